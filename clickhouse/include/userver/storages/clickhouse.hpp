@@ -4,6 +4,7 @@
 /// This file is mainly for documentation purposes and inclusion of all headers
 /// that are required for working with ClickHouse µserver component.
 
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
 #include <userver/storages/clickhouse/cluster.hpp>
 #include <userver/storages/clickhouse/component.hpp>
 #include <userver/storages/clickhouse/execution_result.hpp>
@@ -20,7 +21,9 @@
 /// - Connection pooling;
 /// - Variadic template query parameter passing;
 /// - Query result extraction to C++ types;
-/// - Mapping C++ types to native ClickHouse types.
+/// - Mapping C++ types to native ClickHouse types;
+/// - Batched background inserts of single rows, see
+///   storages::clickhouse::BufferedInserter.
 ///
 /// @section info More information
 /// - For configuration see components::ClickHouse
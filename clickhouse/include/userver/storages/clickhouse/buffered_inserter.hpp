@@ -0,0 +1,249 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// Settings of storages::clickhouse::BufferedInserter
+struct BufferedInserterSettings final {
+  /// The buffered rows are inserted as soon as there are this many of them
+  std::size_t max_rows{10'000};
+
+  /// The buffered rows are inserted at least this often
+  std::chrono::milliseconds flush_interval{std::chrono::seconds{1}};
+
+  /// The rows appended over this limit are dropped, must be at least
+  /// `max_rows`. The rows of the failed inserts are kept within the limit
+  /// to be retried with the next flush.
+  std::size_t max_buffered_rows{100'000};
+
+  /// Command control of the inserts
+  OptionalCommandControl command_control;
+};
+
+namespace impl {
+
+class BufferedInserterBase {
+ public:
+  /// Writes the `rows-inserted`, `rows-dropped`, `insert-errors` and
+  /// `rows-buffered` metrics
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ protected:
+  explicit BufferedInserterBase(BufferedInserterSettings&& settings);
+  ~BufferedInserterBase();
+
+  void StartFlusher();
+  void StopFlusher();
+  void NotifyFull();
+
+  virtual void Flush() = 0;
+
+  const BufferedInserterSettings settings_;
+
+  std::atomic<std::size_t> rows_inserted_{0};
+  std::atomic<std::size_t> rows_dropped_{0};
+  std::atomic<std::size_t> insert_errors_{0};
+  std::atomic<std::size_t> rows_buffered_{0};
+
+ private:
+  void RunFlusher();
+
+  engine::SingleConsumerEvent full_event_;
+  engine::TaskWithResult<void> flusher_;
+};
+
+}  // namespace impl
+
+// clang-format off
+
+/// @brief Accepts single rows from many tasks and inserts them into a ClickHouse
+/// table in large batches in background
+///
+/// Append only moves the row into a buffer, so the writers are never blocked
+/// by ClickHouse. The buffered rows are transposed into the columns and
+/// inserted with storages::clickhouse::Cluster::InsertRows by a background
+/// task, as soon as there are BufferedInserterSettings::max_rows of them or
+/// at least every BufferedInserterSettings::flush_interval. The rest of the
+/// rows are inserted on destruction.
+///
+/// `T` has the same requirements as the rows of
+/// storages::clickhouse::Cluster::InsertRows, see @ref clickhouse_io.
+///
+/// Unlike inserts of the ClickHouse `async_insert` mode, the rows are
+/// batched on the client side, so the setting is not needed. The setting may
+/// still be enabled in the settings profile of the user to merge the batches
+/// of several hosts of the service on the server side.
+///
+/// ## Example:
+///
+/// @code
+/// storages::clickhouse::BufferedInserter<Event> inserter{
+///     cluster, "events", {"id", "name", "time"}};
+/// inserter.Append(Event{42, "click", std::chrono::system_clock::now()});
+/// @endcode
+
+// clang-format on
+
+template <typename T>
+class BufferedInserter final : public impl::BufferedInserterBase {
+ public:
+  /// @param cluster the cluster to insert into
+  /// @param table_name table to insert into
+  /// @param column_names names of columns of the table
+  /// @param settings the batching settings
+  BufferedInserter(std::shared_ptr<Cluster> cluster, std::string table_name,
+                   std::vector<std::string> column_names,
+                   BufferedInserterSettings settings = {});
+
+  /// Inserts the rest of the buffered rows
+  ~BufferedInserter();
+
+  BufferedInserter(const BufferedInserter&) = delete;
+  BufferedInserter& operator=(const BufferedInserter&) = delete;
+
+  /// @brief Buffers the row for insertion
+  /// @returns false if the row is dropped because of
+  /// BufferedInserterSettings::max_buffered_rows
+  bool Append(T row);
+
+  /// @brief Inserts the buffered rows right away
+  /// @throws std::exception of the failed insert, the rows of the failed insert
+  /// are buffered again
+  void Flush() override;
+
+ private:
+  void Requeue(std::vector<T>&& rows);
+
+  const std::shared_ptr<Cluster> cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_name_views_;
+
+  engine::Mutex buffer_mutex_;
+  std::vector<T> buffer_;
+  // Serializes the flushes of the background task and of the user
+  engine::Mutex flush_mutex_;
+};
+
+template <typename T>
+BufferedInserter<T>::BufferedInserter(std::shared_ptr<Cluster> cluster,
+                                      std::string table_name,
+                                      std::vector<std::string> column_names,
+                                      BufferedInserterSettings settings)
+    : BufferedInserterBase(std::move(settings)),
+      cluster_(std::move(cluster)),
+      table_name_(std::move(table_name)),
+      column_names_(std::move(column_names)),
+      column_name_views_(column_names_.begin(), column_names_.end()) {
+  UASSERT(cluster_);
+  buffer_.reserve(settings_.max_rows);
+  StartFlusher();
+}
+
+template <typename T>
+BufferedInserter<T>::~BufferedInserter() {
+  StopFlusher();
+  try {
+    Flush();
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to insert the rest of the buffered rows into "
+                << table_name_ << ": " << ex;
+    rows_dropped_ += rows_buffered_.load();
+  }
+}
+
+template <typename T>
+bool BufferedInserter<T>::Append(T row) {
+  std::size_t size = 0;
+  {
+    const std::lock_guard lock{buffer_mutex_};
+    if (buffer_.size() >= settings_.max_buffered_rows) {
+      ++rows_dropped_;
+      return false;
+    }
+    buffer_.push_back(std::move(row));
+    size = buffer_.size();
+  }
+  ++rows_buffered_;
+
+  if (size == settings_.max_rows) NotifyFull();
+  return true;
+}
+
+template <typename T>
+void BufferedInserter<T>::Flush() {
+  const std::lock_guard flush_lock{flush_mutex_};
+
+  std::vector<T> rows;
+  {
+    const std::lock_guard lock{buffer_mutex_};
+    rows.swap(buffer_);
+  }
+
+  std::size_t offset = 0;
+  while (offset < rows.size()) {
+    const auto count = std::min(settings_.max_rows, rows.size() - offset);
+    const auto begin = rows.begin() + offset;
+    std::vector<T> batch{std::make_move_iterator(begin),
+                         std::make_move_iterator(begin + count)};
+    try {
+      cluster_->InsertRows(settings_.command_control, table_name_,
+                           column_name_views_, batch);
+    } catch (const std::exception&) {
+      ++insert_errors_;
+      Requeue(std::move(batch));
+      Requeue({std::make_move_iterator(begin + count),
+               std::make_move_iterator(rows.end())});
+      throw;
+    }
+    offset += count;
+    rows_buffered_ -= count;
+    rows_inserted_ += count;
+  }
+}
+
+template <typename T>
+void BufferedInserter<T>::Requeue(std::vector<T>&& rows) {
+  std::size_t dropped = 0;
+  {
+    const std::lock_guard lock{buffer_mutex_};
+    const auto room = settings_.max_buffered_rows -
+                      std::min(settings_.max_buffered_rows, buffer_.size());
+    const auto kept = std::min(room, rows.size());
+    buffer_.insert(buffer_.end(), std::make_move_iterator(rows.begin()),
+                   std::make_move_iterator(rows.begin() + kept));
+    dropped = rows.size() - kept;
+  }
+  rows_buffered_ -= dropped;
+  rows_dropped_ += dropped;
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
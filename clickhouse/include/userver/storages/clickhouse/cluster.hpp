@@ -60,6 +60,32 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster
+  /// with args as query parameters and pass each block of the result to
+  /// `handler` as soon as it is received.
+  ///
+  /// Only a single block of the result is kept in memory at a time, so this
+  /// is the way to process the results that don't fit into memory. Each block
+  /// is an ExecutionResult on its own and can be mapped with `As<T>()` into
+  /// a struct of vectors or iterated with `AsRows<T>()` row by row.
+  ///
+  /// The exceptions thrown by `handler` abort the query and are rethrown.
+  /// @note The execute timeout of the command control limits the whole query,
+  /// including the time spent in `handler`.
+  ///
+  /// @snippet storages/tests/execute_chtest.cpp  Sample ExecuteStreaming usage
+  template <typename... Args>
+  void ExecuteStreaming(BlockHandler handler, const Query& query,
+                        const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters and pass each
+  /// block of the result to `handler` as soon as it is received.
+  /// @see ExecuteStreaming
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl, BlockHandler handler,
+                        const Query& query, const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -131,6 +157,9 @@ class Cluster final {
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, BlockHandler handler,
+                          const Query& query) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +218,20 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(BlockHandler handler, const Query& query,
+                               const Args&... args) const {
+  ExecuteStreaming(OptionalCommandControl{}, handler, query, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               BlockHandler handler, const Query& query,
+                               const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, handler, formatted_query);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
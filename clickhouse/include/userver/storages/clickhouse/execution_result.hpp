@@ -12,6 +12,7 @@
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
 #include <userver/storages/clickhouse/io/result_mapper.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -100,6 +101,11 @@ Container ExecutionResult::AsContainer() && {
   return result;
 }
 
+/// Handler of the blocks of a result streamed by
+/// storages::clickhouse::Cluster ExecuteStreaming methods
+using BlockHandler =
+    USERVER_NAMESPACE::utils::function_ref<void(ExecutionResult&& block)>;
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/storages/clickhouse/io/columns/int32_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int64_column.hpp>
 #include <userver/storages/clickhouse/io/columns/int8_column.hpp>
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
 #include <userver/storages/clickhouse/io/columns/string_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint16_column.hpp>
 #include <userver/storages/clickhouse/io/columns/uint32_column.hpp>
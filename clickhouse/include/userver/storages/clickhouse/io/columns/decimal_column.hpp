@@ -0,0 +1,129 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/decimal_column.hpp
+/// @brief Decimal column support
+/// @ingroup userver_clickhouse_types
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+ColumnRef GetDecimalColumn(ColumnRef column, int scale);
+std::int64_t ExtractDecimalItem(const ColumnRef& column, std::size_t ind);
+ColumnRef ConvertDecimalsToColumn(int scale,
+                                  const std::vector<std::int64_t>& unbiased);
+
+/// @brief Represents ClickHouse Decimal(P, S) column with `S == Prec`,
+/// mapped to decimal64::Decimal<Prec, RoundPolicy>
+///
+/// Any precision is accepted for reading as long as the values fit into
+/// decimal64::Decimal, the columns are serialized as Decimal64(Prec), which
+/// is Decimal(18, Prec).
+template <int Prec, typename RoundPolicy = decimal64::DefRoundPolicy>
+class DecimalColumn final
+    : public ClickhouseColumn<DecimalColumn<Prec, RoundPolicy>> {
+ public:
+  using cpp_type = decimal64::Decimal<Prec, RoundPolicy>;
+  using container_type = std::vector<cpp_type>;
+
+  DecimalColumn(ColumnRef column);
+
+  class DecimalDataHolder final {
+   public:
+    DecimalDataHolder() = default;
+    DecimalDataHolder(
+        typename ColumnIterator<DecimalColumn>::IteratorPosition iter_position,
+        ColumnRef&& column);
+
+    DecimalDataHolder operator++(int);
+    DecimalDataHolder& operator++();
+    cpp_type& UpdateValue();
+
+    bool operator==(const DecimalDataHolder& other) const;
+
+   private:
+    ColumnRef column_{};
+    std::size_t ind_{0};
+    std::optional<cpp_type> current_value_ = std::nullopt;
+  };
+  using iterator_data = DecimalDataHolder;
+
+  static ColumnRef Serialize(const container_type& from);
+};
+
+template <int Prec, typename RoundPolicy>
+DecimalColumn<Prec, RoundPolicy>::DecimalColumn(ColumnRef column)
+    : ClickhouseColumn<DecimalColumn>{
+          GetDecimalColumn(std::move(column), Prec)} {}
+
+template <int Prec, typename RoundPolicy>
+DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder::DecimalDataHolder(
+    typename ColumnIterator<DecimalColumn>::IteratorPosition iter_position,
+    ColumnRef&& column)
+    : column_{std::move(column)},
+      ind_(iter_position == decltype(iter_position)::kEnd
+               ? GetColumnSize(column_)
+               : 0) {}
+
+template <int Prec, typename RoundPolicy>
+typename DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder
+DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder::operator++(int) {
+  DecimalDataHolder old{};
+  old.column_ = column_;
+  old.ind_ = ind_++;
+  old.current_value_ = std::exchange(current_value_, std::nullopt);
+
+  return old;
+}
+
+template <int Prec, typename RoundPolicy>
+typename DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder&
+DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder::operator++() {
+  ++ind_;
+  current_value_.reset();
+
+  return *this;
+}
+
+template <int Prec, typename RoundPolicy>
+typename DecimalColumn<Prec, RoundPolicy>::cpp_type&
+DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder::UpdateValue() {
+  UASSERT(ind_ < GetColumnSize(column_));
+  if (!current_value_.has_value()) {
+    current_value_.emplace(
+        cpp_type::FromUnbiased(ExtractDecimalItem(column_, ind_)));
+  }
+
+  return *current_value_;
+}
+
+template <int Prec, typename RoundPolicy>
+bool DecimalColumn<Prec, RoundPolicy>::DecimalDataHolder::operator==(
+    const DecimalDataHolder& other) const {
+  return column_.get() == other.column_.get() && ind_ == other.ind_;
+}
+
+template <int Prec, typename RoundPolicy>
+ColumnRef DecimalColumn<Prec, RoundPolicy>::Serialize(
+    const container_type& from) {
+  std::vector<std::int64_t> unbiased;
+  unbiased.reserve(from.size());
+  for (const auto& value : from) {
+    unbiased.push_back(value.AsUnbiased());
+  }
+
+  return ConvertDecimalsToColumn(Prec, unbiased);
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,165 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/map_column.hpp
+/// @brief Map column support
+/// @ingroup userver_clickhouse_types
+
+#include <map>
+#include <optional>
+
+#include <userver/utils/assert.hpp>
+
+#include <userver/storages/clickhouse/io/columns/column_includes.hpp>
+#include <userver/storages/clickhouse/io/columns/common_columns.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+struct MapColumnMeta final {
+  ColumnRef keys;
+  ColumnRef values;
+  ColumnRef offsets;
+};
+
+ColumnRef ConvertMetaToColumn(MapColumnMeta&& meta);
+MapColumnMeta ExtractMapItem(const ColumnRef& column, std::size_t ind);
+
+/// @brief Represents ClickHouse Map(K, V) column,
+/// where K and V are ClickhouseColumn as well
+///
+/// The values are mapped to std::map, so only the last of the duplicate keys
+/// of a ClickHouse map is kept.
+template <typename K, typename V>
+class MapColumn final : public ClickhouseColumn<MapColumn<K, V>> {
+ public:
+  using cpp_type = std::map<typename K::cpp_type, typename V::cpp_type>;
+  using container_type = std::vector<cpp_type>;
+
+  MapColumn(ColumnRef column);
+
+  class MapDataHolder final {
+   public:
+    MapDataHolder() = default;
+    MapDataHolder(
+        typename ColumnIterator<MapColumn>::IteratorPosition iter_position,
+        ColumnRef&& column);
+
+    MapDataHolder operator++(int);
+    MapDataHolder& operator++();
+    cpp_type& UpdateValue();
+
+    bool operator==(const MapDataHolder& other) const;
+
+   private:
+    ColumnRef inner_{};
+    std::size_t ind_{0};
+    std::optional<cpp_type> current_value_ = std::nullopt;
+  };
+  using iterator_data = MapDataHolder;
+
+  static ColumnRef Serialize(const container_type& from);
+  static cpp_type RetrieveElement(const ColumnRef& ref, std::size_t ind);
+};
+
+template <typename K, typename V>
+MapColumn<K, V>::MapDataHolder::MapDataHolder(
+    typename ColumnIterator<MapColumn<K, V>>::IteratorPosition iter_position,
+    ColumnRef&& column)
+    : inner_{std::move(column)},
+      ind_(iter_position == decltype(iter_position)::kEnd
+               ? GetColumnSize(inner_)
+               : 0) {}
+
+template <typename K, typename V>
+typename MapColumn<K, V>::MapDataHolder
+MapColumn<K, V>::MapDataHolder::operator++(int) {
+  MapDataHolder old{};
+  old.inner_ = inner_;
+  old.ind_ = ind_++;
+  old.current_value_ = std::move_if_noexcept(current_value_);
+  current_value_.reset();
+
+  return old;
+}
+
+template <typename K, typename V>
+typename MapColumn<K, V>::MapDataHolder&
+MapColumn<K, V>::MapDataHolder::operator++() {
+  ++ind_;
+  current_value_.reset();
+
+  return *this;
+}
+
+template <typename K, typename V>
+typename MapColumn<K, V>::cpp_type&
+MapColumn<K, V>::MapDataHolder::UpdateValue() {
+  UASSERT(ind_ < GetColumnSize(inner_));
+  if (!current_value_.has_value()) {
+    cpp_type item = RetrieveElement(inner_, ind_);
+    current_value_.emplace(std::move(item));
+  }
+
+  return *current_value_;
+}
+
+template <typename K, typename V>
+bool MapColumn<K, V>::MapDataHolder::operator==(
+    const MapDataHolder& other) const {
+  return inner_.get() == other.inner_.get() && ind_ == other.ind_;
+}
+
+template <typename K, typename V>
+MapColumn<K, V>::MapColumn(ColumnRef column)
+    : ClickhouseColumn<MapColumn>{column} {}
+
+template <typename K, typename V>
+ColumnRef MapColumn<K, V>::Serialize(const container_type& from) {
+  uint64_t cumulative_offset = 0;
+  std::vector<uint64_t> offsets;
+  offsets.reserve(from.size());
+
+  for (const auto& value : from) {
+    cumulative_offset += value.size();
+    offsets.push_back(cumulative_offset);
+  }
+  typename K::container_type keys;
+  keys.reserve(cumulative_offset);
+  typename V::container_type values;
+  values.reserve(cumulative_offset);
+
+  for (const auto& value : from) {
+    for (const auto& [key, item] : value) {
+      keys.push_back(key);
+      values.push_back(item);
+    }
+  }
+
+  MapColumnMeta map_meta;
+  map_meta.offsets = UInt64Column::Serialize(offsets);
+  map_meta.keys = K::Serialize(keys);
+  map_meta.values = V::Serialize(values);
+
+  return ConvertMetaToColumn(std::move(map_meta));
+}
+
+template <typename K, typename V>
+typename MapColumn<K, V>::cpp_type MapColumn<K, V>::RetrieveElement(
+    const ColumnRef& ref, std::size_t ind) {
+  auto map_item = ExtractMapItem(ref, ind);
+  K keys_column(map_item.keys);
+  V values_column(map_item.values);
+
+  cpp_type result;
+  auto value_it = values_column.begin();
+  for (auto key_it = keys_column.begin(); key_it != keys_column.end();
+       ++key_it, ++value_it) {
+    result.insert_or_assign(std::move(*key_it), std::move(*value_it));
+  }
+  return result;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
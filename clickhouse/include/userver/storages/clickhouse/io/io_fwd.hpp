@@ -29,10 +29,14 @@ namespace storages::clickhouse::io {
 /// - UInt32 @ref storages::clickhouse::io::columns::UInt32Column
 /// - UInt64 @ref storages::clickhouse::io::columns::UInt64Column
 /// - String @ref storages::clickhouse::io::columns::StringColumn
+/// - LowCardinality(String) @ref storages::clickhouse::io::columns::LowCardinalityStringColumn
 /// - UUID @ref storages::clickhouse::io::columns::UuidColumn
 /// - Nullable @ref storages::clickhouse::io::columns::NullableColumn
 /// - Float32 @ref storages::clickhouse::io::columns::Float32Column
 /// - Float64 @ref storages::clickhouse::io::columns::Float64Column
+/// - Decimal(P, S) @ref storages::clickhouse::io::columns::DecimalColumn
+/// - Array @ref storages::clickhouse::io::columns::ArrayColumn
+/// - Map @ref storages::clickhouse::io::columns::MapColumn
 ///
 /// ## Example usage:
 ///
@@ -0,0 +1,60 @@
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+BufferedInserterBase::BufferedInserterBase(BufferedInserterSettings&& settings)
+    : settings_(std::move(settings)) {
+  UINVARIANT(settings_.max_rows > 0, "max_rows must be positive");
+  UINVARIANT(settings_.max_buffered_rows >= settings_.max_rows,
+             "max_buffered_rows must be at least max_rows");
+}
+
+BufferedInserterBase::~BufferedInserterBase() {
+  UASSERT_MSG(!flusher_.IsValid(), "StopFlusher was not called");
+}
+
+void BufferedInserterBase::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer["rows-inserted"] = rows_inserted_.load();
+  writer["rows-dropped"] = rows_dropped_.load();
+  writer["insert-errors"] = insert_errors_.load();
+  writer["rows-buffered"] = rows_buffered_.load();
+}
+
+void BufferedInserterBase::StartFlusher() {
+  flusher_ = USERVER_NAMESPACE::utils::CriticalAsync(
+      "clickhouse-buffered-inserter", [this] { RunFlusher(); });
+}
+
+void BufferedInserterBase::StopFlusher() {
+  if (!flusher_.IsValid()) return;
+  flusher_.SyncCancel();
+  flusher_ = {};
+}
+
+void BufferedInserterBase::NotifyFull() { full_event_.Send(); }
+
+void BufferedInserterBase::RunFlusher() {
+  while (!engine::current_task::ShouldCancel()) {
+    // Either the buffer is full or the flush interval has passed
+    [[maybe_unused]] const auto is_full =
+        full_event_.WaitForEventFor(settings_.flush_interval);
+    if (engine::current_task::ShouldCancel()) break;
+
+    try {
+      Flush();
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to insert the buffered rows: " << ex;
+    }
+  }
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
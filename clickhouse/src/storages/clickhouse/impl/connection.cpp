@@ -104,6 +104,30 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  BlockHandler handler, const Query& query) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+    // we must return 'true' if we don't want to cancel query
+    return !engine::current_task::ShouldCancel();
+  });
+
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  // clickhouse-cpp reads each block into new columns, so the block is passed
+  // to the handler without copying the data
+  native_query.OnData([handler, &scope](const NativeBlock& data) {
+    scope.Reset(scopes::kExec);
+    if (data.GetColumnCount() == 0 || data.GetRowCount() == 0) return;
+
+    auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+    handler(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+  });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
@@ -28,6 +28,8 @@ class Connection final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+  void ExecuteStreaming(OptionalCommandControl, BlockHandler, const Query&);
+
   void Insert(OptionalCommandControl, const InsertionRequest&);
 
   void Ping();
@@ -0,0 +1,64 @@
+#include <userver/storages/clickhouse/io/columns/decimal_column.hpp>
+
+#include <limits>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/decimal.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnDecimal;
+
+// Decimal64, the widest Decimal that fits into int64_t
+constexpr std::size_t kSerializedPrecision = 18;
+}  // namespace
+
+ColumnRef GetDecimalColumn(ColumnRef column, int scale) {
+  const auto decimal = column->As<NativeType>();
+  if (!decimal) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Decimal",
+                    column->Type()->GetName())};
+  }
+  if (decimal->GetScale() != static_cast<std::size_t>(scale)) {
+    throw std::runtime_error{
+        fmt::format("failed to map column of type '{}' to Decimal with {} "
+                    "fractional digits",
+                    column->Type()->GetName(), scale)};
+  }
+
+  return column;
+}
+
+std::int64_t ExtractDecimalItem(const ColumnRef& column, std::size_t ind) {
+  const auto value = impl::NativeGetAt<NativeType>(column, ind);
+  if (value > std::numeric_limits<std::int64_t>::max() ||
+      value < std::numeric_limits<std::int64_t>::min()) {
+    throw std::runtime_error{fmt::format(
+        "value of column of type '{}' does not fit into decimal64::Decimal",
+        column->Type()->GetName())};
+  }
+
+  return static_cast<std::int64_t>(value);
+}
+
+ColumnRef ConvertDecimalsToColumn(int scale,
+                                  const std::vector<std::int64_t>& unbiased) {
+  auto column = std::make_shared<NativeType>(kSerializedPrecision,
+                                             static_cast<std::size_t>(scale));
+  for (const auto value : unbiased) {
+    column->Append(clickhouse::impl::clickhouse_cpp::Int128{value});
+  }
+
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/lowcardinality.h>
+#include <clickhouse/columns/string.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using NativeType = clickhouse::impl::clickhouse_cpp::ColumnLowCardinalityT<
+    clickhouse::impl::clickhouse_cpp::ColumnString>;
+// clickhouse-cpp unwraps LowCardinality columns into their dictionary type
+// when reading by default
+using UnwrappedNativeType = clickhouse::impl::clickhouse_cpp::ColumnString;
+
+ColumnRef GetLowCardinalityColumn(ColumnRef column) {
+  if (column->As<UnwrappedNativeType>()) return column;
+  return impl::GetTypedColumn<LowCardinalityStringColumn, NativeType>(column);
+}
+
+}  // namespace
+
+LowCardinalityStringColumn::LowCardinalityStringColumn(ColumnRef column)
+    : ClickhouseColumn{GetLowCardinalityColumn(std::move(column))} {}
+
+template <>
+LowCardinalityStringColumn::cpp_type
+ColumnIterator<LowCardinalityStringColumn>::DataHolder::Get() const {
+  if (const auto* column = dynamic_cast<const NativeType*>(column_.get())) {
+    return std::string{column->At(ind_)};
+  }
+  return std::string{impl::NativeGetAt<UnwrappedNativeType>(column_, ind_)};
+}
+
+ColumnRef LowCardinalityStringColumn::Serialize(const container_type& from) {
+  auto column = std::make_shared<NativeType>();
+  for (const auto& value : from) {
+    column->Append(std::string_view{value});
+  }
+  return column;
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#include <userver/storages/clickhouse/io/columns/map_column.hpp>
+
+#include <storages/clickhouse/io/columns/impl/column_includes.hpp>
+
+#include <clickhouse/columns/array.h>
+#include <clickhouse/columns/map.h>
+#include <clickhouse/columns/tuple.h>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+namespace {
+using MapNativeType = clickhouse::impl::clickhouse_cpp::ColumnMap;
+using TupleNativeType = clickhouse::impl::clickhouse_cpp::ColumnTuple;
+using ArrayNativeType = clickhouse::impl::clickhouse_cpp::ColumnArray;
+using UInt64NativeType = clickhouse::impl::clickhouse_cpp::ColumnUInt64;
+}  // namespace
+
+MapColumnMeta ExtractMapItem(const ColumnRef& column, std::size_t ind) {
+  const auto map_native = column->As<MapNativeType>();
+  if (!map_native) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to Map",
+                    column->Type()->GetName())};
+  }
+
+  const auto item = map_native->GetAsColumn(ind);
+  const auto tuple = item->As<TupleNativeType>();
+  UINVARIANT(tuple && tuple->TupleSize() == 2, "Map item is not a key-value");
+
+  MapColumnMeta result;
+  result.keys = (*tuple)[0];
+  result.values = (*tuple)[1];
+  return result;
+}
+
+ColumnRef ConvertMetaToColumn(MapColumnMeta&& meta) {
+  auto offsets_native =
+      impl::GetTypedColumn<UInt64Column, UInt64NativeType>(meta.offsets);
+  auto tuple_native = std::make_shared<TupleNativeType>(
+      std::vector<ColumnRef>{std::move(meta.keys), std::move(meta.values)});
+  auto array_native = std::make_shared<ArrayNativeType>(
+      std::move(tuple_native), std::move(offsets_native));
+  return std::make_shared<MapNativeType>(std::move(array_native));
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/utils/async.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EventRow final {
+  uint64_t id{};
+  std::string name;
+};
+
+struct EventIds final {
+  std::vector<uint64_t> ids;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<EventRow> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<EventIds> {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+using storages::clickhouse::BufferedInserter;
+using storages::clickhouse::BufferedInserterSettings;
+
+std::shared_ptr<storages::clickhouse::Cluster> MakeNonOwning(
+    ClusterWrapper& cluster) {
+  return {std::shared_ptr<void>{}, &*cluster};
+}
+
+void CreateTable(ClusterWrapper& cluster, const std::string& name) {
+  cluster->Execute("DROP TABLE IF EXISTS " + name);
+  cluster->Execute("CREATE TABLE " + name +
+                   " (id UInt64, name String) ENGINE = Memory");
+}
+
+std::size_t CountRows(ClusterWrapper& cluster, const std::string& name) {
+  return cluster->Execute("SELECT id FROM " + name).As<EventIds>().ids.size();
+}
+
+}  // namespace
+
+UTEST(BufferedInserter, FlushBySize) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster, "buffered_by_size");
+
+  BufferedInserterSettings settings;
+  settings.max_rows = 10;
+  settings.flush_interval = std::chrono::hours{1};
+  BufferedInserter<EventRow> inserter{MakeNonOwning(cluster),
+                                      "buffered_by_size", {"id", "name"},
+                                      settings};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (uint64_t task = 0; task < 5; ++task) {
+    tasks.push_back(utils::Async("writer", [&inserter, task] {
+      for (uint64_t i = 0; i < 2; ++i) {
+        EXPECT_TRUE(inserter.Append({task * 2 + i, "event"}));
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  while (CountRows(cluster, "buffered_by_size") != 10) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+}
+
+UTEST(BufferedInserter, FlushOnDestruction) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster, "buffered_on_destruction");
+
+  BufferedInserterSettings settings;
+  settings.flush_interval = std::chrono::hours{1};
+  {
+    BufferedInserter<EventRow> inserter{MakeNonOwning(cluster),
+                                        "buffered_on_destruction",
+                                        {"id", "name"}, settings};
+    EXPECT_TRUE(inserter.Append({1, "first"}));
+    EXPECT_TRUE(inserter.Append({2, "second"}));
+    EXPECT_EQ(CountRows(cluster, "buffered_on_destruction"), 0);
+  }
+  EXPECT_EQ(CountRows(cluster, "buffered_on_destruction"), 2);
+}
+
+UTEST(BufferedInserter, DropsOverLimit) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster, "buffered_over_limit");
+
+  BufferedInserterSettings settings;
+  settings.max_rows = 2;
+  settings.max_buffered_rows = 2;
+  settings.flush_interval = std::chrono::hours{1};
+  BufferedInserter<EventRow> inserter{MakeNonOwning(cluster),
+                                      "buffered_over_limit", {"id", "name"},
+                                      settings};
+
+  EXPECT_TRUE(inserter.Append({1, "first"}));
+  EXPECT_TRUE(inserter.Append({2, "second"}));
+  // The background flush has not started yet
+  EXPECT_FALSE(inserter.Append({3, "third"}));
+
+  inserter.Flush();
+  EXPECT_EQ(CountRows(cluster, "buffered_over_limit"), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -8,7 +8,7 @@ USERVER_NAMESPACE_BEGIN
 
 UTEST(Cluster, NoAvailablePools) {
   ClusterWrapper cluster{
-      false,
+      "none",
       {{"unresolved1", 11111}, {"unresolved2", 12222}, {"unresolved3", 12333}}};
 
   EXPECT_THROW(cluster->Execute("Invalid_query"),
@@ -0,0 +1,79 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/io/columns/decimal_column.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4>;
+
+struct DataWithDecimals final {
+  std::vector<Money> values;
+  std::vector<int32_t> key;
+};
+
+struct DecimalRow final {
+  Money value;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithDecimals> {
+  using mapped_type =
+      std::tuple<columns::DecimalColumn<4>, columns::Int32Column>;
+};
+
+template <>
+struct CppToClickhouse<DecimalRow> {
+  using mapped_type = std::tuple<columns::DecimalColumn<4>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Decimal, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value Decimal64(4), key Int32)");
+
+  const DataWithDecimals insertion_data{
+      {Money{"1.2345"}, Money{"-0.0001"}, Money{"123456789.5"}}, {1, 2, 3}};
+  cluster->Insert("tmp_table", {"value", "key"}, insertion_data);
+
+  const auto res =
+      cluster->Execute("SELECT value, key FROM tmp_table ORDER BY key")
+          .As<DataWithDecimals>();
+  EXPECT_EQ(res.values, insertion_data.values);
+  EXPECT_EQ(res.key, insertion_data.key);
+}
+
+UTEST(Decimal, OtherPrecisions) {
+  ClusterWrapper cluster{};
+  const auto res =
+      cluster
+          ->Execute(
+              "SELECT toDecimal32('3.1415', 4) UNION ALL "
+              "SELECT toDecimal128('-2.7182', 4)")
+          .AsContainer<std::vector<DecimalRow>>();
+  ASSERT_EQ(res.size(), 2);
+}
+
+UTEST(Decimal, ScaleMismatch) {
+  ClusterWrapper cluster{};
+  UEXPECT_THROW(cluster->Execute("SELECT toDecimal64('1.5', 2)")
+                    .AsContainer<std::vector<DecimalRow>>(),
+                std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -75,6 +75,52 @@ UTEST(Execute, MappingWorks) {
   EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, Streaming) {
+  ClusterWrapper cluster{};
+
+  const storages::clickhouse::Query q{
+      "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+      "FROM numbers(0, 10000) c SETTINGS max_block_size = 1000"};
+
+  /// [Sample ExecuteStreaming usage]
+  std::size_t blocks = 0;
+  uint64_t sum = 0;
+  cluster->ExecuteStreaming(
+      [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        for (auto&& row : std::move(block).AsRows<RowData>()) {
+          sum += row.number;
+        }
+      },
+      q);
+  /// [Sample ExecuteStreaming usage]
+
+  EXPECT_GT(blocks, 1);
+  EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+}
+
+UTEST(Execute, StreamingHandlerThrows) {
+  ClusterWrapper cluster{};
+
+  const storages::clickhouse::Query q{
+      "SELECT c.number FROM numbers(0, 10000) c "
+      "SETTINGS max_block_size = 1000"};
+
+  std::size_t blocks = 0;
+  UEXPECT_THROW(cluster->ExecuteStreaming(
+                    [&blocks](storages::clickhouse::ExecutionResult&&) {
+                      ++blocks;
+                      throw std::runtime_error{"stop"};
+                    },
+                    q),
+                std::runtime_error);
+  EXPECT_EQ(blocks, 1);
+
+  // the connection is not reused after the interrupted query
+  const auto result = cluster->Execute(common_query).As<Data>();
+  EXPECT_EQ(result.numbers.size(), 10000);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
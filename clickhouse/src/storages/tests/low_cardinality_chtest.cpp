@@ -0,0 +1,74 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/io/columns/low_cardinality_string_column.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DataWithLowCardinality final {
+  std::vector<std::string> values;
+  std::vector<int32_t> key;
+};
+
+struct RowWithLowCardinality final {
+  std::string value;
+  int32_t key;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithLowCardinality> {
+  using mapped_type =
+      std::tuple<columns::LowCardinalityStringColumn, columns::Int32Column>;
+};
+
+template <>
+struct CppToClickhouse<RowWithLowCardinality> {
+  using mapped_type =
+      std::tuple<columns::LowCardinalityStringColumn, columns::Int32Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(LowCardinality, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value LowCardinality(String), key Int32)");
+
+  const DataWithLowCardinality insertion_data{{"a", "b", "a", "", "b"},
+                                              {1, 2, 3, 4, 5}};
+  cluster->Insert("tmp_table", {"value", "key"}, insertion_data);
+
+  const auto res =
+      cluster->Execute("SELECT value, key FROM tmp_table ORDER BY key")
+          .As<DataWithLowCardinality>();
+  EXPECT_EQ(res.values, insertion_data.values);
+  EXPECT_EQ(res.key, insertion_data.key);
+}
+
+UTEST(LowCardinality, IterationWorks) {
+  ClusterWrapper cluster{};
+  const auto res = cluster
+                       ->Execute(
+                           "SELECT toLowCardinality(toString(c.number % 3)), "
+                           "toInt32(c.number) FROM system.numbers c LIMIT 10")
+                       .AsContainer<std::vector<RowWithLowCardinality>>();
+  ASSERT_EQ(res.size(), 10);
+  for (const auto& row : res) {
+    EXPECT_EQ(row.value, std::to_string(row.key % 3));
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <userver/utest/utest.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/io/columns/map_column.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = std::map<std::string, uint64_t>;
+
+struct DataWithMaps final {
+  std::vector<Map> maps;
+  std::vector<int32_t> key;
+};
+
+struct MapRow final {
+  uint64_t value;
+  Map map;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<DataWithMaps> {
+  using mapped_type = std::tuple<
+      columns::MapColumn<columns::StringColumn, columns::UInt64Column>,
+      columns::Int32Column>;
+};
+
+template <>
+struct CppToClickhouse<MapRow> {
+  using mapped_type = std::tuple<
+      columns::UInt64Column,
+      columns::MapColumn<columns::StringColumn, columns::UInt64Column>>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST(Map, InsertSelect) {
+  ClusterWrapper cluster{};
+  cluster->Execute(
+      "CREATE TEMPORARY TABLE IF NOT EXISTS tmp_table "
+      "(value Map(String, UInt64), key Int32)");
+
+  const DataWithMaps insertion_data{
+      {Map{{"a", 1}, {"b", 2}}, Map{}, Map{{"c", 3}}}, {1, 2, 3}};
+  cluster->Insert("tmp_table", {"value", "key"}, insertion_data);
+
+  const auto res =
+      cluster->Execute("SELECT value, key FROM tmp_table ORDER BY key")
+          .As<DataWithMaps>();
+  EXPECT_EQ(res.maps, insertion_data.maps);
+  EXPECT_EQ(res.key, insertion_data.key);
+}
+
+UTEST(Map, IterationWorks) {
+  ClusterWrapper cluster{};
+  auto res = cluster
+                 ->Execute(
+                     "SELECT c.number, CAST((arrayMap(x->toString(x), "
+                     "range(0, c.number)), range(0, c.number)), "
+                     "'Map(String, UInt64)') FROM system.numbers c LIMIT 10")
+                 .AsRows<MapRow>();
+  size_t ind = 0;
+  for (auto it = res.begin(); it != res.end(); it++, ++ind) {
+    ASSERT_EQ(it->value, ind);
+    ASSERT_EQ(it->map.size(), ind);
+    for (size_t count = 0; count < ind; ++count) {
+      ASSERT_EQ(it->map.at(std::to_string(count)), count);
+    }
+  }
+  ASSERT_EQ(ind, 10);
+}
+
+USERVER_NAMESPACE_END
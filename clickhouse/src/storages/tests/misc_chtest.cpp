@@ -88,13 +88,15 @@ UTEST(Query, Works) {
 }
 
 UTEST(Compression, Works) {
-  ClusterWrapper cluster{true};
-  storages::clickhouse::Query q{
-      "SELECT c.number, randomString(10), c.number as t, NOW64() "
-      "FROM "
-      "numbers(0, 10000) c "};
-  auto res = cluster->Execute(q).As<SomeData>();
-  EXPECT_EQ(res.vec_str.size(), 10000);
+  for (const auto* compression : {"lz4", "zstd"}) {
+    ClusterWrapper cluster{compression};
+    storages::clickhouse::Query q{
+        "SELECT c.number, randomString(10), c.number as t, NOW64() "
+        "FROM "
+        "numbers(0, 10000) c "};
+    auto res = cluster->Execute(q).As<SomeData>();
+    EXPECT_EQ(res.vec_str.size(), 10000);
+  }
 }
 
 UTEST(Insert, Works) {
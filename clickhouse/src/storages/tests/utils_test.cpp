@@ -22,7 +22,7 @@ clients::dns::Resolver MakeDnsResolver() {
   return clients::dns::Resolver{engine::current_task::GetTaskProcessor(), {}};
 }
 
-components::ComponentConfig GetConfig(bool use_compression) {
+components::ComponentConfig GetConfig(const std::string& compression) {
   USERVER_NAMESPACE::formats::yaml::ValueBuilder config_builder{
       USERVER_NAMESPACE::formats::yaml::FromString(
           R"(
@@ -31,9 +31,7 @@ max_pool_size: 10
 queue_timeout: 1s
 use_secure_connection: false
 use_compression: false)")};
-  if (use_compression) {
-    config_builder["compression"] = "lz4";
-  }
+  config_builder["compression"] = compression;
 
   USERVER_NAMESPACE::yaml_config::YamlConfig yaml_config{
       config_builder.ExtractValue(), {}};
@@ -50,7 +48,7 @@ storages::clickhouse::impl::AuthSettings GetAuthSettings() {
 }
 
 storages::clickhouse::Cluster MakeCluster(
-    clients::dns::Resolver& resolver, bool use_compression,
+    clients::dns::Resolver& resolver, const std::string& compression,
     const std::vector<storages::clickhouse::impl::EndpointSettings>&
         endpoints) {
   storages::clickhouse::impl::ClickhouseSettings settings;
@@ -58,7 +56,7 @@ storages::clickhouse::Cluster MakeCluster(
   settings.endpoints = endpoints;
 
   return storages::clickhouse::Cluster{resolver, settings,
-                                       GetConfig(use_compression)};
+                                       GetConfig(compression)};
 }
 
 }  // namespace
@@ -72,10 +70,10 @@ uint32_t GetClickhousePort() {
 }
 
 ClusterWrapper::ClusterWrapper(
-    bool use_compression,
+    const std::string& compression,
     const std::vector<storages::clickhouse::impl::EndpointSettings>& endpoints)
     : resolver_{MakeDnsResolver()},
-      cluster_{MakeCluster(resolver_, use_compression, endpoints)} {
+      cluster_{MakeCluster(resolver_, compression, endpoints)} {
   stats_holder_ = statistics_storage_.RegisterWriter(
       "clickhouse", [this](utils::statistics::Writer& writer) {
         cluster_.WriteStatistics(writer);
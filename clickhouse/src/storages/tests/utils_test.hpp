@@ -2,6 +2,8 @@
 
 #include <userver/utest/utest.hpp>
 
+#include <string>
+
 #include <storages/clickhouse/impl/pool_impl.hpp>
 #include <storages/clickhouse/impl/settings.hpp>
 #include <userver/clients/dns/resolver.hpp>
@@ -16,7 +18,7 @@ std::uint32_t GetClickhousePort();
 class ClusterWrapper final {
  public:
   ClusterWrapper(
-      bool use_compression = false,
+      const std::string& compression = "none",
       const std::vector<storages::clickhouse::impl::EndpointSettings>&
           endpoints = {{"localhost", GetClickhousePort()}});
 
@@ -26,3 +26,37 @@ function(add_google_benchmark_tests target)
         --benchmark_color=no
     )
 endfunction()
+
+set(USERVER_GBENCH_BASELINE_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/gbench_baseline.py")
+
+# Adds a `${target}-baseline` test that runs the google-benchmark `target` and
+# fails if a benchmark of the BASELINE json (written by --benchmark_out) got
+# slower in cpu_time by more than MAX_REGRESSION, 0.1 (10%) by default.
+# The BASELINE is written if it does not exist. ARGS are passed to the
+# benchmark binary, e.g. --benchmark_filter or --benchmark_repetitions.
+function(add_google_benchmark_baseline_test target)
+    set(oneValueArgs BASELINE MAX_REGRESSION)
+    set(multiValueArgs ARGS)
+    cmake_parse_arguments(
+        ARG "" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    if (NOT ARG_BASELINE)
+        message(FATAL_ERROR "No BASELINE given for ${target}")
+    endif()
+    if (NOT ARG_MAX_REGRESSION)
+        set(ARG_MAX_REGRESSION 0.1)
+    endif()
+    if (USERVER_PYTHON)
+        set(python ${USERVER_PYTHON})
+    else()
+        set(python python3)
+    endif()
+
+    add_test(NAME ${target}-baseline COMMAND ${python}
+        ${USERVER_GBENCH_BASELINE_SCRIPT}
+        --binary $<TARGET_FILE:${target}>
+        --baseline ${ARG_BASELINE}
+        --max-regression ${ARG_MAX_REGRESSION}
+        -- ${ARG_ARGS}
+    )
+endfunction()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+Runs a google-benchmark binary and compares its results with a baseline
+JSON written by `--benchmark_out` of a previous run. Fails if any benchmark
+of the baseline became slower by more than --max-regression.
+
+With --update the baseline is overwritten with the new results instead.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--binary', required=True, help='benchmark binary')
+    parser.add_argument('--baseline', required=True, help='baseline JSON')
+    parser.add_argument(
+        '--max-regression',
+        type=float,
+        default=0.1,
+        help='max allowed relative slowdown of cpu_time, 0.1 is 10%%',
+    )
+    parser.add_argument(
+        '--update',
+        action='store_true',
+        help='overwrite the baseline with the new results',
+    )
+    parser.add_argument(
+        'benchmark_args',
+        nargs='*',
+        help='extra arguments of the benchmark binary, after --',
+    )
+    return parser.parse_args()
+
+
+def load_times(path):
+    with open(path) as file:
+        data = json.load(file)
+    times = {}
+    for benchmark in data.get('benchmarks', []):
+        # Aggregates (mean, median, ...) are compared only if repeated
+        if benchmark.get('run_type') == 'aggregate':
+            if benchmark.get('aggregate_name') != 'median':
+                continue
+        times[benchmark['name']] = float(benchmark['cpu_time'])
+    return times
+
+
+def run_benchmark(binary, out_path, extra_args):
+    command = [
+        binary,
+        f'--benchmark_out={out_path}',
+        '--benchmark_out_format=json',
+        '--benchmark_color=no',
+    ] + extra_args
+    return subprocess.call(command)
+
+
+def main():
+    args = parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        out_path = os.path.join(tmp_dir, 'results.json')
+        code = run_benchmark(args.binary, out_path, args.benchmark_args)
+        if code != 0:
+            print(f'Benchmark failed with code {code}', file=sys.stderr)
+            return code
+
+        if args.update or not os.path.exists(args.baseline):
+            with open(out_path) as src, open(args.baseline, 'w') as dst:
+                dst.write(src.read())
+            print(f'Baseline written to {args.baseline}')
+            return 0
+
+        baseline = load_times(args.baseline)
+        current = load_times(out_path)
+
+    regressions = []
+    for name, base_time in sorted(baseline.items()):
+        if name not in current:
+            print(f'{name}: missing in the new results', file=sys.stderr)
+            continue
+        if base_time <= 0:
+            continue
+        change = current[name] / base_time - 1
+        print(f'{name}: {base_time:.1f} -> {current[name]:.1f} '
+              f'({change:+.1%})')
+        if change > args.max_regression:
+            regressions.append(name)
+
+    if regressions:
+        print(
+            f'Regressed by more than {args.max_regression:.0%}: '
+            + ', '.join(regressions),
+            file=sys.stderr,
+        )
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
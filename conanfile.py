@@ -28,6 +28,7 @@ class UserverConan(ConanFile):
         'fPIC': [True, False],
         'lto': [True, False],
         'with_jemalloc': [True, False],
+        'with_brotli': [True, False],
         'with_mongodb': [True, False],
         'with_postgresql': [True, False],
         'with_postgresql_extra': [True, False],
@@ -46,6 +47,7 @@ class UserverConan(ConanFile):
         'fPIC': True,
         'lto': True,
         'with_jemalloc': True,
+        'with_brotli': True,
         'with_mongodb': True,
         'with_postgresql': True,
         'with_postgresql_extra': False,
@@ -99,6 +101,8 @@ class UserverConan(ConanFile):
 
         if self.options.with_jemalloc:
             self.requires('jemalloc/5.3.0')
+        if self.options.with_brotli:
+            self.requires('brotli/1.1.0')
         if self.options.with_grpc:
             self.requires(
                 'grpc/1.48.4', transitive_headers=True, transitive_libs=True,
@@ -169,6 +173,7 @@ class UserverConan(ConanFile):
         tool_ch.variables[
             'USERVER_FEATURE_JEMALLOC'
         ] = self.options.with_jemalloc
+        tool_ch.variables['USERVER_FEATURE_BROTLI'] = self.options.with_brotli
         tool_ch.variables[
             'USERVER_FEATURE_MONGODB'
         ] = self.options.with_mongodb
@@ -293,6 +298,15 @@ class UserverConan(ConanFile):
                 ),
                 keep_path=True,
             )
+            copy(
+                self,
+                pattern='*',
+                dst=os.path.join(self.package_folder, 'include', 'ubench'),
+                src=os.path.join(
+                    self.source_folder, 'core', 'benchmark', 'include',
+                ),
+                keep_path=True,
+            )
             copy(
                 self,
                 pattern='*',
@@ -307,6 +321,13 @@ class UserverConan(ConanFile):
                 src=os.path.join(self.source_folder, 'cmake'),
                 keep_path=True,
             )
+            copy(
+                self,
+                pattern='gbench_baseline.py',
+                dst=os.path.join(self.package_folder, 'cmake'),
+                src=os.path.join(self.source_folder, 'cmake'),
+                keep_path=True,
+            )
         if self.options.with_grpc or self.options.with_utest:
             copy(
                 self,
@@ -377,6 +398,9 @@ class UserverConan(ConanFile):
         def zlib():
             return ['zlib::zlib']
 
+        def brotli():
+            return ['brotli::brotli'] if self.options.with_brotli else []
+
         def jemalloc():
             return ['jemalloc::jemalloc'] if self.options.with_jemalloc else []
 
@@ -447,6 +471,7 @@ class UserverConan(ConanFile):
                     + ares()
                     + rapidjson()
                     + zlib()
+                    + brotli()
                 ),
             },
         ]
@@ -608,12 +633,11 @@ class UserverConan(ConanFile):
                     self.cpp_info.components[conan_component].libs.append(
                         get_lib_name('core-internal'),
                     )
-                if cmake_component != 'ubench':
-                    self.cpp_info.components[
-                        conan_component
-                    ].includedirs.append(
-                        os.path.join('include', cmake_component),
-                    )
+                self.cpp_info.components[
+                    conan_component
+                ].includedirs.append(
+                    os.path.join('include', cmake_component),
+                )
 
                 self.cpp_info.components[conan_component].requires = requires
 
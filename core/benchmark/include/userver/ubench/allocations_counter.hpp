@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/ubench/allocations_counter.hpp
+/// @brief @copybrief ubench::AllocationsCounter
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench {
+
+/// @ingroup userver_ubench
+///
+/// @brief Counts the `operator new` calls in all the threads while alive.
+///
+/// Using the class links in the replacement of the global `operator new`
+/// and `operator delete` that forward to malloc(3) and free(3). While no
+/// counter is alive, the only overhead is a relaxed atomic load per
+/// allocation.
+///
+/// @warning Do not use it in the binaries that replace the global
+/// `operator new` themselves.
+class AllocationsCounter final {
+ public:
+  /// Starts counting
+  AllocationsCounter() noexcept;
+
+  AllocationsCounter(AllocationsCounter&&) = delete;
+  AllocationsCounter& operator=(AllocationsCounter&&) = delete;
+
+  ~AllocationsCounter();
+
+  /// Count of the allocations since the construction
+  std::uint64_t GetAllocations() const noexcept;
+
+  /// Adds the `allocations` per-iteration average to the `state`
+  void Report(benchmark::State& state) const;
+
+ private:
+  const std::uint64_t start_;
+};
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#pragma once
+
+/// @file userver/ubench/engine.hpp
+/// @brief Helpers for running google-benchmark benchmarks in a coroutine
+/// engine
+
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @defgroup userver_ubench Benchmarking (ubench)
+///
+/// @brief Helpers for google-benchmark benchmarks of the coroutine code, see
+/// @ref scripts/docs/en/userver/testing.md
+
+/// @brief Benchmarking helpers
+namespace ubench {
+
+/// @brief Settings of the temporary engine of ubench::RunInEngine
+struct EngineSettings final {
+  /// Count of the TaskProcessor worker threads
+  std::size_t worker_threads{1};
+
+  /// Count of the ev threads
+  std::size_t ev_threads{1};
+
+  /// Whether to report the ubench::PerfCounters of the run
+  bool perf_counters{true};
+};
+
+/// @ingroup userver_ubench
+///
+/// @brief Runs the `payload` in a coroutine of a temporary engine and reports
+/// the ubench::PerfCounters of the whole run, including the engine threads,
+/// as per-iteration averages.
+///
+/// The engine start and stop are counted too, so the counters are precise
+/// only with enough iterations.
+///
+/// ## Example:
+/// @snippet core/benchmark/src/ubench/engine_benchmark.cpp  Sample
+void RunInEngine(benchmark::State& state, const EngineSettings& settings,
+                 utils::function_ref<void()> payload);
+
+/// @ingroup userver_ubench
+///
+/// @brief Runs the benchmark loop, spawning `tasks_per_iteration` tasks with
+/// the `func` on each iteration and waiting for them. Must be called from a
+/// coroutine, e.g. from ubench::RunInEngine.
+///
+/// Each task is counted as a processed item.
+template <typename Function>
+void RunTasksPerIteration(benchmark::State& state,
+                          std::size_t tasks_per_iteration,
+                          const Function& func) {
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(tasks_per_iteration);
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < tasks_per_iteration; ++i) {
+      tasks.push_back(engine::AsyncNoSpan(func));
+    }
+    for (auto& task : tasks) task.Get();
+    tasks.clear();
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<benchmark::IterationCount>(
+                              tasks_per_iteration));
+}
+
+/// @ingroup userver_ubench
+///
+/// @brief Runs the benchmark with 1, 2, 4 and 8 worker threads, passed as
+/// `state.range(0)`: `BENCHMARK(Foo)->Apply(ubench::WorkerThreadsArgs)`
+void WorkerThreadsArgs(benchmark::internal::Benchmark* benchmark);
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+/// @file userver/ubench/perf_counters.hpp
+/// @brief @copybrief ubench::PerfCounters
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench {
+
+/// @ingroup userver_ubench
+///
+/// @brief Counts the CPU cycles, cache misses and context switches via
+/// perf_event_open(2) in the current thread and in the threads it starts
+/// while the counters are alive.
+///
+/// The values of the started threads are accounted once the threads exit,
+/// so create the counters before starting the engine and report them after
+/// the engine is stopped. ubench::RunInEngine does exactly that.
+///
+/// The counters the kernel does not support or forbids via
+/// `/proc/sys/kernel/perf_event_paranoid` are silently skipped.
+class PerfCounters final {
+ public:
+  /// Starts the counters
+  PerfCounters();
+
+  PerfCounters(PerfCounters&&) = delete;
+  PerfCounters& operator=(PerfCounters&&) = delete;
+
+  ~PerfCounters();
+
+  /// Stops the counters and adds them to the `state` as per-iteration
+  /// averages: `cycles`, `cache-misses` and `context-switches`.
+  void Report(benchmark::State& state);
+
+ private:
+  struct Counter final {
+    std::string name;
+    int fd;
+  };
+
+  std::vector<Counter> counters_;
+};
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,144 @@
+#include <userver/ubench/allocations_counter.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench {
+
+namespace {
+
+std::atomic<std::size_t> active_counters{0};
+std::atomic<std::uint64_t> allocations{0};
+
+void CountAllocation() noexcept {
+  if (active_counters.load(std::memory_order_relaxed) != 0) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void* Allocate(std::size_t size) noexcept {
+  CountAllocation();
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void* Allocate(std::size_t size, std::align_val_t alignment) noexcept {
+  CountAllocation();
+  void* result = nullptr;
+  const auto alignment_value = std::max(static_cast<std::size_t>(alignment),
+                                        sizeof(void*));
+  if (posix_memalign(&result, alignment_value, size == 0 ? 1 : size) != 0) {
+    return nullptr;
+  }
+  return result;
+}
+
+template <typename... Args>
+void* AllocateOrThrow(Args... args) {
+  void* result = Allocate(args...);
+  if (!result) throw std::bad_alloc();
+  return result;
+}
+
+}  // namespace
+
+AllocationsCounter::AllocationsCounter() noexcept
+    : start_((active_counters.fetch_add(1), allocations.load())) {}
+
+AllocationsCounter::~AllocationsCounter() { active_counters.fetch_sub(1); }
+
+std::uint64_t AllocationsCounter::GetAllocations() const noexcept {
+  return allocations.load() - start_;
+}
+
+void AllocationsCounter::Report(benchmark::State& state) const {
+  state.counters["allocations"] =
+      benchmark::Counter(static_cast<double>(GetAllocations()),
+                         benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
+
+// The replacements are linked in only with the AllocationsCounter
+// NOLINTBEGIN(cert-dcl54-cpp,misc-new-delete-overloads,hicpp-no-malloc)
+
+void* operator new(std::size_t size) {
+  return USERVER_NAMESPACE::ubench::AllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size) {
+  return USERVER_NAMESPACE::ubench::AllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return USERVER_NAMESPACE::ubench::Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return USERVER_NAMESPACE::ubench::Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return USERVER_NAMESPACE::ubench::AllocateOrThrow(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return USERVER_NAMESPACE::ubench::AllocateOrThrow(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return USERVER_NAMESPACE::ubench::Allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return USERVER_NAMESPACE::ubench::Allocate(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+  std::free(ptr);
+}
+
+// NOLINTEND(cert-dcl54-cpp,misc-new-delete-overloads,hicpp-no-malloc)
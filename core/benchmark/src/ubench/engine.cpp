@@ -0,0 +1,33 @@
+#include <userver/ubench/engine.hpp>
+
+#include <optional>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/ubench/perf_counters.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench {
+
+void RunInEngine(benchmark::State& state, const EngineSettings& settings,
+                 utils::function_ref<void()> payload) {
+  engine::TaskProcessorPoolsConfig config;
+  config.ev_threads_num = settings.ev_threads;
+
+  // Must be started before the engine threads to count them
+  std::optional<PerfCounters> perf_counters;
+  if (settings.perf_counters) perf_counters.emplace();
+
+  engine::RunStandalone(settings.worker_threads, config, payload);
+
+  if (perf_counters) perf_counters->Report(state);
+}
+
+void WorkerThreadsArgs(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("threads");
+  for (const int threads : {1, 2, 4, 8}) benchmark->Arg(threads);
+}
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
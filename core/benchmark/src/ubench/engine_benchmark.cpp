@@ -0,0 +1,40 @@
+#include <userver/ubench/engine.hpp>
+
+#include <atomic>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/ubench/allocations_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample]
+void ubench_mutex_contention(benchmark::State& state) {
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  ubench::RunInEngine(state, {/*worker_threads=*/threads}, [&] {
+    engine::Mutex mutex;
+    std::size_t counter = 0;
+
+    const ubench::AllocationsCounter allocations;
+    ubench::RunTasksPerIteration(state, threads, [&] {
+      const std::lock_guard lock{mutex};
+      ++counter;
+    });
+    allocations.Report(state);
+  });
+}
+BENCHMARK(ubench_mutex_contention)->Apply(ubench::WorkerThreadsArgs);
+/// [Sample]
+
+void ubench_task_spawn(benchmark::State& state) {
+  ubench::RunInEngine(state, {}, [&] {
+    std::atomic<std::size_t> counter{0};
+    ubench::RunTasksPerIteration(state, 1, [&counter] { ++counter; });
+  });
+}
+BENCHMARK(ubench_task_spawn);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#include <userver/ubench/perf_counters.hpp>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench {
+
+namespace {
+
+struct EventInfo final {
+  const char* name;
+  std::uint32_t type;
+  std::uint64_t config;
+};
+
+constexpr EventInfo kEvents[] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"context-switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+};
+
+// Returns -1 if the event is not available
+int OpenEvent(const EventInfo& event) {
+  perf_event_attr attr{};
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = 1;
+  // Count the threads started afterwards, e.g. the engine workers
+  attr.inherit = 1;
+  // Hardware events in the user space are usually allowed even with
+  // the restrictive perf_event_paranoid
+  attr.exclude_kernel = event.type == PERF_TYPE_HARDWARE ? 1 : 0;
+  attr.exclude_hv = 1;
+
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, /*pid=*/0,
+                                  /*cpu=*/-1, /*group_fd=*/-1,
+                                  PERF_FLAG_FD_CLOEXEC));
+}
+
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  for (const auto& event : kEvents) {
+    const int fd = OpenEvent(event);
+    if (fd == -1) continue;
+    counters_.push_back({event.name, fd});
+  }
+
+  for (const auto& counter : counters_) {
+    ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+PerfCounters::~PerfCounters() {
+  for (const auto& counter : counters_) close(counter.fd);
+}
+
+void PerfCounters::Report(benchmark::State& state) {
+  for (const auto& counter : counters_) {
+    ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+  }
+
+  for (const auto& counter : counters_) {
+    std::uint64_t value = 0;
+    if (read(counter.fd, &value, sizeof(value)) !=
+        static_cast<ssize_t>(sizeof(value))) {
+      continue;
+    }
+    state.counters[counter.name] = benchmark::Counter(
+        static_cast<double>(value), benchmark::Counter::kAvgIterations);
+  }
+}
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
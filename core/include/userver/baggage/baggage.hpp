@@ -4,6 +4,7 @@
 /// @brief @copybrief baggage::Baggage
 
 #include <algorithm>  // TODO: remove
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -35,6 +36,7 @@ class BaggageException : public std::runtime_error {
 /// ',' and ';'
 class BaggageEntryProperty {
   friend class BaggageEntry;
+  friend class Baggage;
 
  public:
   BaggageEntryProperty(std::string_view key,
@@ -44,7 +46,7 @@ class BaggageEntryProperty {
   std::string GetKey() const;
 
  private:
-  const std::string_view key_;
+  std::string_view key_;
   std::optional<std::string_view> value_;
 };
 
@@ -75,7 +77,7 @@ class BaggageEntry {
  private:
   /// @brief Add entry to the received header string
   void ConcatenateWith(std::string& header) const;
-  const std::string_view key_;
+  std::string_view key_;
   std::string_view value_;
   std::vector<BaggageEntryProperty> properties_;
 };
@@ -88,11 +90,20 @@ class BaggageEntry {
 /// @see baggage::BaggageManagerComponent
 class Baggage {
  public:
+  using AllowedKeysPtr = std::shared_ptr<const std::unordered_set<std::string>>;
+
   Baggage(std::string header, std::unordered_set<std::string> allowed_keys);
+
+  /// @brief Same as the above, but shares the `allowed_keys` instead of
+  /// copying them into each Baggage
+  Baggage(std::string header, AllowedKeysPtr allowed_keys);
+
+  /// Copying and moving do not parse the header again
   Baggage(const Baggage&) noexcept;
   Baggage(Baggage&&) noexcept;
 
-  std::string ToString() const;
+  /// @returns the header to send, without the invalid entries
+  const std::string& ToString() const;
 
   /// @return vector of entries
   const std::vector<BaggageEntry>& GetEntries() const;
@@ -115,7 +126,7 @@ class Baggage {
                 BaggageProperties properties);
 
   /// @brief get baggage allowed keys
-  std::unordered_set<std::string> GetAllowedKeys() const;
+  const std::unordered_set<std::string>& GetAllowedKeys() const;
 
  protected:
   /// @brief parsers
@@ -133,8 +144,13 @@ class Baggage {
   /// @brief Create result_header
   void CreateResultHeader();
 
+  /// @brief Point the entries parsed from `old_header` to `header_value_`
+  void RebaseEntries(const char* old_header);
+
+  friend class BaggageManager;
+
   std::string header_value_;
-  std::unordered_set<std::string> allowed_keys_;
+  AllowedKeysPtr allowed_keys_;
   std::vector<BaggageEntry> entries_;
 
   // result header after parsing entities.
@@ -149,6 +165,10 @@ class Baggage {
 std::optional<Baggage> TryMakeBaggage(
     std::string header, std::unordered_set<std::string> allowed_keys);
 
+/// @overload
+std::optional<Baggage> TryMakeBaggage(std::string header,
+                                      Baggage::AllowedKeysPtr allowed_keys);
+
 template <typename T>
 bool HasInvalidSymbols(const T& obj) {
   return std::find_if(obj.begin(), obj.end(), [](unsigned char x) {
@@ -44,6 +44,9 @@ class BaggageManager final {
   static void ResetBaggage();
 
  private:
+  Baggage::AllowedKeysPtr ChooseCurrentAllowedKeys(
+      const Baggage* current_baggage) const;
+
   dynamic_config::Source config_source_;
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 
@@ -21,6 +22,11 @@ extern const dynamic_config::Key<BaggageSettings> kBaggageSettings;
 
 extern const dynamic_config::Key<bool> kBaggageEnabled;
 
+/// @brief Returns the allowed keys of the `config`, sharing them with the
+/// snapshot instead of copying
+std::shared_ptr<const std::unordered_set<std::string>> GetAllowedKeys(
+    const dynamic_config::Snapshot& config);
+
 }  // namespace baggage
 
 USERVER_NAMESPACE_END
@@ -73,6 +73,7 @@ struct Config final {
   std::chrono::milliseconds cleanup_interval;
   bool is_strong_period;
   std::optional<std::uint64_t> failed_updates_before_expiration;
+  double update_cpu_budget;
 
   FirstUpdateMode first_update_mode;
   FirstUpdateType first_update_type;
@@ -29,6 +29,7 @@ struct UpdateStatistics final {
   std::atomic<std::chrono::steady_clock::time_point>
       last_successful_update_start_time{{}};
   std::atomic<std::chrono::milliseconds> last_update_duration{{}};
+  std::atomic<std::chrono::milliseconds> last_update_cpu_time{{}};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -90,6 +91,7 @@ class UpdateStatisticsScope final {
   impl::UpdateStatistics& update_stats_;
   impl::UpdateState state_{impl::UpdateState::kNotFinished};
   const std::chrono::steady_clock::time_point update_start_time_;
+  const std::chrono::nanoseconds update_start_cpu_time_;
 };
 
 }  // namespace cache
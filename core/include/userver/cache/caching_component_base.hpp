@@ -10,6 +10,7 @@
 #include <fmt/format.h>
 
 #include <userver/cache/cache_update_trait.hpp>
+#include <userver/cache/change_set.hpp>
 #include <userver/cache/exceptions.hpp>
 #include <userver/compiler/demangle.hpp>
 #include <userver/components/component_fwd.hpp>
@@ -68,6 +69,7 @@ namespace components {
 /// is-strong-period | whether to include Update execution time in update-interval | false
 /// testsuite-force-periodic-update | override testsuite-periodic-update-enabled in TestsuiteSupport component config | --
 /// failed-updates-before-expiration | the number of consecutive failed updates for data expiration | --
+/// update-cpu-budget | the share of a CPU core in (0, 1] that an update may use, enforced at the yield points of utils::CpuRelax | 1
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
 /// alert-on-failing-to-update-times | fire an alert if the cache update failed specified amount of times in a row. If zero - alerts are disabled. Value from dynamic config takes priority over static | 0
 /// dump.* | Manages cache behavior after dump load | -
@@ -118,6 +120,7 @@ class CachingComponentBase : public LoggableComponentBase,
   using cache::CacheUpdateTrait::Name;
 
   using DataType = T;
+  using ChangeSetType = cache::ChangeSetFor<T>;
 
   /// @return cache contents. May be nullptr if and only if MayReturnNull()
   /// returns true.
@@ -136,12 +139,26 @@ class CachingComponentBase : public LoggableComponentBase,
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&>&
   GetEventChannel();
 
+  /// Subscribes to cache updates along with the keys changed by them using
+  /// a member function. Also immediately invokes the function with the current
+  /// cache contents and a full cache::ChangeSet.
+  template <class Class>
+  concurrent::AsyncEventSubscriberScope UpdateAndListenChanges(
+      Class* obj, std::string name,
+      void (Class::*func)(const std::shared_ptr<const T>&,
+                          const ChangeSetType&));
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  protected:
   void Set(std::unique_ptr<const T> value_ptr);
   void Set(T&& value);
 
+  /// @brief Sets the new cache contents and reports the keys changed since
+  /// the previous contents to the UpdateAndListenChanges subscribers
+  /// @note Other `Set` overloads report a full cache::ChangeSet
+  void Set(std::unique_ptr<const T> value_ptr, const ChangeSetType& changes);
+
   template <typename... Args>
   void Emplace(Args&&... args);
 
@@ -177,6 +194,9 @@ class CachingComponentBase : public LoggableComponentBase,
 
   rcu::Variable<std::shared_ptr<const T>> cache_;
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&> event_channel_;
+  concurrent::AsyncEventChannel<const std::shared_ptr<const T>&,
+                                const ChangeSetType&>
+      changes_event_channel_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
@@ -189,7 +209,13 @@ CachingComponentBase<T>::CachingComponentBase(const ComponentConfig& config,
                      [this](auto& function) {
                        const auto ptr = cache_.ReadCopy();
                        if (ptr) function(ptr);
-                     }) {
+                     }),
+      changes_event_channel_(
+          components::GetCurrentComponentName(config) + "-changes",
+          [this](auto& function) {
+            const auto ptr = cache_.ReadCopy();
+            if (ptr) function(ptr, ChangeSetType{});
+          }) {
   const auto initial_config = GetConfig();
 }
 
@@ -228,6 +254,20 @@ CachingComponentBase<T>::GetEventChannel() {
   return event_channel_;
 }
 
+template <typename T>
+template <typename Class>
+concurrent::AsyncEventSubscriberScope
+CachingComponentBase<T>::UpdateAndListenChanges(
+    Class* obj, std::string name,
+    void (Class::*func)(const std::shared_ptr<const T>&,
+                        const ChangeSetType&)) {
+  return changes_event_channel_.DoUpdateAndListen(
+      obj, std::move(name), func, [&] {
+        auto ptr = Get();
+        (obj->*func)(ptr, ChangeSetType{});
+      });
+}
+
 template <typename T>
 utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
   return utils::SharedReadablePtr<T>(cache_.ReadCopy());
@@ -235,18 +275,27 @@ utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
 
 template <typename T>
 void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
+  Set(std::move(value_ptr), ChangeSetType{});
+}
+
+template <typename T>
+void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr,
+                                  const ChangeSetType& changes) {
   auto deleter = [token = wait_token_storage_.GetToken(),
                   &cache_task_processor =
                       GetCacheTaskProcessor()](const T* raw_ptr) mutable {
     std::unique_ptr<const T> ptr{raw_ptr};
 
-    // Kill garbage asynchronously as T::~T() might be very slow
-    engine::CriticalAsyncNoSpan(cache_task_processor, [ptr = std::move(ptr),
-                                                       token = std::move(
-                                                           token)]() mutable {
-      // Make sure *ptr is deleted before token is destroyed
-      ptr.reset();
-    }).Detach();
+    // Kill garbage asynchronously as T::~T() might be very slow. The low
+    // priority keeps the deleters from delaying latency-sensitive tasks on
+    // task processors with `task-priorities`.
+    engine::CriticalAsyncNoSpan(
+        cache_task_processor, engine::Task::Priority::kLow,
+        [ptr = std::move(ptr), token = std::move(token)]() mutable {
+          // Make sure *ptr is deleted before token is destroyed
+          ptr.reset();
+        })
+        .Detach();
   };
 
   const std::shared_ptr<const T> new_value(value_ptr.release(),
@@ -259,6 +308,7 @@ void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
 
   cache_.Assign(new_value);
   event_channel_.SendEvent(new_value);
+  changes_event_channel_.SendEvent(new_value, changes);
   OnCacheModified();
 }
 
@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/cache/change_set.hpp
+/// @brief @copybrief cache::ChangeSet
+
+#include <vector>
+
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief The keys changed by a cache update
+///
+/// Is sent to the subscribers of
+/// components::CachingComponentBase::UpdateAndListenChanges along with the new
+/// cache contents, so that derived indexes can be updated incrementally.
+///
+/// The values of the changed keys should be looked up in the new cache
+/// contents. A change set may be delivered for the contents the subscriber has
+/// already seen, so it should be applied idempotently.
+template <typename Key>
+struct ChangeSet final {
+  /// If `true`, the cache contents were replaced as a whole (a full update,
+  /// a dump read, an expiration or an update that did not report the changed
+  /// keys) and the key lists are empty. The subscriber should rebuild from
+  /// the new cache contents.
+  bool is_full{true};
+
+  std::vector<Key> inserted;
+  std::vector<Key> updated;
+  std::vector<Key> erased;
+};
+
+/// @brief The key type of cache::ChangeSet for the cache data type `T`
+///
+/// `T::key_type` by default. Specialize for custom cache data types.
+template <typename T>
+struct ChangeSetKey {
+  using type = meta::MapKeyType<T>;
+};
+
+template <typename T>
+using ChangeSetFor = ChangeSet<typename ChangeSetKey<T>::type>;
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,213 @@
+#pragma once
+
+/// @file userver/cache/columnar_container.hpp
+/// @brief @copybrief cache::ColumnarContainer
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl::columnar {
+
+/// Deduplicates the strings and stores them in large shared blocks
+class StringPool final {
+ public:
+  using Id = std::uint32_t;
+
+  StringPool() = default;
+
+  /// The copy shares the blocks with the original and writes new strings
+  /// into its own blocks
+  StringPool(const StringPool& other);
+  StringPool& operator=(const StringPool& other);
+
+  StringPool(StringPool&& other) noexcept;
+  StringPool& operator=(StringPool&& other) noexcept;
+
+  Id Intern(std::string_view str);
+
+  std::string_view Get(Id id) const {
+    UASSERT(id < strings_.size());
+    return strings_[id];
+  }
+
+  std::size_t GetUniqueCount() const { return strings_.size(); }
+
+  std::size_t GetArenaBytes() const { return arena_bytes_; }
+
+ private:
+  std::string_view Store(std::string_view str);
+
+  std::vector<std::shared_ptr<char[]>> blocks_;
+  char* free_space_{nullptr};
+  std::size_t free_size_{0};
+  std::size_t arena_bytes_{0};
+  std::vector<std::string_view> strings_;
+  std::unordered_map<std::string_view, Id> ids_;
+};
+
+template <typename Field>
+using Column =
+    std::conditional_t<std::is_same_v<Field, std::string>,
+                       std::vector<StringPool::Id>, std::vector<Field>>;
+
+template <typename Value, std::size_t... Indices>
+auto MakeColumns(std::index_sequence<Indices...>)
+    -> std::tuple<Column<boost::pfr::tuple_element_t<Indices, Value>>...>;
+
+template <typename Value>
+using Columns = decltype(MakeColumns<Value>(
+    std::make_index_sequence<boost::pfr::tuple_size_v<Value>>{}));
+
+}  // namespace impl::columnar
+
+/// @ingroup userver_containers
+///
+/// @brief A compact cache container that stores each field of the aggregate
+/// @a Value in a separate column
+///
+/// `std::string` fields are deduplicated and stored in a shared string pool,
+/// each row holds only a 4-byte id of the string. That saves the memory for
+/// the tables with many small or repeating strings, at the cost of
+/// materializing the values on access. The values are accessed via RowRef.
+///
+/// The strings of the replaced values are kept in the pool until the
+/// container is rebuilt by a full update.
+///
+/// Usage example:
+/// @snippet cache/columnar_container_test.cpp  Sample ColumnarContainer
+template <typename Key, typename Value>
+class ColumnarContainer final {
+  static_assert(std::is_aggregate_v<Value>,
+                "ColumnarContainer only supports aggregate values");
+
+  static constexpr auto kFieldsCount = boost::pfr::tuple_size_v<Value>;
+  using Indices = std::make_index_sequence<kFieldsCount>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+
+  /// @brief A lightweight reference to a row of the container
+  class RowRef final {
+   public:
+    /// @returns `std::string_view` for `std::string` fields and a const
+    /// reference to the field otherwise
+    template <std::size_t I>
+    decltype(auto) Get() const {
+      const auto& cell = std::get<I>(container_->columns_)[row_];
+      if constexpr (kIsStringField<I>) {
+        return container_->strings_.Get(cell);
+      } else {
+        return cell;
+      }
+    }
+
+    /// @returns a copy of the value
+    Value ToValue() const { return ToValue(Indices{}); }
+
+   private:
+    friend class ColumnarContainer;
+
+    RowRef(const ColumnarContainer& container, std::size_t row)
+        : container_(&container), row_(row) {}
+
+    template <std::size_t... I>
+    Value ToValue(std::index_sequence<I...>) const {
+      return Value{boost::pfr::tuple_element_t<I, Value>(Get<I>())...};
+    }
+
+    const ColumnarContainer* container_;
+    std::size_t row_;
+  };
+
+  /// Inserts the value or replaces the value with the same key
+  void insert_or_assign(Key key, Value value) {
+    const auto [it, inserted] = rows_.try_emplace(std::move(key), size_);
+    StoreFields(it->second, std::move(value), Indices{});
+    if (inserted) ++size_;
+  }
+
+  std::optional<RowRef> Find(const Key& key) const {
+    const auto it = rows_.find(key);
+    if (it == rows_.end()) return std::nullopt;
+    return RowRef{*this, it->second};
+  }
+
+  /// @returns the row in the insertion order, `row` must be less than size()
+  RowRef GetRow(std::size_t row) const {
+    UASSERT(row < size_);
+    return RowRef{*this, row};
+  }
+
+  void reserve(std::size_t size) {
+    rows_.reserve(size);
+    std::apply([size](auto&... columns) { (columns.reserve(size), ...); },
+               columns_);
+  }
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  /// @returns the number of unique strings in the pool
+  std::size_t GetUniqueStringsCount() const {
+    return strings_.GetUniqueCount();
+  }
+
+  /// @returns the number of bytes allocated for the strings in the pool
+  std::size_t GetStringsArenaBytes() const { return strings_.GetArenaBytes(); }
+
+ private:
+  template <std::size_t I>
+  static constexpr bool kIsStringField =
+      std::is_same_v<boost::pfr::tuple_element_t<I, Value>, std::string>;
+
+  template <std::size_t... I>
+  void StoreFields(std::size_t row, Value&& value, std::index_sequence<I...>) {
+    (StoreField<I>(row, std::move(boost::pfr::get<I>(value))), ...);
+  }
+
+  template <std::size_t I, typename Field>
+  void StoreField(std::size_t row, Field&& field) {
+    auto& column = std::get<I>(columns_);
+    auto cell = [&] {
+      if constexpr (kIsStringField<I>) {
+        return strings_.Intern(field);
+      } else {
+        return std::forward<Field>(field);
+      }
+    }();
+
+    if (row == column.size()) {
+      column.push_back(std::move(cell));
+    } else {
+      column[row] = std::move(cell);
+    }
+  }
+
+  std::unordered_map<Key, std::size_t> rows_;
+  impl::columnar::Columns<Value> columns_;
+  impl::columnar::StringPool strings_;
+  std::size_t size_{0};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,343 @@
+#pragma once
+
+/// @file userver/cache/indexed_container.hpp
+/// @brief @copybrief cache::IndexedContainer
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief A secondary index of cache::IndexedContainer that looks up values by
+/// the hash of their @a Projection
+template <auto Projection>
+struct HashIndex final {};
+
+/// @brief A secondary index of cache::IndexedContainer that keeps values
+/// ordered by their @a Projection, allows range lookups
+template <auto Projection>
+struct SortedIndex final {};
+
+namespace impl::indexed_container {
+
+template <typename Value, auto Projection>
+using ProjectionResult =
+    std::decay_t<std::invoke_result_t<decltype(Projection), const Value&>>;
+
+using Offsets = std::pair<const std::size_t*, const std::size_t*>;
+
+template <typename Value, typename Index>
+class IndexStorage;
+
+template <typename Value, auto Projection>
+class IndexStorage<Value, HashIndex<Projection>> final {
+ public:
+  using KeyType = ProjectionResult<Value, Projection>;
+
+  void Build(const std::vector<Value>& values) {
+    ranges_.clear();
+    offsets_.assign(values.size(), 0);
+
+    // Count the values of each key, then lay out the offsets grouped by key
+    for (const auto& value : values) {
+      ++ranges_[std::invoke(Projection, value)].second;
+    }
+    std::size_t position = 0;
+    for (auto& [key, range] : ranges_) {
+      range.first = position;
+      position += range.second;
+      range.second = range.first;
+    }
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      auto& range = ranges_.find(std::invoke(Projection, values[i]))->second;
+      offsets_[range.second++] = i;
+    }
+  }
+
+  Offsets Find(const KeyType& key) const {
+    const auto it = ranges_.find(key);
+    if (it == ranges_.end()) return {nullptr, nullptr};
+    return {offsets_.data() + it->second.first,
+            offsets_.data() + it->second.second};
+  }
+
+ private:
+  std::vector<std::size_t> offsets_;
+  // [begin, end) positions of the key's offsets in `offsets_`
+  std::unordered_map<KeyType, std::pair<std::size_t, std::size_t>> ranges_;
+};
+
+template <typename Value, auto Projection>
+class IndexStorage<Value, SortedIndex<Projection>> final {
+ public:
+  using KeyType = ProjectionResult<Value, Projection>;
+
+  void Build(const std::vector<Value>& values) {
+    offsets_.resize(values.size());
+    std::iota(offsets_.begin(), offsets_.end(), std::size_t{0});
+    std::stable_sort(offsets_.begin(), offsets_.end(),
+                     [&values](std::size_t lhs, std::size_t rhs) {
+                       return std::invoke(Projection, values[lhs]) <
+                              std::invoke(Projection, values[rhs]);
+                     });
+  }
+
+  Offsets Find(const std::vector<Value>& values, const KeyType& key) const {
+    const auto [first, last] = std::equal_range(
+        offsets_.begin(), offsets_.end(), key, Compare{values});
+    return ToOffsets(first, last);
+  }
+
+  Offsets FindRange(const std::vector<Value>& values, const KeyType& from,
+                    const KeyType& to) const {
+    const auto first = std::lower_bound(offsets_.begin(), offsets_.end(),
+                                        from, Compare{values});
+    const auto last =
+        std::lower_bound(first, offsets_.end(), to, Compare{values});
+    return ToOffsets(first, last);
+  }
+
+ private:
+  using Iterator = std::vector<std::size_t>::const_iterator;
+
+  struct Compare final {
+    bool operator()(std::size_t offset, const KeyType& key) const {
+      return std::invoke(Projection, values[offset]) < key;
+    }
+    bool operator()(const KeyType& key, std::size_t offset) const {
+      return key < std::invoke(Projection, values[offset]);
+    }
+
+    const std::vector<Value>& values;
+  };
+
+  Offsets ToOffsets(Iterator first, Iterator last) const {
+    const auto* data = offsets_.data();
+    return {data + (first - offsets_.begin()),
+            data + (last - offsets_.begin())};
+  }
+
+  std::vector<std::size_t> offsets_;
+};
+
+template <typename Index>
+inline constexpr bool kIsSortedIndex = false;
+
+template <auto Projection>
+inline constexpr bool kIsSortedIndex<SortedIndex<Projection>> = true;
+
+}  // namespace impl::indexed_container
+
+/// @ingroup userver_containers
+///
+/// @brief A cache container that stores the values contiguously and maintains
+/// secondary indexes over them
+///
+/// The values are stored in a single `std::vector` and are looked up by the
+/// primary key. Each of @a Indexes (cache::HashIndex or cache::SortedIndex)
+/// holds only the offsets of the values, so that several lookups by different
+/// fields do not duplicate the values.
+///
+/// The secondary indexes are rebuilt by OnWritesDone(), which is called by
+/// components::PostgreCache at the end of each update. Other caches should
+/// call it before passing the container to
+/// components::CachingComponentBase::Set. If there are several indexes, they
+/// are built in parallel, so OnWritesDone() should be called from a coroutine.
+///
+/// Usage example:
+/// @snippet cache/indexed_container_test.cpp  Sample IndexedContainer
+template <typename Key, typename Value, typename... Indexes>
+class IndexedContainer final {
+  template <std::size_t I>
+  using IndexType = std::tuple_element_t<I, std::tuple<Indexes...>>;
+
+  template <std::size_t I>
+  using IndexKey = typename impl::indexed_container::IndexStorage<
+      Value, IndexType<I>>::KeyType;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using const_iterator = typename std::vector<Value>::const_iterator;
+
+  /// @brief The values found by a secondary index
+  class ValuesRange final {
+   public:
+    class Iterator final {
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = Value;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const Value*;
+      using reference = const Value&;
+
+      Iterator() = default;
+
+      reference operator*() const { return values_[*offset_]; }
+      pointer operator->() const { return &values_[*offset_]; }
+
+      Iterator& operator++() {
+        ++offset_;
+        return *this;
+      }
+      Iterator operator++(int) {
+        auto copy = *this;
+        ++offset_;
+        return copy;
+      }
+
+      bool operator==(const Iterator& other) const {
+        return offset_ == other.offset_;
+      }
+      bool operator!=(const Iterator& other) const {
+        return offset_ != other.offset_;
+      }
+
+     private:
+      friend class ValuesRange;
+
+      Iterator(const Value* values, const std::size_t* offset)
+          : values_(values), offset_(offset) {}
+
+      const Value* values_{nullptr};
+      const std::size_t* offset_{nullptr};
+    };
+
+    Iterator begin() const { return {values_, offsets_.first}; }
+    Iterator end() const { return {values_, offsets_.second}; }
+
+    std::size_t size() const {
+      return static_cast<std::size_t>(offsets_.second - offsets_.first);
+    }
+    bool empty() const { return offsets_.first == offsets_.second; }
+
+   private:
+    friend class IndexedContainer;
+
+    ValuesRange(const Value* values, impl::indexed_container::Offsets offsets)
+        : values_(values), offsets_(offsets) {}
+
+    const Value* values_;
+    impl::indexed_container::Offsets offsets_;
+  };
+
+  /// Inserts the value or replaces the value with the same primary key
+  void insert_or_assign(Key key, Value value) {
+    indexes_outdated_ = true;
+    const auto [it, inserted] = offsets_.try_emplace(key, values_.size());
+    if (inserted) {
+      keys_.push_back(std::move(key));
+      values_.push_back(std::move(value));
+    } else {
+      values_[it->second] = std::move(value);
+    }
+  }
+
+  /// Removes the value with the primary key, if any. Moves the last value in
+  /// its place.
+  /// @returns the number of removed values
+  std::size_t erase(const Key& key) {
+    const auto it = offsets_.find(key);
+    if (it == offsets_.end()) return 0;
+
+    indexes_outdated_ = true;
+    const auto offset = it->second;
+    offsets_.erase(it);
+    if (offset + 1 != values_.size()) {
+      keys_[offset] = std::move(keys_.back());
+      values_[offset] = std::move(values_.back());
+      offsets_[keys_[offset]] = offset;
+    }
+    keys_.pop_back();
+    values_.pop_back();
+    return 1;
+  }
+
+  void reserve(std::size_t size) {
+    keys_.reserve(size);
+    values_.reserve(size);
+    offsets_.reserve(size);
+  }
+
+  /// Rebuilds the secondary indexes after the values have been changed
+  void OnWritesDone() {
+    if constexpr (sizeof...(Indexes) > 1) {
+      std::apply(
+          [this](auto&... indexes) {
+            std::vector<engine::TaskWithResult<void>> tasks;
+            tasks.reserve(sizeof...(Indexes));
+            (tasks.push_back(engine::AsyncNoSpan(
+                 [this, &indexes] { indexes.Build(values_); })),
+             ...);
+            for (auto& task : tasks) task.Get();
+          },
+          indexes_);
+    } else {
+      std::apply([this](auto&... indexes) { (indexes.Build(values_), ...); },
+                 indexes_);
+    }
+    indexes_outdated_ = false;
+  }
+
+  /// @returns the value with the primary key or `nullptr`
+  const Value* Find(const Key& key) const {
+    const auto it = offsets_.find(key);
+    return it == offsets_.end() ? nullptr : &values_[it->second];
+  }
+
+  /// @returns the values with the key in the secondary index @a I
+  template <std::size_t I>
+  ValuesRange FindAll(const IndexKey<I>& key) const {
+    UASSERT_MSG(!indexes_outdated_,
+                "OnWritesDone() must be called after the values are changed");
+    const auto& index = std::get<I>(indexes_);
+    if constexpr (impl::indexed_container::kIsSortedIndex<IndexType<I>>) {
+      return {values_.data(), index.Find(values_, key)};
+    } else {
+      return {values_.data(), index.Find(key)};
+    }
+  }
+
+  /// @returns the values with the keys in `[from, to)` in the secondary
+  /// cache::SortedIndex @a I, ordered by the key
+  template <std::size_t I>
+  ValuesRange FindRange(const IndexKey<I>& from,
+                        const IndexKey<I>& to) const {
+    static_assert(impl::indexed_container::kIsSortedIndex<IndexType<I>>,
+                  "Range lookups require a cache::SortedIndex");
+    UASSERT_MSG(!indexes_outdated_,
+                "OnWritesDone() must be called after the values are changed");
+    return {values_.data(), std::get<I>(indexes_).FindRange(values_, from, to)};
+  }
+
+  const_iterator begin() const { return values_.begin(); }
+  const_iterator end() const { return values_.end(); }
+
+  std::size_t size() const { return values_.size(); }
+  bool empty() const { return values_.empty(); }
+
+ private:
+  std::vector<Key> keys_;
+  std::vector<Value> values_;
+  std::unordered_map<Key, std::size_t> offsets_;
+  std::tuple<impl::indexed_container::IndexStorage<Value, Indexes>...> indexes_;
+  bool indexes_outdated_{false};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,13 @@
 /// @file userver/cache/lru_cache_component_base.hpp
 /// @brief @copybrief cache::LruCacheComponent
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/cache/lru_cache_config.hpp>
@@ -14,7 +20,10 @@
 #include <userver/dump/operations.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/testsuite/component_control.hpp>
+#include <userver/utils/filter_bloom.hpp>
+#include <userver/utils/periodic_task.hpp>
 #include <userver/utils/statistics/entry.hpp>
 #include <userver/yaml_config/schema.hpp>
 
@@ -38,6 +47,18 @@ bool IsDumpSupportEnabled(const components::ComponentConfig& config);
 
 yaml_config::Schema GetLruCacheComponentBaseSchema();
 
+// Derives the second hash of the key filter from the first one
+template <typename Key, typename Hash>
+struct KeyFilterRehash final {
+  std::size_t operator()(const Key& key) const {
+    // splitmix64 finalizer
+    std::uint64_t x = Hash{}(key) + 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return static_cast<std::size_t>(x ^ (x >> 31));
+  }
+};
+
 }  // namespace impl
 
 // clang-format off
@@ -62,6 +83,20 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// ways | number of ways for associative cache | --
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
+/// policy | eviction policy: `lru` or `tinylfu`, see cache::CachePolicy | lru
+/// buffered-reads | look up values without locking the way exclusively, see cache::NWayLRU::SetBufferedReads() | false
+/// key-filter-update-interval | enables the filter of the existing keys rebuilt with this interval, see below | disabled
+///
+/// ## Key filter
+///
+/// If most of the cache misses are for the keys that do not exist in the data
+/// source, set `key-filter-update-interval` and override
+/// LruCacheComponent::DoGetAllKeys. A Bloom filter of the keys it returns is
+/// rebuilt periodically, and the misses for the keys that are absent from the
+/// filter are served by LruCacheComponent::DoGetForAbsentKey without calling
+/// LruCacheComponent::DoGetByKey. The keys added to the data source after the
+/// last rebuild are treated as absent until the next one. The filter is
+/// rebuilt on the testsuite cache invalidation.
 ///
 /// ## Example usage:
 ///
@@ -95,9 +130,30 @@ class LruCacheComponent : public components::LoggableComponentBase,
  protected:
   virtual Value DoGetByKey(const Key& key) = 0;
 
+  /// @brief Returns all the keys that exist in the data source, must be
+  /// overridden if `key-filter-update-interval` is set
+  virtual std::vector<Key> DoGetAllKeys();
+
+  /// @brief Returns the value for a key that is absent from the key filter,
+  /// a default constructed `Value` by default
+  virtual Value DoGetForAbsentKey(const Key& key);
+
+  void OnAllComponentsLoaded() final;
+
+  void OnAllComponentsAreStopping() final;
+
  private:
+  using KeyFilter = utils::FilterBloom<Key, std::uint8_t, Hash,
+                                       impl::KeyFilterRehash<Key, Hash>>;
+
+  // For the false positive rate of about 0.25% with 4 hashes
+  static constexpr std::size_t kKeyFilterCountersPerKey = 16;
+  static constexpr std::size_t kMinKeyFilterCounters = 256;
+
   void DropCache();
 
+  void UpdateKeyFilter();
+
   Value GetByKey(const Key& key);
 
   void OnConfigUpdate(const dynamic_config::Snapshot& cfg);
@@ -121,6 +177,8 @@ class LruCacheComponent : public components::LoggableComponentBase,
   concurrent::AsyncEventSubscriberScope config_subscription_;
   utils::statistics::Entry statistics_holder_;
   std::optional<testsuite::ComponentInvalidatorHolder> invalidator_holder_;
+  rcu::Variable<std::shared_ptr<const KeyFilter>> key_filter_;
+  utils::PeriodicTask key_filter_task_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -131,7 +189,8 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize(),
+                                     static_config_.policy)) {
   if (impl::IsDumpSupportEnabled(config)) {
     dumper_ = std::make_shared<dump::Dumper>(
         config, context, static_cast<dump::DumpableEntity&>(*this));
@@ -141,6 +200,7 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
+  cache_->SetBufferedReads(static_config_.buffered_reads);
 
   if (static_config_.use_dynamic_config) {
     LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -184,13 +244,66 @@ LruCacheComponent<Key, Value, Hash, Equal>::GetCache() {
 template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::DropCache() {
   cache_->Invalidate();
+  if (key_filter_task_.IsRunning()) {
+    key_filter_.Assign(nullptr);
+    key_filter_task_.ForceStepAsync();
+  }
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value LruCacheComponent<Key, Value, Hash, Equal>::GetByKey(const Key& key) {
+  const auto key_filter = key_filter_.ReadCopy();
+  if (key_filter && !key_filter->Has(key)) return DoGetForAbsentKey(key);
   return DoGetByKey(key);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::vector<Key> LruCacheComponent<Key, Value, Hash, Equal>::DoGetAllKeys() {
+  throw std::logic_error("'key-filter-update-interval' is set for cache '" +
+                         name_ + "', but DoGetAllKeys is not overridden");
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value LruCacheComponent<Key, Value, Hash, Equal>::DoGetForAbsentKey(
+    const Key& /*key*/) {
+  if constexpr (std::is_default_constructible_v<Value>) {
+    return Value{};
+  } else {
+    throw std::logic_error("DoGetForAbsentKey must be overridden for cache '" +
+                           name_ + "', because its Value is not default "
+                           "constructible");
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::OnAllComponentsLoaded() {
+  // The filter is built only after the derived component has been constructed
+  if (!static_config_.key_filter_update_interval) return;
+  key_filter_task_.Start("lru-key-filter/" + name_,
+                         *static_config_.key_filter_update_interval,
+                         [this] { UpdateKeyFilter(); });
+  key_filter_task_.ForceStepAsync();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::OnAllComponentsAreStopping() {
+  key_filter_task_.Stop();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void LruCacheComponent<Key, Value, Hash, Equal>::UpdateKeyFilter() {
+  const auto keys = DoGetAllKeys();
+  auto key_filter = std::make_shared<KeyFilter>(std::max(
+      keys.size() * kKeyFilterCountersPerKey, kMinKeyFilterCounters));
+  for (const auto& key : keys) {
+    // Keeps the counters from overflowing on the duplicate keys
+    if (!key_filter->Has(key)) key_filter->Increment(key);
+  }
+  key_filter_.Assign(std::move(key_filter));
+  LOG_INFO() << "Rebuilt the key filter of LRU cache " << name_ << " for "
+             << keys.size() << " keys";
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::OnConfigUpdate(
     const dynamic_config::Snapshot& cfg) {
@@ -1,13 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <variant>
 #include <vector>
 
+#include <userver/cache/impl/policy_lru.hpp>
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/policy.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,6 +30,10 @@ class NWayLRU final {
   NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(),
           const Equal& equal = Equal());
 
+  /// Creates the cache with each way using the `policy`
+  NWayLRU(size_t ways, size_t way_size, CachePolicy policy,
+          const Hash& hash = Hash(), const Equal& equal = Equal());
+
   void Put(const T& key, U value);
 
   template <typename Validator>
@@ -44,6 +57,21 @@ class NWayLRU final {
 
   void UpdateWaySize(size_t way_size);
 
+  /// @brief Enables or disables the buffered reads mode.
+  ///
+  /// In buffered reads mode Get() looks up the value under a shared lock of
+  /// the way and records the hit into a small per-way buffer instead of
+  /// updating the recency right away. The recorded hits are applied in a
+  /// batch by the next write to the way or by the reader that fills the
+  /// buffer, and may be dropped if the buffer is full. This removes the
+  /// contention of concurrent readers of the same way at the cost of a less
+  /// precise LRU order.
+  ///
+  /// The ways are guarded by engine::SharedMutex in this mode and by
+  /// engine::Mutex otherwise. This method is not thread-safe and must be
+  /// called before the cache is used.
+  void SetBufferedReads(bool buffered_reads);
+
   void Write(dump::Writer& writer) const;
   void Read(dump::Reader& reader);
 
@@ -52,14 +80,48 @@ class NWayLRU final {
   void SetDumper(std::shared_ptr<dump::Dumper> dumper);
 
  private:
+  using Lru = impl::PolicyLruBase<T, U, Hash, Equal>;
+  using Node = typename Lru::Node;
+
+  static constexpr std::size_t kReadBufferSize = 16;
+
+  // engine::Mutex, or engine::SharedMutex for the buffered reads. The shared
+  // locks are exclusive with engine::Mutex.
+  class WayMutex final {
+   public:
+    void SetShared(bool is_shared);
+
+    void lock();
+    void unlock();
+    bool try_lock();
+
+    void lock_shared();
+    void unlock_shared();
+
+   private:
+    std::variant<engine::Mutex, engine::SharedMutex> mutex_;
+  };
+
   struct Way {
     Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
 
     // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-    Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+    Way(CachePolicy policy, const Hash& hash, const Equal& equal)
+        : cache(policy, 1, hash, equal) {}
+
+    // Must be called under the shared lock, returns true if the buffer is full
+    bool BufferRead(Node& node) noexcept;
+
+    // Must be called under the unique lock before any modification of the
+    // cache, otherwise the buffered nodes may be freed
+    void DrainReadBuffer();
+
+    void TryDrainReadBuffer();
 
-    mutable engine::Mutex mutex;
-    LruMap<T, U, Hash, Equal> cache;
+    mutable WayMutex mutex;
+    Lru cache;
+    std::array<std::atomic<Node*>, kReadBufferSize> read_buffer{};
+    std::atomic<std::size_t> read_buffer_size{0};
   };
 
   Way& GetWay(const T& key);
@@ -68,15 +130,22 @@ class NWayLRU final {
 
   std::vector<Way> caches_;
   Hash hash_fn_;
+  bool buffered_reads_{false};
   std::shared_ptr<dump::Dumper> dumper_{nullptr};
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
                                  const Eq& equal)
+    : NWayLRU(ways, way_size, CachePolicy::kLRU, hash, equal) {}
+
+template <typename T, typename U, typename Hash, typename Eq>
+NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size,
+                                 CachePolicy policy, const Hash& hash,
+                                 const Eq& equal)
     : caches_(), hash_fn_(hash) {
   caches_.reserve(ways);
-  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(policy, hash, equal);
   if (ways == 0) throw std::logic_error("Ways must be positive");
 
   for (auto& way : caches_) way.cache.SetMaxSize(way_size);
@@ -86,7 +155,8 @@ template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
   auto& way = GetWay(key);
   {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::unique_lock lock(way.mutex);
+    way.DrainReadBuffer();
     way.cache.Put(key, std::move(value));
   }
   NotifyDumper();
@@ -97,7 +167,23 @@ template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
                                               Validator validator) {
   auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
+  if (buffered_reads_) {
+    std::shared_lock lock(way.mutex);
+    auto* node = way.cache.FindNode(key);
+    if (!node) return std::nullopt;
+
+    if (validator(node->GetValue())) {
+      std::optional<U> result{node->GetValue()};
+      const bool is_buffer_full = way.BufferRead(*node);
+      lock.unlock();
+      if (is_buffer_full) way.TryDrainReadBuffer();
+      return result;
+    }
+    // The invalid value is erased under the unique lock below
+  }
+
+  std::unique_lock lock(way.mutex);
+  way.DrainReadBuffer();
   auto* value = way.cache.Get(key);
 
   if (value) {
@@ -112,7 +198,8 @@ template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
   auto& way = GetWay(key);
   {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::unique_lock lock(way.mutex);
+    way.DrainReadBuffer();
     way.cache.Erase(key);
   }
   NotifyDumper();
@@ -121,14 +208,18 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
   auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  std::unique_lock lock(way.mutex);
+  way.DrainReadBuffer();
+  auto* value = way.cache.Get(key);
+  if (value) return *value;
+  return default_value;
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
   for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::unique_lock lock(way.mutex);
+    way.DrainReadBuffer();
     way.cache.Clear();
   }
   NotifyDumper();
@@ -138,7 +229,7 @@ template <typename T, typename U, typename Hash, typename Eq>
 template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
   for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::shared_lock lock(way.mutex);
     way.cache.VisitAll(func);
   }
 }
@@ -147,7 +238,7 @@ template <typename T, typename U, typename Hash, typename Eq>
 size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   size_t size{0};
   for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::shared_lock lock(way.mutex);
     size += way.cache.GetSize();
   }
   return size;
@@ -156,11 +247,18 @@ size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
   for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::unique_lock lock(way.mutex);
+    way.DrainReadBuffer();
     way.cache.SetMaxSize(way_size);
   }
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetBufferedReads(bool buffered_reads) {
+  buffered_reads_ = buffered_reads;
+  for (auto& way : caches_) way.mutex.SetShared(buffered_reads);
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(
     const T& key) {
@@ -179,7 +277,7 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
   writer.Write(caches_.size());
 
   for (const Way& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::shared_lock lock(way.mutex);
 
     writer.Write(way.cache.GetSize());
 
@@ -205,6 +303,86 @@ void NWayLRU<T, U, Hash, Equal>::Read(dump::Reader& reader) {
   }
 }
 
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::WayMutex::SetShared(bool is_shared) {
+  if (is_shared == std::holds_alternative<engine::SharedMutex>(mutex_)) return;
+  if (is_shared) {
+    mutex_.template emplace<engine::SharedMutex>();
+  } else {
+    mutex_.template emplace<engine::Mutex>();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::WayMutex::lock() {
+  if (auto* mutex = std::get_if<engine::Mutex>(&mutex_)) {
+    mutex->lock();
+  } else {
+    std::get<engine::SharedMutex>(mutex_).lock();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::WayMutex::unlock() {
+  if (auto* mutex = std::get_if<engine::Mutex>(&mutex_)) {
+    mutex->unlock();
+  } else {
+    std::get<engine::SharedMutex>(mutex_).unlock();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool NWayLRU<T, U, Hash, Equal>::WayMutex::try_lock() {
+  if (auto* mutex = std::get_if<engine::Mutex>(&mutex_)) {
+    return mutex->try_lock();
+  }
+  return std::get<engine::SharedMutex>(mutex_).try_lock();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::WayMutex::lock_shared() {
+  if (auto* mutex = std::get_if<engine::Mutex>(&mutex_)) {
+    mutex->lock();
+  } else {
+    std::get<engine::SharedMutex>(mutex_).lock_shared();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::WayMutex::unlock_shared() {
+  if (auto* mutex = std::get_if<engine::Mutex>(&mutex_)) {
+    mutex->unlock();
+  } else {
+    std::get<engine::SharedMutex>(mutex_).unlock_shared();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool NWayLRU<T, U, Hash, Equal>::Way::BufferRead(Node& node) noexcept {
+  const auto index = read_buffer_size.fetch_add(1, std::memory_order_relaxed);
+  if (index < kReadBufferSize) {
+    read_buffer[index].store(&node, std::memory_order_relaxed);
+  }
+  return index + 1 >= kReadBufferSize;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::Way::DrainReadBuffer() {
+  const auto size = std::min(read_buffer_size.load(std::memory_order_relaxed),
+                             kReadBufferSize);
+  for (std::size_t i = 0; i < size; ++i) {
+    auto* node = read_buffer[i].exchange(nullptr, std::memory_order_relaxed);
+    if (node) cache.MarkRecentlyUsed(*node);
+  }
+  read_buffer_size.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void NWayLRU<T, U, Hash, Equal>::Way::TryDrainReadBuffer() {
+  std::unique_lock lock(mutex, std::try_to_lock);
+  if (lock) DrainReadBuffer();
+}
+
 template <typename T, typename U, typename Hash, typename Equal>
 void NWayLRU<T, U, Hash, Equal>::NotifyDumper() {
   if (dumper_ != nullptr) {
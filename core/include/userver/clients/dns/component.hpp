@@ -33,6 +33,8 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-prefetch-percent | percent of the reply TTL before the expiration to start the background update of the cached reply at | 10
+/// host-metrics-max-size | max number of hosts to report the metrics for, the hosts that were not resolved for a minute are replaced with the new ones, 0 disables the per-host metrics | 100
 ///
 /// ## Static configuration example:
 ///
@@ -39,6 +39,14 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// Share of the reply TTL before its expiration to update the record in
+  /// background, the network query timeout is used if it is greater
+  double cache_prefetch_share{0.1};
+
+  /// Max count of the hosts to collect the lookup source counters of,
+  /// 0 disables the per-host counters
+  size_t host_metrics_max_size{100};
 };
 
 }  // namespace clients::dns
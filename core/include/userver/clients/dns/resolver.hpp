@@ -3,12 +3,16 @@
 /// @file userver/clients/dns/resolver.hpp
 /// @brief @copybrief clients::dns::Resolver
 
+#include <atomic>
+#include <chrono>
+
 #include <userver/clients/dns/common.hpp>
 #include <userver/clients/dns/config.hpp>
 #include <userver/clients/dns/exception.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/statistics/relaxed_counter.hpp>
 
@@ -23,6 +27,10 @@ namespace clients::dns {
 /// Usually retrieved from clients::dns::Component.
 ///
 /// Combines file-based (/etc/hosts) name resolution with network-based one.
+/// The network results are updated in background shortly before their
+/// expiration while the cached ones are returned, the expired results are
+/// returned until the update succeeds. The failures are cached for a short
+/// time.
 class Resolver {
  public:
   struct LookupSourceCounters {
@@ -34,6 +42,14 @@ class Resolver {
     utils::statistics::RelaxedCounter<size_t> network_failure{0};
   };
 
+  struct HostCounters final : LookupSourceCounters {
+    /// Time of the last lookup of the host, the idle hosts give their place
+    /// to the new ones
+    std::atomic<std::chrono::steady_clock::time_point> last_lookup{};
+  };
+
+  using HostLookupSourceCounters = rcu::RcuMap<std::string, HostCounters>;
+
   Resolver(engine::TaskProcessor& fs_task_processor,
            const ResolverConfig& config);
   Resolver(const Resolver&) = delete;
@@ -54,6 +70,12 @@ class Resolver {
   /// Returns lookup source counters.
   const LookupSourceCounters& GetLookupSourceCounters() const;
 
+  /// Returns lookup source counters of at most
+  /// ResolverConfig::host_metrics_max_size resolved hosts. A host that was
+  /// not looked up for a minute is replaced by a new one when the limit is
+  /// reached.
+  const HostLookupSourceCounters& GetHostLookupSourceCounters() const;
+
   /// Forces the reload of lookup table file. Waits until the reload is done.
   void ReloadHosts();
 
@@ -0,0 +1,106 @@
+#pragma once
+
+/// @file userver/clients/http/batch.hpp
+/// @brief @copybrief clients::http::Batch
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+class ContextAccessor;
+}  // namespace engine::impl
+
+namespace clients::http {
+
+class Client;
+
+/// @brief Performs many HTTP requests with common settings concurrently and
+/// returns their results in the order of completion.
+///
+/// The requests are performed under one `http_batch` span that is tagged with
+/// the count of the requests and the count of the failed ones.
+/// The requests that are not completed are cancelled on the Batch
+/// destruction.
+///
+/// ## Example usage:
+///
+/// @snippet src/clients/http/batch_test.cpp  Sample HTTP Client batch usage
+class Batch final {
+ public:
+  /// The result of a request of the batch
+  struct Result {
+    /// The index of the request in the order of Add() calls
+    std::size_t index{0};
+
+    /// The response, nullptr if the request failed
+    std::shared_ptr<Response> response;
+
+    /// The exception of the failed request
+    std::exception_ptr error;
+  };
+
+  /// @param setup the function to apply to each of the requests returned by
+  /// CreateRequest(), e.g. to set the common timeouts and retries
+  explicit Batch(Client& client, std::function<void(Request&)> setup = {});
+
+  Batch(Batch&&) = delete;
+  Batch& operator=(Batch&&) = delete;
+  ~Batch();
+
+  /// Returns a new request of the client with the common settings applied
+  Request CreateRequest();
+
+  /// Adds the request to the batch, returns its index
+  /// @warning May not be called after Perform()
+  std::size_t Add(Request&& request);
+
+  /// Starts all the added requests
+  void Perform();
+
+  /// @brief Waits for the next completed request up to the `deadline`
+  /// @returns the result of the completed request, or `std::nullopt` if
+  /// all the requests are already returned, the deadline is reached or the
+  /// current task is cancelled
+  std::optional<Result> WaitAny(engine::Deadline deadline = {});
+
+  /// @brief Waits for all the requests that are not returned yet up to the
+  /// `deadline`
+  /// @returns the results of the completed requests in the order of
+  /// completion
+  std::vector<Result> WaitAll(engine::Deadline deadline = {});
+
+  /// Returns the count of the added requests
+  std::size_t GetSize() const noexcept;
+
+  /// Returns the count of the started requests that are not returned yet
+  std::size_t GetPendingCount() const noexcept { return pending_; }
+
+ private:
+  Result GetResult(std::size_t index);
+
+  Client& client_;
+  std::function<void(Request&)> setup_;
+  std::vector<Request> requests_;
+  std::vector<ResponseFuture> futures_;
+  std::vector<engine::impl::ContextAccessor*> targets_;
+  std::optional<tracing::Span> span_;
+  std::size_t pending_{0};
+  std::size_t failed_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,9 @@
 #endif
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -15,6 +18,7 @@
 #include <userver/clients/http/impl/config.hpp>
 #include <userver/clients/http/plugin.hpp>
 #include <userver/clients/http/request.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/fast_pimpl.hpp>
@@ -36,6 +40,7 @@ class HeadersPropagator;
 namespace curl {
 class easy;
 class multi;
+class share;
 class ConnectRateLimiter;
 }  // namespace curl
 
@@ -53,6 +58,7 @@ class Statistics;
 struct PoolStatistics;
 struct InstanceStatistics;
 class DestinationStatistics;
+class AddressBalancer;
 
 /// @ingroup userver_clients
 ///
@@ -83,6 +89,14 @@ class Client final {
   /// @note This method is thread-safe despite being non-const.
   Request CreateNotSignedRequest() { return CreateRequest(); }
 
+  /// @brief Opens connections to each of the `urls` from each of the client
+  /// threads by sending HEAD requests and waits for them up to the `deadline`.
+  ///
+  /// The connections are kept in the connection pool and are reused by the
+  /// following requests to the same hosts, so they do not pay the TCP and
+  /// TLS handshakes latency. Failures are logged and ignored.
+  void WarmUp(const std::vector<std::string>& urls, engine::Deadline deadline);
+
   /// @cond
   // For internal use only.
   void SetMultiplexingEnabled(bool enabled);
@@ -90,6 +104,12 @@ class Client final {
   // For internal use only.
   void SetMaxHostConnections(size_t max_host_connections);
 
+  // For internal use only.
+  void SetMaxConcurrentStreams(size_t max_concurrent_streams);
+
+  // For internal use only.
+  void SetDefaultHttpVersion(HttpVersion version);
+
   // For internal use only.
   PoolStatistics GetPoolStatistics() const;
 
@@ -131,6 +151,8 @@ class Client final {
   void SetDnsResolver(clients::dns::Resolver* resolver);
 
  private:
+  Request CreateRequestImpl(std::optional<size_t> multi_index);
+
   void ReinitEasy();
 
   InstanceStatistics GetMultiStatistics(size_t n) const;
@@ -165,8 +187,15 @@ class Client final {
 
   engine::TaskProcessor& fs_task_processor_;
   std::optional<std::string> user_agent_;
+  HttpVersion default_http_version_{HttpVersion::kDefault};
   rcu::Variable<std::string> proxy_;
 
+  struct DestinationGuardsConfig {
+    impl::RetryBudgetConfig retry_budget;
+    impl::CircuitBreakerConfig circuit_breaker;
+  };
+  rcu::Variable<DestinationGuardsConfig> destination_guards_config_;
+
   utils::SwappingSmart<const curl::easy> easy_;
   utils::PeriodicTask easy_reinit_task_;
 
@@ -175,8 +204,11 @@ class Client final {
   rcu::Variable<std::vector<std::string>> allowed_urls_extra_;
 
   std::shared_ptr<curl::ConnectRateLimiter> connect_rate_limiter_;
+  // DNS cache and TLS sessions shared by the requests of all the multis
+  std::shared_ptr<curl::share> share_;
 
   clients::dns::Resolver* resolver_{nullptr};
+  std::unique_ptr<AddressBalancer> address_balancer_;
   utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
   const server::http::HeadersPropagator* headers_propagator_{nullptr};
   impl::PluginPipeline plugin_pipeline_;
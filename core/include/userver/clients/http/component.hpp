@@ -26,9 +26,16 @@ namespace components {
 /// Returned references to clients::http::Client live for a lifetime of the
 /// component and are safe for concurrent use.
 ///
+/// The connections to the `warmup.urls` are opened before the component
+/// construction finishes, so the components that depend on it start with the
+/// warm connection pool. The components may warm up their own upstreams via
+/// clients::http::Client::WarmUp().
+///
 /// ## Dynamic options:
+/// * @ref HTTP_CLIENT_CIRCUIT_BREAKER
 /// * @ref HTTP_CLIENT_CONNECT_THROTTLE
 /// * @ref HTTP_CLIENT_CONNECTION_POOL_SIZE
+/// * @ref HTTP_CLIENT_RETRY_BUDGET
 /// * @ref USERVER_HTTP_PROXY
 ///
 /// ## Static options:
@@ -40,12 +47,22 @@ namespace components {
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
+/// http-version | HTTP version of the requests that do not set it explicitly: default, 1.0, 1.1, 2, 2tls or 2-prior-knowledge | default
+/// multiplexing | whether to send the concurrent HTTP/2 requests to the same host over one connection | true
+/// max-host-connections | max number of connections to a host, 0 for unlimited | 0
+/// max-concurrent-streams | max number of concurrent requests over one HTTP/2 connection | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
 /// bootstrap-http-proxy | HTTP proxy to use at service start. Will be overridden by @ref USERVER_HTTP_PROXY at runtime config update | ''
 /// testsuite-enabled | enable testsuite testing support | false
 /// testsuite-timeout | if set, force the request timeout regardless of the value passed in code | -
 /// testsuite-allowed-url-prefixes | if set, checks that all URLs start with any of the passed prefixes, asserts if not. Set for testing purposes only. | ''
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
+/// load-balancing.enabled | whether to pick one of the resolved addresses of a host for each request attempt, preferring the less loaded ones and ejecting the failing ones; requires the async dns_resolver | false
+/// load-balancing.consecutive-failures | count of 5xx responses and errors in a row to eject an address | 5
+/// load-balancing.ejection-time | time to eject an address for, grows with each ejection in a row | 30s
+/// load-balancing.max-ejected-percent | max percent of the addresses of a host to eject | 50
+/// warmup.urls | URLs to open connections to from each of the client threads at the component start by sending HEAD requests | []
+/// warmup.timeout | max time to wait for the warmup connections for | 5s
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name.
 ///
@@ -53,6 +53,14 @@ class CancelException : public BaseException {
   ~CancelException() override = default;
 };
 
+/// The request was not performed because the circuit breaker of its
+/// destination is open, see @ref HTTP_CLIENT_CIRCUIT_BREAKER
+class CircuitBreakerOpenException : public BaseException {
+ public:
+  using BaseException::BaseException;
+  ~CircuitBreakerOpenException() override = default;
+};
+
 class SSLException : public BaseCodeException {
  public:
   using BaseCodeException::BaseCodeException;
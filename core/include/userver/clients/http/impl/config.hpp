@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 
 #include <userver/dynamic_config/fwd.hpp>
@@ -23,12 +24,20 @@ struct DeadlinePropagationConfig {
   bool update_header{true};
 };
 
+struct LoadBalancingConfig {
+  bool enabled{false};
+  std::size_t consecutive_failures{5};
+  std::chrono::milliseconds ejection_time{30000};
+  double max_ejected_share{0.5};
+};
+
 // Static config
 struct ClientSettings final {
   std::string thread_name_prefix{};
   size_t io_threads{8};
   bool defer_events{false};
   DeadlinePropagationConfig deadline_propagation{};
+  LoadBalancingConfig load_balancing{};
   const tracing::TracingManagerBase* tracing_manager{nullptr};
   const server::http::HeadersPropagator* headers_propagator{nullptr};
 };
@@ -36,6 +45,24 @@ struct ClientSettings final {
 ClientSettings Parse(const yaml_config::YamlConfig& value,
                      formats::parse::To<ClientSettings>);
 
+struct RetryBudgetConfig final {
+  bool enabled{false};
+  double max_retries_share{0.1};
+  std::size_t min_retries_per_second{10};
+};
+
+RetryBudgetConfig Parse(const formats::json::Value& value,
+                        formats::parse::To<RetryBudgetConfig>);
+
+struct CircuitBreakerConfig final {
+  bool enabled{false};
+  std::size_t consecutive_failures{50};
+  std::chrono::milliseconds open_time{5000};
+};
+
+CircuitBreakerConfig Parse(const formats::json::Value& value,
+                           formats::parse::To<CircuitBreakerConfig>);
+
 struct ThrottleConfig final {
   static constexpr size_t kNoLimit = -1;
 
@@ -57,6 +84,8 @@ struct Config final {
   std::size_t connection_pool_size{kDefaultConnectionPoolSize};
   std::string proxy;
   ThrottleConfig throttle;
+  RetryBudgetConfig retry_budget;
+  CircuitBreakerConfig circuit_breaker;
 };
 
 Config ParseConfig(const dynamic_config::DocsMap& docs_map);
@@ -0,0 +1,109 @@
+#pragma once
+
+/// @file userver/clients/http/lite_client.hpp
+/// @brief @copybrief clients::http::LiteClient
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Settings of the clients::http::LiteClient
+struct LiteClientSettings final {
+  /// Max count of the idle kept-alive connections to an endpoint
+  std::size_t max_idle_connections{16};
+
+  /// Responses with a larger body are treated as network problems
+  std::size_t max_response_size{16 * 1024 * 1024};
+};
+
+/// A request of the clients::http::LiteClient
+struct LiteRequest final {
+  HttpMethod method{HttpMethod::kGet};
+
+  /// Path with the query, e.g. `/v1/users?id=42`
+  std::string target{"/"};
+
+  /// `Host` is set to the endpoint address if missing, `Content-Length` is
+  /// always set by the client
+  Headers headers;
+
+  std::string body;
+};
+
+/// A response of the clients::http::LiteClient
+struct LiteResponse final {
+  int status_code{0};
+  Headers headers;
+  std::string body;
+};
+
+/// @ingroup userver_clients
+///
+/// @brief Minimal HTTP/1.1 client for the hot calls to the nearby hosts,
+/// e.g. to a service mesh sidecar.
+///
+/// Unlike the clients::http::Client, requests are written to and read from
+/// the engine::io::Socket directly in the calling task, without handing the
+/// request over to the ev threads. Connections to each endpoint are kept
+/// alive and reused.
+///
+/// There is no DNS resolution, TLS, redirects, retries, compression, proxies,
+/// tracing headers or per-destination statistics. Use clients::http::Client
+/// for anything but plaintext calls to known addresses.
+///
+/// On errors the client throws clients::http::TimeoutException,
+/// clients::http::CancelException or
+/// clients::http::NetworkProblemException. HTTP error statuses are returned
+/// as is.
+///
+/// ## Usage synopsis
+/// @snippet clients/http/lite_client_test.cpp  Sample
+class LiteClient final {
+ public:
+  explicit LiteClient(LiteClientSettings settings = {});
+
+  LiteClient(const LiteClient&) = delete;
+  LiteClient& operator=(const LiteClient&) = delete;
+
+  ~LiteClient();
+
+  /// Performs the request to the `endpoint` over an idle connection or a new
+  /// one, suspending the current task until the response is received.
+  LiteResponse Perform(const engine::io::Sockaddr& endpoint,
+                       const LiteRequest& request, engine::Deadline deadline);
+
+  /// Count of the idle connections kept, for all the endpoints
+  std::size_t GetIdleConnectionsCount() const;
+
+ private:
+  engine::io::Socket AcquireConnection(const engine::io::Sockaddr& endpoint,
+                                       const std::string& endpoint_name,
+                                       engine::Deadline deadline,
+                                       bool& is_reused);
+
+  void ReleaseConnection(const std::string& endpoint_name,
+                         engine::io::Socket&& socket);
+
+  const LiteClientSettings settings_;
+
+  mutable engine::Mutex mutex_;
+  std::unordered_map<std::string, std::vector<engine::io::Socket>> idle_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -4,7 +4,10 @@
 /// @brief @copybrief clients::http::Plugin
 
 #include <chrono>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <vector>
 
 #include <userver/utils/not_null.hpp>
@@ -28,6 +31,29 @@ class PluginRequest final {
 
   void SetTimeout(std::chrono::milliseconds ms);
 
+  /// @brief Get the URL the request was created with
+  const std::string& GetOriginalUrl() const;
+
+  /// @brief Get the name of the HTTP method, "GET" if none was set
+  std::string_view GetMethod() const;
+
+  /// @brief Returns true if the request has a body to send
+  bool HasBody() const;
+
+  /// @brief Returns true if the request carries the Authorization or Cookie
+  ///        headers or the credentials of the HTTP authentication
+  bool HasCredentials() const;
+
+  /// @brief Returns true if the response body is streamed to the caller and
+  ///        is not available to the plugins
+  bool IsStreamedResponse() const;
+
+  /// @brief Get the timeout of a single attempt of the request
+  std::chrono::milliseconds GetTimeout() const;
+
+  /// @brief Get the destination the request statistics are accounted for
+  const std::string& GetDestination() const;
+
  private:
   RequestState& state_;
 };
@@ -42,6 +68,14 @@ class Plugin {
   /// @brief Get plugin name
   const std::string& GetName() const;
 
+  /// @brief The hook is called in coroutine context before any other hook of
+  ///        the request and before the request is sent. If the hook returns a
+  ///        response, the request is completed with it without any network
+  ///        activity and the rest of the hooks are not called.
+  ///
+  /// Returns nullptr by default.
+  virtual std::shared_ptr<Response> HookBeforePerform(PluginRequest& request);
+
   /// @brief The hook is called before actual HTTP request sending and before
   ///        DNS name resolution. You might want to use the hook for most of the
   ///        hook job.
@@ -58,6 +92,15 @@ class Plugin {
   ///          not do any heavy work here, offload it to other hooks.
   virtual void HookOnCompleted(PluginRequest& request, Response& response) = 0;
 
+  /// @brief The hook is called instead of HookOnCompleted if the request
+  ///        fails without a complete HTTP response, e.g. on a network error.
+  ///
+  /// Does nothing by default.
+  ///
+  /// @warning The hook is called in libev thread, not in coroutine context! Do
+  ///          not do any heavy work here, offload it to other hooks.
+  virtual void HookOnError(PluginRequest& request, std::error_code ec);
+
  private:
   const std::string name_;
 };
@@ -68,12 +111,16 @@ class PluginPipeline final {
  public:
   PluginPipeline(const std::vector<utils::NotNull<Plugin*>>& plugins);
 
+  std::shared_ptr<Response> HookBeforePerform(RequestState& request);
+
   void HookPerformRequest(RequestState& request);
 
   void HookCreateSpan(RequestState& request);
 
   void HookOnCompleted(RequestState& request, Response& response);
 
+  void HookOnError(RequestState& request, std::error_code ec);
+
  private:
   const std::vector<utils::NotNull<Plugin*>> plugins_;
 };
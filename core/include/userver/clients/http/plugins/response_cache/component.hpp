@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/clients/http/plugins/response_cache/component.hpp
+/// @brief @copybrief clients::http::plugins::response_cache::Component
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+class Plugin;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief HTTP client plugin that caches the responses honoring their
+/// `Cache-Control: max-age` and `ETag` headers.
+///
+/// Only the responses to the GET requests without a body are cached, the URL
+/// is the key. The requests with the Authorization or Cookie headers or with
+/// the HTTP authentication bypass the cache. Stale responses with an `ETag` are revalidated with the
+/// `If-None-Match` header. Concurrent requests of a URL that is not in the
+/// cache wait for the first of them, but no longer than their timeout.
+///
+/// @warning The responses are shared between all the requests of the HTTP
+/// client, enable the plugin only for the clients of the endpoints whose
+/// responses do not depend on the request headers.
+///
+/// Add the plugin name "response-cache" to the `plugins` option of
+/// components::HttpClient to enable it.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-entries | max count of the cached responses | 1000
+
+// clang-format on
+class Component final : public plugin::ComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of
+  /// clients::http::plugins::response_cache::Component component
+  static constexpr std::string_view kName = "http-client-plugin-response-cache";
+
+  Component(const components::ComponentConfig&,
+            const components::ComponentContext&);
+
+  ~Component() override;
+
+  http::Plugin& GetPlugin() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::unique_ptr<response_cache::Plugin> plugin_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace clients::http::plugins::response_cache
+
+template <>
+inline constexpr bool components::kHasValidate<
+    clients::http::plugins::response_cache::Component> = true;
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,10 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -36,11 +39,14 @@ class ConnectTo;
 class Form;
 class RequestStats;
 class DestinationStatistics;
+class AddressBalancer;
 struct TestsuiteConfig;
 
 namespace impl {
 class EasyWrapper;
 struct DeadlinePropagationConfig;
+struct RetryBudgetConfig;
+struct CircuitBreakerConfig;
 }  // namespace impl
 
 /// HTTP request method
@@ -58,6 +64,18 @@ enum class HttpVersion {
   k2PriorKnowledge,  ///< HTTP/2 only (without Upgrade)
 };
 
+/// Settings of the hedged requests, see Request::hedging()
+struct HedgingSettings {
+  /// Delay after the start of the request before each extra attempt
+  std::chrono::milliseconds delay{50};
+  /// Maximum number of simultaneous attempts including the first one, the
+  /// hedging is disabled if it is less than 2
+  std::size_t max_attempts{2};
+  /// If set, the delay is at least this percentile (e.g. 95) of the recent
+  /// timings of the destination, see Request::SetDestinationMetricName()
+  std::optional<double> delay_percentile;
+};
+
 enum class HttpAuthType {
   kBasic,      ///< "basic"
   kDigest,     ///< "digest"
@@ -161,6 +179,18 @@ class Request final {
   /// form for POST request
   Request& form(const Form& form) &;
   Request form(const Form& form) &&;
+  /// @brief Body for POST, PUT or PATCH request read from the queue while the
+  /// request is performed.
+  ///
+  /// The body ends when all the producers of the queue are gone. The memory
+  /// is bounded by the queue size: the producer waits while curl sends the
+  /// data. The body is sent with chunked transfer encoding unless
+  /// `content_length` is set. The body is read by a single perform call, the
+  /// request is not retried.
+  Request& data_stream(std::shared_ptr<concurrent::StringStreamQueue> queue,
+                       std::optional<std::size_t> content_length = {}) &;
+  Request data_stream(std::shared_ptr<concurrent::StringStreamQueue> queue,
+                      std::optional<std::size_t> content_length = {}) &&;
   /// Headers for request as map
   Request& headers(const Headers& headers) &;
   Request headers(const Headers& headers) &&;
@@ -244,6 +274,17 @@ class Request final {
   Request& retry(short retries = 3, bool on_fails = true) &;
   Request retry(short retries = 3, bool on_fails = true) &&;
 
+  /// Enable hedging: if there is no response after the delay, send an extra
+  /// attempt of the same request without cancelling the previous ones. The
+  /// first successful (not 5xx) response is returned and the other attempts
+  /// are cancelled; if all the attempts fail, the last failure is returned.
+  ///
+  /// Hedging must only be used for idempotent requests. It replaces the
+  /// retries set by retry() and is ignored by async_perform_stream_body() and
+  /// for the requests with data_stream().
+  Request& hedging(const HedgingSettings& settings) &;
+  Request hedging(const HedgingSettings& settings) &&;
+
   /// Set unix domain socket as connection endpoint and provide path to it
   /// When enabled, request will connect to the Unix domain socket instead
   /// of establishing a TCP connection to a host.
@@ -294,6 +335,14 @@ class Request final {
       const impl::DeadlinePropagationConfig& deadline_propagation_config) &;
 
   void SetHeadersPropagator(const server::http::HeadersPropagator*) &;
+
+  void SetAddressBalancer(AddressBalancer* address_balancer) &;
+
+  // Set the retry budget and the circuit breaker settings of the destination.
+  // For internal use only.
+  void SetDestinationGuardsConfig(
+      const impl::RetryBudgetConfig& retry_budget,
+      const impl::CircuitBreakerConfig& circuit_breaker) &;
   /// @endcond
 
   /// Disable auto-decoding of received replies.
@@ -23,6 +23,7 @@ namespace components {
 /// * server::handlers::Jemalloc
 /// * server::handlers::LogLevel
 /// * server::handlers::OnLogRotate
+/// * server::handlers::Profiler
 /// * server::handlers::ServerMonitor
 /// * server::handlers::TestsControl
 /// * components::AuthCheckerSettings
@@ -3,6 +3,7 @@
 /// @file userver/components/component_context.hpp
 /// @brief @copybrief components::ComponentContext
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <stdexcept>
@@ -28,6 +29,7 @@ namespace impl {
 
 enum class ComponentLifetimeStage;
 class ComponentInfo;
+struct ComponentLoadStats;
 
 template <class T>
 constexpr auto NameFromComponentType() -> decltype(std::string_view{T::kName}) {
@@ -192,6 +194,9 @@ class ComponentContext final {
 
   impl::ComponentBase* DoFindComponent(std::string_view name) const;
 
+  std::vector<impl::ComponentLoadStats> GetComponentsLoadStats(
+      std::chrono::steady_clock::time_point load_start) const;
+
   struct Impl;
   std::unique_ptr<Impl> impl_;
 };
@@ -19,11 +19,13 @@ namespace components {
 /// @brief Component for storing files in memory
 /// ## Static options:
 ///
-/// Name              | Description                                          | Default value
-/// ----------------- | ---------------------------------------------------- | -------------
-/// dir               | directory to cache files from                        | /var/www
-/// update-period     | Update period (0 - fill the cache only at startup)   | 0
-/// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// Name                 | Description                                          | Default value
+/// -------------------- | ---------------------------------------------------- | -------------
+/// dir                  | directory to cache files from                        | /var/www
+/// update-period        | Update period (0 - fill the cache only at startup)   | 0
+/// fs-task-processor    | task processor to do filesystem operations           | fs-task-processor
+/// max-cached-file-size | contents of the bigger files are not kept in memory  | unlimited
+/// precompress          | compress the cached files with gzip and brotli      | false
 
 // clang-format on
 
@@ -3,6 +3,8 @@
 /// @file userver/components/logging_configurator.hpp
 /// @brief @copybrief components::LoggingConfigurator
 
+#include <vector>
+
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/impl/component_base.hpp>
 #include <userver/concurrent/async_event_source.hpp>
@@ -13,6 +15,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 struct DynamicDebugConfig;
+struct LogRateLimitConfig;
 }
 
 namespace components {
@@ -28,6 +31,7 @@ namespace components {
 ///
 /// ## Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
+/// * @ref USERVER_LOG_LIMITS
 /// * @ref USERVER_NO_LOG_SPANS
 ///
 /// ## Static options:
@@ -59,6 +63,7 @@ class LoggingConfigurator final : public impl::ComponentBase {
 
   concurrent::AsyncEventSubscriberScope config_subscription_;
   rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+  rcu::Variable<std::vector<logging::LogRateLimitConfig>> log_rate_limits_;
 };
 
 /// }@
@@ -23,6 +23,10 @@ class Manager;
 /// @brief Component that prepares the engine internals and starts all the
 /// other components.
 ///
+/// The statistics of the engine::InstrumentedMutex,
+/// engine::InstrumentedSharedMutex and engine::InstrumentedSemaphore are
+/// reported in the `engine.locks` metrics labelled by `lock`.
+///
 /// ## Dynamic config
 /// * @ref USERVER_TASK_PROCESSOR_PROFILER_DEBUG
 /// * @ref USERVER_TASK_PROCESSOR_QOS
@@ -33,8 +37,13 @@ class Manager;
 /// coro_pool.initial_size | amount of coroutines to preallocate on startup | 1000
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
+/// coro_pool.stack_size_classes | additional coroutine stack sizes, task processors opt into them with `coro-stack-size` | []
+/// coro_pool.stack_usage_sampling_period | measure the coroutine stack high watermark after every N-th task and report it in the `coro-pool.stack-usage-kb` histogram and the `coro-pool.max-stack-usage-bytes` gauge, 0 disables the sampling | 0
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
+/// event_thread_pool.io_uring | wait for the socket readiness via io_uring instead of epoll, falls back to epoll if io_uring is not available | false
+/// event_thread_pool.timer_wheel | keep the task deadline and sleep timers in a per-thread hierarchical timer wheel with 1ms resolution instead of separate libev timers | false
+/// event_thread_pool.worker_affinity | register the I/O watchers and timers of each task processor worker thread on its own home ev thread instead of spreading them round-robin | false
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
@@ -47,7 +56,19 @@ class Manager;
 /// thread_name | set OS thread name to this value | Part of the task_processor name before the first '-' symbol with '-worker' appended; for example 'fs-worker' or 'main-worker'
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
+/// ev-thread-affinity | register all the I/O watchers of the tasks on a single ev thread to avoid cross-thread handoffs, requires worker_threads to be 1; components::SingleThreadedTaskProcessors pin their processors to different ev threads | false
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 10000
+/// task-queue | task queue implementation: 'global' for a single queue shared by all the workers, 'work-stealing' for per-worker run queues with stealing. With 'work-stealing' a task woken up from a worker thread is run by the same worker right after the current task, so it may wait until the current task yields if other workers are asleep | global
+/// numa-sharding | split the workers into per-NUMA-node groups: threads are pinned to the CPUs of their node, each group gets its own task queue shard and reuses coroutine stacks allocated on its node, cross-node stealing is only a fallback. Requires 'task-queue: work-stealing' | false
+/// task-priorities | dequeue weights of the per-priority queue lanes, e.g. `{high: 4, normal: 2, low: 1}`; without the option all the engine::Task::Priority values share a single queue. Requires 'task-queue: global' | -
+/// worker-autoscaling | optional dictionary of options to park and unpark worker threads depending on the load, at most worker_threads are active. Requires 'task-queue: global' | empty (disabled)
+/// worker-autoscaling.min-workers | required minimal number of active workers | -
+/// worker-autoscaling.check-interval | how often to re-evaluate the active worker count | 1s
+/// worker-autoscaling.scale-up-wait-time | unpark more workers if a sampled task waited in the queue for this long | 1ms
+/// worker-autoscaling.scale-down-load-percent | park a worker if the average CPU load of the active workers is below this value and the queue wait time is below half of scale-up-wait-time | 50
+/// coro-stack-size | coroutine stack size for the tasks of the task processor, the smallest of coro_pool.stack_size and coro_pool.stack_size_classes that fits is used | coro_pool.stack_size
+/// task-profiler | optional dictionary of task profiler options, the results are reported in the `engine.task-processors.task-profiler` metrics labelled by `span_name` and by server::handlers::TaskProfiler | empty (disabled)
+/// task-profiler.every | set N to profile each Nth task | 1000
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -3,6 +3,8 @@
 /// @file userver/components/tcp_acceptor_base.hpp
 /// @brief @copybrief components::TcpAcceptorBase
 
+#include <vector>
+
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -34,6 +36,8 @@ namespace components {
 /// backlog | max count of new connections pending acceptance | 1024
 /// no_delay | whether to set the `TCP_NODELAY` option on incoming sockets | true
 /// sockets_task_processor | task processor to process accepted sockets | value of `task_processor`
+/// shards | count of the SO_REUSEPORT sockets listening on the `port`, each with its own accept loop | 1
+/// reuseport-cpu-steering | let the kernel pick the socket of the `shards` by the CPU that received the connection; Linux only | false
 ///
 /// @see @ref scripts/docs/en/userver/tutorial/tcp_service.md
 
@@ -57,7 +61,7 @@ class TcpAcceptorBase : public LoggableComponentBase {
                   const ComponentContext& context,
                   const server::net::ListenerConfig& acceptor_config);
 
-  void KeepAccepting();
+  void KeepAccepting(engine::io::Socket& listen_sock);
 
   void OnAllComponentsLoaded() final;
   void OnAllComponentsAreStopping() final;
@@ -66,8 +70,8 @@ class TcpAcceptorBase : public LoggableComponentBase {
   engine::TaskProcessor& acceptor_task_processor_;
   engine::TaskProcessor& sockets_task_processor_;
   concurrent::BackgroundTaskStorageCore tasks_;
-  engine::io::Socket listen_sock_;
-  engine::Task acceptor_;
+  std::vector<engine::io::Socket> listen_sockets_;
+  std::vector<engine::Task> acceptors_;
 };
 
 }  // namespace components
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// Bounded lock-free FIFO of a fixed capacity, based on the array queue of
+// Dmitry Vyukov. Every cell carries a sequence number that tells whether the
+// cell is ready for the producer or for the consumer of the current lap, so
+// neither side touches the counter of the other one.
+//
+// The capacity is rounded up to a power of two and allocated at once.
+// TryPush fails if the buffer is full, TryPop fails if it is empty.
+template <typename T>
+class BoundedRingBuffer final {
+ public:
+  explicit BoundedRingBuffer(std::size_t capacity)
+      : mask_(RoundUpToPowerOfTwo(capacity) - 1),
+        cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~BoundedRingBuffer() {
+    T value;
+    while (TryPop(value)) {
+    }
+  }
+
+  BoundedRingBuffer(BoundedRingBuffer&&) = delete;
+  BoundedRingBuffer& operator=(BoundedRingBuffer&&) = delete;
+
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  // `value` is not moved out on failure
+  [[nodiscard]] bool TryPush(T&& value) {
+    std::size_t pos = push_pos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const auto sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos);
+      if (diff == 0) {
+        if (push_pos_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The consumer of the previous lap has not released the cell yet
+        return false;
+      } else {
+        pos = push_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    ::new (static_cast<void*>(&cell->storage)) T(std::move(value));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  [[nodiscard]] bool TryPop(T& value) {
+    std::size_t pos = pop_pos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const auto sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (pop_pos_.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // Empty, or the producer of the cell has not finished writing it
+        return false;
+      } else {
+        pos = pop_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    T& stored = *std::launder(reinterpret_cast<T*>(&cell->storage));
+    value = std::move(stored);
+    stored.~T();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Appends up to `max_count` elements to `out`, returns their count
+  template <typename OutputIt>
+  [[nodiscard]] std::size_t TryPopBulk(OutputIt out, std::size_t max_count) {
+    std::size_t count = 0;
+    T value;
+    while (count < max_count && TryPop(value)) {
+      *out++ = std::move(value);
+      ++count;
+    }
+    return count;
+  }
+
+ private:
+  struct Cell final {
+    std::atomic<std::size_t> sequence{0};
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+  };
+
+  static std::size_t RoundUpToPowerOfTwo(std::size_t value) noexcept {
+    std::size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+  }
+
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+  alignas(64) std::atomic<std::size_t> push_pos_{0};
+  alignas(64) std::atomic<std::size_t> pop_pos_{0};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
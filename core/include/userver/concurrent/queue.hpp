@@ -1,11 +1,16 @@
 #pragma once
 
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/concurrent/impl/bounded_ring_buffer.hpp>
 #include <userver/concurrent/impl/semaphore_capacity_control.hpp>
 #include <userver/concurrent/queue_helpers.hpp>
 #include <userver/engine/deadline.hpp>
@@ -30,6 +35,7 @@ struct SimpleQueuePolicy {
 
   static constexpr bool kIsMultipleProducer{MultipleProducer};
   static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsRingBuffer{false};
 };
 
 template <bool MultipleProducer, bool MultipleConsumer>
@@ -41,6 +47,25 @@ struct ContainerQueuePolicy {
 
   static constexpr bool kIsMultipleProducer{MultipleProducer};
   static constexpr bool kIsMultipleConsumer{MultipleConsumer};
+  static constexpr bool kIsRingBuffer{false};
+};
+
+// Keeps the elements in a preallocated FIFO ring buffer. The size limit may
+// not exceed the buffer size, so the capacity accounting of the producer side
+// guarantees that a push always finds a free cell. A consumer that has popped
+// a later element before an earlier one would break that, hence no
+// multi-consumer variant.
+template <bool MultipleProducer>
+struct RingBufferQueuePolicy {
+  template <typename T>
+  static constexpr std::size_t GetElementSize(const T&) {
+    return 1;
+  }
+
+  static constexpr bool kIsMultipleProducer{MultipleProducer};
+  static constexpr bool kIsMultipleConsumer{false};
+  static constexpr bool kIsRingBuffer{true};
+  static constexpr std::size_t kDefaultMaxSize{1024};
 };
 
 }  // namespace impl
@@ -56,19 +81,26 @@ class GenericQueue final
     explicit EmplaceEnabler() = default;
   };
 
+  static constexpr bool kIsRingBuffer = QueuePolicy::kIsRingBuffer;
+  static constexpr bool kHasMoodycamelTokens =
+      QueuePolicy::kIsMultipleProducer && !kIsRingBuffer;
+
+  using Storage = std::conditional_t<kIsRingBuffer, impl::BoundedRingBuffer<T>,
+                                     moodycamel::ConcurrentQueue<T>>;
+
   using ProducerToken =
-      std::conditional_t<QueuePolicy::kIsMultipleProducer,
-                         moodycamel::ProducerToken, impl::NoToken>;
+      std::conditional_t<kHasMoodycamelTokens, moodycamel::ProducerToken,
+                         impl::NoToken>;
   using ConsumerToken =
-      std::conditional_t<QueuePolicy::kIsMultipleProducer,
-                         moodycamel::ConsumerToken, impl::NoToken>;
+      std::conditional_t<kHasMoodycamelTokens, moodycamel::ConsumerToken,
+                         impl::NoToken>;
   using MultiProducerToken = impl::MultiToken;
   using MultiConsumerToken =
       std::conditional_t<QueuePolicy::kIsMultipleProducer, impl::MultiToken,
                          impl::NoToken>;
 
   using SingleProducerToken =
-      std::conditional_t<!QueuePolicy::kIsMultipleProducer,
+      std::conditional_t<!QueuePolicy::kIsMultipleProducer && !kIsRingBuffer,
                          moodycamel::ProducerToken, impl::NoToken>;
 
   friend class Producer<GenericQueue, ProducerToken, EmplaceEnabler>;
@@ -94,9 +126,9 @@ class GenericQueue final
   /// @cond
   // For internal use only
   explicit GenericQueue(std::size_t max_size, EmplaceEnabler /*unused*/)
-      : queue_(),
+      : queue_(CreateStorage(max_size)),
         single_producer_token_(queue_),
-        producer_side_(*this, std::min(max_size, kUnbounded)),
+        producer_side_(*this, std::min(max_size, GetMaxSizeLimit())),
         consumer_side_(*this) {}
 
   ~GenericQueue() {
@@ -122,8 +154,12 @@ class GenericQueue final
   /// @endcond
 
   /// Create a new queue
+  ///
+  /// The ring-buffer queues allocate the buffer for `max_size` elements at
+  /// once, rounding it up to a power of two. Their size limit can't be raised
+  /// above the buffer size later.
   static std::shared_ptr<GenericQueue> Create(
-      std::size_t max_size = kUnbounded) {
+      std::size_t max_size = GetDefaultMaxSize()) {
     return std::make_shared<GenericQueue>(max_size, EmplaceEnabler{});
   }
 
@@ -184,7 +220,7 @@ class GenericQueue final
   /// @brief Sets the limit on the queue size, pushes over this limit will block
   /// @note This is a soft limit and may be slightly overrun under load.
   void SetSoftMaxSize(std::size_t max_size) {
-    producer_side_.SetSoftMaxSize(std::min(max_size, kUnbounded));
+    producer_side_.SetSoftMaxSize(std::min(max_size, GetMaxSizeLimit()));
   }
 
   /// @brief Gets the limit on the queue size
@@ -213,6 +249,32 @@ class GenericQueue final
       std::conditional_t<QueuePolicy::kIsMultipleConsumer, MultiConsumerSide,
                          SingleConsumerSide>;
 
+  static constexpr std::size_t GetDefaultMaxSize() {
+    if constexpr (kIsRingBuffer) {
+      return QueuePolicy::kDefaultMaxSize;
+    } else {
+      return kUnbounded;
+    }
+  }
+
+  static Storage CreateStorage(std::size_t max_size) {
+    if constexpr (kIsRingBuffer) {
+      UINVARIANT(max_size < kUnbounded,
+                 "A ring-buffer queue requires a finite max_size");
+      return Storage{max_size};
+    } else {
+      return Storage{};
+    }
+  }
+
+  std::size_t GetMaxSizeLimit() const {
+    if constexpr (kIsRingBuffer) {
+      return queue_.GetCapacity();
+    } else {
+      return kUnbounded;
+    }
+  }
+
   template <typename Token>
   [[nodiscard]] bool Push(Token& token, T&& value, engine::Deadline deadline) {
     return producer_side_.Push(token, std::move(value), deadline);
@@ -223,6 +285,34 @@ class GenericQueue final
     return producer_side_.PushNoblock(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    if (values.empty()) return true;
+    CheckBatchFits(values);
+    return producer_side_.PushMany(token, std::move(values), deadline);
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushManyNoblock(Token& token, std::vector<T>&& values) {
+    if (values.empty()) return true;
+    CheckBatchFits(values);
+    return producer_side_.PushManyNoblock(token, std::move(values));
+  }
+
+  // A batch over the size limit never fits, the producer sides would either
+  // fail at once or wait until the deadline
+  void CheckBatchFits(const std::vector<T>& values) const {
+    if (NoMoreConsumers()) return;
+    const auto total_size = GetTotalSize(values);
+    const auto max_size = GetSoftMaxSize();
+    if (total_size > max_size) {
+      throw std::length_error(
+          "The batch is larger than the queue size limit: batch size=" +
+          std::to_string(total_size) + ", limit=" + std::to_string(max_size));
+    }
+  }
+
   template <typename Token>
   [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
     return consumer_side_.Pop(token, value, deadline);
@@ -233,6 +323,38 @@ class GenericQueue final
     return consumer_side_.PopNoblock(token, value);
   }
 
+  engine::impl::ContextAccessor* TryGetConsumerContextAccessor() noexcept {
+    static_assert(!QueuePolicy::kIsMultipleConsumer,
+                  "engine::WaitAny is only supported for single-consumer "
+                  "queues");
+    return consumer_side_.TryGetContextAccessor();
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (max_count == 0) return 0;
+    return consumer_side_.PopMany(token, values, max_count, deadline);
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopManyNoblock(Token& token,
+                                           std::vector<T>& values,
+                                           std::size_t max_count) {
+    if (max_count == 0) return 0;
+    return consumer_side_.PopManyNoblock(token, values, max_count);
+  }
+
+  static std::size_t GetTotalSize(const std::vector<T>& values,
+                                  std::size_t offset = 0) {
+    std::size_t total_size = 0;
+    for (std::size_t i = offset; i < values.size(); ++i) {
+      total_size += QueuePolicy::GetElementSize(values[i]);
+    }
+    return total_size;
+  }
+
   void PrepareProducer() {
     std::size_t old_producers_count{};
     utils::AtomicUpdate(producers_count_, [&](auto old_value) {
@@ -289,7 +411,11 @@ class GenericQueue final
  private:
   template <typename Token>
   void DoPush(Token& token, T&& value) {
-    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+    if constexpr (kIsRingBuffer) {
+      const bool success = queue_.TryPush(std::move(value));
+      // The producer side has reserved a cell for the element
+      UINVARIANT(success, "No free cell in the ring-buffer queue");
+    } else if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
       static_assert(QueuePolicy::kIsMultipleProducer);
       queue_.enqueue(token, std::move(value));
     } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
@@ -304,11 +430,41 @@ class GenericQueue final
     consumer_side_.OnElementPushed();
   }
 
+  // Enqueues the whole batch, then wakes up the consumers once
+  template <typename Token>
+  void DoPushMany(Token& token, std::vector<T>&& values) {
+    const auto first = std::make_move_iterator(values.begin());
+    const auto count = values.size();
+
+    if constexpr (kIsRingBuffer) {
+      for (auto it = first; it != std::make_move_iterator(values.end());
+           ++it) {
+        const bool success = queue_.TryPush(*it);
+        UINVARIANT(success, "No free cell in the ring-buffer queue");
+      }
+    } else if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, first, count);
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(first, count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_, first, count);
+    }
+    values.clear();
+
+    consumer_side_.OnElementsPushed(count);
+  }
+
   template <typename Token>
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     bool success{};
 
-    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+    if constexpr (kIsRingBuffer) {
+      success = queue_.TryPop(value);
+    } else if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
       static_assert(QueuePolicy::kIsMultipleProducer);
       success = queue_.try_dequeue(token, value);
     } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
@@ -328,7 +484,37 @@ class GenericQueue final
     return false;
   }
 
-  moodycamel::ConcurrentQueue<T> queue_{1};
+  // Appends up to `max_count` elements to `values`, then wakes up the
+  // producers once
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const auto old_size = values.size();
+    const auto out = std::back_inserter(values);
+    std::size_t count{};
+
+    if constexpr (kIsRingBuffer) {
+      count = queue_.TryPopBulk(out, max_count);
+    } else if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(token, out, max_count);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(out, max_count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk_from_producer(single_producer_token_, out,
+                                                    max_count);
+    }
+
+    if (count != 0) {
+      producer_side_.OnElementPopped(GetTotalSize(values, old_size));
+    }
+    return count;
+  }
+
+  Storage queue_;
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
 
@@ -368,6 +554,25 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return DoPush(token, std::move(value));
   }
 
+  // Unlike Push, a single wakeup may release not enough space for the batch
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    while (!DoPushMany(token, std::move(values))) {
+      if (queue_.NoMoreConsumers() ||
+          !non_full_event_.WaitForEventUntil(deadline)) {
+        // NOLINTNEXTLINE(bugprone-use-after-move)
+        return DoPushMany(token, std::move(values));
+      }
+    }
+    return true;
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushManyNoblock(Token& token, std::vector<T>&& values) {
+    return DoPushMany(token, std::move(values));
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -406,6 +611,20 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>&& values) {
+    const std::size_t total_size = GetTotalSize(values);
+    if (queue_.NoMoreConsumers() ||
+        used_capacity_.load() + total_size > total_capacity_.load()) {
+      return false;
+    }
+
+    used_capacity_.fetch_add(total_size);
+    queue_.DoPushMany(token, std::move(values));
+    non_full_event_.Reset();
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -438,6 +657,22 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value));
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>&& values,
+                              engine::Deadline deadline) {
+    const std::size_t total_size = GetTotalSize(values);
+    return remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                           total_size) &&
+           DoPushMany(token, std::move(values), total_size);
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushManyNoblock(Token& token, std::vector<T>&& values) {
+    const std::size_t total_size = GetTotalSize(values);
+    return remaining_capacity_.try_lock_shared_count(total_size) &&
+           DoPushMany(token, std::move(values), total_size);
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -476,6 +711,19 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>&& values,
+                                std::size_t total_size) {
+    UASSERT(total_size > 0);
+    if (queue_.NoMoreConsumers()) {
+      remaining_capacity_.unlock_shared_count(total_size);
+      return false;
+    }
+
+    queue_.DoPushMany(token, std::move(values));
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore remaining_capacity_;
   concurrent::impl::SemaphoreCapacityControl remaining_capacity_control_;
@@ -483,11 +731,16 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
 
 // Single consumer ConsumerSide implementation
 template <typename T, typename QueuePolicy>
-class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
+class GenericQueue<T, QueuePolicy>::SingleConsumerSide final
+    : private engine::impl::ContextAccessor {
  public:
   explicit SingleConsumerSide(GenericQueue& queue)
       : queue_(queue), element_count_(0) {}
 
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept {
+    return this;
+  }
+
   // Blocks only if queue is empty
   template <typename Token>
   [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
@@ -508,11 +761,37 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    std::size_t count{};
+    while ((count = DoPopMany(token, values, max_count)) == 0) {
+      if (queue_.NoMoreProducers() ||
+          !nonempty_event_.WaitForEventUntil(deadline)) {
+        // Same TOCTOU as in Pop
+        return DoPopMany(token, values, max_count);
+      }
+    }
+    return count;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopManyNoblock(Token& token, std::vector<T>& values,
+                                           std::size_t max_count) {
+    return DoPopMany(token, values, max_count);
+  }
+
   void OnElementPushed() {
     ++element_count_;
     nonempty_event_.Send();
   }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
+    nonempty_event_.Send();
+  }
+
   void StopBlockingOnPop() { nonempty_event_.Send(); }
 
   void ResumeBlockingOnPop() {}
@@ -520,6 +799,30 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
   std::size_t GetElementCount() const { return element_count_; }
 
  private:
+  // Ready if Pop would not block
+  bool IsReady() const noexcept override {
+    return element_count_ > 0 || queue_.NoMoreProducers();
+  }
+
+  void AppendWaiter(engine::impl::TaskContext& context) noexcept override {
+    auto& event_accessor = *nonempty_event_.TryGetContextAccessor();
+    while (true) {
+      event_accessor.AppendWaiter(context);
+      // Either appended, or signaled by a push that IsReady accounts for
+      if (!nonempty_event_.IsReady() || IsReady()) return;
+      // The signal is left from the elements that were already popped, it
+      // does not wake the waiter. Only the consumer resets the signal, so no
+      // waiter is appended at this point.
+      nonempty_event_.Reset();
+    }
+  }
+
+  void RemoveWaiter(engine::impl::TaskContext& context) noexcept override {
+    nonempty_event_.TryGetContextAccessor()->RemoveWaiter(context);
+  }
+
+  void RethrowErrorResult() const override {}
+
   template <typename Token>
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     if (queue_.DoPop(token, value)) {
@@ -530,6 +833,17 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    const auto count = queue_.DoPopMany(token, values, max_count);
+    if (count != 0) {
+      element_count_ -= count;
+      nonempty_event_.Reset();
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -561,8 +875,27 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (!element_count_.try_lock_shared_until(deadline)) return 0;
+    return DoPopMany(token, values, LockMore(max_count));
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopManyNoblock(Token& token, std::vector<T>& values,
+                                           std::size_t max_count) {
+    if (!element_count_.try_lock_shared()) return 0;
+    return DoPopMany(token, values, LockMore(max_count));
+  }
+
   void OnElementPushed() { element_count_.unlock_shared(); }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
+
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
                                                kSemaphoreUnlockValue);
@@ -598,6 +931,34 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  // One element is already locked, tries to lock the rest of the batch without
+  // waiting. Returns the number of locked elements.
+  std::size_t LockMore(std::size_t max_count) {
+    const std::size_t extra_count =
+        std::min(max_count - 1, GetElementCount());
+    if (extra_count != 0 && element_count_.try_lock_shared_count(extra_count)) {
+      return extra_count + 1;
+    }
+    return 1;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t locked_count) {
+    std::size_t count = 0;
+    while (count < locked_count) {
+      const auto popped =
+          queue_.DoPopMany(token, values, locked_count - count);
+      count += popped;
+      if (popped == 0 && queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(locked_count - count);
+        break;
+      }
+      // See DoPop for the reasons of a spurious miss
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
@@ -654,6 +1015,30 @@ using SpscQueue = GenericQueue<T, impl::SimpleQueuePolicy<false, false>>;
 using StringStreamQueue =
     GenericQueue<std::string, impl::ContainerQueuePolicy<false, false>>;
 
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO single producer single consumer queue.
+///
+/// The elements are kept in a ring buffer that is allocated on creation, so
+/// pushes and pops do not allocate. The size limit is fixed at creation, by
+/// default it is 1024 elements.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedSpscQueue = GenericQueue<T, impl::RingBufferQueuePolicy<false>>;
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded FIFO multiple producers single consumer queue.
+///
+/// Unlike concurrent::NonFifoMpscQueue, items from different producers are
+/// delivered in the order in which they were pushed.
+///
+/// @see concurrent::BoundedSpscQueue for the storage details.
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+using BoundedMpscQueue = GenericQueue<T, impl::RingBufferQueuePolicy<true>>;
+
 }  // namespace concurrent
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/context_accessor.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -63,6 +65,33 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push all the `values` into queue at once, waking up the consumers only
+  /// once. May wait asynchronously until there is enough space in the queue
+  /// for the whole batch. Leaves the `values` unmodified if the operation does
+  /// not succeed and clears them otherwise.
+  /// @returns whether push succeeded before the deadline and before the task
+  /// was canceled.
+  /// @throws std::length_error if the batch is larger than the queue size
+  /// limit and thus would never fit.
+  /// @note Only supported by concurrent::GenericQueue
+  [[nodiscard]] bool PushMany(std::vector<ValueType>&& values,
+                              engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushMany(token_, std::move(values), deadline);
+  }
+
+  /// Try to push all the `values` into queue at once without blocking. May be
+  /// used in non-coroutine environment. Leaves the `values` unmodified if the
+  /// operation does not succeed and clears them otherwise.
+  /// @returns whether push succeeded.
+  /// @throws std::length_error if the batch is larger than the queue size
+  /// limit and thus would never fit.
+  /// @note Only supported by concurrent::GenericQueue
+  [[nodiscard]] bool PushManyNoblock(std::vector<ValueType>&& values) const {
+    UASSERT(queue_);
+    return queue_->PushManyNoblock(token_, std::move(values));
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -124,12 +153,40 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_count` elements from queue at once, appending them to
+  /// `values`. May wait asynchronously if the queue is empty, but the producer
+  /// is alive. Does not wait for more elements once there is at least one.
+  /// @returns the number of popped elements, zero if nothing was popped before
+  /// the deadline.
+  /// @note Only supported by concurrent::GenericQueue
+  [[nodiscard]] std::size_t PopMany(std::vector<ValueType>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline = {}) const {
+    return queue_->PopMany(token_, values, max_count, deadline);
+  }
+
+  /// Try to pop up to `max_count` elements from queue at once without
+  /// blocking, appending them to `values`. May be used in non-coroutine
+  /// environment
+  /// @returns the number of popped elements.
+  /// @note Only supported by concurrent::GenericQueue
+  [[nodiscard]] std::size_t PopManyNoblock(std::vector<ValueType>& values,
+                                           std::size_t max_count) const {
+    return queue_->PopManyNoblock(token_, values, max_count);
+  }
+
   /// Const access to source queue.
   [[nodiscard]] std::shared_ptr<const QueueType> Queue() const {
     return {queue_};
   }
 
   /// @cond
+  // For internal use only, allows waiting for the consumer in engine::WaitAny.
+  // Only supported by single-consumer concurrent::GenericQueue.
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept {
+    return queue_->TryGetConsumerContextAccessor();
+  }
+
   // For internal use only
   Consumer(std::shared_ptr<QueueType> queue, EmplaceEnablerType /*unused*/)
       : queue_(std::move(queue)), token_(queue_->queue_) {}
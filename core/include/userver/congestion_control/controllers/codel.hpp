@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/utils/sliding_interval.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// CoDel-style controller. The timings reported by the sensor are treated as
+/// the queue sojourn times. The controller is activated when the minimal
+/// sojourn time stays above `target` for a whole `interval`, i.e. when there
+/// is a standing queue rather than a burst. While active, the limit is
+/// decreased at the epochs `interval / sqrt(count)` apart, `count` being the
+/// number of the decreases, and is raised back once the minimal sojourn time
+/// gets below `target`.
+class CoDelController final : public Controller {
+ public:
+  struct StaticConfig : Controller::Config {
+    std::chrono::milliseconds target{5};
+    /// In controller steps (seconds)
+    std::size_t interval{3};
+    std::size_t decrease_percent{10};
+    std::size_t safe_delta_limit{10};
+    std::size_t min_limit{10};
+    std::size_t min_qps{10};
+  };
+
+  CoDelController(const std::string& name, v2::Sensor& sensor,
+                  Limiter& limiter, Stats& stats, const StaticConfig& config);
+
+  Limit Update(const Sensor::Data& current) override;
+
+ private:
+  std::size_t GetDecreaseEpochs() const;
+
+  const StaticConfig config_;
+  utils::SlidingInterval<std::int64_t> sojourn_;
+  utils::SlidingInterval<std::int64_t> current_load_;
+  std::optional<std::size_t> current_limit_;
+  std::size_t epoch_{0};
+  bool dropping_{false};
+  std::size_t count_{0};
+  std::size_t next_decrease_epoch_{0};
+  std::size_t dropping_exit_epoch_{0};
+};
+
+CoDelController::StaticConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<CoDelController::StaticConfig>);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,72 @@
+#pragma once
+
+/// @file userver/dist_lock/dist_lock_batch_strategy.hpp
+/// @brief @copybrief dist_lock::DistLockBatchStrategyBase
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+/// A lock to acquire or prolong in DistLockBatchStrategyBase::AcquireBatch()
+struct LeaseRequest {
+  std::string lock_name;
+
+  /// Globally unique ID of the locking entity.
+  std::string locker_id;
+
+  /// The duration for which the lock must be held.
+  std::chrono::milliseconds lock_ttl{0};
+};
+
+/// Result of DistLockBatchStrategyBase::AcquireBatch()
+struct BatchAcquireResult {
+  /// `acquired[i]` is true if the i-th request is held by its locker now.
+  std::vector<bool> acquired;
+
+  /// IDs of the live members that share the locks, as returned by
+  /// DistLockBatchStrategyBase::GetMemberId() of each of them.
+  std::vector<std::string> members;
+};
+
+/// @ingroup userver_base_classes userver_concurrency
+///
+/// @brief Interface for distributed lock strategies that acquire and prolong
+/// many locks in a single request to the backend
+///
+/// Used by dist_lock::DistLockManager.
+///
+/// ## Example
+///
+/// @snippet core/src/dist_lock/dist_lock_manager_test.cpp  Sample batch strategy
+class DistLockBatchStrategyBase {
+ public:
+  virtual ~DistLockBatchStrategyBase() = default;
+
+  /// Acquires or prolongs the locks and marks this member as alive for the
+  /// longest `lock_ttl` of the requests.
+  ///
+  /// @param requests The locks, lock names are unique.
+  /// @returns Whether each of the locks is acquired and the live members.
+  /// @throws anything when the request fails, none of the locks is acquired
+  /// or prolonged then.
+  virtual BatchAcquireResult AcquireBatch(
+      const std::vector<LeaseRequest>& requests) = 0;
+
+  /// Releases the lock.
+  ///
+  /// @note Exceptions are ignored.
+  virtual void Release(const std::string& lock_name,
+                       const std::string& locker_id) = 0;
+
+  /// Globally unique ID of this member (e.g. host) of the group that shares
+  /// the locks.
+  virtual const std::string& GetMemberId() const = 0;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
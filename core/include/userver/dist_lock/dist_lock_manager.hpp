@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/dist_lock/dist_lock_manager.hpp
+/// @brief @copybrief dist_lock::DistLockManager
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <userver/dist_lock/dist_lock_batch_strategy.hpp>
+#include <userver/dist_lock/dist_lock_strategy.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+namespace impl {
+
+class LeaseBatcher;
+
+}  // namespace impl
+
+/// dist_lock::DistLockManager settings
+struct DistLockManagerSettings {
+  /// For how long the lock acquisitions are collected into a batch.
+  std::chrono::milliseconds batch_window{10};
+
+  /// Maximum number of locks in a batch.
+  std::size_t max_batch_size{1000};
+
+  /// How long a member waits before trying to acquire a lock that is assigned
+  /// to another member.
+  std::chrono::milliseconds handover_delay{1000};
+
+  /// How often a member hands over a held lock that is assigned to another
+  /// live member, one lock at a time. Zero disables the handovers.
+  std::chrono::milliseconds rebalance_interval{1000};
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Acquires and prolongs the locks of many dist_lock::DistLockedWorker
+/// and dist_lock::DistLockedTask in batches
+///
+/// The strategies returned by GetStrategy() do not access the backend on their
+/// own: the lock acquisitions that happen within `batch_window` of each other
+/// are merged into a single DistLockBatchStrategyBase::AcquireBatch() call.
+/// For thousands of locks that replaces thousands of small queries per second
+/// with a few batched ones.
+///
+/// The locks are assigned to the live members with rendezvous hashing. A member
+/// tries to acquire the locks assigned to it right away, and the rest of them
+/// only after `handover_delay`, so the locks spread evenly between the
+/// members. A held lock that is assigned to another live member is handed over
+/// to it, one lock per `rebalance_interval`, so the locks rebalance slowly when
+/// the members come and go.
+///
+/// The manager must outlive the workers and tasks that use its strategies.
+///
+/// ## Example
+///
+/// @snippet core/src/dist_lock/dist_lock_manager_test.cpp  Sample DistLockManager
+class DistLockManager final {
+ public:
+  /// Starts the batching task in the current task processor.
+  explicit DistLockManager(std::shared_ptr<DistLockBatchStrategyBase> strategy,
+                           const DistLockManagerSettings& settings = {});
+
+  DistLockManager(DistLockManager&&) = delete;
+  DistLockManager& operator=(DistLockManager&&) = delete;
+  ~DistLockManager();
+
+  /// Returns a strategy for the `lock_name` lock for
+  /// dist_lock::DistLockedWorker or dist_lock::DistLockedTask.
+  std::shared_ptr<DistLockStrategyBase> GetStrategy(std::string lock_name);
+
+ private:
+  std::shared_ptr<impl::LeaseBatcher> batcher_;
+  engine::TaskWithResult<void> batcher_task_;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
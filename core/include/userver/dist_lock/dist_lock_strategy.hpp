@@ -14,6 +14,16 @@ namespace dist_lock {
 /// Indicates that lock cannot be acquired because it's busy.
 class LockIsAcquiredByAnotherHostException : public std::exception {};
 
+/// Indicates that the lock is held, but should be handed over to another host,
+/// e.g. to rebalance the locks between the hosts. The worker is stopped and
+/// the lock is released, then the acquisition continues as usual.
+class LockHandoverRequestedException : public std::exception {};
+
+/// Indicates that the lock acquisition is postponed, e.g. to let another host
+/// acquire the lock first. The acquisition is retried after
+/// DistLockSettings::acquire_interval even with DistLockWaitingMode::kNoWait.
+class LockAcquisitionDeferredException : public std::exception {};
+
 /// @ingroup userver_base_classes userver_concurrency
 ///
 /// @brief Interface for distributed lock strategies
@@ -30,6 +40,10 @@ class DistLockStrategyBase {
   /// @param lock_ttl The duration for which the lock must be held.
   /// @param locker_id Globally unique ID of the locking entity.
   /// @throws LockIsAcquiredByAnotherHostError when the lock is busy
+  /// @throws LockHandoverRequestedException when the held lock should be
+  /// released
+  /// @throws LockAcquisitionDeferredException when the acquisition should be
+  /// retried later
   /// @throws anything else when the locking fails, strategy is responsible for
   /// cleanup, Release won't be invoked.
   virtual void Acquire(std::chrono::milliseconds lock_ttl,
@@ -14,6 +14,7 @@ struct Statistics {
   utils::statistics::RelaxedCounter<size_t> watchdog_triggers{0};
   utils::statistics::RelaxedCounter<size_t> brain_splits{0};
   utils::statistics::RelaxedCounter<size_t> task_failures{0};
+  utils::statistics::RelaxedCounter<size_t> handovers{0};
 };
 
 }  // namespace dist_lock
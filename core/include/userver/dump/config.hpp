@@ -24,6 +24,15 @@ extern const std::string_view kDump;
 extern const std::string_view kMaxDumpAge;
 extern const std::string_view kMinDumpInterval;
 
+/// Compression of the dump file contents
+enum class Compression {
+  kNone,
+  kGzip,
+};
+
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>);
+
 struct ConfigPatch final {
   std::optional<bool> dumps_enabled;
   std::optional<std::chrono::milliseconds> min_dump_interval;
@@ -45,6 +54,8 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool dump_is_mmapped;
+  Compression dump_compression;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
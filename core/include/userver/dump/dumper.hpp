@@ -85,6 +85,8 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `mmap` | `boolean` | Whether to read the dump by mapping it into memory, see dump::MappedStringView; incompatible with `encrypted` | `false`
+/// `compression` | `string` | `none` or `gzip`; chunks of the dump are compressed and decompressed in parallel with serialization, see dump::CompressedWriter | `none`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -0,0 +1,66 @@
+#pragma once
+
+/// @file userver/dump/mapped.hpp
+/// @brief @copybrief dump::MappedStringView
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief An immutable string that may point directly into a memory-mapped
+/// dump file
+///
+/// On write, it is serialized exactly as `std::string`. When it is read by a
+/// `MappedFileReader` (see `mmap` dump static option), the result references
+/// the mapped file without copying or parsing it, and keeps the mapping alive.
+/// Other readers produce a `MappedStringView` that owns a copy of the data.
+///
+/// This allows to store the cache contents in a dump as a single flat blob
+/// (e.g. a FlatBuffers buffer or a sorted array of fixed-size records) and to
+/// access it in place after the restart: reading such a dump costs only the
+/// page faults on the first access to each page.
+///
+/// Copying a `MappedStringView` is cheap and does not copy the data.
+class MappedStringView final {
+ public:
+  /// Creates an empty string
+  MappedStringView() noexcept = default;
+
+  /// Creates a `MappedStringView` that owns the data
+  explicit MappedStringView(std::string data);
+
+  /// Returns the data. It is valid while this `MappedStringView` or any of
+  /// its copies is alive.
+  std::string_view Get() const noexcept { return view_; }
+
+  /// Returns `true` if the data references a memory-mapped dump file
+  bool IsMapped() const noexcept { return is_mapped_; }
+
+ private:
+  MappedStringView(std::shared_ptr<const void> storage, std::string_view view,
+                   bool is_mapped) noexcept;
+
+  friend MappedStringView Read(Reader& reader, To<MappedStringView>);
+
+  std::shared_ptr<const void> storage_;
+  std::string_view view_;
+  bool is_mapped_{false};
+};
+
+/// @brief `MappedStringView` serialization, same as for `std::string`
+void Write(Writer& writer, const MappedStringView& value);
+
+/// @brief `MappedStringView` deserialization
+/// @details References the memory of the reader if possible, copies
+/// the data otherwise
+MappedStringView Read(Reader& reader, To<MappedStringView>);
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -13,6 +13,15 @@
 
 USERVER_NAMESPACE_BEGIN
 
+/// @cond
+namespace utils {
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentMap;
+
+}  // namespace utils
+/// @endcond
+
 namespace dump {
 
 /// @{
@@ -42,6 +51,12 @@ template <typename T, typename Hash, typename Eq, typename Alloc>
 void Insert(std::unordered_set<T, Hash, Eq, Alloc>& cont, T&& elem) {
   cont.insert(std::forward<T>(elem));
 }
+
+template <typename K, typename V, typename Hash, typename Eq>
+void Insert(utils::PersistentMap<K, V, Hash, Eq>& cont,
+            std::pair<const K, V>&& elem) {
+  cont.insert(std::move(elem));
+}
 /// @}
 
 namespace impl {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -12,6 +13,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
+class MappedStringView;
+
 /// Indicates a failure reading or writing a dump. No further operations
 /// should be performed with a failed dump.
 class Error final : public std::runtime_error {
@@ -68,7 +71,14 @@ class Reader {
   /// @throws `Error` on read operation failure
   virtual std::string_view ReadRaw(std::size_t max_size) = 0;
 
+  /// @brief Returns a handle that keeps the memory returned by `ReadRaw` alive
+  /// @details Readers that do not copy the data, e.g. `MappedFileReader`,
+  /// return a non-null handle, and the memory returned by `ReadRaw` is not
+  /// invalidated by the subsequent calls. Other readers return `nullptr`.
+  virtual std::shared_ptr<const void> GetMapping() const { return nullptr; }
+
   friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
+  friend MappedStringView Read(Reader& reader, To<MappedStringView>);
 };
 
 namespace impl {
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Splits the data into chunks, compresses them using gzip in parallel
+/// with the serialization and writes them into the underlying `Writer`
+/// @note The compression tasks are started on the current `TaskProcessor`
+class CompressedWriter final : public Writer {
+ public:
+  static constexpr std::size_t kDefaultChunkSize = 1 << 20;
+  static constexpr std::size_t kDefaultMaxChunksInFlight = 4;
+
+  /// @param chunk_size the amount of uncompressed data in each chunk
+  /// @param max_chunks_in_flight the maximum number of chunks that are
+  /// compressed concurrently
+  explicit CompressedWriter(
+      std::unique_ptr<Writer> base, std::size_t chunk_size = kDefaultChunkSize,
+      std::size_t max_chunks_in_flight = kDefaultMaxChunksInFlight);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  struct Chunk final {
+    std::size_t raw_size;
+    engine::TaskWithResult<std::string> compressed;
+  };
+
+  void WriteRaw(std::string_view data) override;
+
+  void StartChunk();
+  void WriteOldestChunk();
+
+  std::unique_ptr<Writer> base_;
+  const std::size_t chunk_size_;
+  const std::size_t max_chunks_in_flight_;
+  std::string buffer_;
+  std::deque<Chunk> chunks_in_flight_;
+};
+
+/// @brief Reads the chunks written by `CompressedWriter` from the underlying
+/// `Reader`, prefetches and decompresses them in parallel with
+/// the deserialization
+/// @note The decompression tasks are started on the current `TaskProcessor`
+class CompressedReader final : public Reader {
+ public:
+  /// @param max_chunks_in_flight the maximum number of chunks that are
+  /// prefetched and decompressed concurrently
+  explicit CompressedReader(
+      std::unique_ptr<Reader> base,
+      std::size_t max_chunks_in_flight =
+          CompressedWriter::kDefaultMaxChunksInFlight);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  void Prefetch();
+  bool NextChunk();
+
+  std::unique_ptr<Reader> base_;
+  const std::size_t max_chunks_in_flight_;
+  bool base_exhausted_{false};
+  std::deque<engine::TaskWithResult<std::string>> chunks_in_flight_;
+  std::string current_chunk_;
+  std::size_t position_{0};
+  std::string joined_;
+};
+
+/// @brief Wraps the readers and writers of another factory into
+/// `CompressedReader` and `CompressedWriter`
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  explicit CompressedOperationsFactory(std::unique_ptr<OperationsFactory> base);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const std::unique_ptr<OperationsFactory> base_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
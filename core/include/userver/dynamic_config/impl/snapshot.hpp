@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -56,6 +57,11 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  // Parses only the configs whose documents differ from `previous_docs_map`,
+  // the rest are shared with `previous`
+  SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map,
+               const SnapshotData& previous);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -70,13 +76,34 @@ class SnapshotData final {
 
   bool IsEmpty() const noexcept;
 
+  // Whether the config was parsed once and is shared by both snapshots
+  bool IsSameConfig(const SnapshotData& other, ConfigId id) const noexcept;
+
  private:
   const std::any& DoGet(ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  // Shared, so that unchanged configs are not copied between snapshots
+  std::vector<std::shared_ptr<const std::any>> user_configs_;
+};
+
+// Compares a single config in two snapshots, allows to notify only the
+// subscribers of the changed configs
+struct KeyComparator final {
+  using EqualFunc = bool (*)(const SnapshotData& lhs, const SnapshotData& rhs,
+                             ConfigId id);
+
+  ConfigId id;
+  EqualFunc are_equal;
 };
 
+template <typename T>
+bool AreConfigsEqual(const SnapshotData& lhs, const SnapshotData& rhs,
+                     ConfigId id) {
+  return lhs.IsSameConfig(rhs, id) || lhs.Get<T>(id) == rhs.Get<T>(id);
+}
+
 class StorageData;
+class KeyedDiffChannel;
 
 }  // namespace dynamic_config::impl
 
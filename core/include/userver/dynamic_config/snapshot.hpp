@@ -158,6 +158,7 @@ class Snapshot final {
   // for the constructor
   friend class Source;
   friend class impl::StorageData;
+  friend class impl::KeyedDiffChannel;
 
   explicit Snapshot(const impl::StorageData& storage);
 
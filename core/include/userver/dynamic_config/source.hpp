@@ -5,8 +5,8 @@
 
 #include <optional>
 #include <string_view>
-#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
@@ -181,7 +181,9 @@ class Source final {
   /// snapshot (this invocation will be executed synchronously).
   ///
   /// @note Сallbacks occur only if one of the passed config is changed. This is
-  /// true under any components::DynamicConfigClientUpdater options.
+  /// true under any components::DynamicConfigClientUpdater options. Each
+  /// config is compared once per update for all such subscribers, and no task
+  /// is started for the subscribers whose configs did not change.
   ///
   /// @warning To use this function, configs must have the `operator==`.
   ///
@@ -200,31 +202,49 @@ class Source final {
       Class* obj, std::string_view name,
       void (Class::*func)(const dynamic_config::Snapshot& config),
       const Keys&... keys) {
-    auto wrapper = [obj, func, keys = std::make_tuple(std::cref(keys)...)](
-                       const Diff& diff) {
-      const auto args = std::tuple_cat(std::tie(diff), keys);
-      if (!std::apply(HasChanged<Keys...>, args)) return;
-      (obj->*func)(diff.current);
-    };
-    return DoUpdateAndListen(concurrent::FunctionId(obj), name,
-                             std::move(wrapper));
+    static_assert(sizeof...(Keys) != 0);
+    return DoUpdateAndListen(
+        concurrent::FunctionId(obj), name,
+        [obj, func](const Diff& diff) { (obj->*func)(diff.current); },
+        {MakeKeyComparator(keys)...});
   }
 
-  SnapshotEventSource& GetEventChannel();
+  // clang-format off
 
- private:
-  template <typename... Keys>
-  static bool HasChanged(const Diff& diff, const Keys&... keys) {
-    if (!diff.previous) return true;
+  /// @brief Subscribes to updates of a subset of all configs with information
+  /// about the current and previous states.
+  ///
+  /// Same as the overload above, but passes `dynamic_config::Diff`, so that
+  /// the subscriber could find out which of the `keys` have changed. The
+  /// first invocation gets `std::nullopt` as the previous snapshot.
+  ///
+  /// @warning To use this function, configs must have the `operator==`.
+  ///
+  /// Example usage:
+  /// @snippet dynamic_config/config_test.cpp Keyed subscription for dynamic config update
+  ///
+  /// @see dynamic_config::Diff
 
-    const auto& previous = *diff.previous;
-    const auto& current = diff.current;
+  // clang-format on
+  template <typename Class, typename... Keys>
+  concurrent::AsyncEventSubscriberScope UpdateAndListen(
+      Class* obj, std::string_view name,
+      void (Class::*func)(const dynamic_config::Diff& diff),
+      const Keys&... keys) {
+    static_assert(sizeof...(Keys) != 0);
+    return DoUpdateAndListen(
+        concurrent::FunctionId(obj), name,
+        [obj, func](const Diff& diff) { (obj->*func)(diff); },
+        {MakeKeyComparator(keys)...});
+  }
 
-    UASSERT(!current.GetData().IsEmpty());
-    UASSERT(!previous.GetData().IsEmpty());
+  SnapshotEventSource& GetEventChannel();
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
-    return !is_equal;
+ private:
+  template <typename VariableType>
+  static impl::KeyComparator MakeKeyComparator(const Key<VariableType>& key) {
+    return {impl::ConfigIdGetter::Get(key),
+            &impl::AreConfigsEqual<VariableType>};
   }
 
   concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
@@ -235,6 +255,10 @@ class Source final {
       concurrent::FunctionId id, std::string_view name,
       DiffEventSource::Function&& func);
 
+  concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
+      concurrent::FunctionId id, std::string_view name,
+      DiffEventSource::Function&& func, std::vector<impl::KeyComparator>&& keys);
+
   impl::StorageData* storage_;
 };
 
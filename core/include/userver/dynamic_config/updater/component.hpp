@@ -52,7 +52,18 @@ namespace components {
 ///
 /// Note: This is not a silver bullet against extra events, because the events
 /// will be sent to every dynamic config subscriber if *any* part of the config
-/// has updated, not if the interesting part has updated.
+/// has updated, not if the interesting part has updated. Subscribe with the
+/// keys of the needed configs to dynamic_config::Source::UpdateAndListen to
+/// avoid that.
+///
+/// ## Fast config propagation
+///
+/// Incremental updates request only the configs changed since the previous
+/// update (`updated_since`). Only the changed configs are compared for
+/// deduplication and parsed by components::DynamicConfig, the rest are shared
+/// with the previous snapshot. So a short `update-interval` with incremental
+/// updates is cheap, both for the service and for the config service, and
+/// allows to propagate config changes within the interval.
 ///
 /// ## Static options:
 /// Name | Description | Default value
@@ -31,6 +31,9 @@ class DocsMap final {
   formats::json::Value AsJson() const;
   bool AreContentsEqual(const DocsMap& other) const;
 
+  /// Whether `other` has all the documents of this map with the same values
+  bool AreContentsIncludedIn(const DocsMap& other) const;
+
   /// @cond
   // For internal use only
   // Set of configs expected to be used is automatically updated when
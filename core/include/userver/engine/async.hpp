@@ -16,19 +16,29 @@ namespace engine {
 
 namespace impl {
 
+// `config.wait_mode` is overridden with the one required by TaskType
 template <template <typename> typename TaskType, typename Function,
           typename... Args>
-[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
-                                      Task::Importance importance,
-                                      Deadline deadline, Function&& f,
+[[nodiscard]] auto MakeTaskWithResult(TaskConfig config, Function&& f,
                                       Args&&... args) {
   using ResultType =
       typename utils::impl::WrappedCallImplType<Function, Args...>::ResultType;
-  constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
+  config.wait_mode = TaskType<ResultType>::kWaitMode;
 
-  return TaskType<ResultType>{
-      MakeTask({task_processor, importance, kWaitMode, deadline},
-               std::forward<Function>(f), std::forward<Args>(args)...)};
+  return TaskType<ResultType>{MakeTask(config, std::forward<Function>(f),
+                                       std::forward<Args>(args)...)};
+}
+
+template <template <typename> typename TaskType, typename Function,
+          typename... Args>
+[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
+                                      Task::Importance importance,
+                                      Deadline deadline, Function&& f,
+                                      Args&&... args) {
+  return MakeTaskWithResult<TaskType>(
+      TaskConfig{task_processor, importance, Task::WaitMode::kSingleWaiter,
+                 deadline, Task::Priority::kNormal, {}},
+      std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
 }  // namespace impl
@@ -72,6 +82,19 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @brief Runs an asynchronous function call with the scheduling priority
+/// using specified task processor
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               Task::Priority priority, Function&& f,
+                               Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      impl::TaskConfig{task_processor, Task::Importance::kNormal,
+                       Task::WaitMode::kSingleWaiter, {}, priority, {}},
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// Runs an asynchronous function call using task processor of the caller
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(Function&& f, Args&&... args) {
@@ -128,6 +151,20 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @brief Runs an asynchronous function call with the scheduling priority
+/// that will start regardless of cancellations using specified task processor
+/// @see Task::Importance::Critical
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto CriticalAsyncNoSpan(TaskProcessor& task_processor,
+                                       Task::Priority priority, Function&& f,
+                                       Args&&... args) {
+  return impl::MakeTaskWithResult<TaskWithResult>(
+      impl::TaskConfig{task_processor, Task::Importance::kCritical,
+                       Task::WaitMode::kSingleWaiter, {}, priority, {}},
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @brief Runs an asynchronous function call that will start regardless of
 /// cancellations using task processor of the caller
 /// @see Task::Importance::Critical
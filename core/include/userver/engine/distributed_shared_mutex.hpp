@@ -0,0 +1,190 @@
+#pragma once
+
+/// @file userver/engine/distributed_shared_mutex.hpp
+/// @brief @copybrief engine::DistributedSharedMutex
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+inline constexpr std::size_t kDistributedSharedMutexSlots = 16;
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::SharedMutex for read-mostly data with per-thread reader
+/// counters.
+///
+/// Each worker thread increments its own cache line when locking for reading,
+/// so the readers of different threads do not contend with each other. The
+/// price is paid by the writers: they have to scan all the counters and wait
+/// for the readers to drain. Each mutex instance occupies about 1KB.
+///
+/// Prefer engine::SharedMutex unless the readers are frequent, run on many
+/// threads and the benchmarks show the contention on the shared lock.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// Writers (unique locks) have priority over readers (shared locks),
+/// thus new shared lock waits for the pending writes to finish, which in turn
+/// waits for existing shared locks to unlock first.
+///
+/// ## Example usage:
+///
+/// @snippet engine/distributed_shared_mutex_test.cpp  Sample engine::DistributedSharedMutex usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class DistributedSharedMutex final {
+ public:
+  DistributedSharedMutex();
+  ~DistributedSharedMutex();
+
+  DistributedSharedMutex(const DistributedSharedMutex&) = delete;
+  DistributedSharedMutex(DistributedSharedMutex&&) = delete;
+  DistributedSharedMutex& operator=(const DistributedSharedMutex&) = delete;
+  DistributedSharedMutex& operator=(DistributedSharedMutex&&) = delete;
+
+  /// Locks the mutex for unique ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for reading or writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock();
+
+  /// Unlocks the mutex for unique ownership. Before calling this method the
+  /// the mutex should be locked for unique ownership by current coroutine.
+  ///
+  /// @note the order of coroutines to unblock is unspecified. Any code assuming
+  /// any specific order (e.g. FIFO) is incorrect and should be fixed.
+  void unlock();
+
+  /// Tries to lock the mutex for unique ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock();
+
+  /// Tries to lock the mutex for unique ownership in specified duration.
+  /// Blocks current coroutine if
+  /// the mutex is locked by another coroutine up to the provided duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for unique ownership till specified time point.
+  /// Blocks current coroutine if
+  /// the mutex is locked by another coroutine up to the provided duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+  /// Locks the mutex for shared ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock_shared();
+
+  /// Unlocks the mutex for shared ownership. Before calling this method the
+  /// mutex should be locked for shared ownership by current coroutine. The
+  /// coroutine may be on a different thread than the one it locked on.
+  void unlock_shared();
+
+  /// Tries to lock the mutex for shared ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock_shared();
+
+  /// Tries to lock the mutex for shared ownership in specified duration.
+  /// Blocks current coroutine if
+  /// the mutex is locked by another coroutine up to the provided duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_shared_for(
+      const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for shared ownership till specified time point.
+  /// Blocks current coroutine if
+  /// the mutex is locked by another coroutine up to the provided duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_shared_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  using Counter = std::atomic<std::int64_t>;
+
+  Counter& GetCurrentSlot() noexcept;
+  std::int64_t CountReaders() const noexcept;
+
+  bool WaitForNoReaders(Deadline deadline);
+  bool WaitForNoWriter(Deadline deadline);
+  void ReleaseWriter();
+
+  /* A reader increments the slot of its thread and may decrement the slot of
+   * another one if the coroutine has migrated, so only the sum of the slots
+   * is meaningful.
+   */
+  struct alignas(64) Slot final {
+    Counter readers{0};
+  };
+  std::array<Slot, impl::kDistributedSharedMutexSlots> slots_{};
+
+  /* Set by the writer before it counts the readers. Readers check it after
+   * incrementing the slot, so either the reader backs off or the writer
+   * sees its increment.
+   */
+  std::atomic<bool> has_writer_{false};
+
+  Mutex writers_mutex_;
+  SingleConsumerEvent readers_left_event_;
+  Mutex writer_left_mutex_;
+  ConditionVariable writer_left_cv_;
+};
+
+template <typename Rep, typename Period>
+bool DistributedSharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool DistributedSharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool DistributedSharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool DistributedSharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
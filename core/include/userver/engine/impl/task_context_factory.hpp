@@ -24,6 +24,10 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  Task::Priority priority{Task::Priority::kNormal};
+  // A non-critical task that is still in the queue when the start deadline is
+  // reached is cancelled without running its payload
+  engine::Deadline start_deadline;
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
@@ -0,0 +1,98 @@
+#pragma once
+
+/// @file userver/engine/instrumented_semaphore.hpp
+/// @brief @copybrief engine::InstrumentedSemaphore
+
+#include <chrono>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/lock_statistics.hpp>
+#include <userver/engine/semaphore.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::Semaphore that collects the engine::LockStatistics.
+///
+/// `holders` of the statistics is the count of the acquired locks, so
+/// `max-holders` shows how close the semaphore has come to its capacity.
+/// Use std::shared_lock instead of the engine::SemaphoreLock. See
+/// engine::InstrumentedMutex for the details.
+class InstrumentedSemaphore final {
+ public:
+  using Counter = Semaphore::Counter;
+
+  InstrumentedSemaphore(std::string name, Counter capacity);
+  ~InstrumentedSemaphore();
+
+  InstrumentedSemaphore(const InstrumentedSemaphore&) = delete;
+  InstrumentedSemaphore& operator=(const InstrumentedSemaphore&) = delete;
+
+  /// @copydoc engine::Semaphore::SetCapacity
+  void SetCapacity(Counter capacity);
+
+  /// @copydoc engine::Semaphore::GetCapacity
+  [[nodiscard]] Counter GetCapacity() const noexcept;
+
+  /// @copydoc engine::Semaphore::RemainingApprox
+  [[nodiscard]] std::size_t RemainingApprox() const;
+
+  /// @copydoc engine::Semaphore::UsedApprox
+  [[nodiscard]] std::size_t UsedApprox() const;
+
+  /// @copydoc engine::Semaphore::lock_shared
+  void lock_shared();
+
+  /// @copydoc engine::Semaphore::unlock_shared
+  void unlock_shared();
+
+  /// @copydoc engine::Semaphore::try_lock_shared
+  [[nodiscard]] bool try_lock_shared();
+
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_shared_for(std::chrono::duration<Rep, Period>);
+
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_shared_until(
+      std::chrono::time_point<Clock, Duration>);
+
+  [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+  void lock_shared_count(Counter count);
+
+  void unlock_shared_count(Counter count);
+
+  [[nodiscard]] bool try_lock_shared_count(Counter count);
+
+  [[nodiscard]] bool try_lock_shared_until_count(Deadline deadline,
+                                                 Counter count);
+
+  const std::string& GetName() const noexcept;
+
+  const LockStatistics& GetStatistics() const noexcept;
+
+ private:
+  Semaphore semaphore_;
+  LockStatistics statistics_;
+  const impl::LockStatisticsRegistration registration_;
+};
+
+template <typename Rep, typename Period>
+bool InstrumentedSemaphore::try_lock_shared_for(
+    std::chrono::duration<Rep, Period> duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool InstrumentedSemaphore::try_lock_shared_until(
+    std::chrono::time_point<Clock, Duration> until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -61,9 +61,18 @@ class WritableBase {
 
   [[nodiscard]] virtual size_t WriteAll(std::initializer_list<IoData> list,
                                         Deadline deadline) {
+    return WriteAll(list.begin(), list.size(), deadline);
+  }
+
+  /// @brief Sends exactly list_size IoData, with a single vectored write
+  /// where the stream supports that.
+  /// @note Can return less than the total size if stream is closed by peer.
+  [[nodiscard]] virtual size_t WriteAll(const IoData* list,
+                                        std::size_t list_size,
+                                        Deadline deadline) {
     size_t result{0};
-    for (const auto& io_data : list) {
-      result += WriteAll(io_data.data, io_data.len, deadline);
+    for (std::size_t i = 0; i < list_size; ++i) {
+      result += WriteAll(list[i].data, list[i].len, deadline);
     }
     return result;
   }
@@ -75,7 +75,7 @@ class FdPoller final {
   void SwitchStateToReadyToUse();
 
   struct Impl;
-  utils::FastPimpl<Impl, 144, 16> pimpl_;
+  utils::FastPimpl<Impl, 208, 16> pimpl_;
 };
 
 }  // namespace engine::io
@@ -5,6 +5,7 @@
 
 #include <sys/socket.h>
 
+#include <cstddef>
 #include <initializer_list>
 
 #include <userver/engine/deadline.hpp>
@@ -41,6 +42,24 @@ class [[nodiscard]] Socket final : public RwBase {
     Sockaddr src_addr;
   };
 
+  /// @brief A datagram of Socket::RecvSomeDatagrams and
+  /// Socket::SendAllDatagrams
+  struct Datagram {
+    /// Buffer of the datagram
+    void* data{nullptr};
+
+    /// Capacity of the buffer on receive, size of the datagram on send
+    size_t len{0};
+
+    /// Size of the received or sent datagram, set by the call. A received
+    /// datagram that does not fit into the buffer is truncated.
+    size_t bytes_transferred{0};
+
+    /// Source address on receive. Destination address on send, the datagram
+    /// is sent to the connected peer if the address is not set.
+    Sockaddr addr;
+  };
+
   /// Constructs an invalid socket.
   Socket() = default;
 
@@ -99,6 +118,11 @@ class [[nodiscard]] Socket final : public RwBase {
   [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size,
                                Deadline deadline);
 
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
   /// @brief Sends exactly list_size iovec to the socket.
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const struct iovec* list, std::size_t list_size,
@@ -127,6 +151,34 @@ class [[nodiscard]] Socket final : public RwBase {
   [[nodiscard]] size_t SendAllTo(const Sockaddr& dest_addr, const void* buf,
                                  size_t len, Deadline deadline);
 
+  /// @brief Receives at least one datagram, up to `count` of them, with as
+  /// few system calls as possible (`recvmmsg` where available).
+  ///
+  /// For high packet rates, combine with several SO_REUSEPORT sockets
+  /// receiving in separate tasks, so that the kernel spreads the datagrams
+  /// over them.
+  ///
+  /// @returns count of the received datagrams, their sizes and source
+  /// addresses are stored into the first elements of `datagrams`
+  /// @note Not for SocketType::kStream connections.
+  /// @snippet src/engine/io/socket_test.cpp batched datagrams
+  [[nodiscard]] size_t RecvSomeDatagrams(Datagram* datagrams, size_t count,
+                                         Deadline deadline);
+
+  /// @brief Sends all the `count` datagrams with as few system calls as
+  /// possible (`sendmmsg` where available).
+  ///
+  /// If UDP generic segmentation offload is enabled for the socket via
+  /// `SetOption(SOL_UDP, UDP_SEGMENT, segment_size)`, the kernel splits each
+  /// datagram buffer into the datagrams of `segment_size`.
+  ///
+  /// @returns count of the sent datagrams, can be less than `count` if the
+  /// socket is closed or broken
+  /// @note Sockaddr domain must match the socket's domain.
+  /// @note Not for SocketType::kStream connections.
+  [[nodiscard]] size_t SendAllDatagrams(Datagram* datagrams, size_t count,
+                                        Deadline deadline);
+
   /// File descriptor corresponding to this socket.
   int Fd() const;
 
@@ -3,6 +3,9 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,6 +20,61 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// @brief TLS server settings and state shared by the connections of a
+/// listener.
+///
+/// A single context holds the certificate, the server-side session cache and
+/// the session ticket keys, so the clients can resume their sessions on any
+/// connection of the listener with an abbreviated handshake instead of a full
+/// one.
+///
+/// Thread safe.
+class TlsServerContext final {
+ public:
+  struct Options {
+    /// Certificate authorities to verify the client certificates with
+    std::vector<crypto::Certificate> cert_authorities;
+
+    /// Protocols to negotiate via ALPN in the order of server preference,
+    /// e.g. `{"h2", "http/1.1"}`; ALPN is not used if empty
+    std::vector<std::string> alpn_protocols;
+
+    /// Max count of the sessions in the server-side session cache, 0 disables
+    /// the cache
+    std::size_t session_cache_size{20 * 1024};
+
+    /// Lifetime of the cached sessions and of the issued session tickets
+    std::chrono::seconds session_timeout{300};
+
+    /// Whether to issue stateless session tickets, the ticket keys are
+    /// generated for each context
+    bool session_tickets{true};
+  };
+
+  struct Stats {
+    std::uint64_t full_handshakes{0};
+    std::uint64_t resumed_handshakes{0};
+    std::uint64_t failed_handshakes{0};
+  };
+
+  /// @throws TlsException on a failure of the context setup
+  TlsServerContext(const crypto::Certificate& cert,
+                   const crypto::PrivateKey& key, const Options& options);
+  ~TlsServerContext();
+
+  TlsServerContext(const TlsServerContext&) = delete;
+  TlsServerContext& operator=(const TlsServerContext&) = delete;
+
+  /// Counters of the handshakes performed with the context
+  Stats GetStats() const;
+
+ private:
+  friend class TlsWrapper;
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe.
@@ -30,11 +88,21 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
                                    const std::string& server_name,
                                    Deadline deadline);
 
-  /// Starts a TLS server on an opened socket
+  /// @brief Starts a TLS server on an opened socket
+  /// @param alpn_protocols protocols to negotiate via ALPN in the order of
+  /// server preference, e.g. `{"h2", "http/1.1"}`; ALPN is not used if empty
   static TlsWrapper StartTlsServer(
       Socket&& socket, const crypto::Certificate& cert,
       const crypto::PrivateKey& key, Deadline deadline,
-      const std::vector<crypto::Certificate>& cert_authorities = {});
+      const std::vector<crypto::Certificate>& cert_authorities = {},
+      const std::vector<std::string>& alpn_protocols = {});
+
+  /// @brief Starts a TLS server on an opened socket with the settings and the
+  /// session cache of the `context`
+  /// @note The `context` must outlive the wrapper
+  static TlsWrapper StartTlsServer(Socket&& socket,
+                                   const TlsServerContext& context,
+                                   Deadline deadline);
 
   ~TlsWrapper() override;
 
@@ -0,0 +1,125 @@
+#pragma once
+
+/// @file userver/engine/lock_statistics.hpp
+/// @brief @copybrief engine::LockStatistics
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Acquisition statistics of an instrumented synchronization primitive,
+/// see engine::InstrumentedMutex, engine::InstrumentedSharedMutex and
+/// engine::InstrumentedSemaphore.
+///
+/// Metrics:
+/// * `acquisitions` - count of the successful acquisitions
+/// * `contended-acquisitions` - count of the acquisitions that had to wait
+/// * `failed-acquisitions` - count of the acquisitions that have not succeeded
+///   before the deadline
+/// * `wait-time-us` - histogram of the waits of the contended acquisitions,
+///   including the failed ones
+/// * `holders` - current count of the lock holders, for a semaphore the
+///   count of the acquired locks
+/// * `max-holders` - max value of `holders` since the primitive creation
+class LockStatistics final {
+ public:
+  using WaitTimeHistogram = utils::statistics::LogLinearHistogram<1, 24>;
+
+  LockStatistics() = default;
+
+  LockStatistics(const LockStatistics&) = delete;
+  LockStatistics& operator=(const LockStatistics&) = delete;
+
+  /// The lock was acquired without a wait
+  void AccountAcquired(std::size_t count = 1) noexcept;
+
+  /// The lock was acquired after the `wait`
+  void AccountAcquired(std::chrono::steady_clock::duration wait,
+                       std::size_t count = 1) noexcept;
+
+  /// The lock was not acquired after the `wait`
+  void AccountFailed(std::chrono::steady_clock::duration wait) noexcept;
+
+  void AccountReleased(std::size_t count = 1) noexcept;
+
+  /// Sums up the statistics of the primitives with the same name, takes the
+  /// max of the `max-holders`. Writes to `*this` are non-atomic.
+  void Add(const LockStatistics& other) noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const LockStatistics& statistics);
+
+ private:
+  void AccountWait(std::chrono::steady_clock::duration wait) noexcept;
+
+  utils::statistics::RateCounter acquisitions_;
+  utils::statistics::RateCounter contended_acquisitions_;
+  utils::statistics::RateCounter failed_acquisitions_;
+  WaitTimeHistogram wait_time_us_;
+  std::atomic<std::int64_t> holders_{0};
+  std::atomic<std::int64_t> max_holders_{0};
+};
+
+namespace impl {
+
+/// Makes the statistics visible as `engine.locks` with the `lock` label, until
+/// destroyed. The statistics of the primitives with the same name are summed.
+class LockStatisticsRegistration final {
+ public:
+  LockStatisticsRegistration(std::string name,
+                             const LockStatistics& statistics);
+  ~LockStatisticsRegistration();
+
+  LockStatisticsRegistration(const LockStatisticsRegistration&) = delete;
+  LockStatisticsRegistration& operator=(const LockStatisticsRegistration&) =
+      delete;
+
+  const std::string& GetName() const noexcept { return name_; }
+
+ private:
+  const std::string name_;
+  const LockStatistics& statistics_;
+};
+
+// Tries the fast path first, so the uncontended acquisitions do not read the
+// clock. The exceptions of `lock` are accounted as failures.
+template <typename TryLock, typename Lock>
+bool InstrumentedLock(LockStatistics& statistics, std::size_t count,
+                      TryLock&& try_lock, Lock&& lock) {
+  if (try_lock()) {
+    statistics.AccountAcquired(count);
+    return true;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  bool is_locked = false;
+  try {
+    is_locked = lock();
+  } catch (...) {
+    statistics.AccountFailed(std::chrono::steady_clock::now() - start);
+    throw;
+  }
+  const auto wait = std::chrono::steady_clock::now() - start;
+  if (is_locked) {
+    statistics.AccountAcquired(wait, count);
+  } else {
+    statistics.AccountFailed(wait);
+  }
+  return is_locked;
+}
+
+}  // namespace impl
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -21,6 +21,9 @@ struct TaskProcessorPoolsConfig final {
   std::string ev_thread_name = "ev";
   bool ev_default_loop_disabled = false;
   bool defer_events = true;
+  bool io_uring = false;
+  bool timer_wheel = false;
+  bool ev_worker_affinity = false;
 };
 
 /// @brief Runs a payload in a temporary coroutine engine instance.
@@ -7,6 +7,7 @@
 #include <chrono>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,7 +17,10 @@ namespace engine {
 /// @ingroup userver_concurrency
 ///
 /// @brief A multiple-producers, single-consumer event
-class SingleConsumerEvent final {
+///
+/// The event may be waited for together with tasks, futures and queue
+/// consumers via engine::WaitAny. engine::WaitAny never resets the signal.
+class SingleConsumerEvent final : private impl::ContextAccessor {
  public:
   struct NoAutoReset final {};
 
@@ -73,11 +77,20 @@ class SingleConsumerEvent final {
   void Send();
 
   /// Returns `true` iff already signaled. Never resets the signal.
-  [[nodiscard]] bool IsReady() const noexcept;
+  [[nodiscard]] bool IsReady() const noexcept override;
+
+  /// @cond
+  // For internal use only.
+  impl::ContextAccessor* TryGetContextAccessor() noexcept { return this; }
+  /// @endcond
 
  private:
   class EventWaitStrategy;
 
+  void AppendWaiter(impl::TaskContext& context) noexcept override;
+  void RemoveWaiter(impl::TaskContext& context) noexcept override;
+  void RethrowErrorResult() const override {}
+
   bool GetIsSignaled() noexcept;
 
   impl::FastPimplWaitListLight waiters_;
@@ -22,18 +22,63 @@ class ThreadControl;
 
 namespace subprocess {
 
+/// Standard streams of the child process for ProcessStarter::Exec()
+struct ExecOptions {
+  /// Appends the child stdout to the file, ignored if `pipe_stdout` is set.
+  std::optional<std::string> stdout_file;
+
+  /// Appends the child stderr to the file, ignored if `pipe_stderr` is set.
+  std::optional<std::string> stderr_file;
+
+  /// Connects the child stdin to ChildProcess::GetStdin().
+  bool pipe_stdin{false};
+
+  /// Connects the child stdout to ChildProcess::GetStdout().
+  bool pipe_stdout{false};
+
+  /// Connects the child stderr to ChildProcess::GetStderr().
+  bool pipe_stderr{false};
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
+///
+/// The subprocess is started with `posix_spawn`, that does not copy the page
+/// tables of the parent process and stays fast for services with a big RSS.
+///
+/// ## Example
+///
+/// @snippet core/src/engine/subprocess/process_starter_test.cpp Pipes example
 class ProcessStarter {
  public:
   explicit ProcessStarter(TaskProcessor& task_processor);
 
+  /// `env` redefines all environment variables.
+  /// @throws std::system_error if the subprocess cannot be started
+  ChildProcess Exec(const std::string& command,
+                    const std::vector<std::string>& args,
+                    const EnvironmentVariables& env,
+                    const ExecOptions& options);
+
+  /// Variables from `env_update` will be added to current environment.
+  /// Existing values will be replaced.
+  /// @throws std::system_error if the subprocess cannot be started
+  ChildProcess Exec(const std::string& command,
+                    const std::vector<std::string>& args,
+                    EnvironmentVariablesUpdate env_update,
+                    const ExecOptions& options);
+
+  /// Exec subprocess using current environment.
+  /// @throws std::system_error if the subprocess cannot be started
+  ChildProcess Exec(const std::string& command,
+                    const std::vector<std::string>& args,
+                    const ExecOptions& options);
+
   /// `env` redefines all environment variables.
   ChildProcess Exec(
       const std::string& command, const std::vector<std::string>& args,
       const EnvironmentVariables& env,
-      // TODO: use something like pipes instead of path to files
       const std::optional<std::string>& stdout_file = std::nullopt,
       const std::optional<std::string>& stderr_file = std::nullopt);
 
@@ -42,14 +87,12 @@ class ProcessStarter {
   ChildProcess Exec(
       const std::string& command, const std::vector<std::string>& args,
       EnvironmentVariablesUpdate env_update,
-      // TODO: use something like pipes instead of path to files
       const std::optional<std::string>& stdout_file = std::nullopt,
       const std::optional<std::string>& stderr_file = std::nullopt);
 
   /// Exec subprocess using current environment.
   ChildProcess Exec(
       const std::string& command, const std::vector<std::string>& args,
-      // TODO: use something like pipes instead of path to files
       const std::optional<std::string>& stdout_file = std::nullopt,
       const std::optional<std::string>& stderr_file = std::nullopt);
 
@@ -19,6 +19,11 @@ namespace engine {
 /// These are like engine::TaskLocalVariable, but the variable instances are
 /// inherited by child tasks created via utils::Async.
 ///
+/// The variables are not copied into the child tasks, the child tasks share
+/// them with the parent. The cost of the child task creation does not depend
+/// on the count of the variables; the first modification of the variables in
+/// the parent or in the child after that copies the pointers to the variables.
+///
 /// The order of destruction of task-inherited variables is unspecified.
 template <typename T>
 class TaskInheritedVariable final {
@@ -48,6 +48,23 @@ class [[nodiscard]] TaskBase {
     kCritical,
   };
 
+  /// @brief Task scheduling priority
+  ///
+  /// Only matters for task processors with `task-priorities` configured:
+  /// ready tasks of each priority wait in a separate lane and the workers
+  /// dequeue from the lanes proportionally to the configured weights.
+  /// Otherwise all the tasks share the same queue.
+  enum class Priority {
+    /// Latency-sensitive task
+    kHigh,
+
+    /// Normal task
+    kNormal,
+
+    /// Background task, e.g. a deleter of a stale cache snapshot
+    kLow,
+  };
+
   /// Task state
   enum class State {
     kInvalid,    ///< Unusable
@@ -26,6 +26,10 @@ namespace engine {
 /// Works with different types of tasks and futures:
 /// @snippet src/engine/wait_any_test.cpp sample waitany
 ///
+/// Also works with engine::SingleConsumerEvent and with the consumers of
+/// single-consumer concurrent::GenericQueue, e.g. concurrent::SpscQueue:
+/// @snippet src/engine/wait_any_test.cpp sample waitany queues
+///
 /// @param tasks either a single container, or a pack of future-like elements.
 /// @returns the index of the completed task, or `std::nullopt` if there are no
 /// completed tasks (possible if current task was cancelled).
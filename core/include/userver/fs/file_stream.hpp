@@ -0,0 +1,110 @@
+#pragma once
+
+/// @file userver/fs/file_stream.hpp
+/// @brief @copybrief fs::FileReader
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+namespace blocking {
+class FileDescriptor;
+}  // namespace blocking
+
+/// Default size of the chunks of fs::FileReader and fs::FileWriter
+inline constexpr std::size_t kDefaultFileChunkSize = 64 * 1024;
+
+/// @brief Reads a file asynchronously chunk by chunk
+///
+/// The next chunk is read ahead on the TaskProcessor while the caller
+/// processes the current one, so big files are streamed without waiting for
+/// each read and without loading them into memory.
+///
+/// ## Example
+///
+/// @snippet core/src/fs/file_stream_test.cpp  FileReader example
+class FileReader final {
+ public:
+  /// @param async_tp TaskProcessor for the blocking operations
+  /// @param path file to read
+  /// @param chunk_size maximum size of the chunks returned by ReadChunk()
+  /// @throws std::runtime_error if the file cannot be opened
+  FileReader(engine::TaskProcessor& async_tp, const std::string& path,
+             std::size_t chunk_size = kDefaultFileChunkSize);
+
+  FileReader(FileReader&&) noexcept;
+  ~FileReader();
+
+  /// @brief Returns the next chunk of the file, an empty string at the end of
+  /// the file
+  /// @throws std::runtime_error if read fails
+  std::string ReadChunk();
+
+ private:
+  void StartReadahead();
+
+  engine::TaskProcessor* async_tp_;
+  std::size_t chunk_size_;
+  std::unique_ptr<blocking::FileDescriptor> fd_;
+  engine::TaskWithResult<std::string> readahead_;
+};
+
+/// @brief Writes a file asynchronously chunk by chunk
+///
+/// The data is buffered, and the full chunks are written on the TaskProcessor
+/// while the caller produces the next ones.
+///
+/// ## Example
+///
+/// @snippet core/src/fs/file_stream_test.cpp  FileWriter example
+class FileWriter final {
+ public:
+  /// Creates or truncates the file.
+  /// @param async_tp TaskProcessor for the blocking operations
+  /// @param path file to write
+  /// @param perms permissions of a new file
+  /// @param chunk_size size of the writes
+  /// @throws std::runtime_error if the file cannot be opened
+  FileWriter(engine::TaskProcessor& async_tp, const std::string& path,
+             boost::filesystem::perms perms =
+                 boost::filesystem::perms::owner_read |
+                 boost::filesystem::perms::owner_write,
+             std::size_t chunk_size = kDefaultFileChunkSize);
+
+  FileWriter(FileWriter&&) noexcept;
+
+  /// Closes the file, the data that is not written yet by Finish() may be
+  /// lost.
+  ~FileWriter();
+
+  /// @brief Appends the data to the file
+  /// @throws std::runtime_error if a previous write has failed
+  void Write(std::string_view data);
+
+  /// @brief Writes the rest of the data, syncs and closes the file
+  /// @throws std::runtime_error if a write fails
+  void Finish();
+
+ private:
+  void Flush();
+
+  engine::TaskProcessor* async_tp_;
+  std::size_t chunk_size_;
+  std::unique_ptr<blocking::FileDescriptor> fd_;
+  std::string buffer_;
+  engine::TaskWithResult<void> write_task_;
+};
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,11 @@
 /// @file userver/fs/fs_cache_client.hpp
 /// @brief @copybref fs::FsCacheClient
 
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <userver/engine/io/sys/linux/inotify.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
@@ -16,15 +21,25 @@ namespace fs {
 ///
 /// @brief Class client for storing files in memory
 /// Usually retrieved from `components::FsCache`
+///
+/// On Linux the cache is updated with inotify: only the changed files are
+/// reloaded, the events that come within a short window are applied together.
+/// On the other platforms the whole directory is reloaded periodically.
 class FsCacheClient final {
  public:
   /// @brief Fills the cache and starts periodic update
   /// @param dir directory to cache files from
-  /// @param update_period time (0 - fill the cache only at startup), not used
-  /// in Linux
+  /// @param update_period time (0 - fill the cache only at startup), in Linux
+  /// only enables the updates
   /// @param tp task processor to do filesystem operations
+  /// @param max_cached_file_size contents of the bigger files are not kept in
+  /// memory, only their FileInfoWithData::path and FileInfoWithData::size
+  /// @param precompress fill FileInfoWithData::gzip_data and
+  /// FileInfoWithData::brotli_data of the loaded files
   FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period,
-                engine::TaskProcessor& tp);
+                engine::TaskProcessor& tp,
+                std::optional<std::size_t> max_cached_file_size = std::nullopt,
+                bool precompress = false);
 
   /// @brief get file from memory
   /// @param path to file
@@ -35,23 +50,32 @@ class FsCacheClient final {
   /// @brief Concurrency-safe cache update
   void UpdateCache();
 
+  /// @brief Task processor to do filesystem operations on
+  engine::TaskProcessor& GetTaskProcessor() const { return tp_; }
+
  private:
+  std::vector<FileInfoWithData> LoadFiles(
+      const std::vector<std::string>& paths) const;
+
 #ifdef __linux__
-  void InotifyWork();
+  void InotifyWork(engine::io::sys::linux::Inotify& inotify);
 
   void HandleDelete(const std::string& path);
 
-  static void HandleDeleteDirectory(engine::io::sys::linux::Inotify& inotify,
-                                    const std::string& path);
+  void HandleDeleteDirectory(engine::io::sys::linux::Inotify& inotify,
+                             const std::string& path);
 
-  void HandleCreate(const std::string& path);
+  void HandleChanges(const std::vector<std::string>& paths);
 
-  void HandleCreateDirectory(engine::io::sys::linux::Inotify& inotify,
-                             const std::string& path);
+  // Watches the directory and its subdirectories, returns the files in them
+  std::vector<std::string> WatchDirectory(
+      engine::io::sys::linux::Inotify& inotify, const std::string& path);
 #endif
 
   const std::string dir_;
   const std::chrono::milliseconds update_period_;
+  const std::optional<std::size_t> max_cached_file_size_;
+  const bool precompress_;
   engine::TaskProcessor& tp_;
 #ifndef __linux__
   utils::PeriodicTask cache_updater_;
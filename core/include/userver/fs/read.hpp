@@ -3,7 +3,9 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -19,6 +21,19 @@ namespace fs {
 struct FileInfoWithData {
   std::string data;
   std::string extension;
+  /// Path to the file on the filesystem
+  std::string path;
+  /// Size of the file
+  std::size_t size{0};
+  /// false if the file is too big and `data` is left empty
+  bool is_data_loaded{true};
+  /// Strong ETag of `data`, filled by fs::FsCacheClient for the loaded files
+  std::string etag;
+  /// `data` compressed with gzip, filled by fs::FsCacheClient if the
+  /// precompression is enabled and the result is smaller than `data`
+  std::string gzip_data;
+  /// `data` compressed with brotli, see `gzip_data`
+  std::string brotli_data;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -42,12 +57,24 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir);
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path to directory to traverse recursively
 /// @param flags settings read files
+/// @param max_data_size contents of the files bigger than that are not read
 /// @returns map with relative to `path` filepaths and file info
 /// @throws std::runtime_error if read fails for any reason (e.g. no such file,
 /// read error, etc.),
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp, const std::string& path,
-    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden});
+    utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden},
+    std::optional<std::size_t> max_data_size = std::nullopt);
+
+/// @brief Returns the info of the file and its contents
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param max_data_size the contents are not read if the file is bigger
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    std::optional<std::size_t> max_data_size = std::nullopt);
 
 /// @brief Reads file contents asynchronously
 /// @param async_tp TaskProcessor for synchronous waiting
@@ -3,10 +3,14 @@
 /// @file userver/rcu/rcu.hpp
 /// @brief Implementation of hazard pointer
 
+#include <array>
 #include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <list>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
@@ -24,6 +28,22 @@ USERVER_NAMESPACE_BEGIN
 /// with modified API
 namespace rcu {
 
+/// @brief Can be set as `RcuTraits::kReclamation` to choose how rcu::Variable
+/// finds out that nobody reads an old value anymore.
+enum class ReclamationType {
+  /// Readers publish the pointers to the values in a per-variable list of
+  /// hazard pointers, writers scan the list. The default.
+  kHazardPointers,
+
+  /// Readers increment a per-thread counter of the readers of the current
+  /// epoch, writers start a new epoch once the readers of the previous one
+  /// are gone and free the old values after two epochs. Reads and writes do
+  /// not depend on the count of the readers, but a long-living ReadablePtr
+  /// delays the freeing of all the values retired after its creation.
+  /// Each variable takes about half a kilobyte more memory.
+  kEpochs,
+};
+
 namespace impl {
 
 // Hazard pointer implementation. Pointers form a linked list. \p ptr points
@@ -67,11 +87,132 @@ thread_local CachedData<T, RcuTraits> cache;
 
 uint64_t GetNextEpoch() noexcept;
 
+template <typename RcuTraits, typename = void>
+inline constexpr ReclamationType kReclamationType =
+    ReclamationType::kHazardPointers;
+
+template <typename RcuTraits>
+inline constexpr ReclamationType kReclamationType<
+    RcuTraits, std::void_t<decltype(RcuTraits::kReclamation)>> =
+    RcuTraits::kReclamation;
+
+template <typename RcuTraits>
+inline constexpr bool kIsEpochBased =
+    kReclamationType<RcuTraits> == ReclamationType::kEpochs;
+
+inline constexpr std::size_t kEpochShardsCount = 8;
+
+// Index of the EpochReaders shard of the current thread
+std::size_t GetEpochShardIndex() noexcept;
+
+// Readers counters of ReclamationType::kEpochs. A reader increments the counter
+// of the current epoch parity before loading the value and decrements the same
+// counter when done. The writer starts the next epoch only when the counters
+// of the other parity sum up to zero, so after two epoch switches nobody sees
+// the values that were replaced before the first one. If the epoch may be
+// advanced concurrently with the replacement (e.g. by the writers of the other
+// shards), three switches are required, see kConcurrentGraceEpochs.
+class EpochReaders final {
+ public:
+  using Counter = std::atomic<std::int64_t>;
+
+  EpochReaders() = default;
+
+  EpochReaders(const EpochReaders&) = delete;
+  EpochReaders& operator=(const EpochReaders&) = delete;
+
+  // The returned counter has to be passed to Unlock. The increment is ordered
+  // before the subsequent load of the value.
+  Counter& Lock() noexcept {
+    const auto epoch = epoch_.load();
+    auto& counter = shards_[GetEpochShardIndex()].readers[epoch & 1];
+    counter.fetch_add(1);
+    return counter;
+  }
+
+  // For the copies of an already locked reader
+  static void Relock(Counter& counter) noexcept {
+    counter.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static void Unlock(Counter& counter) noexcept {
+    counter.fetch_sub(1, std::memory_order_release);
+  }
+
+  // Is ordered after the preceding replacement of the value
+  std::uint64_t GetEpoch() const noexcept { return epoch_.load(); }
+
+  // Starts the next epoch if the readers of the previous one are gone.
+  // Returns the current epoch.
+  std::uint64_t TryAdvance() noexcept {
+    auto epoch = GetEpoch();
+    if (CountReaders((epoch + 1) & 1) != 0) return epoch;
+    if (!epoch_.compare_exchange_strong(epoch, epoch + 1)) return epoch;
+    return epoch + 1;
+  }
+
+  bool HasReaders() const noexcept {
+    return CountReaders(0) != 0 || CountReaders(1) != 0;
+  }
+
+ private:
+  // Each reader decrements the counter it has incremented, so the shards can
+  // be loaded one by one
+  std::int64_t CountReaders(std::uint64_t parity) const noexcept {
+    std::int64_t result = 0;
+    for (const auto& shard : shards_) result += shard.readers[parity].load();
+    return result;
+  }
+
+  struct alignas(64) Shard final {
+    Counter readers[2]{};
+  };
+
+  std::atomic<std::uint64_t> epoch_{0};
+  std::array<Shard, kEpochShardsCount> shards_{};
+};
+
+// Count of the epoch switches after which nobody sees a value replaced
+// at the epoch, if the epoch is advanced without the writer's mutex
+inline constexpr std::uint64_t kConcurrentGraceEpochs = 3;
+
+// Holds the epoch of the reader
+class EpochReadLock final {
+ public:
+  explicit EpochReadLock(EpochReaders& readers) noexcept
+      : counter_(readers.Lock()) {}
+
+  EpochReadLock(const EpochReadLock&) = delete;
+  EpochReadLock& operator=(const EpochReadLock&) = delete;
+
+  ~EpochReadLock() { EpochReaders::Unlock(counter_); }
+
+ private:
+  EpochReaders::Counter& counter_;
+};
+
+struct NoEpochReaders final {};
+
+template <typename T>
+struct EpochRetiredValue final {
+  std::uint64_t free_epoch;
+  std::unique_ptr<T> ptr;
+};
+
+template <typename T, typename RcuTraits>
+using ReaderRecord =
+    std::conditional_t<kIsEpochBased<RcuTraits>, EpochReaders::Counter,
+                       HazardPointerRecord<T, RcuTraits>>;
+
 }  // namespace impl
 
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `kReclamation` (optional) is a rcu::ReclamationType constant, the
+/// hazard pointers are used if it is not defined
+///
+/// @snippet rcu/rcu_test.cpp  Sample rcu::Variable epochs
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
@@ -85,18 +226,23 @@ struct DefaultRcuTraits {
 template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
  public:
-  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr)
-      : hp_record_(&ptr.MakeHazardPointer()) {
-    // This cycle guarantees that at the end of it both t_ptr_ and
-    // hp_record_->ptr will both be set to
-    // 1. something meaningful
-    // 2. and that this meaningful value was not removed between assigning to
-    //    t_ptr_ and storing  it in a hazard pointer
-    do {
+  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      hp_record_ = &ptr.epoch_readers_.Lock();
       t_ptr_ = ptr.GetCurrent();
-
-      hp_record_->ptr.store(t_ptr_);
-    } while (t_ptr_ != ptr.GetCurrent());
+    } else {
+      hp_record_ = &ptr.MakeHazardPointer();
+      // This cycle guarantees that at the end of it both t_ptr_ and
+      // hp_record_->ptr will both be set to
+      // 1. something meaningful
+      // 2. and that this meaningful value was not removed between assigning
+      //    to t_ptr_ and storing  it in a hazard pointer
+      do {
+        t_ptr_ = ptr.GetCurrent();
+
+        hp_record_->ptr.store(t_ptr_);
+      } while (t_ptr_ != ptr.GetCurrent());
+    }
   }
 
   ReadablePtr(ReadablePtr<T, RcuTraits>&& other) noexcept
@@ -128,7 +274,7 @@ class [[nodiscard]] ReadablePtr final {
 
     // Get rid of our current hp_record_
     if (t_ptr_) {
-      hp_record_->Release();
+      Release();
     }
     // After that moment, the content of our hp_record_ can't be used -
     // no more hp_record_->xyz calls, because it is probably already reused in
@@ -148,7 +294,7 @@ class [[nodiscard]] ReadablePtr final {
   }
 
   ReadablePtr(const ReadablePtr<T, RcuTraits>& other)
-      : ReadablePtr(other.hp_record_->owner) {}
+      : ReadablePtr(CopyFrom(other)) {}
 
   ReadablePtr& operator=(const ReadablePtr<T, RcuTraits>& other) {
     if (this != &other) *this = ReadablePtr<T, RcuTraits>{other};
@@ -158,7 +304,7 @@ class [[nodiscard]] ReadablePtr final {
   ~ReadablePtr() {
     if (!t_ptr_) return;
     UASSERT(hp_record_ != nullptr);
-    hp_record_->Release();
+    Release();
   }
 
   const T* Get() const& {
@@ -181,15 +327,38 @@ class [[nodiscard]] ReadablePtr final {
     std::abort();
   }
 
+  ReadablePtr(T* t_ptr, impl::ReaderRecord<T, RcuTraits>* record) noexcept
+      : t_ptr_(t_ptr), hp_record_(record) {}
+
+  static ReadablePtr CopyFrom(const ReadablePtr<T, RcuTraits>& other) {
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      // The epoch of `other` can not end while it is held, so the copy may
+      // share its counter
+      if (other.t_ptr_) impl::EpochReaders::Relock(*other.hp_record_);
+      return ReadablePtr{other.t_ptr_, other.hp_record_};
+    } else {
+      return ReadablePtr{other.hp_record_->owner};
+    }
+  }
+
+  void Release() noexcept {
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      impl::EpochReaders::Unlock(*hp_record_);
+    } else {
+      hp_record_->Release();
+    }
+  }
+
   // This is a pointer to actual data. If it is null, then we treat it as
   // an indicator that this ReadablePtr is cleared and won't call
   // any logic associated with hp_record_
   T* t_ptr_;
-  // Our hazard pointer. It can be nullptr in some circumstances.
+  // Our hazard pointer or, for ReclamationType::kEpochs, the epoch readers
+  // counter. It can be nullptr in some circumstances.
   // Invariant is this: if t_ptr_ is not nullptr, then hp_record_ is also
   // not nullptr and points to hazard pointer containing same T*.
   // Thus, if t_ptr_ is nullptr, then hp_record_ is undefined.
-  impl::HazardPointerRecord<T, RcuTraits>* hp_record_;
+  impl::ReaderRecord<T, RcuTraits>* hp_record_;
 };
 
 /// Smart pointer for rcu::Variable<T> for changing RCU value. It stores a
@@ -340,6 +509,11 @@ class Variable final {
   ~Variable() {
     delete current_.load();
 
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      UASSERT_MSG(!epoch_readers_.HasReaders(),
+                  "RCU variable is destroyed while being used");
+    }
+
     auto* hp = hp_record_head_.load();
     while (hp) {
       auto* next = hp->next.load();
@@ -402,10 +576,19 @@ class Variable final {
       return;
     }
 
-    ScanRetiredList(CollectHazardPtrs(lock));
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      ScanRetiredEpochs();
+    } else {
+      ScanRetiredList(CollectHazardPtrs(lock));
+    }
   }
 
  private:
+  using RetireList =
+      std::conditional_t<impl::kIsEpochBased<RcuTraits>,
+                         std::list<impl::EpochRetiredValue<T>>,
+                         std::list<std::unique_ptr<T>>>;
+
   T* GetCurrent() const { return current_.load(); }
 
   impl::HazardPointerRecord<T, RcuTraits>* MakeHazardPointerCached() const {
@@ -469,6 +652,19 @@ class Variable final {
 
   void Retire(std::unique_ptr<T> old_ptr, std::unique_lock<MutexType>& lock) {
     LOG_TRACE() << "Retiring ptr=" << old_ptr.get();
+    if constexpr (impl::kIsEpochBased<RcuTraits>) {
+      // The readers that might have seen old_ptr are gone after two epoch
+      // switches
+      retire_list_head_.push_back(
+          {epoch_readers_.GetEpoch() + 2, std::move(old_ptr)});
+      ScanRetiredEpochs();
+    } else {
+      RetireHazardPointers(std::move(old_ptr), lock);
+    }
+  }
+
+  void RetireHazardPointers(std::unique_ptr<T> old_ptr,
+                            std::unique_lock<MutexType>& lock) {
     auto hazard_ptrs = CollectHazardPtrs(lock);
 
     if (hazard_ptrs.count(old_ptr.get()) > 0) {
@@ -497,6 +693,21 @@ class Variable final {
     }
   }
 
+  // Advances the epoch as far as possible (at most two switches are needed
+  // for the values retired just now) and destroys the values retired long
+  // enough ago
+  void ScanRetiredEpochs() {
+    if (retire_list_head_.empty()) return;
+
+    epoch_readers_.TryAdvance();
+    const auto epoch = epoch_readers_.TryAdvance();
+    while (!retire_list_head_.empty() &&
+           retire_list_head_.front().free_epoch <= epoch) {
+      DeleteAsync(std::move(retire_list_head_.front().ptr));
+      retire_list_head_.pop_front();
+    }
+  }
+
   // Returns all T*, that have hazard ptr pointing at them. Occasionally nullptr
   // might be in result as well.
   std::unordered_set<T*> CollectHazardPtrs(std::unique_lock<MutexType>&) {
@@ -531,10 +742,14 @@ class Variable final {
   mutable std::atomic<impl::HazardPointerRecord<T, RcuTraits>*> hp_record_head_{
       {nullptr}};
 
+  mutable std::conditional_t<impl::kIsEpochBased<RcuTraits>,
+                             impl::EpochReaders, impl::NoEpochReaders>
+      epoch_readers_;
+
   MutexType mutex_;  // for current_ changes and retire_list_head_ access
   // may be read without mutex_ locked, but must be changed with held mutex_
   std::atomic<T*> current_;
-  std::list<std::unique_ptr<T>> retire_list_head_;
+  RetireList retire_list_head_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 
   friend class ReadablePtr<T, RcuTraits>;
@@ -21,6 +21,8 @@ namespace impl {
 template <typename RcuMapTraits>
 struct RcuTraitsFromRcuMapTraits {
   using MutexType = typename RcuMapTraits::MutexType;
+  static constexpr ReclamationType kReclamation =
+      kReclamationType<RcuMapTraits>;
 };
 }  // namespace impl
 
@@ -37,6 +39,8 @@ class MissingKeyException : public utils::TracefulException {
 /// type `Key`
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `kReclamation` (optional) is a rcu::ReclamationType constant, see
+/// rcu::DefaultRcuTraits
 template <typename Key, typename Value>
 struct DefaultRcuMapTraits {
   using Hash = std::hash<Key>;
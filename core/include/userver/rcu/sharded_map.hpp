@@ -0,0 +1,483 @@
+#pragma once
+
+/// @file userver/rcu/sharded_map.hpp
+/// @brief @copybrief rcu::ShardedMap
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// Default rcu::ShardedMap traits.
+/// Member types:
+/// - `Hash` is a functor type that returns hash value for `Key`
+/// - `KeyEqual` is a functor type that provide equality test for two values of
+/// type `Key`
+/// - `MutexType` is a writer's mutex type that protects a shard on update
+/// - `kShardsCount` is the count of the independently locked shards, must be
+/// a power of 2
+template <typename Key, typename Value>
+struct DefaultShardedMapTraits {
+  using Hash = std::hash<Key>;
+  using KeyEqual = std::equal_to<Key>;
+  using MutexType = engine::Mutex;
+  static constexpr std::size_t kShardsCount = 64;
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Concurrent hash map with lock-free reads and per-shard writers.
+///
+/// Unlike rcu::RcuMap, a keyset change does not copy the map: a writer locks
+/// only the shard of the key and links or unlinks a single node. Readers never
+/// lock or wait, they traverse the nodes under an epoch of the
+/// rcu::ReclamationType::kEpochs scheme and the unlinked nodes are freed once
+/// no reader may see them. Each shard grows its own bucket table, so the
+/// resizing is spread across the writes.
+///
+/// Values are stored in `shared_ptr`s and are not copied.
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// @note The memory of the erased nodes is reclaimed by the subsequent writes
+/// to the same shard, and a long-living reader (e.g. a slow VisitAll callback)
+/// delays it.
+///
+/// ## Example usage:
+///
+/// @snippet rcu/sharded_map_test.cpp  Sample rcu::ShardedMap usage
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value,
+          typename Traits = DefaultShardedMapTraits<Key, Value>>
+class ShardedMap final {
+ public:
+  static_assert(!std::is_reference_v<Key>);
+  static_assert(!std::is_reference_v<Value>);
+  static_assert(!std::is_const_v<Key>);
+  static_assert(Traits::kShardsCount > 0 &&
+                (Traits::kShardsCount & (Traits::kShardsCount - 1)) == 0);
+
+  using Hash = typename Traits::Hash;
+  using KeyEqual = typename Traits::KeyEqual;
+  using MutexType = typename Traits::MutexType;
+  using ValuePtr = std::shared_ptr<Value>;
+  using ConstValuePtr = std::shared_ptr<const Value>;
+  using Snapshot = std::unordered_map<Key, ConstValuePtr, Hash, KeyEqual>;
+
+  struct InsertReturnType {
+    ValuePtr value;
+    bool inserted;
+  };
+
+  ShardedMap() = default;
+  ~ShardedMap();
+
+  ShardedMap(const ShardedMap&) = delete;
+  ShardedMap(ShardedMap&&) = delete;
+  ShardedMap& operator=(const ShardedMap&) = delete;
+  ShardedMap& operator=(ShardedMap&&) = delete;
+
+  /// Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const noexcept;
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  /// @note Never blocks.
+  ConstValuePtr Get(const Key& key) const;
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  /// @note Never blocks.
+  ValuePtr Get(const Key& key);
+
+  /// @brief Inserts a new element into the container if there is no element
+  /// with the key in the container.
+  /// Returns a pair consisting of a pointer to the inserted element, or the
+  /// already-existing element if no insertion happened, and a bool denoting
+  /// whether the insertion took place.
+  InsertReturnType Insert(const Key& key, ValuePtr value);
+
+  /// @brief Inserts a new element into the container constructed in-place with
+  /// the given args if there is no element with the key in the container.
+  /// The value is not constructed if the key exists.
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args);
+
+  /// @brief If a key equivalent to `key` already exists in the container,
+  /// replaces the associated value. Otherwise, inserts a new pair into the map.
+  void InsertOrAssign(const Key& key, ValuePtr value);
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  bool Erase(const Key& key);
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  ValuePtr Pop(const Key& key);
+
+  /// Resets the map to an empty state, one shard at a time
+  void Clear();
+
+  /// @brief Calls `func(const Key&, const ValuePtr&)` for the elements of the
+  /// map, one shard at a time.
+  /// @details The elements inserted or erased concurrently may or may not be
+  /// visited. Never blocks, but delays the memory reclamation of the whole map
+  /// while a shard is visited.
+  template <typename Func>
+  void VisitAll(Func&& func) const;
+
+  /// @brief Returns a readonly copy of the map, each shard is copied at its
+  /// own point in time
+  Snapshot GetSnapshot() const;
+
+ private:
+  struct Node final {
+    Node(std::size_t hash, Key key, ValuePtr value, Node* next)
+        : hash(hash),
+          key(std::move(key)),
+          value(std::move(value)),
+          next(next) {}
+
+    const std::size_t hash;
+    const Key key;
+    const ValuePtr value;
+    std::atomic<Node*> next;
+  };
+
+  class Table final {
+   public:
+    explicit Table(std::size_t buckets_count)
+        : mask_(buckets_count - 1),
+          buckets_(std::make_unique<std::atomic<Node*>[]>(buckets_count)) {
+      UASSERT((buckets_count & mask_) == 0);
+    }
+
+    Table(const Table&) = delete;
+    Table& operator=(const Table&) = delete;
+
+    // Deletes the nodes linked to the table
+    ~Table() {
+      for (std::size_t i = 0; i <= mask_; ++i) {
+        auto* node = buckets_[i].load(std::memory_order_relaxed);
+        while (node) {
+          auto* const next = node->next.load(std::memory_order_relaxed);
+          delete node;
+          node = next;
+        }
+      }
+    }
+
+    std::size_t GetBucketsCount() const noexcept { return mask_ + 1; }
+
+    std::atomic<Node*>& GetBucket(std::size_t hash) noexcept {
+      return buckets_[(hash / Traits::kShardsCount) & mask_];
+    }
+
+    std::atomic<Node*>& GetBucketAt(std::size_t index) noexcept {
+      return buckets_[index];
+    }
+
+   private:
+    const std::size_t mask_;
+    const std::unique_ptr<std::atomic<Node*>[]> buckets_;
+  };
+
+  // Either a node or a whole table with its nodes
+  struct Retired final {
+    std::uint64_t free_epoch;
+    std::unique_ptr<Node> node;
+    std::unique_ptr<Table> table;
+  };
+
+  struct alignas(64) Shard final {
+    MutexType mutex;
+    std::atomic<Table*> table{nullptr};
+    std::atomic<std::size_t> size{0};
+    // protected by mutex
+    std::deque<Retired> retired;
+  };
+
+  static constexpr std::size_t kInitialBucketsCount = 8;
+
+  Shard& GetShard(std::size_t hash) const noexcept {
+    return shards_[hash & (Traits::kShardsCount - 1)];
+  }
+
+  // Must be called under an impl::EpochReadLock
+  static Node* Find(const Shard& shard, std::size_t hash,
+                    const Key& key) noexcept;
+
+  // Returns the link that points to the node with the key or the last link of
+  // the bucket (nullptr). Must be called with the shard mutex held.
+  static std::atomic<Node*>& FindLink(Table& table, std::size_t hash,
+                                      const Key& key) noexcept;
+
+  template <typename MakeValue>
+  InsertReturnType DoInsert(const Key& key, MakeValue&& make_value);
+
+  // Must be called with the shard mutex held
+  Table& GetOrCreateTable(Shard& shard);
+  void GrowIfNeeded(Shard& shard, Table& table);
+  void Retire(Shard& shard, Retired&& retired);
+  void Reclaim(Shard& shard) noexcept;
+
+  mutable impl::EpochReaders epoch_readers_;
+  mutable std::array<Shard, Traits::kShardsCount> shards_{};
+};
+
+template <typename K, typename V, typename Traits>
+ShardedMap<K, V, Traits>::~ShardedMap() {
+  UASSERT_MSG(!epoch_readers_.HasReaders(),
+              "ShardedMap is destroyed while being used");
+  for (auto& shard : shards_) {
+    delete shard.table.load(std::memory_order_relaxed);
+  }
+}
+
+template <typename K, typename V, typename Traits>
+std::size_t ShardedMap<K, V, Traits>::SizeApprox() const noexcept {
+  std::size_t result = 0;
+  for (const auto& shard : shards_) {
+    result += shard.size.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::Find(const Shard& shard, std::size_t hash,
+                                    const K& key) noexcept -> Node* {
+  auto* const table = shard.table.load();
+  if (!table) return nullptr;
+
+  for (auto* node = table->GetBucket(hash).load(); node;
+       node = node->next.load()) {
+    if (node->hash == hash && KeyEqual{}(node->key, key)) return node;
+  }
+  return nullptr;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::FindLink(Table& table, std::size_t hash,
+                                        const K& key) noexcept
+    -> std::atomic<Node*>& {
+  auto* link = &table.GetBucket(hash);
+  for (auto* node = link->load(); node; node = link->load()) {
+    if (node->hash == hash && KeyEqual{}(node->key, key)) break;
+    link = &node->next;
+  }
+  return *link;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::Get(const K& key) const -> ConstValuePtr {
+  const auto hash = Hash{}(key);
+  const impl::EpochReadLock lock{epoch_readers_};
+  const auto* const node = Find(GetShard(hash), hash, key);
+  return node ? node->value : nullptr;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::Get(const K& key) -> ValuePtr {
+  const auto hash = Hash{}(key);
+  const impl::EpochReadLock lock{epoch_readers_};
+  const auto* const node = Find(GetShard(hash), hash, key);
+  return node ? node->value : nullptr;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::Insert(const K& key, ValuePtr value)
+    -> InsertReturnType {
+  return DoInsert(key, [&value] { return std::move(value); });
+}
+
+template <typename K, typename V, typename Traits>
+template <typename... Args>
+auto ShardedMap<K, V, Traits>::Emplace(const K& key, Args&&... args)
+    -> InsertReturnType {
+  return DoInsert(key, [&args...] {
+    return std::make_shared<V>(std::forward<Args>(args)...);
+  });
+}
+
+template <typename K, typename V, typename Traits>
+template <typename MakeValue>
+auto ShardedMap<K, V, Traits>::DoInsert(const K& key, MakeValue&& make_value)
+    -> InsertReturnType {
+  const auto hash = Hash{}(key);
+  auto& shard = GetShard(hash);
+  const std::lock_guard lock{shard.mutex};
+
+  auto& table = GetOrCreateTable(shard);
+  auto& link = FindLink(table, hash, key);
+  if (auto* const existing = link.load()) return {existing->value, false};
+
+  auto& bucket = table.GetBucket(hash);
+  auto* const node = new Node(hash, key, make_value(), bucket.load());
+  bucket.store(node);
+  shard.size.fetch_add(1, std::memory_order_relaxed);
+
+  // The node may be freed by the rehashing
+  auto value = node->value;
+  GrowIfNeeded(shard, table);
+  return {std::move(value), true};
+}
+
+template <typename K, typename V, typename Traits>
+void ShardedMap<K, V, Traits>::InsertOrAssign(const K& key, ValuePtr value) {
+  const auto hash = Hash{}(key);
+  auto& shard = GetShard(hash);
+  const std::lock_guard lock{shard.mutex};
+
+  auto& table = GetOrCreateTable(shard);
+  auto& link = FindLink(table, hash, key);
+  auto* const existing = link.load();
+  if (!existing) {
+    auto& bucket = table.GetBucket(hash);
+    bucket.store(new Node(hash, key, std::move(value), bucket.load()));
+    shard.size.fetch_add(1, std::memory_order_relaxed);
+    GrowIfNeeded(shard, table);
+    return;
+  }
+
+  // The readers that are at `existing` continue to its old successors
+  link.store(new Node(hash, key, std::move(value), existing->next.load()));
+  Retire(shard, {0, std::unique_ptr<Node>{existing}, nullptr});
+}
+
+template <typename K, typename V, typename Traits>
+bool ShardedMap<K, V, Traits>::Erase(const K& key) {
+  return Pop(key) != nullptr;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::Pop(const K& key) -> ValuePtr {
+  const auto hash = Hash{}(key);
+  auto& shard = GetShard(hash);
+  const std::lock_guard lock{shard.mutex};
+
+  auto* const table = shard.table.load();
+  if (!table) return nullptr;
+
+  auto& link = FindLink(*table, hash, key);
+  auto* const existing = link.load();
+  if (!existing) return nullptr;
+
+  link.store(existing->next.load());
+  shard.size.fetch_sub(1, std::memory_order_relaxed);
+  auto value = existing->value;
+  Retire(shard, {0, std::unique_ptr<Node>{existing}, nullptr});
+  return value;
+}
+
+template <typename K, typename V, typename Traits>
+void ShardedMap<K, V, Traits>::Clear() {
+  for (auto& shard : shards_) {
+    const std::lock_guard lock{shard.mutex};
+    auto* const table = shard.table.exchange(nullptr);
+    if (!table) continue;
+
+    shard.size.store(0, std::memory_order_relaxed);
+    Retire(shard, {0, nullptr, std::unique_ptr<Table>{table}});
+  }
+}
+
+template <typename K, typename V, typename Traits>
+template <typename Func>
+void ShardedMap<K, V, Traits>::VisitAll(Func&& func) const {
+  for (const auto& shard : shards_) {
+    const impl::EpochReadLock lock{epoch_readers_};
+    auto* const table = shard.table.load();
+    if (!table) continue;
+
+    for (std::size_t i = 0; i < table->GetBucketsCount(); ++i) {
+      for (const auto* node = table->GetBucketAt(i).load(); node;
+           node = node->next.load()) {
+        func(std::as_const(node->key), std::as_const(node->value));
+      }
+    }
+  }
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::GetSnapshot() const -> Snapshot {
+  Snapshot snapshot;
+  snapshot.reserve(SizeApprox());
+  VisitAll([&snapshot](const K& key, const ValuePtr& value) {
+    snapshot.emplace(key, value);
+  });
+  return snapshot;
+}
+
+template <typename K, typename V, typename Traits>
+auto ShardedMap<K, V, Traits>::GetOrCreateTable(Shard& shard) -> Table& {
+  auto* table = shard.table.load();
+  if (!table) {
+    table = new Table(kInitialBucketsCount);
+    shard.table.store(table);
+  }
+  return *table;
+}
+
+template <typename K, typename V, typename Traits>
+void ShardedMap<K, V, Traits>::GrowIfNeeded(Shard& shard, Table& table) {
+  if (shard.size.load(std::memory_order_relaxed) <= table.GetBucketsCount()) {
+    Reclaim(shard);
+    return;
+  }
+
+  // The readers may traverse the old nodes, so the nodes are copied into the
+  // new table rather than relinked
+  auto new_table = std::make_unique<Table>(table.GetBucketsCount() * 2);
+  for (std::size_t i = 0; i < table.GetBucketsCount(); ++i) {
+    for (auto* node = table.GetBucketAt(i).load(); node;
+         node = node->next.load()) {
+      auto& bucket = new_table->GetBucket(node->hash);
+      bucket.store(
+          new Node(node->hash, node->key, node->value, bucket.load()),
+          std::memory_order_relaxed);
+    }
+  }
+
+  shard.table.store(new_table.release());
+  Retire(shard, {0, nullptr, std::unique_ptr<Table>{&table}});
+}
+
+template <typename K, typename V, typename Traits>
+void ShardedMap<K, V, Traits>::Retire(Shard& shard, Retired&& retired) {
+  // The other shards advance the epoch without our mutex
+  retired.free_epoch = epoch_readers_.GetEpoch() + impl::kConcurrentGraceEpochs;
+  shard.retired.push_back(std::move(retired));
+  Reclaim(shard);
+}
+
+template <typename K, typename V, typename Traits>
+void ShardedMap<K, V, Traits>::Reclaim(Shard& shard) noexcept {
+  if (shard.retired.empty()) return;
+
+  std::uint64_t epoch = 0;
+  for (std::uint64_t i = 0; i < impl::kConcurrentGraceEpochs; ++i) {
+    epoch = epoch_readers_.TryAdvance();
+  }
+  while (!shard.retired.empty() &&
+         shard.retired.front().free_epoch <= epoch) {
+    shard.retired.pop_front();
+  }
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
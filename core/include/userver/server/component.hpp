@@ -43,6 +43,17 @@ namespace components {
 /// listener | (*required*) *see below* | -
 /// listener-monitor | *see below* | -
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | false
+/// handoff-socket | unix socket for the zero downtime restarts, *see below* | -
+///
+/// If 'handoff-socket' is set, the starting server takes the listening sockets
+/// from the running instance of the service that serves that socket, so no
+/// connection is refused during the restart. The running instance keeps
+/// accepting until the new one has loaded all its components and started the
+/// listeners, then it gets SIGTERM and stops gracefully. The new instance
+/// serves the socket for the next restart. The listeners must have the same
+/// ports and shards count in both instances, the extra sockets are closed.
+/// The socket file is accessible to the owner only; a temporary private
+/// directory is created next to it while the socket is bound.
 ///
 /// Server is configured by 'listener' and 'listener-monitor' entries.
 /// 'listener' is a required entry that describes the request processing
@@ -71,7 +82,24 @@ namespace components {
 /// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
+/// connection.http_version | '2' to additionally serve HTTP/2 with prior knowledge (h2c) or via TLS ALPN, '1.1' to serve HTTP/1.1 only | '1.1'
+/// connection.http_parser | HTTP/1.x request parser: 'http-parser' or 'simd' for the one that searches for the delimiters with SIMD instructions | 'http-parser'
+/// connection.zero_copy_body | keep the HTTP/1.x request bodies in the receive buffers instead of copying them, the buffers stay allocated until the requests that refer to them are destroyed; see server::http::HttpRequest::GetRequestBodyChunks() | false
+/// connection.receive_buffers_pool_size | count of free receive buffers of `in_buffer_size` kept for reuse by the listener; the connections give their buffers back while waiting for data, 0 makes each connection keep its buffer | 256
+/// connection.memory_budget | max bytes of URLs, headers and bodies of the requests of a connection that are being parsed or processed; the request that exceeds it is answered with 413 and the connection is closed, 0 for unlimited | 0
+/// connection.http2_session.max_concurrent_streams | SETTINGS_MAX_CONCURRENT_STREAMS advertised to the peer | 100
+/// connection.http2_session.max_frame_size | SETTINGS_MAX_FRAME_SIZE advertised to the peer | 16384
+/// connection.http2_session.initial_window_size | SETTINGS_INITIAL_WINDOW_SIZE advertised to the peer | 65535
+/// tls.cert | path to TLS certificate | -
+/// tls.private-key | path to TLS certificate private key | -
+/// tls.private-key-passphrase-name | passphrase name located in secdist | -
+/// tls.session-cache-size | max count of sessions in the server-side TLS session cache shared by the connections of the listener, 0 disables the cache | 20480
+/// tls.session-timeout | lifetime of the cached TLS sessions and of the session tickets | 300s
+/// tls.session-tickets | whether to issue TLS session tickets, so that the clients resume the sessions with an abbreviated handshake without the server-side cache | true
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// shared-nothing | run each shard with its own SO_REUSEPORT socket on a dedicated single-threaded task processor pinned to an ev thread; the requests are handled on the task processor of their connection, ignoring the `task_processor` of the handlers, so that a request never migrates between threads. The worker_threads of the shard task processors are spawned in addition to the ones of `task_processor`. Tasks started by the handlers must not outlive the server component | false
+/// pinned-acceptors | run the accept loop of each shard on a dedicated single-threaded task processor pinned to its own ev thread, so that the accept loops do not compete for the threads during connection storms; the connections are handled by `task_processor`. The shards accept on their own SO_REUSEPORT sockets anyway. Implied by `shared-nothing` | false
+/// reuseport-cpu-steering | attach a classic BPF program to the SO_REUSEPORT sockets of the shards, so that the kernel picks the socket of a new connection by the CPU that received it instead of by the hash of the addresses. Combine with RSS/RPS to keep the connection of a CPU on the same shard. Linux only | false
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
 
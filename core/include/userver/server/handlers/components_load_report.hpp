@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file userver/server/handlers/components_load_report.hpp
+/// @brief @copybrief server::handlers::ComponentsLoadReport
+
+#include <userver/server/handlers/http_handler_json_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+class Manager;
+}  // namespace components
+
+namespace server::handlers {
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the timings of the component constructors and
+/// the critical path of the components load.
+///
+/// All the components start loading simultaneously, a component waits only
+/// for the dependencies it requests via components::ComponentContext::FindComponent.
+/// The critical path is the chain of the dependencies that determined the
+/// total load time, speeding up the components outside of it does not
+/// shorten the service start.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @code
+/// handler-components-load-report:
+///     path: /service/components/load-report
+///     method: GET
+///     task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Scheme
+/// `GET` returns the load duration of all the components including
+/// components::ComponentBase::OnAllComponentsLoaded, the names of the
+/// components on the critical path and the timings of each component sorted
+/// by the load start time:
+/// @code
+/// {"load-duration-ms": 1100,
+///  "critical-path": ["logging", "dynamic-config", "handler-ping"],
+///  "components": [{"name": "logging", "started-at-ms": 0,
+///    "finished-at-ms": 10, "total-ms": 10, "own-ms": 10,
+///    "dependencies-wait-ms": 0, "dependencies": []}]}
+/// @endcode
+
+// clang-format on
+class ComponentsLoadReport final : public HttpHandlerJsonBase {
+ public:
+  ComponentsLoadReport(const components::ComponentConfig& config,
+                       const components::ComponentContext& component_context);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::ComponentsLoadReport
+  static constexpr std::string_view kName = "handler-components-load-report";
+
+  formats::json::Value HandleRequestJsonThrow(
+      const http::HttpRequest& request,
+      const formats::json::Value& request_json,
+      request::RequestContext& context) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const components::Manager& manager_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool
+    components::kHasValidate<server::handlers::ComponentsLoadReport> = true;
+
+USERVER_NAMESPACE_END
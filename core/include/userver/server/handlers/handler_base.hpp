@@ -36,9 +36,25 @@ namespace server::handlers {
 /// request_body_size_log_limit | trim request to this size before logging | 512
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
-/// decompress_request | allow decompression of the requests | true
+/// decompress_request | allow decompression of the gzip and br requests, the body is decompressed as it is received and the decompressed size is limited by `max_request_size` | true
+/// multipart-spool-dir | stream the multipart/form-data requests that are not compressed and write their file parts to temporary files in this directory, see server::http::FormDataArg::file_path; the other parts are kept in memory and `max_request_size` still limits the whole request | <the body is kept in memory>
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
+/// response-compression.encodings | content codings to compress the responses with, in the order of preference: 'br', 'gzip' | [br, gzip]
+/// response-compression.min-size | do not compress the non-streamed responses smaller than this | 1024
+/// response-compression.gzip-level | gzip compression level, from 1 to 9 | 6
+/// response-compression.brotli-level | brotli compression level, from 0 to 11 | 4
+/// response-compression.task-processor | a task processor to compress the responses on | <the task processor of the handler>
+/// request-coalescing | set to `{}` or to an object with the options below to run the handler once for the concurrent identical GET and HEAD requests and copy its response to all of them | <no coalescing>
+/// request-coalescing.args | names of the request args that must be the same for the requests to be coalesced | <all the args>
+/// request-coalescing.headers | names of the request headers that must also be the same for the requests to be coalesced | []
+/// adaptive-concurrency-limit | set to `{}` or to an object with the options below to limit the requests in flight of the handler; the limit follows the observed latency and the requests over it are rejected with 429 | <no limit>
+/// adaptive-concurrency-limit.min-limit | the limit is never reduced below this value | 8
+/// adaptive-concurrency-limit.max-limit | the limit is never increased above this value | 1000
+/// adaptive-concurrency-limit.initial-limit | the limit on startup | 20
+/// adaptive-concurrency-limit.tolerance | ratio of the current latency to the minimal one that does not reduce the limit | 1.5
+/// adaptive-concurrency-limit.smoothing | weight of each new limit estimation, in (0, 1] | 0.2
+/// static-response-headers | map of "name": value headers to add to each response, formatted once at startup; the headers set by the handler take precedence | {}
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// deadline_propagation_enabled | when `false`, disables HTTP handler @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation" | true
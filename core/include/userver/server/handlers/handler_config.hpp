@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <optional>
 #include <string>
 #include <variant>
@@ -26,6 +27,34 @@ enum class UrlTrailingSlashOption {
   kDefault = kBoth,
 };
 
+struct ResponseCompressionConfig {
+  /// Content codings in the order of preference
+  std::vector<std::string> encodings{"br", "gzip"};
+  size_t min_size{1024};
+  int gzip_level{6};
+  int brotli_level{4};
+  std::optional<std::string> task_processor;
+};
+
+struct RequestCoalescingConfig {
+  /// Names of the request args the response depends on, all the args if not
+  /// set
+  std::optional<std::vector<std::string>> args;
+  /// Names of the request headers the response depends on
+  std::vector<std::string> headers;
+};
+
+struct AdaptiveConcurrencyLimitConfig {
+  size_t min_limit{8};
+  size_t max_limit{1000};
+  size_t initial_limit{20};
+  /// Ratio of the current latency to the minimal one that is tolerated
+  /// without reducing the limit
+  double tolerance{1.5};
+  /// Weight of each new limit estimation, in (0, 1]
+  double smoothing{0.2};
+};
+
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
@@ -38,8 +67,13 @@ struct HandlerConfig {
   std::optional<size_t> max_requests_in_flight;
   std::optional<size_t> max_requests_per_second;
   bool decompress_request{true};
+  std::optional<std::string> multipart_spool_dir;
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  std::optional<ResponseCompressionConfig> response_compression;
+  std::map<std::string, std::string> static_response_headers;
+  std::optional<RequestCoalescingConfig> request_coalescing;
+  std::optional<AdaptiveConcurrencyLimitConfig> adaptive_concurrency_limit;
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
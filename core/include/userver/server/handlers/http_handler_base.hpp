@@ -29,13 +29,21 @@ namespace tracing {
 class TracingManagerBase;
 }  // namespace tracing
 
+namespace server::http {
+class StaticHeaders;
+}  // namespace server::http
+
 /// @brief Most common \ref userver_http_handlers "userver HTTP handlers"
 namespace server::handlers {
 
+class AdaptiveConcurrencyLimiter;
+class HttpHandlerStageStatistics;
 class HttpHandlerStatistics;
 class HttpRequestStatistics;
 class HttpHandlerMethodStatistics;
 class HttpHandlerStatisticsScope;
+class RequestCoalescer;
+class ResponseCompressor;
 
 // clang-format off
 
@@ -52,6 +60,17 @@ class HttpHandlerStatisticsScope;
 /// ---- | ----------- | -------------
 /// log-level | overrides log level for this handle | <no override>
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
+/// stage-statistics | whether to collect the percentiles of the timings and the CPU time of the request processing stages and of the bytes allocated per request | false
+///
+/// The `stage-statistics` are written under `handler.profile`. The stages are
+/// `check-auth`, `decompress-request`, `parse-request`, `handle-request`
+/// (includes `serialize-response` of the JSON handlers), `compress-response`
+/// and `send-response` (wall time only, the response is sent by another
+/// task). The allocated bytes are counted only with jemalloc.
+///
+/// The responses are compressed with one of the encodings accepted by the
+/// client if the `response-compression` option of
+/// server::handlers::HandlerBase is set.
 ///
 /// ## Example usage:
 ///
@@ -82,6 +101,12 @@ class HttpHandlerBase : public HandlerBase {
 
   // For internal use only.
   HttpRequestStatistics& GetRequestStatistics() const;
+
+  // For internal use only, nullptr if the limit is not configured.
+  AdaptiveConcurrencyLimiter* GetConcurrencyLimiter() const;
+
+  // For internal use only, nullptr if `stage-statistics` is disabled.
+  HttpHandlerStageStatistics* GetStageStatistics() const;
   /// @endcond
 
   /// Override it if you need a custom logging level for messages about finish
@@ -185,6 +210,8 @@ class HttpHandlerBase : public HandlerBase {
 
   void SetResponseAcceptEncoding(http::HttpResponse& response) const;
   void SetResponseServerHostname(http::HttpResponse& response) const;
+  void CompressResponse(const http::HttpRequest& http_request,
+                        http::HttpResponse& response) const;
 
   const dynamic_config::Source config_source_;
   const std::vector<http::HttpMethod> allowed_methods_;
@@ -195,7 +222,12 @@ class HttpHandlerBase : public HandlerBase {
 
   std::unique_ptr<HttpHandlerStatistics> handler_statistics_;
   std::unique_ptr<HttpRequestStatistics> request_statistics_;
+  std::unique_ptr<HttpHandlerStageStatistics> stage_statistics_;
   std::vector<auth::AuthCheckerBasePtr> auth_checkers_;
+  std::unique_ptr<ResponseCompressor> response_compressor_;
+  std::unique_ptr<RequestCoalescer> request_coalescer_;
+  std::unique_ptr<AdaptiveConcurrencyLimiter> concurrency_limiter_;
+  std::unique_ptr<const http::StaticHeaders> static_response_headers_;
 
   std::optional<logging::Level> log_level_;
   bool set_response_server_hostname_;
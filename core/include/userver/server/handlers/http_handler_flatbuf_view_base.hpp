@@ -0,0 +1,235 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_flatbuf_view_base.hpp
+/// @brief @copybrief server::handlers::HttpHandlerFlatbufViewBase
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include <boost/lockfree/stack.hpp>
+#include <flatbuffers/flatbuffers.h>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/utils/log.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace impl {
+
+inline const std::string kFlatbufRequestViewDataName = "__request_flatbuf_view";
+
+/// Builders are reused by the requests, so that the response is built without
+/// allocations once a builder has grown to the usual response size. The pool
+/// holds a builder per concurrently processed request, up to a limit.
+class FlatbufBuilderPool final {
+ public:
+  class Lease;
+
+  FlatbufBuilderPool() = default;
+  FlatbufBuilderPool(const FlatbufBuilderPool&) = delete;
+  FlatbufBuilderPool& operator=(const FlatbufBuilderPool&) = delete;
+
+  ~FlatbufBuilderPool() {
+    builders_.consume_all([](flatbuffers::FlatBufferBuilder* builder) {
+      delete builder;
+    });
+  }
+
+  Lease Acquire();
+
+ private:
+  static constexpr std::size_t kMaxPooledBuilders = 64;
+  // Builders of the occasional huge responses are not kept
+  static constexpr std::size_t kMaxPooledBuilderSize = 1024 * 1024;
+
+  void Release(std::unique_ptr<flatbuffers::FlatBufferBuilder> builder) {
+    if (builder->GetSize() > kMaxPooledBuilderSize) return;
+    builder->Clear();
+    if (builders_.bounded_push(builder.get())) {
+      [[maybe_unused]] auto* ptr = builder.release();
+    }
+  }
+
+  boost::lockfree::stack<flatbuffers::FlatBufferBuilder*,
+                         boost::lockfree::capacity<kMaxPooledBuilders>>
+      builders_;
+};
+
+class FlatbufBuilderPool::Lease final {
+ public:
+  Lease(FlatbufBuilderPool& pool,
+        std::unique_ptr<flatbuffers::FlatBufferBuilder> builder)
+      : pool_(pool), builder_(std::move(builder)) {}
+
+  Lease(const Lease&) = delete;
+  Lease& operator=(const Lease&) = delete;
+
+  ~Lease() { pool_.Release(std::move(builder_)); }
+
+  flatbuffers::FlatBufferBuilder& operator*() const { return *builder_; }
+  flatbuffers::FlatBufferBuilder* operator->() const { return builder_.get(); }
+
+ private:
+  FlatbufBuilderPool& pool_;
+  std::unique_ptr<flatbuffers::FlatBufferBuilder> builder_;
+};
+
+inline FlatbufBuilderPool::Lease FlatbufBuilderPool::Acquire() {
+  flatbuffers::FlatBufferBuilder* builder = nullptr;
+  if (builders_.pop(builder)) {
+    return {*this, std::unique_ptr<flatbuffers::FlatBufferBuilder>(builder)};
+  }
+  return {*this, std::make_unique<flatbuffers::FlatBufferBuilder>()};
+}
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Base for handlers that accept requests with body in Flatbuffer
+/// format and respond with body in Flatbuffer format, without the object API.
+///
+/// Unlike server::handlers::HttpHandlerFlatbufBase the request body is not
+/// unpacked: the handler gets the verified root table that refers to the
+/// request body. The response is built directly in a
+/// flatbuffers::FlatBufferBuilder that is reused between the requests, the
+/// finished buffer is copied only once, into the response body.
+///
+/// ## Example usage:
+///
+/// @snippet samples/flatbuf_service/flatbuf_service.cpp Flatbuf service sample - view component
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerFlatbufViewBase : public HttpHandlerBase {
+  static_assert(std::is_base_of<flatbuffers::Table, InputType>::value,
+                "Input type should be auto-generated FlatBuffers table type");
+  static_assert(std::is_base_of<flatbuffers::Table, ReturnType>::value,
+                "Return type should be auto-generated FlatBuffers table type");
+
+ public:
+  HttpHandlerFlatbufViewBase(
+      const components::ComponentConfig& config,
+      const components::ComponentContext& component_context);
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext& context) const final;
+
+  /// @param input the verified root of the request body, valid until the
+  /// request is destroyed
+  /// @param builder an empty builder to build the response in, must not be
+  /// finished
+  /// @returns the root of the response built in `builder`
+  virtual flatbuffers::Offset<ReturnType> HandleRequestFlatbufThrow(
+      const http::HttpRequest& request, const InputType& input,
+      flatbuffers::FlatBufferBuilder& builder,
+      request::RequestContext& context) const = 0;
+
+  /// @returns A pointer to the root of the request body if it was verified
+  /// successfully or nullptr otherwise.
+  const InputType* GetInputData(const request::RequestContext& context) const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override it if you need a custom request body logging.
+  std::string GetRequestBodyForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& request_body) const override;
+
+  /// Override it if you need a custom response data logging.
+  std::string GetResponseDataForLogging(
+      const http::HttpRequest& request, request::RequestContext& context,
+      const std::string& response_data) const override;
+
+  void ParseRequestData(const http::HttpRequest& request,
+                        request::RequestContext& context) const final;
+
+ private:
+  mutable impl::FlatbufBuilderPool builders_;
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HttpHandlerFlatbufViewBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context) {}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto* input = context.GetData<const InputType*>(
+      impl::kFlatbufRequestViewDataName);
+
+  const auto builder = builders_.Acquire();
+  const auto root =
+      HandleRequestFlatbufThrow(request, *input, *builder, context);
+  builder->Finish(root);
+  return {reinterpret_cast<const char*>(builder->GetBufferPointer()),
+          builder->GetSize()};
+}
+
+template <typename InputType, typename ReturnType>
+const InputType*
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetInputData(
+    const request::RequestContext& context) const {
+  const auto* input = context.GetDataOptional<const InputType*>(
+      impl::kFlatbufRequestViewDataName);
+  return input ? *input : nullptr;
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetRequestBodyForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& request_body) const {
+  size_t limit = GetConfig().request_body_size_log_limit;
+  return utils::log::ToLimitedHex(request_body, limit);
+}
+
+template <typename InputType, typename ReturnType>
+std::string
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetResponseDataForLogging(
+    const http::HttpRequest&, request::RequestContext&,
+    const std::string& response_data) const {
+  size_t limit = GetConfig().response_data_size_log_limit;
+  return utils::log::ToLimitedHex(response_data, limit);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerFlatbufViewBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto& body = request.RequestBody();
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(body.data()),
+                                 body.size());
+  if (!verifier.VerifyBuffer<InputType>(nullptr)) {
+    throw ClientError(
+        InternalMessage{"Invalid FlatBuffers format in request body"});
+  }
+
+  // The body is not modified until the request is destroyed
+  context.SetData(impl::kFlatbufRequestViewDataName,
+                  flatbuffers::GetRoot<InputType>(body.data()));
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema
+HttpHandlerFlatbufViewBase<InputType, ReturnType>::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("HTTP handler flatbuf view base config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,21 @@ namespace server::handlers {
 /// @brief Convenient base for handlers that accept requests with body in
 /// JSON format and respond with body in JSON format.
 ///
+/// With `allow-msgpack` the handler also speaks MessagePack, see
+/// formats::msgpack: the request body with `Content-Type: application/msgpack`
+/// (or `application/x-msgpack`) is parsed from MessagePack, and the response
+/// is serialized to MessagePack if the `Accept` header of the request prefers
+/// `application/msgpack` to `application/json`. HandleRequestJsonThrow works
+/// with formats::json::Value in both cases.
+///
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the
+/// following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// allow-msgpack | accept and respond with MessagePack bodies on request | false
+///
 /// ## Example usage:
 ///
 /// @snippet samples/config_service/config_service.cpp Config service sample - component
@@ -55,6 +70,8 @@ class HttpHandlerJsonBase : public HttpHandlerBase {
  private:
   FormattedErrorData GetFormattedExternalErrorBody(
       const CustomHandlerException& exc) const final;
+
+  const bool allow_msgpack_;
 };
 
 }  // namespace server::handlers
@@ -19,6 +19,10 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// A single byte range of the `Range` header is served with HTTP 206. Files
+/// bigger than the `max-cached-file-size` of the components::FsCache are sent
+/// from the filesystem with sendfile() where the connection allows that.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
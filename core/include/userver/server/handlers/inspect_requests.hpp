@@ -28,6 +28,9 @@ namespace handlers {
 /// ## Scheme
 /// Provide an optional query parameter `body` to get the bodies of all the
 /// in-flight requests.
+///
+/// Only 1 in @ref USERVER_INSPECT_REQUESTS_SAMPLE_RATE requests is tracked
+/// and returned, set it to 0 to stop tracking the requests.
 
 // clang-format on
 class InspectRequests final : public HttpHandlerJsonBase {
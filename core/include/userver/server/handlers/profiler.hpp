@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/server/handlers/profiler.hpp
+/// @brief @copybrief server::handlers::Profiler
+
+#include <chrono>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that collects the CPU, heap and lock contention profiles of
+/// the service in the gzipped
+/// [pprof](https://github.com/google/pprof/blob/main/proto/profile.proto)
+/// format, for the continuous profilers and the `go tool pprof`.
+///
+/// The addresses are symbolized by the service and are also attributed to the
+/// loaded binaries, so the profiles could be re-symbolized with the debug
+/// info of the binaries.
+///
+/// Only one profile of each type is collected at a time, the concurrent
+/// requests get HTTP 409.
+///
+/// ## Static options:
+/// Aside from @ref userver_http_handlers "common handler options" component
+/// has the following options:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-duration | max value of the `seconds` argument | 60s
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler profiler component config
+///
+/// ## Scheme
+/// Set an URL path argument `type` to one of the following values:
+/// * `cpu` - to sample the stacks of the threads consuming CPU with
+///   `SIGPROF` for 30 or `seconds` seconds at 99 or `frequency` Hz. The
+///   samples taken while a task runs contain only the frames of the task
+///   coroutine. The handler of the signal stays installed after the first
+///   profile.
+/// * `heap` - to get the live allocations sampled by jemalloc, the jemalloc
+///   should be started with `MALLOC_CONF=prof:true`. If `seconds` is set, two
+///   profiles are dumped `seconds` apart, and the difference between them is
+///   returned.
+/// * `contention` - to record the stacks of the engine::Mutex locks that have
+///   waited, with the count of the waits and their total duration, for 30 or
+///   `seconds` seconds.
+///
+/// Example: `go tool pprof http://localhost:8085/service/profiler/cpu?seconds=10`
+
+// clang-format on
+
+class Profiler final : public HttpHandlerBase {
+ public:
+  Profiler(const components::ComponentConfig&,
+           const components::ComponentContext&);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::Profiler
+  static constexpr std::string_view kName = "handler-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest&,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::chrono::seconds max_duration_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::Profiler> =
+    true;
+
+USERVER_NAMESPACE_END
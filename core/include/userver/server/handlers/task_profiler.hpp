@@ -0,0 +1,78 @@
+#pragma once
+
+/// @file userver/server/handlers/task_profiler.hpp
+/// @brief @copybrief server::handlers::TaskProfiler
+
+#include <userver/server/handlers/http_handler_json_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+class Manager;
+}  // namespace components
+
+namespace server::handlers {
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the CPU time, context switches and queue wait
+/// time of the sampled tasks, aggregated by the name of their root span.
+///
+/// Only the task processors with the `task-profiler` option are reported, see
+/// components::ManagerControllerComponent.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @code
+/// handler-task-profiler:
+///     path: /service/profile/tasks
+///     method: GET,DELETE
+///     task_processor: monitor-task-processor
+/// @endcode
+///
+/// ## Scheme
+/// `GET` returns an object with a key per task processor and an array of
+/// records sorted by the CPU time in descending order:
+/// @code
+/// {"main-task-processor": [{"span_name": "handler-ping", "tasks": 12,
+///   "cpu-time-us": 1400, "context-switches": 3, "queue-wait-us": 210}]}
+/// @endcode
+///
+/// Provide an optional query parameter `limit` to get only the top records of
+/// each task processor.
+///
+/// `DELETE` resets the statistics reported by `GET`. The task profiler metrics
+/// are not affected and keep growing.
+
+// clang-format on
+class TaskProfiler final : public HttpHandlerJsonBase {
+ public:
+  TaskProfiler(const components::ComponentConfig& config,
+               const components::ComponentContext& component_context);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::TaskProfiler
+  static constexpr std::string_view kName = "handler-task-profiler";
+
+  formats::json::Value HandleRequestJsonThrow(
+      const http::HttpRequest& request,
+      const formats::json::Value& request_json,
+      request::RequestContext& context) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const components::Manager& manager_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::TaskProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
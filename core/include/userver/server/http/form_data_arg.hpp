@@ -18,11 +18,16 @@ struct FormDataArg {
   std::optional<std::string> filename;
   std::optional<std::string> default_charset;
   std::optional<std::string_view> content_type;
+  /// Path to the temporary file with the value if the file parts of the
+  /// request are written to disk, see the `multipart-spool-dir` option of
+  /// server::handlers::HandlerBase. The `value` is empty then and the file is
+  /// removed with the request.
+  std::optional<std::string> file_path;
 
   bool operator==(const FormDataArg& r) const {
     return value == r.value && content_disposition == r.content_disposition &&
            filename == r.filename && default_charset == r.default_charset &&
-           content_type == r.content_type;
+           content_type == r.content_type && file_path == r.file_path;
   }
 
   std::string Charset() const;
@@ -6,6 +6,7 @@
 #include <chrono>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -190,6 +191,11 @@ class HttpRequest final {
   /// @return HTTP body.
   const std::string& RequestBody() const;
 
+  /// @return HTTP body as a sequence of chunks. Unlike RequestBody() does not
+  /// copy the body that refers to the connection receive buffers, see
+  /// `connection.zero_copy_body` of components::Server.
+  std::vector<std::string_view> GetRequestBodyChunks() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
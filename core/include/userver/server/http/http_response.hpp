@@ -4,11 +4,16 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/http/content_type.hpp>
 #include <userver/http/header_map.hpp>
 #include <userver/server/http/http_response_cookie.hpp>
@@ -27,9 +32,15 @@ namespace impl {
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header,
                   std::string_view key, std::string_view val);
 
+void CheckHeaderName(std::string_view name);
+
+void CheckHeaderValue(std::string_view value);
+
 }  // namespace impl
 
 class HttpRequestImpl;
+class Http2Session;
+class StaticHeaders;
 
 /// @brief HTTP Response data
 class HttpResponse final : public request::ResponseBase {
@@ -119,6 +130,12 @@ class HttpResponse final : public request::ResponseBase {
   /// @cond
   // TODO: server internals. remove from public interface
   void SendResponse(engine::io::RwBase& socket) override;
+
+  // Headers of the handler that are sent unless the response sets them,
+  // must outlive the response
+  void SetStaticHeaders(const StaticHeaders* headers) {
+    static_headers_ = headers;
+  }
   /// @endcond
 
   void SetStatusServiceUnavailable() override {
@@ -137,12 +154,36 @@ class HttpResponse final : public request::ResponseBase {
   // Can be called only once
   Queue::Producer GetBodyProducer();
 
+  /// @brief Sends `size` bytes of the `file` starting from `offset` as the
+  /// body instead of the data.
+  ///
+  /// Plain TCP connections send the file with sendfile() without loading it
+  /// into memory, other connections read it in chunks. The blocking file
+  /// operations are done on the `fs_task_processor`.
+  void SetFileBody(std::shared_ptr<const fs::blocking::FileDescriptor> file,
+                   std::uint64_t offset, std::uint64_t size,
+                   engine::TaskProcessor& fs_task_processor);
+
+  /// @return true if the body was set by SetFileBody()
+  bool IsFileBody() const { return file_body_.has_value(); }
+
  private:
+  // Writes the response in HTTP/2 framing
+  friend class Http2Session;
+
   // Returns total size of the response
   std::size_t SetBodyStreamed(
       engine::io::RwBase& socket,
       USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+  // Returns total size of the response
+  std::size_t SetBodyFile(
+      engine::io::RwBase& socket,
+      USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+  // Replaces the file body with the data read from the file
+  void LoadFileBody();
+
   // Returns total size of the response
   std::size_t SetBodyNotStreamed(
       engine::io::RwBase& socket,
@@ -156,6 +197,15 @@ class HttpResponse final : public request::ResponseBase {
   engine::SingleConsumerEvent headers_end_;
   std::optional<Queue::Consumer> body_stream_;
   std::optional<Queue::Producer> body_stream_producer_;
+  const StaticHeaders* static_headers_{nullptr};
+
+  struct FileBody {
+    std::shared_ptr<const fs::blocking::FileDescriptor> file;
+    std::uint64_t offset;
+    std::uint64_t size;
+    engine::TaskProcessor* fs_task_processor;
+  };
+  std::optional<FileBody> file_body_;
 };
 
 void SetThrottleReason(http::HttpResponse& http_response,
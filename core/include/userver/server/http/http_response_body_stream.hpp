@@ -1,12 +1,18 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/response_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace compression {
+class StreamCompressor;
+}
+
 namespace server::handlers {
 class HttpHandlerBase;
 }
@@ -15,7 +21,8 @@ namespace server::http {
 
 class ResponseBodyStream final {
  public:
-  ResponseBodyStream(ResponseBodyStream&&) = default;
+  ResponseBodyStream(ResponseBodyStream&&) noexcept;
+  ~ResponseBodyStream();
 
   // Send a chunk of response data. It may NOT generate
   // exactly one HTTP chunk per call to PushBodyChunk().
@@ -38,9 +45,15 @@ class ResponseBodyStream final {
       server::http::HttpResponse::Queue::Producer&& queue_producer,
       server::http::HttpResponse& http_response);
 
+  void SetCompressor(std::unique_ptr<compression::StreamCompressor> compressor,
+                     engine::TaskProcessor* task_processor);
+  std::string Compress(std::string_view chunk, bool is_last);
+
   bool headers_ended_{false};
   HttpResponse::Queue::Producer queue_producer_;
   server::http::HttpResponse& http_response_;
+  std::unique_ptr<compression::StreamCompressor> compressor_;
+  engine::TaskProcessor* compression_task_processor_{nullptr};
 };
 
 }  // namespace server::http
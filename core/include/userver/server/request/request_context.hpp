@@ -3,6 +3,7 @@
 /// @file userver/server/request/request_context.hpp
 /// @brief @copybrief server::request::RequestContext
 
+#include <memory_resource>
 #include <string>
 
 #include <userver/compiler/select.hpp>
@@ -11,12 +12,21 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace utils {
+class Arena;
+}  // namespace utils
+
 namespace server::request {
 
 /// @brief Stores request-specific data during request processing.
 ///
 /// For example: you can store some data in `HandleRequestThrow()` method
 /// and access this data in `GetResponseDataForLogging()` method.
+///
+/// The data that lives no longer than the request may be allocated from
+/// GetArena() or GetMemoryResource(): the allocations are pointer increments
+/// and all the memory is given back at once when the request is done, even if
+/// that happens on another thread.
 class RequestContext final {
  public:
   RequestContext();
@@ -100,14 +110,24 @@ class RequestContext final {
   /// @brief Erase data with specified name.
   void EraseData(const std::string& name);
 
+  /// @brief Returns the arena of the request, that is created on the first
+  /// call and is destroyed after all the stored data.
+  ///
+  /// The memory of the arena must not be used after the request is processed.
+  utils::Arena& GetArena();
+
+  /// @brief Returns the std::pmr adapter of GetArena() for use with the
+  /// std::pmr containers.
+  std::pmr::memory_resource& GetMemoryResource();
+
  private:
   class Impl;
 
   static constexpr std::size_t kPimplSize = compiler::SelectSize()  //
-                                                .ForLibCpp32(24)
-                                                .ForLibCpp64(48)
-                                                .ForLibStdCpp64(64)
-                                                .ForLibStdCpp32(32);
+                                                .ForLibCpp32(28)
+                                                .ForLibCpp64(56)
+                                                .ForLibStdCpp64(72)
+                                                .ForLibStdCpp32(36);
 
   utils::AnyMovable& SetUserAnyData(utils::AnyMovable&& data);
   utils::AnyMovable& GetUserAnyData();
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -48,6 +49,10 @@ class WebSocketConnectionImpl;
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
+
+  bool deflate_enabled = false;  // permessage-deflate negotiation
+  int deflate_level = 6;
+  unsigned deflate_threshold = 128;  // smaller messages are not compressed
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
@@ -59,6 +64,42 @@ struct Statistics final {
   std::atomic<int64_t> bytes_recv{0};
 };
 
+namespace impl {
+struct PreparedFrames;
+}  // namespace impl
+
+/// @brief A message that is framed (and optionally compressed) once and sent
+/// to many connections with WebSocketConnection::SendPrepared.
+///
+/// The frames are immutable and shared between the copies, so copying a
+/// PreparedMessage is cheap. The message is sent as a single frame
+/// regardless of the `fragment-size` of the connections.
+///
+/// @snippet server/websocket/deflate_test.cpp  Sample websocket broadcast
+class PreparedMessage final {
+ public:
+  /// @param data payload
+  /// @param is_text is it text or binary?
+  /// @param compress also prepare a permessage-deflate variant of the frame
+  /// for the connections that negotiated the extension
+  PreparedMessage(std::string_view data, bool is_text, bool compress = true);
+
+  ~PreparedMessage();
+
+  PreparedMessage(const PreparedMessage&) noexcept;
+  PreparedMessage(PreparedMessage&&) noexcept;
+  PreparedMessage& operator=(const PreparedMessage&) noexcept;
+  PreparedMessage& operator=(PreparedMessage&&) noexcept;
+
+  /// @returns payload size
+  std::size_t GetPayloadSize() const noexcept;
+
+ private:
+  friend class WebSocketConnectionImpl;
+
+  std::shared_ptr<const impl::PreparedFrames> frames_;
+};
+
 /// @brief Main class for Websocket connection
 class WebSocketConnection {
  public:
@@ -91,6 +132,15 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send a prepared message to websocket without framing or
+  /// compressing it again.
+  ///
+  /// Writes to the socket directly, so a slow peer blocks the sending
+  /// coroutine. Send to many connections from separate coroutines.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Same thread-safety as Send().
+  virtual void SendPrepared(const PreparedMessage& message) = 0;
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
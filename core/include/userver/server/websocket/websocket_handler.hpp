@@ -28,6 +28,9 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// deflate | accept the permessage-deflate extension offered by clients | false
+/// deflate-level | zlib compression level of the outgoing messages | 6
+/// deflate-threshold | outgoing messages smaller than this are not compressed | 128
 ///
 /// ## Example usage:
 ///
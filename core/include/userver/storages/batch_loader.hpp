@@ -0,0 +1,211 @@
+#pragma once
+
+/// @file userver/storages/batch_loader.hpp
+/// @brief @copybrief storages::BatchLoader
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/lazy_prvalue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Gathers the keys requested by concurrent tasks into batches and
+/// loads each batch with a single call of a user-provided bulk loader.
+///
+/// A batch is loaded once it has `max_batch_size` distinct keys or once
+/// `max_delay` has passed since its first key, whatever comes first. The
+/// loader runs in a separate critical task that does not inherit the
+/// deadline or the variables of the task that started the batch, so a single
+/// cancelled request does not fail the whole batch.
+///
+/// Typical bulk loaders are `SELECT ... WHERE id = ANY($1)` queries, `$in`
+/// queries or batch HTTP endpoints.
+///
+/// ## Usage synopsis
+/// @snippet storages/batch_loader_test.cpp  Sample
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class BatchLoader final {
+ public:
+  using Values = std::unordered_map<Key, Value, Hash>;
+
+  /// Returns the found values of the unique `keys`. The absent keys are
+  /// reported as std::nullopt by Load().
+  using BulkLoader = std::function<Values(const std::vector<Key>& keys)>;
+
+  struct Settings final {
+    /// Max time a key waits for the other keys of the batch
+    std::chrono::microseconds max_delay{500};
+
+    /// Max count of distinct keys in a batch
+    std::size_t max_batch_size{100};
+  };
+
+  /// Loads the batches in the engine::TaskProcessor of the caller
+  BatchLoader(Settings settings, BulkLoader loader);
+
+  BatchLoader(Settings settings, BulkLoader loader,
+              engine::TaskProcessor& task_processor);
+
+  BatchLoader(const BatchLoader&) = delete;
+  BatchLoader& operator=(const BatchLoader&) = delete;
+
+  /// Cancels and waits for the batches being loaded
+  ~BatchLoader();
+
+  /// @brief Waits for the batch with the `key` to load and returns the value
+  /// of the key, std::nullopt if the loader has not returned it.
+  /// @throws anything the loader throws for the batch
+  /// @throws engine::WaitInterruptedException if the current task is
+  /// cancelled
+  std::optional<Value> Load(const Key& key);
+
+ private:
+  struct Batch final {
+    std::vector<Key> keys;
+    std::unordered_set<Key, Hash> unique_keys;
+    engine::SingleConsumerEvent full_event;
+
+    engine::Mutex mutex;
+    engine::ConditionVariable cv;
+    bool is_loaded{false};
+    Values values;
+    std::exception_ptr exception;
+  };
+
+  std::shared_ptr<Batch> AddKey(const Key& key);
+
+  void LoadBatch(const std::shared_ptr<Batch>& batch);
+
+  const Settings settings_;
+  const BulkLoader loader_;
+  engine::TaskProcessor& task_processor_;
+
+  engine::Mutex mutex_;
+  // The batch that accepts new keys
+  std::shared_ptr<Batch> current_;
+
+  // Must be the last member, the tasks refer to the other members
+  concurrent::BackgroundTaskStorageCore tasks_;
+};
+
+template <typename Key, typename Value, typename Hash>
+BatchLoader<Key, Value, Hash>::BatchLoader(Settings settings,
+                                           BulkLoader loader)
+    : BatchLoader(settings, std::move(loader),
+                  engine::current_task::GetTaskProcessor()) {}
+
+template <typename Key, typename Value, typename Hash>
+BatchLoader<Key, Value, Hash>::BatchLoader(
+    Settings settings, BulkLoader loader,
+    engine::TaskProcessor& task_processor)
+    : settings_(settings),
+      loader_(std::move(loader)),
+      task_processor_(task_processor) {
+  UASSERT(loader_);
+  UASSERT(settings_.max_batch_size > 0);
+}
+
+template <typename Key, typename Value, typename Hash>
+BatchLoader<Key, Value, Hash>::~BatchLoader() {
+  tasks_.CancelAndWait();
+}
+
+template <typename Key, typename Value, typename Hash>
+std::optional<Value> BatchLoader<Key, Value, Hash>::Load(const Key& key) {
+  const auto batch = AddKey(key);
+
+  {
+    std::unique_lock lock(batch->mutex);
+    if (!batch->cv.Wait(lock, [&batch] { return batch->is_loaded; })) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+  }
+
+  // The batch is not modified after it is loaded
+  if (batch->exception) std::rethrow_exception(batch->exception);
+  const auto it = batch->values.find(key);
+  if (it == batch->values.end()) return std::nullopt;
+  return it->second;
+}
+
+template <typename Key, typename Value, typename Hash>
+auto BatchLoader<Key, Value, Hash>::AddKey(const Key& key)
+    -> std::shared_ptr<Batch> {
+  const std::lock_guard lock(mutex_);
+  if (!current_) {
+    current_ = std::make_shared<Batch>();
+    // Critical, so that the waiters are always notified
+    tasks_.Detach(engine::CriticalAsyncNoSpan(
+        task_processor_,
+        utils::LazyPrvalue([] {
+          return utils::impl::SpanWrapCall(
+              "batch_loader",
+              utils::impl::SpanWrapCall::InheritVariables::kNo);
+        }),
+        [this, batch = current_] { LoadBatch(batch); }));
+  }
+
+  auto batch = current_;
+  if (batch->unique_keys.insert(key).second) {
+    batch->keys.push_back(key);
+    if (batch->keys.size() >= settings_.max_batch_size) {
+      current_.reset();
+      batch->full_event.Send();
+    }
+  }
+  return batch;
+}
+
+template <typename Key, typename Value, typename Hash>
+void BatchLoader<Key, Value, Hash>::LoadBatch(
+    const std::shared_ptr<Batch>& batch) {
+  [[maybe_unused]] const bool is_full =
+      batch->full_event.WaitForEventFor(settings_.max_delay);
+  {
+    const std::lock_guard lock(mutex_);
+    if (current_ == batch) current_.reset();
+  }
+
+  // No keys are added to the batch from now on
+  try {
+    batch->values = loader_(batch->keys);
+  } catch (...) {
+    batch->exception = std::current_exception();
+  }
+
+  {
+    const std::lock_guard lock(batch->mutex);
+    batch->is_loaded = true;
+  }
+  batch->cv.NotifyAll();
+}
+
+}  // namespace storages
+
+USERVER_NAMESPACE_END
@@ -3,8 +3,12 @@
 /// @file userver/tracing/manager.hpp
 /// @brief @copybrief tracing::TracingManagerBase
 
+#include <memory>
+#include <string_view>
+
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/response.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/span_builder.hpp>
 #include <userver/utils/flags.hpp>
@@ -43,6 +47,12 @@ class TracingManagerBase {
   /// Fill response with tracing information
   virtual void FillResponseWithTracingContext(
       const Span& span, server::http::HttpResponse& response) const = 0;
+
+  /// Decides whether the new trace started by a request to the handler is
+  /// sampled. Not called for the requests that continue the traces of the
+  /// callers, the decision of the caller is used for them.
+  /// @see tracing::Sampler
+  virtual bool ShouldSampleNewTrace(std::string_view handler_name) const;
 };
 
 // clang-format off
@@ -95,8 +105,11 @@ class GenericTracingManager final : public TracingManagerBase {
   GenericTracingManager() = delete;
 
   GenericTracingManager(utils::Flags<Format> in_request_response,
-                        utils::Flags<Format> new_request)
-      : in_request_response_{in_request_response}, new_request_{new_request} {}
+                        utils::Flags<Format> new_request,
+                        std::shared_ptr<Sampler> sampler = {})
+      : in_request_response_{in_request_response},
+        new_request_{new_request},
+        sampler_{std::move(sampler)} {}
 
   bool TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request,
                                      SpanBuilder& span_builder) const override;
@@ -108,9 +121,12 @@ class GenericTracingManager final : public TracingManagerBase {
   void FillResponseWithTracingContext(
       const Span& span, server::http::HttpResponse& response) const override;
 
+  bool ShouldSampleNewTrace(std::string_view handler_name) const override;
+
  private:
   const utils::Flags<Format> in_request_response_;
   const utils::Flags<Format> new_request_;
+  const std::shared_ptr<Sampler> sampler_;
 };
 
 }  // namespace tracing
@@ -49,6 +49,23 @@ class TracingManagerComponentBase : public components::LoggableComponentBase,
 /// component-name | name of the component, that implements TracingManagerComponentBase | <use tracing::GenericTracingManager with below settings>
 /// incoming-format | Array of incoming tracing formats supported by tracing::FormatFromString | ['taxi']
 /// new-requests-format | Send tracing data in those formats supported by tracing::FormatFromString | ['taxi']
+/// sampling.probability | probability of sampling a new trace started by a handler | 1
+/// sampling.max-traces-per-second | max count of the new traces sampled per second by the handlers without their own rules | unlimited
+/// sampling.endpoints | dictionary of the handler names and their own `probability` and `max-traces-per-second` | {}
+///
+/// The sampling applies only to the requests that do not continue the traces
+/// of the callers, see tracing::EndpointSampler. The logs of the not sampled
+/// spans are skipped according to the `not-sampled-log-level` of the
+/// @ref USERVER_LOG_LIMITS dynamic config:
+/// @code
+/// # yaml
+/// sampling:
+///     probability: 0.01
+///     max-traces-per-second: 100
+///     endpoints:
+///         handler-ping:
+///             probability: 0
+/// @endcode
 ///
 // clang-format on
 class DefaultTracingManagerLocator final
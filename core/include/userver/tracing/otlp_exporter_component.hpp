@@ -0,0 +1,104 @@
+#pragma once
+
+/// @file userver/tracing/otlp_exporter_component.hpp
+/// @brief @copybrief components::OtlpSpanExporter
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief Interface of the tail-based sampling decisions for
+/// components::OtlpSpanExporter
+class TailSampler {
+ public:
+  virtual ~TailSampler();
+
+  /// Receives the spans of a single trace that were collected for the same
+  /// batch, returns whether these spans should be exported. Called from the
+  /// background task of the exporter.
+  virtual bool ShouldExport(utils::span<const FinishedSpan> trace_spans) = 0;
+};
+
+namespace impl {
+class OtlpExporter;
+}  // namespace impl
+
+}  // namespace tracing
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that sends the finished spans to an OpenTelemetry
+/// collector in OTLP/HTTP protobuf format, without writing and parsing the
+/// span logs.
+///
+/// The spans are put into a bounded in-memory queue by the destructors of the
+/// spans, the spans are dropped if the queue is full. A background task sends
+/// the spans in batches of at most `max-batch-size` spans, at least once per
+/// `export-interval`. The requests of the exporter itself are not exported.
+///
+/// A tracing::TailSampler could be set via SetTailSampler to decide which of
+/// the traces of a batch are exported.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URL of the OTLP/HTTP traces handler of the collector, e.g. 'http://localhost:4318/v1/traces' | -
+/// service-name | the service name to put into the `service.name` resource attribute | -
+/// http-client | name of the components::HttpClient to send the spans with | 'http-client'
+/// max-queue-size | max count of the spans waiting for the export | 65536
+/// max-batch-size | max count of the spans in a single request | 512
+/// export-interval | max time the spans wait in the queue | 1s
+/// timeout | timeout of the export request | 5s
+/// log-spans | whether the spans are also written to the default logger | false
+///
+/// ## Static configuration example:
+///
+/// ```
+/// # yaml
+/// otlp-span-exporter:
+///     endpoint: http://localhost:4318/v1/traces
+///     service-name: my-service
+///     max-batch-size: 1024
+/// ```
+
+// clang-format on
+class OtlpSpanExporter final : public LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::OtlpSpanExporter
+  static constexpr std::string_view kName = "otlp-span-exporter";
+
+  OtlpSpanExporter(const ComponentConfig& config,
+                   const ComponentContext& context);
+  ~OtlpSpanExporter() override;
+
+  /// Sets the sampler for the following batches, nullptr disables the tail
+  /// sampling
+  void SetTailSampler(std::shared_ptr<tracing::TailSampler> sampler);
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<tracing::impl::OtlpExporter> exporter_;
+  engine::TaskWithResult<void> task_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<OtlpSpanExporter> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
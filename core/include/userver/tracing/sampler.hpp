@@ -0,0 +1,76 @@
+#pragma once
+
+/// @file userver/tracing/sampler.hpp
+/// @brief @copybrief tracing::Sampler
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/token_bucket.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief Interface of the sampling decisions for the new traces started by
+/// the incoming requests.
+///
+/// The decision is stored in tracing::Span::IsSampled, inherited by the child
+/// spans and propagated to the outgoing requests by the tracing headers that
+/// support it.
+class Sampler {
+ public:
+  virtual ~Sampler();
+
+  /// Returns whether the new trace started by the request to the `endpoint`
+  /// is sampled. `endpoint` is the name of the handler component.
+  virtual bool ShouldSample(std::string_view endpoint) noexcept = 0;
+};
+
+/// @brief Sampling settings of tracing::EndpointSampler
+struct SamplingRule final {
+  /// Probability of sampling a new trace
+  double probability{1.0};
+
+  /// Max count of the new traces sampled per second, unlimited if not set
+  std::optional<std::size_t> max_traces_per_second;
+};
+
+SamplingRule Parse(const yaml_config::YamlConfig& value,
+                   formats::parse::To<SamplingRule>);
+
+/// @brief Probabilistic and rate-limited sampler with settings per handler.
+///
+/// The endpoints without their own rule share the rate limit of the default
+/// rule.
+class EndpointSampler final : public Sampler {
+ public:
+  EndpointSampler(const SamplingRule& default_rule,
+                  const utils::impl::TransparentMap<std::string, SamplingRule>&
+                      endpoint_rules);
+  ~EndpointSampler() override;
+
+  bool ShouldSample(std::string_view endpoint) noexcept override;
+
+ private:
+  struct Limiter final {
+    explicit Limiter(const SamplingRule& rule);
+
+    bool ShouldSample() noexcept;
+
+    const double probability;
+    std::optional<utils::TokenBucket> bucket;
+  };
+
+  Limiter default_limiter_;
+  utils::impl::TransparentMap<std::string, Limiter> endpoint_limiters_;
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
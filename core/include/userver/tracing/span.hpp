@@ -150,6 +150,17 @@ class Span final {
   /// it is set and greater than the main log level of the Span.
   std::optional<logging::Level> GetLocalLogLevel() const;
 
+  /// @brief Sets the head-based sampling decision of the trace, received
+  /// from the upstream in the tracing headers. The decision is inherited by
+  /// the child spans.
+  ///
+  /// The logs of the spans that are not sampled may be skipped, see
+  /// @ref USERVER_LOG_LIMITS.
+  void SetSampled(bool sampled) noexcept;
+
+  /// @returns false if the trace was sampled out by the upstream
+  bool IsSampled() const noexcept;
+
   /// Set link - a request ID within a service. Can be called only once.
   ///
   /// Propagates within a single service, but not from client to server. A new
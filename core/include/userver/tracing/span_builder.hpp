@@ -26,6 +26,7 @@ class SpanBuilder final {
   void SetParentLink(std::string parent_link);
   void AddTagFrozen(std::string key, logging::LogExtra::Value value);
   void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
+  void SetSampled(bool sampled) noexcept;
   Span Build() &&;
 
  private:
@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/tracing/span_exporter.hpp
+/// @brief @copybrief tracing::SpanExporter
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/logging/log_extra.hpp>
+#include <userver/tracing/tracer_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief The data of a finished tracing::Span passed to tracing::SpanExporter
+struct FinishedSpan final {
+  std::string name;
+  std::string trace_id;
+  std::string span_id;
+  std::string parent_id;
+  ReferenceType reference_type{ReferenceType::kChild};
+  std::chrono::system_clock::time_point start_time;
+  std::chrono::nanoseconds duration{0};
+  std::vector<std::pair<std::string, logging::LogExtra::Value>> attributes;
+};
+
+/// @brief Interface of the exporters that receive the finished spans directly,
+/// without formatting and parsing the span logs.
+///
+/// Set globally via tracing::Tracer::SetSpanExporter. Only the sampled spans
+/// that are not in the `USERVER_NO_LOG_SPANS` are exported, the log level of
+/// the span does not matter.
+class SpanExporter {
+ public:
+  virtual ~SpanExporter();
+
+  /// Called from the destructor of each span, must not block.
+  virtual void Export(FinishedSpan&& span) noexcept = 0;
+
+  /// Whether the spans are also written to the default logger.
+  virtual bool IsSpanLoggingEnabled() const noexcept { return true; }
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,7 @@ class TagWriter;
 namespace tracing {
 
 struct NoLogSpans;
+class SpanExporter;
 
 class Tracer : public std::enable_shared_from_this<Tracer> {
  public:
@@ -26,6 +27,11 @@ class Tracer : public std::enable_shared_from_this<Tracer> {
 
   static TracerPtr GetTracer();
 
+  /// Sets the exporter of the finished spans, nullptr disables the export
+  static void SetSpanExporter(std::shared_ptr<SpanExporter> exporter);
+
+  static std::shared_ptr<SpanExporter> GetSpanExporter();
+
   const std::string& GetServiceName() const;
 
   Span CreateSpanWithoutParent(std::string name);
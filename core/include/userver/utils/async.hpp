@@ -80,6 +80,31 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task with the scheduling priority, execution of
+/// function is guaranteed to start regardless of engine::TaskProcessor load
+/// limits.
+///
+/// The priority only matters for task processors with `task-priorities`
+/// configured, see engine::Task::Priority.
+///
+/// @param tasks_processor Task processor to run on
+/// @param name Name for the tracing::Span to use with this task
+/// @param priority Scheduling priority of the task
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto CriticalAsync(engine::TaskProcessor& task_processor,
+                                 std::string name,
+                                 engine::Task::Priority priority, Function&& f,
+                                 Args&&... args) {
+  return engine::CriticalAsyncNoSpan(
+      task_processor, priority, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task, execution of function is guaranteed to start
@@ -180,6 +205,34 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// Starts an asynchronous task with the scheduling priority, task execution
+/// may be cancelled before the function starts execution in case of
+/// TaskProcessor overload.
+///
+/// The priority only matters for task processors with `task-priorities`
+/// configured, see engine::Task::Priority.
+///
+/// By default, arguments are copied or moved inside the resulting
+/// `TaskWithResult`, like `std::thread` does. To pass an argument by reference,
+/// wrap it in `std::ref / std::cref` or capture the arguments using a lambda.
+///
+/// @param tasks_processor Task processor to run on
+/// @param name Name of the task to show in logs
+/// @param priority Scheduling priority of the task
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
+                         std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return engine::AsyncNoSpan(
+      task_processor, priority, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 /// @ingroup userver_concurrency
 ///
 /// Starts an asynchronous task with deadline, task execution may be cancelled
@@ -0,0 +1,315 @@
+#pragma once
+
+/// @file userver/utils/async_many.hpp
+/// @brief @copybrief utils::AsyncMany
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future_status.hpp>
+#include <userver/engine/impl/task_local_storage.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl {
+
+// State shared by the tasks of a utils::TaskBatch. The tasks report into a
+// single counter instead of being waited for one by one.
+class TaskBatchStateBase {
+ public:
+  TaskBatchStateBase(std::string&& name, std::size_t size);
+
+  TaskBatchStateBase(const TaskBatchStateBase&) = delete;
+  TaskBatchStateBase& operator=(const TaskBatchStateBase&) = delete;
+
+  // Cancels the unfinished tasks and waits for all of them
+  virtual ~TaskBatchStateBase();
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+  bool IsReady() const noexcept;
+
+  void RequestCancel();
+
+  engine::FutureStatus WaitUntil(engine::Deadline deadline);
+
+  // Throws engine::WaitInterruptedException if the caller is cancelled
+  void Wait();
+
+  // Rethrows the first exception of the tasks, if any
+  void RethrowIfFailed();
+
+  // Called by each task exactly once
+  void OnTaskCompleted(std::exception_ptr exception) noexcept;
+  void OnTaskCancelled() noexcept;
+
+ protected:
+  // Called in the task before the function
+  void BeforeInvoke();
+
+  void AddTask(engine::TaskWithResult<void>&& task);
+
+  // Accounts for the tasks that failed to start
+  void OnTasksNotStarted(std::size_t count) noexcept;
+
+ private:
+  const std::size_t size_;
+  tracing::Span span_;
+  engine::impl::task_local::Storage storage_;
+  std::vector<engine::TaskWithResult<void>> tasks_;
+
+  std::atomic<std::size_t> remaining_;
+  std::atomic<bool> has_exception_{false};
+  std::atomic<bool> is_failed_{false};
+  std::exception_ptr exception_;
+  engine::SingleConsumerEvent event_;
+};
+
+// Reports the task as cancelled if it was destroyed without running, e.g.
+// cancelled before the start
+class TaskBatchCompletion final {
+ public:
+  explicit TaskBatchCompletion(TaskBatchStateBase& state) noexcept
+      : state_(&state) {}
+
+  TaskBatchCompletion(TaskBatchCompletion&& other) noexcept
+      : state_(std::exchange(other.state_, nullptr)) {}
+
+  TaskBatchCompletion& operator=(TaskBatchCompletion&&) = delete;
+
+  ~TaskBatchCompletion() { Cancel(); }
+
+  void Complete(std::exception_ptr exception) noexcept {
+    if (state_) {
+      std::exchange(state_, nullptr)->OnTaskCompleted(std::move(exception));
+    }
+  }
+
+  void Cancel() noexcept {
+    if (state_) std::exchange(state_, nullptr)->OnTaskCancelled();
+  }
+
+ private:
+  TaskBatchStateBase* state_;
+};
+
+// Results of the tasks, independent of the function type
+template <typename Result>
+class TaskBatchResults : public TaskBatchStateBase {
+ public:
+  TaskBatchResults(std::string&& name, std::size_t size)
+      : TaskBatchStateBase(std::move(name), size), values_(size) {}
+
+  std::vector<Result> TakeResults() {
+    std::vector<Result> results;
+    results.reserve(values_.size());
+    for (auto& value : values_) results.push_back(std::move(*value));
+    return results;
+  }
+
+ protected:
+  template <typename Function>
+  void Invoke(Function& function, std::size_t index) {
+    values_[index].emplace(function(index));
+  }
+
+ private:
+  std::vector<std::optional<Result>> values_;
+};
+
+template <>
+class TaskBatchResults<void> : public TaskBatchStateBase {
+ public:
+  using TaskBatchStateBase::TaskBatchStateBase;
+
+  void TakeResults() noexcept {}
+
+ protected:
+  template <typename Function>
+  void Invoke(Function& function, std::size_t index) {
+    function(index);
+  }
+};
+
+template <typename Result, typename Function>
+class TaskBatchState final : public TaskBatchResults<Result> {
+ public:
+  TaskBatchState(std::string&& name, std::size_t size, Function&& function)
+      : TaskBatchResults<Result>(std::move(name), size),
+        function_(std::forward<Function>(function)) {}
+
+  void Start(engine::TaskProcessor& task_processor) {
+    const auto size = this->GetSize();
+    std::size_t started = 0;
+    try {
+      for (; started < size; ++started) {
+        this->AddTask(engine::AsyncNoSpan(
+            task_processor,
+            [this, index = started,
+             completion = TaskBatchCompletion{*this}]() mutable {
+              Run(index, completion);
+            }));
+      }
+    } catch (...) {
+      // The completion of the failed task has already reported it
+      this->OnTasksNotStarted(size - started - 1);
+      throw;
+    }
+  }
+
+ private:
+  void Run(std::size_t index, TaskBatchCompletion& completion) {
+    // Reports the task as cancelled if it is unwound by a cancellation point
+    const utils::FastScopeGuard cancel_guard(
+        [&completion]() noexcept { completion.Cancel(); });
+
+    try {
+      this->BeforeInvoke();
+      this->Invoke(function_, index);
+    } catch (const std::exception&) {
+      completion.Complete(std::current_exception());
+      return;
+    }
+    completion.Complete({});
+  }
+
+  std::decay_t<Function> function_;
+};
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Tasks started by utils::AsyncMany, waited for as a whole.
+///
+/// If the TaskBatch is still valid on destruction, the unfinished tasks are
+/// cancelled and waited for.
+template <typename Result>
+class [[nodiscard]] TaskBatch final {
+ public:
+  /// @brief Creates an invalid batch
+  TaskBatch() = default;
+
+  TaskBatch(TaskBatch&&) noexcept = default;
+  TaskBatch& operator=(TaskBatch&&) noexcept = default;
+
+  /// @returns whether the batch holds the tasks
+  bool IsValid() const noexcept { return state_ != nullptr; }
+
+  /// @returns count of the tasks in the batch
+  std::size_t Size() const noexcept { return state_ ? state_->GetSize() : 0; }
+
+  /// @returns whether all the tasks finished or any of them failed
+  bool IsReady() const noexcept { return state_ && state_->IsReady(); }
+
+  /// @brief Requests cancellation of all the tasks
+  void RequestCancel() {
+    UASSERT(IsValid());
+    state_->RequestCancel();
+  }
+
+  /// @brief Waits until all the tasks finish or any of them fails
+  /// @throws engine::WaitInterruptedException if the caller is cancelled
+  void Wait() {
+    UASSERT(IsValid());
+    state_->Wait();
+  }
+
+  /// @brief Waits until all the tasks finish, any of them fails or the
+  /// deadline is reached
+  [[nodiscard]] engine::FutureStatus WaitUntil(engine::Deadline deadline) {
+    UASSERT(IsValid());
+    return state_->WaitUntil(deadline);
+  }
+
+  /// @brief Waits for the tasks and returns their results in the order of the
+  /// indexes, invalidates the batch.
+  ///
+  /// @returns `std::vector<Result>` or `void`
+  /// @throws engine::WaitInterruptedException if the caller is cancelled
+  /// @throws std::exception the first exception thrown by the tasks, the rest
+  /// of the tasks are cancelled
+  auto Get() {
+    UASSERT(IsValid());
+    const auto state = std::move(state_);
+    state->Wait();
+    state->RethrowIfFailed();
+    return state->TakeResults();
+  }
+
+  /// @cond
+  // For internal use only.
+  explicit TaskBatch(std::unique_ptr<impl::TaskBatchResults<Result>>&& state)
+      : state_(std::move(state)) {}
+  /// @endcond
+
+ private:
+  std::unique_ptr<impl::TaskBatchResults<Result>> state_;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Starts `count` tasks that call `f(index)` for each index in
+/// [0, count), waited for as a whole through utils::TaskBatch.
+///
+/// A cheaper alternative to `count` utils::Async calls for a fine-grained
+/// fan-out:
+/// - a single tracing::Span with the `name` is created for the whole batch,
+///   the tasks run without spans;
+/// - the tasks share a single copy of `f`, so `f` must be safe to call
+///   concurrently, and inherit the engine::TaskInheritedVariable instances of
+///   the caller without copying them;
+/// - the tasks report into a single counter, so waiting for the batch does
+///   not depend on the count of the tasks.
+///
+/// Use utils::Async if the logs of each task have to be bound to a separate
+/// span.
+///
+/// @param task_processor Task processor to run on
+/// @param name Name of the tracing::Span of the batch
+/// @param count Count of the tasks to start
+/// @param f Function to call with the index of the task
+/// @returns utils::TaskBatch with the results of `f`
+///
+/// @snippet utils/async_many_test.cpp  Sample utils::AsyncMany
+template <typename Function>
+[[nodiscard]] auto AsyncMany(engine::TaskProcessor& task_processor,
+                             std::string name, std::size_t count,
+                             Function&& f) {
+  using Result = std::invoke_result_t<std::decay_t<Function>&, std::size_t>;
+
+  auto state = std::make_unique<impl::TaskBatchState<Result, Function>>(
+      std::move(name), count, std::forward<Function>(f));
+  state->Start(task_processor);
+  return TaskBatch<Result>{std::move(state)};
+}
+
+/// @ingroup userver_concurrency
+///
+/// @overload
+template <typename Function>
+[[nodiscard]] auto AsyncMany(std::string name, std::size_t count,
+                             Function&& f) {
+  return AsyncMany(engine::current_task::GetTaskProcessor(), std::move(name),
+                   count, std::forward<Function>(f));
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -28,6 +28,40 @@ class ScopeTimePause {
   std::string scope_name_;
 };
 
+/// @brief Limits the share of a CPU core that the current task may use at the
+/// yield points of utils::CpuRelax and utils::StreamingCpuRelax
+///
+/// While the scope is alive, the yield points of the current task sleep as
+/// long as needed to keep the CPU time of the task within `cpu_share` of the
+/// wall time elapsed since the start of the scope. The code that does not use
+/// CpuRelax is accounted, but is only throttled at the next yield point.
+///
+/// @note Must be created and destroyed in the same coroutine
+class CpuBudgetScope final {
+ public:
+  /// @param cpu_share the share of a CPU core in (0, 1], 1 means no throttling
+  explicit CpuBudgetScope(double cpu_share);
+  ~CpuBudgetScope();
+
+  CpuBudgetScope(CpuBudgetScope&&) = delete;
+  CpuBudgetScope& operator=(CpuBudgetScope&&) = delete;
+
+  /// @returns the CPU time used by the current task since the start of the
+  /// scope
+  std::chrono::nanoseconds GetCpuTime() const;
+
+  /// @cond
+  // Sleeps or yields, called by CpuRelax and StreamingCpuRelax
+  void Throttle();
+  /// @endcond
+
+ private:
+  const double cpu_share_;
+  CpuBudgetScope* const previous_;
+  const std::chrono::nanoseconds start_cpu_time_;
+  std::chrono::steady_clock::time_point start_time_;
+};
+
 /// Utility to yield every N iterations in a CPU-bound task to give other tasks
 /// an opportunity to get CPU time
 class CpuRelax {
@@ -0,0 +1,213 @@
+#pragma once
+
+/// @file userver/utils/parallel.hpp
+/// @brief Parallel algorithms over an engine::TaskProcessor.
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Parallel algorithms that split the work into chunks and run the
+/// chunks as tasks of an engine::TaskProcessor
+namespace utils::parallel {
+
+/// @brief Options of the utils::parallel algorithms
+struct Options final {
+  /// Task processor to run the chunks on, the one of the caller if not set
+  engine::TaskProcessor* task_processor{nullptr};
+
+  /// Maximum count of the simultaneously running chunk tasks, the count of the
+  /// task processor worker threads if 0
+  std::size_t max_concurrency{0};
+
+  /// Minimum count of elements in a chunk. Increase it if the work per element
+  /// is cheap, so that the task startup does not dominate.
+  std::size_t min_chunk_size{1};
+
+  /// Deadline of the whole call, the chunks that did not finish in time are
+  /// cancelled
+  engine::Deadline deadline{};
+};
+
+namespace impl {
+
+// Runs the jobs on the tasks of the chosen task processor, holds the span of
+// the algorithm call
+class Runner final {
+ public:
+  using Job = utils::function_ref<void(std::size_t)>;
+
+  Runner(std::string&& name, std::size_t size, const Options& options);
+
+  Runner(const Runner&) = delete;
+  Runner& operator=(const Runner&) = delete;
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+  // Chunks of the [0, size) range have equal sizes except for the last one
+  std::size_t GetChunkSize() const noexcept { return chunk_size_; }
+  std::size_t GetChunksCount() const noexcept { return chunks_count_; }
+
+  // Calls `job(i)` for each i in [0, jobs_count) on at most max_concurrency
+  // tasks, rethrows the first exception of the jobs
+  void RunJobs(std::size_t jobs_count, Job job);
+
+  // Calls `func(chunk_index, begin, end)` for each chunk
+  template <typename Function>
+  void RunChunks(Function&& func) {
+    RunJobs(chunks_count_, [this, &func](std::size_t chunk) {
+      const auto begin = chunk * chunk_size_;
+      func(chunk, begin, std::min(begin + chunk_size_, size_));
+    });
+  }
+
+ private:
+  tracing::Span span_;
+  engine::TaskProcessor& task_processor_;
+  const engine::Deadline deadline_;
+  const std::size_t size_;
+  std::size_t concurrency_;
+  std::size_t chunk_size_;
+  std::size_t chunks_count_;
+};
+
+template <typename Iterator>
+inline constexpr bool kIsRandomAccess = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<Iterator>::iterator_category>;
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func(i)` for each `i` in [0, size) in parallel.
+///
+/// Creates a single tracing::Span with the `name` for the whole call, the
+/// chunks are run without spans. The caller waits for all the chunks.
+///
+/// @throws engine::WaitInterruptedException if the caller is cancelled
+/// @throws engine::TaskCancelledException if the deadline is reached
+/// @throws std::exception the first exception thrown by `func`
+///
+/// @snippet utils/parallel_test.cpp  Sample utils::parallel::For
+template <typename Function>
+void For(std::string name, std::size_t size, Function&& func,
+         const Options& options = {}) {
+  impl::Runner runner(std::move(name), size, options);
+  runner.RunChunks([&func](std::size_t, std::size_t begin, std::size_t end) {
+    for (auto i = begin; i < end; ++i) func(i);
+  });
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func(element)` for each element of the [first, last) range
+/// in parallel, see utils::parallel::For for the details.
+template <typename Iterator, typename Function>
+void ForEach(std::string name, Iterator first, Iterator last, Function&& func,
+             const Options& options = {}) {
+  static_assert(impl::kIsRandomAccess<Iterator>,
+                "utils::parallel requires random access iterators");
+  impl::Runner runner(std::move(name), std::distance(first, last), options);
+  runner.RunChunks(
+      [first, &func](std::size_t, std::size_t begin, std::size_t end) {
+        std::for_each(first + begin, first + end, func);
+      });
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel std::transform of the [first, last) range into the range
+/// starting at `d_first`, see utils::parallel::For for the details.
+template <typename Iterator, typename OutputIterator, typename Function>
+void Transform(std::string name, Iterator first, Iterator last,
+               OutputIterator d_first, Function&& func,
+               const Options& options = {}) {
+  static_assert(impl::kIsRandomAccess<Iterator> &&
+                    impl::kIsRandomAccess<OutputIterator>,
+                "utils::parallel requires random access iterators");
+  impl::Runner runner(std::move(name), std::distance(first, last), options);
+  runner.RunChunks(
+      [first, d_first, &func](std::size_t, std::size_t begin, std::size_t end) {
+        std::transform(first + begin, first + end, d_first + begin, func);
+      });
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel reduction of the [first, last) range, see
+/// utils::parallel::For for the details.
+///
+/// `op` must be associative, the elements are combined in the order of the
+/// range, so it does not have to be commutative.
+///
+/// @snippet utils/parallel_test.cpp  Sample utils::parallel::Reduce
+template <typename Iterator, typename T, typename BinaryOp = std::plus<>>
+T Reduce(std::string name, Iterator first, Iterator last, T init,
+         BinaryOp op = {}, const Options& options = {}) {
+  static_assert(impl::kIsRandomAccess<Iterator>,
+                "utils::parallel requires random access iterators");
+  impl::Runner runner(std::move(name), std::distance(first, last), options);
+
+  std::vector<std::optional<T>> partial(runner.GetChunksCount());
+  runner.RunChunks([first, &op, &partial](std::size_t chunk, std::size_t begin,
+                                          std::size_t end) {
+    T result(*(first + begin));
+    for (auto it = first + begin + 1; it != first + end; ++it) {
+      result = op(std::move(result), *it);
+    }
+    partial[chunk].emplace(std::move(result));
+  });
+
+  for (auto& value : partial) init = op(std::move(init), std::move(*value));
+  return init;
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Parallel sort of the [first, last) range, see utils::parallel::For
+/// for the details.
+///
+/// The chunks are sorted in parallel and then merged pairwise with
+/// std::inplace_merge, each round of merges halves the parallelism. The sort
+/// is not stable.
+template <typename Iterator, typename Compare = std::less<>>
+void Sort(std::string name, Iterator first, Iterator last, Compare comp = {},
+          const Options& options = {}) {
+  static_assert(impl::kIsRandomAccess<Iterator>,
+                "utils::parallel requires random access iterators");
+  impl::Runner runner(std::move(name), std::distance(first, last), options);
+
+  runner.RunChunks(
+      [first, &comp](std::size_t, std::size_t begin, std::size_t end) {
+        std::sort(first + begin, first + end, comp);
+      });
+
+  const auto size = runner.GetSize();
+  for (auto width = runner.GetChunkSize(); width < size; width *= 2) {
+    const auto merges_count = (size + 2 * width - 1) / (2 * width);
+    runner.RunJobs(merges_count, [&](std::size_t merge) {
+      const auto begin = merge * 2 * width;
+      const auto middle = std::min(begin + width, size);
+      const auto end = std::min(begin + 2 * width, size);
+      std::inplace_merge(first + begin, first + middle, first + end, comp);
+    });
+  }
+}
+
+}  // namespace utils::parallel
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,9 @@
 /// @file userver/utils/periodic_task.hpp
 /// @brief @copybrief utils::PeriodicTask
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <string>
@@ -32,6 +34,11 @@ namespace utils {
 /// * `B` is the time of previous callback execution if Flags::kStrong flag is
 ///   set, otherwise is `0`;
 ///
+/// With Flags::kSpread the first wait is extended by a fraction of
+/// `distribution` derived from the task name. Tasks started together with the
+/// same period then run at different phases instead of all at once, and each
+/// task keeps its phase between restarts.
+///
 /// TaskProcessor to execute the callback and many other options are specified
 /// in PeriodicTask::Settings.
 class PeriodicTask final {
@@ -52,6 +59,20 @@ class PeriodicTask final {
     /// Subtasks that may be spawned in the callback
     /// are not critical by default and may be cancelled as usual.
     kCritical = 1 << 4,
+    /// Shift the phase of the task by a name-derived part of `distribution`
+    kSpread = 1 << 5,
+  };
+
+  /// Execution statistics of the callback, see GetStatistics()
+  struct Statistics final {
+    /// Finished callback executions, including the failed ones
+    std::uint64_t runs{0};
+    /// Callback executions that threw an exception
+    std::uint64_t failures{0};
+    /// Callback executions that took longer than the `period`
+    std::uint64_t overruns{0};
+    std::chrono::microseconds last_runtime{0};
+    std::chrono::microseconds max_runtime{0};
   };
 
   /// Configuration parameters for PeriodicTask.
@@ -193,6 +214,10 @@ class PeriodicTask final {
   /// Get current settings. Note that they might become stale very quickly.
   Settings GetCurrentSettings() const;
 
+  /// Get statistics of the callback executions since the construction,
+  /// including the SynchronizeDebug() ones.
+  Statistics GetStatistics() const;
+
  private:
   enum class SuspendState { kRunning, kSuspended };
 
@@ -208,6 +233,11 @@ class PeriodicTask final {
 
   std::chrono::milliseconds MutatePeriod(std::chrono::milliseconds period);
 
+  std::chrono::milliseconds GetPhase() const;
+
+  void AccountRun(std::chrono::steady_clock::duration runtime,
+                  std::chrono::milliseconds period, bool no_exception);
+
   rcu::Variable<std::string> name_;
   Callback callback_;
   engine::TaskWithResult<void> task_;
@@ -215,6 +245,12 @@ class PeriodicTask final {
   engine::SingleConsumerEvent changed_event_;
   std::atomic<bool> should_force_step_{false};
 
+  std::atomic<std::uint64_t> runs_{0};
+  std::atomic<std::uint64_t> failures_{0};
+  std::atomic<std::uint64_t> overruns_{0};
+  std::atomic<std::int64_t> last_runtime_us_{0};
+  std::atomic<std::int64_t> max_runtime_us_{0};
+
   // For kNow only
   engine::Mutex step_mutex_;
   std::atomic<SuspendState> suspend_state_;
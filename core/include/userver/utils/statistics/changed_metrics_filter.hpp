@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/utils/statistics/changed_metrics_filter.hpp
+/// @brief @copybrief utils::statistics::ChangedMetricsFilter
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Remembers the metrics of the previous visits to pass only the
+/// changed ones, for the push-based exporters that send the deltas.
+///
+/// A metric is passed if its value or labels differ from the previous visit
+/// through the same filter, or if it was absent at the previous visit. The
+/// metrics that disappeared are forgotten, and are passed again once they
+/// reappear.
+///
+/// Not thread-safe, the visits through the same filter must not run
+/// concurrently.
+class ChangedMetricsFilter final {
+ public:
+  ChangedMetricsFilter();
+  ChangedMetricsFilter(ChangedMetricsFilter&&) noexcept;
+  ChangedMetricsFilter& operator=(ChangedMetricsFilter&&) noexcept;
+  ~ChangedMetricsFilter();
+
+  /// Visits the metrics of the `storage`, calls `out.HandleMetric` only for
+  /// the changed ones. Returns the number of the passed metrics.
+  std::size_t VisitChangedMetrics(const Storage& storage,
+                                  BaseFormatBuilder& out,
+                                  const Request& request = {});
+
+  /// Forgets the previous values, so the next visit passes all the metrics.
+  void Reset() noexcept;
+
+ private:
+  struct PreviousValue final {
+    // The exact bits for the non-histogram values
+    std::uint64_t fingerprint{0};
+    std::uint64_t visit{0};
+  };
+
+  class Builder;
+
+  std::unordered_map<std::string, PreviousValue> previous_values_;
+  std::uint64_t visit_{0};
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
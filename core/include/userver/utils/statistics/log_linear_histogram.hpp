@@ -0,0 +1,241 @@
+#pragma once
+
+/// @file userver/utils/statistics/log_linear_histogram.hpp
+/// @brief @copybrief utils::statistics::LogLinearHistogram
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl::log_linear_histogram {
+
+// The counters of the shards are summed up on read
+inline constexpr std::size_t kShardCount = 4;
+
+// 0th counter is the "infinity" one, 0 and 1 share the 1st counter
+constexpr std::size_t GetCounterIndex(std::uint64_t value,
+                                      std::size_t precision_bits,
+                                      std::size_t max_power_of_two) noexcept {
+  if (value >> max_power_of_two) return 0;
+  if (value >> precision_bits == 0) return value == 0 ? 1 : value;
+
+  const std::size_t power = 63 - __builtin_clzll(value);
+  const auto shift = power - precision_bits;
+  const auto mantissa =
+      (value >> shift) & ((std::uint64_t{1} << precision_bits) - 1);
+  return ((shift + 1) << precision_bits) | mantissa;
+}
+
+// The largest value that falls into the counter, the inverse of
+// GetCounterIndex for the non-"infinity" counters
+constexpr std::uint64_t GetUpperBound(std::size_t counter_index,
+                                      std::size_t precision_bits) noexcept {
+  if (counter_index >> precision_bits == 0) return counter_index;
+
+  const auto shift = (counter_index >> precision_bits) - 1;
+  const auto mantissa =
+      counter_index & ((std::size_t{1} << precision_bits) - 1);
+  const auto lower_bound =
+      ((std::uint64_t{1} << precision_bits) | mantissa) << shift;
+  return lower_bound + (std::uint64_t{1} << shift) - 1;
+}
+
+std::size_t GetCurrentShard() noexcept;
+
+void DumpMetric(Writer& writer, std::size_t precision_bits,
+                utils::span<const std::uint64_t> counters);
+
+}  // namespace impl::log_linear_histogram
+
+/// @brief A histogram with the exponentially growing buckets, that replaces
+/// utils::statistics::Percentile with a much smaller memory footprint and
+/// serializes as a summable utils::statistics::Histogram.
+///
+/// The values are rounded up to integers, so choose the units accordingly,
+/// e.g. microseconds for the timings. The values below
+/// `2^(PrecisionBits + 1)` get a bucket each. Each following power of two is
+/// split into `2^PrecisionBits` equal buckets, so the relative error of the
+/// bucket bounds is at most `2^-PrecisionBits`. The values of at least
+/// `2^MaxPowerOfTwo` fall into the "infinity" bucket.
+///
+/// There are `((MaxPowerOfTwo - PrecisionBits + 1) << PrecisionBits) - 1`
+/// buckets. For best portability, there should be no more than 50 buckets,
+/// e.g. `LogLinearHistogram<2, 13>` has 47 buckets for the values up to 8191
+/// with 25% precision.
+///
+/// The counters are sharded among the threads to reduce the contention on
+/// Account, the shards are summed up on read. The bounds are known at compile
+/// time, so unlike the utils::statistics::Histogram the bounds are not stored
+/// and no allocations are made.
+///
+/// The histograms are mergeable, and could be used as both template arguments
+/// of utils::statistics::RecentPeriod. GetPercentile of the aggregated result
+/// gives the percentiles over the whole period:
+///
+/// @code
+/// using Timings = utils::statistics::LogLinearHistogram<3, 20>;
+/// utils::statistics::RecentPeriod<Timings, Timings> timings;
+///
+/// void Account(std::chrono::microseconds duration) {
+///   timings.GetCurrentCounter().Account(duration.count());
+/// }
+///
+/// std::uint64_t GetP99() {
+///   return timings.GetStatsForPeriod().GetPercentile(99);
+/// }
+/// @endcode
+///
+/// @tparam PrecisionBits log2 of the count of buckets per power of two
+/// @tparam MaxPowerOfTwo log2 of the lower bound of the "infinity" bucket
+template <std::size_t PrecisionBits, std::size_t MaxPowerOfTwo>
+class LogLinearHistogram final {
+  static_assert(PrecisionBits >= 1 && PrecisionBits <= 8,
+                "PrecisionBits should be in [1, 8]");
+  static_assert(MaxPowerOfTwo > PrecisionBits && MaxPowerOfTwo <= 53,
+                "MaxPowerOfTwo should be in (PrecisionBits, 53], the bounds "
+                "must be exactly representable as 'double'");
+
+ public:
+  /// The number of "normal" (non-"infinity") buckets.
+  static constexpr std::size_t kBucketCount =
+      ((MaxPowerOfTwo - PrecisionBits + 1) << PrecisionBits) - 1;
+
+  LogLinearHistogram() noexcept { Reset(); }
+
+  LogLinearHistogram(const LogLinearHistogram& other) noexcept {
+    *this = other;
+  }
+
+  /// Writes to `*this` are non-atomic.
+  LogLinearHistogram& operator=(const LogLinearHistogram& other) noexcept {
+    if (this == &other) return *this;
+    Reset();
+    Add(other);
+    return *this;
+  }
+
+  /// Atomically increment the bucket corresponding to the given value.
+  void Account(double value, std::uint64_t count = 1) noexcept {
+    auto& shard = shards_[impl::log_linear_histogram::GetCurrentShard()];
+    shard.counters[GetCounterIndex(value)].fetch_add(count,
+                                                     std::memory_order_relaxed);
+  }
+
+  /// Adds the other histogram to the current one, the signature allows using
+  /// LogLinearHistogram as a `Result` of utils::statistics::RecentPeriod.
+  /// Writes to `*this` are non-atomic.
+  template <class Duration = std::chrono::seconds>
+  void Add(const LogLinearHistogram& other,
+           [[maybe_unused]] Duration this_epoch_duration = Duration(),
+           [[maybe_unused]] Duration before_this_epoch_duration = Duration()) {
+    auto& to = shards_[0].counters;
+    for (const auto& shard : other.shards_) {
+      for (std::size_t i = 0; i < kCounterCount; ++i) {
+        to[i].store(to[i].load(std::memory_order_relaxed) +
+                        shard.counters[i].load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Atomically reset all counters to zero.
+  void Reset() noexcept {
+    for (auto& shard : shards_) {
+      for (auto& counter : shard.counters) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// @overload
+  friend void ResetMetric(LogLinearHistogram& histogram) noexcept {
+    histogram.Reset();
+  }
+
+  /// Total number of the accounted values.
+  std::uint64_t Count() const noexcept {
+    std::uint64_t count = 0;
+    for (const auto value : LoadCounters()) count += value;
+    return count;
+  }
+
+  /// @brief Get X percentile - the upper bound of the lowest bucket, so that
+  /// the values in buckets up to it make up no less than X percent of all the
+  /// values.
+  ///
+  /// Returns `2^MaxPowerOfTwo` for the "infinity" bucket, returns 0 if there
+  /// are no values.
+  ///
+  /// @param percent - value in [0..100] - requested percentile
+  ///                  if outside of 100, then returns the last bucket that
+  ///                  has any value in it.
+  std::uint64_t GetPercentile(double percent) const noexcept {
+    const auto counters = LoadCounters();
+    std::uint64_t count = 0;
+    for (const auto value : counters) count += value;
+    if (count == 0) return 0;
+
+    const auto want_count = static_cast<double>(count) * percent;
+    std::uint64_t sum = 0;
+    std::uint64_t max_value = 0;
+    for (std::size_t i = 1; i < kCounterCount; ++i) {
+      if (counters[i] == 0) continue;
+      sum += counters[i];
+      max_value = impl::log_linear_histogram::GetUpperBound(i, PrecisionBits);
+      if (static_cast<double>(sum) * 100 > want_count) return max_value;
+    }
+    if (counters[0] != 0) return std::uint64_t{1} << MaxPowerOfTwo;
+    return max_value;
+  }
+
+  /// Metric serialization support, writes a utils::statistics::HistogramView.
+  friend void DumpMetric(Writer& writer, const LogLinearHistogram& histogram) {
+    const auto counters = histogram.LoadCounters();
+    impl::log_linear_histogram::DumpMetric(writer, PrecisionBits, counters);
+  }
+
+ private:
+  static constexpr std::size_t kCounterCount = kBucketCount + 1;
+
+  // A separate cache line for each shard
+  struct alignas(64) Shard final {
+    std::array<std::atomic<std::uint64_t>, kCounterCount> counters;
+  };
+
+  static std::size_t GetCounterIndex(double value) noexcept {
+    // Also handles NaN
+    if (!(value > 0)) return 1;
+    if (value >= static_cast<double>(std::uint64_t{1} << MaxPowerOfTwo)) {
+      return 0;
+    }
+    return impl::log_linear_histogram::GetCounterIndex(
+        static_cast<std::uint64_t>(std::ceil(value)), PrecisionBits,
+        MaxPowerOfTwo);
+  }
+
+  std::array<std::uint64_t, kCounterCount> LoadCounters() const noexcept {
+    std::array<std::uint64_t, kCounterCount> result{};
+    for (const auto& shard : shards_) {
+      for (std::size_t i = 0; i < kCounterCount; ++i) {
+        result[i] += shard.counters[i].load(std::memory_order_relaxed);
+      }
+    }
+    return result;
+  }
+
+  std::array<Shard, impl::log_linear_histogram::kShardCount> shards_;
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
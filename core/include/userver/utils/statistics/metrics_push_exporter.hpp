@@ -0,0 +1,90 @@
+#pragma once
+
+/// @file userver/utils/statistics/metrics_push_exporter.hpp
+/// @brief @copybrief components::MetricsPushExporter
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically pushes the metrics of the
+/// components::StatisticsStorage to a collector, instead of waiting for the
+/// collector to pull them from the monitor handler.
+///
+/// The counters (utils::statistics::Rate) and the histograms
+/// (utils::statistics::HistogramView) are sent with the delta temporality,
+/// i.e. as their increments since the previous push, the counters that did
+/// not change are not sent. The gauges are sent as is. The increments of a
+/// failed push are lost.
+///
+/// Supported formats:
+/// * `otlp` - OTLP/HTTP protobuf ExportMetricsServiceRequest, sent with the
+///   components::HttpClient. The counters are the monotonic sums, the body
+///   could be compressed with gzip;
+/// * `statsd` - StatsD lines with the DogStatsD tags, sent in the UDP
+///   datagrams of at most `max-packet-size` bytes. The histograms are sent as
+///   the `.bucket` counters tagged with the `upper_bound` and the `.count`
+///   counters.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// format | `otlp` or `statsd` | -
+/// endpoint | URL of the OTLP/HTTP metrics handler, e.g. 'http://localhost:4318/v1/metrics', or the 'host:port' of the StatsD server | -
+/// service-name | the service name to put into the `service.name` resource attribute of OTLP | -
+/// push-interval | interval between the pushes | 15s
+/// prefix | only the metrics with the path starting with the prefix are pushed | ''
+/// http-client | name of the components::HttpClient to send the OTLP requests with | 'http-client'
+/// timeout | timeout of the OTLP request | 5s
+/// compression | `none` or `gzip` compression of the OTLP request body | none
+/// dns-client | name of the clients::dns::Component to resolve the StatsD host with | 'dns-client'
+/// max-packet-size | max size of a StatsD datagram in bytes | 1432
+///
+/// ## Static configuration example:
+///
+/// ```
+/// # yaml
+/// metrics-push-exporter:
+///     format: otlp
+///     endpoint: http://localhost:4318/v1/metrics
+///     service-name: my-service
+///     compression: gzip
+/// ```
+
+// clang-format on
+class MetricsPushExporter final : public LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::MetricsPushExporter
+  static constexpr std::string_view kName = "metrics-push-exporter";
+
+  MetricsPushExporter(const ComponentConfig& config,
+                      const ComponentContext& context);
+  ~MetricsPushExporter() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  class Impl;
+
+  std::unique_ptr<Impl> impl_;
+  utils::PeriodicTask periodic_task_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<MetricsPushExporter> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -70,7 +70,8 @@ class Request final {
   /// Match type of the `prefix`
   const PrefixMatch prefix_match_type = PrefixMatch::kNoop;
 
-  /// Require those labels in the metric
+  /// Require those labels in the metric. The writers registered with a label
+  /// of the same name and another value are not called at all.
   const std::vector<Label> require_labels{};
 
   /// Add those labels to each returned metric
@@ -8,6 +8,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +19,19 @@ namespace {
 const int kEntitiesLimit = 64;
 const int kHeaderLengthLimit = 8192;
 
+// Most keys are not encoded, so they are compared without decoding
+std::string DecodeKey(std::string_view key) {
+  if (key.find_first_of("%+") == std::string_view::npos) {
+    return std::string{key};
+  }
+  return http::parser::UrlDecode(key);
+}
+
+std::string_view Rebase(std::string_view view, const char* old_header,
+                        const char* new_header) {
+  return {new_header + (view.data() - old_header), view.size()};
+}
+
 }  // namespace
 
 BaggageEntryProperty::BaggageEntryProperty(
@@ -91,7 +105,7 @@ const BaggageEntryProperty& BaggageEntry::GetProperty(
   throw BaggageException("Entry doesn't contain selected property");
 }
 
-std::string Baggage::ToString() const {
+const std::string& Baggage::ToString() const {
   if (is_valid_header_) {
     return header_value_;
   }
@@ -122,7 +136,13 @@ const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
 
 Baggage::Baggage(std::string header,
                  std::unordered_set<std::string> allowed_keys)
+    : Baggage(std::move(header),
+              std::make_shared<const std::unordered_set<std::string>>(
+                  std::move(allowed_keys))) {}
+
+Baggage::Baggage(std::string header, AllowedKeysPtr allowed_keys)
     : header_value_(std::move(header)), allowed_keys_(std::move(allowed_keys)) {
+  UASSERT(allowed_keys_);
   header_value_.erase(
       std::remove_if(header_value_.begin(), header_value_.end(),
                      [](unsigned char x) { return std::isspace(x); }),
@@ -137,32 +157,38 @@ Baggage::Baggage(std::string header,
 }
 
 Baggage::Baggage(const Baggage& baggage_copy) noexcept
-    : allowed_keys_(baggage_copy.allowed_keys_) {
-  if (baggage_copy.is_valid_header_) {
-    header_value_ = baggage_copy.header_value_;
-  } else {
-    header_value_ = baggage_copy.result_header_;
-  }
-  FillEntries();
-
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
+    : header_value_(baggage_copy.header_value_),
+      allowed_keys_(baggage_copy.allowed_keys_),
+      entries_(baggage_copy.entries_),
+      result_header_(baggage_copy.result_header_),
+      is_valid_header_(baggage_copy.is_valid_header_) {
+  RebaseEntries(baggage_copy.header_value_.data());
 }
 
 Baggage::Baggage(Baggage&& baggage_copy) noexcept
-    : allowed_keys_(std::move(baggage_copy.allowed_keys_)) {
-  if (baggage_copy.is_valid_header_) {
-    header_value_ = std::move(baggage_copy.header_value_);
-  } else {
-    header_value_ = std::move(baggage_copy.result_header_);
-  }
-  FillEntries();
+    : allowed_keys_(baggage_copy.allowed_keys_),
+      result_header_(std::move(baggage_copy.result_header_)),
+      is_valid_header_(baggage_copy.is_valid_header_) {
+  // short strings are not moved with their buffer
+  const char* old_header = baggage_copy.header_value_.data();
+  header_value_ = std::move(baggage_copy.header_value_);
+  entries_ = std::move(baggage_copy.entries_);
+  RebaseEntries(old_header);
+}
 
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
+void Baggage::RebaseEntries(const char* old_header) {
+  const char* new_header = header_value_.data();
+  if (old_header == new_header) return;
+
+  for (auto& entry : entries_) {
+    entry.key_ = Rebase(entry.key_, old_header, new_header);
+    entry.value_ = Rebase(entry.value_, old_header, new_header);
+    for (auto& property : entry.properties_) {
+      property.key_ = Rebase(property.key_, old_header, new_header);
+      if (property.value_) {
+        property.value_ = Rebase(*property.value_, old_header, new_header);
+      }
+    }
   }
 }
 
@@ -226,11 +252,11 @@ void Baggage::AddEntry(std::string key, std::string value,
 }
 
 bool Baggage::IsValidEntry(const std::string& key) const {
-  return allowed_keys_.count(key);
+  return allowed_keys_->count(key);
 }
 
-std::unordered_set<std::string> Baggage::GetAllowedKeys() const {
-  return allowed_keys_;
+const std::unordered_set<std::string>& Baggage::GetAllowedKeys() const {
+  return *allowed_keys_;
 }
 
 void Baggage::CreateResultHeader() {
@@ -244,7 +270,6 @@ void Baggage::CreateResultHeader() {
 }
 
 void Baggage::FillEntries() {
-  entries_.reserve(kEntitiesLimit);
   for (size_t header_pos = 0;
        header_pos != std::string::npos && entries_.size() < kEntitiesLimit;) {
     std::string_view entry{header_value_};
@@ -289,7 +314,7 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
     return std::nullopt;
   }
   key.remove_suffix(entry.size() - entry_delimiter);
-  if (!allowed_keys_.count(http::parser::UrlDecode(key))) {
+  if (!allowed_keys_->count(DecodeKey(key))) {
     LOG_LIMITED_WARNING() << fmt::format("Key {} is not available", key);
     return std::nullopt;
   }
@@ -320,7 +345,6 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
 
   // make properties
   std::vector<BaggageEntryProperty> properties;
-  properties.reserve(kEntitiesLimit);
   while (property_pos != std::string_view::npos) {
     std::string_view property{entry};
     property.remove_prefix(property_pos + 1);
@@ -337,7 +361,7 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
       }
     }
   }
-  return std::make_optional<BaggageEntry>({key, value, properties});
+  return std::make_optional<BaggageEntry>({key, value, std::move(properties)});
 }
 
 std::optional<BaggageEntryProperty> Baggage::TryMakeBaggageEntryProperty(
@@ -382,6 +406,14 @@ std::optional<BaggageEntryProperty> Baggage::TryMakeBaggageEntryProperty(
 
 std::optional<Baggage> TryMakeBaggage(
     std::string header, std::unordered_set<std::string> allowed_keys) {
+  return TryMakeBaggage(
+      std::move(header),
+      std::make_shared<const std::unordered_set<std::string>>(
+          std::move(allowed_keys)));
+}
+
+std::optional<Baggage> TryMakeBaggage(std::string header,
+                                      Baggage::AllowedKeysPtr allowed_keys) {
   if (header.size() > kHeaderLengthLimit) {
     LOG_LIMITED_WARNING() << fmt::format(
         "Exceeded the limit of header length: {}", kHeaderLengthLimit);
@@ -11,21 +11,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace baggage {
 
-namespace {
-
-std::unordered_set<std::string> ChooseCurrentAllowedKeys(
-    const Baggage* current_baggage,
-    const dynamic_config::Source& config_source) {
+Baggage::AllowedKeysPtr BaggageManager::ChooseCurrentAllowedKeys(
+    const Baggage* current_baggage) const {
   if (current_baggage != nullptr) {
-    return current_baggage->GetAllowedKeys();
+    return current_baggage->allowed_keys_;
   }
-  const auto snapshot = config_source.GetSnapshot();
-  const auto& baggage_settings = snapshot[kBaggageSettings];
-  return baggage_settings.allowed_keys;
+  return GetAllowedKeys(config_source_.GetSnapshot());
 }
 
-}  // namespace
-
 BaggageManagerComponent::BaggageManagerComponent(
     const components::ComponentConfig& config,
     const components::ComponentContext& context)
@@ -63,8 +56,7 @@ void BaggageManager::AddEntry(std::string key, std::string value,
 
   auto baggage = current_baggage
                      ? std::move(*current_baggage)
-                     : Baggage("", ChooseCurrentAllowedKeys(current_baggage,
-                                                            config_source_));
+                     : Baggage("", ChooseCurrentAllowedKeys(current_baggage));
 
   baggage.AddEntry(std::move(key), std::move(value), std::move(properties));
   kInheritedBaggage.Set(std::move(baggage));
@@ -79,8 +71,7 @@ void BaggageManager::SetBaggage(std::string header) const {
     return;
   }
   const auto* current_baggage = TryGetBaggage();
-  auto current_allowed_keys =
-      ChooseCurrentAllowedKeys(current_baggage, config_source_);
+  auto current_allowed_keys = ChooseCurrentAllowedKeys(current_baggage);
 
   auto baggage =
       TryMakeBaggage(std::move(header), std::move(current_allowed_keys));
@@ -23,6 +23,14 @@ const dynamic_config::Key<BaggageSettings> kBaggageSettings{
 const dynamic_config::Key<bool> kBaggageEnabled{"USERVER_BAGGAGE_ENABLED",
                                                 false};
 
+std::shared_ptr<const std::unordered_set<std::string>> GetAllowedKeys(
+    const dynamic_config::Snapshot& config) {
+  // The snapshot keeps the config values alive
+  auto snapshot = std::make_shared<const dynamic_config::Snapshot>(config);
+  const auto& allowed_keys = (*snapshot)[kBaggageSettings].allowed_keys;
+  return {std::move(snapshot), &allowed_keys};
+}
+
 }  // namespace baggage
 
 USERVER_NAMESPACE_END
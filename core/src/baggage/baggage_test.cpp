@@ -168,6 +168,42 @@ UTEST(Baggage, FindEntities) {
   UEXPECT_THROW(baggage->GetEntry("key4"), baggage::BaggageException);
 }
 
+// Check that copies and moves of a baggage point to their own header
+UTEST(Baggage, CopyAndMove) {
+  // Short header is stored inline, so the move changes its address
+  std::string short_header = "key1=value1;p=v";
+  std::string long_header =
+      "key1=value1;property1;PropertyKey2=PropertyValue2,key2=value2,"
+      "key6=value6";
+  const std::string short_expected =
+      "Baggage:"
+      "\nEntry: key1 value1"
+      "\n\tProperty: p v";
+  const std::string long_expected =
+      "Baggage:"
+      "\nEntry: key1 value1"
+      "\n\tProperty: property1"
+      "\n\tProperty: PropertyKey2 PropertyValue2"
+      "\nEntry: key2 value2";
+
+  for (auto [header, expected] : {std::pair{short_header, short_expected},
+                                  std::pair{long_header, long_expected}}) {
+    auto baggage = baggage::TryMakeBaggage(std::move(header), kAllowedKeys);
+    ASSERT_TRUE(baggage);
+
+    std::optional<baggage::Baggage> copy{*baggage};
+    baggage::Baggage moved{std::move(*baggage)};
+    baggage.reset();
+    EXPECT_EQ(PrintBaggage(*copy), expected);
+
+    baggage::Baggage moved_copy{std::move(*copy)};
+    copy.reset();
+    EXPECT_EQ(PrintBaggage(moved), expected);
+    EXPECT_EQ(PrintBaggage(moved_copy), expected);
+    EXPECT_EQ(moved.ToString(), moved_copy.ToString());
+  }
+}
+
 // Check functions of available entries
 UTEST(Baggage, AvailableEntries) {
   auto baggage = baggage::TryMakeBaggage("", kAllowedKeys);
@@ -26,6 +26,7 @@ constexpr std::string_view kUpdatesEnabled = "updates-enabled";
 constexpr std::string_view kTaskProcessor = "task-processor";
 constexpr std::string_view kFailedUpdatesBeforeExpiration =
     "failed-updates-before-expiration";
+constexpr std::string_view kUpdateCpuBudget = "update-cpu-budget";
 
 constexpr std::string_view kUpdateInterval = "update-interval";
 constexpr std::string_view kUpdateJitter = "update-jitter";
@@ -145,6 +146,7 @@ Config::Config(const yaml_config::YamlConfig& config,
       is_strong_period(config[kIsStrongPeriod].As<bool>(false)),
       failed_updates_before_expiration(config[kFailedUpdatesBeforeExpiration]
                                            .As<std::optional<std::uint64_t>>()),
+      update_cpu_budget(config[kUpdateCpuBudget].As<double>(1)),
       first_update_mode(
           config[dump::kDump][kFirstUpdateMode].As<FirstUpdateMode>(
               FirstUpdateMode::kSkip)),
@@ -161,6 +163,10 @@ Config::Config(const yaml_config::YamlConfig& config,
       updates_enabled(config[kUpdatesEnabled].As<bool>(true)),
       alert_on_failing_to_update_times(
           config[kAlertOnFailingToUpdateTimes].As<size_t>(0)) {
+  if (update_cpu_budget <= 0 || update_cpu_budget > 1) {
+    throw ConfigError(fmt::format("{} must be in (0, 1] at '{}'",
+                                  kUpdateCpuBudget, config.GetPath()));
+  }
   switch (allowed_update_types) {
     case AllowedUpdateTypes::kFullAndIncremental:
       if (!update_interval.count() || !full_update_interval.count()) {
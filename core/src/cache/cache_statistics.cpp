@@ -1,5 +1,6 @@
 #include <userver/cache/cache_statistics.hpp>
 
+#include <engine/task/task_context.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -27,6 +28,13 @@ std::int64_t TimeStampToMillisecondsFromNow(
   return std::chrono::duration_cast<std::chrono::milliseconds>(diff).count();
 }
 
+// Only the CPU time of the task that runs the update is accounted, the tasks
+// it starts are not
+std::chrono::nanoseconds GetCurrentTaskCpuTime() {
+  auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  return context ? context->GetCpuTime() : std::chrono::nanoseconds{0};
+}
+
 void CombineStatistics(const impl::UpdateStatistics& a,
                        const impl::UpdateStatistics& b,
                        impl::UpdateStatistics& result) {
@@ -46,6 +54,8 @@ void CombineStatistics(const impl::UpdateStatistics& a,
                b.last_successful_update_start_time.load());
   result.last_update_duration =
       std::max(a.last_update_duration.load(), b.last_update_duration.load());
+  result.last_update_cpu_time =
+      std::max(a.last_update_cpu_time.load(), b.last_update_cpu_time.load());
 }
 
 }  // namespace
@@ -74,6 +84,7 @@ void DumpMetric(utils::statistics::Writer& writer,
         std::chrono::duration_cast<std::chrono::milliseconds>(
             stats.last_update_duration.load())
             .count();
+    age["last-update-cpu-time-ms"] = stats.last_update_cpu_time.load().count();
   }
 }
 
@@ -99,7 +110,8 @@ UpdateStatisticsScope::UpdateStatisticsScope(impl::Statistics& stats,
       update_stats_(type == cache::UpdateType::kIncremental
                         ? stats.incremental_update
                         : stats.full_update),
-      update_start_time_(utils::datetime::SteadyNow()) {
+      update_start_time_(utils::datetime::SteadyNow()),
+      update_start_cpu_time_(GetCurrentTaskCpuTime()) {
   update_stats_.last_update_start_time = update_start_time_;
   ++update_stats_.update_attempt_count;
 }
@@ -150,6 +162,11 @@ void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   update_stats_.last_update_duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(update_stop_time -
                                                             update_start_time_);
+  // Finish may be called from another task, which has its own CPU time
+  update_stats_.last_update_cpu_time =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::max(GetCurrentTaskCpuTime() - update_start_cpu_time_,
+                   std::chrono::nanoseconds{0}));
 
   state_ = new_state;
 }
@@ -13,6 +13,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/atomic.hpp>
+#include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/statistics/metadata.hpp>
 
@@ -377,6 +378,7 @@ void CacheUpdateTrait::Impl::DoUpdate(UpdateType update_type,
   tracing::Span::CurrentSpan().AddTag("update_type",
                                       std::string{update_type_str});
 
+  const utils::CpuBudgetScope cpu_budget{static_config_.update_cpu_budget};
   UpdateStatisticsScope stats(statistics_, update_type);
   LOG_INFO() << "Updating cache update_type=" << update_type_str
              << " name=" << name_;
@@ -57,6 +57,14 @@ properties:
         type: boolean
         description: whether to include Update execution time in update-interval
         defaultDescription: false
+    update-cpu-budget:
+        type: number
+        description: |
+            the share of a CPU core that an update may use at the yield points
+            of utils::CpuRelax, in (0, 1]
+        defaultDescription: 1
+        minimum: 0
+        maximum: 1
     has-pre-assign-check:
         type: boolean
         description: |
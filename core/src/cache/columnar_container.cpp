@@ -0,0 +1,95 @@
+#include <userver/cache/columnar_container.hpp>
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl::columnar {
+
+namespace {
+
+constexpr std::size_t kBlockSize = 64 * 1024;
+
+// Larger strings are stored in blocks of their own to not waste the free space
+// of the current block
+constexpr std::size_t kMaxSharedBlockString = kBlockSize / 4;
+
+}  // namespace
+
+StringPool::StringPool(const StringPool& other)
+    : blocks_(other.blocks_),
+      arena_bytes_(other.arena_bytes_),
+      strings_(other.strings_),
+      ids_(other.ids_) {}
+
+StringPool::StringPool(StringPool&& other) noexcept
+    : blocks_(std::move(other.blocks_)),
+      free_space_(std::exchange(other.free_space_, nullptr)),
+      free_size_(std::exchange(other.free_size_, 0)),
+      arena_bytes_(std::exchange(other.arena_bytes_, 0)),
+      strings_(std::move(other.strings_)),
+      ids_(std::move(other.ids_)) {}
+
+StringPool& StringPool::operator=(const StringPool& other) {
+  if (this == &other) return *this;
+  *this = StringPool{other};
+  return *this;
+}
+
+StringPool& StringPool::operator=(StringPool&& other) noexcept {
+  if (this == &other) return *this;
+  blocks_ = std::move(other.blocks_);
+  free_space_ = std::exchange(other.free_space_, nullptr);
+  free_size_ = std::exchange(other.free_size_, 0);
+  arena_bytes_ = std::exchange(other.arena_bytes_, 0);
+  strings_ = std::move(other.strings_);
+  ids_ = std::move(other.ids_);
+  return *this;
+}
+
+StringPool::Id StringPool::Intern(std::string_view str) {
+  const auto it = ids_.find(str);
+  if (it != ids_.end()) return it->second;
+
+  UINVARIANT(strings_.size() < std::numeric_limits<Id>::max(),
+             "Too many unique strings in the pool");
+  const auto id = static_cast<Id>(strings_.size());
+  const auto stored = Store(str);
+  strings_.push_back(stored);
+  ids_.emplace(stored, id);
+  return id;
+}
+
+std::string_view StringPool::Store(std::string_view str) {
+  if (str.empty()) return {};
+
+  if (str.size() > kMaxSharedBlockString) {
+    std::shared_ptr<char[]> block{new char[str.size()]};
+    std::memcpy(block.get(), str.data(), str.size());
+    blocks_.push_back(std::move(block));
+    arena_bytes_ += str.size();
+    return {blocks_.back().get(), str.size()};
+  }
+
+  if (str.size() > free_size_) {
+    std::shared_ptr<char[]> block{new char[kBlockSize]};
+    free_space_ = block.get();
+    free_size_ = kBlockSize;
+    blocks_.push_back(std::move(block));
+    arena_bytes_ += kBlockSize;
+  }
+
+  // The copies of the pool never write to the blocks they share, the free
+  // space of a block belongs to the pool that has allocated it
+  std::memcpy(free_space_, str.data(), str.size());
+  const std::string_view stored{free_space_, str.size()};
+  free_space_ += str.size();
+  free_size_ -= str.size();
+  return stored;
+}
+
+}  // namespace cache::impl::columnar
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#include <userver/cache/columnar_container.hpp>
+
+#include <string>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// A wide row with a few low-cardinality string columns, typical for
+// dictionaries cached from PostgreSQL
+struct Row {
+  int id;
+  std::string name;
+  std::string country;
+  std::string status;
+  std::string description;
+  double score;
+};
+
+constexpr std::size_t kStatus = 3;
+
+Row MakeRow(int i) {
+  return {i, "name-" + std::to_string(i), "country-" + std::to_string(i % 200),
+          i % 2 ? "active" : "disabled",
+          "a description of category " + std::to_string(i % 1000),
+          i * 0.5};
+}
+
+void cache_unordered_map_build(benchmark::State& state) {
+  const auto size = static_cast<int>(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    std::unordered_map<int, Row> rows;
+    rows.reserve(size);
+    for (int i = 0; i < size; ++i) rows.insert_or_assign(i, MakeRow(i));
+    benchmark::DoNotOptimize(rows);
+  }
+}
+
+void cache_columnar_build(benchmark::State& state) {
+  const auto size = static_cast<int>(state.range(0));
+  std::size_t arena_bytes = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    cache::ColumnarContainer<int, Row> rows;
+    rows.reserve(size);
+    for (int i = 0; i < size; ++i) rows.insert_or_assign(i, MakeRow(i));
+    arena_bytes = rows.GetStringsArenaBytes();
+    benchmark::DoNotOptimize(rows);
+  }
+  state.counters["arena_bytes"] = arena_bytes;
+}
+
+void cache_unordered_map_find(benchmark::State& state) {
+  const auto size = static_cast<int>(state.range(0));
+  std::unordered_map<int, Row> rows;
+  for (int i = 0; i < size; ++i) rows.insert_or_assign(i, MakeRow(i));
+
+  int i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(rows.find(++i % size)->second.status.size());
+  }
+}
+
+void cache_columnar_find(benchmark::State& state) {
+  const auto size = static_cast<int>(state.range(0));
+  cache::ColumnarContainer<int, Row> rows;
+  for (int i = 0; i < size; ++i) rows.insert_or_assign(i, MakeRow(i));
+
+  int i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(rows.Find(++i % size)->Get<kStatus>().size());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(cache_unordered_map_build)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK(cache_columnar_build)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(cache_unordered_map_find)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK(cache_columnar_find)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+
+USERVER_NAMESPACE_END
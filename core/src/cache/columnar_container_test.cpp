@@ -0,0 +1,90 @@
+#include <userver/cache/columnar_container.hpp>
+
+#include <string>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample ColumnarContainer]
+struct Order {
+  int id;
+  std::string status;
+  std::string region;
+  double price;
+};
+
+using Orders = cache::ColumnarContainer<int, Order>;
+
+constexpr std::size_t kStatus = 1;
+constexpr std::size_t kPrice = 3;
+/// [Sample ColumnarContainer]
+
+}  // namespace
+
+TEST(ColumnarContainer, InsertAndFind) {
+  Orders orders;
+  orders.insert_or_assign(1, {1, "new", "north", 10.5});
+  orders.insert_or_assign(2, {2, "done", "north", 20});
+  orders.insert_or_assign(3, {3, "new", "south", 30});
+
+  EXPECT_EQ(orders.size(), 3);
+  EXPECT_EQ(orders.GetUniqueStringsCount(), 4);
+  EXPECT_FALSE(orders.Find(4));
+
+  const auto row = orders.Find(1);
+  ASSERT_TRUE(row);
+  EXPECT_EQ(row->Get<kStatus>(), "new");
+  EXPECT_EQ(row->Get<kPrice>(), 10.5);
+
+  const auto order = orders.GetRow(2).ToValue();
+  EXPECT_EQ(order.id, 3);
+  EXPECT_EQ(order.status, "new");
+  EXPECT_EQ(order.region, "south");
+  EXPECT_EQ(order.price, 30);
+}
+
+TEST(ColumnarContainer, Assign) {
+  Orders orders;
+  orders.insert_or_assign(1, {1, "new", "north", 10});
+  orders.insert_or_assign(1, {1, "done", "", 15});
+
+  EXPECT_EQ(orders.size(), 1);
+  EXPECT_EQ(orders.Find(1)->Get<kStatus>(), "done");
+  EXPECT_EQ(orders.Find(1)->ToValue().region, "");
+  EXPECT_EQ(orders.Find(1)->Get<kPrice>(), 15);
+}
+
+TEST(ColumnarContainer, LongStrings) {
+  const std::string long_string(100'000, 'a');
+  Orders orders;
+  for (int i = 0; i < 10'000; ++i) {
+    orders.insert_or_assign(i, {i, std::to_string(i), long_string, 0});
+  }
+
+  EXPECT_EQ(orders.GetUniqueStringsCount(), 10'001);
+  EXPECT_EQ(orders.Find(1234)->Get<kStatus>(), "1234");
+  EXPECT_EQ(orders.Find(9999)->ToValue().region, long_string);
+}
+
+TEST(ColumnarContainer, Copy) {
+  Orders orders;
+  orders.insert_or_assign(1, {1, "new", "north", 10});
+
+  auto copy = orders;
+  copy.insert_or_assign(2, {2, "done", "south", 20});
+  orders.insert_or_assign(3, {3, "cancelled", "west", 30});
+
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.Find(1)->Get<kStatus>(), "new");
+  EXPECT_EQ(copy.Find(2)->Get<kStatus>(), "done");
+  EXPECT_FALSE(copy.Find(3));
+
+  EXPECT_EQ(orders.size(), 2);
+  EXPECT_EQ(orders.Find(3)->Get<kStatus>(), "cancelled");
+  EXPECT_FALSE(orders.Find(2));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/cache/indexed_container.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample IndexedContainer]
+struct User {
+  int id;
+  std::string phone;
+  int region;
+};
+
+using Users = cache::IndexedContainer<int, User,
+                                      cache::HashIndex<&User::phone>,
+                                      cache::SortedIndex<&User::region>>;
+
+constexpr std::size_t kByPhone = 0;
+constexpr std::size_t kByRegion = 1;
+/// [Sample IndexedContainer]
+
+std::vector<int> Ids(const Users::ValuesRange& range) {
+  std::vector<int> result;
+  for (const auto& user : range) result.push_back(user.id);
+  return result;
+}
+
+Users MakeUsers() {
+  Users users;
+  users.insert_or_assign(1, {1, "111", 10});
+  users.insert_or_assign(2, {2, "222", 20});
+  users.insert_or_assign(3, {3, "333", 10});
+  users.insert_or_assign(4, {4, "444", 30});
+  users.OnWritesDone();
+  return users;
+}
+
+}  // namespace
+
+UTEST(IndexedContainer, Lookups) {
+  const auto users = MakeUsers();
+  EXPECT_EQ(users.size(), 4);
+
+  ASSERT_NE(users.Find(2), nullptr);
+  EXPECT_EQ(users.Find(2)->phone, "222");
+  EXPECT_EQ(users.Find(5), nullptr);
+
+  EXPECT_EQ(Ids(users.FindAll<kByPhone>("333")), std::vector{3});
+  EXPECT_TRUE(users.FindAll<kByPhone>("555").empty());
+
+  EXPECT_EQ(Ids(users.FindAll<kByRegion>(10)), (std::vector{1, 3}));
+  EXPECT_EQ(Ids(users.FindRange<kByRegion>(15, 31)), (std::vector{2, 4}));
+  EXPECT_TRUE(users.FindRange<kByRegion>(11, 20).empty());
+}
+
+UTEST(IndexedContainer, Update) {
+  auto users = MakeUsers();
+  users.insert_or_assign(1, {1, "111", 20});
+  users.insert_or_assign(5, {5, "111", 20});
+  users.OnWritesDone();
+
+  EXPECT_EQ(users.size(), 5);
+  EXPECT_EQ(Ids(users.FindAll<kByPhone>("111")), (std::vector{1, 5}));
+  EXPECT_EQ(Ids(users.FindAll<kByRegion>(10)), std::vector{3});
+  EXPECT_EQ(Ids(users.FindAll<kByRegion>(20)), (std::vector{1, 2, 5}));
+}
+
+UTEST(IndexedContainer, Erase) {
+  auto users = MakeUsers();
+  EXPECT_EQ(users.erase(1), 1);
+  EXPECT_EQ(users.erase(1), 0);
+  users.OnWritesDone();
+
+  EXPECT_EQ(users.size(), 3);
+  EXPECT_EQ(users.Find(1), nullptr);
+  ASSERT_NE(users.Find(4), nullptr);
+  EXPECT_EQ(users.Find(4)->phone, "444");
+  EXPECT_TRUE(users.FindAll<kByPhone>("111").empty());
+  EXPECT_EQ(Ids(users.FindAll<kByRegion>(30)), std::vector{4});
+}
+
+UTEST_MT(IndexedContainer, ManyValues, 4) {
+  constexpr int kCount = 10000;
+  Users users;
+  users.reserve(kCount);
+  for (int i = 0; i < kCount; ++i) {
+    users.insert_or_assign(i, {i, std::to_string(i), i % 100});
+  }
+  users.OnWritesDone();
+
+  EXPECT_EQ(Ids(users.FindAll<kByPhone>("1234")), std::vector{1234});
+  EXPECT_EQ(users.FindAll<kByRegion>(42).size(), kCount / 100);
+  EXPECT_EQ(users.FindRange<kByRegion>(0, 100).size(), kCount);
+}
+
+USERVER_NAMESPACE_END
@@ -73,6 +73,28 @@ properties:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
         defaultDescription: true
+    policy:
+        type: string
+        description: |
+            eviction policy, 'tinylfu' protects frequently used keys from
+            being evicted by the scans of rarely used ones
+        defaultDescription: lru
+        enum:
+          - lru
+          - tinylfu
+    buffered-reads:
+        type: boolean
+        description: |
+            look up values without locking the way exclusively, the recency
+            of the values is updated in batches
+        defaultDescription: false
+    key-filter-update-interval:
+        type: string
+        description: |
+            enables a Bloom filter of the existing keys that is rebuilt with
+            this interval, the keys that are absent from the filter are not
+            looked up by DoGetByKey
+        defaultDescription: disabled
 )");
 }
 
@@ -66,6 +66,17 @@ TEST(StaticConfigValidator, ValidConfig) {
       std::string{kStaticConfig})["components_manager"]["components"]);
 }
 
+TEST(StaticConfigValidator, KeyFilter) {
+  const std::string kStaticConfigWithKeyFilter = R"(
+example-cache:
+    size: 1
+    ways: 1
+    key-filter-update-interval: 1m
+)";
+  UEXPECT_NO_THROW(ValidateExampleCacheConfig(
+      formats::yaml::FromString(kStaticConfigWithKeyFilter)));
+}
+
 TEST(StaticConfigValidator, InvalidFieldName) {
   const std::string kInvalidStaticConfig = R"(
 example-cache:
@@ -6,6 +6,8 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +20,7 @@ constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kPolicy = "policy";
 
 }  // namespace
 
@@ -54,11 +57,26 @@ LruCacheConfig Parse(const formats::json::Value& value,
   return LruCacheConfig{value};
 }
 
+CachePolicy Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<CachePolicy>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(CachePolicy::kLRU, "lru")
+        .Case(CachePolicy::kTinyLFU, "tinylfu");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
 LruCacheConfigStatic::LruCacheConfigStatic(
     const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
-      use_dynamic_config(config["config-settings"].As<bool>(true)) {
+      use_dynamic_config(config["config-settings"].As<bool>(true)),
+      buffered_reads(config["buffered-reads"].As<bool>(false)),
+      policy(config[kPolicy].As<CachePolicy>(CachePolicy::kLRU)),
+      key_filter_update_interval(
+          config["key-filter-update-interval"]
+              .As<std::optional<std::chrono::milliseconds>>()) {
   if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
 }
 
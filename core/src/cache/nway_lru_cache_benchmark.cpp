@@ -0,0 +1,63 @@
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Cache = cache::NWayLRU<unsigned, unsigned>;
+
+constexpr std::size_t kWays = 16;
+constexpr unsigned kKeysCount = 1024;
+
+// All the gets are hits, the keys are spread over all the ways
+void nway_lru_get_hit(benchmark::State& state, bool buffered_reads) {
+  engine::RunStandalone(state.range(0), [&] {
+    Cache cache(kWays, kKeysCount / kWays * 2);
+    cache.SetBufferedReads(buffered_reads);
+    for (unsigned i = 0; i < kKeysCount; ++i) cache.Put(i, i);
+
+    const std::size_t concurrent_jobs = state.range(0);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        unsigned i = thread_id;
+        while (keep_running) {
+          benchmark::DoNotOptimize(cache.Get(++i % kKeysCount));
+        }
+      }));
+    }
+
+    unsigned i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(cache.Get(++i % kKeysCount));
+    }
+
+    keep_running = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(nway_lru_get_hit, locked, false)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_CAPTURE(nway_lru_get_hit, buffered, true)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <userver/utest/utest.hpp>
 
+#include <vector>
+
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -54,6 +57,66 @@ UTEST(NWayLRU, SetMultipleWays) {
   EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, BufferedReads) {
+  Cache cache(1, 2);
+  cache.SetBufferedReads(true);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  // The buffered hit of the key 1 is applied before the eviction
+  EXPECT_EQ(1, cache.Get(1));
+  cache.Put(3, 3);
+
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_FALSE(cache.Get(2).has_value());
+  EXPECT_EQ(3, cache.Get(3));
+
+  EXPECT_FALSE(cache.Get(3, [](int) { return false; }).has_value());
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+UTEST_MT(NWayLRU, BufferedReadsConcurrent, 4) {
+  constexpr int kKeys = 64;
+  Cache cache(2, kKeys / 4);
+  cache.SetBufferedReads(true);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int task_id = 0; task_id < 4; ++task_id) {
+    tasks.push_back(engine::AsyncNoSpan([&cache, task_id] {
+      for (int i = 0; i < 10000; ++i) {
+        const int key = (i * 7 + task_id) % kKeys;
+        if (i % 10 == task_id) {
+          cache.Put(key, key);
+        } else if (const auto value = cache.Get(key)) {
+          EXPECT_EQ(*value, key);
+        }
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_LE(cache.GetSize(), kKeys / 2);
+}
+
+UTEST(NWayLRU, TinyLfu) {
+  Cache cache(2, 50, cache::CachePolicy::kTinyLFU);
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 20; ++i) {
+      if (!cache.Get(i)) cache.Put(i, i);
+    }
+  }
+
+  // The scan of new keys does not evict the frequently used ones
+  for (int i = 1000; i < 2000; ++i) cache.Put(i, i);
+  for (int i = 0; i < 20; ++i) EXPECT_EQ(i, cache.Get(i));
+
+  cache.SetBufferedReads(true);
+  EXPECT_EQ(1, cache.Get(1));
+  cache.Put(1, 2);
+  EXPECT_EQ(2, cache.Get(1));
+}
+
 UTEST(NWayLRU, HashCombine) {
   for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
     /// @note: checking for seed used in way selection to not be equal after
@@ -1,5 +1,8 @@
 #include <userver/clients/dns/component.hpp>
 
+#include <optional>
+#include <string_view>
+
 #include <userver/clients/dns/config.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
@@ -15,6 +18,27 @@ namespace clients::dns {
 namespace {
 
 constexpr std::string_view kDnsReplySource = "dns_reply_source";
+constexpr std::string_view kDnsHost = "dns_host";
+
+void WriteCounters(utils::statistics::Writer& writer,
+                   const Resolver::LookupSourceCounters& counters,
+                   std::optional<std::string_view> host = std::nullopt) {
+  const auto write = [&writer, &host](const auto& value,
+                                      std::string_view source) {
+    if (host) {
+      writer.ValueWithLabels(value,
+                             {{kDnsHost, *host}, {kDnsReplySource, source}});
+    } else {
+      writer.ValueWithLabels(value, {kDnsReplySource, source});
+    }
+  };
+  write(counters.file, "file");
+  write(counters.cached, "cached");
+  write(counters.cached_stale, "cached-stale");
+  write(counters.cached_failure, "cached-failure");
+  write(counters.network, "network");
+  write(counters.network_failure, "network-failure");
+}
 
 ResolverConfig ParseResolverConfig(
     const components::ComponentConfig& component_config) {
@@ -34,14 +58,21 @@ ResolverConfig ParseResolverConfig(
           config.network_custom_servers);
   config.cache_ways =
       component_config["cache-ways"].As<size_t>(config.cache_ways);
-  config.cache_size_per_way = component_config["cache_size_per_way"].As<size_t>(
+  config.cache_size_per_way = component_config["cache-size-per-way"].As<size_t>(
       config.cache_size_per_way);
   config.cache_max_reply_ttl =
-      component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(
+      component_config["cache-max-reply-ttl"].As<std::chrono::milliseconds>(
           config.cache_max_reply_ttl);
   config.cache_failure_ttl =
-      component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
+      component_config["cache-failure-ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_prefetch_share =
+      component_config["cache-prefetch-percent"].As<double>(
+          config.cache_prefetch_share * 100) /
+      100;
+  config.host_metrics_max_size =
+      component_config["host-metrics-max-size"].As<size_t>(
+          config.host_metrics_max_size);
   return config;
 }
 
@@ -62,16 +93,13 @@ Component::Component(const components::ComponentConfig& config,
 clients::dns::Resolver& Component::GetResolver() { return resolver_; }
 
 void Component::Write(utils::statistics::Writer& writer) {
-  const auto& counters = GetResolver().GetLookupSourceCounters();
-  writer.ValueWithLabels(counters.file, {kDnsReplySource, "file"});
-  writer.ValueWithLabels(counters.cached, {kDnsReplySource, "cached"});
-  writer.ValueWithLabels(counters.cached_stale,
-                         {kDnsReplySource, "cached-stale"});
-  writer.ValueWithLabels(counters.cached_failure,
-                         {kDnsReplySource, "cached-failure"});
-  writer.ValueWithLabels(counters.network, {kDnsReplySource, "network"});
-  writer.ValueWithLabels(counters.network_failure,
-                         {kDnsReplySource, "network-failure"});
+  WriteCounters(writer, GetResolver().GetLookupSourceCounters());
+
+  auto hosts_writer = writer["hosts"];
+  for (const auto& [host, counters] :
+       GetResolver().GetHostLookupSourceCounters()) {
+    WriteCounters(hosts_writer, *counters, host);
+  }
 }
 
 yaml_config::Schema Component::GetStaticConfigSchema() {
@@ -122,6 +150,22 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-prefetch-percent:
+        type: number
+        description: |
+            percent of the reply TTL before the expiration to start the
+            background update of the cached reply at
+        defaultDescription: 10
+        minimum: 0
+        maximum: 100
+    host-metrics-max-size:
+        type: integer
+        description: |
+            max number of hosts to report the metrics for, the hosts that
+            were not resolved for a minute are replaced with the new ones,
+            0 disables the per-host metrics
+        defaultDescription: 100
+        minimum: 0
 )");
 }
 
@@ -24,6 +24,13 @@ USERVER_NAMESPACE_BEGIN
 namespace clients::dns {
 namespace {
 
+// A host that was not looked up for this long gives its place in the per-host
+// counters to a new one
+constexpr std::chrono::minutes kHostCountersIdleTimeout{1};
+
+// The lookups of the untracked hosts look for an idle host at most this often
+constexpr std::chrono::seconds kHostCountersEvictionInterval{1};
+
 std::optional<engine::io::Sockaddr> ParseIpV4Addr(const std::string& ip) {
   // inet_pton accepts formats other than ddd.ddd.ddd.ddd on some systems
   // so additional checks are necessary.
@@ -146,6 +153,7 @@ class Resolver::Impl {
   ~Impl();
 
   const LookupSourceCounters& GetLookupSourceCounters() const;
+  const HostLookupSourceCounters& GetHostLookupSourceCounters() const;
 
   void ReloadHosts();
   void FlushNetworkCache();
@@ -155,7 +163,7 @@ class Resolver::Impl {
   NetCacheResult QueryNetCache(const std::string& name);
 
   auto GetUpdateMutex(const std::string& name);
-  void AccountNetUpdateFailure();
+  void AccountNetUpdateFailure(const std::string& name);
 
   template <typename Mutex>
   AddrVector DoForegroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
@@ -167,12 +175,20 @@ class Resolver::Impl {
                             const std::string& name);
 
  private:
+  using Counter = utils::statistics::RelaxedCounter<size_t>;
+
   struct NetCacheEntry {
     AddrVector addrs;
     std::chrono::steady_clock::time_point expiration;
     bool is_failure{false};
+    // The time to start the background update at
+    std::chrono::steady_clock::time_point update_time{};
   };
 
+  void Account(const std::string& name, Counter LookupSourceCounters::*counter);
+  std::shared_ptr<HostCounters> AddHostCounters(
+      const std::string& name, std::chrono::steady_clock::time_point now);
+
   template <typename Mutex>
   void MoveQueryToBackground(std::unique_lock<Mutex>& lock, Mutex&& mutex,
                              engine::Future<NetResolver::Response>&& future,
@@ -185,11 +201,15 @@ class Resolver::Impl {
                        FailureMode failure_mode);
 
   LookupSourceCounters source_counters_;
+  HostLookupSourceCounters host_source_counters_;
+  const size_t host_metrics_max_size_;
+  std::atomic<std::chrono::steady_clock::time_point> next_host_eviction_{};
   FileResolver file_resolver_;
   NetResolver net_resolver_;
   const std::chrono::milliseconds net_cache_update_margin_;
   const std::chrono::milliseconds net_cache_max_reply_ttl_;
   const std::chrono::milliseconds net_cache_failure_ttl_;
+  const double net_cache_prefetch_share_;
   cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
   concurrent::MutexSet<std::string> net_cache_update_mutexes_;
   utils::impl::WaitTokenStorage wait_token_storage_;
@@ -197,13 +217,15 @@ class Resolver::Impl {
 
 Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
                      const ResolverConfig& config)
-    : file_resolver_{fs_task_processor, config.file_path,
+    : host_metrics_max_size_{config.host_metrics_max_size},
+      file_resolver_{fs_task_processor, config.file_path,
                      config.file_update_interval},
       net_resolver_{fs_task_processor, config.network_timeout,
                     config.network_attempts, config.network_custom_servers},
       net_cache_update_margin_{config.network_timeout},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_prefetch_share_{config.cache_prefetch_share},
       net_cache_{config.cache_ways, config.cache_size_per_way},
       net_cache_update_mutexes_(config.cache_ways) {}
 
@@ -214,6 +236,56 @@ const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
   return source_counters_;
 }
 
+const Resolver::HostLookupSourceCounters&
+Resolver::Impl::GetHostLookupSourceCounters() const {
+  return host_source_counters_;
+}
+
+void Resolver::Impl::Account(const std::string& name,
+                             Counter LookupSourceCounters::*counter) {
+  ++(source_counters_.*counter);
+  if (host_metrics_max_size_ == 0) return;
+
+  const auto now = utils::datetime::MockSteadyNow();
+  auto host_counters = host_source_counters_.Get(name);
+  if (!host_counters) host_counters = AddHostCounters(name, now);
+  if (!host_counters) return;
+
+  ++((*host_counters).*counter);
+  host_counters->last_lookup.store(now, std::memory_order_relaxed);
+}
+
+std::shared_ptr<Resolver::HostCounters> Resolver::Impl::AddHostCounters(
+    const std::string& name, std::chrono::steady_clock::time_point now) {
+  if (host_source_counters_.SizeApprox() >= host_metrics_max_size_) {
+    // Every write copies the map, so a stream of new hosts must not turn into
+    // a stream of evictions
+    auto next_eviction = next_host_eviction_.load(std::memory_order_relaxed);
+    if (now < next_eviction ||
+        !next_host_eviction_.compare_exchange_strong(
+            next_eviction, now + kHostCountersEvictionInterval)) {
+      return {};
+    }
+
+    std::optional<std::string> lru_host;
+    auto lru_last_lookup = now - kHostCountersIdleTimeout;
+    for (const auto& [host, counters] : host_source_counters_) {
+      const auto last_lookup =
+          counters->last_lookup.load(std::memory_order_relaxed);
+      if (last_lookup <= lru_last_lookup) {
+        lru_host = host;
+        lru_last_lookup = last_lookup;
+      }
+    }
+    if (!lru_host) return {};
+    host_source_counters_.Erase(*lru_host);
+  }
+
+  auto host_counters = host_source_counters_.TryEmplace(name).value;
+  host_counters->last_lookup.store(now, std::memory_order_relaxed);
+  return host_counters;
+}
+
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
 void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
@@ -225,7 +297,7 @@ void Resolver::Impl::FlushNetworkCache(const std::string& name) {
 AddrVector Resolver::Impl::QueryFileCache(const std::string& name) {
   auto addrs = file_resolver_.Resolve(name);
   if (!addrs.empty()) {
-    ++source_counters_.file;
+    Account(name, &LookupSourceCounters::file);
   }
   return addrs;
 }
@@ -240,7 +312,7 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
 
   if (cached->is_failure) {
     if (cached->expiration >= now) {
-      ++source_counters_.cached_failure;
+      Account(name, &LookupSourceCounters::cached_failure);
       result.status = NetCacheResult::Status::kHitFailure;
     }
     return result;
@@ -248,12 +320,12 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
 
   result.addrs = cached->addrs;
   if (cached->expiration >= now) {
-    ++source_counters_.cached;
+    Account(name, &LookupSourceCounters::cached);
   } else {
-    ++source_counters_.cached_stale;
+    Account(name, &LookupSourceCounters::cached_stale);
   }
 
-  if (cached->expiration - now >= net_cache_update_margin_) {
+  if (now < cached->update_time) {
     result.status = NetCacheResult::Status::kHitReply;
   } else {
     result.status = NetCacheResult::Status::kHitReplyWithUpdate;
@@ -266,8 +338,8 @@ auto Resolver::Impl::GetUpdateMutex(const std::string& name) {
   return net_cache_update_mutexes_.GetMutexForKey(name);
 }
 
-void Resolver::Impl::AccountNetUpdateFailure() {
-  ++source_counters_.network_failure;
+void Resolver::Impl::AccountNetUpdateFailure(const std::string& name) {
+  Account(name, &LookupSourceCounters::network_failure);
 }
 
 template <typename Mutex>
@@ -353,7 +425,7 @@ void Resolver::Impl::FinishNetUpdate(
                                              net_cache_failure_ttl_,
                                          true});
     }
-    ++source_counters_.network_failure;
+    Account(name, &LookupSourceCounters::network_failure);
     throw;
   }
 
@@ -364,13 +436,18 @@ void Resolver::Impl::FinishNetUpdate(
   if (addrs) *addrs = response.addrs;
   if (effective_ttl.count() > 0) {
     LOG_TRACE() << "Updating cache for '" << name << '\'';
-    net_cache_.Put(
-        name, NetCacheEntry{std::move(response.addrs),
-                            utils::datetime::MockSteadyNow() + effective_ttl});
+    // Hot records are updated in background before they expire
+    const auto update_margin = std::max<std::chrono::milliseconds>(
+        net_cache_update_margin_,
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            effective_ttl * net_cache_prefetch_share_));
+    const auto expiration = utils::datetime::MockSteadyNow() + effective_ttl;
+    net_cache_.Put(name, NetCacheEntry{std::move(response.addrs), expiration,
+                                       false, expiration - update_margin});
   } else {
     LOG_TRACE() << "Skipping cache update for '" << name << '\'';
   }
-  ++source_counters_.network;
+  Account(name, &LookupSourceCounters::network);
 }
 
 Resolver::Resolver(engine::TaskProcessor& fs_task_processor,
@@ -418,7 +495,7 @@ AddrVector Resolver::Resolve(const std::string& name,
       lock.lock();
     }
     if (!lock) {
-      impl_->AccountNetUpdateFailure();
+      impl_->AccountNetUpdateFailure(name);
       throw NotResolvedException{"Resolving '" + name + "' timed out (lock)"};
     }
 
@@ -448,6 +525,11 @@ const Resolver::LookupSourceCounters& Resolver::GetLookupSourceCounters()
   return impl_->GetLookupSourceCounters();
 }
 
+const Resolver::HostLookupSourceCounters&
+Resolver::GetHostLookupSourceCounters() const {
+  return impl_->GetHostLookupSourceCounters();
+}
+
 void Resolver::ReloadHosts() { impl_->ReloadHosts(); }
 
 void Resolver::FlushNetworkCache() { impl_->FlushNetworkCache(); }
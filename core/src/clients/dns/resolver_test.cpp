@@ -58,7 +58,8 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
   using ServerMock = utest::DnsServerMock;
 
-  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way,
+                 size_t host_metrics_max_size = 100)
       : hosts_file{[] {
           auto file = fs::blocking::TempFile::Create();
           fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -87,6 +88,7 @@ struct MockedResolver {
               config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl},
               config.cache_ways = 1;
               config.cache_size_per_way = cache_size_per_way;
+              config.host_metrics_max_size = host_metrics_max_size;
               config.network_custom_servers = {server_mock.GetServerAddress()};
               return config;
             }()} {}
@@ -371,6 +373,87 @@ UTEST(Resolver, CacheOverflow) {
   EXPECT_EQ(counters.network_failure, 0);
 }
 
+UTEST(Resolver, HostCounters) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 2};
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                        (Expected{kNetV6String, kNetV4String}));
+  }
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("second", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  EXPECT_PRED_FORMAT2(CheckAddrs,
+                      resolver->Resolve("mycomputer", test_deadline),
+                      (Expected{"::1", "127.0.0.1"}));
+
+  const auto& host_counters = resolver->GetHostLookupSourceCounters();
+  EXPECT_EQ(host_counters.SizeApprox(), 3);
+
+  const auto first = host_counters.Get("first");
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first->cached, 2);
+  EXPECT_EQ(first->network, 1);
+
+  const auto second = host_counters.Get("second");
+  ASSERT_TRUE(second);
+  EXPECT_EQ(second->cached, 0);
+  EXPECT_EQ(second->network, 1);
+
+  const auto file = host_counters.Get("mycomputer");
+  ASSERT_TRUE(file);
+  EXPECT_EQ(file->file, 1);
+  EXPECT_EQ(file->network, 0);
+}
+
+UTEST(Resolver, HostCountersEviction) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 2, 1};
+  const auto& host_counters = resolver->GetHostLookupSourceCounters();
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("second", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  // "first" is not idle yet
+  EXPECT_TRUE(host_counters.Get("first"));
+  EXPECT_FALSE(host_counters.Get("second"));
+
+  utils::datetime::MockSleep(std::chrono::minutes{2});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("second", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  EXPECT_FALSE(host_counters.Get("first"));
+  const auto second = host_counters.Get("second");
+  ASSERT_TRUE(second);
+  EXPECT_EQ(second->cached, 1);
+  EXPECT_EQ(host_counters.SizeApprox(), 1);
+
+  // Total counters are not affected by the eviction
+  const auto& counters = resolver->GetLookupSourceCounters();
+  EXPECT_EQ(counters.network, 2);
+  EXPECT_EQ(counters.cached, 1);
+
+  utils::datetime::MockNowUnset();
+}
+
+UTEST(Resolver, HostCountersDisabled) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 2, 0};
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  EXPECT_EQ(resolver->GetHostLookupSourceCounters().SizeApprox(), 0);
+  EXPECT_EQ(resolver->GetLookupSourceCounters().network, 1);
+}
+
 UTEST(Resolver, CacheStale) {
   const auto test_deadline =
       engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
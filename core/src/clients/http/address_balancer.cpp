@@ -0,0 +1,219 @@
+#include <clients/http/address_balancer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// The weight of the latest latency in the average one
+constexpr double kLatencyWeight = 0.2;
+// Limits the growth of the ejection time
+constexpr std::size_t kMaxEjectionsMultiplier = 10;
+
+}  // namespace
+
+struct AddressBalancer::AddressState {
+  AddressState(Host& host, std::string address)
+      : host(host), address(std::move(address)) {}
+
+  Host& host;
+  const std::string address;
+
+  std::size_t in_flight{0};
+  double average_latency_us{0};
+  std::size_t consecutive_failures{0};
+  std::size_t ejections{0};
+  Clock::time_point ejected_until{};
+};
+
+struct AddressBalancer::Host {
+  std::vector<std::shared_ptr<AddressState>> addresses;
+};
+
+AddressBalancer::Lease::Lease(AddressBalancer& balancer,
+                              std::shared_ptr<AddressState> state)
+    : balancer_(&balancer), state_(std::move(state)), start_(Clock::now()) {
+  ++state_->in_flight;
+}
+
+AddressBalancer::Lease::Lease(Lease&& other) noexcept
+    : balancer_(other.balancer_),
+      state_(std::move(other.state_)),
+      start_(other.start_) {}
+
+AddressBalancer::Lease& AddressBalancer::Lease::operator=(
+    Lease&& other) noexcept {
+  if (this != &other) {
+    Release(nullptr);
+    balancer_ = other.balancer_;
+    state_ = std::move(other.state_);
+    start_ = other.start_;
+  }
+  return *this;
+}
+
+AddressBalancer::Lease::~Lease() { Release(nullptr); }
+
+const std::string& AddressBalancer::Lease::GetAddress() const {
+  UASSERT(state_);
+  return state_->address;
+}
+
+void AddressBalancer::Lease::Finish(bool is_ok) { Release(&is_ok); }
+
+void AddressBalancer::Lease::Release(const bool* is_ok) noexcept {
+  if (!state_) return;
+
+  const auto now = Clock::now();
+  {
+    const std::lock_guard lock{balancer_->mutex_};
+    UASSERT(state_->in_flight > 0);
+    --state_->in_flight;
+    if (is_ok) {
+      balancer_->Account(
+          *state_,
+          std::chrono::duration_cast<std::chrono::microseconds>(now - start_),
+          *is_ok, now);
+    }
+  }
+  state_.reset();
+}
+
+AddressBalancer::AddressBalancer(impl::LoadBalancingConfig config)
+    : config_(config) {}
+
+AddressBalancer::~AddressBalancer() = default;
+
+AddressBalancer::Lease AddressBalancer::Pick(
+    const std::string& host, const std::vector<std::string>& addresses,
+    std::string_view avoid) {
+  UASSERT(!addresses.empty());
+  const auto now = Clock::now();
+
+  const std::lock_guard lock{mutex_};
+  auto& host_state = hosts_[host];
+
+  // Keep the states of the addresses that are still resolved
+  const bool same_addresses = std::equal(
+      host_state.addresses.begin(), host_state.addresses.end(),
+      addresses.begin(), addresses.end(),
+      [](const auto& state, const auto& address) {
+        return state->address == address;
+      });
+  if (!same_addresses) {
+    // The keys refer to the addresses of the states, which outlive the map
+    std::unordered_map<std::string_view, std::shared_ptr<AddressState>> old;
+    old.reserve(host_state.addresses.size());
+    for (auto& state : host_state.addresses) {
+      const std::string_view address = state->address;
+      old.emplace(address, std::move(state));
+    }
+
+    std::vector<std::shared_ptr<AddressState>> states;
+    states.reserve(addresses.size());
+    for (const auto& address : addresses) {
+      const auto it = old.find(address);
+      // A repeated address gets a state of its own
+      if (it != old.end() && it->second) {
+        states.push_back(std::move(it->second));
+      } else {
+        states.push_back(std::make_shared<AddressState>(host_state, address));
+      }
+    }
+    host_state.addresses = std::move(states);
+  }
+
+  std::vector<AddressState*> candidates;
+  candidates.reserve(host_state.addresses.size());
+  for (const auto& state : host_state.addresses) {
+    if (state->ejected_until <= now && state->address != avoid) {
+      candidates.push_back(state.get());
+    }
+  }
+  if (candidates.empty()) {
+    // All the addresses are ejected or avoided, pick from all of them
+    for (const auto& state : host_state.addresses) {
+      candidates.push_back(state.get());
+    }
+  }
+
+  const auto score = [](const AddressState& state) {
+    return static_cast<double>(state.in_flight + 1) *
+           std::max(state.average_latency_us, 1.0);
+  };
+
+  auto* picked = candidates[utils::RandRange(candidates.size())];
+  if (candidates.size() > 1) {
+    auto second_index = utils::RandRange(candidates.size() - 1);
+    if (candidates[second_index] == picked) {
+      second_index = candidates.size() - 1;
+    }
+    auto* second = candidates[second_index];
+    if (score(*second) < score(*picked)) picked = second;
+  }
+
+  const auto it = std::find_if(
+      host_state.addresses.begin(), host_state.addresses.end(),
+      [picked](const auto& state) { return state.get() == picked; });
+  UASSERT(it != host_state.addresses.end());
+  return Lease{*this, *it};
+}
+
+std::size_t AddressBalancer::GetEjectedCount(const std::string& host) const {
+  const auto now = Clock::now();
+  const std::lock_guard lock{mutex_};
+  const auto it = hosts_.find(host);
+  if (it == hosts_.end()) return 0;
+  return std::count_if(
+      it->second.addresses.begin(), it->second.addresses.end(),
+      [now](const auto& state) { return state->ejected_until > now; });
+}
+
+void AddressBalancer::Account(AddressState& state,
+                              std::chrono::microseconds latency, bool is_ok,
+                              Clock::time_point now) {
+  const auto latency_us = static_cast<double>(latency.count());
+  state.average_latency_us =
+      state.average_latency_us == 0
+          ? latency_us
+          : state.average_latency_us * (1 - kLatencyWeight) +
+                latency_us * kLatencyWeight;
+
+  if (is_ok) {
+    state.consecutive_failures = 0;
+    state.ejections = 0;
+    return;
+  }
+
+  if (++state.consecutive_failures < config_.consecutive_failures) return;
+  // The failures of the requests started before the ejection
+  if (state.ejected_until > now) return;
+
+  const auto& addresses = state.host.addresses;
+  const auto ejected = std::count_if(
+      addresses.begin(), addresses.end(),
+      [now](const auto& other) { return other->ejected_until > now; });
+  const auto max_ejected =
+      static_cast<std::size_t>(addresses.size() * config_.max_ejected_share);
+  if (static_cast<std::size_t>(ejected) >= max_ejected) return;
+
+  state.consecutive_failures = 0;
+  state.ejections = std::min(state.ejections + 1, kMaxEjectionsMultiplier);
+  const auto ejection_time = config_.ejection_time * state.ejections;
+  state.ejected_until = now + ejection_time;
+  LOG_WARNING() << "Ejecting the address " << state.address << " for "
+                << ejection_time.count() << "ms after "
+                << config_.consecutive_failures << " failures in a row";
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
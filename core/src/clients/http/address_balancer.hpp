@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/impl/config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Picks the addresses for the requests to the hosts that resolve to several
+/// addresses. Of two random addresses the one with less requests in flight
+/// per their average latency is picked (the power of two choices). The
+/// addresses that fail several times in a row are not picked for the
+/// ejection time, which grows with each ejection in a row.
+///
+/// Thread-safe.
+class AddressBalancer final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct AddressState;
+
+  /// The request in flight to the picked address
+  class Lease final {
+   public:
+    Lease(Lease&&) noexcept;
+    Lease& operator=(Lease&&) noexcept;
+    ~Lease();
+
+    const std::string& GetAddress() const;
+
+    /// Accounts the outcome and the latency of the request
+    void Finish(bool is_ok);
+
+   private:
+    friend class AddressBalancer;
+
+    Lease(AddressBalancer& balancer, std::shared_ptr<AddressState> state);
+
+    void Release(const bool* is_ok) noexcept;
+
+    AddressBalancer* balancer_;
+    std::shared_ptr<AddressState> state_;
+    Clock::time_point start_;
+  };
+
+  explicit AddressBalancer(impl::LoadBalancingConfig config);
+  ~AddressBalancer();
+
+  /// Picks one of the `addresses` of the `host`, avoids the `avoid` address
+  /// if there are others to pick from
+  Lease Pick(const std::string& host, const std::vector<std::string>& addresses,
+             std::string_view avoid = {});
+
+  /// Returns the count of the addresses of the `host` that are ejected now
+  std::size_t GetEjectedCount(const std::string& host) const;
+
+ private:
+  struct Host;
+
+  void Account(AddressState& state, std::chrono::microseconds latency,
+               bool is_ok, Clock::time_point now);
+
+  const impl::LoadBalancingConfig config_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Host> hosts_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <clients/http/address_balancer.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::AddressBalancer;
+
+const std::string kHost = "example.com:80";
+const std::vector<std::string> kAddresses{"10.0.0.1", "10.0.0.2"};
+
+clients::http::impl::LoadBalancingConfig MakeConfig() {
+  clients::http::impl::LoadBalancingConfig config;
+  config.enabled = true;
+  config.consecutive_failures = 2;
+  return config;
+}
+
+}  // namespace
+
+TEST(AddressBalancer, PicksLessLoaded) {
+  AddressBalancer balancer{MakeConfig()};
+
+  auto first = balancer.Pick(kHost, kAddresses);
+  for (int i = 0; i < 10; ++i) {
+    auto second = balancer.Pick(kHost, kAddresses);
+    EXPECT_NE(second.GetAddress(), first.GetAddress());
+  }
+}
+
+TEST(AddressBalancer, Avoid) {
+  AddressBalancer balancer{MakeConfig()};
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer.Pick(kHost, kAddresses, kAddresses[0]).GetAddress(),
+              kAddresses[1]);
+  }
+  EXPECT_EQ(balancer.Pick(kHost, {kAddresses[0]}, kAddresses[0]).GetAddress(),
+            kAddresses[0]);
+}
+
+TEST(AddressBalancer, Ejection) {
+  AddressBalancer balancer{MakeConfig()};
+  balancer.Pick(kHost, kAddresses).Finish(true);
+
+  auto lease = balancer.Pick(kHost, kAddresses, kAddresses[1]);
+  lease.Finish(false);
+  lease = balancer.Pick(kHost, kAddresses, kAddresses[1]);
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 0);
+  lease.Finish(false);
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 1);
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer.Pick(kHost, kAddresses).GetAddress(), kAddresses[1]);
+  }
+
+  // No more than a half of the addresses are ejected
+  for (int i = 0; i < 4; ++i) {
+    lease = balancer.Pick(kHost, kAddresses);
+    EXPECT_EQ(lease.GetAddress(), kAddresses[1]);
+    lease.Finish(false);
+  }
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 1);
+}
+
+TEST(AddressBalancer, AddressesChange) {
+  AddressBalancer balancer{MakeConfig()};
+
+  for (int i = 0; i < 2; ++i) {
+    balancer.Pick(kHost, kAddresses, kAddresses[1]).Finish(false);
+  }
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 1);
+
+  // The state of the ejected address survives growing and reordering
+  const std::vector<std::string> grown{"10.0.0.3", kAddresses[1],
+                                       kAddresses[0]};
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_NE(balancer.Pick(kHost, grown).GetAddress(), kAddresses[0]);
+  }
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 1);
+
+  const std::vector<std::string> reordered{kAddresses[0], "10.0.0.3",
+                                           "10.0.0.3"};
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer.Pick(kHost, reordered).GetAddress(), "10.0.0.3");
+  }
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 1);
+
+  EXPECT_EQ(balancer.Pick(kHost, {"10.0.0.4"}).GetAddress(), "10.0.0.4");
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 0);
+}
+
+TEST(AddressBalancer, SuccessResetsFailures) {
+  AddressBalancer balancer{MakeConfig()};
+
+  for (int i = 0; i < 3; ++i) {
+    auto lease = balancer.Pick(kHost, kAddresses, kAddresses[1]);
+    lease.Finish(false);
+    lease = balancer.Pick(kHost, kAddresses, kAddresses[1]);
+    lease.Finish(true);
+  }
+  EXPECT_EQ(balancer.GetEjectedCount(kHost), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#include <userver/clients/http/batch.hpp>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+const std::string kBatchSpanName = "http_batch";
+const std::string kBatchSizeTag = "http_batch_size";
+const std::string kBatchFailedTag = "http_batch_failed";
+
+}  // namespace
+
+Batch::Batch(Client& client, std::function<void(Request&)> setup)
+    : client_(client), setup_(std::move(setup)) {}
+
+Batch::~Batch() {
+  for (std::size_t i = 0; i < futures_.size(); ++i) {
+    if (targets_[i]) futures_[i].Cancel();
+  }
+}
+
+Request Batch::CreateRequest() {
+  auto request = client_.CreateRequest();
+  if (setup_) setup_(request);
+  return request;
+}
+
+std::size_t Batch::Add(Request&& request) {
+  UINVARIANT(futures_.empty(), "Batch::Add() called after Batch::Perform()");
+  requests_.push_back(std::move(request));
+  return requests_.size() - 1;
+}
+
+void Batch::Perform() {
+  UINVARIANT(futures_.empty(), "Batch::Perform() called twice");
+  if (requests_.empty()) return;
+
+  span_.emplace(kBatchSpanName);
+  span_->AddTag(kBatchSizeTag, requests_.size());
+
+  // The spans of the requests are the children of the batch span
+  futures_.reserve(requests_.size());
+  for (auto& request : requests_) {
+    futures_.push_back(request.async_perform());
+  }
+  span_->DetachFromCoroStack();
+
+  targets_.reserve(futures_.size());
+  for (auto& future : futures_) {
+    targets_.push_back(future.TryGetContextAccessor());
+  }
+  pending_ = futures_.size();
+}
+
+std::optional<Batch::Result> Batch::WaitAny(engine::Deadline deadline) {
+  if (!pending_) return std::nullopt;
+
+  const auto index = engine::impl::DoWaitAny(targets_, deadline);
+  if (!index) return std::nullopt;
+  return GetResult(*index);
+}
+
+std::vector<Batch::Result> Batch::WaitAll(engine::Deadline deadline) {
+  std::vector<Result> results;
+  results.reserve(pending_);
+  while (auto result = WaitAny(deadline)) {
+    results.push_back(std::move(*result));
+  }
+  return results;
+}
+
+std::size_t Batch::GetSize() const noexcept { return requests_.size(); }
+
+Batch::Result Batch::GetResult(std::size_t index) {
+  UASSERT(targets_[index]);
+  targets_[index] = nullptr;
+  --pending_;
+
+  Result result;
+  result.index = index;
+  try {
+    result.response = futures_[index].Get();
+  } catch (const std::exception&) {
+    result.error = std::current_exception();
+    ++failed_;
+  }
+
+  if (!pending_) {
+    span_->AddTag(kBatchFailedTag, failed_);
+    span_.reset();
+  }
+  return result;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
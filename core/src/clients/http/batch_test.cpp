@@ -0,0 +1,104 @@
+#include <userver/clients/http/batch.hpp>
+
+#include <set>
+#include <string>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::size_t kRequestsCount = 20;
+
+// Responds to `GET /<delay ms>` after the delay with the delay in the body
+HttpResponse DelayCallback(const HttpRequest& request) {
+  const auto path_begin = request.find(' ') + 2;
+  const auto path_end = request.find(' ', path_begin);
+  const auto delay = request.substr(path_begin, path_end - path_begin);
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{std::stoi(delay)});
+
+  return {
+      "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " +
+          std::to_string(delay.size()) + "\r\n\r\n" + delay,
+      HttpResponse::kWriteAndClose};
+}
+
+}  // namespace
+
+UTEST(HttpClientBatch, WaitAll) {
+  const utest::SimpleServer http_server{&DelayCallback};
+  auto http_client = utest::CreateHttpClient();
+
+  /// [Sample HTTP Client batch usage]
+  clients::http::Batch batch{
+      *http_client, [](clients::http::Request& request) {
+        request.retry(1).timeout(utest::kMaxTestWaitTime);
+      }};
+  for (std::size_t i = 0; i < kRequestsCount; ++i) {
+    batch.Add(batch.CreateRequest().get(http_server.GetBaseUrl() + "/0"));
+  }
+  batch.Perform();
+
+  std::set<std::size_t> indices;
+  for (auto& result : batch.WaitAll()) {
+    ASSERT_TRUE(result.response);
+    EXPECT_EQ(result.response->status_code(), 200);
+    indices.insert(result.index);
+  }
+  /// [Sample HTTP Client batch usage]
+
+  EXPECT_EQ(indices.size(), kRequestsCount);
+  EXPECT_EQ(batch.GetPendingCount(), 0);
+  EXPECT_FALSE(batch.WaitAny());
+}
+
+UTEST_MT(HttpClientBatch, CompletionOrder, 2) {
+  const utest::SimpleServer http_server{&DelayCallback};
+  auto http_client = utest::CreateHttpClient();
+
+  clients::http::Batch batch{*http_client};
+  const auto slow = batch.Add(batch.CreateRequest()
+                                  .get(http_server.GetBaseUrl() + "/500")
+                                  .timeout(utest::kMaxTestWaitTime));
+  const auto fast = batch.Add(batch.CreateRequest()
+                                  .get(http_server.GetBaseUrl() + "/0")
+                                  .timeout(utest::kMaxTestWaitTime));
+  batch.Perform();
+  EXPECT_EQ(batch.GetPendingCount(), 2);
+
+  auto result = batch.WaitAny();
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->index, fast);
+  EXPECT_EQ(result->response->body(), "0");
+
+  result = batch.WaitAny();
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->index, slow);
+  EXPECT_EQ(result->response->body(), "500");
+}
+
+UTEST(HttpClientBatch, Errors) {
+  auto http_client = utest::CreateHttpClient();
+
+  clients::http::Batch batch{*http_client};
+  batch.Add(batch.CreateRequest()
+                .get("http://127.0.0.1:1")
+                .retry(1)
+                .timeout(utest::kMaxTestWaitTime));
+  batch.Perform();
+
+  const auto results = batch.WaitAll();
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_FALSE(results[0].response);
+  EXPECT_TRUE(results[0].error);
+}
+
+USERVER_NAMESPACE_END
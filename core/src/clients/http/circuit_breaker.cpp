@@ -0,0 +1,62 @@
+#include <clients/http/circuit_breaker.hpp>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+std::int64_t NowNs() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             utils::datetime::SteadyNow().time_since_epoch())
+      .count();
+}
+
+std::int64_t ToNs(std::chrono::milliseconds duration) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+bool CircuitBreaker::AllowRequest(
+    const impl::CircuitBreakerConfig& config) noexcept {
+  if (!config.enabled) return true;
+
+  auto open_until = open_until_ns_.load();
+  if (open_until == 0) return true;
+
+  const auto now = NowNs();
+  if (now < open_until) return false;
+
+  // Half-open: the first request after the open time probes the destination,
+  // the others wait for another open time
+  return open_until_ns_.compare_exchange_strong(
+      open_until, now + ToNs(config.open_time));
+}
+
+bool CircuitBreaker::AccountResult(
+    bool is_ok, const impl::CircuitBreakerConfig& config) noexcept {
+  if (is_ok) {
+    consecutive_failures_ = 0;
+    open_until_ns_ = 0;
+    return false;
+  }
+
+  const auto failures = ++consecutive_failures_;
+  if (!config.enabled || failures < config.consecutive_failures) return false;
+
+  std::int64_t expected = 0;
+  return open_until_ns_.compare_exchange_strong(
+      expected, NowNs() + ToNs(config.open_time));
+}
+
+bool CircuitBreaker::IsOpen() const noexcept {
+  return open_until_ns_.load() != 0;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/clients/http/impl/config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Fails the requests to a destination fast after its consecutive failures.
+/// The breaker opens for the open time, then lets one request through each
+/// open time until a request succeeds.
+///
+/// Thread-safe.
+class CircuitBreaker final {
+ public:
+  /// Returns whether the request may be performed
+  bool AllowRequest(const impl::CircuitBreakerConfig& config) noexcept;
+
+  /// Accounts the outcome of a performed request, returns whether the breaker
+  /// has opened because of it
+  bool AccountResult(bool is_ok,
+                     const impl::CircuitBreakerConfig& config) noexcept;
+
+  bool IsOpen() const noexcept;
+
+ private:
+  std::atomic<std::size_t> consecutive_failures_{0};
+  // Time since the epoch of utils::datetime::SteadyNow(), zero if closed
+  std::atomic<std::int64_t> open_until_ns_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
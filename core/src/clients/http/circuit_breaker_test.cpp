@@ -0,0 +1,79 @@
+#include <clients/http/circuit_breaker.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::CircuitBreaker;
+
+clients::http::impl::CircuitBreakerConfig MakeConfig() {
+  clients::http::impl::CircuitBreakerConfig config;
+  config.enabled = true;
+  config.consecutive_failures = 3;
+  config.open_time = std::chrono::seconds{5};
+  return config;
+}
+
+void Fail(CircuitBreaker& breaker,
+          const clients::http::impl::CircuitBreakerConfig& config, int count) {
+  for (int i = 0; i < count; ++i) breaker.AccountResult(false, config);
+}
+
+}  // namespace
+
+TEST(CircuitBreaker, OpensAfterConsecutiveFailures) {
+  utils::datetime::MockNowSet({});
+  CircuitBreaker breaker;
+  const auto config = MakeConfig();
+
+  Fail(breaker, config, 2);
+  breaker.AccountResult(true, config);
+  Fail(breaker, config, 2);
+  EXPECT_FALSE(breaker.IsOpen());
+  EXPECT_TRUE(breaker.AllowRequest(config));
+
+  EXPECT_TRUE(breaker.AccountResult(false, config));
+  EXPECT_TRUE(breaker.IsOpen());
+  EXPECT_FALSE(breaker.AllowRequest(config));
+  EXPECT_FALSE(breaker.AccountResult(false, config));
+}
+
+TEST(CircuitBreaker, HalfOpen) {
+  utils::datetime::MockNowSet({});
+  CircuitBreaker breaker;
+  const auto config = MakeConfig();
+
+  Fail(breaker, config, 3);
+  EXPECT_FALSE(breaker.AllowRequest(config));
+
+  utils::datetime::MockSleep(config.open_time);
+  EXPECT_TRUE(breaker.AllowRequest(config));
+  EXPECT_FALSE(breaker.AllowRequest(config));
+
+  // The probe failed
+  breaker.AccountResult(false, config);
+  EXPECT_FALSE(breaker.AllowRequest(config));
+
+  utils::datetime::MockSleep(config.open_time);
+  EXPECT_TRUE(breaker.AllowRequest(config));
+  breaker.AccountResult(true, config);
+  EXPECT_FALSE(breaker.IsOpen());
+  EXPECT_TRUE(breaker.AllowRequest(config));
+  EXPECT_TRUE(breaker.AllowRequest(config));
+}
+
+TEST(CircuitBreaker, Disabled) {
+  CircuitBreaker breaker;
+  auto config = MakeConfig();
+  config.enabled = false;
+
+  Fail(breaker, config, 10);
+  EXPECT_FALSE(breaker.IsOpen());
+  EXPECT_TRUE(breaker.AllowRequest(config));
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <limits>
+#include <optional>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -13,6 +14,7 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/userver_info.hpp>
 
+#include <clients/http/address_balancer.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/statistics.hpp>
@@ -20,6 +22,7 @@
 #include <crypto/openssl.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 #include <server/http/headers_propagator.hpp>
 
@@ -37,6 +40,16 @@ long ClampToLong(size_t value) {
   return std::min<size_t>(value, std::numeric_limits<long>::max());
 }
 
+// libcurl does not support sharing the connection cache between the multi
+// handles of different threads, so only the caches that do not depend on the
+// thread are shared
+std::shared_ptr<curl::share> MakeShare() {
+  auto share = std::make_shared<curl::share>();
+  share->set_share_dns(true);
+  share->set_share_ssl_session(true);
+  return share;
+}
+
 const tracing::TracingManagerBase* GetTracingManager(
     const impl::ClientSettings& settings) {
   UASSERT(settings.tracing_manager);
@@ -54,6 +67,11 @@ Client::Client(impl::ClientSettings settings,
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
+      share_(MakeShare()),
+      address_balancer_(settings.load_balancing.enabled
+                            ? std::make_unique<AddressBalancer>(
+                                  settings.load_balancing)
+                            : nullptr),
       tracing_manager_(GetTracingManager(settings)),
       headers_propagator_(settings.headers_propagator),
       plugin_pipeline_(std::move(plugin_pipeline)) {
@@ -113,10 +131,47 @@ Client::~Client() {
   thread_pool_.reset();
 }
 
-Request Client::CreateRequest() {
-  auto request = [this] {
-    auto easy = TryDequeueIdle();
+Request Client::CreateRequest() { return CreateRequestImpl(std::nullopt); }
+
+void Client::WarmUp(const std::vector<std::string>& urls,
+                    engine::Deadline deadline) {
+  if (urls.empty()) return;
+
+  std::vector<ResponseFuture> futures;
+  futures.reserve(urls.size() * multis_.size());
+  for (size_t i = 0; i < multis_.size(); ++i) {
+    for (const auto& url : urls) {
+      const auto timeout =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              deadline.TimeLeft());
+      if (timeout.count() <= 0) break;
+      futures.push_back(CreateRequestImpl(i)
+                            .head()
+                            .url(url)
+                            .timeout(timeout)
+                            .retry(1)
+                            .async_perform());
+    }
+  }
+
+  size_t failures = 0;
+  for (auto& future : futures) {
+    try {
+      future.Get();
+    } catch (const std::exception& e) {
+      LOG_WARNING() << "Failed to warm up a connection: " << e;
+      ++failures;
+    }
+  }
+  LOG_INFO() << "Warmed up " << futures.size() - failures << " of "
+             << urls.size() * multis_.size() << " connections";
+}
+
+Request Client::CreateRequestImpl(std::optional<size_t> multi_index) {
+  auto request = [this, multi_index] {
+    auto easy = multi_index ? nullptr : TryDequeueIdle();
     if (easy) {
+      easy->set_share(share_);
       auto idx = FindMultiIndex(easy->GetMulti());
       auto wrapper =
           std::make_shared<impl::EasyWrapper>(std::move(easy), *this);
@@ -125,13 +180,17 @@ Request Client::CreateRequest() {
           destination_statistics_, resolver_,
           plugin_pipeline_,        *tracing_manager_.GetBase()};
     } else {
-      auto i = utils::RandRange(multis_.size());
+      const auto i =
+          multi_index.value_or(utils::RandRange(multis_.size()));
+      UASSERT(i < multis_.size());
       auto& multi = multis_[i];
 
       try {
         auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
+                         auto easy = easy_.Get()->GetBoundBlocking(*multi);
+                         easy->set_share(share_);
                          return std::make_shared<impl::EasyWrapper>(
-                             easy_.Get()->GetBoundBlocking(*multi), *this);
+                             std::move(easy), *this);
                        }).Get();
         return Request{
             std::move(wrapper),      statistics_[i].CreateRequestStats(),
@@ -156,6 +215,9 @@ Request Client::CreateRequest() {
   if (user_agent_) {
     request.user_agent(*user_agent_);
   }
+  if (default_http_version_ != HttpVersion::kDefault) {
+    request.http_version(default_http_version_);
+  }
 
   {
     // Even if proxy is an empty string we should set it, because empty proxy
@@ -164,6 +226,12 @@ Request Client::CreateRequest() {
     request.proxy(*proxy_value);
   }
   request.SetDeadlinePropagationConfig(deadline_propagation_config_);
+  request.SetAddressBalancer(address_balancer_.get());
+  {
+    const auto guards_config = destination_guards_config_.Read();
+    request.SetDestinationGuardsConfig(guards_config->retry_budget,
+                                       guards_config->circuit_breaker);
+  }
 
   return request;
 }
@@ -180,6 +248,16 @@ void Client::SetMaxHostConnections(size_t max_host_connections) {
   }
 }
 
+void Client::SetMaxConcurrentStreams(size_t max_concurrent_streams) {
+  for (auto& multi : multis_) {
+    multi->SetMaxConcurrentStreams(ClampToLong(max_concurrent_streams));
+  }
+}
+
+void Client::SetDefaultHttpVersion(HttpVersion version) {
+  default_http_version_ = version;
+}
+
 std::string Client::GetProxy() const { return proxy_.ReadCopy(); }
 
 void Client::SetDnsResolver(clients::dns::Resolver* resolver) {
@@ -282,6 +360,8 @@ void Client::SetConfig(const impl::Config& config) {
       config.throttle.per_host_connect_rate);
 
   proxy_.Assign(config.proxy);
+  destination_guards_config_.Assign(
+      {config.retry_budget, config.circuit_breaker});
 }
 
 void Client::ResetUserAgent(std::optional<std::string> user_agent) {
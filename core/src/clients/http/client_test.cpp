@@ -1,5 +1,6 @@
 #include <userver/clients/http/client.hpp>
 
+#include <atomic>
 #include <set>
 
 #include <fmt/format.h>
@@ -386,6 +387,62 @@ struct Response503WithConnDrop {
   }
 };
 
+struct SlowFirstRequestCallback {
+  const std::shared_ptr<std::atomic<int>> requests =
+      std::make_shared<std::atomic<int>>(0);
+
+  HttpResponse operator()(const HttpRequest& request) const {
+    if (requests->fetch_add(1) == 0) return sleep_callback(request);
+
+    LOG_INFO() << "HTTP Server receive: " << request;
+    return {
+        "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: "
+        "2\r\n\r\nok",
+        HttpResponse::kWriteAndClose};
+  }
+};
+
+// Replies with the request body once it is received completely
+HttpResponse streamed_body_echo_callback(const HttpRequest& request) {
+  const auto header_end = request.find("\r\n\r\n");
+  if (header_end == std::string::npos) return {{}, HttpResponse::kTryReadMore};
+  const auto headers = request.substr(0, header_end);
+  auto body = request.substr(header_end + 4);
+
+  std::string payload;
+  if (headers.find("Transfer-Encoding: chunked") != std::string::npos) {
+    std::size_t pos = 0;
+    while (true) {
+      const auto size_end = body.find("\r\n", pos);
+      if (size_end == std::string::npos) {
+        return {{}, HttpResponse::kTryReadMore};
+      }
+      const auto size =
+          std::stoul(body.substr(pos, size_end - pos), nullptr, 16);
+      if (body.size() < size_end + 2 + size + 2) {
+        return {{}, HttpResponse::kTryReadMore};
+      }
+      if (size == 0) break;
+      payload += body.substr(size_end + 2, size);
+      pos = size_end + 2 + size + 2;
+    }
+  } else {
+    const auto length_pos = headers.find("Content-Length: ");
+    EXPECT_NE(length_pos, std::string::npos) << request;
+    if (length_pos == std::string::npos) {
+      return {{}, HttpResponse::kWriteAndClose};
+    }
+    const auto length = std::stoul(headers.substr(length_pos + 16));
+    if (body.size() < length) return {{}, HttpResponse::kTryReadMore};
+    payload = std::move(body);
+  }
+
+  return {
+      "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: " +
+          std::to_string(payload.size()) + "\r\n\r\n" + payload,
+      HttpResponse::kWriteAndClose};
+}
+
 struct CheckCookie {
   const std::set<std::string> expected_cookies;
 
@@ -1321,6 +1378,103 @@ UTEST(HttpClient, Retry) {
   EXPECT_EQ(2, response->GetStats().retries_count);
 }
 
+UTEST(HttpClient, Hedging) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const SlowFirstRequestCallback callback;
+  const utest::SimpleServer http_server{callback};
+
+  clients::http::HedgingSettings hedging;
+  hedging.delay = kSmallTimeout;
+  auto response = http_client_ptr->CreateRequest()
+                      .get(http_server.GetBaseUrl())
+                      .timeout(kTimeout)
+                      .hedging(hedging)
+                      .perform();
+
+  EXPECT_TRUE(response->IsOk());
+  EXPECT_EQ(response->body(), "ok");
+  EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClient, HedgingNotNeeded) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const utest::SimpleServer http_server{EchoCallback{}};
+
+  clients::http::HedgingSettings hedging;
+  hedging.delay = kTimeout;
+  hedging.max_attempts = 3;
+  auto request = http_client_ptr->CreateRequest()
+                     .post(http_server.GetBaseUrl(), kTestData)
+                     .timeout(kTimeout)
+                     .hedging(hedging);
+
+  for (unsigned i = 0; i < kFewRepetitions; ++i) {
+    auto response = request.perform();
+    EXPECT_TRUE(response->IsOk());
+    EXPECT_EQ(response->body(), kTestData);
+  }
+}
+
+UTEST(HttpClient, HedgingCancel) {
+  constexpr int kAttempts = 3;
+  std::atomic<int> server_requests{0};
+  engine::SingleConsumerEvent all_attempts_event;
+  auto callback = [&server_requests,
+                   &all_attempts_event](const HttpRequest& request) {
+    if (++server_requests == kAttempts) all_attempts_event.Send();
+    return sleep_callback(request);
+  };
+
+  const utest::SimpleServer http_server{callback};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  clients::http::HedgingSettings hedging;
+  hedging.delay = std::chrono::milliseconds{1};
+  hedging.max_attempts = kAttempts;
+  auto future = http_client_ptr->CreateRequest()
+                    .get(http_server.GetBaseUrl())
+                    .timeout(kTimeout)
+                    .hedging(hedging)
+                    .async_perform();
+
+  ASSERT_TRUE(all_attempts_event.WaitForEventFor(utest::kMaxTestWaitTime));
+  engine::current_task::GetCancellationToken().RequestCancel();
+
+  UEXPECT_THROW(future.Wait(), clients::http::CancelException);
+  EXPECT_EQ(server_requests.load(), kAttempts);
+}
+
+UTEST(HttpClient, DataStream) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const utest::SimpleServer http_server{streamed_body_echo_callback};
+
+  constexpr std::size_t kChunks = 100;
+  const std::string chunk(1000, '@');
+  for (const bool known_length : {false, true}) {
+    // Holds less than two chunks, so the producer waits for the client
+    auto queue = concurrent::StringStreamQueue::Create(chunk.size() * 3 / 2);
+    std::optional<std::size_t> content_length;
+    if (known_length) content_length = chunk.size() * kChunks;
+
+    auto producer_task = utils::Async(
+        "producer", [&chunk, producer = queue->GetProducer()]() mutable {
+          for (std::size_t i = 0; i < kChunks; ++i) {
+            ASSERT_TRUE(producer.Push(std::string{chunk}));
+          }
+        });
+
+    auto response = http_client_ptr->CreateRequest()
+                        .put(http_server.GetBaseUrl())
+                        .data_stream(queue, content_length)
+                        .timeout(kTimeout)
+                        .perform();
+    producer_task.Get();
+
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body().size(), chunk.size() * kChunks);
+  }
+}
+
 UTEST(HttpClient, TinyTimeout) {
   auto http_client_ptr = utest::CreateHttpClient();
   const utest::SimpleServer http_server{sleep_callback_1s};
@@ -1657,4 +1811,27 @@ UTEST(HttpClient, DigestAuth) {
   }
 }
 
+UTEST(HttpClient, WarmUp) {
+  const auto heads = std::make_shared<std::size_t>(0);
+  const utest::SimpleServer http_server{
+      [heads](const HttpRequest& request) -> HttpResponse {
+        if (request.rfind("HEAD ", 0) == 0) ++*heads;
+        return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+                HttpResponse::kWriteAndContinue};
+      }};
+  auto http_client = utest::CreateHttpClient();
+
+  http_client->WarmUp({http_server.GetBaseUrl(), "http://127.0.0.1:1"},
+                      engine::Deadline::FromDuration(kTimeout));
+  EXPECT_EQ(*heads, 1);
+
+  const auto response = http_client->CreateRequest()
+                            .get(http_server.GetBaseUrl())
+                            .retry(1)
+                            .timeout(kTimeout)
+                            .perform();
+  EXPECT_EQ(response->status_code(), 200);
+  EXPECT_EQ(response->GetStats().open_socket_count, 0);
+}
+
 USERVER_NAMESPACE_END
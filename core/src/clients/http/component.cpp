@@ -1,5 +1,10 @@
 #include <userver/clients/http/component.hpp>
 
+#include <chrono>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 #include <userver/clients/dns/resolver_utils.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/headers_propagator_component.hpp>
@@ -7,6 +12,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 #include <userver/utils/statistics/metadata.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/statistics.hpp>
@@ -24,7 +30,31 @@ namespace components {
 namespace {
 
 constexpr size_t kDestinationMetricsAutoMaxSizeDefault = 100;
+constexpr size_t kMaxConcurrentStreamsDefault = 100;
 constexpr std::string_view kHttpClientPluginPrefix = "http-client-plugin-";
+constexpr std::chrono::seconds kWarmupTimeoutDefault{5};
+
+constexpr utils::TrivialBiMap kHttpVersionMap = [](auto selector) {
+  return selector()
+      .Case("default", clients::http::HttpVersion::kDefault)
+      .Case("1.0", clients::http::HttpVersion::k10)
+      .Case("1.1", clients::http::HttpVersion::k11)
+      .Case("2", clients::http::HttpVersion::k2)
+      .Case("2tls", clients::http::HttpVersion::k2Tls)
+      .Case("2-prior-knowledge", clients::http::HttpVersion::k2PriorKnowledge);
+};
+
+clients::http::HttpVersion ParseHttpVersion(
+    const yaml_config::YamlConfig& value) {
+  const auto str = value.As<std::string>("default");
+  const auto version = kHttpVersionMap.TryFindByFirst(str);
+  if (!version) {
+    throw std::runtime_error(fmt::format(
+        "Unknown HTTP version '{}' at '{}', expected one of: {}", str,
+        value.GetPath(), kHttpVersionMap.DescribeFirst()));
+  }
+  return *version;
+}
 
 clients::http::impl::ClientSettings GetClientSettings(
     const ComponentConfig& component_config, const ComponentContext& context) {
@@ -55,12 +85,30 @@ constexpr dynamic_config::DefaultAsJsonString kThrottleDefaults{R"(
 }
 )"};
 
+constexpr dynamic_config::DefaultAsJsonString kRetryBudgetDefaults{R"(
+{
+  "enabled": false,
+  "max-retries-percent": 10,
+  "min-retries-per-second": 10
+}
+)"};
+
+constexpr dynamic_config::DefaultAsJsonString kCircuitBreakerDefaults{R"(
+{
+  "enabled": false,
+  "consecutive-failures": 50,
+  "open-time-ms": 5000
+}
+)"};
+
 const dynamic_config::Key kClientConfig{
     clients::http::impl::ParseConfig,
     {
         {"HTTP_CLIENT_CONNECTION_POOL_SIZE", 1000},
         {"USERVER_HTTP_PROXY", ""},
         {"HTTP_CLIENT_CONNECT_THROTTLE", kThrottleDefaults},
+        {"HTTP_CLIENT_RETRY_BUDGET", kRetryBudgetDefaults},
+        {"HTTP_CLIENT_CIRCUIT_BREAKER", kCircuitBreakerDefaults},
     },
 };
 /// [docs map config sample]
@@ -83,6 +131,16 @@ HttpClient::HttpClient(const ComponentConfig& component_config,
       component_config["destination-metrics-auto-max-size"].As<size_t>(
           kDestinationMetricsAutoMaxSizeDefault));
 
+  http_client_.SetDefaultHttpVersion(
+      ParseHttpVersion(component_config["http-version"]));
+  http_client_.SetMultiplexingEnabled(
+      component_config["multiplexing"].As<bool>(true));
+  http_client_.SetMaxHostConnections(
+      component_config["max-host-connections"].As<size_t>(0));
+  http_client_.SetMaxConcurrentStreams(
+      component_config["max-concurrent-streams"].As<size_t>(
+          kMaxConcurrentStreamsDefault));
+
   http_client_.SetDnsResolver(
       clients::dns::GetResolverPtr(component_config, context));
 
@@ -133,6 +191,13 @@ HttpClient::HttpClient(const ComponentConfig& component_config,
       std::move(stats_name), [this](utils::statistics::Writer& writer) {
         return WriteStatistics(writer);
       });
+
+  const auto& warmup = component_config["warmup"];
+  http_client_.WarmUp(
+      warmup["urls"].As<std::vector<std::string>>({}),
+      engine::Deadline::FromDuration(
+          warmup["timeout"].As<std::chrono::milliseconds>(
+              kWarmupTimeoutDefault)));
 }
 
 std::vector<utils::NotNull<clients::http::Plugin*>> HttpClient::FindPlugins(
@@ -195,6 +260,31 @@ properties:
         type: integer
         description: set max number of automatically created destination metrics
         defaultDescription: 100
+    http-version:
+        type: string
+        description: HTTP version of the requests that do not set it explicitly
+        defaultDescription: default
+        enum:
+          - default
+          - '1.0'
+          - '1.1'
+          - '2'
+          - 2tls
+          - 2-prior-knowledge
+    multiplexing:
+        type: boolean
+        description: whether to send the concurrent HTTP/2 requests to the same host over one connection
+        defaultDescription: true
+    max-host-connections:
+        type: integer
+        description: max number of connections to a host, 0 for unlimited
+        defaultDescription: 0
+        minimum: 0
+    max-concurrent-streams:
+        type: integer
+        description: max number of concurrent requests over one HTTP/2 connection
+        defaultDescription: 100
+        minimum: 1
     user-agent:
         type: string
         description: User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty
@@ -223,6 +313,50 @@ properties:
         enum:
           - getaddrinfo
           - async
+    load-balancing:
+        type: object
+        description: |
+            Settings of the balancing of the requests over the addresses of
+            the hosts, requires the async dns_resolver.
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: whether to pick the address of each request
+                defaultDescription: false
+            consecutive-failures:
+                type: integer
+                description: count of failures in a row to eject an address
+                defaultDescription: 5
+                minimum: 1
+            ejection-time:
+                type: string
+                description: time to eject an address for the first time
+                defaultDescription: 30s
+            max-ejected-percent:
+                type: number
+                description: max percent of the addresses of a host to eject
+                defaultDescription: 50
+                minimum: 0
+                maximum: 100
+    warmup:
+        type: object
+        description: |
+            Connections to open from each of the client threads at the
+            component start, the start waits for them up to the timeout.
+        additionalProperties: false
+        properties:
+            urls:
+                type: array
+                description: URLs to send HEAD requests to
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: URL to send HEAD requests to
+            timeout:
+                type: string
+                description: max time to wait for the warmup for
+                defaultDescription: 5s
     set-deadline-propagation-header:
         type: boolean
         description: |
@@ -7,6 +7,9 @@
 #include <userver/utest/http_client.hpp>
 #include <userver/utest/simple_server.hpp>
 #include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,6 +26,13 @@ static HttpResponse Callback(int code, const HttpRequest& request) {
           HttpResponse::kWriteAndClose};
 }
 
+static HttpResponse KeepAliveCallback(const HttpRequest& request) {
+  LOG_INFO() << "HTTP Server receive: " << request;
+
+  return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+          HttpResponse::kWriteAndContinue};
+}
+
 UTEST(DestinationStatistics, Empty) {
   auto client = utest::CreateHttpClient();
 
@@ -134,4 +144,44 @@ UTEST(DestinationStatistics, Multiple) {
   }
 }
 
+UTEST(DestinationStatistics, ConnectionMetrics) {
+  const utest::SimpleServer http_server{&KeepAliveCallback};
+  auto client = utest::CreateHttpClient();
+
+  auto url = http_server.GetBaseUrl();
+
+  // The second request runs over the connection kept alive by the first one
+  for (int i = 0; i < 2; ++i) {
+    auto response = client->CreateRequest()
+                        .get(url)
+                        .retry(1)
+                        .timeout(utest::kMaxTestWaitTime)
+                        .perform();
+    EXPECT_EQ(response->status_code(), 200);
+  }
+
+  const auto& dest_stats = client->GetDestinationStatistics();
+  ASSERT_NE(dest_stats.begin(), dest_stats.end());
+  const auto stats =
+      clients::http::InstanceStatistics(*dest_stats.begin()->second);
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "destination", [&stats](utils::statistics::Writer& writer) {
+        writer = clients::http::DestinationStatisticsView{stats};
+      });
+  const utils::statistics::Snapshot snapshot{storage};
+  const auto get = [&snapshot](const std::string& metric) {
+    return snapshot.SingleMetric("destination." + metric).AsRate().value;
+  };
+
+  EXPECT_EQ(get("sockets.open"), 1);
+  EXPECT_EQ(get("connections.reused"), 1);
+  // Plain HTTP/1.1 without TLS
+  EXPECT_EQ(get("connections.http2-streams"), 0);
+  EXPECT_EQ(get("connections.tls-handshakes"), 0);
+
+  holder.Unregister();
+}
+
 USERVER_NAMESPACE_END
@@ -17,6 +17,13 @@ EasyWrapper::~EasyWrapper() { client_.PushIdleEasy(std::move(easy_)); }
 
 curl::easy& EasyWrapper::Easy() { return *easy_; }
 
+std::shared_ptr<EasyWrapper> EasyWrapper::CloneBound() {
+  auto* multi = easy_->GetMulti();
+  UASSERT(multi);
+  return std::make_shared<EasyWrapper>(easy_->GetBoundBlocking(*multi),
+                                       client_);
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
@@ -25,6 +25,11 @@ class EasyWrapper final {
 
   curl::easy& Easy();
 
+  /// Makes a copy of the easy with all the options set, bound to the same
+  /// multi. The copy does not inherit the share or the callback data.
+  /// Blocks, so it is not called in the ev thread.
+  std::shared_ptr<EasyWrapper> CloneBound();
+
  private:
   std::shared_ptr<curl::easy> easy_;
   Client& client_;
@@ -1,5 +1,6 @@
 #include <userver/clients/http/impl/config.hpp>
 
+#include <cstdint>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
@@ -37,6 +38,21 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(
   return result;
 }
 
+LoadBalancingConfig ParseLoadBalancingConfig(
+    const yaml_config::YamlConfig& value) {
+  LoadBalancingConfig result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.consecutive_failures =
+      value["consecutive-failures"].As<std::size_t>(
+          result.consecutive_failures);
+  result.ejection_time = value["ejection-time"].As<std::chrono::milliseconds>(
+      result.ejection_time);
+  result.max_ejected_share =
+      value["max-ejected-percent"].As<double>(result.max_ejected_share * 100) /
+      100;
+  return result;
+}
+
 }  // namespace
 
 ClientSettings Parse(const yaml_config::YamlConfig& value,
@@ -47,6 +63,7 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.load_balancing = ParseLoadBalancingConfig(value["load-balancing"]);
   return result;
 }
 
@@ -65,6 +82,30 @@ ThrottleConfig Parse(const formats::json::Value& value,
   return result;
 }
 
+RetryBudgetConfig Parse(const formats::json::Value& value,
+                        formats::parse::To<RetryBudgetConfig>) {
+  RetryBudgetConfig result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.max_retries_share =
+      value["max-retries-percent"].As<double>(result.max_retries_share * 100) /
+      100;
+  result.min_retries_per_second =
+      value["min-retries-per-second"].As<std::size_t>(
+          result.min_retries_per_second);
+  return result;
+}
+
+CircuitBreakerConfig Parse(const formats::json::Value& value,
+                           formats::parse::To<CircuitBreakerConfig>) {
+  CircuitBreakerConfig result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.consecutive_failures = value["consecutive-failures"].As<std::size_t>(
+      result.consecutive_failures);
+  result.open_time = std::chrono::milliseconds{
+      value["open-time-ms"].As<std::int64_t>(result.open_time.count())};
+  return result;
+}
+
 Config ParseConfig(const dynamic_config::DocsMap& docs_map) {
   Config result;
   result.connection_pool_size =
@@ -72,6 +113,10 @@ Config ParseConfig(const dynamic_config::DocsMap& docs_map) {
   result.proxy = docs_map.Get("USERVER_HTTP_PROXY").As<std::string>();
   result.throttle =
       docs_map.Get("HTTP_CLIENT_CONNECT_THROTTLE").As<ThrottleConfig>();
+  result.retry_budget =
+      docs_map.Get("HTTP_CLIENT_RETRY_BUDGET").As<RetryBudgetConfig>();
+  result.circuit_breaker =
+      docs_map.Get("HTTP_CLIENT_CIRCUIT_BREAKER").As<CircuitBreakerConfig>();
   return result;
 }
 
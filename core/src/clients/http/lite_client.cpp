@@ -0,0 +1,305 @@
+#include <userver/clients/http/lite_client.hpp>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <array>
+#include <string_view>
+
+#include <fmt/format.h>
+#include <http_parser.h>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/clients/http/local_stats.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::size_t kRecvBufferSize = 8 * 1024;
+
+std::string SerializeRequest(const LiteRequest& request,
+                             std::string_view endpoint_name) {
+  namespace headers = USERVER_NAMESPACE::http::headers;
+
+  std::string data;
+  data.reserve(request.target.size() + request.body.size() + 128);
+  data.append(ToStringView(request.method));
+  data.append(" ").append(request.target).append(" HTTP/1.1\r\n");
+  if (!request.headers.contains(headers::kHost)) {
+    data.append("Host: ").append(endpoint_name).append("\r\n");
+  }
+  for (const auto& [name, value] : request.headers) {
+    if (utils::StrIcaseEqual{}(name, headers::kContentLength)) continue;
+    data.append(name).append(": ").append(value).append("\r\n");
+  }
+  data.append("Content-Length: ")
+      .append(std::to_string(request.body.size()))
+      .append("\r\n\r\n")
+      .append(request.body);
+  return data;
+}
+
+class ResponseParser final {
+ public:
+  ResponseParser(LiteResponse& response, bool is_head_request,
+                 std::size_t max_body_size)
+      : response_(response),
+        is_head_request_(is_head_request),
+        max_body_size_(max_body_size) {
+    http_parser_init(&parser_, HTTP_RESPONSE);
+    parser_.data = this;
+  }
+
+  ResponseParser(const ResponseParser&) = delete;
+  ResponseParser& operator=(const ResponseParser&) = delete;
+
+  // Returns false on a malformed response
+  bool Parse(const char* data, std::size_t size) {
+    is_started_ = true;
+    const auto parsed =
+        http_parser_execute(&parser_, &kParserSettings, data, size);
+    return parsed == size && HTTP_PARSER_ERRNO(&parser_) == HPE_OK;
+  }
+
+  // Notifies the parser that the server has closed the connection
+  bool ParseEof() {
+    return http_parser_execute(&parser_, &kParserSettings, nullptr, 0) == 0 &&
+           HTTP_PARSER_ERRNO(&parser_) == HPE_OK;
+  }
+
+  bool IsStarted() const noexcept { return is_started_; }
+
+  bool IsComplete() const noexcept { return is_complete_; }
+
+  bool ShouldKeepAlive() const noexcept {
+    return http_should_keep_alive(&parser_) != 0;
+  }
+
+  std::string_view GetError() const noexcept {
+    return http_errno_description(HTTP_PARSER_ERRNO(&parser_));
+  }
+
+ private:
+  static ResponseParser& Get(http_parser* p) {
+    return *static_cast<ResponseParser*>(p->data);
+  }
+
+  static int OnHeaderField(http_parser* p, const char* data, size_t size) {
+    auto& self = Get(p);
+    if (!self.reading_header_name_) {
+      self.StoreHeader();
+      self.reading_header_name_ = true;
+    }
+    self.header_name_.append(data, size);
+    return 0;
+  }
+
+  static int OnHeaderValue(http_parser* p, const char* data, size_t size) {
+    auto& self = Get(p);
+    self.reading_header_name_ = false;
+    self.header_value_.append(data, size);
+    return 0;
+  }
+
+  static int OnHeadersComplete(http_parser* p) {
+    auto& self = Get(p);
+    if (!self.header_name_.empty()) self.StoreHeader();
+    self.response_.status_code = static_cast<int>(p->status_code);
+    // 1 tells the parser that there is no body
+    return self.is_head_request_ ? 1 : 0;
+  }
+
+  static int OnBody(http_parser* p, const char* data, size_t size) {
+    auto& self = Get(p);
+    if (self.response_.body.size() + size > self.max_body_size_) return 1;
+    self.response_.body.append(data, size);
+    return 0;
+  }
+
+  static int OnMessageComplete(http_parser* p) {
+    Get(p).is_complete_ = true;
+    return 0;
+  }
+
+  void StoreHeader() {
+    response_.headers.InsertOrAppend(std::move(header_name_),
+                                     std::move(header_value_));
+    header_name_.clear();
+    header_value_.clear();
+  }
+
+  static constexpr http_parser_settings MakeParserSettings() {
+    http_parser_settings settings{};
+    settings.on_header_field = OnHeaderField;
+    settings.on_header_value = OnHeaderValue;
+    settings.on_headers_complete = OnHeadersComplete;
+    settings.on_body = OnBody;
+    settings.on_message_complete = OnMessageComplete;
+    return settings;
+  }
+
+  static const http_parser_settings kParserSettings;
+
+  LiteResponse& response_;
+  const bool is_head_request_;
+  const std::size_t max_body_size_;
+
+  http_parser parser_{};
+  std::string header_name_;
+  std::string header_value_;
+  bool reading_header_name_{true};
+  bool is_started_{false};
+  bool is_complete_{false};
+};
+
+constexpr http_parser_settings ResponseParser::kParserSettings =
+    ResponseParser::MakeParserSettings();
+
+// The kept-alive connection has been closed by the server before it started
+// to respond, the request may be resent over a new connection
+class StaleConnection final {};
+
+void Exchange(engine::io::Socket& socket, const std::string& request_data,
+              ResponseParser& parser, engine::Deadline deadline,
+              bool is_reused, std::string_view url) {
+  const auto fail = [&](std::string_view message) {
+    if (is_reused && !parser.IsStarted()) throw StaleConnection{};
+    throw NetworkProblemException(
+        std::make_error_code(std::errc::connection_reset), message, url, {});
+  };
+
+  try {
+    if (socket.SendAll(request_data.data(), request_data.size(), deadline) !=
+        request_data.size()) {
+      fail("Connection closed while sending the request");
+    }
+
+    std::array<char, kRecvBufferSize> buffer{};
+    while (!parser.IsComplete()) {
+      const auto size = socket.RecvSome(buffer.data(), buffer.size(), deadline);
+      if (size == 0) {
+        if (!parser.IsStarted() || !parser.ParseEof() ||
+            !parser.IsComplete()) {
+          fail("Connection closed before the response was received");
+        }
+        break;
+      }
+      if (!parser.Parse(buffer.data(), size)) {
+        throw NetworkProblemException(
+            std::make_error_code(std::errc::protocol_error),
+            fmt::format("Malformed or too large response: {}",
+                        parser.GetError()),
+            url, {});
+      }
+    }
+  } catch (const engine::io::IoSystemError& e) {
+    if (is_reused && !parser.IsStarted()) throw StaleConnection{};
+    throw NetworkProblemException(e.Code(), e.what(), url, {});
+  }
+}
+
+}  // namespace
+
+LiteClient::LiteClient(LiteClientSettings settings) : settings_(settings) {}
+
+LiteClient::~LiteClient() = default;
+
+LiteResponse LiteClient::Perform(const engine::io::Sockaddr& endpoint,
+                                 const LiteRequest& request,
+                                 engine::Deadline deadline) {
+  const auto endpoint_name = fmt::format("{}", endpoint);
+  const auto url = fmt::format("http://{}{}", endpoint_name, request.target);
+  const auto request_data = SerializeRequest(request, endpoint_name);
+  const auto start = std::chrono::steady_clock::now();
+  const auto make_stats = [&start] {
+    LocalStats stats;
+    stats.time_to_process = std::chrono::steady_clock::now() - start;
+    return stats;
+  };
+
+  try {
+    while (true) {
+      bool is_reused = false;
+      auto socket =
+          AcquireConnection(endpoint, endpoint_name, deadline, is_reused);
+
+      LiteResponse response;
+      ResponseParser parser(response, request.method == HttpMethod::kHead,
+                            settings_.max_response_size);
+      try {
+        Exchange(socket, request_data, parser, deadline, is_reused, url);
+      } catch (const StaleConnection&) {
+        LOG_DEBUG() << "Kept-alive connection to " << endpoint_name
+                    << " was closed by the server, reconnecting";
+        continue;
+      }
+
+      if (parser.ShouldKeepAlive()) {
+        ReleaseConnection(endpoint_name, std::move(socket));
+      }
+      return response;
+    }
+  } catch (const engine::io::IoTimeout&) {
+    throw TimeoutException(fmt::format("Timeout while requesting {}", url),
+                           make_stats());
+  } catch (const engine::io::IoCancelled&) {
+    throw CancelException(fmt::format("Cancelled while requesting {}", url),
+                          make_stats());
+  }
+}
+
+std::size_t LiteClient::GetIdleConnectionsCount() const {
+  const std::lock_guard lock(mutex_);
+  std::size_t result = 0;
+  for (const auto& [name, sockets] : idle_) result += sockets.size();
+  return result;
+}
+
+engine::io::Socket LiteClient::AcquireConnection(
+    const engine::io::Sockaddr& endpoint, const std::string& endpoint_name,
+    engine::Deadline deadline, bool& is_reused) {
+  {
+    const std::lock_guard lock(mutex_);
+    const auto it = idle_.find(endpoint_name);
+    if (it != idle_.end() && !it->second.empty()) {
+      auto socket = std::move(it->second.back());
+      it->second.pop_back();
+      is_reused = true;
+      return socket;
+    }
+  }
+
+  is_reused = false;
+  engine::io::Socket socket{endpoint.Domain(), engine::io::SocketType::kStream};
+  if (endpoint.Domain() != engine::io::AddrDomain::kUnix) {
+    socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+  }
+  try {
+    socket.Connect(endpoint, deadline);
+  } catch (const engine::io::IoSystemError& e) {
+    throw NetworkProblemException(
+        e.Code(), e.what(), fmt::format("http://{}", endpoint_name), {});
+  }
+  return socket;
+}
+
+void LiteClient::ReleaseConnection(const std::string& endpoint_name,
+                                   engine::io::Socket&& socket) {
+  const std::lock_guard lock(mutex_);
+  auto& sockets = idle_[endpoint_name];
+  if (sockets.size() < settings_.max_idle_connections) {
+    sockets.push_back(std::move(socket));
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <userver/clients/http/lite_client.hpp>
+
+#include <netinet/in.h>
+
+#include <string>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_server_mock.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::HttpMethod;
+
+constexpr auto kTimeout = utest::kMaxTestWaitTime;
+
+// HttpServerMock listens on 127.0.0.1
+engine::io::Sockaddr GetEndpoint(const utest::HttpServerMock& server) {
+  const auto base_url = server.GetBaseUrl();
+  const auto port = std::stoi(base_url.substr(base_url.rfind(':') + 1));
+
+  engine::io::Sockaddr endpoint;
+  auto* sa = endpoint.As<sockaddr_in>();
+  sa->sin_family = AF_INET;
+  sa->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  // NOLINTNEXTLINE(hicpp-no-assembler,readability-isolate-declaration)
+  sa->sin_port = htons(static_cast<std::uint16_t>(port));
+  return endpoint;
+}
+
+utest::HttpServerMock::HttpResponse Echo(
+    const utest::HttpServerMock::HttpRequest& request) {
+  return {200, {{"X-Path", request.path}}, request.body};
+}
+
+}  // namespace
+
+UTEST(LiteClient, Sample) {
+  utest::HttpServerMock server(&Echo);
+  const auto endpoint = GetEndpoint(server);
+
+  /// [Sample]
+  clients::http::LiteClient client;
+
+  clients::http::LiteRequest request;
+  request.method = HttpMethod::kPost;
+  request.target = "/v1/echo?id=42";
+  request.body = "ping";
+
+  const auto response = client.Perform(
+      endpoint, request, engine::Deadline::FromDuration(kTimeout));
+  EXPECT_EQ(response.status_code, 200);
+  EXPECT_EQ(response.body, "ping");
+  /// [Sample]
+
+  EXPECT_EQ(response.headers.at("X-Path"), "/v1/echo");
+}
+
+UTEST(LiteClient, KeepAlive) {
+  utest::HttpServerMock server(&Echo);
+  const auto endpoint = GetEndpoint(server);
+  clients::http::LiteClient client;
+
+  for (int i = 0; i < 10; ++i) {
+    clients::http::LiteRequest request;
+    request.body = std::to_string(i);
+    const auto response = client.Perform(
+        endpoint, request, engine::Deadline::FromDuration(kTimeout));
+    EXPECT_EQ(response.body, std::to_string(i));
+  }
+
+  EXPECT_EQ(server.GetConnectionsOpenedCount(), 1);
+  EXPECT_EQ(client.GetIdleConnectionsCount(), 1);
+}
+
+UTEST(LiteClient, ConnectionClose) {
+  utest::HttpServerMock server(
+      [](const utest::HttpServerMock::HttpRequest&)
+          -> utest::HttpServerMock::HttpResponse {
+        return {503, {{"Connection", "close"}}, "unavailable"};
+      });
+  const auto endpoint = GetEndpoint(server);
+  clients::http::LiteClient client;
+
+  const auto response = client.Perform(
+      endpoint, {}, engine::Deadline::FromDuration(kTimeout));
+  EXPECT_EQ(response.status_code, 503);
+  EXPECT_EQ(response.body, "unavailable");
+  EXPECT_EQ(client.GetIdleConnectionsCount(), 0);
+}
+
+UTEST(LiteClient, Timeout) {
+  utest::HttpServerMock server(
+      [](const utest::HttpServerMock::HttpRequest& request) {
+        engine::SleepFor(std::chrono::milliseconds{100});
+        return Echo(request);
+      });
+  const auto endpoint = GetEndpoint(server);
+  clients::http::LiteClient client;
+
+  UEXPECT_THROW(client.Perform(endpoint, {},
+                               engine::Deadline::FromDuration(
+                                   std::chrono::milliseconds{10})),
+                clients::http::TimeoutException);
+  // The connection with the late response is not reused
+  EXPECT_EQ(client.GetIdleConnectionsCount(), 0);
+}
+
+UTEST(LiteClient, TooLargeResponse) {
+  utest::HttpServerMock server(&Echo);
+  const auto endpoint = GetEndpoint(server);
+  clients::http::LiteClient client({/*max_idle_connections=*/1,
+                                    /*max_response_size=*/4});
+
+  clients::http::LiteRequest request;
+  request.body = "too large";
+  UEXPECT_THROW(client.Perform(endpoint, request,
+                               engine::Deadline::FromDuration(kTimeout)),
+                clients::http::NetworkProblemException);
+}
+
+USERVER_NAMESPACE_END
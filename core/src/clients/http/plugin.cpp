@@ -18,16 +18,57 @@ void PluginRequest::SetTimeout(std::chrono::milliseconds ms) {
   state_.SetEasyTimeout(ms);
 }
 
+const std::string& PluginRequest::GetOriginalUrl() const {
+  return state_.easy().get_original_url();
+}
+
+std::string_view PluginRequest::GetMethod() const {
+  return state_.GetMethod();
+}
+
+bool PluginRequest::HasBody() const { return state_.HasBody(); }
+
+bool PluginRequest::HasCredentials() const { return state_.HasCredentials(); }
+
+bool PluginRequest::IsStreamedResponse() const {
+  return state_.IsStreamedResponse();
+}
+
+std::chrono::milliseconds PluginRequest::GetTimeout() const {
+  return std::chrono::milliseconds{state_.timeout()};
+}
+
+const std::string& PluginRequest::GetDestination() const {
+  return state_.GetDestinationMetricName();
+}
+
 Plugin::Plugin(std::string name) : name_(std::move(name)) {}
 
 const std::string& Plugin::GetName() const { return name_; }
 
+std::shared_ptr<Response> Plugin::HookBeforePerform(PluginRequest&) {
+  return nullptr;
+}
+
+void Plugin::HookOnError(PluginRequest&, std::error_code) {}
+
 namespace impl {
 
 PluginPipeline::PluginPipeline(
     const std::vector<utils::NotNull<Plugin*>>& plugins)
     : plugins_(plugins) {}
 
+std::shared_ptr<Response> PluginPipeline::HookBeforePerform(
+    RequestState& request_state) {
+  PluginRequest req(request_state);
+
+  for (const auto& plugin : plugins_) {
+    auto response = plugin->HookBeforePerform(req);
+    if (response) return response;
+  }
+  return nullptr;
+}
+
 void PluginPipeline::HookCreateSpan(RequestState& request_state) {
   PluginRequest req(request_state);
 
@@ -47,6 +88,17 @@ void PluginPipeline::HookOnCompleted(RequestState& request_state,
   }
 }
 
+void PluginPipeline::HookOnError(RequestState& request_state,
+                                 std::error_code ec) {
+  PluginRequest req(request_state);
+
+  // NOLINTNEXTLINE(modernize-loop-convert)
+  for (auto it = plugins_.rbegin(); it != plugins_.rend(); ++it) {
+    const auto& plugin = *it;
+    plugin->HookOnError(req, ec);
+  }
+}
+
 void PluginPipeline::HookPerformRequest(RequestState& request_state) {
   PluginRequest req(request_state);
 
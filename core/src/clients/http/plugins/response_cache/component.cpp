@@ -0,0 +1,50 @@
+#include <userver/clients/http/plugins/response_cache/component.hpp>
+
+#include <clients/http/plugins/response_cache/plugin.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace {
+constexpr std::size_t kDefaultMaxEntries = 1000;
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config,
+                     const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      plugin_(std::make_unique<response_cache::Plugin>(
+          config["max-entries"].As<std::size_t>(kDefaultMaxEntries))) {
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "httpclient.response-cache",
+      [this](utils::statistics::Writer& writer) {
+        plugin_->WriteStatistics(writer);
+      });
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: HTTP client plugin that caches the responses
+additionalProperties: false
+properties:
+    max-entries:
+        type: integer
+        description: max count of the cached responses
+        defaultDescription: 1000
+        minimum: 1
+)");
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,236 @@
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <charconv>
+#include <optional>
+#include <string_view>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+namespace {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+const std::string kName = "response-cache";
+
+struct CacheControl {
+  std::chrono::seconds max_age{0};
+  bool no_store{false};
+};
+
+std::string_view TrimSpaces(std::string_view str) {
+  while (!str.empty() && utils::text::IsAsciiSpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && utils::text::IsAsciiSpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+bool ICaseEqual(std::string_view lhs, std::string_view rhs) {
+  return lhs.size() == rhs.size() && utils::text::ICaseStartsWith(lhs, rhs);
+}
+
+CacheControl ParseCacheControl(const Headers& response_headers) {
+  CacheControl result;
+  const auto value =
+      utils::FindOptional(response_headers, headers::kCacheControl);
+  if (!value) return result;
+
+  constexpr std::string_view kMaxAge = "max-age=";
+  bool no_cache = false;
+  for (const auto part : utils::text::SplitIntoStringViewVector(*value, ",")) {
+    const auto directive = TrimSpaces(part);
+    if (utils::text::ICaseStartsWith(directive, kMaxAge)) {
+      const auto number = directive.substr(kMaxAge.size());
+      std::chrono::seconds::rep seconds = 0;
+      const auto [ptr, ec] =
+          std::from_chars(number.data(), number.data() + number.size(),
+                          seconds);
+      if (ec == std::errc{} && ptr == number.data() + number.size()) {
+        result.max_age = std::chrono::seconds{seconds};
+      }
+    } else if (ICaseEqual(directive, "no-cache")) {
+      no_cache = true;
+    } else if (ICaseEqual(directive, "no-store") ||
+               ICaseEqual(directive, "private")) {
+      result.no_store = true;
+    }
+  }
+  if (no_cache) result.max_age = std::chrono::seconds{0};
+  return result;
+}
+
+bool IsCacheable(const PluginRequest& request) {
+  // The responses to the requests of different users may differ
+  return request.GetMethod() == "GET" && !request.HasBody() &&
+         !request.HasCredentials() && !request.IsStreamedResponse();
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
+  writer["hits"] = stats.hits;
+  writer["coalesced"] = stats.coalesced;
+  writer["misses"] = stats.misses;
+  writer["revalidated"] = stats.revalidated;
+}
+
+Plugin::Plugin(std::size_t max_entries)
+    : http::Plugin(kName), entries_(max_entries) {}
+
+std::shared_ptr<Response> Plugin::HookBeforePerform(PluginRequest& request) {
+  if (!IsCacheable(request)) return nullptr;
+
+  const auto& url = request.GetOriginalUrl();
+  auto& stats = GetStats(request.GetDestination());
+  const auto deadline = engine::Deadline::FromDuration(request.GetTimeout());
+
+  std::optional<engine::Future<void>> leader_completion;
+  {
+    const std::lock_guard lock{mutex_};
+    if (auto response = FindFresh(url)) {
+      ++stats.hits;
+      return response;
+    }
+
+    auto [it, inserted] = in_flight_.try_emplace(url);
+    if (inserted || it->second.deadline.IsReached()) {
+      // The request becomes the one the concurrent misses wait for
+      it->second.deadline = deadline;
+      const auto* entry = entries_.Get(url);
+      if (entry && !entry->etag.empty()) {
+        request.SetHeader(headers::kIfNoneMatch, entry->etag);
+      }
+    } else {
+      leader_completion.emplace(
+          it->second.waiters.emplace_back().get_future());
+    }
+  }
+
+  if (leader_completion) {
+    // Whatever the outcome is, the cache is checked once again and the request
+    // is sent on a miss
+    [[maybe_unused]] const auto status =
+        leader_completion->wait_until(deadline);
+
+    const std::lock_guard lock{mutex_};
+    if (auto response = FindFresh(url)) {
+      ++stats.coalesced;
+      return response;
+    }
+  }
+
+  ++stats.misses;
+  return nullptr;
+}
+
+void Plugin::HookPerformRequest(PluginRequest&) {}
+
+void Plugin::HookCreateSpan(PluginRequest&) {}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+  if (!IsCacheable(request)) return;
+
+  const auto& url = request.GetOriginalUrl();
+  std::vector<engine::Promise<void>> waiters;
+  {
+    const std::lock_guard lock{mutex_};
+    const auto now = Clock::now();
+    if (response.status_code() == Status::NotModified) {
+      if (auto* entry = entries_.Get(url)) {
+        entry->expires = now + ParseCacheControl(response.headers()).max_age;
+        response.SetStatusCode(entry->status);
+        response.headers() = entry->headers;
+        response.cookies() = entry->cookies;
+        response.sink_string() = entry->body;
+        ++GetStats(request.GetDestination()).revalidated;
+      }
+    } else if (response.status_code() == Status::OK) {
+      Store(url, response, now);
+    }
+    waiters = ReleaseInFlight(url);
+  }
+
+  for (auto& waiter : waiters) waiter.set_value();
+}
+
+void Plugin::HookOnError(PluginRequest& request, std::error_code) {
+  if (!IsCacheable(request)) return;
+
+  std::vector<engine::Promise<void>> waiters;
+  {
+    const std::lock_guard lock{mutex_};
+    waiters = ReleaseInFlight(request.GetOriginalUrl());
+  }
+
+  // The waiters find no fresh entry and send their own requests
+  for (auto& waiter : waiters) waiter.set_value();
+}
+
+void Plugin::WriteStatistics(utils::statistics::Writer& writer) const {
+  const std::lock_guard lock{stats_mutex_};
+  for (const auto& [destination, stats] : stats_) {
+    writer.ValueWithLabels(stats, {"http_destination", destination});
+  }
+}
+
+Stats& Plugin::GetStats(const std::string& destination) {
+  const std::lock_guard lock{stats_mutex_};
+  // References to the elements of std::unordered_map are stable
+  return stats_[destination];
+}
+
+std::shared_ptr<Response> Plugin::FindFresh(const std::string& url) {
+  const auto* entry = entries_.Get(url);
+  if (!entry || Clock::now() >= entry->expires) return nullptr;
+
+  auto response = std::make_shared<Response>();
+  response->SetStatusCode(entry->status);
+  response->headers() = entry->headers;
+  response->cookies() = entry->cookies;
+  response->sink_string() = entry->body;
+  return response;
+}
+
+void Plugin::Store(const std::string& url, const Response& response,
+                   Clock::time_point now) {
+  const auto& response_headers = response.headers();
+  const auto cache_control = ParseCacheControl(response_headers);
+  auto etag = utils::FindOptional(response_headers, headers::kETag);
+
+  // Responses that vary by the request headers are not told apart
+  const bool varies =
+      response_headers.find(headers::kVary) != response_headers.end();
+  if (cache_control.no_store || varies ||
+      (cache_control.max_age.count() <= 0 && !etag)) {
+    entries_.Erase(url);
+    return;
+  }
+
+  entries_.Put(url, Entry{response.status_code(), response_headers,
+                          response.cookies(), std::string{response.body_view()},
+                          etag.value_or(std::string{}),
+                          now + cache_control.max_age});
+}
+
+std::vector<engine::Promise<void>> Plugin::ReleaseInFlight(
+    const std::string& url) {
+  std::vector<engine::Promise<void>> waiters;
+  const auto it = in_flight_.find(url);
+  if (it != in_flight_.end()) {
+    waiters = std::move(it->second.waiters);
+    in_flight_.erase(it);
+  }
+  return waiters;
+}
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
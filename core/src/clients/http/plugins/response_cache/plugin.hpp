@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::response_cache {
+
+struct Stats {
+  /// Served from the cache right away
+  utils::statistics::RateCounter hits;
+  /// Served from the cache after waiting for a concurrent request
+  utils::statistics::RateCounter coalesced;
+  /// Sent to the network
+  utils::statistics::RateCounter misses;
+  /// Served from the cache after a `304 Not Modified` response
+  utils::statistics::RateCounter revalidated;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
+
+/// Caches the responses to the GET requests without a body and credentials
+/// (Authorization or Cookie headers, HTTP authentication) by their URL for
+/// the `max-age` of their `Cache-Control` header, revalidates the stale ones
+/// that have an `ETag` via `If-None-Match`. Concurrent misses of the same URL
+/// wait for the first of them to complete, but no longer than their timeout.
+class Plugin final : public http::Plugin {
+ public:
+  explicit Plugin(std::size_t max_entries);
+
+  std::shared_ptr<Response> HookBeforePerform(PluginRequest& request) override;
+
+  void HookPerformRequest(PluginRequest& request) override;
+
+  void HookCreateSpan(PluginRequest& request) override;
+
+  void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+  void HookOnError(PluginRequest& request, std::error_code ec) override;
+
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    Status status;
+    Headers headers;
+    Response::CookiesMap cookies;
+    std::string body;
+    std::string etag;
+    Clock::time_point expires;
+  };
+
+  struct InFlight {
+    engine::Deadline deadline;
+    std::vector<engine::Promise<void>> waiters;
+  };
+
+  Stats& GetStats(const std::string& destination);
+
+  std::shared_ptr<Response> FindFresh(const std::string& url);
+
+  void Store(const std::string& url, const Response& response,
+             Clock::time_point now);
+
+  // Must be called with the mutex_ locked
+  std::vector<engine::Promise<void>> ReleaseInFlight(const std::string& url);
+
+  std::mutex mutex_;
+  cache::LruMap<std::string, Entry> entries_;
+  std::unordered_map<std::string, InFlight> in_flight_;
+
+  mutable std::mutex stats_mutex_;
+  std::unordered_map<std::string, Stats> stats_;
+};
+
+}  // namespace clients::http::plugins::response_cache
+
+USERVER_NAMESPACE_END
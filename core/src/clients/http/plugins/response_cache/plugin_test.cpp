@@ -0,0 +1,216 @@
+#include <clients/http/plugins/response_cache/plugin.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/impl/config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/tracing/manager.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::plugins::response_cache::Plugin;
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr auto kTimeout = utest::kMaxTestWaitTime;
+constexpr std::string_view kBody = "cached data";
+
+struct CachingCallback {
+  std::string cache_control;
+  std::chrono::milliseconds delay{0};
+  std::shared_ptr<std::atomic<int>> requests =
+      std::make_shared<std::atomic<int>>(0);
+  std::shared_ptr<std::atomic<int>> not_modified =
+      std::make_shared<std::atomic<int>>(0);
+
+  HttpResponse operator()(const HttpRequest& request) const {
+    ++*requests;
+    engine::SleepFor(delay);
+
+    if (request.find("If-None-Match: \"v1\"") != std::string::npos) {
+      ++*not_modified;
+      return {"HTTP/1.1 304 Not Modified\r\nConnection: close\r\n"
+              "Cache-Control: " +
+                  cache_control + "\r\nETag: \"v1\"\r\n\r\n",
+              HttpResponse::kWriteAndClose};
+    }
+
+    return {"HTTP/1.1 200 OK\r\nConnection: close\r\nCache-Control: " +
+                cache_control + "\r\nETag: \"v1\"\r\nContent-Length: " +
+                std::to_string(kBody.size()) + "\r\n\r\n" + std::string{kBody},
+            HttpResponse::kWriteAndClose};
+  }
+};
+
+std::shared_ptr<clients::http::Client> CreateHttpClient(Plugin& plugin) {
+  static const tracing::GenericTracingManager kTracingManager{
+      tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 1;
+  settings.tracing_manager = &kTracingManager;
+
+  return std::make_shared<clients::http::Client>(
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{
+          utils::NotNull<clients::http::Plugin*>{&plugin}});
+}
+
+std::shared_ptr<clients::http::Response> Get(clients::http::Client& client,
+                                             const std::string& url) {
+  return client.CreateRequest().get(url).timeout(kTimeout).perform();
+}
+
+}  // namespace
+
+UTEST(HttpClientResponseCache, MaxAge) {
+  const CachingCallback callback{"public, max-age=600"};
+  const utest::SimpleServer http_server{callback};
+  Plugin plugin{100};
+  auto http_client_ptr = CreateHttpClient(plugin);
+  const auto url = http_server.GetBaseUrl() + "/config";
+
+  for (int i = 0; i < 3; ++i) {
+    const auto response = Get(*http_client_ptr, url);
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body_view(), kBody);
+  }
+  EXPECT_EQ(*callback.requests, 1);
+
+  Get(*http_client_ptr, url + "?other");
+  EXPECT_EQ(*callback.requests, 2);
+
+  const auto response = http_client_ptr->CreateRequest()
+                            .post(url, "data")
+                            .timeout(kTimeout)
+                            .perform();
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(*callback.requests, 3);
+}
+
+UTEST(HttpClientResponseCache, Revalidation) {
+  const CachingCallback callback{"no-cache"};
+  const utest::SimpleServer http_server{callback};
+  Plugin plugin{100};
+  auto http_client_ptr = CreateHttpClient(plugin);
+  const auto url = http_server.GetBaseUrl() + "/config";
+
+  for (int i = 0; i < 3; ++i) {
+    const auto response = Get(*http_client_ptr, url);
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body_view(), kBody);
+  }
+  EXPECT_EQ(*callback.requests, 3);
+  EXPECT_EQ(*callback.not_modified, 2);
+}
+
+UTEST(HttpClientResponseCache, NoStore) {
+  const CachingCallback callback{"no-store"};
+  const utest::SimpleServer http_server{callback};
+  Plugin plugin{100};
+  auto http_client_ptr = CreateHttpClient(plugin);
+  const auto url = http_server.GetBaseUrl() + "/config";
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(Get(*http_client_ptr, url)->body_view(), kBody);
+  }
+  EXPECT_EQ(*callback.requests, 2);
+  EXPECT_EQ(*callback.not_modified, 0);
+}
+
+UTEST(HttpClientResponseCache, Credentials) {
+  const CachingCallback callback{"public, max-age=600"};
+  const utest::SimpleServer http_server{callback};
+  Plugin plugin{100};
+  auto http_client_ptr = CreateHttpClient(plugin);
+  const auto url = http_server.GetBaseUrl() + "/config";
+
+  for (int i = 0; i < 2; ++i) {
+    const auto response = http_client_ptr->CreateRequest()
+                              .get(url)
+                              .headers({{"Authorization", "Bearer token"}})
+                              .timeout(kTimeout)
+                              .perform();
+    EXPECT_EQ(response->body_view(), kBody);
+  }
+  EXPECT_EQ(*callback.requests, 2);
+
+  for (int i = 0; i < 2; ++i) {
+    const auto response = http_client_ptr->CreateRequest()
+                              .get(url)
+                              .cookies(std::unordered_map<std::string,
+                                                          std::string>{
+                                  {"session", "1"}})
+                              .timeout(kTimeout)
+                              .perform();
+    EXPECT_EQ(response->body_view(), kBody);
+  }
+  EXPECT_EQ(*callback.requests, 4);
+
+  // The requests with credentials do not fill the cache for the others
+  EXPECT_EQ(Get(*http_client_ptr, url)->body_view(), kBody);
+  EXPECT_EQ(*callback.requests, 5);
+}
+
+UTEST_MT(HttpClientResponseCache, LeaderError, 4) {
+  const CachingCallback caching{"max-age=600"};
+  const auto callback = [caching](const HttpRequest& request) -> HttpResponse {
+    if (*caching.requests == 0) {
+      ++*caching.requests;
+      engine::SleepFor(std::chrono::milliseconds{100});
+      // The connection is closed without any response
+      return {"", HttpResponse::kWriteAndClose};
+    }
+    return caching(request);
+  };
+  const utest::SimpleServer http_server{callback};
+  Plugin plugin{100};
+  auto http_client_ptr = CreateHttpClient(plugin);
+  const auto url = http_server.GetBaseUrl() + "/config";
+
+  auto leader = utils::Async("leader", [&] { Get(*http_client_ptr, url); });
+  while (*caching.requests == 0) engine::Yield();
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<engine::TaskWithResult<std::string>> followers;
+  for (int i = 0; i < 2; ++i) {
+    followers.push_back(utils::Async("follower", [&] {
+      return Get(*http_client_ptr, url)->body();
+    }));
+  }
+
+  UEXPECT_THROW(leader.Get(), std::exception);
+  // The followers are released on the error and send their own requests
+  for (auto& follower : followers) EXPECT_EQ(follower.Get(), kBody);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, kTimeout / 2);
+}
+
+UTEST_MT(HttpClientResponseCache, Coalescing, 4) {
+  const CachingCallback callback{"max-age=600", std::chrono::milliseconds{100}};
+  const utest::SimpleServer http_server{callback};
+  Plugin plugin{100};
+  auto http_client_ptr = CreateHttpClient(plugin);
+  const auto url = http_server.GetBaseUrl() + "/config";
+
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  for (int i = 0; i < 8; ++i) {
+    tasks.push_back(utils::Async("request", [&] {
+      return Get(*http_client_ptr, url)->body();
+    }));
+  }
+  for (auto& task : tasks) EXPECT_EQ(task.Get(), kBody);
+  EXPECT_EQ(*callback.requests, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -337,6 +337,20 @@ Request Request::retry(short retries, bool on_fails) && {
   return std::move(this->retry(retries, on_fails));
 }
 
+Request& Request::hedging(const HedgingSettings& settings) & {
+  UASSERT_MSG(settings.delay.count() >= 0,
+              "hedging delay < 0, uninitialized variable?");
+  UASSERT_MSG(!settings.delay_percentile ||
+                  (*settings.delay_percentile >= 0 &&
+                   *settings.delay_percentile <= 100),
+              "hedging delay percentile is out of [0, 100]");
+  pimpl_->hedging(settings);
+  return *this;
+}
+Request Request::hedging(const HedgingSettings& settings) && {
+  return std::move(this->hedging(settings));
+}
+
 Request& Request::unix_socket_path(const std::string& path) & {
   pimpl_->unix_socket_path(path);
   return *this;
@@ -376,6 +390,20 @@ Request Request::data(std::string data) && {
   return std::move(this->data(std::move(data)));
 }
 
+Request& Request::data_stream(
+    std::shared_ptr<concurrent::StringStreamQueue> queue,
+    std::optional<std::size_t> content_length) & {
+  pimpl_->easy().add_header(kHeaderExpect, "",
+                            curl::easy::EmptyHeaderAction::kDoNotSend);
+  pimpl_->data_stream(std::move(queue), content_length);
+  return *this;
+}
+Request Request::data_stream(
+    std::shared_ptr<concurrent::StringStreamQueue> queue,
+    std::optional<std::size_t> content_length) && {
+  return std::move(this->data_stream(std::move(queue), content_length));
+}
+
 Request& Request::form(const Form& form) & {
   pimpl_->easy().set_http_post(form.GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
@@ -465,6 +493,7 @@ Request Request::proxy_auth_type(ProxyAuthType value) && {
 
 Request& Request::cookies(const Cookies& cookies) & {
   SetCookies(pimpl_->easy(), cookies);
+  if (!cookies.empty()) pimpl_->SetHasCookies();
   return *this;
 }
 Request Request::cookies(const Cookies& cookies) && {
@@ -474,6 +503,7 @@ Request Request::cookies(const Cookies& cookies) && {
 Request& Request::cookies(
     const std::unordered_map<std::string, std::string>& cookies) & {
   SetCookies(pimpl_->easy(), cookies);
+  if (!cookies.empty()) pimpl_->SetHasCookies();
   return *this;
 }
 Request Request::cookies(
@@ -504,6 +534,7 @@ Request& Request::method(HttpMethod method) & {
       if (!pimpl_->easy().has_post_data()) data({});
       break;
   };
+  pimpl_->SetMethod(std::string{ToStringView(method)});
   return *this;
 }
 
@@ -535,6 +566,7 @@ Request& Request::set_custom_http_request_method(std::string method) & {
          "changing of request type. Use it only if you need to make "
          "GET-request with body.";
   pimpl_->easy().set_custom_request(method);
+  pimpl_->SetMethod(std::move(method));
   return *this;
 }
 Request Request::set_custom_http_request_method(std::string method) && {
@@ -646,6 +678,16 @@ void Request::SetHeadersPropagator(
   pimpl_->SetHeadersPropagator(headers_propagator);
 }
 
+void Request::SetAddressBalancer(AddressBalancer* address_balancer) & {
+  pimpl_->SetAddressBalancer(address_balancer);
+}
+
+void Request::SetDestinationGuardsConfig(
+    const impl::RetryBudgetConfig& retry_budget,
+    const impl::CircuitBreakerConfig& circuit_breaker) & {
+  pimpl_->SetDestinationGuardsConfig(retry_budget, circuit_breaker);
+}
+
 const std::string& Request::GetUrl() const& {
   return pimpl_->easy().get_original_url();
 }
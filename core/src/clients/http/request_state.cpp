@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <map>
 #include <string_view>
 
@@ -184,6 +185,10 @@ RequestState::RequestState(
 
   // set autodecoding for gzip and deflate
   easy().set_accept_encoding("gzip,deflate,identity");
+
+  // Wait for a connection that may be multiplexed rather than open a new one,
+  // has no effect unless the multiplexing is enabled for the client
+  easy().set_pipewait(true);
 }
 
 RequestState::~RequestState() {
@@ -260,6 +265,9 @@ void RequestState::client_key_cert(crypto::PrivateKey pkey,
 
 void RequestState::http_version(curl::easy::http_version_t version) {
   easy().set_http_version(version);
+  // HTTP/1.x connections are never multiplexed, there is nothing to wait for
+  easy().set_pipewait(version != curl::easy::http_version_1_0 &&
+                      version != curl::easy::http_version_1_1);
 }
 
 void RequestState::set_timeout(long timeout_ms) {
@@ -273,6 +281,18 @@ void RequestState::retry(short retries, bool on_fails) {
   retry_.on_fails = on_fails;
 }
 
+void RequestState::hedging(const HedgingSettings& settings) {
+  hedging_.settings.reset();
+  if (settings.max_attempts > 1) hedging_.settings = settings;
+}
+
+void RequestState::data_stream(std::shared_ptr<Queue> queue,
+                               std::optional<std::size_t> content_length) {
+  UASSERT(queue);
+  body_queue_ = std::move(queue);
+  body_content_length_ = content_length;
+}
+
 void RequestState::unix_socket_path(const std::string& path) {
   easy().set_unix_socket_path(path);
 }
@@ -281,6 +301,7 @@ void RequestState::connect_to(const ConnectTo& connect_to) {
   curl::native::curl_slist* ptr = connect_to.GetUnderlying();
   if (ptr) {
     easy().set_connect_to(ptr);
+    connect_to_set_ = true;
   }
 }
 
@@ -299,11 +320,29 @@ void RequestState::http_auth_type(curl::easy::httpauth_t value, bool auth_only,
   easy().set_http_auth(value, auth_only);
   easy().set_user(std::string{user}.c_str());
   easy().set_password(std::string{password}.c_str());
+  has_credentials_ = true;
+}
+
+bool RequestState::HasBody() const {
+  return body_queue_ != nullptr || easy().has_post_data();
+}
+
+bool RequestState::HasCredentials() const {
+  namespace headers = USERVER_NAMESPACE::http::headers;
+  return has_credentials_ ||
+         easy().FindHeaderByName(headers::kAuthorization) ||
+         easy().FindHeaderByName(headers::kCookie);
 }
 
 void RequestState::Cancel() {
   // We can not call `retry_.timer.reset();` here because of data race
   is_cancelled_ = true;
+  if (hedging_.thread_control) {
+    // easy_ may be swapped with an extra attempt in the ev thread
+    hedging_.thread_control->RunInEvLoopSync(
+        [this] { CancelHedgedAttempts(); });
+    return;
+  }
   easy().cancel();
 }
 
@@ -312,6 +351,7 @@ void RequestState::SetDestinationMetricNameAuto(std::string destination) {
 }
 
 void RequestState::SetDestinationMetricName(const std::string& destination) {
+  destination_metric_name_ = destination;
   dest_req_stats_ = dest_stats_->GetStatisticsForDestination(destination);
 }
 
@@ -337,7 +377,21 @@ size_t RequestState::on_header(void* ptr, size_t size, size_t nmemb,
                                void* userdata) {
   auto* self = static_cast<RequestState*>(userdata);
   const std::size_t data_size = size * nmemb;
-  if (self) self->parse_header(static_cast<char*>(ptr), data_size);
+  if (self) {
+    ParseHeader(*self->response_, self->easy(), static_cast<char*>(ptr),
+                data_size);
+  }
+  return data_size;
+}
+
+size_t RequestState::on_hedged_header(void* ptr, size_t size, size_t nmemb,
+                                      void* userdata) {
+  auto* attempt = static_cast<HedgedAttempt*>(userdata);
+  const std::size_t data_size = size * nmemb;
+  if (attempt) {
+    ParseHeader(*attempt->response, attempt->easy->Easy(),
+                static_cast<char*>(ptr), data_size);
+  }
   return data_size;
 }
 
@@ -385,6 +439,9 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   auto& span = holder->span_storage_->Get();
   auto& easy = holder->easy();
 
+  holder->FinishBodyStream();
+  holder->FinishAddressLease(holder->balancing_.lease, easy, err);
+
   // TODO don't swallow errors, report them to StreamedResponse
   auto* stream_data = std::get_if<StreamData>(&holder->data_);
   if (stream_data && !stream_data->headers_promise_set.exchange(true)) {
@@ -402,9 +459,17 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   }
 
   holder->AccountResponse(err);
+  holder->AccountCircuitBreaker(err, status_code);
   const auto sockets = easy.get_num_connects();
-  holder->WithRequestStats(
-      [sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+  const bool is_http2 =
+      easy.get_http_version() == curl::native::CURL_HTTP_VERSION_2_0;
+  // The time of TLS connect is only set for TLS connections
+  const bool is_tls = easy.get_appconnect_time_usec() > 0;
+  holder->WithRequestStats([sockets, is_http2, is_tls](RequestStats& stats) {
+    stats.AccountOpenSockets(sockets);
+    stats.AccountConnectionReuse(sockets == 0, is_http2);
+    if (is_tls) stats.AccountTlsHandshakes(sockets);
+  });
 
   span.AddTag(tracing::kAttempts, holder->retry_.current);
   if (holder->deadline_propagation_config_.update_header) {
@@ -425,14 +490,18 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
       LOG_DEBUG() << "cURL error details: " << holder->errorbuffer_.data();
     }
 
+    holder->plugin_pipeline_.HookOnError(*holder, err);
+
     holder->span_storage_.reset();
 
     const utils::Overloaded visitor{
         [&holder, &err](FullBufferedData& buffered_data) {
           { [[maybe_unused]] const auto cleanup = holder->response_move(); }
+          auto exception = holder->PrepareException(err);
+          holder->FinishHedging();
           auto promise = std::move(buffered_data.promise_);
           // The task will wake up and may reuse RequestState.
-          promise.set_exception(holder->PrepareException(err));
+          promise.set_exception(std::move(exception));
         },
         [](StreamData& stream_data) {
           auto producer = std::move(stream_data.queue_producer);
@@ -445,17 +514,19 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
     holder->response()->SetStatusCode(status_code);
     holder->response()->SetStats(easy.get_local_stats());
 
-    if (!holder->response()->IsOk()) span.AddTag(tracing::kErrorFlag, true);
-
     holder->plugin_pipeline_.HookOnCompleted(*holder, *holder->response());
 
+    if (!holder->response()->IsOk()) span.AddTag(tracing::kErrorFlag, true);
+
     holder->span_storage_.reset();
 
     const utils::Overloaded visitor{
         [&holder](FullBufferedData& buffered_data) {
+          auto response = holder->response_move();
+          holder->FinishHedging();
           auto promise = std::move(buffered_data.promise_);
           // The task will wake up and may reuse RequestState.
-          promise.set_value(holder->response_move());
+          promise.set_value(std::move(response));
         },
         [](StreamData& stream_data) {
           auto producer = std::move(stream_data.queue_producer);
@@ -474,6 +545,7 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder,
   LOG_TRACE() << "RequestImpl::on_retry"
               << tracing::impl::LogSpanAsLastNonCoro{
                      holder->span_storage_->Get()};
+  holder->FinishAddressLease(holder->balancing_.lease, holder->easy(), err);
 
   // We do not need to retry:
   // - if we got result and HTTP code is good
@@ -485,7 +557,7 @@ void RequestState::on_retry(std::shared_ptr<RequestState> holder,
       (holder->retry_.current >= holder->retry_.retries) ||
       (err && !holder->retry_.on_fails) || holder->is_cancelled_.load();
 
-  if (not_need_retry) {
+  if (not_need_retry || !holder->AdmitRetry()) {
     // finish if no need to retry
     RequestState::on_completed(std::move(holder), err);
   } else {
@@ -528,11 +600,174 @@ void RequestState::on_retry_timer(std::error_code err) {
     on_completed(shared_from_this(), err);
 }
 
-void RequestState::ParseSingleCookie(const char* ptr, size_t size) {
+void RequestState::on_hedged_completed(std::shared_ptr<RequestState> holder,
+                                       HedgedAttempt* attempt,
+                                       std::error_code err) {
+  UASSERT(holder);
+  auto& hedging = holder->hedging_;
+  // The attempts cancelled by CompleteHedging()
+  if (hedging.finished) return;
+
+  UASSERT(hedging.in_flight > 0);
+  --hedging.in_flight;
+
+  const auto& easy = attempt ? attempt->easy->Easy() : holder->easy();
+  holder->FinishAddressLease(
+      attempt ? attempt->address_lease : holder->balancing_.lease, easy, err);
+  const bool is_ok = !err && static_cast<Status>(easy.get_response_code()) <
+                                 kLeastBadHttpCodeForEB;
+  if (!is_ok && hedging.in_flight > 0 && !holder->is_cancelled_.load()) {
+    // Wait for the other attempts
+    return;
+  }
+
+  RequestState::CompleteHedging(std::move(holder), attempt, err);
+}
+
+void RequestState::ScheduleHedgedAttempt() {
+  if (!hedging_.thread_control) return;
+
+  const auto& settings = *hedging_.settings;
+  hedging_.delay = settings.delay;
+  if (settings.delay_percentile && dest_req_stats_) {
+    hedging_.delay = std::max(
+        hedging_.delay,
+        dest_req_stats_->GetTimingsPercentile(*settings.delay_percentile));
+  }
+  hedging_.start_time = std::chrono::steady_clock::now();
+
+  // Runs in the task that performs the request, curl_easy_duphandle() must
+  // not block the ev thread
+  hedging_.easies.clear();
+  try {
+    // The copies share the headers, the body and the SSL context callback
+    // data with easy(), they outlive the attempts
+    for (std::size_t i = 1; i < settings.max_attempts; ++i) {
+      hedging_.easies.push_back(easy_->CloneBound());
+    }
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to copy the handle for the hedged attempts: "
+                  << e;
+  }
+  if (hedging_.easies.empty()) return;
+
+  // The previous timer, if any, was cancelled by CompleteHedging()
+  hedging_.timer.emplace(*hedging_.thread_control);
+  hedging_.timer->SingleshotAsync(
+      hedging_.delay, [holder = shared_from_this()](std::error_code err) {
+        holder->on_hedging_timer(err);
+      });
+}
+
+void RequestState::on_hedging_timer(std::error_code err) {
+  if (err || hedging_.finished || is_cancelled_.load()) return;
+
+  StartHedgedAttempt();
+
+  if (!hedging_.easies.empty()) {
+    hedging_.timer->SingleshotAsync(
+        hedging_.delay, [holder = shared_from_this()](std::error_code err) {
+          holder->on_hedging_timer(err);
+        });
+  }
+}
+
+void RequestState::StartHedgedAttempt() {
+  const auto timeout_left =
+      original_timeout_ -
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - hedging_.start_time);
+  if (timeout_left <= std::chrono::milliseconds::zero()) return;
+
+  if (hedging_.easies.empty()) return;
+
+  auto attempt = std::make_unique<HedgedAttempt>();
+  attempt->easy = std::move(hedging_.easies.back());
+  hedging_.easies.pop_back();
+  try {
+    auto& attempt_easy = attempt->easy->Easy();
+    attempt_easy.set_error_buffer(attempt->errorbuffer.data());
+    attempt_easy.set_header_function(&RequestState::on_hedged_header);
+    attempt_easy.set_header_data(attempt.get());
+    if (easy().get_share()) attempt_easy.set_share(easy().get_share());
+    attempt_easy.set_timeout_ms(timeout_left.count());
+    attempt_easy.set_connect_timeout_ms(timeout_left.count());
+    if (!balancing_.addresses.empty()) {
+      PickAddress(attempt_easy, attempt->address_lease,
+                  balancing_.last_address);
+    }
+
+    attempt->response = std::make_shared<Response>();
+    attempt->response->SetStatusCode(Status::InternalServerError);
+    attempt_easy.set_sink(&attempt->response->sink_string());
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to start a hedged attempt: " << e
+                  << tracing::impl::LogSpanAsLastNonCoro{
+                         span_storage_->Get()};
+    return;
+  }
+
+  ++hedging_.started;
+  ++hedging_.in_flight;
+  auto* attempt_ptr = attempt.get();
+  hedging_.attempts.push_back(std::move(attempt));
+  attempt_ptr->easy->Easy().async_perform(
+      [holder = shared_from_this(), attempt_ptr](std::error_code err) mutable {
+        RequestState::on_hedged_completed(std::move(holder), attempt_ptr, err);
+      });
+}
+
+void RequestState::CancelHedgedAttempts() {
+  if (hedging_.finished) return;
+
+  // The first cancelled attempt in flight completes the request
+  easy().cancel();
+  for (std::size_t i = 0; i < hedging_.attempts.size() && !hedging_.finished;
+       ++i) {
+    hedging_.attempts[i]->easy->Easy().cancel();
+  }
+}
+
+void RequestState::CompleteHedging(std::shared_ptr<RequestState> holder,
+                                   HedgedAttempt* winner,
+                                   std::error_code err) {
+  auto& hedging = holder->hedging_;
+  hedging.finished = true;
+  if (hedging.timer) hedging.timer->Cancel();
+
+  // Completes the other attempts, the completed ones are not affected
+  holder->easy().cancel();
+  for (const auto& attempt : hedging.attempts) attempt->easy->Easy().cancel();
+
+  if (winner) {
+    // The attempt of easy() is cancelled, that tells nothing about its address
+    holder->balancing_.lease.reset();
+    hedging.winner = winner;
+    std::swap(holder->easy_, winner->easy);
+    std::swap(holder->response_, winner->response);
+    holder->errorbuffer_ = winner->errorbuffer;
+  }
+
+  holder->span_storage_->Get().AddTag("hedged_attempts", hedging.started);
+  RequestState::on_completed(std::move(holder), err);
+}
+
+void RequestState::FinishHedging() {
+  if (hedging_.winner) {
+    // Restore the easy with the request settings
+    std::swap(easy_, hedging_.winner->easy);
+    hedging_.winner = nullptr;
+  }
+  hedging_.easies.clear();
+  hedging_.attempts.clear();
+}
+
+void RequestState::ParseSingleCookie(Response& response, const char* ptr,
+                                     size_t size) {
   if (auto cookie =
           server::http::Cookie::FromString(std::string_view(ptr, size))) {
     [[maybe_unused]] auto [it, ok] =
-        response_->cookies().emplace(cookie->Name(), std::move(*cookie));
+        response.cookies().emplace(cookie->Name(), std::move(*cookie));
     if (!ok) {
       LOG_WARNING() << "Failed to add cookie '" + it->first +
                            "', already added";
@@ -540,14 +775,15 @@ void RequestState::ParseSingleCookie(const char* ptr, size_t size) {
   }
 }
 
-void RequestState::parse_header(char* ptr, size_t size) try {
+void RequestState::ParseHeader(Response& response, curl::easy& easy,
+                               char* ptr, size_t size) try {
   /* It is a fast path in curl's thread (io thread).  Creation of tmp
    * std::string, boost::trim_right_if(), etc. is too expensive. */
 
   auto* end = rfind_not_space(ptr, size);
   if (ptr == end) {
-    const auto status_code = static_cast<Status>(easy().get_response_code());
-    response()->SetStatusCode(status_code);
+    const auto status_code = static_cast<Status>(easy.get_response_code());
+    response.SetStatusCode(status_code);
     return;
   }
   *end = '\0';
@@ -555,10 +791,10 @@ void RequestState::parse_header(char* ptr, size_t size) try {
   const char* col_pos = static_cast<const char*>(memchr(ptr, ':', size));
   if (col_pos == nullptr) {
     if (IsHttpStatusLineStart(ptr, size)) {
-      for (auto& [k, v] : response_->headers())
+      for (auto& [k, v] : response.headers())
         LOG_INFO() << "drop header " << k << "=" << v;
       // In case of redirect drop 1st response headers
-      response_->headers().clear();
+      response.headers().clear();
     }
     return;
   }
@@ -568,7 +804,7 @@ void RequestState::parse_header(char* ptr, size_t size) try {
   ++col_pos;
 
   if (IsSetCookie(key)) {
-    return ParseSingleCookie(col_pos, end - col_pos);
+    return ParseSingleCookie(response, col_pos, end - col_pos);
   }
 
   // From https://tools.ietf.org/html/rfc7230#page-22 :
@@ -580,7 +816,7 @@ void RequestState::parse_header(char* ptr, size_t size) try {
   }
 
   std::string value(col_pos, end - col_pos);
-  response_->headers().emplace(std::move(key), std::move(value));
+  response.headers().emplace(std::move(key), std::move(value));
 } catch (const std::exception& e) {
   LOG_ERROR() << "Failed to parse header: " << e.what();
 }
@@ -607,7 +843,26 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(
 
   auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
 
-  if (UpdateTimeoutFromDeadlineAndCheck()) {
+  if (!UpdateTimeoutFromDeadlineAndCheck()) return future;
+
+  if (auto response = plugin_pipeline_.HookBeforePerform(*this)) {
+    span.AddTag(tracing::kHttpStatusCode, response->status_code());
+    span.AddTag("served_by_plugin", 1);
+    span_storage_.reset();
+    std::get_if<FullBufferedData>(&data_)->promise_.set_value(
+        std::move(response));
+    return future;
+  }
+
+  if (!AdmitRequest()) return future;
+
+  StartBodyStream();
+  if (hedging_.settings && !body_stream_) {
+    hedging_.thread_control = &easy().GetThreadControl();
+    perform_request([holder = shared_from_this()](std::error_code err) mutable {
+      RequestState::on_hedged_completed(std::move(holder), nullptr, err);
+    });
+  } else {
     perform_request([holder = shared_from_this()](std::error_code err) mutable {
       RequestState::on_retry(std::move(holder), err);
     });
@@ -633,7 +888,8 @@ engine::Future<void> RequestState::async_perform_stream(
 
   auto future = std::get_if<StreamData>(&data_)->headers_promise.get_future();
 
-  if (UpdateTimeoutFromDeadlineAndCheck()) {
+  if (UpdateTimeoutFromDeadlineAndCheck() && AdmitRequest()) {
+    StartBodyStream();
     perform_request([holder = shared_from_this()](std::error_code err) mutable {
       RequestState::on_completed(std::move(holder), err);
     });
@@ -659,14 +915,17 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
                          handler = std::move(handler)]() mutable {
       try {
         ResolveTargetAddress(*resolver_);
+        ScheduleHedgedAttempt();
         easy().async_perform(std::move(handler));
       } catch (const clients::dns::ResolverException& ex) {
+        FinishBodyStream();
         // TODO: should retry - TAXICOMMON-4932
         auto* buffered_data = std::get_if<FullBufferedData>(&data_);
         if (buffered_data) {
           buffered_data->promise_.set_exception(std::current_exception());
         }
       } catch (const BaseException& ex) {
+        FinishBodyStream();
         auto* buffered_data = std::get_if<FullBufferedData>(&data_);
         if (buffered_data) {
           buffered_data->promise_.set_exception(std::current_exception());
@@ -674,6 +933,11 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
       }
     }).Detach();
   } else {
+    // Retries go to the addresses picked anew
+    if (!balancing_.addresses.empty()) {
+      PickAddress(easy(), balancing_.lease, balancing_.last_address);
+    }
+    ScheduleHedgedAttempt();
     easy().async_perform(std::move(handler));
   }
 }
@@ -741,9 +1005,11 @@ void RequestState::HandleDeadlineAlreadyPassed() {
   WithRequestStats(
       [](RequestStats& stats) { stats.AccountCancelledByDeadline(); });
 
-  auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(),
-                                            easy().get_local_stats());
+  FailBeforePerform(PrepareDeadlinePassedException(GetLoggedOriginalUrl(),
+                                                   easy().get_local_stats()));
+}
 
+void RequestState::FailBeforePerform(std::exception_ptr exc) {
   const utils::Overloaded visitor{
       [&exc](FullBufferedData& buffered_data) {
         auto promise = std::move(buffered_data.promise_);
@@ -812,6 +1078,60 @@ bool RequestState::ShouldRetryResponse() {
   return status_code >= kLeastBadHttpCodeForEB;
 }
 
+bool RequestState::AdmitRequest() {
+  if (!dest_req_stats_) return true;
+
+  if (dest_req_stats_->GetCircuitBreaker().AllowRequest(
+          circuit_breaker_config_)) {
+    dest_req_stats_->GetRetryBudget().AccountRequest();
+    return true;
+  }
+
+  auto& span = span_storage_->Get();
+  span.AddTag(tracing::kAttempts, 0);
+  span.AddTag(tracing::kErrorFlag, true);
+  span.AddTag("circuit_breaker_open", 1);
+
+  WithRequestStats(
+      [](RequestStats& stats) { stats.AccountCircuitBreakerRejected(); });
+
+  FailBeforePerform(std::make_exception_ptr(CircuitBreakerOpenException(
+      fmt::format("Circuit breaker is open, url: {}", GetLoggedOriginalUrl()),
+      easy().get_local_stats())));
+  return false;
+}
+
+bool RequestState::AdmitRetry() {
+  if (!dest_req_stats_ ||
+      dest_req_stats_->GetRetryBudget().TryAccountRetry(retry_budget_config_)) {
+    return true;
+  }
+
+  span_storage_->Get().AddTag("retry_budget_exhausted", 1);
+  WithRequestStats([](RequestStats& stats) { stats.AccountRetryThrottled(); });
+  return false;
+}
+
+void RequestState::AccountCircuitBreaker(std::error_code err,
+                                         Status status_code) {
+  if (!dest_req_stats_) return;
+  // Cancellation and our own deadline tell nothing about the destination
+  if (is_cancelled_.load() || err == std::errc::operation_canceled ||
+      deadline_expired_) {
+    return;
+  }
+
+  const bool is_ok = !err && status_code < kLeastBadHttpCodeForEB;
+  if (dest_req_stats_->GetCircuitBreaker().AccountResult(
+          is_ok, circuit_breaker_config_)) {
+    LOG_WARNING() << "Circuit breaker opened for destination "
+                  << destination_metric_name_ << " for "
+                  << circuit_breaker_config_.open_time.count() << "ms";
+    WithRequestStats(
+        [](RequestStats& stats) { stats.AccountCircuitBreakerOpened(); });
+  }
+}
+
 void RequestState::AccountResponse(std::error_code err) {
   const auto attempts = retry_.current;
 
@@ -853,6 +1173,19 @@ void RequestState::ResetDataForNewRequest() {
 
   is_cancelled_ = false;
   retry_.current = 1;
+  if (!balancing_.addresses.empty()) {
+    // The addresses are picked anew after the target is resolved
+    easy().set_connect_to(nullptr);
+    balancing_.addresses.clear();
+  }
+  balancing_.lease.reset();
+  hedging_.thread_control = nullptr;
+  hedging_.easies.clear();
+  hedging_.attempts.clear();
+  hedging_.winner = nullptr;
+  hedging_.started = 1;
+  hedging_.in_flight = 1;
+  hedging_.finished = false;
   remote_timeout_ = original_timeout_;
   deadline_ = server::request::GetTaskInheritedDeadline();
   deadline_expired_ = false;
@@ -909,6 +1242,109 @@ size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb,
   return CURL_WRITEFUNC_PAUSE;
 }
 
+size_t RequestState::StreamReadFunction(char* ptr, size_t size, size_t nmemb,
+                                        void* userdata) {
+  RequestState& rs = *static_cast<RequestState*>(userdata);
+  auto* stream = rs.body_stream_.get();
+  // The request is reused without a new body stream
+  if (!stream) return 0;
+
+  std::size_t copied = 0;
+  bool chunk_sent = false;
+  {
+    const std::lock_guard lock{stream->mutex};
+    const auto left = stream->chunk.size() - stream->chunk_offset;
+    if (left == 0) {
+      if (stream->eof) return 0;
+      // Resumed by the pump when the next chunk arrives
+      stream->paused = true;
+      return CURL_READFUNC_PAUSE;
+    }
+
+    copied = std::min(left, size * nmemb);
+    std::memcpy(ptr, stream->chunk.data() + stream->chunk_offset, copied);
+    stream->chunk_offset += copied;
+    chunk_sent = (stream->chunk_offset == stream->chunk.size());
+  }
+
+  if (chunk_sent) stream->chunk_sent_event.Send();
+  return copied;
+}
+
+void RequestState::StartBodyStream() {
+  if (!body_queue_) return;
+
+  body_stream_ = std::make_shared<BodyStream>(
+      std::exchange(body_queue_, nullptr)->GetConsumer());
+  // The body can not be sent twice
+  retry_.retries = 1;
+
+  easy().set_post(true);
+  easy().set_post_fields(nullptr);
+  if (body_content_length_) {
+    easy().set_post_field_size_large(
+        static_cast<curl::native::curl_off_t>(*body_content_length_));
+  } else {
+    easy().set_post_field_size_large(-1);
+    easy().add_header(USERVER_NAMESPACE::http::headers::kTransferEncoding,
+                      "chunked", curl::easy::DuplicateHeaderAction::kReplace);
+  }
+  easy().set_read_function(&RequestState::StreamReadFunction);
+  easy().set_read_data(this);
+
+  // The chunks are moved from the queue one by one, so the memory is bounded
+  // by the queue size and a single chunk
+  auto pump = engine::AsyncNoSpan([stream = body_stream_,
+                                   &thread_control = easy().GetThreadControl(),
+                                   easy = easy().shared_from_this()] {
+    while (true) {
+      std::string chunk;
+      const bool has_chunk = stream->consumer.Pop(chunk);
+      if (engine::current_task::ShouldCancel()) return;
+      if (has_chunk && chunk.empty()) continue;
+
+      bool resume = false;
+      {
+        const std::lock_guard lock{stream->mutex};
+        if (stream->finished) return;
+        stream->chunk = std::move(chunk);
+        stream->chunk_offset = 0;
+        stream->eof = !has_chunk;
+        resume = std::exchange(stream->paused, false);
+      }
+
+      if (resume) {
+        thread_control.RunInEvLoopAsync([stream, easy] {
+          {
+            const std::lock_guard lock{stream->mutex};
+            if (stream->finished) return;
+          }
+          try {
+            easy->unpause();
+          } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to resume the request body stream: " << e;
+          }
+        });
+      }
+
+      if (!has_chunk || !stream->chunk_sent_event.WaitForEvent()) return;
+    }
+  });
+  body_stream_->pump = engine::TaskCancellationToken{pump};
+  std::move(pump).Detach();
+}
+
+void RequestState::FinishBodyStream() {
+  if (!body_stream_) return;
+
+  {
+    const std::lock_guard lock{body_stream_->mutex};
+    body_stream_->finished = true;
+  }
+  body_stream_->pump.RequestCancel();
+  body_stream_.reset();
+}
+
 void RequestState::ApplyTestsuiteConfig() {
   if (!testsuite_config_) {
     return;
@@ -987,8 +1423,43 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
       addrs | boost::adaptors::transformed(
                   [](const auto& addr) { return addr.PrimaryAddressString(); });
 
-  easy().add_resolve(hostname, target.Get().GetPortPtr().get(),
+  const std::string port = target.Get().GetPortPtr().get();
+  easy().add_resolve(hostname, port,
                      fmt::to_string(fmt::join(addr_strings, ",")));
+
+  // The user-provided connect_to and the proxy take precedence
+  if (balancing_.balancer && !connect_to_set_ && proxy_url_.empty() &&
+      addrs.size() > 1) {
+    balancing_.host = hostname;
+    balancing_.port = port;
+    balancing_.addresses.assign(addr_strings.begin(), addr_strings.end());
+    PickAddress(easy(), balancing_.lease, {});
+  }
+}
+
+void RequestState::PickAddress(curl::easy& easy,
+                               std::optional<AddressBalancer::Lease>& lease,
+                               std::string_view avoid) {
+  UASSERT(balancing_.balancer);
+  lease.reset();
+  lease.emplace(balancing_.balancer->Pick(
+      utils::StrCat(balancing_.host, ":", balancing_.port),
+      balancing_.addresses, avoid));
+  easy.set_connect_to_address(balancing_.host, balancing_.port,
+                              lease->GetAddress());
+  balancing_.last_address = lease->GetAddress();
+}
+
+void RequestState::FinishAddressLease(
+    std::optional<AddressBalancer::Lease>& lease, const curl::easy& easy,
+    std::error_code err) {
+  if (!lease) return;
+  // Cancellation tells nothing about the address
+  if (!is_cancelled_.load() && err != std::errc::operation_canceled) {
+    lease->Finish(!err && static_cast<Status>(easy.get_response_code()) <
+                             kLeastBadHttpCodeForEB);
+  }
+  lease.reset();
 }
 
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) {
@@ -1000,6 +1471,17 @@ void RequestState::SetHeadersPropagator(
   headers_propagator_ = propagator;
 }
 
+void RequestState::SetAddressBalancer(AddressBalancer* address_balancer) {
+  balancing_.balancer = address_balancer;
+}
+
+void RequestState::SetDestinationGuardsConfig(
+    const impl::RetryBudgetConfig& retry_budget,
+    const impl::CircuitBreakerConfig& circuit_breaker) {
+  retry_budget_config_ = retry_budget;
+  circuit_breaker_config_ = circuit_breaker;
+}
+
 RequestTracingEditor RequestState::GetEditableTracingInstance() {
   return RequestTracingEditor(easy());
 }
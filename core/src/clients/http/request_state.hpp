@@ -1,16 +1,21 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <system_error>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/request.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -18,6 +23,8 @@
 #include <userver/crypto/private_key.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/url.hpp>
 #include <userver/tracing/in_place_span.hpp>
@@ -26,6 +33,7 @@
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/not_null.hpp>
 
+#include <clients/http/address_balancer.hpp>
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
 #include <clients/http/testsuite.hpp>
@@ -82,6 +90,11 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void set_timeout(long timeout_ms);
   /// set number of retries
   void retry(short retries, bool on_fails);
+  /// set hedging settings
+  void hedging(const HedgingSettings& settings);
+  /// set request body read from the queue
+  void data_stream(std::shared_ptr<Queue> queue,
+                   std::optional<std::size_t> content_length);
   /// set unix socket as transport instead of TCP
   void unix_socket_path(const std::string& path);
   /// set connect_to option
@@ -96,6 +109,20 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   /// get timeout value in milliseconds
   long timeout() const { return original_timeout_.count(); }
+  /// remember the name of the HTTP method for plugins
+  void SetMethod(std::string method) { method_ = std::move(method); }
+  /// get the name of the HTTP method
+  std::string_view GetMethod() const { return method_; }
+  /// true iff the request has a body to send
+  bool HasBody() const;
+  /// remember that the cookies are set for the request
+  void SetHasCookies() { has_credentials_ = true; }
+  /// true iff the request carries the cookies or the authorization
+  bool HasCredentials() const;
+  /// true iff the response body is streamed instead of being buffered
+  bool IsStreamedResponse() const {
+    return std::holds_alternative<StreamData>(data_);
+  }
   /// get retries count
   short retries() const { return retry_.retries; }
 
@@ -112,6 +139,10 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void SetDestinationMetricName(const std::string& destination);
 
+  const std::string& GetDestinationMetricName() const {
+    return destination_metric_name_;
+  }
+
   void SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& config);
 
   void SetAllowedUrlsExtra(const std::vector<std::string>& urls);
@@ -131,34 +162,64 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void SetTracingManager(const tracing::TracingManagerBase&);
   void SetHeadersPropagator(const server::http::HeadersPropagator*);
+  void SetAddressBalancer(AddressBalancer* address_balancer);
+  void SetDestinationGuardsConfig(
+      const impl::RetryBudgetConfig& retry_budget,
+      const impl::CircuitBreakerConfig& circuit_breaker);
 
   RequestTracingEditor GetEditableTracingInstance();
 
  private:
+  /// extra attempt of the hedged request
+  struct HedgedAttempt {
+    std::shared_ptr<impl::EasyWrapper> easy;
+    std::shared_ptr<Response> response;
+    std::array<char, CURL_ERROR_SIZE> errorbuffer{};
+    std::optional<AddressBalancer::Lease> address_lease;
+  };
+
   /// final callback that calls user callback and set value in promise
   static void on_completed(std::shared_ptr<RequestState>, std::error_code err);
   /// retry callback
   static void on_retry(std::shared_ptr<RequestState>, std::error_code err);
+  /// completion callback of an attempt of the hedged request
+  static void on_hedged_completed(std::shared_ptr<RequestState>,
+                                  HedgedAttempt* attempt,
+                                  std::error_code err);
   /// header function curl callback
   static size_t on_header(void* ptr, size_t size, size_t nmemb, void* userdata);
+  /// header function curl callback of the extra attempts
+  static size_t on_hedged_header(void* ptr, size_t size, size_t nmemb,
+                                 void* userdata);
 
   /// certificate function curl callback
   static curl::native::CURLcode on_certificate_request(void* curl, void* sslctx,
                                                        void* userdata) noexcept;
 
   /// parse one header
-  void parse_header(char* ptr, size_t size);
-  void ParseSingleCookie(const char* ptr, size_t size);
+  static void ParseHeader(Response& response, curl::easy& easy, char* ptr,
+                          size_t size);
+  static void ParseSingleCookie(Response& response, const char* ptr,
+                                size_t size);
   /// simply run perform_request if there is now errors from timer
   void on_retry_timer(std::error_code err);
   /// run curl async_request, called once per attempt
   void perform_request(curl::easy::handler_type handler);
 
+  void ScheduleHedgedAttempt();
+  void on_hedging_timer(std::error_code err);
+  void StartHedgedAttempt();
+  void CancelHedgedAttempts();
+  static void CompleteHedging(std::shared_ptr<RequestState> holder,
+                              HedgedAttempt* winner, std::error_code err);
+  void FinishHedging();
+
   void UpdateTimeoutFromDeadline(std::chrono::milliseconds backoff);
   [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(
       std::chrono::milliseconds backoff = {});
   void UpdateTimeoutHeader();
   void HandleDeadlineAlreadyPassed();
+  void FailBeforePerform(std::exception_ptr exception);
   void CheckResponseDeadline(std::error_code& err, Status status_code);
   bool IsDeadlineExpiredResponse(Status status_code);
   bool ShouldRetryResponse();
@@ -167,8 +228,19 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   static size_t StreamWriteFunction(char* ptr, size_t size, size_t nmemb,
                                     void* userdata);
+  static size_t StreamReadFunction(char* ptr, size_t size, size_t nmemb,
+                                   void* userdata);
+
+  void StartBodyStream();
+  void FinishBodyStream();
 
   void AccountResponse(std::error_code err);
+
+  /// false iff the circuit breaker of the destination rejected the request
+  [[nodiscard]] bool AdmitRequest();
+  /// false iff the retry budget of the destination is exhausted
+  [[nodiscard]] bool AdmitRetry();
+  void AccountCircuitBreaker(std::error_code err, Status status_code);
   std::exception_ptr PrepareException(std::error_code err);
 
   void ResetDataForNewRequest();
@@ -180,6 +252,13 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void WithRequestStats(const Func& func);
 
   void ResolveTargetAddress(clients::dns::Resolver& resolver);
+  /// picks the address to connect to if there are several ones to balance
+  void PickAddress(curl::easy& easy,
+                   std::optional<AddressBalancer::Lease>& lease,
+                   std::string_view avoid);
+  /// accounts the outcome of the request to the picked address
+  void FinishAddressLease(std::optional<AddressBalancer::Lease>& lease,
+                          const curl::easy& easy, std::error_code err);
 
   /// curl handler wrapper
   std::shared_ptr<impl::EasyWrapper> easy_;
@@ -188,6 +267,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   std::shared_ptr<DestinationStatistics> dest_stats_;
   std::string destination_metric_name_;
+  std::string method_{"GET"};
+  bool has_credentials_{false};
 
   std::shared_ptr<const TestsuiteConfig> testsuite_config_;
   std::vector<std::string> allowed_urls_extra_;
@@ -205,6 +286,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   std::chrono::milliseconds remote_timeout_;
 
   impl::DeadlinePropagationConfig deadline_propagation_config_;
+  impl::RetryBudgetConfig retry_budget_config_;
+  impl::CircuitBreakerConfig circuit_breaker_config_;
   /// deadline from current task
   engine::Deadline deadline_;
   bool timeout_updated_by_deadline_{false};
@@ -224,6 +307,26 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
     std::optional<engine::ev::TimerWatcher> timer;
   } retry_;
 
+  /// struct for hedging, modified only in the ev thread of the easy during
+  /// the request
+  struct {
+    std::optional<HedgingSettings> settings;
+    std::chrono::milliseconds delay{};
+    std::chrono::steady_clock::time_point start_time;
+    engine::ev::ThreadControl* thread_control{nullptr};
+    std::optional<engine::ev::TimerWatcher> timer;
+    /// handles of the extra attempts not started yet, copied before the
+    /// request is performed as copying blocks
+    std::vector<std::shared_ptr<impl::EasyWrapper>> easies;
+    /// extra attempts, the winner is swapped with easy_ until FinishHedging()
+    std::vector<std::unique_ptr<HedgedAttempt>> attempts;
+    HedgedAttempt* winner{nullptr};
+    /// attempts started including the first one
+    std::size_t started{0};
+    std::size_t in_flight{0};
+    bool finished{false};
+  } hedging_;
+
   std::optional<tracing::InPlaceSpan> span_storage_;
   std::optional<std::string> log_url_;
 
@@ -232,6 +335,17 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   clients::dns::Resolver* resolver_{nullptr};
   std::string proxy_url_;
+  bool connect_to_set_{false};
+
+  struct {
+    AddressBalancer* balancer{nullptr};
+    std::string host;
+    std::string port;
+    // Empty if the address is not picked by the balancer
+    std::vector<std::string> addresses;
+    std::optional<AddressBalancer::Lease> lease;
+    std::string last_address;
+  } balancing_;
   impl::PluginPipeline& plugin_pipeline_;
 
   struct StreamData {
@@ -248,6 +362,29 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   };
 
   std::variant<FullBufferedData, StreamData> data_;
+
+  /// request body read from the queue for a single request
+  struct BodyStream {
+    explicit BodyStream(Queue::Consumer&& consumer)
+        : consumer(std::move(consumer)) {}
+
+    Queue::Consumer consumer;
+    /// cancels the task that moves the chunks from the queue
+    engine::TaskCancellationToken pump;
+    /// signalled by curl when the chunk is sent
+    engine::SingleConsumerEvent chunk_sent_event;
+
+    std::mutex mutex;
+    std::string chunk;
+    std::size_t chunk_offset{0};
+    bool eof{false};
+    bool paused{false};
+    bool finished{false};
+  };
+
+  std::shared_ptr<Queue> body_queue_;
+  std::optional<std::size_t> body_content_length_;
+  std::shared_ptr<BodyStream> body_stream_;
 };
 
 }  // namespace clients::http
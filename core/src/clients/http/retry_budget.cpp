@@ -0,0 +1,50 @@
+#include <clients/http/retry_budget.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::chrono::seconds kEpoch{1};
+
+}  // namespace
+
+void RetryBudget::Counter::Reset() noexcept {
+  requests = 0;
+  retries = 0;
+}
+
+RetryBudget::Result& RetryBudget::Result::operator+=(
+    const Counter& other) noexcept {
+  requests += other.requests.load();
+  retries += other.retries.load();
+  return *this;
+}
+
+RetryBudget::RetryBudget() : window_(kEpoch, kWindow) {}
+
+void RetryBudget::AccountRequest() noexcept {
+  ++window_.GetCurrentCounter().requests;
+}
+
+bool RetryBudget::TryAccountRetry(
+    const impl::RetryBudgetConfig& config) noexcept {
+  if (!config.enabled) return true;
+
+  const auto recent = window_.GetStatsForPeriod(kWindow, true);
+  const auto budget = std::max<std::uint64_t>(
+      config.min_retries_per_second * kWindow.count(),
+      static_cast<std::uint64_t>(static_cast<double>(recent.requests) *
+                                 config.max_retries_share));
+  if (recent.retries >= budget) return false;
+
+  ++window_.GetCurrentCounter().retries;
+  return true;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/clients/http/impl/config.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Limits the retries to a destination by a share of its requests over the
+/// recent period, so that the retries do not multiply the load of an
+/// overloaded upstream.
+///
+/// Thread-safe.
+class RetryBudget final {
+ public:
+  static constexpr std::chrono::seconds kWindow{10};
+
+  RetryBudget();
+
+  void AccountRequest() noexcept;
+
+  /// Returns whether the retry fits the budget, accounts it if it does
+  bool TryAccountRetry(const impl::RetryBudgetConfig& config) noexcept;
+
+ private:
+  struct Counter {
+    std::atomic<std::uint64_t> requests{0};
+    std::atomic<std::uint64_t> retries{0};
+
+    void Reset() noexcept;
+  };
+
+  struct Result {
+    std::uint64_t requests{0};
+    std::uint64_t retries{0};
+
+    Result& operator+=(const Counter& other) noexcept;
+  };
+
+  utils::statistics::RecentPeriod<Counter, Result,
+                                  utils::datetime::SteadyCoarseMockableClock>
+      window_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
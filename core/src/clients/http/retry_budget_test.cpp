@@ -0,0 +1,73 @@
+#include <clients/http/retry_budget.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::RetryBudget;
+
+clients::http::impl::RetryBudgetConfig MakeConfig() {
+  clients::http::impl::RetryBudgetConfig config;
+  config.enabled = true;
+  config.max_retries_share = 0.1;
+  config.min_retries_per_second = 0;
+  return config;
+}
+
+}  // namespace
+
+TEST(RetryBudget, LimitsRetriesShare) {
+  utils::datetime::MockNowSet({});
+  RetryBudget budget;
+  const auto config = MakeConfig();
+
+  for (int i = 0; i < 100; ++i) budget.AccountRequest();
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(budget.TryAccountRetry(config));
+  EXPECT_FALSE(budget.TryAccountRetry(config));
+
+  for (int i = 0; i < 10; ++i) budget.AccountRequest();
+  EXPECT_TRUE(budget.TryAccountRetry(config));
+  EXPECT_FALSE(budget.TryAccountRetry(config));
+}
+
+TEST(RetryBudget, MinRetries) {
+  utils::datetime::MockNowSet({});
+  RetryBudget budget;
+  auto config = MakeConfig();
+  config.min_retries_per_second = 1;
+
+  const auto min_retries = RetryBudget::kWindow.count();
+  for (int i = 0; i < min_retries; ++i) {
+    EXPECT_TRUE(budget.TryAccountRetry(config));
+  }
+  EXPECT_FALSE(budget.TryAccountRetry(config));
+}
+
+TEST(RetryBudget, WindowSlides) {
+  utils::datetime::MockNowSet({});
+  RetryBudget budget;
+  const auto config = MakeConfig();
+
+  for (int i = 0; i < 10; ++i) budget.AccountRequest();
+  EXPECT_TRUE(budget.TryAccountRetry(config));
+  EXPECT_FALSE(budget.TryAccountRetry(config));
+
+  utils::datetime::MockSleep(RetryBudget::kWindow * 2);
+  EXPECT_FALSE(budget.TryAccountRetry(config));
+  for (int i = 0; i < 10; ++i) budget.AccountRequest();
+  EXPECT_TRUE(budget.TryAccountRetry(config));
+}
+
+TEST(RetryBudget, Disabled) {
+  RetryBudget budget;
+  auto config = MakeConfig();
+  config.enabled = false;
+
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(budget.TryAccountRetry(config));
+}
+
+USERVER_NAMESPACE_END
@@ -62,6 +62,16 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
   stats_.socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountConnectionReuse(bool is_reused,
+                                          bool is_http2) noexcept {
+  if (is_reused) ++stats_.reused_connections_;
+  if (is_http2) ++stats_.http2_streams_;
+}
+
+void RequestStats::AccountTlsHandshakes(size_t handshakes) noexcept {
+  stats_.tls_handshakes_ += utils::statistics::Rate{handshakes};
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
   ++stats_.timeout_updated_by_deadline_;
 }
@@ -70,6 +80,32 @@ void RequestStats::AccountCancelledByDeadline() noexcept {
   ++stats_.cancelled_by_deadline_;
 }
 
+void RequestStats::AccountRetryThrottled() noexcept {
+  ++stats_.retries_throttled_;
+}
+
+void RequestStats::AccountCircuitBreakerRejected() noexcept {
+  ++stats_.circuit_breaker_rejected_;
+}
+
+void RequestStats::AccountCircuitBreakerOpened() noexcept {
+  ++stats_.circuit_breaker_opened_;
+}
+
+RetryBudget& RequestStats::GetRetryBudget() noexcept {
+  return stats_.retry_budget_;
+}
+
+CircuitBreaker& RequestStats::GetCircuitBreaker() noexcept {
+  return stats_.circuit_breaker_;
+}
+
+std::chrono::milliseconds RequestStats::GetTimingsPercentile(
+    double percent) const {
+  return std::chrono::milliseconds{
+      stats_.timings_percentile_.GetStatsForPeriod().GetPercentile(percent)};
+}
+
 Statistics::ErrorGroup Statistics::ErrorCodeToGroup(std::error_code ec) {
   using ErrorCode = curl::errc::EasyErrorCode;
 
@@ -155,12 +191,20 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["reply-statuses"] = stats.reply_status;
 
   writer["retries"] = stats.retries;
+  writer["retries-throttled"] = stats.retries_throttled;
   writer["pending-requests"] = stats.easy_handles;
 
   writer["timeout-updated-by-deadline"] = stats.timeout_updated_by_deadline;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
+  writer["circuit-breaker"]["rejected"] = stats.circuit_breaker_rejected;
+  writer["circuit-breaker"]["opened"] = stats.circuit_breaker_opened;
+
   writer["sockets"]["open"] = stats.multi.socket_open;
+  // Requests that did not open a connection, compare with "sockets.open"
+  writer["connections"]["reused"] = stats.reused_connections;
+  writer["connections"]["http2-streams"] = stats.http2_streams;
+  writer["connections"]["tls-handshakes"] = stats.tls_handshakes;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -197,8 +241,14 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       last_time_to_start_us(other.last_time_to_start_us_.load()),
       timings_percentile(other.timings_percentile_.GetStatsForPeriod()),
       retries(other.retries_.Load()),
+      reused_connections(other.reused_connections_.Load()),
+      http2_streams(other.http2_streams_.Load()),
+      tls_handshakes(other.tls_handshakes_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
+      retries_throttled(other.retries_throttled_.Load()),
+      circuit_breaker_rejected(other.circuit_breaker_rejected_.Load()),
+      circuit_breaker_opened(other.circuit_breaker_opened_.Load()),
       reply_status(other.reply_status_) {
   for (size_t i = 0; i < error_count.size(); i++)
     error_count[i] = other.error_count_[i].Load();
@@ -230,9 +280,15 @@ InstanceStatistics& InstanceStatistics::operator+=(
     error_count[i] += stat.error_count[i];
   }
   retries += stat.retries;
+  reused_connections += stat.reused_connections;
+  http2_streams += stat.http2_streams;
+  tls_handshakes += stat.tls_handshakes;
 
   timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
   cancelled_by_deadline += stat.cancelled_by_deadline;
+  retries_throttled += stat.retries_throttled;
+  circuit_breaker_rejected += stat.circuit_breaker_rejected;
+  circuit_breaker_opened += stat.circuit_breaker_opened;
   reply_status += stat.reply_status;
 
   multi += stat.multi;
@@ -13,6 +13,9 @@
 #include <userver/utils/statistics/writer.hpp>
 #include <utils/statistics/http_codes.hpp>
 
+#include <clients/http/circuit_breaker.hpp>
+#include <clients/http/retry_budget.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
@@ -31,10 +34,23 @@ class RequestStats final {
   void StoreTimeToStart(std::chrono::microseconds micro_seconds) noexcept;
 
   void AccountOpenSockets(size_t sockets) noexcept;
+  void AccountConnectionReuse(bool is_reused, bool is_http2) noexcept;
+  void AccountTlsHandshakes(size_t handshakes) noexcept;
 
   void AccountTimeoutUpdatedByDeadline() noexcept;
   void AccountCancelledByDeadline() noexcept;
 
+  void AccountRetryThrottled() noexcept;
+  void AccountCircuitBreakerRejected() noexcept;
+  void AccountCircuitBreakerOpened() noexcept;
+
+  RetryBudget& GetRetryBudget() noexcept;
+  CircuitBreaker& GetCircuitBreaker() noexcept;
+
+  /// Returns the percentile of the request timings for the recent period,
+  /// zero if there were no requests
+  std::chrono::milliseconds GetTimingsPercentile(double percent) const;
+
  private:
   void StoreTiming() noexcept;
 
@@ -96,15 +112,25 @@ class Statistics {
   std::atomic<uint64_t> easy_handles_{0};
   std::atomic<uint64_t> last_time_to_start_us_{0};
   utils::statistics::RecentPeriod<Percentile, Percentile,
-                                  utils::datetime::SteadyClock>
+                                  utils::datetime::SteadyCoarseMockableClock>
       timings_percentile_;
   std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
   utils::statistics::RateCounter retries_;
   utils::statistics::RateCounter socket_open_{0};
+  utils::statistics::RateCounter reused_connections_;
+  utils::statistics::RateCounter http2_streams_;
+  utils::statistics::RateCounter tls_handshakes_;
   utils::statistics::RateCounter timeout_updated_by_deadline_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter retries_throttled_;
+  utils::statistics::RateCounter circuit_breaker_rejected_;
+  utils::statistics::RateCounter circuit_breaker_opened_;
   utils::statistics::HttpCodes reply_status_;
 
+  // Used for the destinations only
+  RetryBudget retry_budget_;
+  CircuitBreaker circuit_breaker_;
+
   friend struct InstanceStatistics;
   friend class RequestStats;
 };
@@ -127,9 +153,15 @@ struct InstanceStatistics {
   Percentile timings_percentile;
   std::array<utils::statistics::Rate, Statistics::kErrorGroupCount> error_count;
   utils::statistics::Rate retries{0};
+  utils::statistics::Rate reused_connections;
+  utils::statistics::Rate http2_streams;
+  utils::statistics::Rate tls_handshakes;
 
   utils::statistics::Rate timeout_updated_by_deadline;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate retries_throttled;
+  utils::statistics::Rate circuit_breaker_rejected;
+  utils::statistics::Rate circuit_breaker_opened;
   utils::statistics::HttpCodes::Snapshot reply_status;
 
   MultiStats multi;
@@ -1,7 +1,15 @@
 #include <userver/components/common_component_list.hpp>
 
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
 #include <fmt/format.h>
 
+#include <userver/cache/caching_component_base.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/loggable_component_base.hpp>
 #include <userver/components/run.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
@@ -187,9 +195,106 @@ components_manager:
 config_vars: )";
 // clang-format on
 
-}  // namespace
+using ChangesData = std::unordered_map<int, int>;
 
-TEST_F(ComponentList, Common) {
+class ChangesListener;
+
+class ChangesCache final
+    : public components::CachingComponentBase<ChangesData> {
+ public:
+  friend ChangesListener;
+
+  static constexpr std::string_view kName = "changes-cache";
+
+  ChangesCache(const components::ComponentConfig& config,
+               const components::ComponentContext& context)
+      : CachingComponentBase(config, context) {
+    CacheUpdateTrait::StartPeriodicUpdates();
+  }
+
+  ~ChangesCache() override { CacheUpdateTrait::StopPeriodicUpdates(); }
+
+  void Update(cache::UpdateType type,
+              const std::chrono::system_clock::time_point& /*last_update*/,
+              const std::chrono::system_clock::time_point& /*now*/,
+              cache::UpdateStatisticsScope& stats_scope) override {
+    if (type == cache::UpdateType::kFull) {
+      Set(ChangesData{{1, 1}});
+      stats_scope.Finish(1);
+      return;
+    }
+
+    const auto current = Get();
+    auto data = *current;
+    const auto key = static_cast<int>(data.size()) + 1;
+    data.emplace(key, key);
+
+    ChangeSetType changes;
+    changes.is_full = false;
+    changes.inserted.push_back(key);
+    Set(std::make_unique<const ChangesData>(std::move(data)), changes);
+    stats_scope.Finish(1);
+  }
+};
+
+class ChangesListener final : public components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "changes-listener";
+
+  ChangesListener(const components::ComponentConfig& config,
+                  const components::ComponentContext& context)
+      : LoggableComponentBase(config, context),
+        cache_(context.FindComponent<ChangesCache>()),
+        subscription_(cache_.UpdateAndListenChanges(
+            this, std::string{kName}, &ChangesListener::OnCacheChanges)) {
+    // The current contents are delivered on subscription as a full change set
+    EXPECT_EQ(index_, (ChangesData{{1, 1}}));
+  }
+
+  ~ChangesListener() override { subscription_.Unsubscribe(); }
+
+  void OnAllComponentsLoaded() override {
+    cache_.UpdateSyncDebug(cache::UpdateType::kIncremental);
+    EXPECT_EQ(index_, (ChangesData{{1, 1}, {2, 2}}));
+    EXPECT_EQ(full_updates_, 1);
+
+    cache_.UpdateSyncDebug(cache::UpdateType::kFull);
+    EXPECT_EQ(index_, (ChangesData{{1, 1}}));
+    EXPECT_EQ(full_updates_, 2);
+  }
+
+ private:
+  void OnCacheChanges(const std::shared_ptr<const ChangesData>& data,
+                      const ChangesCache::ChangeSetType& changes) {
+    if (changes.is_full) {
+      EXPECT_TRUE(changes.inserted.empty());
+      ++full_updates_;
+      index_ = *data;
+      return;
+    }
+
+    EXPECT_TRUE(changes.updated.empty());
+    EXPECT_TRUE(changes.erased.empty());
+    for (const auto key : changes.inserted) index_[key] = data->at(key);
+  }
+
+  ChangesCache& cache_;
+  ChangesData index_;
+  int full_updates_{0};
+  concurrent::AsyncEventSubscriberScope subscription_;
+};
+
+constexpr std::string_view kChangesComponentsConfig = R"(
+    changes-cache:
+      update-types: full-and-incremental
+      update-interval: 1h
+      full-update-interval: 1d
+    changes-listener:
+      # Nothing
+)";
+
+void RunWithConfigVars(std::string_view static_config,
+                       components::ComponentList component_list) {
   const auto temp_root = fs::blocking::TempDirectory::Create();
   const std::string dynamic_config_cache_path =
       temp_root.GetPath() + "/dynamic_config.json";
@@ -208,8 +313,24 @@ TEST_F(ComponentList, Common) {
                   ToString(logging::GetDefaultLoggerLevel())));
 
   components::RunOnce(
-      components::InMemoryConfig{std::string{kStaticConfig} + config_vars_path},
-      components::CommonComponentList());
+      components::InMemoryConfig{std::string{static_config} + config_vars_path},
+      std::move(component_list));
+}
+
+}  // namespace
+
+TEST_F(ComponentList, Common) {
+  RunWithConfigVars(kStaticConfig, components::CommonComponentList());
+}
+
+TEST_F(ComponentList, CacheChangeSets) {
+  std::string static_config{kStaticConfig};
+  static_config.insert(static_config.rfind("config_vars: "),
+                       kChangesComponentsConfig.substr(1));
+
+  RunWithConfigVars(static_config, components::CommonComponentList()
+                                       .Append<ChangesCache>()
+                                       .Append<ChangesListener>());
 }
 
 USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/server/handlers/jemalloc.hpp>
 #include <userver/server/handlers/log_level.hpp>
 #include <userver/server/handlers/on_log_rotate.hpp>
+#include <userver/server/handlers/profiler.hpp>
 #include <userver/server/handlers/server_monitor.hpp>
 #include <userver/server/handlers/tests_control.hpp>
 #include <userver/tracing/manager_component.hpp>
@@ -29,6 +30,7 @@ ComponentList CommonServerComponentList() {
       .Append<server::handlers::Jemalloc>()
       .Append<server::handlers::LogLevel>()
       .Append<server::handlers::OnLogRotate>()
+      .Append<server::handlers::Profiler>()
       .Append<server::handlers::ServerMonitor>()
       .Append<server::handlers::TestsControl>()
       .Append<congestion_control::Component>()
@@ -202,6 +202,14 @@ components_manager:
         method: POST
         task_processor: monitor-task-processor
 # /// [Sample handler jemalloc component config]
+# /// [Sample handler profiler component config]
+# yaml
+    handler-profiler:
+        path: /service/profiler/{type}
+        method: GET
+        task_processor: monitor-task-processor
+        max-duration: 60s
+# /// [Sample handler profiler component config]
 # /// [Sample handler dns client control component config]
 # yaml
     handler-dns-client-control:
@@ -75,6 +75,11 @@ impl::ComponentBase* ComponentContext::DoFindComponent(
   return impl_->DoFindComponent(name);
 }
 
+std::vector<impl::ComponentLoadStats> ComponentContext::GetComponentsLoadStats(
+    std::chrono::steady_clock::time_point load_start) const {
+  return impl_->GetComponentsLoadStats(load_start);
+}
+
 }  // namespace components
 
 USERVER_NAMESPACE_END
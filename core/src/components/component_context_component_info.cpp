@@ -149,6 +149,40 @@ std::string ComponentInfo::GetDependencies() const {
                      fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::OnLoadStarted() {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  load_started_ = std::chrono::steady_clock::now();
+}
+
+void ComponentInfo::OnLoadFinished() {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  load_finished_ = std::chrono::steady_clock::now();
+}
+
+void ComponentInfo::AddDependenciesWait(
+    std::chrono::steady_clock::duration wait) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  dependencies_wait_ += wait;
+}
+
+ComponentLoadStats ComponentInfo::GetLoadStats(
+    std::chrono::steady_clock::time_point load_start) const {
+  using std::chrono::duration_cast;
+  using std::chrono::milliseconds;
+
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  ComponentLoadStats stats;
+  stats.name = name_;
+  stats.total = duration_cast<milliseconds>(load_finished_ - load_started_);
+  stats.dependencies_wait = duration_cast<milliseconds>(dependencies_wait_);
+  stats.finished_at = duration_cast<milliseconds>(load_finished_ - load_start);
+  stats.dependencies.reserve(it_depends_on_.size());
+  for (const auto& dependency : it_depends_on_) {
+    stats.dependencies.emplace_back(dependency.StringViewName());
+  }
+  return stats;
+}
+
 bool ComponentInfo::HasComponent() const {
   std::lock_guard<engine::Mutex> lock(mutex_);
   return !!component_;
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <userver/components/impl/component_base.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -22,6 +24,18 @@ enum class ComponentLifetimeStage {
   kReadyForClearing
 };
 
+/// Timings of a component constructor
+struct ComponentLoadStats final {
+  std::string name;
+  /// Duration of the constructor, including dependencies_wait
+  std::chrono::milliseconds total{0};
+  /// Time spent in FindComponent waiting for the dependencies to load
+  std::chrono::milliseconds dependencies_wait{0};
+  /// Relative to the start of the components load
+  std::chrono::milliseconds finished_at{0};
+  std::vector<std::string> dependencies;
+};
+
 class StageSwitchingCancelledException : public std::runtime_error {
  public:
   explicit StageSwitchingCancelledException(const std::string& message);
@@ -72,6 +86,12 @@ class ComponentInfo final {
 
   std::string GetDependencies() const;
 
+  void OnLoadStarted();
+  void OnLoadFinished();
+  void AddDependenciesWait(std::chrono::steady_clock::duration wait);
+  ComponentLoadStats GetLoadStats(
+      std::chrono::steady_clock::time_point load_start) const;
+
  private:
   bool HasComponent() const;
   std::unique_ptr<ComponentBase> ExtractComponent();
@@ -92,6 +112,9 @@ class ComponentInfo final {
   ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
   bool stage_switching_cancelled_{false};
   std::atomic<bool> on_loading_cancelled_called_{false};
+  std::chrono::steady_clock::time_point load_started_;
+  std::chrono::steady_clock::time_point load_finished_;
+  std::chrono::steady_clock::duration dependencies_wait_{};
 };
 
 }  // namespace components::impl
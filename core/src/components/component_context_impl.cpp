@@ -24,6 +24,7 @@ namespace components {
 
 namespace {
 const std::string kOnAllComponentsLoadedRootName = "all_components_loaded";
+const std::string kDependenciesWaitTag = "dependencies_wait_ms";
 const std::string kClearComponentsRootName = "clear_components";
 
 const std::chrono::seconds kPrintAddingComponentsPeriod{10};
@@ -117,7 +118,13 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
+  component_info.OnLoadStarted();
   component_info.SetComponent(factory(context));
+  component_info.OnLoadFinished();
+  if (auto* span = tracing::Span::CurrentSpanUnchecked()) {
+    span->AddTag(kDependenciesWaitTag,
+                 component_info.GetLoadStats({}).dependencies_wait.count());
+  }
   auto* component = component_info.GetComponent();
   if (component) {
     // Call the following command on logs to get the component dependencies:
@@ -343,7 +350,22 @@ impl::ComponentBase* ComponentContext::Impl::DoFindComponent(
   }
   SearchingComponentScope finder(*this, this_component_name);
 
-  return component_info.WaitAndGetComponent();
+  const auto wait_start = std::chrono::steady_clock::now();
+  auto* result = component_info.WaitAndGetComponent();
+  components_.at(this_component_name)
+      .AddDependenciesWait(std::chrono::steady_clock::now() - wait_start);
+  return result;
+}
+
+std::vector<impl::ComponentLoadStats>
+ComponentContext::Impl::GetComponentsLoadStats(
+    std::chrono::steady_clock::time_point load_start) const {
+  std::vector<impl::ComponentLoadStats> result;
+  result.reserve(components_.size());
+  for (const auto& [name, component_info] : components_) {
+    result.push_back(component_info.GetLoadStats(load_start));
+  }
+  return result;
 }
 
 void ComponentContext::Impl::AddDependency(impl::ComponentNameFromInfo name) {
@@ -3,6 +3,7 @@
 #include <userver/components/component_context.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
@@ -55,6 +56,9 @@ struct ComponentContext::Impl {
 
   impl::ComponentBase* DoFindComponent(std::string_view name);
 
+  std::vector<impl::ComponentLoadStats> GetComponentsLoadStats(
+      std::chrono::steady_clock::time_point load_start) const;
+
  private:
   class TaskToComponentMapScope final {
    public:
@@ -16,7 +16,9 @@ FsCache::FsCache(const components::ComponentConfig& config,
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
           context.GetTaskProcessor(config["fs-task-processor"].As<std::string>(
-              "fs-task-processor"))) {}
+              "fs-task-processor")),
+          config["max-cached-file-size"].As<std::optional<std::size_t>>(),
+          config["precompress"].As<bool>(false)) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
@@ -37,6 +39,19 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    max-cached-file-size:
+        type: integer
+        description: |
+            contents of the bigger files are not kept in memory and are read
+            from the filesystem on each request
+        defaultDescription: unlimited
+        minimum: 0
+    precompress:
+        type: boolean
+        description: |
+            compress the cached files with gzip and brotli on load to serve
+            them without compressing on each request
+        defaultDescription: false
 )");
 }
 
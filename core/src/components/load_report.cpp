@@ -0,0 +1,140 @@
+#include <components/load_report.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+std::chrono::milliseconds GetOwnTime(const ComponentLoadStats& stats) {
+  return std::max(stats.total - stats.dependencies_wait,
+                  std::chrono::milliseconds::zero());
+}
+
+std::chrono::milliseconds GetStartedAt(const ComponentLoadStats& stats) {
+  return stats.finished_at - stats.total;
+}
+
+void FormatComponent(fmt::memory_buffer& buffer,
+                     const ComponentLoadStats& stats) {
+  fmt::format_to(std::back_inserter(buffer), "{} (own {}ms, waited {}ms)",
+                 stats.name, GetOwnTime(stats).count(),
+                 stats.dependencies_wait.count());
+}
+
+}  // namespace
+
+std::vector<const ComponentLoadStats*> FindLoadCriticalPath(
+    const std::vector<ComponentLoadStats>& stats) {
+  if (stats.empty()) return {};
+
+  std::unordered_map<std::string_view, const ComponentLoadStats*> by_name;
+  by_name.reserve(stats.size());
+  for (const auto& item : stats) by_name.emplace(item.name, &item);
+
+  const auto by_finish = [](const ComponentLoadStats* lhs,
+                            const ComponentLoadStats* rhs) {
+    return lhs->finished_at < rhs->finished_at;
+  };
+
+  std::vector<const ComponentLoadStats*> path;
+  const auto* current =
+      &*std::max_element(stats.begin(), stats.end(),
+                         [&](const auto& lhs, const auto& rhs) {
+                           return by_finish(&lhs, &rhs);
+                         });
+  while (current) {
+    path.push_back(current);
+
+    const ComponentLoadStats* last_dependency = nullptr;
+    for (const auto& dependency : current->dependencies) {
+      const auto it = by_name.find(dependency);
+      if (it == by_name.end()) continue;
+      if (!last_dependency || by_finish(last_dependency, it->second)) {
+        last_dependency = it->second;
+      }
+    }
+    current = last_dependency;
+  }
+
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+std::string MakeLoadReport(const std::vector<ComponentLoadStats>& stats,
+                           std::size_t top_count) {
+  fmt::memory_buffer buffer;
+
+  fmt::format_to(std::back_inserter(buffer), "Components load critical path: ");
+  bool is_first = true;
+  for (const auto* item : FindLoadCriticalPath(stats)) {
+    if (!is_first) fmt::format_to(std::back_inserter(buffer), " -> ");
+    is_first = false;
+    FormatComponent(buffer, *item);
+  }
+
+  std::vector<const ComponentLoadStats*> slowest;
+  slowest.reserve(stats.size());
+  for (const auto& item : stats) slowest.push_back(&item);
+  top_count = std::min(top_count, slowest.size());
+  std::partial_sort(slowest.begin(), slowest.begin() + top_count, slowest.end(),
+                    [](const auto* lhs, const auto* rhs) {
+                      return GetOwnTime(*lhs) > GetOwnTime(*rhs);
+                    });
+
+  fmt::format_to(std::back_inserter(buffer), "; slowest components: ");
+  for (std::size_t i = 0; i < top_count; ++i) {
+    if (i != 0) fmt::format_to(std::back_inserter(buffer), ", ");
+    FormatComponent(buffer, *slowest[i]);
+  }
+
+  return fmt::to_string(buffer);
+}
+
+formats::json::Value MakeLoadReportJson(
+    const std::vector<ComponentLoadStats>& stats) {
+  formats::json::ValueBuilder critical_path(formats::json::Type::kArray);
+  for (const auto* item : FindLoadCriticalPath(stats)) {
+    critical_path.PushBack(item->name);
+  }
+
+  std::vector<const ComponentLoadStats*> by_start;
+  by_start.reserve(stats.size());
+  for (const auto& item : stats) by_start.push_back(&item);
+  std::stable_sort(by_start.begin(), by_start.end(),
+                   [](const auto* lhs, const auto* rhs) {
+                     return GetStartedAt(*lhs) < GetStartedAt(*rhs);
+                   });
+
+  formats::json::ValueBuilder components(formats::json::Type::kArray);
+  for (const auto* item : by_start) {
+    formats::json::ValueBuilder component(formats::json::Type::kObject);
+    component["name"] = item->name;
+    component["started-at-ms"] = GetStartedAt(*item).count();
+    component["finished-at-ms"] = item->finished_at.count();
+    component["total-ms"] = item->total.count();
+    component["own-ms"] = GetOwnTime(*item).count();
+    component["dependencies-wait-ms"] = item->dependencies_wait.count();
+    component["dependencies"] = item->dependencies;
+    components.PushBack(std::move(component));
+  }
+
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  result["critical-path"] = std::move(critical_path);
+  result["components"] = std::move(components);
+  return result.ExtractValue();
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
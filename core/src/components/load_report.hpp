@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <components/component_context_component_info.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+/// Returns the chain of components that determined the total load time,
+/// starting from the component that has no dependencies. Each component in
+/// the chain is the dependency of the next one that was loaded last.
+std::vector<const ComponentLoadStats*> FindLoadCriticalPath(
+    const std::vector<ComponentLoadStats>& stats);
+
+/// Formats the critical path and the `top_count` components with the longest
+/// load time excluding the dependencies wait
+std::string MakeLoadReport(const std::vector<ComponentLoadStats>& stats,
+                           std::size_t top_count);
+
+/// Serializes the timings of each component and the critical path, the
+/// components are sorted by the load start time
+formats::json::Value MakeLoadReportJson(
+    const std::vector<ComponentLoadStats>& stats);
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#include <components/load_report.hpp>
+
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using std::chrono::milliseconds;
+
+components::impl::ComponentLoadStats MakeStats(
+    std::string name, milliseconds total, milliseconds wait,
+    milliseconds finished_at, std::vector<std::string> dependencies = {}) {
+  return {std::move(name), total, wait, finished_at, std::move(dependencies)};
+}
+
+std::vector<components::impl::ComponentLoadStats> MakeSample() {
+  return {
+      MakeStats("logging", milliseconds{10}, milliseconds{0}, milliseconds{10}),
+      MakeStats("config", milliseconds{50}, milliseconds{10}, milliseconds{50},
+                {"logging"}),
+      MakeStats("fast-cache", milliseconds{60}, milliseconds{50},
+                milliseconds{60}, {"config", "logging"}),
+      MakeStats("slow-cache", milliseconds{1050}, milliseconds{50},
+                milliseconds{1050}, {"config"}),
+      MakeStats("handler", milliseconds{1060}, milliseconds{1055},
+                milliseconds{1060}, {"fast-cache", "slow-cache"}),
+  };
+}
+
+}  // namespace
+
+TEST(ComponentsLoadReport, CriticalPath) {
+  const auto stats = MakeSample();
+  const auto path = components::impl::FindLoadCriticalPath(stats);
+
+  std::vector<std::string> names;
+  for (const auto* item : path) names.push_back(item->name);
+  EXPECT_EQ(names, (std::vector<std::string>{"logging", "config", "slow-cache",
+                                             "handler"}));
+}
+
+TEST(ComponentsLoadReport, Empty) {
+  EXPECT_TRUE(components::impl::FindLoadCriticalPath({}).empty());
+  EXPECT_EQ(components::impl::MakeLoadReport({}, 10),
+            "Components load critical path: ; slowest components: ");
+}
+
+TEST(ComponentsLoadReport, Report) {
+  EXPECT_EQ(components::impl::MakeLoadReport(MakeSample(), 2),
+            "Components load critical path: logging (own 10ms, waited 0ms) -> "
+            "config (own 40ms, waited 10ms) -> slow-cache (own 1000ms, waited "
+            "50ms) -> handler (own 5ms, waited 1055ms); slowest components: "
+            "slow-cache (own 1000ms, waited 50ms), config (own 40ms, waited "
+            "10ms)");
+}
+
+TEST(ComponentsLoadReport, Json) {
+  const auto json = components::impl::MakeLoadReportJson(MakeSample());
+
+  EXPECT_EQ(json["critical-path"].As<std::vector<std::string>>(),
+            (std::vector<std::string>{"logging", "config", "slow-cache",
+                                      "handler"}));
+
+  const auto& components = json["components"];
+  ASSERT_EQ(components.GetSize(), 5);
+  EXPECT_EQ(components[0]["name"].As<std::string>(), "logging");
+
+  const auto& slow_cache = components[3];
+  EXPECT_EQ(slow_cache["name"].As<std::string>(), "slow-cache");
+  EXPECT_EQ(slow_cache["started-at-ms"].As<std::int64_t>(), 0);
+  EXPECT_EQ(slow_cache["finished-at-ms"].As<std::int64_t>(), 1050);
+  EXPECT_EQ(slow_cache["own-ms"].As<std::int64_t>(), 1000);
+  EXPECT_EQ(slow_cache["dependencies-wait-ms"].As<std::int64_t>(), 50);
+  EXPECT_EQ(slow_cache["dependencies"].As<std::vector<std::string>>(),
+            std::vector<std::string>{"config"});
+}
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
+#include <logging/log_limits_config.hpp>
 #include <tracing/no_log_spans.hpp>
 #include <userver/components/component.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
@@ -36,6 +37,13 @@ const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
   }
 )"}};
 
+const dynamic_config::Key<logging::LogLimitsConfig> kLogLimitsConfig{
+    "USERVER_LOG_LIMITS", dynamic_config::DefaultAsJsonString{R"(
+  {
+    "rate-limits": []
+  }
+)"}};
+
 }  // namespace
 
 LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
@@ -89,6 +97,29 @@ void LoggingConfigurator::OnConfigUpdate(
   } catch (const std::exception& e) {
     LOG_ERROR() << "Failed to set dynamic debug logs from config: " << e;
   }
+
+  try {
+    const auto& limits = config[kLogLimitsConfig];
+    logging::impl::SetNotSampledLogLevel(limits.not_sampled_log_level);
+
+    auto old_limits = log_rate_limits_.Read();
+    if (!(*old_limits == limits.rate_limits)) {
+      auto lock = log_rate_limits_.StartWrite();
+      *lock = limits.rate_limits;
+
+      // Some logs may pass unlimited while the limits are being replaced
+      logging::RemoveDynamicLogRateLimits();
+      for (const auto& limit : limits.rate_limits) {
+        const auto [path, line] = logging::SplitLocation(limit.location);
+        logging::SetDynamicLogRateLimit(path, line,
+                                        {limit.max_logs, limit.interval});
+      }
+
+      lock.Commit();
+    }
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Failed to set log rate limits from config: " << e;
+  }
 }
 
 yaml_config::Schema LoggingConfigurator::GetStaticConfigSchema() {
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <future>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <thread>
@@ -9,7 +10,9 @@
 
 #include <fmt/core.h>
 
+#include <components/load_report.hpp>
 #include <components/manager_config.hpp>
+#include <components/static_config_validation_cache.hpp>
 #include <engine/task/exception_hacks.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
@@ -28,6 +31,7 @@ USERVER_NAMESPACE_BEGIN
 namespace {
 
 constexpr std::size_t kDefaultHwThreadsEstimate = 512;
+constexpr std::size_t kLoadReportTopCount = 10;
 
 template <typename Func>
 auto RunInCoro(engine::TaskProcessor& task_processor, Func&& func) {
@@ -70,8 +74,14 @@ std::optional<size_t> GuessCpuLimit(const std::string& tp_name) {
 
 void ValidateConfigs(const components::ComponentList& component_list,
                      const components::ComponentConfigMap& component_config_map,
-                     components::ValidationMode validation_condition) {
+                     components::ValidationMode validation_condition,
+                     const std::optional<std::string>& cache_path) {
+  std::optional<components::impl::StaticConfigValidationCache> cache;
+  if (cache_path) cache.emplace(*cache_path);
+
   std::string validation_errors;
+  std::size_t validated_count = 0;
+  std::size_t cached_count = 0;
 
   for (const auto& adder : component_list) {
     const auto it = component_config_map.find(adder->GetComponentName());
@@ -79,8 +89,21 @@ void ValidateConfigs(const components::ComponentList& component_list,
         it != component_config_map.cend(),
         fmt::format("Component-config map does not have name of component '{}'",
                     adder->GetComponentName()));
+
+    std::string cache_key;
+    if (cache) {
+      cache_key = cache->MakeKey(adder->GetComponentName(), it->second,
+                                 validation_condition);
+      if (cache->Contains(cache_key)) {
+        ++cached_count;
+        continue;
+      }
+    }
+
     try {
       adder->ValidateStaticConfig(it->second, validation_condition);
+      ++validated_count;
+      if (cache) cache->Add(std::move(cache_key));
     } catch (const std::exception& exception) {
       auto component_name = adder->GetComponentName();
       validation_errors +=
@@ -93,6 +116,13 @@ void ValidateConfigs(const components::ComponentList& component_list,
         "The following components have failed static config validation:" +
         validation_errors);
   }
+
+  if (cache) {
+    LOG_INFO() << "Static configs validation: " << validated_count
+               << " components validated, " << cached_count
+               << " components skipped as unchanged";
+    cache->Store();
+  }
 }
 
 }  // namespace
@@ -113,7 +143,7 @@ void Manager::TaskProcessorsStorage::Reset() noexcept {
     task_processor->InitiateShutdown();
   }
   LOG_TRACE() << "Waiting for all coroutines to become idle";
-  while (task_processor_pools_->GetCoroPool().GetStats().active_coroutines) {
+  while (task_processor_pools_->GetCoroPoolStats().active_coroutines) {
     std::this_thread::sleep_for(std::chrono::milliseconds{10});
   }
   LOG_TRACE() << "Stopping task processors";
@@ -230,6 +260,10 @@ std::chrono::milliseconds Manager::GetLoadDuration() const {
   return load_duration_;
 }
 
+const std::vector<impl::ComponentLoadStats>& Manager::GetLoadStats() const {
+  return load_stats_;
+}
+
 void Manager::CreateComponentContext(const ComponentList& component_list) {
   std::set<std::string> loading_component_names;
   for (const auto& adder : component_list) {
@@ -305,7 +339,8 @@ void Manager::AddComponents(const ComponentList& component_list) {
   bool is_load_cancelled = false;
   try {
     ValidateConfigs(component_list, component_config_map,
-                    config_->validate_components_configs);
+                    config_->validate_components_configs,
+                    config_->validation_cache_path);
 
     for (const auto& adder : component_list) {
       auto task_name = "boot/" + adder->GetComponentName();
@@ -360,6 +395,8 @@ void Manager::AddComponents(const ComponentList& component_list) {
   LOG_INFO() << "All components created. Constructors for all the components "
                 "have completed. Preparing to run OnAllComponentsLoaded "
                 "for each component.";
+  load_stats_ = component_context_.GetComponentsLoadStats(start_time);
+  LOG_INFO() << impl::MakeLoadReport(load_stats_, kLoadReportTopCount);
 
   try {
     component_context_.OnAllComponentsLoaded();
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <components/component_context_component_info.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/component_list.hpp>
@@ -52,6 +53,10 @@ class Manager final {
 
   std::chrono::milliseconds GetLoadDuration() const;
 
+  /// Timings of the component constructors, empty until all the components
+  /// are created
+  const std::vector<impl::ComponentLoadStats>& GetLoadStats() const;
+
  private:
   class TaskProcessorsStorage {
    public:
@@ -105,6 +110,7 @@ class Manager final {
   engine::TaskProcessor* default_task_processor_{nullptr};
   const std::chrono::steady_clock::time_point start_time_;
   std::chrono::milliseconds load_duration_{0};
+  std::vector<impl::ComponentLoadStats> load_stats_;
 
   os_signals::ProcessorComponent* signal_processor_{nullptr};
 };
@@ -103,6 +103,23 @@ properties:
                 type: integer
                 description: size of a single coroutine, bytes
                 defaultDescription: 256 * 1024
+            stack_size_classes:
+                type: array
+                description: >
+                    additional coroutine stack sizes in bytes, task processors
+                    opt into them with `coro-stack-size`
+                defaultDescription: '[]'
+                items:
+                    type: integer
+                    description: stack size, bytes
+            stack_usage_sampling_period:
+                type: integer
+                description: >
+                    measure the coroutine stack high watermark after every
+                    N-th task and report it in the coro-pool.stack-usage-kb
+                    histogram and the coro-pool.max-stack-usage-bytes gauge,
+                    0 disables the sampling
+                defaultDescription: 0
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -125,6 +142,27 @@ properties:
                 description: >
                     Whether to defer timer events to a per-thread periodic timer
                     or notify ev-loop right away
+            io_uring:
+                type: boolean
+                description: >
+                    Whether to wait for the socket readiness via io_uring
+                    instead of epoll; falls back to epoll if io_uring is
+                    not available
+                defaultDescription: false
+            timer_wheel:
+                type: boolean
+                description: >
+                    Whether to keep the task deadline and sleep timers in a
+                    per-thread hierarchical timer wheel with 1ms resolution
+                    instead of separate libev timers
+                defaultDescription: false
+            worker_affinity:
+                type: boolean
+                description: >
+                    Whether to register the I/O watchers and timers of each
+                    task processor worker thread on its own home ev thread
+                    instead of spreading them round-robin
+                defaultDescription: false
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -160,12 +198,114 @@ properties:
                       - normal
                       - low-priority
                       - idle
+                ev-thread-affinity:
+                    type: boolean
+                    description: |
+                        register all the I/O watchers of the tasks on
+                        a single ev thread, requires a single worker thread;
+                        single-threaded-task-processors spread their
+                        processors over the ev threads
+                    defaultDescription: false
                 spinning-iterations:
                     type: integer
                     description: |
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                task-queue:
+                    type: string
+                    description: |
+                        task queue implementation. `global` is a single queue
+                        shared by all the workers. `work-stealing` gives each
+                        worker a local run queue and lets idle workers steal
+                        from the busy ones
+                    defaultDescription: global
+                    enum:
+                      - global
+                      - work-stealing
+                numa-sharding:
+                    type: boolean
+                    description: |
+                        split the workers into per-NUMA-node groups with
+                        node-pinned threads, own task queue shards and
+                        node-local coroutine stacks reuse; cross-node stealing
+                        is only a fallback. Requires `task-queue: work-stealing`
+                    defaultDescription: false
+                task-priorities:
+                    type: object
+                    description: |
+                        split the task queue into per-priority lanes, see
+                        engine::Task::Priority. Requires `task-queue: global`
+                    additionalProperties: false
+                    properties:
+                        high:
+                            type: integer
+                            description: dequeue weight of high priority tasks
+                            defaultDescription: 4
+                            minimum: 1
+                            maximum: 100
+                        normal:
+                            type: integer
+                            description: dequeue weight of normal priority tasks
+                            defaultDescription: 2
+                            minimum: 1
+                            maximum: 100
+                        low:
+                            type: integer
+                            description: dequeue weight of low priority tasks
+                            defaultDescription: 1
+                            minimum: 1
+                            maximum: 100
+                worker-autoscaling:
+                    type: object
+                    description: |
+                        park and unpark the worker threads depending on the
+                        task queue wait time and the CPU load of the workers,
+                        keeping from min-workers to worker_threads of them
+                        active. Requires `task-queue: global`
+                    additionalProperties: false
+                    properties:
+                        min-workers:
+                            type: integer
+                            description: minimal number of active workers
+                            minimum: 1
+                        check-interval:
+                            type: string
+                            description: how often to re-evaluate the count
+                            defaultDescription: 1s
+                        scale-up-wait-time:
+                            type: string
+                            description: |
+                                unpark more workers if a task waited in the
+                                queue for this long
+                            defaultDescription: 1ms
+                        scale-down-load-percent:
+                            type: integer
+                            description: |
+                                park a worker if the average CPU load of the
+                                active workers is below this value
+                            defaultDescription: 50
+                            minimum: 0
+                            maximum: 100
+                coro-stack-size:
+                    type: integer
+                    description: |
+                        coroutine stack size for the tasks of the task
+                        processor, bytes. The smallest of coro_pool.stack_size
+                        and coro_pool.stack_size_classes that fits is used
+                    defaultDescription: coro_pool.stack_size
+                task-profiler:
+                    type: object
+                    description: |
+                        profile CPU time, context switches and queue wait
+                        time of the sampled tasks by their root span name
+                    additionalProperties: false
+                    properties:
+                        every:
+                            type: integer
+                            description: profile each N-th task
+                            defaultDescription: 1000
+                            minimum: 1
                 task-trace:
                     type: object
                     description: .
@@ -198,6 +338,14 @@ properties:
             validate_all_components:
                 type: boolean
                 description: if true, all components configs are validated
+            cache_path:
+                type: string
+                description: >
+                    file to store the hashes of the components configs that
+                    passed the validation in; the configs that did not change
+                    since the previous start of the same executable are not
+                    validated again
+                defaultDescription: no cache
 )");
 }
 
@@ -226,6 +374,9 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value,
   config.validate_components_configs =
       value["static_config_validation"].As<ValidationMode>(
           ValidationMode::kAll);
+  config.validation_cache_path =
+      value["static_config_validation"]["cache_path"]
+          .As<std::optional<std::string>>();
   config.mlock_debug_info =
       value["mlock_debug_info"].As<bool>(config.mlock_debug_info);
   return config;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,7 @@ struct ManagerConfig {
   std::vector<engine::TaskProcessorConfig> task_processors;
   std::string default_task_processor;
   ValidationMode validate_components_configs{};
+  std::optional<std::string> validation_cache_path;
   utils::impl::UserverExperimentSet enabled_experiments;
   bool experiments_force_enabled{false};
   bool mlock_debug_info{true};
@@ -1,7 +1,13 @@
 #include <userver/components/manager_controller_component.hpp>
 
+#include <string>
+#include <string_view>
+#include <utility>
+
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
+#include <engine/ev/thread.hpp>
+#include <engine/impl/lock_statistics_registry.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/components/statistics_storage.hpp>
@@ -16,6 +22,13 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const TaskPriorityLaneStats& stats) {
+  writer["queued"] = stats.queued;
+  writer["wait_time_samples"] = stats.wait_time_samples;
+  writer["wait_time_us"] = stats.wait_time_us;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const engine::TaskProcessor& task_processor) {
   const auto& counter = task_processor.GetTaskCounter();
@@ -33,6 +46,8 @@ void DumpMetric(utils::statistics::Writer& writer,
     tasks["queued"] = task_processor.GetTaskQueueSize();
     tasks["finished"] = stopped.value;
     tasks["cancelled"] = counter.GetCancelledTasks().value;
+    tasks["cancelled_by_start_deadline"] =
+        counter.GetCancelledTasksStartDeadline().value;
   }
 
   writer["errors"].ValueWithLabels(
@@ -48,7 +63,31 @@ void DumpMetric(utils::statistics::Writer& writer,
     context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
   }
 
+  if (auto priorities = writer["priorities"]) {
+    static constexpr std::pair<Task::Priority, std::string_view> kPriorities[]{
+        {Task::Priority::kHigh, "high"},
+        {Task::Priority::kNormal, "normal"},
+        {Task::Priority::kLow, "low"},
+    };
+    for (const auto& [priority, name] : kPriorities) {
+      if (const auto stats = task_processor.GetPriorityLaneStats(priority)) {
+        priorities.ValueWithLabels(*stats, {{"task_priority", name}});
+      }
+    }
+  }
+
   writer["worker-threads"] = task_processor.GetWorkerCount();
+  if (task_processor.HasWorkerAutoscaling()) {
+    writer["active-worker-threads"] = task_processor.GetActiveWorkerCount();
+  }
+
+  if (const auto* profiler = task_processor.GetTaskProfiler()) {
+    if (auto task_profiler = writer["task-profiler"]) {
+      for (const auto& [name, stats] : profiler->GetStats()) {
+        task_profiler.ValueWithLabels(stats, {"span_name", name});
+      }
+    }
+  }
 }
 
 }  // namespace engine
@@ -100,19 +139,53 @@ void ManagerControllerComponent::WriteStatistics(
   const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
   auto& ev_thread_pool = pools_ptr->EventThreadPool();
   for (auto* thread : ev_thread_pool.NextThreads(ev_thread_pool.GetSize())) {
+    const utils::statistics::LabelView label{"ev_thread_name",
+                                             thread->GetName()};
     writer["ev-threads"]["cpu-load-percent"].ValueWithLabels(
-        thread->GetCurrentLoadPercent(),
-        {{"ev_thread_name", thread->GetName()}});
+        thread->GetCurrentLoadPercent(), label);
+
+    using utils::statistics::Rate;
+    const auto stats = thread->GetStats();
+    writer["ev-threads"]["wakeups"].ValueWithLabels(Rate{stats.wakeups},
+                                                    label);
+    writer["ev-threads"]["command-batches"].ValueWithLabels(
+        Rate{stats.command_batches}, label);
+    writer["ev-threads"]["commands"].ValueWithLabels(Rate{stats.commands},
+                                                     label);
   }
 
   // coroutines
   if (auto coro_pool = writer["coro-pool"]) {
+    const auto pools_stats = pools_ptr->GetCoroPoolStats();
     if (auto coro_stats = coro_pool["coroutines"]) {
-      auto stats =
-          components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
-      coro_stats["active"] = stats.active_coroutines;
-      coro_stats["total"] = stats.total_coroutines;
+      coro_stats["active"] = pools_stats.active_coroutines;
+      coro_stats["total"] = pools_stats.total_coroutines;
+    }
+    if (pools_stats.max_stack_usage != 0) {
+      coro_pool["max-stack-usage-bytes"] = pools_stats.max_stack_usage;
     }
+    const auto coro_pools = pools_ptr->GetCoroPools();
+    for (const auto* pool : coro_pools) {
+      const auto stack_size = std::to_string(pool->GetStackSize());
+      const utils::statistics::LabelView label{"stack_size", stack_size};
+      auto class_stats = coro_pool["stack-classes"]["coroutines"];
+      if (coro_pools.size() > 1 && class_stats) {
+        const auto stats = pool->GetStats();
+        class_stats["active"].ValueWithLabels(stats.active_coroutines, label);
+        class_stats["total"].ValueWithLabels(stats.total_coroutines, label);
+      }
+      if (pool->IsStackUsageSampled()) {
+        coro_pool["stack-classes"]["max-stack-usage-bytes"].ValueWithLabels(
+            pool->GetStats().max_stack_usage, label);
+        coro_pool["stack-usage-kb"].ValueWithLabels(pool->GetStackUsage(),
+                                                    label);
+      }
+    }
+  }
+
+  // instrumented synchronization primitives
+  if (auto locks = writer["locks"]) {
+    engine::impl::WriteLockStatistics(locks);
   }
 
   // misc
@@ -1,5 +1,10 @@
 #include <userver/components/minimal_server_component_list.hpp>
 
+#include <netinet/in.h>
+
+#include <atomic>
+#include <vector>
+
 #include <fmt/format.h>
 #include <gmock/gmock.h>
 
@@ -7,11 +12,13 @@
 #include <userver/components/loggable_component_base.hpp>
 #include <userver/components/manager_controller_component.hpp>
 #include <userver/components/run.hpp>
+#include <userver/engine/io/socket.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>  // for fs::blocking::TempDirectory
 #include <userver/fs/blocking/write.hpp>  // for fs::blocking::RewriteFileContents
 #include <userver/logging/component.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/async.hpp>
 
 #include <components/component_list_test.hpp>
@@ -108,12 +115,117 @@ class TaskTraceProducer final : public components::LoggableComponentBase {
   }
 };
 
+constexpr std::string_view kSharedNothingStaticConfig = R"(
+components_manager:
+  coro_pool:
+    initial_size: 50
+    max_size: 500
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 2
+  task_processors:
+    main-task-processor:
+      worker_threads: 2
+  components:
+    logging:
+      fs-task-processor: main-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+          level: warning
+    server:
+      listener:
+          port: $server-port
+          task_processor: main-task-processor
+          shared-nothing: true
+          shards: 2
+    handler-sleeping:
+      path: /sleep
+      method: GET
+      task_processor: main-task-processor
+config_vars: )";
+
+constexpr std::size_t kRequestsInFlight = 4;
+
+std::atomic<std::size_t> started_requests{0};
+std::atomic<std::size_t> cancelled_background_tasks{0};
+std::atomic<std::uint16_t> sleeping_server_port{0};
+
+// Sleeps until the server cancels the request, and leaves a detached task on
+// the shard of the connection
+class SleepingHandler final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-sleeping";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest&,
+      server::request::RequestContext&) const override {
+    utils::Async("background", [] {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+      if (engine::current_task::ShouldCancel()) ++cancelled_background_tasks;
+    }).Detach();
+
+    ++started_requests;
+    engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    return {};
+  }
+};
+
+// Keeps kRequestsInFlight requests to SleepingHandler in flight until the
+// service stops
+class RequestsInFlight final : public components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "requests-in-flight";
+
+  RequestsInFlight(const components::ComponentConfig& config,
+                   const components::ComponentContext& context)
+      : components::LoggableComponentBase(config, context) {
+    [[maybe_unused]] const auto& handler =
+        context.FindComponent<SleepingHandler>();
+  }
+
+  void OnAllComponentsLoaded() override {
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    engine::io::Sockaddr addr;
+    auto* sa = addr.As<sockaddr_in6>();
+    sa->sin6_family = AF_INET6;
+    sa->sin6_addr = in6addr_loopback;
+    addr.SetPort(sleeping_server_port);
+
+    constexpr std::string_view kRequest =
+        "GET /sleep HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    for (std::size_t i = 0; i < kRequestsInFlight; ++i) {
+      auto& socket = sockets_.emplace_back(addr.Domain(),
+                                           engine::io::SocketType::kStream);
+      socket.Connect(addr, deadline);
+      ASSERT_EQ(socket.SendAll(kRequest.data(), kRequest.size(), deadline),
+                kRequest.size());
+    }
+
+    while (started_requests < kRequestsInFlight) {
+      ASSERT_FALSE(deadline.IsReached());
+      engine::SleepFor(std::chrono::milliseconds{1});
+    }
+  }
+
+ private:
+  std::vector<engine::io::Socket> sockets_;
+};
+
 }  // namespace
 
 template <>
 inline constexpr auto components::kConfigFileMode<TaskTraceProducer> =
     ConfigFileMode::kNotRequired;
 
+template <>
+inline constexpr auto components::kConfigFileMode<RequestsInFlight> =
+    ConfigFileMode::kNotRequired;
+
 TEST_F(ServerMinimalComponentList, Basic) {
   constexpr std::string_view kConfigVarsTemplate = R"(
     server-port: {0}
@@ -176,6 +288,24 @@ TEST_F(ServerMinimalComponentList, TraceStacktraces) {
   ASSERT_THAT(logs, testing::HasSubstr("stacktrace= 0# "));
 }
 
+TEST_F(ServerMinimalComponentList, SharedNothingStopWithRequestsInFlight) {
+  sleeping_server_port = GetServerPort();
+  fs::blocking::RewriteFileContents(
+      GetConfigVarsPath(), fmt::format("server-port: {}", GetServerPort()));
+
+  // The server stops while the requests are in flight and their detached
+  // tasks are running on the shard task processors
+  components::RunOnce(
+      components::InMemoryConfig{std::string{kSharedNothingStaticConfig} +
+                                 GetConfigVarsPath()},
+      components::MinimalServerComponentList()
+          .Append<SleepingHandler>()
+          .Append<RequestsInFlight>());
+
+  EXPECT_EQ(started_requests, kRequestsInFlight);
+  EXPECT_EQ(cancelled_background_tasks, kRequestsInFlight);
+}
+
 TEST_F(ServerMinimalComponentList, InvalidDynamicConfigParam) {
   constexpr std::string_view kConfigVarsTemplate = R"(
     dynamic-config-default-overrides:
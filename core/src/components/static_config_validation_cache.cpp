@@ -0,0 +1,108 @@
+#include <components/static_config_validation_cache.hpp>
+
+#include <sys/stat.h>
+
+#include <fmt/format.h>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+constexpr std::string_view kFormatVersion = "1";
+
+// The schemas of the components are compiled into the executable, so a
+// rebuilt executable may validate the same configs differently
+std::string GetExecutableId() {
+  struct stat info {};
+  if (::stat("/proc/self/exe", &info) != 0) return {};
+
+  return fmt::format("{}:{}:{}:{}", info.st_dev, info.st_ino, info.st_size,
+                     info.st_mtime);
+}
+
+}  // namespace
+
+StaticConfigValidationCache::StaticConfigValidationCache(std::string path)
+    : path_(std::move(path)), executable_id_(GetExecutableId()) {
+  if (executable_id_.empty()) {
+    LOG_WARNING() << "Failed to identify the executable, static config "
+                     "validation cache is disabled";
+    return;
+  }
+
+  std::string contents;
+  try {
+    if (!fs::blocking::FileExists(path_)) return;
+    contents = fs::blocking::ReadFileContents(path_);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to read the static config validation cache from '"
+                  << path_ << "': " << ex;
+    return;
+  }
+
+  for (const auto line :
+       utils::text::SplitIntoStringViewVector(contents, "\n")) {
+    if (!line.empty()) keys_.emplace(line);
+  }
+}
+
+std::string StaticConfigValidationCache::MakeKey(
+    std::string_view component_name, const ComponentConfig& config,
+    ValidationMode validation_mode) const {
+  if (executable_id_.empty()) return {};
+
+  std::string config_json;
+  try {
+    config_json = formats::json::ToString(config.As<formats::json::Value>());
+  } catch (const std::exception& ex) {
+    LOG_DEBUG() << "Static config of '" << component_name
+                << "' is not cached: " << ex;
+    return {};
+  }
+
+  return crypto::hash::Sha256(fmt::format(
+      "{}\n{}\n{}\n{}\n{}", kFormatVersion, executable_id_,
+      static_cast<int>(validation_mode), component_name, config_json));
+}
+
+bool StaticConfigValidationCache::Contains(const std::string& key) const {
+  return !key.empty() && keys_.count(key) != 0;
+}
+
+void StaticConfigValidationCache::Add(std::string key) {
+  if (key.empty()) return;
+  is_modified_ |= keys_.insert(std::move(key)).second;
+}
+
+void StaticConfigValidationCache::Store() const {
+  if (!is_modified_) return;
+
+  std::string contents;
+  for (const auto& key : keys_) {
+    contents += key;
+    contents += '\n';
+  }
+
+  try {
+    fs::blocking::RewriteFileContentsAtomically(
+        path_, contents,
+        boost::filesystem::perms::owner_read |
+            boost::filesystem::perms::owner_write);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to write the static config validation cache to '"
+                  << path_ << "': " << ex;
+  }
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/static_config_validator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+/// Remembers the hashes of the component static configs that passed the
+/// validation, so that the configs that did not change since the previous
+/// start of the same executable are not validated again.
+///
+/// The key of a config covers the executable identity, the validation mode,
+/// the component name and the config contents after the substitution of the
+/// config_vars and the environment variables.
+class StaticConfigValidationCache final {
+ public:
+  /// Loads the cache from the `path`, a missing or a broken file is treated as
+  /// an empty cache
+  explicit StaticConfigValidationCache(std::string path);
+
+  /// Returns an empty key if the config could not be hashed, such a config is
+  /// never cached
+  std::string MakeKey(std::string_view component_name,
+                      const ComponentConfig& config,
+                      ValidationMode validation_mode) const;
+
+  bool Contains(const std::string& key) const;
+
+  void Add(std::string key);
+
+  /// Rewrites the file if new keys were added, logs the errors instead of
+  /// throwing
+  void Store() const;
+
+ private:
+  const std::string path_;
+  const std::string executable_id_;
+  std::unordered_set<std::string> keys_;
+  bool is_modified_{false};
+};
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
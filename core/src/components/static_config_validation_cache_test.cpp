@@ -0,0 +1,71 @@
+#include <components/static_config_validation_cache.hpp>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+components::ComponentConfig MakeConfig(const std::string& yaml) {
+  return yaml_config::YamlConfig(formats::yaml::FromString(yaml), {});
+}
+
+constexpr auto kMode = components::ValidationMode::kAll;
+
+}  // namespace
+
+UTEST(StaticConfigValidationCache, StoreAndLoad) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto path = temp_root.GetPath() + "/cache";
+  const auto config = MakeConfig("path: /ping\nmethod: GET");
+
+  {
+    components::impl::StaticConfigValidationCache cache{path};
+    const auto key = cache.MakeKey("handler-ping", config, kMode);
+    ASSERT_FALSE(key.empty());
+    EXPECT_FALSE(cache.Contains(key));
+    cache.Add(key);
+    EXPECT_TRUE(cache.Contains(key));
+    cache.Store();
+  }
+
+  components::impl::StaticConfigValidationCache cache{path};
+  EXPECT_TRUE(cache.Contains(cache.MakeKey("handler-ping", config, kMode)));
+  EXPECT_FALSE(cache.Contains(cache.MakeKey("handler-pong", config, kMode)));
+  EXPECT_FALSE(cache.Contains(cache.MakeKey(
+      "handler-ping", config, components::ValidationMode::kOnlyTurnedOn)));
+  EXPECT_FALSE(cache.Contains(cache.MakeKey(
+      "handler-ping", MakeConfig("path: /ping\nmethod: POST"), kMode)));
+}
+
+UTEST(StaticConfigValidationCache, SubstitutedVars) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  components::impl::StaticConfigValidationCache cache{temp_root.GetPath() +
+                                                      "/cache"};
+
+  const auto config_yaml = formats::yaml::FromString("path: $path");
+  const auto make_config = [&config_yaml](const std::string& vars) {
+    return components::ComponentConfig{
+        yaml_config::YamlConfig(config_yaml, formats::yaml::FromString(vars))};
+  };
+
+  EXPECT_EQ(cache.MakeKey("handler", make_config("path: /a"), kMode),
+            cache.MakeKey("handler", MakeConfig("path: /a"), kMode));
+  EXPECT_NE(cache.MakeKey("handler", make_config("path: /a"), kMode),
+            cache.MakeKey("handler", make_config("path: /b"), kMode));
+}
+
+UTEST(StaticConfigValidationCache, BrokenFile) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto path = temp_root.GetPath() + "/cache";
+  fs::blocking::RewriteFileContents(path, "\n\ngarbage\n");
+
+  components::impl::StaticConfigValidationCache cache{path};
+  EXPECT_FALSE(cache.Contains(
+      cache.MakeKey("handler", MakeConfig("path: /a"), kMode)));
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <userver/components/tcp_acceptor_base.hpp>
 
+#include <functional>
+#include <stdexcept>
+
 #include <userver/components/component.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
@@ -23,6 +26,25 @@ std::string SocketsTaskProcessorName(const ComponentConfig& config,
       acceptor_config.task_processor);
 }
 
+std::vector<engine::io::Socket> CreateSockets(
+    const ListenerConfig& acceptor_config) {
+  const auto count = acceptor_config.shards.value_or(1);
+  if (count == 0) {
+    throw std::runtime_error("'shards' of the acceptor must be positive");
+  }
+  if (count > 1 && !acceptor_config.unix_socket_path.empty()) {
+    throw std::runtime_error(
+        "'shards' of the acceptor may be set only for the 'port'");
+  }
+
+  std::vector<engine::io::Socket> sockets;
+  sockets.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    sockets.push_back(server::net::CreateSocket(acceptor_config, count));
+  }
+  return sockets;
+}
+
 }  // namespace
 
 TcpAcceptorBase::TcpAcceptorBase(const ComponentConfig& config,
@@ -62,6 +84,15 @@ properties:
       type: string
       description: task processor to process accepted sockets
       defaultDescription: value of `task_processor`
+  shards:
+      type: integer
+      description: count of the SO_REUSEPORT sockets listening on the port, each with its own accept loop
+      defaultDescription: 1
+      minimum: 1
+  reuseport-cpu-steering:
+      type: boolean
+      description: let the kernel pick the socket of the shards by the CPU that received the connection; Linux only
+      defaultDescription: false
 )");
 }
 
@@ -74,11 +105,11 @@ TcpAcceptorBase::TcpAcceptorBase(const ComponentConfig& config,
           context.GetTaskProcessor(acceptor_config.task_processor)),
       sockets_task_processor_(context.GetTaskProcessor(
           SocketsTaskProcessorName(config, acceptor_config))),
-      listen_sock_(server::net::CreateSocket(acceptor_config)) {}
+      listen_sockets_(CreateSockets(acceptor_config)) {}
 
-void TcpAcceptorBase::KeepAccepting() {
+void TcpAcceptorBase::KeepAccepting(engine::io::Socket& listen_sock) {
   while (!engine::current_task::ShouldCancel()) {
-    engine::io::Socket sock = listen_sock_.Accept({});
+    engine::io::Socket sock = listen_sock.Accept({});
 
     tasks_.Detach(engine::AsyncNoSpan(
         sockets_task_processor_,
@@ -95,14 +126,20 @@ void TcpAcceptorBase::KeepAccepting() {
 void TcpAcceptorBase::OnAllComponentsLoaded() {
   // Start handling after the derived object was fully constructed
 
-  // NOLINTNEXTLINE(cppcoreguidelines-slicing)
-  acceptor_ = engine::AsyncNoSpan(acceptor_task_processor_,
-                                  &TcpAcceptorBase::KeepAccepting, this);
+  acceptors_.reserve(listen_sockets_.size());
+  for (auto& listen_sock : listen_sockets_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+    acceptors_.push_back(engine::AsyncNoSpan(
+        acceptor_task_processor_, &TcpAcceptorBase::KeepAccepting, this,
+        std::ref(listen_sock)));
+  }
 }
 
 void TcpAcceptorBase::OnAllComponentsAreStopping() {
-  acceptor_ = {};  // Cancel and wait for finish
-  listen_sock_.Close();
+  acceptors_.clear();  // Cancel and wait for finish
+  for (auto& listen_sock : listen_sockets_) {
+    listen_sock.Close();
+  }
   tasks_.CancelAndWait();
 }
 
@@ -0,0 +1,156 @@
+#include <compression/brotli.hpp>
+
+#include <cstdint>
+
+#ifndef USERVER_NO_BROTLI
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::brotli {
+
+#ifndef USERVER_NO_BROTLI
+
+namespace {
+
+class BrotliCompressor final : public StreamCompressor {
+ public:
+  explicit BrotliCompressor(int level) {
+    if (level < BROTLI_MIN_QUALITY || level > BROTLI_MAX_QUALITY) {
+      throw CompressionError("brotli compression level should be from 0 to 11");
+    }
+    if (!state_ || !BrotliEncoderSetParameter(state_.get(),
+                                              BROTLI_PARAM_QUALITY, level)) {
+      throw CompressionError("failed to initialize brotli compression");
+    }
+  }
+
+  std::string Compress(std::string_view chunk, Flush flush) override {
+    const auto operation = flush == Flush::kFinish ? BROTLI_OPERATION_FINISH
+                                                   : BROTLI_OPERATION_FLUSH;
+
+    std::size_t avail_in = chunk.size();
+    const auto* next_in = reinterpret_cast<const std::uint8_t*>(chunk.data());
+
+    std::string compressed;
+    while (true) {
+      // The output is taken from the internal buffer of the encoder
+      std::size_t avail_out = 0;
+      if (!BrotliEncoderCompressStream(state_.get(), operation, &avail_in,
+                                       &next_in, &avail_out, nullptr,
+                                       nullptr)) {
+        throw CompressionError("failed to compress the data with brotli");
+      }
+
+      std::size_t size = 0;
+      const auto* output = BrotliEncoderTakeOutput(state_.get(), &size);
+      compressed.append(reinterpret_cast<const char*>(output), size);
+
+      if (avail_in == 0 && !BrotliEncoderHasMoreOutput(state_.get()) &&
+          (flush != Flush::kFinish || BrotliEncoderIsFinished(state_.get()))) {
+        break;
+      }
+    }
+    return compressed;
+  }
+
+ private:
+  struct StateDeleter {
+    void operator()(BrotliEncoderState* state) const noexcept {
+      BrotliEncoderDestroyInstance(state);
+    }
+  };
+
+  std::unique_ptr<BrotliEncoderState, StateDeleter> state_{
+      BrotliEncoderCreateInstance(nullptr, nullptr, nullptr)};
+};
+
+// The output is taken by this size at most, so the limit is checked before
+// anything large is allocated
+constexpr std::size_t kDecompressStepSize = 16 * 1024;
+
+class BrotliDecompressor final : public StreamDecompressor {
+ public:
+  BrotliDecompressor() {
+    if (!state_) {
+      throw DecompressionError("failed to initialize brotli decompression");
+    }
+  }
+
+  void Decompress(std::string_view chunk, std::string& output,
+                  std::size_t max_size) override {
+    std::size_t avail_in = chunk.size();
+    const auto* next_in = reinterpret_cast<const std::uint8_t*>(chunk.data());
+
+    while (true) {
+      // The output is taken from the internal buffer of the decoder
+      std::size_t avail_out = 0;
+      const auto result = BrotliDecoderDecompressStream(
+          state_.get(), &avail_in, &next_in, &avail_out, nullptr, nullptr);
+      if (result == BROTLI_DECODER_RESULT_ERROR) {
+        throw DecompressionError("failed to decompress brotli data");
+      }
+
+      while (BrotliDecoderHasMoreOutput(state_.get())) {
+        std::size_t size = kDecompressStepSize;
+        const auto* data = BrotliDecoderTakeOutput(state_.get(), &size);
+        if (size > max_size - output.size()) throw TooBigError();
+        output.append(reinterpret_cast<const char*>(data), size);
+      }
+
+      if (result == BROTLI_DECODER_RESULT_SUCCESS) {
+        if (avail_in != 0) {
+          throw DecompressionError("extra data after the brotli stream");
+        }
+        break;
+      }
+      if (result == BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT) break;
+    }
+  }
+
+  void Finish() override {
+    if (!BrotliDecoderIsFinished(state_.get())) {
+      throw DecompressionError("truncated brotli data");
+    }
+  }
+
+ private:
+  struct StateDeleter {
+    void operator()(BrotliDecoderState* state) const noexcept {
+      BrotliDecoderDestroyInstance(state);
+    }
+  };
+
+  std::unique_ptr<BrotliDecoderState, StateDeleter> state_{
+      BrotliDecoderCreateInstance(nullptr, nullptr, nullptr)};
+};
+
+}  // namespace
+
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(int level) {
+  return std::make_unique<BrotliCompressor>(level);
+}
+
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor() {
+  return std::make_unique<BrotliDecompressor>();
+}
+
+#else
+
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(int /*level*/) {
+  throw CompressionError(
+      "userver is built without brotli, see USERVER_FEATURE_BROTLI");
+}
+
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor() {
+  throw DecompressionError(
+      "userver is built without brotli, see USERVER_FEATURE_BROTLI");
+}
+
+#endif
+
+}  // namespace compression::brotli
+
+USERVER_NAMESPACE_END
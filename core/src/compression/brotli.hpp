@@ -0,0 +1,20 @@
+#pragma once
+
+#include <memory>
+
+#include <compression/compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::brotli {
+
+/// @param level from 0 (fastest) to 11 (best compression)
+/// @throws CompressionError, always if built with USERVER_NO_BROTLI
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(int level);
+
+/// @throws DecompressionError, always if built with USERVER_NO_BROTLI
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor();
+
+}  // namespace compression::brotli
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <compression/compressor.hpp>
+
+#include <compression/brotli.hpp>
+#include <compression/gzip.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+std::string_view ToContentEncoding(Algorithm algorithm) {
+  switch (algorithm) {
+    case Algorithm::kGzip:
+      return "gzip";
+    case Algorithm::kBrotli:
+      return "br";
+  }
+  UINVARIANT(false, "Unexpected compression algorithm");
+}
+
+std::optional<Algorithm> AlgorithmFromContentEncoding(std::string_view coding) {
+  if (coding == "gzip") return Algorithm::kGzip;
+#ifndef USERVER_NO_BROTLI
+  if (coding == "br") return Algorithm::kBrotli;
+#endif
+  return std::nullopt;
+}
+
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(Algorithm algorithm,
+                                                       int level) {
+  switch (algorithm) {
+    case Algorithm::kGzip:
+      return gzip::MakeStreamCompressor(level);
+    case Algorithm::kBrotli:
+      return brotli::MakeStreamCompressor(level);
+  }
+  UINVARIANT(false, "Unexpected compression algorithm");
+}
+
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor(
+    Algorithm algorithm) {
+  switch (algorithm) {
+    case Algorithm::kGzip:
+      return gzip::MakeStreamDecompressor();
+    case Algorithm::kBrotli:
+      return brotli::MakeStreamDecompressor();
+  }
+  UINVARIANT(false, "Unexpected compression algorithm");
+}
+
+std::string Compress(Algorithm algorithm, std::string_view data, int level) {
+  return MakeStreamCompressor(algorithm, level)
+      ->Compress(data, StreamCompressor::Flush::kFinish);
+}
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
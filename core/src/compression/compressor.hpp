@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+enum class Algorithm {
+  kGzip,
+  kBrotli,
+};
+
+/// Returns the name of the algorithm for the Content-Encoding header
+std::string_view ToContentEncoding(Algorithm algorithm);
+
+/// Returns the algorithm for the Content-Encoding header value, if supported
+/// by this build
+std::optional<Algorithm> AlgorithmFromContentEncoding(std::string_view coding);
+
+/// Compresses the data that is produced in chunks, keeps the state
+/// between them
+class StreamCompressor {
+ public:
+  enum class Flush {
+    /// All the output produced so far may be decompressed by the peer
+    kSync,
+    /// The end of the data
+    kFinish,
+  };
+
+  virtual ~StreamCompressor() = default;
+
+  /// Compresses the chunk.
+  /// @throws CompressionError
+  virtual std::string Compress(std::string_view chunk, Flush flush) = 0;
+};
+
+/// Decompresses the data that arrives in chunks, keeps the state between
+/// them. The output grows in bounded steps, so the limit is enforced before
+/// anything large is allocated.
+class StreamDecompressor {
+ public:
+  virtual ~StreamDecompressor() = default;
+
+  /// Decompresses the chunk and appends the result to `output`.
+  /// @throws TooBigError if `output` would grow over `max_size`
+  /// @throws DecompressionError
+  virtual void Decompress(std::string_view chunk, std::string& output,
+                          std::size_t max_size) = 0;
+
+  /// Checks that all the compressed data is received.
+  /// @throws DecompressionError if the data is truncated
+  virtual void Finish() = 0;
+};
+
+/// @param level algorithm specific compression level
+/// @throws CompressionError if the level is not supported
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(Algorithm algorithm,
+                                                       int level);
+
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor(
+    Algorithm algorithm);
+
+/// Compresses the string.
+/// @throws CompressionError
+std::string Compress(Algorithm algorithm, std::string_view data, int level);
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,111 @@
+#include <compression/compressor.hpp>
+
+#include <algorithm>
+#include <string>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr compression::Algorithm kAlgorithms[] = {
+    compression::Algorithm::kGzip,
+    compression::Algorithm::kBrotli,
+};
+
+std::string MakeData() {
+  std::string data;
+  for (int i = 0; i < 10000; ++i) data += "line " + std::to_string(i) + '\n';
+  return data;
+}
+
+std::string DecompressByChunks(compression::Algorithm algorithm,
+                               std::string_view compressed,
+                               std::size_t chunk_size, std::size_t max_size) {
+  auto decompressor = compression::MakeStreamDecompressor(algorithm);
+  std::string output;
+  while (!compressed.empty()) {
+    const auto size = std::min(chunk_size, compressed.size());
+    decompressor->Decompress(compressed.substr(0, size), output, max_size);
+    compressed.remove_prefix(size);
+  }
+  decompressor->Finish();
+  return output;
+}
+
+}  // namespace
+
+TEST(StreamDecompressor, Chunks) {
+  const auto data = MakeData();
+  for (const auto algorithm : kAlgorithms) {
+    const auto compressed = compression::Compress(algorithm, data, 5);
+    for (const std::size_t chunk_size : {1, 7, 1000, 1000000}) {
+      EXPECT_EQ(
+          DecompressByChunks(algorithm, compressed, chunk_size, data.size()),
+          data)
+          << compression::ToContentEncoding(algorithm) << ' ' << chunk_size;
+    }
+  }
+}
+
+TEST(StreamDecompressor, Empty) {
+  for (const auto algorithm : kAlgorithms) {
+    const auto compressed = compression::Compress(algorithm, {}, 5);
+    EXPECT_EQ(DecompressByChunks(algorithm, compressed, 1, 0), "");
+  }
+}
+
+TEST(StreamDecompressor, TooBig) {
+  // A "zip bomb" that expands a lot
+  const std::string data(10 * 1024 * 1024, '\0');
+  constexpr std::size_t kMaxSize = 1024 * 1024;
+  for (const auto algorithm : kAlgorithms) {
+    const auto compressed = compression::Compress(algorithm, data, 5);
+    ASSERT_LT(compressed.size(), kMaxSize);
+
+    auto decompressor = compression::MakeStreamDecompressor(algorithm);
+    std::string output;
+    EXPECT_THROW(decompressor->Decompress(compressed, output, kMaxSize),
+                 compression::TooBigError);
+    EXPECT_LE(output.size(), kMaxSize);
+    // the output grows in small steps
+    EXPECT_LT(output.capacity(), 2 * kMaxSize);
+
+    EXPECT_THROW(DecompressByChunks(algorithm, compressed, 4096, kMaxSize),
+                 compression::TooBigError);
+    EXPECT_NO_THROW(
+        DecompressByChunks(algorithm, compressed, 4096, data.size()));
+  }
+}
+
+TEST(StreamDecompressor, Truncated) {
+  const auto data = MakeData();
+  for (const auto algorithm : kAlgorithms) {
+    const auto compressed = compression::Compress(algorithm, data, 5);
+    EXPECT_THROW(DecompressByChunks(algorithm,
+                                    std::string_view{compressed}.substr(
+                                        0, compressed.size() / 2),
+                                    100, data.size()),
+                 compression::DecompressionError);
+  }
+}
+
+TEST(StreamDecompressor, Malformed) {
+  for (const auto algorithm : kAlgorithms) {
+    EXPECT_THROW(DecompressByChunks(algorithm, "definitely not compressed", 3,
+                                    1024),
+                 compression::DecompressionError);
+  }
+}
+
+TEST(StreamDecompressor, GzipMembers) {
+  const auto compressed =
+      compression::Compress(compression::Algorithm::kGzip, "first ", 5) +
+      compression::Compress(compression::Algorithm::kGzip, "second", 5);
+  EXPECT_EQ(DecompressByChunks(compression::Algorithm::kGzip, compressed, 5,
+                               1024),
+            "first second");
+}
+
+USERVER_NAMESPACE_END
@@ -1,15 +1,142 @@
 #include <compression/gzip.hpp>
 
+#include <algorithm>
+
+#include <zlib.h>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
+
 constexpr auto kDecompressBufferSize = 1024;
-}
+constexpr std::size_t kMinCompressBufferSize = 64;
+// 15 bits of the window plus 16 for the gzip header instead of the zlib one
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+// The output grows by this size at most, so the limit is checked before
+// anything large is allocated
+constexpr std::size_t kDecompressStepSize = 16 * 1024;
+
+class GzipCompressor final : public StreamCompressor {
+ public:
+  explicit GzipCompressor(int level) {
+    if (level < 1 || level > 9) {
+      throw CompressionError("gzip compression level should be from 1 to 9");
+    }
+    if (deflateInit2(&stream_, level, Z_DEFLATED, kGzipWindowBits, kMemLevel,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      throw CompressionError("failed to initialize gzip compression");
+    }
+  }
+
+  ~GzipCompressor() override { deflateEnd(&stream_); }
+
+  std::string Compress(std::string_view chunk, Flush flush) override {
+    const int mode = flush == Flush::kFinish ? Z_FINISH : Z_SYNC_FLUSH;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+    stream_.avail_in = chunk.size();
+    UASSERT(stream_.avail_in == chunk.size());
+
+    std::string compressed;
+    compressed.resize(
+        std::max<std::size_t>(deflateBound(&stream_, chunk.size()),
+                              kMinCompressBufferSize));
+    std::size_t size = 0;
+    while (true) {
+      stream_.next_out = reinterpret_cast<Bytef*>(compressed.data() + size);
+      stream_.avail_out = compressed.size() - size;
+      const auto ret = deflate(&stream_, mode);
+      size = compressed.size() - stream_.avail_out;
+      if (ret == Z_STREAM_ERROR) {
+        throw CompressionError("failed to gzip the data");
+      }
+
+      // deflate() needs more output space if it has filled all the buffer
+      const bool is_done = flush == Flush::kFinish ? ret == Z_STREAM_END
+                                                   : stream_.avail_out != 0;
+      if (is_done) break;
+      compressed.resize(compressed.size() * 2);
+    }
+    compressed.resize(size);
+    return compressed;
+  }
+
+ private:
+  z_stream stream_{};
+};
+
+class GzipDecompressor final : public StreamDecompressor {
+ public:
+  GzipDecompressor() {
+    if (inflateInit2(&stream_, kGzipWindowBits) != Z_OK) {
+      throw DecompressionError("failed to initialize gzip decompression");
+    }
+  }
+
+  ~GzipDecompressor() override { inflateEnd(&stream_); }
+
+  void Decompress(std::string_view chunk, std::string& output,
+                  std::size_t max_size) override {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(chunk.data()));
+    stream_.avail_in = chunk.size();
+    UASSERT(stream_.avail_in == chunk.size());
+
+    auto size = output.size();
+    UASSERT(size <= max_size);
+    while (true) {
+      if (is_finished_) {
+        if (stream_.avail_in == 0) break;
+        // The next member of a multi-member gzip stream
+        if (inflateReset(&stream_) != Z_OK) {
+          throw DecompressionError("failed to decompress gzip'ed data");
+        }
+        is_finished_ = false;
+      }
+
+      // One byte over the limit is enough to detect the overflow
+      const auto step = std::min(kDecompressStepSize, max_size - size) + 1;
+      output.resize(size + step);
+      stream_.next_out = reinterpret_cast<Bytef*>(output.data() + size);
+      stream_.avail_out = step;
+      const auto ret = inflate(&stream_, Z_NO_FLUSH);
+      size = output.size() - stream_.avail_out;
+      output.resize(size);
+
+      if (ret == Z_STREAM_END) {
+        is_finished_ = true;
+      } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+        throw DecompressionError("failed to decompress gzip'ed data");
+      }
+      if (size > max_size) {
+        output.resize(max_size);
+        throw TooBigError();
+      }
+
+      // inflate() has consumed all the input if it has not filled the output
+      if (!is_finished_ && stream_.avail_out != 0) break;
+    }
+  }
+
+  void Finish() override {
+    if (!is_finished_) throw DecompressionError("truncated gzip'ed data");
+  }
+
+ private:
+  z_stream stream_{};
+  bool is_finished_{false};
+};
+
+}  // namespace
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
   std::string decompressed;
@@ -38,6 +165,14 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(int level) {
+  return std::make_unique<GzipCompressor>(level);
+}
+
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor() {
+  return std::make_unique<GzipDecompressor>();
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
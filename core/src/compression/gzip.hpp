@@ -1,7 +1,9 @@
 #pragma once
 
+#include <memory>
 #include <string_view>
 
+#include <compression/compressor.hpp>
 #include <compression/error.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,6 +14,13 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// @param level from 1 (fastest) to 9 (best compression)
+/// @throws CompressionError
+std::unique_ptr<StreamCompressor> MakeStreamCompressor(int level);
+
+/// @throws DecompressionError
+std::unique_ptr<StreamDecompressor> MakeStreamDecompressor();
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <atomic>
+#include <vector>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -9,6 +10,8 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/task/task_processor_utils.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
 
 using namespace std::chrono_literals;
@@ -152,6 +155,31 @@ UTEST(BackgroundTaskStorage, CancelAndWait) {
   EXPECT_TRUE(finished);
 }
 
+UTEST_MT(BackgroundTaskStorage, CancelAndWaitFromManyThreads, 4) {
+  constexpr std::size_t kSpawners = 8;
+  constexpr std::size_t kTasksPerSpawner = 100;
+  std::atomic<std::size_t> finished{0};
+  concurrent::BackgroundTaskStorage bts;
+
+  std::vector<engine::TaskWithResult<void>> spawners;
+  for (std::size_t i = 0; i < kSpawners; ++i) {
+    spawners.push_back(utils::Async("spawner", [&] {
+      for (std::size_t j = 0; j < kTasksPerSpawner; ++j) {
+        bts.AsyncDetach("task", [&] {
+          engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+          ++finished;
+        });
+      }
+    }));
+  }
+  for (auto& spawner : spawners) spawner.Get();
+
+  // The tasks were registered from different threads
+  EXPECT_EQ(bts.ActiveTasksApprox(), kSpawners * kTasksPerSpawner);
+  bts.CancelAndWait();
+  EXPECT_EQ(finished, kSpawners * kTasksPerSpawner);
+}
+
 UTEST(BackgroundTaskStorage, SleepWhileCancelled) {
   concurrent::BackgroundTaskStorageCore bts;
   engine::SingleConsumerEvent event;
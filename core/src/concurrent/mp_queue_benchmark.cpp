@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -67,6 +69,67 @@ void producer_consumer(benchmark::State& state) {
   });
 }
 
+// Same as producer_consumer, but items are transferred in batches of
+// state.range(3) elements with PushMany/PopMany
+template <typename QueueType>
+void producer_consumer_batch(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + state.range(1), [&] {
+    const std::size_t producers_count = state.range(0);
+    const std::size_t consumers_count = state.range(1);
+    const std::size_t queue_size = state.range(2);
+    const std::size_t batch_size = state.range(3);
+
+    std::atomic<bool> run{true};
+    auto queue = QueueType::Create(queue_size);
+
+    const auto make_batch = [batch_size](std::size_t& message) {
+      std::vector<std::size_t> batch;
+      batch.reserve(batch_size);
+      for (std::size_t i = 0; i < batch_size; ++i) batch.push_back(message++);
+      return batch;
+    };
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(producers_count + consumers_count - 1);
+    for (std::size_t i = 0; i < producers_count - 1; ++i) {
+      tasks.push_back(utils::Async(
+          "producer", [producer = queue->GetProducer(), &run, &make_batch] {
+            std::size_t message = 0;
+            while (run) {
+              bool res = producer.PushMany(make_batch(message));
+              benchmark::DoNotOptimize(res);
+            }
+          }));
+    }
+
+    for (std::size_t i = 0; i < consumers_count; ++i) {
+      tasks.push_back(utils::Async(
+          "consumer", [consumer = queue->GetConsumer(), &run, batch_size] {
+            std::vector<std::size_t> values;
+            values.reserve(batch_size);
+            while (run) {
+              auto res = consumer.PopMany(values, batch_size);
+              benchmark::DoNotOptimize(res);
+              values.clear();
+            }
+          }));
+    }
+
+    // Current thread work
+    {
+      std::size_t message = 0;
+      auto producer = queue->GetProducer();
+      for ([[maybe_unused]] auto _ : state) {
+        bool res = producer.PushMany(make_batch(message));
+        benchmark::DoNotOptimize(res);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+
+    run = false;
+  });
+}
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {128, 512}});
@@ -87,10 +150,43 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 1}, {1, 1}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::NonFifoMpmcQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 4}, {1'000'000'000, 1'000'000'000}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::NonFifoMpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1'000'000'000, 1'000'000'000}, {1, 64}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {128, 512}});
 
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedMpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::BoundedSpscQueue<std::size_t>)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 1}, {1, 1}, {128, 512}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::BoundedMpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 1}, {1024, 1024}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::BoundedSpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1024, 1024}, {1, 64}});
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}});
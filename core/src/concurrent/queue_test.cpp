@@ -40,6 +40,15 @@ using TestMpscTypes =
                    concurrent::NonFifoMpscQueue<std::unique_ptr<int>>,
                    concurrent::NonFifoMpscQueue<std::unique_ptr<RefCountData>>>;
 
+using TestBoundedMpscTypes = testing::Types<
+    concurrent::BoundedMpscQueue<int>,
+    concurrent::BoundedMpscQueue<std::unique_ptr<int>>,
+    concurrent::BoundedMpscQueue<std::unique_ptr<RefCountData>>>;
+using TestBoundedSpscTypes = testing::Types<
+    concurrent::BoundedSpscQueue<int>,
+    concurrent::BoundedSpscQueue<std::unique_ptr<int>>,
+    concurrent::BoundedSpscQueue<std::unique_ptr<RefCountData>>>;
+
 using TestQueueTypes = testing::Types<concurrent::NonFifoMpmcQueue<std::size_t>,
                                       concurrent::NonFifoMpscQueue<std::size_t>,
                                       concurrent::SpmcQueue<std::size_t>,
@@ -59,6 +68,15 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, QueueFixture,
 INSTANTIATE_TYPED_UTEST_SUITE_P(NonFifoMpscQueue, TypedQueueFixture,
                                 TestMpmcTypes);
 
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpscQueue, QueueFixture,
+                                concurrent::BoundedMpscQueue<int>);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedMpscQueue, TypedQueueFixture,
+                                TestBoundedMpscTypes);
+
+INSTANTIATE_TYPED_UTEST_SUITE_P(BoundedSpscQueue, TypedQueueFixture,
+                                TestBoundedSpscTypes);
+
 TYPED_TEST_SUITE(NonCoroutineTest, TestQueueTypes);
 
 TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
@@ -83,6 +101,62 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   EXPECT_EQ(value, 2);
 }
 
+TYPED_TEST(NonCoroutineTest, PushPopManyNoblock) {
+  auto queue = TypeParam::Create(4);
+
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> batch{0, 1, 2};
+  EXPECT_TRUE(producer.PushManyNoblock(std::move(batch)));
+  EXPECT_TRUE(batch.empty());
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  // The whole batch does not fit, so nothing is pushed
+  batch = {3, 4};
+  EXPECT_FALSE(producer.PushManyNoblock(std::move(batch)));
+  EXPECT_EQ(batch, (std::vector<std::size_t>{3, 4}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  std::vector<std::size_t> values;
+  EXPECT_EQ(consumer.PopManyNoblock(values, 2), 2);
+  EXPECT_EQ(values, (std::vector<std::size_t>{0, 1}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 1);
+
+  EXPECT_TRUE(producer.PushManyNoblock(std::move(batch)));
+  EXPECT_EQ(consumer.PopManyNoblock(values, 10), 3);
+  EXPECT_EQ(values, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(consumer.PopManyNoblock(values, 10), 0);
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+TYPED_UTEST_SUITE(QueuePushMany, TestQueueTypes);
+
+TYPED_UTEST(QueuePushMany, Oversized) {
+  auto queue = TypeParam::Create(2);
+
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  // Single and multiple producers reject the batch that would never fit
+  std::vector<std::size_t> batch{0, 1, 2};
+  UEXPECT_THROW_MSG(
+      static_cast<void>(producer.PushMany(
+          std::move(batch),
+          engine::Deadline::FromDuration(utest::kMaxTestWaitTime))),
+      std::length_error, "larger than the queue size limit");
+  UEXPECT_THROW_MSG(
+      static_cast<void>(producer.PushManyNoblock(std::move(batch))),
+      std::length_error, "larger than the queue size limit");
+  EXPECT_EQ(batch.size(), 3);
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+
+  queue->SetSoftMaxSize(3);
+  EXPECT_TRUE(producer.PushMany(std::move(batch)));
+  EXPECT_TRUE(batch.empty());
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
   auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
   auto producer = queue->GetProducer();
@@ -140,6 +214,65 @@ UTEST_MT(NonFifoMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
                           [](int item) { return item == 1; }));
 }
 
+UTEST_MT(NonFifoMpmcQueue, MpmcMany, kProducersCount + kConsumersCount) {
+  constexpr std::size_t kBatchSize = 10;
+  static_assert(kMessageCount % kBatchSize == 0);
+
+  auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kMessageCount);
+  std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(utils::Async("producer", [&producers, i] {
+      std::vector<std::size_t> batch;
+      for (std::size_t message = i * kMessageCount;
+           message < (i + 1) * kMessageCount; ++message) {
+        batch.push_back(message);
+        if (batch.size() == kBatchSize) {
+          ASSERT_TRUE(producers[i].PushMany(std::move(batch)));
+          ASSERT_TRUE(batch.empty());
+        }
+      }
+    }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopMany(values, kBatchSize * 2) != 0) {
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 UTEST_MT(NonFifoMpmcQueue, SizeAfterConsumersDie, kConsumersCount + 1) {
   constexpr std::size_t kAttemptsCount = 1000;
 
@@ -307,6 +440,120 @@ UTEST_MT(NonFifoSpscQueue, Spsc, 1 + 1) {
                           [](int item) { return item == 1; }));
 }
 
+UTEST(BoundedSpscQueue, SizeLimit) {
+  auto queue = concurrent::BoundedSpscQueue<std::size_t>::Create(3);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 3);
+
+  // The limit can't be raised above the buffer size, which is rounded up to
+  // a power of two
+  queue->SetSoftMaxSize(100);
+  EXPECT_EQ(queue->GetSoftMaxSize(), 4);
+
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  // The buffer wraps around several times
+  std::size_t value{};
+  for (std::size_t i = 0; i < 10; ++i) {
+    EXPECT_TRUE(producer.PushManyNoblock({i * 4, i * 4 + 1, i * 4 + 2}));
+    EXPECT_TRUE(producer.PushNoblock(i * 4 + 3));
+    EXPECT_FALSE(producer.PushNoblock(std::size_t{0}));
+
+    std::vector<std::size_t> values;
+    EXPECT_EQ(consumer.PopManyNoblock(values, 3), 3);
+    EXPECT_EQ(values, (std::vector<std::size_t>{i * 4, i * 4 + 1, i * 4 + 2}));
+    EXPECT_TRUE(consumer.PopNoblock(value));
+    EXPECT_EQ(value, i * 4 + 3);
+    EXPECT_FALSE(consumer.PopNoblock(value));
+  }
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+UTEST_MT(BoundedSpscQueue, Spsc, 1 + 1) {
+  // Less than the message count, so that the producer waits for the consumer
+  auto queue = concurrent::BoundedSpscQueue<std::size_t>::Create(16);
+
+  std::optional producer(queue->GetProducer());
+  auto producer_task = GetProducerTask(*producer, 0);
+
+  auto consumer = queue->GetConsumer();
+  std::size_t expected = 0;
+  std::size_t value{};
+  while (consumer.Pop(value)) {
+    ASSERT_EQ(value, expected);
+    ++expected;
+    if (expected == kMessageCount) break;
+  }
+
+  producer_task.Get();
+  producer.reset();
+  EXPECT_EQ(expected, kMessageCount);
+  EXPECT_FALSE(consumer.Pop(value));
+}
+
+UTEST_MT(BoundedMpscQueue, Mpsc, kProducersCount + 1) {
+  constexpr std::size_t kBatchSize = 10;
+
+  auto queue = concurrent::BoundedMpscQueue<std::size_t>::Create(64);
+  std::vector<concurrent::BoundedMpscQueue<std::size_t>::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  // Half of the producers push the batches
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(utils::Async("producer", [&producers, i] {
+      std::vector<std::size_t> batch;
+      for (std::size_t message = i * kMessageCount;
+           message < (i + 1) * kMessageCount; ++message) {
+        if (i % 2 == 0) {
+          ASSERT_TRUE(producers[i].Push(std::size_t{message}));
+          continue;
+        }
+        batch.push_back(message);
+        if (batch.size() == kBatchSize) {
+          ASSERT_TRUE(producers[i].PushMany(std::move(batch)));
+          batch.clear();
+        }
+      }
+    }));
+  }
+
+  auto consumer = queue->GetConsumer();
+  auto consumer_task = utils::Async("consumer", [&consumer] {
+    // The items of every producer arrive in the production order
+    std::vector<std::size_t> next_messages(kProducersCount);
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+      next_messages[i] = i * kMessageCount;
+    }
+
+    std::vector<std::size_t> values;
+    while (consumer.PopMany(values, kBatchSize) != 0) {
+      for (const auto value : values) {
+        auto& next_message = next_messages[value / kMessageCount];
+        ASSERT_EQ(value, next_message);
+        ++next_message;
+      }
+      values.clear();
+    }
+
+    for (std::size_t i = 0; i < kProducersCount; ++i) {
+      EXPECT_EQ(next_messages[i], (i + 1) * kMessageCount);
+    }
+  });
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  consumer_task.Get();
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 // TODO(TAXICOMMON-7429) the test occasionally hangs; fix and re-enable
 UTEST_MT(QueueFixture, DISABLED_MultiConsumerToken,
          kProducersCount + kConsumersCount) {
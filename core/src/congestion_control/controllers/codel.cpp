@@ -0,0 +1,123 @@
+#include <userver/congestion_control/controllers/codel.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+constexpr std::size_t kCurrentLoadEpochs = 3;
+// Same as in CoDel: if the controller re-activates soon after deactivation,
+// the previous decrease rate is likely to be the right one
+constexpr std::size_t kRecentDroppingIntervals = 16;
+}  // namespace
+
+CoDelController::CoDelController(const std::string& name, v2::Sensor& sensor,
+                                 Limiter& limiter, Stats& stats,
+                                 const StaticConfig& config)
+    : Controller(name, sensor, limiter, stats,
+                 {config.fake_mode, config.enabled}),
+      config_(config),
+      sojourn_(std::max<std::size_t>(config.interval, 1)),
+      current_load_(kCurrentLoadEpochs) {}
+
+std::size_t CoDelController::GetDecreaseEpochs() const {
+  const auto epochs = std::ceil(static_cast<double>(sojourn_.GetWindowSize()) /
+                                std::sqrt(static_cast<double>(count_)));
+  return std::max<std::size_t>(static_cast<std::size_t>(epochs), 1);
+}
+
+Limit CoDelController::Update(const Sensor::Data& current) {
+  ++epoch_;
+  sojourn_.Update(current.timings_avg_ms);
+  current_load_.Update(current.current_load);
+  const auto current_load = current_load_.GetSmoothed();
+
+  if (epoch_ < sojourn_.GetWindowSize()) {
+    // The minimum is meaningless until the whole interval is observed
+    return {current_limit_, current.current_load};
+  }
+
+  if (current.total < config_.min_qps && !current_limit_) {
+    // Too little QPS, timings avg data is VERY noisy
+    return {current_limit_, current.current_load};
+  }
+
+  const auto min_sojourn = sojourn_.GetMinimal();
+  LOG_DEBUG() << "CC codel:"
+              << " sensor=(" << current.ToLogString() << ")"
+              << " min_sojourn=" << min_sojourn << " dropping=" << dropping_
+              << " count=" << count_;
+
+  const auto decrease = [this] {
+    *current_limit_ = *current_limit_ * (100 - config_.decrease_percent) / 100;
+  };
+
+  // Even the fastest requests of the interval had to wait for too long, so
+  // there is a standing queue
+  if (min_sojourn > config_.target.count()) {
+    if (!dropping_) {
+      dropping_ = true;
+      const bool recently_dropping =
+          epoch_ - dropping_exit_epoch_ <
+          kRecentDroppingIntervals * sojourn_.GetWindowSize();
+      count_ = (recently_dropping && count_ > 2) ? count_ - 2 : 1;
+
+      if (!current_limit_) {
+        LOG_ERROR() << GetName() << " Congestion Control is activated";
+        current_limit_ = current_load;
+      }
+      decrease();
+      next_decrease_epoch_ = epoch_ + GetDecreaseEpochs();
+    } else if (epoch_ >= next_decrease_epoch_) {
+      ++count_;
+      decrease();
+      next_decrease_epoch_ = epoch_ + GetDecreaseEpochs();
+    }
+  } else {
+    if (dropping_) {
+      dropping_ = false;
+      dropping_exit_epoch_ = epoch_;
+    }
+
+    if (current_limit_) {
+      if (*current_limit_ >
+          static_cast<std::size_t>(current_load) + config_.safe_delta_limit) {
+        LOG_ERROR() << GetName() << " Congestion Control is deactivated";
+        current_limit_.reset();
+      } else {
+        ++*current_limit_;
+      }
+    }
+  }
+
+  if (current_limit_.has_value() && current_limit_ < config_.min_limit) {
+    current_limit_ = config_.min_limit;
+  }
+
+  return {current_limit_, current.current_load};
+}
+
+CoDelController::StaticConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<CoDelController::StaticConfig>) {
+  CoDelController::StaticConfig config;
+  config.fake_mode = value["fake-mode"].As<bool>(false);
+  config.enabled = value["enabled"].As<bool>(true);
+  config.target =
+      std::chrono::milliseconds{value["target-ms"].As<std::size_t>(5)};
+  config.interval = value["interval-seconds"].As<std::size_t>(3);
+  config.decrease_percent = value["decrease-percent"].As<std::size_t>(10);
+  config.safe_delta_limit = value["deactivate-delta"].As<std::size_t>(10);
+  config.min_limit = value["min-limit"].As<std::size_t>(10);
+  config.min_qps = value["min-qps"].As<std::size_t>(10);
+  return config;
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/codel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+  void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Stats stats;
+FakeSensor sensor;
+FakeLimiter limiter;
+
+congestion_control::v2::CoDelController MakeController() {
+  congestion_control::v2::CoDelController::StaticConfig config;
+  config.target = std::chrono::milliseconds{50};
+  config.interval = 3;
+  return {"test", sensor, limiter, stats, config};
+}
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t sojourn_ms) {
+  congestion_control::v2::Sensor::Data data;
+  data.timings_avg_ms = sojourn_ms;
+  data.total = 1000;
+  data.current_load = 1000;
+  return data;
+}
+
+}  // namespace
+
+TEST(CCCoDel, Zero) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 1000; i++) {
+    auto limit = controller.Update({});
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCCoDel, Burst) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 10; i++) {
+    auto limit = controller.Update(MakeData(10));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+
+  // A burst shorter than the interval does not build a standing queue
+  for (size_t i = 0; i < 2; i++) {
+    auto limit = controller.Update(MakeData(5000));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+
+  for (size_t i = 0; i < 10; i++) {
+    auto limit = controller.Update(MakeData(10));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCCoDel, StandingQueue) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 10; i++) {
+    controller.Update(MakeData(10));
+  }
+
+  // The minimum is above the target for the whole interval
+  controller.Update(MakeData(100));
+  controller.Update(MakeData(100));
+  auto limit = controller.Update(MakeData(100));
+  ASSERT_NE(limit.load_limit, std::nullopt);
+  EXPECT_LT(*limit.load_limit, 1000);
+
+  // The limit goes down faster and faster while the queue persists
+  std::size_t previous = *limit.load_limit;
+  std::size_t decreases = 0;
+  for (size_t i = 0; i < 20; i++) {
+    limit = controller.Update(MakeData(100));
+    ASSERT_NE(limit.load_limit, std::nullopt) << i;
+    EXPECT_LE(*limit.load_limit, previous) << i;
+    if (*limit.load_limit < previous) ++decreases;
+    previous = *limit.load_limit;
+  }
+  EXPECT_GT(decreases, 20 / 3);
+
+  // The limit goes up once the queue is gone
+  limit = controller.Update(MakeData(10));
+  ASSERT_NE(limit.load_limit, std::nullopt);
+  EXPECT_EQ(*limit.load_limit, previous + 1);
+}
+
+TEST(CCCoDel, Deactivation) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 10; i++) {
+    controller.Update(MakeData(10));
+  }
+  for (size_t i = 0; i < 3; i++) {
+    controller.Update(MakeData(100));
+  }
+
+  // The load went down well below the limit
+  auto data = MakeData(10);
+  data.current_load = 100;
+  for (size_t i = 0; i < 3; i++) {
+    controller.Update(data);
+  }
+  auto limit = controller.Update(data);
+  EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
+TEST(CCCoDel, MinLimit) {
+  auto controller = MakeController();
+
+  for (size_t i = 0; i < 1000; i++) {
+    auto limit = controller.Update(MakeData(100));
+    if (limit.load_limit) {
+      EXPECT_GE(*limit.load_limit, 10) << i;
+    }
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -233,6 +233,12 @@ void easy::do_ev_cancel(size_t request_num) {
   }
 }
 
+void easy::unpause() {
+  const std::error_code ec{static_cast<errc::EasyErrorCode>(
+      native::curl_easy_pause(handle_, CURLPAUSE_CONT))};
+  throw_error(ec, "unpause");
+}
+
 void easy::reset() {
   LOG_TRACE() << "easy::reset start " << this;
 
@@ -247,6 +253,8 @@ void easy::reset() {
     http200_aliases_->clear();
   if (resolved_hosts_)
     resolved_hosts_->clear();
+  if (connect_to_)
+    connect_to_->clear();
   share_.reset();
   retries_count_ = 0;
   sockets_opened_ = 0;
@@ -586,6 +594,32 @@ void easy::add_resolve(const std::string &host, const std::string &port,
           handle_, native::CURLOPT_RESOLVE, resolved_hosts_->native_handle()))};
 }
 
+void easy::set_connect_to_address(const std::string &host,
+                                  const std::string &port,
+                                  const std::string &addr) {
+  std::error_code ec;
+  set_connect_to_address(host, port, addr, ec);
+  throw_error(ec, "set_connect_to_address");
+}
+
+void easy::set_connect_to_address(const std::string &host,
+                                  const std::string &port,
+                                  const std::string &addr,
+                                  std::error_code &ec) {
+  if (!connect_to_) {
+    connect_to_ = std::make_shared<string_list>();
+  }
+  connect_to_->clear();
+  // IPv6 addresses have to be in brackets
+  const bool is_ipv6 = addr.find(':') != std::string::npos;
+  connect_to_->add(utils::StrCat(host, ":", port, ":", is_ipv6 ? "[" : "",
+                                 addr, is_ipv6 ? "]" : "", ":", port));
+
+  ec =
+      std::error_code{static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
+          handle_, native::CURLOPT_CONNECT_TO, connect_to_->native_handle()))};
+}
+
 void easy::set_resolves(std::shared_ptr<string_list> resolved_hosts) {
   std::error_code ec;
   set_resolves(std::move(resolved_hosts), ec);
@@ -615,7 +649,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code &ec) {
   share_ = std::move(share);
 
-  if (share) {
+  if (share_) {
     ec = std::error_code{
         static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
             handle_, native::CURLOPT_SHARE, share_->native_handle()))};
@@ -168,6 +168,7 @@ public:
   // resolver initialization).
   std::shared_ptr<easy> GetBoundBlocking(multi &) const;
 
+  multi *GetMulti() { return multi_; }
   const multi *GetMulti() const { return multi_; }
 
   inline native::CURL *native_handle() { return handle_; }
@@ -177,6 +178,8 @@ public:
   void perform(std::error_code &ec);
   void async_perform(handler_type handler);
   void cancel();
+  // Resumes the transfer paused by a callback, must be called in the ev thread
+  void unpause();
   void reset();
   void set_source(std::shared_ptr<std::istream> source);
   void set_source(std::shared_ptr<std::istream> source, std::error_code &ec);
@@ -464,6 +467,7 @@ public:
   };
   IMPLEMENT_CURL_OPTION_ENUM(set_http_version, native::CURLOPT_HTTP_VERSION,
                              http_version_t, long);
+  IMPLEMENT_CURL_OPTION_BOOLEAN(set_pipewait, native::CURLOPT_PIPEWAIT);
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_ignore_content_length,
                                 native::CURLOPT_IGNORE_CONTENT_LENGTH);
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_http_content_decoding,
@@ -546,6 +550,11 @@ public:
   void set_resolves(std::shared_ptr<string_list> resolved_hosts);
   void set_resolves(std::shared_ptr<string_list> resolved_hosts,
                     std::error_code &ec);
+  // Connects to `addr` instead of host:port, replaces the previous call
+  void set_connect_to_address(const std::string &host, const std::string &port,
+                              const std::string &addr);
+  void set_connect_to_address(const std::string &host, const std::string &port,
+                              const std::string &addr, std::error_code &ec);
   IMPLEMENT_CURL_OPTION_STRING(set_dns_servers, native::CURLOPT_DNS_SERVERS);
   IMPLEMENT_CURL_OPTION(set_accept_timeout_ms, native::CURLOPT_ACCEPTTIMEOUT_MS,
                         long);
@@ -617,6 +626,7 @@ public:
   IMPLEMENT_CURL_OPTION(set_private, native::CURLOPT_PRIVATE, void *);
   void set_share(std::shared_ptr<share> share);
   void set_share(std::shared_ptr<share> share, std::error_code &ec);
+  const std::shared_ptr<share> &get_share() const { return share_; }
   IMPLEMENT_CURL_OPTION(set_new_file_perms, native::CURLOPT_NEW_FILE_PERMS,
                         long);
   IMPLEMENT_CURL_OPTION(set_new_directory_perms,
@@ -789,6 +799,7 @@ private:
   std::shared_ptr<string_list> proxy_headers_;
   std::shared_ptr<string_list> http200_aliases_;
   std::shared_ptr<string_list> resolved_hosts_;
+  std::shared_ptr<string_list> connect_to_;
   std::shared_ptr<share> share_;
   progress_callback_t progress_callback_;
   std::size_t retries_count_{0};
@@ -35,6 +35,8 @@ const char* GetSetterName(native::CURLMoption option) {
       return "SetMultiplexingEnabled";
     case native::CURLMOPT_MAX_HOST_CONNECTIONS:
       return "SetMaxHostConnections";
+    case native::CURLMOPT_MAX_CONCURRENT_STREAMS:
+      return "SetMaxConcurrentStreams";
     case native::CURLMOPT_MAXCONNECTS:
       return "SetConnectionCacheSize";
     default:
@@ -140,13 +142,18 @@ void multi::CheckRateLimit(const char* url_str, std::error_code& ec) {
 }
 
 void multi::SetMultiplexingEnabled(bool value) {
-  SetOptionAsync(native::CURLMOPT_PIPELINING, value ? 1 : 0);
+  SetOptionAsync(native::CURLMOPT_PIPELINING,
+                 value ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
 }
 
 void multi::SetMaxHostConnections(long value) {
   SetOptionAsync(native::CURLMOPT_MAX_HOST_CONNECTIONS, value);
 }
 
+void multi::SetMaxConcurrentStreams(long value) {
+  SetOptionAsync(native::CURLMOPT_MAX_CONCURRENT_STREAMS, value);
+}
+
 void multi::SetConnectionCacheSize(long value) {
   SetOptionAsync(native::CURLMOPT_MAXCONNECTS, value);
 }
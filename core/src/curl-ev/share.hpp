@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 
@@ -46,8 +47,11 @@ class share final : public std::enable_shared_from_this<share> {
   static void unlock(native::CURL* handle, native::curl_lock_data data,
                      void* userptr);
 
+  std::mutex& GetMutex(native::curl_lock_data data);
+
   native::CURLSH* handle_;
-  std::mutex mutex_;
+  // by curl_lock_data, so that e.g. DNS lookups do not wait for TLS sessions
+  std::array<std::mutex, native::CURL_LOCK_DATA_LAST> mutexes_;
 };
 }  // namespace curl
 
@@ -0,0 +1,56 @@
+#include <userver/dist_lock/dist_lock_manager.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <dist_lock/impl/lease_batcher.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+namespace {
+
+class BatchedStrategy final : public DistLockStrategyBase {
+ public:
+  BatchedStrategy(std::shared_ptr<impl::LeaseBatcher> batcher,
+                  std::string lock_name)
+      : batcher_(std::move(batcher)), lock_name_(std::move(lock_name)) {}
+
+  void Acquire(std::chrono::milliseconds lock_ttl,
+               const std::string& locker_id) override {
+    batcher_->Acquire(lock_name_, lock_ttl, locker_id);
+  }
+
+  void Release(const std::string& locker_id) override {
+    batcher_->Release(lock_name_, locker_id);
+  }
+
+ private:
+  const std::shared_ptr<impl::LeaseBatcher> batcher_;
+  const std::string lock_name_;
+};
+
+}  // namespace
+
+DistLockManager::DistLockManager(
+    std::shared_ptr<DistLockBatchStrategyBase> strategy,
+    const DistLockManagerSettings& settings)
+    : batcher_(std::make_shared<impl::LeaseBatcher>(std::move(strategy),
+                                                    settings)),
+      batcher_task_(utils::CriticalAsync(
+          "dist-lock-manager", [batcher = batcher_] { batcher->Run(); })) {}
+
+DistLockManager::~DistLockManager() {
+  batcher_task_.SyncCancel();
+  batcher_->Stop();
+}
+
+std::shared_ptr<DistLockStrategyBase> DistLockManager::GetStrategy(
+    std::string lock_name) {
+  UASSERT(!lock_name.empty());
+  return std::make_shared<BatchedStrategy>(batcher_, std::move(lock_name));
+}
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
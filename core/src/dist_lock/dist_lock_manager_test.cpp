@@ -0,0 +1,208 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/dist_lock/dist_lock_batch_strategy.hpp>
+#include <userver/dist_lock/dist_lock_manager.hpp>
+#include <userver/dist_lock/dist_locked_worker.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kAttemptInterval{10};
+constexpr std::chrono::milliseconds kLockTtl{1000};
+
+dist_lock::DistLockSettings MakeSettings() {
+  return {kAttemptInterval, kAttemptInterval, kLockTtl, kAttemptInterval,
+          kAttemptInterval};
+}
+
+dist_lock::DistLockManagerSettings MakeManagerSettings() {
+  dist_lock::DistLockManagerSettings settings;
+  settings.batch_window = kAttemptInterval;
+  settings.handover_delay = 5 * kAttemptInterval;
+  settings.rebalance_interval = kAttemptInterval;
+  return settings;
+}
+
+struct Owner {
+  std::string member_id;
+  std::string locker_id;
+};
+
+/// The locks of all the members, as a database table would store them
+struct MockBackend {
+  std::map<std::string, Owner> owners;
+  std::set<std::string> members;
+  std::size_t batches{0};
+  std::size_t requests{0};
+};
+
+/// [Sample batch strategy]
+class MockBatchStrategy final : public dist_lock::DistLockBatchStrategyBase {
+ public:
+  MockBatchStrategy(std::shared_ptr<concurrent::Variable<MockBackend>> backend,
+                    std::string member_id)
+      : backend_(std::move(backend)), member_id_(std::move(member_id)) {}
+
+  dist_lock::BatchAcquireResult AcquireBatch(
+      const std::vector<dist_lock::LeaseRequest>& requests) override {
+    auto backend = backend_->Lock();
+    ++backend->batches;
+    backend->requests += requests.size();
+    backend->members.insert(member_id_);
+
+    dist_lock::BatchAcquireResult result;
+    for (const auto& request : requests) {
+      auto& owner = backend->owners[request.lock_name];
+      const bool acquired = owner.locker_id.empty() ||
+                            owner.locker_id == request.locker_id;
+      if (acquired) owner = {member_id_, request.locker_id};
+      result.acquired.push_back(acquired);
+    }
+    result.members.assign(backend->members.begin(), backend->members.end());
+    return result;
+  }
+
+  void Release(const std::string& lock_name,
+               const std::string& locker_id) override {
+    auto backend = backend_->Lock();
+    const auto it = backend->owners.find(lock_name);
+    if (it != backend->owners.end() && it->second.locker_id == locker_id) {
+      backend->owners.erase(it);
+    }
+  }
+
+  const std::string& GetMemberId() const override { return member_id_; }
+
+ private:
+  const std::shared_ptr<concurrent::Variable<MockBackend>> backend_;
+  const std::string member_id_;
+};
+/// [Sample batch strategy]
+
+std::string LockName(std::size_t i) { return fmt::format("lock-{}", i); }
+
+void Work() {
+  while (!engine::current_task::ShouldCancel()) {
+    engine::InterruptibleSleepFor(kAttemptInterval);
+  }
+}
+
+std::vector<std::unique_ptr<dist_lock::DistLockedWorker>> StartWorkers(
+    dist_lock::DistLockManager& manager, std::size_t count) {
+  std::vector<std::unique_ptr<dist_lock::DistLockedWorker>> workers;
+  for (std::size_t i = 0; i < count; ++i) {
+    workers.push_back(std::make_unique<dist_lock::DistLockedWorker>(
+        LockName(i), &Work, manager.GetStrategy(LockName(i)), MakeSettings()));
+    workers.back()->Start();
+  }
+  return workers;
+}
+
+// number of locks held by each member
+std::map<std::string, std::size_t> CountLocks(
+    concurrent::Variable<MockBackend>& backend) {
+  std::map<std::string, std::size_t> result;
+  for (const auto& [name, owner] : backend.Lock()->owners) {
+    ++result[owner.member_id];
+  }
+  return result;
+}
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate) {
+  const auto deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (!predicate()) {
+    if (deadline.IsReached()) return false;
+    engine::SleepFor(kAttemptInterval);
+  }
+  return true;
+}
+
+}  // namespace
+
+UTEST_MT(DistLockManager, Sample, 3) {
+  auto backend = std::make_shared<concurrent::Variable<MockBackend>>();
+
+  /// [Sample DistLockManager]
+  dist_lock::DistLockManager manager{
+      std::make_shared<MockBatchStrategy>(backend, "host-1")};
+
+  std::atomic<bool> is_locked{false};
+  dist_lock::DistLockedWorker worker{
+      "sample",
+      [&is_locked] {
+        is_locked = true;
+        Work();
+      },
+      manager.GetStrategy("sample"), MakeSettings()};
+  worker.Start();
+  /// [Sample DistLockManager]
+
+  EXPECT_TRUE(WaitFor([&] { return is_locked.load(); }));
+  worker.Stop();
+  EXPECT_TRUE(backend->Lock()->owners.empty());
+}
+
+UTEST_MT(DistLockManager, Batches, 3) {
+  constexpr std::size_t kWorkers = 50;
+  auto backend = std::make_shared<concurrent::Variable<MockBackend>>();
+  dist_lock::DistLockManager manager{
+      std::make_shared<MockBatchStrategy>(backend, "host-1"),
+      MakeManagerSettings()};
+
+  auto workers = StartWorkers(manager, kWorkers);
+  EXPECT_TRUE(
+      WaitFor([&] { return CountLocks(*backend)["host-1"] == kWorkers; }));
+
+  {
+    const auto locked_backend = backend->Lock();
+    EXPECT_LT(locked_backend->batches, locked_backend->requests);
+  }
+
+  for (auto& worker : workers) worker->Stop();
+  EXPECT_TRUE(backend->Lock()->owners.empty());
+}
+
+UTEST_MT(DistLockManager, Rebalance, 4) {
+  constexpr std::size_t kWorkers = 20;
+  auto backend = std::make_shared<concurrent::Variable<MockBackend>>();
+
+  dist_lock::DistLockManager manager_a{
+      std::make_shared<MockBatchStrategy>(backend, "a"),
+      MakeManagerSettings()};
+  auto workers_a = StartWorkers(manager_a, kWorkers);
+  EXPECT_TRUE(WaitFor([&] { return CountLocks(*backend)["a"] == kWorkers; }));
+
+  dist_lock::DistLockManager manager_b{
+      std::make_shared<MockBatchStrategy>(backend, "b"),
+      MakeManagerSettings()};
+  auto workers_b = StartWorkers(manager_b, kWorkers);
+
+  // some of the locks are handed over to the new member
+  EXPECT_TRUE(WaitFor([&] {
+    auto counts = CountLocks(*backend);
+    return counts["a"] > 0 && counts["b"] > 0 &&
+           counts["a"] + counts["b"] == kWorkers;
+  }));
+
+  for (auto& worker : workers_a) worker->Stop();
+  for (auto& worker : workers_b) worker->Stop();
+  EXPECT_TRUE(backend->Lock()->owners.empty());
+}
+
+USERVER_NAMESPACE_END
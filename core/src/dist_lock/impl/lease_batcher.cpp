@@ -0,0 +1,245 @@
+#include <dist_lock/impl/lease_batcher.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_set>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock::impl {
+namespace {
+
+class ManagerStoppedException : public std::runtime_error {
+ public:
+  ManagerStoppedException()
+      : std::runtime_error("dist_lock::DistLockManager is stopped") {}
+};
+
+}  // namespace
+
+LeaseBatcher::LeaseBatcher(std::shared_ptr<DistLockBatchStrategyBase> strategy,
+                           const DistLockManagerSettings& settings)
+    : strategy_(std::move(strategy)), settings_(settings) {
+  UASSERT(strategy_);
+  UINVARIANT(settings_.max_batch_size > 0, "max_batch_size must be positive");
+}
+
+void LeaseBatcher::Acquire(const std::string& lock_name,
+                           std::chrono::milliseconds lock_ttl,
+                           const std::string& locker_id) {
+  engine::Future<bool> acquired;
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    if (is_stopped_) throw ManagerStoppedException();
+
+    auto& state = locks_[lock_name];
+    if (IsAssignedToThisMember(lock_name)) {
+      state.deferred_since.reset();
+    } else if (state.holder == locker_id) {
+      if (!state.is_kept && TryStartHandover()) {
+        state.holder.clear();
+        // let the member the lock is assigned to take it first
+        state.deferred_since = utils::datetime::SteadyNow();
+        throw LockHandoverRequestedException();
+      }
+    } else {
+      const auto now = utils::datetime::SteadyNow();
+      if (!state.deferred_since) state.deferred_since = now;
+      if (now - *state.deferred_since < settings_.handover_delay) {
+        throw LockAcquisitionDeferredException();
+      }
+    }
+
+    PendingLease lease{{lock_name, locker_id, lock_ttl}, {}};
+    acquired = lease.promise.get_future();
+    pending_.push_back(std::move(lease));
+  }
+  has_pending_.NotifyOne();
+
+  if (!acquired.get()) throw LockIsAcquiredByAnotherHostException();
+}
+
+void LeaseBatcher::Release(const std::string& lock_name,
+                           const std::string& locker_id) {
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    const auto it = locks_.find(lock_name);
+    if (it != locks_.end() && it->second.holder == locker_id) {
+      it->second.holder.clear();
+      it->second.is_kept = false;
+    }
+  }
+  strategy_->Release(lock_name, locker_id);
+}
+
+void LeaseBatcher::Run() {
+  while (!engine::current_task::ShouldCancel()) {
+    {
+      std::unique_lock<engine::Mutex> lock(mutex_);
+      if (!has_pending_.Wait(lock, [this] { return !pending_.empty(); })) {
+        break;
+      }
+    }
+
+    // collect the acquisitions of the other lockers
+    engine::InterruptibleSleepFor(settings_.batch_window);
+    if (engine::current_task::ShouldCancel()) break;
+
+    ExecuteBatch(TakeBatch());
+  }
+}
+
+void LeaseBatcher::Stop() {
+  std::vector<PendingLease> pending;
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    is_stopped_ = true;
+    pending.swap(pending_);
+  }
+  for (auto& lease : pending) {
+    lease.promise.set_exception(
+        std::make_exception_ptr(ManagerStoppedException()));
+  }
+}
+
+bool LeaseBatcher::IsAssignedToThisMember(const std::string& lock_name) const {
+  // No members are known before the first batch, try to acquire everything.
+  if (members_.empty()) return true;
+
+  // Rendezvous hashing: the lock is assigned to the member with the highest
+  // score, so only the locks of the joined or the left member move.
+  const Member* best = nullptr;
+  std::uint64_t best_score = 0;
+  for (const auto& member : members_) {
+    const auto score = utils::hash::WyHash(lock_name, member.seed);
+    if (!best || score > best_score) {
+      best = &member;
+      best_score = score;
+    }
+  }
+  return best->id == strategy_->GetMemberId();
+}
+
+bool LeaseBatcher::TryStartHandover() {
+  if (settings_.rebalance_interval.count() <= 0) return false;
+
+  const auto now = utils::datetime::SteadyNow();
+  if (last_handover_ && now - *last_handover_ < settings_.rebalance_interval) {
+    return false;
+  }
+  last_handover_ = now;
+  return true;
+}
+
+void LeaseBatcher::UpdateMembers(std::vector<std::string>&& member_ids) {
+  const auto& self_id = strategy_->GetMemberId();
+  if (std::find(member_ids.begin(), member_ids.end(), self_id) ==
+      member_ids.end()) {
+    member_ids.push_back(self_id);
+  }
+  std::sort(member_ids.begin(), member_ids.end());
+  member_ids.erase(std::unique(member_ids.begin(), member_ids.end()),
+                   member_ids.end());
+
+  const bool is_same = std::equal(
+      member_ids.begin(), member_ids.end(), members_.begin(), members_.end(),
+      [](const std::string& id, const Member& member) {
+        return id == member.id;
+      });
+  if (is_same) return;
+
+  LOG_INFO() << "Dist lock members changed, " << member_ids.size()
+             << " members are alive";
+  members_.clear();
+  members_.reserve(member_ids.size());
+  for (auto& id : member_ids) {
+    const auto seed = utils::hash::WyHash(id);
+    members_.push_back({std::move(id), seed});
+  }
+
+  // the assignments have changed, start over
+  for (auto& [name, state] : locks_) {
+    state.deferred_since.reset();
+    state.is_kept = false;
+  }
+}
+
+std::vector<LeaseBatcher::PendingLease> LeaseBatcher::TakeBatch() {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+
+  std::vector<PendingLease> batch;
+  std::vector<PendingLease> rest;
+  std::unordered_set<std::string_view> lock_names;
+  for (auto& lease : pending_) {
+    // a repeated lock name waits for the next batch
+    if (batch.size() < settings_.max_batch_size &&
+        lock_names.insert(lease.request.lock_name).second) {
+      batch.push_back(std::move(lease));
+    } else {
+      rest.push_back(std::move(lease));
+    }
+  }
+  pending_ = std::move(rest);
+  return batch;
+}
+
+void LeaseBatcher::ExecuteBatch(std::vector<PendingLease>&& batch) {
+  if (batch.empty()) return;
+
+  std::vector<LeaseRequest> requests;
+  requests.reserve(batch.size());
+  for (const auto& lease : batch) requests.push_back(lease.request);
+
+  BatchAcquireResult result;
+  try {
+    result = strategy_->AcquireBatch(requests);
+    if (result.acquired.size() != requests.size()) {
+      throw std::logic_error("AcquireBatch returned " +
+                             std::to_string(result.acquired.size()) +
+                             " results for " +
+                             std::to_string(requests.size()) + " requests");
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to acquire " << requests.size()
+                  << " dist locks: " << ex;
+    const auto exception = std::current_exception();
+    for (auto& lease : batch) lease.promise.set_exception(exception);
+    return;
+  }
+
+  {
+    std::lock_guard<engine::Mutex> lock(mutex_);
+    UpdateMembers(std::move(result.members));
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      const auto& request = requests[i];
+      auto& state = locks_[request.lock_name];
+      if (result.acquired[i]) {
+        if (state.holder != request.locker_id &&
+            !IsAssignedToThisMember(request.lock_name)) {
+          // the member the lock is assigned to did not take it in time
+          state.is_kept = true;
+        }
+        state.holder = request.locker_id;
+      } else if (state.holder == request.locker_id) {
+        state.holder.clear();
+        state.is_kept = false;
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    batch[i].promise.set_value(result.acquired[i]);
+  }
+}
+
+}  // namespace dist_lock::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/dist_lock/dist_lock_batch_strategy.hpp>
+#include <userver/dist_lock/dist_lock_manager.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock::impl {
+
+/// Merges the lock acquisitions of dist_lock::DistLockManager strategies into
+/// batches and decides which locks are assigned to this member
+class LeaseBatcher final {
+ public:
+  LeaseBatcher(std::shared_ptr<DistLockBatchStrategyBase> strategy,
+               const DistLockManagerSettings& settings);
+
+  /// Waits for the batch with the lock and throws on failure, see
+  /// DistLockStrategyBase::Acquire()
+  void Acquire(const std::string& lock_name, std::chrono::milliseconds lock_ttl,
+               const std::string& locker_id);
+
+  void Release(const std::string& lock_name, const std::string& locker_id);
+
+  /// Executes the batches until cancelled
+  void Run();
+
+  /// Fails the pending and the future acquisitions
+  void Stop();
+
+ private:
+  struct PendingLease {
+    LeaseRequest request;
+    engine::Promise<bool> promise;
+  };
+
+  struct LockState {
+    // ID of the locker that holds the lock on this member, if any
+    std::string holder;
+    // since when the acquisition of the lock assigned to another member is
+    // deferred
+    std::optional<std::chrono::steady_clock::time_point> deferred_since;
+    // the lock was not taken by the member it is assigned to, so it is not
+    // handed over until the members change
+    bool is_kept{false};
+  };
+
+  struct Member {
+    std::string id;
+    std::uint64_t seed;
+  };
+
+  bool IsAssignedToThisMember(const std::string& lock_name) const;
+  bool TryStartHandover();
+  void UpdateMembers(std::vector<std::string>&& member_ids);
+
+  std::vector<PendingLease> TakeBatch();
+  void ExecuteBatch(std::vector<PendingLease>&& batch);
+
+  const std::shared_ptr<DistLockBatchStrategyBase> strategy_;
+  const DistLockManagerSettings settings_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable has_pending_;
+  std::vector<PendingLease> pending_;
+  std::unordered_map<std::string, LockState> locks_;
+  // sorted by id, empty until the first batch
+  std::vector<Member> members_;
+  std::optional<std::chrono::steady_clock::time_point> last_handover_;
+  bool is_stopped_{false};
+};
+
+}  // namespace dist_lock::impl
+
+USERVER_NAMESPACE_END
@@ -129,6 +129,17 @@ void Locker::Run(LockerMode mode, dist_lock::DistLockWaitingMode waiting_mode,
         ExchangeLockState(false, utils::datetime::SteadyNow());
       }
       if (waiting_mode == dist_lock::DistLockWaitingMode::kNoWait) break;
+    } catch (const LockAcquisitionDeferredException&) {
+      LOG_DEBUG() << "Lock acquisition is deferred";
+    } catch (const LockHandoverRequestedException&) {
+      LOG_INFO() << "Handing the lock over to another host";
+      stats_.handovers++;
+      LOG_DEBUG() << "Terminating watchdog task";
+      if (watchdog_task.IsValid()) watchdog_task.RequestCancel();
+      GetTask(watchdog_task, WatchdogName(name_));
+      LOG_DEBUG() << "Terminated watchdog task";
+      lock_guard.TryUnlock();
+      if (waiting_mode == dist_lock::DistLockWaitingMode::kNoWait) break;
     } catch (const std::exception& ex) {
       stats_.lock_failures++;
       LOG_WARNING() << "Lock acquisition failed: " << ex;
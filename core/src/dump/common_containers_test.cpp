@@ -8,6 +8,7 @@
 #include <boost/multi_index_container.hpp>
 
 #include <userver/dump/test_helpers.hpp>
+#include <userver/utils/persistent_map.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -96,6 +97,17 @@ TEST(DumpCommonContainers, UnorderedMap) {
   TestWriteReadCycle(std::unordered_map<bool, bool>{});
 }
 
+TEST(DumpCommonContainers, PersistentMap) {
+  utils::PersistentMap<int, std::string> map;
+  map.insert_or_assign(1, "a");
+  map.insert_or_assign(2, "b");
+
+  const auto result = FromBinary<decltype(map)>(ToBinary(map));
+  EXPECT_EQ(result.size(), 2);
+  EXPECT_EQ(result.at(1), "a");
+  EXPECT_EQ(result.at(2), "b");
+}
+
 TEST(DumpCommonContainers, Set) {
   TestWriteReadCycle(std::set<int>{1, 2, 5});
   TestWriteReadCycle(std::set<std::string>{"a", "b", "bb"});
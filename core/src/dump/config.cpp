@@ -5,6 +5,7 @@
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +19,8 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kMmap = "mmap";
+constexpr std::string_view kCompression = "compression";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
@@ -44,6 +47,16 @@ constexpr std::string_view kDump = "dump";
 constexpr std::string_view kMaxDumpAge = "max-age";
 constexpr std::string_view kMinDumpInterval = "min-interval";
 
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(Compression::kNone, "none")
+        .Case(Compression::kGzip, "gzip");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
 ConfigPatch Parse(const formats::json::Value& value,
                   formats::parse::To<ConfigPatch>) {
   const auto min_dump_interval = value["min-dump-interval-ms"];
@@ -67,6 +80,9 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_mmapped(config[kMmap].As<bool>(false)),
+      dump_compression(
+          config[kCompression].As<Compression>(Compression::kNone)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +94,10 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (dump_is_encrypted && dump_is_mmapped) {
+    throw std::logic_error(fmt::format("{}: {} and {} are mutually exclusive",
+                                       this->name, kEncrypted, kMmap));
+  }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
@@ -574,6 +574,17 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            mmap:
+                type: boolean
+                description: Whether to read the dump by mapping it into memory, see dump::MappedStringView
+                defaultDescription: false
+            compression:
+                type: string
+                description: Compression of the dump file contents
+                defaultDescription: none
+                enum:
+                  - none
+                  - gzip
 )");
 }
 
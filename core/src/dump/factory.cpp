@@ -1,6 +1,7 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
 #include <userver/storages/secdist/component.hpp>
@@ -19,6 +20,13 @@ boost::filesystem::perms GetPerms(const Config& config) {
     return perms::owner_read;
 }
 
+std::unique_ptr<dump::OperationsFactory> WrapCompression(
+    const Config& config, std::unique_ptr<dump::OperationsFactory> factory) {
+  if (config.dump_compression == Compression::kNone) return factory;
+  return std::make_unique<dump::CompressedOperationsFactory>(
+      std::move(factory));
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
@@ -28,17 +36,21 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
   if (config.dump_is_encrypted) {
     const auto& secdist = context.FindComponent<components::Secdist>().Get();
     auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
-    return std::make_unique<dump::EncryptedOperationsFactory>(
-        std::move(secret_key), dump_perms);
+    return WrapCompression(
+        config, std::make_unique<dump::EncryptedOperationsFactory>(
+                    std::move(secret_key), dump_perms));
   } else {
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return WrapCompression(config,
+                           std::make_unique<dump::FileOperationsFactory>(
+                               dump_perms, config.dump_is_mmapped));
   }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(
     const Config& config) {
   auto dump_perms = GetPerms(config);
-  return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+  return WrapCompression(config, std::make_unique<dump::FileOperationsFactory>(
+                                     dump_perms, config.dump_is_mmapped));
 }
 
 }  // namespace dump
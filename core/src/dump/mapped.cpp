@@ -0,0 +1,38 @@
+#include <userver/dump/mapped.hpp>
+
+#include <utility>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+MappedStringView::MappedStringView(std::string data) {
+  auto storage = std::make_shared<const std::string>(std::move(data));
+  view_ = *storage;
+  storage_ = std::move(storage);
+}
+
+MappedStringView::MappedStringView(std::shared_ptr<const void> storage,
+                                   std::string_view view,
+                                   bool is_mapped) noexcept
+    : storage_(std::move(storage)), view_(view), is_mapped_(is_mapped) {}
+
+void Write(Writer& writer, const MappedStringView& value) {
+  writer.Write(value.Get());
+}
+
+MappedStringView Read(Reader& reader, To<MappedStringView>) {
+  auto mapping = reader.GetMapping();
+  if (!mapping) {
+    return MappedStringView{reader.Read<std::string>()};
+  }
+  const auto view = ReadStringViewUnsafe(reader);
+  return MappedStringView{std::move(mapping), view, true};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,195 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <compression/compressor.hpp>
+#include <compression/gzip.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+// Dumps are written in background, the speed matters more than the ratio
+constexpr int kCompressionLevel = 1;
+
+// A chunk of zero size marks the end of the dump
+constexpr std::size_t kEndOfChunks = 0;
+
+std::string CompressChunk(const std::string& chunk) {
+  try {
+    return compression::Compress(compression::Algorithm::kGzip, chunk,
+                                 kCompressionLevel);
+  } catch (const compression::CompressionError& ex) {
+    throw Error(fmt::format("Failed to compress a dump chunk: {}", ex.what()));
+  }
+}
+
+std::string DecompressChunk(const std::string& compressed,
+                            std::size_t raw_size) {
+  std::string result;
+  try {
+    // gzip::Decompress reports TooBigError when the output reaches the limit
+    // before the end of the stream is seen, hence '+ 1'
+    result = compression::gzip::Decompress(compressed, raw_size + 1);
+  } catch (const std::exception& ex) {
+    throw Error(
+        fmt::format("Failed to decompress a dump chunk: {}", ex.what()));
+  }
+  if (result.size() != raw_size) {
+    throw Error(fmt::format(
+        "Unexpected dump chunk size: expected-size={}, actual-size={}",
+        raw_size, result.size()));
+  }
+  return result;
+}
+
+}  // namespace
+
+CompressedWriter::CompressedWriter(std::unique_ptr<Writer> base,
+                                   std::size_t chunk_size,
+                                   std::size_t max_chunks_in_flight)
+    : base_(std::move(base)),
+      chunk_size_(chunk_size),
+      max_chunks_in_flight_(max_chunks_in_flight) {
+  UASSERT(base_);
+  UINVARIANT(chunk_size_ != 0, "Dump chunk size must be positive");
+  UINVARIANT(max_chunks_in_flight_ != 0,
+             "At least one dump chunk must be allowed in flight");
+  buffer_.reserve(chunk_size_);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  while (!data.empty()) {
+    const auto part = data.substr(0, chunk_size_ - buffer_.size());
+    buffer_.append(part);
+    data.remove_prefix(part.size());
+    if (buffer_.size() == chunk_size_) StartChunk();
+  }
+}
+
+void CompressedWriter::StartChunk() {
+  UASSERT(!buffer_.empty());
+  if (chunks_in_flight_.size() == max_chunks_in_flight_) WriteOldestChunk();
+
+  const auto raw_size = buffer_.size();
+  chunks_in_flight_.push_back(
+      {raw_size,
+       engine::AsyncNoSpan([chunk = std::exchange(buffer_, {})] {
+         return CompressChunk(chunk);
+       })});
+  buffer_.reserve(chunk_size_);
+}
+
+void CompressedWriter::WriteOldestChunk() {
+  UASSERT(!chunks_in_flight_.empty());
+  auto chunk = std::move(chunks_in_flight_.front());
+  chunks_in_flight_.pop_front();
+
+  const auto compressed = chunk.compressed.Get();
+  base_->Write(chunk.raw_size);
+  base_->Write(compressed);
+}
+
+void CompressedWriter::Finish() {
+  if (!buffer_.empty()) StartChunk();
+  while (!chunks_in_flight_.empty()) WriteOldestChunk();
+  base_->Write(kEndOfChunks);
+  base_->Finish();
+}
+
+CompressedReader::CompressedReader(std::unique_ptr<Reader> base,
+                                   std::size_t max_chunks_in_flight)
+    : base_(std::move(base)), max_chunks_in_flight_(max_chunks_in_flight) {
+  UASSERT(base_);
+  UINVARIANT(max_chunks_in_flight_ != 0,
+             "At least one dump chunk must be allowed in flight");
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  std::string_view available{current_chunk_};
+  available.remove_prefix(position_);
+  if (available.size() >= max_size) {
+    position_ += max_size;
+    return available.substr(0, max_size);
+  }
+
+  // The requested data spans multiple chunks
+  joined_.assign(available);
+  while (joined_.size() < max_size && NextChunk()) {
+    const auto part =
+        std::string_view{current_chunk_}.substr(0, max_size - joined_.size());
+    joined_.append(part);
+    position_ = part.size();
+  }
+  return joined_;
+}
+
+void CompressedReader::Prefetch() {
+  while (!base_exhausted_ && chunks_in_flight_.size() < max_chunks_in_flight_) {
+    const auto raw_size = base_->Read<std::size_t>();
+    if (raw_size == kEndOfChunks) {
+      base_exhausted_ = true;
+      break;
+    }
+    chunks_in_flight_.push_back(engine::AsyncNoSpan(
+        [compressed = base_->Read<std::string>(), raw_size] {
+          return DecompressChunk(compressed, raw_size);
+        }));
+  }
+}
+
+bool CompressedReader::NextChunk() {
+  Prefetch();
+  if (chunks_in_flight_.empty()) return false;
+
+  auto chunk = std::move(chunks_in_flight_.front());
+  chunks_in_flight_.pop_front();
+  current_chunk_ = chunk.Get();
+  position_ = 0;
+
+  // Start decompressing the next chunk while this one is being deserialized
+  Prefetch();
+  return true;
+}
+
+void CompressedReader::Finish() {
+  Prefetch();
+  if (position_ != current_chunk_.size() || !chunks_in_flight_.empty()) {
+    throw Error("Unexpected extra data at the end of the compressed dump");
+  }
+  base_->Finish();
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    std::unique_ptr<OperationsFactory> base)
+    : base_(std::move(base)) {
+  UASSERT(base_);
+}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(
+      base_->CreateReader(std::move(full_path)));
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(
+      base_->CreateWriter(std::move(full_path), scope));
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,138 @@
+#include <userver/utest/utest.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations_compressed.hpp>
+#include <userver/dump/operations_encrypted.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kPerms = boost::filesystem::perms::owner_read;
+constexpr std::size_t kSmallChunkSize = 100;
+
+std::vector<std::string> MakeData() {
+  std::vector<std::string> data;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    data.push_back(std::string(i % 300, 'a' + i % 26));
+  }
+  return data;
+}
+
+}  // namespace
+
+UTEST_MT(DumpCompressedFile, WriteRead, 4) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  const auto data = MakeData();
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(
+      std::make_unique<dump::FileWriter>(path, kPerms, scope_time),
+      kSmallChunkSize);
+  writer.Write(data);
+  writer.Write(42);
+  UEXPECT_NO_THROW(writer.Finish());
+
+  dump::CompressedReader reader(std::make_unique<dump::FileReader>(path));
+  EXPECT_EQ(reader.Read<std::vector<std::string>>(), data);
+  EXPECT_EQ(reader.Read<int>(), 42);
+  UEXPECT_THROW(reader.Read<int>(), dump::Error);
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpCompressedFile, Empty) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(
+      std::make_unique<dump::FileWriter>(path, kPerms, scope_time));
+  UEXPECT_NO_THROW(writer.Finish());
+
+  dump::CompressedReader reader(std::make_unique<dump::FileReader>(path));
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpCompressedFile, CompressionRatio) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  const std::string data(10 * dump::CompressedWriter::kDefaultChunkSize, 'a');
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(
+      std::make_unique<dump::FileWriter>(path, kPerms, scope_time));
+  writer.Write(data);
+  writer.Finish();
+
+  EXPECT_LT(boost::filesystem::file_size(path), data.size() / 100);
+
+  dump::CompressedReader reader(std::make_unique<dump::FileReader>(path));
+  EXPECT_EQ(reader.Read<std::string>(), data);
+  reader.Finish();
+}
+
+UTEST(DumpCompressedFile, UnreadData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(
+      std::make_unique<dump::FileWriter>(path, kPerms, scope_time),
+      kSmallChunkSize);
+  writer.Write(MakeData());
+  writer.Finish();
+
+  dump::CompressedReader reader(std::make_unique<dump::FileReader>(path));
+  reader.Read<std::size_t>();
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, Corrupted) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  {
+    // A chunk of 100 bytes that is not gzipped
+    dump::FileWriter writer(path, kPerms, scope_time);
+    writer.Write(std::size_t{100});
+    writer.Write(std::string(100, 'a'));
+    writer.Write(std::size_t{0});
+    writer.Finish();
+  }
+
+  dump::CompressedReader reader(std::make_unique<dump::FileReader>(path));
+  UEXPECT_THROW(reader.Read<std::string>(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, Encrypted) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  const dump::SecretKey key{"12345678901234567890123456789012"};
+  const auto data = MakeData();
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(
+      std::make_unique<dump::EncryptedWriter>(path, key, kPerms, scope_time),
+      kSmallChunkSize);
+  writer.Write(data);
+  writer.Finish();
+
+  dump::CompressedReader reader(
+      std::make_unique<dump::EncryptedReader>(path, key));
+  EXPECT_EQ(reader.Read<std::vector<std::string>>(), data);
+  reader.Finish();
+}
+
+USERVER_NAMESPACE_END
@@ -1,20 +1,49 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>
 #include <stdexcept>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
 
 namespace {
+
 constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
-}
+
+class FileMapping final {
+ public:
+  FileMapping(void* data, std::size_t size) noexcept
+      : data_(data), size_(size) {}
+
+  FileMapping(const FileMapping&) = delete;
+  FileMapping& operator=(const FileMapping&) = delete;
+
+  ~FileMapping() {
+    [[maybe_unused]] const auto result = ::munmap(data_, size_);
+    UASSERT(result == 0);
+  }
+
+  std::string_view GetData() const noexcept {
+    return {static_cast<const char*>(data_), size_};
+  }
+
+ private:
+  void* const data_;
+  const std::size_t size_;
+};
+
+}  // namespace
 
 FileWriter::FileWriter(std::string path, boost::filesystem::perms perms,
                        tracing::ScopeTime& scope)
@@ -116,11 +145,64 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+MappedFileReader::MappedFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    auto file = fs::blocking::FileDescriptor::Open(
+        path_, fs::blocking::OpenFlag::kRead);
+    const auto size = file.GetSize();
+
+    if (size == 0) {
+      // mmap of an empty file fails, and there is nothing to map anyway
+      mapping_ = std::make_shared<const std::string>();
+      return;
+    }
+
+    void* const data = utils::CheckSyscallNotEquals(
+        ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.GetNative(), 0),
+        MAP_FAILED, "calling ::mmap");
+    auto mapping = std::make_shared<const FileMapping>(data, size);
+    data_ = mapping->GetData();
+    mapping_ = std::move(mapping);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to map the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+}
+
+std::string_view MappedFileReader::ReadRaw(std::size_t max_size) {
+  const auto result = data_.substr(position_, max_size);
+  position_ += result.size();
+  return result;
+}
+
+std::shared_ptr<const void> MappedFileReader::GetMapping() const {
+  return mapping_;
+}
+
+void MappedFileReader::Finish() {
+  if (position_ != data_.size()) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, data_.size(), position_, data_.size() - position_));
+  }
+
+  // MappedStringView instances may still hold the mapping
+  mapping_.reset();
+  data_ = {};
+  position_ = 0;
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms,
+                                             bool use_mmap)
+    : perms_(perms), use_mmap_(use_mmap) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
+  if (use_mmap_) {
+    return std::make_unique<MappedFileReader>(std::move(full_path));
+  }
   return std::make_unique<FileReader>(std::move(full_path));
 }
 
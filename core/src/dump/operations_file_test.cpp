@@ -1,7 +1,11 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <vector>
+
 #include <boost/regex.hpp>
 
+#include <userver/dump/common.hpp>
+#include <userver/dump/mapped.hpp>
 #include <userver/dump/unsafe.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
@@ -113,4 +117,87 @@ TEST(DumpOperationsFile, Underread) {
   FAIL();
 }
 
+UTEST(DumpOperationsFile, MappedReadRaw) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  constexpr std::size_t kMaxLength = 10;
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  for (std::size_t i = 0; i <= kMaxLength; ++i) {
+    WriteStringViewUnsafe(writer, std::string(i, 'a' + i));
+  }
+  writer.Finish();
+
+  dump::MappedFileReader reader(path);
+  std::vector<std::string_view> views;
+  for (std::size_t i = 0; i <= kMaxLength; ++i) {
+    views.push_back(ReadStringViewUnsafe(reader, i));
+  }
+  // Unlike FileReader, the previously returned memory is not invalidated
+  for (std::size_t i = 0; i <= kMaxLength; ++i) {
+    EXPECT_EQ(views[i], std::string(i, 'a' + i));
+  }
+  reader.Finish();
+}
+
+UTEST(DumpOperationsFile, MappedEmptyDump) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  dump::MappedFileReader reader(file.GetPath());
+  EXPECT_EQ(reader.Read<dump::MappedStringView>().Get(), "");
+  reader.Finish();
+}
+
+UTEST(DumpOperationsFile, MappedUnderread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MappedFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  UEXPECT_THROW_MSG(reader.Finish(), dump::Error,
+                    "file-size=10, position=9, unread-size=1");
+}
+
+UTEST(DumpOperationsFile, MappedStringView) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  const std::string blob(1000, 'x');
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(dump::MappedStringView{blob});
+  writer.Write(blob);
+  writer.Finish();
+
+  dump::MappedStringView mapped;
+  {
+    dump::MappedFileReader reader(path);
+    mapped = reader.Read<dump::MappedStringView>();
+    EXPECT_TRUE(mapped.IsMapped());
+    // The format is the same as for std::string
+    EXPECT_EQ(reader.Read<std::string>(), blob);
+    reader.Finish();
+  }
+  // The mapping outlives both the reader and the file
+  boost::filesystem::remove(path);
+  EXPECT_EQ(mapped.Get(), blob);
+
+  // Other readers copy the data
+  const auto copy_path = path + "-copy";
+  dump::FileWriter copy_writer(copy_path, boost::filesystem::perms::owner_read,
+                               scope_time);
+  copy_writer.Write(mapped);
+  copy_writer.Finish();
+
+  dump::FileReader copy_reader(copy_path);
+  const auto copied = copy_reader.Read<dump::MappedStringView>();
+  EXPECT_FALSE(copied.IsMapped());
+  EXPECT_EQ(copied.Get(), blob);
+  copy_reader.Finish();
+}
+
 USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
 
 using namespace std::chrono_literals;
 
@@ -52,6 +53,28 @@ UTEST(DynamicConfig, SampleStructConfig) {
   EXPECT_EQ(config[kSampleStructConfig].bar_period, 42s);
 }
 
+const dynamic_config::Key kSampleIntConfig{"SAMPLE_INT_CONFIG", 1};
+
+UTEST(DynamicConfig, ParseOnlyChangedConfigs) {
+  namespace impl = dynamic_config::impl;
+  const auto struct_id = impl::ConfigIdGetter::Get(kSampleStructConfig);
+  const auto int_id = impl::ConfigIdGetter::Get(kSampleIntConfig);
+
+  const auto docs_map = impl::MakeDefaultDocsMap();
+  const impl::SnapshotData snapshot(docs_map, {});
+
+  auto new_docs_map = docs_map;
+  new_docs_map.Set("SAMPLE_INT_CONFIG",
+                   formats::json::ValueBuilder{2}.ExtractValue());
+  const impl::SnapshotData new_snapshot(new_docs_map, docs_map, snapshot);
+
+  EXPECT_EQ(new_snapshot.Get<int>(int_id), 2);
+  EXPECT_FALSE(new_snapshot.IsSameConfig(snapshot, int_id));
+  EXPECT_TRUE(new_snapshot.IsSameConfig(snapshot, struct_id));
+  EXPECT_EQ(&new_snapshot.Get<SampleStructConfig>(struct_id),
+            &snapshot.Get<SampleStructConfig>(struct_id));
+}
+
 struct DummyConfig final {
   int foo;
   std::string bar;
@@ -465,6 +488,58 @@ UTEST(DynamicConfigSubscription, Snippet) {
   EXPECT_EQ(subscriber.GetFooInterestingEventCounter(), 1);
 }
 
+class KeyedConfigSubscriber final {
+ public:
+  /*! [Keyed subscription for dynamic config update] */
+  void OnConfigUpdate(const dynamic_config::Diff& diff_data) {
+    ++updates_count_;
+    // Only called if kBoolConfig or kDummyConfig has changed
+    if (!diff_data.previous || (*diff_data.previous)[kDummyConfig].foo !=
+                                   diff_data.current[kDummyConfig].foo) {
+      RebuildDummyState(diff_data.current[kDummyConfig]);
+    }
+  }
+  /*! [Keyed subscription for dynamic config update] */
+
+  void RebuildDummyState(const DummyConfig&) { ++rebuilds_count_; }
+
+  std::size_t GetUpdatesCount() const { return updates_count_; }
+  std::size_t GetRebuildsCount() const { return rebuilds_count_; }
+
+ private:
+  std::size_t updates_count_{};
+  std::size_t rebuilds_count_{};
+};
+
+UTEST(DynamicConfigSubscription, KeyedDiff) {
+  dynamic_config::StorageMock storage{
+      {kIntConfig, 1}, {kBoolConfig, false}, {kDummyConfig, {1, "bar"}}};
+  auto source = storage.GetSource();
+  KeyedConfigSubscriber subscriber;
+
+  auto scope = source.UpdateAndListen(&subscriber, "",
+                                      &KeyedConfigSubscriber::OnConfigUpdate,
+                                      kBoolConfig, kDummyConfig);
+  EXPECT_EQ(subscriber.GetUpdatesCount(), 1);
+  EXPECT_EQ(subscriber.GetRebuildsCount(), 1);
+
+  storage.Extend({{kIntConfig, 2}});
+  EXPECT_EQ(subscriber.GetUpdatesCount(), 1);
+  EXPECT_EQ(subscriber.GetRebuildsCount(), 1);
+
+  storage.Extend({{kBoolConfig, true}});
+  EXPECT_EQ(subscriber.GetUpdatesCount(), 2);
+  EXPECT_EQ(subscriber.GetRebuildsCount(), 1);
+
+  storage.Extend({{kDummyConfig, {2, "bar"}}});
+  EXPECT_EQ(subscriber.GetUpdatesCount(), 3);
+  EXPECT_EQ(subscriber.GetRebuildsCount(), 2);
+
+  storage.Extend({{kDummyConfig, {2, "bar"}}});
+  EXPECT_EQ(subscriber.GetUpdatesCount(), 3);
+  EXPECT_EQ(subscriber.GetRebuildsCount(), 2);
+}
+
 const dynamic_config::Key<formats::json::Value> kJsonConfig{
     dynamic_config::ConstantConfig{}, {}};
 
@@ -34,6 +34,17 @@ bool IsValidJson(std::string_view json_string) {
   }
 }
 
+std::shared_ptr<const std::any> MakeConfigChecked(
+    const VariableMetadata& metadata, const DocsMap& docs_map) {
+  try {
+    return std::make_shared<const std::any>(metadata.factory(docs_map));
+  } catch (const std::exception& ex) {
+    throw ConfigParseError(
+        fmt::format("While parsing dynamic config values: {} ({})", ex.what(),
+                    compiler::GetTypeName(typeid(ex))));
+  }
+}
+
 }  // namespace
 
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
@@ -112,7 +123,8 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    user_configs_[config_variable.GetId()] =
+        std::make_shared<const std::any>(config_variable.GetValue());
   }
 }
 
@@ -121,15 +133,9 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
   for (const auto [id, metadata] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+    if (!user_configs_[id]) {
       relax.Relax(1);
-      try {
-        user_configs_[id] = metadata.factory(defaults);
-      } catch (const std::exception& ex) {
-        throw ConfigParseError(
-            fmt::format("While parsing dynamic config values: {} ({})",
-                        ex.what(), compiler::GetTypeName(typeid(ex))));
-      }
+      user_configs_[id] = MakeConfigChecked(metadata, defaults);
     }
   }
 }
@@ -140,20 +146,51 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
   if (defaults.IsEmpty()) return;
 
   for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
+    if (user_configs_[id]) continue;
     user_configs_[id] = defaults.user_configs_[id];
   }
 }
 
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const DocsMap& previous_docs_map,
+                           const SnapshotData& previous)
+    : SnapshotData(std::vector<KeyValue>{}) {
+  if (!previous.IsEmpty()) {
+    UASSERT(previous.user_configs_.size() == user_configs_.size());
+  }
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (const auto [id, metadata] : utils::enumerate(Registry())) {
+    // Configs parsed from multiple documents are always parsed anew
+    if (!previous.IsEmpty() && !metadata.name.empty() &&
+        docs_map.Has(metadata.name) &&
+        previous_docs_map.Has(metadata.name) &&
+        docs_map.Get(metadata.name) ==
+            previous_docs_map.Get(metadata.name)) {
+      user_configs_[id] = previous.user_configs_[id];
+      continue;
+    }
+
+    relax.Relax(1);
+    user_configs_[id] = MakeConfigChecked(metadata, docs_map);
+  }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSameConfig(const SnapshotData& other,
+                                ConfigId id) const noexcept {
+  return id < user_configs_.size() && id < other.user_configs_.size() &&
+         user_configs_[id] && user_configs_[id] == other.user_configs_[id];
+}
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config || !config->has_value()) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return *config;
 }
 
 }  // namespace dynamic_config::impl
@@ -0,0 +1,105 @@
+#include <dynamic_config/keyed_diff_channel.hpp>
+
+#include <algorithm>
+
+#include <userver/concurrent/async_event_channel.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+KeyedDiffChannel::KeyedDiffChannel(std::string name,
+                                   OnRemoveCallback on_listener_removal)
+    : name_(std::move(name)),
+      data_(ListenersData{{}, std::move(on_listener_removal)}) {}
+
+void KeyedDiffChannel::SendEvent(const Diff& diff) const {
+  std::lock_guard lock(event_mutex_);
+  auto data = data_.Lock();
+
+  const auto& current = diff.current.GetData();
+  const auto* previous =
+      diff.previous && !current.IsEmpty() ? &diff.previous->GetData() : nullptr;
+
+  // Filled lazily, only the configs of the subscribers are compared
+  std::vector<Change> changes;
+  const auto is_changed = [&](const KeyComparator& key) {
+    if (key.id >= changes.size()) changes.resize(key.id + 1, Change::kUnknown);
+    auto& change = changes[key.id];
+    if (change == Change::kUnknown) {
+      change = key.are_equal(*previous, current, key.id) ? Change::kSame
+                                                         : Change::kChanged;
+    }
+    return change == Change::kChanged;
+  };
+
+  std::vector<const Listener*> notified;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (const auto& [_, listener] : data->listeners) {
+    if (previous && !listener.keys.empty() &&
+        std::none_of(listener.keys.begin(), listener.keys.end(), is_changed)) {
+      continue;
+    }
+    tasks.push_back(
+        utils::Async(listener.task_name,
+                     [&diff, &callback = listener.callback] { callback(diff); }));
+    notified.push_back(&listener);
+  }
+
+  for (std::size_t i = 0; i < tasks.size(); ++i) {
+    concurrent::impl::WaitForTask(notified[i]->name, tasks[i]);
+  }
+}
+
+void KeyedDiffChannel::RemoveListener(
+    concurrent::FunctionId id, concurrent::UnsubscribingKind kind) noexcept {
+  engine::TaskCancellationBlocker blocker;
+  auto data = data_.Lock();
+  auto& listeners = data->listeners;
+  const auto iter = listeners.find(id);
+
+  if (iter == listeners.end()) {
+    concurrent::impl::ReportNotSubscribed(Name());
+    return;
+  }
+
+  if (kind == concurrent::UnsubscribingKind::kAutomatic) {
+    if (!data->on_listener_removal) {
+      concurrent::impl::ReportUnsubscribingAutomatically(name_,
+                                                         iter->second.name);
+    }
+
+    if constexpr (concurrent::impl::kCheckSubscriptionUB) {
+      // Fake listener call to check
+      concurrent::impl::
+          CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnsubscribing(
+              data->on_listener_removal, iter->second.callback, name_,
+              iter->second.name);
+    }
+  }
+  listeners.erase(iter);
+}
+
+concurrent::AsyncEventSubscriberScope KeyedDiffChannel::DoAddListener(
+    concurrent::FunctionId id, std::string_view name, Function&& func) {
+  return DoAddListener(id, name, std::move(func), {});
+}
+
+concurrent::AsyncEventSubscriberScope KeyedDiffChannel::DoAddListener(
+    concurrent::FunctionId id, std::string_view name, Function&& func,
+    std::vector<KeyComparator>&& keys) {
+  auto data = data_.Lock();
+  auto& listeners = data->listeners;
+  auto task_name = concurrent::impl::MakeAsyncChannelName(name_, name);
+  const auto [iterator, success] = listeners.emplace(
+      id, Listener{std::string{name}, std::move(func), std::move(task_name),
+                   std::move(keys)});
+  if (!success) concurrent::impl::ReportAlreadySubscribed(Name(), name);
+  return concurrent::AsyncEventSubscriberScope(*this, id);
+}
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/dynamic_config/impl/snapshot.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dynamic_config::impl {
+
+// Event channel for the subscribers of a subset of configs. Unlike
+// concurrent::AsyncEventChannel, starts tasks only for the subscribers whose
+// configs have changed, each config is compared once per event.
+class KeyedDiffChannel final : public concurrent::AsyncEventSource<const Diff&> {
+ public:
+  using OnRemoveCallback = std::function<void(Function&)>;
+
+  KeyedDiffChannel(std::string name, OnRemoveCallback on_listener_removal);
+
+  template <typename UpdaterFunc>
+  concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
+      concurrent::FunctionId id, std::string_view name, Function&& func,
+      std::vector<KeyComparator>&& keys, UpdaterFunc&& updater) {
+    std::lock_guard lock(event_mutex_);
+    std::forward<UpdaterFunc>(updater)();
+    return DoAddListener(id, name, std::move(func), std::move(keys));
+  }
+
+  // Notifies the subscribers of the changed configs and waits for them
+  void SendEvent(const Diff& diff) const;
+
+  const std::string& Name() const noexcept { return name_; }
+
+ private:
+  struct Listener final {
+    std::string name;
+    Function callback;
+    std::string task_name;
+    std::vector<KeyComparator> keys;
+  };
+
+  struct ListenersData final {
+    std::unordered_map<concurrent::FunctionId, Listener,
+                       concurrent::FunctionId::Hash>
+        listeners;
+    OnRemoveCallback on_listener_removal;
+  };
+
+  enum class Change : std::uint8_t { kUnknown, kChanged, kSame };
+
+  void RemoveListener(concurrent::FunctionId id,
+                      concurrent::UnsubscribingKind kind) noexcept override;
+
+  // A listener without keys is notified of any update
+  concurrent::AsyncEventSubscriberScope DoAddListener(
+      concurrent::FunctionId id, std::string_view name,
+      Function&& func) override;
+
+  concurrent::AsyncEventSubscriberScope DoAddListener(
+      concurrent::FunctionId id, std::string_view name, Function&& func,
+      std::vector<KeyComparator>&& keys);
+
+  const std::string name_;
+  concurrent::Variable<ListenersData> data_;
+  mutable engine::Mutex event_mutex_;
+};
+
+}  // namespace dynamic_config::impl
+
+USERVER_NAMESPACE_END
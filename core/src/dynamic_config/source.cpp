@@ -28,6 +28,13 @@ concurrent::AsyncEventSubscriberScope Source::DoUpdateAndListen(
   return storage_->DoUpdateAndListen(id, name, std::move(func));
 }
 
+concurrent::AsyncEventSubscriberScope Source::DoUpdateAndListen(
+    concurrent::FunctionId id, std::string_view name,
+    DiffEventSource::Function&& func, std::vector<impl::KeyComparator>&& keys) {
+  return storage_->DoUpdateAndListen(id, name, std::move(func),
+                                     std::move(keys));
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
@@ -70,6 +70,10 @@ class DynamicConfig::Impl final {
   dynamic_config::impl::SnapshotData ParseConfig(
       const dynamic_config::DocsMap& value);
 
+  // Parses only the configs that differ from the last applied value
+  dynamic_config::impl::SnapshotData DoParseConfig(
+      const dynamic_config::DocsMap& value);
+
   void DoSetConfig(const dynamic_config::DocsMap& value);
 
   bool Has() const;
@@ -90,6 +94,9 @@ class DynamicConfig::Impl final {
   dynamic_config::impl::StorageData cache_;
   std::string fs_loading_error_msg_;
   dynamic_config::DocsMap fallback_config_;
+  // The last applied value, guarded by set_config_mutex_
+  dynamic_config::DocsMap last_docs_map_;
+  engine::Mutex set_config_mutex_;
 
   const bool updates_enabled_;
   const bool fs_write_enabled_;
@@ -177,7 +184,7 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
     const dynamic_config::DocsMap& value) {
   try {
-    dynamic_config::impl::SnapshotData config(value, {});
+    auto config = DoParseConfig(value);
     stats_.was_last_parse_successful = true;
     alert_storage_.StopAlertNow("config_parse_error");
     return config;
@@ -193,7 +200,15 @@ dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
   }
 }
 
+dynamic_config::impl::SnapshotData DynamicConfig::Impl::DoParseConfig(
+    const dynamic_config::DocsMap& value) {
+  const auto previous = cache_.Read();
+  if (previous->IsEmpty()) return dynamic_config::impl::SnapshotData(value, {});
+  return dynamic_config::impl::SnapshotData(value, last_docs_map_, *previous);
+}
+
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
+  const std::lock_guard lock(set_config_mutex_);
   auto config = ParseConfig(value);
 
   if (!value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
@@ -209,6 +224,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
     loaded_cv_.NotifyAll();
   };
   cache_.Update(std::move(config), std::move(after_assign_hook));
+  last_docs_map_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater,
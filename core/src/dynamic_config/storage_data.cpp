@@ -18,7 +18,14 @@ StorageData::StorageData(SnapshotData config)
                           const auto snapshot = GetSnapshot();
                           if (!snapshot.GetData().IsEmpty()) func(snapshot);
                         }),
-      diff_channel_("dynamic-config-diff", [&](auto& func) {
+      diff_channel_("dynamic-config-diff",
+                    [&](auto& func) {
+                      auto snapshot = GetSnapshot();
+                      if (snapshot.GetData().IsEmpty()) return;
+                      const Diff diff{std::nullopt, std::move(snapshot)};
+                      func(diff);
+                    }),
+      keyed_diff_channel_("dynamic-config-keyed-diff", [&](auto& func) {
         auto snapshot = GetSnapshot();
         if (snapshot.GetData().IsEmpty()) return;
         const Diff diff{std::nullopt, std::move(snapshot)};
@@ -47,6 +54,7 @@ void StorageData::Update(SnapshotData config,
 
   const Diff diff{std::move(previous_config), GetSnapshot()};
   diff_channel_.SendEvent(diff);
+  keyed_diff_channel_.SendEvent(diff);
   snapshot_channel_.SendEvent(GetSnapshot());
 }
 
@@ -88,6 +96,20 @@ concurrent::AsyncEventSubscriberScope StorageData::DoUpdateAndListen(
                                          std::move(updater));
 }
 
+concurrent::AsyncEventSubscriberScope StorageData::DoUpdateAndListen(
+    concurrent::FunctionId id, std::string_view name,
+    DiffChannel::Function&& func, std::vector<KeyComparator>&& keys) {
+  // Locked for the same reason as the overload above
+  std::lock_guard lock(update_mutex_);
+
+  auto updater = [&, func_copy = func] {
+    const Diff diff{std::nullopt, GetSnapshot()};
+    func_copy(diff);
+  };
+  return keyed_diff_channel_.DoUpdateAndListen(
+      id, name, std::move(func), std::move(keys), std::move(updater));
+}
+
 }  // namespace dynamic_config::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include <dynamic_config/keyed_diff_channel.hpp>
 #include <userver/concurrent/async_event_channel.hpp>
 #include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
@@ -34,12 +37,17 @@ class StorageData final {
       concurrent::FunctionId id, std::string_view name,
       DiffChannel::Function&& func);
 
+  concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
+      concurrent::FunctionId id, std::string_view name,
+      DiffChannel::Function&& func, std::vector<KeyComparator>&& keys);
+
  private:
   Snapshot GetSnapshot() { return Snapshot{*this}; }
 
   rcu::Variable<SnapshotData> config_;
   SnapshotChannel snapshot_channel_;
   DiffChannel diff_channel_;
+  KeyedDiffChannel keyed_diff_channel_;
 
   engine::Mutex update_mutex_;
 };
@@ -200,14 +200,18 @@ void DynamicConfigClientUpdater::Update(
     {
       const std::lock_guard lock(update_config_mutex_);
       auto ptr = Get();
-      auto combined = MergeDocsMap(*ptr, std::move(docs_map));
 
-      if (IsDuplicate(update_type, combined)) {
+      // Only the updated documents are compared, the rest are taken from the
+      // current value anyway
+      if (ShouldDeduplicate(deduplicate_update_types_, update_type) &&
+          docs_map.AreContentsIncludedIn(*ptr)) {
         stats.FinishNoChanges();
         server_timestamp_ = reply.timestamp;
         return;
       }
 
+      auto combined = MergeDocsMap(*ptr, std::move(docs_map));
+
       auto size = combined.Size();
       Emplace(std::move(combined));
       StoreIfEnabled();
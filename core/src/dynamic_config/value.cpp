@@ -74,6 +74,14 @@ bool DocsMap::AreContentsEqual(const DocsMap& other) const {
   return docs_ == other.docs_;
 }
 
+bool DocsMap::AreContentsIncludedIn(const DocsMap& other) const {
+  for (const auto& [name, value] : docs_) {
+    const auto it = other.docs_.find(name);
+    if (it == other.docs_.end() || it->second != value) return false;
+  }
+  return true;
+}
+
 void DocsMap::SetConfigsExpectedToBeUsed(
     utils::impl::TransparentSet<std::string> configs, utils::InternalTag) {
   configs_to_be_used_ = std::move(configs);
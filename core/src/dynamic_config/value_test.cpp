@@ -43,6 +43,22 @@ TEST(DocsMap, AreContentsEqualFalse) {
   EXPECT_FALSE(docs_map1.AreContentsEqual(docs_map2));
 }
 
+TEST(DocsMap, AreContentsIncludedIn) {
+  dynamic_config::DocsMap docs_map;
+  docs_map.Parse(R"({"a": "a", "b": "b"})", false);
+
+  dynamic_config::DocsMap update;
+  update.Parse(R"({"b": "b"})", false);
+  EXPECT_TRUE(update.AreContentsIncludedIn(docs_map));
+  EXPECT_FALSE(docs_map.AreContentsIncludedIn(update));
+
+  update.Parse(R"({"b": "c"})", false);
+  EXPECT_FALSE(update.AreContentsIncludedIn(docs_map));
+
+  update.Parse(R"({"b": "b", "c": "c"})", false);
+  EXPECT_FALSE(update.AreContentsIncludedIn(docs_map));
+}
+
 TEST(DocsMap, ConfigExpectedToBeUsedRemovedAfterGet) {
   dynamic_config::DocsMap docs_map;
   utils::impl::TransparentSet<std::string> to_be_used = {"a", "b"};
@@ -9,11 +9,15 @@
 
 #include <coroutines/coroutine.hpp>
 
+#include <engine/impl/numa.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/histogram.hpp>
 
 #include "pool_config.hpp"
 #include "pool_stats.hpp"
+#include "stack_usage.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +39,18 @@ class Pool final {
   PoolStats GetStats() const;
   std::size_t GetStackSize() const;
 
+  /// Must be called from a coroutine of this pool with the address of an
+  /// object in its outermost frame, samples the stack usage according to
+  /// PoolConfig::stack_usage_sampling_period.
+  void SampleStackUsage(const void* stack_marker) noexcept;
+
+  bool IsStackUsageSampled() const noexcept {
+    return config_.stack_usage_sampling_period != 0;
+  }
+
+  /// Histogram of the sampled stack high watermarks, KiB
+  utils::statistics::HistogramView GetStackUsage() const noexcept;
+
  private:
   Coroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
@@ -42,6 +58,10 @@ class Pool final {
   template <typename Token>
   Token& GetUsedPoolToken();
 
+  std::size_t GetLocalUsedPoolIndex() const noexcept;
+
+  static std::size_t GetUsedPoolCapacity(std::size_t max_size);
+
   const PoolConfig config_;
   const Executor executor_;
 
@@ -53,11 +73,17 @@ class Pool final {
   //
   // The same could've been achieved with some LIFO container, but apparently
   // we don't have a container handy enough to not just use 2 queues.
+  //
+  // The 'working set' is sharded by NUMA nodes, so that coroutine stacks that
+  // were touched on a node are reused on the same node.
   moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
-  moodycamel::ConcurrentQueue<Coroutine> used_coroutines_;
+  utils::FixedArray<moodycamel::ConcurrentQueue<Coroutine>> used_coroutines_;
 
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
+
+  std::atomic<std::size_t> max_stack_usage_{0};
+  utils::statistics::Histogram stack_usage_kb_;
 };
 
 template <typename Task>
@@ -95,9 +121,11 @@ Pool<Task>::Pool(PoolConfig config, Executor executor)
       executor_(executor),
       stack_allocator_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
-      used_coroutines_(config_.max_size),
+      used_coroutines_(impl::GetNumaTopology().node_cpus.size(),
+                       GetUsedPoolCapacity(config_.max_size)),
       idle_coroutines_num_(config_.initial_size),
-      total_coroutines_num_(0) {
+      total_coroutines_num_(0),
+      stack_usage_kb_(GetStackUsageBoundsKb()) {
   moodycamel::ProducerToken token(initial_coroutines_);
   for (std::size_t i = 0; i < config_.initial_size; ++i) {
     bool ok =
@@ -126,13 +154,25 @@ typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
   // First try to dequeue from 'working set': if we can get a coroutine
   // from there we are happy, because we saved on minor-page-faulting (thus
   // increasing resident memory usage) a not-yet-de-virtualized coroutine stack.
-  if (used_coroutines_.try_dequeue(
+  const auto local_index = GetLocalUsedPoolIndex();
+  if (used_coroutines_[local_index].try_dequeue(
           GetUsedPoolToken<moodycamel::ConsumerToken>(), mover) ||
       initial_coroutines_.try_dequeue(mover)) {
     --idle_coroutines_num_;
-  } else {
-    coroutine.emplace(CreateCoroutine());
+    return CoroutinePtr(std::move(*coroutine), *this);
+  }
+
+  // A remote stack is still cheaper than a new one: no mmap and no page
+  // faults.
+  for (std::size_t i = 1; i < used_coroutines_.size(); ++i) {
+    const auto index = (local_index + i) % used_coroutines_.size();
+    if (used_coroutines_[index].try_dequeue(mover)) {
+      --idle_coroutines_num_;
+      return CoroutinePtr(std::move(*coroutine), *this);
+    }
   }
+
+  coroutine.emplace(CreateCoroutine());
   return CoroutinePtr(std::move(*coroutine), *this);
 }
 
@@ -142,18 +182,23 @@ void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
   auto& token = GetUsedPoolToken<moodycamel::ProducerToken>();
   const bool ok =
       // We only ever return coroutines into our 'working set'.
-      used_coroutines_.enqueue(token, std::move(coroutine_ptr.Get()));
+      used_coroutines_[GetLocalUsedPoolIndex()].enqueue(
+          token, std::move(coroutine_ptr.Get()));
   if (ok) ++idle_coroutines_num_;
 }
 
 template <typename Task>
 PoolStats Pool<Task>::GetStats() const {
+  std::size_t idle_coroutines = initial_coroutines_.size_approx();
+  for (const auto& used_coroutines : used_coroutines_) {
+    idle_coroutines += used_coroutines.size_approx();
+  }
+
   PoolStats stats;
-  stats.active_coroutines =
-      total_coroutines_num_.load() -
-      (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
+  stats.active_coroutines = total_coroutines_num_.load() - idle_coroutines;
   stats.total_coroutines =
       std::max(total_coroutines_num_.load(), stats.active_coroutines);
+  stats.max_stack_usage = max_stack_usage_.load(std::memory_order_relaxed);
   return stats;
 }
 
@@ -194,13 +239,49 @@ std::size_t Pool<Task>::GetStackSize() const {
   return config_.stack_size;
 }
 
+template <typename Task>
+void Pool<Task>::SampleStackUsage(const void* stack_marker) noexcept {
+  const auto period = config_.stack_usage_sampling_period;
+  if (period == 0 || !ShouldSampleStackUsage(period)) return;
+
+  const auto usage = GetStackHighWatermark(stack_marker, config_.stack_size);
+  if (usage == 0) return;
+
+  stack_usage_kb_.Account(static_cast<double>(usage) / 1024);
+  auto max_usage = max_stack_usage_.load(std::memory_order_relaxed);
+  while (usage > max_usage &&
+         !max_stack_usage_.compare_exchange_weak(max_usage, usage,
+                                                 std::memory_order_relaxed)) {
+  }
+}
+
+template <typename Task>
+utils::statistics::HistogramView Pool<Task>::GetStackUsage() const noexcept {
+  return stack_usage_kb_.GetView();
+}
+
 template <typename Task>
 template <typename Token>
 Token& Pool<Task>::GetUsedPoolToken() {
-  thread_local Token token(used_coroutines_);
+  // The NUMA node of a thread never changes after the first coroutine request
+  thread_local Token token(used_coroutines_[GetLocalUsedPoolIndex()]);
   return token;
 }
 
+template <typename Task>
+std::size_t Pool<Task>::GetUsedPoolCapacity(std::size_t max_size) {
+  // idle_coroutines_num_ limits all the shards together, so the preallocated
+  // capacity is split between them rather than repeated for every node.
+  const auto nodes = impl::GetNumaTopology().node_cpus.size();
+  return (max_size + nodes - 1) / nodes;
+}
+
+template <typename Task>
+std::size_t Pool<Task>::GetLocalUsedPoolIndex() const noexcept {
+  return std::min(impl::GetCurrentThreadNumaNode(),
+                  used_coroutines_.size() - 1);
+}
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -10,6 +10,12 @@ PoolConfig Parse(const yaml_config::YamlConfig& value,
   config.initial_size = value["initial_size"].As<size_t>(config.initial_size);
   config.max_size = value["max_size"].As<size_t>(config.max_size);
   config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
+  config.stack_size_classes =
+      value["stack_size_classes"].As<std::vector<std::size_t>>(
+          config.stack_size_classes);
+  config.stack_usage_sampling_period =
+      value["stack_usage_sampling_period"].As<std::size_t>(
+          config.stack_usage_sampling_period);
   return config;
 }
 
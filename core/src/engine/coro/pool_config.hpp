@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -13,6 +14,11 @@ struct PoolConfig {
   std::size_t initial_size = 1000;
   std::size_t max_size = 4000;
   std::size_t stack_size = 256 * 1024ULL;
+  // Additional stack sizes, each one gets a separate pool that task processors
+  // may opt into with `coro-stack-size`
+  std::vector<std::size_t> stack_size_classes;
+  // Measure the stack usage after every N-th task, 0 disables the sampling
+  std::size_t stack_usage_sampling_period = 0;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
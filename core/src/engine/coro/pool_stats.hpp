@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <utility>
 
@@ -10,11 +11,14 @@ namespace engine::coro {
 struct PoolStats {
   size_t active_coroutines = 0;
   size_t total_coroutines = 0;
+  // The largest sampled stack usage, bytes, 0 if the sampling is disabled
+  size_t max_stack_usage = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
   lhs.active_coroutines += rhs.active_coroutines;
   lhs.total_coroutines += rhs.total_coroutines;
+  lhs.max_stack_usage = std::max(lhs.max_stack_usage, rhs.max_stack_usage);
   return lhs;
 }
 
@@ -0,0 +1,68 @@
+#include <engine/coro/stack_usage.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+constexpr std::array<double, 12> kStackUsageBoundsKb{
+    4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192};
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t finished_tasks = 0;
+
+std::size_t GetPageSize() noexcept {
+  static const auto kPageSize =
+      static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return kPageSize;
+}
+
+}  // namespace
+
+utils::span<const double> GetStackUsageBoundsKb() noexcept {
+  return kStackUsageBoundsKb;
+}
+
+USERVER_PREVENT_TLS_CACHING bool ShouldSampleStackUsage(
+    std::size_t period) noexcept {
+  // Crude, but avoids contention on a shared counter
+  return ++finished_tasks % period == 0;
+}
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetStackHighWatermark(
+    const void* stack_marker, std::size_t stack_size) noexcept {
+  const auto page_size = GetPageSize();
+  const auto marker = reinterpret_cast<std::uintptr_t>(stack_marker);
+  // The outermost frame is in the topmost page of the stack
+  const auto stack_top = (marker / page_size + 1) * page_size;
+  const auto pages = (stack_size + page_size - 1) / page_size;
+  if (stack_top < pages * page_size) return 0;
+  const auto stack_bottom = stack_top - pages * page_size;
+
+  // Called rarely enough for an allocation to be fine
+  thread_local std::vector<unsigned char> residency;
+  residency.resize(pages);
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  if (::mincore(reinterpret_cast<void*>(stack_bottom), pages * page_size,
+                residency.data()) != 0) {
+    return 0;
+  }
+
+  std::size_t resident_pages = 0;
+  for (const auto page : residency) resident_pages += page & 1;
+  return resident_pages * page_size;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+/// Upper bounds of the stack usage histogram buckets, KiB
+utils::span<const double> GetStackUsageBoundsKb() noexcept;
+
+/// Returns true for every `period`-th call on the current thread
+bool ShouldSampleStackUsage(std::size_t period) noexcept;
+
+/// @brief Returns the amount of the coroutine stack memory that has ever been
+/// touched, in bytes.
+///
+/// `stack_marker` is the address of any object in the outermost frame of the
+/// coroutine. The stacks grow down and are never released back to the OS
+/// while the coroutine is alive, so the resident part of the stack is its high
+/// watermark. Returns 0 on errors.
+std::size_t GetStackHighWatermark(const void* stack_marker,
+                                  std::size_t stack_size) noexcept;
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
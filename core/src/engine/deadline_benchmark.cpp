@@ -27,6 +27,15 @@ void deadline_is_reached(benchmark::State& state,
   }
 }
 
+void deadline_is_surely_reached_approx(benchmark::State& state,
+                                       std::chrono::nanoseconds duration) {
+  auto deadline = engine::Deadline::FromDuration(duration);
+  for ([[maybe_unused]] auto _ : state) {
+    bool is_reached = deadline.IsSurelyReachedApprox();
+    benchmark::DoNotOptimize(is_reached);
+  }
+}
+
 void deadline_1us_interval_construction(benchmark::State& state) {
   deadline_from_duration(state, std::chrono::microseconds{1});
 }
@@ -47,6 +56,10 @@ void deadline_100s_interval_reached(benchmark::State& state) {
   deadline_is_reached(state, std::chrono::seconds{100});
 }
 
+void deadline_100s_interval_reached_approx(benchmark::State& state) {
+  deadline_is_surely_reached_approx(state, std::chrono::seconds{100});
+}
+
 }  // namespace
 
 BENCHMARK(deadline_1us_interval_construction);
@@ -55,5 +68,6 @@ BENCHMARK(deadline_20ms_interval_construction);
 BENCHMARK(deadline_1us_interval_reached);
 BENCHMARK(deadline_20ms_interval_reached);
 BENCHMARK(deadline_100s_interval_reached);
+BENCHMARK(deadline_100s_interval_reached_approx);
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#include <userver/engine/distributed_shared_mutex.hpp>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+std::size_t GetCurrentSlotIndex() noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  thread_local const std::size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) %
+      impl::kDistributedSharedMutexSlots;
+  return index;
+}
+
+}  // namespace
+
+DistributedSharedMutex::DistributedSharedMutex() = default;
+
+DistributedSharedMutex::~DistributedSharedMutex() {
+  UASSERT_MSG(!has_writer_.load(), "Destroying a locked mutex");
+  UASSERT_MSG(CountReaders() == 0, "Destroying a locked mutex");
+}
+
+void DistributedSharedMutex::lock() {
+  const auto ok = try_lock_until(Deadline{});
+  UASSERT(ok);
+}
+
+void DistributedSharedMutex::unlock() { ReleaseWriter(); }
+
+bool DistributedSharedMutex::try_lock() {
+  if (!writers_mutex_.try_lock()) return false;
+
+  has_writer_.store(true);
+  if (CountReaders() != 0) {
+    ReleaseWriter();
+    return false;
+  }
+  return true;
+}
+
+bool DistributedSharedMutex::try_lock_until(Deadline deadline) {
+  engine::TaskCancellationBlocker blocker;
+  if (!writers_mutex_.try_lock_until(deadline)) return false;
+
+  has_writer_.store(true);
+  if (!WaitForNoReaders(deadline)) {
+    ReleaseWriter();
+    return false;
+  }
+  return true;
+}
+
+void DistributedSharedMutex::lock_shared() {
+  const auto ok = try_lock_shared_until(Deadline{});
+  UASSERT(ok);
+}
+
+void DistributedSharedMutex::unlock_shared() {
+  GetCurrentSlot().fetch_sub(1);
+  if (has_writer_.load()) readers_left_event_.Send();
+}
+
+bool DistributedSharedMutex::try_lock_shared() {
+  /* Fast path, does not touch the slot while a writer is active */
+  if (has_writer_.load()) return false;
+
+  auto& slot = GetCurrentSlot();
+  slot.fetch_add(1);
+  if (!has_writer_.load()) return true;
+
+  /* The writer might have counted us, let it recount */
+  slot.fetch_sub(1);
+  readers_left_event_.Send();
+  return false;
+}
+
+bool DistributedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  while (!try_lock_shared()) {
+    if (!WaitForNoWriter(deadline)) return false;
+  }
+  return true;
+}
+
+DistributedSharedMutex::Counter&
+DistributedSharedMutex::GetCurrentSlot() noexcept {
+  return slots_[GetCurrentSlotIndex()].readers;
+}
+
+std::int64_t DistributedSharedMutex::CountReaders() const noexcept {
+  std::int64_t result = 0;
+  for (const auto& slot : slots_) result += slot.readers.load();
+  return result;
+}
+
+bool DistributedSharedMutex::WaitForNoReaders(Deadline deadline) {
+  /*
+   * Each reader that unlocks or backs off while has_writer_ is set sends the
+   * event. The event is auto-reset and remembers the signals sent between
+   * the count and the wait, so no wakeup is lost.
+   */
+  while (CountReaders() != 0) {
+    if (!readers_left_event_.WaitForEventUntil(deadline)) {
+      return CountReaders() == 0;
+    }
+  }
+  return true;
+}
+
+bool DistributedSharedMutex::WaitForNoWriter(Deadline deadline) {
+  /* Fast path */
+  if (!has_writer_.load()) return true;
+
+  engine::TaskCancellationBlocker blocker;
+  std::unique_lock<Mutex> lock(writer_left_mutex_);
+  return writer_left_cv_.WaitUntil(lock, deadline,
+                                   [this] { return !has_writer_.load(); });
+}
+
+void DistributedSharedMutex::ReleaseWriter() {
+  {
+    engine::TaskCancellationBlocker blocker;
+    std::lock_guard<Mutex> lock(writer_left_mutex_);
+    has_writer_.store(false);
+  }
+  writer_left_cv_.NotifyAll();
+  writers_mutex_.unlock();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
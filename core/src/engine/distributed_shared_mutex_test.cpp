@@ -0,0 +1,205 @@
+#include <userver/utest/utest.hpp>
+
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/distributed_shared_mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(DistributedSharedMutex, SharedLockUnlockDouble) {
+  engine::DistributedSharedMutex mutex;
+  mutex.lock_shared();
+  mutex.unlock_shared();
+
+  mutex.lock_shared();
+  mutex.unlock_shared();
+}
+
+UTEST_MT(DistributedSharedMutex, SharedLockParallel, 4) {
+  engine::DistributedSharedMutex mutex;
+  std::atomic<int> count{0};
+  engine::SingleConsumerEvent all_locked;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(4);
+  for (int i = 0; i < 4; ++i) {
+    tasks.push_back(utils::Async("", [&] {
+      std::shared_lock lock(mutex);
+      if (++count == 4) all_locked.Send();
+      while (count != 4) engine::Yield();
+    }));
+  }
+
+  EXPECT_TRUE(all_locked.WaitForEventFor(utest::kMaxTestWaitTime));
+  for (auto& task : tasks) UEXPECT_NO_THROW(task.Get());
+}
+
+UTEST(DistributedSharedMutex, SharedAndUniqueLock) {
+  engine::DistributedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  auto reader = utils::Async("", [&mutex] { std::shared_lock lock(mutex); });
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(reader.IsFinished());
+
+  lock.unlock();
+
+  reader.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(reader.IsFinished());
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(DistributedSharedMutex, UniqueAndSharedLock) {
+  engine::DistributedSharedMutex mutex;
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex] { std::unique_lock lock(mutex); });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(writer.IsFinished());
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST_MT(DistributedSharedMutex, WritersDontStarve, 2) {
+  engine::DistributedSharedMutex mutex;
+  std::atomic<int> counter{0};
+  std::atomic<int> loaded{-1};
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&] {
+    std::unique_lock lock(mutex);
+    loaded = counter.load();
+  });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    readers.push_back(utils::Async("", [&] {
+      std::shared_lock lock(mutex);
+      counter++;
+    }));
+  }
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(writer.IsFinished());
+  EXPECT_EQ(loaded.load(), 0);
+
+  for (auto& reader : readers) reader.Get();
+  EXPECT_EQ(counter.load(), 10);
+}
+
+UTEST(DistributedSharedMutex, TryLockShared) {
+  engine::DistributedSharedMutex mutex;
+
+  {
+    std::shared_lock lock(mutex, std::try_to_lock);
+    EXPECT_TRUE(lock.owns_lock());
+    EXPECT_FALSE(mutex.try_lock());
+  }
+
+  std::unique_lock lock(mutex);
+  EXPECT_FALSE(utils::Async("", [&mutex] {
+                 return mutex.try_lock_shared();
+               }).Get());
+  EXPECT_FALSE(utils::Async("", [&mutex] {
+                 return mutex.try_lock_shared_for(
+                     std::chrono::milliseconds(10));
+               }).Get());
+}
+
+UTEST_MT(DistributedSharedMutex, UnlockOnAnotherThread, 4) {
+  constexpr int kReadersCount = 32;
+  engine::DistributedSharedMutex mutex;
+
+  // The readers yield while holding the lock, so some of them unlock on
+  // a different thread and decrement the slot of that thread
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(kReadersCount);
+  for (int i = 0; i < kReadersCount; ++i) {
+    readers.push_back(utils::Async("", [&mutex] {
+      for (int j = 0; j < 100; ++j) {
+        std::shared_lock lock(mutex);
+        engine::Yield();
+      }
+    }));
+  }
+  for (auto& reader : readers) reader.Get();
+
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+UTEST_MT(DistributedSharedMutex, ReadersAndWriters, 4) {
+  constexpr auto kTestDuration = std::chrono::milliseconds{200};
+  const auto deadline = engine::Deadline::FromDuration(kTestDuration);
+
+  engine::DistributedSharedMutex mutex;
+  std::int64_t first = 0;
+  std::int64_t second = 0;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(utils::Async("reader", [&] {
+      while (!deadline.IsReached()) {
+        std::shared_lock lock(mutex);
+        ASSERT_EQ(first, second);
+      }
+    }));
+  }
+  tasks.push_back(utils::Async("writer", [&] {
+    while (!deadline.IsReached()) {
+      std::unique_lock lock(mutex);
+      ++first;
+      engine::Yield();
+      ++second;
+    }
+  }));
+
+  for (auto& task : tasks) task.Get();
+  EXPECT_GT(first, 0);
+}
+
+UTEST(DistributedSharedMutex, SampleDistributedSharedMutex) {
+  /// [Sample engine::DistributedSharedMutex usage]
+  constexpr auto kTestString = "123";
+
+  engine::DistributedSharedMutex mutex;
+  std::string data;
+  {
+    std::lock_guard lock(mutex);
+    // accessing the data under the mutex for writing, waits for all the
+    // readers of all the threads
+    data = kTestString;
+  }
+
+  {
+    std::shared_lock lock(mutex);
+    // accessing the data under the mutex for reading, only the counter of
+    // the current thread is modified
+    const auto& x = data;
+    ASSERT_EQ(x, kTestString);
+  }
+  /// [Sample engine::DistributedSharedMutex usage]
+}
+
+USERVER_NAMESPACE_END
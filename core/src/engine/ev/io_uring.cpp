@@ -0,0 +1,297 @@
+#include <engine/ev/io_uring.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define USERVER_IMPL_HAS_IO_URING 1
+#endif
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+#ifdef USERVER_IMPL_HAS_IO_URING
+
+namespace {
+
+int SysIoUringSetup(std::uint32_t entries, io_uring_params& params) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int SysIoUringEnter(int fd, std::uint32_t to_submit,
+                    std::uint32_t min_complete, std::uint32_t flags) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+template <typename T>
+T* RingPtr(void* base, std::uint32_t offset) noexcept {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+[[noreturn]] void ThrowSystemError(int error, const char* what) {
+  throw std::system_error(error, std::system_category(), what);
+}
+
+// The handlers are at least 2-byte aligned, the lowest bit of user_data
+// tells the removal completions from the poll ones
+constexpr std::uintptr_t kPollRemoveTag = 1;
+
+std::uint64_t MakeUserData(IoUringCompletionHandler& handler,
+                           IoUringOperation operation) noexcept {
+  const auto address = reinterpret_cast<std::uintptr_t>(&handler);
+  UASSERT((address & kPollRemoveTag) == 0);
+  return operation == IoUringOperation::kPollRemove ? address | kPollRemoveTag
+                                                    : address;
+}
+
+}  // namespace
+
+struct IoUring::Rings final {
+  explicit Rings(std::uint32_t entries) {
+    io_uring_params params{};
+    fd = SysIoUringSetup(entries, params);
+    if (fd < 0) ThrowSystemError(errno, "io_uring_setup");
+
+    sq_entries = params.sq_entries;
+    sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+    }
+
+    sq_ring = ::mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+      sq_ring = nullptr;
+      DestroyAndThrow("mmap(IORING_OFF_SQ_RING)");
+    }
+    cq_ring = single_mmap
+                  ? sq_ring
+                  : ::mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (cq_ring == MAP_FAILED) {
+      cq_ring = nullptr;
+      DestroyAndThrow("mmap(IORING_OFF_CQ_RING)");
+    }
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes_ptr =
+        ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes_ptr == MAP_FAILED) {
+      DestroyAndThrow("mmap(IORING_OFF_SQES)");
+    }
+    sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+
+    sq_head = RingPtr<unsigned>(sq_ring, params.sq_off.head);
+    sq_tail = RingPtr<unsigned>(sq_ring, params.sq_off.tail);
+    sq_mask = *RingPtr<unsigned>(sq_ring, params.sq_off.ring_mask);
+    sq_flags = RingPtr<unsigned>(sq_ring, params.sq_off.flags);
+    sq_array = RingPtr<unsigned>(sq_ring, params.sq_off.array);
+    cq_head = RingPtr<unsigned>(cq_ring, params.cq_off.head);
+    cq_tail = RingPtr<unsigned>(cq_ring, params.cq_off.tail);
+    cq_mask = *RingPtr<unsigned>(cq_ring, params.cq_off.ring_mask);
+    cqes = RingPtr<io_uring_cqe>(cq_ring, params.cq_off.cqes);
+  }
+
+  ~Rings() { Destroy(); }
+
+  // Reports the errno of the failed call, not of the cleanup
+  [[noreturn]] void DestroyAndThrow(const char* what) {
+    const auto error = errno;
+    Destroy();
+    ThrowSystemError(error, what);
+  }
+
+  void Destroy() noexcept {
+    if (sqes) ::munmap(sqes, sqes_size);
+    if (cq_ring && cq_ring != sq_ring) ::munmap(cq_ring, cq_ring_size);
+    if (sq_ring) ::munmap(sq_ring, sq_ring_size);
+    if (fd >= 0) ::close(fd);
+    sqes = nullptr;
+    cq_ring = sq_ring = nullptr;
+    fd = -1;
+  }
+
+  int fd{-1};
+
+  void* sq_ring{nullptr};
+  std::size_t sq_ring_size{0};
+  void* cq_ring{nullptr};
+  std::size_t cq_ring_size{0};
+  io_uring_sqe* sqes{nullptr};
+  std::size_t sqes_size{0};
+
+  std::uint32_t sq_entries{0};
+  unsigned* sq_head{nullptr};
+  unsigned* sq_tail{nullptr};
+  unsigned sq_mask{0};
+  unsigned* sq_flags{nullptr};
+  unsigned* sq_array{nullptr};
+  unsigned* cq_head{nullptr};
+  unsigned* cq_tail{nullptr};
+  unsigned cq_mask{0};
+  io_uring_cqe* cqes{nullptr};
+
+  // Entries that are in the ring, but were not consumed by the kernel yet,
+  // protected by IoUring::submit_mutex_
+  std::uint32_t unsubmitted{0};
+};
+
+IoUring::IoUring(std::uint32_t entries)
+    : rings_(std::make_unique<Rings>(entries)) {}
+
+IoUring::~IoUring() = default;
+
+bool IoUring::IsSupported() noexcept {
+  static const bool kIsSupported = [] {
+    try {
+      IoUring probe{1};
+      return true;
+    } catch (const std::exception& ex) {
+      LOG_INFO() << "io_uring is not available: " << ex;
+      return false;
+    }
+  }();
+  return kIsSupported;
+}
+
+int IoUring::Fd() const noexcept { return rings_->fd; }
+
+template <typename SqeInitializer>
+bool IoUring::Submit(SqeInitializer&& initializer) noexcept {
+  auto& rings = *rings_;
+  std::lock_guard lock{submit_mutex_};
+
+  const auto tail = *rings.sq_tail;
+  const auto head = __atomic_load_n(rings.sq_head, __ATOMIC_ACQUIRE);
+  if (tail - head >= rings.sq_entries) {
+    return false;
+  }
+
+  const auto index = tail & rings.sq_mask;
+  auto& sqe = rings.sqes[index];
+  std::memset(&sqe, 0, sizeof(sqe));
+  initializer(sqe);
+  rings.sq_array[index] = index;
+  __atomic_store_n(rings.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  ++rings.unsubmitted;
+
+  // Entries that were not consumed stay in the ring and are submitted along
+  // with the next operation or by FlushSubmissions
+  EnterUnsubmitted();
+  return true;
+}
+
+void IoUring::EnterUnsubmitted() noexcept {
+  auto& rings = *rings_;
+  if (rings.unsubmitted == 0) return;
+
+  const auto submitted = SysIoUringEnter(rings.fd, rings.unsubmitted, 0, 0);
+  if (submitted > 0) {
+    rings.unsubmitted -= static_cast<std::uint32_t>(submitted);
+  } else if (submitted < 0 && errno != EAGAIN && errno != EBUSY &&
+             errno != EINTR) {
+    LOG_LIMITED_ERROR() << "io_uring_enter failed: "
+                        << std::error_code(errno, std::system_category())
+                               .message();
+  }
+}
+
+void IoUring::FlushSubmissions() noexcept {
+  std::lock_guard lock{submit_mutex_};
+  EnterUnsubmitted();
+}
+
+bool IoUring::SubmitPollAdd(int fd, std::uint32_t poll_mask,
+                            IoUringCompletionHandler& handler) noexcept {
+  return Submit([&](io_uring_sqe& sqe) {
+    sqe.opcode = IORING_OP_POLL_ADD;
+    sqe.fd = fd;
+    sqe.poll32_events = poll_mask;
+    sqe.user_data = MakeUserData(handler, IoUringOperation::kPollAdd);
+  });
+}
+
+bool IoUring::SubmitPollRemove(IoUringCompletionHandler& handler) noexcept {
+  return Submit([&](io_uring_sqe& sqe) {
+    sqe.opcode = IORING_OP_POLL_REMOVE;
+    sqe.fd = -1;
+    sqe.addr = MakeUserData(handler, IoUringOperation::kPollAdd);
+    sqe.user_data = MakeUserData(handler, IoUringOperation::kPollRemove);
+  });
+}
+
+std::size_t IoUring::ReapCompletions() noexcept {
+  auto& rings = *rings_;
+
+  if (__atomic_load_n(rings.sq_flags, __ATOMIC_RELAXED) &
+      IORING_SQ_CQ_OVERFLOW) {
+    // Moves the overflown completions into the ring
+    SysIoUringEnter(rings.fd, 0, 0, IORING_ENTER_GETEVENTS);
+  }
+
+  std::size_t reaped = 0;
+  auto head = *rings.cq_head;
+  while (head != __atomic_load_n(rings.cq_tail, __ATOMIC_ACQUIRE)) {
+    const auto cqe = rings.cqes[head & rings.cq_mask];
+    ++head;
+    __atomic_store_n(rings.cq_head, head, __ATOMIC_RELEASE);
+    ++reaped;
+
+    const auto user_data = static_cast<std::uintptr_t>(cqe.user_data);
+    auto* handler = reinterpret_cast<IoUringCompletionHandler*>(
+        user_data & ~kPollRemoveTag);
+    const auto operation = (user_data & kPollRemoveTag)
+                               ? IoUringOperation::kPollRemove
+                               : IoUringOperation::kPollAdd;
+    // Every completion, including -ECANCELED, goes to the operation owner
+    if (handler) handler->OnIoUringCompletion(operation, cqe.res);
+  }
+  return reaped;
+}
+
+#else  // USERVER_IMPL_HAS_IO_URING
+
+struct IoUring::Rings final {};
+
+IoUring::IoUring(std::uint32_t) {
+  throw std::system_error(std::make_error_code(std::errc::not_supported),
+                          "io_uring is only available on Linux");
+}
+
+IoUring::~IoUring() = default;
+
+bool IoUring::IsSupported() noexcept { return false; }
+
+int IoUring::Fd() const noexcept { return -1; }
+
+bool IoUring::SubmitPollAdd(int, std::uint32_t,
+                            IoUringCompletionHandler&) noexcept {
+  return false;
+}
+
+bool IoUring::SubmitPollRemove(IoUringCompletionHandler&) noexcept {
+  return false;
+}
+
+void IoUring::FlushSubmissions() noexcept {}
+
+std::size_t IoUring::ReapCompletions() noexcept { return 0; }
+
+#endif  // USERVER_IMPL_HAS_IO_URING
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+enum class IoUringOperation {
+  kPollAdd,
+  kPollRemove,
+};
+
+/// Receives the results of the operations submitted to IoUring. Called from
+/// the ev thread that owns the ring, once for every submitted operation.
+class IoUringCompletionHandler {
+ public:
+  // `result` is the `res` field of the completion entry: a non-negative
+  // operation result or a negated errno value
+  virtual void OnIoUringCompletion(IoUringOperation operation,
+                                   int result) noexcept = 0;
+
+ protected:
+  ~IoUringCompletionHandler() = default;
+};
+
+/// A minimal io_uring instance driven with raw syscalls.
+///
+/// Operations are submitted by the coroutines directly, without a round trip
+/// through the ev loop, and are completed by the ev thread that polls the ring
+/// fd and calls ReapCompletions.
+class IoUring final {
+ public:
+  /// @throws std::system_error if io_uring is not available
+  explicit IoUring(std::uint32_t entries);
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+  ~IoUring();
+
+  /// Returns true if io_uring may be used in the current environment
+  static bool IsSupported() noexcept;
+
+  int Fd() const noexcept;
+
+  /// Starts a one-shot wait for the `poll(2)` events of the fd. The handler
+  /// gets the happened events or a negated errno.
+  /// Thread-safe. Returns false if the submission queue is full.
+  bool SubmitPollAdd(int fd, std::uint32_t poll_mask,
+                     IoUringCompletionHandler& handler) noexcept;
+
+  /// Cancels a pending poll, its handler gets -ECANCELED unless the poll has
+  /// already completed. The handler also gets the result of the removal
+  /// itself.
+  /// Thread-safe. Returns false if the submission queue is full.
+  bool SubmitPollRemove(IoUringCompletionHandler& handler) noexcept;
+
+  /// Retries passing to the kernel the submitted entries that it has not
+  /// accepted yet, e.g. because of EAGAIN.
+  /// Thread-safe.
+  void FlushSubmissions() noexcept;
+
+  /// Calls the handlers of all the completed operations. Must only be called
+  /// from a single thread.
+  std::size_t ReapCompletions() noexcept;
+
+ private:
+  struct Rings;
+
+  template <typename SqeInitializer>
+  bool Submit(SqeInitializer&& initializer) noexcept;
+
+  // Must be called with submit_mutex_ locked
+  void EnterUnsubmitted() noexcept;
+
+  std::unique_ptr<Rings> rings_;
+  std::mutex submit_mutex_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
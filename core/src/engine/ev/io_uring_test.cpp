@@ -0,0 +1,186 @@
+#include <engine/ev/io_uring.hpp>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/pipe.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class RecordingHandler final : public engine::ev::IoUringCompletionHandler {
+ public:
+  void OnIoUringCompletion(engine::ev::IoUringOperation operation,
+                           int result) noexcept override {
+    if (operation == engine::ev::IoUringOperation::kPollAdd) {
+      result_ = result;
+    } else {
+      remove_result_ = result;
+    }
+  }
+
+  std::optional<int> GetResult() const { return result_; }
+
+  std::optional<int> GetRemoveResult() const { return remove_result_; }
+
+ private:
+  std::optional<int> result_;
+  std::optional<int> remove_result_;
+};
+
+class Pipe final {
+ public:
+  Pipe() { EXPECT_EQ(::pipe(fds_.data()), 0); }
+
+  ~Pipe() {
+    ::close(fds_[0]);
+    ::close(fds_[1]);
+  }
+
+  int Reader() const { return fds_[0]; }
+  int Writer() const { return fds_[1]; }
+
+ private:
+  std::array<int, 2> fds_{-1, -1};
+};
+
+void WaitForCompletions(engine::ev::IoUring& ring) {
+  ::pollfd pfd{ring.Fd(), POLLIN, 0};
+  ASSERT_EQ(::poll(&pfd, 1, 10'000), 1);
+}
+
+}  // namespace
+
+TEST(IoUring, PollAdd) {
+  if (!engine::ev::IoUring::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not available";
+  }
+
+  engine::ev::IoUring ring{16};
+  Pipe pipe;
+  RecordingHandler handler;
+
+  ASSERT_TRUE(ring.SubmitPollAdd(pipe.Reader(), POLLIN, handler));
+  EXPECT_EQ(ring.ReapCompletions(), 0);
+  EXPECT_FALSE(handler.GetResult());
+
+  ASSERT_EQ(::write(pipe.Writer(), "x", 1), 1);
+  WaitForCompletions(ring);
+  EXPECT_EQ(ring.ReapCompletions(), 1);
+  ASSERT_TRUE(handler.GetResult());
+  EXPECT_TRUE(*handler.GetResult() & POLLIN);
+}
+
+TEST(IoUring, PollRemove) {
+  if (!engine::ev::IoUring::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not available";
+  }
+
+  engine::ev::IoUring ring{16};
+  Pipe pipe;
+  RecordingHandler handler;
+
+  ASSERT_TRUE(ring.SubmitPollAdd(pipe.Reader(), POLLIN, handler));
+  ASSERT_TRUE(ring.SubmitPollRemove(handler));
+  // Both the poll and the removal complete
+  std::size_t reaped = 0;
+  while (reaped < 2) {
+    WaitForCompletions(ring);
+    reaped += ring.ReapCompletions();
+  }
+  EXPECT_EQ(reaped, 2);
+  ASSERT_TRUE(handler.GetResult());
+  EXPECT_EQ(*handler.GetResult(), -ECANCELED);
+  ASSERT_TRUE(handler.GetRemoveResult());
+  EXPECT_EQ(*handler.GetRemoveResult(), 0);
+
+  // The removal of a completed poll fails, but is still reported
+  RecordingHandler completed_handler;
+  ASSERT_TRUE(ring.SubmitPollRemove(completed_handler));
+  WaitForCompletions(ring);
+  EXPECT_EQ(ring.ReapCompletions(), 1);
+  EXPECT_FALSE(completed_handler.GetResult());
+  ASSERT_TRUE(completed_handler.GetRemoveResult());
+  EXPECT_EQ(*completed_handler.GetRemoveResult(), -ENOENT);
+}
+
+TEST(IoUring, EnginePipe) {
+  engine::TaskProcessorPoolsConfig config;
+  config.io_uring = true;
+
+  engine::RunStandalone(2, config, [] {
+    engine::io::Pipe pipe;
+    std::array<char, 4> buf{};
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    EXPECT_FALSE(pipe.reader.WaitReadable(
+        engine::Deadline::FromDuration(std::chrono::milliseconds{10})));
+
+    auto reader = engine::AsyncNoSpan(
+        [&] { return pipe.reader.ReadAll(buf.data(), buf.size(), deadline); });
+    ASSERT_EQ(pipe.writer.WriteAll("test", 4, deadline), 4);
+    EXPECT_EQ(reader.Get(), buf.size());
+  });
+}
+
+TEST(IoUring, EngineWaitAfterTimeouts) {
+  engine::TaskProcessorPoolsConfig config;
+  config.io_uring = true;
+
+  engine::RunStandalone(2, config, [] {
+    engine::io::Pipe pipe;
+    char c{};
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    // Every timed out wait removes its poll, and the removals must not affect
+    // the following waits of the same poller
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_FALSE(pipe.reader.WaitReadable(
+          engine::Deadline::FromDuration(std::chrono::microseconds{100})));
+    }
+
+    auto reader = engine::AsyncNoSpan(
+        [&] { return pipe.reader.ReadAll(&c, 1, deadline); });
+    engine::Yield();
+    ASSERT_EQ(pipe.writer.WriteAll("x", 1, deadline), 1);
+    EXPECT_EQ(reader.Get(), 1);
+    EXPECT_EQ(c, 'x');
+  });
+}
+
+TEST(IoUring, EngineCancelledWait) {
+  engine::TaskProcessorPoolsConfig config;
+  config.io_uring = true;
+
+  engine::RunStandalone(2, config, [] {
+    engine::io::Pipe pipe;
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    engine::SingleConsumerEvent started;
+    auto waiter = engine::AsyncNoSpan([&] {
+      started.Send();
+      return pipe.reader.WaitReadable(deadline);
+    });
+    ASSERT_TRUE(started.WaitForEventFor(utest::kMaxTestWaitTime));
+    waiter.RequestCancel();
+    // Returns without waiting for the deadline
+    EXPECT_FALSE(waiter.Get());
+  });
+}
+
+USERVER_NAMESPACE_END
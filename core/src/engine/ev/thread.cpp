@@ -1,5 +1,6 @@
 #include "thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -37,6 +38,15 @@ const auto kEventImmediateSetupThreshold =
     kPeriodicEventsDriverInterval +
     utils::datetime::SteadyCoarseClock::resolution();
 
+// The counter has a single writer, the ev thread
+using LibEvDuration = std::chrono::duration<double>;
+
+void IncrementFromEvThread(std::atomic<std::uint64_t>& counter,
+                           std::uint64_t value = 1) noexcept {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
 std::atomic_flag& GetEvDefaultLoopFlag() {
   static std::atomic_flag ev_default_loop_flag ATOMIC_FLAG_INIT;
   return ev_default_loop_flag;
@@ -60,22 +70,47 @@ void ReleaseEvDefaultLoop() {
 constexpr std::chrono::milliseconds kCpuStatsCollectInterval{1000};
 constexpr std::size_t kCpuStatsThrottle{16};
 
+// Only limits the number of operations submitted at once, the number of
+// pending polls is unbounded
+constexpr std::uint32_t kIoUringEntries{4096};
+
+std::unique_ptr<IoUring> MakeIoUring(const std::string& thread_name,
+                                     Thread::IoBackend io_backend) {
+  if (io_backend != Thread::IoBackend::kIoUring) return nullptr;
+  try {
+    return std::make_unique<IoUring>(kIoUringEntries);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to set up io_uring for thread_name="
+                  << thread_name << ", falling back to libev: " << ex;
+    return nullptr;
+  }
+}
+
 }  // namespace
 
 Thread::Thread(const std::string& thread_name,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, false, register_event_mode) {}
+               RegisterEventMode register_event_mode, IoBackend io_backend,
+               TimerBackend timer_backend)
+    : Thread(thread_name, false, register_event_mode, io_backend,
+             timer_backend) {}
 
 Thread::Thread(const std::string& thread_name, UseDefaultEvLoop,
-               RegisterEventMode register_event_mode)
-    : Thread(thread_name, true, register_event_mode) {}
+               RegisterEventMode register_event_mode, IoBackend io_backend,
+               TimerBackend timer_backend)
+    : Thread(thread_name, true, register_event_mode, io_backend,
+             timer_backend) {}
 
 Thread::Thread(const std::string& thread_name, bool use_ev_default_loop,
-               RegisterEventMode register_event_mode)
+               RegisterEventMode register_event_mode, IoBackend io_backend,
+               TimerBackend timer_backend)
     : use_ev_default_loop_(use_ev_default_loop),
       register_event_mode_(register_event_mode),
       loop_(nullptr),
       lock_(loop_mutex_, std::defer_lock),
+      io_uring_(MakeIoUring(thread_name, io_backend)),
+      timer_wheel_(timer_backend == TimerBackend::kTimerWheel
+                       ? std::make_unique<TimerWheel>()
+                       : nullptr),
       name_{thread_name},
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
       is_running_(false) {
@@ -135,6 +170,50 @@ std::uint8_t Thread::GetCurrentLoadPercent() const {
 
 const std::string& Thread::GetName() const { return name_; }
 
+ThreadStats Thread::GetStats() const noexcept {
+  ThreadStats stats;
+  stats.wakeups = wakeups_.load(std::memory_order_relaxed);
+  stats.command_batches = command_batches_.load(std::memory_order_relaxed);
+  stats.commands = commands_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void Thread::StartTimer(TimerWheel::Timer& timer,
+                        Deadline::Duration delay) noexcept {
+  UASSERT(IsInEvThread());
+  UASSERT(timer_wheel_);
+  const auto now = TimerWheel::Clock::now();
+  const auto expiry = now + delay;
+  timer_wheel_->Schedule(timer, expiry, now);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  if (!ev_is_active(&timer_wheel_driver_) ||
+      expiry < timer_wheel_driver_expiry_) {
+    RearmTimerWheelDriver(now);
+  }
+}
+
+void Thread::StopTimer(TimerWheel::Timer& timer) noexcept {
+  UASSERT(IsInEvThread());
+  UASSERT(timer_wheel_);
+  // The driver is re-armed lazily when it fires
+  timer_wheel_->Cancel(timer);
+}
+
+void Thread::RearmTimerWheelDriver(TimerWheel::TimePoint now) noexcept {
+  ev_timer_stop(loop_, &timer_wheel_driver_);
+  if (timer_wheel_->IsEmpty()) return;
+
+  // Sleeps until the wheel has something to fire or cascade instead of
+  // ticking every TimerWheel::kTick
+  timer_wheel_driver_expiry_ = timer_wheel_->GetNextAdvanceTime();
+  const auto delay = std::max(timer_wheel_driver_expiry_ - now,
+                              TimerWheel::Clock::duration::zero());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_set(&timer_wheel_driver_,
+               std::chrono::duration_cast<LibEvDuration>(delay).count(), 0.0);
+  ev_timer_start(loop_, &timer_wheel_driver_);
+}
+
 void Thread::Start() {
   loop_ = use_ev_default_loop_ ? ev_default_loop(EVFLAG_AUTO)
                                : ev_loop_new(EVFLAG_AUTO);
@@ -154,7 +233,6 @@ void Thread::Start() {
   ev_set_priority(&watch_break_, EV_MAXPRI);
   ev_async_start(loop_, &watch_break_);
 
-  using LibEvDuration = std::chrono::duration<double>;
   if (register_event_mode_ == RegisterEventMode::kDeferred) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
     ev_timer_init(
@@ -180,6 +258,18 @@ void Thread::Start() {
     ev_child_start(loop_, &watch_child_);
   }
 
+  if (io_uring_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_io_init(&watch_io_uring_, IoUringWatcher, io_uring_->Fd(), EV_READ);
+    ev_io_start(loop_, &watch_io_uring_);
+  }
+
+  if (timer_wheel_) {
+    // Is started with the first timer
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+    ev_timer_init(&timer_wheel_driver_, TimerWheelWatcher, 0.0, 0.0);
+  }
+
   is_running_ = true;
   thread_ = std::thread([this] {
     utils::SetCurrentThreadName(name_);
@@ -216,11 +306,14 @@ void Thread::RunEvLoop() {
     ev_timer_stop(loop_, &stats_timer_);
   }
   if (use_ev_default_loop_) ev_child_stop(loop_, &watch_child_);
+  if (io_uring_) ev_io_stop(loop_, &watch_io_uring_);
+  if (timer_wheel_) ev_timer_stop(loop_, &timer_wheel_driver_);
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
+  IncrementFromEvThread(ev_thread->wakeups_);
   ev_thread->UpdateLoopWatcherImpl();
 }
 
@@ -232,7 +325,9 @@ void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
 }
 
 void Thread::UpdateLoopWatcherImpl() {
+  std::uint64_t commands = 0;
   while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
+    ++commands;
     LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
                 << compiler::GetTypeName(typeid(*payload));
     try {
@@ -241,6 +336,11 @@ void Thread::UpdateLoopWatcherImpl() {
       LOG_WARNING() << "exception in async thread func: " << ex;
     }
   }
+
+  if (commands != 0) {
+    IncrementFromEvThread(command_batches_);
+    IncrementFromEvThread(commands_, commands);
+  }
 }
 
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -263,6 +363,23 @@ void Thread::ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept {
   }
 }
 
+void Thread::IoUringWatcher(struct ev_loop* loop, ev_io*, int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  UASSERT(ev_thread->io_uring_);
+  ev_thread->io_uring_->ReapCompletions();
+}
+
+void Thread::TimerWheelWatcher(struct ev_loop* loop, ev_timer*,
+                               int) noexcept {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  UASSERT(ev_thread->timer_wheel_);
+  const auto now = TimerWheel::Clock::now();
+  ev_thread->timer_wheel_->Advance(now);
+  ev_thread->RearmTimerWheelDriver(now);
+}
+
 void Thread::ChildWatcherImpl(ev_child* w) {
   auto* child_process_info = ChildProcessMapGetOptional(w->rpid);
   UASSERT(child_process_info);
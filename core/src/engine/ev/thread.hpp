@@ -12,12 +12,24 @@
 
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/io_uring.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+// Counted by the ev thread itself, so the producers do not contend on them
+struct ThreadStats final {
+  // Times the ev loop was woken up by the other threads via ev_async_send
+  std::uint64_t wakeups{0};
+  // Loop iterations that performed at least one command from the queue
+  std::uint64_t command_batches{0};
+  // Commands (watcher starts, stops, etc.) performed from the queue
+  std::uint64_t commands{0};
+};
+
 class Thread final {
  public:
   struct UseDefaultEvLoop {};
@@ -34,8 +46,27 @@ class Thread final {
     kDeferred
   };
 
-  Thread(const std::string& thread_name, RegisterEventMode);
-  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode);
+  enum class IoBackend {
+    // fd readiness is waited for with ev_io watchers
+    kLibev,
+    // fd readiness is waited for with io_uring polls submitted directly from
+    // the coroutines, falls back to kLibev if io_uring is not available
+    kIoUring,
+  };
+
+  enum class TimerBackend {
+    // Each timer is a separate ev_timer
+    kLibev,
+    // Timers are kept in a TimerWheel driven by a single 1ms ev_timer
+    kTimerWheel,
+  };
+
+  Thread(const std::string& thread_name, RegisterEventMode,
+         IoBackend = IoBackend::kLibev,
+         TimerBackend = TimerBackend::kLibev);
+  Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode,
+         IoBackend = IoBackend::kLibev,
+         TimerBackend = TimerBackend::kLibev);
   ~Thread();
 
   struct ev_loop* GetEvLoop() const { return loop_; }
@@ -55,9 +86,22 @@ class Thread final {
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  ThreadStats GetStats() const noexcept;
+
+  // nullptr if the thread does not use IoBackend::kIoUring
+  IoUring* GetIoUring() const noexcept { return io_uring_.get(); }
+
+  bool HasTimerWheel() const noexcept { return timer_wheel_ != nullptr; }
+
+  // Must be called from the ev thread, which must use
+  // TimerBackend::kTimerWheel
+  void StartTimer(TimerWheel::Timer& timer, Deadline::Duration delay) noexcept;
+  void StopTimer(TimerWheel::Timer& timer) noexcept;
+
  private:
   Thread(const std::string& thread_name, bool use_ev_default_loop,
-         RegisterEventMode register_event_mode);
+         RegisterEventMode register_event_mode, IoBackend io_backend,
+         TimerBackend timer_backend);
 
   void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -72,7 +116,10 @@ class Thread final {
   static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   void BreakLoopWatcherImpl();
   static void ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept;
+  static void IoUringWatcher(struct ev_loop*, ev_io* w, int) noexcept;
+  static void TimerWheelWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
   static void ChildWatcherImpl(ev_child* w);
+  void RearmTimerWheelDriver(TimerWheel::TimePoint now) noexcept;
 
   static void Acquire(struct ev_loop* loop) noexcept;
   static void Release(struct ev_loop* loop) noexcept;
@@ -94,10 +141,21 @@ class Thread final {
   ev_async watch_update_{};
   ev_async watch_break_{};
   ev_child watch_child_{};
+  ev_io watch_io_uring_{};
+  ev_timer timer_wheel_driver_{};
+  // When the active driver fires
+  TimerWheel::TimePoint timer_wheel_driver_expiry_{};
+
+  std::unique_ptr<IoUring> io_uring_;
+  std::unique_ptr<TimerWheel> timer_wheel_;
 
   const std::string name_;
   utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
 
+  std::atomic<std::uint64_t> wakeups_{0};
+  std::atomic<std::uint64_t> command_batches_{0};
+  std::atomic<std::uint64_t> commands_{0};
+
   bool is_running_;
 };
 
@@ -28,6 +28,14 @@ bool ThreadControlBase::IsInEvThread() const noexcept {
   return thread_.IsInEvThread();
 }
 
+IoUring* ThreadControlBase::GetIoUring() const noexcept {
+  return thread_.GetIoUring();
+}
+
+bool ThreadControlBase::HasTimerWheel() const noexcept {
+  return thread_.HasTimerWheel();
+}
+
 std::uint8_t ThreadControlBase::GetCurrentLoadPercent() const {
   return thread_.GetCurrentLoadPercent();
 }
@@ -36,6 +44,10 @@ const std::string& ThreadControlBase::GetName() const {
   return thread_.GetName();
 }
 
+ThreadStats ThreadControlBase::GetStats() const noexcept {
+  return thread_.GetStats();
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStart(ev_timer& w) noexcept {
   UASSERT(IsInEvThread());
@@ -85,6 +97,17 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStart(TimerWheel::Timer& timer,
+                                Deadline::Duration delay) noexcept {
+  thread_.StartTimer(timer, delay);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStop(TimerWheel::Timer& timer) noexcept {
+  thread_.StopTimer(timer);
+}
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -97,6 +120,17 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Start(TimerWheel::Timer& timer,
+                               Deadline::Duration delay) noexcept {
+  DoStart(timer, delay);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Stop(TimerWheel::Timer& timer) noexcept {
+  DoStop(timer);
+}
+
 ThreadControl::ThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -9,6 +9,8 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/io_uring.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
@@ -98,6 +100,7 @@ class CallerOwnedPayloadBlocking final
 }  // namespace impl
 
 class Thread;
+struct ThreadStats;
 
 class ThreadControlBase {
  public:
@@ -129,8 +132,15 @@ class ThreadControlBase {
 
   bool IsInEvThread() const noexcept;
 
+  /// nullptr if the thread is not configured to use io_uring
+  IoUring* GetIoUring() const noexcept;
+
+  /// Whether the timers must be started via TimerWheel::Timer overloads
+  bool HasTimerWheel() const noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
+  ThreadStats GetStats() const noexcept;
 
  protected:
   explicit ThreadControlBase(Thread& thread) noexcept;
@@ -146,6 +156,9 @@ class ThreadControlBase {
   void DoStart(ev_io& w) noexcept;
   void DoStop(ev_io& w) noexcept;
 
+  void DoStart(TimerWheel::Timer& timer, Deadline::Duration delay) noexcept;
+  void DoStop(TimerWheel::Timer& timer) noexcept;
+
  private:
   Thread& thread_;
 };
@@ -214,6 +227,9 @@ class TimerThreadControl final : public ThreadControlBase {
   void Start(ev_timer& w) noexcept;
   void Stop(ev_timer& w) noexcept;
   void Again(ev_timer& w) noexcept;
+
+  void Start(TimerWheel::Timer& timer, Deadline::Duration delay) noexcept;
+  void Stop(TimerWheel::Timer& timer) noexcept;
 };
 
 class ThreadControl final : public ThreadControlBase {
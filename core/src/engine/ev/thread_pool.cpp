@@ -4,6 +4,9 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+
 #include "thread.hpp"
 #include "thread_control.hpp"
 
@@ -18,8 +21,36 @@ Thread::RegisterEventMode GetRegisterEventMode(bool defer_timers) {
                       : Thread::RegisterEventMode::kImmediate;
 }
 
+Thread::IoBackend GetIoBackend(bool io_uring) {
+  return io_uring ? Thread::IoBackend::kIoUring : Thread::IoBackend::kLibev;
+}
+
+Thread::TimerBackend GetTimerBackend(bool timer_wheel) {
+  return timer_wheel ? Thread::TimerBackend::kTimerWheel
+                     : Thread::TimerBackend::kLibev;
+}
+
+constexpr std::size_t kNoHomeIndex = -1;
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t current_thread_home_index =
+    kNoHomeIndex;
+
 }  // namespace
 
+USERVER_PREVENT_TLS_CACHING std::size_t GetCurrentThreadHomeIndex() noexcept {
+  if (current_thread_home_index == kNoHomeIndex) {
+    static std::atomic<std::size_t> next_index{0};
+    current_thread_home_index =
+        next_index.fetch_add(1, std::memory_order_relaxed);
+  }
+  return current_thread_home_index;
+}
+
+USERVER_PREVENT_TLS_CACHING void SetCurrentThreadHomeIndex(
+    std::size_t index) noexcept {
+  current_thread_home_index = index;
+}
+
 ThreadPool::ThreadPool(ThreadPoolConfig config)
     : ThreadPool(std::move(config), false) {}
 
@@ -27,9 +58,12 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, UseDefaultEvLoop)
     : ThreadPool(std::move(config), !config.ev_default_loop_disabled) {}
 
 ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
-    : use_ev_default_loop_(use_ev_default_loop) {
+    : use_ev_default_loop_(use_ev_default_loop),
+      worker_affinity_(config.worker_affinity) {
   const auto register_timer_event_mode =
       GetRegisterEventMode(config.defer_events);
+  const auto io_backend = GetIoBackend(config.io_uring);
+  const auto timer_backend = GetTimerBackend(config.timer_wheel);
 
   {
     default_threads_.threads =
@@ -38,8 +72,10 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
               fmt::format("{}_{}", config.thread_name, index);
           return (use_ev_default_loop && index == 0)
                      ? Thread(thread_name, Thread::kUseDefaultEvLoop,
-                              register_timer_event_mode)
-                     : Thread(thread_name, register_timer_event_mode);
+                              register_timer_event_mode, io_backend,
+                              timer_backend)
+                     : Thread(thread_name, register_timer_event_mode,
+                              io_backend, timer_backend);
         });
 
     default_threads_.thread_controls = utils::GenerateFixedArray(
@@ -50,9 +86,10 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop)
 
   {
     timer_threads_.threads = utils::GenerateFixedArray(
-        config.dedicated_timer_threads, [](std::size_t index) {
+        config.dedicated_timer_threads, [timer_backend](std::size_t index) {
           return Thread{fmt::format("ev-timer_{}", index),
-                        Thread::RegisterEventMode::kDeferred};
+                        Thread::RegisterEventMode::kDeferred,
+                        Thread::IoBackend::kLibev, timer_backend};
         });
 
     // Although we expect to always have a dedicated timer thread[s]
@@ -76,7 +113,14 @@ std::size_t ThreadPool::GetSize() const {
   return default_threads_.threads.size();
 }
 
-ThreadControl& ThreadPool::NextThread() { return default_threads_.Next(); }
+ThreadControl& ThreadPool::NextThread() {
+  return default_threads_.Next(worker_affinity_);
+}
+
+ThreadControl& ThreadPool::GetThread(std::size_t index) {
+  UASSERT(index < default_threads_.thread_controls.size());
+  return default_threads_.thread_controls[index];
+}
 
 std::vector<ThreadControl*> ThreadPool::NextThreads(std::size_t count) {
   std::vector<ThreadControl*> res;
@@ -96,7 +140,7 @@ std::vector<ThreadControl*> ThreadPool::NextThreads(std::size_t count) {
 }
 
 TimerThreadControl& ThreadPool::NextTimerThread() {
-  return timer_threads_.Next();
+  return timer_threads_.Next(worker_affinity_);
 }
 
 ThreadControl& ThreadPool::GetEvDefaultLoopThread() {
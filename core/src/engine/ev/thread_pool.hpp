@@ -13,6 +13,14 @@ namespace engine::ev {
 
 class Thread;
 
+// Index of the current OS thread. The TaskProcessor workers use their index
+// within the task processor, so that the workers of each task processor
+// spread over all the ev threads. The other threads are assigned one
+// round-robin on the first call.
+std::size_t GetCurrentThreadHomeIndex() noexcept;
+
+void SetCurrentThreadHomeIndex(std::size_t index) noexcept;
+
 class ThreadPool final {
  public:
   struct UseDefaultEvLoop {};
@@ -25,7 +33,10 @@ class ThreadPool final {
 
   std::size_t GetSize() const;
 
+  // With worker_affinity returns the home ev thread of the current thread,
+  // so that the watchers of a TaskProcessor worker share an ev thread
   ThreadControl& NextThread();
+  ThreadControl& GetThread(std::size_t index);
   std::vector<ThreadControl*> NextThreads(std::size_t count);
 
   TimerThreadControl& NextTimerThread();
@@ -36,6 +47,7 @@ class ThreadPool final {
   ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop);
 
   bool use_ev_default_loop_;
+  bool worker_affinity_;
 
   template <typename Control>
   struct BunchOfThreads final {
@@ -43,8 +55,12 @@ class ThreadPool final {
     utils::FixedArray<Control> thread_controls;
     std::atomic<std::size_t> next_thread_idx{0};
 
-    Control& Next() {
+    Control& Next(bool worker_affinity) {
       UASSERT(!thread_controls.empty());
+      if (worker_affinity) {
+        return thread_controls[GetCurrentThreadHomeIndex() %
+                               thread_controls.size()];
+      }
       // just ignore counter_ overflow
       return thread_controls[next_thread_idx++ % thread_controls.size()];
     }
@@ -13,6 +13,10 @@ ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
           config.dedicated_timer_threads);
   config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
   config.defer_events = value["defer_events"].As<bool>(config.defer_events);
+  config.io_uring = value["io_uring"].As<bool>(config.io_uring);
+  config.timer_wheel = value["timer_wheel"].As<bool>(config.timer_wheel);
+  config.worker_affinity =
+      value["worker_affinity"].As<bool>(config.worker_affinity);
   return config;
 }
 
@@ -15,6 +15,9 @@ struct ThreadPoolConfig {
   std::string thread_name = "event-worker";
   bool ev_default_loop_disabled = false;
   bool defer_events = false;
+  bool io_uring = false;
+  bool timer_wheel = false;
+  bool worker_affinity = false;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value,
@@ -0,0 +1,95 @@
+#include <engine/ev/thread_pool.hpp>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/ev/thread.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::ev::ThreadPoolConfig MakeConfig(bool worker_affinity) {
+  engine::ev::ThreadPoolConfig config;
+  config.threads = 4;
+  config.worker_affinity = worker_affinity;
+  return config;
+}
+
+}  // namespace
+
+TEST(EvThreadPool, RoundRobin) {
+  engine::ev::ThreadPool pool{MakeConfig(false)};
+
+  std::set<const engine::ev::ThreadControl*> threads;
+  for (std::size_t i = 0; i < pool.GetSize(); ++i) {
+    threads.insert(&pool.NextThread());
+  }
+  EXPECT_EQ(threads.size(), pool.GetSize());
+}
+
+TEST(EvThreadPool, WorkerAffinity) {
+  engine::ev::ThreadPool pool{MakeConfig(true)};
+
+  const auto& home = pool.NextThread();
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(&pool.NextThread(), &home);
+  EXPECT_EQ(&pool.NextThread(),
+            &pool.GetThread(engine::ev::GetCurrentThreadHomeIndex() %
+                            pool.GetSize()));
+
+  // The other threads get their own homes
+  std::vector<const engine::ev::ThreadControl*> homes(pool.GetSize());
+  std::vector<std::thread> workers;
+  for (auto& worker_home : homes) {
+    workers.emplace_back([&pool, &worker_home] {
+      worker_home = &pool.NextThread();
+      EXPECT_EQ(&pool.NextThread(), worker_home);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  EXPECT_EQ(std::set(homes.begin(), homes.end()).size(), pool.GetSize());
+
+  // NextThreads still spreads over all the threads
+  const auto all = pool.NextThreads(pool.GetSize());
+  EXPECT_EQ(std::set(all.begin(), all.end()).size(), pool.GetSize());
+}
+
+TEST(EvThreadPool, WorkerIndex) {
+  engine::ev::ThreadPool pool{MakeConfig(true)};
+
+  // The workers of different task processors with the same index share the
+  // home, and the workers of one task processor spread over the ev threads
+  std::vector<const engine::ev::ThreadControl*> homes(pool.GetSize() * 2);
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < homes.size(); ++i) {
+    workers.emplace_back([&pool, &homes, i] {
+      engine::ev::SetCurrentThreadHomeIndex(i % pool.GetSize());
+      homes[i] = &pool.NextThread();
+    });
+  }
+  for (auto& worker : workers) worker.join();
+
+  for (std::size_t i = 0; i < homes.size(); ++i) {
+    EXPECT_EQ(homes[i], &pool.GetThread(i % pool.GetSize()));
+  }
+}
+
+TEST(EvThreadPool, Stats) {
+  engine::ev::ThreadPool pool{MakeConfig(false)};
+  auto& thread = pool.GetThread(0);
+
+  constexpr int kCommands = 10;
+  for (int i = 0; i < kCommands; ++i) thread.RunInEvLoopBlocking([] {});
+
+  // The stats of the last batch may be not stored yet
+  const auto stats = thread.GetStats();
+  EXPECT_GE(stats.commands, kCommands - 1);
+  EXPECT_GE(stats.command_batches, kCommands - 1);
+  EXPECT_LE(stats.command_batches, stats.commands);
+  EXPECT_GE(stats.wakeups, kCommands - 1);
+}
+
+USERVER_NAMESPACE_END
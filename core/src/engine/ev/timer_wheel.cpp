@@ -0,0 +1,177 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+using TickDuration = std::chrono::duration<std::int64_t, std::milli>;
+static_assert(TickDuration{1} == TimerWheel::kTick);
+
+}  // namespace
+
+void TimerWheel::Timer::Init(Callback callback, void* data) noexcept {
+  UASSERT(!IsScheduled());
+  callback_ = callback;
+  data_ = data;
+}
+
+TimerWheel::TimerWheel(TimePoint now) noexcept : origin_(now) {}
+
+TimerWheel::~TimerWheel() {
+  UASSERT_MSG(IsEmpty(), "Some timers are still scheduled");
+  for (auto& slot : slots_) slot.clear();
+}
+
+void TimerWheel::Schedule(Timer& timer, TimePoint expiry,
+                          TimePoint now) noexcept {
+  UASSERT(timer.callback_);
+  Cancel(timer);
+
+  if (IsEmpty()) {
+    // Nothing to cascade, so the idle period may be skipped at once
+    current_tick_ = std::max(current_tick_, ToTicks(now));
+  }
+
+  // Round up to never fire early. The current slot may have already been
+  // fired, so the earliest option is the next one.
+  const auto expiry_tick = ToTicks(expiry + kTick - TimePoint::duration{1});
+  timer.expiry_tick_ = std::max(expiry_tick, current_tick_ + 1);
+  Insert(timer);
+  ++size_;
+}
+
+void TimerWheel::Cancel(Timer& timer) noexcept {
+  if (!timer.IsScheduled()) return;
+
+  auto& slot = slots_[timer.slot_];
+  slot.erase(slot.iterator_to(timer));
+  UASSERT(size_ > 0);
+  --size_;
+}
+
+std::size_t TimerWheel::Advance(TimePoint now) noexcept {
+  const auto target_tick = ToTicks(now);
+  std::size_t fired = 0;
+
+  while (current_tick_ < target_tick) {
+    if (IsEmpty()) {
+      current_tick_ = target_tick;
+      break;
+    }
+
+    // Nothing is fired or cascaded in the ticks before the next event
+    const auto next_tick = GetNextEventTick();
+    if (next_tick > target_tick) {
+      current_tick_ = target_tick;
+      break;
+    }
+
+    current_tick_ = next_tick;
+    for (std::size_t level = kLevels - 1; level > 0; --level) {
+      const auto level_period_mask =
+          (std::uint64_t{1} << (kSlotBits * level)) - 1;
+      if ((current_tick_ & level_period_mask) == 0) Cascade(level);
+    }
+    fired += FireCurrentSlot();
+  }
+
+  return fired;
+}
+
+TimerWheel::TimePoint TimerWheel::GetNextAdvanceTime() const noexcept {
+  return origin_ + TickDuration{static_cast<TickDuration::rep>(
+                       GetNextEventTick())};
+}
+
+std::uint64_t TimerWheel::ToTicks(TimePoint time_point) const noexcept {
+  if (time_point <= origin_) return 0;
+  return std::chrono::duration_cast<TickDuration>(time_point - origin_).count();
+}
+
+std::uint64_t TimerWheel::GetNextEventTick() const noexcept {
+  UASSERT(!IsEmpty());
+  auto next_tick = std::numeric_limits<std::uint64_t>::max();
+
+  // The timers of the first level expire within a turn of the wheel
+  for (auto tick = current_tick_ + 1; tick < current_tick_ + kSlots; ++tick) {
+    if (!slots_[tick & (kSlots - 1)].empty()) {
+      next_tick = tick;
+      break;
+    }
+  }
+
+  // The timers of the upper levels are cascaded at the boundaries of their
+  // slots, which come within a turn of the level
+  for (std::size_t level = 1; level < kLevels; ++level) {
+    const auto shift = kSlotBits * level;
+    const auto current_period = current_tick_ >> shift;
+    for (auto period = current_period + 1;
+         period <= current_period + kSlots; ++period) {
+      const auto boundary_tick = period << shift;
+      if (boundary_tick >= next_tick) break;
+      if (!slots_[level * kSlots + (period & (kSlots - 1))].empty()) {
+        next_tick = boundary_tick;
+        break;
+      }
+    }
+  }
+
+  UASSERT(next_tick != std::numeric_limits<std::uint64_t>::max());
+  return next_tick;
+}
+
+void TimerWheel::Insert(Timer& timer) noexcept {
+  UASSERT(timer.expiry_tick_ >= current_tick_);
+  const auto delay =
+      std::min(timer.expiry_tick_ - current_tick_, kMaxDelayTicks);
+  const auto effective_expiry_tick = current_tick_ + delay;
+
+  std::size_t level = 0;
+  while (delay >> (kSlotBits * (level + 1))) ++level;
+  UASSERT(level < kLevels);
+
+  const auto slot =
+      (effective_expiry_tick >> (kSlotBits * level)) & (kSlots - 1);
+  timer.slot_ = level * kSlots + slot;
+  slots_[timer.slot_].push_back(timer);
+}
+
+void TimerWheel::Cascade(std::size_t level) noexcept {
+  const auto slot = (current_tick_ >> (kSlotBits * level)) & (kSlots - 1);
+
+  List cascaded;
+  cascaded.swap(slots_[level * kSlots + slot]);
+  while (!cascaded.empty()) {
+    auto& timer = cascaded.front();
+    cascaded.pop_front();
+    Insert(timer);
+  }
+}
+
+std::size_t TimerWheel::FireCurrentSlot() noexcept {
+  auto& slot = slots_[current_tick_ & (kSlots - 1)];
+  std::size_t fired = 0;
+
+  while (!slot.empty()) {
+    auto& timer = slot.front();
+    UASSERT(timer.expiry_tick_ == current_tick_);
+    slot.pop_front();
+    --size_;
+    ++fired;
+    // May reschedule the timer or destroy it
+    timer.callback_(timer);
+  }
+
+  return fired;
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
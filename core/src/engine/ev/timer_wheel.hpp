@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/intrusive/list.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+/// @brief A hierarchical timer wheel with a 1ms tick.
+///
+/// Scheduling and cancellation are O(1) and only touch the intrusive node of
+/// the timer, which makes the wheel much cheaper than libev timers (a binary
+/// heap) when there are millions of deadlines, most of which never fire.
+/// Timers never fire early, but may fire up to a tick late, plus the delay of
+/// the Advance calls.
+///
+/// Not thread-safe, all the methods must be called from the owning ev thread.
+class TimerWheel final {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using TimePoint = Clock::time_point;
+
+  static constexpr std::chrono::milliseconds kTick{1};
+
+  class Timer final {
+   public:
+    using Callback = void (*)(Timer&) noexcept;
+
+    Timer() = default;
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+    void Init(Callback callback, void* data) noexcept;
+
+    bool IsScheduled() const noexcept { return hook_.is_linked(); }
+
+    void* GetData() const noexcept { return data_; }
+
+   private:
+    friend class TimerWheel;
+
+    using Hook = boost::intrusive::list_member_hook<>;
+
+    Hook hook_;
+    // Index of the slot that holds the timer, level * kSlots + slot
+    std::size_t slot_{0};
+    Callback callback_{nullptr};
+    void* data_{nullptr};
+    std::uint64_t expiry_tick_{0};
+  };
+
+  explicit TimerWheel(TimePoint now = Clock::now()) noexcept;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  ~TimerWheel();
+
+  /// Schedules the timer to fire at `expiry` or reschedules it if it is
+  /// already scheduled.
+  void Schedule(Timer& timer, TimePoint expiry, TimePoint now) noexcept;
+
+  /// Does nothing if the timer is not scheduled.
+  void Cancel(Timer& timer) noexcept;
+
+  /// Fires the timers that have expired by `now`, returns their count.
+  /// The callbacks may schedule and cancel any timers.
+  std::size_t Advance(TimePoint now) noexcept;
+
+  /// The earliest time at which Advance may fire or cascade some timers, so
+  /// the wheel needs no Advance calls until then. The wheel must not be
+  /// empty.
+  TimePoint GetNextAdvanceTime() const noexcept;
+
+  bool IsEmpty() const noexcept { return size_ == 0; }
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+ private:
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlots = 1 << kSlotBits;
+  static constexpr std::size_t kLevels = 4;
+  // Timers with a larger delay are parked at the last level and are
+  // re-inserted when their slot is cascaded
+  static constexpr std::uint64_t kMaxDelayTicks =
+      (std::uint64_t{1} << (kSlotBits * kLevels)) - 1;
+
+  using List = boost::intrusive::make_list<
+      Timer, boost::intrusive::constant_time_size<false>,
+      boost::intrusive::member_hook<Timer, Timer::Hook, &Timer::hook_>>::type;
+
+  std::uint64_t ToTicks(TimePoint time_point) const noexcept;
+  std::uint64_t GetNextEventTick() const noexcept;
+  void Insert(Timer& timer) noexcept;
+  void Cascade(std::size_t level) noexcept;
+  std::size_t FireCurrentSlot() noexcept;
+
+  const TimePoint origin_;
+  std::uint64_t current_tick_{0};
+  std::size_t size_{0};
+  std::array<List, kSlots * kLevels> slots_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,222 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+using namespace std::chrono_literals;
+
+struct RecordingTimer final {
+  RecordingTimer() { timer.Init(OnTimer, this); }
+
+  static void OnTimer(TimerWheel::Timer& timer) noexcept {
+    auto& self = *static_cast<RecordingTimer*>(timer.GetData());
+    self.fired_at = *self.now;
+  }
+
+  TimerWheel::Timer timer;
+  const TimerWheel::TimePoint* now{nullptr};
+  std::optional<TimerWheel::TimePoint> fired_at;
+};
+
+}  // namespace
+
+TEST(TimerWheel, FiresOnTime) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  RecordingTimer timer;
+  timer.now = &now;
+  wheel.Schedule(timer.timer, now + 5ms, now);
+  EXPECT_EQ(wheel.GetSize(), 1);
+
+  now += 4ms;
+  EXPECT_EQ(wheel.Advance(now), 0);
+  EXPECT_FALSE(timer.fired_at);
+
+  now += 1ms;
+  EXPECT_EQ(wheel.Advance(now), 1);
+  EXPECT_TRUE(timer.fired_at);
+  EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, Cancel) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  RecordingTimer timer;
+  timer.now = &now;
+  wheel.Schedule(timer.timer, now + 100ms, now);
+  EXPECT_TRUE(timer.timer.IsScheduled());
+
+  wheel.Cancel(timer.timer);
+  EXPECT_FALSE(timer.timer.IsScheduled());
+  EXPECT_TRUE(wheel.IsEmpty());
+
+  now += 200ms;
+  EXPECT_EQ(wheel.Advance(now), 0);
+  EXPECT_FALSE(timer.fired_at);
+
+  // Cancelling an unscheduled timer is a noop
+  wheel.Cancel(timer.timer);
+}
+
+TEST(TimerWheel, Reschedule) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  RecordingTimer timer;
+  timer.now = &now;
+  wheel.Schedule(timer.timer, now + 10ms, now);
+  wheel.Schedule(timer.timer, now + 3s, now);
+  EXPECT_EQ(wheel.GetSize(), 1);
+
+  now += 2999ms;
+  wheel.Advance(now);
+  EXPECT_FALSE(timer.fired_at);
+
+  now += 1ms;
+  wheel.Advance(now);
+  EXPECT_EQ(timer.fired_at, now);
+}
+
+TEST(TimerWheel, NeverFiresEarly) {
+  const auto start = TimerWheel::Clock::now();
+  auto now = start;
+  TimerWheel wheel{now};
+
+  std::mt19937 gen{42};
+  // Covers every level of the wheel, as well as the overflow
+  std::uniform_int_distribution<std::int64_t> delay_us{0, 20'000'000'000};
+
+  constexpr std::size_t kTimers = 1000;
+  std::vector<RecordingTimer> timers(kTimers);
+  std::vector<TimerWheel::TimePoint> expiries;
+  expiries.reserve(kTimers);
+  for (auto& timer : timers) {
+    timer.now = &now;
+    expiries.push_back(start + std::chrono::microseconds{delay_us(gen)});
+    wheel.Schedule(timer.timer, expiries.back(), now);
+  }
+
+  std::size_t fired = 0;
+  while (!wheel.IsEmpty()) {
+    now += 100ms;
+    fired += wheel.Advance(now);
+  }
+  EXPECT_EQ(fired, kTimers);
+
+  for (std::size_t i = 0; i < kTimers; ++i) {
+    ASSERT_TRUE(timers[i].fired_at);
+    EXPECT_GE(*timers[i].fired_at, expiries[i]);
+    EXPECT_LT(*timers[i].fired_at, expiries[i] + 100ms + TimerWheel::kTick);
+  }
+}
+
+TEST(TimerWheel, NextAdvanceTime) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  RecordingTimer soon;
+  RecordingTimer later;
+  soon.now = &now;
+  later.now = &now;
+  wheel.Schedule(later.timer, now + 1h, now);
+  wheel.Schedule(soon.timer, now + 5ms, now);
+  EXPECT_EQ(wheel.GetNextAdvanceTime(), now + 5ms);
+
+  now += 5ms;
+  EXPECT_EQ(wheel.Advance(now), 1);
+  EXPECT_TRUE(soon.fired_at);
+  EXPECT_GT(wheel.GetNextAdvanceTime(), now);
+  EXPECT_LE(wheel.GetNextAdvanceTime(), now + 1h);
+
+  wheel.Cancel(later.timer);
+  EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, AdvanceAtNextTimeOnly) {
+  const auto start = TimerWheel::Clock::now();
+  auto now = start;
+  TimerWheel wheel{now};
+
+  std::mt19937 gen{42};
+  // Covers every level of the wheel, as well as the overflow
+  std::uniform_int_distribution<std::int64_t> delay_us{0, 20'000'000'000};
+
+  constexpr std::size_t kTimers = 1000;
+  std::vector<RecordingTimer> timers(kTimers);
+  std::vector<TimerWheel::TimePoint> expiries;
+  expiries.reserve(kTimers);
+  for (auto& timer : timers) {
+    timer.now = &now;
+    expiries.push_back(start + std::chrono::microseconds{delay_us(gen)});
+    wheel.Schedule(timer.timer, expiries.back(), now);
+  }
+
+  std::size_t fired = 0;
+  std::size_t advances = 0;
+  while (!wheel.IsEmpty()) {
+    const auto next = wheel.GetNextAdvanceTime();
+    ASSERT_GT(next, now);
+    now = next;
+    fired += wheel.Advance(now);
+    ++advances;
+  }
+  EXPECT_EQ(fired, kTimers);
+  // Far fewer wakeups than the ticks in the 20000s
+  EXPECT_LT(advances, 10 * kTimers);
+
+  for (std::size_t i = 0; i < kTimers; ++i) {
+    ASSERT_TRUE(timers[i].fired_at);
+    EXPECT_GE(*timers[i].fired_at, expiries[i]);
+    EXPECT_LT(*timers[i].fired_at, expiries[i] + TimerWheel::kTick);
+  }
+}
+
+TEST(TimerWheel, IdleSkip) {
+  auto now = TimerWheel::Clock::now();
+  TimerWheel wheel{now};
+
+  now += 24h;
+  EXPECT_EQ(wheel.Advance(now), 0);
+
+  RecordingTimer timer;
+  timer.now = &now;
+  wheel.Schedule(timer.timer, now + 1ms, now);
+  now += 1ms;
+  EXPECT_EQ(wheel.Advance(now), 1);
+}
+
+TEST(TimerWheel, EngineTimers) {
+  engine::TaskProcessorPoolsConfig config;
+  config.timer_wheel = true;
+
+  engine::RunStandalone(2, config, [] {
+    const auto start = std::chrono::steady_clock::now();
+    engine::SleepFor(10ms);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 10ms);
+
+    auto task = engine::AsyncNoSpan(engine::Deadline::FromDuration(10ms), [] {
+      engine::InterruptibleSleepFor(std::chrono::hours{1});
+      return engine::current_task::CancellationReason();
+    });
+    EXPECT_EQ(task.Get(), engine::TaskCancellationReason::kDeadline);
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,15 @@
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 
 #include <atomic>
+#include <cstddef>
+#include <memory>
 #include <optional>
 
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 
+#include <compiler/tls.hpp>
+#include <concurrent/impl/interference_shield.hpp>
 #include <concurrent/intrusive_walkable_pool.hpp>
 #include <engine/task/task_context.hpp>
 
@@ -13,11 +17,31 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// The tokens are spread over the shards by the thread that detaches the task,
+// so that the workers do not contend on the heads of a single pool
+constexpr std::size_t kShardCount = 16;
+
+USERVER_PREVENT_TLS_CACHING
+std::size_t GetCurrentThreadShard() noexcept {
+  static std::atomic<std::size_t> next_shard{0};
+  thread_local const std::size_t shard =
+      next_shard.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+  return shard;
+}
+
+}  // namespace
+
 struct DetachedTasksSyncBlock::Token final {
-  explicit Token(DetachedTasksSyncBlock& owner) : owner(owner) {}
+  Token(DetachedTasksSyncBlock& owner, std::size_t shard)
+      : owner(owner), shard(shard) {}
 
   DetachedTasksSyncBlock& owner;
 
+  // A token is always released to the pool of the shard it was created in
+  const std::size_t shard;
+
   concurrent::impl::IntrusiveWalkablePoolHook<Token> pool_hook{};
 
   // For cancellations
@@ -28,10 +52,13 @@ struct DetachedTasksSyncBlock::Token final {
 };
 
 struct DetachedTasksSyncBlock::Impl final {
+  using TokenPool = concurrent::impl::IntrusiveWalkablePool<
+      Token, concurrent::impl::MemberHook<&Token::pool_hook>>;
+  using Shard = concurrent::impl::InterferenceShield<TokenPool>;
+
   std::optional<utils::impl::WaitTokenStorage> wait_tokens{};
-  concurrent::impl::IntrusiveWalkablePool<
-      Token, concurrent::impl::MemberHook<&Token::pool_hook>>
-      cancel_tokens{};
+  std::unique_ptr<Shard[]> cancel_tokens{
+      std::make_unique<Shard[]>(kShardCount)};
   std::atomic<TaskCancellationReason> cancel_new_tasks{
       TaskCancellationReason::kNone};
 };
@@ -45,7 +72,9 @@ DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
 DetachedTasksSyncBlock::~DetachedTasksSyncBlock() = default;
 
 void DetachedTasksSyncBlock::Add(TaskContext& context) {
-  auto& token = impl_->cancel_tokens.Acquire([this] { return Token(*this); });
+  const auto shard = GetCurrentThreadShard();
+  auto& token = impl_->cancel_tokens[shard]->Acquire(
+      [this, shard] { return Token(*this, shard); });
   UASSERT(token.task == nullptr);
 
   boost::intrusive_ptr<TaskContext> context_copy(&context);
@@ -75,22 +104,24 @@ void DetachedTasksSyncBlock::Dispose(Token& token) noexcept {
                                                     /*add_ref=*/false);
   }
   [[maybe_unused]] const auto wait_token = std::move(token.wait_token);
-  token.owner.impl_->cancel_tokens.Release(token);
+  token.owner.impl_->cancel_tokens[token.shard]->Release(token);
 }
 
 void DetachedTasksSyncBlock::RequestCancellation(
     TaskCancellationReason reason) noexcept {
   impl_->cancel_new_tasks.store(reason);
 
-  impl_->cancel_tokens.Walk([&](Token& token) {
-    auto* const context_ptr = token.task.exchange(nullptr);
+  for (std::size_t i = 0; i < kShardCount; ++i) {
+    impl_->cancel_tokens[i]->Walk([&](Token& token) {
+      auto* const context_ptr = token.task.exchange(nullptr);
 
-    if (context_ptr != nullptr) {
-      boost::intrusive_ptr<TaskContext> context(context_ptr,
-                                                /*add_ref=*/false);
-      context->RequestCancel(reason);
-    }
-  });
+      if (context_ptr != nullptr) {
+        boost::intrusive_ptr<TaskContext> context(context_ptr,
+                                                  /*add_ref=*/false);
+        context->RequestCancel(reason);
+      }
+    });
+  }
 
   if (impl_->wait_tokens) {
     impl_->wait_tokens->WaitForAllTokens();
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Writes the statistics of all the registered instrumented primitives
+void WriteLockStatistics(utils::statistics::Writer& writer);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
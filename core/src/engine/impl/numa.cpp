@@ -0,0 +1,169 @@
+#include <engine/impl/numa.hpp>
+
+#include <sched.h>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr std::string_view kSysNodePath = "/sys/devices/system/node";
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t current_thread_numa_node = 0;
+
+std::string_view TrimWhitespace(std::string_view str) {
+  constexpr std::string_view kWhitespace = " \t\r\n";
+  const auto begin = str.find_first_not_of(kWhitespace);
+  if (begin == std::string_view::npos) return {};
+  const auto end = str.find_last_not_of(kWhitespace);
+  return str.substr(begin, end - begin + 1);
+}
+
+int ParseCpuNumber(std::string_view str, std::string_view cpu_list) {
+  int result{};
+  const auto* const end = str.data() + str.size();
+  const auto [ptr, ec] = std::from_chars(str.data(), end, result);
+  if (ec != std::errc{} || ptr != end || result < 0) {
+    throw std::runtime_error(
+        fmt::format("Invalid CPU list '{}': bad number '{}'", cpu_list, str));
+  }
+  return result;
+}
+
+std::vector<int> GetAvailableCpus() {
+  std::vector<int> result;
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (::sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &cpu_set)) result.push_back(cpu);
+    }
+    return result;
+  }
+#endif
+  const auto cpus = std::max(std::thread::hardware_concurrency(), 1U);
+  for (unsigned cpu = 0; cpu < cpus; ++cpu) {
+    result.push_back(static_cast<int>(cpu));
+  }
+  return result;
+}
+
+NumaTopology ReadNumaTopology() {
+  const auto available_cpus = GetAvailableCpus();
+
+  NumaTopology topology;
+  try {
+    const auto nodes = ParseCpuList(
+        fs::blocking::ReadFileContents(fmt::format("{}/online", kSysNodePath)));
+    for (const auto node : nodes) {
+      auto cpus = ParseCpuList(fs::blocking::ReadFileContents(
+          fmt::format("{}/node{}/cpulist", kSysNodePath, node)));
+      cpus.erase(std::remove_if(cpus.begin(), cpus.end(),
+                                [&available_cpus](int cpu) {
+                                  return !std::binary_search(
+                                      available_cpus.begin(),
+                                      available_cpus.end(), cpu);
+                                }),
+                 cpus.end());
+      if (!cpus.empty()) topology.node_cpus.push_back(std::move(cpus));
+    }
+  } catch (const std::exception& ex) {
+    LOG_INFO() << "Failed to read NUMA topology, assuming a single node: "
+               << ex;
+    topology.node_cpus.clear();
+  }
+
+  if (topology.node_cpus.empty()) {
+    topology.node_cpus.push_back(available_cpus);
+  }
+  return topology;
+}
+
+}  // namespace
+
+std::vector<int> ParseCpuList(std::string_view cpu_list) {
+  std::vector<int> result;
+  for (auto range : utils::text::SplitIntoStringViewVector(cpu_list, ",")) {
+    range = TrimWhitespace(range);
+    if (range.empty()) continue;
+
+    const auto dash_pos = range.find('-');
+    if (dash_pos == std::string_view::npos) {
+      result.push_back(ParseCpuNumber(range, cpu_list));
+      continue;
+    }
+
+    const auto first = ParseCpuNumber(range.substr(0, dash_pos), cpu_list);
+    const auto last = ParseCpuNumber(range.substr(dash_pos + 1), cpu_list);
+    if (first > last) {
+      throw std::runtime_error(fmt::format(
+          "Invalid CPU list '{}': bad range '{}'", cpu_list, range));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+const NumaTopology& GetNumaTopology() {
+  static const NumaTopology topology = ReadNumaTopology();
+  return topology;
+}
+
+std::vector<std::size_t> DistributeWorkersOverNumaNodes(
+    std::size_t workers_count, std::size_t nodes_count) {
+  UASSERT(nodes_count != 0);
+  std::vector<std::size_t> result;
+  result.reserve(workers_count);
+  for (std::size_t i = 0; i < workers_count; ++i) {
+    result.push_back(i * nodes_count / workers_count);
+  }
+  return result;
+}
+
+void BindCurrentThreadToNumaNode(std::size_t node) {
+  const auto& topology = GetNumaTopology();
+  UINVARIANT(node < topology.node_cpus.size(), "NUMA node is out of range");
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : topology.node_cpus[node]) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  utils::CheckSyscall(::sched_setaffinity(0, sizeof(cpu_set), &cpu_set),
+                      "binding thread to NUMA node {}", node);
+#endif
+}
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetCurrentThreadNumaNode() noexcept {
+  return current_thread_numa_node;
+}
+
+USERVER_PREVENT_TLS_CACHING void SetCurrentThreadNumaNode(
+    std::size_t node) noexcept {
+  current_thread_numa_node = node;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// CPUs of the NUMA nodes that are available to the current process. Nodes
+/// without available CPUs are omitted, so there is always at least one node.
+struct NumaTopology final {
+  std::vector<std::vector<int>> node_cpus;
+};
+
+/// Parses the Linux `cpulist` format, e.g. "0-3,8,10-11"
+/// @throws std::runtime_error on invalid input
+std::vector<int> ParseCpuList(std::string_view cpu_list);
+
+/// Reads the topology from /sys/devices/system/node once. Falls back to a
+/// single node with all the available CPUs if the information is missing.
+/// @note Does blocking syscalls on the first call
+const NumaTopology& GetNumaTopology();
+
+/// Evenly distributes `workers_count` workers over `nodes_count` nodes in
+/// contiguous blocks, returns the node index of each worker
+std::vector<std::size_t> DistributeWorkersOverNumaNodes(
+    std::size_t workers_count, std::size_t nodes_count);
+
+/// Pins the current OS thread to the CPUs of the node
+/// @throws std::system_error
+void BindCurrentThreadToNumaNode(std::size_t node);
+
+/// The NUMA node of the current thread. Used by node-aware structures, such as
+/// the coroutine pool, to pick the node-local shard. 0 by default.
+std::size_t GetCurrentThreadNumaNode() noexcept;
+
+void SetCurrentThreadNumaNode(std::size_t node) noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <engine/impl/numa.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Numa, ParseCpuList) {
+  using engine::impl::ParseCpuList;
+
+  EXPECT_THAT(ParseCpuList("0"), testing::ElementsAre(0));
+  EXPECT_THAT(ParseCpuList("0-3\n"), testing::ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(ParseCpuList("0-1,8,10-11"),
+              testing::ElementsAre(0, 1, 8, 10, 11));
+  EXPECT_THAT(ParseCpuList("4,0-1,1"), testing::ElementsAre(0, 1, 4));
+  EXPECT_THAT(ParseCpuList(""), testing::IsEmpty());
+
+  EXPECT_ANY_THROW(ParseCpuList("a"));
+  EXPECT_ANY_THROW(ParseCpuList("3-1"));
+  EXPECT_ANY_THROW(ParseCpuList("1-"));
+  EXPECT_ANY_THROW(ParseCpuList("-1"));
+}
+
+TEST(Numa, DistributeWorkers) {
+  using engine::impl::DistributeWorkersOverNumaNodes;
+
+  EXPECT_THAT(DistributeWorkersOverNumaNodes(4, 1),
+              testing::ElementsAre(0, 0, 0, 0));
+  EXPECT_THAT(DistributeWorkersOverNumaNodes(4, 2),
+              testing::ElementsAre(0, 0, 1, 1));
+  EXPECT_THAT(DistributeWorkersOverNumaNodes(5, 2),
+              testing::ElementsAre(0, 0, 0, 1, 1));
+  EXPECT_THAT(DistributeWorkersOverNumaNodes(3, 3),
+              testing::ElementsAre(0, 1, 2));
+}
+
+TEST(Numa, Topology) {
+  const auto& topology = engine::impl::GetNumaTopology();
+  ASSERT_FALSE(topology.node_cpus.empty());
+  for (const auto& cpus : topology.node_cpus) {
+    EXPECT_FALSE(cpus.empty());
+  }
+}
+
+USERVER_NAMESPACE_END
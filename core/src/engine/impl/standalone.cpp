@@ -25,6 +25,9 @@ std::shared_ptr<TaskProcessorPools> MakeTaskProcessorPools(
   ev_config.thread_name = pools_config.ev_thread_name;
   ev_config.ev_default_loop_disabled = pools_config.ev_default_loop_disabled;
   ev_config.defer_events = pools_config.defer_events;
+  ev_config.io_uring = pools_config.io_uring;
+  ev_config.timer_wheel = pools_config.timer_wheel;
+  ev_config.worker_affinity = pools_config.ev_worker_affinity;
 
   return std::make_shared<TaskProcessorPools>(std::move(coro_config),
                                               std::move(ev_config));
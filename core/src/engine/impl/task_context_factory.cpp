@@ -14,8 +14,13 @@ static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
 
 TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config,
                                      utils::impl::WrappedCallBase& payload) {
-  return *new (storage) TaskContext{config.task_processor, config.importance,
-                                    config.wait_mode, config.deadline, payload};
+  auto& context = *new (storage)
+      TaskContext{config.task_processor, config.importance, config.wait_mode,
+                  config.deadline, config.priority, payload};
+  if (config.start_deadline.IsReachable()) {
+    context.SetStartDeadline(config.start_deadline);
+  }
+  return context;
 }
 
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
@@ -1,10 +1,9 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 
 #include <fmt/format.h>
-#include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/slist.hpp>
-#include <boost/range/adaptor/reversed.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -47,10 +46,58 @@ using NormalDataList = boost::intrusive::slist<
     boost::intrusive::constant_time_size<false>, boost::intrusive::linear<true>,
     boost::intrusive::cache_last<false>>;
 
-using InheritedDataList = boost::intrusive::list<
-    DataPtr,
-    boost::intrusive::member_hook<DataPtr, ListHook, &DataPtr::list_hook>,
-    boost::intrusive::constant_time_size<false>>;
+// Pointers to the inherited variables, shared by a task and its children
+// until either of them modifies its inherited variables (copy-on-write).
+class InheritedBlock final {
+ public:
+  InheritedBlock()
+      : data_(std::make_unique<InheritedDataBase*[]>(variable_count)) {}
+
+  InheritedBlock(const InheritedBlock&) = delete;
+  InheritedBlock& operator=(const InheritedBlock&) = delete;
+
+  ~InheritedBlock() {
+    for (Key key = 0; key < variable_count; ++key) {
+      if (data_[key]) data_[key]->DeleteSelf();
+    }
+  }
+
+  InheritedDataBase*& operator[](Key key) noexcept {
+    UASSERT(key < variable_count);
+    return data_[key];
+  }
+
+  // Only the owning storage shares the block further, so the other owners can
+  // only go away concurrently and the `false` result stays valid
+  bool IsShared() const noexcept {
+    return ref_counter_.load(std::memory_order_acquire) != 1;
+  }
+
+  boost::intrusive_ptr<InheritedBlock> Copy() const {
+    boost::intrusive_ptr<InheritedBlock> copy{new InheritedBlock()};
+    for (Key key = 0; key < variable_count; ++key) {
+      if (auto* const node = data_[key]) {
+        node->AddRef();
+        copy->data_[key] = node;
+      }
+    }
+    return copy;
+  }
+
+  friend void intrusive_ptr_add_ref(InheritedBlock* block) noexcept {
+    block->ref_counter_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  friend void intrusive_ptr_release(InheritedBlock* block) noexcept {
+    if (block->ref_counter_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete block;
+    }
+  }
+
+ private:
+  std::atomic<std::size_t> ref_counter_{0};
+  const std::unique_ptr<InheritedDataBase*[]> data_;
+};
 
 }  // namespace
 
@@ -71,11 +118,20 @@ void ReportVariableNotSet(const std::type_info& type) {
 struct Storage::Impl final {
   std::unique_ptr<DataPtr[]> data;
   NormalDataList normal_data_storage;
-  InheritedDataList inherited_data_storage;
+  boost::intrusive_ptr<InheritedBlock> inherited;
 
-  void DoSetGeneric(Key key, DataBase& node);
+  InheritedBlock& GetUniqueInherited();
 };
 
+InheritedBlock& Storage::Impl::GetUniqueInherited() {
+  if (!inherited) {
+    inherited.reset(new InheritedBlock());
+  } else if (inherited->IsShared()) {
+    inherited = inherited->Copy();
+  }
+  return *inherited;
+}
+
 Storage::Storage() { utils::impl::AssertStaticRegistrationFinished(); }
 
 Storage::~Storage() {
@@ -91,79 +147,57 @@ Storage::~Storage() {
     impl_->normal_data_storage.pop_front_and_dispose(disposer);
   }
 
-  while (!impl_->inherited_data_storage.empty()) {
-    impl_->inherited_data_storage.pop_front_and_dispose(disposer);
-  }
+  impl_->inherited.reset();
 }
 
 void Storage::InheritFrom(Storage& other) {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
-
-  if (!other.impl_->inherited_data_storage.empty() && !impl_->data) {
-    impl_->data = std::make_unique<DataPtr[]>(variable_count);
-  }
-
-  for (DataPtr& their_ptr :
-       other.impl_->inherited_data_storage | boost::adaptors::reversed) {
-    UASSERT(their_ptr.ptr);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-    UASSERT(node.GetKey() < variable_count);
-
-    auto& our_ptr = impl_->data[node.GetKey()];
-    UASSERT(!our_ptr.ptr);
-    our_ptr.ptr = &node;
-    impl_->inherited_data_storage.push_front(our_ptr);
-    node.AddRef();
-  }
+  UASSERT(!impl_->inherited);
+  impl_->inherited = other.impl_->inherited;
 }
 
 void Storage::InitializeFrom(Storage&& other) noexcept {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
+  UASSERT(!impl_->inherited);
   impl_ = std::move(other.impl_);
 }
 
-DataBase* Storage::GetGeneric(Key key) noexcept {
+DataBase* Storage::GetNormalGeneric(Key key) noexcept {
   UASSERT(key < variable_count);
   if (!impl_->data) return nullptr;
   return impl_->data[key].ptr;
 }
 
-void Storage::Impl::DoSetGeneric(Key key, DataBase& node) {
+DataBase* Storage::GetInheritedGeneric(Key key) noexcept {
   UASSERT(key < variable_count);
-  if (!data) data = std::make_unique<DataPtr[]>(variable_count);
-  data[key].ptr = &node;
+  if (!impl_->inherited) return nullptr;
+  return (*impl_->inherited)[key];
 }
 
 void Storage::SetGeneric(Key key, NormalDataBase& node,
                          bool has_existing_variable) {
-  impl_->DoSetGeneric(key, node);
+  UASSERT(key < variable_count);
+  auto& data = impl_->data;
+  if (!data) data = std::make_unique<DataPtr[]>(variable_count);
+  data[key].ptr = &node;
   if (!has_existing_variable) {
-    impl_->normal_data_storage.push_front(impl_->data[key]);
+    impl_->normal_data_storage.push_front(data[key]);
   }
 }
 
 void Storage::SetGeneric(Key key, InheritedDataBase& node,
-                         bool has_existing_variable) {
-  impl_->DoSetGeneric(key, node);
-  if (!has_existing_variable) {
-    impl_->inherited_data_storage.push_front(impl_->data[key]);
-  }
+                         bool /*has_existing_variable*/) {
+  UASSERT(node.GetKey() == key);
+  // The old node, if any, is deleted by the caller
+  impl_->GetUniqueInherited()[key] = &node;
 }
 
-void Storage::EraseInherited(Key key) noexcept {
-  UASSERT(key < variable_count);
-  if (!impl_->data) return;
-
-  auto& data_ptr = impl_->data[key];
-  auto* const data = data_ptr.ptr;
-  if (!data) return;
+void Storage::EraseInherited(Key key) {
+  if (!GetInheritedGeneric(key)) return;
 
-  data_ptr.ptr = nullptr;
-  impl_->inherited_data_storage.erase(
-      InheritedDataList::s_iterator_to(data_ptr));
+  auto& data_ptr = impl_->GetUniqueInherited()[key];
+  auto* const data = data_ptr;
+  data_ptr = nullptr;
   data->DeleteSelf();
 }
 
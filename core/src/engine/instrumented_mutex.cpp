@@ -0,0 +1,115 @@
+#include <userver/engine/instrumented_mutex.hpp>
+
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+InstrumentedMutex::InstrumentedMutex(std::string name)
+    : registration_(std::move(name), statistics_) {}
+
+InstrumentedMutex::~InstrumentedMutex() = default;
+
+void InstrumentedMutex::lock() {
+  impl::InstrumentedLock(
+      statistics_, 1, [this] { return mutex_.try_lock(); },
+      [this] {
+        mutex_.lock();
+        return true;
+      });
+}
+
+void InstrumentedMutex::unlock() {
+  statistics_.AccountReleased();
+  mutex_.unlock();
+}
+
+bool InstrumentedMutex::try_lock() noexcept {
+  if (!mutex_.try_lock()) return false;
+  statistics_.AccountAcquired();
+  return true;
+}
+
+bool InstrumentedMutex::try_lock_until(Deadline deadline) {
+  return impl::InstrumentedLock(
+      statistics_, 1, [this] { return mutex_.try_lock(); },
+      [this, deadline] { return mutex_.try_lock_until(deadline); });
+}
+
+const std::string& InstrumentedMutex::GetName() const noexcept {
+  return registration_.GetName();
+}
+
+const LockStatistics& InstrumentedMutex::GetStatistics() const noexcept {
+  return statistics_;
+}
+
+InstrumentedSharedMutex::InstrumentedSharedMutex(std::string name)
+    : registration_(std::move(name), statistics_) {}
+
+InstrumentedSharedMutex::~InstrumentedSharedMutex() = default;
+
+void InstrumentedSharedMutex::lock() {
+  impl::InstrumentedLock(
+      statistics_, 1, [this] { return mutex_.try_lock(); },
+      [this] {
+        mutex_.lock();
+        return true;
+      });
+}
+
+void InstrumentedSharedMutex::unlock() {
+  statistics_.AccountReleased();
+  mutex_.unlock();
+}
+
+bool InstrumentedSharedMutex::try_lock() {
+  if (!mutex_.try_lock()) return false;
+  statistics_.AccountAcquired();
+  return true;
+}
+
+bool InstrumentedSharedMutex::try_lock_until(Deadline deadline) {
+  return impl::InstrumentedLock(
+      statistics_, 1, [this] { return mutex_.try_lock(); },
+      [this, deadline] { return mutex_.try_lock_until(deadline); });
+}
+
+void InstrumentedSharedMutex::lock_shared() {
+  impl::InstrumentedLock(
+      statistics_, 1, [this] { return mutex_.try_lock_shared(); },
+      [this] {
+        mutex_.lock_shared();
+        return true;
+      });
+}
+
+void InstrumentedSharedMutex::unlock_shared() {
+  statistics_.AccountReleased();
+  mutex_.unlock_shared();
+}
+
+bool InstrumentedSharedMutex::try_lock_shared() {
+  if (!mutex_.try_lock_shared()) return false;
+  statistics_.AccountAcquired();
+  return true;
+}
+
+bool InstrumentedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  return impl::InstrumentedLock(
+      statistics_, 1, [this] { return mutex_.try_lock_shared(); },
+      [this, deadline] { return mutex_.try_lock_shared_until(deadline); });
+}
+
+const std::string& InstrumentedSharedMutex::GetName() const noexcept {
+  return registration_.GetName();
+}
+
+const LockStatistics& InstrumentedSharedMutex::GetStatistics() const noexcept {
+  return statistics_;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
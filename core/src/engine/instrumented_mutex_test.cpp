@@ -0,0 +1,204 @@
+#include <userver/engine/instrumented_mutex.hpp>
+
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/instrumented_semaphore.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <engine/impl/lock_statistics_registry.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class LockMetrics final {
+ public:
+  LockMetrics()
+      : holder_(storage_.RegisterWriter(
+            "engine.locks", [](utils::statistics::Writer& writer) {
+              engine::impl::WriteLockStatistics(writer);
+            })) {}
+
+  ~LockMetrics() { holder_.Unregister(); }
+
+  std::int64_t Get(const std::string& metric, const std::string& lock) const {
+    const utils::statistics::Snapshot snapshot{storage_};
+    const auto value =
+        snapshot.SingleMetric("engine.locks." + metric, {{"lock", lock}});
+    if (value.IsRate()) return value.AsRate().value;
+    return value.AsInt();
+  }
+
+  std::uint64_t GetWaitsCount(const std::string& lock) const {
+    const utils::statistics::Snapshot snapshot{storage_};
+    const auto histogram =
+        snapshot.SingleMetric("engine.locks.wait-time-us", {{"lock", lock}})
+            .AsHistogram();
+    std::uint64_t count = histogram.GetValueAtInf();
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      count += histogram.GetValueAt(i);
+    }
+    return count;
+  }
+
+ private:
+  utils::statistics::Storage storage_;
+  utils::statistics::Entry holder_;
+};
+
+}  // namespace
+
+/// [Sample engine::InstrumentedMutex usage]
+class UsersCache final {
+ public:
+  void Set(std::string user) {
+    const std::lock_guard lock{mutex_};
+    user_ = std::move(user);
+  }
+
+  std::string Get() const {
+    const std::lock_guard lock{mutex_};
+    return user_;
+  }
+
+ private:
+  // Reported as `engine.locks.*` metrics with the `lock=users-cache` label
+  mutable engine::InstrumentedMutex mutex_{"users-cache"};
+  std::string user_;
+};
+/// [Sample engine::InstrumentedMutex usage]
+
+UTEST(InstrumentedMutex, Sample) {
+  UsersCache cache;
+  cache.Set("john");
+  EXPECT_EQ(cache.Get(), "john");
+}
+
+UTEST(InstrumentedMutex, Uncontended) {
+  const LockMetrics metrics;
+  engine::InstrumentedMutex mutex{"test-uncontended"};
+  EXPECT_EQ(mutex.GetName(), "test-uncontended");
+
+  {
+    const std::lock_guard lock{mutex};
+    EXPECT_EQ(metrics.Get("holders", "test-uncontended"), 1);
+    EXPECT_FALSE(mutex.try_lock());
+  }
+  ASSERT_TRUE(mutex.try_lock());
+  mutex.unlock();
+
+  EXPECT_EQ(metrics.Get("acquisitions", "test-uncontended"), 2);
+  EXPECT_EQ(metrics.Get("contended-acquisitions", "test-uncontended"), 0);
+  EXPECT_EQ(metrics.Get("failed-acquisitions", "test-uncontended"), 0);
+  EXPECT_EQ(metrics.Get("holders", "test-uncontended"), 0);
+  EXPECT_EQ(metrics.Get("max-holders", "test-uncontended"), 1);
+  EXPECT_EQ(metrics.GetWaitsCount("test-uncontended"), 0);
+}
+
+UTEST_MT(InstrumentedMutex, Contended, 2) {
+  const LockMetrics metrics;
+  engine::InstrumentedMutex mutex{"test-contended"};
+
+  std::unique_lock lock{mutex};
+  auto task =
+      engine::AsyncNoSpan([&mutex] { const std::lock_guard guard{mutex}; });
+  engine::SleepFor(10ms);
+  lock.unlock();
+  task.Get();
+
+  EXPECT_EQ(metrics.Get("acquisitions", "test-contended"), 2);
+  EXPECT_EQ(metrics.Get("contended-acquisitions", "test-contended"), 1);
+  EXPECT_EQ(metrics.Get("failed-acquisitions", "test-contended"), 0);
+  EXPECT_EQ(metrics.Get("holders", "test-contended"), 0);
+  EXPECT_EQ(metrics.GetWaitsCount("test-contended"), 1);
+}
+
+UTEST(InstrumentedMutex, Failed) {
+  const LockMetrics metrics;
+  engine::InstrumentedMutex mutex{"test-failed"};
+
+  const std::lock_guard lock{mutex};
+  auto task =
+      engine::AsyncNoSpan([&mutex] { return mutex.try_lock_for(1ms); });
+  EXPECT_FALSE(task.Get());
+
+  EXPECT_EQ(metrics.Get("acquisitions", "test-failed"), 1);
+  EXPECT_EQ(metrics.Get("failed-acquisitions", "test-failed"), 1);
+  EXPECT_EQ(metrics.GetWaitsCount("test-failed"), 1);
+}
+
+UTEST(InstrumentedMutex, SameName) {
+  const LockMetrics metrics;
+  std::optional<engine::InstrumentedMutex> mutex1{"test-shards"};
+  engine::InstrumentedMutex mutex2{"test-shards"};
+
+  ASSERT_TRUE(mutex1->try_lock());
+  ASSERT_TRUE(mutex2.try_lock());
+  EXPECT_EQ(metrics.Get("acquisitions", "test-shards"), 2);
+  EXPECT_EQ(metrics.Get("holders", "test-shards"), 2);
+  EXPECT_EQ(metrics.Get("max-holders", "test-shards"), 1);
+
+  mutex1->unlock();
+  mutex1.reset();
+  EXPECT_EQ(metrics.Get("acquisitions", "test-shards"), 1);
+  mutex2.unlock();
+}
+
+UTEST(InstrumentedSharedMutex, Holders) {
+  const LockMetrics metrics;
+  engine::InstrumentedSharedMutex mutex{"test-shared"};
+
+  {
+    const std::shared_lock lock1{mutex};
+    const std::shared_lock lock2{mutex};
+    EXPECT_EQ(metrics.Get("holders", "test-shared"), 2);
+    EXPECT_FALSE(mutex.try_lock());
+  }
+  {
+    const std::lock_guard lock{mutex};
+    EXPECT_FALSE(mutex.try_lock_shared());
+  }
+
+  EXPECT_EQ(metrics.Get("acquisitions", "test-shared"), 3);
+  EXPECT_EQ(metrics.Get("holders", "test-shared"), 0);
+  EXPECT_EQ(metrics.Get("max-holders", "test-shared"), 2);
+}
+
+UTEST(InstrumentedSemaphore, Holders) {
+  const LockMetrics metrics;
+  engine::InstrumentedSemaphore semaphore{"test-semaphore", 3};
+  EXPECT_EQ(semaphore.GetCapacity(), 3);
+
+  semaphore.lock_shared_count(2);
+  {
+    const std::shared_lock lock{semaphore};
+    EXPECT_EQ(metrics.Get("holders", "test-semaphore"), 3);
+    EXPECT_FALSE(semaphore.try_lock_shared_until(engine::Deadline::Passed()));
+  }
+  semaphore.unlock_shared_count(2);
+
+  EXPECT_EQ(metrics.Get("acquisitions", "test-semaphore"), 2);
+  EXPECT_EQ(metrics.Get("failed-acquisitions", "test-semaphore"), 1);
+  EXPECT_EQ(metrics.Get("holders", "test-semaphore"), 0);
+  EXPECT_EQ(metrics.Get("max-holders", "test-semaphore"), 3);
+}
+
+UTEST(InstrumentedSemaphore, Unreachable) {
+  const LockMetrics metrics;
+  engine::InstrumentedSemaphore semaphore{"test-unreachable", 0};
+
+  EXPECT_THROW(semaphore.lock_shared(), engine::UnreachableSemaphoreLockError);
+  EXPECT_EQ(metrics.Get("acquisitions", "test-unreachable"), 0);
+  EXPECT_EQ(metrics.Get("failed-acquisitions", "test-unreachable"), 1);
+}
+
+USERVER_NAMESPACE_END
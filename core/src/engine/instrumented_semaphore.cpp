@@ -0,0 +1,85 @@
+#include <userver/engine/instrumented_semaphore.hpp>
+
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+InstrumentedSemaphore::InstrumentedSemaphore(std::string name,
+                                             Counter capacity)
+    : semaphore_(capacity), registration_(std::move(name), statistics_) {}
+
+InstrumentedSemaphore::~InstrumentedSemaphore() = default;
+
+void InstrumentedSemaphore::SetCapacity(Counter capacity) {
+  semaphore_.SetCapacity(capacity);
+}
+
+InstrumentedSemaphore::Counter InstrumentedSemaphore::GetCapacity()
+    const noexcept {
+  return semaphore_.GetCapacity();
+}
+
+std::size_t InstrumentedSemaphore::RemainingApprox() const {
+  return semaphore_.RemainingApprox();
+}
+
+std::size_t InstrumentedSemaphore::UsedApprox() const {
+  return semaphore_.UsedApprox();
+}
+
+void InstrumentedSemaphore::lock_shared() { lock_shared_count(1); }
+
+void InstrumentedSemaphore::unlock_shared() { unlock_shared_count(1); }
+
+bool InstrumentedSemaphore::try_lock_shared() {
+  return try_lock_shared_count(1);
+}
+
+bool InstrumentedSemaphore::try_lock_shared_until(Deadline deadline) {
+  return try_lock_shared_until_count(deadline, 1);
+}
+
+void InstrumentedSemaphore::lock_shared_count(Counter count) {
+  impl::InstrumentedLock(
+      statistics_, count,
+      [this, count] { return semaphore_.try_lock_shared_count(count); },
+      [this, count] {
+        semaphore_.lock_shared_count(count);
+        return true;
+      });
+}
+
+void InstrumentedSemaphore::unlock_shared_count(Counter count) {
+  statistics_.AccountReleased(count);
+  semaphore_.unlock_shared_count(count);
+}
+
+bool InstrumentedSemaphore::try_lock_shared_count(Counter count) {
+  if (!semaphore_.try_lock_shared_count(count)) return false;
+  statistics_.AccountAcquired(count);
+  return true;
+}
+
+bool InstrumentedSemaphore::try_lock_shared_until_count(Deadline deadline,
+                                                        Counter count) {
+  return impl::InstrumentedLock(
+      statistics_, count,
+      [this, count] { return semaphore_.try_lock_shared_count(count); },
+      [this, deadline, count] {
+        return semaphore_.try_lock_shared_until_count(deadline, count);
+      });
+}
+
+const std::string& InstrumentedSemaphore::GetName() const noexcept {
+  return registration_.GetName();
+}
+
+const LockStatistics& InstrumentedSemaphore::GetStatistics() const noexcept {
+  return statistics_;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
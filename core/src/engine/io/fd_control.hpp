@@ -1,6 +1,7 @@
 #pragma once
 
 #include <sys/uio.h>
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 
@@ -86,6 +87,14 @@ class Direction final {
                     TransferMode mode, Deadline deadline,
                     const Context&... context);
 
+  // (IoFunc*)(int, Message*, unsigned), e.g. recvmmsg; returns the count of
+  // the processed messages
+  template <typename IoFunc, typename Message, typename... Context>
+  size_t PerformIoMessages(SingleUserGuard& guard, IoFunc&& io_func,
+                           Message* messages, std::size_t count,
+                           TransferMode mode, Deadline deadline,
+                           const Context&... context);
+
  private:
   friend class FdControl;
   explicit Direction(Kind kind);
@@ -224,6 +233,33 @@ size_t Direction::PerformIoV(SingleUserGuard&, IoFunc&& io_func,
   return processed_bytes;
 }
 
+template <typename IoFunc, typename Message, typename... Context>
+size_t Direction::PerformIoMessages(SingleUserGuard&, IoFunc&& io_func,
+                                    Message* messages, std::size_t count,
+                                    TransferMode mode, Deadline deadline,
+                                    const Context&... context) {
+  // The kernel silently truncates the batches to UIO_MAXIOV messages
+  constexpr std::size_t kMaxBatchSize = 1024;
+
+  std::size_t processed = 0;
+  while (processed < count) {
+    const auto batch_size = std::min(count - processed, kMaxBatchSize);
+    const auto ret = io_func(Fd(), messages + processed,
+                             static_cast<unsigned>(batch_size));
+
+    if (ret > 0) {
+      processed += ret;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+    } else if (!ret || TryHandleError(errno, processed, mode, deadline,
+                                      context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return processed;
+}
+
 template <typename IoFunc, typename... Context>
 size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
                             size_t len, TransferMode mode, Deadline deadline,
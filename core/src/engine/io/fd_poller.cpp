@@ -1,8 +1,15 @@
 #include <userver/engine/io/fd_poller.hpp>
 
+#include <poll.h>
+
+#include <cerrno>
+
+#include <engine/ev/io_uring.hpp>
 #include <engine/ev/watcher.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
 
 template <>
 struct fmt::formatter<USERVER_NAMESPACE::engine::io::FdPoller::State> {
@@ -33,6 +40,11 @@ namespace engine::io {
 
 namespace {
 
+// How long to wait for the completion of an io_uring poll that should have
+// completed already before removing it, and how often to retry passing the
+// removal to the kernel
+constexpr std::chrono::milliseconds kIoUringRemoveRetryInterval{1};
+
 int GetEvMode(FdPoller::Kind kind) {
   switch (kind) {
     case FdPoller::Kind::kRead:
@@ -64,6 +76,25 @@ FdPoller::Kind GetUserMode(int ev_events) {
   UINVARIANT(false, "Failed to recognize events that happened on the socket.");
 }
 
+std::uint32_t GetPollMask(FdPoller::Kind kind) {
+  const auto ev_mode = GetEvMode(kind);
+  std::uint32_t result = 0;
+  if (ev_mode & EV_READ) result |= POLLIN;
+  if (ev_mode & EV_WRITE) result |= POLLOUT;
+  return result;
+}
+
+FdPoller::Kind GetUserModeFromPollEvents(int poll_events,
+                                         FdPoller::Kind requested) {
+  // Errors and hangups wake up both directions, just like with epoll
+  constexpr int kAnyDirection = POLLERR | POLLHUP;
+  int ev_events = 0;
+  if (poll_events & (POLLIN | POLLPRI | kAnyDirection)) ev_events |= EV_READ;
+  if (poll_events & (POLLOUT | kAnyDirection)) ev_events |= EV_WRITE;
+  ev_events &= GetEvMode(requested);
+  return ev_events ? GetUserMode(ev_events) : requested;
+}
+
 }  // namespace
 
 namespace impl {
@@ -97,12 +128,15 @@ class DirectionWaitStrategy final : public engine::impl::WaitStrategy {
 
 }  // namespace impl
 
-struct FdPoller::Impl {
+struct FdPoller::Impl final : public ev::IoUringCompletionHandler {
+  class IoUringWaitStrategy;
+
   Impl();
 
   ~Impl();
 
   engine::impl::TaskContext::WakeupSource DoWait(Deadline deadline);
+  engine::impl::TaskContext::WakeupSource DoWaitIoUring(Deadline deadline);
 
   bool IsValid() const noexcept;
 
@@ -114,16 +148,55 @@ struct FdPoller::Impl {
   static void IoWatcherCb(struct ev_loop*, ev_io*, int) noexcept;
   void WakeupWaiters();
 
+  void OnIoUringCompletion(ev::IoUringOperation operation,
+                           int result) noexcept override;
+
   int fd_{-1};
+  Kind kind_{Kind::kRead};
   std::atomic<FdPoller::State> state_{FdPoller::State::kInvalid};
   engine::impl::FastPimplWaitListLight waiters_;
   ev::Watcher<ev_io> watcher_;
   std::atomic<FdPoller::Kind> events_that_happened_{};
+  ev::IoUring* const io_uring_;
+  // The number of the submitted io_uring operations that reference `this`
+  // and have not completed yet
+  std::atomic<int> pending_io_uring_ops_{0};
+  engine::SingleConsumerEvent io_uring_op_completed_;
+};
+
+class FdPoller::Impl::IoUringWaitStrategy final
+    : public engine::impl::WaitStrategy {
+ public:
+  IoUringWaitStrategy(Deadline deadline, Impl& poller,
+                      engine::impl::TaskContext& current)
+      : WaitStrategy(deadline), poller_(poller), current_(current) {}
+
+  void SetupWakeups() override {
+    poller_.waiters_->Append(&current_);
+    poller_.pending_io_uring_ops_.fetch_add(1, std::memory_order_relaxed);
+    if (!poller_.io_uring_->SubmitPollAdd(
+            poller_.fd_, GetPollMask(poller_.kind_), poller_)) {
+      // The submission queue is full, so let libev do the job this time
+      poller_.pending_io_uring_ops_.fetch_sub(1, std::memory_order_relaxed);
+      poller_.watcher_.StartAsync();
+    }
+  }
+
+  void DisableWakeups() override {
+    poller_.waiters_->Remove(current_);
+    poller_.watcher_.StopAsync();
+  }
+
+ private:
+  Impl& poller_;
+  engine::impl::TaskContext& current_;
 };
 
 void FdPoller::Impl::WakeupWaiters() { waiters_->WakeupOne(); }
 
-FdPoller::Impl::Impl() : watcher_(current_task::GetEventThread(), this) {
+FdPoller::Impl::Impl()
+    : watcher_(current_task::GetEventThread(), this),
+      io_uring_(current_task::GetEventThread().GetIoUring()) {
   watcher_.Init(&IoWatcherCb);
 }
 
@@ -132,6 +205,7 @@ FdPoller::Impl::~Impl() = default;
 engine::impl::TaskContext::WakeupSource FdPoller::Impl::DoWait(
     Deadline deadline) {
   UASSERT(IsValid());
+  if (io_uring_) return DoWaitIoUring(deadline);
 
   auto& current = current_task::GetCurrentTaskContext();
 
@@ -147,6 +221,59 @@ engine::impl::TaskContext::WakeupSource FdPoller::Impl::DoWait(
   return ret;
 }
 
+engine::impl::TaskContext::WakeupSource FdPoller::Impl::DoWaitIoUring(
+    Deadline deadline) {
+  auto& current = current_task::GetCurrentTaskContext();
+
+  IoUringWaitStrategy wait_manager(deadline, *this, current);
+  auto ret = current.Sleep(wait_manager);
+
+  // The kernel must stop referencing `this` before we return. If we were
+  // woken up by the poll, its completion handler is finishing on the ev
+  // thread. Otherwise, e.g. on a timeout or a cancellation, the poll is
+  // removed and we wait for the completions of both the poll and the removal.
+  const engine::TaskCancellationBlocker cancellation_blocker;
+  bool should_remove =
+      ret != engine::impl::TaskContext::WakeupSource::kWaitList;
+  bool is_remove_submitted = false;
+  while (pending_io_uring_ops_.load(std::memory_order_acquire) != 0) {
+    if (is_remove_submitted) {
+      io_uring_->FlushSubmissions();
+    } else if (should_remove) {
+      pending_io_uring_ops_.fetch_add(1, std::memory_order_relaxed);
+      is_remove_submitted = io_uring_->SubmitPollRemove(*this);
+      if (!is_remove_submitted) {
+        pending_io_uring_ops_.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+
+    if (!io_uring_op_completed_.WaitForEventFor(kIoUringRemoveRetryInterval)) {
+      // The wakeup came from someone else, e.g. FdControl::Invalidate
+      should_remove = true;
+    }
+  }
+  // The libev fallback might have been used
+  watcher_.Stop();
+  return ret;
+}
+
+void FdPoller::Impl::OnIoUringCompletion(ev::IoUringOperation operation,
+                                         int result) noexcept {
+  if (operation == ev::IoUringOperation::kPollAdd) {
+    // Wake up on any result, including -ECANCELED: the waiter has already left
+    // if it is the one that has removed the poll, and for others the wakeup is
+    // at most spurious. On errors, e.g. EBADF, the following syscall will
+    // report the error.
+    events_that_happened_.store(
+        result >= 0 ? GetUserModeFromPollEvents(result, kind_) : kind_,
+        std::memory_order_relaxed);
+    WakeupWaiters();
+  }
+  io_uring_op_completed_.Send();
+  // Must be the last access to `this`
+  pending_io_uring_ops_.fetch_sub(1, std::memory_order_release);
+}
+
 void FdPoller::Impl::Invalidate() {
   StopWatcher();
 
@@ -241,6 +368,7 @@ void FdPoller::Impl::Reset(int fd, Kind kind) {
   UASSERT(!IsValid());
   UASSERT(fd_ == fd || fd_ == -1);
   fd_ = fd;
+  kind_ = kind;
   watcher_.Set(fd_, GetEvMode(kind));
   state_ = State::kReadyToUse;
 }
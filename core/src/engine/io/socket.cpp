@@ -5,6 +5,8 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -106,6 +108,90 @@ class SendToWrapper {
   const Sockaddr& dest_addr_;
 };
 
+#if defined(HAVE_RECVMMSG) || defined(HAVE_SENDMMSG)
+using MessageHeader = struct ::mmsghdr;
+#else
+struct MessageHeader {
+  struct ::msghdr msg_hdr;
+  unsigned int msg_len;
+};
+#endif
+
+[[nodiscard]] int RecvMessagesWrapper(int fd, MessageHeader* messages,
+                                      unsigned count) {
+#ifdef HAVE_RECVMMSG
+  return ::recvmmsg(fd, messages, count, 0, nullptr);
+#else
+  // MAC_COMPAT: no recvmmsg, a datagram per call
+  UASSERT(count > 0);
+  const auto ret = ::recvmsg(fd, &messages->msg_hdr, 0);
+  if (ret == -1) return -1;
+  messages->msg_len = ret;
+  return 1;
+#endif
+}
+
+[[nodiscard]] int SendMessagesWrapper(int fd, MessageHeader* messages,
+                                      unsigned count) {
+  constexpr int kFlags =
+// MAC_COMPAT: does not support MSG_NOSIGNAL
+#ifdef MSG_NOSIGNAL
+      MSG_NOSIGNAL |
+#endif
+      0;
+#ifdef HAVE_SENDMMSG
+  return ::sendmmsg(fd, messages, count, kFlags);
+#else
+  // MAC_COMPAT: no sendmmsg, a datagram per call
+  UASSERT(count > 0);
+  const auto ret = ::sendmsg(fd, &messages->msg_hdr, kFlags);
+  if (ret == -1) return -1;
+  messages->msg_len = ret;
+  return 1;
+#endif
+}
+
+enum class DatagramsDirection { kRecv, kSend };
+
+void FillMessages(Socket::Datagram* datagrams, std::size_t count,
+                  DatagramsDirection direction, MessageHeader* messages,
+                  struct ::iovec* iovecs) {
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& datagram = datagrams[i];
+    iovecs[i].iov_base = datagram.data;
+    iovecs[i].iov_len = datagram.len;
+
+    auto& header = messages[i].msg_hdr;
+    header = {};
+    header.msg_iov = &iovecs[i];
+    header.msg_iovlen = 1;
+    if (direction == DatagramsDirection::kRecv) {
+      header.msg_name = datagram.addr.Data();
+      header.msg_namelen = datagram.addr.Capacity();
+    } else if (datagram.addr.Domain() != AddrDomain::kUnspecified) {
+      header.msg_name = datagram.addr.Data();
+      header.msg_namelen = datagram.addr.Size();
+    }
+    messages[i].msg_len = 0;
+  }
+}
+
+// Calls `func(messages, iovecs)` with the arrays of `count` elements
+template <typename Func>
+std::size_t WithMessages(std::size_t count, Func&& func) {
+  if (count <= kMaxStackSizeVector) {
+    /// stack
+    std::array<MessageHeader, kMaxStackSizeVector> messages{};
+    std::array<struct ::iovec, kMaxStackSizeVector> iovecs{};
+    return func(messages.data(), iovecs.data());
+  } else {
+    /// heap
+    std::vector<MessageHeader> messages(count);
+    std::vector<struct ::iovec> iovecs(count);
+    return func(messages.data(), iovecs.data());
+  }
+}
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
   UASSERT(data);
   UASSERT(count > 0);
@@ -319,6 +405,68 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
                        "SendAllTo to ", dest_addr);
 }
 
+size_t Socket::RecvSomeDatagrams(Datagram* datagrams, size_t count,
+                                 Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to RecvSomeDatagrams via closed socket");
+  }
+  if (!count) return 0;
+  UASSERT(datagrams);
+
+  return WithMessages(count, [&](MessageHeader* messages,
+                                 struct ::iovec* iovecs) {
+    FillMessages(datagrams, count, DatagramsDirection::kRecv, messages,
+                 iovecs);
+
+    auto& dir = fd_control_->Read();
+    impl::Direction::SingleUserGuard guard(dir);
+    const auto received = dir.PerformIoMessages(
+        guard, &RecvMessagesWrapper, messages, count,
+        impl::TransferMode::kOnce, deadline, "RecvSomeDatagrams");
+
+    for (std::size_t i = 0; i < received; ++i) {
+      datagrams[i].bytes_transferred =
+          std::min<std::size_t>(messages[i].msg_len, datagrams[i].len);
+    }
+    return received;
+  });
+}
+
+size_t Socket::SendAllDatagrams(Datagram* datagrams, size_t count,
+                                Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to SendAllDatagrams via closed socket");
+  }
+  if (!count) return 0;
+  UASSERT(datagrams);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto domain = datagrams[i].addr.Domain();
+    if (domain != AddrDomain::kUnspecified && domain != domain_) {
+      throw AddrException(fmt::format(
+          "Socket address domain ({}) does not match address domain ({})",
+          static_cast<int>(domain_), static_cast<int>(domain)));
+    }
+  }
+
+  return WithMessages(count, [&](MessageHeader* messages,
+                                 struct ::iovec* iovecs) {
+    FillMessages(datagrams, count, DatagramsDirection::kSend, messages,
+                 iovecs);
+
+    auto& dir = fd_control_->Write();
+    impl::Direction::SingleUserGuard guard(dir);
+    const auto sent = dir.PerformIoMessages(
+        guard, &SendMessagesWrapper, messages, count,
+        impl::TransferMode::kWhole, deadline, "SendAllDatagrams");
+
+    for (std::size_t i = 0; i < sent; ++i) {
+      datagrams[i].bytes_transferred = messages[i].msg_len;
+    }
+    return sent;
+  });
+}
+
 Socket Socket::Accept(Deadline deadline) {
   if (!IsValid()) {
     throw IoException("Attempt to Accept from closed socket");
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <string>
 
@@ -138,4 +139,89 @@ BENCHMARK(socket_send_all_v);
 // TODO(TAXICOMMON-5510) flaky, sometimes throws engine::io::IoTimeout
 // BENCHMARK(socket_send_all_range)->RangeMultiplier(10)->Range(10, 10000);
 
+namespace {
+
+constexpr std::size_t kDatagramSize = 64;
+constexpr std::size_t kDatagramsBatch = 32;
+
+}  // namespace
+
+// Sends kDatagramsBatch datagrams per iteration one by one and receives them
+// in a separate task
+void socket_udp_send_to(benchmark::State& state) {
+  engine::RunStandalone(2, [&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    std::atomic<bool> reading{true};
+    auto task_reader = engine::AsyncNoSpan([&] {
+      std::array<char, kDatagramSize> buf = {};
+      while (reading) {
+        [[maybe_unused]] const auto ret = listener.socket.RecvSomeFrom(
+            buf.data(), buf.size(), test_deadline);
+      }
+    });
+
+    const std::string datagram(kDatagramSize, 'a');
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < kDatagramsBatch; ++i) {
+        const auto sent = client.SendAllTo(listener.addr, datagram.data(),
+                                           datagram.size(), test_deadline);
+        benchmark::DoNotOptimize(sent);
+      }
+    }
+    reading = false;
+    // wake up the reader
+    [[maybe_unused]] const auto sent =
+        client.SendAllTo(listener.addr, "", 0, test_deadline);
+    task_reader.Get();
+    state.SetItemsProcessed(state.iterations() * kDatagramsBatch);
+  });
+}
+BENCHMARK(socket_udp_send_to);
+
+// Same as socket_udp_send_to with the batched send and receive
+void socket_udp_send_datagrams(benchmark::State& state) {
+  engine::RunStandalone(2, [&]() {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    std::atomic<bool> reading{true};
+    auto task_reader = engine::AsyncNoSpan([&] {
+      std::array<std::array<char, kDatagramSize>, kDatagramsBatch> buffers{};
+      std::array<engine::io::Socket::Datagram, kDatagramsBatch> datagrams{};
+      for (std::size_t i = 0; i < kDatagramsBatch; ++i) {
+        datagrams[i].data = buffers[i].data();
+        datagrams[i].len = buffers[i].size();
+      }
+      while (reading) {
+        [[maybe_unused]] const auto ret = listener.socket.RecvSomeDatagrams(
+            datagrams.data(), datagrams.size(), test_deadline);
+      }
+    });
+
+    std::string buffer(kDatagramSize, 'a');
+    std::array<engine::io::Socket::Datagram, kDatagramsBatch> datagrams{};
+    for (auto& datagram : datagrams) {
+      datagram.data = buffer.data();
+      datagram.len = buffer.size();
+      datagram.addr = listener.addr;
+    }
+    for ([[maybe_unused]] auto _ : state) {
+      const auto sent = client.SendAllDatagrams(
+          datagrams.data(), datagrams.size(), test_deadline);
+      benchmark::DoNotOptimize(sent);
+    }
+    reading = false;
+    // wake up the reader
+    [[maybe_unused]] const auto sent =
+        client.SendAllTo(listener.addr, "", 0, test_deadline);
+    task_reader.Get();
+    state.SetItemsProcessed(state.iterations() * kDatagramsBatch);
+  });
+}
+BENCHMARK(socket_udp_send_datagrams);
+
 USERVER_NAMESPACE_END
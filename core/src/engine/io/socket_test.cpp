@@ -418,6 +418,78 @@ UTEST_MT(Socket, ConcurrentReadWriteUdp, 2) {
   /// [send self concurrent]
 }
 
+UTEST(Socket, DgramBatched) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  UdpListener listener;
+  engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+  client.Connect(listener.addr, test_deadline);
+
+  /// [batched datagrams]
+  constexpr std::size_t kCount = 50;
+  std::array<std::array<char, 8>, kCount> buffers{};
+  std::array<io::Socket::Datagram, kCount> datagrams{};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    buffers[i].fill(static_cast<char>('a' + i % 26));
+    // Sent to the connected peer, as the address is not set
+    datagrams[i].data = buffers[i].data();
+    datagrams[i].len = 1 + i % buffers[i].size();
+  }
+  EXPECT_EQ(kCount, client.SendAllDatagrams(datagrams.data(), datagrams.size(),
+                                            test_deadline));
+
+  std::array<std::array<char, 8>, kCount> recv_buffers{};
+  std::array<io::Socket::Datagram, kCount> received{};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    received[i].data = recv_buffers[i].data();
+    received[i].len = recv_buffers[i].size();
+  }
+
+  std::size_t received_count = 0;
+  while (received_count < kCount) {
+    received_count += listener.socket.RecvSomeDatagrams(
+        received.data() + received_count, kCount - received_count,
+        test_deadline);
+  }
+  /// [batched datagrams]
+
+  for (std::size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(received[i].bytes_transferred, datagrams[i].len);
+    EXPECT_EQ(std::string_view(recv_buffers[i].data(), datagrams[i].len),
+              std::string_view(buffers[i].data(), datagrams[i].len));
+    EXPECT_EQ(client.Getsockname().Port(), received[i].addr.Port());
+  }
+
+  // Replies are sent to the source addresses
+  for (auto& datagram : received) datagram.len = datagram.bytes_transferred;
+  EXPECT_EQ(kCount, listener.socket.SendAllDatagrams(
+                        received.data(), received.size(), test_deadline));
+
+  std::array<char, 8> reply{};
+  for (std::size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(datagrams[i].len,
+              client.RecvSome(reply.data(), reply.size(), test_deadline));
+  }
+}
+
+UTEST(Socket, DgramBatchedTruncated) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  UdpListener listener;
+  engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+  EXPECT_EQ(5, client.SendAllTo(listener.addr, "hello", 5, test_deadline));
+
+  std::array<char, 2> buffer{};
+  io::Socket::Datagram datagram;
+  datagram.data = buffer.data();
+  datagram.len = buffer.size();
+  ASSERT_EQ(1, listener.socket.RecvSomeDatagrams(&datagram, 1, test_deadline));
+  EXPECT_EQ(datagram.bytes_transferred, 2);
+  EXPECT_EQ(std::string_view(buffer.data(), buffer.size()), "he");
+
+  EXPECT_EQ(0, listener.socket.RecvSomeDatagrams(&datagram, 0, test_deadline));
+}
+
 UTEST(Socket, WriteALot) {
   const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
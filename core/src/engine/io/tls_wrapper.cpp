@@ -1,7 +1,11 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
+#include <atomic>
 #include <exception>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
@@ -194,6 +198,36 @@ int SSL_write_ex(SSL* ssl, const void* data, size_t len,
 }
 #endif
 
+// Protocols are encoded as length-prefixed strings, see RFC 7301
+std::string MakeAlpnProtocolList(const std::vector<std::string>& protocols) {
+  std::string result;
+  for (const auto& protocol : protocols) {
+    if (protocol.empty() || protocol.size() > 255) {
+      throw TlsException(
+          fmt::format("Invalid ALPN protocol name '{}'", protocol));
+    }
+    result.push_back(static_cast<char>(protocol.size()));
+    result += protocol;
+  }
+  return result;
+}
+
+int SelectAlpnProtocol(SSL*, const unsigned char** out, unsigned char* outlen,
+                       const unsigned char* in, unsigned int inlen,
+                       void* arg) noexcept {
+  const auto& server_protocols = *static_cast<const std::string*>(arg);
+  unsigned char* selected = nullptr;
+  if (OPENSSL_NPN_NEGOTIATED !=
+      SSL_select_next_proto(
+          &selected, outlen,
+          reinterpret_cast<const unsigned char*>(server_protocols.data()),
+          server_protocols.size(), in, inlen)) {
+    return SSL_TLSEXT_ERR_NOACK;
+  }
+  *out = selected;
+  return SSL_TLSEXT_ERR_OK;
+}
+
 SslCtx MakeSslCtx() {
   crypto::impl::Openssl::Init();
 
@@ -232,6 +266,96 @@ enum InterruptAction {
 
 }  // namespace
 
+class TlsServerContext::Impl {
+ public:
+  Impl(const crypto::Certificate& cert, const crypto::PrivateKey& key,
+       const Options& options)
+      : ssl_ctx(MakeSslCtx()),
+        alpn_protocol_list(MakeAlpnProtocolList(options.alpn_protocols)) {
+    // Renegotiation is disabled, so the list is only used by SSL_accept
+    if (!alpn_protocol_list.empty()) {
+      SSL_CTX_set_alpn_select_cb(ssl_ctx.get(), &SelectAlpnProtocol,
+                                 &alpn_protocol_list);
+    }
+
+    if (!options.cert_authorities.empty()) {
+      auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
+      for (const auto& ca : options.cert_authorities) {
+        if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
+          throw TlsException(crypto::FormatSslError(
+              "Failed to set up server TLS context: X509_STORE_add_cert"));
+        }
+      }
+    }
+
+    if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS context: SSL_CTX_use_certificate"));
+    }
+
+    if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS context: SSL_CTX_use_PrivateKey"));
+    }
+
+    SetUpSessionResumption(options);
+  }
+
+  SslCtx ssl_ctx;
+  std::string alpn_protocol_list;
+
+  std::atomic<std::uint64_t> full_handshakes{0};
+  std::atomic<std::uint64_t> resumed_handshakes{0};
+  std::atomic<std::uint64_t> failed_handshakes{0};
+
+ private:
+  void SetUpSessionResumption(const Options& options) {
+    static constexpr std::string_view kSessionIdContext = "userver";
+    if (1 != SSL_CTX_set_session_id_context(
+                 ssl_ctx.get(),
+                 reinterpret_cast<const unsigned char*>(
+                     kSessionIdContext.data()),
+                 kSessionIdContext.size())) {
+      throw TlsException(crypto::FormatSslError(
+          "Failed to set up server TLS context: "
+          "SSL_CTX_set_session_id_context"));
+    }
+
+    if (options.session_cache_size == 0) {
+      SSL_CTX_set_session_cache_mode(ssl_ctx.get(), SSL_SESS_CACHE_OFF);
+    } else {
+      SSL_CTX_set_session_cache_mode(ssl_ctx.get(), SSL_SESS_CACHE_SERVER);
+      SSL_CTX_sess_set_cache_size(ssl_ctx.get(), options.session_cache_size);
+    }
+    SSL_CTX_set_timeout(ssl_ctx.get(), options.session_timeout.count());
+
+    if (!options.session_tickets) {
+      SSL_CTX_set_options(ssl_ctx.get(), SSL_OP_NO_TICKET);
+#if OPENSSL_VERSION_NUMBER >= 0x010101000L
+      // Otherwise TLSv1.3 still issues tickets for the stateful resumption
+      if (options.session_cache_size == 0) {
+        SSL_CTX_set_num_tickets(ssl_ctx.get(), 0);
+      }
+#endif
+    }
+  }
+};
+
+TlsServerContext::TlsServerContext(const crypto::Certificate& cert,
+                                   const crypto::PrivateKey& key,
+                                   const Options& options)
+    : impl_(std::make_unique<Impl>(cert, key, options)) {}
+
+TlsServerContext::~TlsServerContext() = default;
+
+TlsServerContext::Stats TlsServerContext::GetStats() const {
+  Stats stats;
+  stats.full_handshakes = impl_->full_handshakes.load();
+  stats.resumed_handshakes = impl_->resumed_handshakes.load();
+  stats.failed_handshakes = impl_->failed_handshakes.load();
+  return stats;
+}
+
 class TlsWrapper::Impl {
  public:
   explicit Impl(Socket&& socket) : bio_data(std::move(socket)) {}
@@ -244,7 +368,7 @@ class TlsWrapper::Impl {
     SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
+  void SetUp(SSL_CTX* ssl_ctx) {
     Bio socket_bio{BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
@@ -254,7 +378,7 @@ class TlsWrapper::Impl {
     SyncBioData(socket_bio.get(), nullptr);
     BIO_set_init(socket_bio.get(), 1);
 
-    ssl.reset(SSL_new(ssl_ctx.get()));
+    ssl.reset(SSL_new(ssl_ctx));
     if (!ssl) {
       throw TlsException(
           crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
@@ -367,7 +491,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(ssl_ctx.get());
   if (!server_name.empty()) {
     // cast in openssl1.0 macro expansion
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
@@ -396,35 +520,31 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
 TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
-    const std::vector<crypto::Certificate>& cert_authorities) {
-  auto ssl_ctx = MakeSslCtx();
-
-  if (!cert_authorities.empty()) {
-    auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
-    for (const auto& ca : cert_authorities) {
-      if (1 != X509_STORE_add_cert(store, ca.GetNative())) {
-        throw TlsException(crypto::FormatSslError(
-            "Failed to set up server TLS wrapper: X509_STORE_add_cert"));
-      }
-    }
-  }
-
-  if (1 != SSL_CTX_use_certificate(ssl_ctx.get(), cert.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_certificate"));
-  }
+    const std::vector<crypto::Certificate>& cert_authorities,
+    const std::vector<std::string>& alpn_protocols) {
+  TlsServerContext::Options options;
+  options.cert_authorities = cert_authorities;
+  options.alpn_protocols = alpn_protocols;
+  // The context is not reused, so there is nothing to resume sessions from
+  options.session_cache_size = 0;
+  options.session_tickets = false;
+
+  const TlsServerContext context{cert, key, options};
+  return StartTlsServer(std::move(socket), context, deadline);
+}
 
-  if (1 != SSL_CTX_use_PrivateKey(ssl_ctx.get(), key.GetNative())) {
-    throw TlsException(crypto::FormatSslError(
-        "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
-  }
+TlsWrapper TlsWrapper::StartTlsServer(Socket&& socket,
+                                      const TlsServerContext& context,
+                                      Deadline deadline) {
+  auto& context_impl = *context.impl_;
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(context_impl.ssl_ctx.get());
   wrapper.impl_->bio_data.current_deadline = deadline;
 
   auto ret = SSL_accept(wrapper.impl_->ssl.get());
   if (1 != ret) {
+    ++context_impl.failed_handshakes;
     if (wrapper.impl_->bio_data.last_exception) {
       std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
     }
@@ -434,6 +554,12 @@ TlsWrapper TlsWrapper::StartTlsServer(
                     SSL_get_error(wrapper.impl_->ssl.get(), ret))));
   }
 
+  if (SSL_session_reused(wrapper.impl_->ssl.get())) {
+    ++context_impl.resumed_handshakes;
+  } else {
+    ++context_impl.full_handshakes;
+  }
+
   return wrapper;
 }
 
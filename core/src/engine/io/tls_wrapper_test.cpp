@@ -401,6 +401,53 @@ UTEST_MT(TlsWrapper, NonTlsServer, 2) {
   server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, SharedServerContext, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  const io::TlsServerContext context{crypto::Certificate::LoadFromString(cert),
+                                     crypto::PrivateKey::LoadFromString(key),
+                                     {}};
+  TcpListener tcp_listener;
+
+  for (int i = 0; i < 2; ++i) {
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+    auto server_task = engine::AsyncNoSpan(
+        [test_deadline, &context](auto&& server) {
+          auto tls_server = io::TlsWrapper::StartTlsServer(
+              std::forward<decltype(server)>(server), context, test_deadline);
+          EXPECT_EQ(1, tls_server.SendAll("1", 1, test_deadline));
+        },
+        std::move(server));
+
+    auto tls_client =
+        io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+    char c = 0;
+    EXPECT_EQ(1, tls_client.RecvSome(&c, 1, test_deadline));
+    EXPECT_EQ('1', c);
+    server_task.Get();
+  }
+
+  {
+    auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+    auto server_task = engine::AsyncNoSpan(
+        [test_deadline, &context](auto&& server) {
+          UEXPECT_THROW(static_cast<void>(io::TlsWrapper::StartTlsServer(
+                            std::forward<decltype(server)>(server), context,
+                            test_deadline)),
+                        io::TlsException);
+        },
+        std::move(server));
+    EXPECT_EQ(5, client.SendAll("hello", 5, test_deadline));
+    server_task.Get();
+  }
+
+  const auto stats = context.GetStats();
+  // The client does not keep the sessions between the connections
+  EXPECT_EQ(stats.full_handshakes, 2);
+  EXPECT_EQ(stats.resumed_handshakes, 0);
+  EXPECT_EQ(stats.failed_handshakes, 1);
+}
+
 UTEST_MT(TlsWrapper, DoubleSmoke, 4) {
   const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
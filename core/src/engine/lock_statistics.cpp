@@ -0,0 +1,137 @@
+#include <userver/engine/lock_statistics.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <engine/impl/lock_statistics_registry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+
+namespace {
+
+struct Registry final {
+  // The registrations are rare, a plain mutex is fine here
+  std::mutex mutex;
+  std::multimap<std::string, const LockStatistics*, std::less<>> statistics;
+};
+
+Registry& GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+}  // namespace
+
+LockStatisticsRegistration::LockStatisticsRegistration(
+    std::string name, const LockStatistics& statistics)
+    : name_(std::move(name)), statistics_(statistics) {
+  auto& registry = GetRegistry();
+  const std::lock_guard lock{registry.mutex};
+  registry.statistics.emplace(name_, &statistics_);
+}
+
+LockStatisticsRegistration::~LockStatisticsRegistration() {
+  auto& registry = GetRegistry();
+  const std::lock_guard lock{registry.mutex};
+  auto [begin, end] = registry.statistics.equal_range(name_);
+  const auto it = std::find_if(begin, end, [this](const auto& item) {
+    return item.second == &statistics_;
+  });
+  UASSERT(it != end);
+  if (it != end) registry.statistics.erase(it);
+}
+
+void WriteLockStatistics(utils::statistics::Writer& writer) {
+  auto& registry = GetRegistry();
+  const std::lock_guard lock{registry.mutex};
+  auto& statistics = registry.statistics;
+  for (auto it = statistics.begin(); it != statistics.end();) {
+    const auto& name = it->first;
+    const auto end = statistics.upper_bound(name);
+    if (std::next(it) == end) {
+      writer.ValueWithLabels(*it->second, {"lock", name});
+    } else {
+      LockStatistics total;
+      for (; it != end; ++it) total.Add(*it->second);
+      writer.ValueWithLabels(total, {"lock", name});
+    }
+    it = end;
+  }
+}
+
+}  // namespace impl
+
+void LockStatistics::AccountAcquired(std::size_t count) noexcept {
+  ++acquisitions_;
+  const auto added = static_cast<std::int64_t>(count);
+  const auto holders =
+      holders_.fetch_add(added, std::memory_order_relaxed) + added;
+  auto max_holders = max_holders_.load(std::memory_order_relaxed);
+  while (max_holders < holders &&
+         !max_holders_.compare_exchange_weak(max_holders, holders,
+                                             std::memory_order_relaxed)) {
+  }
+}
+
+void LockStatistics::AccountAcquired(std::chrono::steady_clock::duration wait,
+                                     std::size_t count) noexcept {
+  ++contended_acquisitions_;
+  AccountWait(wait);
+  AccountAcquired(count);
+}
+
+void LockStatistics::AccountFailed(
+    std::chrono::steady_clock::duration wait) noexcept {
+  ++failed_acquisitions_;
+  AccountWait(wait);
+}
+
+void LockStatistics::AccountReleased(std::size_t count) noexcept {
+  holders_.fetch_sub(static_cast<std::int64_t>(count),
+                     std::memory_order_relaxed);
+}
+
+void LockStatistics::Add(const LockStatistics& other) noexcept {
+  acquisitions_ += other.acquisitions_;
+  contended_acquisitions_ += other.contended_acquisitions_;
+  failed_acquisitions_ += other.failed_acquisitions_;
+  wait_time_us_.Add(other.wait_time_us_);
+  holders_.store(holders_.load(std::memory_order_relaxed) +
+                     other.holders_.load(std::memory_order_relaxed),
+                 std::memory_order_relaxed);
+  const auto other_max_holders =
+      other.max_holders_.load(std::memory_order_relaxed);
+  if (other_max_holders > max_holders_.load(std::memory_order_relaxed)) {
+    max_holders_.store(other_max_holders, std::memory_order_relaxed);
+  }
+}
+
+void LockStatistics::AccountWait(
+    std::chrono::steady_clock::duration wait) noexcept {
+  wait_time_us_.Account(static_cast<double>(
+      std::chrono::duration_cast<std::chrono::microseconds>(wait).count()));
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const LockStatistics& statistics) {
+  writer["acquisitions"] = statistics.acquisitions_;
+  writer["contended-acquisitions"] = statistics.contended_acquisitions_;
+  writer["failed-acquisitions"] = statistics.failed_acquisitions_;
+  writer["wait-time-us"] = statistics.wait_time_us_;
+  writer["holders"] = statistics.holders_.load(std::memory_order_relaxed);
+  writer["max-holders"] =
+      statistics.max_holders_.load(std::memory_order_relaxed);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/engine/mutex.hpp>
 
 #include <engine/impl/mutex_impl.hpp>
+#include <utils/pprof/contention_profiler.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,13 +13,18 @@ Mutex::Mutex() = default;
 
 Mutex::~Mutex() = default;
 
-void Mutex::lock() { impl_->lock(); }
+void Mutex::lock() {
+  [[maybe_unused]] const bool is_locked = try_lock_until(Deadline{});
+}
 
 void Mutex::unlock() { impl_->unlock(); }
 
 bool Mutex::try_lock() noexcept { return impl_->try_lock(); }
 
 bool Mutex::try_lock_until(Deadline deadline) {
+  if (impl_->try_lock()) return true;
+
+  const utils::pprof::ContentionScope contention_scope;
   return impl_->try_lock_until(deadline);
 }
 
@@ -0,0 +1,237 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+
+// Scheduler scenarios under contention. Each benchmark takes the
+// TaskProcessor variant and the number of worker threads as the first two
+// arguments, run with `--benchmark_format=json` for machine-readable results.
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::chrono_literals;
+
+enum class Variant {
+  kGlobalQueue,
+  kWorkStealingQueue,
+  kGlobalQueueNoSpinning,
+};
+
+const char* ToString(Variant variant) {
+  switch (variant) {
+    case Variant::kGlobalQueue:
+      return "global-queue";
+    case Variant::kWorkStealingQueue:
+      return "work-stealing";
+    case Variant::kGlobalQueueNoSpinning:
+      return "global-queue-no-spinning";
+  }
+  UINVARIANT(false, "Unexpected variant");
+}
+
+engine::TaskProcessorConfig MakeConfig(Variant variant,
+                                       std::size_t worker_threads) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = worker_threads;
+  config.thread_name = "bench-worker";
+  switch (variant) {
+    case Variant::kGlobalQueue:
+      break;
+    case Variant::kWorkStealingQueue:
+      config.task_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+      break;
+    case Variant::kGlobalQueueNoSpinning:
+      config.spinning_iterations = 0;
+      break;
+  }
+  return config;
+}
+
+// Like engine::RunStandalone, but with a custom TaskProcessorConfig
+template <typename Payload>
+void RunScenario(benchmark::State& state, Payload payload) {
+  const auto variant = static_cast<Variant>(state.range(0));
+  const auto worker_threads = static_cast<std::size_t>(state.range(1));
+  state.SetLabel(ToString(variant));
+
+  engine::TaskProcessorPoolsConfig pools_config;
+  pools_config.max_coro_pool_size = 10000;
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          MakeConfig(variant, worker_threads),
+          engine::impl::MakeTaskProcessorPools(pools_config))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+void ApplyVariants(benchmark::internal::Benchmark* b,
+                   const std::vector<std::int64_t>& extra_args) {
+  for (const auto variant :
+       {Variant::kGlobalQueue, Variant::kWorkStealingQueue,
+        Variant::kGlobalQueueNoSpinning}) {
+    for (const std::int64_t threads : {1, 2, 4, 8}) {
+      std::vector<std::int64_t> args{static_cast<std::int64_t>(variant),
+                                     threads};
+      args.insert(args.end(), extra_args.begin(), extra_args.end());
+      b->Args(args);
+    }
+  }
+  b->UseRealTime();
+}
+
+// Two tasks wake up each other, an iteration is a round trip
+void scheduler_ping_pong(benchmark::State& state) {
+  RunScenario(state, [&] {
+    engine::SingleConsumerEvent ping;
+    engine::SingleConsumerEvent pong;
+    std::atomic<bool> stop{false};
+
+    auto partner = engine::AsyncNoSpan([&] {
+      while (true) {
+        if (!ping.WaitForEvent() || stop) return;
+        pong.Send();
+      }
+    });
+
+    for ([[maybe_unused]] auto _ : state) {
+      ping.Send();
+      [[maybe_unused]] const bool received = pong.WaitForEvent();
+    }
+
+    stop = true;
+    ping.Send();
+    partner.Get();
+  });
+}
+BENCHMARK(scheduler_ping_pong)->Apply([](auto* b) { ApplyVariants(b, {}); });
+
+// Starts range(2) tasks and waits for all of them
+void scheduler_fan_out_fan_in(benchmark::State& state) {
+  const auto tasks_count = static_cast<std::size_t>(state.range(2));
+  RunScenario(state, [&] {
+    std::vector<engine::TaskWithResult<std::size_t>> tasks;
+    tasks.reserve(tasks_count);
+
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([i] { return i; }));
+      }
+      std::size_t sum = 0;
+      for (auto& task : tasks) sum += task.Get();
+      benchmark::DoNotOptimize(sum);
+      tasks.clear();
+    }
+  });
+  state.SetItemsProcessed(state.iterations() * tasks_count);
+}
+BENCHMARK(scheduler_fan_out_fan_in)->Apply([](auto* b) {
+  ApplyVariants(b, {16});
+  ApplyVariants(b, {1024});
+});
+
+// range(2) producers and range(2) consumers pass kMessages messages through
+// a bounded concurrent::NonFifoMpmcQueue
+void scheduler_producer_consumer(benchmark::State& state) {
+  constexpr std::size_t kMessages = 10000;
+  constexpr std::size_t kQueueSize = 64;
+  const auto tasks_count = static_cast<std::size_t>(state.range(2));
+
+  RunScenario(state, [&] {
+    for ([[maybe_unused]] auto _ : state) {
+      auto queue =
+          concurrent::NonFifoMpmcQueue<std::size_t>::Create(kQueueSize);
+      std::vector<engine::TaskWithResult<void>> tasks;
+      tasks.reserve(2 * tasks_count);
+
+      for (std::size_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan(
+            [producer = queue->GetProducer(), i, tasks_count] {
+              for (auto message = i; message < kMessages;
+                   message += tasks_count) {
+                [[maybe_unused]] const bool pushed =
+                    producer.Push(std::size_t{message});
+              }
+            }));
+      }
+      for (std::size_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([consumer = queue->GetConsumer()] {
+          std::size_t message{};
+          while (consumer.Pop(message)) benchmark::DoNotOptimize(message);
+        }));
+      }
+      // the consumers stop when all the producers are gone
+      queue.reset();
+      for (auto& task : tasks) task.Get();
+    }
+  });
+  state.SetItemsProcessed(state.iterations() * kMessages);
+}
+BENCHMARK(scheduler_producer_consumer)->Apply([](auto* b) {
+  ApplyVariants(b, {1});
+  ApplyVariants(b, {8});
+});
+
+// range(2) tasks sleep for a short time, so the timers fire
+void scheduler_timers_fired(benchmark::State& state) {
+  const auto tasks_count = static_cast<std::size_t>(state.range(2));
+  RunScenario(state, [&] {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(tasks_count);
+
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(
+            engine::AsyncNoSpan([] { engine::InterruptibleSleepFor(10us); }));
+      }
+      for (auto& task : tasks) task.Get();
+      tasks.clear();
+    }
+  });
+  state.SetItemsProcessed(state.iterations() * tasks_count);
+}
+BENCHMARK(scheduler_timers_fired)->Apply([](auto* b) {
+  ApplyVariants(b, {1000});
+});
+
+// range(2) tasks wait with a long deadline and are woken up before it, so the
+// timers are armed and then cancelled
+void scheduler_timers_cancelled(benchmark::State& state) {
+  const auto tasks_count = static_cast<std::size_t>(state.range(2));
+  RunScenario(state, [&] {
+    std::vector<engine::SingleConsumerEvent> events(tasks_count);
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(tasks_count);
+
+    for ([[maybe_unused]] auto _ : state) {
+      for (auto& event : events) {
+        tasks.push_back(engine::AsyncNoSpan([&event] {
+          [[maybe_unused]] const bool received = event.WaitForEventFor(1h);
+        }));
+      }
+      for (auto& event : events) event.Send();
+      for (auto& task : tasks) task.Get();
+      tasks.clear();
+    }
+  });
+  state.SetItemsProcessed(state.iterations() * tasks_count);
+}
+BENCHMARK(scheduler_timers_cancelled)->Apply([](auto* b) {
+  ApplyVariants(b, {1000});
+});
+
+}  // namespace
+
+USERVER_NAMESPACE_END
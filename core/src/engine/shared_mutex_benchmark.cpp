@@ -3,16 +3,18 @@
 #include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/distributed_shared_mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+template <typename SharedMutex>
 void shared_mutex_benchmark(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     int variable = 0;
-    engine::SharedMutex mutex;
+    SharedMutex mutex;
     std::atomic<bool> is_running(true);
 
     std::vector<engine::TaskWithResult<void>> tasks;
@@ -44,6 +46,9 @@ void shared_mutex_benchmark(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::SharedMutex)
+    ->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::DistributedSharedMutex)
+    ->DenseRange(1, 6);
 
 USERVER_NAMESPACE_END
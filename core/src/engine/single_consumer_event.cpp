@@ -74,6 +74,17 @@ bool SingleConsumerEvent::IsReady() const noexcept {
   return waiters_->IsSignaled();
 }
 
+void SingleConsumerEvent::AppendWaiter(impl::TaskContext& context) noexcept {
+  // If already signaled, the waiter is not appended, but engine::WaitAny
+  // checks IsReady right after this call
+  [[maybe_unused]] const bool is_signaled =
+      waiters_->GetSignalOrAppend(&context);
+}
+
+void SingleConsumerEvent::RemoveWaiter(impl::TaskContext& context) noexcept {
+  waiters_->Remove(context);
+}
+
 bool SingleConsumerEvent::GetIsSignaled() noexcept {
   if (is_auto_reset_) {
     return waiters_->GetAndResetSignal();
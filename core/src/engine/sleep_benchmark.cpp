@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <engine/ev/thread_control.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -67,4 +69,47 @@ BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline,
                   true);
 
+// Measures the cost of arming and cancelling a deadline timer while a lot of
+// other deadlines are pending, e.g. with many in-flight requests.
+void concurrent_deadlines_benchmark(benchmark::State& state,
+                                    bool timer_wheel) {
+  const auto concurrent_deadlines = static_cast<std::size_t>(state.range(0));
+
+  engine::TaskProcessorPoolsConfig config;
+  config.coro_stack_size = 32 * 1024ULL;
+  config.max_coro_pool_size = concurrent_deadlines + 100;
+  config.ev_threads_num = 2;
+  config.timer_wheel = timer_wheel;
+
+  engine::RunStandalone(4, config, [&] {
+    std::vector<engine::TaskWithResult<void>> sleepers;
+    sleepers.reserve(concurrent_deadlines);
+    for (std::size_t i = 0; i < concurrent_deadlines; ++i) {
+      sleepers.push_back(engine::AsyncNoSpan(
+          [] { engine::InterruptibleSleepFor(std::chrono::hours{1}); }));
+    }
+    // Let the sleepers arm their timers
+    engine::SleepFor(100ms);
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto sleep_deadline = engine::Deadline::FromDuration(20s);
+      auto task = engine::AsyncNoSpan(
+          [&] { engine::InterruptibleSleepUntil(sleep_deadline); });
+      engine::Yield();
+      task.SyncCancel();
+    }
+
+    for (auto& sleeper : sleepers) sleeper.RequestCancel();
+    for (auto& sleeper : sleepers) sleeper.Wait();
+  });
+}
+BENCHMARK_CAPTURE(concurrent_deadlines_benchmark, libev, false)
+    ->RangeMultiplier(32)
+    ->Range(1, 1024 * 1024)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(concurrent_deadlines_benchmark, timer_wheel, true)
+    ->RangeMultiplier(32)
+    ->Range(1, 1024 * 1024)
+    ->Unit(benchmark::kMicrosecond);
+
 USERVER_NAMESPACE_END
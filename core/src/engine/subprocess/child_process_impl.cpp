@@ -3,6 +3,8 @@
 #include <sys/types.h>
 
 #include <csignal>
+#include <stdexcept>
+#include <string>
 
 #include <userver/engine/task/cancel.hpp>
 #include <utils/check_syscall.hpp>
@@ -11,9 +13,25 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
+namespace {
+
+template <typename T>
+T& GetPipeEnd(std::optional<T>& pipe_end, const char* stream_name) {
+  if (!pipe_end) {
+    throw std::logic_error(std::string{"The child process "} + stream_name +
+                           " is not connected to a pipe");
+  }
+  return *pipe_end;
+}
+
+}  // namespace
+
 ChildProcessImpl::ChildProcessImpl(int pid,
-                                   Future<ChildProcessStatus>&& status_future)
-    : pid_(pid), status_future_(std::move(status_future)) {}
+                                   Future<ChildProcessStatus>&& status_future,
+                                   ChildProcessPipes&& pipes)
+    : pid_(pid),
+      status_future_(std::move(status_future)),
+      pipes_(std::move(pipes)) {}
 
 void ChildProcessImpl::WaitNonCancellable() {
   TaskCancellationBlocker cancel_blocker;
@@ -35,6 +53,18 @@ void ChildProcessImpl::SendSignal(int signum) {
   utils::CheckSyscall(kill(pid_, signum), "kill, pid={}", pid_);
 }
 
+io::PipeWriter& ChildProcessImpl::GetStdin() {
+  return GetPipeEnd(pipes_.stdin_writer, "stdin");
+}
+
+io::PipeReader& ChildProcessImpl::GetStdout() {
+  return GetPipeEnd(pipes_.stdout_reader, "stdout");
+}
+
+io::PipeReader& ChildProcessImpl::GetStderr() {
+  return GetPipeEnd(pipes_.stderr_reader, "stderr");
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
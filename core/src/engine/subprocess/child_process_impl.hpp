@@ -1,18 +1,28 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process_status.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
+/// Parent ends of the pipes to the standard streams of the child
+struct ChildProcessPipes {
+  std::optional<io::PipeWriter> stdin_writer;
+  std::optional<io::PipeReader> stdout_reader;
+  std::optional<io::PipeReader> stderr_reader;
+};
+
 class ChildProcessImpl {
  public:
-  ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future);
+  ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future,
+                   ChildProcessPipes&& pipes = {});
 
   int GetPid() const { return pid_; }
 
@@ -24,9 +34,16 @@ class ChildProcessImpl {
 
   void SendSignal(int signum);
 
+  io::PipeWriter& GetStdin();
+
+  io::PipeReader& GetStdout();
+
+  io::PipeReader& GetStderr();
+
  private:
   int pid_;
   Future<ChildProcessStatus> status_future_;
+  ChildProcessPipes pipes_;
 };
 
 }  // namespace engine::subprocess
@@ -1,13 +1,13 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <spawn.h>
 #include <sys/types.h>
-#include <sys/wait.h>
 #include <unistd.h>
 
+#include <array>
+#include <cerrno>
 #include <csignal>
-#include <cstdio>
-#include <cstring>
-#include <iostream>
 
 #include <fmt/format.h>
 #include <boost/algorithm/string.hpp>
@@ -22,6 +22,7 @@
 #include <engine/ev/thread_pool.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/task/cancel.hpp>
 
 #include <engine/subprocess/child_process_impl.hpp>
@@ -31,20 +32,89 @@ USERVER_NAMESPACE_BEGIN
 namespace engine::subprocess {
 namespace {
 
-void DoExecve(const std::string& command, const std::vector<std::string>& args,
-              const EnvironmentVariables& env,
-              const std::optional<std::string>& stdout_file,
-              const std::optional<std::string>& stderr_file) {
-  if (stdout_file) {
-    if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
-      utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
+// Child ends of the pipes, blocking as most of the programs expect. Closed in
+// the parent once the child is started.
+class ChildFds final {
+ public:
+  ChildFds() = default;
+  ChildFds(const ChildFds&) = delete;
+  ChildFds& operator=(const ChildFds&) = delete;
+
+  ~ChildFds() {
+    for (const int fd : fds_) {
+      if (fd != -1) ::close(fd);
     }
   }
-  if (stderr_file) {
-    if (!std::freopen(stderr_file->c_str(), "a", stderr)) {
-      utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
-    }
+
+  void Set(int target_fd, int fd) {
+    fds_[target_fd] = fd;
+    const int flags = utils::CheckSyscall(::fcntl(fd, F_GETFL), "fcntl");
+    utils::CheckSyscall(::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK), "fcntl");
+  }
+
+  int Get(int target_fd) const { return fds_[target_fd]; }
+
+ private:
+  std::array<int, 3> fds_{-1, -1, -1};
+};
+
+class SpawnFileActions final {
+ public:
+  SpawnFileActions() {
+    CheckSpawnError(::posix_spawn_file_actions_init(&actions_),
+                    "posix_spawn_file_actions_init");
+  }
+  SpawnFileActions(const SpawnFileActions&) = delete;
+  SpawnFileActions& operator=(const SpawnFileActions&) = delete;
+
+  ~SpawnFileActions() { ::posix_spawn_file_actions_destroy(&actions_); }
+
+  void AddDup2(int fd, int target_fd) {
+    CheckSpawnError(
+        ::posix_spawn_file_actions_adddup2(&actions_, fd, target_fd),
+        "posix_spawn_file_actions_adddup2");
+  }
+
+  void AddAppend(int target_fd, const std::string& path) {
+    CheckSpawnError(
+        ::posix_spawn_file_actions_addopen(&actions_, target_fd, path.c_str(),
+                                           O_WRONLY | O_CREAT | O_APPEND,
+                                           0666),
+        "posix_spawn_file_actions_addopen {}", path);
   }
+
+  const posix_spawn_file_actions_t* Get() const { return &actions_; }
+
+  template <typename... Args>
+  static void CheckSpawnError(int error, const char* format,
+                              const Args&... args) {
+    // posix_spawn* functions return the error instead of setting errno
+    if (error == 0) return;
+    errno = error;
+    utils::CheckSyscall(-1, format, args...);
+  }
+
+ private:
+  posix_spawn_file_actions_t actions_{};
+};
+
+void AddStreamActions(SpawnFileActions& actions, const ChildFds& child_fds,
+                      int target_fd, const std::optional<std::string>& file) {
+  if (child_fds.Get(target_fd) != -1) {
+    actions.AddDup2(child_fds.Get(target_fd), target_fd);
+  } else if (file) {
+    actions.AddAppend(target_fd, *file);
+  }
+}
+
+int DoSpawn(const std::string& command, const std::vector<std::string>& args,
+            const EnvironmentVariables& env, const ExecOptions& options,
+            const ChildFds& child_fds) {
+  SpawnFileActions actions;
+  AddStreamActions(actions, child_fds, STDIN_FILENO, std::nullopt);
+  AddStreamActions(actions, child_fds, STDOUT_FILENO, options.stdout_file);
+  AddStreamActions(actions, child_fds, STDERR_FILENO, options.stderr_file);
+
   std::vector<char*> argv_ptrs;
   std::vector<std::string> envp_buf;
   std::vector<char*> envp_ptrs;
@@ -67,8 +137,14 @@ void DoExecve(const std::string& command, const std::vector<std::string>& args,
   }
   envp_ptrs.push_back(nullptr);
 
-  utils::CheckSyscall(
-      execve(command.c_str(), argv_ptrs.data(), envp_ptrs.data()), "execve");
+  // posix_spawn uses vfork-like clone where available, so the cost does not
+  // grow with the memory size of the parent
+  pid_t pid = 0;
+  SpawnFileActions::CheckSpawnError(
+      ::posix_spawn(&pid, command.c_str(), actions.Get(), nullptr,
+                    argv_ptrs.data(), envp_ptrs.data()),
+      "posix_spawn {}", command);
+  return pid;
 }
 
 }  // namespace
@@ -77,17 +153,37 @@ ProcessStarter::ProcessStarter(TaskProcessor& task_processor)
     : thread_control_(
           task_processor.EventThreadPool().GetEvDefaultLoopThread()) {}
 
-ChildProcess ProcessStarter::Exec(
-    const std::string& command, const std::vector<std::string>& args,
-    const EnvironmentVariables& env,
-    const std::optional<std::string>& stdout_file,
-    const std::optional<std::string>& stderr_file) {
+ChildProcess ProcessStarter::Exec(const std::string& command,
+                                  const std::vector<std::string>& args,
+                                  const EnvironmentVariables& env,
+                                  const ExecOptions& options) {
   tracing::Span span("ProcessStarter::Exec");
   span.AddTag("command", command);
+
+  ChildFds child_fds;
+  ChildProcessPipes pipes;
+  if (options.pipe_stdin) {
+    io::Pipe pipe;
+    child_fds.Set(STDIN_FILENO, pipe.reader.Release());
+    pipes.stdin_writer.emplace(std::move(pipe.writer));
+  }
+  if (options.pipe_stdout) {
+    io::Pipe pipe;
+    child_fds.Set(STDOUT_FILENO, pipe.writer.Release());
+    pipes.stdout_reader.emplace(std::move(pipe.reader));
+  }
+  if (options.pipe_stderr) {
+    io::Pipe pipe;
+    child_fds.Set(STDERR_FILENO, pipe.writer.Release());
+    pipes.stderr_reader.emplace(std::move(pipe.reader));
+  }
+
   Promise<ChildProcess> promise;
   auto future = promise.get_future();
+  // Spawning and registering the pid happen in the ev loop that reaps the
+  // children, so the exit status can not be reaped before the registration.
   thread_control_.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
-    LOG_DEBUG() << "do fork() + execve(), command=" << command << ", args=["
+    LOG_DEBUG() << "do posix_spawn(), command=" << command << ", args=["
                 << (args.empty() ? "" : '\'' + boost::join(args, "' '") + '\'')
                 << "], env=["
                 << (env.empty()
@@ -99,37 +195,31 @@ ChildProcess ProcessStarter::Exec(
                                                 }),
                                       ", "))
                 << ']';
-    auto pid = utils::CheckSyscall(fork(), "fork");
-    if (pid) {
-      // in parent thread
-      span.AddTag("child-process-pid", pid);
-      LOG_DEBUG() << "Started child process with pid=" << pid;
-      Promise<ChildProcessStatus> exec_result_promise;
-      auto res = ChildProcessMapSet(
-          pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-      if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-      } else {
-        std::string msg = "process with pid=" + std::to_string(pid) +
-                          " already exists in child_process_map";
-        LOG_ERROR() << msg << ", send SIGKILL";
-        ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-        promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-      }
+    int pid = 0;
+    try {
+      pid = DoSpawn(command, args, env, options, child_fds);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Cannot execute child: " << ex;
+      promise.set_exception(std::current_exception());
+      return;
+    }
+
+    span.AddTag("child-process-pid", pid);
+    LOG_DEBUG() << "Started child process with pid=" << pid;
+    Promise<ChildProcessStatus> exec_result_promise;
+    auto res = ChildProcessMapSet(
+        pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+    if (res.second) {
+      promise.set_value(
+          ChildProcess{ChildProcessImpl{pid,
+                                        res.first->status_promise.get_future(),
+                                        std::move(pipes)}});
     } else {
-      // in child thread
-      try {
-        try {
-          DoExecve(command, args, env, stdout_file, stderr_file);
-        } catch (const std::exception& ex) {
-          std::cerr << "Cannot execute child: " << ex.what();
-        }
-      } catch (...) {
-        // must not do anything in a child
-      }
-      // on success execve does not return
-      std::abort();
+      std::string msg = "process with pid=" + std::to_string(pid) +
+                        " already exists in child_process_map";
+      LOG_ERROR() << msg << ", send SIGKILL";
+      ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+      promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
     }
   });
 
@@ -137,6 +227,33 @@ ChildProcess ProcessStarter::Exec(
   return future.get();
 }
 
+ChildProcess ProcessStarter::Exec(const std::string& command,
+                                  const std::vector<std::string>& args,
+                                  EnvironmentVariablesUpdate env_update,
+                                  const ExecOptions& options) {
+  return Exec(command, args,
+              EnvironmentVariables{GetCurrentEnvironmentVariables()}.UpdateWith(
+                  std::move(env_update)),
+              options);
+}
+
+ChildProcess ProcessStarter::Exec(const std::string& command,
+                                  const std::vector<std::string>& args,
+                                  const ExecOptions& options) {
+  return Exec(command, args, EnvironmentVariablesUpdate{{}}, options);
+}
+
+ChildProcess ProcessStarter::Exec(
+    const std::string& command, const std::vector<std::string>& args,
+    const EnvironmentVariables& env,
+    const std::optional<std::string>& stdout_file,
+    const std::optional<std::string>& stderr_file) {
+  ExecOptions options;
+  options.stdout_file = stdout_file;
+  options.stderr_file = stderr_file;
+  return Exec(command, args, env, options);
+}
+
 ChildProcess ProcessStarter::Exec(
     const std::string& command, const std::vector<std::string>& args,
     EnvironmentVariablesUpdate env_update,
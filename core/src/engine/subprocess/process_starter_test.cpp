@@ -19,6 +19,7 @@
 
 #include <engine/ev/thread_control.hpp>
 #include <engine/ev/thread_pool.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
@@ -43,6 +44,8 @@ const std::string kTestProgram = "/bin/test";
 const std::string kTestProgram = "/usr/bin/test";
 #endif
 
+const std::string kCatProgram = "/bin/cat";
+
 constexpr std::string_view kLogFilePart = "log_closeexec_test_";
 
 }  // namespace
@@ -65,6 +68,46 @@ UTEST(Subprocess, False) {
   EXPECT_NE(0, status.GetExitCode());
 }
 
+UTEST(Subprocess, Pipes) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  /// [Pipes example]
+  engine::subprocess::ExecOptions options;
+  options.pipe_stdin = true;
+  options.pipe_stdout = true;
+  auto child = starter.Exec(kCatProgram, {}, options);
+
+  const std::string input = "streamed through the child";
+  ASSERT_EQ(child.GetStdin().WriteAll(input.data(), input.size(), deadline),
+            input.size());
+  child.GetStdin().Close();
+
+  std::string output;
+  char buf[64];
+  while (const auto size =
+             child.GetStdout().ReadSome(buf, sizeof(buf), deadline)) {
+    output.append(buf, size);
+  }
+  /// [Pipes example]
+
+  EXPECT_EQ(output, input);
+  const auto status = child.Get();
+  ASSERT_TRUE(status.IsExited());
+  EXPECT_EQ(status.GetExitCode(), 0);
+  EXPECT_THROW(child.GetStderr(), std::logic_error);
+}
+
+UTEST(Subprocess, NoSuchProgram) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+
+  EXPECT_THROW(starter.Exec("/nonexistent/program", {},
+                            engine::subprocess::ExecOptions{}),
+               std::system_error);
+}
+
 UTEST(Subprocess, CheckLogClosesFds) {
   auto file = fs::blocking::TempFile::Create("/tmp", kLogFilePart);
   auto logger = logging::MakeFileLogger("to_file", file.GetPath(),
@@ -1,12 +1,17 @@
 #include <benchmark/benchmark.h>
 
 #include <array>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/async_many.hpp>
 #include <userver/utils/fixed_array.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,7 +22,9 @@ using WrappedSpanCall =
     utils::impl::WrappedCallImplType<decltype(utils::impl::SpanLazyPrvalue("")),
                                      void (*)()>;
 
-}
+std::array<engine::TaskInheritedVariable<std::string>, 16> kInheritedVariables;
+
+}  // namespace
 
 // Note: We intentionally do not run this benchmark from RunStandalone to avoid
 // any side-effects (RunStandalone spawns additional std::threads and uses some
@@ -99,4 +106,43 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+void async_inherited_variables(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      kInheritedVariables[i].Set(std::string(100, 'a'));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      utils::Async("", [] {}).Wait();
+    }
+  });
+}
+BENCHMARK(async_inherited_variables)->Arg(0)->Arg(1)->Arg(4)->Arg(16);
+
+void async_fan_out_spanned(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    std::vector<engine::TaskWithResult<std::size_t>> tasks;
+    for ([[maybe_unused]] auto _ : state) {
+      tasks.reserve(state.range(0));
+      for (std::int64_t i = 0; i < state.range(0); ++i) {
+        tasks.push_back(utils::Async("", [i] { return std::size_t(i); }));
+      }
+      benchmark::DoNotOptimize(engine::GetAll(tasks));
+      tasks.clear();
+    }
+  });
+}
+BENCHMARK(async_fan_out_spanned)->RangeMultiplier(4)->Range(4, 256);
+
+void async_fan_out_many(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    for ([[maybe_unused]] auto _ : state) {
+      auto batch = utils::AsyncMany("", state.range(0),
+                                    [](std::size_t i) { return i; });
+      benchmark::DoNotOptimize(batch.Get());
+    }
+  });
+}
+BENCHMARK(async_fan_out_many)->RangeMultiplier(4)->Range(4, 256);
+
 USERVER_NAMESPACE_END
@@ -65,6 +65,7 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   void StopTimerInEvThread() noexcept;
 
   static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnWheelTimer(ev::TimerWheel::Timer& timer) noexcept;
   static void InvokeTimerFunction(const Params& params, TaskContext& context);
   void DoOnTimer();
 
@@ -72,6 +73,8 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   ev::TimerThreadControl* thread_control_ = nullptr;
   Params params_;
   ev_timer timer_{};
+  // Used instead of timer_ if the thread has a timer wheel
+  ev::TimerWheel::Timer wheel_timer_;
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
@@ -79,11 +82,13 @@ ContextTimer::Impl::Impl() {
   timer_.data = this;
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_init(&timer_, OnTimer);
+  wheel_timer_.Init(OnWheelTimer, this);
 }
 
 ContextTimer::Impl::~Impl() {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   UASSERT(!ev_is_active(&timer_));
+  UASSERT(!wheel_timer_.IsScheduled());
 }
 
 bool ContextTimer::Impl::WasStarted() const noexcept {
@@ -137,19 +142,24 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
   params_ = std::move(*params);
 
   using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
+  const auto time_left = params_.deadline.TimeLeft();
 
-  LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  LOG_TRACE() << "time_left="
+              << std::chrono::duration_cast<LibEvDuration>(time_left).count();
+  if (time_left <= Deadline::Duration::zero()) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
   UASSERT(thread_control_);
+  if (thread_control_->HasTimerWheel()) {
+    thread_control_->Start(wheel_timer_, time_left);
+    return;
+  }
+
+  timer_.repeat =
+      std::chrono::duration_cast<LibEvDuration>(time_left).count();
   thread_control_->Again(timer_);
 }
 
@@ -170,7 +180,11 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
 
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
-  thread_control_->Stop(timer_);
+  if (thread_control_->HasTimerWheel()) {
+    thread_control_->Stop(wheel_timer_);
+  } else {
+    thread_control_->Stop(timer_);
+  }
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -193,6 +207,14 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnWheelTimer(ev::TimerWheel::Timer& timer) noexcept {
+  UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+  auto* self = static_cast<Impl*>(timer.GetData());
+  UASSERT(self != nullptr);
+  self->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
 
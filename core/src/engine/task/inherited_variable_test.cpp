@@ -8,6 +8,7 @@
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/task/shared_task_with_result.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fixed_array.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -151,6 +152,35 @@ UTEST(TaskInheritedVariable, SameObjectIsInherited) {
   }).Get();
 }
 
+UTEST_MT(TaskInheritedVariable, FanOut, 4) {
+  constexpr std::size_t kTasksCount = 100;
+
+  kStringVariable.Set("foo");
+  kStringVariable2.Set("bar");
+  const auto* const kParentVariablePtr = &kStringVariable.Get();
+
+  auto tasks = utils::GenerateFixedArray(kTasksCount, [&](std::size_t i) {
+    return utils::Async("subtask", [&, i] {
+      EXPECT_EQ(&kStringVariable.Get(), kParentVariablePtr);
+      if (i % 2 == 0) {
+        kStringVariable2.Set(std::to_string(i));
+        kStringVariable3.Set("baz");
+        EXPECT_EQ(kStringVariable2.Get(), std::to_string(i));
+      } else {
+        kStringVariable2.Erase();
+        EXPECT_FALSE(kStringVariable2.GetOptional());
+      }
+      EXPECT_EQ(&kStringVariable.Get(), kParentVariablePtr);
+    });
+  });
+  kStringVariable.Set("new-foo");
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(kStringVariable.Get(), "new-foo");
+  EXPECT_EQ(kStringVariable2.Get(), "bar");
+  EXPECT_FALSE(kStringVariable3.GetOptional());
+}
+
 UTEST_MT(TaskInheritedVariable, VariablesAfterParentTaskDeath, 4) {
   using Event = engine::SingleConsumerEvent;
   Event assigned_a{Event::NoAutoReset{}};
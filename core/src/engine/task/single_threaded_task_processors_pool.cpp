@@ -36,6 +36,7 @@ SingleThreadedTaskProcessorsPool::SingleThreadedTaskProcessorsPool(
     auto proc_config = config;
     proc_config.name += std::to_string(i);
     proc_config.thread_name += std::to_string(i);
+    if (proc_config.ev_thread_affinity) proc_config.ev_thread_index = i;
     processors_.push_back(std::make_unique<engine::TaskProcessor>(
         std::move(proc_config), libev_pool));
   }
@@ -1,5 +1,7 @@
 #include <userver/components/single_threaded_task_processors.hpp>
 
+#include <engine/ev/thread_pool.hpp>
+#include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/strong_typedef.hpp>
@@ -31,6 +33,13 @@ FourThreadIds GetArrayOfThreadIds(Pool& pool) {
   }};
 }
 
+const void* GetEventThread(engine::TaskProcessor& tp) {
+  return utils::Async(tp, "test", [] {
+           return static_cast<const void*>(
+               &engine::current_task::GetEventThread());
+         }).Get();
+}
+
 std::ostream& operator<<(std::ostream& os, FourThreadIds v) {
   return os << '[' << v[0] << ',' << v[1] << ',' << v[2] << ',' << v[3] << ']';
 }
@@ -60,4 +69,35 @@ UTEST_MT(SingleThreadedTaskprocessor, ConstructionWithoutComponentSystem, 2) {
   }
 }
 
+UTEST_MT(SingleThreadedTaskprocessor, EvThreadAffinity, 2) {
+  engine::TaskProcessorConfig config;
+  config.name = "test";
+  config.worker_threads = 2;
+  config.ev_thread_affinity = true;
+
+  Pool pool{config};
+  const auto* first_ev_thread = GetEventThread(pool.At(0));
+  const auto* second_ev_thread = GetEventThread(pool.At(1));
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(GetEventThread(pool.At(0)), first_ev_thread);
+    EXPECT_EQ(GetEventThread(pool.At(1)), second_ev_thread);
+  }
+
+  if (pool.At(0).EventThreadPool().GetSize() > 1) {
+    EXPECT_NE(first_ev_thread, second_ev_thread);
+  }
+}
+
+UTEST(SingleThreadedTaskprocessor, EvThreadAffinityRequiresSingleWorker) {
+  engine::TaskProcessorConfig config;
+  config.name = "test";
+  config.worker_threads = 2;
+  config.ev_thread_affinity = true;
+
+  UEXPECT_THROW(engine::TaskProcessor(
+                    config, engine::current_task::GetTaskProcessor()
+                                .GetTaskProcessorPools()),
+                std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
@@ -176,14 +176,11 @@ TaskProcessor& GetTaskProcessor() {
 }
 
 std::size_t GetStackSize() {
-  return GetTaskProcessor()
-      .GetTaskProcessorPools()
-      ->GetCoroPool()
-      .GetStackSize();
+  return GetTaskProcessor().GetCoroPool().GetStackSize();
 }
 
 ev::ThreadControl& GetEventThread() {
-  return GetTaskProcessor().EventThreadPool().NextThread();
+  return GetTaskProcessor().GetEventThread();
 }
 
 }  // namespace current_task
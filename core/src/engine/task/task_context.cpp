@@ -102,16 +102,20 @@ auto* const kFinishedDetachedToken =
 
 TaskContext::TaskContext(TaskProcessor& task_processor,
                          Task::Importance importance, Task::WaitMode wait_type,
-                         Deadline deadline,
+                         Deadline deadline, Task::Priority priority,
                          utils::impl::WrappedCallBase& payload)
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      priority_(priority),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
   UASSERT(payload_);
+  if (auto* profiler = task_processor_.GetTaskProfiler()) {
+    profile_ = profiler->MaybeStartProfile();
+  }
   LOG_TRACE() << "task with task_id="
               << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
               << " created task with task_id=" << ReadableTaskId(this)
@@ -210,6 +214,7 @@ void TaskContext::WaitUntil(Deadline deadline) const {
 
 void TaskContext::DoStep() {
   if (IsFinished()) return;
+  if (profile_) profile_->OnDequeued();
 
   SleepState::Flags clear_flags{SleepFlags::kSleeping};
   if (!coro_) {
@@ -243,6 +248,12 @@ void TaskContext::DoStep() {
           TaskCancellationReason::kNone) {
         GetTaskProcessor().GetTaskCounter().AccountTaskCancel();
       }
+      if (profile_) {
+        if (profile_->IsSampled()) {
+          task_processor_.GetTaskProfiler()->Account(*profile_);
+        }
+        profile_.reset();
+      }
       SetState(new_state);
       deadline_timer_.Finalize();
       finish_waiters_->WakeupAll();
@@ -480,6 +491,9 @@ class TaskContext::LocalStorageGuard {
 };
 
 void TaskContext::CoroFunc(TaskPipe& task_pipe) {
+  // Lives in the outermost frame of the coroutine stack
+  const char stack_marker{};
+
   for (TaskContext* context : task_pipe) {
     UASSERT(context);
     context->yield_reason_ = YieldReason::kNone;
@@ -523,6 +537,7 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
     context->ProfilerStopExecution();
 
     context->task_pipe_ = nullptr;
+    context->GetTaskProcessor().GetCoroPool().SampleStackUsage(&stack_marker);
   }
 }
 
@@ -662,7 +677,26 @@ void TaskContext::Schedule() {
   // NOTE: may be executed at this point
 }
 
+TaskProfile& TaskContext::GetOrCreateProfile() {
+  UASSERT(current_task::GetCurrentTaskContextUnchecked() == this);
+  if (!profile_) {
+    profile_ = std::make_unique<TaskProfile>(/*is_sampled=*/false);
+    profile_->OnExecutionStarted();
+  }
+  return *profile_;
+}
+
+std::chrono::nanoseconds TaskContext::GetCpuTime() {
+  return GetOrCreateProfile().GetRunningCpuTime();
+}
+
+std::uint64_t TaskContext::GetAllocatedBytes() {
+  return GetOrCreateProfile().GetRunningAllocatedBytes();
+}
+
 void TaskContext::ProfilerStartExecution() {
+  if (profile_) profile_->OnExecutionStarted();
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
     execute_started_ = std::chrono::steady_clock::now();
@@ -672,6 +706,8 @@ void TaskContext::ProfilerStartExecution() {
 }
 
 void TaskContext::ProfilerStopExecution() {
+  if (profile_) profile_->OnExecutionStopped();
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() <= 0) return;
 
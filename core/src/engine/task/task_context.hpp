@@ -3,6 +3,8 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include <ev.h>
@@ -16,9 +18,11 @@
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_counter.hpp>
+#include <engine/task/task_profiler.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
+#include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -61,7 +65,8 @@ class WaitStrategy {
   const Deadline deadline_;
 };
 
-class TaskContext final : public ContextAccessor {
+class alignas(kTaskContextAlignment) TaskContext final
+    : public ContextAccessor {
  public:
   struct NoEpoch {};
   using TaskPipe = coro::Pool<TaskContext>::TaskPipe;
@@ -79,7 +84,7 @@ class TaskContext final : public ContextAccessor {
   };
 
   TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline,
-              utils::impl::WrappedCallBase& payload);
+              Task::Priority, utils::impl::WrappedCallBase& payload);
 
   ~TaskContext() noexcept;
 
@@ -100,6 +105,9 @@ class TaskContext final : public ContextAccessor {
   // exceeding these limits causes task to become cancelled
   bool IsCritical() const;
 
+  // the priority lane of the task processor queue this task is scheduled to
+  Task::Priority GetPriority() const noexcept { return priority_; }
+
   // whether task is allowed to be awaited from multiple coroutines
   // simultaneously
   bool IsSharedWaitAllowed() const;
@@ -172,6 +180,37 @@ class TaskContext final : public ContextAccessor {
 
   void SetCancelDeadline(Deadline deadline);
 
+  // Must be called before the task is scheduled
+  void SetStartDeadline(Deadline deadline) noexcept {
+    start_deadline_ = deadline;
+  }
+
+  // Whether the task has not been started yet and its start deadline is
+  // reached. Must be called by the TaskProcessor right before running the task,
+  // only the first call may return true. The check is approximate, as it is
+  // done for every task with a start deadline.
+  bool ConsumeStartDeadlineReached() noexcept {
+    if (!start_deadline_.IsReachable()) return false;
+    return std::exchange(start_deadline_, Deadline{}).IsSurelyReachedApprox();
+  }
+
+  // Task profiler support, noops for the tasks that are not sampled
+  void ProfilerOnQueued() noexcept {
+    if (profile_) profile_->OnQueued();
+  }
+  void ProfilerSetSpanName(std::string_view name) {
+    if (profile_) profile_->SetNameIfMissing(name);
+  }
+
+  // Returns the CPU time of the task since the first call, or since the start
+  // of the task for the profiled tasks. Must be called by the task itself.
+  std::chrono::nanoseconds GetCpuTime();
+
+  // Returns the bytes allocated by the task since the first call of GetCpuTime
+  // or GetAllocatedBytes, or since the start of the task for the profiled
+  // tasks. Always 0 if jemalloc is disabled. Must be called by the task itself.
+  std::uint64_t GetAllocatedBytes();
+
   bool HasLocalStorage() const noexcept;
   task_local::Storage& GetLocalStorage() noexcept;
 
@@ -203,6 +242,7 @@ class TaskContext final : public ContextAccessor {
   void Schedule();
   static bool ShouldSchedule(SleepState::Flags flags, WakeupSource source);
 
+  TaskProfile& GetOrCreateProfile();
   void ProfilerStartExecution();
   void ProfilerStopExecution();
 
@@ -212,6 +252,7 @@ class TaskContext final : public ContextAccessor {
   TaskProcessor& task_processor_;
   TaskCounter::Token task_counter_token_;
   const bool is_critical_;
+  const Task::Priority priority_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
   EhGlobals eh_globals_;
@@ -226,6 +267,7 @@ class TaskContext final : public ContextAccessor {
 
   ContextTimer deadline_timer_;
   engine::Deadline cancel_deadline_;
+  engine::Deadline start_deadline_;
 
   // {} if not defined
   std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
@@ -233,6 +275,7 @@ class TaskContext final : public ContextAccessor {
   std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
   size_t trace_csw_left_;
+  std::unique_ptr<TaskProfile> profile_;
 
   AtomicSleepState sleep_state_{
       SleepState{SleepFlags::kSleeping, SleepState::Epoch{0}}};
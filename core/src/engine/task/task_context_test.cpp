@@ -3,6 +3,7 @@
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 
 #include <userver/engine/task/task_base.hpp>
@@ -94,4 +95,71 @@ UTEST(TaskContext, WaitListWakeupRace) {
             engine::impl::TaskContext::WakeupSource::kWaitList);
 }
 
+namespace {
+
+template <typename Function>
+auto MakeTaskWithStartDeadline(engine::Task::Importance importance,
+                               engine::Deadline start_deadline, Function f) {
+  return engine::impl::MakeTaskWithResult<engine::TaskWithResult>(
+      engine::impl::TaskConfig{engine::current_task::GetTaskProcessor(),
+                               importance,
+                               engine::Task::WaitMode::kSingleWaiter,
+                               engine::Deadline{},
+                               engine::Task::Priority::kNormal,
+                               start_deadline},
+      std::move(f));
+}
+
+}  // namespace
+
+UTEST(TaskContext, StartDeadlineReached) {
+  bool started = false;
+  auto task = MakeTaskWithStartDeadline(engine::Task::Importance::kNormal,
+                                        engine::Deadline::Passed(),
+                                        [&started] { started = true; });
+  UEXPECT_THROW(task.Get(), engine::TaskCancelledException);
+  EXPECT_FALSE(started);
+  EXPECT_EQ(task.CancellationReason(),
+            engine::TaskCancellationReason::kDeadline);
+}
+
+UTEST(TaskContext, StartDeadlineNotReached) {
+  bool started = false;
+  auto task = MakeTaskWithStartDeadline(
+      engine::Task::Importance::kNormal,
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime),
+      [&started] { started = true; });
+  UEXPECT_NO_THROW(task.Get());
+  EXPECT_TRUE(started);
+}
+
+UTEST(TaskContext, StartDeadlineCritical) {
+  bool started = false;
+  auto task = MakeTaskWithStartDeadline(engine::Task::Importance::kCritical,
+                                        engine::Deadline::Passed(),
+                                        [&started] { started = true; });
+  UEXPECT_NO_THROW(task.Get());
+  EXPECT_TRUE(started);
+}
+
+UTEST(TaskContext, StartDeadlineAfterStart) {
+  engine::SingleConsumerEvent started_event;
+  engine::SingleConsumerEvent deadline_passed_event;
+  const auto start_deadline =
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10});
+
+  auto task = MakeTaskWithStartDeadline(
+      engine::Task::Importance::kNormal, start_deadline, [&] {
+        started_event.Send();
+        // the start deadline does not cancel a running task
+        EXPECT_TRUE(deadline_passed_event.WaitForEvent());
+        EXPECT_FALSE(engine::current_task::ShouldCancel());
+      });
+
+  ASSERT_TRUE(started_event.WaitForEvent());
+  engine::SleepUntil(start_deadline);
+  deadline_passed_event.Send();
+  UEXPECT_NO_THROW(task.Get());
+}
+
 USERVER_NAMESPACE_END
@@ -103,6 +103,10 @@ Rate TaskCounter::GetCancelledTasksOverload() const noexcept {
   return GetApproximate(LocalCounterId::kCancelOverload);
 }
 
+Rate TaskCounter::GetCancelledTasksStartDeadline() const noexcept {
+  return GetApproximate(LocalCounterId::kCancelStartDeadline);
+}
+
 Rate TaskCounter::GetTasksOverload() const noexcept {
   return GetApproximate(LocalCounterId::kOverload);
 }
@@ -135,6 +139,10 @@ void TaskCounter::AccountTaskCancelOverload() noexcept {
   Increment(LocalCounterId::kCancelOverload);
 }
 
+void TaskCounter::AccountTaskCancelStartDeadline() noexcept {
+  Increment(LocalCounterId::kCancelStartDeadline);
+}
+
 void TaskCounter::AccountTaskOverload() noexcept {
   Increment(LocalCounterId::kOverload);
 }
@@ -43,6 +43,8 @@ class TaskCounter final {
 
   Rate GetCancelledTasksOverload() const noexcept;
 
+  Rate GetCancelledTasksStartDeadline() const noexcept;
+
   Rate GetTasksOverload() const noexcept;
 
   Rate GetTasksOverloadSensor() const noexcept;
@@ -59,6 +61,8 @@ class TaskCounter final {
 
   void AccountTaskCancelOverload() noexcept;
 
+  void AccountTaskCancelStartDeadline() noexcept;
+
   void AccountTaskOverload() noexcept;
 
   void AccountTaskOverloadSensor() noexcept;
@@ -92,6 +96,7 @@ class TaskCounter final {
     kSwitchSlow,
     kSpuriousWakeups,
     kCancelOverload,
+    kCancelStartDeadline,
     kOverload,
     kOverloadSensor,
     kNoOverloadSensor,
@@ -2,6 +2,7 @@
 
 #include <sys/types.h>
 #include <csignal>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -14,6 +15,8 @@
 #include <userver/utils/threads.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
+#include <engine/ev/thread_pool.hpp>
+#include <engine/impl/numa.hpp>
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
@@ -38,6 +41,24 @@ void SetTaskQueueWaitTimepoint(impl::TaskContext* context) {
   }
 }
 
+ev::ThreadControl* GetPinnedEvThread(const TaskProcessorConfig& config,
+                                     ev::ThreadPool& ev_thread_pool) {
+  if (!config.ev_thread_affinity) return nullptr;
+  if (config.worker_threads != 1) {
+    throw std::runtime_error(fmt::format(
+        "ev-thread-affinity of task processor '{}' requires a single worker "
+        "thread, got {}",
+        config.name, config.worker_threads));
+  }
+  if (config.ev_thread_index) {
+    return &ev_thread_pool.GetThread(*config.ev_thread_index %
+                                     ev_thread_pool.GetSize());
+  }
+  // Not NextThread(), that may return the same home ev thread of the
+  // current thread for all the task processors
+  return ev_thread_pool.NextThreads(1).front();
+}
+
 // Hooks are modified only before task processors created and only in main
 // thread, so it doesn't need any synchronization.
 std::vector<std::function<void()>>& ThreadStartedHooks() {
@@ -54,6 +75,19 @@ void EmitMagicNanosleep() {
   nanosleep(&ts, nullptr);
 }
 
+std::variant<TaskQueue, WorkStealingTaskQueue> MakeTaskQueue(
+    const TaskProcessorConfig& config) {
+  switch (config.task_queue) {
+    case TaskQueueType::kGlobalTaskQueue:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<TaskQueue>, config};
+    case TaskQueueType::kWorkStealingTaskQueue:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<WorkStealingTaskQueue>, config};
+  }
+  UINVARIANT(false, "Unexpected value of task_queue config option");
+}
+
 void TaskProcessorThreadStartedHook() {
   utils::impl::AssertStaticRegistrationFinished();
   (void)utils::DefaultRandom();
@@ -68,14 +102,34 @@ void TaskProcessorThreadStartedHook() {
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_counter_(config.worker_threads),
-      task_queue_(config),
+      task_queue_(MakeTaskQueue(config)),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      pools_(std::move(pools)),
+      coro_pool_(config_.coro_stack_size
+                     ? pools_->GetCoroPool(*config_.coro_stack_size)
+                     : pools_->GetCoroPool()),
+      worker_autoscaler_(config_.worker_autoscaling
+                             ? std::make_optional<impl::WorkerAutoscaler>(
+                                   *config_.worker_autoscaling,
+                                   config_.worker_threads)
+                             : std::nullopt),
+      active_workers_(config_.worker_threads),
+      task_profiler_(config_.task_profiler_every
+                         ? std::make_unique<impl::TaskProfiler>(
+                               config_.task_profiler_every)
+                         : nullptr),
+      pinned_ev_thread_(GetPinnedEvThread(config_, pools_->EventThreadPool())) {
   utils::impl::FinishStaticRegistration();
   try {
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
-               << " thread_name=" << config_.thread_name;
+               << " thread_name=" << config_.thread_name
+               << " task_queue=" << ToString(config_.task_queue)
+               << " numa_sharding=" << config_.numa_sharding
+               << " task_priorities=" << config_.task_priorities.has_value()
+               << " worker_autoscaling=" << worker_autoscaler_.has_value()
+               << " coro_stack_size=" << coro_pool_.GetStackSize()
+               << " task_profiler_every=" << config_.task_profiler_every;
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
@@ -83,14 +137,23 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
       workers_.emplace_back([this, i, &workers_left] {
         PrepareWorkerThread(i);
         workers_left.count_down();
-        ProcessTasks();
+        ProcessTasks(i);
       });
     }
 
     cpu_stats_storage_ =
         std::make_unique<utils::statistics::ThreadPoolCpuStatsStorage>(
             workers_);
+    if (worker_autoscaler_) {
+      autoscaling_cpu_stats_ =
+          std::make_unique<utils::statistics::ThreadPoolCpuStatsStorage>(
+              workers_);
+    }
     workers_left.wait();
+    if (worker_autoscaler_) {
+      // Not driven by the tasks, so that the idle workers are parked as well
+      autoscaling_thread_ = std::thread([this] { RunWorkerAutoscaling(); });
+    }
   } catch (...) {
     Cleanup();
     throw;
@@ -105,7 +168,14 @@ void TaskProcessor::Cleanup() noexcept {
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustion();
 
-  task_queue_.StopProcessing();
+  {
+    std::lock_guard lock{parking_mutex_};
+    is_parking_stopped_ = true;
+  }
+  parking_cv_.notify_all();
+  if (autoscaling_thread_.joinable()) autoscaling_thread_.join();
+
+  std::visit([](auto& queue) { queue.StopProcessing(); }, task_queue_);
 
   for (auto& w : workers_) {
     w.join();
@@ -135,20 +205,43 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
     context->RequestCancel(TaskCancellationReason::kShutdown);
 
   SetTaskQueueWaitTimepoint(context);
+  context->ProfilerOnQueued();
 
-  task_queue_.Push(context);
+  std::visit([context](auto& queue) { queue.Push(context); }, task_queue_);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
   detached_contexts_->Add(context);
 }
 
+size_t TaskProcessor::GetTaskQueueSize() const {
+  return std::visit(
+      [](const auto& queue) { return queue.GetSizeApproximate(); },
+      task_queue_);
+}
+
+size_t TaskProcessor::GetActiveWorkerCount() const noexcept {
+  return active_workers_.load(std::memory_order_relaxed);
+}
+
+std::optional<TaskPriorityLaneStats> TaskProcessor::GetPriorityLaneStats(
+    Task::Priority priority) const {
+  const auto* queue = std::get_if<TaskQueue>(&task_queue_);
+  if (!queue || !queue->HasPriorityLanes()) return std::nullopt;
+  return queue->GetPriorityLaneStats(priority);
+}
+
 ev::ThreadPool& TaskProcessor::EventThreadPool() {
   return pools_->EventThreadPool();
 }
 
+ev::ThreadControl& TaskProcessor::GetEventThread() {
+  if (pinned_ev_thread_) return *pinned_ev_thread_;
+  return EventThreadPool().NextThread();
+}
+
 impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() {
-  return {pools_->GetCoroPool().GetCoroutine(), *this};
+  return {coro_pool_.GetCoroutine(), *this};
 }
 
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
@@ -243,17 +336,43 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
   impl::SetLocalTaskCounterData(task_counter_, index);
+  ev::SetCurrentThreadHomeIndex(index);
+  if (auto* queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+    queue->PrepareWorker(index);
+    if (config_.numa_sharding) {
+      const auto node = queue->GetWorkerNumaNode(index);
+      try {
+        impl::BindCurrentThreadToNumaNode(node);
+      } catch (const std::exception& ex) {
+        LOG_ERROR() << "Failed to bind worker " << index
+                    << " of task processor " << Name() << " to NUMA node "
+                    << node << ": " << ex;
+      }
+      impl::SetCurrentThreadNumaNode(node);
+    }
+  }
 
   TaskProcessorThreadStartedHook();
 }
 
-void TaskProcessor::ProcessTasks() noexcept {
+void TaskProcessor::ProcessTasks(std::size_t index) noexcept {
+  std::visit([this, index](auto& queue) { ProcessTasks(queue, index); },
+             task_queue_);
+}
+
+template <typename Queue>
+void TaskProcessor::ProcessTasks(Queue& task_queue,
+                                 std::size_t index) noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    if (worker_autoscaler_) ParkWorkerIfNeeded(index);
+
+    auto context = task_queue.PopBlocking();
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
+    if (worker_autoscaler_) AccountAutoscalingWaitTime(*context);
     CheckWaitTime(*context);
+    CheckStartDeadline(*context);
 
     bool has_failed = false;
     try {
@@ -269,6 +388,70 @@ void TaskProcessor::ProcessTasks() noexcept {
   }
 }
 
+void TaskProcessor::ParkWorkerIfNeeded(std::size_t index) {
+  if (index < active_workers_.load(std::memory_order_relaxed)) return;
+
+  std::unique_lock lock{parking_mutex_};
+  parking_cv_.wait(lock, [this, index] {
+    return is_parking_stopped_ || index < active_workers_.load();
+  });
+}
+
+void TaskProcessor::RunWorkerAutoscaling() {
+  UASSERT(worker_autoscaler_);
+  std::unique_lock lock{parking_mutex_};
+  while (!parking_cv_.wait_for(lock, worker_autoscaler_->GetCheckInterval(),
+                               [this] { return is_parking_stopped_; })) {
+    lock.unlock();
+    CheckWorkerAutoscaling();
+    lock.lock();
+  }
+}
+
+void TaskProcessor::CheckWorkerAutoscaling() {
+  UASSERT(worker_autoscaler_);
+  const auto active_workers = GetActiveWorkerCount();
+  const auto load = autoscaling_cpu_stats_->CollectCurrentLoadPct();
+  std::size_t total_load = 0;
+  for (std::size_t i = 0; i < active_workers && i < load.size(); ++i) {
+    total_load += load[i];
+  }
+  const auto average_load =
+      total_load / std::max<std::size_t>(active_workers, 1);
+  const auto max_wait_time = autoscaling_max_wait_time_.exchange({});
+
+  const auto new_active_workers = worker_autoscaler_->Evaluate(
+      active_workers, max_wait_time, static_cast<std::uint8_t>(average_load));
+  if (new_active_workers != active_workers) {
+    LOG_INFO() << "Changing active worker count of task processor " << Name()
+               << " from " << active_workers << " to " << new_active_workers
+               << ", max queue wait time=" << max_wait_time.count()
+               << "us, average load=" << average_load << "%";
+    SetActiveWorkerCount(new_active_workers);
+  }
+}
+
+void TaskProcessor::AccountAutoscalingWaitTime(
+    const impl::TaskContext& context) noexcept {
+  const auto wait_timepoint = context.GetQueueWaitTimepoint();
+  if (wait_timepoint == std::chrono::steady_clock::time_point()) return;
+
+  const auto wait_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - wait_timepoint);
+  // A lost race only loses a sample, the next one will likely be close
+  if (wait_time > autoscaling_max_wait_time_.load(std::memory_order_relaxed)) {
+    autoscaling_max_wait_time_.store(wait_time, std::memory_order_relaxed);
+  }
+}
+
+void TaskProcessor::SetActiveWorkerCount(std::size_t count) {
+  {
+    std::lock_guard lock{parking_mutex_};
+    active_workers_ = count;
+  }
+  parking_cv_.notify_all();
+}
+
 void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
   const auto max_wait_time = max_task_queue_wait_time_.load();
   const auto sensor_wait_time = sensor_task_queue_wait_time_.load();
@@ -332,6 +515,16 @@ void TaskProcessor::HandleOverload(impl::TaskContext& context) {
   }
 }
 
+void TaskProcessor::CheckStartDeadline(impl::TaskContext& context) {
+  if (!context.ConsumeStartDeadlineReached() || context.IsCritical()) return;
+
+  LOG_LIMITED_INFO() << "Task with task_id="
+                     << logging::HexShort(context.GetTaskId())
+                     << " reached its start deadline in queue, cancelling.";
+  context.RequestCancel(TaskCancellationReason::kDeadline);
+  GetTaskCounter().AccountTaskCancelStartDeadline();
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -12,7 +17,10 @@
 #include <concurrent/impl/interference_shield.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <engine/task/task_profiler.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/work_stealing_task_queue.hpp>
+#include <engine/task/worker_autoscaler.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
@@ -28,7 +36,13 @@ class TaskProcessorPools;
 class CountedCoroutinePtr;
 }  // namespace impl
 
+namespace coro {
+template <typename Task>
+class Pool;
+}  // namespace coro
+
 namespace ev {
+class ThreadControl;
 class ThreadPool;
 }  // namespace ev
 
@@ -47,26 +61,53 @@ class TaskProcessor final {
 
   ev::ThreadPool& EventThreadPool();
 
+  /// The ev thread for the new I/O watchers, the same one for all of them
+  /// with `ev-thread-affinity`
+  ev::ThreadControl& GetEventThread();
+
   std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() {
     return pools_;
   }
 
+  /// The pool of the `coro-stack-size` class
+  coro::Pool<impl::TaskContext>& GetCoroPool() noexcept { return coro_pool_; }
+
   const std::string& Name() const { return config_.name; }
 
   impl::TaskCounter& GetTaskCounter() noexcept { return task_counter_; }
 
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
-  size_t GetTaskQueueSize() const { return task_queue_.GetSizeApproximate(); }
+  size_t GetTaskQueueSize() const;
+
+  /// Returns std::nullopt if the task processor has no `task-priorities`
+  std::optional<TaskPriorityLaneStats> GetPriorityLaneStats(
+      Task::Priority priority) const;
 
   size_t GetWorkerCount() const { return workers_.size(); }
 
+  bool HasWorkerAutoscaling() const noexcept {
+    return worker_autoscaler_.has_value();
+  }
+
+  /// Number of the workers that are not parked by `worker-autoscaling`
+  size_t GetActiveWorkerCount() const noexcept;
+
   void SetSettings(const TaskProcessorSettings& settings);
 
   std::chrono::microseconds GetProfilerThreshold() const;
 
   bool ShouldProfilerForceStacktrace() const;
 
+  /// Returns nullptr if the task processor has no `task-profiler`
+  impl::TaskProfiler* GetTaskProfiler() noexcept {
+    return task_profiler_.get();
+  }
+
+  const impl::TaskProfiler* GetTaskProfiler() const noexcept {
+    return task_profiler_.get();
+  }
+
   size_t GetTaskTraceMaxCswForNewTask() const;
 
   const std::string& GetTaskTraceLoggerName() const;
@@ -82,7 +123,20 @@ class TaskProcessor final {
 
   void PrepareWorkerThread(std::size_t index) noexcept;
 
-  void ProcessTasks() noexcept;
+  void ProcessTasks(std::size_t index) noexcept;
+
+  template <typename Queue>
+  void ProcessTasks(Queue& task_queue, std::size_t index) noexcept;
+
+  void ParkWorkerIfNeeded(std::size_t index);
+
+  void RunWorkerAutoscaling();
+
+  void CheckWorkerAutoscaling();
+
+  void AccountAutoscalingWaitTime(const impl::TaskContext& context) noexcept;
+
+  void SetActiveWorkerCount(std::size_t count);
 
   void CheckWaitTime(impl::TaskContext& context);
 
@@ -90,15 +144,18 @@ class TaskProcessor final {
 
   void HandleOverload(impl::TaskContext& context);
 
+  void CheckStartDeadline(impl::TaskContext& context);
+
   impl::TaskCounter task_counter_;
   concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock>
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<std::atomic<bool>>
       task_queue_wait_time_overloaded_{false};
-  TaskQueue task_queue_;
+  std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  coro::Pool<impl::TaskContext>& coro_pool_;
   std::vector<std::thread> workers_;
   logging::LoggerPtr task_trace_logger_{nullptr};
 
@@ -115,6 +172,22 @@ class TaskProcessor final {
 
   std::unique_ptr<utils::statistics::ThreadPoolCpuStatsStorage>
       cpu_stats_storage_{nullptr};
+
+  const std::optional<impl::WorkerAutoscaler> worker_autoscaler_;
+  // A separate storage, as the main one is owned by TaskProcessorsLoadMonitor
+  std::unique_ptr<utils::statistics::ThreadPoolCpuStatsStorage>
+      autoscaling_cpu_stats_{nullptr};
+  std::atomic<std::size_t> active_workers_{0};
+  std::atomic<std::chrono::microseconds> autoscaling_max_wait_time_{{}};
+  std::mutex parking_mutex_;
+  // Also wakes up the autoscaling_thread_ on shutdown
+  std::condition_variable parking_cv_;
+  bool is_parking_stopped_{false};
+  // Re-evaluates the active worker count every check-interval
+  std::thread autoscaling_thread_;
+
+  const std::unique_ptr<impl::TaskProfiler> task_profiler_;
+  ev::ThreadControl* const pinned_ev_thread_;
 };
 
 /// Register a function that runs on all threads on task processor creation.
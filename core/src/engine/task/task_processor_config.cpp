@@ -31,6 +31,25 @@ std::string GenerateWorkerThreadName(std::string_view tp_name) {
       tp_name));
 }
 
+constexpr utils::TrivialBiMap kTaskQueueTypeMap([](auto selector) {
+  return selector()
+      .Case(TaskQueueType::kGlobalTaskQueue, "global")
+      .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing");
+});
+
+constexpr std::size_t kMaxTaskPriorityWeight = 100;
+
+std::size_t ParseTaskPriorityWeight(const yaml_config::YamlConfig& value,
+                                    std::size_t default_weight) {
+  const auto weight = value.As<std::size_t>(default_weight);
+  if (weight == 0 || weight > kMaxTaskPriorityWeight) {
+    throw std::runtime_error(
+        fmt::format("Task priority weight at '{}' must be in range [1, {}]",
+                    value.GetPath(), kMaxTaskPriorityWeight));
+  }
+  return weight;
+}
+
 }  // namespace
 
 OsScheduling Parse(const yaml_config::YamlConfig& value,
@@ -45,6 +64,51 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  return utils::ParseFromValueString(value, kTaskQueueTypeMap);
+}
+
+std::string_view ToString(TaskQueueType task_queue_type) {
+  return utils::impl::EnumToStringView(task_queue_type, kTaskQueueTypeMap);
+}
+
+TaskPriorityWeights Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<TaskPriorityWeights>) {
+  TaskPriorityWeights result;
+  auto& weights = result.weights;
+  weights[0] = ParseTaskPriorityWeight(value["high"], weights[0]);
+  weights[1] = ParseTaskPriorityWeight(value["normal"], weights[1]);
+  weights[2] = ParseTaskPriorityWeight(value["low"], weights[2]);
+  return result;
+}
+
+WorkerAutoscalingConfig Parse(const yaml_config::YamlConfig& value,
+                              formats::parse::To<WorkerAutoscalingConfig>) {
+  WorkerAutoscalingConfig config;
+  config.min_workers = value["min-workers"].As<std::size_t>();
+  config.check_interval =
+      value["check-interval"].As<std::chrono::milliseconds>(
+          config.check_interval);
+  config.scale_up_wait_time =
+      value["scale-up-wait-time"].As<std::chrono::milliseconds>(
+          config.scale_up_wait_time);
+  const auto load_percent =
+      value["scale-down-load-percent"].As<std::size_t>(
+          config.scale_down_load_percent);
+
+  if (config.min_workers == 0 || config.check_interval.count() <= 0 ||
+      load_percent > 100) {
+    throw std::runtime_error(fmt::format(
+        "Invalid worker autoscaling config at '{}': min-workers and "
+        "check-interval must be positive, scale-down-load-percent must not "
+        "exceed 100",
+        value.GetPath()));
+  }
+  config.scale_down_load_percent = static_cast<std::uint8_t>(load_percent);
+  return config;
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
@@ -56,6 +120,53 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.task_queue =
+      value["task-queue"].As<TaskQueueType>(config.task_queue);
+  config.numa_sharding =
+      value["numa-sharding"].As<bool>(config.numa_sharding);
+  if (config.numa_sharding &&
+      config.task_queue != TaskQueueType::kWorkStealingTaskQueue) {
+    throw std::runtime_error(fmt::format(
+        "numa-sharding requires 'task-queue: work-stealing' at '{}'",
+        value.GetPath()));
+  }
+  config.task_priorities =
+      value["task-priorities"].As<std::optional<TaskPriorityWeights>>();
+  if (config.task_priorities &&
+      config.task_queue != TaskQueueType::kGlobalTaskQueue) {
+    throw std::runtime_error(fmt::format(
+        "task-priorities require 'task-queue: global' at '{}'",
+        value.GetPath()));
+  }
+  config.worker_autoscaling =
+      value["worker-autoscaling"].As<std::optional<WorkerAutoscalingConfig>>();
+  if (config.worker_autoscaling) {
+    if (config.task_queue != TaskQueueType::kGlobalTaskQueue) {
+      throw std::runtime_error(fmt::format(
+          "worker-autoscaling requires 'task-queue: global' at '{}'",
+          value.GetPath()));
+    }
+    if (config.worker_autoscaling->min_workers > config.worker_threads) {
+      throw std::runtime_error(fmt::format(
+          "worker-autoscaling.min-workers must not exceed worker_threads at "
+          "'{}'",
+          value.GetPath()));
+    }
+  }
+
+  config.coro_stack_size =
+      value["coro-stack-size"].As<std::optional<std::size_t>>();
+  config.ev_thread_affinity =
+      value["ev-thread-affinity"].As<bool>(config.ev_thread_affinity);
+
+  const auto task_profiler = value["task-profiler"];
+  if (!task_profiler.IsMissing()) {
+    config.task_profiler_every = task_profiler["every"].As<std::size_t>(1000);
+    if (config.task_profiler_every == 0) {
+      throw std::runtime_error(fmt::format(
+          "task-profiler.every must be positive at '{}'", value.GetPath()));
+    }
+  }
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -21,6 +24,38 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobalTaskQueue,
+  kWorkStealingTaskQueue,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
+std::string_view ToString(TaskQueueType task_queue_type);
+
+/// Number of engine::Task::Priority values
+inline constexpr std::size_t kTaskPrioritiesCount = 3;
+
+/// Dequeue weights of the priority lanes, indexed by engine::Task::Priority
+struct TaskPriorityWeights {
+  std::array<std::size_t, kTaskPrioritiesCount> weights{4, 2, 1};
+};
+
+TaskPriorityWeights Parse(const yaml_config::YamlConfig& value,
+                          formats::parse::To<TaskPriorityWeights>);
+
+/// Limits and thresholds of the worker count autoscaling
+struct WorkerAutoscalingConfig {
+  std::size_t min_workers{1};
+  std::chrono::milliseconds check_interval{1000};
+  std::chrono::milliseconds scale_up_wait_time{1};
+  std::uint8_t scale_down_load_percent{50};
+};
+
+WorkerAutoscalingConfig Parse(const yaml_config::YamlConfig& value,
+                              formats::parse::To<WorkerAutoscalingConfig>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,6 +64,21 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{10000};
+  TaskQueueType task_queue{TaskQueueType::kGlobalTaskQueue};
+  bool numa_sharding{false};
+  std::optional<TaskPriorityWeights> task_priorities;
+  std::optional<WorkerAutoscalingConfig> worker_autoscaling;
+  // Selects the coroutine stack size class, coro_pool.stack_size if not set
+  std::optional<std::size_t> coro_stack_size;
+  // Registers all the I/O watchers of the tasks on a single ev thread,
+  // requires a single worker
+  bool ev_thread_affinity{false};
+  // The ev thread for ev_thread_affinity, set by
+  // SingleThreadedTaskProcessorsPool to spread its processors over ev threads
+  std::optional<std::size_t> ev_thread_index;
+
+  // Every N-th task is profiled, 0 disables the task profiler
+  std::size_t task_profiler_every{0};
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
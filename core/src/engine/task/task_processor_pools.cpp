@@ -1,7 +1,11 @@
 #include <engine/task/task_processor_pools.hpp>
 
+#include <algorithm>
+#include <stdexcept>
 #include <utility>
 
+#include <fmt/format.h>
+
 #include <engine/task/task_context.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -10,11 +14,34 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+std::vector<std::size_t> GetExtraStackSizes(const coro::PoolConfig& config) {
+  auto result = config.stack_size_classes;
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  result.erase(std::remove(result.begin(), result.end(), config.stack_size),
+               result.end());
+  return result;
+}
+
+}  // namespace
+
 TaskProcessorPools::TaskProcessorPools(coro::PoolConfig coro_pool_config,
                                        ev::ThreadPoolConfig ev_pool_config)
-    : coro_pool_(std::move(coro_pool_config), &TaskContext::CoroFunc),
+    : coro_pool_(coro_pool_config, &TaskContext::CoroFunc),
       event_thread_pool_(std::move(ev_pool_config),
                          ev::ThreadPool::kUseDefaultEvLoop) {
+  for (const auto stack_size : GetExtraStackSizes(coro_pool_config)) {
+    auto config = coro_pool_config;
+    config.stack_size = stack_size;
+    config.stack_size_classes.clear();
+    // Coroutines of non-default classes are created on demand
+    config.initial_size = 0;
+    extra_coro_pools_.push_back(
+        std::make_unique<CoroPool>(std::move(config), &TaskContext::CoroFunc));
+  }
+
   const bool old_value =
       std::exchange(logging::impl::has_background_threads_which_can_log, true);
   UASSERT_MSG(!old_value,
@@ -28,6 +55,43 @@ TaskProcessorPools::~TaskProcessorPools() {
   UASSERT(old_value);
 }
 
+TaskProcessorPools::CoroPool& TaskProcessorPools::GetCoroPool(
+    std::size_t stack_size) {
+  CoroPool* result = nullptr;
+  const auto consider = [&](CoroPool& pool) {
+    if (pool.GetStackSize() < stack_size) return;
+    if (!result || pool.GetStackSize() < result->GetStackSize()) {
+      result = &pool;
+    }
+  };
+
+  consider(coro_pool_);
+  for (auto& pool : extra_coro_pools_) consider(*pool);
+
+  if (!result) {
+    throw std::runtime_error(fmt::format(
+        "No coroutine stack size class fits {} bytes, add it to "
+        "coro_pool.stack_size_classes",
+        stack_size));
+  }
+  return *result;
+}
+
+std::vector<const TaskProcessorPools::CoroPool*>
+TaskProcessorPools::GetCoroPools() const {
+  std::vector<const CoroPool*> result;
+  result.reserve(extra_coro_pools_.size() + 1);
+  result.push_back(&coro_pool_);
+  for (const auto& pool : extra_coro_pools_) result.push_back(pool.get());
+  return result;
+}
+
+coro::PoolStats TaskProcessorPools::GetCoroPoolStats() const {
+  auto stats = coro_pool_.GetStats();
+  for (const auto& pool : extra_coro_pools_) stats += pool->GetStats();
+  return stats;
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
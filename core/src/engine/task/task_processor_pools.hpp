@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include <engine/coro/pool.hpp>
 #include <engine/ev/thread_pool.hpp>
 
@@ -19,10 +22,24 @@ class TaskProcessorPools final {
   ~TaskProcessorPools();
 
   CoroPool& GetCoroPool() { return coro_pool_; }
+
+  /// Returns the pool of the smallest stack size class that fits
+  /// `stack_size`.
+  /// @throws std::runtime_error if there is no such class
+  CoroPool& GetCoroPool(std::size_t stack_size);
+
+  /// Pools of all the stack size classes, the default one goes first
+  std::vector<const CoroPool*> GetCoroPools() const;
+
+  /// Summed over all the stack size classes
+  coro::PoolStats GetCoroPoolStats() const;
+
   ev::ThreadPool& EventThreadPool() { return event_thread_pool_; }
 
  private:
   CoroPool coro_pool_;
+  // Sorted by stack size
+  std::vector<std::unique_ptr<CoroPool>> extra_coro_pools_;
   ev::ThreadPool event_thread_pool_;
 };
 
@@ -0,0 +1,93 @@
+#include <engine/task/task_processor_pools.hpp>
+
+#include <cstdint>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/task/task_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kKb = 1024;
+
+std::shared_ptr<engine::impl::TaskProcessorPools> MakePools() {
+  engine::coro::PoolConfig coro_config;
+  coro_config.initial_size = 1;
+  coro_config.max_size = 10;
+  coro_config.stack_size = 256 * kKb;
+  coro_config.stack_size_classes = {1024 * kKb, 64 * kKb, 256 * kKb};
+  coro_config.stack_usage_sampling_period = 1;
+
+  engine::ev::ThreadPoolConfig ev_config;
+  ev_config.threads = 1;
+
+  return std::make_shared<engine::impl::TaskProcessorPools>(
+      std::move(coro_config), std::move(ev_config));
+}
+
+__attribute__((noinline)) void TouchStack(std::size_t bytes) {
+  constexpr std::size_t kPage = 4 * kKb;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  volatile char buffer[kPage];
+  buffer[0] = 1;
+  if (bytes > kPage) TouchStack(bytes - kPage);
+  buffer[kPage - 1] = buffer[0];
+}
+
+std::uint64_t CountSamplesAbove(utils::statistics::HistogramView histogram,
+                                double bound) {
+  std::uint64_t result = histogram.GetValueAtInf();
+  for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+    if (histogram.GetUpperBoundAt(i) > bound) {
+      result += histogram.GetValueAt(i);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TaskProcessorPools, StackSizeClasses) {
+  const auto pools = MakePools();
+
+  ASSERT_EQ(pools->GetCoroPools().size(), 3);
+  EXPECT_EQ(pools->GetCoroPool().GetStackSize(), 256 * kKb);
+  EXPECT_EQ(pools->GetCoroPool(1).GetStackSize(), 64 * kKb);
+  EXPECT_EQ(pools->GetCoroPool(64 * kKb).GetStackSize(), 64 * kKb);
+  EXPECT_EQ(pools->GetCoroPool(100 * kKb).GetStackSize(), 256 * kKb);
+  EXPECT_EQ(pools->GetCoroPool(512 * kKb).GetStackSize(), 1024 * kKb);
+  EXPECT_ANY_THROW(pools->GetCoroPool(2048 * kKb));
+}
+
+TEST(TaskProcessorPools, StackUsageSampling) {
+  const auto pools = MakePools();
+
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "deep-worker";
+  config.coro_stack_size = 1024 * kKb;
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(std::move(config), pools)};
+
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+    EXPECT_EQ(engine::current_task::GetStackSize(), 1024 * kKb);
+    TouchStack(512 * kKb);
+  });
+
+  const auto& deep_pool = pools->GetCoroPool(1024 * kKb);
+  EXPECT_GE(CountSamplesAbove(deep_pool.GetStackUsage(), 512), 1);
+  EXPECT_EQ(CountSamplesAbove(pools->GetCoroPool().GetStackUsage(), 0), 0);
+
+  EXPECT_GE(deep_pool.GetStats().max_stack_usage, 512 * kKb);
+  EXPECT_LE(deep_pool.GetStats().max_stack_usage, 1024 * kKb);
+  EXPECT_EQ(pools->GetCoroPool().GetStats().max_stack_usage, 0);
+  EXPECT_EQ(pools->GetCoroPoolStats().max_stack_usage,
+            deep_pool.GetStats().max_stack_usage);
+}
+
+USERVER_NAMESPACE_END
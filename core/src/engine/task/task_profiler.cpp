@@ -0,0 +1,172 @@
+#include <engine/task/task_profiler.hpp>
+
+#include <time.h>
+
+#include <algorithm>
+
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+// Bounds the memory and the metrics cardinality for the services that use
+// unique span names
+constexpr std::size_t kMaxNames = 256;
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t created_tasks = 0;
+
+std::chrono::nanoseconds GetThreadCpuTime() noexcept {
+  struct timespec ts {};
+  ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+std::uint64_t ToMicroseconds(std::chrono::nanoseconds duration) noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+USERVER_PREVENT_TLS_CACHING bool ShouldSampleNewTask(
+    std::size_t period) noexcept {
+  // Crude, but avoids contention on a shared counter
+  return ++created_tasks % period == 0;
+}
+
+TaskProfileStats Subtract(const TaskProfileStats& total,
+                          const TaskProfileStats& base) noexcept {
+  return {total.tasks - base.tasks, total.cpu_time_us - base.cpu_time_us,
+          total.context_switches - base.context_switches,
+          total.queue_wait_us - base.queue_wait_us};
+}
+
+void SortByCpuTime(TaskProfiler::Stats& stats) {
+  std::sort(stats.begin(), stats.end(), [](const auto& x, const auto& y) {
+    return x.second.cpu_time_us > y.second.cpu_time_us;
+  });
+}
+
+}  // namespace
+
+TaskProfile::TaskProfile(bool is_sampled) noexcept
+    : is_sampled_(is_sampled) {}
+
+void TaskProfile::OnQueued() noexcept {
+  queued_at_ = std::chrono::steady_clock::now();
+}
+
+void TaskProfile::OnDequeued() noexcept {
+  if (queued_at_ == std::chrono::steady_clock::time_point{}) return;
+  queue_wait_ += std::chrono::steady_clock::now() - queued_at_;
+  queued_at_ = {};
+}
+
+void TaskProfile::OnExecutionStarted() noexcept {
+  execution_started_cpu_time_ = GetThreadCpuTime();
+  execution_started_allocated_bytes_ =
+      utils::jemalloc::GetThreadAllocatedBytes();
+}
+
+void TaskProfile::OnExecutionStopped() noexcept {
+  // The task may be resumed on another thread, so the CPU time is only
+  // comparable within a single execution slice
+  cpu_time_ += GetThreadCpuTime() - execution_started_cpu_time_;
+  allocated_bytes_ += utils::jemalloc::GetThreadAllocatedBytes() -
+                      execution_started_allocated_bytes_;
+  ++execution_slices_;
+}
+
+void TaskProfile::SetNameIfMissing(std::string_view name) {
+  if (name_.empty()) name_ = name;
+}
+
+std::chrono::nanoseconds TaskProfile::GetRunningCpuTime() const noexcept {
+  return cpu_time_ + (GetThreadCpuTime() - execution_started_cpu_time_);
+}
+
+std::uint64_t TaskProfile::GetRunningAllocatedBytes() const noexcept {
+  return allocated_bytes_ + (utils::jemalloc::GetThreadAllocatedBytes() -
+                             execution_started_allocated_bytes_);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TaskProfileStats& stats) {
+  writer["tasks"] = stats.tasks;
+  writer["cpu-time-us"] = stats.cpu_time_us;
+  writer["context-switches"] = stats.context_switches;
+  writer["queue-wait-us"] = stats.queue_wait_us;
+}
+
+TaskProfiler::TaskProfiler(std::size_t sampling_period)
+    : sampling_period_(sampling_period) {
+  UINVARIANT(sampling_period_ > 0, "Task profiler sampling period must be > 0");
+}
+
+std::unique_ptr<TaskProfile> TaskProfiler::MaybeStartProfile() {
+  if (!ShouldSampleNewTask(sampling_period_)) return nullptr;
+  return std::make_unique<TaskProfile>();
+}
+
+void TaskProfiler::Account(const TaskProfile& profile) {
+  std::string_view name = profile.name_;
+  if (name.empty()) name = kUnnamed;
+
+  const std::lock_guard lock{mutex_};
+  auto it = stats_.find(std::string{name});
+  if (it == stats_.end()) {
+    if (stats_.size() >= kMaxNames) name = kOtherName;
+    it = stats_.try_emplace(std::string{name}).first;
+  }
+
+  auto& stats = it->second;
+  ++stats.tasks;
+  stats.cpu_time_us += ToMicroseconds(profile.cpu_time_);
+  // The last execution slice ends with the task completion
+  if (profile.execution_slices_ > 0) {
+    stats.context_switches += profile.execution_slices_ - 1;
+  }
+  stats.queue_wait_us += ToMicroseconds(profile.queue_wait_);
+}
+
+TaskProfiler::Stats TaskProfiler::GetStats() const {
+  Stats result;
+  {
+    const std::lock_guard lock{mutex_};
+    result.assign(stats_.begin(), stats_.end());
+  }
+
+  SortByCpuTime(result);
+  return result;
+}
+
+TaskProfiler::Stats TaskProfiler::GetStatsSinceReset() const {
+  Stats result;
+  {
+    const std::lock_guard lock{mutex_};
+    for (const auto& [name, total] : stats_) {
+      const auto it = reset_stats_.find(name);
+      const auto stats =
+          it == reset_stats_.end() ? total : Subtract(total, it->second);
+      if (stats.tasks == 0) continue;
+      result.emplace_back(name, stats);
+    }
+  }
+
+  SortByCpuTime(result);
+  return result;
+}
+
+void TaskProfiler::Reset() {
+  const std::lock_guard lock{mutex_};
+  reset_stats_ = stats_;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Resource usage of a single profiled task, owned by its TaskContext
+class TaskProfile final {
+ public:
+  /// @param is_sampled whether the profile should be accounted by the
+  /// TaskProfiler, the unsampled profiles only measure the CPU time
+  explicit TaskProfile(bool is_sampled = true) noexcept;
+
+  void OnQueued() noexcept;
+  void OnDequeued() noexcept;
+
+  void OnExecutionStarted() noexcept;
+  void OnExecutionStopped() noexcept;
+
+  /// The first span of the task names it
+  void SetNameIfMissing(std::string_view name);
+
+  bool IsSampled() const noexcept { return is_sampled_; }
+
+  /// The CPU time of the task, must be called by the running task itself
+  std::chrono::nanoseconds GetRunningCpuTime() const noexcept;
+
+  /// The bytes allocated by the task, always 0 if jemalloc is disabled. Must
+  /// be called by the running task itself
+  std::uint64_t GetRunningAllocatedBytes() const noexcept;
+
+ private:
+  friend class TaskProfiler;
+
+  const bool is_sampled_;
+  std::string name_;
+  std::chrono::steady_clock::time_point queued_at_;
+  std::chrono::nanoseconds queue_wait_{0};
+  std::chrono::nanoseconds execution_started_cpu_time_{0};
+  std::chrono::nanoseconds cpu_time_{0};
+  std::uint64_t execution_started_allocated_bytes_{0};
+  std::uint64_t allocated_bytes_{0};
+  std::uint64_t execution_slices_{0};
+};
+
+/// Aggregated resource usage of the profiled tasks with the same span name
+struct TaskProfileStats final {
+  std::uint64_t tasks{0};
+  std::uint64_t cpu_time_us{0};
+  std::uint64_t context_switches{0};
+  std::uint64_t queue_wait_us{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TaskProfileStats& stats);
+
+/// @brief Samples the tasks of a task processor and aggregates their CPU time,
+/// context switches and queue wait time by the name of their first span.
+///
+/// Only every N-th task is profiled, so the overhead of the unsampled tasks is
+/// a single check of a null pointer in the context switch path.
+class TaskProfiler final {
+ public:
+  /// Tasks that finished after the limit on the span names was reached are
+  /// accounted under this name
+  static constexpr std::string_view kOtherName = "<other>";
+  /// Tasks that have never created a span are accounted under this name
+  static constexpr std::string_view kUnnamed = "<unnamed>";
+
+  using Stats = std::vector<std::pair<std::string, TaskProfileStats>>;
+
+  explicit TaskProfiler(std::size_t sampling_period);
+
+  /// Returns nullptr if the new task should not be profiled
+  std::unique_ptr<TaskProfile> MaybeStartProfile();
+
+  void Account(const TaskProfile& profile);
+
+  /// Returns the stats since the start sorted by the CPU time, the largest
+  /// first. The counters never decrease, so they are exported as cumulative
+  /// metrics.
+  Stats GetStats() const;
+
+  /// Returns the stats since the last Reset, sorted as in GetStats
+  Stats GetStatsSinceReset() const;
+
+  /// Starts over the GetStatsSinceReset, does not affect GetStats
+  void Reset();
+
+ private:
+  using StatsMap = std::unordered_map<std::string, TaskProfileStats>;
+
+  const std::size_t sampling_period_;
+
+  mutable std::mutex mutex_;
+  StatsMap stats_;
+  // The values of stats_ at the last Reset
+  StatsMap reset_stats_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,121 @@
+#include <engine/task/task_profiler.hpp>
+
+#include <chrono>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::chrono_literals;
+
+engine::impl::TaskProcessorHolder MakeProfiledTaskProcessor() {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "profiled";
+  config.task_profiler_every = 1;
+
+  return engine::impl::TaskProcessorHolder{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config),
+          engine::impl::MakeTaskProcessorPools({}))};
+}
+
+const engine::impl::TaskProfileStats* FindStats(
+    const engine::impl::TaskProfiler::Stats& stats, std::string_view name) {
+  for (const auto& [span_name, span_stats] : stats) {
+    if (span_name == name) return &span_stats;
+  }
+  return nullptr;
+}
+
+void BurnCpu(std::chrono::milliseconds duration) {
+  const auto start = std::chrono::steady_clock::now();
+  while (std::chrono::steady_clock::now() - start < duration) {
+  }
+}
+
+}  // namespace
+
+TEST(TaskProfiler, Disabled) {
+  auto task_processor = engine::impl::TaskProcessorHolder::Make(
+      1, "plain", engine::impl::MakeTaskProcessorPools({}));
+  EXPECT_EQ(task_processor->GetTaskProfiler(), nullptr);
+}
+
+TEST(TaskProfiler, AggregatesBySpanName) {
+  auto task_processor = MakeProfiledTaskProcessor();
+
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+    for (int i = 0; i < 3; ++i) {
+      utils::Async("busy", [] {
+        BurnCpu(5ms);
+        engine::Yield();
+      }).Get();
+    }
+    utils::Async("sleepy", [] { engine::SleepFor(1ms); }).Get();
+    engine::AsyncNoSpan([] {}).Get();
+  });
+
+  const auto* profiler = task_processor->GetTaskProfiler();
+  ASSERT_NE(profiler, nullptr);
+  const auto stats = profiler->GetStats();
+
+  const auto* busy = FindStats(stats, "busy");
+  ASSERT_NE(busy, nullptr);
+  EXPECT_EQ(busy->tasks, 3);
+  EXPECT_GE(busy->cpu_time_us, 3 * 4'000);
+  EXPECT_GE(busy->context_switches, 3);
+  // The CPU-heavy tasks come first
+  EXPECT_EQ(stats.front().first, "busy");
+
+  const auto* sleepy = FindStats(stats, "sleepy");
+  ASSERT_NE(sleepy, nullptr);
+  EXPECT_EQ(sleepy->tasks, 1);
+  EXPECT_GE(sleepy->context_switches, 1);
+
+  EXPECT_NE(FindStats(stats, engine::impl::TaskProfiler::kUnnamed), nullptr);
+
+  EXPECT_EQ(profiler->GetStatsSinceReset().size(), stats.size());
+}
+
+TEST(TaskProfiler, Reset) {
+  auto task_processor = MakeProfiledTaskProcessor();
+  auto* profiler = task_processor->GetTaskProfiler();
+  ASSERT_NE(profiler, nullptr);
+
+  const auto run_busy = [&] {
+    engine::impl::RunOnTaskProcessorSync(*task_processor, [] {
+      utils::Async("busy", [] { BurnCpu(1ms); }).Get();
+    });
+  };
+
+  run_busy();
+  run_busy();
+  profiler->Reset();
+  EXPECT_EQ(FindStats(profiler->GetStatsSinceReset(), "busy"), nullptr);
+
+  run_busy();
+  const auto since_reset = profiler->GetStatsSinceReset();
+  const auto* busy_since_reset = FindStats(since_reset, "busy");
+  ASSERT_NE(busy_since_reset, nullptr);
+  EXPECT_EQ(busy_since_reset->tasks, 1);
+
+  // The exported totals never decrease
+  const auto total = profiler->GetStats();
+  const auto* busy_total = FindStats(total, "busy");
+  ASSERT_NE(busy_total, nullptr);
+  EXPECT_EQ(busy_total->tasks, 3);
+  EXPECT_GE(busy_total->cpu_time_us, busy_since_reset->cpu_time_us);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <engine/task/task_queue.hpp>
 
+#include <chrono>
+
 #include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,53 +11,123 @@ namespace engine {
 
 namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
+
+std::size_t GetLanesCount(const TaskProcessorConfig& config) {
+  return config.task_priorities ? kTaskPrioritiesCount : 1;
+}
+
+// Smooth weighted round-robin: the lanes are interleaved as evenly as
+// possible, e.g. weights {4, 2, 1} produce "0 1 0 2 0 1 0".
+std::vector<std::uint8_t> MakeSchedule(const TaskProcessorConfig& config) {
+  if (!config.task_priorities) return {};
+  const auto& weights = config.task_priorities->weights;
+
+  std::size_t total_weight = 0;
+  for (const auto weight : weights) total_weight += weight;
+
+  std::vector<std::uint8_t> schedule;
+  schedule.reserve(total_weight);
+  std::array<std::int64_t, kTaskPrioritiesCount> current{};
+  for (std::size_t step = 0; step < total_weight; ++step) {
+    std::size_t best = 0;
+    for (std::size_t i = 0; i < kTaskPrioritiesCount; ++i) {
+      current[i] += static_cast<std::int64_t>(weights[i]);
+      if (current[i] > current[best]) best = i;
+    }
+    current[best] -= static_cast<std::int64_t>(total_weight);
+    schedule.push_back(static_cast<std::uint8_t>(best));
+  }
+  return schedule;
 }
 
+}  // namespace
+
+struct TaskQueue::LocalData final {
+  explicit LocalData(TaskQueue& task_queue)
+      : tokens(utils::GenerateFixedArray(
+            task_queue.lanes_.size(), [&task_queue](std::size_t index) {
+              return moodycamel::ConsumerToken(task_queue.lanes_[index]->queue);
+            })) {}
+
+  utils::FixedArray<moodycamel::ConsumerToken> tokens;
+  std::size_t schedule_position{0};
+};
+
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : lanes_(GetLanesCount(config)),
+      schedule_(MakeSchedule(config)),
+      queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
-  DoPush(context.get());
+  DoPush(context.get(), GetLaneIndex(*context));
   context.detach();
 }
 
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
-  // Current thread handles only a single TaskProcessor, so it's safe to store
-  // a token for the task processor in a thread-local variable.
-  thread_local moodycamel::ConsumerToken token(queue_);
+  impl::TaskContext* raw_context{};
+  if (schedule_.empty()) {
+    // Current thread handles only a single TaskProcessor, so it's safe to
+    // store a token for the task processor in a thread-local variable.
+    thread_local moodycamel::ConsumerToken token(lanes_[0]->queue);
+    raw_context = DoPopBlocking(token);
+  } else {
+    thread_local LocalData local_data(*this);
+    raw_context = DoPopBlockingFromLanes(local_data);
+  }
 
-  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(token),
+  boost::intrusive_ptr<impl::TaskContext> context{raw_context,
                                                   /* add_ref= */ false};
 
   if (!context) {
     // return "stop" token back
-    DoPush(nullptr);
+    DoPush(nullptr, 0);
   }
 
   return context;
 }
 
-void TaskQueue::StopProcessing() { DoPush(nullptr); }
+void TaskQueue::StopProcessing() { DoPush(nullptr, 0); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept {
-  return queue_.size_approx();
+  std::size_t result = 0;
+  for (const auto& lane : lanes_) {
+    result += lane->queue.size_approx();
+  }
+  return result;
 }
 
-void TaskQueue::DoPush(impl::TaskContext* context) {
+bool TaskQueue::HasPriorityLanes() const noexcept { return !schedule_.empty(); }
+
+TaskPriorityLaneStats TaskQueue::GetPriorityLaneStats(
+    Task::Priority priority) const {
+  const auto index = static_cast<std::size_t>(priority);
+  UINVARIANT(index < lanes_.size(), "No lane for the task priority");
+  const auto& lane = *lanes_[index];
+
+  TaskPriorityLaneStats stats;
+  stats.queued = lane.queue.size_approx();
+  stats.wait_time_samples =
+      utils::statistics::Rate{lane.wait_time_samples.load()};
+  stats.wait_time_us = utils::statistics::Rate{lane.wait_time_us.load()};
+  return stats;
+}
+
+void TaskQueue::DoPush(impl::TaskContext* context, std::size_t lane_index) {
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::enqueue
-  queue_.enqueue(context);
+  lanes_[lane_index]->queue.enqueue(context);
   queue_semaphore_.signal();
 }
 
 impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
   impl::TaskContext* context{};
+  auto& queue = lanes_[0]->queue;
 
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::wait_dequeue
   queue_semaphore_.wait();
-  while (!queue_.try_dequeue(token, context)) {
+  while (!queue.try_dequeue(token, context)) {
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
   }
@@ -62,6 +135,53 @@ impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
   return context;
 }
 
+impl::TaskContext* TaskQueue::DoPopBlockingFromLanes(LocalData& local_data) {
+  impl::TaskContext* context{};
+
+  // The semaphore counts the items of all the lanes, so after the wait there
+  // is an item for us in one of them.
+  queue_semaphore_.wait();
+
+  const std::size_t preferred = schedule_[local_data.schedule_position];
+  if (++local_data.schedule_position == schedule_.size()) {
+    local_data.schedule_position = 0;
+  }
+
+  auto& preferred_lane = *lanes_[preferred];
+  if (preferred_lane.queue.try_dequeue(local_data.tokens[preferred], context)) {
+    if (context) AccountWaitTime(preferred_lane, *context);
+    return context;
+  }
+
+  while (true) {
+    for (std::size_t index = 0; index < lanes_.size(); ++index) {
+      auto& lane = *lanes_[index];
+      if (lane.queue.try_dequeue(local_data.tokens[index], context)) {
+        if (context) AccountWaitTime(lane, *context);
+        return context;
+      }
+    }
+  }
+}
+
+void TaskQueue::AccountWaitTime(Lane& lane,
+                                const impl::TaskContext& context) noexcept {
+  const auto wait_timepoint = context.GetQueueWaitTimepoint();
+  if (wait_timepoint == std::chrono::steady_clock::time_point{}) return;
+
+  const auto wait_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - wait_timepoint);
+  lane.wait_time_samples.fetch_add(1, std::memory_order_relaxed);
+  lane.wait_time_us.fetch_add(static_cast<std::uint64_t>(wait_time.count()),
+                              std::memory_order_relaxed);
+}
+
+std::size_t TaskQueue::GetLaneIndex(
+    const impl::TaskContext& context) const noexcept {
+  if (schedule_.empty()) return 0;
+  return static_cast<std::size_t>(context.GetPriority());
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
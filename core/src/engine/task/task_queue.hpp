@@ -1,10 +1,18 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <concurrent/impl/interference_shield.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,6 +22,21 @@ namespace impl {
 class TaskContext;
 }  // namespace impl
 
+/// Statistics of a single priority lane of a TaskQueue
+struct TaskPriorityLaneStats final {
+  std::size_t queued{0};
+  // Wait time is only measured for a sample of the dequeued tasks
+  utils::statistics::Rate wait_time_samples;
+  utils::statistics::Rate wait_time_us;
+};
+
+/// A task queue shared by all the workers of a TaskProcessor.
+///
+/// With `task-priorities` configured the tasks are split into lanes by
+/// engine::Task::Priority. Each dequeue picks a lane according to a smooth
+/// weighted round-robin schedule, so that under a backlog the lanes are served
+/// proportionally to their weights, and falls back to the other lanes in
+/// priority order if the picked one is empty.
 class TaskQueue final {
  public:
   explicit TaskQueue(const TaskProcessorConfig& config);
@@ -27,12 +50,35 @@ class TaskQueue final {
 
   std::size_t GetSizeApproximate() const noexcept;
 
+  /// Returns false if all the priorities share a single lane
+  bool HasPriorityLanes() const noexcept;
+
+  TaskPriorityLaneStats GetPriorityLaneStats(Task::Priority priority) const;
+
  private:
-  void DoPush(impl::TaskContext* context);
+  struct Lane final {
+    moodycamel::ConcurrentQueue<impl::TaskContext*> queue;
+    std::atomic<std::uint64_t> wait_time_samples{0};
+    std::atomic<std::uint64_t> wait_time_us{0};
+  };
+
+  struct LocalData;
+
+  using LaneSlot = concurrent::impl::InterferenceShield<Lane>;
+
+  void DoPush(impl::TaskContext* context, std::size_t lane_index);
 
   impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
 
-  moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+  impl::TaskContext* DoPopBlockingFromLanes(LocalData& local_data);
+
+  void AccountWaitTime(Lane& lane, const impl::TaskContext& context) noexcept;
+
+  std::size_t GetLaneIndex(const impl::TaskContext& context) const noexcept;
+
+  utils::FixedArray<LaneSlot> lanes_;
+  // Lane indices in the dequeue order, empty without `task-priorities`
+  const std::vector<std::uint8_t> schedule_;
   moodycamel::LightweightSemaphore queue_semaphore_;
 };
 
@@ -0,0 +1,142 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::TaskProcessor MakeTaskProcessor(
+    std::size_t threads,
+    std::optional<engine::TaskPriorityWeights> task_priorities) {
+  engine::TaskProcessorConfig config;
+  config.name = "priorities";
+  config.thread_name = "prio-worker";
+  config.worker_threads = threads;
+  config.task_priorities = task_priorities;
+  return engine::TaskProcessor{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+}
+
+}  // namespace
+
+TEST(TaskQueue, ParsePriorities) {
+  const auto parse = [](const char* yaml) {
+    return yaml_config::YamlConfig{formats::yaml::FromString(yaml), {}}
+        .As<engine::TaskProcessorConfig>();
+  };
+
+  EXPECT_FALSE(parse("worker_threads: 4").task_priorities);
+
+  const auto config = parse(R"(
+    worker_threads: 4
+    task-priorities:
+      high: 10
+      low: 3
+  )");
+  ASSERT_TRUE(config.task_priorities);
+  EXPECT_EQ(config.task_priorities->weights,
+            (std::array<std::size_t, engine::kTaskPrioritiesCount>{10, 2, 3}));
+
+  EXPECT_ANY_THROW(parse(R"(
+    worker_threads: 4
+    task-priorities:
+      normal: 0
+  )"));
+  EXPECT_ANY_THROW(parse(R"(
+    worker_threads: 4
+    task-queue: work-stealing
+    task-priorities: {}
+  )"));
+}
+
+UTEST(TaskQueue, HighPriorityOvertakesLow) {
+  auto task_processor =
+      MakeTaskProcessor(1, engine::TaskPriorityWeights{{4, 2, 1}});
+
+  std::atomic<bool> blocker_started{false};
+  std::atomic<bool> release_blocker{false};
+  auto blocker = engine::AsyncNoSpan(task_processor, [&] {
+    blocker_started = true;
+    while (!release_blocker) {
+      // keep the only worker busy until the backlog is queued
+    }
+  });
+  while (!blocker_started) {
+  }
+
+  constexpr std::size_t kTasksPerPriority = 20;
+  // Only mutated from the single worker thread
+  std::vector<engine::Task::Priority> order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kTasksPerPriority; ++i) {
+    for (const auto priority :
+         {engine::Task::Priority::kLow, engine::Task::Priority::kHigh}) {
+      tasks.push_back(engine::AsyncNoSpan(
+          task_processor, priority, [&order, priority] {
+            order.push_back(priority);
+          }));
+    }
+  }
+  release_blocker = true;
+  blocker.Get();
+  engine::WaitAllChecked(tasks);
+
+  ASSERT_EQ(order.size(), 2 * kTasksPerPriority);
+
+  // Normal lane is empty, so its turns go to the high lane: 6 of each 7
+  // dequeues pick a high priority task.
+  std::size_t high_first = 0;
+  for (std::size_t i = 0; i < 14; ++i) {
+    if (order[i] == engine::Task::Priority::kHigh) ++high_first;
+  }
+  EXPECT_GE(high_first, std::size_t{10});
+
+  // ...but the low lane is not starved
+  const auto first_low =
+      std::find(order.begin(), order.end(), engine::Task::Priority::kLow);
+  const auto last_high =
+      std::find(order.rbegin(), order.rend(), engine::Task::Priority::kHigh);
+  EXPECT_LT(first_low - order.begin(), order.rend() - last_high - 1);
+}
+
+UTEST(TaskQueue, PriorityLaneStats) {
+  auto task_processor =
+      MakeTaskProcessor(2, engine::TaskPriorityWeights{{4, 2, 1}});
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < 100; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor,
+                                        engine::Task::Priority::kLow, [] {}));
+  }
+  engine::WaitAllChecked(tasks);
+
+  const auto low_stats =
+      task_processor.GetPriorityLaneStats(engine::Task::Priority::kLow);
+  ASSERT_TRUE(low_stats);
+  EXPECT_GT(low_stats->wait_time_samples.value, 0U);
+
+  const auto high_stats =
+      task_processor.GetPriorityLaneStats(engine::Task::Priority::kHigh);
+  ASSERT_TRUE(high_stats);
+  EXPECT_EQ(high_stats->queued, std::size_t{0});
+  EXPECT_EQ(high_stats->wait_time_samples.value, 0U);
+
+  auto no_lanes_task_processor = MakeTaskProcessor(1, std::nullopt);
+  EXPECT_FALSE(no_lanes_task_processor.GetPriorityLaneStats(
+      engine::Task::Priority::kNormal));
+}
+
+USERVER_NAMESPACE_END
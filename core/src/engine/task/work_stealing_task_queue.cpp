@@ -0,0 +1,344 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <compiler/tls.hpp>
+#include <engine/impl/numa.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// A task that keeps rescheduling itself (e.g. via Yield) through the LIFO slot
+// should not starve the rest of the local queue.
+constexpr std::size_t kMaxLifoPollsInRow = 3;
+
+// Same as in Go and Tokio schedulers: poll the global queue once in a while
+// even if there is local work, so that tasks from ev-threads are not starved.
+constexpr std::size_t kGlobalQueuePollInterval = 61;
+
+constexpr std::size_t kMaxStealBatch = 32;
+
+constexpr std::size_t kStealRounds = 2;
+
+struct LocalConsumerData final {
+  const void* queue{nullptr};
+  void* consumer{nullptr};
+};
+
+thread_local USERVER_IMPL_CONSTINIT LocalConsumerData local_consumer_data;
+
+USERVER_PREVENT_TLS_CACHING LocalConsumerData GetLocalConsumerData() noexcept {
+  return local_consumer_data;
+}
+
+USERVER_PREVENT_TLS_CACHING void SetLocalConsumerData(
+    LocalConsumerData data) noexcept {
+  local_consumer_data = data;
+}
+
+std::size_t GetShardsCount(const TaskProcessorConfig& config) {
+  if (!config.numa_sharding) return 1;
+  const auto nodes = impl::GetNumaTopology().node_cpus.size();
+  return std::max<std::size_t>(std::min(nodes, config.worker_threads), 1);
+}
+
+}  // namespace
+
+WorkStealingTaskQueue::Consumer::Consumer() : local_token(local_queue) {}
+
+WorkStealingTaskQueue::Shard::Shard(int spinning_iterations)
+    : sleep_semaphore(kSemaphoreInitialCount, spinning_iterations) {}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : consumers_(config.worker_threads),
+      shards_(GetShardsCount(config), config.spinning_iterations) {
+  const auto worker_shards =
+      impl::DistributeWorkersOverNumaNodes(consumers_.size(), shards_.size());
+  for (std::size_t i = 0; i < consumers_.size(); ++i) {
+    consumers_[i]->index = i;
+    consumers_[i]->shard = worker_shards[i];
+  }
+
+  // Workers of a shard are contiguous, see DistributeWorkersOverNumaNodes
+  std::size_t begin = 0;
+  for (std::size_t shard = 0; shard < shards_.size(); ++shard) {
+    auto end = begin;
+    while (end < consumers_.size() && consumers_[end]->shard == shard) ++end;
+    shards_[shard]->consumers_begin = begin;
+    shards_[shard]->consumers_end = end;
+    begin = end;
+  }
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() = default;
+
+void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
+  UINVARIANT(index < consumers_.size(),
+             "Worker index is out of the work-stealing queue bounds");
+  SetLocalConsumerData({this, &*consumers_[index]});
+}
+
+std::size_t WorkStealingTaskQueue::GetWorkerNumaNode(
+    std::size_t index) const noexcept {
+  UASSERT(index < consumers_.size());
+  return consumers_[index]->shard;
+}
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  auto* const ptr = context.detach();
+
+  auto* const consumer = GetLocalConsumer();
+  if (consumer) {
+    PushLocal(*consumer, ptr);
+  } else {
+    PushGlobal(ptr);
+  }
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  auto* const consumer = GetLocalConsumer();
+  UINVARIANT(consumer,
+             "PopBlocking must be called from a worker thread after "
+             "PrepareWorker");
+  return {DoPopBlocking(*consumer), /* add_ref= */ false};
+}
+
+void WorkStealingTaskQueue::StopProcessing() {
+  is_stopped_.store(true);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  for (auto& shard : shards_) {
+    while (TryWakeUpOne(*shard)) {
+    }
+  }
+}
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = 0;
+  for (const auto& shard : shards_) {
+    size += shard->global_queue.size_approx();
+  }
+  for (const auto& consumer : consumers_) {
+    size += consumer->local_queue.size_approx();
+    if (consumer->lifo_slot.load(std::memory_order_relaxed)) ++size;
+  }
+  return size;
+}
+
+WorkStealingTaskQueue::Consumer* WorkStealingTaskQueue::GetLocalConsumer()
+    const noexcept {
+  const auto data = GetLocalConsumerData();
+  if (data.queue != this) return nullptr;
+  return static_cast<Consumer*>(data.consumer);
+}
+
+void WorkStealingTaskQueue::PushLocal(Consumer& consumer,
+                                      impl::TaskContext* context) {
+  auto* const displaced =
+      consumer.lifo_slot.exchange(context, std::memory_order_acq_rel);
+  if (!displaced) {
+    // The current worker is busy with the task that has scheduled 'context',
+    // it will pick 'context' up right after that. No need to wake anyone.
+    return;
+  }
+
+  consumer.local_queue.enqueue(consumer.local_token, displaced);
+  // Pairs with the fence in DoPopBlocking, so that either we see a sleeping
+  // worker, or it sees our item.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  WakeUpOne(*shards_[consumer.shard]);
+}
+
+void WorkStealingTaskQueue::PushGlobal(impl::TaskContext* context) {
+  auto& shard = GetShardForExternalPush();
+  shard.global_queue.enqueue(context);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  WakeUpOne(shard);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking(Consumer& consumer) {
+  auto& shard = *shards_[consumer.shard];
+  while (true) {
+    if (auto* context = TryPopLocal(consumer)) return context;
+    if (auto* context = TryPopGlobal(shard)) return context;
+    for (std::size_t i = 0; i < kStealRounds; ++i) {
+      if (auto* context = TryStealFromShard(consumer)) return context;
+    }
+    if (auto* context = TryPopOtherShards(consumer)) return context;
+    if (auto* context = TryStealFromOtherShards(consumer)) return context;
+
+    shard.sleeping_workers.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Re-check after announcing that we are going to sleep, otherwise a push
+    // between the checks above and 'fetch_add' would be lost.
+    auto* context = TryPopAnyShared(consumer);
+    if (context || is_stopped_.load()) {
+      CancelSleep(shard);
+      // nullptr is the stop signal here
+      return context;
+    }
+
+    shard.sleep_semaphore.wait();
+  }
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopLocal(Consumer& consumer) {
+  impl::TaskContext* context = nullptr;
+
+  if (++consumer.pops_since_global_poll >= kGlobalQueuePollInterval) {
+    consumer.pops_since_global_poll = 0;
+    if ((context = TryPopGlobal(*shards_[consumer.shard]))) return context;
+  }
+
+  if (consumer.lifo_polls_in_row < kMaxLifoPollsInRow) {
+    context = consumer.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+    if (context) {
+      ++consumer.lifo_polls_in_row;
+      return context;
+    }
+  }
+  consumer.lifo_polls_in_row = 0;
+
+  if (consumer.local_queue.try_dequeue_from_producer(consumer.local_token,
+                                                     context)) {
+    return context;
+  }
+  return consumer.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopGlobal(Shard& shard) {
+  impl::TaskContext* context = nullptr;
+  if (shard.global_queue.try_dequeue(context)) return context;
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopOtherShards(
+    Consumer& consumer) {
+  for (std::size_t i = 1; i < shards_.size(); ++i) {
+    auto& shard = *shards_[(consumer.shard + i) % shards_.size()];
+    if (auto* context = TryPopGlobal(shard)) return context;
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFromRange(
+    Consumer& consumer, std::size_t begin, std::size_t end) {
+  const auto size = end - begin;
+  if (size == 0) return nullptr;
+
+  const auto start = utils::RandRange(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    auto& victim = *consumers_[begin + (start + i) % size];
+    if (&victim == &consumer) continue;
+    if (auto* context = TryStealFrom(consumer, victim)) return context;
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFromShard(
+    Consumer& consumer) {
+  const auto& shard = *shards_[consumer.shard];
+  return TryStealFromRange(consumer, shard.consumers_begin,
+                           shard.consumers_end);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFromOtherShards(
+    Consumer& consumer) {
+  for (std::size_t i = 1; i < shards_.size(); ++i) {
+    const auto& shard = *shards_[(consumer.shard + i) % shards_.size()];
+    if (auto* context = TryStealFromRange(consumer, shard.consumers_begin,
+                                          shard.consumers_end)) {
+      return context;
+    }
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFrom(Consumer& thief,
+                                                       Consumer& victim) {
+  // Take a half of the victim's local queue, so that we do not come back for
+  // every single task.
+  const auto victim_size = victim.local_queue.size_approx();
+  if (victim_size != 0) {
+    std::array<impl::TaskContext*, kMaxStealBatch> batch{};
+    const auto to_steal = std::min(kMaxStealBatch, (victim_size + 1) / 2);
+    const auto stolen = victim.local_queue.try_dequeue_bulk_from_producer(
+        victim.local_token, batch.data(), to_steal);
+    if (stolen != 0) {
+      if (stolen > 1) {
+        thief.local_queue.enqueue_bulk(thief.local_token, batch.data() + 1,
+                                       stolen - 1);
+      }
+      return batch[0];
+    }
+  }
+
+  // The victim may be stuck in a long-running task while its LIFO slot holds
+  // something runnable.
+  if (victim.lifo_slot.load(std::memory_order_relaxed)) {
+    return victim.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopAnyShared(Consumer& consumer) {
+  if (auto* context = TryPopGlobal(*shards_[consumer.shard])) return context;
+  if (auto* context = TryStealFromShard(consumer)) return context;
+  if (auto* context = TryPopOtherShards(consumer)) return context;
+  return TryStealFromOtherShards(consumer);
+}
+
+WorkStealingTaskQueue::Shard& WorkStealingTaskQueue::GetShardForExternalPush() {
+  if (shards_.size() == 1) return *shards_[0];
+  return *shards_[utils::RandRange(shards_.size())];
+}
+
+bool WorkStealingTaskQueue::TryWakeUpOne(Shard& shard) noexcept {
+  auto& sleeping = shard.sleeping_workers;
+  auto current = sleeping.load();
+  while (current != 0) {
+    if (sleeping.compare_exchange_weak(current, current - 1)) {
+      shard.sleep_semaphore.signal();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingTaskQueue::WakeUpOne(Shard& preferred_shard) noexcept {
+  if (TryWakeUpOne(preferred_shard)) return;
+
+  // Cross-node stealing is only a fallback, but a task should not wait for a
+  // busy node while another one is idle.
+  for (auto& shard : shards_) {
+    if (&*shard != &preferred_shard && TryWakeUpOne(*shard)) return;
+  }
+}
+
+void WorkStealingTaskQueue::CancelSleep(Shard& shard) noexcept {
+  auto& sleeping = shard.sleeping_workers;
+  auto current = sleeping.load();
+  while (current != 0) {
+    if (sleeping.compare_exchange_weak(current, current - 1)) return;
+  }
+
+  // Someone has already decremented the counter on our behalf and is going to
+  // signal the semaphore. Consume the signal to keep the accounting exact.
+  shard.sleep_semaphore.wait();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
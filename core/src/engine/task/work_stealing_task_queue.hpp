@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// A task queue with per-worker run queues.
+///
+/// Each worker owns a LIFO slot and a local FIFO queue. Tasks scheduled from
+/// a worker of the same TaskProcessor go to the LIFO slot of that worker (the
+/// previous occupant is moved to the local queue) and do not wake other
+/// workers unless the local queue has work that could be stolen. Tasks
+/// scheduled from other threads go to the shared global queue. An idle worker
+/// first polls its own queues, then the global one, then steals a batch from
+/// its siblings and only then goes to sleep.
+///
+/// With `numa-sharding` enabled the workers are split into per-NUMA-node
+/// groups, each one with its own global queue shard and sleep semaphore.
+/// Workers steal from their own node first and from the other nodes only as
+/// a fallback.
+class WorkStealingTaskQueue final {
+ public:
+  explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
+
+  ~WorkStealingTaskQueue();
+
+  /// Must be called once from each worker thread before PopBlocking
+  void PrepareWorker(std::size_t index);
+
+  /// Returns the NUMA node the worker is assigned to, 0 if `numa-sharding`
+  /// is disabled
+  std::size_t GetWorkerNumaNode(std::size_t index) const noexcept;
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+ private:
+  struct Consumer final {
+    Consumer();
+
+    std::atomic<impl::TaskContext*> lifo_slot{nullptr};
+    moodycamel::ConcurrentQueue<impl::TaskContext*> local_queue;
+    // Only the owning worker pushes into its local queue
+    moodycamel::ProducerToken local_token;
+    std::size_t index{0};
+    std::size_t shard{0};
+    std::size_t lifo_polls_in_row{0};
+    std::size_t pops_since_global_poll{0};
+  };
+
+  struct Shard final {
+    explicit Shard(int spinning_iterations);
+
+    moodycamel::ConcurrentQueue<impl::TaskContext*> global_queue;
+    std::atomic<std::size_t> sleeping_workers{0};
+    moodycamel::LightweightSemaphore sleep_semaphore;
+    std::size_t consumers_begin{0};
+    std::size_t consumers_end{0};
+  };
+
+  using ConsumerSlot = concurrent::impl::InterferenceShield<Consumer>;
+  using ShardSlot = concurrent::impl::InterferenceShield<Shard>;
+
+  Consumer* GetLocalConsumer() const noexcept;
+
+  void PushLocal(Consumer& consumer, impl::TaskContext* context);
+
+  void PushGlobal(impl::TaskContext* context);
+
+  impl::TaskContext* DoPopBlocking(Consumer& consumer);
+
+  impl::TaskContext* TryPopLocal(Consumer& consumer);
+
+  impl::TaskContext* TryPopGlobal(Shard& shard);
+
+  impl::TaskContext* TryPopOtherShards(Consumer& consumer);
+
+  impl::TaskContext* TryStealFromRange(Consumer& consumer, std::size_t begin,
+                                       std::size_t end);
+
+  impl::TaskContext* TryStealFromShard(Consumer& consumer);
+
+  impl::TaskContext* TryStealFromOtherShards(Consumer& consumer);
+
+  impl::TaskContext* TryStealFrom(Consumer& thief, Consumer& victim);
+
+  impl::TaskContext* TryPopAnyShared(Consumer& consumer);
+
+  Shard& GetShardForExternalPush();
+
+  static bool TryWakeUpOne(Shard& shard) noexcept;
+
+  void WakeUpOne(Shard& preferred_shard) noexcept;
+
+  static void CancelSleep(Shard& shard) noexcept;
+
+  utils::FixedArray<ConsumerSlot> consumers_;
+  utils::FixedArray<ShardSlot> shards_;
+  std::atomic<bool> is_stopped_{false};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
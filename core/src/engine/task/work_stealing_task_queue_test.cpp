@@ -0,0 +1,179 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::seconds kMaxBusyTime{10};
+
+engine::TaskProcessorConfig MakeWorkStealingConfig(std::size_t threads,
+                                                   bool numa_sharding = false) {
+  engine::TaskProcessorConfig config;
+  config.name = "work-stealing";
+  config.thread_name = "ws-worker";
+  config.worker_threads = threads;
+  config.task_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+  config.numa_sharding = numa_sharding;
+  return config;
+}
+
+engine::TaskProcessor MakeTaskProcessor(std::size_t threads,
+                                        bool numa_sharding = false) {
+  return engine::TaskProcessor{
+      MakeWorkStealingConfig(threads, numa_sharding),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+}
+
+}  // namespace
+
+TEST(WorkStealingTaskQueue, ParseConfig) {
+  const auto yaml = formats::yaml::FromString(R"(
+    worker_threads: 4
+    task-queue: work-stealing
+  )");
+  const auto config =
+      yaml_config::YamlConfig{yaml, {}}.As<engine::TaskProcessorConfig>();
+  EXPECT_EQ(config.task_queue, engine::TaskQueueType::kWorkStealingTaskQueue);
+
+  const auto yaml_default = formats::yaml::FromString("worker_threads: 4");
+  const auto config_default = yaml_config::YamlConfig{yaml_default, {}}
+                                  .As<engine::TaskProcessorConfig>();
+  EXPECT_EQ(config_default.task_queue,
+            engine::TaskQueueType::kGlobalTaskQueue);
+  EXPECT_FALSE(config_default.numa_sharding);
+
+  const auto yaml_numa = formats::yaml::FromString(R"(
+    worker_threads: 4
+    task-queue: work-stealing
+    numa-sharding: true
+  )");
+  EXPECT_TRUE(yaml_config::YamlConfig(yaml_numa, {})
+                  .As<engine::TaskProcessorConfig>()
+                  .numa_sharding);
+
+  const auto yaml_numa_global = formats::yaml::FromString(R"(
+    worker_threads: 4
+    numa-sharding: true
+  )");
+  EXPECT_ANY_THROW(yaml_config::YamlConfig(yaml_numa_global, {})
+                       .As<engine::TaskProcessorConfig>());
+}
+
+UTEST(WorkStealingTaskQueue, SpawnFromOutside) {
+  auto task_processor = MakeTaskProcessor(4);
+
+  constexpr std::size_t kTasks = 1000;
+  std::atomic<std::size_t> counter{0};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&counter] {
+      engine::Yield();
+      ++counter;
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+
+  EXPECT_EQ(counter.load(), kTasks);
+}
+
+UTEST(WorkStealingTaskQueue, SpawnFromInside) {
+  auto task_processor = MakeTaskProcessor(4);
+
+  constexpr std::size_t kTasks = 100;
+  std::atomic<std::size_t> counter{0};
+  engine::AsyncNoSpan(task_processor, [&counter] {
+    // All the subtasks land in the local queue of a single worker, the rest
+    // of the workers have to steal them.
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasks);
+    for (std::size_t i = 0; i < kTasks; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&counter] {
+        for (int j = 0; j < 10; ++j) engine::Yield();
+        ++counter;
+      }));
+    }
+    engine::WaitAllChecked(tasks);
+  }).Get();
+
+  EXPECT_EQ(counter.load(), kTasks);
+}
+
+UTEST(WorkStealingTaskQueue, StealWhileOwnerIsBusy) {
+  auto task_processor = MakeTaskProcessor(2);
+
+  engine::AsyncNoSpan(task_processor, [] {
+    std::atomic<std::size_t> finished{0};
+    // The first subtask is displaced from the LIFO slot of the current worker
+    // into its local queue by the second one, which wakes up the other worker
+    // to steal them while we are busy.
+    auto first = engine::AsyncNoSpan([&finished] { ++finished; });
+    auto second = engine::AsyncNoSpan([&finished] { ++finished; });
+
+    const auto deadline = std::chrono::steady_clock::now() + kMaxBusyTime;
+    while (finished != 2 && std::chrono::steady_clock::now() < deadline) {
+      // busy loop without context switches
+    }
+    EXPECT_EQ(finished.load(), std::size_t{2});
+
+    first.Get();
+    second.Get();
+  }).Get();
+}
+
+UTEST(WorkStealingTaskQueue, MutexPingPong) {
+  auto task_processor = MakeTaskProcessor(4);
+
+  constexpr std::size_t kTasks = 8;
+  constexpr std::size_t kIterations = 1000;
+  engine::Mutex mutex;
+  std::size_t counter = 0;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        std::lock_guard lock{mutex};
+        ++counter;
+      }
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+
+  EXPECT_EQ(counter, kTasks * kIterations);
+}
+
+UTEST(WorkStealingTaskQueue, NumaSharding) {
+  auto task_processor = MakeTaskProcessor(4, /*numa_sharding=*/true);
+
+  constexpr std::size_t kTasks = 100;
+  std::atomic<std::size_t> counter{0};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&counter] {
+      auto subtask = engine::AsyncNoSpan([&counter] { ++counter; });
+      engine::Yield();
+      subtask.Get();
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+
+  EXPECT_EQ(counter.load(), kTasks);
+}
+
+USERVER_NAMESPACE_END
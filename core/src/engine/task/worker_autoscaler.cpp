@@ -0,0 +1,45 @@
+#include <engine/task/worker_autoscaler.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+WorkerAutoscaler::WorkerAutoscaler(const WorkerAutoscalingConfig& config,
+                                   std::size_t max_workers)
+    // worker_threads may be lowered by `guess-cpu-limit` after the config
+    // validation, so clamp here once more
+    : min_workers_(
+          std::max<std::size_t>(std::min(config.min_workers, max_workers), 1)),
+      max_workers_(std::max(max_workers, min_workers_)),
+      check_interval_(config.check_interval),
+      scale_up_wait_time_(config.scale_up_wait_time),
+      scale_down_load_percent_(config.scale_down_load_percent) {
+  UASSERT(check_interval_.count() > 0);
+}
+
+std::size_t WorkerAutoscaler::Evaluate(
+    std::size_t active_workers, std::chrono::microseconds max_wait_time,
+    std::uint8_t average_load_percent) const noexcept {
+  active_workers = std::clamp(active_workers, min_workers_, max_workers_);
+
+  if (max_wait_time >= scale_up_wait_time_) {
+    const auto step = std::max<std::size_t>(active_workers / 2, 1);
+    return std::min(active_workers + step, max_workers_);
+  }
+
+  if (average_load_percent < scale_down_load_percent_ &&
+      max_wait_time < scale_up_wait_time_ / 2 &&
+      active_workers > min_workers_) {
+    return active_workers - 1;
+  }
+
+  return active_workers;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <engine/task/task_processor_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Decides how many workers of a TaskProcessor should be active.
+///
+/// The worker count grows by half (at least by one) as soon as some sampled
+/// task waited in the queue for `scale-up-wait-time` or longer, and shrinks by
+/// one when the average CPU load of the active workers is below
+/// `scale-down-load-percent` and the queue wait time is well below the limit.
+class WorkerAutoscaler final {
+ public:
+  WorkerAutoscaler(const WorkerAutoscalingConfig& config,
+                   std::size_t max_workers);
+
+  std::size_t GetMinWorkers() const noexcept { return min_workers_; }
+
+  std::size_t GetMaxWorkers() const noexcept { return max_workers_; }
+
+  std::chrono::milliseconds GetCheckInterval() const noexcept {
+    return check_interval_;
+  }
+
+  /// Returns the new active worker count
+  std::size_t Evaluate(std::size_t active_workers,
+                       std::chrono::microseconds max_wait_time,
+                       std::uint8_t average_load_percent) const noexcept;
+
+ private:
+  const std::size_t min_workers_;
+  const std::size_t max_workers_;
+  const std::chrono::milliseconds check_interval_;
+  const std::chrono::microseconds scale_up_wait_time_;
+  const std::uint8_t scale_down_load_percent_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
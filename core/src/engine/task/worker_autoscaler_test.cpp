@@ -0,0 +1,155 @@
+#include <engine/task/worker_autoscaler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr auto kMaxTestTime = 10s;
+
+engine::WorkerAutoscalingConfig MakeAutoscalingConfig() {
+  engine::WorkerAutoscalingConfig config;
+  config.min_workers = 1;
+  config.check_interval = 10ms;
+  config.scale_up_wait_time = 1ms;
+  config.scale_down_load_percent = 50;
+  return config;
+}
+
+}  // namespace
+
+TEST(WorkerAutoscaler, ParseConfig) {
+  const auto parse = [](const char* yaml) {
+    return yaml_config::YamlConfig{formats::yaml::FromString(yaml), {}}
+        .As<engine::TaskProcessorConfig>();
+  };
+
+  EXPECT_FALSE(parse("worker_threads: 4").worker_autoscaling);
+
+  const auto config = parse(R"(
+    worker_threads: 4
+    worker-autoscaling:
+      min-workers: 2
+      check-interval: 100ms
+  )");
+  ASSERT_TRUE(config.worker_autoscaling);
+  EXPECT_EQ(config.worker_autoscaling->min_workers, 2);
+  EXPECT_EQ(config.worker_autoscaling->check_interval, 100ms);
+  EXPECT_EQ(config.worker_autoscaling->scale_up_wait_time, 1ms);
+
+  EXPECT_ANY_THROW(parse(R"(
+    worker_threads: 4
+    worker-autoscaling:
+      min-workers: 5
+  )"));
+  EXPECT_ANY_THROW(parse(R"(
+    worker_threads: 4
+    task-queue: work-stealing
+    worker-autoscaling:
+      min-workers: 1
+  )"));
+}
+
+TEST(WorkerAutoscaler, Evaluate) {
+  const engine::impl::WorkerAutoscaler autoscaler{MakeAutoscalingConfig(), 8};
+
+  // queue wait time is too high
+  EXPECT_EQ(autoscaler.Evaluate(1, 1ms, 100), 2);
+  EXPECT_EQ(autoscaler.Evaluate(4, 5ms, 100), 6);
+  EXPECT_EQ(autoscaler.Evaluate(7, 5ms, 100), 8);
+  EXPECT_EQ(autoscaler.Evaluate(8, 5ms, 100), 8);
+
+  // the workers are underloaded
+  EXPECT_EQ(autoscaler.Evaluate(4, 0us, 10), 3);
+  EXPECT_EQ(autoscaler.Evaluate(1, 0us, 10), 1);
+
+  // steady state
+  EXPECT_EQ(autoscaler.Evaluate(4, 0us, 80), 4);
+  EXPECT_EQ(autoscaler.Evaluate(4, 700us, 10), 4);
+}
+
+TEST(WorkerAutoscaler, ClampsToWorkerThreads) {
+  auto config = MakeAutoscalingConfig();
+  config.min_workers = 6;
+  const engine::impl::WorkerAutoscaler autoscaler{config, 4};
+
+  EXPECT_EQ(autoscaler.GetMinWorkers(), 4);
+  EXPECT_EQ(autoscaler.GetMaxWorkers(), 4);
+  EXPECT_EQ(autoscaler.Evaluate(4, 0us, 0), 4);
+}
+
+UTEST(WorkerAutoscaler, ParksAndUnparksWorkers) {
+  engine::TaskProcessorConfig config;
+  config.name = "autoscaling";
+  config.thread_name = "as-worker";
+  config.worker_threads = 4;
+  config.worker_autoscaling = MakeAutoscalingConfig();
+  engine::TaskProcessor task_processor{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+  ASSERT_TRUE(task_processor.HasWorkerAutoscaling());
+  EXPECT_EQ(task_processor.GetActiveWorkerCount(), 4);
+
+  const auto deadline = std::chrono::steady_clock::now() + kMaxTestTime;
+
+  // Light load: the workers are parked down to min-workers
+  while (task_processor.GetActiveWorkerCount() > 1 &&
+         std::chrono::steady_clock::now() < deadline) {
+    engine::AsyncNoSpan(task_processor, [] {}).Get();
+    engine::SleepFor(1ms);
+  }
+  EXPECT_EQ(task_processor.GetActiveWorkerCount(), 1);
+
+  // Heavy load: tasks wait in the queue, so the workers are unparked
+  std::atomic<bool> keep_busy{true};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 64; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&keep_busy] {
+      const auto busy_until = std::chrono::steady_clock::now() + 2ms;
+      while (keep_busy && std::chrono::steady_clock::now() < busy_until) {
+      }
+    }));
+  }
+  while (task_processor.GetActiveWorkerCount() == 1 &&
+         std::chrono::steady_clock::now() < deadline) {
+    engine::SleepFor(1ms);
+  }
+  EXPECT_GT(task_processor.GetActiveWorkerCount(), 1);
+
+  keep_busy = false;
+  engine::WaitAllChecked(tasks);
+}
+
+UTEST(WorkerAutoscaler, ParksIdleWorkers) {
+  engine::TaskProcessorConfig config;
+  config.name = "autoscaling";
+  config.thread_name = "as-worker";
+  config.worker_threads = 4;
+  config.worker_autoscaling = MakeAutoscalingConfig();
+  engine::TaskProcessor task_processor{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  // No tasks at all, the worker count is re-evaluated nevertheless
+  const auto deadline = std::chrono::steady_clock::now() + kMaxTestTime;
+  while (task_processor.GetActiveWorkerCount() > 1 &&
+         std::chrono::steady_clock::now() < deadline) {
+    engine::SleepFor(1ms);
+  }
+  EXPECT_EQ(task_processor.GetActiveWorkerCount(), 1);
+}
+
+USERVER_NAMESPACE_END
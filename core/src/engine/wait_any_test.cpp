@@ -4,8 +4,10 @@
 #include <atomic>
 #include <chrono>
 
+#include <userver/concurrent/queue.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
@@ -164,6 +166,92 @@ UTEST(WaitAny, Sample) {
   /// [sample waitany]
 }
 
+UTEST(WaitAny, SingleConsumerEvent) {
+  engine::SingleConsumerEvent event;
+  auto task = engine::AsyncNoSpan([] {
+    engine::InterruptibleSleepFor(20s);
+    return 1;
+  });
+
+  EXPECT_EQ(engine::WaitAnyFor(10ms, task, event), std::nullopt);
+
+  auto sender = engine::AsyncNoSpan([&event] { event.Send(); });
+  EXPECT_EQ(engine::WaitAny(task, event), 1);
+
+  // WaitAny does not reset the event
+  EXPECT_TRUE(event.IsReady());
+  EXPECT_TRUE(event.WaitForEventFor(0s));
+  EXPECT_FALSE(event.IsReady());
+}
+
+UTEST_MT(WaitAny, QueueConsumers, 2) {
+  /// [sample waitany queues]
+  auto numbers_queue = concurrent::SpscQueue<int>::Create();
+  auto strings_queue = concurrent::NonFifoMpscQueue<std::string>::Create();
+  auto numbers = numbers_queue->GetConsumer();
+  auto strings = strings_queue->GetConsumer();
+
+  auto producer = engine::AsyncNoSpan(
+      [numbers_producer = numbers_queue->GetProducer(),
+       strings_producer = strings_queue->GetMultiProducer()] {
+        for (int i = 0; i < 100; ++i) {
+          ASSERT_TRUE(numbers_producer.Push(int{i}));
+          ASSERT_TRUE(strings_producer.Push(std::to_string(i)));
+        }
+      });
+
+  int numbers_sum = 0;
+  std::string last_string;
+  bool numbers_done = false;
+  bool strings_done = false;
+  while (!numbers_done || !strings_done) {
+    // Wakes up once any of the queues has an element or has no producers
+    const auto ready = engine::WaitAnyFor(utest::kMaxTestWaitTime, numbers,
+                                          strings);
+    ASSERT_TRUE(ready);
+
+    if (*ready == 0) {
+      int value{};
+      if (numbers.PopNoblock(value)) {
+        numbers_sum += value;
+      } else {
+        numbers_done = true;
+      }
+    } else {
+      std::string value;
+      if (strings.PopNoblock(value)) {
+        last_string = std::move(value);
+      } else {
+        strings_done = true;
+      }
+    }
+  }
+  /// [sample waitany queues]
+
+  UEXPECT_NO_THROW(producer.Get());
+  EXPECT_EQ(numbers_sum, 99 * 100 / 2);
+  EXPECT_FALSE(last_string.empty());
+}
+
+UTEST(WaitAny, QueueConsumerAndDeadline) {
+  auto queue = concurrent::SpscQueue<int>::Create();
+  auto consumer = queue->GetConsumer();
+  auto producer = queue->GetProducer();
+
+  EXPECT_EQ(engine::WaitAnyFor(10ms, consumer), std::nullopt);
+
+  auto pusher = engine::AsyncNoSpan([&producer] {
+    engine::SleepFor(10ms);
+    ASSERT_TRUE(producer.Push(42));
+  });
+  EXPECT_EQ(engine::WaitAnyFor(utest::kMaxTestWaitTime, consumer), 0);
+
+  int value{};
+  ASSERT_TRUE(consumer.PopNoblock(value));
+  EXPECT_EQ(value, 42);
+  EXPECT_EQ(engine::WaitAnyFor(10ms, consumer), std::nullopt);
+}
+
 UTEST(WaitAny, Throwing) {
   const size_t kTaskCount = 2;
   std::vector<engine::TaskWithResult<void>> tasks;
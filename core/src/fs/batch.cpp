@@ -0,0 +1,96 @@
+#include <userver/fs/batch.hpp>
+
+#include <algorithm>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+namespace {
+
+// Calls `func(i)` for each i in [0, count), `files_per_task` calls per task
+template <typename Func>
+void ForEachInBatches(engine::TaskProcessor& async_tp, std::size_t count,
+                      const BatchSettings& settings, const Func& func) {
+  UINVARIANT(settings.files_per_task > 0, "files_per_task must be positive");
+  if (count == 0) return;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve((count - 1) / settings.files_per_task + 1);
+  for (std::size_t begin = 0; begin < count;
+       begin += settings.files_per_task) {
+    const auto end = std::min(count, begin + settings.files_per_task);
+    tasks.push_back(engine::AsyncNoSpan(async_tp, [&func, begin, end] {
+      for (auto i = begin; i < end; ++i) func(i);
+    }));
+  }
+
+  // on failure the rest of the tasks are cancelled and waited for in
+  // destructors
+  for (auto& task : tasks) task.Get();
+}
+
+}  // namespace
+
+std::vector<std::string> ReadFilesContents(
+    engine::TaskProcessor& async_tp, const std::vector<std::string>& paths,
+    const BatchSettings& settings) {
+  std::vector<std::string> result(paths.size());
+  ForEachInBatches(async_tp, paths.size(), settings, [&](std::size_t i) {
+    result[i] = fs::blocking::ReadFileContents(paths[i]);
+  });
+  return result;
+}
+
+std::vector<FileInfoWithData> ReadFilesInfoWithData(
+    engine::TaskProcessor& async_tp, const std::vector<std::string>& paths,
+    std::optional<std::size_t> max_data_size, const BatchSettings& settings) {
+  std::vector<FileInfoWithData> result(paths.size());
+  ForEachInBatches(async_tp, paths.size(), settings, [&](std::size_t i) {
+    auto& info = result[i];
+    info.extension = boost::filesystem::path(paths[i]).extension().string();
+    info.path = paths[i];
+    info.size = boost::filesystem::file_size(paths[i]);
+    info.is_data_loaded = !max_data_size || info.size <= *max_data_size;
+    if (info.is_data_loaded) {
+      info.data = fs::blocking::ReadFileContents(paths[i]);
+      info.size = info.data.size();
+    }
+  });
+  return result;
+}
+
+std::vector<FileStat> StatFiles(engine::TaskProcessor& async_tp,
+                                const std::vector<std::string>& paths,
+                                const BatchSettings& settings) {
+  std::vector<FileStat> result(paths.size());
+  ForEachInBatches(async_tp, paths.size(), settings, [&](std::size_t i) {
+    auto& stat = result[i];
+    stat.type = boost::filesystem::status(paths[i]).type();
+    if (stat.type == boost::filesystem::regular_file) {
+      stat.size = boost::filesystem::file_size(paths[i]);
+    }
+  });
+  return result;
+}
+
+void RewriteFilesContents(
+    engine::TaskProcessor& async_tp,
+    const std::vector<std::pair<std::string, std::string>>& files,
+    const BatchSettings& settings) {
+  ForEachInBatches(async_tp, files.size(), settings, [&](std::size_t i) {
+    fs::blocking::RewriteFileContents(files[i].first, files[i].second);
+  });
+}
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
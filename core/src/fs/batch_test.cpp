@@ -0,0 +1,83 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/batch.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kFilesCount = 100;
+
+std::vector<std::pair<std::string, std::string>> MakeFiles(
+    const std::string& dir) {
+  std::vector<std::pair<std::string, std::string>> files;
+  for (std::size_t i = 0; i < kFilesCount; ++i) {
+    files.emplace_back(dir + "/file" + std::to_string(i),
+                       std::string(i, static_cast<char>('a' + i % 26)));
+  }
+  return files;
+}
+
+}  // namespace
+
+UTEST_MT(AsyncFsBatch, WriteReadStat, 2) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+  const fs::BatchSettings settings{7};
+
+  const auto files = MakeFiles(dir.GetPath());
+  fs::RewriteFilesContents(async_tp, files, settings);
+
+  std::vector<std::string> paths;
+  for (const auto& [path, contents] : files) paths.push_back(path);
+
+  const auto contents = fs::ReadFilesContents(async_tp, paths, settings);
+  ASSERT_EQ(contents.size(), kFilesCount);
+  for (std::size_t i = 0; i < kFilesCount; ++i) {
+    EXPECT_EQ(contents[i], files[i].second);
+  }
+
+  paths.push_back(dir.GetPath() + "/missing");
+  paths.push_back(dir.GetPath());
+  const auto stats = fs::StatFiles(async_tp, paths, settings);
+  ASSERT_EQ(stats.size(), kFilesCount + 2);
+  for (std::size_t i = 0; i < kFilesCount; ++i) {
+    EXPECT_EQ(stats[i].type, boost::filesystem::regular_file);
+    EXPECT_EQ(stats[i].size, files[i].second.size());
+  }
+  EXPECT_EQ(stats[kFilesCount].type, boost::filesystem::file_not_found);
+  EXPECT_EQ(stats[kFilesCount + 1].type, boost::filesystem::directory_file);
+}
+
+UTEST(AsyncFsBatch, ReadFilesInfoWithData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+  const auto files = MakeFiles(dir.GetPath());
+  fs::blocking::RewriteFileContents(files[10].first, files[10].second);
+  fs::blocking::RewriteFileContents(files[90].first, files[90].second);
+
+  const auto infos = fs::ReadFilesInfoWithData(
+      async_tp, {files[10].first, files[90].first}, 50);
+  ASSERT_EQ(infos.size(), 2u);
+  EXPECT_TRUE(infos[0].is_data_loaded);
+  EXPECT_EQ(infos[0].data, files[10].second);
+  EXPECT_FALSE(infos[1].is_data_loaded);
+  EXPECT_EQ(infos[1].size, 90u);
+  EXPECT_EQ(infos[1].path, files[90].first);
+}
+
+UTEST(AsyncFsBatch, ReadFailure) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  EXPECT_THROW(
+      fs::ReadFilesContents(async_tp, {dir.GetPath() + "/missing"}),
+      std::runtime_error);
+  EXPECT_TRUE(fs::ReadFilesContents(async_tp, {}).empty());
+}
+
+USERVER_NAMESPACE_END
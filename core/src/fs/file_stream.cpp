@@ -0,0 +1,117 @@
+#include <userver/fs/file_stream.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+namespace {
+
+std::unique_ptr<blocking::FileDescriptor> OpenFile(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    blocking::OpenMode flags, boost::filesystem::perms perms) {
+  return engine::AsyncNoSpan(async_tp, [&path, flags, perms] {
+           return std::make_unique<blocking::FileDescriptor>(
+               blocking::FileDescriptor::Open(path, flags, perms));
+         })
+      .Get();
+}
+
+}  // namespace
+
+FileReader::FileReader(engine::TaskProcessor& async_tp,
+                       const std::string& path, std::size_t chunk_size)
+    : async_tp_(&async_tp),
+      chunk_size_(chunk_size),
+      fd_(OpenFile(async_tp, path, blocking::OpenFlag::kRead,
+                   boost::filesystem::perms::no_perms)) {
+  UINVARIANT(chunk_size_ > 0, "chunk_size must be positive");
+  StartReadahead();
+}
+
+FileReader::FileReader(FileReader&&) noexcept = default;
+
+FileReader::~FileReader() = default;
+
+std::string FileReader::ReadChunk() {
+  // invalid after the end of the file or an error
+  if (!readahead_.IsValid()) return {};
+
+  auto chunk = readahead_.Get();
+  if (!chunk.empty()) StartReadahead();
+  return chunk;
+}
+
+void FileReader::StartReadahead() {
+  readahead_ = engine::AsyncNoSpan(
+      *async_tp_, [fd = fd_.get(), chunk_size = chunk_size_] {
+        std::string chunk(chunk_size, '\0');
+        std::size_t size = 0;
+        while (size < chunk_size) {
+          const auto read = fd->Read(chunk.data() + size, chunk_size - size);
+          if (read == 0) break;
+          size += read;
+        }
+        chunk.resize(size);
+        return chunk;
+      });
+}
+
+FileWriter::FileWriter(engine::TaskProcessor& async_tp,
+                       const std::string& path, boost::filesystem::perms perms,
+                       std::size_t chunk_size)
+    : async_tp_(&async_tp),
+      chunk_size_(chunk_size),
+      fd_(OpenFile(async_tp, path,
+                   {blocking::OpenFlag::kWrite,
+                    blocking::OpenFlag::kCreateIfNotExists,
+                    blocking::OpenFlag::kTruncate},
+                   perms)) {
+  UINVARIANT(chunk_size_ > 0, "chunk_size must be positive");
+  buffer_.reserve(chunk_size_);
+}
+
+FileWriter::FileWriter(FileWriter&&) noexcept = default;
+
+FileWriter::~FileWriter() = default;
+
+void FileWriter::Write(std::string_view data) {
+  UINVARIANT(fd_, "Write after Finish");
+  while (!data.empty()) {
+    const auto size = std::min(data.size(), chunk_size_ - buffer_.size());
+    buffer_.append(data.substr(0, size));
+    data.remove_prefix(size);
+    if (buffer_.size() == chunk_size_) Flush();
+  }
+}
+
+void FileWriter::Finish() {
+  UINVARIANT(fd_, "Finish is called twice");
+  Flush();
+  write_task_.Get();
+  engine::AsyncNoSpan(*async_tp_, [fd = std::move(fd_)] {
+    fd->FSync();
+    std::move(*fd).Close();
+  }).Get();
+}
+
+void FileWriter::Flush() {
+  // keeps the order of the writes and reports the errors
+  if (write_task_.IsValid()) write_task_.Get();
+
+  write_task_ = engine::AsyncNoSpan(
+      *async_tp_, [fd = fd_.get(), data = std::move(buffer_)] {
+        if (!data.empty()) fd->Write(data);
+      });
+  buffer_ = {};
+  buffer_.reserve(chunk_size_);
+}
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
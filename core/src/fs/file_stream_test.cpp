@@ -0,0 +1,80 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/fs/file_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeContents() {
+  std::string contents;
+  for (int i = 0; i < 10000; ++i) contents += std::to_string(i) + '\n';
+  return contents;
+}
+
+}  // namespace
+
+UTEST(AsyncFsStream, Read) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  const auto contents = MakeContents();
+  fs::blocking::RewriteFileContents(path, contents);
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  /// [FileReader example]
+  fs::FileReader reader{async_tp, path, 1000};
+  std::string result;
+  while (true) {
+    const auto chunk = reader.ReadChunk();
+    if (chunk.empty()) break;
+    result += chunk;
+  }
+  /// [FileReader example]
+
+  EXPECT_EQ(result, contents);
+  EXPECT_EQ(reader.ReadChunk(), "");
+}
+
+UTEST(AsyncFsStream, ReadMissing) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  EXPECT_THROW(fs::FileReader(async_tp, dir.GetPath() + "/missing"),
+               std::runtime_error);
+}
+
+UTEST(AsyncFsStream, Write) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  const auto contents = MakeContents();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  /// [FileWriter example]
+  fs::FileWriter writer{async_tp, path};
+  for (int i = 0; i < 10000; ++i) writer.Write(std::to_string(i) + '\n');
+  writer.Finish();
+  /// [FileWriter example]
+
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), contents);
+}
+
+UTEST(AsyncFsStream, WriteSmallChunks) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/file";
+  const auto contents = MakeContents();
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  fs::FileWriter writer{async_tp, path, boost::filesystem::perms::owner_all,
+                        7};
+  writer.Write(contents.substr(0, 100));
+  writer.Write(contents.substr(100));
+  writer.Finish();
+
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), contents);
+}
+
+USERVER_NAMESPACE_END
@@ -1,14 +1,26 @@
 #include <userver/fs/fs_cache_client.hpp>
 
+#include <algorithm>
+#include <set>
+
+#include <fmt/format.h>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/batch.hpp>
 #include <userver/fs/read.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/hash.hpp>
 #include <userver/utils/periodic_task.hpp>
 
+#include <compression/compressor.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -29,31 +41,106 @@ std::string GetNormalizeDirectory(std::string_view dir) {
 
 namespace fs {
 
-#ifdef __linux__
 namespace {
 
+constexpr std::size_t kFilesPerTask = 64;
+constexpr int kGzipLevel = 9;
+#ifndef USERVER_NO_BROTLI
+constexpr int kBrotliLevel = 9;
+#endif
+
+#ifdef __linux__
+// inotify events that come within the window are applied together, so a file
+// that is written in many chunks is reloaded once
+constexpr std::chrono::milliseconds kEventsWindow{50};
+#endif
+
 bool IsFilepathHidden(const std::string& path) {
   auto filename = boost::filesystem::path(path).filename().string();
   return filename[0] == '.';
 }
 
+struct DirectoryListing {
+  std::vector<std::string> directories;
+  std::vector<std::string> files;
+};
+
+// Lists the directory recursively in a single task, skips the hidden files
+DirectoryListing ListDirectory(engine::TaskProcessor& tp,
+                               const std::string& path) {
+  return engine::AsyncNoSpan(tp, [&path] {
+           DirectoryListing listing;
+           listing.directories.push_back(path);
+           for (boost::filesystem::recursive_directory_iterator it(path), end;
+                it != end; ++it) {
+             const auto type = it->status().type();
+             auto entry_path = it->path().string();
+             if (type == boost::filesystem::directory_file) {
+               listing.directories.push_back(std::move(entry_path));
+             } else if (type == boost::filesystem::regular_file &&
+                        !IsFilepathHidden(entry_path)) {
+               listing.files.push_back(std::move(entry_path));
+             }
+           }
+           return listing;
+         })
+      .Get();
+}
+
+std::string CompressIfSmaller(compression::Algorithm algorithm,
+                              const std::string& data, int level) {
+  auto compressed = compression::Compress(algorithm, data, level);
+  if (compressed.size() >= data.size()) return {};
+  return compressed;
+}
+
+void PrepareFile(FileInfoWithData& info, bool precompress) {
+  if (!info.is_data_loaded) return;
+  info.etag = fmt::format("\"{:016x}\"", utils::hash::WyHash(info.data));
+  if (precompress && !info.data.empty()) {
+    info.gzip_data = CompressIfSmaller(compression::Algorithm::kGzip,
+                                       info.data, kGzipLevel);
+#ifndef USERVER_NO_BROTLI
+    info.brotli_data = CompressIfSmaller(compression::Algorithm::kBrotli,
+                                         info.data, kBrotliLevel);
+#endif
+  }
+}
+
 }  // namespace
-#endif  // __linux__
 
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
-                             engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
-  UpdateCache();
-
+                             engine::TaskProcessor& tp,
+                             std::optional<std::size_t> max_cached_file_size,
+                             bool precompress)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      max_cached_file_size_(max_cached_file_size),
+      precompress_(precompress),
+      tp_(tp) {
   if (update_period_ == std::chrono::milliseconds(0)) {
+    UpdateCache();
     return;
   }
 
 #ifdef __linux__
-  inotify_task_ =
-      utils::CriticalAsync("inotify_task", [this] { InotifyWork(); });
+  // The watches are added before the files are read, so no change is missed
+  auto inotify = std::make_unique<engine::io::sys::linux::Inotify>();
+  const auto paths = WatchDirectory(*inotify, dir_);
+  FileInfoWithDataMap map;
+  for (auto& info : LoadFiles(paths)) {
+    auto relative_path = GetLexicallyRelative(info.path, dir_);
+    map[std::move(relative_path)] =
+        std::make_shared<const FileInfoWithData>(std::move(info));
+  }
+  data_.Assign(std::move(map));
+
+  inotify_task_ = utils::CriticalAsync(
+      "inotify_task",
+      [this, inotify = std::move(inotify)] { InotifyWork(*inotify); });
 #else
+  UpdateCache();
   cache_updater_.Start("fs_cache_updater",
                        utils::PeriodicTask::Settings{update_period_},
                        [this] { UpdateCache(); });
@@ -61,41 +148,71 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
-  auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+  FileInfoWithDataMap map;
+  for (auto& info : LoadFiles(ListDirectory(tp_, dir_).files)) {
+    auto relative_path = GetLexicallyRelative(info.path, dir_);
+    map[std::move(relative_path)] =
+        std::make_shared<const FileInfoWithData>(std::move(info));
+  }
   data_.Assign(std::move(map));
 }
 
+std::vector<FileInfoWithData> FsCacheClient::LoadFiles(
+    const std::vector<std::string>& paths) const {
+  auto infos = ReadFilesInfoWithData(tp_, paths, max_cached_file_size_,
+                                     BatchSettings{kFilesPerTask});
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t begin = 0; begin < infos.size(); begin += kFilesPerTask) {
+    const auto end = std::min(infos.size(), begin + kFilesPerTask);
+    tasks.push_back(engine::AsyncNoSpan(tp_, [this, &infos, begin, end] {
+      for (auto i = begin; i < end; ++i) PrepareFile(infos[i], precompress_);
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  return infos;
+}
+
 #ifdef __linux__
-void FsCacheClient::InotifyWork() {
+void FsCacheClient::InotifyWork(engine::io::sys::linux::Inotify& inotify) {
   namespace linux = engine::io::sys::linux;
-  linux::Inotify inotify;
-
-  HandleCreateDirectory(inotify, dir_);
 
   while (!engine::current_task::ShouldCancel()) {
     auto event = inotify.Poll({});
-    LOG_INFO() << event;
     if (!event) return;
 
-    if (event->mask & linux::EventType::kMovedFrom ||
-        event->mask & linux::EventType::kDelete) {
-      if (!(event->mask & linux::EventType::kIsDir)) {
-        HandleDelete(event->path);
-      } else {
-        HandleDeleteDirectory(inotify, event->path);
+    std::set<std::string> changed;
+    const auto deadline = engine::Deadline::FromDuration(kEventsWindow);
+    for (; event; event = inotify.Poll(deadline)) {
+      LOG_DEBUG() << event;
+
+      if (event->mask & linux::EventType::kMovedFrom ||
+          event->mask & linux::EventType::kDelete) {
+        if (!(event->mask & linux::EventType::kIsDir)) {
+          changed.erase(event->path);
+          HandleDelete(event->path);
+        } else {
+          HandleDeleteDirectory(inotify, event->path);
+        }
       }
-    }
 
-    if (event->mask & linux::EventType::kMovedTo ||
-        event->mask & linux::EventType::kCreate ||
-        event->mask & linux::EventType::kModify) {
-      if (!(event->mask & linux::EventType::kIsDir)) {
-        HandleCreate(event->path);
-      } else {
-        HandleCreateDirectory(inotify, event->path);
+      if (event->mask & linux::EventType::kMovedTo ||
+          event->mask & linux::EventType::kCreate ||
+          event->mask & linux::EventType::kModify ||
+          event->mask & linux::EventType::kCloseWrite) {
+        if (!(event->mask & linux::EventType::kIsDir)) {
+          if (!IsFilepathHidden(event->path)) changed.insert(event->path);
+        } else {
+          for (auto& path : WatchDirectory(inotify, event->path)) {
+            changed.insert(std::move(path));
+          }
+        }
       }
     }
+
+    if (engine::current_task::ShouldCancel()) return;
+    HandleChanges({changed.begin(), changed.end()});
   }
 }
 
@@ -105,47 +222,68 @@ void FsCacheClient::HandleDelete(const std::string& path) {
 
 void FsCacheClient::HandleDeleteDirectory(
     engine::io::sys::linux::Inotify& inotify, const std::string& path) {
-  LOG_INFO() << "HandleDeleteDirectory()";
-  inotify.RmWatch(path);
+  LOG_INFO() << "HandleDeleteDirectory(" << path << ")";
+  try {
+    inotify.RmWatch(path);
+  } catch (const std::exception& ex) {
+    // the watch of a removed directory is removed by the kernel
+    LOG_DEBUG() << "Failed to remove the watch of " << path << ": " << ex;
+  }
+
+  // the directory may be moved away with the files in it
+  const auto prefix = GetLexicallyRelative(path, dir_) + '/';
+  for (const auto& [relative_path, info] : data_.GetSnapshot()) {
+    if (relative_path.compare(0, prefix.size(), prefix) == 0) {
+      data_.Erase(relative_path);
+    }
+  }
 }
 
-void FsCacheClient::HandleCreate(const std::string& path) {
-  if (IsFilepathHidden(path)) return;
+void FsCacheClient::HandleChanges(const std::vector<std::string>& paths) {
+  if (paths.empty()) return;
 
-  FileInfoWithData info{};
-  info.extension = boost::filesystem::path(path).extension().string();
-  info.data = ReadFileContents(tp_, path);
-  data_.InsertOrAssign(
-      GetLexicallyRelative(path, dir_),
-      std::make_shared<const FileInfoWithData>(std::move(info)));
+  std::vector<FileInfoWithData> infos;
+  try {
+    infos = LoadFiles(paths);
+  } catch (const std::exception& batch_ex) {
+    // some file is gone already, load them one by one
+    LOG_DEBUG() << "Failed to load the changed files at once: " << batch_ex;
+    for (const auto& path : paths) {
+      try {
+        auto loaded = LoadFiles({path});
+        infos.push_back(std::move(loaded[0]));
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to load " << path << ": " << ex;
+        HandleDelete(path);
+      }
+    }
+  }
+
+  for (auto& info : infos) {
+    auto relative_path = GetLexicallyRelative(info.path, dir_);
+    data_.InsertOrAssign(
+        std::move(relative_path),
+        std::make_shared<const FileInfoWithData>(std::move(info)));
+  }
 }
 
-void FsCacheClient::HandleCreateDirectory(
+std::vector<std::string> FsCacheClient::WatchDirectory(
     engine::io::sys::linux::Inotify& inotify, const std::string& path) {
-  LOG_INFO() << "HandleCreateDirectory(" << path << ")";
+  LOG_INFO() << "WatchDirectory(" << path << ")";
   namespace linux = engine::io::sys::linux;
-  inotify.AddWatch(path, {
-                             linux::EventType::kModify,
-                             linux::EventType::kMovedFrom,
-                             linux::EventType::kMovedTo,
-                             linux::EventType::kDelete,
-                             linux::EventType::kCreate,
-                         });
-
-  for (auto it =
-           utils::Async(
-               tp_, "init",
-               [&path] { return boost::filesystem::directory_iterator(path); })
-               .Get();
-       it != boost::filesystem::directory_iterator();
-       utils::Async(tp_, "next", [&it] { ++it; }).Get()) {
-    if (is_directory(it->status())) {
-      HandleCreateDirectory(inotify,
-                            path + '/' + it->path().filename().string());
-    } else {
-      HandleCreate(path + '/' + it->path().filename().string());
-    }
+
+  auto listing = ListDirectory(tp_, path);
+  for (const auto& directory : listing.directories) {
+    inotify.AddWatch(directory, {
+                                    linux::EventType::kModify,
+                                    linux::EventType::kCloseWrite,
+                                    linux::EventType::kMovedFrom,
+                                    linux::EventType::kMovedTo,
+                                    linux::EventType::kDelete,
+                                    linux::EventType::kCreate,
+                                });
   }
+  return std::move(listing.files);
 }
 #endif
 
@@ -0,0 +1,251 @@
+#include <userver/fs/fs_cache_client.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Longer than the window in which the inotify events are coalesced
+constexpr std::chrono::milliseconds kSettleTime{200};
+
+const std::string kCompressible(4096, 'a');
+
+template <typename Predicate>
+bool WaitForFile(const fs::FsCacheClient& client, std::string_view path,
+                 Predicate predicate) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (!predicate(client.TryGetFile(path))) {
+    if (deadline.IsReached()) return false;
+    engine::SleepFor(1ms);
+  }
+  return true;
+}
+
+bool WaitForData(const fs::FsCacheClient& client, std::string_view path,
+                 std::string_view data) {
+  return WaitForFile(client, path, [data](const auto& file) {
+    return file && file->data == data;
+  });
+}
+
+bool WaitForRemoval(const fs::FsCacheClient& client, std::string_view path) {
+  return WaitForFile(client, path, [](const auto& file) { return !file; });
+}
+
+class FsCacheClient : public ::testing::Test {
+ protected:
+  void Write(const std::string& relative_path, std::string_view contents) {
+    fs::blocking::RewriteFileContents(dir_.GetPath() + relative_path,
+                                      contents);
+  }
+
+  std::string Path(const std::string& relative_path) const {
+    return dir_.GetPath() + relative_path;
+  }
+
+  fs::FsCacheClient MakeClient(std::chrono::milliseconds update_period,
+                               std::optional<std::size_t> max_size = {},
+                               bool precompress = false) const {
+    return fs::FsCacheClient{dir_.GetPath(), update_period,
+                             engine::current_task::GetTaskProcessor(),
+                             max_size, precompress};
+  }
+
+  const fs::blocking::TempDirectory dir_ =
+      fs::blocking::TempDirectory::Create();
+};
+
+}  // namespace
+
+UTEST_F(FsCacheClient, InitialLoad) {
+  fs::blocking::CreateDirectories(Path("/dir"));
+  Write("/a.txt", "a");
+  Write("/dir/b.txt", "b");
+  Write("/.hidden", "hidden");
+
+  const auto client = MakeClient(0ms);
+
+  const auto a = client.TryGetFile("/a.txt");
+  ASSERT_TRUE(a);
+  EXPECT_EQ(a->data, "a");
+  EXPECT_EQ(a->size, 1);
+  EXPECT_EQ(a->extension, ".txt");
+  EXPECT_TRUE(a->is_data_loaded);
+  EXPECT_TRUE(a->gzip_data.empty());
+  EXPECT_TRUE(a->brotli_data.empty());
+
+  const auto b = client.TryGetFile("/dir/b.txt");
+  ASSERT_TRUE(b);
+  EXPECT_EQ(b->data, "b");
+
+  EXPECT_FALSE(client.TryGetFile("/.hidden"));
+  EXPECT_FALSE(client.TryGetFile("/missing.txt"));
+}
+
+UTEST_F(FsCacheClient, ETag) {
+  Write("/a.txt", "a");
+  Write("/b.txt", "b");
+  Write("/c.txt", "a");
+
+  const auto client = MakeClient(0ms);
+  const auto a = client.TryGetFile("/a.txt");
+  const auto b = client.TryGetFile("/b.txt");
+  const auto c = client.TryGetFile("/c.txt");
+  ASSERT_TRUE(a && b && c);
+
+  // a strong ETag is a quoted string
+  ASSERT_GE(a->etag.size(), 2);
+  EXPECT_EQ(a->etag.front(), '"');
+  EXPECT_EQ(a->etag.back(), '"');
+
+  EXPECT_NE(a->etag, b->etag);
+  EXPECT_EQ(a->etag, c->etag);
+}
+
+UTEST_F(FsCacheClient, MaxCachedFileSize) {
+  Write("/small.txt", "small");
+  Write("/big.txt", kCompressible);
+
+  const auto client = MakeClient(0ms, 16, true);
+
+  const auto small = client.TryGetFile("/small.txt");
+  ASSERT_TRUE(small);
+  EXPECT_TRUE(small->is_data_loaded);
+  EXPECT_EQ(small->data, "small");
+
+  const auto big = client.TryGetFile("/big.txt");
+  ASSERT_TRUE(big);
+  EXPECT_FALSE(big->is_data_loaded);
+  EXPECT_EQ(big->size, kCompressible.size());
+  EXPECT_EQ(big->path, Path("/big.txt"));
+  EXPECT_TRUE(big->data.empty());
+  EXPECT_TRUE(big->etag.empty());
+  EXPECT_TRUE(big->gzip_data.empty());
+  EXPECT_TRUE(big->brotli_data.empty());
+}
+
+UTEST_F(FsCacheClient, Precompress) {
+  Write("/big.txt", kCompressible);
+  Write("/tiny.txt", "a");
+
+  const auto client = MakeClient(0ms, {}, true);
+
+  const auto big = client.TryGetFile("/big.txt");
+  ASSERT_TRUE(big);
+  EXPECT_EQ(big->data, kCompressible);
+  ASSERT_FALSE(big->gzip_data.empty());
+  EXPECT_LT(big->gzip_data.size(), big->data.size());
+  // gzip magic bytes
+  EXPECT_EQ(big->gzip_data.substr(0, 2), "\x1f\x8b");
+  EXPECT_FALSE(big->brotli_data.empty());
+  EXPECT_LT(big->brotli_data.size(), big->data.size());
+
+  // compression does not pay off for the tiny files
+  const auto tiny = client.TryGetFile("/tiny.txt");
+  ASSERT_TRUE(tiny);
+  EXPECT_TRUE(tiny->gzip_data.empty());
+  EXPECT_TRUE(tiny->brotli_data.empty());
+}
+
+UTEST_F(FsCacheClient, Updates) {
+  fs::blocking::CreateDirectories(Path("/dir"));
+  Write("/a.txt", "a");
+  Write("/b.txt", "b");
+  Write("/dir/c.txt", "c");
+
+  const auto client = MakeClient(1ms, {}, true);
+  const auto old_a = client.TryGetFile("/a.txt");
+  const auto old_b = client.TryGetFile("/b.txt");
+  ASSERT_TRUE(old_a && old_b);
+
+  // modify
+  Write("/a.txt", kCompressible);
+  ASSERT_TRUE(WaitForData(client, "/a.txt", kCompressible));
+  const auto new_a = client.TryGetFile("/a.txt");
+  EXPECT_NE(new_a->etag, old_a->etag);
+  EXPECT_FALSE(new_a->gzip_data.empty());
+#ifdef __linux__
+  // only the changed files are reloaded
+  EXPECT_EQ(client.TryGetFile("/b.txt"), old_b);
+#endif
+
+  // add
+  Write("/d.txt", "d");
+  EXPECT_TRUE(WaitForData(client, "/d.txt", "d"));
+
+  // add a directory
+  fs::blocking::CreateDirectories(Path("/new/nested"));
+  Write("/new/nested/e.txt", "e");
+  EXPECT_TRUE(WaitForData(client, "/new/nested/e.txt", "e"));
+
+  // files in the added directories are watched as well
+  Write("/new/nested/e.txt", "ee");
+  EXPECT_TRUE(WaitForData(client, "/new/nested/e.txt", "ee"));
+
+  // hidden files are ignored
+  Write("/.hidden", "hidden");
+
+  // rename
+  fs::blocking::Rename(Path("/d.txt"), Path("/renamed.txt"));
+  EXPECT_TRUE(WaitForData(client, "/renamed.txt", "d"));
+  EXPECT_TRUE(WaitForRemoval(client, "/d.txt"));
+
+  // remove
+  fs::blocking::RemoveSingleFile(Path("/b.txt"));
+  EXPECT_TRUE(WaitForRemoval(client, "/b.txt"));
+
+  // remove a directory
+  boost::filesystem::remove_all(Path("/dir"));
+  EXPECT_TRUE(WaitForRemoval(client, "/dir/c.txt"));
+
+  // move a directory away
+  const auto outside = fs::blocking::TempDirectory::Create();
+  fs::blocking::Rename(Path("/new"), outside.GetPath() + "/new");
+  EXPECT_TRUE(WaitForRemoval(client, "/new/nested/e.txt"));
+
+  EXPECT_FALSE(client.TryGetFile("/.hidden"));
+  EXPECT_TRUE(client.TryGetFile("/a.txt"));
+  EXPECT_TRUE(client.TryGetFile("/renamed.txt"));
+}
+
+UTEST_F(FsCacheClient, CoalescedWrites) {
+  const auto client = MakeClient(1ms);
+
+  {
+    auto file = fs::blocking::FileDescriptor::Open(
+        Path("/chunks.txt"),
+        {fs::blocking::OpenFlag::kWrite,
+         fs::blocking::OpenFlag::kCreateIfNotExists});
+    file.Write("first");
+    engine::SleepFor(5ms);
+    file.Write(" second");
+    engine::SleepFor(5ms);
+    file.Write(" third");
+    std::move(file).Close();
+  }
+
+  ASSERT_TRUE(WaitForData(client, "/chunks.txt", "first second third"));
+
+#ifdef __linux__
+  const auto loaded = client.TryGetFile("/chunks.txt");
+  // all the events of the writes are applied at once, nothing is reloaded
+  // after the final contents are seen
+  engine::SleepFor(kSettleTime);
+  EXPECT_EQ(client.TryGetFile("/chunks.txt"), loaded);
+#endif
+}
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,13 @@
 #include <userver/fs/read.hpp>
 
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
 #include <userver/engine/async.hpp>
+#include <userver/fs/batch.hpp>
 #include <userver/fs/blocking/read.hpp>
-#include <userver/utils/async.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -31,27 +36,38 @@ std::string ReadFileContents(engine::TaskProcessor& async_tp,
       .Get();
 }
 
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    std::optional<std::size_t> max_data_size) {
+  return std::move(ReadFilesInfoWithData(async_tp, {path}, max_data_size)[0]);
+}
+
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp, const std::string& path,
-    utils::Flags<SettingsReadFile> flags) {
+    utils::Flags<SettingsReadFile> flags,
+    std::optional<std::size_t> max_data_size) {
+  // the whole traversal is a single task, the files are read in batches
+  const auto paths =
+      engine::AsyncNoSpan(async_tp, [&path, flags] {
+        std::vector<std::string> result;
+        for (boost::filesystem::recursive_directory_iterator it(path), end;
+             it != end; ++it) {
+          // only files
+          if (it->status().type() != boost::filesystem::regular_file) continue;
+          if ((flags & SettingsReadFile::kSkipHidden) &&
+              IsHiddenFile(it->path()))
+            continue;
+          result.push_back(it->path().string());
+        }
+        return result;
+      }).Get();
+
+  auto infos = ReadFilesInfoWithData(async_tp, paths, max_data_size);
+
   FileInfoWithDataMap data{};
-  for (auto it =
-           utils::Async(
-               async_tp, "init",
-               [&path] {
-                 return boost::filesystem::recursive_directory_iterator(path);
-               })
-               .Get();
-       it != boost::filesystem::recursive_directory_iterator();
-       utils::Async(async_tp, "next", [&it] { ++it; }).Get()) {
-    // only files
-    if (it->status().type() != boost::filesystem::regular_file) continue;
-    if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path()))
-      continue;
-    FileInfoWithData info{};
-    info.extension = it->path().extension().string();
-    info.data = ReadFileContents(async_tp, it->path().string());
-    data[GetLexicallyRelative(it->path().string(), path)] =
+  for (auto& info : infos) {
+    auto relative_path = GetLexicallyRelative(info.path, path);
+    data[std::move(relative_path)] =
         std::make_shared<const FileInfoWithData>(std::move(info));
   }
   return data;
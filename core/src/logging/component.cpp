@@ -252,6 +252,7 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -271,6 +272,10 @@ properties:
                     type: string
                     description: task processor for disk I/O operations for this logger
                     defaultDescription: fs-task-processor of the loggers component
+                direct-io:
+                    type: boolean
+                    description: write the log file in large aligned blocks with O_DIRECT where the file system allows it, and preallocate the file
+                    defaultDescription: false
                 testsuite-capture:
                     type: object
                     description: if exists, setups additional TCP log sink for testing purposes
@@ -55,6 +55,8 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
   config.fs_task_processor =
       value["fs-task-processor"].As<std::optional<std::string>>();
 
+  config.direct_io = value["direct-io"].As<bool>(config.direct_io);
+
   config.testsuite_capture =
       value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
 
@@ -43,6 +43,8 @@ struct LoggerConfig final {
 
   std::optional<std::string> fs_task_processor;
 
+  bool direct_io{false};
+
   std::optional<TestsuiteCaptureConfig> testsuite_capture;
 };
 
@@ -141,4 +141,32 @@ TEST_F(LoggingTest, DynamicDebugLimitedEnable) {
   EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("unrelated")));
 }
 
+TEST_F(LoggingTest, DynamicLogRateLimit) {
+  const std::string location{USERVER_FILEPATH};
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+
+  const auto do_log = [](std::string_view string) {
+#line 50001
+    LOG_INFO() << string;
+  };
+
+  logging::SetDynamicLogRateLimit(location, 50001,
+                                  {2, std::chrono::hours{1}});
+
+  do_log("limited 1");
+  do_log("limited 2");
+  do_log("limited 3");
+  LOG_INFO() << "unrelated";
+
+  logging::RemoveDynamicLogRateLimits();
+
+  do_log("after");
+
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("limited 1"));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("limited 2"));
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("limited 3")));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("unrelated"));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("after"));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,235 @@
+#include "block_file_sink.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+// O_DIRECT requires the buffer, the offset and the size of the writes to be
+// aligned to the logical block size of the device, 4KiB fits all the devices
+constexpr std::size_t kBlockSize = 4096;
+constexpr std::size_t kBufferSize = std::size_t{1} << 20;
+constexpr std::size_t kPreallocationSize = std::size_t{64} << 20;
+
+static_assert(kBufferSize % kBlockSize == 0);
+
+constexpr std::size_t AlignDown(std::size_t value) noexcept {
+  return value & ~(kBlockSize - 1);
+}
+
+constexpr std::size_t AlignUp(std::size_t value) noexcept {
+  return AlignDown(value + kBlockSize - 1);
+}
+
+[[noreturn]] void ThrowSystemError(const char* operation) {
+  throw std::system_error(errno, std::system_category(), operation);
+}
+
+void WriteAt(int fd, const char* data, std::size_t size, std::size_t offset) {
+  while (size > 0) {
+    const auto written = ::pwrite(fd, data, size, offset);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      ThrowSystemError("calling ::pwrite");
+    }
+
+    data += written;
+    size -= written;
+    offset += written;
+  }
+}
+
+std::size_t ReadAt(int fd, char* data, std::size_t size, std::size_t offset) {
+  while (true) {
+    const auto read = ::pread(fd, data, size, offset);
+    if (read < 0) {
+      if (errno == EINTR) continue;
+      ThrowSystemError("calling ::pread");
+    }
+    return read;
+  }
+}
+
+fs::blocking::FileDescriptor OpenNative(const std::string& filename,
+                                        fs::blocking::OpenMode flags,
+                                        boost::filesystem::perms perms,
+                                        bool& is_direct_io) {
+  int native_flags = O_RDWR | O_CREAT | O_CLOEXEC;
+  if (flags & fs::blocking::OpenFlag::kTruncate) native_flags |= O_TRUNC;
+
+  int fd = -1;
+#ifdef O_DIRECT
+  fd = ::open(filename.c_str(), native_flags | O_DIRECT, perms);
+  // tmpfs and some other file systems do not support O_DIRECT
+  if (fd == -1 && errno != EINVAL) ThrowSystemError("opening the log file");
+#endif
+  is_direct_io = fd != -1;
+  if (fd == -1) {
+    fd = utils::CheckSyscall(::open(filename.c_str(), native_flags, perms),
+                             "opening the log file '{}'", filename);
+  }
+  return fs::blocking::FileDescriptor::AdoptFd(fd);
+}
+
+// Constructible in the way logging::impl::OpenFile expects
+struct BlockFile final {
+  BlockFile(const std::string& filename, fs::blocking::OpenMode flags,
+            boost::filesystem::perms perms)
+      : fd(OpenNative(filename, flags, perms, is_direct_io)) {}
+
+  // Initialized before 'fd'
+  bool is_direct_io{false};
+  fs::blocking::FileDescriptor fd;
+};
+
+fs::blocking::FileDescriptor OpenBlockFile(const std::string& filename,
+                                           ReopenMode mode,
+                                           bool& is_direct_io) {
+  auto file = OpenFile<BlockFile>(filename, mode);
+  is_direct_io = file.is_direct_io;
+  return std::move(file.fd);
+}
+
+}  // namespace
+
+BlockFileSink::BlockFileSink(const std::string& filename)
+    : filename_(filename),
+      buffer_(static_cast<char*>(std::aligned_alloc(kBlockSize, kBufferSize))),
+      fd_(OpenBlockFile(filename_, ReopenMode::kAppend, is_direct_io_)) {
+  if (!buffer_) throw std::bad_alloc();
+  ReadTail();
+  if (buffer_offset_ + buffer_size_ > 0) Write("\n");
+}
+
+BlockFileSink::~BlockFileSink() {
+  try {
+    Flush();
+  } catch (const std::exception&) {
+    // The buffered logs are lost, there is no better place to report it
+  }
+}
+
+void BlockFileSink::Reopen(ReopenMode mode) {
+  // The old file is flushed before the new one is opened, as it may be the
+  // same file being truncated. The old file is kept if the new one cannot be
+  // opened.
+  Flush();
+  bool is_direct_io = false;
+  auto fd = OpenBlockFile(filename_, mode, is_direct_io);
+
+  fd_ = std::move(fd);
+  is_direct_io_ = is_direct_io;
+  ReadTail();
+}
+
+void BlockFileSink::Flush() {
+  if (!fd_.IsOpen()) return;
+
+  if (buffer_size_ != 0) {
+    // A direct write of the padded last block would need ftruncate to cut the
+    // padding, and ftruncate drops the preallocated space. So the incomplete
+    // blocks are written through the page cache, the next direct write of the
+    // same blocks writes back and invalidates the cached pages.
+    SetDirectIo(false);
+    WriteAt(fd_.GetNative(), buffer_.get(), buffer_size_, buffer_offset_);
+    SetDirectIo(true);
+
+    const auto written_blocks_size = AlignDown(buffer_size_);
+    if (written_blocks_size != 0) {
+      std::memmove(buffer_.get(), buffer_.get() + written_blocks_size,
+                   buffer_size_ - written_blocks_size);
+      buffer_offset_ += written_blocks_size;
+      buffer_size_ -= written_blocks_size;
+    }
+  }
+
+#ifdef __linux__
+  // Starts the writeback without waiting for it, errors are not fatal
+  ::sync_file_range(fd_.GetNative(), 0, 0, SYNC_FILE_RANGE_WRITE);
+#endif
+}
+
+void BlockFileSink::Write(std::string_view log) {
+  while (!log.empty()) {
+    const auto chunk_size = std::min(log.size(), kBufferSize - buffer_size_);
+    std::memcpy(buffer_.get() + buffer_size_, log.data(), chunk_size);
+    buffer_size_ += chunk_size;
+    log.remove_prefix(chunk_size);
+
+    if (buffer_size_ == kBufferSize) {
+      WriteBuffer(kBufferSize);
+      buffer_offset_ += kBufferSize;
+      buffer_size_ = 0;
+    }
+  }
+}
+
+void BlockFileSink::ReadTail() {
+  const auto size = fd_.GetSize();
+  buffer_offset_ = AlignDown(size);
+  buffer_size_ = 0;
+  preallocated_end_ = size;
+
+  if (buffer_offset_ != size) {
+    // The incomplete last block is rewritten together with the new logs
+    const auto read =
+        ReadAt(fd_.GetNative(), buffer_.get(), kBlockSize, buffer_offset_);
+    buffer_size_ = std::min(read, size - buffer_offset_);
+  }
+}
+
+void BlockFileSink::WriteBuffer(std::size_t size) {
+  UASSERT(size % kBlockSize == 0);
+  Preallocate(buffer_offset_ + size);
+  WriteAt(fd_.GetNative(), buffer_.get(), size, buffer_offset_);
+}
+
+void BlockFileSink::SetDirectIo(bool enable) {
+#ifdef O_DIRECT
+  if (!is_direct_io_) return;
+
+  const auto flags =
+      utils::CheckSyscall(::fcntl(fd_.GetNative(), F_GETFL), "calling ::fcntl");
+  utils::CheckSyscall(
+      ::fcntl(fd_.GetNative(), F_SETFL,
+              enable ? (flags | O_DIRECT) : (flags & ~O_DIRECT)),
+      "calling ::fcntl");
+#else
+  (void)enable;
+#endif
+}
+
+void BlockFileSink::Preallocate(std::size_t end) {
+#ifdef __linux__
+  if (!is_preallocation_supported_ || end <= preallocated_end_) return;
+
+  const auto new_end = AlignUp(end) + kPreallocationSize;
+  if (::fallocate(fd_.GetNative(), FALLOC_FL_KEEP_SIZE, preallocated_end_,
+                  new_end - preallocated_end_) == 0) {
+    preallocated_end_ = new_end;
+  } else if (errno == EOPNOTSUPP || errno == ENOSYS) {
+    is_preallocation_supported_ = false;
+  }
+  // Other errors, e.g. ENOSPC, are reported by the writes
+#else
+  (void)end;
+#endif
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+
+#include "base_sink.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// A file sink that writes the logs in large blocks aligned to the page size,
+/// bypassing the page cache with O_DIRECT where the file system allows it.
+///
+/// The file is preallocated with fallocate ahead of the writes. Flush writes
+/// the last incomplete block through the page cache and starts the writeback
+/// without waiting for it.
+///
+/// Reopen opens the new file first, so the old one keeps being used if the
+/// new file cannot be opened.
+class BlockFileSink final : public BaseSink {
+ public:
+  explicit BlockFileSink(const std::string& filename);
+  ~BlockFileSink() override;
+
+  void Reopen(ReopenMode mode) override;
+
+  void Flush() override;
+
+  bool IsDirectIo() const noexcept { return is_direct_io_; }
+
+ protected:
+  void Write(std::string_view log) final;
+
+ private:
+  struct FreeDeleter {
+    void operator()(char* ptr) const noexcept { std::free(ptr); }
+  };
+
+  void ReadTail();
+  void WriteBuffer(std::size_t size);
+  void SetDirectIo(bool enable);
+  void Preallocate(std::size_t end);
+
+  std::string filename_;
+  std::unique_ptr<char, FreeDeleter> buffer_;
+  // Initialized before 'fd_'
+  bool is_direct_io_{false};
+  fs::blocking::FileDescriptor fd_;
+  bool is_preallocation_supported_{true};
+
+  // The offset of the beginning of the buffer in the file, always aligned
+  std::size_t buffer_offset_{0};
+  std::size_t buffer_size_{0};
+  std::size_t preallocated_end_{0};
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
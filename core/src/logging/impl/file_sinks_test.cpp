@@ -1,6 +1,10 @@
 #include "file_sink.hpp"
 
 #include <functional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
@@ -8,6 +12,7 @@
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include "block_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "sink_helper_test.hpp"
 
@@ -30,6 +35,10 @@ SinkPtr MakeBufferedFileSink(const std::string& filename) {
   return std::make_unique<logging::impl::BufferedFileSink>(filename);
 }
 
+SinkPtr MakeBlockFileSink(const std::string& filename) {
+  return std::make_unique<logging::impl::BlockFileSink>(filename);
+}
+
 class FileSinks : public testing::TestWithParam<SinkFactory> {
  protected:
   const std::string& GetTempRootPath() const { return temp_root_.GetPath(); }
@@ -188,10 +197,27 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
             test::Messages("message", "message 2", "message 3"));
 }
 
-INSTANTIATE_UTEST_SUITE_P(/* no prefix */, FileSinks,
-                          testing::Values(SinkFactory{"FileSink", MakeFileSink},
-                                          SinkFactory{"BufferedFileSink",
-                                                      MakeBufferedFileSink}),
-                          utest::PrintTestName());
+UTEST_P(FileSinks, TestWriteManyBlocks) {
+  // Crosses the boundaries of the blocks and of the buffers of the sinks
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100000; ++i) {
+    expected.push_back(fmt::format("message {}", i));
+    EXPECT_NO_THROW(
+        Sink().Log({expected.back() + "\n", logging::Level::kInfo}));
+    if (i % 9973 == 0) {
+      EXPECT_NO_THROW(Sink().Flush());
+    }
+  }
+  EXPECT_NO_THROW(Sink().Flush());
+
+  EXPECT_EQ(test::ReadFromFile(Filename()), expected);
+}
+
+INSTANTIATE_UTEST_SUITE_P(
+    /* no prefix */, FileSinks,
+    testing::Values(SinkFactory{"FileSink", MakeFileSink},
+                    SinkFactory{"BufferedFileSink", MakeBufferedFileSink},
+                    SinkFactory{"BlockFileSink", MakeBlockFileSink}),
+    utest::PrintTestName());
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <gmock/gmock.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/logging/impl/binary_format.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Record = logging::impl::binary::Record;
+
+std::vector<Record> ParseRecords(std::string_view data) {
+  std::vector<Record> records;
+  while (!data.empty()) {
+    logging::impl::binary::ParseRecord(data, records.emplace_back());
+  }
+  return records;
+}
+
+std::string_view GetTag(const Record& record, std::string_view key) {
+  for (const auto& [tag_key, value] : record.tags) {
+    if (tag_key == key) return value;
+  }
+  ADD_FAILURE() << "No tag '" << key << "'";
+  return {};
+}
+
+}  // namespace
+
+TEST_F(LoggingBinaryTest, Basic) {
+  const auto before = std::chrono::system_clock::now();
+  LOG_INFO() << "Some text\twith\nspecial=characters\\";
+  LOG_WARNING() << "Another text";
+  logging::LogFlush();
+
+  const auto logs = GetStreamString();
+  const auto records = ParseRecords(logs);
+  ASSERT_EQ(records.size(), 2);
+
+  EXPECT_EQ(records[0].level, logging::Level::kInfo);
+  EXPECT_GE(records[0].timestamp,
+            std::chrono::time_point_cast<std::chrono::microseconds>(before));
+  EXPECT_EQ(GetTag(records[0], "text"),
+            "Some text\twith\nspecial=characters\\");
+  EXPECT_THAT(GetTag(records[0], "module"), testing::HasSubstr("TestBody"));
+  GetTag(records[0], "thread_id");
+
+  EXPECT_EQ(records[1].level, logging::Level::kWarning);
+  EXPECT_EQ(GetTag(records[1], "text"), "Another text");
+}
+
+TEST_F(LoggingBinaryTest, Tags) {
+  const std::string long_value(100'000, 'x');
+  LOG_INFO() << "text" << logging::LogExtra{{"custom.key", "value\t1"},
+                                            {"int", 42},
+                                            {"long", long_value}};
+  logging::LogFlush();
+
+  const auto logs = GetStreamString();
+  const auto records = ParseRecords(logs);
+  ASSERT_EQ(records.size(), 1);
+
+  EXPECT_EQ(GetTag(records[0], "text"), "text");
+  EXPECT_EQ(GetTag(records[0], "custom.key"), "value\t1");
+  EXPECT_EQ(GetTag(records[0], "int"), "42");
+  EXPECT_EQ(GetTag(records[0], "long"), long_value);
+}
+
+TEST_F(LoggingBinaryTest, Malformed) {
+  LOG_INFO() << "text";
+  logging::LogFlush();
+
+  const auto logs = GetStreamString();
+  std::string_view truncated = logs;
+  truncated.remove_suffix(1);
+  Record record;
+  EXPECT_THROW(logging::impl::binary::ParseRecord(truncated, record),
+               std::runtime_error);
+
+  std::string_view garbage = "tskv\ttext=1\n";
+  EXPECT_THROW(logging::impl::binary::GetRecordSize(garbage),
+               std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#include "log_limits_config.hpp"
+
+#include <cstdint>
+#include <optional>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+bool operator==(const LogRateLimitConfig& a, const LogRateLimitConfig& b) {
+  return a.location == b.location && a.max_logs == b.max_logs &&
+         a.interval == b.interval;
+}
+
+LogRateLimitConfig Parse(const formats::json::Value& value,
+                         formats::parse::To<LogRateLimitConfig>) {
+  return LogRateLimitConfig{
+      value["location"].As<std::string>(),
+      value["max-logs"].As<std::size_t>(),
+      std::chrono::milliseconds{value["interval-ms"].As<std::uint32_t>()}};
+}
+
+LogLimitsConfig Parse(const formats::json::Value& value,
+                      formats::parse::To<LogLimitsConfig>) {
+  LogLimitsConfig result;
+  result.rate_limits =
+      value["rate-limits"].As<std::vector<LogRateLimitConfig>>();
+
+  const auto level =
+      value["not-sampled-log-level"].As<std::optional<std::string>>();
+  if (level) result.not_sampled_log_level = LevelFromString(*level);
+  return result;
+}
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace logging {
+
+struct LogRateLimitConfig {
+  std::string location;
+  std::size_t max_logs{0};
+  std::chrono::milliseconds interval{0};
+};
+
+bool operator==(const LogRateLimitConfig& a, const LogRateLimitConfig& b);
+
+LogRateLimitConfig Parse(const formats::json::Value&,
+                         formats::parse::To<LogRateLimitConfig>);
+
+struct LogLimitsConfig {
+  std::vector<LogRateLimitConfig> rate_limits;
+  Level not_sampled_log_level{Level::kTrace};
+};
+
+LogLimitsConfig Parse(const formats::json::Value&,
+                      formats::parse::To<LogLimitsConfig>);
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,19 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include <fmt/format.h>
 
+#include <compiler/tls.hpp>
 #include <engine/task/task_context.hpp>
+#include <logging/rate_limit.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/algo.hpp>
 #include <userver/utils/enumerate.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
@@ -14,12 +21,55 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace async {
+
+struct ThreadBuffer final {
+  std::mutex mutex;
+  std::vector<Log> logs;
+};
+
+}  // namespace async
+
+namespace {
+
+// The buffered records are pushed into the queue as soon as the buffer of
+// some thread reaches this size.
+constexpr std::size_t kBlockSize = 64;
+
+// Partially filled thread buffers are pushed into the queue at least this
+// often. It is the maximum delay of a record in async mode.
+constexpr std::chrono::milliseconds kFlushWindow{10};
+
+// There are usually just a few loggers in a service, and only some of them
+// are used by a particular thread.
+constexpr std::size_t kMaxCachedThreadBuffers = 8;
+
+std::atomic<std::uint64_t> next_logger_id{0};
+
+struct CachedThreadBuffer final {
+  std::uint64_t logger_id;
+  std::shared_ptr<async::ThreadBuffer> buffer;
+};
+
+thread_local std::vector<CachedThreadBuffer> cached_thread_buffers;
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
   TpLogger& logger;
 
   void operator()(impl::async::Log&& log) const {
-    logger.AccountLogConsumed();
-    logger.BackendLog(std::move(log));
+    logger.pending_logs_.push_back(std::move(log));
+  }
+
+  void operator()(impl::async::LogBlock&& block) const {
+    auto& pending = logger.pending_logs_;
+    if (pending.empty()) {
+      pending = std::move(block.logs);
+    } else {
+      std::move(block.logs.begin(), block.logs.end(),
+                std::back_inserter(pending));
+    }
   }
 
   void operator()(impl::async::Stop&&) const noexcept {
@@ -27,6 +77,7 @@ struct TpLogger::ActionVisitor final {
   }
 
   void operator()(impl::async::ReopenCoro&& reopen) const noexcept {
+    logger.WriteBufferedLogs();
     try {
       logger.BackendReopen(reopen.reopen_mode);
       reopen.promise.set_value();
@@ -39,13 +90,16 @@ struct TpLogger::ActionVisitor final {
 
   template <class Flush>
   void operator()(Flush&& flush) const {
+    logger.WriteBufferedLogs();
     logger.BackendFlush();
     flush.promise.set_value();
   }
 };
 
 TpLogger::TpLogger(Format format, std::string logger_name)
-    : LoggerBase(format), logger_name_(std::move(logger_name)) {
+    : LoggerBase(format),
+      id_(next_logger_id++),
+      logger_name_(std::move(logger_name)) {
   SetLevel(logging::Level::kInfo);
 }
 
@@ -76,13 +130,16 @@ void TpLogger::StartConsumerTask(engine::TaskProcessor& task_processor,
   consuming_task_ = engine::CriticalAsyncNoSpan(
       task_processor,
       [this, guard = std::move(exit_async_guard)] { ProcessingLoop(); });
+
+  buffers_flushing_task_ = engine::CriticalAsyncNoSpan(
+      task_processor, [this] { FlushBuffersLoop(); });
 }
 
 TpLogger::~TpLogger() {
   UASSERT_MSG(
       state_ == State::kSync,
       "We may be in non coroutine context, async logger must be in sync mode");
-  UASSERT_MSG(!consuming_task_.IsValid(),
+  UASSERT_MSG(!consuming_task_.IsValid() && !buffers_flushing_task_.IsValid(),
               "We may be in non coroutine context, async logger must be in "
               "sync mode and consuming task must be stopped");
 }
@@ -93,6 +150,9 @@ void TpLogger::StopConsumerTask() {
     return;
   }
 
+  buffers_flushing_task_.SyncCancel();
+  buffers_flushing_task_ = {};
+
   DoPush(stop_node_);
 
   const engine::TaskCancellationBlocker block_cancel;
@@ -134,6 +194,10 @@ void TpLogger::Log(Level level, std::string_view msg) {
 
   impl::async::Log action{level, std::string{msg}};
 
+  if (state_.load() == State::kAsync && TryPushToThreadBuffer(action)) {
+    return;
+  }
+
   if (TryWaitFreeQueueCapacity()) {
     // The queue might have concurrently become full, in which case the size
     // will temporarily go over the max size. The actual number of log actions
@@ -164,6 +228,9 @@ bool TpLogger::DoShouldLog(Level level) const noexcept {
     if (local_log_level && *local_log_level > level) {
       return false;
     }
+    if (level < GetNotSampledLogLevel() && !span->IsSampled()) {
+      return false;
+    }
   }
 
   return true;
@@ -200,6 +267,7 @@ void TpLogger::ProcessingLoop() {
 
   while (true) {
     ConsumeQueueOnce(queue_consumer_);
+    WritePendingLogs();
     if (state_ != State::kAsync) {
       UASSERT(state_ == State::kStoppingAsync);
       break;
@@ -207,6 +275,8 @@ void TpLogger::ProcessingLoop() {
     queue_.WaitWhileEmpty(queue_consumer_);
   }
 
+  // No records are added to the thread buffers after the state has changed.
+  WriteBufferedLogs();
   CleanUpQueue(std::move(queue_consumer_));
 }
 
@@ -219,8 +289,9 @@ void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
   }
 }
 
-bool TpLogger::HasFreeQueueCapacity() noexcept {
-  return produced_->load() - consumed_->load() < max_queue_size_.load();
+bool TpLogger::HasFreeQueueCapacity(QueueSize buffered) noexcept {
+  return produced_->load() + buffered - consumed_->load() <
+         max_queue_size_.load();
 }
 
 bool TpLogger::TryWaitFreeQueueCapacity() {
@@ -248,6 +319,120 @@ void TpLogger::Push(impl::async::Action&& action) {
   DoPush(*node.release());
 }
 
+bool TpLogger::TryPushToThreadBuffer(impl::async::Log& action) {
+  auto& buffer = GetThreadBuffer();
+  std::unique_lock lock{buffer.mutex};
+  // Checked under the lock, so that the final WriteBufferedLogs of the
+  // consumer does not miss the record.
+  if (state_.load() != State::kAsync) return false;
+
+  // Only the records of the current thread are taken into account, so the
+  // queue may temporarily go over the max size by up to
+  // n_threads * kBlockSize records.
+  const auto buffered = static_cast<QueueSize>(buffer.logs.size());
+  if (!HasFreeQueueCapacity(buffered)) {
+    lock.unlock();
+    // The caller applies the overflow policy, the buffered records should
+    // be visible to the consumer by then.
+    if (buffered != 0) PushBufferedLogs();
+    return false;
+  }
+
+  const bool should_flush = ShouldFlush(action.level);
+  buffer.logs.push_back(std::move(action));
+  if (buffer.logs.size() < kBlockSize && !should_flush) return true;
+
+  lock.unlock();
+  PushBufferedLogs();
+  return true;
+}
+
+USERVER_PREVENT_TLS_CACHING impl::async::ThreadBuffer&
+TpLogger::GetThreadBuffer() {
+  auto& cache = cached_thread_buffers;
+  for (const auto& cached : cache) {
+    if (cached.logger_id == id_) return *cached.buffer;
+  }
+
+  auto buffer = std::make_shared<impl::async::ThreadBuffer>();
+  buffer->logs.reserve(kBlockSize);
+  {
+    const std::lock_guard lock{thread_buffers_mutex_};
+    thread_buffers_.push_back(buffer);
+  }
+  // The evicted buffer is written and released by TakeBufferedLogs.
+  if (cache.size() == kMaxCachedThreadBuffers) cache.erase(cache.begin());
+  cache.push_back({id_, buffer});
+  return *buffer;
+}
+
+void TpLogger::PushBufferedLogs() {
+  // The buffers of all the threads are taken at once, so that the records of
+  // a task that has migrated between threads are written in order.
+  std::vector<impl::async::Log> logs;
+  logs.reserve(kBlockSize);
+  TakeBufferedLogs(logs);
+  if (logs.empty()) return;
+
+  produced_->fetch_add(static_cast<QueueSize>(logs.size()));
+  Push(impl::async::LogBlock{std::move(logs)});
+}
+
+void TpLogger::TakeBufferedLogs(std::vector<impl::async::Log>& logs) {
+  const std::lock_guard lock{thread_buffers_mutex_};
+  for (const auto& buffer : thread_buffers_) {
+    const std::lock_guard buffer_lock{buffer->mutex};
+    std::move(buffer->logs.begin(), buffer->logs.end(),
+              std::back_inserter(logs));
+    buffer->logs.clear();
+  }
+  // Nobody else owns the buffers of the exited threads
+  utils::EraseIf(thread_buffers_,
+                 [](const auto& buffer) { return buffer.use_count() == 1; });
+}
+
+void TpLogger::WriteBufferedLogs() noexcept {
+  try {
+    const auto pending_count = pending_logs_.size();
+    TakeBufferedLogs(pending_logs_);
+    produced_->fetch_add(
+        static_cast<QueueSize>(pending_logs_.size() - pending_count));
+  } catch (const std::exception& e) {
+    UASSERT_MSG(false,
+                fmt::format("Exception while taking the buffered logs: {}",
+                            e.what()));
+  }
+  WritePendingLogs();
+}
+
+void TpLogger::WritePendingLogs() noexcept {
+  if (pending_logs_.empty()) return;
+
+  // The blocks from different threads overlap in time
+  std::stable_sort(
+      pending_logs_.begin(), pending_logs_.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.time < rhs.time; });
+
+  AccountLogsConsumed(static_cast<QueueSize>(pending_logs_.size()));
+  for (auto& log : pending_logs_) {
+    try {
+      BackendLog(std::move(log));
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false,
+                  fmt::format("Exception while doing an async logging: {}",
+                              e.what()));
+    }
+  }
+  pending_logs_.clear();
+}
+
+void TpLogger::FlushBuffersLoop() {
+  while (!engine::current_task::ShouldCancel()) {
+    engine::InterruptibleSleepFor(kFlushWindow);
+    PushBufferedLogs();
+  }
+}
+
 void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   auto consumer = queue_.PushAndTryStartConsuming(node);
   if (consumer.IsValid()) {
@@ -255,8 +440,8 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-  consumed_->store(consumed_->load(std::memory_order_relaxed) + 1,
+void TpLogger::AccountLogsConsumed(QueueSize count) noexcept {
+  consumed_->store(consumed_->load(std::memory_order_relaxed) + count,
                    std::memory_order_relaxed);
   if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
     {
@@ -267,7 +452,7 @@ void TpLogger::AccountLogConsumed() noexcept {
       //    not fall asleep
       const std::lock_guard lock{capacity_waiters_mutex_};
     }
-    capacity_waiters_cv_.NotifyOne();
+    capacity_waiters_cv_.NotifyAll();
   }
 }
 
@@ -289,7 +474,10 @@ void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
 
 void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
   std::move(consumer).ConsumeAndStop(
-      [this](auto& node) noexcept { ConsumeNode(node); });
+      [this](auto& node) noexcept {
+        ConsumeNode(node);
+        WritePendingLogs();
+      });
 }
 
 void TpLogger::BackendLog(impl::async::Log&& action) const {
@@ -4,6 +4,7 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -38,6 +39,11 @@ struct Log {
   std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
 };
 
+// A batch of records taken from the thread buffers.
+struct LogBlock {
+  std::vector<Log> logs;
+};
+
 struct FlushCoro {
   engine::Promise<void> promise;
 };
@@ -53,15 +59,26 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+using Action =
+    std::variant<Stop, Log, LogBlock, FlushCoro, FlushThreaded, ReopenCoro>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
   Action action{Stop{}};
 };
 
+struct ThreadBuffer;
+
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
+///
+/// In async mode the records are accumulated in per-thread buffers and are
+/// pushed into the queue by blocks, so that the producers rarely touch the
+/// shared state. The buffers are pushed when one of them is full, at least
+/// once per flush window, on Flush, Reopen and StopConsumerTask, and right
+/// away for records that should be flushed (see LoggerBase::SetFlushOn). The
+/// records of a single batch of the consumer are written ordered by their
+/// timestamps.
 class TpLogger final : public LoggerBase {
  public:
   TpLogger(Format format, std::string logger_name);
@@ -101,19 +118,27 @@ class TpLogger final : public LoggerBase {
   using QueueSize = std::int64_t;
 
   void ProcessingLoop();
-  bool HasFreeQueueCapacity() noexcept;
+  bool HasFreeQueueCapacity(QueueSize buffered = 0) noexcept;
   bool TryWaitFreeQueueCapacity();
   void Push(impl::async::Action&& action);
+  bool TryPushToThreadBuffer(impl::async::Log& action);
+  impl::async::ThreadBuffer& GetThreadBuffer();
+  void PushBufferedLogs();
+  void TakeBufferedLogs(std::vector<impl::async::Log>& logs);
+  void WriteBufferedLogs() noexcept;
+  void WritePendingLogs() noexcept;
+  void FlushBuffersLoop();
   void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
   void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-  void AccountLogConsumed() noexcept;
+  void AccountLogsConsumed(QueueSize count) noexcept;
   void BackendPerform(impl::async::Action&& action) noexcept;
   void BackendLog(impl::async::Log&& action) const;
   void BackendFlush() const;
   void BackendReopen(ReopenMode reopen_mode) const;
 
+  const std::uint64_t id_;
   const std::string logger_name_;
   std::vector<impl::SinkPtr> sinks_;
   mutable statistics::LogStatistics stats_{};
@@ -121,6 +146,7 @@ class TpLogger final : public LoggerBase {
   engine::Mutex capacity_waiters_mutex_;
   engine::ConditionVariable capacity_waiters_cv_;
   engine::Task consuming_task_;
+  engine::Task buffers_flushing_task_;
   std::atomic<QueueSize> max_queue_size_{std::numeric_limits<QueueSize>::max()};
   std::atomic<QueueOverflowBehavior> overflow_policy_{
       QueueOverflowBehavior::kDiscard};
@@ -129,6 +155,11 @@ class TpLogger final : public LoggerBase {
   Queue::Consumer queue_consumer_;
   // A dummy action used for notifying the async task during stopping.
   impl::async::ActionNode stop_node_;
+  // Records taken from the queue, only accessed by the current consumer.
+  std::vector<impl::async::Log> pending_logs_;
+
+  std::mutex thread_buffers_mutex_;
+  std::vector<std::shared_ptr<impl::async::ThreadBuffer>> thread_buffers_;
 
   Queue queue_;
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
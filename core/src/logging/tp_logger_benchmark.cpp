@@ -1,8 +1,11 @@
 #include <logging/tp_logger.hpp>
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <logging/impl/null_sink.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -65,6 +68,32 @@ BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringMT)(benchmark::State& state) {
+  constexpr std::size_t kLogsPerTask = 1000;
+  const auto task_count = static_cast<std::size_t>(state.range(0));
+
+  engine::RunStandalone(task_count + 1, [&] {
+    auto scope = StartAsyncLoggerScope();
+    const auto msg = Launder(std::string(64, '*'));
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(task_count);
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < task_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&msg] {
+          for (std::size_t j = 0; j < kLogsPerTask; ++j) {
+            LOG_INFO() << msg;
+          }
+        }));
+      }
+      for (auto& task : tasks) task.Get();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * task_count * kLogsPerTask);
+  });
+}
+// Contention of the producers that log from several threads at once
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringMT)->Arg(1)->Arg(2)->Arg(4);
+
 namespace {
 
 __attribute__((noinline)) void LogDebug() { LOG_DEBUG() << 42; }
@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -600,6 +601,43 @@ UTEST_F(LoggingTestCoro, TpLoggerFlushMultiple) {
   EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
 }
 
+UTEST_F(LoggingTestCoro, TpLoggerWritesBufferedWithoutFlush) {
+  auto logger = StartAsyncLogger();
+
+  LOG_INFO_TO(logger) << "Some log";
+  // The record is pushed from the thread buffer within the flush window
+  while (GetRecordsCount() == 0) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("text=Some log"));
+
+  logger->StopConsumerTask();
+  EXPECT_EQ(GetRecordsCount(), 1);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerKeepsTaskOrderMT, 4) {
+  auto logger = StartAsyncLogger(kLoggingTestIterations);
+
+  // The task migrates between the threads, and so between the thread buffers
+  engine::AsyncNoSpan([&logger] {
+    for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+      LOG_INFO_TO(logger) << i;
+      engine::Yield();
+    }
+  }).Get();
+  logger->StopConsumerTask();
+
+  const auto logs = GetStreamString();
+  std::size_t prev_pos = 0;
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    const auto pos = logs.find(fmt::format("text={}\t", i));
+    ASSERT_NE(pos, std::string::npos) << i;
+    EXPECT_GE(pos, prev_pos) << i;
+    prev_pos = pos;
+  }
+  EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
+}
+
 UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleMT, 4) {
   const std::size_t message_count =
       kLoggingTestIterations * (GetThreadCount() - 1);
@@ -11,6 +11,13 @@ uint64_t GetNextEpoch() noexcept {
   return counter++;
 }
 
+std::size_t GetEpochShardIndex() noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  thread_local const std::size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed) % kEpochShardsCount;
+  return index;
+}
+
 }  // namespace rcu::impl
 
 USERVER_NAMESPACE_END
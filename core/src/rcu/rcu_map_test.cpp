@@ -25,6 +25,14 @@ struct RcuTraitsStdMutex : rcu::DefaultRcuMapTraits<Key, Value> {
 using StdMutexRcuMap =
     rcu::RcuMap<std::string, int, RcuTraitsStdMutex<std::string, int>>;
 
+template <typename Key, typename Value>
+struct RcuTraitsEpochs : rcu::DefaultRcuMapTraits<Key, Value> {
+  static constexpr auto kReclamation = rcu::ReclamationType::kEpochs;
+};
+
+using EpochsRcuMap =
+    rcu::RcuMap<std::string, int, RcuTraitsEpochs<std::string, int>>;
+
 }  // namespace
 
 TEST(RcuMap, StdMutexBase) {
@@ -122,6 +130,22 @@ UTEST(RcuMap, Modify) {
   EXPECT_EQ(*map.Pop("any"), 5);
 }
 
+UTEST(RcuMap, Epochs) {
+  EpochsRcuMap map;
+
+  *map["a"] = 1;
+  {
+    const auto snapshot = map.GetSnapshot();
+    EXPECT_TRUE(map.Erase("a"));
+    EXPECT_EQ(*snapshot.at("a"), 1);
+    EXPECT_TRUE(map.GetSnapshot().empty());
+  }
+
+  map.InsertOrAssign("b", std::make_shared<int>(2));
+  EXPECT_EQ(*map["b"], 2);
+  EXPECT_EQ(map.SizeApprox(), 1);
+}
+
 UTEST(RcuMap, InsertOrAssign) {
   rcu::RcuMap<std::string, int> map;
 
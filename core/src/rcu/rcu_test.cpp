@@ -577,6 +577,121 @@ UTEST_MT(Rcu, Core, 3) {
   }
 }
 
+namespace {
+
+/// [Sample rcu::Variable epochs]
+template <typename T>
+struct EpochRcuTraits final {
+  using MutexType = engine::Mutex;
+  static constexpr auto kReclamation = rcu::ReclamationType::kEpochs;
+};
+
+template <typename T>
+using EpochVariable = rcu::Variable<T, EpochRcuTraits<T>>;
+/// [Sample rcu::Variable epochs]
+
+template <typename T>
+using EpochReadablePtr = rcu::ReadablePtr<T, EpochRcuTraits<T>>;
+
+}  // namespace
+
+UTEST(Rcu, EpochsLifetime) {
+  using Counted = Counted<struct EpochsLifetimeTag>;
+
+  EpochVariable<Counted> var{rcu::DestructionType::kSync};
+  EXPECT_EQ(1, Counted::counter);
+
+  {
+    const auto reader = var.Read();
+    auto writer = var.StartWrite();
+    writer->value = 2;
+    writer.Commit();
+
+    EXPECT_EQ(2, Counted::counter);
+    EXPECT_EQ(1, reader->value);
+  }
+  // The retired values are freed on the next write or Cleanup
+  EXPECT_EQ(2, Counted::counter);
+  var.Cleanup();
+  EXPECT_EQ(1, Counted::counter);
+
+  {
+    auto writer = var.StartWrite();
+    writer->value = 3;
+    writer.Commit();
+  }
+  // Nobody reads the old value, it is freed immediately
+  EXPECT_EQ(1, Counted::counter);
+  EXPECT_EQ(3, var.ReadCopy().value);
+}
+
+UTEST(Rcu, EpochsReadablePtrCopyAndMove) {
+  EpochVariable<int> var1{1};
+  EpochVariable<int> var2{2};
+
+  auto reader1 = var1.Read();
+  auto copy = reader1;
+  var1.Assign(10);
+  EXPECT_EQ(*reader1, 1);
+  EXPECT_EQ(*copy, 1);
+
+  copy = var2.Read();
+  EXPECT_EQ(*copy, 2);
+  reader1 = std::move(copy);
+  EXPECT_EQ(*reader1, 2);
+
+  var1.Cleanup();
+  EXPECT_EQ(var1.ReadCopy(), 10);
+
+  const auto reader2 = var1.Read();
+  var1.Assign(20);
+  EXPECT_EQ(*reader2, 10);
+}
+
+UTEST_MT(Rcu, EpochsTortureTest, kTotalTasks) {
+  EpochVariable<CleaningUpInt> data{1};
+  std::atomic<bool> keep_running{true};
+
+  engine::Mutex ping_pong_mutex;
+  EpochReadablePtr<CleaningUpInt> ptr = data.Read();
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+
+  for (std::size_t i = 0; i < kReadablePtrPingPongTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        std::lock_guard lock(ping_pong_mutex);
+        // copy a ptr created by another thread
+        ptr = EpochReadablePtr<CleaningUpInt>{ptr};
+        ASSERT_GT(ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kReadingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto local_ptr = data.Read();
+        // the reader may continue on another thread
+        engine::Yield();
+        ASSERT_GT(local_ptr->value, 0);
+      }
+    }));
+  }
+
+  for (std::size_t i = 0; i < kWritingTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto old = data.Read();
+        data.Assign(CleaningUpInt{old->value + 1});
+      }
+    }));
+  }
+
+  engine::SleepFor(std::chrono::milliseconds{100});
+  keep_running = false;
+}
+
 TEST(Rcu, StdMutexInit) {
   rcu::Variable<X, StdMutexRcuTraits> ptr(1, 2);
   auto reader = ptr.Read();
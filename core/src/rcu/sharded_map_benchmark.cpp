@@ -0,0 +1,170 @@
+#include <userver/rcu/sharded_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kKeysCount = 4096;
+
+using Value = std::uint64_t;
+
+class ShardedMapAdapter final {
+ public:
+  std::shared_ptr<const Value> Get(std::uint64_t key) const {
+    return map_.Get(key);
+  }
+
+  void Assign(std::uint64_t key, Value value) {
+    map_.InsertOrAssign(key, std::make_shared<Value>(value));
+  }
+
+ private:
+  rcu::ShardedMap<std::uint64_t, Value> map_;
+};
+
+class RcuMapAdapter final {
+ public:
+  std::shared_ptr<const Value> Get(std::uint64_t key) const {
+    return map_.Get(key);
+  }
+
+  void Assign(std::uint64_t key, Value value) {
+    map_.InsertOrAssign(key, std::make_shared<Value>(value));
+  }
+
+ private:
+  rcu::RcuMap<std::uint64_t, Value> map_;
+};
+
+class LockedMapAdapter final {
+ public:
+  std::shared_ptr<const Value> Get(std::uint64_t key) const {
+    const auto map = map_.SharedLock();
+    const auto it = map->find(key);
+    return it == map->end() ? nullptr : it->second;
+  }
+
+  void Assign(std::uint64_t key, Value value) {
+    auto new_value = std::make_shared<Value>(value);
+    auto map = map_.Lock();
+    (*map)[key] = std::move(new_value);
+  }
+
+ private:
+  concurrent::Variable<
+      std::unordered_map<std::uint64_t, std::shared_ptr<Value>>,
+      engine::SharedMutex>
+      map_;
+};
+
+}  // namespace
+
+template <typename Map>
+void sharded_map_read(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    Map map;
+    for (std::uint64_t i = 0; i < kKeysCount; ++i) map.Assign(i, i);
+
+    std::uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(map.Get(i++ % kKeysCount));
+    }
+  });
+}
+BENCHMARK_TEMPLATE(sharded_map_read, ShardedMapAdapter);
+BENCHMARK_TEMPLATE(sharded_map_read, RcuMapAdapter);
+BENCHMARK_TEMPLATE(sharded_map_read, LockedMapAdapter);
+
+template <typename Map>
+void sharded_map_write(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    Map map;
+    for (std::uint64_t i = 0; i < kKeysCount; ++i) map.Assign(i, i);
+
+    std::uint64_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      map.Assign(i % kKeysCount, i);
+      ++i;
+    }
+  });
+}
+BENCHMARK_TEMPLATE(sharded_map_write, ShardedMapAdapter);
+BENCHMARK_TEMPLATE(sharded_map_write, RcuMapAdapter);
+BENCHMARK_TEMPLATE(sharded_map_write, LockedMapAdapter);
+
+// Measures the reads of the main task while the other tasks read and write
+template <typename Map>
+void sharded_map_mixed(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+  const std::size_t writers_count = state.range(1);
+  const std::size_t thread_count =
+      std::min(readers_count + writers_count, std::size_t{6});
+
+  engine::RunStandalone(thread_count, [&] {
+    Map map;
+    for (std::uint64_t i = 0; i < kKeysCount; ++i) map.Assign(i, i);
+    std::atomic<bool> run{true};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count - 1 + writers_count);
+
+    for (std::size_t i = 0; i < readers_count - 1; ++i) {
+      tasks.push_back(utils::Async("reader", [&] {
+        std::uint64_t key = 0;
+        while (run) {
+          for (int j = 0; j < 100; ++j) {
+            benchmark::DoNotOptimize(map.Get(key++ % kKeysCount));
+          }
+          engine::Yield();
+        }
+      }));
+    }
+
+    for (std::size_t i = 0; i < writers_count; ++i) {
+      tasks.push_back(utils::Async("writer", [&, i] {
+        std::uint64_t key = i;
+        while (run) {
+          map.Assign(key % kKeysCount, key);
+          key += 7;
+          engine::Yield();
+        }
+      }));
+    }
+
+    std::uint64_t key = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(map.Get(key++ % kKeysCount));
+    }
+
+    run = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+BENCHMARK_TEMPLATE(sharded_map_mixed, ShardedMapAdapter)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {0, 2}});
+BENCHMARK_TEMPLATE(sharded_map_mixed, RcuMapAdapter)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {0, 2}});
+BENCHMARK_TEMPLATE(sharded_map_mixed, LockedMapAdapter)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 4}, {0, 2}});
+
+USERVER_NAMESPACE_END
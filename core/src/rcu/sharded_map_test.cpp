@@ -0,0 +1,252 @@
+#include <userver/rcu/sharded_map.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename Key, typename Value>
+struct StdMutexTraits : rcu::DefaultShardedMapTraits<Key, Value> {
+  using MutexType = std::mutex;
+};
+
+// A single shard makes the rehashing and the collisions frequent
+template <typename Key, typename Value>
+struct SingleShardTraits : rcu::DefaultShardedMapTraits<Key, Value> {
+  static constexpr std::size_t kShardsCount = 1;
+};
+
+struct Counted final {
+  explicit Counted(std::atomic<int>& alive) : alive(alive) { ++alive; }
+  ~Counted() { --alive; }
+
+  std::atomic<int>& alive;
+};
+
+}  // namespace
+
+/// [Sample rcu::ShardedMap usage]
+UTEST(ShardedMap, Sample) {
+  rcu::ShardedMap<std::string, int> map;
+
+  // Only the shard of the key is locked
+  map.InsertOrAssign("apples", std::make_shared<int>(3));
+  const auto [pears, inserted] = map.Emplace("pears", 5);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(*pears, 5);
+
+  // Never locks
+  const auto apples = map.Get("apples");
+  ASSERT_TRUE(apples);
+  EXPECT_EQ(*apples, 3);
+
+  EXPECT_TRUE(map.Erase("apples"));
+  EXPECT_FALSE(map.Get("apples"));
+  // The erased value stays alive while it is referenced
+  EXPECT_EQ(*apples, 3);
+}
+/// [Sample rcu::ShardedMap usage]
+
+TEST(ShardedMap, StdMutexBase) {
+  rcu::ShardedMap<std::string, int, StdMutexTraits<std::string, int>> map;
+  const auto& cmap = map;
+
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(cmap.Get("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_FALSE(map.Pop("any"));
+  EXPECT_EQ(map.SizeApprox(), 0);
+
+  map.InsertOrAssign("any", std::make_shared<int>(1));
+  EXPECT_EQ(*cmap.Get("any"), 1);
+}
+
+UTEST(ShardedMap, Insert) {
+  rcu::ShardedMap<int, std::string> map;
+
+  const auto first = map.Insert(1, std::make_shared<std::string>("a"));
+  EXPECT_TRUE(first.inserted);
+  EXPECT_EQ(*first.value, "a");
+
+  const auto second = map.Insert(1, std::make_shared<std::string>("b"));
+  EXPECT_FALSE(second.inserted);
+  EXPECT_EQ(second.value, first.value);
+
+  const auto emplaced = map.Emplace(1, "c");
+  EXPECT_FALSE(emplaced.inserted);
+  EXPECT_EQ(*emplaced.value, "a");
+  EXPECT_EQ(*map.Get(1), "a");
+  EXPECT_EQ(map.SizeApprox(), 1);
+}
+
+UTEST(ShardedMap, InsertOrAssign) {
+  rcu::ShardedMap<int, std::string> map;
+
+  map.InsertOrAssign(1, std::make_shared<std::string>("a"));
+  const auto old_value = map.Get(1);
+  map.InsertOrAssign(1, std::make_shared<std::string>("b"));
+
+  EXPECT_EQ(*old_value, "a");
+  EXPECT_EQ(*map.Get(1), "b");
+  EXPECT_EQ(map.SizeApprox(), 1);
+}
+
+UTEST(ShardedMap, Pop) {
+  rcu::ShardedMap<int, std::string> map;
+  map.Emplace(1, "a");
+  map.Emplace(2, "b");
+
+  const auto value = map.Pop(1);
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value, "a");
+  EXPECT_FALSE(map.Pop(1));
+  EXPECT_FALSE(map.Get(1));
+  EXPECT_EQ(*map.Get(2), "b");
+  EXPECT_EQ(map.SizeApprox(), 1);
+}
+
+UTEST(ShardedMap, Growth) {
+  rcu::ShardedMap<int, int, SingleShardTraits<int, int>> map;
+  constexpr int kCount = 10000;
+
+  for (int i = 0; i < kCount; ++i) {
+    ASSERT_TRUE(map.Emplace(i, i).inserted);
+  }
+  EXPECT_EQ(map.SizeApprox(), kCount);
+
+  for (int i = 0; i < kCount; ++i) {
+    const auto value = map.Get(i);
+    ASSERT_TRUE(value) << i;
+    EXPECT_EQ(*value, i);
+  }
+  EXPECT_FALSE(map.Get(kCount));
+
+  for (int i = 0; i < kCount; i += 2) {
+    ASSERT_TRUE(map.Erase(i));
+  }
+  EXPECT_EQ(map.SizeApprox(), kCount / 2);
+  for (int i = 0; i < kCount; ++i) {
+    EXPECT_EQ(map.Get(i) != nullptr, i % 2 == 1) << i;
+  }
+}
+
+UTEST(ShardedMap, SnapshotAndVisit) {
+  rcu::ShardedMap<int, int> map;
+  for (int i = 0; i < 100; ++i) map.Emplace(i, i * 10);
+
+  const auto snapshot = map.GetSnapshot();
+  ASSERT_EQ(snapshot.size(), 100);
+  for (const auto& [key, value] : snapshot) {
+    EXPECT_EQ(*value, key * 10);
+  }
+
+  int sum = 0;
+  map.VisitAll([&sum](int /*key*/, const std::shared_ptr<int>& value) {
+    sum += *value;
+  });
+  EXPECT_EQ(sum, 49500);
+}
+
+UTEST(ShardedMap, Clear) {
+  std::atomic<int> alive{0};
+  {
+    rcu::ShardedMap<int, Counted> map;
+    for (int i = 0; i < 100; ++i) map.Emplace(i, alive);
+    const auto kept = map.Get(42);
+
+    map.Clear();
+    EXPECT_EQ(map.SizeApprox(), 0);
+    EXPECT_FALSE(map.Get(42));
+    EXPECT_TRUE(map.GetSnapshot().empty());
+    EXPECT_TRUE(kept);
+
+    map.Emplace(1, alive);
+    EXPECT_TRUE(map.Get(1));
+  }
+  EXPECT_EQ(alive, 0);
+}
+
+UTEST(ShardedMap, NoLeaks) {
+  std::atomic<int> alive{0};
+  {
+    rcu::ShardedMap<int, Counted, SingleShardTraits<int, Counted>> map;
+    for (int i = 0; i < 1000; ++i) {
+      map.Emplace(i, alive);
+      map.InsertOrAssign(i / 2, std::make_shared<Counted>(alive));
+      if (i % 3 == 0) map.Erase(i / 3);
+    }
+    EXPECT_EQ(static_cast<std::size_t>(alive.load()), map.SizeApprox());
+  }
+  EXPECT_EQ(alive, 0);
+}
+
+UTEST_MT(ShardedMap, ConcurrentReadWrite, 4) {
+  // Few keys in a single shard make a reader meet the nodes being replaced
+  using Map = rcu::ShardedMap<int, int, SingleShardTraits<int, int>>;
+  constexpr int kKeys = 64;
+  constexpr int kIterations = 10000;
+
+  Map map;
+  std::atomic<bool> run{true};
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  for (int i = 0; i < 2; ++i) {
+    readers.push_back(utils::Async("reader", [&] {
+      while (run) {
+        for (int key = 0; key < kKeys; ++key) {
+          // Each stored value is a multiple of its key
+          const auto value = map.Get(key);
+          if (value && key != 0) {
+            ASSERT_EQ(*value % key, 0);
+          }
+        }
+        map.VisitAll([](int key, const std::shared_ptr<int>& value) {
+          if (key != 0) {
+            ASSERT_EQ(*value % key, 0);
+          }
+        });
+        engine::Yield();
+      }
+    }));
+  }
+
+  std::vector<engine::TaskWithResult<void>> writers;
+  for (int i = 0; i < 2; ++i) {
+    writers.push_back(utils::Async("writer", [&, i] {
+      for (int j = 0; j < kIterations; ++j) {
+        const int key = (i * 7 + j) % kKeys;
+        switch (j % 4) {
+          case 0:
+            map.Emplace(key, key * j);
+            break;
+          case 1:
+            map.InsertOrAssign(key, std::make_shared<int>(key * (j + 1)));
+            break;
+          case 2:
+            map.Erase(key);
+            break;
+          default:
+            if (j % 1000 == 3) map.Clear();
+        }
+      }
+    }));
+  }
+
+  for (auto& writer : writers) writer.Get();
+  run = false;
+  for (auto& reader : readers) reader.Get();
+
+  for (int key = 0; key < kKeys; ++key) map.InsertOrAssign(key, nullptr);
+  EXPECT_EQ(map.SizeApprox(), kKeys);
+}
+
+USERVER_NAMESPACE_END
@@ -124,6 +124,18 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    session-cache-size:
+                        type: integer
+                        description: max count of sessions in the server-side TLS session cache shared by the connections, 0 disables the cache
+                        defaultDescription: 20480
+                    session-timeout:
+                        type: string
+                        description: lifetime of the cached TLS sessions and of the session tickets
+                        defaultDescription: 300s
+                    session-tickets:
+                        type: boolean
+                        description: whether to issue TLS session tickets to resume the sessions without the server-side cache
+                        defaultDescription: true
             handler-defaults:
                 type: object
                 description: handler defaults options
@@ -174,9 +186,70 @@ properties:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    http_version:
+                        type: string
+                        description: "'2' to additionally serve HTTP/2 with prior knowledge or via TLS ALPN, '1.1' to serve HTTP/1.1 only"
+                        defaultDescription: '1.1'
+                        enum:
+                          - '1.1'
+                          - '2'
+                    http_parser:
+                        type: string
+                        description: "HTTP/1.x request parser, 'simd' for the one that searches for the delimiters with SIMD instructions"
+                        defaultDescription: http-parser
+                        enum:
+                          - http-parser
+                          - simd
+                    zero_copy_body:
+                        type: boolean
+                        description: keep the HTTP/1.x request bodies in the receive buffers instead of copying them, the buffer stays allocated until the requests that refer to it are destroyed
+                        defaultDescription: false
+                    receive_buffers_pool_size:
+                        type: integer
+                        description: count of free receive buffers kept for reuse by the listener, the connections give their buffers back while waiting for data; 0 makes each connection keep its buffer
+                        defaultDescription: 256
+                        minimum: 0
+                    memory_budget:
+                        type: integer
+                        description: max bytes of URLs, headers and bodies of the requests of a connection that are being parsed or processed, the request that exceeds it is answered with 413 and the connection is closed; 0 for unlimited
+                        defaultDescription: 0
+                        minimum: 0
+                    http2_session:
+                        type: object
+                        description: HTTP/2 session options
+                        additionalProperties: false
+                        properties:
+                            max_concurrent_streams:
+                                type: integer
+                                description: SETTINGS_MAX_CONCURRENT_STREAMS advertised to the peer
+                                defaultDescription: 100
+                                minimum: 1
+                            max_frame_size:
+                                type: integer
+                                description: SETTINGS_MAX_FRAME_SIZE advertised to the peer
+                                defaultDescription: 16384
+                                minimum: 16384
+                                maximum: 16777215
+                            initial_window_size:
+                                type: integer
+                                description: SETTINGS_INITIAL_WINDOW_SIZE advertised to the peer
+                                defaultDescription: 65535
+                                maximum: 2147483647
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            shared-nothing:
+                type: boolean
+                description: run each shard with its own socket on a dedicated single-threaded task processor pinned to an ev thread and handle the requests on it, ignoring the task_processor of the handlers
+                defaultDescription: false
+            pinned-acceptors:
+                type: boolean
+                description: run the accept loop of each shard on a dedicated single-threaded task processor pinned to its own ev thread, the connections are still handled by task_processor; implied by shared-nothing
+                defaultDescription: false
+            reuseport-cpu-steering:
+                type: boolean
+                description: attach a classic BPF program to the SO_REUSEPORT sockets of the shards, so that the kernel picks the socket by the CPU that received the connection; Linux only
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -186,6 +259,9 @@ properties:
         type: boolean
         description: set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header
         defaultDescription: false
+    handoff-socket:
+        type: string
+        description: unix socket to take the listening sockets from the running instance on start and to hand them off to the next one
 )");
 }
 
@@ -0,0 +1,129 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+// The limit is estimated once per window of samples
+constexpr std::size_t kWindowSamples = 10;
+// The long-term latency is averaged over about 600 samples
+constexpr double kLongLatencyWeight = 1.0 / 60;
+constexpr double kMinGradient = 0.5;
+
+}  // namespace
+
+AdaptiveConcurrencyLimiter::Token::Token(AdaptiveConcurrencyLimiter& limiter,
+                                         std::size_t in_flight)
+    : limiter_(&limiter),
+      start_(std::chrono::steady_clock::now()),
+      in_flight_(in_flight) {}
+
+AdaptiveConcurrencyLimiter::Token::Token(Token&& other) noexcept
+    : limiter_(std::exchange(other.limiter_, nullptr)),
+      start_(other.start_),
+      in_flight_(other.in_flight_) {}
+
+AdaptiveConcurrencyLimiter::Token::~Token() {
+  if (limiter_) limiter_->in_flight_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void AdaptiveConcurrencyLimiter::Token::Complete() {
+  UASSERT(limiter_);
+  limiter_->AddSample(std::chrono::steady_clock::now() - start_, in_flight_);
+}
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(
+    const AdaptiveConcurrencyLimitConfig& config)
+    : config_(config),
+      limit_(config.initial_limit),
+      estimated_limit_(config.initial_limit) {
+  UASSERT(config_.min_limit <= config_.initial_limit);
+  UASSERT(config_.initial_limit <= config_.max_limit);
+}
+
+std::optional<AdaptiveConcurrencyLimiter::Token>
+AdaptiveConcurrencyLimiter::TryAcquire() {
+  auto in_flight = in_flight_.load(std::memory_order_relaxed);
+  do {
+    if (in_flight >= limit_.load(std::memory_order_relaxed)) {
+      rejected_.fetch_add(1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+  } while (!in_flight_.compare_exchange_weak(in_flight, in_flight + 1,
+                                             std::memory_order_relaxed));
+  return Token{*this, in_flight + 1};
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetLimit() const noexcept {
+  return limit_.load(std::memory_order_relaxed);
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetInFlight() const noexcept {
+  return in_flight_.load(std::memory_order_relaxed);
+}
+
+void AdaptiveConcurrencyLimiter::AddSample(
+    std::chrono::steady_clock::duration latency, std::size_t in_flight) {
+  // The estimation tolerates lost samples, the request must not wait for it
+  std::unique_lock lock(estimation_mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) return;
+
+  window_latency_sum_us_ +=
+      std::chrono::duration<double, std::micro>(latency).count();
+  window_max_in_flight_ = std::max(window_max_in_flight_, in_flight);
+  if (++window_samples_ < kWindowSamples) return;
+
+  const auto short_latency = window_latency_sum_us_ / window_samples_;
+  const auto max_in_flight = window_max_in_flight_;
+  window_latency_sum_us_ = 0;
+  window_samples_ = 0;
+  window_max_in_flight_ = 0;
+  UpdateLimit(short_latency, max_in_flight);
+}
+
+void AdaptiveConcurrencyLimiter::UpdateLimit(double short_latency,
+                                             std::size_t max_in_flight) {
+  // Avoid division by zero for the handlers that respond instantly
+  short_latency = std::max(short_latency, 1.0);
+  if (long_latency_us_ == 0) {
+    long_latency_us_ = short_latency;
+  } else {
+    long_latency_us_ += (short_latency - long_latency_us_) * kLongLatencyWeight;
+  }
+  // Recover faster after a period of high latency
+  if (long_latency_us_ > short_latency * 2) long_latency_us_ *= 0.95;
+
+  // The load does not reach the limit, so the latency says nothing about it
+  if (max_in_flight * 2 < estimated_limit_) return;
+
+  const auto gradient = std::clamp(
+      config_.tolerance * long_latency_us_ / short_latency, kMinGradient, 1.0);
+  const auto new_limit =
+      estimated_limit_ * gradient + std::sqrt(estimated_limit_);
+  const auto smoothed_limit = estimated_limit_ * (1 - config_.smoothing) +
+                              new_limit * config_.smoothing;
+  estimated_limit_ = std::clamp(smoothed_limit,
+                                static_cast<double>(config_.min_limit),
+                                static_cast<double>(config_.max_limit));
+  limit_.store(static_cast<std::size_t>(estimated_limit_),
+               std::memory_order_relaxed);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AdaptiveConcurrencyLimiter& limiter) {
+  writer["limit"] = limiter.GetLimit();
+  writer["in-flight"] = limiter.GetInFlight();
+  writer["rejected"] = limiter.rejected_.load(std::memory_order_relaxed);
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// Limits the requests in flight of a handler according to its
+/// `adaptive-concurrency-limit` static config option.
+///
+/// The limit is estimated with the gradient of the latency: the short-term
+/// latency of the recent requests is compared with the long-term one, the
+/// limit is reduced while the ratio exceeds the tolerance and grows by about
+/// sqrt(limit) otherwise, so that a small queue is always allowed.
+class AdaptiveConcurrencyLimiter final {
+ public:
+  /// Keeps a slot of the limit for a request until destroyed
+  class Token final {
+   public:
+    Token(Token&& other) noexcept;
+    Token& operator=(Token&&) = delete;
+    ~Token();
+
+    /// Reports the latency of the request to the limit estimation, the
+    /// slot is kept until the Token is destroyed
+    void Complete();
+
+   private:
+    friend class AdaptiveConcurrencyLimiter;
+
+    Token(AdaptiveConcurrencyLimiter& limiter, std::size_t in_flight);
+
+    AdaptiveConcurrencyLimiter* limiter_;
+    std::chrono::steady_clock::time_point start_;
+    std::size_t in_flight_;
+  };
+
+  explicit AdaptiveConcurrencyLimiter(
+      const AdaptiveConcurrencyLimitConfig& config);
+
+  /// Returns std::nullopt if the request must be rejected
+  std::optional<Token> TryAcquire();
+
+  std::size_t GetLimit() const noexcept;
+  std::size_t GetInFlight() const noexcept;
+
+  /// @cond
+  // For tests
+  void AddSample(std::chrono::steady_clock::duration latency,
+                 std::size_t in_flight);
+  /// @endcond
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const AdaptiveConcurrencyLimiter& limiter);
+
+ private:
+  void UpdateLimit(double short_latency, std::size_t max_in_flight);
+
+  const AdaptiveConcurrencyLimitConfig config_;
+  std::atomic<std::size_t> limit_;
+  std::atomic<std::size_t> in_flight_{0};
+  std::atomic<std::size_t> rejected_{0};
+
+  std::mutex estimation_mutex_;
+  double estimated_limit_;
+  double long_latency_us_{0};
+  double window_latency_sum_us_{0};
+  std::size_t window_samples_{0};
+  std::size_t window_max_in_flight_{0};
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::AdaptiveConcurrencyLimitConfig;
+using server::handlers::AdaptiveConcurrencyLimiter;
+
+AdaptiveConcurrencyLimitConfig MakeConfig(std::size_t initial_limit) {
+  AdaptiveConcurrencyLimitConfig config;
+  config.min_limit = 2;
+  config.max_limit = 100;
+  config.initial_limit = initial_limit;
+  return config;
+}
+
+void AddLoadedSamples(AdaptiveConcurrencyLimiter& limiter,
+                      std::chrono::microseconds latency, int count) {
+  for (int i = 0; i < count; ++i) {
+    limiter.AddSample(latency, limiter.GetLimit());
+  }
+}
+
+}  // namespace
+
+TEST(AdaptiveConcurrencyLimiter, RejectsOverLimit) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig(2)};
+
+  std::vector<AdaptiveConcurrencyLimiter::Token> tokens;
+  for (int i = 0; i < 2; ++i) {
+    auto token = limiter.TryAcquire();
+    ASSERT_TRUE(token);
+    tokens.push_back(std::move(*token));
+  }
+  EXPECT_EQ(limiter.GetInFlight(), 2);
+  EXPECT_FALSE(limiter.TryAcquire());
+
+  tokens.pop_back();
+  EXPECT_EQ(limiter.GetInFlight(), 1);
+  EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_EQ(limiter.GetInFlight(), 1);
+}
+
+TEST(AdaptiveConcurrencyLimiter, GrowsWithStableLatency) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig(10)};
+
+  AddLoadedSamples(limiter, std::chrono::milliseconds{1}, 100);
+  EXPECT_GT(limiter.GetLimit(), 10);
+
+  AddLoadedSamples(limiter, std::chrono::milliseconds{1}, 10000);
+  EXPECT_EQ(limiter.GetLimit(), 100);
+}
+
+TEST(AdaptiveConcurrencyLimiter, ShrinksWithGrowingLatency) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig(50)};
+
+  AddLoadedSamples(limiter, std::chrono::milliseconds{1}, 50);
+  const auto limit = limiter.GetLimit();
+
+  AddLoadedSamples(limiter, std::chrono::milliseconds{10}, 100);
+  EXPECT_LT(limiter.GetLimit(), limit);
+  EXPECT_GE(limiter.GetLimit(), 2);
+}
+
+TEST(AdaptiveConcurrencyLimiter, KeepsLimitWithoutLoad) {
+  AdaptiveConcurrencyLimiter limiter{MakeConfig(20)};
+
+  for (int i = 0; i < 100; ++i) {
+    limiter.AddSample(std::chrono::milliseconds{1}, 1);
+  }
+  EXPECT_EQ(limiter.GetLimit(), 20);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#include <server/handlers/byte_range.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <optional>
+
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::string_view kBytesUnit = "bytes=";
+constexpr std::string_view kWhitespace = " \t";
+
+std::string_view Trim(std::string_view str) {
+  const auto begin = str.find_first_not_of(kWhitespace);
+  if (begin == std::string_view::npos) return {};
+  const auto end = str.find_last_not_of(kWhitespace);
+  return str.substr(begin, end - begin + 1);
+}
+
+std::optional<std::uint64_t> ParsePosition(std::string_view str) {
+  if (str.empty()) return std::nullopt;
+  std::uint64_t result = 0;
+  const auto [end, error] =
+      std::from_chars(str.data(), str.data() + str.size(), result);
+  if (error != std::errc{} || end != str.data() + str.size()) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+ByteRange MakePartial(std::uint64_t first, std::uint64_t last) {
+  return {ByteRange::Kind::kPartial, first, last - first + 1};
+}
+
+}  // namespace
+
+ByteRange ParseByteRange(std::string_view range, std::uint64_t size) {
+  const ByteRange whole{ByteRange::Kind::kWhole, 0, size};
+  const ByteRange unsatisfiable{ByteRange::Kind::kUnsatisfiable, 0, 0};
+
+  if (range.size() < kBytesUnit.size() ||
+      !utils::StrIcaseEqual{}(range.substr(0, kBytesUnit.size()),
+                              kBytesUnit)) {
+    return whole;
+  }
+  const auto spec = Trim(range.substr(kBytesUnit.size()));
+  // Serving multiple ranges as multipart/byteranges is not supported, and
+  // ignoring the header is allowed
+  if (spec.find(',') != std::string_view::npos) return whole;
+
+  const auto dash = spec.find('-');
+  if (dash == std::string_view::npos) return whole;
+  const auto first_str = spec.substr(0, dash);
+  const auto last_str = spec.substr(dash + 1);
+
+  if (first_str.empty()) {
+    const auto suffix = ParsePosition(last_str);
+    if (!suffix) return whole;
+    if (*suffix == 0 || size == 0) return unsatisfiable;
+    return MakePartial(size - std::min(*suffix, size), size - 1);
+  }
+
+  const auto first = ParsePosition(first_str);
+  if (!first) return whole;
+  std::optional<std::uint64_t> last = size == 0 ? 0 : size - 1;
+  if (!last_str.empty()) {
+    last = ParsePosition(last_str);
+    if (!last || *last < *first) return whole;
+  }
+  if (*first >= size) return unsatisfiable;
+  return MakePartial(*first, std::min(*last, size - 1));
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// Part of a representation requested by the Range header
+struct ByteRange {
+  enum class Kind {
+    /// The header is absent, malformed or requests multiple ranges, the whole
+    /// representation should be sent
+    kWhole,
+    /// 416 Range Not Satisfiable should be sent
+    kUnsatisfiable,
+    /// 206 Partial Content should be sent
+    kPartial,
+  };
+
+  Kind kind{Kind::kWhole};
+  std::uint64_t offset{0};
+  std::uint64_t size{0};
+};
+
+/// Parses the Range header value for a representation of `size` bytes,
+/// see RFC 9110 14.1.2
+ByteRange ParseByteRange(std::string_view range, std::uint64_t size);
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
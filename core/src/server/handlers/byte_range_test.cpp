@@ -0,0 +1,54 @@
+#include <server/handlers/byte_range.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::ByteRange;
+using server::handlers::ParseByteRange;
+
+void ExpectPartial(const ByteRange& range, std::uint64_t offset,
+                   std::uint64_t size) {
+  EXPECT_EQ(range.kind, ByteRange::Kind::kPartial);
+  EXPECT_EQ(range.offset, offset);
+  EXPECT_EQ(range.size, size);
+}
+
+}  // namespace
+
+TEST(ByteRange, Partial) {
+  ExpectPartial(ParseByteRange("bytes=0-499", 10000), 0, 500);
+  ExpectPartial(ParseByteRange("bytes=500-999", 10000), 500, 500);
+  ExpectPartial(ParseByteRange("bytes=9500-", 10000), 9500, 500);
+  ExpectPartial(ParseByteRange("bytes=-500", 10000), 9500, 500);
+  ExpectPartial(ParseByteRange("Bytes= 0-0 ", 10000), 0, 1);
+}
+
+TEST(ByteRange, Clamped) {
+  ExpectPartial(ParseByteRange("bytes=9500-20000", 10000), 9500, 500);
+  ExpectPartial(ParseByteRange("bytes=-20000", 10000), 0, 10000);
+}
+
+TEST(ByteRange, Unsatisfiable) {
+  EXPECT_EQ(ParseByteRange("bytes=10000-", 10000).kind,
+            ByteRange::Kind::kUnsatisfiable);
+  EXPECT_EQ(ParseByteRange("bytes=-0", 10000).kind,
+            ByteRange::Kind::kUnsatisfiable);
+  EXPECT_EQ(ParseByteRange("bytes=0-", 0).kind,
+            ByteRange::Kind::kUnsatisfiable);
+}
+
+TEST(ByteRange, Whole) {
+  for (const auto* range :
+       {"", "items=0-1", "bytes=", "bytes=1", "bytes=5-1", "bytes=a-b",
+        "bytes=0-1,5-6", "bytes=-", "bytes=1-2-3"}) {
+    const auto result = ParseByteRange(range, 10000);
+    EXPECT_EQ(result.kind, ByteRange::Kind::kWhole) << range;
+    EXPECT_EQ(result.offset, 0) << range;
+    EXPECT_EQ(result.size, 10000) << range;
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include <userver/server/handlers/components_load_report.hpp>
+
+#include <components/load_report.hpp>
+#include <components/manager.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+ComponentsLoadReport::ComponentsLoadReport(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerJsonBase(config, component_context, /*is_monitor = */ true),
+      manager_(component_context.GetManager()) {}
+
+formats::json::Value ComponentsLoadReport::HandleRequestJsonThrow(
+    const http::HttpRequest&, const formats::json::Value&,
+    request::RequestContext&) const {
+  formats::json::ValueBuilder result{
+      components::impl::MakeLoadReportJson(manager_.GetLoadStats())};
+  result["load-duration-ms"] = manager_.GetLoadDuration().count();
+  return result.ExtractValue();
+}
+
+yaml_config::Schema ComponentsLoadReport::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-components-load-report config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <server/handlers/deadline_propagation.hpp>
+
+#include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/handlers/impl/deadline_propagation_config.hpp>
+#include <userver/server/http/http_error.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+std::optional<std::chrono::milliseconds> ParseClientTimeout(
+    std::string_view timeout_ms_str) {
+  if (timeout_ms_str.empty()) return std::nullopt;
+
+  LOG_DEBUG() << "Got client timeout_ms=" << timeout_ms_str;
+  std::chrono::milliseconds timeout;
+  try {
+    timeout = std::chrono::milliseconds{
+        utils::FromString<std::uint64_t>(timeout_ms_str)};
+  } catch (const std::exception& ex) {
+    LOG_LIMITED_WARNING() << "Can't parse client timeout from '"
+                          << timeout_ms_str << '\'';
+    return std::nullopt;
+  }
+
+  // Very large timeouts may cause overflows.
+  if (timeout >= std::chrono::hours{24 * 365 * 10}) {
+    LOG_LIMITED_WARNING() << "Unreasonably large timeout: " << timeout;
+    return std::nullopt;
+  }
+
+  return timeout;
+}
+
+engine::Deadline GetPropagatedDeadline(const HttpHandlerBase& handler,
+                                       const http::HttpRequestImpl& request,
+                                       const dynamic_config::Snapshot& config) {
+  if (!handler.GetConfig().deadline_propagation_enabled) return {};
+  if (!config[impl::kDeadlinePropagationEnabled]) return {};
+
+  const auto timeout = ParseClientTimeout(request.GetHeader(
+      USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs));
+  if (!timeout) return {};
+
+  return engine::Deadline::FromTimePoint(request.StartTime() + *timeout);
+}
+
+void ReportDroppedByDeadline(const HttpHandlerBase& handler,
+                             http::HttpRequestImpl& request) {
+  try {
+    handler.GetHandlerStatistics()
+        .ForMethod(request.GetMethod())
+        .IncrementDroppedByDeadline();
+
+    const auto& config = handler.GetConfig();
+    auto& response = request.GetHttpResponse();
+    response.SetStatus(config.deadline_expired_status_code);
+
+    auto formatted_error = handler.GetFormattedExternalErrorBody(
+        http::CustomHandlerException{
+            HandlerErrorCode::kClientError, config.deadline_expired_status_code,
+            ExternalBody{"Deadline expired"},
+            InternalMessage{"Queue timeout (deadline propagation)"},
+            ServiceErrorCode{"deadline_expired"}});
+    response.SetData(std::move(formatted_error.external_body));
+    if (formatted_error.content_type) {
+      response.SetContentType(*std::move(formatted_error.content_type));
+    }
+    response.SetHeader(
+        USERVER_NAMESPACE::http::headers::kXYaTaxiDeadlineExpired,
+        std::string{"1"});
+
+    request.SetResponseNotifyTime();
+    response.SetReady();
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "unable to respond to a request dropped by deadline: "
+                << ex;
+  }
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpRequestImpl;
+}  // namespace server::http
+
+namespace server::handlers {
+
+// Parses the value of the X-YaTaxi-Client-TimeoutMs header, std::nullopt if
+// the header is missing or malformed
+std::optional<std::chrono::milliseconds> ParseClientTimeout(
+    std::string_view timeout_ms_str);
+
+// The deadline propagated by the client of the request, unreachable if the
+// deadline propagation is disabled or the request has no timeout
+engine::Deadline GetPropagatedDeadline(const HttpHandlerBase& handler,
+                                       const http::HttpRequestImpl& request,
+                                       const dynamic_config::Snapshot& config);
+
+// Responds to the request whose task was dropped from the task processor
+// queue because its propagated deadline had passed before the task started
+void ReportDroppedByDeadline(const HttpHandlerBase& handler,
+                             http::HttpRequestImpl& request);
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
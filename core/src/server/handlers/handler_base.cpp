@@ -93,8 +93,12 @@ properties:
         defaultDescription: <no limit>
     decompress_request:
         type: boolean
-        description: allow decompression of the requests
+        description: allow decompression of the gzip and br requests, the body is decompressed as it is received and the decompressed size is limited by max_request_size
         defaultDescription: false
+    multipart-spool-dir:
+        type: string
+        description: stream the multipart/form-data requests that are not compressed and write their file parts to temporary files in this directory instead of keeping the whole body in memory
+        defaultDescription: <the body is kept in memory>
     throttling_enabled:
         type: boolean
         description: allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options
@@ -107,6 +111,103 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    response-compression:
+        type: object
+        description: compress the responses with one of the encodings accepted by the client
+        defaultDescription: <no compression>
+        additionalProperties: false
+        properties:
+            encodings:
+                type: array
+                description: content codings in the order of preference
+                defaultDescription: '[br, gzip], without br if built without brotli'
+                items:
+                    type: string
+                    description: content coding
+                    enum:
+                      - br
+                      - gzip
+            min-size:
+                type: integer
+                description: do not compress the responses smaller than this
+                defaultDescription: 1024
+                minimum: 0
+            gzip-level:
+                type: integer
+                description: gzip compression level
+                defaultDescription: 6
+                minimum: 1
+                maximum: 9
+            brotli-level:
+                type: integer
+                description: brotli compression level
+                defaultDescription: 4
+                minimum: 0
+                maximum: 11
+            task-processor:
+                type: string
+                description: a task processor to compress the responses on
+                defaultDescription: <the task processor of the handler>
+    static-response-headers:
+        type: object
+        description: headers to add to each response, they are formatted once at startup; the headers set by the handler take precedence
+        defaultDescription: '{}'
+        properties: {}
+        additionalProperties:
+            type: string
+            description: header value
+    request-coalescing:
+        type: object
+        description: run the handler once for the concurrent identical GET and HEAD requests and copy its response to all of them
+        defaultDescription: <no coalescing>
+        additionalProperties: false
+        properties:
+            args:
+                type: array
+                description: names of the request args the response depends on
+                defaultDescription: <all the args>
+                items:
+                    type: string
+                    description: arg name
+            headers:
+                type: array
+                description: names of the request headers the response depends on
+                defaultDescription: '[]'
+                items:
+                    type: string
+                    description: header name
+    adaptive-concurrency-limit:
+        type: object
+        description: limit the requests in flight of the handler, the limit is adapted to the observed latency and the requests over it are rejected with 429
+        defaultDescription: <no limit>
+        additionalProperties: false
+        properties:
+            min-limit:
+                type: integer
+                description: the limit is never reduced below this value
+                defaultDescription: 8
+                minimum: 1
+            max-limit:
+                type: integer
+                description: the limit is never increased above this value
+                defaultDescription: 1000
+                minimum: 1
+            initial-limit:
+                type: integer
+                description: the limit on startup
+                defaultDescription: 20
+                minimum: 1
+            tolerance:
+                type: number
+                description: ratio of the current latency to the minimal one that does not reduce the limit
+                defaultDescription: 1.5
+                minimum: 1
+            smoothing:
+                type: number
+                description: weight of each new limit estimation
+                defaultDescription: 0.2
+                minimum: 0
+                maximum: 1
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
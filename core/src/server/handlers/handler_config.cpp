@@ -1,7 +1,10 @@
 #include <userver/server/handlers/handler_config.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
+#include <compression/compressor.hpp>
 #include <server/server_config.hpp>
 
 #include <server/http/parse_http_status.hpp>
@@ -31,6 +34,73 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml,
   return FallbackHandlerFromString(value);
 }
 
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& value,
+                                formats::parse::To<ResponseCompressionConfig>) {
+  ResponseCompressionConfig config;
+
+  if (value["encodings"].IsMissing()) {
+    // The default list is trimmed to what this build supports
+    const auto unsupported = [](const std::string& encoding) {
+      return !compression::AlgorithmFromContentEncoding(encoding);
+    };
+    config.encodings.erase(std::remove_if(config.encodings.begin(),
+                                          config.encodings.end(), unsupported),
+                           config.encodings.end());
+  } else {
+    config.encodings = value["encodings"].As<std::vector<std::string>>();
+  }
+  for (const auto& encoding : config.encodings) {
+    if (!compression::AlgorithmFromContentEncoding(encoding)) {
+      throw std::runtime_error(fmt::format(
+          "Unsupported response compression encoding '{}' at '{}', expected "
+          "'br' or 'gzip' ('br' requires USERVER_FEATURE_BROTLI)",
+          encoding, value["encodings"].GetPath()));
+    }
+  }
+  config.min_size = value["min-size"].As<size_t>(config.min_size);
+  config.gzip_level = value["gzip-level"].As<int>(config.gzip_level);
+  config.brotli_level = value["brotli-level"].As<int>(config.brotli_level);
+  config.task_processor =
+      value["task-processor"].As<std::optional<std::string>>();
+
+  return config;
+}
+
+RequestCoalescingConfig Parse(const yaml_config::YamlConfig& value,
+                              formats::parse::To<RequestCoalescingConfig>) {
+  RequestCoalescingConfig config;
+  config.args = value["args"].As<std::optional<std::vector<std::string>>>();
+  config.headers = value["headers"].As<std::vector<std::string>>({});
+  return config;
+}
+
+AdaptiveConcurrencyLimitConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<AdaptiveConcurrencyLimitConfig>) {
+  AdaptiveConcurrencyLimitConfig config;
+  config.min_limit = value["min-limit"].As<size_t>(config.min_limit);
+  config.max_limit = value["max-limit"].As<size_t>(config.max_limit);
+  config.initial_limit =
+      value["initial-limit"].As<size_t>(config.initial_limit);
+  config.tolerance = value["tolerance"].As<double>(config.tolerance);
+  config.smoothing = value["smoothing"].As<double>(config.smoothing);
+
+  if (config.min_limit == 0 || config.min_limit > config.max_limit ||
+      config.initial_limit < config.min_limit ||
+      config.initial_limit > config.max_limit) {
+    throw std::runtime_error(fmt::format(
+        "Expected 0 < min-limit <= initial-limit <= max-limit at '{}'",
+        value.GetPath()));
+  }
+  if (config.tolerance < 1.0 || config.smoothing <= 0.0 ||
+      config.smoothing > 1.0) {
+    throw std::runtime_error(fmt::format(
+        "Expected tolerance >= 1 and smoothing in (0, 1] at '{}'",
+        value.GetPath()));
+  }
+  return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config, bool is_monitor) {
@@ -83,11 +153,24 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
   config.max_requests_per_second =
       value["max_requests_per_second"].As<std::optional<size_t>>();
   config.decompress_request = value["decompress_request"].As<bool>(true);
+  config.multipart_spool_dir =
+      value["multipart-spool-dir"].As<std::optional<std::string>>();
   config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
   config.set_response_server_hostname =
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.response_compression =
+      value["response-compression"]
+          .As<std::optional<ResponseCompressionConfig>>();
+  config.static_response_headers =
+      value["static-response-headers"].As<std::map<std::string, std::string>>(
+          {});
+  config.request_coalescing =
+      value["request-coalescing"].As<std::optional<RequestCoalescingConfig>>();
+  config.adaptive_concurrency_limit =
+      value["adaptive-concurrency-limit"]
+          .As<std::optional<AdaptiveConcurrencyLimitConfig>>();
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
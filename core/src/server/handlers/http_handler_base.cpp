@@ -3,10 +3,16 @@
 #include <fmt/core.h>
 #include <boost/algorithm/string/split.hpp>
 
-#include <compression/gzip.hpp>
+#include <compression/compressor.hpp>
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+#include <server/handlers/deadline_propagation.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/handlers/http_handler_stage_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
+#include <server/handlers/request_coalescer.hpp>
+#include <server/handlers/response_compressor.hpp>
 #include <server/http/http_request_impl.hpp>
+#include <server/http/static_headers.hpp>
 #include <server/server_config.hpp>
 #include <userver/baggage/baggage.hpp>
 #include <userver/baggage/baggage_settings.hpp>
@@ -110,9 +116,9 @@ void SetUpBaggage(const http::HttpRequest& http_request,
         http_request.GetHeader(USERVER_NAMESPACE::http::headers::kXBaggage);
     if (!baggage_header.empty()) {
       LOG_DEBUG() << "Got baggage header: " << baggage_header;
-      const auto& baggage_settings = config_snapshot[baggage::kBaggageSettings];
-      auto baggage = baggage::TryMakeBaggage(std::move(baggage_header),
-                                             baggage_settings.allowed_keys);
+      auto baggage =
+          baggage::TryMakeBaggage(std::move(baggage_header),
+                                  baggage::GetAllowedKeys(config_snapshot));
       if (baggage) {
         baggage::kInheritedBaggage.Set(std::move(*baggage));
       }
@@ -197,10 +203,12 @@ class RequestProcessor final {
   }
 
   template <typename Func>
-  void ProcessRequestStep(std::string_view step_name,
+  void ProcessRequestStep(std::string_view step_name, HttpHandlerStage stage,
                           const Func& process_step_func) {
     if (process_finished_) return;
     const tracing::ScopeTime scope_time{std::string{step_name}};
+    const HttpHandlerStageScope stage_scope{handler_.GetStageStatistics(),
+                                            stage};
     DoProcessRequestStep(step_name, process_step_func);
   }
 
@@ -299,32 +307,6 @@ class RequestProcessor final {
   const bool need_log_response_headers_;
 };
 
-std::optional<std::chrono::milliseconds> ParseTimeout(
-    const http::HttpRequest& request) {
-  const auto& timeout_ms_str = request.GetHeader(
-      USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs);
-  if (timeout_ms_str.empty()) return std::nullopt;
-
-  LOG_DEBUG() << "Got client timeout_ms=" << timeout_ms_str;
-  std::chrono::milliseconds timeout;
-  try {
-    timeout = std::chrono::milliseconds{
-        utils::FromString<std::uint64_t>(timeout_ms_str)};
-  } catch (const std::exception& ex) {
-    LOG_LIMITED_WARNING() << "Can't parse client timeout from '"
-                          << timeout_ms_str << '\'';
-    return std::nullopt;
-  }
-
-  // Very large timeouts may cause overflows.
-  if (timeout >= std::chrono::hours{24 * 365 * 10}) {
-    LOG_LIMITED_WARNING() << "Unreasonably large timeout: " << timeout;
-    return std::nullopt;
-  }
-
-  return timeout;
-}
-
 struct DeadlinePropagationContext final {
   bool need_log_response{false};
   bool is_cancelled_by_deadline{false};
@@ -364,7 +346,8 @@ void SetUpInheritedDeadline(RequestProcessor& processor,
     return;
   }
 
-  const auto timeout = ParseTimeout(processor.GetRequest());
+  const auto timeout = ParseClientTimeout(processor.GetRequest().GetHeader(
+      USERVER_NAMESPACE::http::headers::kXYaTaxiClientTimeoutMs));
   if (!timeout) return;
 
   dp_context.need_log_response =
@@ -525,6 +508,9 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
               .As<std::unordered_map<std::string, std::string>>({}))),
       handler_statistics_(std::make_unique<HttpHandlerStatistics>()),
       request_statistics_(std::make_unique<HttpRequestStatistics>()),
+      stage_statistics_(config["stage-statistics"].As<bool>(false)
+                            ? std::make_unique<HttpHandlerStageStatistics>()
+                            : nullptr),
       auth_checkers_(auth::CreateAuthCheckers(
           context, GetConfig(),
           context.FindComponent<components::AuthCheckerSettings>().Get())),
@@ -571,12 +557,24 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
                         }},
       GetConfig().path);
 
+  if (const auto& limit_config = GetConfig().adaptive_concurrency_limit) {
+    concurrency_limiter_ =
+        std::make_unique<AdaptiveConcurrencyLimiter>(*limit_config);
+  }
+
   auto& statistics_storage =
       context.FindComponent<components::StatisticsStorage>().GetStorage();
   statistics_holder_ = statistics_storage.RegisterWriter(
       std::move(prefix),
       [this](utils::statistics::Writer& result) {
         FormatStatistics(result["handler"], *handler_statistics_);
+        if (concurrency_limiter_) {
+          result["handler"]["adaptive-concurrency-limit"] =
+              *concurrency_limiter_;
+        }
+        if (stage_statistics_) {
+          result["handler"]["profile"] = *stage_statistics_;
+        }
         if constexpr (kIncludeServerHttpMetrics) {
           FormatStatistics(result["request"], *request_statistics_);
         }
@@ -588,10 +586,38 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
           server_component.GetServer()
               .GetConfig()
               .set_response_server_hostname);
+
+  if (const auto& compression_config = GetConfig().response_compression) {
+    engine::TaskProcessor* compression_task_processor = nullptr;
+    if (compression_config->task_processor) {
+      compression_task_processor =
+          &context.GetTaskProcessor(*compression_config->task_processor);
+    }
+    response_compressor_ = std::make_unique<ResponseCompressor>(
+        *compression_config, compression_task_processor);
+  }
+
+  if (const auto& coalescing_config = GetConfig().request_coalescing) {
+    request_coalescer_ =
+        std::make_unique<RequestCoalescer>(*coalescing_config);
+  }
+
+  if (!GetConfig().static_response_headers.empty()) {
+    static_response_headers_ = std::make_unique<const http::StaticHeaders>(
+        GetConfig().static_response_headers);
+  }
 }
 
 HttpHandlerBase::~HttpHandlerBase() { statistics_holder_.Unregister(); }
 
+AdaptiveConcurrencyLimiter* HttpHandlerBase::GetConcurrencyLimiter() const {
+  return concurrency_limiter_.get();
+}
+
+HttpHandlerStageStatistics* HttpHandlerBase::GetStageStatistics() const {
+  return stage_statistics_.get();
+}
+
 void HttpHandlerBase::HandleRequestStream(
     const http::HttpRequest& http_request,
     request::RequestContext& context) const {
@@ -601,6 +627,11 @@ void HttpHandlerBase::HandleRequestStream(
   auto& http_response = http_request.GetHttpResponse();
   server::http::ResponseBodyStream response_body_stream{
       response.GetBodyProducer(), http_response};
+  if (response_compressor_) {
+    response_body_stream.SetCompressor(
+        response_compressor_->StartStream(http_request, http_response),
+        response_compressor_->GetTaskProcessor());
+  }
 
   // Just in case HandleStreamRequest() throws an exception.
   // Though it can be changed in HandleStreamRequest().
@@ -650,6 +681,8 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
   http::HttpRequest http_request(http_request_impl);
   auto& response = http_request.GetHttpResponse();
   std::optional<tracing::Span> span_storage;
+  response.SetStaticHeaders(static_response_headers_.get());
+  const HttpHandlerAllocationScope allocation_scope{stage_statistics_.get()};
 
   try {
     HttpHandlerStatisticsScope stats_scope(*handler_statistics_,
@@ -677,17 +710,18 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
         });
 
     request_processor.ProcessRequestStep(
-        "http_check_auth",
+        "http_check_auth", HttpHandlerStage::kCheckAuth,
         [this, &http_request, &context] { CheckAuth(http_request, context); });
 
     if (GetConfig().decompress_request) {
       request_processor.ProcessRequestStep(
-          "http_decompress_request_body",
+          "http_decompress_request_body", HttpHandlerStage::kDecompressRequest,
           [this, &http_request] { DecompressRequestBody(http_request); });
     }
 
     request_processor.ProcessRequestStep(
-        "http_parse_request_data", [this, &http_request, &context] {
+        "http_parse_request_data", HttpHandlerStage::kParseRequest,
+        [this, &http_request, &context] {
           ParseRequestData(http_request, context);
         });
 
@@ -708,12 +742,20 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     }
 
     request_processor.ProcessRequestStep(
-        "http_handle_request", [this, &response, &http_request, &context] {
+        "http_handle_request", HttpHandlerStage::kHandleRequest,
+        [this, &response, &http_request, &context] {
           if (response.IsBodyStreamed()) {
             HandleRequestStream(http_request, context);
           } else {
             // !IsBodyStreamed()
-            response.SetData(HandleRequestThrow(http_request, context));
+            if (request_coalescer_) {
+              response.SetData(
+                  request_coalescer_->Handle(http_request, [&] {
+                    return HandleRequestThrow(http_request, context);
+                  }));
+            } else {
+              response.SetData(HandleRequestThrow(http_request, context));
+            }
           }
         });
 
@@ -728,6 +770,7 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     LOG_ERROR() << "unable to handle request: " << ex;
   }
 
+  CompressResponse(http_request, response);
   SetResponseAcceptEncoding(response);
   SetResponseServerHostname(response);
   response.SetHeadersEnd();
@@ -811,7 +854,13 @@ FormattedErrorData HttpHandlerBase::GetFormattedExternalErrorBody(
 tracing::Span HttpHandlerBase::MakeSpan(const http::HttpRequest& http_request,
                                         const std::string& meta_type) const {
   tracing::SpanBuilder span_builder(fmt::format("http/{}", HandlerName()));
-  tracing_manager_.TryFillSpanBuilderFromRequest(http_request, span_builder);
+  const bool is_trace_continued =
+      tracing_manager_.TryFillSpanBuilderFromRequest(http_request,
+                                                     span_builder);
+  if (!is_trace_continued) {
+    span_builder.SetSampled(
+        tracing_manager_.ShouldSampleNewTrace(HandlerName()));
+  }
   auto span = std::move(span_builder).Build();
 
   span.SetLocalLogLevel(log_level_);
@@ -883,12 +932,18 @@ void HttpHandlerBase::DecompressRequestBody(
         USERVER_NAMESPACE::http::headers::kContentEncoding);
   }};
 
+  // Usually the body is decompressed as it is received, see
+  // server::http::HttpRequestConstructor
   try {
-    if (content_encoding == "gzip") {
+    const auto algorithm =
+        compression::AlgorithmFromContentEncoding(content_encoding);
+    if (algorithm) {
       http_request.RemoveHeader("Content-Encoding");
-      auto body = compression::gzip::Decompress(
-          http_request.RequestBody(),
-          GetConfig().request_config.max_request_size);
+      std::string body;
+      auto decompressor = compression::MakeStreamDecompressor(*algorithm);
+      decompressor->Decompress(http_request.RequestBody(), body,
+                               GetConfig().request_config.max_request_size);
+      decompressor->Finish();
       http_request.SetRequestBody(std::move(body));
       if (GetConfig().request_config.parse_args_from_body) {
         http_request.ParseArgsFromBody();
@@ -982,7 +1037,20 @@ void HttpHandlerBase::SetResponseAcceptEncoding(
 
   if (!response.HasHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding)) {
     response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding,
-                       "gzip, identity");
+                       "gzip, br, identity");
+  }
+}
+
+void HttpHandlerBase::CompressResponse(const http::HttpRequest& http_request,
+                                       http::HttpResponse& response) const {
+  if (!response_compressor_) return;
+
+  const HttpHandlerStageScope stage_scope{stage_statistics_.get(),
+                                          HttpHandlerStage::kCompressResponse};
+  try {
+    response_compressor_->Compress(http_request, response);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "unable to compress the response: " << ex;
   }
 }
 
@@ -1011,6 +1079,13 @@ properties:
             type: string
             description: log level
         description: HTTP status code -> log level map
+    stage-statistics:
+        type: boolean
+        description: |
+            whether to collect the percentiles of the timings and the CPU time
+            of the request processing stages and of the bytes allocated per
+            request
+        defaultDescription: false
 )");
 }
 
@@ -24,6 +24,7 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["rate-limit-reached"] = stats.rate_limit_reached;
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
+  writer["dropped-by-deadline"] = stats.dropped_by_deadline;
   writer["timings"] = stats.timings;
 }
 
@@ -59,7 +60,8 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
       too_many_requests_in_flight(stats.too_many_requests_in_flight_.Load()),
       rate_limit_reached(stats.rate_limit_reached_.Load()),
       deadline_received(stats.deadline_received_.Load()),
-      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()) {}
+      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()),
+      dropped_by_deadline(stats.dropped_by_deadline_.Load()) {}
 
 void HttpHandlerStatisticsSnapshot::Add(
     const HttpHandlerStatisticsSnapshot& other) {
@@ -71,6 +73,7 @@ void HttpHandlerStatisticsSnapshot::Add(
   rate_limit_reached += other.rate_limit_reached;
   deadline_received += other.deadline_received;
   cancelled_by_deadline += other.cancelled_by_deadline;
+  dropped_by_deadline += other.dropped_by_deadline;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
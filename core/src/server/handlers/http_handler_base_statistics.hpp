@@ -47,13 +47,14 @@ class HttpHandlerMethodStatistics final {
 
   void IncrementRateLimitReached() noexcept { ++rate_limit_reached_; }
 
+  void IncrementDroppedByDeadline() noexcept { ++dropped_by_deadline_; }
+
  private:
   friend struct HttpHandlerStatisticsSnapshot;
 
   using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
-  using RecentPeriod =
-      utils::statistics::RecentPeriod<Percentile, Percentile,
-                                      utils::datetime::SteadyClock>;
+  using RecentPeriod = utils::statistics::RecentPeriod<
+      Percentile, Percentile, utils::datetime::SteadyCoarseMockableClock>;
 
   RecentPeriod timings_;
   utils::statistics::HttpCodes reply_codes_;
@@ -63,6 +64,7 @@ class HttpHandlerMethodStatistics final {
   utils::statistics::RateCounter rate_limit_reached_;
   utils::statistics::RateCounter deadline_received_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter dropped_by_deadline_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -84,6 +86,7 @@ struct HttpHandlerStatisticsSnapshot final {
   utils::statistics::Rate rate_limit_reached;
   utils::statistics::Rate deadline_received;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate dropped_by_deadline;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -107,7 +110,7 @@ class HttpRequestMethodStatistics final {
 
  private:
   utils::statistics::RecentPeriod<Percentile, Percentile,
-                                  utils::datetime::SteadyClock>
+                                  utils::datetime::SteadyCoarseMockableClock>
       timings_;
 };
 
@@ -1,7 +1,12 @@
 #include <userver/server/handlers/http_handler_json_base.hpp>
 
+#include <algorithm>
+
+#include <userver/components/component_config.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/msgpack.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
 #include <userver/tracing/span.hpp>
 
@@ -10,7 +15,9 @@
 #include <userver/server/handlers/legacy_json_error_builder.hpp>
 #include <userver/server/http/http_error.hpp>
 #include <userver/server/http/http_status.hpp>
-#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <server/handlers/http_handler_stage_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,13 +28,65 @@ namespace {
 const std::string kRequestDataName = "__request_json";
 const std::string kResponseDataName = "__response_json";
 const std::string kSerializeJson = "serialize_json";
+const std::string kSerializeMsgpack = "serialize_msgpack";
+
+const USERVER_NAMESPACE::http::ContentType kApplicationXMsgpack =
+    "application/x-msgpack";
+
+bool IsMsgpack(const USERVER_NAMESPACE::http::ContentType& content_type) {
+  return content_type == USERVER_NAMESPACE::http::content_type::
+                             kApplicationMsgpack ||
+         content_type == kApplicationXMsgpack;
+}
+
+bool IsMsgpackRequest(const http::HttpRequest& request) {
+  const auto& content_type =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
+  if (content_type.empty()) return false;
+  try {
+    return IsMsgpack(content_type);
+  } catch (const USERVER_NAMESPACE::http::MalformedContentType&) {
+    return false;
+  }
+}
+
+// Whether the Accept header prefers MessagePack to JSON, JSON wins the ties
+bool IsMsgpackAccepted(const http::HttpRequest& request) {
+  std::string_view accept =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAccept);
+  int msgpack_quality = 0;
+  int json_quality = 0;
+  while (!accept.empty()) {
+    const auto comma_pos = accept.find(',');
+    const auto media_range = accept.substr(0, comma_pos);
+    accept.remove_prefix(comma_pos == std::string_view::npos ? accept.size()
+                                                             : comma_pos + 1);
+
+    try {
+      const USERVER_NAMESPACE::http::ContentType range{media_range};
+      if (range.DoesAccept(
+              USERVER_NAMESPACE::http::content_type::kApplicationMsgpack) ||
+          range.DoesAccept(kApplicationXMsgpack)) {
+        msgpack_quality = std::max(msgpack_quality, range.Quality());
+      }
+      if (range.DoesAccept(
+              USERVER_NAMESPACE::http::content_type::kApplicationJson)) {
+        json_quality = std::max(json_quality, range.Quality());
+      }
+    } catch (const USERVER_NAMESPACE::http::MalformedContentType&) {
+      // ignore the invalid media ranges
+    }
+  }
+  return msgpack_quality > json_quality;
+}
 
 }  // namespace
 
 HttpHandlerJsonBase::HttpHandlerJsonBase(
     const components::ComponentConfig& config,
     const components::ComponentContext& component_context, bool is_monitor)
-    : HttpHandlerBase(config, component_context, is_monitor) {}
+    : HttpHandlerBase(config, component_context, is_monitor),
+      allow_msgpack_(config["allow-msgpack"].As<bool>(false)) {}
 
 std::string HttpHandlerJsonBase::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext& context) const {
@@ -35,13 +94,29 @@ std::string HttpHandlerJsonBase::HandleRequestThrow(
       context.GetData<const formats::json::Value&>(kRequestDataName);
 
   auto& response = request.GetHttpResponse();
+  const bool is_msgpack_response =
+      allow_msgpack_ && IsMsgpackAccepted(request);
+  if (allow_msgpack_) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{USERVER_NAMESPACE::http::headers::kAccept});
+  }
   response.SetContentType(
-      USERVER_NAMESPACE::http::content_type::kApplicationJson);
+      is_msgpack_response
+          ? USERVER_NAMESPACE::http::content_type::kApplicationMsgpack
+          : USERVER_NAMESPACE::http::content_type::kApplicationJson);
 
   const auto& response_json = context.SetData<const formats::json::Value>(
       kResponseDataName,
       HandleRequestJsonThrow(request, request_json, context));
 
+  const HttpHandlerStageScope stage_scope{GetStageStatistics(),
+                                          HttpHandlerStage::kSerializeResponse};
+  if (is_msgpack_response) {
+    const auto scope_time =
+        tracing::Span::CurrentSpan().CreateScopeTime(kSerializeMsgpack);
+    return formats::msgpack::ToString(response_json);
+  }
+
   const auto scope_time =
       tracing::Span::CurrentSpan().CreateScopeTime(kSerializeJson);
   return formats::json::ToString(response_json);
@@ -71,22 +146,40 @@ FormattedErrorData HttpHandlerJsonBase::GetFormattedExternalErrorBody(
 void HttpHandlerJsonBase::ParseRequestData(
     const http::HttpRequest& request, request::RequestContext& context) const {
   formats::json::Value request_json;
-  try {
-    if (!request.RequestBody().empty())
-      request_json = formats::json::FromString(request.RequestBody());
-  } catch (const formats::json::Exception& e) {
-    throw RequestParseError(
-        InternalMessage{"Invalid JSON body"},
-        ExternalBody{std::string("Invalid JSON body: ") + e.what()});
+  if (allow_msgpack_ && IsMsgpackRequest(request)) {
+    try {
+      if (!request.RequestBody().empty())
+        request_json = formats::msgpack::FromString(request.RequestBody());
+    } catch (const formats::msgpack::Exception& e) {
+      throw RequestParseError(
+          InternalMessage{"Invalid MessagePack body"},
+          ExternalBody{std::string("Invalid MessagePack body: ") + e.what()});
+    }
+  } else {
+    try {
+      if (!request.RequestBody().empty())
+        request_json = formats::json::FromString(request.RequestBody());
+    } catch (const formats::json::Exception& e) {
+      throw RequestParseError(
+          InternalMessage{"Invalid JSON body"},
+          ExternalBody{std::string("Invalid JSON body: ") + e.what()});
+    }
   }
 
   context.SetData<const formats::json::Value>(kRequestDataName, request_json);
 }
 
 yaml_config::Schema HttpHandlerJsonBase::GetStaticConfigSchema() {
-  auto schema = HttpHandlerBase::GetStaticConfigSchema();
-  schema.UpdateDescription("HTTP handler JSON base config");
-  return schema;
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: HTTP handler JSON base config
+additionalProperties: false
+properties:
+    allow-msgpack:
+        type: boolean
+        description: accept and respond with MessagePack bodies on request
+        defaultDescription: false
+)");
 }
 
 }  // namespace server::handlers
@@ -0,0 +1,130 @@
+#include <server/handlers/http_handler_stage_statistics.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::array<std::string_view, kHttpHandlerStageCount> kStageNames{
+    "check-auth",         "decompress-request", "parse-request",
+    "handle-request",     "serialize-response", "compress-response",
+    "send-response",
+};
+
+template <typename Histogram>
+struct PercentilesHelper final {
+  const Histogram& histogram;
+};
+
+template <typename Histogram>
+void DumpMetric(utils::statistics::Writer& writer,
+                PercentilesHelper<Histogram> helper) {
+  for (const double percent : {0.0, 50.0, 90.0, 95.0, 98.0, 99.0, 99.6, 99.9,
+                               100.0}) {
+    writer.ValueWithLabels(
+        helper.histogram.GetPercentile(percent),
+        {"percentile", utils::statistics::GetPercentileFieldName(percent)});
+  }
+}
+
+std::uint64_t ToMicroseconds(std::chrono::nanoseconds duration) noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+engine::impl::TaskContext& GetCurrentTaskContext() {
+  return engine::current_task::GetCurrentTaskContext();
+}
+
+}  // namespace
+
+std::string_view ToString(HttpHandlerStage stage) noexcept {
+  const auto index = static_cast<std::size_t>(stage);
+  UASSERT(index < kStageNames.size());
+  return kStageNames[index];
+}
+
+void HttpHandlerStageStatistics::AccountStage(
+    HttpHandlerStage stage, std::chrono::nanoseconds timing,
+    std::chrono::nanoseconds cpu_time) noexcept {
+  AccountStageTiming(stage, timing);
+  stages_[static_cast<std::size_t>(stage)]
+      .cpu_time.GetCurrentCounter()
+      .Account(ToMicroseconds(cpu_time));
+}
+
+void HttpHandlerStageStatistics::AccountStageTiming(
+    HttpHandlerStage stage, std::chrono::nanoseconds timing) noexcept {
+  stages_[static_cast<std::size_t>(stage)]
+      .timings.GetCurrentCounter()
+      .Account(ToMicroseconds(timing));
+}
+
+void HttpHandlerStageStatistics::AccountAllocatedBytes(
+    std::uint64_t bytes) noexcept {
+  allocated_bytes_.GetCurrentCounter().Account(bytes);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HttpHandlerStageStatistics& stats) {
+  using Histogram = HttpHandlerStageStatistics::Histogram;
+  for (std::size_t i = 0; i < kHttpHandlerStageCount; ++i) {
+    const auto& stage = stats.stages_[i];
+    const auto timings = stage.timings.GetStatsForPeriod();
+    if (timings.Count() == 0) continue;
+
+    auto stage_writer = writer["stages"];
+    const utils::statistics::LabelView label{"http_stage", kStageNames[i]};
+    stage_writer["timings-us"].ValueWithLabels(
+        PercentilesHelper<Histogram>{timings}, label);
+
+    const auto cpu_time = stage.cpu_time.GetStatsForPeriod();
+    if (cpu_time.Count() != 0) {
+      stage_writer["cpu-time-us"].ValueWithLabels(
+          PercentilesHelper<Histogram>{cpu_time}, label);
+    }
+  }
+
+  const auto allocated_bytes = stats.allocated_bytes_.GetStatsForPeriod();
+  if (allocated_bytes.Count() != 0) {
+    writer["allocated-bytes"] = PercentilesHelper<Histogram>{allocated_bytes};
+  }
+}
+
+HttpHandlerStageScope::HttpHandlerStageScope(HttpHandlerStageStatistics* stats,
+                                             HttpHandlerStage stage)
+    : stats_(stats), stage_(stage) {
+  if (!stats_) return;
+  start_time_ = std::chrono::steady_clock::now();
+  start_cpu_time_ = GetCurrentTaskContext().GetCpuTime();
+}
+
+HttpHandlerStageScope::~HttpHandlerStageScope() {
+  if (!stats_) return;
+  const auto cpu_time = GetCurrentTaskContext().GetCpuTime() - start_cpu_time_;
+  stats_->AccountStage(stage_, std::chrono::steady_clock::now() - start_time_,
+                       cpu_time);
+}
+
+HttpHandlerAllocationScope::HttpHandlerAllocationScope(
+    HttpHandlerStageStatistics* stats)
+    : stats_(stats) {
+  if (!stats_) return;
+  start_allocated_bytes_ = GetCurrentTaskContext().GetAllocatedBytes();
+}
+
+HttpHandlerAllocationScope::~HttpHandlerAllocationScope() {
+  if (!stats_) return;
+  stats_->AccountAllocatedBytes(GetCurrentTaskContext().GetAllocatedBytes() -
+                                start_allocated_bytes_);
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// The stages of the request processing by HttpHandlerBase
+enum class HttpHandlerStage : std::size_t {
+  kCheckAuth,
+  kDecompressRequest,
+  kParseRequest,
+  kHandleRequest,
+  kSerializeResponse,
+  kCompressResponse,
+  kSendResponse,
+};
+
+inline constexpr std::size_t kHttpHandlerStageCount = 7;
+
+std::string_view ToString(HttpHandlerStage stage) noexcept;
+
+// Per-stage timings and CPU time and per-request allocated bytes of
+// a handler, aggregated over all the HTTP methods
+class HttpHandlerStageStatistics final {
+ public:
+  void AccountStage(HttpHandlerStage stage, std::chrono::nanoseconds timing,
+                    std::chrono::nanoseconds cpu_time) noexcept;
+
+  // For the stages that are not executed by the task of the handler
+  void AccountStageTiming(HttpHandlerStage stage,
+                          std::chrono::nanoseconds timing) noexcept;
+
+  void AccountAllocatedBytes(std::uint64_t bytes) noexcept;
+
+ private:
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const HttpHandlerStageStatistics& stats);
+
+  // Up to ~4.8 hours in microseconds or 16GiB in bytes, with 12.5% precision
+  using Histogram = utils::statistics::LogLinearHistogram<3, 34>;
+  using RecentPeriod = utils::statistics::RecentPeriod<
+      Histogram, Histogram, utils::datetime::SteadyCoarseMockableClock>;
+
+  struct Stage final {
+    RecentPeriod timings;
+    RecentPeriod cpu_time;
+  };
+
+  std::array<Stage, kHttpHandlerStageCount> stages_;
+  RecentPeriod allocated_bytes_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HttpHandlerStageStatistics& stats);
+
+// Accounts the wall time and the CPU time of the current task between the
+// construction and the destruction, if `stats` is not nullptr
+class HttpHandlerStageScope final {
+ public:
+  HttpHandlerStageScope(HttpHandlerStageStatistics* stats,
+                        HttpHandlerStage stage);
+
+  HttpHandlerStageScope(const HttpHandlerStageScope&) = delete;
+  HttpHandlerStageScope& operator=(const HttpHandlerStageScope&) = delete;
+
+  ~HttpHandlerStageScope();
+
+ private:
+  HttpHandlerStageStatistics* const stats_;
+  const HttpHandlerStage stage_;
+  std::chrono::steady_clock::time_point start_time_;
+  std::chrono::nanoseconds start_cpu_time_{0};
+};
+
+// Accounts the bytes allocated by the current task during the whole request
+// processing, if `stats` is not nullptr
+class HttpHandlerAllocationScope final {
+ public:
+  explicit HttpHandlerAllocationScope(HttpHandlerStageStatistics* stats);
+
+  HttpHandlerAllocationScope(const HttpHandlerAllocationScope&) = delete;
+  HttpHandlerAllocationScope& operator=(const HttpHandlerAllocationScope&) =
+      delete;
+
+  ~HttpHandlerAllocationScope();
+
+ private:
+  HttpHandlerStageStatistics* const stats_;
+  std::uint64_t start_allocated_bytes_{0};
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
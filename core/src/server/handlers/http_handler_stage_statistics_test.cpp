@@ -0,0 +1,89 @@
+#include <server/handlers/http_handler_stage_statistics.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::HttpHandlerStage;
+using server::handlers::HttpHandlerStageStatistics;
+
+std::uint64_t GetPercentile(const utils::statistics::Snapshot& snapshot,
+                            std::string path, std::string stage,
+                            std::string percentile) {
+  return snapshot
+      .SingleMetric(std::move(path), {{"http_stage", std::move(stage)},
+                                      {"percentile", std::move(percentile)}})
+      .AsInt();
+}
+
+}  // namespace
+
+TEST(HttpHandlerStageStatistics, StageNames) {
+  EXPECT_EQ(ToString(HttpHandlerStage::kCheckAuth), "check-auth");
+  EXPECT_EQ(ToString(HttpHandlerStage::kSendResponse), "send-response");
+}
+
+UTEST(HttpHandlerStageStatistics, Timings) {
+  HttpHandlerStageStatistics stats;
+  stats.AccountStage(HttpHandlerStage::kParseRequest,
+                     std::chrono::microseconds{100},
+                     std::chrono::microseconds{80});
+  stats.AccountStageTiming(HttpHandlerStage::kSendResponse,
+                           std::chrono::milliseconds{5});
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = stats; });
+  const utils::statistics::Snapshot snapshot{storage, "test"};
+
+  // The upper bounds of the buckets with 12.5% precision
+  EXPECT_EQ(GetPercentile(snapshot, "timings-us", "parse-request", "p50"),
+            103);
+  EXPECT_EQ(GetPercentile(snapshot, "cpu-time-us", "parse-request", "p50"),
+            87);
+  EXPECT_EQ(GetPercentile(snapshot, "timings-us", "send-response", "p100"),
+            5119);
+
+  // The wall time of the sending is the only one known
+  EXPECT_ANY_THROW(
+      GetPercentile(snapshot, "cpu-time-us", "send-response", "p50"));
+  // No requests for the stage yet
+  EXPECT_ANY_THROW(GetPercentile(snapshot, "timings-us", "check-auth", "p50"));
+}
+
+UTEST(HttpHandlerStageStatistics, Scopes) {
+  HttpHandlerStageStatistics stats;
+  {
+    const server::handlers::HttpHandlerAllocationScope allocation_scope{
+        &stats};
+    const server::handlers::HttpHandlerStageScope stage_scope{
+        &stats, HttpHandlerStage::kHandleRequest};
+  }
+  {
+    // Disabled statistics
+    const server::handlers::HttpHandlerAllocationScope allocation_scope{
+        nullptr};
+    const server::handlers::HttpHandlerStageScope stage_scope{
+        nullptr, HttpHandlerStage::kCheckAuth};
+  }
+
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = stats; });
+  const utils::statistics::Snapshot snapshot{storage, "test"};
+
+  EXPECT_NO_THROW(
+      GetPercentile(snapshot, "timings-us", "handle-request", "p100"));
+  EXPECT_NO_THROW(
+      GetPercentile(snapshot, "cpu-time-us", "handle-request", "p100"));
+  EXPECT_ANY_THROW(GetPercentile(snapshot, "timings-us", "check-auth", "p50"));
+  EXPECT_NO_THROW(
+      snapshot.SingleMetric("allocated-bytes", {{"percentile", "p100"}}));
+}
+
+USERVER_NAMESPACE_END
@@ -1,11 +1,24 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <compression/compressor.hpp>
+#include <server/handlers/byte_range.hpp>
+#include <server/handlers/response_compressor.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -33,6 +46,48 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>>
 )"},
     };
 
+bool IsRangeApplicable(const http::HttpRequest& request) {
+  return request.GetMethod() == http::HttpMethod::kGet ||
+         request.GetMethod() == http::HttpMethod::kHead;
+}
+
+// Whether the If-None-Match header value lists the ETag
+bool IsETagMatched(std::string_view if_none_match, std::string_view etag) {
+  while (!if_none_match.empty()) {
+    const auto end = if_none_match.find(',');
+    auto element = if_none_match.substr(0, end);
+    if_none_match.remove_prefix(end == std::string_view::npos
+                                    ? if_none_match.size()
+                                    : end + 1);
+
+    const auto begin = element.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) continue;
+    element.remove_prefix(begin);
+    element = element.substr(0, element.find_last_not_of(" \t") + 1);
+    // weak comparison, see RFC 9110 13.1.2
+    if (element.substr(0, 2) == "W/") element.remove_prefix(2);
+    if (element == "*" || element == etag) return true;
+  }
+  return false;
+}
+
+// The precompressed variant of the file acceptable for the request, if any
+std::optional<compression::Algorithm> NegotiatePrecompressed(
+    const http::HttpRequest& request, const fs::FileInfoWithData& file) {
+  std::vector<compression::Algorithm> algorithms;
+  if (!file.brotli_data.empty()) {
+    algorithms.push_back(compression::Algorithm::kBrotli);
+  }
+  if (!file.gzip_data.empty()) {
+    algorithms.push_back(compression::Algorithm::kGzip);
+  }
+  if (algorithms.empty()) return std::nullopt;
+
+  return NegotiateContentEncoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+      algorithms);
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -50,14 +105,86 @@ std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
   const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
-    const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+  if (!file) {
+    request.GetResponse().SetStatusNotFound();
+    return "File not found";
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+
+  auto& response = request.GetHttpResponse();
+  const auto config = config_.GetSnapshot();
+  response.SetContentType(config[kContentTypeMap][file->extension]);
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptRanges,
+                     std::string{"bytes"});
+
+  const auto& range_header =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kRange);
+  std::optional<compression::Algorithm> encoding;
+  if (range_header.empty()) {
+    encoding = NegotiatePrecompressed(request, *file);
+    if (!file->gzip_data.empty() || !file->brotli_data.empty()) {
+      response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                         std::string{"Accept-Encoding"});
+    }
+  }
+
+  if (!file->etag.empty()) {
+    // each encoding is a different representation with its own ETag
+    auto etag = file->etag;
+    if (encoding) {
+      etag.insert(etag.size() - 1,
+                  "-" + std::string{compression::ToContentEncoding(*encoding)});
+    }
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, etag);
+    if (IsETagMatched(request.GetHeader(
+                          USERVER_NAMESPACE::http::headers::kIfNoneMatch),
+                      etag)) {
+      response.SetStatus(http::HttpStatus::kNotModified);
+      return {};
+    }
+  }
+
+  if (encoding) {
+    response.SetContentEncoding(
+        std::string{compression::ToContentEncoding(*encoding)});
+    return *encoding == compression::Algorithm::kBrotli ? file->brotli_data
+                                                        : file->gzip_data;
+  }
+
+  auto range = ByteRange{ByteRange::Kind::kWhole, 0, file->size};
+  if (IsRangeApplicable(request)) {
+    range = ParseByteRange(range_header, file->size);
+  }
+  switch (range.kind) {
+    case ByteRange::Kind::kWhole:
+      break;
+    case ByteRange::Kind::kUnsatisfiable:
+      response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+      response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                         fmt::format("bytes */{}", file->size));
+      return {};
+    case ByteRange::Kind::kPartial:
+      response.SetStatus(http::HttpStatus::kPartialContent);
+      response.SetHeader(
+          USERVER_NAMESPACE::http::headers::kContentRange,
+          fmt::format("bytes {}-{}/{}", range.offset,
+                      range.offset + range.size - 1, file->size));
+      break;
+  }
+
+  if (file->is_data_loaded) {
+    if (range.kind == ByteRange::Kind::kWhole) return file->data;
+    return file->data.substr(range.offset, range.size);
+  }
+
+  auto& fs_task_processor = storage_.GetTaskProcessor();
+  auto descriptor = engine::AsyncNoSpan(fs_task_processor, [&file] {
+                      return fs::blocking::FileDescriptor::Open(
+                          file->path, fs::blocking::OpenFlag::kRead);
+                    }).Get();
+  response.SetFileBody(std::make_shared<const fs::blocking::FileDescriptor>(
+                           std::move(descriptor)),
+                       range.offset, range.size, fs_task_processor);
+  return {};
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -65,7 +192,8 @@ yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
 type: object
 description: |
     Handler that returns HTTP 200 if file exist
-    and returns file data with mapped content/type
+    and returns file data with mapped content/type,
+    single byte ranges are served with HTTP 206
 additionalProperties: false
 properties:
     fs-cache-component:
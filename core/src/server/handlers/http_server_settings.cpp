@@ -33,6 +33,9 @@ const dynamic_config::Key<CcCustomStatus> kCcCustomStatus{
 const dynamic_config::Key<bool> kStreamApiEnabled{
     "USERVER_HANDLER_STREAM_API_ENABLED", false};
 
+const dynamic_config::Key<std::size_t> kInspectRequestsSampleRate{
+    "USERVER_INSPECT_REQUESTS_SAMPLE_RATE", 1};
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
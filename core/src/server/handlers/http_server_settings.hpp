@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -27,6 +28,8 @@ extern const dynamic_config::Key<CcCustomStatus> kCcCustomStatus;
 
 extern const dynamic_config::Key<bool> kStreamApiEnabled;
 
+extern const dynamic_config::Key<std::size_t> kInspectRequestsSampleRate;
+
 }  // namespace server::handlers
 
 USERVER_NAMESPACE_END
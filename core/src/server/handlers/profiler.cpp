@@ -0,0 +1,131 @@
+#include <userver/server/handlers/profiler.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/components/component_config.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <compression/compressor.hpp>
+#include <utils/pprof/contention_profiler.hpp>
+#include <utils/pprof/cpu_profiler.hpp>
+#include <utils/pprof/heap_profile.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::chrono::seconds kDefaultDuration{30};
+constexpr std::chrono::seconds kDefaultMaxDuration{60};
+constexpr int kDefaultFrequency = 99;
+constexpr int kMaxFrequency = 1000;
+constexpr int kGzipLevel = 6;
+
+template <typename T>
+T ParseArg(const http::HttpRequest& request, std::string_view name, T min,
+           T max) {
+  const auto& value = request.GetArg(name);
+  try {
+    const auto result = utils::FromString<T>(value);
+    if (result >= min && result <= max) return result;
+  } catch (const std::exception&) {
+    // Reported below
+  }
+  throw ClientError(ExternalBody{
+      fmt::format("Invalid '{}' value '{}', expected an integer in [{}, {}]",
+                  name, value, min, max)});
+}
+
+std::string GetHeapProfile(std::optional<std::chrono::seconds> duration) {
+  try {
+    const auto base = utils::pprof::DumpJemallocHeapProfile();
+    if (!duration) return utils::pprof::SerializeHeapProfile(base);
+
+    engine::InterruptibleSleepFor(*duration);
+    const auto current = utils::pprof::DumpJemallocHeapProfile();
+    return utils::pprof::SerializeHeapProfile(
+        utils::pprof::GetDelta(current, base), current.time - base.time);
+  } catch (const std::system_error& e) {
+    throw InternalServerError(ExternalBody{fmt::format(
+        "Failed to dump the jemalloc heap profile, make sure that the service "
+        "is started with MALLOC_CONF=prof:true: {}",
+        e.what())});
+  }
+}
+
+}  // namespace
+
+Profiler::Profiler(const components::ComponentConfig& config,
+                   const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      max_duration_(config["max-duration"].As<std::chrono::seconds>(
+          kDefaultMaxDuration)) {}
+
+std::string Profiler::HandleRequestThrow(const http::HttpRequest& request,
+                                         request::RequestContext&) const {
+  const auto& type = request.GetPathArg("type");
+  std::optional<std::chrono::seconds> duration;
+  if (request.HasArg("seconds")) {
+    duration = std::chrono::seconds{ParseArg<std::int64_t>(
+        request, "seconds", 1, max_duration_.count())};
+  }
+  const auto sampling_duration =
+      duration.value_or(std::min(kDefaultDuration, max_duration_));
+
+  std::string profile;
+  try {
+    if (type == "cpu") {
+      const auto frequency =
+          request.HasArg("frequency")
+              ? ParseArg<int>(request, "frequency", 1, kMaxFrequency)
+              : kDefaultFrequency;
+      profile = utils::pprof::CollectCpuProfile(sampling_duration, frequency);
+    } else if (type == "heap") {
+      profile = GetHeapProfile(duration);
+    } else if (type == "contention") {
+      profile = utils::pprof::CollectContentionProfile(sampling_duration);
+    } else {
+      throw ClientError(ExternalBody{fmt::format(
+          "Unknown profile type '{}', expected one of: cpu, heap, contention",
+          type)});
+    }
+  } catch (const utils::pprof::ProfilerBusyError& e) {
+    throw ConflictError(ExternalBody{e.what()});
+  }
+
+  auto& response = request.GetHttpResponse();
+  response.SetContentType(
+      USERVER_NAMESPACE::http::content_type::kApplicationOctetStream);
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kContentDisposition,
+                     fmt::format("attachment; filename=\"{}.pb.gz\"", type));
+  return compression::Compress(compression::Algorithm::kGzip, profile,
+                               kGzipLevel);
+}
+
+yaml_config::Schema Profiler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-profiler config
+additionalProperties: false
+properties:
+    max-duration:
+        type: string
+        description: max value of the `seconds` argument
+        defaultDescription: 60s
+)");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
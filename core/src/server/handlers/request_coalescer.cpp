@@ -0,0 +1,134 @@
+#include <server/handlers/request_coalescer.hpp>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+// The parts are length-prefixed, so that no value can imitate a separator
+void AppendKeyPart(std::string& key, std::string_view part) {
+  key += std::to_string(part.size());
+  key += ':';
+  key += part;
+}
+
+}  // namespace
+
+struct RequestCoalescer::Response {
+  http::HttpStatus status{http::HttpStatus::kOk};
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::vector<http::Cookie> cookies;
+  std::string data;
+};
+
+RequestCoalescer::RequestCoalescer(RequestCoalescingConfig config)
+    : config_(std::move(config)) {}
+
+RequestCoalescer::~RequestCoalescer() = default;
+
+std::string RequestCoalescer::Handle(
+    const http::HttpRequest& request,
+    utils::function_ref<std::string()> handle) const {
+  if (!IsCoalescible(request)) return handle();
+
+  auto& response = request.GetHttpResponse();
+  const auto key = MakeKey(request);
+  engine::SharedTaskWithResult<SharedResponse> task;
+  bool is_leader = false;
+  {
+    const std::lock_guard lock(mutex_);
+    auto& in_flight = in_flight_[key];
+    if (!in_flight.IsValid()) {
+      // Critical, as the leader relies on the handler to be run
+      in_flight = utils::SharedCriticalAsync(
+          "http_coalesced_request", [&handle, &response] {
+            auto data = handle();
+
+            auto result = std::make_shared<Response>();
+            result->status = response.GetStatus();
+            for (const auto& name : response.GetHeaderNames()) {
+              result->headers.emplace_back(name, response.GetHeader(name));
+            }
+            for (const auto& name : response.GetCookieNames()) {
+              result->cookies.push_back(response.GetCookie(name));
+            }
+            result->data = std::move(data);
+            return SharedResponse{std::move(result)};
+          });
+      is_leader = true;
+    }
+    task = in_flight;
+  }
+
+  if (is_leader) {
+    {
+      // The task refers to the request, it must finish before the request
+      const engine::TaskCancellationBlocker cancel_blocker;
+      task.Wait();
+    }
+    {
+      const std::lock_guard lock(mutex_);
+      in_flight_.erase(key);
+    }
+    // The headers are already set by the handler
+    return task.Get()->data;
+  }
+
+  // Rethrows the exception of the leader, so that the followers get the
+  // same error response instead of hitting the failing backend again
+  const auto result = task.Get();
+
+  response.SetStatus(result->status);
+  for (const auto& [name, value] : result->headers) {
+    response.SetHeader(std::string_view{name}, value);
+  }
+  for (const auto& cookie : result->cookies) {
+    response.SetCookie(cookie);
+  }
+  return result->data;
+}
+
+bool RequestCoalescer::IsCoalescible(const http::HttpRequest& request) const {
+  const auto method = request.GetMethod();
+  return (method == http::HttpMethod::kGet ||
+          method == http::HttpMethod::kHead) &&
+         !request.GetHttpResponse().IsBodyStreamed();
+}
+
+std::string RequestCoalescer::MakeKey(const http::HttpRequest& request) const {
+  std::string key;
+  AppendKeyPart(key, request.GetMethodStr());
+  if (!config_.args) {
+    AppendKeyPart(key, request.GetUrl());
+  } else {
+    AppendKeyPart(key, request.GetRequestPath());
+    for (const auto& arg : *config_.args) {
+      const auto& values = request.GetArgVector(arg);
+      AppendKeyPart(key, std::to_string(values.size()));
+      for (const auto& value : values) AppendKeyPart(key, value);
+    }
+  }
+  // The requests of different users never share a response
+  namespace headers = USERVER_NAMESPACE::http::headers;
+  AppendKeyPart(key, request.GetHeader(headers::kAuthorization));
+  AppendKeyPart(key, request.GetHeader(headers::kProxyAuthorization));
+  AppendKeyPart(key, request.GetHeader(headers::kCookie));
+  for (const auto& header : config_.headers) {
+    AppendKeyPart(key, request.GetHeader(header));
+  }
+  return key;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
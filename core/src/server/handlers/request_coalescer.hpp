@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// Runs the handler once for the concurrent identical idempotent requests
+/// according to the `request-coalescing` static config option of the handler.
+///
+/// The first request of a kind becomes the leader, its handler runs in a
+/// separate task, so that the cancellation of the leader does not affect the
+/// other requests. The followers wait for the leader and copy the status,
+/// headers, cookies and data of its response. If the handler of the leader
+/// throws, the followers rethrow the same exception. The requests with
+/// different Authorization, Proxy-Authorization or Cookie headers are never
+/// coalesced.
+class RequestCoalescer final {
+ public:
+  explicit RequestCoalescer(RequestCoalescingConfig config);
+  ~RequestCoalescer();
+
+  /// Returns the data of the response to the `request`, `handle` is called to
+  /// get it unless an identical request is in flight
+  std::string Handle(const http::HttpRequest& request,
+                     utils::function_ref<std::string()> handle) const;
+
+ private:
+  struct Response;
+  using SharedResponse = std::shared_ptr<const Response>;
+
+  bool IsCoalescible(const http::HttpRequest& request) const;
+  std::string MakeKey(const http::HttpRequest& request) const;
+
+  const RequestCoalescingConfig config_;
+  mutable engine::Mutex mutex_;
+  mutable std::unordered_map<std::string,
+                             engine::SharedTaskWithResult<SharedResponse>>
+      in_flight_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,162 @@
+#include <server/handlers/request_coalescer.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <server/http/create_parser_test.hpp>
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::shared_ptr<server::request::RequestBase> Parse(std::string_view data) {
+  std::shared_ptr<server::request::RequestBase> result;
+  auto parser = server::CreateTestParser(
+      [&result](std::shared_ptr<server::request::RequestBase>&& request) {
+        result = std::move(request);
+      });
+  EXPECT_TRUE(parser.Parse(data.data(), data.size()));
+  return result;
+}
+
+server::http::HttpRequest Wrap(
+    const std::shared_ptr<server::request::RequestBase>& request) {
+  return server::http::HttpRequest{
+      dynamic_cast<server::http::HttpRequestImpl&>(*request)};
+}
+
+}  // namespace
+
+UTEST(RequestCoalescer, IdenticalRequests) {
+  const server::handlers::RequestCoalescer coalescer{{}};
+  const auto leader = Parse("GET /a?x=1 HTTP/1.1\r\n\r\n");
+  const auto follower = Parse("GET /a?x=1 HTTP/1.1\r\n\r\n");
+  const auto other = Parse("GET /a?x=2 HTTP/1.1\r\n\r\n");
+
+  std::atomic<int> calls{0};
+  engine::SingleConsumerEvent release_1;
+  engine::SingleConsumerEvent release_2;
+  const auto handle = [&](const server::http::HttpRequest& request) {
+    ++calls;
+    auto& release = request.GetArg("x") == "1" ? release_1 : release_2;
+    EXPECT_TRUE(release.WaitForEvent());
+    request.GetHttpResponse().SetStatus(server::http::HttpStatus::kCreated);
+    request.GetHttpResponse().SetHeader(std::string_view{"X-Handled"},
+                                        request.GetArg("x"));
+    return "data" + request.GetArg("x");
+  };
+  const auto run = [&](const std::shared_ptr<server::request::RequestBase>&
+                           request) {
+    return engine::AsyncNoSpan([&, request] {
+      const auto http_request = Wrap(request);
+      return coalescer.Handle(http_request,
+                              [&] { return handle(http_request); });
+    });
+  };
+
+  auto leader_task = run(leader);
+  engine::Yield();
+  auto follower_task = run(follower);
+  auto other_task = run(other);
+  // The follower joins the leader before the other request is handled
+  while (calls < 2) engine::Yield();
+
+  release_1.Send();
+  EXPECT_EQ(leader_task.Get(), "data1");
+  EXPECT_EQ(follower_task.Get(), "data1");
+  EXPECT_EQ(calls, 2);
+
+  const auto follower_request = Wrap(follower);
+  EXPECT_EQ(follower_request.GetHttpResponse().GetStatus(),
+            server::http::HttpStatus::kCreated);
+  EXPECT_EQ(follower_request.GetHttpResponse().GetHeader("X-Handled"), "1");
+
+  release_2.Send();
+  EXPECT_EQ(other_task.Get(), "data2");
+}
+
+UTEST(RequestCoalescer, FollowerGetsLeaderError) {
+  const server::handlers::RequestCoalescer coalescer{{}};
+  const auto leader = Parse("GET /a HTTP/1.1\r\n\r\n");
+  const auto follower = Parse("GET /a HTTP/1.1\r\n\r\n");
+
+  int calls = 0;
+  engine::SingleConsumerEvent release;
+  auto leader_task = engine::AsyncNoSpan([&] {
+    return coalescer.Handle(Wrap(leader), [&]() -> std::string {
+      ++calls;
+      EXPECT_TRUE(release.WaitForEvent());
+      throw std::runtime_error("leader failed");
+    });
+  });
+  while (calls < 1) engine::Yield();
+  auto follower_task = engine::AsyncNoSpan([&] {
+    return coalescer.Handle(Wrap(follower), [&] {
+      ++calls;
+      return std::string{"follower"};
+    });
+  });
+  engine::Yield();
+
+  release.Send();
+  UEXPECT_THROW_MSG(leader_task.Get(), std::runtime_error, "leader failed");
+  UEXPECT_THROW_MSG(follower_task.Get(), std::runtime_error, "leader failed");
+  EXPECT_EQ(calls, 1);
+}
+
+UTEST(RequestCoalescer, DifferentCredentials) {
+  const server::handlers::RequestCoalescer coalescer{{}};
+  const std::vector<std::shared_ptr<server::request::RequestBase>> requests{
+      Parse("GET /a HTTP/1.1\r\nAuthorization: Bearer 1\r\n\r\n"),
+      Parse("GET /a HTTP/1.1\r\nAuthorization: Bearer 2\r\n\r\n"),
+      Parse("GET /a HTTP/1.1\r\nCookie: session=1\r\n\r\n"),
+      Parse("GET /a HTTP/1.1\r\n\r\n"),
+  };
+
+  std::atomic<std::size_t> calls{0};
+  std::vector<engine::SingleConsumerEvent> releases(requests.size());
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&, i] {
+      return coalescer.Handle(Wrap(requests[i]), [&] {
+        ++calls;
+        EXPECT_TRUE(releases[i].WaitForEvent());
+        return std::string{"data"};
+      });
+    }));
+  }
+  // Each request runs its own handler
+  while (calls < requests.size()) engine::Yield();
+
+  for (auto& release : releases) release.Send();
+  for (auto& task : tasks) EXPECT_EQ(task.Get(), "data");
+  EXPECT_EQ(calls, requests.size());
+}
+
+UTEST(RequestCoalescer, NotIdempotent) {
+  const server::handlers::RequestCoalescer coalescer{{}};
+  const auto request = Parse("POST /a HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+
+  int calls = 0;
+  const auto http_request = Wrap(request);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(coalescer.Handle(http_request,
+                               [&] {
+                                 ++calls;
+                                 return std::string{"data"};
+                               }),
+              "data");
+  }
+  EXPECT_EQ(calls, 2);
+}
+
+USERVER_NAMESPACE_END
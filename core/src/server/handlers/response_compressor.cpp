@@ -0,0 +1,209 @@
+#include <server/handlers/response_compressor.hpp>
+
+#include <array>
+
+#include <userver/engine/async.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+constexpr std::string_view kWhitespace = " \t";
+constexpr std::size_t kAlgorithmsCount = 2;
+// Quality values are stored in thousandths, see RFC 9110 12.4.2
+constexpr int kMaxQuality = 1000;
+
+std::string_view Trim(std::string_view str) {
+  const auto begin = str.find_first_not_of(kWhitespace);
+  if (begin == std::string_view::npos) return {};
+  const auto end = str.find_last_not_of(kWhitespace);
+  return str.substr(begin, end - begin + 1);
+}
+
+std::optional<int> ParseQuality(std::string_view str) {
+  if (str.empty() || (str[0] != '0' && str[0] != '1')) return std::nullopt;
+  int quality = (str[0] - '0') * kMaxQuality;
+  str.remove_prefix(1);
+  if (str.empty()) return quality;
+  if (str[0] != '.' || str.size() > 4) return std::nullopt;
+
+  int multiplier = kMaxQuality / 10;
+  for (const char c : str.substr(1)) {
+    if (c < '0' || c > '9') return std::nullopt;
+    quality += (c - '0') * multiplier;
+    multiplier /= 10;
+  }
+  if (quality > kMaxQuality) return std::nullopt;
+  return quality;
+}
+
+std::size_t ToIndex(compression::Algorithm algorithm) {
+  const auto index = static_cast<std::size_t>(algorithm);
+  UASSERT(index < kAlgorithmsCount);
+  return index;
+}
+
+bool IsCompressible(const http::HttpResponse& response) {
+  const auto status = static_cast<int>(response.GetStatus());
+  if (status < 200 || status == 204 || status == 304) return false;
+  return !response.HasHeader(headers::kContentEncoding) &&
+         !response.HasHeader(headers::kContentRange);
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+  constexpr std::string_view kAcceptEncoding = "Accept-Encoding";
+  const auto& vary = response.GetHeader(headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(headers::kVary, std::string{kAcceptEncoding});
+  } else if (!utils::StrIcaseEqual{}(vary, kAcceptEncoding)) {
+    response.SetHeader(headers::kVary,
+                       vary + ", " + std::string{kAcceptEncoding});
+  }
+}
+
+template <typename Function>
+auto RunOn(engine::TaskProcessor* task_processor, Function&& function) {
+  if (!task_processor) return function();
+  return engine::AsyncNoSpan(*task_processor, std::forward<Function>(function))
+      .Get();
+}
+
+}  // namespace
+
+std::optional<compression::Algorithm> NegotiateContentEncoding(
+    std::string_view accept_encoding,
+    const std::vector<compression::Algorithm>& algorithms) {
+  std::array<std::optional<int>, kAlgorithmsCount> qualities{};
+  std::optional<int> any_quality;
+
+  while (!accept_encoding.empty()) {
+    const auto element_end = accept_encoding.find(',');
+    auto element = accept_encoding.substr(0, element_end);
+    accept_encoding.remove_prefix(element_end == std::string_view::npos
+                                      ? accept_encoding.size()
+                                      : element_end + 1);
+
+    const auto params_begin = element.find(';');
+    const auto coding = Trim(element.substr(0, params_begin));
+    if (coding.empty()) continue;
+
+    std::optional<int> quality = kMaxQuality;
+    if (params_begin != std::string_view::npos) {
+      const auto param = Trim(element.substr(params_begin + 1));
+      if (param.size() < 2 || (param[0] != 'q' && param[0] != 'Q') ||
+          param[1] != '=') {
+        continue;
+      }
+      quality = ParseQuality(Trim(param.substr(2)));
+      if (!quality) continue;
+    }
+
+    if (coding == "*") {
+      any_quality = quality;
+      continue;
+    }
+    for (const auto algorithm : algorithms) {
+      if (utils::StrIcaseEqual{}(coding,
+                                 compression::ToContentEncoding(algorithm))) {
+        qualities[ToIndex(algorithm)] = quality;
+      }
+    }
+  }
+
+  std::optional<compression::Algorithm> result;
+  int best_quality = 0;
+  for (const auto algorithm : algorithms) {
+    const auto quality =
+        qualities[ToIndex(algorithm)].value_or(any_quality.value_or(0));
+    if (quality > best_quality) {
+      best_quality = quality;
+      result = algorithm;
+    }
+  }
+  return result;
+}
+
+ResponseCompressor::ResponseCompressor(const ResponseCompressionConfig& config,
+                                       engine::TaskProcessor* task_processor)
+    : min_size_(config.min_size),
+      gzip_level_(config.gzip_level),
+      brotli_level_(config.brotli_level),
+      task_processor_(task_processor) {
+  for (const auto& encoding : config.encodings) {
+    const auto algorithm = compression::AlgorithmFromContentEncoding(encoding);
+    UINVARIANT(algorithm, "Encodings are validated at config parsing");
+    algorithms_.push_back(*algorithm);
+  }
+
+  // Fail on startup rather than on the first request
+  for (const auto algorithm : algorithms_) {
+    compression::MakeStreamCompressor(algorithm, GetLevel(algorithm));
+  }
+}
+
+void ResponseCompressor::Compress(const http::HttpRequest& request,
+                                  http::HttpResponse& response) const {
+  if (response.IsBodyStreamed() || response.IsFileBody() ||
+      response.GetData().size() < min_size_) {
+    return;
+  }
+  const auto algorithm = Negotiate(request, response);
+  if (!algorithm) return;
+
+  const tracing::ScopeTime scope_time{"http_compress_response"};
+  const auto& data = response.GetData();
+  auto compressed = RunOn(task_processor_, [this, &data, algorithm] {
+    return compression::Compress(*algorithm, data, GetLevel(*algorithm));
+  });
+  if (compressed.size() >= data.size()) {
+    LOG_TRACE() << "Compressed response is not smaller than the original one";
+    return;
+  }
+
+  response.SetData(std::move(compressed));
+  response.SetContentEncoding(
+      std::string{compression::ToContentEncoding(*algorithm)});
+}
+
+std::unique_ptr<compression::StreamCompressor> ResponseCompressor::StartStream(
+    const http::HttpRequest& request, http::HttpResponse& response) const {
+  const auto algorithm = Negotiate(request, response);
+  if (!algorithm) return nullptr;
+
+  response.SetContentEncoding(
+      std::string{compression::ToContentEncoding(*algorithm)});
+  return compression::MakeStreamCompressor(*algorithm, GetLevel(*algorithm));
+}
+
+std::optional<compression::Algorithm> ResponseCompressor::Negotiate(
+    const http::HttpRequest& request, http::HttpResponse& response) const {
+  if (!IsCompressible(response)) return std::nullopt;
+
+  // The response depends on the Accept-Encoding even if it is not compressed
+  AddVaryAcceptEncoding(response);
+  return NegotiateContentEncoding(request.GetHeader(headers::kAcceptEncoding),
+                                  algorithms_);
+}
+
+int ResponseCompressor::GetLevel(compression::Algorithm algorithm) const {
+  switch (algorithm) {
+    case compression::Algorithm::kGzip:
+      return gzip_level_;
+    case compression::Algorithm::kBrotli:
+      return brotli_level_;
+  }
+  UINVARIANT(false, "Unexpected compression algorithm");
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+
+#include <compression/compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+/// Returns the first of the `algorithms` with the highest quality value in the
+/// Accept-Encoding header value, or std::nullopt if none is acceptable
+std::optional<compression::Algorithm> NegotiateContentEncoding(
+    std::string_view accept_encoding,
+    const std::vector<compression::Algorithm>& algorithms);
+
+/// Compresses the responses of a handler according to its
+/// `response-compression` static config option
+class ResponseCompressor final {
+ public:
+  ResponseCompressor(const ResponseCompressionConfig& config,
+                     engine::TaskProcessor* task_processor);
+
+  /// Compresses the data of a non-streamed response if the client accepts
+  /// one of the encodings
+  void Compress(const http::HttpRequest& request,
+                http::HttpResponse& response) const;
+
+  /// Sets the headers of a streamed response and returns the compressor for
+  /// its body, if the client accepts one of the encodings
+  std::unique_ptr<compression::StreamCompressor> StartStream(
+      const http::HttpRequest& request, http::HttpResponse& response) const;
+
+  /// The task processor to compress on, nullptr for the current one
+  engine::TaskProcessor* GetTaskProcessor() const { return task_processor_; }
+
+ private:
+  std::optional<compression::Algorithm> Negotiate(
+      const http::HttpRequest& request, http::HttpResponse& response) const;
+  int GetLevel(compression::Algorithm algorithm) const;
+
+  std::vector<compression::Algorithm> algorithms_;
+  const std::size_t min_size_;
+  const int gzip_level_;
+  const int brotli_level_;
+  engine::TaskProcessor* const task_processor_;
+};
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
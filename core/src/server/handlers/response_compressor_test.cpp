@@ -0,0 +1,139 @@
+#include <server/handlers/response_compressor.hpp>
+
+#include <string>
+
+#include <userver/utest/utest.hpp>
+
+#include <compression/gzip.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using compression::Algorithm;
+
+const std::vector<Algorithm> kBrotliThenGzip{Algorithm::kBrotli,
+                                             Algorithm::kGzip};
+
+std::string MakeData() {
+  std::string data;
+  for (int i = 0; i < 10'000; ++i) {
+    data += "{\"key\":" + std::to_string(i) + "}";
+  }
+  return data;
+}
+
+// Feeds the data to the decompressor in small chunks
+std::string Decompress(Algorithm algorithm, std::string_view compressed) {
+  constexpr std::size_t kChunkSize = 100;
+  auto decompressor = compression::MakeStreamDecompressor(algorithm);
+  std::string data;
+  while (!compressed.empty()) {
+    const auto chunk = compressed.substr(0, kChunkSize);
+    compressed.remove_prefix(chunk.size());
+    decompressor->Decompress(chunk, data, std::string::npos);
+  }
+  decompressor->Finish();
+  return data;
+}
+
+}  // namespace
+
+TEST(ResponseCompression, Negotiate) {
+  using server::handlers::NegotiateContentEncoding;
+
+  EXPECT_EQ(NegotiateContentEncoding("", kBrotliThenGzip), std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("identity", kBrotliThenGzip),
+            std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("gzip", kBrotliThenGzip),
+            Algorithm::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("gzip, deflate, br", kBrotliThenGzip),
+            Algorithm::kBrotli);
+  EXPECT_EQ(NegotiateContentEncoding("GZIP, br;q=0.5", kBrotliThenGzip),
+            Algorithm::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("br;q=0, gzip;q=0.001", kBrotliThenGzip),
+            Algorithm::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("*", kBrotliThenGzip), Algorithm::kBrotli);
+  EXPECT_EQ(NegotiateContentEncoding("br;q=0, *;q=0.3", kBrotliThenGzip),
+            Algorithm::kGzip);
+  EXPECT_EQ(NegotiateContentEncoding("gzip;q=2, br;q=x", kBrotliThenGzip),
+            std::nullopt);
+  EXPECT_EQ(NegotiateContentEncoding("br", {Algorithm::kGzip}), std::nullopt);
+}
+
+TEST(ResponseCompression, GzipRoundTrip) {
+  const auto data = MakeData();
+  const auto compressed = compression::Compress(Algorithm::kGzip, data, 6);
+  EXPECT_LT(compressed.size(), data.size());
+  EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+}
+
+TEST(ResponseCompression, GzipStream) {
+  using Flush = compression::StreamCompressor::Flush;
+  const auto data = MakeData();
+  auto compressor = compression::MakeStreamCompressor(Algorithm::kGzip, 1);
+
+  std::string compressed;
+  const auto half = data.size() / 2;
+  compressed += compressor->Compress(data.substr(0, half), Flush::kSync);
+  compressed += compressor->Compress(data.substr(half), Flush::kSync);
+  compressed += compressor->Compress({}, Flush::kFinish);
+  EXPECT_EQ(compression::gzip::Decompress(compressed, data.size()), data);
+}
+
+#ifndef USERVER_NO_BROTLI
+TEST(ResponseCompression, Brotli) {
+  const auto data = MakeData();
+  const auto compressed = compression::Compress(Algorithm::kBrotli, data, 4);
+  EXPECT_FALSE(compressed.empty());
+  EXPECT_LT(compressed.size(), data.size());
+  EXPECT_EQ(Decompress(Algorithm::kBrotli, compressed), data);
+}
+
+TEST(ResponseCompression, BrotliStreamRoundTrip) {
+  using Flush = compression::StreamCompressor::Flush;
+  const auto data = MakeData();
+  auto compressor = compression::MakeStreamCompressor(Algorithm::kBrotli, 4);
+
+  std::string compressed;
+  const auto half = data.size() / 2;
+  compressed += compressor->Compress(data.substr(0, half), Flush::kSync);
+  // Everything before the sync flush is decodable on its own
+  auto decompressor = compression::MakeStreamDecompressor(Algorithm::kBrotli);
+  std::string decompressed;
+  decompressor->Decompress(compressed, decompressed, std::string::npos);
+  EXPECT_EQ(decompressed, data.substr(0, half));
+
+  compressed += compressor->Compress(data.substr(half), Flush::kFinish);
+  EXPECT_EQ(Decompress(Algorithm::kBrotli, compressed), data);
+}
+
+TEST(ResponseCompression, BrotliMalformed) {
+  EXPECT_THROW(Decompress(Algorithm::kBrotli, "not compressed"),
+               compression::DecompressionError);
+
+  const auto compressed =
+      compression::Compress(Algorithm::kBrotli, MakeData(), 4);
+  EXPECT_THROW(Decompress(Algorithm::kBrotli,
+                          std::string_view{compressed}.substr(
+                              0, compressed.size() / 2)),
+               compression::DecompressionError);
+}
+#else
+TEST(ResponseCompression, BrotliDisabled) {
+  EXPECT_EQ(compression::AlgorithmFromContentEncoding("br"), std::nullopt);
+  EXPECT_THROW(compression::MakeStreamCompressor(Algorithm::kBrotli, 4),
+               compression::CompressionError);
+}
+#endif
+
+TEST(ResponseCompression, InvalidLevel) {
+  EXPECT_THROW(compression::MakeStreamCompressor(Algorithm::kGzip, 10),
+               compression::CompressionError);
+#ifndef USERVER_NO_BROTLI
+  EXPECT_THROW(compression::MakeStreamCompressor(Algorithm::kBrotli, 12),
+               compression::CompressionError);
+#endif
+}
+
+USERVER_NAMESPACE_END
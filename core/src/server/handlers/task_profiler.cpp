@@ -0,0 +1,86 @@
+#include <userver/server/handlers/task_profiler.hpp>
+
+#include <limits>
+
+#include <components/manager.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+std::size_t ParseLimit(const http::HttpRequest& request) {
+  const auto& limit = request.GetArg("limit");
+  if (limit.empty()) return std::numeric_limits<std::size_t>::max();
+
+  try {
+    return utils::FromString<std::size_t>(limit);
+  } catch (const std::exception& ex) {
+    throw ClientError(ExternalBody{std::string{"invalid 'limit' value: "} +
+                                   ex.what()});
+  }
+}
+
+}  // namespace
+
+TaskProfiler::TaskProfiler(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerJsonBase(config, component_context, /*is_monitor = */ true),
+      manager_(component_context.GetManager()) {}
+
+formats::json::Value TaskProfiler::HandleRequestJsonThrow(
+    const http::HttpRequest& request, const formats::json::Value&,
+    request::RequestContext&) const {
+  const auto& task_processors = manager_.GetTaskProcessorsMap();
+
+  if (request.GetMethod() == http::HttpMethod::kDelete) {
+    for (const auto& [name, task_processor] : task_processors) {
+      if (auto* profiler = task_processor->GetTaskProfiler()) {
+        profiler->Reset();
+      }
+    }
+    return formats::json::MakeObject();
+  }
+
+  const auto limit = ParseLimit(request);
+
+  formats::json::ValueBuilder result(formats::json::Type::kObject);
+  for (const auto& [name, task_processor] : task_processors) {
+    const auto* profiler = task_processor->GetTaskProfiler();
+    if (!profiler) continue;
+
+    formats::json::ValueBuilder records(formats::json::Type::kArray);
+    for (const auto& [span_name, stats] : profiler->GetStatsSinceReset()) {
+      if (records.GetSize() >= limit) break;
+
+      formats::json::ValueBuilder record(formats::json::Type::kObject);
+      record["span_name"] = span_name;
+      record["tasks"] = stats.tasks;
+      record["cpu-time-us"] = stats.cpu_time_us;
+      record["context-switches"] = stats.context_switches;
+      record["queue-wait-us"] = stats.queue_wait_us;
+      records.PushBack(std::move(record));
+    }
+    result[name] = std::move(records);
+  }
+
+  return result.ExtractValue();
+}
+
+yaml_config::Schema TaskProfiler::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-task-profiler config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
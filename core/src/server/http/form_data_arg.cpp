@@ -27,6 +27,7 @@ std::string FormDataArg::ToDebugString() const {
   os << ", content_disposition='" << content_disposition << '\'';
   if (filename) os << ", filename=" << *filename;
   if (content_type) os << ", content_type=" << *content_type;
+  if (file_path) os << ", file_path=" << *file_path;
   os << ", charset=" << Charset();
   return os.str();
 }
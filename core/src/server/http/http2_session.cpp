@@ -0,0 +1,571 @@
+#include <server/http/http2_session.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+#include <nghttp2/nghttp2.h>
+
+#include <server/http/http_cached_date.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/http/static_headers.hpp>
+#include <userver/engine/io/common.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kDefaultContentType = "application/octet-stream";
+
+// Forbidden in HTTP/2, see RFC 9113 8.2.2. Content-Length is computed.
+constexpr std::array<std::string_view, 6> kSkippedResponseHeaders{
+    "connection",       "content-length",    "keep-alive",
+    "proxy-connection", "transfer-encoding", "upgrade"};
+
+std::string ToLowerAscii(std::string_view str) {
+  std::string result{str};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+  }
+  return result;
+}
+
+bool IsBodyForbiddenForStatus(HttpStatus status) {
+  return status == HttpStatus::kNoContent ||
+         status == HttpStatus::kNotModified ||
+         (static_cast<int>(status) >= 100 && static_cast<int>(status) < 200);
+}
+
+HttpMethod ParseMethod(std::string_view method) {
+  try {
+    return HttpMethodFromString(method);
+  } catch (const std::exception&) {
+    return HttpMethod::kUnknown;
+  }
+}
+
+nghttp2_nv MakeNv(const std::string& name, const std::string& value) {
+  // nghttp2 copies the name and the value on submit
+  return {reinterpret_cast<uint8_t*>(const_cast<char*>(name.data())),
+          reinterpret_cast<uint8_t*>(const_cast<char*>(value.data())),
+          name.size(), value.size(), NGHTTP2_NV_FLAG_NONE};
+}
+
+}  // namespace
+
+class Http2Session::Callbacks final {
+ public:
+  static int OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                            void* user_data) {
+    if (!IsRequestHeaders(*frame)) return 0;
+    return Call(user_data, &Http2Session::OnBeginHeaders, frame->hd.stream_id);
+  }
+
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const uint8_t* name, size_t namelen,
+                      const uint8_t* value, size_t valuelen, uint8_t,
+                      void* user_data) {
+    // Trailers are ignored
+    if (!IsRequestHeaders(*frame)) return 0;
+    return Call(user_data, &Http2Session::OnHeader, frame->hd.stream_id,
+                std::string_view{reinterpret_cast<const char*>(name), namelen},
+                std::string_view{reinterpret_cast<const char*>(value),
+                                 valuelen});
+  }
+
+  static int OnDataChunk(nghttp2_session*, uint8_t, int32_t stream_id,
+                         const uint8_t* data, size_t len, void* user_data) {
+    return Call(user_data, &Http2Session::OnData, stream_id,
+                std::string_view{reinterpret_cast<const char*>(data), len});
+  }
+
+  static int OnFrame(nghttp2_session*, const nghttp2_frame* frame,
+                     void* user_data) {
+    const auto stream_id = frame->hd.stream_id;
+    if (IsRequestHeaders(*frame)) {
+      const auto result =
+          Call(user_data, &Http2Session::OnHeadersComplete, stream_id);
+      if (result != 0) return result;
+    }
+    if ((frame->hd.type == NGHTTP2_HEADERS ||
+         frame->hd.type == NGHTTP2_DATA) &&
+        (frame->hd.flags & NGHTTP2_FLAG_END_STREAM)) {
+      return Call(user_data, &Http2Session::FinalizeRequest, stream_id);
+    }
+    return 0;
+  }
+
+  static int OnStreamClose(nghttp2_session*, int32_t stream_id, uint32_t,
+                           void* user_data) {
+    return Call(user_data, &Http2Session::OnStreamClose, stream_id);
+  }
+
+  static ssize_t ReadData(nghttp2_session*, int32_t, uint8_t* buf,
+                          size_t length, uint32_t* data_flags,
+                          nghttp2_data_source* source, void*) {
+    auto& stream = *static_cast<OutgoingStream*>(source->ptr);
+
+    const auto size = std::min(length, stream.pending.size());
+    std::memcpy(buf, stream.pending.data(), size);
+    stream.pending.remove_prefix(size);
+    stream.body_bytes += size;
+
+    if (stream.pending.empty()) {
+      if (stream.is_eof) {
+        *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+        stream.is_finished = true;
+      } else if (size == 0) {
+        stream.is_data_deferred = true;
+        return NGHTTP2_ERR_DEFERRED;
+      }
+    }
+    return static_cast<ssize_t>(size);
+  }
+
+ private:
+  static bool IsRequestHeaders(const nghttp2_frame& frame) {
+    return frame.hd.type == NGHTTP2_HEADERS &&
+           frame.headers.cat == NGHTTP2_HCAT_REQUEST;
+  }
+
+  template <typename Func, typename... Args>
+  static int Call(void* user_data, Func func, Args... args) noexcept {
+    auto& self = *static_cast<Http2Session*>(user_data);
+    try {
+      (self.*func)(args...);
+      return 0;
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "HTTP/2 session callback failed: " << ex;
+      return NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
+  }
+};
+
+void Http2Session::NghttpSessionDeleter::operator()(
+    nghttp2_session* session) const noexcept {
+  nghttp2_session_del(session);
+}
+
+Http2Session::Http2Session(const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           const net::Http2SessionConfig& session_config,
+                           OnNewRequestCb&& on_new_request_cb,
+                           net::ParserStats& stats,
+                           request::ResponseDataAccounter& data_accounter,
+                           engine::io::RwBase& socket)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter),
+      socket_(socket) {
+  nghttp2_session_callbacks* callbacks_ptr = nullptr;
+  if (nghttp2_session_callbacks_new(&callbacks_ptr) != 0) {
+    throw std::runtime_error("nghttp2_session_callbacks_new failed");
+  }
+  std::unique_ptr<nghttp2_session_callbacks,
+                  decltype(&nghttp2_session_callbacks_del)>
+      callbacks{callbacks_ptr, &nghttp2_session_callbacks_del};
+
+  nghttp2_session_callbacks_set_on_begin_headers_callback(
+      callbacks.get(), &Callbacks::OnBeginHeaders);
+  nghttp2_session_callbacks_set_on_header_callback(callbacks.get(),
+                                                   &Callbacks::OnHeader);
+  nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+      callbacks.get(), &Callbacks::OnDataChunk);
+  nghttp2_session_callbacks_set_on_frame_recv_callback(callbacks.get(),
+                                                       &Callbacks::OnFrame);
+  nghttp2_session_callbacks_set_on_stream_close_callback(
+      callbacks.get(), &Callbacks::OnStreamClose);
+
+  nghttp2_session* session = nullptr;
+  if (nghttp2_session_server_new(&session, callbacks.get(), this) != 0) {
+    throw std::runtime_error("nghttp2_session_server_new failed");
+  }
+  session_.reset(session);
+
+  const std::array<nghttp2_settings_entry, 3> settings{{
+      {NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS,
+       session_config.max_concurrent_streams},
+      {NGHTTP2_SETTINGS_MAX_FRAME_SIZE, session_config.max_frame_size},
+      {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE,
+       session_config.initial_window_size},
+  }};
+  const auto rv = nghttp2_submit_settings(session_.get(), NGHTTP2_FLAG_NONE,
+                                          settings.data(), settings.size());
+  if (rv != 0) {
+    throw std::runtime_error(fmt::format("nghttp2_submit_settings failed: {}",
+                                         nghttp2_strerror(rv)));
+  }
+}
+
+Http2Session::~Http2Session() {
+  stats_.parsing_request_count -= incoming_streams_.size();
+}
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  bool is_ok = true;
+  std::vector<std::shared_ptr<request::RequestBase>> requests;
+  {
+    std::unique_lock lock{mutex_};
+    const auto rv = nghttp2_session_mem_recv(
+        session_.get(), reinterpret_cast<const uint8_t*>(data), size);
+    if (rv < 0) {
+      LOG_WARNING() << "HTTP/2 session error: "
+                    << nghttp2_strerror(static_cast<int>(rv));
+      nghttp2_session_terminate_session(session_.get(), NGHTTP2_PROTOCOL_ERROR);
+      is_ok = false;
+    }
+
+    // Sends the SETTINGS, WINDOW_UPDATE and the data unblocked by them
+    SendPendingFrames();
+
+    requests.swap(finalized_requests_);
+    is_ok = is_ok && (nghttp2_session_want_read(session_.get()) ||
+                      nghttp2_session_want_write(session_.get()));
+    // The peer will not enlarge the windows of a terminated session
+    if (!is_ok) is_receiving_ = false;
+    NotifyWindowUpdate();
+  }
+
+  for (auto& request : requests) on_new_request_cb_(std::move(request));
+  return is_ok;
+}
+
+void Http2Session::SendResponse(HttpResponse& response) {
+  const auto stream_id = response.request_.GetStreamId();
+  UINVARIANT(stream_id, "Not an HTTP/2 request");
+
+  std::unique_lock lock{mutex_};
+  const auto sent_bytes = SendResponseImpl(response, *stream_id, lock);
+  lock.unlock();
+
+  response.SetSent(sent_bytes, std::chrono::steady_clock::now());
+}
+
+void Http2Session::StopReceiving() {
+  std::unique_lock lock{mutex_};
+  is_receiving_ = false;
+  NotifyWindowUpdate();
+}
+
+void Http2Session::NotifyWindowUpdate() {
+  ++window_update_epoch_;
+  window_update_cv_.NotifyAll();
+}
+
+void Http2Session::SendPendingFrames() {
+  for (;;) {
+    const uint8_t* data = nullptr;
+    const auto size = nghttp2_session_mem_send(session_.get(), &data);
+    if (size < 0) {
+      throw std::runtime_error(
+          fmt::format("nghttp2_session_mem_send failed: {}",
+                      nghttp2_strerror(static_cast<int>(size))));
+    }
+    if (size == 0) return;
+
+    socket_.WriteAll(data, size, {});
+  }
+}
+
+std::size_t Http2Session::SendResponseImpl(
+    HttpResponse& response, std::int32_t stream_id,
+    std::unique_lock<engine::Mutex>& lock) {
+  if (!nghttp2_session_find_stream(session_.get(), stream_id)) {
+    throw std::runtime_error("HTTP/2 stream is closed by peer");
+  }
+
+  // HTTP/2 frames the data itself, sendfile() is of no use here
+  if (response.file_body_) response.LoadFileBody();
+
+  const auto status = response.GetStatus();
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(status);
+  const bool is_head_request =
+      response.request_.GetMethod() == HttpMethod::kHead;
+  const bool is_streamed =
+      response.IsBodyStreamed() && response.GetData().empty();
+  const auto& data = response.GetData();
+
+  std::vector<std::pair<std::string, std::string>> headers;
+  headers.reserve(response.headers_.size() + response.cookies_.size() + 4);
+  headers.emplace_back(":status", std::to_string(static_cast<int>(status)));
+  const auto end = response.headers_.end();
+  const auto* static_headers = response.static_headers_;
+  const auto is_set = [&response, end, static_headers](const auto& name) {
+    return response.headers_.find(name) != end ||
+           (static_headers && static_headers->Contains(name));
+  };
+  if (!is_set(USERVER_NAMESPACE::http::headers::kDate)) {
+    headers.emplace_back("date", impl::GetCachedDate());
+  }
+  if (!is_set(USERVER_NAMESPACE::http::headers::kContentType)) {
+    headers.emplace_back("content-type", kDefaultContentType);
+  }
+  if (static_headers) {
+    for (const auto& [name, value] : static_headers->GetHeaders()) {
+      if (response.headers_.find(name) != end) continue;
+      headers.emplace_back(ToLowerAscii(name), value);
+    }
+  }
+  for (const auto& [name, value] : response.headers_) {
+    auto lower_name = ToLowerAscii(name);
+    if (std::find(kSkippedResponseHeaders.begin(),
+                  kSkippedResponseHeaders.end(),
+                  lower_name) != kSkippedResponseHeaders.end()) {
+      continue;
+    }
+    headers.emplace_back(std::move(lower_name), value);
+  }
+  for (const auto& cookie : response.cookies_) {
+    headers.emplace_back("set-cookie", cookie.second.ToString());
+  }
+  if (!is_streamed && !is_body_forbidden) {
+    headers.emplace_back("content-length", std::to_string(data.size()));
+  }
+
+  std::size_t headers_size = 0;
+  std::vector<nghttp2_nv> nva;
+  nva.reserve(headers.size());
+  for (const auto& [name, value] : headers) {
+    nva.push_back(MakeNv(name, value));
+    headers_size += name.size() + value.size();
+  }
+
+  const auto [it, inserted] = outgoing_streams_.try_emplace(stream_id);
+  UASSERT(inserted);
+  auto& stream = it->second;
+  stream.is_eof = !is_streamed;
+  if (!is_streamed && !is_head_request && !is_body_forbidden) {
+    stream.pending = data;
+  }
+
+  utils::FastScopeGuard stream_guard([&]() noexcept {
+    stream.is_sending = false;
+    if (stream.is_closed) {
+      outgoing_streams_.erase(stream_id);
+    } else if (!stream.is_finished) {
+      // The data must not be read by the session after the return
+      stream.pending = {};
+      stream.is_eof = true;
+      nghttp2_submit_rst_stream(session_.get(), NGHTTP2_FLAG_NONE, stream_id,
+                                NGHTTP2_INTERNAL_ERROR);
+      if (stream.is_data_deferred) {
+        nghttp2_session_resume_data(session_.get(), stream_id);
+      }
+    }
+  });
+
+  const bool has_body = is_streamed || !stream.pending.empty();
+  nghttp2_data_provider data_provider{};
+  data_provider.source.ptr = &stream;
+  data_provider.read_callback = &Callbacks::ReadData;
+  const auto rv =
+      nghttp2_submit_response(session_.get(), stream_id, nva.data(),
+                              nva.size(), has_body ? &data_provider : nullptr);
+  if (rv != 0) {
+    throw std::runtime_error(fmt::format("nghttp2_submit_response failed: {}",
+                                         nghttp2_strerror(rv)));
+  }
+  if (!has_body) stream.is_finished = true;
+  SendPendingFrames();
+
+  while (!stream.is_finished) {
+    if (stream.is_closed) {
+      throw std::runtime_error("HTTP/2 stream is closed by peer");
+    }
+
+    if (is_streamed && !stream.is_eof && stream.pending.empty()) {
+      std::string chunk;
+      lock.unlock();
+      const bool has_chunk = response.body_stream_->Pop(chunk);
+      lock.lock();
+
+      if (!has_chunk) {
+        stream.is_eof = true;
+      } else if (chunk.empty()) {
+        continue;
+      } else {
+        stream.chunk = std::move(chunk);
+        stream.pending = stream.chunk;
+      }
+
+      if (stream.is_data_deferred) {
+        stream.is_data_deferred = false;
+        nghttp2_session_resume_data(session_.get(), stream_id);
+      }
+      SendPendingFrames();
+      continue;
+    }
+
+    // Waiting for the peer to enlarge the flow control window
+    if (!is_receiving_) {
+      throw std::runtime_error("HTTP/2 connection is closed by peer");
+    }
+    const auto epoch = window_update_epoch_;
+    const bool is_notified = window_update_cv_.Wait(lock, [&] {
+      return window_update_epoch_ != epoch || !is_receiving_ ||
+             stream.is_closed;
+    });
+    if (!is_notified) {
+      throw std::runtime_error(
+          "HTTP/2 response is cancelled while waiting for the peer");
+    }
+  }
+
+  if (is_streamed) {
+    response.body_stream_producer_.reset();
+    response.body_stream_.reset();
+  }
+  return headers_size + stream.body_bytes;
+}
+
+void Http2Session::SetMemoryBudget(
+    std::shared_ptr<net::MemoryBudget> budget) {
+  memory_budget_ = std::move(budget);
+}
+
+void Http2Session::OnBeginHeaders(std::int32_t stream_id) {
+  const auto [it, inserted] = incoming_streams_.try_emplace(
+      stream_id, request_constructor_config_, handler_info_index_,
+      data_accounter_);
+  UASSERT(inserted);
+  ++stats_.parsing_request_count;
+
+  auto& constructor = it->second.constructor;
+  if (memory_budget_) constructor.SetMemoryBudget(memory_budget_);
+  constructor.SetHttpMajor(2);
+  constructor.SetHttpMinor(0);
+  constructor.SetStreamId(stream_id);
+}
+
+void Http2Session::OnHeader(std::int32_t stream_id, std::string_view name,
+                            std::string_view value) {
+  const auto it = incoming_streams_.find(stream_id);
+  if (it == incoming_streams_.end()) return;
+  auto& stream = it->second;
+  auto& constructor = stream.constructor;
+
+  try {
+    // nghttp2 guarantees that pseudo-headers precede the regular ones
+    if (!name.empty() && name.front() == ':') {
+      if (name == ":method") {
+        constructor.SetMethod(ParseMethod(value));
+      } else if (name == ":path") {
+        constructor.AppendUrl(value.data(), value.size());
+      } else if (name == ":authority") {
+        stream.authority = value;
+      }
+      // :scheme is defined by the listener
+      return;
+    }
+
+    ParseUrl(stream);
+    if (name == "cookie") {
+      if (!stream.cookies.empty()) stream.cookies += "; ";
+      stream.cookies += value;
+      return;
+    }
+    constructor.AppendHeaderField(name.data(), name.size());
+    constructor.AppendHeaderValue(value.data(), value.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append header: " << ex;
+    FinalizeRequest(stream_id);
+  }
+}
+
+void Http2Session::OnData(std::int32_t stream_id, std::string_view data) {
+  const auto it = incoming_streams_.find(stream_id);
+  if (it == incoming_streams_.end()) return;
+
+  try {
+    it->second.constructor.AppendBody(data.data(), data.size());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append body: " << ex;
+    FinalizeRequest(stream_id);
+  }
+}
+
+void Http2Session::OnHeadersComplete(std::int32_t stream_id) {
+  const auto it = incoming_streams_.find(stream_id);
+  if (it == incoming_streams_.end()) return;
+  auto& stream = it->second;
+  auto& constructor = stream.constructor;
+
+  try {
+    ParseUrl(stream);
+    if (!stream.cookies.empty()) {
+      constexpr std::string_view kCookie = "cookie";
+      constructor.AppendHeaderField(kCookie.data(), kCookie.size());
+      constructor.AppendHeaderValue(stream.cookies.data(),
+                                    stream.cookies.size());
+    }
+    constructor.AppendHeaderField("", 0);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't complete headers: " << ex;
+    FinalizeRequest(stream_id);
+  }
+}
+
+void Http2Session::OnStreamClose(std::int32_t stream_id) {
+  const auto incoming_it = incoming_streams_.find(stream_id);
+  if (incoming_it != incoming_streams_.end()) {
+    // Reset by the peer before the request is complete
+    incoming_streams_.erase(incoming_it);
+    --stats_.parsing_request_count;
+  }
+
+  const auto outgoing_it = outgoing_streams_.find(stream_id);
+  if (outgoing_it != outgoing_streams_.end()) {
+    if (outgoing_it->second.is_sending) {
+      outgoing_it->second.is_closed = true;
+      NotifyWindowUpdate();
+    } else {
+      outgoing_streams_.erase(outgoing_it);
+    }
+  }
+}
+
+void Http2Session::ParseUrl(IncomingStream& stream) {
+  if (stream.is_url_parsed) return;
+  stream.is_url_parsed = true;
+
+  stream.constructor.ParseUrl();
+  if (!stream.authority.empty()) {
+    constexpr std::string_view kHost = "host";
+    stream.constructor.AppendHeaderField(kHost.data(), kHost.size());
+    stream.constructor.AppendHeaderValue(stream.authority.data(),
+                                         stream.authority.size());
+  }
+}
+
+void Http2Session::FinalizeRequest(std::int32_t stream_id) {
+  const auto it = incoming_streams_.find(stream_id);
+  if (it == incoming_streams_.end()) return;
+
+  auto request = it->second.constructor.Finalize();
+  incoming_streams_.erase(it);
+  --stats_.parsing_request_count;
+
+  if (request) {
+    finalized_requests_.push_back(std::move(request));
+  } else {
+    LOG_ERROR() << "request is null after Finalize()";
+  }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
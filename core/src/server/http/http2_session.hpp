@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <server/net/connection_config.hpp>
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/io/common.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+#include "http_request_parser.hpp"
+
+struct nghttp2_session;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpResponse;
+
+/// Server side of an HTTP/2 connection: parses the frames into requests, one
+/// per stream, and writes the responses into the streams.
+///
+/// Parse() is called by the reading task of the connection and SendResponse()
+/// by the writing one, the nghttp2 session is guarded by a mutex.
+class Http2Session final : public request::RequestParser {
+ public:
+  using OnNewRequestCb = HttpRequestParser::OnNewRequestCb;
+
+  /// The connection preface a client starts an HTTP/2 connection with
+  static constexpr std::string_view kClientPreface{
+      "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n"};
+
+  Http2Session(const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               const net::Http2SessionConfig& session_config,
+               OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
+               request::ResponseDataAccounter& data_accounter,
+               engine::io::RwBase& socket);
+
+  Http2Session(Http2Session&&) = delete;
+  Http2Session& operator=(Http2Session&&) = delete;
+  ~Http2Session() override;
+
+  /// Consumes the received bytes and sends the pending frames. Returns false
+  /// if the connection should be closed.
+  bool Parse(const char* data, size_t size) override;
+
+  void SetMemoryBudget(std::shared_ptr<net::MemoryBudget> budget) override;
+
+  /// Sends the response into the stream of its request, waits for the peer
+  /// flow control window if needed.
+  void SendResponse(HttpResponse& response);
+
+  /// Fails the pending and further SendResponse calls that wait for the peer,
+  /// must be called once no more data will be received.
+  void StopReceiving();
+
+ private:
+  struct IncomingStream {
+    IncomingStream(const HttpRequestConstructor::Config& config,
+                   const HandlerInfoIndex& handler_info_index,
+                   request::ResponseDataAccounter& data_accounter)
+        : constructor(config, handler_info_index, data_accounter) {}
+
+    HttpRequestConstructor constructor;
+    // HTTP/2 allows splitting the cookie header, see RFC 9113 8.2.3
+    std::string cookies;
+    std::string authority;
+    bool is_url_parsed{false};
+  };
+  struct OutgoingStream {
+    // The rest of the current body chunk
+    std::string_view pending;
+    std::string chunk;
+    std::size_t body_bytes{0};
+    // No more body chunks will be produced
+    bool is_eof{false};
+    // The read callback has run out of data and waits for resume
+    bool is_data_deferred{false};
+    // The end of the stream has been sent
+    bool is_finished{false};
+    bool is_closed{false};
+    bool is_sending{true};
+  };
+  struct NghttpSessionDeleter {
+    void operator()(nghttp2_session* session) const noexcept;
+  };
+  class Callbacks;
+
+  void SendPendingFrames();
+  // Must be called under the mutex_
+  void NotifyWindowUpdate();
+  std::size_t SendResponseImpl(HttpResponse& response, std::int32_t stream_id,
+                               std::unique_lock<engine::Mutex>& lock);
+
+  void OnBeginHeaders(std::int32_t stream_id);
+  void OnHeader(std::int32_t stream_id, std::string_view name,
+                std::string_view value);
+  void OnData(std::int32_t stream_id, std::string_view data);
+  void OnHeadersComplete(std::int32_t stream_id);
+  void OnStreamClose(std::int32_t stream_id);
+  void ParseUrl(IncomingStream& stream);
+  void FinalizeRequest(std::int32_t stream_id);
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+  std::shared_ptr<net::MemoryBudget> memory_budget_;
+  engine::io::RwBase& socket_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable window_update_cv_;
+  // Changed by every event that may unblock the waiters of window_update_cv_
+  std::uint64_t window_update_epoch_{0};
+  std::unordered_map<std::int32_t, IncomingStream> incoming_streams_;
+  std::unordered_map<std::int32_t, OutgoingStream> outgoing_streams_;
+  // Requests are passed to on_new_request_cb_ outside of the session
+  // callbacks, as the callback may block while the mutex is held
+  std::vector<std::shared_ptr<request::RequestBase>> finalized_requests_;
+  bool is_receiving_{true};
+  // Destroyed first, as it refers to the streams
+  std::unique_ptr<nghttp2_session, NghttpSessionDeleter> session_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
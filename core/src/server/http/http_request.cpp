@@ -164,6 +164,10 @@ const std::string& HttpRequest::RequestBody() const {
   return impl_.RequestBody();
 }
 
+std::vector<std::string_view> HttpRequest::GetRequestBodyChunks() const {
+  return impl_.GetRequestBodyChunks();
+}
+
 const HttpRequest::HeadersMap& HttpRequest::RequestHeaders() const {
   return impl_.GetHeaders();
 }
@@ -1,6 +1,7 @@
 #include "http_request_constructor.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
@@ -10,6 +11,7 @@
 #include <userver/utils/exception.hpp>
 
 #include "multipart_form_data_parser.hpp"
+#include "multipart_form_data_spool.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -60,6 +62,16 @@ void HttpRequestConstructor::SetHttpMinor(unsigned short http_minor) {
   request_->http_minor_ = http_minor;
 }
 
+void HttpRequestConstructor::SetStreamId(std::int32_t stream_id) {
+  request_->stream_id_ = stream_id;
+}
+
+void HttpRequestConstructor::SetMemoryBudget(
+    std::shared_ptr<net::MemoryBudget> budget) {
+  UASSERT(!request_size_);
+  request_->memory_charge_ = net::MemoryCharge{std::move(budget)};
+}
+
 void HttpRequestConstructor::AppendUrl(const char* data, size_t size) {
   // using common limits in checks
   AccountUrlSize(size);
@@ -112,6 +124,9 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    if (handler_config.multipart_spool_dir) {
+      multipart_spool_dir_ = &*handler_config.multipart_spool_dir;
+    }
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
@@ -156,9 +171,55 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
   header_value_.append(data, size);
 }
 
+void HttpRequestConstructor::AppendHeader(std::string_view name,
+                                          std::string_view value) {
+  UASSERT(!header_field_flag_);
+
+  AccountHeadersSize(name.size());
+  AccountRequestSize(name.size());
+  AccountHeadersSize(value.size());
+  AccountRequestSize(value.size());
+
+  // The strings are moved into the map, which owns its headers
+  InsertHeader(std::string{name}, std::string{value});
+}
+
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
+  if (!body_started_) StartBody();
+  if (decompressor_) {
+    AppendCompressedBody({data, size});
+    return;
+  }
+  if (multipart_parser_) {
+    CheckRequestSize(size);
+    AppendMultipartFormData({data, size});
+    return;
+  }
+
+  AccountRequestSize(size);
+  if (request_->request_body_chunks_.empty()) {
+    request_->request_body_.append(data, size);
+    return;
+  }
+
+  // Keeps the order with the chunks referred to
+  std::shared_ptr<char[]> copy(new char[size]);
+  std::memcpy(copy.get(), data, size);
+  const std::string_view chunk{copy.get(), size};
+  request_->request_body_chunks_.push_back({std::move(copy), chunk});
+}
+
+void HttpRequestConstructor::AppendBody(const char* data, size_t size,
+                                        const net::ReceiveSlab& slab) {
+  if (!body_started_) StartBody();
+  if (!slab || !request_->request_body_.empty() || decompressor_ ||
+      multipart_parser_) {
+    AppendBody(data, size);
+    return;
+  }
+
   AccountRequestSize(size);
-  request_->request_body_.append(data, size);
+  request_->request_body_chunks_.push_back({slab, {data, size}});
 }
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
@@ -176,22 +237,31 @@ std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
 }
 
 void HttpRequestConstructor::FinalizeImpl() {
-  if (status_ != Status::kOk &&
-      (!config_.testing_mode || status_ != Status::kHandlerNotFound)) {
-    return;
-  }
+  if (!CanProcessRequest()) return;
 
   if (!url_parsed_) {
     SetStatus(Status::kBadRequest);
     return;
   }
 
+  if (decompressor_) {
+    try {
+      decompressor_->Finish();
+    } catch (const compression::DecompressionError& ex) {
+      LOG_WARNING() << "can't decompress request body: " << ex;
+      SetStatus(Status::kBadRequest);
+      return;
+    }
+    // The handler gets the decompressed body
+    request_->RemoveHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
+  }
+
   try {
     ParseArgs(parsed_url_);
     if (config_.parse_args_from_body) {
       if (!config_.decompress_request || !request_->IsBodyCompressed())
-        ParseArgs(request_->request_body_.data(),
-                  request_->request_body_.size());
+        ParseArgs(request_->RequestBody().data(),
+                  request_->RequestBody().size());
     }
   } catch (const std::exception& ex) {
     LOG_WARNING() << "can't parse args: " << ex;
@@ -199,11 +269,7 @@ void HttpRequestConstructor::FinalizeImpl() {
     return;
   }
 
-  UASSERT(std::all_of(request_->request_args_.begin(),
-                      request_->request_args_.end(),
-                      [](const auto& arg) { return !arg.second.empty(); }));
-
-  LOG_TRACE() << "request_args:" << request_->request_args_;
+  LOG_TRACE() << "request_args:" << request_->request_args_.GetRaw();
   LOG_TRACE() << "headers:" << request_->headers_;
 
   try {
@@ -218,7 +284,13 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
+  if (multipart_parser_) {
+    if (multipart_parser_->Finish()) {
+      request_->form_data_spool_->Finish();
+    } else {
+      SetStatus(Status::kParseMultipartFormDataError);
+    }
+  } else if (IsMultipartFormDataContentType(content_type)) {
     if (!ParseMultipartFormData(content_type, request_->RequestBody(),
                                 request_->form_data_args_)) {
       SetStatus(Status::kParseMultipartFormDataError);
@@ -236,19 +308,21 @@ void HttpRequestConstructor::ParseArgs(const http_parser_url& url) {
 }
 
 void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
-  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(
-      std::string_view(data, size),
-      [this](std::string&& key, std::string&& value) {
-        request_->request_args_[std::move(key)].push_back(std::move(value));
-      });
+  request_->request_args_.Parse(std::string_view(data, size));
 }
 
 void HttpRequestConstructor::AddHeader() {
   UASSERT(header_field_flag_);
 
+  InsertHeader(std::move(header_field_), std::move(header_value_));
+  header_field_.clear();
+  header_value_.clear();
+}
+
+void HttpRequestConstructor::InsertHeader(std::string&& name,
+                                          std::string&& value) {
   try {
-    request_->headers_.InsertOrAppend(std::move(header_field_),
-                                      std::move(header_value_));
+    request_->headers_.InsertOrAppend(std::move(name), std::move(value));
   } catch (const USERVER_NAMESPACE::http::headers::HeaderMap::
                TooManyHeadersException&) {
     SetStatus(Status::kHeadersTooLarge);
@@ -256,8 +330,6 @@ void HttpRequestConstructor::AddHeader() {
         "HeaderMap reached its maximum capacity, already contains {} headers",
         request_->headers_.size()));
   }
-  header_field_.clear();
-  header_value_.clear();
 }
 
 void HttpRequestConstructor::ParseCookies() {
@@ -304,11 +376,113 @@ void HttpRequestConstructor::ParseCookies() {
   }
 }
 
+void HttpRequestConstructor::StartBody() {
+  body_started_ = true;
+  if (!CanProcessRequest()) return;
+
+  if (config_.decompress_request && request_->IsBodyCompressed()) {
+    const auto& content_encoding = request_->GetHeader(
+        USERVER_NAMESPACE::http::headers::kContentEncoding);
+    const auto algorithm =
+        compression::AlgorithmFromContentEncoding(content_encoding);
+    // The unsupported encodings are reported by the handler
+    if (algorithm) {
+      decompressor_ = compression::MakeStreamDecompressor(*algorithm);
+    }
+  }
+  if (multipart_spool_dir_) StartMultipartFormData();
+}
+
+void HttpRequestConstructor::StartMultipartFormData() {
+  const auto& content_type =
+      request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
+  // The compressed body is parsed after the decompression in the handler
+  if (!IsMultipartFormDataContentType(content_type) ||
+      (request_->IsBodyCompressed() && !decompressor_)) {
+    return;
+  }
+  std::string boundary;
+  std::string charset;
+  if (!ParseMultipartFormDataContentType(content_type, boundary, charset)) {
+    // reported by ParseMultipartFormData() of the buffered body
+    return;
+  }
+
+  request_->form_data_spool_ = std::make_unique<MultipartFormDataSpool>(
+      *multipart_spool_dir_, std::move(charset), request_->form_data_args_);
+  multipart_parser_ = std::make_unique<MultipartFormDataStreamParser>(
+      std::move(boundary), *request_->form_data_spool_);
+}
+
+void HttpRequestConstructor::AppendCompressedBody(std::string_view data) {
+  // The received size is limited as usual, the decompressed size is limited
+  // by max_request_size on the fly
+  CheckRequestSize(data.size());
+  if (!CanProcessRequest()) return;
+
+  if (multipart_parser_) decompressed_chunk_.clear();
+  auto& output =
+      multipart_parser_ ? decompressed_chunk_ : request_->request_body_;
+  const auto output_size = output.size();
+  try {
+    decompressor_->Decompress(
+        data, output,
+        output_size + (config_.max_request_size - decompressed_size_));
+  } catch (const compression::TooBigError&) {
+    SetStatus(Status::kRequestTooLarge);
+    utils::LogErrorAndThrow(
+        "decompressed request body is too large, >" +
+        std::to_string(config_.max_request_size) +
+        " (enforced by 'max_request_size' handler limit in config.yaml)" +
+        ", url: " + request_->GetUrl());
+  } catch (const compression::DecompressionError& ex) {
+    SetStatus(Status::kBadRequest);
+    utils::LogErrorAndThrow(
+        std::string{"can't decompress request body: "} + ex.what() +
+        ", url: " + request_->GetUrl());
+  }
+
+  const auto size = output.size() - output_size;
+  decompressed_size_ += size;
+  if (multipart_parser_) {
+    AppendMultipartFormData(decompressed_chunk_);
+  } else {
+    ChargeMemory(size);
+  }
+}
+
+void HttpRequestConstructor::AppendMultipartFormData(std::string_view data) {
+  // Only the values kept in memory are charged to the memory budget
+  if (!CanProcessRequest()) return;
+
+  auto& spool = *request_->form_data_spool_;
+  const auto memory_size = spool.GetMemorySize();
+  bool parsed = false;
+  try {
+    parsed = multipart_parser_->Feed(data);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't store multipart/form-data part: " << ex;
+  }
+  ChargeMemory(spool.GetMemorySize() - memory_size);
+  if (!parsed) SetStatus(Status::kParseMultipartFormDataError);
+}
+
+bool HttpRequestConstructor::CanProcessRequest() const {
+  // The requests without a handler are processed in testing mode
+  return status_ == Status::kOk ||
+         (config_.testing_mode && status_ == Status::kHandlerNotFound);
+}
+
 void HttpRequestConstructor::SetStatus(HttpRequestConstructor::Status status) {
   status_ = status;
 }
 
 void HttpRequestConstructor::AccountRequestSize(size_t size) {
+  CheckRequestSize(size);
+  ChargeMemory(size);
+}
+
+void HttpRequestConstructor::CheckRequestSize(size_t size) {
   request_size_ += size;
   if (request_size_ > config_.max_request_size) {
     SetStatus(Status::kRequestTooLarge);
@@ -321,6 +495,17 @@ void HttpRequestConstructor::AccountRequestSize(size_t size) {
   }
 }
 
+void HttpRequestConstructor::ChargeMemory(size_t size) {
+  if (!request_->memory_charge_.TryAdd(size)) {
+    SetStatus(Status::kRequestTooLarge);
+    utils::LogErrorAndThrow(
+        "connection memory budget is exceeded by the request of size " +
+        std::to_string(request_size_) +
+        " (enforced by 'memory_budget' connection limit in config.yaml)" +
+        ", url: " + (url_parsed_ ? request_->GetUrl() : "not parsed yet"));
+  }
+}
+
 void HttpRequestConstructor::AccountUrlSize(size_t size) {
   url_size_ += size;
   if (url_size_ > config_.max_url_size) {
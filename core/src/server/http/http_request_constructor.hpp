@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <string_view>
 
 #include <http_parser.h>
 
@@ -8,10 +11,12 @@
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/request/request_config.hpp>
 
+#include <compression/compressor.hpp>
 #include <server/request/request_constructor.hpp>
 
 #include "handler_info_index.hpp"
 #include "http_request_impl.hpp"
+#include "multipart_form_data_stream_parser.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -45,12 +50,20 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void SetMethod(HttpMethod method);
   void SetHttpMajor(unsigned short http_major);
   void SetHttpMinor(unsigned short http_minor);
+  void SetStreamId(std::int32_t stream_id);
+  // The URL, headers and body of the request are charged to `budget`
+  void SetMemoryBudget(std::shared_ptr<net::MemoryBudget> budget);
 
   void AppendUrl(const char* data, size_t size);
   void ParseUrl();
   void AppendHeaderField(const char* data, size_t size);
   void AppendHeaderValue(const char* data, size_t size);
+  // Adds a complete header without buffering its parts, must not be mixed
+  // with AppendHeaderField() and AppendHeaderValue()
+  void AppendHeader(std::string_view name, std::string_view value);
   void AppendBody(const char* data, size_t size);
+  // Refers to the data instead of copying it if `slab` is not empty
+  void AppendBody(const char* data, size_t size, const net::ReceiveSlab& slab);
 
   void SetIsFinal(bool is_final);
 
@@ -62,10 +75,18 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void ParseArgs(const http_parser_url& url);
   void ParseArgs(const char* data, size_t size);
   void AddHeader();
+  void InsertHeader(std::string&& name, std::string&& value);
   void ParseCookies();
+  void StartBody();
+  void StartMultipartFormData();
+  void AppendCompressedBody(std::string_view data);
+  void AppendMultipartFormData(std::string_view data);
 
+  bool CanProcessRequest() const;
   void SetStatus(Status status);
   void AccountRequestSize(size_t size);
+  void CheckRequestSize(size_t size);
+  void ChargeMemory(size_t size);
   void AccountUrlSize(size_t size);
   void AccountHeadersSize(size_t size);
 
@@ -84,8 +105,18 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   size_t url_size_ = 0;
   size_t headers_size_ = 0;
   bool url_parsed_ = false;
+  bool body_started_ = false;
   Status status_ = Status::kOk;
 
+  // Set if the body is decompressed as it arrives
+  std::unique_ptr<compression::StreamDecompressor> decompressor_;
+  size_t decompressed_size_ = 0;
+  std::string decompressed_chunk_;
+
+  // Set if the handler streams multipart/form-data bodies
+  const std::string* multipart_spool_dir_{nullptr};
+  std::unique_ptr<MultipartFormDataStreamParser> multipart_parser_;
+
   std::shared_ptr<HttpRequestImpl> request_;
 };
 
@@ -1,6 +1,10 @@
 #include <userver/utest/utest.hpp>
 
+#include <vector>
+
+#include <compression/compressor.hpp>
 #include <server/http/http_request_constructor.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/http/parser/http_request_parse_args.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,4 +19,88 @@ TEST(HttpRequestConstructor, DecodeUrlPlus) {
   EXPECT_EQ("Some String", http::parser::UrlDecode(str));
 }
 
+namespace {
+
+constexpr server::request::HttpRequestConfig kDecompressConfig{
+    /*.max_url_size = */ 8192,
+    /*.max_request_size = */ 1024 * 1024,
+    /*.max_headers_size = */ 65536,
+    /*.parse_args_from_body = */ false,
+    /*.testing_mode = */ true,
+    /*.decompress_request = */ true,
+};
+
+std::shared_ptr<server::http::HttpRequestImpl> ConstructCompressedRequest(
+    std::string_view encoding, std::string_view body) {
+  static const server::http::HandlerInfoIndex kHandlerInfoIndex;
+  static server::request::ResponseDataAccounter accounter;
+
+  server::http::HttpRequestConstructor constructor{
+      kDecompressConfig, kHandlerInfoIndex, accounter};
+  constructor.SetMethod(server::http::HttpMethod::kPost);
+  constructor.AppendUrl("/", 1);
+  constructor.ParseUrl();
+  constructor.AppendHeaderField("Content-Encoding", 16);
+  constructor.AppendHeaderValue(encoding.data(), encoding.size());
+  constructor.AppendHeaderField("", 0);
+
+  try {
+    constexpr std::size_t kChunkSize = 1000;
+    for (std::size_t pos = 0; pos < body.size(); pos += kChunkSize) {
+      const auto chunk = body.substr(pos, kChunkSize);
+      constructor.AppendBody(chunk.data(), chunk.size());
+    }
+  } catch (const std::exception&) {
+    // the status is set by the constructor
+  }
+  return std::dynamic_pointer_cast<server::http::HttpRequestImpl>(
+      constructor.Finalize());
+}
+
+}  // namespace
+
+TEST(HttpRequestConstructor, DecompressBody) {
+  std::string data;
+  for (int i = 0; i < 10000; ++i) data += std::to_string(i);
+
+  std::vector<compression::Algorithm> algorithms{
+      compression::Algorithm::kGzip};
+#ifndef USERVER_NO_BROTLI
+  algorithms.push_back(compression::Algorithm::kBrotli);
+#endif
+
+  for (const auto algorithm : algorithms) {
+    const auto encoding = compression::ToContentEncoding(algorithm);
+    const auto request = ConstructCompressedRequest(
+        encoding, compression::Compress(algorithm, data, 5));
+    ASSERT_TRUE(request);
+    EXPECT_EQ(request->RequestBody(), data) << encoding;
+    EXPECT_FALSE(request->IsBodyCompressed()) << encoding;
+  }
+}
+
+TEST(HttpRequestConstructor, DecompressBodyTooLarge) {
+  const std::string data(kDecompressConfig.max_request_size + 1, 'a');
+  const auto request = ConstructCompressedRequest(
+      "gzip", compression::Compress(compression::Algorithm::kGzip, data, 5));
+  ASSERT_TRUE(request);
+  EXPECT_EQ(request->GetHttpResponse().GetStatus(),
+            server::http::HttpStatus::kPayloadTooLarge);
+}
+
+TEST(HttpRequestConstructor, DecompressBodyMalformed) {
+  const auto request = ConstructCompressedRequest("gzip", "not compressed");
+  ASSERT_TRUE(request);
+  EXPECT_EQ(request->GetHttpResponse().GetStatus(),
+            server::http::HttpStatus::kBadRequest);
+}
+
+TEST(HttpRequestConstructor, DecompressBodyUnsupportedEncoding) {
+  // left for the handler to respond with 415
+  const auto request = ConstructCompressedRequest("zstd", "compressed");
+  ASSERT_TRUE(request);
+  EXPECT_EQ(request->RequestBody(), "compressed");
+  EXPECT_TRUE(request->IsBodyCompressed());
+}
+
 USERVER_NAMESPACE_END
@@ -1,8 +1,11 @@
 #include "http_request_handler.hpp"
 
 #include <chrono>
+#include <optional>
 #include <stdexcept>
 
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+#include <server/handlers/deadline_propagation.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/request/task_inherited_request_impl.hpp>
@@ -43,6 +46,35 @@ engine::TaskWithResult<void> StartFailsafeTask(
   });
 }
 
+// Responds to the request if its task is dropped from the queue without being
+// started, see engine::impl::TaskConfig::start_deadline
+class DroppedByDeadlineGuard final {
+ public:
+  DroppedByDeadlineGuard(std::shared_ptr<request::RequestBase> request,
+                         const handlers::HttpHandlerBase& handler,
+                         engine::Deadline start_deadline)
+      : request_(start_deadline.IsReachable() ? std::move(request) : nullptr),
+        handler_(handler),
+        start_deadline_(start_deadline) {}
+
+  DroppedByDeadlineGuard(DroppedByDeadlineGuard&&) noexcept = default;
+
+  ~DroppedByDeadlineGuard() {
+    if (!request_ || !start_deadline_.IsReached()) return;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto& http_request = static_cast<http::HttpRequestImpl&>(*request_);
+    handlers::ReportDroppedByDeadline(handler_, http_request);
+  }
+
+  // The task has been started
+  void Release() noexcept { request_.reset(); }
+
+ private:
+  std::shared_ptr<request::RequestBase> request_;
+  const handlers::HttpHandlerBase& handler_;
+  engine::Deadline start_deadline_;
+};
+
 }  // namespace
 
 HttpRequestHandler::HttpRequestHandler(
@@ -110,6 +142,10 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     // by HttpRequestConstructor::CheckStatus
     return StartFailsafeTask(std::move(request));
   }
+  if (shared_nothing_) {
+    // Keep processing the request on the thread of its connection
+    task_processor = &engine::current_task::GetTaskProcessor();
+  }
   auto throttling_enabled = handler->GetConfig().throttling_enabled;
 
   if (throttling_enabled && http_response.IsLimitReached()) {
@@ -156,12 +192,46 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     return StartFailsafeTask(std::move(request));
   }
 
+  auto* concurrency_limiter =
+      throttling_enabled ? handler->GetConcurrencyLimiter() : nullptr;
+  auto concurrency_token = concurrency_limiter
+                               ? concurrency_limiter->TryAcquire()
+                               : std::nullopt;
+  if (concurrency_limiter && !concurrency_token) {
+    SetThrottleReason(http_response, "adaptive-concurrency-limit",
+                      std::string{USERVER_NAMESPACE::http::headers::
+                                      ratelimit_reason::kAdaptiveConcurrency});
+
+    http_response.SetStatus(HttpStatus::kTooManyRequests);
+    http_response.SetReady();
+
+    LOG_LIMITED_WARNING()
+        << "Request throttled (adaptive concurrency limit, "
+           "limit via 'adaptive-concurrency-limit' of the handler), "
+        << "limit=" << concurrency_limiter->GetLimit()
+        << ", url=" << http_request.GetUrl();
+
+    return StartFailsafeTask(std::move(request));
+  }
+
   if (handler->GetConfig().response_body_stream &&
       config[handlers::kStreamApiEnabled]) {
     http_response.SetStreamBody();
   }
 
-  auto payload = [request = std::move(request), handler] {
+  const bool is_critical = is_monitor_ || !throttling_enabled;
+  // The task is not started if the deadline propagated by the client passes
+  // while the task is queued
+  const auto start_deadline =
+      is_critical
+          ? engine::Deadline{}
+          : handlers::GetPropagatedDeadline(*handler, http_request, config);
+  DroppedByDeadlineGuard dropped_guard{request, *handler, start_deadline};
+
+  auto payload = [request = std::move(request), handler,
+                  concurrency_token = std::move(concurrency_token),
+                  dropped_guard = std::move(dropped_guard)]() mutable {
+    dropped_guard.Release();
     server::request::kTaskInheritedRequest.Set(
         std::static_pointer_cast<HttpRequestImpl>(request));
 
@@ -169,14 +239,24 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
 
     request::RequestContext context;
     handler->HandleRequest(*request, context);
+    if (concurrency_token) concurrency_token->Complete();
 
     const auto now = std::chrono::steady_clock::now();
     request->SetResponseNotifyTime(now);
     request->GetResponse().SetReady(now);
   };
 
-  if (!is_monitor_ && throttling_enabled) {
-    return engine::AsyncNoSpan(*task_processor, std::move(payload));
+  if (!is_critical) {
+    const engine::impl::TaskConfig task_config{
+        *task_processor,
+        engine::Task::Importance::kNormal,
+        engine::Task::WaitMode::kSingleWaiter,
+        engine::Deadline{},
+        engine::Task::Priority::kNormal,
+        start_deadline,
+    };
+    return engine::impl::MakeTaskWithResult<engine::TaskWithResult>(
+        task_config, std::move(payload));
   } else {
     return engine::CriticalAsyncNoSpan(*task_processor, std::move(payload));
   }
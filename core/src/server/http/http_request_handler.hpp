@@ -50,6 +50,12 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
+  /// Run the handlers on the task processor of the connection instead of the
+  /// one from their configs
+  void SetSharedNothing(bool shared_nothing) noexcept {
+    shared_nothing_ = shared_nothing;
+  }
+
  private:
   logging::LoggerPtr logger_access_;
   logging::LoggerPtr logger_access_tskv_;
@@ -62,6 +68,7 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   std::atomic<bool> add_handler_disabled_;
   const bool is_monitor_;
+  bool shared_nothing_{false};
   const std::string server_name_;
   NewRequestHook new_request_hook_;
   mutable utils::TokenBucket rate_limit_;
@@ -1,15 +1,17 @@
 #include "http_request_impl.hpp"
 
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/handlers/http_handler_stage_statistics.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/http/common_headers.hpp>
-#include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
+#include "multipart_form_data_spool.hpp"
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -75,12 +77,11 @@ namespace server::http {
 // unordered_maps because we don't need different seeds and want to avoid its
 // overhead.
 HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter)
-    : form_data_args_(kZeroAllocationBucketCount,
-                      request_args_.hash_function()),
+    : form_data_args_(kZeroAllocationBucketCount),
       path_args_by_name_index_(kZeroAllocationBucketCount,
-                               request_args_.hash_function()),
+                               form_data_args_.hash_function()),
       headers_(kBucketCount),
-      cookies_(kZeroAllocationBucketCount, request_args_.hash_function()),
+      cookies_(kZeroAllocationBucketCount, form_data_args_.hash_function()),
       response_(*this, data_accounter) {}
 
 HttpRequestImpl::~HttpRequestImpl() = default;
@@ -98,33 +99,26 @@ const std::string& HttpRequestImpl::GetHost() const {
 }
 
 const std::string& HttpRequestImpl::GetArg(std::string_view arg_name) const {
-  const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
+  const auto* ptr = request_args_.Find(arg_name);
   if (!ptr) return kEmptyString;
   return ptr->at(0);
 }
 
 const std::vector<std::string>& HttpRequestImpl::GetArgVector(
     std::string_view arg_name) const {
-  const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
+  const auto* ptr = request_args_.Find(arg_name);
   if (!ptr) return kEmptyVector;
   return *ptr;
 }
 
 bool HttpRequestImpl::HasArg(std::string_view arg_name) const {
-  const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
-  return !!ptr;
+  return request_args_.Find(arg_name) != nullptr;
 }
 
-size_t HttpRequestImpl::ArgCount() const { return request_args_.size(); }
+size_t HttpRequestImpl::ArgCount() const { return request_args_.Size(); }
 
 std::vector<std::string> HttpRequestImpl::ArgNames() const {
-  std::vector<std::string> res;
-  res.reserve(request_args_.size());
-  for (const auto& arg : request_args_) res.push_back(arg.first);
-  return res;
+  return request_args_.GetNames();
 }
 
 const FormDataArg& HttpRequestImpl::GetFormDataArg(
@@ -253,18 +247,42 @@ const HttpRequest::CookiesMap& HttpRequestImpl::GetCookies() const {
   return cookies_;
 }
 
+const std::string& HttpRequestImpl::RequestBody() const {
+  if (!request_body_chunks_.empty()) {
+    std::call_once(request_body_once_, [this] {
+      std::size_t size = 0;
+      for (const auto& chunk : request_body_chunks_) size += chunk.data.size();
+      request_body_.reserve(size);
+      for (const auto& chunk : request_body_chunks_) {
+        request_body_.append(chunk.data);
+      }
+    });
+  }
+  return request_body_;
+}
+
+std::vector<std::string_view> HttpRequestImpl::GetRequestBodyChunks() const {
+  if (request_body_chunks_.empty()) {
+    if (request_body_.empty()) return {};
+    return {request_body_};
+  }
+
+  std::vector<std::string_view> chunks;
+  chunks.reserve(request_body_chunks_.size());
+  for (const auto& chunk : request_body_chunks_) chunks.push_back(chunk.data);
+  return chunks;
+}
+
 void HttpRequestImpl::SetRequestBody(std::string body) {
+  request_body_chunks_.clear();
   request_body_ = std::move(body);
 }
 
 void HttpRequestImpl::ParseArgsFromBody() {
   UASSERT_MSG(
-      request_args_.empty(),
+      request_args_.Empty(),
       "References to arguments could be invalidated by ParseArgsFromBody()");
-  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(
-      request_body_, [this](std::string&& key, std::string&& value) {
-        request_args_[std::move(key)].push_back(std::move(value));
-      });
+  request_args_.Parse(RequestBody());
 }
 
 bool HttpRequestImpl::IsBodyCompressed() const {
@@ -302,6 +320,13 @@ void HttpRequestImpl::AccountResponseTime() {
       finish_send_response_time_ - start_time_);
   request_statistics_->ForMethod(GetMethod())
       .Account(handlers::HttpRequestStatisticsEntry{timing});
+
+  if (auto* stage_statistics =
+          handler_ ? handler_->GetStageStatistics() : nullptr) {
+    stage_statistics->AccountStageTiming(
+        handlers::HttpHandlerStage::kSendResponse,
+        finish_send_response_time_ - start_send_response_time_);
+  }
 }
 
 void HttpRequestImpl::MarkAsInternalServerError() const {
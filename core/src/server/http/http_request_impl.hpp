@@ -1,13 +1,21 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
+#include <http/parser/lazy_args.hpp>
+#include <server/net/memory_budget.hpp>
+#include <server/net/receive_buffer.hpp>
+
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/http/http_response.hpp>
@@ -26,6 +34,8 @@ class HttpHandlerBase;
 
 namespace http {
 
+class MultipartFormDataSpool;
+
 class HttpRequestImpl final : public request::RequestBase {
  public:
   HttpRequestImpl(request::ResponseDataAccounter& data_accounter);
@@ -35,6 +45,8 @@ class HttpRequestImpl final : public request::RequestBase {
   const std::string& GetMethodStr() const { return ToString(method_); }
   int GetHttpMajor() const { return http_major_; }
   int GetHttpMinor() const { return http_minor_; }
+  // Set for HTTP/2 requests only
+  std::optional<std::int32_t> GetStreamId() const { return stream_id_; }
   const std::string& GetUrl() const { return url_; }
   const std::string& GetRequestPath() const override { return request_path_; }
   const std::string& GetPathSuffix() const { return path_suffix_; }
@@ -82,7 +94,8 @@ class HttpRequestImpl final : public request::RequestBase {
   HttpRequest::CookiesMapKeys GetCookieNames() const;
   const HttpRequest::CookiesMap& GetCookies() const;
 
-  const std::string& RequestBody() const { return request_body_; }
+  const std::string& RequestBody() const;
+  std::vector<std::string_view> GetRequestBodyChunks() const;
   void SetRequestBody(std::string body);
   void ParseArgsFromBody();
   void SetResponseStatus(HttpStatus status) const {
@@ -139,25 +152,37 @@ class HttpRequestImpl final : public request::RequestBase {
   friend class HttpRequestConstructor;
 
  private:
+  struct RequestBodyChunk {
+    net::ReceiveSlab slab;
+    std::string_view data;
+  };
+
   HttpMethod method_{HttpMethod::kUnknown};
   unsigned short http_major_{1};
   unsigned short http_minor_{1};
+  std::optional<std::int32_t> stream_id_;
   std::string url_;
   std::string request_path_;
-  std::string request_body_;
+  // Concatenation of request_body_chunks_ is built on the first RequestBody()
+  mutable std::string request_body_;
+  // The body that refers to the connection receive buffers
+  std::vector<RequestBodyChunk> request_body_chunks_;
+  mutable std::once_flag request_body_once_;
   std::string path_suffix_;
-  utils::impl::TransparentMap<std::string, std::vector<std::string>,
-                              utils::StrCaseHash>
-      request_args_;
+  USERVER_NAMESPACE::http::parser::LazyArgs request_args_;
   utils::impl::TransparentMap<std::string, std::vector<FormDataArg>,
                               utils::StrCaseHash>
       form_data_args_;
+  // Owns the values and the files of form_data_args_ of a streamed body
+  std::unique_ptr<MultipartFormDataSpool> form_data_spool_;
   std::vector<std::string> path_args_;
   utils::impl::TransparentMap<std::string, size_t, utils::StrCaseHash>
       path_args_by_name_index_;
   HttpRequest::HeadersMap headers_;
   HttpRequest::CookiesMap cookies_;
   bool is_final_{false};
+  // Released back to the connection memory budget with the request
+  net::MemoryCharge memory_charge_;
   UpgradeCallback upgrade_websocket_cb_;
 
   mutable HttpResponse response_;
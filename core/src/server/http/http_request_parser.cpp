@@ -62,6 +62,14 @@ HttpRequestParser::HttpRequestParser(
   parser_.data = this;
 }
 
+void HttpRequestParser::SetReceiveSlab(net::ReceiveSlab slab) {
+  receive_slab_ = std::move(slab);
+}
+
+void HttpRequestParser::SetMemoryBudget(std::shared_ptr<net::MemoryBudget> budget) {
+  memory_budget_ = std::move(budget);
+}
+
 bool HttpRequestParser::Parse(const char* data, size_t size) {
   size_t parsed = http_parser_execute(&parser_, &parser_settings, data, size);
   if (parsed != size) {
@@ -190,7 +198,7 @@ int HttpRequestParser::OnBodyImpl(http_parser* p, const char* data,
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "body: '" << std::string_view(data, size) << "'";
   try {
-    request_constructor_->AppendBody(data, size);
+    request_constructor_->AppendBody(data, size, receive_slab_);
   } catch (const std::exception& ex) {
     LOG_WARNING() << "can't append body: " << ex;
     return -1;
@@ -214,6 +222,7 @@ void HttpRequestParser::CreateRequestConstructor() {
   ++stats_.parsing_request_count;
   request_constructor_.emplace(request_constructor_config_, handler_info_index_,
                                data_accounter_);
+  if (memory_budget_) request_constructor_->SetMemoryBudget(memory_budget_);
   url_complete_ = false;
 }
 
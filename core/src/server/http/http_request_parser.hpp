@@ -33,6 +33,10 @@ class HttpRequestParser final : public request::RequestParser {
 
   bool Parse(const char* data, size_t size) override;
 
+  void SetReceiveSlab(net::ReceiveSlab slab) override;
+
+  void SetMemoryBudget(std::shared_ptr<net::MemoryBudget> budget) override;
+
  private:
   static int OnMessageBegin(http_parser* p);
   static int OnUrl(http_parser* p, const char* data, size_t size);
@@ -70,6 +74,8 @@ class HttpRequestParser final : public request::RequestParser {
   static const http_parser_settings parser_settings;
   net::ParserStats& stats_;
   request::ResponseDataAccounter& data_accounter_;
+  net::ReceiveSlab receive_slab_;
+  std::shared_ptr<net::MemoryBudget> memory_budget_;
 };
 
 }  // namespace server::http
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
+#include <utils/gbench_auxilary.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kRequest =
+    "GET /v1/some/handler?arg=value&other_arg=other_value HTTP/1.1\r\n"
+    "Host: localhost:8080\r\n"
+    "User-Agent: benchmark/1.0\r\n"
+    "Accept: */*\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Connection: keep-alive\r\n"
+    "Cookie: session=0123456789abcdef; theme=dark\r\n"
+    "X-YaRequestId: 2c45094a64b44e0e8d2d4e8e2bd5e1c7\r\n"
+    "X-YaSpanId: 7e9a1cd6bd8c4c64\r\n"
+    "X-YaTraceId: 5d4b2c9e93e24b1d9c39cbcd8c2b1e1b\r\n"
+    "\r\n";
+
+template <typename Parser>
+void http_request_parser_parse(benchmark::State& state) {
+  const server::http::HandlerInfoIndex handler_info_index;
+  const server::request::HttpRequestConfig request_config{};
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter data_accounter;
+
+  std::string data;
+  for (int64_t i = 0; i < state.range(0); ++i) data += kRequest;
+
+  std::size_t requests = 0;
+  Parser parser(
+      handler_info_index, request_config,
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        benchmark::DoNotOptimize(request);
+        ++requests;
+      },
+      stats, data_accounter);
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(parser.Parse(data.data(), data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetItemsProcessed(requests);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(http_request_parser_parse, server::http::HttpRequestParser)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_TEMPLATE(http_request_parser_parse,
+                   server::http::SimdHttpRequestParser)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+USERVER_NAMESPACE_END
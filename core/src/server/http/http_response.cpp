@@ -18,6 +18,8 @@
 #include <userver/utils/small_string.hpp>
 
 #include <server/http/http_cached_date.hpp>
+#include <server/http/send_file.hpp>
+#include <server/http/static_headers.hpp>
 
 #include "http_request_impl.hpp"
 
@@ -41,37 +43,6 @@ constexpr std::string_view kKeepAlive = "keep-alive";
 
 const std::string kHostname = hostinfo::blocking::GetRealHostName();
 
-void CheckHeaderName(std::string_view name) {
-  static constexpr auto init = []() {
-    std::array<uint8_t, 256> res{};  // zero initialize
-    for (int i = 0; i < 32; i++) res[i] = 1;
-    for (int i = 127; i < 256; i++) res[i] = 1;
-    for (unsigned char c : "()<>@,;:\\\"/[]?={} \t") res[c] = 1;
-    return res;
-  };
-  static constexpr auto bad_chars = init();
-
-  for (char c : name) {
-    auto code = static_cast<uint8_t>(c);
-    if (bad_chars[code]) {
-      throw std::runtime_error(
-          std::string("invalid character in header name: '") + c + "' (#" +
-          std::to_string(code) + ")");
-    }
-  }
-}
-
-void CheckHeaderValue(std::string_view value) {
-  for (char c : value) {
-    auto code = static_cast<uint8_t>(c);
-    if (code < 32 || code == 127) {
-      throw std::runtime_error(
-          std::string("invalid character in header value: '") + c + "' (#" +
-          std::to_string(code) + ")");
-    }
-  }
-}
-
 bool IsBodyForbiddenForStatus(server::http::HttpStatus status) {
   return status == server::http::HttpStatus::kNoContent ||
          status == server::http::HttpStatus::kNotModified ||
@@ -108,6 +79,37 @@ void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header,
       });
 }
 
+void CheckHeaderName(std::string_view name) {
+  static constexpr auto init = []() {
+    std::array<uint8_t, 256> res{};  // zero initialize
+    for (int i = 0; i < 32; i++) res[i] = 1;
+    for (int i = 127; i < 256; i++) res[i] = 1;
+    for (unsigned char c : "()<>@,;:\\\"/[]?={} \t") res[c] = 1;
+    return res;
+  };
+  static constexpr auto bad_chars = init();
+
+  for (char c : name) {
+    auto code = static_cast<uint8_t>(c);
+    if (bad_chars[code]) {
+      throw std::runtime_error(
+          std::string("invalid character in header name: '") + c + "' (#" +
+          std::to_string(code) + ")");
+    }
+  }
+}
+
+void CheckHeaderValue(std::string_view value) {
+  for (char c : value) {
+    auto code = static_cast<uint8_t>(c);
+    if (code < 32 || code == 127) {
+      throw std::runtime_error(
+          std::string("invalid character in header value: '") + c + "' (#" +
+          std::to_string(code) + ")");
+    }
+  }
+}
+
 }  // namespace impl
 
 HttpResponse::HttpResponse(const HttpRequestImpl& request,
@@ -130,8 +132,8 @@ bool HttpResponse::SetHeader(std::string name, std::string value) {
     return false;
   }
 
-  CheckHeaderName(name);
-  CheckHeaderValue(value);
+  impl::CheckHeaderName(name);
+  impl::CheckHeaderValue(value);
 
   headers_.insert_or_assign(std::move(name), std::move(value));
 
@@ -150,7 +152,7 @@ bool HttpResponse::SetHeader(
     return false;
   }
 
-  CheckHeaderValue(value);
+  impl::CheckHeaderValue(value);
 
   headers_.insert_or_assign(header, std::move(value));
 
@@ -188,8 +190,8 @@ bool HttpResponse::ClearHeaders() {
 }
 
 void HttpResponse::SetCookie(Cookie cookie) {
-  CheckHeaderValue(cookie.Name());
-  CheckHeaderValue(cookie.Value());
+  impl::CheckHeaderValue(cookie.Name());
+  impl::CheckHeaderValue(cookie.Value());
   UASSERT(!cookie.Name().empty());
   auto [it, ok] = cookies_.emplace(std::string_view{}, std::move(cookie));
   UASSERT(ok);
@@ -261,15 +263,20 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
   headers_.erase(USERVER_NAMESPACE::http::headers::kContentLength);
   const auto end = headers_.end();
-  if (headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
+  const auto is_set = [this, end](const auto& name) {
+    return headers_.find(name) != end ||
+           (static_headers_ && static_headers_->Contains(name));
+  };
+  if (!is_set(USERVER_NAMESPACE::http::headers::kDate)) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kDate,
                        // impl::GetCachedDate() must not cross thread boundaries
                        impl::GetCachedDate());
   }
-  if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
+  if (!is_set(USERVER_NAMESPACE::http::headers::kContentType)) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentType,
                        kDefaultContentType);
   }
+  if (static_headers_) static_headers_->OutputInHttpFormat(headers_, header);
   headers_.OutputInHttpFormat(header);
   if (headers_.find(USERVER_NAMESPACE::http::headers::kConnection) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kConnection,
@@ -298,7 +305,9 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
   std::size_t sent_bytes{};
 
-  if (IsBodyStreamed() && GetData().empty()) {
+  if (file_body_) {
+    sent_bytes = SetBodyFile(socket, header);
+  } else if (IsBodyStreamed() && GetData().empty()) {
     sent_bytes = SetBodyStreamed(socket, header);
   } else {
     // e.g. a CustomHandlerException
@@ -341,29 +350,99 @@ std::size_t HttpResponse::SetBodyNotStreamed(
   return sent_bytes;
 }
 
+std::size_t HttpResponse::SetBodyFile(
+    engine::io::RwBase& socket,
+    USERVER_NAMESPACE::http::headers::HeadersString& header) {
+  UASSERT(file_body_);
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+  const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
+
+  if (!is_body_forbidden) {
+    impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength,
+                       fmt::format(FMT_COMPILE("{}"), file_body_->size));
+  }
+  header.append(kCrlf);
+
+  std::size_t sent_bytes =
+      socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+  if (!is_head_request && !is_body_forbidden) {
+    sent_bytes += impl::SendFile(socket, file_body_->file->GetNative(),
+                                 file_body_->offset, file_body_->size,
+                                 *file_body_->fs_task_processor);
+  }
+
+  file_body_.reset();
+  return sent_bytes;
+}
+
+void HttpResponse::LoadFileBody() {
+  UASSERT(file_body_);
+  SetData(impl::ReadFile(file_body_->file->GetNative(), file_body_->offset,
+                         file_body_->size, *file_body_->fs_task_processor));
+  file_body_.reset();
+}
+
 std::size_t HttpResponse::SetBodyStreamed(
     engine::io::RwBase& socket,
     USERVER_NAMESPACE::http::headers::HeadersString& header) {
   impl::OutputHeader(
       header, USERVER_NAMESPACE::http::headers::kTransferEncoding, "chunked");
 
-  // send HTTP headers
-  size_t sent_bytes = socket.WriteAll(header.data(), header.size(), {});
+  // Chunks that are already in the queue are written with a single writev,
+  // 2 IoData per chunk plus the headers fit into the stack iovec of Socket
+  constexpr std::size_t kMaxChunksPerWrite = 15;
+  // "\r\n" + 16 hex digits + "\r\n"
+  constexpr std::size_t kMaxChunkSizeLength = 20;
+
+  std::array<std::string, kMaxChunksPerWrite> body_parts;
+  std::array<std::array<char, kMaxChunkSizeLength>, kMaxChunksPerWrite> sizes;
+  std::array<engine::io::IoData, 2 * kMaxChunksPerWrite + 1> io_data;
+
+  const auto pop_ready_parts = [&](std::size_t count) {
+    while (count < kMaxChunksPerWrite &&
+           body_stream_->PopNoblock(body_parts[count])) {
+      if (body_parts[count].empty()) {
+        LOG_DEBUG() << "Zero size body_part in http_response.cpp";
+        continue;
+      }
+      ++count;
+    }
+    return count;
+  };
+
+  const auto write_parts = [&](std::size_t io_data_count,
+                               std::size_t parts_count) {
+    for (std::size_t i = 0; i < parts_count; ++i) {
+      auto& size = sizes[i];
+      const auto size_length =
+          fmt::format_to_n(size.data(), size.size(),
+                           FMT_COMPILE("\r\n{:x}\r\n"), body_parts[i].size())
+              .size;
+      io_data[io_data_count++] = {size.data(), size_length};
+      io_data[io_data_count++] = {body_parts[i].data(), body_parts[i].size()};
+    }
+    const auto sent_bytes =
+        socket.WriteAll(io_data.data(), io_data_count, engine::Deadline{});
+    // free the memory of the sent chunks before waiting for the next ones
+    for (std::size_t i = 0; i < parts_count; ++i) {
+      std::string{}.swap(body_parts[i]);
+    }
+    return sent_bytes;
+  };
+
+  // send HTTP headers together with the chunks that are ready
+  io_data[0] = {header.data(), header.size()};
+  size_t sent_bytes = write_parts(1, pop_ready_parts(0));
   header.clear();
   header.shrink_to_fit();  // free memory before time-consuming operation
 
   // Transmit HTTP response body
-  std::string body_part;
-  while (body_stream_->Pop(body_part)) {
-    if (body_part.empty()) {
+  while (body_stream_->Pop(body_parts[0])) {
+    if (body_parts[0].empty()) {
       LOG_DEBUG() << "Zero size body_part in http_response.cpp";
       continue;
     }
-
-    auto size = fmt::format("\r\n{:x}\r\n", body_part.size());
-    sent_bytes += socket.WriteAll(
-        {{size.data(), size.size()}, {body_part.data(), body_part.size()}},
-        engine::Deadline{});
+    sent_bytes += write_parts(0, pop_ready_parts(1));
   }
 
   const constexpr std::string_view terminating_chunk{"\r\n0\r\n\r\n"};
@@ -400,6 +479,16 @@ void HttpResponse::SetStreamBody() {
 
 bool HttpResponse::IsBodyStreamed() const { return body_stream_.has_value(); }
 
+void HttpResponse::SetFileBody(
+    std::shared_ptr<const fs::blocking::FileDescriptor> file,
+    std::uint64_t offset, std::uint64_t size,
+    engine::TaskProcessor& fs_task_processor) {
+  UASSERT(file && file->IsOpen());
+  UASSERT_MSG(!IsBodyStreamed(), "File body of a streamed response");
+  file_body_.emplace(
+      FileBody{std::move(file), offset, size, &fs_task_processor});
+}
+
 HttpResponse::Queue::Producer HttpResponse::GetBodyProducer() {
   UASSERT(IsBodyStreamed());
   UASSERT_MSG(body_stream_producer_, "GetBodyProducer() is called twice");
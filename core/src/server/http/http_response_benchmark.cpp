@@ -1,13 +1,20 @@
 #include <benchmark/benchmark.h>
 
 #include <fmt/compile.h>
+#include <array>
+#include <atomic>
 #include <sstream>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/small_string.hpp>
 
+#include <server/http/http_request_impl.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -120,10 +127,71 @@ void http_headers_serialization_ostreams(benchmark::State& state) {
   }
 }
 
+constexpr std::size_t kStreamChunkSize = 16 * 1024;
+
+template <typename FillResponse>
+void SendResponses(benchmark::State& state, FillResponse fill_response) {
+  engine::RunStandalone([&] {
+    const auto deadline =
+        engine::Deadline::FromDuration(std::chrono::seconds{60});
+    auto [server, client] =
+        internal::net::TcpListener{}.MakeSocketPair(deadline);
+
+    std::atomic<bool> reading{true};
+    auto reader = engine::AsyncNoSpan([&reading, &client, deadline] {
+      std::array<char, 64 * 1024> buffer{};
+      while (reading &&
+             client.RecvSome(buffer.data(), buffer.size(), deadline) > 0) {
+      }
+    });
+
+    const std::string body(state.range(0), 'x');
+    server::request::ResponseDataAccounter accounter;
+    for ([[maybe_unused]] auto _ : state) {
+      server::http::HttpRequestImpl request{accounter};
+      auto& response = request.GetHttpResponse();
+      fill_response(response, body);
+      response.SendResponse(server);
+    }
+    state.SetBytesProcessed(state.iterations() * body.size());
+
+    reading = false;
+    server.Close();
+    reader.Get();
+  });
+}
+
+void http_response_send_not_streamed(benchmark::State& state) {
+  SendResponses(state, [](server::http::HttpResponse& response,
+                          const std::string& body) {
+    response.SetData(body);
+  });
+}
+
+void http_response_send_streamed(benchmark::State& state) {
+  SendResponses(state, [](server::http::HttpResponse& response,
+                          const std::string& body) {
+    response.SetStreamBody();
+    auto producer = response.GetBodyProducer();
+    for (std::size_t pos = 0; pos < body.size(); pos += kStreamChunkSize) {
+      [[maybe_unused]] const auto success = producer.PushNoblock(
+          std::string{std::string_view{body}.substr(pos, kStreamChunkSize)});
+    }
+  });
+}
+
 }  // namespace
 
 BENCHMARK(http_headers_serialization_inplace);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
+BENCHMARK(http_response_send_not_streamed)
+    ->Arg(1024)
+    ->Arg(64 * 1024)
+    ->Arg(4 * 1024 * 1024);
+BENCHMARK(http_response_send_streamed)
+    ->Arg(1024)
+    ->Arg(64 * 1024)
+    ->Arg(4 * 1024 * 1024);
 
 USERVER_NAMESPACE_END
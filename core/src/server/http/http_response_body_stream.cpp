@@ -1,5 +1,8 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <compression/compressor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,10 +15,29 @@ ResponseBodyStream::ResponseBodyStream(
     : queue_producer_(std::move(queue_producer)),
       http_response_(http_response) {}
 
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) noexcept = default;
+
+ResponseBodyStream::~ResponseBodyStream() {
+  if (!compressor_) return;
+
+  try {
+    if (!headers_ended_) SetEndOfHeaders();
+    auto chunk = Compress({}, /*is_last=*/true);
+    [[maybe_unused]] const auto success =
+        queue_producer_.Push(std::move(chunk), engine::Deadline{});
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to finish the compressed response body: " << ex;
+  }
+}
+
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk,
                                        engine::Deadline deadline) {
   UASSERT_MSG(headers_ended_,
               "SetEndOfHeaders() was not called before PushBodyChunk()");
+  if (compressor_) {
+    chunk = Compress(chunk, /*is_last=*/false);
+    if (chunk.empty()) return;
+  }
   const auto success = queue_producer_.Push(std::move(chunk), deadline);
   UASSERT(success);
 }
@@ -43,6 +65,24 @@ void ResponseBodyStream::SetStatusCode(HttpStatus status) {
   http_response_.SetStatus(status);
 }
 
+void ResponseBodyStream::SetCompressor(
+    std::unique_ptr<compression::StreamCompressor> compressor,
+    engine::TaskProcessor* task_processor) {
+  compressor_ = std::move(compressor);
+  compression_task_processor_ = task_processor;
+}
+
+std::string ResponseBodyStream::Compress(std::string_view chunk, bool is_last) {
+  UASSERT(compressor_);
+  const auto flush = is_last ? compression::StreamCompressor::Flush::kFinish
+                             : compression::StreamCompressor::Flush::kSync;
+  if (!compression_task_processor_) return compressor_->Compress(chunk, flush);
+  auto task = engine::AsyncNoSpan(
+      *compression_task_processor_,
+      [this, chunk, flush] { return compressor_->Compress(chunk, flush); });
+  return task.Get();
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -6,6 +6,10 @@
 
 #include <server/http/http_request_impl.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/server/http/http_response.hpp>
@@ -117,6 +121,90 @@ UTEST_P(HttpResponseBody, ForbiddenBody) {
 INSTANTIATE_UTEST_SUITE_P(HttpResponseForbiddenBody, HttpResponseBody,
                           testing::Values(100, 101, 150, 199, 304, 204));
 
+UTEST(HttpResponse, FileBody) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  std::string contents;
+  for (int i = 0; contents.size() < 200'000; ++i) {
+    contents += std::to_string(i);
+  }
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), contents);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  constexpr std::size_t kOffset = 1000;
+  constexpr std::size_t kSize = 150'000;
+  response.SetFileBody(
+      std::make_shared<const fs::blocking::FileDescriptor>(
+          fs::blocking::FileDescriptor::Open(file.GetPath(),
+                                             fs::blocking::OpenFlag::kRead)),
+      kOffset, kSize, engine::current_task::GetTaskProcessor());
+  EXPECT_TRUE(response.IsFileBody());
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::string buffer(kSize * 2, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+  buffer.resize(reply_size);
+
+  EXPECT_THAT(buffer,
+              testing::HasSubstr(fmt::format(
+                  "\r\n{}: {}\r\n", http::headers::kContentLength, kSize)));
+  EXPECT_EQ(std::string_view{buffer}.substr(buffer.size() - kSize),
+            std::string_view{contents}.substr(kOffset, kSize));
+  send_task.Get();
+  EXPECT_EQ(response.BytesSent(), reply_size);
+}
+
+UTEST(HttpResponse, StreamedBodyBatches) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  response.SetStreamBody();
+  {
+    auto producer = response.GetBodyProducer();
+    // More chunks than are written at once
+    for (int i = 0; i < 40; ++i) {
+      ASSERT_TRUE(producer.PushNoblock(i % 7 ? std::to_string(i) : ""));
+    }
+  }
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::string buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+  buffer.resize(reply_size);
+
+  std::string expected_body;
+  for (int i = 0; i < 40; ++i) {
+    if (i % 7 == 0) continue;
+    const auto part = std::to_string(i);
+    expected_body += fmt::format("\r\n{:x}\r\n{}", part.size(), part);
+  }
+  expected_body += "\r\n0\r\n\r\n";
+
+  EXPECT_THAT(buffer, testing::HasSubstr("\r\nTransfer-Encoding: chunked\r\n"));
+  EXPECT_THAT(buffer, testing::EndsWith(expected_body));
+}
+
 TEST(HttpResponse, GetHeaderDoesntThrow) {
   server::request::ResponseDataAccounter accounter{};
   const server::http::HttpRequestImpl request_impl{accounter};
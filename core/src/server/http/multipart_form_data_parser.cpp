@@ -406,9 +406,9 @@ bool IsMultipartFormDataContentType(std::string_view content_type) {
   return false;
 }
 
-bool ParseMultipartFormData(const std::string& content_type,
-                            std::string_view body, FormDataArgs& form_data_args,
-                            bool strict_cr_lf) {
+bool ParseMultipartFormDataContentType(std::string_view content_type,
+                                       std::string& boundary,
+                                       std::string& charset) {
   static const std::string kBoundary = "boundary";
   static const std::string kCharset = "charset";
   static const std::string kBoundaryNotFound =
@@ -422,8 +422,8 @@ bool ParseMultipartFormData(const std::string& content_type,
   unparsed.remove_prefix(kMultipartFormData.size());
   SkipOptionalSpaces(unparsed);
 
-  std::string boundary;
-  std::string charset;
+  boundary.clear();
+  charset.clear();
   while (!unparsed.empty()) {
     if (!SkipSymbol(unparsed, ';')) return false;
     SkipOptionalSpaces(unparsed);
@@ -455,6 +455,30 @@ bool ParseMultipartFormData(const std::string& content_type,
     LOG_WARNING() << kBoundaryNotFound;
     return false;
   }
+  return true;
+}
+
+bool ParseMultipartFormDataPartHeaders(std::string_view headers,
+                                       std::string& name, FormDataArg& arg) {
+  FormDataArgInfo arg_info;
+  if (!ParseMultipartFormDataHeaders(headers, arg_info, "\r\n")) return false;
+  if (arg_info.arg.content_disposition.empty()) {
+    LOG_WARNING() << "Missing Content-Disposition header";
+    return false;
+  }
+  name = std::move(arg_info.name);
+  arg = std::move(arg_info.arg);
+  return true;
+}
+
+bool ParseMultipartFormData(const std::string& content_type,
+                            std::string_view body, FormDataArgs& form_data_args,
+                            bool strict_cr_lf) {
+  std::string boundary;
+  std::string charset;
+  if (!ParseMultipartFormDataContentType(content_type, boundary, charset)) {
+    return false;
+  }
 
   return ParseMultipartFormDataBody(body, boundary, std::move(charset),
                                     form_data_args, strict_cr_lf);
@@ -18,6 +18,16 @@ using FormDataArgs =
                                 utils::StrCaseHash>;
 
 bool IsMultipartFormDataContentType(std::string_view content_type);
+// Extracts the `boundary` and the `charset` parameters of the content type
+bool ParseMultipartFormDataContentType(std::string_view content_type,
+                                       std::string& boundary,
+                                       std::string& charset);
+
+// Parses the CRLF-terminated headers of a part followed by an empty line,
+// the views of `arg` point into `headers`
+bool ParseMultipartFormDataPartHeaders(std::string_view headers,
+                                       std::string& name, FormDataArg& arg);
+
 bool ParseMultipartFormData(const std::string& content_type,
                             std::string_view body, FormDataArgs& form_data_args,
                             bool strict_cr_lf = false);
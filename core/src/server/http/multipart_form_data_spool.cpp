@@ -0,0 +1,90 @@
+#include "multipart_form_data_spool.hpp"
+
+#include <utility>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+const std::string kCharset = "_charset_";
+const std::string kFilePrefix = "upload_";
+
+}  // namespace
+
+MultipartFormDataSpool::MultipartFormDataSpool(std::string spool_dir,
+                                               std::string charset,
+                                               FormDataArgs& form_data_args)
+    : spool_dir_(std::move(spool_dir)), form_data_args_(form_data_args) {
+  if (!charset.empty()) charset_ = std::move(charset);
+}
+
+void MultipartFormDataSpool::OnPartBegin(MultipartPartHeaders&& headers) {
+  UASSERT(!part_);
+  if (headers.filename && headers.name != kCharset) {
+    auto& file = files_.emplace_back(
+        fs::blocking::TempFile::Create(spool_dir_, kFilePrefix));
+    part_file_.emplace(fs::blocking::FileDescriptor::Open(
+        file.GetPath(), fs::blocking::OpenFlag::kWrite));
+    LOG_TRACE() << "Writing the part '" << headers.name << "' to "
+                << file.GetPath();
+  }
+  memory_size_ += headers.name.size() + headers.content_disposition.size() +
+                  (headers.content_type ? headers.content_type->size() : 0);
+  part_ = std::move(headers);
+}
+
+void MultipartFormDataSpool::OnPartData(std::string_view data) {
+  UASSERT(part_);
+  if (part_file_) {
+    part_file_->Write(data);
+  } else {
+    part_value_.append(data);
+    memory_size_ += data.size();
+  }
+}
+
+void MultipartFormDataSpool::OnPartEnd() {
+  UASSERT(part_);
+  auto headers = std::move(*part_);
+  part_.reset();
+
+  if (headers.name == kCharset) {
+    charset_ = std::exchange(part_value_, {});
+    return;
+  }
+
+  FormDataArg arg;
+  if (part_file_) {
+    std::move(*part_file_).Close();
+    part_file_.reset();
+    arg.file_path = files_.back().GetPath();
+  } else {
+    arg.value = Store(std::exchange(part_value_, {}));
+  }
+  arg.content_disposition = Store(std::move(headers.content_disposition));
+  arg.filename = std::move(headers.filename);
+  if (headers.content_type) {
+    arg.content_type = Store(std::move(*headers.content_type));
+  }
+  form_data_args_[headers.name].push_back(std::move(arg));
+}
+
+void MultipartFormDataSpool::Finish() {
+  if (!charset_) return;
+  for (auto& [name, args] : form_data_args_) {
+    for (auto& arg : args) arg.default_charset = charset_;
+  }
+}
+
+std::string_view MultipartFormDataSpool::Store(std::string&& value) {
+  return values_.emplace_back(std::move(value));
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+
+#include "multipart_form_data_parser.hpp"
+#include "multipart_form_data_stream_parser.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+// Stores the parts streamed by MultipartFormDataStreamParser: the file parts
+// are written to temporary files in `spool_dir`, the rest are kept in memory.
+// Owns the values and the files the FormDataArgs refer to.
+class MultipartFormDataSpool final : public MultipartPartHandler {
+ public:
+  // `charset` is the parameter of the request content type, may be empty
+  MultipartFormDataSpool(std::string spool_dir, std::string charset,
+                         FormDataArgs& form_data_args);
+
+  void OnPartBegin(MultipartPartHeaders&& headers) override;
+  void OnPartData(std::string_view data) override;
+  void OnPartEnd() override;
+
+  // Applies the charset of the request or of the `_charset_` part to all the
+  // args
+  void Finish();
+
+  // Size of the values kept in memory
+  std::size_t GetMemorySize() const { return memory_size_; }
+
+ private:
+  std::string_view Store(std::string&& value);
+
+  const std::string spool_dir_;
+  FormDataArgs& form_data_args_;
+
+  std::optional<MultipartPartHeaders> part_;
+  std::string part_value_;
+  std::optional<fs::blocking::FileDescriptor> part_file_;
+  std::optional<std::string> charset_;
+  std::size_t memory_size_{0};
+
+  // deque does not move the strings, the args refer to them
+  std::deque<std::string> values_;
+  std::vector<fs::blocking::TempFile> files_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
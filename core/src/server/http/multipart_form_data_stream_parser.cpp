@@ -0,0 +1,165 @@
+#include "multipart_form_data_stream_parser.hpp"
+
+#include <algorithm>
+
+#include <userver/logging/log.hpp>
+
+#include "multipart_form_data_parser.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+const std::string_view kCrLf = "\r\n";
+const std::string_view kHeadersEnd = "\r\n\r\n";
+const std::string_view kFinalSuffix = "--";
+
+// The same as the default max_headers_size of a request
+constexpr std::size_t kMaxPartHeadersSize = 65536;
+
+bool IsWsp(char c) { return c == ' ' || c == '\t'; }
+
+}  // namespace
+
+MultipartFormDataStreamParser::MultipartFormDataStreamParser(
+    std::string boundary, MultipartPartHandler& handler)
+    : delimiter_("\r\n--" + boundary),
+      handler_(handler),
+      // the first delimiter may start the body without a line break
+      buffer_(kCrLf) {}
+
+bool MultipartFormDataStreamParser::Feed(std::string_view chunk) {
+  if (state_ == State::kError) return false;
+  if (state_ == State::kEpilogue) return true;
+
+  buffer_.erase(0, offset_);
+  offset_ = 0;
+  buffer_.append(chunk);
+
+  while (Step()) {
+  }
+  return state_ != State::kError;
+}
+
+bool MultipartFormDataStreamParser::Finish() {
+  if (state_ == State::kEpilogue) return true;
+  if (state_ != State::kError) SetError("Unexpected request body end");
+  return false;
+}
+
+bool MultipartFormDataStreamParser::Step() {
+  const std::string_view data = std::string_view{buffer_}.substr(offset_);
+
+  switch (state_) {
+    case State::kPreamble: {
+      const auto pos = data.find(delimiter_);
+      if (pos == std::string_view::npos) {
+        // the preamble is ignored
+        offset_ += data.size() - std::min(data.size(), delimiter_.size() - 1);
+        return false;
+      }
+      offset_ += pos + delimiter_.size();
+      state_ = State::kAfterDelimiter;
+      return true;
+    }
+
+    case State::kAfterDelimiter: {
+      if (data.size() < kFinalSuffix.size()) return false;
+      if (data.substr(0, kFinalSuffix.size()) == kFinalSuffix) {
+        // https://datatracker.ietf.org/doc/html/rfc2046#section-5.1.1
+        state_ = State::kEpilogue;
+        buffer_.clear();
+        offset_ = 0;
+        return false;
+      }
+
+      // transport padding is allowed before the line break
+      const auto pos = data.find(kCrLf);
+      auto padding = data.substr(0, pos);
+      if (pos == std::string_view::npos && !padding.empty() &&
+          padding.back() == kCrLf.front()) {
+        padding.remove_suffix(1);
+      }
+      if (!std::all_of(padding.begin(), padding.end(), IsWsp)) {
+        SetError("Unexpected characters after the boundary");
+        return false;
+      }
+      if (pos == std::string_view::npos) {
+        if (data.size() > kMaxPartHeadersSize) {
+          SetError("Too long line after the boundary");
+        }
+        return false;
+      }
+      // the line break is kept to find the end of empty headers
+      offset_ += pos;
+      state_ = State::kHeaders;
+      return true;
+    }
+
+    case State::kHeaders: {
+      const auto pos = data.find(kHeadersEnd);
+      if (pos == std::string_view::npos) {
+        if (data.size() > kMaxPartHeadersSize) {
+          SetError("Too large headers of a part");
+        }
+        return false;
+      }
+      if (!ParseHeaders(data.substr(kCrLf.size(), pos + kCrLf.size()))) {
+        SetError("Malformed headers of a part");
+        return false;
+      }
+      offset_ += pos + kHeadersEnd.size();
+      state_ = State::kValue;
+      return true;
+    }
+
+    case State::kValue: {
+      const auto pos = data.find(delimiter_);
+      if (pos == std::string_view::npos) {
+        // the tail may be the beginning of the delimiter
+        const auto size =
+            data.size() - std::min(data.size(), delimiter_.size() - 1);
+        if (size) handler_.OnPartData(data.substr(0, size));
+        offset_ += size;
+        return false;
+      }
+      if (pos) handler_.OnPartData(data.substr(0, pos));
+      handler_.OnPartEnd();
+      offset_ += pos + delimiter_.size();
+      state_ = State::kAfterDelimiter;
+      return true;
+    }
+
+    case State::kEpilogue:
+    case State::kError:
+      return false;
+  }
+  return false;
+}
+
+bool MultipartFormDataStreamParser::ParseHeaders(std::string_view headers) {
+  std::string name;
+  FormDataArg arg;
+  if (!ParseMultipartFormDataPartHeaders(headers, name, arg)) return false;
+
+  MultipartPartHeaders part_headers;
+  part_headers.name = std::move(name);
+  part_headers.content_disposition = std::string{arg.content_disposition};
+  part_headers.filename = std::move(arg.filename);
+  if (arg.content_type) part_headers.content_type.emplace(*arg.content_type);
+  handler_.OnPartBegin(std::move(part_headers));
+  return true;
+}
+
+void MultipartFormDataStreamParser::SetError(std::string_view reason) {
+  LOG_WARNING() << "Can't parse multipart/form-data: " << reason;
+  state_ = State::kError;
+  buffer_.clear();
+  offset_ = 0;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+struct MultipartPartHeaders {
+  std::string name;
+  std::string content_disposition;
+  std::optional<std::string> filename;
+  std::optional<std::string> content_type;
+};
+
+// Receives the parts of a multipart/form-data body as they arrive
+class MultipartPartHandler {
+ public:
+  virtual ~MultipartPartHandler() = default;
+
+  virtual void OnPartBegin(MultipartPartHeaders&& headers) = 0;
+  // Called zero or more times with the consecutive pieces of the part value
+  virtual void OnPartData(std::string_view data) = 0;
+  virtual void OnPartEnd() = 0;
+};
+
+// Incremental multipart/form-data parser, the body is fed in chunks of any
+// size and only the headers of a part and a possible partial delimiter are
+// buffered. Unlike ParseMultipartFormData() the line breaks must be CRLF.
+class MultipartFormDataStreamParser final {
+ public:
+  MultipartFormDataStreamParser(std::string boundary,
+                                MultipartPartHandler& handler);
+
+  // Returns false on malformed input, the rest of the body is ignored then
+  bool Feed(std::string_view chunk);
+
+  // Returns true if the final delimiter has been received
+  bool Finish();
+
+ private:
+  enum class State {
+    kPreamble,
+    kAfterDelimiter,
+    kHeaders,
+    kValue,
+    kEpilogue,
+    kError,
+  };
+
+  bool Step();
+  bool ParseHeaders(std::string_view headers);
+  void SetError(std::string_view reason);
+
+  // "\r\n--" + boundary
+  const std::string delimiter_;
+  MultipartPartHandler& handler_;
+  State state_{State::kPreamble};
+  std::string buffer_;
+  std::size_t offset_{0};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,207 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+
+#include <server/http/multipart_form_data_spool.hpp>
+#include <server/http/multipart_form_data_stream_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace sh = server::http;
+
+const std::string kBoundary = "------------------------8099aaf9723cd601";
+const std::string kBody =
+    "preamble\r\n"
+    "--------------------------8099aaf9723cd601\r\n"
+    "Content-Disposition: form-data; name=\"text\"\r\n"
+    "\r\n"
+    "default\r\n"
+    "--------------------------8099aaf9723cd601 \t\r\n"
+    "Content-Disposition: form-data; name=\"file1\"; filename=\"a.html\"\r\n"
+    "Content-Type: text/html\r\n"
+    "\r\n"
+    "<!DOCTYPE html><title>Content of a.html.</title>\n"
+    "\r\n--------------------------8099aaf9723cd60\r\n\r\n"
+    "--------------------------8099aaf9723cd601\r\n"
+    "Content-Disposition: form-data; name=\"empty\"\r\n"
+    "\r\n"
+    "\r\n"
+    "--------------------------8099aaf9723cd601--\r\n"
+    "epilogue";
+
+const std::string kHtml =
+    "<!DOCTYPE html><title>Content of a.html.</title>\n"
+    "\r\n--------------------------8099aaf9723cd60\r\n";
+
+struct Part {
+  sh::MultipartPartHeaders headers;
+  std::string value;
+  bool is_complete{false};
+};
+
+class PartsCollector final : public sh::MultipartPartHandler {
+ public:
+  void OnPartBegin(sh::MultipartPartHeaders&& headers) override {
+    parts.push_back({std::move(headers), {}, false});
+  }
+
+  void OnPartData(std::string_view data) override {
+    ASSERT_FALSE(parts.empty());
+    parts.back().value.append(data);
+  }
+
+  void OnPartEnd() override {
+    ASSERT_FALSE(parts.empty());
+    parts.back().is_complete = true;
+  }
+
+  std::vector<Part> parts;
+};
+
+bool FeedByChunks(sh::MultipartFormDataStreamParser& parser,
+                  std::string_view body, std::size_t chunk_size) {
+  while (!body.empty()) {
+    const auto size = std::min(chunk_size, body.size());
+    if (!parser.Feed(body.substr(0, size))) return false;
+    body.remove_prefix(size);
+  }
+  return parser.Finish();
+}
+
+}  // namespace
+
+TEST(MultipartFormDataStreamParser, Chunks) {
+  for (const std::size_t chunk_size : {1, 2, 3, 7, 46, 100, 4096}) {
+    PartsCollector collector;
+    sh::MultipartFormDataStreamParser parser{kBoundary, collector};
+    ASSERT_TRUE(FeedByChunks(parser, kBody, chunk_size)) << chunk_size;
+
+    const auto& parts = collector.parts;
+    ASSERT_EQ(parts.size(), 3) << chunk_size;
+
+    EXPECT_EQ(parts[0].headers.name, "text");
+    EXPECT_EQ(parts[0].headers.content_disposition,
+              R"(form-data; name="text")");
+    EXPECT_EQ(parts[0].headers.filename, std::nullopt);
+    EXPECT_EQ(parts[0].value, "default");
+
+    EXPECT_EQ(parts[1].headers.name, "file1");
+    EXPECT_EQ(parts[1].headers.filename, "a.html");
+    EXPECT_EQ(parts[1].headers.content_type, "text/html");
+    EXPECT_EQ(parts[1].value, kHtml) << chunk_size;
+
+    EXPECT_EQ(parts[2].headers.name, "empty");
+    EXPECT_EQ(parts[2].value, "");
+
+    for (const auto& part : parts) EXPECT_TRUE(part.is_complete);
+  }
+}
+
+TEST(MultipartFormDataStreamParser, NoPreamble) {
+  PartsCollector collector;
+  sh::MultipartFormDataStreamParser parser{"b", collector};
+  ASSERT_TRUE(FeedByChunks(parser,
+                           "--b\r\n"
+                           "Content-Disposition: form-data; name=\"x\"\r\n"
+                           "\r\n"
+                           "value\r\n"
+                           "--b--",
+                           1));
+  ASSERT_EQ(collector.parts.size(), 1);
+  EXPECT_EQ(collector.parts[0].value, "value");
+}
+
+TEST(MultipartFormDataStreamParser, Malformed) {
+  for (const std::string_view body : {
+           // no final delimiter
+           "--b\r\nContent-Disposition: form-data; name=\"x\"\r\n\r\nvalue",
+           // no Content-Disposition
+           "--b\r\nContent-Type: text/plain\r\n\r\nvalue\r\n--b--",
+           // no name
+           "--b\r\nContent-Disposition: form-data\r\n\r\nvalue\r\n--b--",
+           // garbage after the boundary
+           "--b\r\nContent-Disposition: form-data; name=\"x\"\r\n\r\n"
+           "value\r\n--bx\r\n",
+           // no delimiter at all
+           "value",
+       }) {
+    for (const std::size_t chunk_size : {1, 4096}) {
+      PartsCollector collector;
+      sh::MultipartFormDataStreamParser parser{"b", collector};
+      EXPECT_FALSE(FeedByChunks(parser, body, chunk_size)) << body;
+    }
+  }
+}
+
+TEST(MultipartFormDataStreamParser, TooLargeHeaders) {
+  PartsCollector collector;
+  sh::MultipartFormDataStreamParser parser{"b", collector};
+  ASSERT_TRUE(parser.Feed("--b\r\nContent-Disposition: form-data; name=\"x\""));
+  const std::string header_value(1024, 'a');
+  bool fed = true;
+  for (int i = 0; i < 100 && fed; ++i) {
+    fed = parser.Feed("; a=" + header_value);
+  }
+  EXPECT_FALSE(fed);
+}
+
+TEST(MultipartFormDataSpool, FileParts) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  std::string file_path;
+  {
+    sh::FormDataArgs args;
+    sh::MultipartFormDataSpool spool{dir.GetPath(), "", args};
+    sh::MultipartFormDataStreamParser parser{kBoundary, spool};
+    ASSERT_TRUE(FeedByChunks(parser, kBody, 5));
+    spool.Finish();
+
+    ASSERT_EQ(args.size(), 3);
+    ASSERT_EQ(args["text"].size(), 1);
+    EXPECT_EQ(args["text"][0].value, "default");
+    EXPECT_EQ(args["text"][0].file_path, std::nullopt);
+    EXPECT_EQ(args["text"][0].Charset(), "UTF-8");
+
+    ASSERT_EQ(args["file1"].size(), 1);
+    const auto& file = args["file1"][0];
+    EXPECT_EQ(file.value, "");
+    EXPECT_EQ(file.filename, "a.html");
+    EXPECT_EQ(file.content_type, "text/html");
+    ASSERT_TRUE(file.file_path);
+    file_path = *file.file_path;
+    EXPECT_EQ(fs::blocking::ReadFileContents(file_path), kHtml);
+
+    // the file part is not kept in memory
+    EXPECT_LT(spool.GetMemorySize(), kBody.size() - kHtml.size());
+  }
+  EXPECT_FALSE(fs::blocking::FileExists(file_path));
+}
+
+TEST(MultipartFormDataSpool, Charset) {
+  sh::FormDataArgs args;
+  sh::MultipartFormDataSpool spool{"/nonexistent", "koi8-r", args};
+  sh::MultipartFormDataStreamParser parser{"b", spool};
+  ASSERT_TRUE(FeedByChunks(parser,
+                           "--b\r\n"
+                           "Content-Disposition: form-data; name=\"x\"\r\n"
+                           "\r\n"
+                           "value\r\n"
+                           "--b\r\n"
+                           "Content-Disposition: form-data; name=_charset_\r\n"
+                           "\r\n"
+                           "windows-1251\r\n"
+                           "--b--",
+                           3));
+  spool.Finish();
+
+  ASSERT_EQ(args.size(), 1);
+  EXPECT_EQ(args["x"][0].Charset(), "windows-1251");
+}
+
+USERVER_NAMESPACE_END
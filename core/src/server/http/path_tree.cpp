@@ -0,0 +1,160 @@
+#include <server/http/path_tree.hpp>
+
+#include <algorithm>
+
+#include <boost/container/small_vector.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+constexpr std::string_view kAnySuffixMark{"*"};
+
+using Params = boost::container::small_vector<std::string_view, 8>;
+
+bool IsParamSegment(std::string_view segment) {
+  return segment.size() >= 2 && segment.front() == '{' &&
+         segment.back() == '}';
+}
+
+bool StartsWith(std::string_view str, std::string_view prefix) {
+  return str.substr(0, prefix.size()) == prefix;
+}
+
+}  // namespace
+
+struct PathTree::Node {
+  // The static part of the path consumed by the edge to this node
+  std::string prefix;
+
+  // First chars of the prefixes of the static children, they are distinct
+  std::string first_chars;
+  std::vector<std::unique_ptr<Node>> static_children;
+  std::unique_ptr<Node> param_child;
+
+  std::optional<std::size_t> route;
+  std::optional<std::size_t> any_suffix_route;
+
+  Node* AddStatic(std::string_view text);
+
+  bool Match(std::string_view rest, Params& params,
+             utils::function_ref<bool(const PathTreeMatch&)> accept) const;
+};
+
+PathTree::Node* PathTree::Node::AddStatic(std::string_view text) {
+  Node* node = this;
+  while (!text.empty()) {
+    const auto pos = node->first_chars.find(text.front());
+    if (pos == std::string::npos) {
+      auto child = std::make_unique<Node>();
+      child->prefix = std::string{text};
+      node->first_chars.push_back(text.front());
+      node->static_children.push_back(std::move(child));
+      return node->static_children.back().get();
+    }
+
+    auto& child = node->static_children[pos];
+    const auto common =
+        std::mismatch(child->prefix.begin(), child->prefix.end(), text.begin(),
+                      text.end())
+            .first -
+        child->prefix.begin();
+    if (static_cast<std::size_t>(common) < child->prefix.size()) {
+      // Split the edge at the end of the common prefix
+      auto split = std::make_unique<Node>();
+      split->prefix = child->prefix.substr(0, common);
+      child->prefix.erase(0, common);
+      split->first_chars.push_back(child->prefix.front());
+      split->static_children.push_back(std::move(child));
+      child = std::move(split);
+    }
+    node = child.get();
+    text.remove_prefix(common);
+  }
+  return node;
+}
+
+bool PathTree::Node::Match(
+    std::string_view rest, Params& params,
+    utils::function_ref<bool(const PathTreeMatch&)> accept) const {
+  if (rest.empty() && route &&
+      accept(PathTreeMatch{*route, params, std::nullopt})) {
+    return true;
+  }
+
+  if (!rest.empty()) {
+    const auto pos = first_chars.find(rest.front());
+    if (pos != std::string::npos) {
+      const auto& child = *static_children[pos];
+      if (StartsWith(rest, child.prefix) &&
+          child.Match(rest.substr(child.prefix.size()), params, accept)) {
+        return true;
+      }
+    }
+  }
+
+  if (param_child) {
+    const auto value = rest.substr(0, rest.find('/'));
+    params.push_back(value);
+    if (param_child->Match(rest.substr(value.size()), params, accept)) {
+      return true;
+    }
+    params.pop_back();
+  }
+
+  return any_suffix_route &&
+         accept(PathTreeMatch{*any_suffix_route, params, rest});
+}
+
+PathTree::PathTree() : root_(std::make_unique<Node>()) {}
+
+PathTree::PathTree(PathTree&&) noexcept = default;
+
+PathTree& PathTree::operator=(PathTree&&) noexcept = default;
+
+PathTree::~PathTree() = default;
+
+std::size_t PathTree::AddRoute(std::string_view path_template) {
+  Node* node = root_.get();
+  std::size_t segment_begin = 0;
+  std::size_t static_begin = 0;
+  while (true) {
+    const auto segment_end = std::min(path_template.find('/', segment_begin),
+                                      path_template.size());
+    const auto segment =
+        path_template.substr(segment_begin, segment_end - segment_begin);
+    const bool is_last = segment_end == path_template.size();
+
+    if (IsParamSegment(segment) || (is_last && segment == kAnySuffixMark)) {
+      node = node->AddStatic(
+          path_template.substr(static_begin, segment_begin - static_begin));
+      if (segment == kAnySuffixMark) {
+        if (!node->any_suffix_route) node->any_suffix_route = routes_count_++;
+        return *node->any_suffix_route;
+      }
+      if (!node->param_child) node->param_child = std::make_unique<Node>();
+      node = node->param_child.get();
+      static_begin = segment_end;
+    }
+
+    if (is_last) break;
+    segment_begin = segment_end + 1;
+  }
+
+  node = node->AddStatic(path_template.substr(static_begin));
+  if (!node->route) node->route = routes_count_++;
+  return *node->route;
+}
+
+bool PathTree::Match(
+    std::string_view path,
+    utils::function_ref<bool(const PathTreeMatch&)> accept) const {
+  Params params;
+  return root_->Match(path, params, accept);
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
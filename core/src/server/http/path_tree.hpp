@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// The result of a PathTree lookup
+struct PathTreeMatch {
+  /// The route returned by PathTree::AddRoute for the matched path
+  std::size_t route;
+  /// The values of the `{...}` path segments in the order of the segments
+  utils::span<const std::string_view> params;
+  /// The rest of the path matched by the trailing `*`, if any
+  std::optional<std::string_view> suffix;
+};
+
+/// Compressed radix tree of the path templates.
+///
+/// The static parts of the templates share the nodes by their common
+/// prefixes, a `{...}` segment matches any (possibly empty) path segment, the
+/// trailing `*` segment matches the rest of the path. The static parts are
+/// preferred over the `{...}` segments, which are preferred over `*`.
+class PathTree final {
+ public:
+  PathTree();
+  PathTree(PathTree&&) noexcept;
+  PathTree& operator=(PathTree&&) noexcept;
+  ~PathTree();
+
+  /// Returns the route of the path template, the templates that differ only
+  /// in the names of the `{...}` segments share the route. The routes are
+  /// numbered from 0 in the order of their addition.
+  std::size_t AddRoute(std::string_view path_template);
+
+  /// Calls `accept` for the matches of the `path` in the order of priority
+  /// until it returns true; returns whether it did
+  bool Match(std::string_view path,
+             utils::function_ref<bool(const PathTreeMatch&)> accept) const;
+
+  std::size_t GetRoutesCount() const { return routes_count_; }
+
+ private:
+  struct Node;
+
+  std::unique_ptr<Node> root_;
+  std::size_t routes_count_{0};
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
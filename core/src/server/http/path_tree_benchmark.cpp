@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <server/http/path_tree.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Resembles the routes of an API gateway: a few versions of many services,
+// each with a handful of resources
+std::vector<std::string> MakePathTemplates(std::size_t count) {
+  constexpr std::string_view kResources[] = {
+      "/items",
+      "/items/{item_id}",
+      "/items/{item_id}/history",
+      "/users/{user_id}/items/{item_id}",
+      "/files/*",
+  };
+  std::vector<std::string> result;
+  result.reserve(count);
+  for (std::size_t i = 0; result.size() < count; ++i) {
+    const auto prefix = fmt::format("/v{}/service-{}", i % 4, i);
+    for (const auto resource : kResources) {
+      if (result.size() == count) break;
+      result.push_back(prefix + std::string{resource});
+    }
+  }
+  return result;
+}
+
+std::vector<std::string> MakePaths(std::size_t routes_count) {
+  const std::size_t services = routes_count / 5;
+  std::vector<std::string> result;
+  const std::size_t step = std::max<std::size_t>(services / 64, 1);
+  for (std::size_t i = 0; i < services; i += step) {
+    const auto prefix = fmt::format("/v{}/service-{}", i % 4, i);
+    result.push_back(prefix + "/items/0123456789abcdef");
+    result.push_back(prefix + "/users/42/items/0123456789abcdef");
+    result.push_back(prefix + "/files/some/file.txt");
+  }
+  return result;
+}
+
+void path_tree_match(benchmark::State& state) {
+  server::http::impl::PathTree tree;
+  for (const auto& path_template : MakePathTemplates(state.range(0))) {
+    tree.AddRoute(path_template);
+  }
+  const auto paths = MakePaths(state.range(0));
+
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const bool matched = tree.Match(
+        paths[i++ % paths.size()],
+        [](const server::http::impl::PathTreeMatch& match) {
+          benchmark::DoNotOptimize(match.route);
+          return true;
+        });
+    benchmark::DoNotOptimize(matched);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(path_tree_match)->RangeMultiplier(4)->Range(64, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#include <server/http/path_tree.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTree;
+using server::http::impl::PathTreeMatch;
+
+struct Match {
+  std::size_t route;
+  std::vector<std::string> params;
+  std::optional<std::string> suffix;
+};
+
+std::optional<Match> MatchFirst(const PathTree& tree, std::string_view path) {
+  std::optional<Match> result;
+  tree.Match(path, [&result](const PathTreeMatch& match) {
+    result.emplace(Match{match.route,
+                         {match.params.begin(), match.params.end()},
+                         std::nullopt});
+    if (match.suffix) result->suffix.emplace(*match.suffix);
+    return true;
+  });
+  return result;
+}
+
+}  // namespace
+
+TEST(PathTree, Static) {
+  PathTree tree;
+  const auto abc = tree.AddRoute("/abc");
+  const auto abd = tree.AddRoute("/abd");
+  const auto ab = tree.AddRoute("/ab");
+  EXPECT_EQ(tree.GetRoutesCount(), 3);
+  EXPECT_EQ(tree.AddRoute("/abd"), abd);
+
+  EXPECT_EQ(MatchFirst(tree, "/abc")->route, abc);
+  EXPECT_EQ(MatchFirst(tree, "/abd")->route, abd);
+  EXPECT_EQ(MatchFirst(tree, "/ab")->route, ab);
+  EXPECT_FALSE(MatchFirst(tree, "/a"));
+  EXPECT_FALSE(MatchFirst(tree, "/abcd"));
+}
+
+TEST(PathTree, Params) {
+  PathTree tree;
+  const auto user = tree.AddRoute("/users/{id}");
+  const auto order = tree.AddRoute("/users/{id}/orders/{order}");
+  EXPECT_EQ(tree.AddRoute("/users/{name}"), user);
+
+  auto match = MatchFirst(tree, "/users/42");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->route, user);
+  EXPECT_EQ(match->params, std::vector<std::string>{"42"});
+  EXPECT_FALSE(match->suffix);
+
+  match = MatchFirst(tree, "/users/42/orders/7");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->route, order);
+  EXPECT_EQ(match->params, (std::vector<std::string>{"42", "7"}));
+
+  match = MatchFirst(tree, "/users/");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->params, std::vector<std::string>{""});
+
+  EXPECT_FALSE(MatchFirst(tree, "/users/42/orders"));
+}
+
+TEST(PathTree, Priority) {
+  PathTree tree;
+  const auto any = tree.AddRoute("/a/*");
+  const auto param = tree.AddRoute("/a/{x}");
+  const auto fixed = tree.AddRoute("/a/b");
+
+  EXPECT_EQ(MatchFirst(tree, "/a/b")->route, fixed);
+  EXPECT_EQ(MatchFirst(tree, "/a/bc")->route, param);
+  EXPECT_EQ(MatchFirst(tree, "/a/b/c")->route, any);
+  EXPECT_FALSE(MatchFirst(tree, "/a"));
+}
+
+TEST(PathTree, Backtracking) {
+  PathTree tree;
+  const auto fixed_first = tree.AddRoute("/a/{x}/c");
+  const auto param_first = tree.AddRoute("/{x}/b/d");
+
+  auto match = MatchFirst(tree, "/a/b/d");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->route, param_first);
+  EXPECT_EQ(match->params, std::vector<std::string>{"a"});
+
+  EXPECT_EQ(MatchFirst(tree, "/a/b/c")->route, fixed_first);
+
+  std::vector<std::size_t> routes;
+  tree.Match("/a/b/c", [&routes](const PathTreeMatch& match) {
+    routes.push_back(match.route);
+    return false;
+  });
+  EXPECT_EQ(routes, std::vector<std::size_t>{fixed_first});
+}
+
+TEST(PathTree, AnySuffix) {
+  PathTree tree;
+  const auto any = tree.AddRoute("/files/{bucket}/*");
+  const auto root = tree.AddRoute("*");
+
+  auto match = MatchFirst(tree, "/files/docs/a/b.txt");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->route, any);
+  EXPECT_EQ(match->params, std::vector<std::string>{"docs"});
+  EXPECT_EQ(match->suffix, "a/b.txt");
+
+  match = MatchFirst(tree, "/files/docs/");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->route, any);
+  EXPECT_EQ(match->suffix, "");
+
+  match = MatchFirst(tree, "/files/docs");
+  ASSERT_TRUE(match);
+  EXPECT_EQ(match->route, root);
+  EXPECT_EQ(match->suffix, "/files/docs");
+}
+
+TEST(PathTree, MiddleAsteriskIsStatic) {
+  PathTree tree;
+  const auto route = tree.AddRoute("/a/*/b");
+
+  EXPECT_EQ(MatchFirst(tree, "/a/*/b")->route, route);
+  EXPECT_FALSE(MatchFirst(tree, "/a/x/b"));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#include <server/http/send_file.hpp>
+
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+#ifdef __linux__
+// Limits the time a fs task processor thread is busy with a single socket
+constexpr std::uint64_t kSendFileChunkSize = 1024 * 1024;
+#endif
+constexpr std::uint64_t kReadChunkSize = 64 * 1024;
+
+struct SyscallResult {
+  ssize_t result;
+  int error;
+};
+
+// errno is thread local, so it is captured on the thread of the syscall
+template <typename Function>
+SyscallResult RunSyscall(engine::TaskProcessor& task_processor,
+                         Function function) {
+  return engine::AsyncNoSpan(task_processor,
+                             [&function] {
+                               const auto result = function();
+                               return SyscallResult{result,
+                                                    result < 0 ? errno : 0};
+                             })
+      .Get();
+}
+
+[[noreturn]] void ThrowFileTruncated() {
+  throw std::runtime_error("File is shorter than the response body");
+}
+
+std::size_t ReadChunk(int file_fd, char* buffer, std::size_t size,
+                      std::uint64_t offset,
+                      engine::TaskProcessor& fs_task_processor) {
+  while (true) {
+    const auto [result, error] = RunSyscall(fs_task_processor, [&] {
+      return ::pread(file_fd, buffer, size, static_cast<off_t>(offset));
+    });
+    if (result > 0) return static_cast<std::size_t>(result);
+    if (result == 0) ThrowFileTruncated();
+    if (error != EINTR) throw engine::io::IoSystemError(error, "pread");
+  }
+}
+
+std::size_t CopyFile(engine::io::RwBase& socket, int file_fd,
+                     std::uint64_t offset, std::uint64_t size,
+                     engine::TaskProcessor& fs_task_processor) {
+  std::string buffer(std::min(size, kReadChunkSize), '\0');
+  std::size_t sent_bytes = 0;
+  while (sent_bytes < size) {
+    const auto chunk_size =
+        ReadChunk(file_fd, buffer.data(),
+                  std::min<std::uint64_t>(size - sent_bytes, buffer.size()),
+                  offset + sent_bytes, fs_task_processor);
+    sent_bytes += socket.WriteAll(buffer.data(), chunk_size, {});
+  }
+  return sent_bytes;
+}
+
+#ifdef __linux__
+std::size_t SendFileToSocket(engine::io::Socket& socket, int file_fd,
+                             std::uint64_t offset, std::uint64_t size,
+                             engine::TaskProcessor& fs_task_processor) {
+  auto file_offset = static_cast<off_t>(offset);
+  std::size_t sent_bytes = 0;
+  while (sent_bytes < size) {
+    const auto chunk_size =
+        std::min<std::uint64_t>(size - sent_bytes, kSendFileChunkSize);
+    const auto [result, error] = RunSyscall(fs_task_processor, [&] {
+      return ::sendfile(socket.Fd(), file_fd, &file_offset, chunk_size);
+    });
+    if (result > 0) {
+      sent_bytes += static_cast<std::size_t>(result);
+      continue;
+    }
+    if (result == 0) ThrowFileTruncated();
+
+    if (error == EAGAIN || error == EWOULDBLOCK) {
+      if (!socket.WaitWriteable({})) {
+        throw engine::io::IoCancelled(sent_bytes) << "sendfile";
+      }
+    } else if (error != EINTR) {
+      throw engine::io::IoSystemError(error, "sendfile");
+    }
+  }
+  return sent_bytes;
+}
+#endif
+
+}  // namespace
+
+std::size_t SendFile(engine::io::RwBase& socket, int file_fd,
+                     std::uint64_t offset, std::uint64_t size,
+                     engine::TaskProcessor& fs_task_processor) {
+#ifdef __linux__
+  // TLS sockets are not engine::io::Socket, they need the data in userspace
+  if (auto* tcp_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+    return SendFileToSocket(*tcp_socket, file_fd, offset, size,
+                            fs_task_processor);
+  }
+#endif
+  return CopyFile(socket, file_fd, offset, size, fs_task_processor);
+}
+
+std::string ReadFile(int file_fd, std::uint64_t offset, std::uint64_t size,
+                     engine::TaskProcessor& fs_task_processor) {
+  std::string result(size, '\0');
+  std::size_t read_bytes = 0;
+  while (read_bytes < size) {
+    read_bytes += ReadChunk(file_fd, result.data() + read_bytes,
+                            size - read_bytes, offset + read_bytes,
+                            fs_task_processor);
+  }
+  return result;
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <userver/engine/io/common.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Writes `size` bytes of the file starting from `offset` to the socket and
+/// returns the number of bytes written.
+///
+/// Plain TCP sockets are written with sendfile() without copying the data to
+/// userspace, other sockets get the file in chunks. The blocking file
+/// operations are done on the `fs_task_processor`.
+std::size_t SendFile(engine::io::RwBase& socket, int file_fd,
+                     std::uint64_t offset, std::uint64_t size,
+                     engine::TaskProcessor& fs_task_processor);
+
+/// Reads `size` bytes of the file starting from `offset` on the
+/// `fs_task_processor`
+std::string ReadFile(int file_fd, std::uint64_t offset, std::uint64_t size,
+                     engine::TaskProcessor& fs_task_processor);
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
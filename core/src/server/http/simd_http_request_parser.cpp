@@ -0,0 +1,515 @@
+#include "simd_http_request_parser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// Generous upper bound for the method and the version in the request line
+constexpr std::size_t kMaxRequestLineOverhead = 64;
+
+// Returns the first occurrence of `first` or `second`, or `end`
+const char* FindFirstOf(const char* begin, const char* end, char first,
+                        char second) noexcept {
+#if defined(__AVX2__)
+  const auto first_32 = _mm256_set1_epi8(first);
+  const auto second_32 = _mm256_set1_epi8(second);
+  while (end - begin >= 32) {
+    const auto chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    const auto matches = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, first_32),
+                                         _mm256_cmpeq_epi8(chunk, second_32));
+    const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+    if (mask) return begin + __builtin_ctz(mask);
+    begin += 32;
+  }
+#endif
+#if defined(__SSE2__)
+  const auto first_16 = _mm_set1_epi8(first);
+  const auto second_16 = _mm_set1_epi8(second);
+  while (end - begin >= 16) {
+    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    const auto matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, first_16),
+                                      _mm_cmpeq_epi8(chunk, second_16));
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+    if (mask) return begin + __builtin_ctz(mask);
+    begin += 16;
+  }
+#elif defined(__ARM_NEON)
+  const auto first_16 = vdupq_n_u8(static_cast<std::uint8_t>(first));
+  const auto second_16 = vdupq_n_u8(static_cast<std::uint8_t>(second));
+  while (end - begin >= 16) {
+    const auto chunk = vld1q_u8(reinterpret_cast<const std::uint8_t*>(begin));
+    const auto matches =
+        vorrq_u8(vceqq_u8(chunk, first_16), vceqq_u8(chunk, second_16));
+    // Narrows every byte of the comparison result to 4 bits
+    const auto mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    if (mask) return begin + (__builtin_ctzll(mask) >> 2);
+    begin += 16;
+  }
+#endif
+  for (; begin != end; ++begin) {
+    if (*begin == first || *begin == second) return begin;
+  }
+  return end;
+}
+
+std::size_t Find(std::string_view str, char c) noexcept {
+  const auto* found = FindFirstOf(str.data(), str.data() + str.size(), c, c);
+  return found == str.data() + str.size() ? std::string_view::npos
+                                          : found - str.data();
+}
+
+constexpr auto kTokenChars = [] {
+  std::array<bool, 256> result{};
+  for (int c = '0'; c <= '9'; ++c) result[c] = true;
+  for (int c = 'a'; c <= 'z'; ++c) result[c] = true;
+  for (int c = 'A'; c <= 'Z'; ++c) result[c] = true;
+  for (const unsigned char c : std::string_view{"!#$%&'*+-.^_`|~"}) {
+    result[c] = true;
+  }
+  return result;
+}();
+
+bool IsToken(std::string_view str) noexcept {
+  if (str.empty()) return false;
+  for (const char c : str) {
+    if (!kTokenChars[static_cast<unsigned char>(c)]) return false;
+  }
+  return true;
+}
+
+bool IsValidHeaderValue(std::string_view str) noexcept {
+  for (const char c : str) {
+    const auto code = static_cast<unsigned char>(c);
+    if ((code < 0x20 && c != '\t') || code == 0x7f) return false;
+  }
+  return true;
+}
+
+std::string_view TrimOws(std::string_view str) noexcept {
+  while (!str.empty() && (str.front() == ' ' || str.front() == '\t')) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && (str.back() == ' ' || str.back() == '\t')) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept {
+  if (lhs.size() != rhs.size()) return false;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    if ((lhs[i] | 0x20) != (rhs[i] | 0x20)) return false;
+  }
+  return true;
+}
+
+// Calls `func` for every comma-separated element of a header value
+template <typename Func>
+void ForEachListElement(std::string_view value, Func func) {
+  while (!value.empty()) {
+    const auto comma = value.find(',');
+    func(TrimOws(value.substr(0, comma)));
+    if (comma == std::string_view::npos) break;
+    value.remove_prefix(comma + 1);
+  }
+}
+
+std::optional<std::uint64_t> ParseNumber(std::string_view str,
+                                         unsigned base) noexcept {
+  if (str.empty()) return std::nullopt;
+
+  std::uint64_t result = 0;
+  for (const char c : str) {
+    unsigned digit = 0;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (base == 16 && (c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+      digit = (c | 0x20) - 'a' + 10;
+    } else {
+      return std::nullopt;
+    }
+    if (result > (std::numeric_limits<std::uint64_t>::max() - digit) / base) {
+      return std::nullopt;
+    }
+    result = result * base + digit;
+  }
+  return result;
+}
+
+bool ParseHttpVersion(std::string_view version, unsigned short& major,
+                      unsigned short& minor) noexcept {
+  constexpr std::string_view kPrefix = "HTTP/";
+  if (version.size() != kPrefix.size() + 3 ||
+      version.substr(0, kPrefix.size()) != kPrefix) {
+    return false;
+  }
+  version.remove_prefix(kPrefix.size());
+  if (version[0] < '0' || version[0] > '9' || version[1] != '.' ||
+      version[2] < '0' || version[2] > '9') {
+    return false;
+  }
+  major = version[0] - '0';
+  minor = version[2] - '0';
+  return true;
+}
+
+HttpMethod ParseMethod(std::string_view method) {
+  try {
+    return HttpMethodFromString(method);
+  } catch (const std::exception&) {
+    return HttpMethod::kUnknown;
+  }
+}
+
+}  // namespace
+
+SimdHttpRequestParser::SimdHttpRequestParser(
+    const HandlerInfoIndex& handler_info_index,
+    const request::HttpRequestConfig& request_config,
+    OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
+    request::ResponseDataAccounter& data_accounter)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter) {}
+
+void SimdHttpRequestParser::SetReceiveSlab(net::ReceiveSlab slab) {
+  receive_slab_ = std::move(slab);
+}
+
+void SimdHttpRequestParser::SetMemoryBudget(std::shared_ptr<net::MemoryBudget> budget) {
+  memory_budget_ = std::move(budget);
+}
+
+bool SimdHttpRequestParser::Parse(const char* data, size_t size) {
+  const auto result = ParseImpl({data, size});
+  if (result == Result::kOk) return true;
+
+  if (result == Result::kError) {
+    LOG_WARNING() << "malformed request, size=" << size
+                  << " state=" << static_cast<int>(state_);
+  }
+  FinalizeRequest();
+  return false;
+}
+
+SimdHttpRequestParser::Result SimdHttpRequestParser::ParseImpl(
+    std::string_view data) {
+  while (!data.empty()) {
+    if (state_ == State::kBody || state_ == State::kChunkData) {
+      if (!OnBody(data)) return Result::kError;
+      continue;
+    }
+
+    const auto line = ReadLine(data);
+    if (!line) return OnLongLine() ? Result::kOk : Result::kError;
+
+    auto result = Result::kOk;
+    switch (state_) {
+      case State::kRequestLine:
+        if (!OnRequestLine(*line)) result = Result::kError;
+        break;
+      case State::kHeaders:
+        result = OnHeaderLine(*line);
+        break;
+      case State::kChunkSize:
+        if (!OnChunkSize(*line)) result = Result::kError;
+        break;
+      case State::kChunkDataEnd:
+        if (!line->empty()) {
+          result = Result::kError;
+        } else {
+          state_ = State::kChunkSize;
+        }
+        break;
+      case State::kTrailers:
+        if (line->empty() && !OnMessageComplete()) result = Result::kError;
+        break;
+      case State::kBody:
+      case State::kChunkData:
+        UASSERT(false);
+        break;
+    }
+
+    line_buffer_.clear();
+    is_line_buffered_ = false;
+    if (result != Result::kOk) return result;
+  }
+  return Result::kOk;
+}
+
+std::optional<std::string_view> SimdHttpRequestParser::ReadLine(
+    std::string_view& data) {
+  const auto newline = Find(data, '\n');
+  if (newline == std::string_view::npos) {
+    line_buffer_.append(data);
+    is_line_buffered_ = true;
+    data = {};
+    return std::nullopt;
+  }
+
+  std::string_view line;
+  if (is_line_buffered_) {
+    line_buffer_.append(data.data(), newline);
+    line = line_buffer_;
+  } else {
+    line = data.substr(0, newline);
+  }
+  data.remove_prefix(newline + 1);
+
+  // Bare LF is tolerated, see RFC 9112 2.2
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+bool SimdHttpRequestParser::OnLongLine() {
+  const auto& config = request_constructor_config_;
+  switch (state_) {
+    case State::kRequestLine:
+      if (line_buffer_.size() <=
+          config.max_url_size + kMaxRequestLineOverhead) {
+        return true;
+      }
+      if (!request_constructor_) CreateRequestConstructor();
+      try {
+        // Sets the status for the response
+        request_constructor_->AppendUrl(line_buffer_.data(),
+                                        line_buffer_.size());
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't append url: " << ex;
+      }
+      return false;
+    case State::kHeaders:
+      if (line_buffer_.size() <= config.max_headers_size) return true;
+      try {
+        request_constructor_->AppendHeaderField(line_buffer_.data(),
+                                                line_buffer_.size());
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't append header field: " << ex;
+      }
+      return false;
+    default:
+      return line_buffer_.size() <= config.max_headers_size;
+  }
+}
+
+bool SimdHttpRequestParser::OnRequestLine(std::string_view line) {
+  // Empty lines before the request line are ignored, see RFC 9112 2.2
+  if (line.empty()) return true;
+
+  CreateRequestConstructor();
+
+  const auto method_end = Find(line, ' ');
+  const auto url_end = line.rfind(' ');
+  if (method_end == std::string_view::npos || url_end == method_end) {
+    return false;
+  }
+  const auto method = line.substr(0, method_end);
+  const auto url = line.substr(method_end + 1, url_end - method_end - 1);
+  if (!IsToken(method) || url.empty() ||
+      !ParseHttpVersion(line.substr(url_end + 1), http_major_, http_minor_)) {
+    return false;
+  }
+
+  LOG_TRACE() << "url: '" << url << '\'';
+  request_constructor_->SetMethod(ParseMethod(method));
+  request_constructor_->SetHttpMajor(http_major_);
+  request_constructor_->SetHttpMinor(http_minor_);
+  is_connect_ = method == "CONNECT";
+  try {
+    request_constructor_->AppendUrl(url.data(), url.size());
+    request_constructor_->ParseUrl();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse url: " << ex;
+    return false;
+  }
+
+  state_ = State::kHeaders;
+  return true;
+}
+
+SimdHttpRequestParser::Result SimdHttpRequestParser::OnHeaderLine(
+    std::string_view line) {
+  if (line.empty()) return OnHeadersComplete();
+
+  // Obsolete line folding is rejected, see RFC 9112 5.2
+  if (line.front() == ' ' || line.front() == '\t') return Result::kError;
+
+  const auto colon = Find(line, ':');
+  if (colon == std::string_view::npos) return Result::kError;
+  const auto name = line.substr(0, colon);
+  const auto value = TrimOws(line.substr(colon + 1));
+  if (!IsToken(name) || !IsValidHeaderValue(value)) return Result::kError;
+
+  return OnHeader(name, value) ? Result::kOk : Result::kError;
+}
+
+bool SimdHttpRequestParser::OnHeader(std::string_view name,
+                                     std::string_view value) {
+  LOG_TRACE() << "header: '" << name << "': '" << value << '\'';
+
+  if (EqualsIgnoreCase(name, "Content-Length")) {
+    const auto content_length = ParseNumber(value, 10);
+    if (!content_length ||
+        (content_length_ && *content_length_ != *content_length)) {
+      return false;
+    }
+    content_length_ = content_length;
+  } else if (EqualsIgnoreCase(name, "Transfer-Encoding")) {
+    // Only chunked is supported as the final coding, see RFC 9112 6.3
+    std::string_view last_coding;
+    ForEachListElement(value, [&](std::string_view coding) {
+      if (!coding.empty()) last_coding = coding;
+    });
+    if (!EqualsIgnoreCase(last_coding, "chunked")) return false;
+    is_chunked_ = true;
+  } else if (EqualsIgnoreCase(name, "Connection")) {
+    ForEachListElement(value, [this](std::string_view option) {
+      if (EqualsIgnoreCase(option, "close")) has_connection_close_ = true;
+      if (EqualsIgnoreCase(option, "keep-alive")) {
+        has_connection_keep_alive_ = true;
+      }
+      if (EqualsIgnoreCase(option, "upgrade")) has_connection_upgrade_ = true;
+    });
+  } else if (EqualsIgnoreCase(name, "Upgrade")) {
+    has_upgrade_ = true;
+  }
+
+  try {
+    request_constructor_->AppendHeader(name, value);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append header: " << ex;
+    return false;
+  }
+  return true;
+}
+
+SimdHttpRequestParser::Result SimdHttpRequestParser::OnHeadersComplete() {
+  // Request smuggling protection, see RFC 9112 6.1
+  if (is_chunked_ && content_length_) return Result::kError;
+
+  LOG_TRACE() << "headers complete";
+
+  // Same as http_parser, the request is finalized and the rest of the data
+  // belongs to the new protocol
+  if (is_connect_ || (has_upgrade_ && has_connection_upgrade_)) {
+    return Result::kUpgrade;
+  }
+
+  if (is_chunked_) {
+    state_ = State::kChunkSize;
+  } else if (content_length_.value_or(0) != 0) {
+    body_remaining_ = *content_length_;
+    state_ = State::kBody;
+  } else if (!OnMessageComplete()) {
+    return Result::kError;
+  }
+  return Result::kOk;
+}
+
+bool SimdHttpRequestParser::OnBody(std::string_view& data) {
+  const auto size =
+      static_cast<std::size_t>(std::min<std::uint64_t>(body_remaining_,
+                                                       data.size()));
+  try {
+    request_constructor_->AppendBody(data.data(), size, receive_slab_);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't append body: " << ex;
+    return false;
+  }
+  data.remove_prefix(size);
+  body_remaining_ -= size;
+
+  if (body_remaining_ != 0) return true;
+  if (state_ == State::kChunkData) {
+    state_ = State::kChunkDataEnd;
+    return true;
+  }
+  return OnMessageComplete();
+}
+
+bool SimdHttpRequestParser::OnChunkSize(std::string_view line) {
+  // Chunk extensions are ignored
+  const auto size = ParseNumber(TrimOws(line.substr(0, line.find(';'))), 16);
+  if (!size) return false;
+
+  if (*size == 0) {
+    state_ = State::kTrailers;
+  } else {
+    body_remaining_ = *size;
+    state_ = State::kChunkData;
+  }
+  return true;
+}
+
+bool SimdHttpRequestParser::OnMessageComplete() {
+  const bool should_keep_alive = (http_major_ > 0 && http_minor_ > 0)
+                                     ? !has_connection_close_
+                                     : has_connection_keep_alive_;
+  request_constructor_->SetIsFinal(!should_keep_alive);
+  LOG_TRACE() << "message complete";
+  if (!FinalizeRequest()) return false;
+
+  state_ = State::kRequestLine;
+  return true;
+}
+
+void SimdHttpRequestParser::CreateRequestConstructor() {
+  ++stats_.parsing_request_count;
+  request_constructor_.emplace(request_constructor_config_, handler_info_index_,
+                               data_accounter_);
+  if (memory_budget_) request_constructor_->SetMemoryBudget(memory_budget_);
+  http_major_ = 1;
+  http_minor_ = 1;
+  content_length_.reset();
+  body_remaining_ = 0;
+  is_chunked_ = false;
+  is_connect_ = false;
+  has_connection_close_ = false;
+  has_connection_keep_alive_ = false;
+  has_connection_upgrade_ = false;
+  has_upgrade_ = false;
+}
+
+bool SimdHttpRequestParser::FinalizeRequest() {
+  bool res = FinalizeRequestImpl();
+  --stats_.parsing_request_count;
+  request_constructor_.reset();
+  return res;
+}
+
+bool SimdHttpRequestParser::FinalizeRequestImpl() {
+  if (!request_constructor_) CreateRequestConstructor();
+
+  if (auto request = request_constructor_->Finalize()) {
+    on_new_request_cb_(std::move(request));
+  } else {
+    LOG_ERROR() << "request is null after Finalize()";
+    return false;
+  }
+  return true;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
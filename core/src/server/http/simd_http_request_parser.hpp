@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+#include "http_request_parser.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief HTTP/1.x request parser that searches for the delimiters 16 or 32
+/// bytes at a time (SSE2, AVX2 or NEON, depending on the target).
+///
+/// A drop-in replacement for HttpRequestParser: the headers and the body are
+/// passed to HttpRequestConstructor right from the receive buffer, only an
+/// incomplete line is copied between the Parse calls. Trailers of chunked
+/// requests are skipped.
+class SimdHttpRequestParser final : public request::RequestParser {
+ public:
+  using OnNewRequestCb = HttpRequestParser::OnNewRequestCb;
+
+  SimdHttpRequestParser(const HandlerInfoIndex& handler_info_index,
+                        const request::HttpRequestConfig& request_config,
+                        OnNewRequestCb&& on_new_request_cb,
+                        net::ParserStats& stats,
+                        request::ResponseDataAccounter& data_accounter);
+
+  SimdHttpRequestParser(SimdHttpRequestParser&&) = delete;
+  SimdHttpRequestParser& operator=(SimdHttpRequestParser&&) = delete;
+
+  bool Parse(const char* data, size_t size) override;
+
+  void SetReceiveSlab(net::ReceiveSlab slab) override;
+
+  void SetMemoryBudget(std::shared_ptr<net::MemoryBudget> budget) override;
+
+ private:
+  enum class State {
+    kRequestLine,
+    kHeaders,
+    kBody,
+    kChunkSize,
+    kChunkData,
+    kChunkDataEnd,
+    kTrailers,
+  };
+
+  enum class Result { kOk, kError, kUpgrade };
+
+  Result ParseImpl(std::string_view data);
+  std::optional<std::string_view> ReadLine(std::string_view& data);
+  bool OnLongLine();
+
+  bool OnRequestLine(std::string_view line);
+  Result OnHeaderLine(std::string_view line);
+  bool OnHeader(std::string_view name, std::string_view value);
+  Result OnHeadersComplete();
+  bool OnBody(std::string_view& data);
+  bool OnChunkSize(std::string_view line);
+  bool OnMessageComplete();
+
+  void CreateRequestConstructor();
+
+  bool FinalizeRequest();
+  bool FinalizeRequestImpl();
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+
+  OnNewRequestCb on_new_request_cb_;
+
+  State state_{State::kRequestLine};
+  // An incomplete line from the previous Parse calls
+  std::string line_buffer_;
+  bool is_line_buffered_{false};
+
+  std::optional<HttpRequestConstructor> request_constructor_;
+  unsigned short http_major_{1};
+  unsigned short http_minor_{1};
+  std::optional<std::uint64_t> content_length_;
+  std::uint64_t body_remaining_{0};
+  bool is_chunked_{false};
+  bool is_connect_{false};
+  bool has_connection_close_{false};
+  bool has_connection_keep_alive_{false};
+  bool has_connection_upgrade_{false};
+  bool has_upgrade_{false};
+
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+  net::ReceiveSlab receive_slab_;
+  std::shared_ptr<net::MemoryBudget> memory_budget_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,156 @@
+#include <server/http/simd_http_request_parser.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <userver/server/http/http_request.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <server/http/http_request_impl.hpp>
+
+#include "create_parser_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using SimdParser = server::http::SimdHttpRequestParser;
+using ReferenceParser = server::http::HttpRequestParser;
+
+std::string Describe(const server::request::RequestBase& request) {
+  const auto& impl =
+      dynamic_cast<const server::http::HttpRequestImpl&>(request);
+  const server::http::HttpRequest http_request(
+      const_cast<server::http::HttpRequestImpl&>(impl));
+
+  std::vector<std::string> headers;
+  for (const auto& name : http_request.GetHeaderNames()) {
+    headers.push_back(fmt::format("{}={}", name, http_request.GetHeader(name)));
+  }
+  std::sort(headers.begin(), headers.end());
+
+  return fmt::format(
+      "{} {} HTTP/{}.{} path={} final={} status={} body='{}' headers=[{}]",
+      impl.GetMethodStr(), impl.GetUrl(), impl.GetHttpMajor(),
+      impl.GetHttpMinor(), impl.GetRequestPath(), impl.IsFinal(),
+      static_cast<int>(impl.GetHttpResponse().GetStatus()),
+      http_request.RequestBody(), fmt::join(headers, ","));
+}
+
+struct ParseResult {
+  std::vector<std::string> requests;
+  bool is_ok{true};
+
+  bool operator==(const ParseResult& other) const {
+    return requests == other.requests && is_ok == other.is_ok;
+  }
+};
+
+template <typename Parser>
+ParseResult ParseInChunks(std::string_view data, std::size_t chunk_size) {
+  ParseResult result;
+  auto parser = server::CreateTestParser<Parser>(
+      [&result](std::shared_ptr<server::request::RequestBase>&& request) {
+        result.requests.push_back(Describe(*request));
+      });
+
+  while (!data.empty() && result.is_ok) {
+    const auto chunk = data.substr(0, chunk_size);
+    result.is_ok = parser.Parse(chunk.data(), chunk.size());
+    data.remove_prefix(chunk.size());
+  }
+  return result;
+}
+
+class SimdHttpRequestParserSameAsHttpParser
+    : public ::testing::TestWithParam<std::string> {};
+
+class SimdHttpRequestParserMalformed
+    : public ::testing::TestWithParam<std::string> {};
+
+}  // namespace
+
+INSTANTIATE_UTEST_SUITE_P(
+    /**/, SimdHttpRequestParserSameAsHttpParser,
+    ::testing::Values(
+        "GET / HTTP/1.1\r\n\r\n",
+        "GET /path/to?a=b&c=d HTTP/1.1\r\nHost: localhost\r\n"
+        "X-Header:  value with spaces\r\nCookie: a=b; c=d\r\n\r\n",
+        "POST /post HTTP/1.1\r\nContent-Length: 11\r\n\r\nhello world",
+        "POST /chunked HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+        "5;ext=1\r\nhello\r\n6\r\n world\r\n0\r\n\r\n",
+        "GET /first HTTP/1.1\r\n\r\nPOST /second HTTP/1.1\r\n"
+        "Content-Length: 3\r\n\r\nabcGET /third HTTP/1.1\r\n\r\n",
+        "GET /close HTTP/1.1\r\nConnection: close\r\n\r\n",
+        "GET /old HTTP/1.0\r\n\r\n",
+        "GET /old-keep-alive HTTP/1.0\r\nConnection: keep-alive\r\n\r\n",
+        "\r\nGET /leading-crlf HTTP/1.1\r\n\r\n",
+        "PROPFIND /unknown-method HTTP/1.1\r\n\r\n",
+        "GET /ws HTTP/1.1\r\nConnection: Upgrade\r\nUpgrade: websocket\r\n"
+        "\r\n"));
+
+UTEST_P(SimdHttpRequestParserSameAsHttpParser, AnySplit) {
+  const std::string& data = GetParam();
+  const auto expected = ParseInChunks<ReferenceParser>(data, data.size());
+  ASSERT_FALSE(expected.requests.empty());
+
+  for (std::size_t chunk_size = 1; chunk_size <= data.size(); ++chunk_size) {
+    EXPECT_EQ(ParseInChunks<SimdParser>(data, chunk_size), expected)
+        << "chunk_size=" << chunk_size;
+  }
+}
+
+INSTANTIATE_UTEST_SUITE_P(
+    /**/, SimdHttpRequestParserMalformed,
+    ::testing::Values("GET / HTTP/1.1\r\nBad Header: value\r\n\r\n",
+                      "GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n",
+                      "GET / HTTP/1.1\r\nFolded: value\r\n continued\r\n\r\n",
+                      "GET /no-version\r\n\r\n", "garbage\r\n\r\n"));
+
+UTEST_P(SimdHttpRequestParserMalformed, AnySplit) {
+  const std::string& data = GetParam();
+  ASSERT_FALSE(ParseInChunks<ReferenceParser>(data, data.size()).is_ok);
+
+  for (std::size_t chunk_size = 1; chunk_size <= data.size(); ++chunk_size) {
+    const auto result = ParseInChunks<SimdParser>(data, chunk_size);
+    EXPECT_FALSE(result.is_ok) << "chunk_size=" << chunk_size;
+    EXPECT_EQ(result.requests.size(), 1) << "chunk_size=" << chunk_size;
+  }
+}
+
+UTEST(SimdHttpRequestParser, LongHeader) {
+  const std::string header(100'000, 'a');
+  const auto data = "GET / HTTP/1.1\r\nX-Long: " + header + "\r\n\r\n";
+
+  const auto result = ParseInChunks<SimdParser>(data, 4096);
+  EXPECT_FALSE(result.is_ok);
+  ASSERT_EQ(result.requests.size(), 1);
+  EXPECT_NE(result.requests.front().find("status=431"), std::string::npos);
+}
+
+UTEST(SimdHttpRequestParser, LongUrl) {
+  const std::string path(100'000, 'a');
+  const auto data = "GET /" + path + " HTTP/1.1\r\n\r\n";
+
+  const auto result = ParseInChunks<SimdParser>(data, 4096);
+  EXPECT_FALSE(result.is_ok);
+  ASSERT_EQ(result.requests.size(), 1);
+  EXPECT_NE(result.requests.front().find("status=414"), std::string::npos);
+}
+
+UTEST(SimdHttpRequestParser, ContentLengthWithChunked) {
+  const std::string data =
+      "POST / HTTP/1.1\r\nContent-Length: 5\r\n"
+      "Transfer-Encoding: chunked\r\n\r\n0\r\n\r\n";
+
+  const auto result = ParseInChunks<SimdParser>(data, data.size());
+  EXPECT_FALSE(result.is_ok);
+  ASSERT_EQ(result.requests.size(), 1);
+  EXPECT_NE(result.requests.front().find("status=400"), std::string::npos);
+}
+
+USERVER_NAMESPACE_END
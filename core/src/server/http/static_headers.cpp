@@ -0,0 +1,77 @@
+#include <server/http/static_headers.hpp>
+
+#include <array>
+#include <iterator>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/small_string.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+namespace headers = USERVER_NAMESPACE::http::headers;
+
+// The server sets these for each response according to its body and
+// connection
+constexpr std::array kForbiddenHeaders{
+    headers::kContentLength,
+    headers::kTransferEncoding,
+    headers::kConnection,
+};
+
+}  // namespace
+
+StaticHeaders::StaticHeaders(const std::map<std::string, std::string>& headers)
+    : headers_(headers.size()) {
+  names_.reserve(headers.size());
+  keys_.reserve(headers.size());
+
+  for (const auto& [name, value] : headers) {
+    impl::CheckHeaderName(name);
+    impl::CheckHeaderValue(value);
+    for (const auto& forbidden : kForbiddenHeaders) {
+      if (utils::StrIcaseEqual{}(name, forbidden)) {
+        throw std::runtime_error(fmt::format(
+            "Header '{}' can not be static, it is set by the server", name));
+      }
+    }
+
+    headers_.emplace(name, value);
+    names_.push_back(name);
+    keys_.emplace_back(names_.back());
+    fmt::format_to(std::back_inserter(block_), "{}: {}\r\n", name, value);
+  }
+}
+
+void StaticHeaders::OutputInHttpFormat(
+    const headers::HeaderMap& overrides,
+    headers::HeadersString& header) const {
+  bool is_overridden = false;
+  for (const auto& key : keys_) {
+    if (overrides.contains(key)) {
+      is_overridden = true;
+      break;
+    }
+  }
+
+  if (!is_overridden) {
+    header.append(block_);
+    return;
+  }
+  for (std::size_t i = 0; i < keys_.size(); ++i) {
+    if (overrides.contains(keys_[i])) continue;
+    impl::OutputHeader(header, names_[i], headers_.at(keys_[i]));
+  }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/http/header_map.hpp>
+#include <userver/http/predefined_header.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// Response headers that are the same for all the responses of a handler.
+///
+/// The HTTP/1.x block of the headers is formatted once and memcpy'd into each
+/// response, unless the response sets some of these headers itself.
+class StaticHeaders final {
+ public:
+  /// @throws std::runtime_error on invalid headers or the headers that are
+  /// set by the server for each response (Content-Length etc.)
+  explicit StaticHeaders(const std::map<std::string, std::string>& headers);
+
+  // The lookup keys refer to the names
+  StaticHeaders(const StaticHeaders&) = delete;
+  StaticHeaders& operator=(const StaticHeaders&) = delete;
+
+  bool Contains(
+      const USERVER_NAMESPACE::http::headers::PredefinedHeader& name) const {
+    return headers_.contains(name);
+  }
+
+  /// Appends the headers that are not in `overrides` in the HTTP/1.x format
+  void OutputInHttpFormat(
+      const USERVER_NAMESPACE::http::headers::HeaderMap& overrides,
+      USERVER_NAMESPACE::http::headers::HeadersString& header) const;
+
+  const USERVER_NAMESPACE::http::headers::HeaderMap& GetHeaders() const {
+    return headers_;
+  }
+
+ private:
+  USERVER_NAMESPACE::http::headers::HeaderMap headers_;
+  std::vector<std::string> names_;
+  // Hashes of the names_ are computed once
+  std::vector<USERVER_NAMESPACE::http::headers::PredefinedHeader> keys_;
+  std::string block_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#include <server/http/static_headers.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/small_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string Output(const server::http::StaticHeaders& static_headers,
+                   const http::headers::HeaderMap& overrides) {
+  http::headers::HeadersString result;
+  static_headers.OutputInHttpFormat(overrides, result);
+  return std::string{result.data(), result.size()};
+}
+
+}  // namespace
+
+TEST(StaticHeaders, Block) {
+  const server::http::StaticHeaders static_headers{{
+      {"Cache-Control", "no-cache"},
+      {"X-Static", "value"},
+  }};
+
+  EXPECT_TRUE(static_headers.Contains(http::headers::kCacheControl));
+  EXPECT_FALSE(static_headers.Contains(http::headers::kContentType));
+  EXPECT_EQ(Output(static_headers, {}),
+            "Cache-Control: no-cache\r\nX-Static: value\r\n");
+  EXPECT_EQ(Output(static_headers, {{"X-Other", "other"}}),
+            "Cache-Control: no-cache\r\nX-Static: value\r\n");
+}
+
+TEST(StaticHeaders, Overridden) {
+  const server::http::StaticHeaders static_headers{{
+      {"Cache-Control", "no-cache"},
+      {"X-Static", "value"},
+  }};
+
+  EXPECT_EQ(Output(static_headers, {{"cache-control", "max-age=60"}}),
+            "X-Static: value\r\n");
+  EXPECT_EQ(Output(static_headers, {{"x-static", "1"}, {"Cache-Control", "2"}}),
+            "");
+}
+
+TEST(StaticHeaders, Invalid) {
+  using Headers = std::map<std::string, std::string>;
+  using server::http::StaticHeaders;
+  EXPECT_ANY_THROW(StaticHeaders(Headers{{"Content-Length", "1"}}));
+  EXPECT_ANY_THROW(StaticHeaders(Headers{{"connection", "close"}}));
+  EXPECT_ANY_THROW(StaticHeaders(Headers{{"Bad Name", "value"}}));
+  EXPECT_ANY_THROW(StaticHeaders(Headers{{"X-Header", "bad\r\nvalue"}}));
+}
+
+USERVER_NAMESPACE_END
@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <array>
+#include <optional>
 #include <stdexcept>
+#include <string_view>
 #include <system_error>
 #include <vector>
 
-#include <server/http/http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
+#include <server/net/receive_buffer.hpp>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/exception.hpp>
@@ -15,6 +17,7 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_config.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
@@ -30,13 +33,17 @@ Connection::Connection(
     const engine::io::Sockaddr& remote_address,
     const http::RequestHandlerBase& request_handler,
     std::shared_ptr<Stats> stats,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<ReceiveSlabPool> receive_slab_pool)
     : config_(config),
       handler_defaults_config_(handler_defaults_config),
       peer_socket_(std::move(peer_socket)),
       request_handler_(request_handler),
       stats_(std::move(stats)),
       data_accounter_(data_accounter),
+      receive_slab_pool_(std::move(receive_slab_pool)),
+      memory_budget_(
+          std::make_shared<MemoryBudget>(config_.memory_budget, stats_)),
       remote_address_(remote_address),
       peer_name_(remote_address_.PrimaryAddressString()),
       request_tasks_(Queue::Create()) {
@@ -82,6 +89,8 @@ void Connection::Shutdown() noexcept {
                  "requests) for fd "
               << Fd();
 
+  // Refers to the socket
+  http2_session_.reset();
   peer_socket_.reset();
 
   --stats_->active_connections;
@@ -98,21 +107,23 @@ void Connection::ListenForRequests(
     Queue::Producer producer, engine::TaskCancellationToken token) noexcept {
   using RequestBasePtr = std::shared_ptr<request::RequestBase>;
   utils::FastScopeGuard send_stopper([&]() noexcept { token.RequestCancel(); });
+  // Nothing will unblock the HTTP/2 responses waiting for the peer any more
+  utils::FastScopeGuard http2_stopper([this]() noexcept {
+    if (http2_session_) http2_session_->StopReceiving();
+  });
 
   try {
     request_tasks_->SetSoftMaxSize(config_.requests_queue_size_threshold);
 
-    http::HttpRequestParser request_parser(
-        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
-        [this, &producer](RequestBasePtr&& request_ptr) {
-          if (!NewRequest(std::move(request_ptr), producer)) {
-            is_accepting_requests_ = false;
-          }
-        },
-        stats_->parser_stats, data_accounter_);
+    std::unique_ptr<request::RequestParser> http1_parser;
+    request::RequestParser* request_parser = nullptr;
+    // Bytes received before the protocol is known
+    std::string first_bytes;
 
-    std::vector<char> buf(config_.in_buffer_size);
+    auto buf = receive_slab_pool_ ? ReceiveBuffer{receive_slab_pool_}
+                                  : ReceiveBuffer{config_.in_buffer_size};
     std::size_t last_bytes_read = 0;
+    bool is_buffer_filled = false;
     while (is_accepting_requests_) {
       auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
@@ -127,13 +138,19 @@ void Connection::ListenForRequests(
       // 3. recv (return some data)
       //
       // So instead we just do 2. and 3., shaving off a whole recv syscall
-      if (last_bytes_read != buf.size()) {
+      if (!is_buffer_filled) {
+        // The connection may stay idle for long, so the pooled slab is given
+        // back for other connections to receive into
+        buf.Release();
         is_readable = peer_socket_->WaitReadable(deadline);
       }
 
+      const auto space = buf.Prepare();
       last_bytes_read =
-          is_readable ? peer_socket_->ReadSome(buf.data(), buf.size(), deadline)
-                      : 0;
+          is_readable
+              ? peer_socket_->ReadSome(space.data(), space.size(), deadline)
+              : 0;
+      is_buffer_filled = last_bytes_read == space.size();
       if (!last_bytes_read) {
         LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
                     << " closed connection or the connection timed out";
@@ -150,7 +167,38 @@ void Connection::ListenForRequests(
       LOG_TRACE() << "Received " << last_bytes_read << " byte(s) from "
                   << Getpeername() << " on fd " << Fd();
 
-      if (!request_parser.Parse(buf.data(), last_bytes_read)) {
+      std::string_view data = buf.Commit(last_bytes_read);
+      if (!request_parser) {
+        if (config_.http_version == HttpVersion::kHttp2) {
+          first_bytes.append(data);
+          data = first_bytes;
+          const auto& preface = http::Http2Session::kClientPreface;
+          if (data.size() < preface.size() &&
+              preface.substr(0, data.size()) == data) {
+            continue;
+          }
+        }
+        request_parser = &CreateRequestParser(
+            data, http1_parser,
+            [this, &producer](RequestBasePtr&& request_ptr) {
+              if (!NewRequest(std::move(request_ptr), producer)) {
+                is_accepting_requests_ = false;
+              }
+            });
+        request_parser->SetMemoryBudget(memory_budget_);
+      }
+
+      if (config_.zero_copy_body) {
+        // The bytes buffered before the protocol is known are not in the slab
+        const bool is_in_slab = data.data() != first_bytes.data();
+        request_parser->SetReceiveSlab(is_in_slab ? buf.GetSlab()
+                                                  : net::ReceiveSlab{});
+      }
+      const bool is_parsed = request_parser->Parse(data.data(), data.size());
+      // The requests keep the slab alive, the parser must not, or the slab is
+      // never reused and an idle connection pins it
+      if (config_.zero_copy_body) request_parser->SetReceiveSlab({});
+      if (!is_parsed) {
         LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd "
                     << Fd();
 
@@ -181,6 +229,33 @@ void Connection::ListenForRequests(
   }
 }
 
+request::RequestParser& Connection::CreateRequestParser(
+    std::string_view first_bytes,
+    std::unique_ptr<request::RequestParser>& http1_parser,
+    http::HttpRequestParser::OnNewRequestCb&& on_new_request_cb) {
+  if (config_.http_version == HttpVersion::kHttp2 &&
+      first_bytes.substr(0, http::Http2Session::kClientPreface.size()) ==
+          http::Http2Session::kClientPreface) {
+    LOG_TRACE() << "Starting HTTP/2 session for fd " << Fd();
+    http2_session_ = std::make_unique<http::Http2Session>(
+        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+        config_.http2_session_config, std::move(on_new_request_cb),
+        stats_->parser_stats, data_accounter_, *peer_socket_);
+    return *http2_session_;
+  }
+
+  if (config_.http_parser == HttpParser::kSimd) {
+    http1_parser = std::make_unique<http::SimdHttpRequestParser>(
+        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+        std::move(on_new_request_cb), stats_->parser_stats, data_accounter_);
+  } else {
+    http1_parser = std::make_unique<http::HttpRequestParser>(
+        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+        std::move(on_new_request_cb), stats_->parser_stats, data_accounter_);
+  }
+  return *http1_parser;
+}
+
 bool Connection::NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                             Queue::Producer& producer) {
   if (!is_accepting_requests_) {
@@ -213,7 +288,7 @@ void Connection::ProcessResponses(Queue::Consumer& consumer) noexcept {
        * until SendResponse() as the task produces body chunks.
        */
       SendResponse(*item.first);
-      if (item.first->IsUpgradeWebsocket())
+      if (item.first->IsUpgradeWebsocket() && !http2_session_)
         item.first->DoUpgrade(std::move(peer_socket_),
                               std::move(remote_address_));
       item.first.reset();
@@ -269,7 +344,12 @@ void Connection::SendResponse(request::RequestBase& request) {
   if (is_response_chain_valid_ && peer_socket_) {
     try {
       // Might be a stream reading or a fully constructed response
-      response.SendResponse(*peer_socket_);
+      if (http2_session_) {
+        http2_session_->SendResponse(
+            static_cast<http::HttpResponse&>(response));
+      } else {
+        response.SendResponse(*peer_socket_);
+      }
     } catch (const engine::io::IoSystemError& ex) {
       // working with raw values because std::errc compares error_category
       // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
@@ -2,10 +2,17 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
+#include <server/http/http2_session.hpp>
+#include <server/http/http_request_parser.hpp>
+#include <server/http/simd_http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <server/net/connection_config.hpp>
+#include <server/net/memory_budget.hpp>
+#include <server/net/receive_buffer.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 
@@ -28,7 +35,8 @@ class Connection final {
              const engine::io::Sockaddr& remote_address,
              const http::RequestHandlerBase& request_handler,
              std::shared_ptr<Stats> stats,
-             request::ResponseDataAccounter& data_accounter);
+             request::ResponseDataAccounter& data_accounter,
+             std::shared_ptr<ReceiveSlabPool> receive_slab_pool = {});
 
   void Process();
 
@@ -47,6 +55,10 @@ class Connection final {
                          engine::TaskCancellationToken token) noexcept;
   bool NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                   Queue::Producer&);
+  request::RequestParser& CreateRequestParser(
+      std::string_view first_bytes,
+      std::unique_ptr<request::RequestParser>& http1_parser,
+      http::HttpRequestParser::OnNewRequestCb&& on_new_request_cb);
 
   void ProcessResponses(Queue::Consumer&) noexcept;
   void HandleQueueItem(QueueItem& item) noexcept;
@@ -60,11 +72,15 @@ class Connection final {
   const http::RequestHandlerBase& request_handler_;
   const std::shared_ptr<Stats> stats_;
   request::ResponseDataAccounter& data_accounter_;
+  const std::shared_ptr<ReceiveSlabPool> receive_slab_pool_;
+  const std::shared_ptr<MemoryBudget> memory_budget_;
 
   engine::io::Sockaddr remote_address_;
   std::string peer_name_;
 
   std::shared_ptr<Queue> request_tasks_;
+  // Set by ListenForRequests before the first HTTP/2 request is queued
+  std::unique_ptr<http::Http2Session> http2_session_;
 
   bool is_accepting_requests_{true};
   bool is_response_chain_valid_{true};
@@ -1,11 +1,50 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
+#include <fmt/format.h>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+HttpVersion Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<HttpVersion>) {
+  const auto version = value.As<std::string>();
+  if (version == "1.1") return HttpVersion::kHttp11;
+  if (version == "2") return HttpVersion::kHttp2;
+  throw std::runtime_error(fmt::format(
+      "Unknown http_version '{}' at '{}', expected '1.1' or '2'", version,
+      value.GetPath()));
+}
+
+HttpParser Parse(const yaml_config::YamlConfig& value,
+                 formats::parse::To<HttpParser>) {
+  const auto parser = value.As<std::string>();
+  if (parser == "http-parser") return HttpParser::kHttpParser;
+  if (parser == "simd") return HttpParser::kSimd;
+  throw std::runtime_error(fmt::format(
+      "Unknown http_parser '{}' at '{}', expected 'http-parser' or 'simd'",
+      parser, value.GetPath()));
+}
+
+Http2SessionConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<Http2SessionConfig>) {
+  Http2SessionConfig config;
+
+  config.max_concurrent_streams =
+      value["max_concurrent_streams"].As<std::uint32_t>(
+          config.max_concurrent_streams);
+  config.max_frame_size =
+      value["max_frame_size"].As<std::uint32_t>(config.max_frame_size);
+  config.initial_window_size = value["initial_window_size"].As<std::uint32_t>(
+      config.initial_window_size);
+
+  return config;
+}
+
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ConnectionConfig>) {
   ConnectionConfig config;
@@ -18,6 +57,19 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
   config.keepalive_timeout =
       value["keepalive_timeout"].As<std::chrono::seconds>(
           config.keepalive_timeout);
+  config.http_version =
+      value["http_version"].As<HttpVersion>(config.http_version);
+  config.http2_session_config =
+      value["http2_session"].As<Http2SessionConfig>(
+          config.http2_session_config);
+  config.http_parser = value["http_parser"].As<HttpParser>(config.http_parser);
+  config.zero_copy_body =
+      value["zero_copy_body"].As<bool>(config.zero_copy_body);
+  config.receive_buffers_pool_size =
+      value["receive_buffers_pool_size"].As<size_t>(
+          config.receive_buffers_pool_size);
+  config.memory_budget =
+      value["memory_budget"].As<size_t>(config.memory_budget);
 
   return config;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -9,12 +11,50 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+enum class HttpVersion {
+  kHttp11,
+  /// Serve HTTP/2 with prior knowledge (h2c) or negotiated via TLS ALPN, in
+  /// addition to HTTP/1.1
+  kHttp2,
+};
+
+enum class HttpParser {
+  kHttpParser,
+  /// server::http::SimdHttpRequestParser
+  kSimd,
+};
+
+struct Http2SessionConfig {
+  std::uint32_t max_concurrent_streams = 100;
+  std::uint32_t max_frame_size = 16 * 1024;
+  std::uint32_t initial_window_size = 64 * 1024 - 1;
+};
+
 struct ConnectionConfig {
   size_t in_buffer_size = 32 * 1024;
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
+  HttpVersion http_version = HttpVersion::kHttp11;
+  Http2SessionConfig http2_session_config;
+  HttpParser http_parser = HttpParser::kHttpParser;
+  bool zero_copy_body = false;
+  /// Receive buffers kept for reuse by the listener, 0 makes each connection
+  /// keep its own buffer for its lifetime
+  size_t receive_buffers_pool_size = 256;
+  /// Max bytes of the requests of a connection that are being parsed or
+  /// processed, 0 for unlimited
+  size_t memory_budget = 0;
 };
 
+HttpVersion Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<HttpVersion>);
+
+HttpParser Parse(const yaml_config::YamlConfig& value,
+                 formats::parse::To<HttpParser>);
+
+Http2SessionConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<Http2SessionConfig>);
+
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ConnectionConfig>);
 
@@ -1,11 +1,14 @@
 #include <server/net/connection.hpp>
 
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <server/net/create_socket.hpp>
+#include <server/net/receive_buffer.hpp>
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/sleep.hpp>
@@ -274,6 +277,65 @@ UTEST(ServerNetConnection, KeepAlive) {
   EXPECT_EQ(handler.asyncs_finished, 2);
 }
 
+UTEST(ServerNetConnection, ReusesReceiveSlab) {
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.zero_copy_body = true;
+  auto request_socket = net::CreateSocket(config);
+  const auto pool = std::make_shared<net::ReceiveSlabPool>(
+      config.connection_config.in_buffer_size, 1);
+  const auto slab_size = pool->GetSlabSize();
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+  const auto post = [&] {
+    return http_client_ptr->CreateRequest()
+        .post(HttpConnectionUriFromSocket(request_socket), "body")
+        .retry(1)
+        .timeout(utest::kMaxTestWaitTime)
+        .async_perform();
+  };
+  // An idle connection gives its slab back to the pool
+  const auto wait_idle = [&pool] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (pool->GetFreeBytes() != pool->GetAllocatedBytes()) {
+      if (deadline.IsReached()) return false;
+      engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    return true;
+  };
+
+  auto request = post();
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter, pool);
+
+    connection.Process();
+  });
+  EXPECT_EQ(request.Get()->status_code(), 404);
+  ASSERT_TRUE(wait_idle());
+  EXPECT_EQ(pool->GetAllocatedBytes(), slab_size);
+
+  // The second request on the connection is received into the same slab
+  request = post();
+  EXPECT_EQ(request.Get()->status_code(), 404);
+  EXPECT_EQ(handler.asyncs_finished, 2);
+  ASSERT_TRUE(wait_idle());
+  EXPECT_EQ(pool->GetAllocatedBytes(), slab_size);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
 UTEST(ServerNetConnection, CancelMultipleInFlight) {
   constexpr std::size_t kInFlightRequests = 10;
   constexpr std::size_t kMaxAttempts = 10;
@@ -323,4 +385,78 @@ UTEST(ServerNetConnection, CancelMultipleInFlight) {
   FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnection, Http2PriorKnowledge) {
+  constexpr std::size_t kRequests = 10;
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.http_version = net::HttpVersion::kHttp2;
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+
+  std::vector<clients::http::ResponseFuture> requests;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    requests.push_back(
+        http_client_ptr->CreateRequest()
+            .get(HttpConnectionUriFromSocket(request_socket))
+            .http_version(clients::http::HttpVersion::k2PriorKnowledge)
+            .retry(1)
+            .timeout(utest::kMaxTestWaitTime)
+            .async_perform());
+  }
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+
+  for (auto& request : requests) {
+    EXPECT_EQ(request.Get()->status_code(), 404);
+  }
+  EXPECT_EQ(handler.asyncs_finished, kRequests);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, Http11WithHttp2Enabled) {
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.http_version = net::HttpVersion::kHttp2;
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  auto request = CreateRequest(*http_client_ptr, request_socket);
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+  EXPECT_EQ(request.Get()->status_code(), 404);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
@@ -7,6 +7,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -21,6 +26,8 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+#include <utils/strerror.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -73,13 +80,48 @@ engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog) {
   return socket;
 }
 
+void AttachReuseportCpuSteering(engine::io::Socket& socket,
+                                std::size_t sockets_count) {
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+  // Returns the index of the socket in the SO_REUSEPORT group: the sockets
+  // join the group in the order of creation, so the connections received by
+  // CPU i go to the socket (cpu % sockets_count). Out of range indexes, e.g.
+  // while the group is not complete yet, fall back to the hash.
+  std::array<sock_filter, 3> code{{
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0,
+       static_cast<std::uint32_t>(sockets_count)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  }};
+  sock_fprog program{static_cast<unsigned short>(code.size()), code.data()};
+  if (::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program,
+                   sizeof(program)) == -1) {
+    const auto err_value = errno;
+    LOG_WARNING() << "Failed to attach the SO_REUSEPORT CPU steering program: "
+                  << utils::strerror(err_value);
+  }
+#else
+  (void)socket;
+  (void)sockets_count;
+  LOG_WARNING() << "SO_REUSEPORT CPU steering is not supported on this "
+                   "platform, ignoring reuseport-cpu-steering";
+#endif
+}
+
 }  // namespace
 
-engine::io::Socket CreateSocket(const ListenerConfig& config) {
-  if (config.unix_socket_path.empty())
-    return CreateIpv6Socket(config.port, config.backlog);
-  else
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t sockets_count) {
+  if (!config.unix_socket_path.empty()) {
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
+  }
+
+  auto socket = CreateIpv6Socket(config.port, config.backlog);
+  if (config.reuseport_cpu_steering && sockets_count > 1) {
+    AttachReuseportCpuSteering(socket, sockets_count);
+  }
+  return socket;
 }
 
 }  // namespace server::net
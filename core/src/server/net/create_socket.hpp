@@ -7,7 +7,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
-engine::io::Socket CreateSocket(const ListenerConfig& config);
+// `sockets_count` is the count of the SO_REUSEPORT sockets that share the
+// port, used for ListenerConfig::reuseport_cpu_steering
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t sockets_count = 1);
 
 }  // namespace server::net
 
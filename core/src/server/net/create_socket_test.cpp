@@ -0,0 +1,67 @@
+#include <server/net/create_socket.hpp>
+
+#include <netinet/in.h>
+
+#include <chrono>
+#include <vector>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace net = server::net;
+using engine::Deadline;
+
+namespace {
+
+constexpr std::size_t kSocketsCount = 4;
+constexpr std::size_t kClientsCount = 32;
+constexpr auto kAcceptTimeout = std::chrono::milliseconds{100};
+
+engine::io::Sockaddr MakeLoopbackAddr(std::uint16_t port) {
+  engine::io::Sockaddr addr;
+  auto* sa = addr.As<struct sockaddr_in6>();
+  sa->sin6_family = AF_INET6;
+  sa->sin6_addr = in6addr_loopback;
+  addr.SetPort(port);
+  return addr;
+}
+
+}  // namespace
+
+UTEST(ServerNetCreateSocket, ReuseportCpuSteering) {
+  net::ListenerConfig config;
+  config.reuseport_cpu_steering = true;
+
+  std::vector<engine::io::Socket> sockets;
+  sockets.push_back(net::CreateSocket(config, kSocketsCount));
+  config.port = sockets.front().Getsockname().Port();
+  while (sockets.size() < kSocketsCount) {
+    sockets.push_back(net::CreateSocket(config, kSocketsCount));
+  }
+
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  const auto addr = MakeLoopbackAddr(config.port);
+  std::vector<engine::io::Socket> clients;
+  for (std::size_t i = 0; i < kClientsCount; ++i) {
+    clients.emplace_back(addr.Domain(), engine::io::SocketType::kStream);
+    clients.back().Connect(addr, deadline);
+  }
+
+  // Every connection is accepted by exactly one of the sockets
+  std::size_t accepted = 0;
+  for (auto& socket : sockets) {
+    try {
+      while (true) {
+        socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+        ++accepted;
+      }
+    } catch (const engine::io::IoTimeout&) {
+    }
+  }
+  EXPECT_EQ(accepted, kClientsCount);
+}
+
+USERVER_NAMESPACE_END
@@ -6,7 +6,20 @@ namespace server::net {
 
 EndpointInfo::EndpointInfo(const ListenerConfig& listener_config,
                            http::HttpRequestHandler& request_handler)
-    : listener_config(listener_config), request_handler(request_handler) {}
+    : listener_config(listener_config), request_handler(request_handler) {
+  if (!listener_config.tls) return;
+
+  engine::io::TlsServerContext::Options options;
+  if (listener_config.connection_config.http_version == HttpVersion::kHttp2) {
+    options.alpn_protocols = {"h2", "http/1.1"};
+  }
+  options.session_cache_size = listener_config.tls_session_cache_size;
+  options.session_timeout = listener_config.tls_session_timeout;
+  options.session_tickets = listener_config.tls_session_tickets;
+
+  tls_context = std::make_unique<engine::io::TlsServerContext>(
+      listener_config.tls_cert, listener_config.tls_private_key, options);
+}
 
 std::string EndpointInfo::GetDescription() const {
   if (listener_config.unix_socket_path.empty())
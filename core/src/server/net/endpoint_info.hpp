@@ -1,6 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+
+#include <userver/engine/io/tls_wrapper.hpp>
 
 #include <server/http/http_request_handler.hpp>
 #include <server/net/connection.hpp>
@@ -10,6 +13,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+class SocketHandoffClient;
+
 struct EndpointInfo {
   EndpointInfo(const ListenerConfig&, http::HttpRequestHandler&);
 
@@ -18,6 +23,14 @@ struct EndpointInfo {
   const ListenerConfig& listener_config;
   http::HttpRequestHandler& request_handler;
   Connection::Type connection_type{Connection::Type::kRequest};
+  // Shared by the connections of all the listener shards to resume the TLS
+  // sessions across them, null if TLS is not enabled
+  std::unique_ptr<engine::io::TlsServerContext> tls_context;
+  // Count of the listener shards, each with its own SO_REUSEPORT socket
+  std::size_t shards_count{1};
+  // Set while the listeners are started if the previous instance of the
+  // service hands off its listening sockets
+  SocketHandoffClient* socket_handoff{nullptr};
 
   std::atomic<size_t> connection_count{0};
 };
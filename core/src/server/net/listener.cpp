@@ -9,8 +9,10 @@ namespace server::net {
 
 Listener::Listener(std::shared_ptr<EndpointInfo> endpoint_info,
                    engine::TaskProcessor& task_processor,
+                   engine::TaskProcessor& accept_task_processor,
                    request::ResponseDataAccounter& data_accounter)
     : task_processor_(&task_processor),
+      accept_task_processor_(&accept_task_processor),
       endpoint_info_(std::move(endpoint_info)),
       data_accounter_(&data_accounter) {}
 
@@ -23,8 +25,9 @@ Listener::~Listener() {
 }
 
 void Listener::Start() {
-  impl_ = std::make_unique<ListenerImpl>(*task_processor_, endpoint_info_,
-                                         *data_accounter_);
+  impl_ = std::make_unique<ListenerImpl>(
+      *task_processor_, *accept_task_processor_, endpoint_info_,
+      *data_accounter_);
 }
 
 Stats Listener::GetStats() const {
@@ -32,6 +35,11 @@ Stats Listener::GetStats() const {
   return Stats{};
 }
 
+int Listener::GetSocketFd() const {
+  if (impl_) return impl_->GetSocketFd();
+  return -1;
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -16,6 +16,7 @@ class Listener final {
  public:
   Listener(std::shared_ptr<EndpointInfo> endpoint_info,
            engine::TaskProcessor& task_processor,
+           engine::TaskProcessor& accept_task_processor,
            request::ResponseDataAccounter& data_accounter);
   ~Listener();
 
@@ -28,8 +29,12 @@ class Listener final {
 
   Stats GetStats() const;
 
+  // The listening socket, -1 if the listener is not started
+  int GetSocketFd() const;
+
  private:
   engine::TaskProcessor* task_processor_;
+  engine::TaskProcessor* accept_task_processor_;
   std::shared_ptr<EndpointInfo> endpoint_info_;
   request::ResponseDataAccounter* data_accounter_;
 
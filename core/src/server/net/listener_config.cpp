@@ -23,6 +23,12 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
       value["max_connections"].As<size_t>(config.max_connections);
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
   config.task_processor = value["task_processor"].As<std::string>();
+  config.shared_nothing =
+      value["shared-nothing"].As<bool>(config.shared_nothing);
+  config.pinned_acceptors =
+      value["pinned-acceptors"].As<bool>(config.pinned_acceptors);
+  config.reuseport_cpu_steering =
+      value["reuseport-cpu-steering"].As<bool>(config.reuseport_cpu_steering);
   config.backlog = value["backlog"].As<int>(config.backlog);
 
   if (config.port != 0 && !config.unix_socket_path.empty())
@@ -56,6 +62,13 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   if (!pkey_pass_name.empty()) {
     config.tls_private_key_passphrase_name = pkey_pass_name;
   }
+  config.tls_session_cache_size = value["tls"]["session-cache-size"].As<size_t>(
+      config.tls_session_cache_size);
+  config.tls_session_timeout =
+      value["tls"]["session-timeout"].As<std::chrono::seconds>(
+          config.tls_session_timeout);
+  config.tls_session_tickets =
+      value["tls"]["session-tickets"].As<bool>(config.tls_session_tickets);
 
   return config;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
@@ -23,12 +25,24 @@ struct ListenerConfig {
   size_t max_connections = 32768;
   std::optional<size_t> shards;
   std::string task_processor;
+  // Each shard gets its own single-threaded task processor pinned to an ev
+  // thread, the requests are handled by the task processor of the connection
+  bool shared_nothing{false};
+  // Each shard accepts on a dedicated single-threaded task processor pinned to
+  // its own ev thread, the connections are handled by task_processor
+  bool pinned_acceptors{false};
+  // The kernel picks the SO_REUSEPORT socket of a new connection by the CPU
+  // that received it
+  bool reuseport_cpu_steering{false};
 
   bool tls{false};
   crypto::Certificate tls_cert;
   std::string tls_private_key_path;
   std::string tls_private_key_passphrase_name;
   crypto::PrivateKey tls_private_key;
+  std::size_t tls_session_cache_size{20 * 1024};
+  std::chrono::seconds tls_session_timeout{300};
+  bool tls_session_tickets{true};
 };
 
 ListenerConfig Parse(const yaml_config::YamlConfig& value,
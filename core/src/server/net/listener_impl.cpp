@@ -7,8 +7,10 @@
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <vector>
 
 #include <server/net/create_socket.hpp>
+#include <server/net/socket_handoff.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
@@ -24,15 +26,30 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+std::shared_ptr<ReceiveSlabPool> MakeReceiveSlabPool(
+    const ConnectionConfig& config) {
+  if (!config.receive_buffers_pool_size) return {};
+  return std::make_shared<ReceiveSlabPool>(config.in_buffer_size,
+                                           config.receive_buffers_pool_size);
+}
+
+}  // namespace
+
 ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
+                           engine::TaskProcessor& accept_task_processor,
                            std::shared_ptr<EndpointInfo> endpoint_info,
                            request::ResponseDataAccounter& data_accounter)
     : task_processor_(task_processor),
+      accept_task_processor_(accept_task_processor),
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
       data_accounter_(data_accounter),
+      receive_slab_pool_(MakeReceiveSlabPool(
+          endpoint_info_->listener_config.connection_config)),
       socket_listener_task_(engine::CriticalAsyncNoSpan(
-          task_processor_,
+          accept_task_processor_,
           [this](engine::io::Socket&& request_socket) {
             while (!engine::current_task::ShouldCancel()) {
               try {
@@ -48,7 +65,7 @@ ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
               }
             }
           },
-          CreateSocket(endpoint_info_->listener_config))) {}
+          CreateListenerSocket())) {}
 
 ListenerImpl::~ListenerImpl() {
   LOG_TRACE() << "Stopping socket listener task";
@@ -58,7 +75,29 @@ ListenerImpl::~ListenerImpl() {
   connections_.CancelAndWait();
 }
 
-Stats ListenerImpl::GetStats() const { return *stats_; }
+Stats ListenerImpl::GetStats() const {
+  Stats stats{*stats_};
+  if (receive_slab_pool_) {
+    stats.receive_buffers_bytes = receive_slab_pool_->GetAllocatedBytes();
+    stats.receive_buffers_free_bytes = receive_slab_pool_->GetFreeBytes();
+  }
+  return stats;
+}
+
+engine::io::Socket ListenerImpl::CreateListenerSocket() {
+  // The poller of a socket uses the ev thread of the task that creates it
+  auto socket = engine::CriticalAsyncNoSpan(accept_task_processor_, [this] {
+                  if (auto* handoff = endpoint_info_->socket_handoff) {
+                    const auto fd = handoff->TakeSocket(
+                        endpoint_info_->GetDescription());
+                    if (fd != -1) return engine::io::Socket{fd};
+                  }
+                  return CreateSocket(endpoint_info_->listener_config,
+                                      endpoint_info_->shards_count);
+                }).Get();
+  socket_fd_ = socket.Fd();
+  return socket;
+}
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
   auto peer_socket = request_socket.Accept({});
@@ -98,20 +137,21 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
   LOG_TRACE() << "Creating connection for fd " << fd;
   std::unique_ptr<engine::io::RwBase> socket;
   auto remote_address = peer_socket.Getpeername();
-  if (endpoint_info_->listener_config.tls) {
+  const auto& listener_config = endpoint_info_->listener_config;
+  if (listener_config.tls) {
+    UASSERT(endpoint_info_->tls_context);
     socket = std::make_unique<engine::io::TlsWrapper>(
         engine::io::TlsWrapper::StartTlsServer(
-            std::move(peer_socket), endpoint_info_->listener_config.tls_cert,
-            endpoint_info_->listener_config.tls_private_key, {}));
+            std::move(peer_socket), *endpoint_info_->tls_context, {}));
   } else {
     socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
   }
 
-  Connection connection_ptr(endpoint_info_->listener_config.connection_config,
-                            endpoint_info_->listener_config.handler_defaults,
+  Connection connection_ptr(listener_config.connection_config,
+                            listener_config.handler_defaults,
                             std::move(socket), std::move(remote_address),
                             endpoint_info_->request_handler, stats_,
-                            data_accounter_);
+                            data_accounter_, receive_slab_pool_);
 
   LOG_TRACE() << "Start connection processing for fd " << fd;
   connection_ptr.Process();
@@ -9,6 +9,7 @@
 
 #include "connection.hpp"
 #include "endpoint_info.hpp"
+#include "receive_buffer.hpp"
 #include "stats.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -17,24 +18,35 @@ namespace server::net {
 
 class ListenerImpl final {
  public:
+  // The socket is created and accepted on in `accept_task_processor`, so that
+  // it is bound to the ev thread of that task processor
   ListenerImpl(engine::TaskProcessor& task_processor,
+               engine::TaskProcessor& accept_task_processor,
                std::shared_ptr<EndpointInfo> endpoint_info,
                request::ResponseDataAccounter& data_accounter);
   ~ListenerImpl();
 
   Stats GetStats() const;
 
+  // The listening socket, for the handoff to the next instance
+  int GetSocketFd() const { return socket_fd_; }
+
  private:
+  engine::io::Socket CreateListenerSocket();
   void AcceptConnection(engine::io::Socket& request_socket);
   void ProcessConnection(engine::io::Socket peer_socket);
 
   engine::TaskProcessor& task_processor_;
+  engine::TaskProcessor& accept_task_processor_;
   std::shared_ptr<EndpointInfo> endpoint_info_;
 
   std::shared_ptr<Stats> stats_;
   request::ResponseDataAccounter& data_accounter_;
+  // Shared by the connections, nullptr if each of them keeps its own buffer
+  std::shared_ptr<ReceiveSlabPool> receive_slab_pool_;
 
   concurrent::BackgroundTaskStorageCore connections_;
+  int socket_fd_{-1};
 
   engine::TaskWithResult<void> socket_listener_task_;
 };
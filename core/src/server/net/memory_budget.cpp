@@ -0,0 +1,75 @@
+#include <server/net/memory_budget.hpp>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+MemoryBudget::MemoryBudget(std::size_t limit, std::shared_ptr<Stats> stats)
+    : limit_(limit), stats_(std::move(stats)) {
+  UASSERT(stats_);
+}
+
+MemoryBudget::~MemoryBudget() { UASSERT(usage_ == 0); }
+
+bool MemoryBudget::TryCharge(std::size_t bytes) noexcept {
+  if (!bytes) return true;
+
+  auto usage = usage_.load(std::memory_order_relaxed);
+  do {
+    if (limit_ && usage + bytes > limit_) return false;
+  } while (!usage_.compare_exchange_weak(usage, usage + bytes,
+                                         std::memory_order_relaxed));
+
+  stats_->requests_memory_bytes.fetch_add(bytes, std::memory_order_relaxed);
+  return true;
+}
+
+void MemoryBudget::Release(std::size_t bytes) noexcept {
+  if (!bytes) return;
+
+  UASSERT(usage_ >= bytes);
+  usage_.fetch_sub(bytes, std::memory_order_relaxed);
+  stats_->requests_memory_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+std::size_t MemoryBudget::GetUsage() const noexcept {
+  return usage_.load(std::memory_order_relaxed);
+}
+
+MemoryCharge::MemoryCharge(std::shared_ptr<MemoryBudget> budget) noexcept
+    : budget_(std::move(budget)) {}
+
+MemoryCharge::MemoryCharge(MemoryCharge&& other) noexcept
+    : budget_(std::move(other.budget_)),
+      bytes_(std::exchange(other.bytes_, 0)) {}
+
+MemoryCharge& MemoryCharge::operator=(MemoryCharge&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    budget_ = std::move(other.budget_);
+    bytes_ = std::exchange(other.bytes_, 0);
+  }
+  return *this;
+}
+
+MemoryCharge::~MemoryCharge() { Reset(); }
+
+bool MemoryCharge::TryAdd(std::size_t bytes) noexcept {
+  if (!budget_) return true;
+  if (!budget_->TryCharge(bytes)) return false;
+  bytes_ += bytes;
+  return true;
+}
+
+void MemoryCharge::Reset() noexcept {
+  if (budget_) budget_->Release(std::exchange(bytes_, 0));
+  budget_.reset();
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <server/net/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// Memory held by the requests of a connection from the start of their
+/// parsing till their destruction, limited by ConnectionConfig::memory_budget.
+///
+/// The requests are charged by their parser with the sizes of their URL,
+/// headers and body, so that a single connection can not hold more than the
+/// budget with pipelined HTTP/1.1 requests or concurrent HTTP/2 streams.
+class MemoryBudget final {
+ public:
+  /// `limit` of 0 disables the limit, the usage is still accounted
+  MemoryBudget(std::size_t limit, std::shared_ptr<Stats> stats);
+
+  MemoryBudget(const MemoryBudget&) = delete;
+  MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+  ~MemoryBudget();
+
+  /// Returns false and charges nothing if the limit would be exceeded
+  bool TryCharge(std::size_t bytes) noexcept;
+
+  void Release(std::size_t bytes) noexcept;
+
+  std::size_t GetUsage() const noexcept;
+
+ private:
+  const std::size_t limit_;
+  const std::shared_ptr<Stats> stats_;
+  std::atomic<std::size_t> usage_{0};
+};
+
+/// Bytes charged to a MemoryBudget by a single request, released on
+/// destruction
+class MemoryCharge final {
+ public:
+  MemoryCharge() noexcept = default;
+  explicit MemoryCharge(std::shared_ptr<MemoryBudget> budget) noexcept;
+
+  MemoryCharge(MemoryCharge&&) noexcept;
+  MemoryCharge& operator=(MemoryCharge&&) noexcept;
+
+  ~MemoryCharge();
+
+  /// Returns false if the budget is exceeded, always true without a budget
+  bool TryAdd(std::size_t bytes) noexcept;
+
+  std::size_t GetBytes() const noexcept { return bytes_; }
+
+ private:
+  void Reset() noexcept;
+
+  std::shared_ptr<MemoryBudget> budget_;
+  std::size_t bytes_{0};
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,93 @@
+#include <server/net/memory_budget.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/server/http/http_status.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <server/http/create_parser_test.hpp>
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename Parser>
+class MemoryBudgetParser : public ::testing::Test {};
+
+using Parsers = ::testing::Types<server::http::HttpRequestParser,
+                                 server::http::SimdHttpRequestParser>;
+
+}  // namespace
+
+TEST(MemoryBudget, Charge) {
+  const auto stats = std::make_shared<server::net::Stats>();
+  const auto budget = std::make_shared<server::net::MemoryBudget>(100, stats);
+
+  {
+    server::net::MemoryCharge first{budget};
+    EXPECT_TRUE(first.TryAdd(60));
+    server::net::MemoryCharge second{budget};
+    EXPECT_FALSE(second.TryAdd(50));
+    EXPECT_TRUE(second.TryAdd(40));
+    EXPECT_EQ(budget->GetUsage(), 100);
+    EXPECT_EQ(stats->requests_memory_bytes, 100);
+
+    auto moved = std::move(first);
+    EXPECT_EQ(moved.GetBytes(), 60);
+    EXPECT_EQ(budget->GetUsage(), 100);
+  }
+  EXPECT_EQ(budget->GetUsage(), 0);
+  EXPECT_EQ(stats->requests_memory_bytes, 0);
+}
+
+TEST(MemoryBudget, Unlimited) {
+  const auto stats = std::make_shared<server::net::Stats>();
+  const auto budget = std::make_shared<server::net::MemoryBudget>(0, stats);
+
+  server::net::MemoryCharge charge{budget};
+  EXPECT_TRUE(charge.TryAdd(1024 * 1024 * 1024));
+  EXPECT_EQ(stats->requests_memory_bytes, 1024 * 1024 * 1024);
+
+  server::net::MemoryCharge no_budget;
+  EXPECT_TRUE(no_budget.TryAdd(100));
+  EXPECT_EQ(no_budget.GetBytes(), 0);
+}
+
+TYPED_UTEST_SUITE(MemoryBudgetParser, Parsers);
+
+TYPED_UTEST(MemoryBudgetParser, PipelinedRequests) {
+  const auto stats = std::make_shared<server::net::Stats>();
+  const auto budget = std::make_shared<server::net::MemoryBudget>(60, stats);
+
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  auto parser = server::CreateTestParser<TypeParam>(
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        requests.push_back(std::move(request));
+      });
+  parser.SetMemoryBudget(budget);
+
+  const std::string request =
+      "POST / HTTP/1.1\r\nContent-Length: 30\r\n\r\n" + std::string(30, 'a');
+  const auto data = request + request;
+  EXPECT_FALSE(parser.Parse(data.data(), data.size()));
+
+  // The second request does not fit while the first one is alive
+  ASSERT_EQ(requests.size(), 2);
+  const auto status = [&requests](std::size_t i) {
+    return dynamic_cast<server::http::HttpRequestImpl&>(*requests[i])
+        .GetHttpResponse()
+        .GetStatus();
+  };
+  EXPECT_EQ(status(0), server::http::HttpStatus::kOk);
+  EXPECT_EQ(status(1), server::http::HttpStatus::kPayloadTooLarge);
+  EXPECT_GT(stats->requests_memory_bytes, 0);
+
+  requests.clear();
+  EXPECT_EQ(budget->GetUsage(), 0);
+  EXPECT_EQ(stats->requests_memory_bytes, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#include <server/net/receive_buffer.hpp>
+
+#include <atomic>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+ReceiveSlabPool::ReceiveSlabPool(std::size_t slab_size,
+                                 std::size_t max_free_slabs)
+    : slab_size_(slab_size), max_free_slabs_(max_free_slabs) {
+  UASSERT(slab_size_ > 0);
+}
+
+ReceiveSlabPool::~ReceiveSlabPool() {
+  char* slab = nullptr;
+  while (free_slabs_.try_dequeue(slab)) {
+    delete[] slab;
+  }
+}
+
+std::shared_ptr<char[]> ReceiveSlabPool::Acquire() {
+  char* slab = nullptr;
+  if (free_slabs_.try_dequeue(slab)) {
+    free_slabs_count_.fetch_sub(1, std::memory_order_relaxed);
+  } else {
+    slab = new char[slab_size_];
+    allocated_slabs_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // The slab may outlive the listener in a request, so it keeps the pool alive
+  return {slab, [pool = shared_from_this()](char* slab) noexcept {
+            pool->Release(slab);
+          }};
+}
+
+std::size_t ReceiveSlabPool::GetAllocatedBytes() const noexcept {
+  return allocated_slabs_count_.load(std::memory_order_relaxed) * slab_size_;
+}
+
+std::size_t ReceiveSlabPool::GetFreeBytes() const noexcept {
+  return free_slabs_count_.load(std::memory_order_relaxed) * slab_size_;
+}
+
+void ReceiveSlabPool::Release(char* slab) noexcept {
+  if (free_slabs_count_.fetch_add(1, std::memory_order_relaxed) <
+          max_free_slabs_ &&
+      free_slabs_.enqueue(slab)) {
+    return;
+  }
+
+  free_slabs_count_.fetch_sub(1, std::memory_order_relaxed);
+  allocated_slabs_count_.fetch_sub(1, std::memory_order_relaxed);
+  delete[] slab;
+}
+
+ReceiveBuffer::ReceiveBuffer(std::size_t slab_size)
+    : slab_size_(slab_size), slab_(AllocateSlab()) {
+  UASSERT(slab_size_ > 0);
+}
+
+ReceiveBuffer::ReceiveBuffer(std::shared_ptr<ReceiveSlabPool> pool)
+    : pool_(std::move(pool)), slab_size_(pool_->GetSlabSize()) {}
+
+utils::span<char> ReceiveBuffer::Prepare() {
+  if (!slab_) {
+    slab_ = AllocateSlab();
+    offset_ = 0;
+  } else if (slab_.use_count() == 1) {
+    // Pairs with the release of the last reference by a request
+    std::atomic_thread_fence(std::memory_order_acquire);
+    offset_ = 0;
+  } else if (slab_size_ - offset_ < slab_size_ / 4 || offset_ == slab_size_) {
+    slab_ = AllocateSlab();
+    offset_ = 0;
+  }
+  return {slab_.get() + offset_, slab_.get() + slab_size_};
+}
+
+std::string_view ReceiveBuffer::Commit(std::size_t size) {
+  UASSERT(slab_);
+  UASSERT(offset_ + size <= slab_size_);
+  const std::string_view data{slab_.get() + offset_, size};
+  offset_ += size;
+  return data;
+}
+
+void ReceiveBuffer::Release() noexcept {
+  // Requests that still refer to the slab return it to the pool themselves
+  if (pool_) slab_.reset();
+}
+
+std::shared_ptr<char[]> ReceiveBuffer::AllocateSlab() {
+  if (pool_) return pool_->Acquire();
+  return std::shared_ptr<char[]>(new char[slab_size_]);
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include <moodycamel/concurrentqueue.h>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// A chunk of the connection receive buffer, kept alive by the requests that
+/// refer to the data in it
+using ReceiveSlab = std::shared_ptr<const char[]>;
+
+/// Pool of receive slabs shared by the connections of a listener.
+///
+/// A slab returns to the pool when the last reference to it is dropped, so
+/// that idle connections hold no receive memory. At most `max_free_slabs` are
+/// kept for reuse, the rest are freed.
+class ReceiveSlabPool final
+    : public std::enable_shared_from_this<ReceiveSlabPool> {
+ public:
+  ReceiveSlabPool(std::size_t slab_size, std::size_t max_free_slabs);
+
+  ReceiveSlabPool(const ReceiveSlabPool&) = delete;
+  ReceiveSlabPool& operator=(const ReceiveSlabPool&) = delete;
+
+  ~ReceiveSlabPool();
+
+  std::shared_ptr<char[]> Acquire();
+
+  std::size_t GetSlabSize() const noexcept { return slab_size_; }
+
+  /// Bytes of the slabs in use and in the pool
+  std::size_t GetAllocatedBytes() const noexcept;
+
+  /// Bytes of the slabs in the pool
+  std::size_t GetFreeBytes() const noexcept;
+
+ private:
+  void Release(char* slab) noexcept;
+
+  const std::size_t slab_size_;
+  const std::size_t max_free_slabs_;
+  moodycamel::ConcurrentQueue<char*> free_slabs_;
+  std::atomic<std::size_t> free_slabs_count_{0};
+  std::atomic<std::size_t> allocated_slabs_count_{0};
+};
+
+/// Receive buffer of a connection that consists of refcounted slabs.
+///
+/// The bytes are received into the current slab until it is mostly full, then
+/// a new slab is taken unless no request refers to the current one any
+/// more.
+class ReceiveBuffer final {
+ public:
+  /// Allocates the slabs on the heap
+  explicit ReceiveBuffer(std::size_t slab_size);
+
+  /// Takes the slabs from the `pool`
+  explicit ReceiveBuffer(std::shared_ptr<ReceiveSlabPool> pool);
+
+  /// Returns the space to receive the next bytes into
+  utils::span<char> Prepare();
+
+  /// Marks the first `size` bytes of the space returned by Prepare() as
+  /// received and returns them
+  std::string_view Commit(std::size_t size);
+
+  /// Returns the slab the last committed bytes belong to
+  ReceiveSlab GetSlab() const { return slab_; }
+
+  /// Drops the reference to the current pooled slab, the next Prepare() takes
+  /// a new one. Used before waiting for the peer so that idle connections
+  /// hold no receive memory.
+  void Release() noexcept;
+
+ private:
+  std::shared_ptr<char[]> AllocateSlab();
+
+  const std::shared_ptr<ReceiveSlabPool> pool_;
+  const std::size_t slab_size_;
+  std::shared_ptr<char[]> slab_;
+  std::size_t offset_{0};
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
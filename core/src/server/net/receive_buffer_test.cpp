@@ -0,0 +1,143 @@
+#include <server/net/receive_buffer.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <userver/server/http/http_request.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <server/http/create_parser_test.hpp>
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string_view Receive(server::net::ReceiveBuffer& buffer,
+                         std::string_view data) {
+  const auto space = buffer.Prepare();
+  EXPECT_GE(space.size(), data.size());
+  std::memcpy(space.data(), data.data(), data.size());
+  return buffer.Commit(data.size());
+}
+
+template <typename Parser>
+std::shared_ptr<server::request::RequestBase> ParseWithSlabs(
+    const std::vector<std::string>& reads) {
+  server::net::ReceiveBuffer buffer(1024);
+  std::shared_ptr<server::request::RequestBase> result;
+  auto parser = server::CreateTestParser<Parser>(
+      [&result](std::shared_ptr<server::request::RequestBase>&& request) {
+        result = std::move(request);
+      });
+
+  for (const auto& read : reads) {
+    const auto data = Receive(buffer, read);
+    parser.SetReceiveSlab(buffer.GetSlab());
+    EXPECT_TRUE(parser.Parse(data.data(), data.size()));
+  }
+  return result;
+}
+
+template <typename Parser>
+class ReceiveBufferParser : public ::testing::Test {};
+
+using Parsers = ::testing::Types<server::http::HttpRequestParser,
+                                 server::http::SimdHttpRequestParser>;
+
+}  // namespace
+
+UTEST(ReceiveBuffer, ReusesFreeSlab) {
+  server::net::ReceiveBuffer buffer(1024);
+
+  const auto first = Receive(buffer, "first");
+  const auto second = Receive(buffer, "second");
+  EXPECT_EQ(first.data(), second.data());
+  EXPECT_EQ(second, "second");
+}
+
+UTEST(ReceiveBuffer, KeepsReferredSlab) {
+  server::net::ReceiveBuffer buffer(1024);
+
+  const auto first = Receive(buffer, "first");
+  const auto slab = buffer.GetSlab();
+  const auto second = Receive(buffer, "second");
+  EXPECT_EQ(second.data(), first.data() + first.size());
+  EXPECT_EQ(first, "first");
+
+  const auto rest = buffer.Prepare();
+  std::memset(rest.data(), 'x', rest.size() - 200);
+  buffer.Commit(rest.size() - 200);
+
+  const auto third = Receive(buffer, "third");
+  EXPECT_NE(third.data(), first.data() + first.size() + second.size());
+  EXPECT_EQ(first, "first");
+  EXPECT_EQ(second, "second");
+}
+
+UTEST(ReceiveBuffer, PooledSlabs) {
+  const auto pool = std::make_shared<server::net::ReceiveSlabPool>(1024, 1);
+  server::net::ReceiveBuffer buffer(pool);
+  EXPECT_EQ(pool->GetAllocatedBytes(), 0);
+
+  const auto first = Receive(buffer, "first");
+  EXPECT_EQ(pool->GetAllocatedBytes(), 1024);
+
+  // An idle buffer gives its slab back to the pool
+  buffer.Release();
+  EXPECT_EQ(pool->GetFreeBytes(), 1024);
+
+  const auto second = Receive(buffer, "second");
+  EXPECT_EQ(second.data(), first.data());
+  EXPECT_EQ(pool->GetAllocatedBytes(), 1024);
+  EXPECT_EQ(pool->GetFreeBytes(), 0);
+
+  // A slab referred to by a request returns to the pool with the request
+  auto slab = buffer.GetSlab();
+  buffer.Release();
+  EXPECT_EQ(pool->GetFreeBytes(), 0);
+  const auto third = Receive(buffer, "third");
+  EXPECT_NE(third.data(), first.data());
+  EXPECT_EQ(pool->GetAllocatedBytes(), 2048);
+
+  slab.reset();
+  EXPECT_EQ(pool->GetFreeBytes(), 1024);
+
+  // The pool keeps at most 1 free slab
+  buffer.Release();
+  EXPECT_EQ(pool->GetFreeBytes(), 1024);
+  EXPECT_EQ(pool->GetAllocatedBytes(), 1024);
+}
+
+TYPED_UTEST_SUITE(ReceiveBufferParser, Parsers);
+
+TYPED_UTEST(ReceiveBufferParser, BodyRefersToSlabs) {
+  const auto request = ParseWithSlabs<TypeParam>({
+      "POST / HTTP/1.1\r\nContent-Length: 11\r\n\r\nhello",
+      " world",
+  });
+  ASSERT_TRUE(request);
+
+  const auto& impl = dynamic_cast<server::http::HttpRequestImpl&>(*request);
+  const auto chunks = impl.GetRequestBodyChunks();
+  ASSERT_EQ(chunks.size(), 2);
+  EXPECT_EQ(chunks[0], "hello");
+  EXPECT_EQ(chunks[1], " world");
+  EXPECT_EQ(impl.RequestBody(), "hello world");
+}
+
+TYPED_UTEST(ReceiveBufferParser, SetRequestBodyDropsSlabs) {
+  const auto request = ParseWithSlabs<TypeParam>({
+      "POST / HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello",
+  });
+  ASSERT_TRUE(request);
+
+  auto& impl = dynamic_cast<server::http::HttpRequestImpl&>(*request);
+  impl.SetRequestBody("other");
+  EXPECT_EQ(impl.RequestBody(), "other");
+  EXPECT_EQ(impl.GetRequestBodyChunks(),
+            std::vector<std::string_view>{"other"});
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,296 @@
+#include "socket_handoff.hpp"
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+namespace {
+
+// SCM_MAX_FD of Linux
+constexpr std::size_t kMaxSockets = 253;
+constexpr std::size_t kMaxPayloadSize = 64 * 1024;
+constexpr char kStartedMessage = '1';
+// The next instance starts the listeners right after it gets the sockets
+constexpr std::chrono::seconds kStartTimeout{60};
+constexpr std::chrono::seconds kNotifyTimeout{1};
+
+engine::io::Sockaddr MakeUnixSockaddr(const std::string& path) {
+  engine::io::Sockaddr addr;
+  auto* sa = addr.As<struct sockaddr_un>();
+  sa->sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(sa->sun_path)) {
+    throw std::runtime_error("Invalid handoff socket path '" + path + "'");
+  }
+  std::strncpy(sa->sun_path, path.c_str(), sizeof(sa->sun_path));
+  return addr;
+}
+
+// bind() creates the socket file with the mode of the process umask, so the
+// socket is bound in a private 0700 directory first, is made accessible to
+// the owner only and only then is moved to `path`.
+engine::io::Socket CreateHandoffSocket(const std::string& path) {
+  MakeUnixSockaddr(path);
+
+  // Startup only, the blocking API is fine
+  if (fs::blocking::GetFileType(path) ==
+      boost::filesystem::file_type::socket_file) {
+    fs::blocking::RemoveSingleFile(path);
+  }
+
+  auto parent_path = boost::filesystem::path{path}.parent_path().string();
+  if (parent_path.empty()) parent_path = ".";
+  const auto private_dir =
+      fs::blocking::TempDirectory::Create(parent_path, ".handoff");
+  const auto private_path = private_dir.GetPath() + "/s";
+  const auto addr = MakeUnixSockaddr(private_path);
+
+  engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+  socket.Bind(addr);
+  fs::blocking::Chmod(private_path, boost::filesystem::perms::owner_read |
+                                        boost::filesystem::perms::owner_write);
+  fs::blocking::Rename(private_path, path);
+  socket.Listen(1);
+  return socket;
+}
+
+// Whoever connects gets the listening sockets of the service
+void CheckPeerIsSameUser(int fd) {
+  uid_t peer_uid = 0;
+#ifdef SO_PEERCRED
+  struct ucred credentials {};
+  socklen_t size = sizeof(credentials);
+  utils::CheckSyscall(
+      ::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size),
+      "getting the credentials of the handoff peer");
+  peer_uid = credentials.uid;
+#else
+  gid_t peer_gid = 0;
+  utils::CheckSyscall(::getpeereid(fd, &peer_uid, &peer_gid),
+                      "getting the credentials of the handoff peer");
+#endif
+  if (peer_uid != ::getuid()) {
+    throw std::runtime_error("Handoff peer runs as another user, uid " +
+                             std::to_string(peer_uid));
+  }
+}
+
+void CloseFds(const std::vector<int>& fds) noexcept {
+  for (const auto fd : fds) ::close(fd);
+}
+
+}  // namespace
+
+std::optional<SocketHandoffClient> SocketHandoffClient::Connect(
+    const std::string& path, engine::Deadline deadline) {
+  if (fs::blocking::GetFileType(path) !=
+      boost::filesystem::file_type::socket_file) {
+    return std::nullopt;
+  }
+
+  const auto addr = MakeUnixSockaddr(path);
+  engine::io::Socket connection{addr.Domain(),
+                                engine::io::SocketType::kStream};
+  try {
+    connection.Connect(addr, deadline);
+  } catch (const engine::io::IoException& ex) {
+    LOG_WARNING() << "No instance serves the handoff socket " << path << ": "
+                  << ex;
+    return std::nullopt;
+  }
+
+  if (!connection.WaitReadable(deadline)) {
+    throw std::runtime_error(
+        "Timed out waiting for the listening sockets from " + path);
+  }
+
+  std::string payload(kMaxPayloadSize, '\0');
+  std::vector<char> control(CMSG_SPACE(sizeof(int) * kMaxSockets));
+  iovec iov{payload.data(), payload.size()};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.data();
+  msg.msg_controllen = control.size();
+
+  int flags = 0;
+#ifdef MSG_CMSG_CLOEXEC
+  flags |= MSG_CMSG_CLOEXEC;
+#endif
+  const auto size =
+      utils::CheckSyscall(::recvmsg(connection.Fd(), &msg, flags),
+                          "receiving the listening sockets from {}", path);
+
+  std::vector<int> fds;
+  for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+      continue;
+    }
+    const auto count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (std::size_t i = 0; i < count; ++i) {
+      int fd = -1;
+      std::memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+      fds.push_back(fd);
+    }
+  }
+
+  // One line with the key of each socket
+  std::vector<std::string> keys;
+  std::string_view lines{payload.data(), static_cast<std::size_t>(size)};
+  for (auto end = lines.find('\n'); end != std::string_view::npos;
+       end = lines.find('\n')) {
+    keys.emplace_back(lines.substr(0, end));
+    lines.remove_prefix(end + 1);
+  }
+  if ((msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) || !lines.empty() ||
+      fds.empty() || keys.size() != fds.size()) {
+    CloseFds(fds);
+    throw std::runtime_error("Malformed handoff message from " + path);
+  }
+
+  SocketHandoffClient client{std::move(connection)};
+  for (std::size_t i = 0; i < fds.size(); ++i) {
+    client.fds_.emplace(std::move(keys[i]), fds[i]);
+  }
+  LOG_INFO() << "Received " << fds.size() << " listening sockets from " << path;
+  return client;
+}
+
+SocketHandoffClient::SocketHandoffClient(engine::io::Socket connection)
+    : connection_(std::move(connection)) {}
+
+SocketHandoffClient::SocketHandoffClient(SocketHandoffClient&& other) noexcept
+    : connection_(std::move(other.connection_)),
+      fds_(std::exchange(other.fds_, {})) {}
+
+SocketHandoffClient::~SocketHandoffClient() {
+  for (const auto& [key, fd] : fds_) {
+    LOG_INFO() << "Closing the unused handed off socket, " << key;
+    ::close(fd);
+  }
+}
+
+int SocketHandoffClient::TakeSocket(const std::string& key) {
+  const auto it = fds_.find(key);
+  if (it == fds_.end()) return -1;
+  const auto fd = it->second;
+  fds_.erase(it);
+  return fd;
+}
+
+void SocketHandoffClient::NotifyStarted() {
+  [[maybe_unused]] const auto sent =
+      connection_.SendAll(&kStartedMessage, 1,
+                          engine::Deadline::FromDuration(kNotifyTimeout));
+  connection_.Close();
+}
+
+SocketHandoffServer::SocketHandoffServer(std::string path,
+                                         engine::TaskProcessor& task_processor,
+                                         SocketsGetter get_sockets,
+                                         StartedCallback on_started)
+    : path_(std::move(path)),
+      get_sockets_(std::move(get_sockets)),
+      on_started_(std::move(on_started)),
+      task_(engine::CriticalAsyncNoSpan(
+          task_processor,
+          [this](engine::io::Socket&& listener) { Serve(listener); },
+          CreateHandoffSocket(path_))) {}
+
+SocketHandoffServer::~SocketHandoffServer() { task_.SyncCancel(); }
+
+void SocketHandoffServer::Serve(engine::io::Socket& listener) {
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      auto peer = listener.Accept({});
+      if (HandOff(peer)) return;
+    } catch (const engine::io::IoCancelled&) {
+      return;
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to hand off the listening sockets: " << ex;
+    }
+  }
+}
+
+bool SocketHandoffServer::HandOff(engine::io::Socket& peer) {
+  CheckPeerIsSameUser(peer.Fd());
+
+  const auto sockets = get_sockets_();
+  if (sockets.empty() || sockets.size() > kMaxSockets) {
+    throw std::runtime_error("Cannot hand off " +
+                             std::to_string(sockets.size()) + " sockets");
+  }
+
+  std::string keys;
+  for (const auto& socket : sockets) {
+    keys += socket.key;
+    keys += '\n';
+  }
+  if (keys.size() > kMaxPayloadSize) {
+    throw std::runtime_error("Too long keys of the handed off sockets");
+  }
+
+  std::vector<char> control(CMSG_SPACE(sizeof(int) * sockets.size()));
+  iovec iov{keys.data(), keys.size()};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.data();
+  msg.msg_controllen = control.size();
+
+  auto* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * sockets.size());
+  for (std::size_t i = 0; i < sockets.size(); ++i) {
+    std::memcpy(CMSG_DATA(cmsg) + i * sizeof(int), &sockets[i].fd,
+                sizeof(int));
+  }
+
+  // The message is far smaller than the socket buffer
+  const auto sent = utils::CheckSyscall(::sendmsg(peer.Fd(), &msg, 0),
+                                        "sending the listening sockets");
+  if (static_cast<std::size_t>(sent) != keys.size()) {
+    throw std::runtime_error("Partial handoff message is sent");
+  }
+  LOG_INFO() << "Handed off " << sockets.size() << " listening sockets via "
+             << path_ << ", waiting for the next instance to start";
+
+  char message = 0;
+  const auto received = peer.RecvSome(
+      &message, 1, engine::Deadline::FromDuration(kStartTimeout));
+  if (received != 1 || message != kStartedMessage) {
+    LOG_ERROR() << "The next instance has not started, keep serving";
+    return false;
+  }
+
+  LOG_WARNING() << "The next instance has started";
+  on_started_();
+  return true;
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+// Listening socket of a listener shard, `key` is EndpointInfo::GetDescription()
+struct HandoffSocket {
+  std::string key;
+  int fd{-1};
+};
+
+// Receives the listening sockets from the previous instance of the service,
+// that keeps accepting on them until NotifyStarted() is called
+class SocketHandoffClient final {
+ public:
+  // Returns std::nullopt if no instance serves the handoff socket at `path`
+  static std::optional<SocketHandoffClient> Connect(const std::string& path,
+                                                    engine::Deadline deadline);
+
+  SocketHandoffClient(SocketHandoffClient&&) noexcept;
+  SocketHandoffClient& operator=(SocketHandoffClient&&) = delete;
+
+  // Closes the sockets that were not taken
+  ~SocketHandoffClient();
+
+  // Returns the fd of a received socket with the `key` and passes its
+  // ownership to the caller, -1 if there is none
+  int TakeSocket(const std::string& key);
+
+  // Tells the previous instance that the listeners are started, so it may
+  // drain the connections and stop
+  void NotifyStarted();
+
+ private:
+  explicit SocketHandoffClient(engine::io::Socket connection);
+
+  engine::io::Socket connection_;
+  std::unordered_multimap<std::string, int> fds_;
+};
+
+// Hands off the listening sockets to the next instance of the service that
+// connects to the handoff socket at `path` from the same user. After the next
+// instance has started, calls `on_started` once, e.g. to stop the current
+// process gracefully.
+class SocketHandoffServer final {
+ public:
+  using SocketsGetter = std::function<std::vector<HandoffSocket>()>;
+  using StartedCallback = std::function<void()>;
+
+  SocketHandoffServer(std::string path, engine::TaskProcessor& task_processor,
+                      SocketsGetter get_sockets, StartedCallback on_started);
+  ~SocketHandoffServer();
+
+ private:
+  void Serve(engine::io::Socket& listener);
+  bool HandOff(engine::io::Socket& peer);
+
+  const std::string path_;
+  const SocketsGetter get_sockets_;
+  const StartedCallback on_started_;
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
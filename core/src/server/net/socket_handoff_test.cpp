@@ -0,0 +1,274 @@
+#include <server/net/socket_handoff.hpp>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace net = server::net;
+using engine::Deadline;
+
+namespace {
+
+Deadline MakeDeadline() {
+  return Deadline::FromDuration(utest::kMaxTestWaitTime);
+}
+
+engine::io::Sockaddr MakeLoopbackAddr() {
+  engine::io::Sockaddr addr;
+  auto* sa = addr.As<struct sockaddr_in6>();
+  sa->sin6_family = AF_INET6;
+  sa->sin6_addr = in6addr_loopback;
+  return addr;
+}
+
+engine::io::Socket MakeListeningSocket() {
+  const auto addr = MakeLoopbackAddr();
+  engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+  socket.Bind(addr);
+  socket.Listen();
+  return socket;
+}
+
+engine::io::Sockaddr MakeUnixAddr(const std::string& path) {
+  engine::io::Sockaddr addr;
+  auto* sa = addr.As<struct sockaddr_un>();
+  sa->sun_family = AF_UNIX;
+  std::strncpy(sa->sun_path, path.c_str(), sizeof(sa->sun_path) - 1);
+  return addr;
+}
+
+std::size_t CountOpenFds() {
+  std::size_t result = 0;
+  for (int fd = 0; fd < 4096; ++fd) {
+    if (::fcntl(fd, F_GETFD) != -1) ++result;
+  }
+  return result;
+}
+
+// The server closes its end of the connection asynchronously
+bool WaitForOpenFds(std::size_t count) {
+  const auto deadline = MakeDeadline();
+  while (CountOpenFds() != count) {
+    if (deadline.IsReached()) return false;
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  return true;
+}
+
+// Checks that the `fd` accepts the connections to the port of `original`
+void ExpectWorkingListener(int fd, engine::io::Socket& original) {
+  ASSERT_NE(fd, -1);
+  engine::io::Socket taken{fd, engine::io::AddrDomain::kInet6};
+  EXPECT_EQ(taken.Getsockname().Port(), original.Getsockname().Port());
+
+  auto addr = MakeLoopbackAddr();
+  addr.SetPort(original.Getsockname().Port());
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, MakeDeadline());
+  UEXPECT_NO_THROW(taken.Accept(MakeDeadline()));
+}
+
+// Sends a raw handoff message with the `fds` to the first client
+engine::TaskWithResult<void> ServeRawMessage(const std::string& path,
+                                             std::string payload,
+                                             std::vector<int> fds) {
+  const auto addr = MakeUnixAddr(path);
+  engine::io::Socket listener{addr.Domain(), engine::io::SocketType::kStream};
+  listener.Bind(addr);
+  listener.Listen();
+
+  return engine::AsyncNoSpan([listener = std::move(listener),
+                              payload = std::move(payload),
+                              fds = std::move(fds)]() mutable {
+    auto peer = listener.Accept(MakeDeadline());
+
+    std::vector<char> control(CMSG_SPACE(sizeof(int) * fds.size()));
+    iovec iov{payload.data(), payload.size()};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    if (!fds.empty()) {
+      msg.msg_control = control.data();
+      msg.msg_controllen = control.size();
+      auto* cmsg = CMSG_FIRSTHDR(&msg);
+      cmsg->cmsg_level = SOL_SOCKET;
+      cmsg->cmsg_type = SCM_RIGHTS;
+      cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+      std::memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * fds.size());
+    }
+    ASSERT_EQ(::sendmsg(peer.Fd(), &msg, 0),
+              static_cast<ssize_t>(payload.size()));
+
+    // Keeps the connection open until the client is done
+    char message = 0;
+    [[maybe_unused]] const auto received =
+        peer.RecvSome(&message, 1, MakeDeadline());
+  });
+}
+
+class SocketHandoff : public ::testing::Test {
+ protected:
+  const fs::blocking::TempDirectory dir_ =
+      fs::blocking::TempDirectory::Create();
+  const std::string path_ = dir_.GetPath() + "/handoff.sock";
+};
+
+}  // namespace
+
+UTEST_F(SocketHandoff, NoServer) {
+  EXPECT_FALSE(net::SocketHandoffClient::Connect(path_, MakeDeadline()));
+}
+
+UTEST_F(SocketHandoff, HandOff) {
+  auto main_socket = MakeListeningSocket();
+  auto monitor_socket = MakeListeningSocket();
+
+  engine::SingleConsumerEvent started;
+  net::SocketHandoffServer server{
+      path_, engine::current_task::GetTaskProcessor(),
+      [&] {
+        return std::vector<net::HandoffSocket>{
+            {"main", main_socket.Fd()}, {"monitor", monitor_socket.Fd()}};
+      },
+      [&] { started.Send(); }};
+
+  auto client = net::SocketHandoffClient::Connect(path_, MakeDeadline());
+  ASSERT_TRUE(client);
+
+  ExpectWorkingListener(client->TakeSocket("main"), main_socket);
+  EXPECT_EQ(client->TakeSocket("main"), -1);
+  EXPECT_EQ(client->TakeSocket("unknown"), -1);
+  ExpectWorkingListener(client->TakeSocket("monitor"), monitor_socket);
+
+  client->NotifyStarted();
+  EXPECT_TRUE(started.WaitForEventFor(utest::kMaxTestWaitTime));
+}
+
+UTEST_F(SocketHandoff, PrivateSocketFile) {
+  auto main_socket = MakeListeningSocket();
+  const auto old_umask = ::umask(S_IWGRP | S_IWOTH);
+
+  net::SocketHandoffServer server{
+      path_, engine::current_task::GetTaskProcessor(),
+      [&] {
+        return std::vector<net::HandoffSocket>{{"main", main_socket.Fd()}};
+      },
+      [] {}};
+
+  // The process umask is left as is
+  EXPECT_EQ(::umask(old_umask), S_IWGRP | S_IWOTH);
+
+  struct stat info {};
+  ASSERT_EQ(::lstat(path_.c_str(), &info), 0);
+  EXPECT_TRUE(S_ISSOCK(info.st_mode));
+  EXPECT_EQ(info.st_mode & 0777, S_IRUSR | S_IWUSR);
+
+  // The private directory the socket is bound in is removed
+  std::size_t entries = 0;
+  for ([[maybe_unused]] const auto& entry :
+       boost::filesystem::directory_iterator(dir_.GetPath())) {
+    ++entries;
+  }
+  EXPECT_EQ(entries, 1);
+
+  auto client = net::SocketHandoffClient::Connect(path_, MakeDeadline());
+  ASSERT_TRUE(client);
+  ExpectWorkingListener(client->TakeSocket("main"), main_socket);
+}
+
+UTEST_F(SocketHandoff, NotStartedKeepsServing) {
+  auto main_socket = MakeListeningSocket();
+  auto monitor_socket = MakeListeningSocket();
+
+  engine::SingleConsumerEvent started;
+  net::SocketHandoffServer server{
+      path_, engine::current_task::GetTaskProcessor(),
+      [&] {
+        return std::vector<net::HandoffSocket>{
+            {"main", main_socket.Fd()}, {"monitor", monitor_socket.Fd()}};
+      },
+      [&] { started.Send(); }};
+
+  {
+    auto client = net::SocketHandoffClient::Connect(path_, MakeDeadline());
+    ASSERT_TRUE(client);
+    const auto taken_fd = client->TakeSocket("main");
+    ASSERT_NE(taken_fd, -1);
+    ::close(taken_fd);
+  }
+
+  // The previous client has gone without NotifyStarted()
+  EXPECT_FALSE(started.WaitForEventFor(std::chrono::milliseconds{10}));
+
+  const auto fds_before = CountOpenFds();
+  {
+    auto client = net::SocketHandoffClient::Connect(path_, MakeDeadline());
+    ASSERT_TRUE(client);
+    ExpectWorkingListener(client->TakeSocket("main"), main_socket);
+  }
+  // The "monitor" socket that is not taken is closed by the client
+  EXPECT_TRUE(WaitForOpenFds(fds_before));
+  EXPECT_FALSE(started.WaitForEventFor(std::chrono::milliseconds{10}));
+}
+
+UTEST_F(SocketHandoff, TooManySockets) {
+  auto main_socket = MakeListeningSocket();
+
+  net::SocketHandoffServer server{
+      path_, engine::current_task::GetTaskProcessor(),
+      [&] {
+        return std::vector<net::HandoffSocket>(1000,
+                                               {"main", main_socket.Fd()});
+      },
+      [] { FAIL() << "Must not start"; }};
+
+  // The server drops the connection without sending anything
+  UEXPECT_THROW_MSG(net::SocketHandoffClient::Connect(path_, MakeDeadline()),
+                    std::runtime_error, "Malformed handoff message");
+}
+
+UTEST_F(SocketHandoff, MalformedMessages) {
+  auto main_socket = MakeListeningSocket();
+
+  const std::vector<std::pair<std::string, std::vector<int>>> messages{
+      // more keys than sockets
+      {"main\nmonitor\n", {main_socket.Fd()}},
+      // more sockets than keys
+      {"main\n", {main_socket.Fd(), main_socket.Fd()}},
+      // no trailing newline
+      {"main", {main_socket.Fd()}},
+      // no sockets at all
+      {"main\n", {}},
+  };
+
+  for (const auto& [payload, fds] : messages) {
+    auto task = ServeRawMessage(path_, payload, fds);
+    UEXPECT_THROW_MSG(
+        net::SocketHandoffClient::Connect(path_, MakeDeadline()),
+        std::runtime_error, "Malformed handoff message");
+    task.Get();
+    ::unlink(path_.c_str());
+  }
+}
+
+USERVER_NAMESPACE_END
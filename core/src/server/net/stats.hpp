@@ -27,9 +27,12 @@ struct Stats {
       : active_connections(other.active_connections.load()),
         connections_created(other.connections_created.load()),
         connections_closed(other.connections_closed.load()),
+        receive_buffers_bytes(other.receive_buffers_bytes.load()),
+        receive_buffers_free_bytes(other.receive_buffers_free_bytes.load()),
         parser_stats(other.parser_stats),
         active_request_count(other.active_request_count.load()),
-        requests_processed_count(other.requests_processed_count.load()) {}
+        requests_processed_count(other.requests_processed_count.load()),
+        requests_memory_bytes(other.requests_memory_bytes.load()) {}
 
   Stats() = default;
 
@@ -37,21 +40,29 @@ struct Stats {
   std::atomic<size_t> active_connections{0};
   std::atomic<size_t> connections_created{0};
   std::atomic<size_t> connections_closed{0};
+  // receive slabs of the listener pool, both in use and free
+  std::atomic<size_t> receive_buffers_bytes{0};
+  std::atomic<size_t> receive_buffers_free_bytes{0};
 
   // per connection
   ParserStats parser_stats;
   std::atomic<size_t> active_request_count{0};
   std::atomic<size_t> requests_processed_count{0};
+  // charged to the connection MemoryBudget
+  std::atomic<size_t> requests_memory_bytes{0};
 };
 
 inline Stats& operator+=(Stats& lhs, const Stats& rhs) {
   lhs.active_connections += rhs.active_connections;
   lhs.connections_created += rhs.connections_created;
   lhs.connections_closed += rhs.connections_closed;
+  lhs.receive_buffers_bytes += rhs.receive_buffers_bytes;
+  lhs.receive_buffers_free_bytes += rhs.receive_buffers_free_bytes;
 
   lhs.parser_stats += rhs.parser_stats;
   lhs.active_request_count += rhs.active_request_count;
   lhs.requests_processed_count += rhs.requests_processed_count;
+  lhs.requests_memory_bytes += rhs.requests_memory_bytes;
   return lhs;
 }
 
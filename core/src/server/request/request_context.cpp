@@ -4,12 +4,37 @@
 #include <stdexcept>
 #include <unordered_map>
 
+#include <userver/utils/arena.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
 
+namespace {
+
+constexpr std::size_t kArenaBlockSize = 16 * 1024;
+constexpr std::size_t kArenaMaxFreeBlocks = 1024;
+
+// Requests may finish on any thread, the blocks of their arenas are reused via
+// the pool instead of being freed to the heap of that thread
+utils::ArenaBlockPool& GetArenaBlockPool() {
+  static utils::ArenaBlockPool pool{kArenaBlockSize, kArenaMaxFreeBlocks};
+  return pool;
+}
+
+struct RequestArena final {
+  RequestArena() : arena(GetArenaBlockPool()), resource(arena) {}
+
+  utils::Arena arena;
+  utils::ArenaMemoryResource resource;
+};
+
+}  // namespace
+
 class RequestContext::Impl final {
  public:
+  RequestArena& GetArena();
+
   utils::AnyMovable& SetUserAnyData(utils::AnyMovable&& data);
   utils::AnyMovable& GetUserAnyData();
   utils::AnyMovable* GetUserAnyDataOptional();
@@ -21,10 +46,17 @@ class RequestContext::Impl final {
   void EraseAnyData(const std::string& name);
 
  private:
+  // destroyed after the data that may use it
+  std::unique_ptr<RequestArena> arena_;
   utils::AnyMovable user_data_;
   std::unordered_map<std::string, utils::AnyMovable> named_datum_;
 };
 
+RequestArena& RequestContext::Impl::GetArena() {
+  if (!arena_) arena_ = std::make_unique<RequestArena>();
+  return *arena_;
+}
+
 utils::AnyMovable& RequestContext::Impl::SetUserAnyData(
     utils::AnyMovable&& data) {
   if (user_data_.HasValue())
@@ -115,6 +147,12 @@ void RequestContext::EraseAnyData(const std::string& name) {
   return impl_->EraseAnyData(name);
 }
 
+utils::Arena& RequestContext::GetArena() { return impl_->GetArena().arena; }
+
+std::pmr::memory_resource& RequestContext::GetMemoryResource() {
+  return impl_->GetArena().resource;
+}
+
 }  // namespace server::request
 
 USERVER_NAMESPACE_END
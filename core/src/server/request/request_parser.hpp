@@ -1,6 +1,10 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+
+#include <server/net/memory_budget.hpp>
+#include <server/net/receive_buffer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +19,14 @@ class RequestParser {
   virtual ~RequestParser() noexcept = default;
 
   virtual bool Parse(const char* data, size_t size) = 0;
+
+  /// The data passed to the following Parse() calls lies in `slab`, so the
+  /// parser may refer to it instead of copying. An empty `slab` disables that.
+  virtual void SetReceiveSlab(net::ReceiveSlab /*slab*/) {}
+
+  /// The requests created after the call are charged to `budget` and fail
+  /// with 413 once it is exhausted
+  virtual void SetMemoryBudget(std::shared_ptr<net::MemoryBudget> /*budget*/) {}
 };
 
 }  // namespace server::request
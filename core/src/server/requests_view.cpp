@@ -1,4 +1,6 @@
 #include <server/requests_view.hpp>
+
+#include <compiler/tls.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -8,6 +10,13 @@ USERVER_NAMESPACE_BEGIN
 namespace {
 const auto kDequeueBulkSize = 10000;
 const auto kDequeuePollPeriod = std::chrono::milliseconds(100);
+
+// Counts the new requests of the current worker thread for sampling, so that
+// the threads do not contend on a shared counter
+USERVER_PREVENT_TLS_CACHING bool ShouldSample(std::size_t sample_rate) {
+  thread_local std::size_t new_requests_count = 0;
+  return ++new_requests_count % sample_rate == 0;
+}
 }  // namespace
 
 namespace server {
@@ -17,6 +26,18 @@ RequestsView::RequestsView()
 
 RequestsView::~RequestsView() { StopBackgroundWorker(); }
 
+void RequestsView::SetSampleRate(std::size_t sample_rate) noexcept {
+  sample_rate_.store(sample_rate, std::memory_order_relaxed);
+}
+
+void RequestsView::OnNewRequest(
+    const std::shared_ptr<request::RequestBase>& request) {
+  const auto sample_rate = sample_rate_.load(std::memory_order_relaxed);
+  if (sample_rate == 0) return;
+  if (sample_rate > 1 && !ShouldSample(sample_rate)) return;
+  queue_->enqueue(request);
+}
+
 std::vector<std::shared_ptr<request::RequestBase>>
 RequestsView::GetAllRequests() {
   std::vector<std::shared_ptr<request::RequestBase>> result;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <list>
 #include <memory>
 
@@ -22,6 +24,12 @@ class RequestsView final {
 
   std::shared_ptr<Queue> GetQueue() { return queue_; }
 
+  /// Tracks 1 in `sample_rate` new requests, none if 0
+  void SetSampleRate(std::size_t sample_rate) noexcept;
+
+  /// Called for each new request, lock-free
+  void OnNewRequest(const std::shared_ptr<request::RequestBase>& request);
+
   std::vector<std::shared_ptr<request::RequestBase>> GetAllRequests();
 
   void StartBackgroundWorker();
@@ -36,6 +44,7 @@ class RequestsView final {
   void HandleQueue();
 
   std::shared_ptr<Queue> queue_;
+  std::atomic<std::size_t> sample_rate_{1};
   engine::TaskWithResult<void> job_task_;
   std::vector<RequestWPtr> job_requests;
 
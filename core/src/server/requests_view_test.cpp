@@ -0,0 +1,64 @@
+#include <server/requests_view.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kRequestsCount = 120;
+
+// Returns the number of the requests that got into the queue
+std::size_t CountTracked(server::RequestsView& view) {
+  server::request::ResponseDataAccounter data_accounter;
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  for (std::size_t i = 0; i < kRequestsCount; ++i) {
+    requests.push_back(
+        std::make_shared<server::http::HttpRequestImpl>(data_accounter));
+    view.OnNewRequest(requests.back());
+  }
+
+  std::size_t tracked = 0;
+  server::RequestsView::RequestWPtr request;
+  while (view.GetQueue()->try_dequeue(request)) {
+    EXPECT_TRUE(request.lock());
+    ++tracked;
+  }
+  return tracked;
+}
+
+}  // namespace
+
+UTEST(RequestsView, TracksAllByDefault) {
+  server::RequestsView view;
+  EXPECT_EQ(CountTracked(view), kRequestsCount);
+}
+
+UTEST(RequestsView, SampleRate) {
+  server::RequestsView view;
+
+  view.SetSampleRate(1);
+  EXPECT_EQ(CountTracked(view), kRequestsCount);
+
+  // Any run of consecutive requests holds the same number of the sampled ones
+  view.SetSampleRate(4);
+  EXPECT_EQ(CountTracked(view), kRequestsCount / 4);
+
+  view.SetSampleRate(7);
+  const auto tracked = CountTracked(view);
+  EXPECT_GE(tracked, kRequestsCount / 7);
+  EXPECT_LE(tracked, kRequestsCount / 7 + 1);
+
+  view.SetSampleRate(0);
+  EXPECT_EQ(CountTracked(view), 0);
+
+  view.SetSampleRate(1);
+  EXPECT_EQ(CountTracked(view), kRequestsCount);
+}
+
+USERVER_NAMESPACE_END
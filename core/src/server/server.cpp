@@ -1,24 +1,38 @@
 #include <userver/server/server.hpp>
 
+#include <unistd.h>
+
 #include <atomic>
+#include <chrono>
+#include <csignal>
+#include <optional>
 #include <shared_mutex>
 #include <stdexcept>
 
+#include <userver/concurrent/async_event_source.hpp>
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/storage/component.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/engine/task/single_threaded_task_processors_pool.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <engine/ev/thread_pool.hpp>
 #include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/handlers/http_server_settings.hpp>
 #include <server/http/http_request_handler.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/net/endpoint_info.hpp>
 #include <server/net/listener.hpp>
+#include <server/net/socket_handoff.hpp>
 #include <server/net/stats.hpp>
 #include <server/pph_config.hpp>
 #include <server/requests_view.hpp>
 #include <server/server_config.hpp>
 #include <userver/fs/blocking/read.hpp>
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,21 +40,30 @@ namespace server {
 
 namespace {
 
+constexpr std::chrono::seconds kSocketHandoffTimeout{10};
+
 struct PortInfo final {
   void Init(const ServerConfig& config,
             const net::ListenerConfig& listener_config,
             const components::ComponentContext& component_context,
             bool is_monitor);
 
-  void Start();
+  void Start(net::SocketHandoffClient* socket_handoff);
 
   void Stop();
 
   bool IsRunning() const noexcept;
 
+  std::vector<net::HandoffSocket> GetHandoffSockets() const;
+
   std::optional<http::HttpRequestHandler> request_handler_;
   std::shared_ptr<net::EndpointInfo> endpoint_info_;
   request::ResponseDataAccounter data_accounter_;
+  // Must outlive the listeners and their connections. Outlive Stop(), because
+  // the handlers may leave tasks on them, e.g. in their background task
+  // storages, until the handler components are destroyed.
+  std::optional<engine::SingleThreadedTaskProcessorsPool> shard_processors_;
+  std::optional<engine::SingleThreadedTaskProcessorsPool> acceptor_processors_;
   std::vector<net::Listener> listeners_;
 };
 
@@ -64,18 +87,59 @@ void PortInfo::Init(const ServerConfig& config,
   size_t listener_shards = listener_config.shards ? *listener_config.shards
                                                   : event_thread_pool.GetSize();
 
+  endpoint_info_->shards_count = listener_shards;
+
   listeners_.reserve(listener_shards);
+  if (listener_config.shared_nothing) {
+    request_handler_->SetSharedNothing(true);
+
+    // Every listener socket has SO_REUSEPORT, so the kernel spreads the
+    // connections over the shards
+    engine::TaskProcessorConfig shard_config;
+    shard_config.name = listener_config.task_processor + "-shard";
+    shard_config.thread_name = is_monitor ? "mon-shard" : "shard";
+    shard_config.worker_threads = listener_shards;
+    shard_config.ev_thread_affinity = true;
+    shard_processors_.emplace(shard_config);
+
+    for (std::size_t i = 0; i < listener_shards; ++i) {
+      listeners_.emplace_back(endpoint_info_, shard_processors_->At(i),
+                              shard_processors_->At(i), data_accounter_);
+    }
+    return;
+  }
+
+  if (listener_config.pinned_acceptors) {
+    // Accept loops of the shards do not compete for the same ev thread
+    // during connection storms
+    engine::TaskProcessorConfig acceptor_config;
+    acceptor_config.name = listener_config.task_processor + "-acceptor";
+    acceptor_config.thread_name = is_monitor ? "mon-acceptor" : "acceptor";
+    acceptor_config.worker_threads = listener_shards;
+    acceptor_config.ev_thread_affinity = true;
+    acceptor_processors_.emplace(acceptor_config);
+
+    for (std::size_t i = 0; i < listener_shards; ++i) {
+      listeners_.emplace_back(endpoint_info_, task_processor,
+                              acceptor_processors_->At(i), data_accounter_);
+    }
+    return;
+  }
+
   while (listener_shards--) {
-    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
+    listeners_.emplace_back(endpoint_info_, task_processor, task_processor,
+                            data_accounter_);
   }
 }
 
-void PortInfo::Start() {
+void PortInfo::Start(net::SocketHandoffClient* socket_handoff) {
   UASSERT(request_handler_);
   request_handler_->DisableAddHandler();
+  endpoint_info_->socket_handoff = socket_handoff;
   for (auto& listener : listeners_) {
     listener.Start();
   }
+  endpoint_info_->socket_handoff = nullptr;
 }
 
 void PortInfo::Stop() {
@@ -91,12 +155,31 @@ void PortInfo::Stop() {
   LOG_TRACE() << "Stopping request handlers";
   request_handler_.reset();
   LOG_TRACE() << "Stopped request handlers";
+
+  // Cancels the tasks that the requests have detached on the shards, the
+  // processors themselves wait for all their tasks on destruction
+  for (auto* processors : {&shard_processors_, &acceptor_processors_}) {
+    if (!*processors) continue;
+    for (std::size_t i = 0; i < (*processors)->GetSize(); ++i) {
+      (*processors)->At(i).InitiateShutdown();
+    }
+  }
 }
 
 bool PortInfo::IsRunning() const noexcept {
   return request_handler_ && request_handler_->IsAddHandlerDisabled();
 }
 
+std::vector<net::HandoffSocket> PortInfo::GetHandoffSockets() const {
+  std::vector<net::HandoffSocket> sockets;
+  if (!endpoint_info_) return sockets;
+  for (const auto& listener : listeners_) {
+    const auto fd = listener.GetSocketFd();
+    if (fd != -1) sockets.push_back({endpoint_info_->GetDescription(), fd});
+  }
+  return sockets;
+}
+
 }  // namespace
 
 class ServerImpl final {
@@ -109,6 +192,8 @@ class ServerImpl final {
   void StartPortInfos();
   void Stop();
 
+  std::vector<net::HandoffSocket> GetHandoffSockets() const;
+
   void AddHandler(const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
 
@@ -116,6 +201,7 @@ class ServerImpl final {
   std::chrono::milliseconds GetAvgRequestTimeMs() const;
   const http::HttpRequestHandler& GetHttpRequestHandler(bool is_monitor) const;
   net::Stats GetServerStats() const;
+  std::optional<engine::io::TlsServerContext::Stats> GetTlsStats() const;
   const ServerConfig& GetServerConfig() const { return config_; }
 
   RequestsView& GetRequestsView();
@@ -125,6 +211,8 @@ class ServerImpl final {
   void SetRpsRatelimit(std::optional<size_t> rps);
 
  private:
+  void OnConfigUpdate(const dynamic_config::Snapshot& config);
+
   PortInfo main_port_info_;
   PortInfo monitor_port_info_;
 
@@ -137,6 +225,11 @@ class ServerImpl final {
   RequestsView requests_view_{};
 
   ServerConfig config_;
+
+  // Stopped before the listeners
+  std::optional<net::SocketHandoffServer> socket_handoff_server_;
+
+  concurrent::AsyncEventSubscriberScope config_subscription_;
 };
 
 ServerImpl::ServerImpl(ServerConfig config,
@@ -164,19 +257,31 @@ ServerImpl::ServerImpl(ServerConfig config,
                             component_context, true);
   }
 
+  config_subscription_ =
+      component_context.FindComponent<components::DynamicConfig>()
+          .GetSource()
+          .UpdateAndListen(this, "server", &ServerImpl::OnConfigUpdate);
+
   LOG_INFO() << "Server is created, listening for incoming connections.";
 }
 
-ServerImpl::~ServerImpl() { Stop(); }
+ServerImpl::~ServerImpl() {
+  config_subscription_.Unsubscribe();
+  Stop();
+}
+
+void ServerImpl::OnConfigUpdate(const dynamic_config::Snapshot& config) {
+  requests_view_.SetSampleRate(config[handlers::kInspectRequestsSampleRate]);
+}
 
 void ServerImpl::StartPortInfos() {
   UASSERT(main_port_info_.request_handler_);
 
   if (has_requests_view_watchers_.load()) {
-    auto queue = requests_view_.GetQueue();
     requests_view_.StartBackgroundWorker();
-    auto hook = [queue](std::shared_ptr<request::RequestBase> request) {
-      queue->enqueue(request);
+    // The listeners are stopped before the requests_view_ is destroyed
+    auto hook = [this](std::shared_ptr<request::RequestBase> request) {
+      requests_view_.OnNewRequest(request);
     };
     main_port_info_.request_handler_->SetNewRequestHook(hook);
     if (monitor_port_info_.request_handler_) {
@@ -184,12 +289,58 @@ void ServerImpl::StartPortInfos() {
     }
   }
 
-  main_port_info_.Start();
+  const auto connect_handoff =
+      [this]() -> std::optional<net::SocketHandoffClient> {
+    if (!config_.handoff_socket) return std::nullopt;
+    try {
+      return net::SocketHandoffClient::Connect(
+          *config_.handoff_socket,
+          engine::Deadline::FromDuration(kSocketHandoffTimeout));
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to take the listening sockets from the running "
+                     "instance, creating new ones: "
+                  << ex;
+      return std::nullopt;
+    }
+  };
+  auto socket_handoff = connect_handoff();
+  auto* socket_handoff_ptr = socket_handoff ? &*socket_handoff : nullptr;
+
+  main_port_info_.Start(socket_handoff_ptr);
   if (monitor_port_info_.request_handler_) {
-    monitor_port_info_.Start();
+    monitor_port_info_.Start(socket_handoff_ptr);
   } else {
     LOG_WARNING() << "No 'listener-monitor' in 'server' component";
   }
+
+  if (socket_handoff) {
+    // The previous instance stops accepting and drains its connections
+    socket_handoff->NotifyStarted();
+    socket_handoff.reset();
+  }
+  if (config_.handoff_socket) {
+    try {
+      socket_handoff_server_.emplace(
+          *config_.handoff_socket, engine::current_task::GetTaskProcessor(),
+          [this] { return GetHandoffSockets(); },
+          [] {
+            // The components are stopped in order, the connections are
+            // drained
+            utils::CheckSyscall(::kill(::getpid(), SIGTERM),
+                                "sending SIGTERM");
+          });
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to serve the handoff socket "
+                  << *config_.handoff_socket << ": " << ex;
+    }
+  }
+}
+
+std::vector<net::HandoffSocket> ServerImpl::GetHandoffSockets() const {
+  auto sockets = main_port_info_.GetHandoffSockets();
+  auto monitor_sockets = monitor_port_info_.GetHandoffSockets();
+  sockets.insert(sockets.end(), monitor_sockets.begin(), monitor_sockets.end());
+  return sockets;
 }
 
 void ServerImpl::Stop() {
@@ -200,6 +351,7 @@ void ServerImpl::Stop() {
   }
 
   LOG_INFO() << "Stopping server";
+  socket_handoff_server_.reset();
   main_port_info_.Stop();
   monitor_port_info_.Stop();
   LOG_INFO() << "Stopped server";
@@ -264,6 +416,16 @@ net::Stats ServerImpl::GetServerStats() const {
   return summary;
 }
 
+std::optional<engine::io::TlsServerContext::Stats> ServerImpl::GetTlsStats()
+    const {
+  std::shared_lock lock{on_stop_mutex_};
+  if (is_stopping_ || !main_port_info_.endpoint_info_) return {};
+
+  const auto& tls_context = main_port_info_.endpoint_info_->tls_context;
+  if (!tls_context) return {};
+  return tls_context->GetStats();
+}
+
 RequestsView& ServerImpl::GetRequestsView() {
   UASSERT(!main_port_info_.IsRunning() || has_requests_view_watchers_.load());
 
@@ -331,12 +493,33 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     conn_stats["closed"] = server_stats.connections_closed;
   }
 
+  if (auto memory_stats = writer["connections"]["memory"]) {
+    const auto memory_bytes = server_stats.receive_buffers_bytes +
+                              server_stats.requests_memory_bytes;
+    memory_stats["receive-buffers-bytes"] = server_stats.receive_buffers_bytes;
+    memory_stats["receive-buffers-pooled-bytes"] =
+        server_stats.receive_buffers_free_bytes;
+    memory_stats["requests-bytes"] = server_stats.requests_memory_bytes;
+    memory_stats["per-connection-bytes"] =
+        server_stats.active_connections
+            ? memory_bytes / server_stats.active_connections
+            : 0;
+  }
+
   if (auto request_stats = writer["requests"]) {
     request_stats["active"] = server_stats.active_request_count;
     request_stats["avg-lifetime-ms"] = pimpl->GetAvgRequestTimeMs().count();
     request_stats["processed"] = server_stats.requests_processed_count;
     request_stats["parsing"] = server_stats.parser_stats.parsing_request_count;
   }
+
+  if (const auto tls_stats = pimpl->GetTlsStats()) {
+    if (auto handshake_stats = writer["tls"]["handshakes"]) {
+      handshake_stats["full"] = tls_stats->full_handshakes;
+      handshake_stats["resumed"] = tls_stats->resumed_handshakes;
+      handshake_stats["failed"] = tls_stats->failed_handshakes;
+    }
+  }
 }
 
 void Server::WriteTotalHandlerStatistics(
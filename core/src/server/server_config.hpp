@@ -19,6 +19,9 @@ struct ServerConfig {
   std::optional<size_t> max_response_size_in_flight;
   std::string server_name;
   bool set_response_server_hostname{false};
+  // Unix socket to receive the listening sockets from the previous instance
+  // of the service and to hand them off to the next one
+  std::optional<std::string> handoff_socket;
 };
 
 ServerConfig Parse(const yaml_config::YamlConfig& value,
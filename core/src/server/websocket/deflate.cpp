@@ -0,0 +1,209 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+// Each compressed message ends with an empty stored block that is stripped
+// by the sender, see RFC 7692 section 7.2.1
+constexpr std::array<char, 4> kDeflateTail{'\x00', '\x00', '\xff', '\xff'};
+
+constexpr int kMemLevel = 8;
+constexpr std::size_t kMinCompressBufferSize = 64;
+constexpr std::size_t kDecompressBufferSize = 4096;
+
+std::string_view TrimView(std::string_view str) noexcept {
+  while (!str.empty() && utils::text::IsAsciiSpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && utils::text::IsAsciiSpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+  int bits = 0;
+  const auto [ptr, ec] =
+      std::from_chars(value.data(), value.data() + value.size(), bits);
+  if (ec != std::errc{} || ptr != value.data() + value.size()) return {};
+  // zlib does not support a raw deflate window of 8 bits
+  if (bits < kMinDeflateWindowBits || bits > kMaxDeflateWindowBits) return {};
+  return bits;
+}
+
+std::optional<DeflateParams> ParseOffer(std::string_view offer) {
+  const auto parts = utils::text::SplitIntoStringViewVector(offer, ";");
+  if (parts.empty() || TrimView(parts.front()) != kExtensionName) return {};
+
+  DeflateParams params;
+  bool server_no_context_takeover = false;
+  bool client_max_window_bits = false;
+  for (std::size_t i = 1; i < parts.size(); ++i) {
+    const auto param = TrimView(parts[i]);
+    const auto eq_pos = param.find('=');
+    const auto name = TrimView(param.substr(0, eq_pos));
+    const auto value = eq_pos == std::string_view::npos
+                           ? std::string_view{}
+                           : TrimView(param.substr(eq_pos + 1));
+
+    // Offers with duplicate or unknown parameters are declined
+    if (name == "server_no_context_takeover" && value.empty() &&
+        !server_no_context_takeover) {
+      server_no_context_takeover = true;
+    } else if (name == "client_no_context_takeover" && value.empty() &&
+               !params.client_no_context_takeover) {
+      params.client_no_context_takeover = true;
+    } else if (name == "server_max_window_bits" &&
+               !params.server_max_window_bits_requested) {
+      const auto bits = ParseWindowBits(value);
+      if (!bits) return {};
+      params.server_max_window_bits = *bits;
+      params.server_max_window_bits_requested = true;
+    } else if (name == "client_max_window_bits" && !client_max_window_bits) {
+      // The inflater always uses the maximum window, so the hint is ignored
+      if (!value.empty() && !ParseWindowBits(value)) return {};
+      client_max_window_bits = true;
+    } else {
+      return {};
+    }
+  }
+  return params;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions) {
+  for (const auto offer :
+       utils::text::SplitIntoStringViewVector(extensions, ",")) {
+    auto params = ParseOffer(offer);
+    if (params) return params;
+  }
+  return {};
+}
+
+std::string MakeDeflateResponse(const DeflateParams& params) {
+  std::string response{kExtensionName};
+  response += "; server_no_context_takeover";
+  if (params.client_no_context_takeover) {
+    response += "; client_no_context_takeover";
+  }
+  if (params.server_max_window_bits_requested) {
+    response +=
+        fmt::format("; server_max_window_bits={}", params.server_max_window_bits);
+  }
+  return response;
+}
+
+Deflater::Deflater(int level, int window_bits) {
+  UASSERT(window_bits >= kMinDeflateWindowBits &&
+          window_bits <= kMaxDeflateWindowBits);
+  // Negative window bits produce raw deflate data without the zlib header
+  if (deflateInit2(&stream_, level, Z_DEFLATED, -window_bits, kMemLevel,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw std::runtime_error("failed to initialize websocket deflate");
+  }
+}
+
+Deflater::~Deflater() { deflateEnd(&stream_); }
+
+std::string Deflater::Compress(utils::span<const std::byte> data) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  stream_.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+  stream_.avail_in = data.size();
+  UASSERT(stream_.avail_in == data.size());
+
+  std::string compressed;
+  compressed.resize(std::max<std::size_t>(
+      deflateBound(&stream_, data.size()) + kDeflateTail.size(),
+      kMinCompressBufferSize));
+  std::size_t size = 0;
+  while (true) {
+    stream_.next_out = reinterpret_cast<Bytef*>(compressed.data() + size);
+    stream_.avail_out = compressed.size() - size;
+    const auto ret = deflate(&stream_, Z_SYNC_FLUSH);
+    size = compressed.size() - stream_.avail_out;
+    if (ret == Z_STREAM_ERROR) {
+      throw std::runtime_error("failed to deflate websocket message");
+    }
+
+    // deflate() needs more output space if it has filled all the buffer
+    if (stream_.avail_out != 0) break;
+    compressed.resize(compressed.size() * 2);
+  }
+
+  // server_no_context_takeover: the next message starts from a clean state
+  deflateReset(&stream_);
+
+  UASSERT(size >= kDeflateTail.size());
+  compressed.resize(size - kDeflateTail.size());
+  return compressed;
+}
+
+Inflater::Inflater() {
+  if (inflateInit2(&stream_, -kMaxDeflateWindowBits) != Z_OK) {
+    throw std::runtime_error("failed to initialize websocket inflate");
+  }
+}
+
+Inflater::~Inflater() { inflateEnd(&stream_); }
+
+CloseStatus Inflater::Decompress(std::string_view compressed, std::string& out,
+                                 std::size_t max_size) {
+  out.resize(0);
+
+  for (const auto input :
+       {compressed, std::string_view{kDeflateTail.data(), kDeflateTail.size()}}) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream_.avail_in = input.size();
+
+    while (true) {
+      const auto offset = out.size();
+      out.resize(offset + kDecompressBufferSize);
+      stream_.next_out = reinterpret_cast<Bytef*>(out.data() + offset);
+      stream_.avail_out = kDecompressBufferSize;
+
+      const auto ret = inflate(&stream_, Z_SYNC_FLUSH);
+      out.resize(out.size() - stream_.avail_out);
+      if (out.size() > max_size) return CloseStatus::kTooBigData;
+      if (ret == Z_STREAM_END) {
+        // A final block ends the stream, the next message starts a new one
+        inflateReset(&stream_);
+        return CloseStatus::kNone;
+      }
+      if (ret != Z_OK && ret != Z_BUF_ERROR) {
+        return CloseStatus::kProtocolError;
+      }
+
+      // inflate() has more output if it has filled all the buffer
+      if (stream_.avail_out != 0) {
+        if (stream_.avail_in == 0) break;
+        // no progress is possible
+        if (ret == Z_BUF_ERROR) return CloseStatus::kProtocolError;
+      }
+    }
+  }
+  return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
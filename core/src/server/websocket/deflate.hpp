@@ -0,0 +1,78 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/*
+ permessage-deflate extension
+ https://datatracker.ietf.org/doc/html/rfc7692
+
+ The server always replies with server_no_context_takeover, so that each
+ outgoing message is compressed independently and a compressed frame may be
+ shared by many connections.
+*/
+
+inline constexpr int kMinDeflateWindowBits = 9;
+inline constexpr int kMaxDeflateWindowBits = 15;
+inline constexpr int kDefaultDeflateLevel = Z_DEFAULT_COMPRESSION;
+
+struct DeflateParams final {
+  int server_max_window_bits = kMaxDeflateWindowBits;
+  bool server_max_window_bits_requested = false;
+  bool client_no_context_takeover = false;
+};
+
+// Chooses the first acceptable permessage-deflate offer of the
+// Sec-WebSocket-Extensions request header
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions);
+
+// Sec-WebSocket-Extensions response header for the accepted offer
+std::string MakeDeflateResponse(const DeflateParams& params);
+
+class Deflater final {
+ public:
+  Deflater(int level, int window_bits);
+
+  Deflater(const Deflater&) = delete;
+  Deflater& operator=(const Deflater&) = delete;
+
+  ~Deflater();
+
+  // Compresses a whole message without the trailing 0x00 0x00 0xff 0xff
+  std::string Compress(utils::span<const std::byte> data);
+
+ private:
+  z_stream stream_{};
+};
+
+class Inflater final {
+ public:
+  Inflater();
+
+  Inflater(const Inflater&) = delete;
+  Inflater& operator=(const Inflater&) = delete;
+
+  ~Inflater();
+
+  // Decompresses a whole message into `out`, keeps the sliding window for the
+  // next messages. Returns kTooBigData if the result exceeds `max_size`.
+  CloseStatus Decompress(std::string_view compressed, std::string& out,
+                         std::size_t max_size);
+
+ private:
+  z_stream stream_{};
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
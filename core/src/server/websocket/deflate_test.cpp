@@ -0,0 +1,170 @@
+#include <server/websocket/deflate.hpp>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <server/websocket/protocol.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/websocket/server.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+constexpr unsigned char kFinText = 0x81;
+constexpr unsigned char kFinTextCompressed = 0xC1;
+
+utils::span<const std::byte> AsBytes(std::string_view data) {
+  return utils::as_bytes(utils::span<const char>(data));
+}
+
+struct Connection {
+  std::shared_ptr<ws::WebSocketConnection> server;
+  engine::io::Socket client;
+};
+
+Connection MakeConnection(
+    const std::optional<ws::impl::DeflateParams>& deflate_params) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(deadline);
+  auto peer = server.Getpeername();
+  ws::Config config;
+  config.deflate_enabled = deflate_params.has_value();
+  return {ws::impl::MakeWebSocket(
+              std::make_unique<engine::io::Socket>(std::move(server)),
+              std::move(peer), config, deflate_params),
+          std::move(client)};
+}
+
+// Reads a single unfragmented frame with a short payload
+std::pair<unsigned char, std::string> ReadFrame(engine::io::Socket& socket) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  std::array<unsigned char, 2> header{};
+  EXPECT_EQ(socket.RecvAll(header.data(), header.size(), deadline), 2);
+  std::string payload(header[1], '\0');
+  EXPECT_LT(payload.size(), 126);
+  EXPECT_EQ(socket.RecvAll(payload.data(), payload.size(), deadline),
+            payload.size());
+  return {header[0], payload};
+}
+
+}  // namespace
+
+TEST(WebsocketDeflate, Negotiate) {
+  EXPECT_FALSE(ws::impl::NegotiateDeflate(""));
+  EXPECT_FALSE(ws::impl::NegotiateDeflate("x-webkit-deflate-frame"));
+  EXPECT_FALSE(ws::impl::NegotiateDeflate("permessage-deflate; unknown"));
+  EXPECT_FALSE(
+      ws::impl::NegotiateDeflate("permessage-deflate; server_max_window_bits"));
+  EXPECT_FALSE(ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_max_window_bits=8"));
+
+  auto params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; client_max_window_bits");
+  ASSERT_TRUE(params);
+  EXPECT_EQ(ws::impl::MakeDeflateResponse(*params),
+            "permessage-deflate; server_no_context_takeover");
+
+  // The first acceptable offer is chosen
+  params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_max_window_bits=8, "
+      "permessage-deflate; server_max_window_bits=\"10\"; "
+      "client_no_context_takeover, permessage-deflate");
+  ASSERT_TRUE(params);
+  EXPECT_EQ(params->server_max_window_bits, 10);
+  EXPECT_EQ(ws::impl::MakeDeflateResponse(*params),
+            "permessage-deflate; server_no_context_takeover; "
+            "client_no_context_takeover; server_max_window_bits=10");
+}
+
+TEST(WebsocketDeflate, RoundTrip) {
+  ws::impl::Deflater deflater{ws::impl::kDefaultDeflateLevel,
+                              ws::impl::kMaxDeflateWindowBits};
+  ws::impl::Inflater inflater;
+
+  std::string decompressed;
+  for (const std::string& message :
+       {std::string{}, std::string(100000, 'a'), std::string{"hello world"},
+        std::string(100000, 'a')}) {
+    const auto compressed = deflater.Compress(AsBytes(message));
+    EXPECT_EQ(inflater.Decompress(compressed, decompressed, 1000000),
+              ws::CloseStatus::kNone);
+    EXPECT_EQ(decompressed, message);
+  }
+
+  const auto compressed =
+      deflater.Compress(AsBytes(std::string(100000, 'a')));
+  EXPECT_EQ(inflater.Decompress(compressed, decompressed, 1000),
+            ws::CloseStatus::kTooBigData);
+}
+
+UTEST(WebsocketDeflate, SendPrepared) {
+  auto plain = MakeConnection({});
+  auto compressed = MakeConnection(ws::impl::DeflateParams{});
+
+  /// [Sample websocket broadcast]
+  const ws::PreparedMessage message{std::string(100, 'a'), /*is_text=*/true};
+
+  std::vector<std::shared_ptr<ws::WebSocketConnection>> connections{
+      plain.server, compressed.server};
+  for (const auto& connection : connections) {
+    connection->SendPrepared(message);
+  }
+  /// [Sample websocket broadcast]
+
+  const auto [plain_opcode, plain_payload] = ReadFrame(plain.client);
+  EXPECT_EQ(plain_opcode, kFinText);
+  EXPECT_EQ(plain_payload, std::string(100, 'a'));
+
+  const auto [opcode, payload] = ReadFrame(compressed.client);
+  EXPECT_EQ(opcode, kFinTextCompressed);
+  ws::impl::Inflater inflater;
+  std::string decompressed;
+  EXPECT_EQ(inflater.Decompress(payload, decompressed, 100000),
+            ws::CloseStatus::kNone);
+  EXPECT_EQ(decompressed, std::string(100, 'a'));
+}
+
+UTEST(WebsocketDeflate, RecvCompressed) {
+  auto connection = MakeConnection(ws::impl::DeflateParams{});
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  ws::impl::Deflater deflater{ws::impl::kDefaultDeflateLevel,
+                              ws::impl::kMaxDeflateWindowBits};
+  const std::string data(1000, 'b');
+  const auto frame = ws::impl::frames::DataFrame(
+      AsBytes(deflater.Compress(AsBytes(data))), /*is_text=*/true,
+      ws::impl::frames::Compressed::kYes);
+  EXPECT_EQ(connection.client.SendAll(frame.data(), frame.size(), deadline),
+            frame.size());
+
+  ws::Message message;
+  connection.server->Recv(message);
+  EXPECT_FALSE(message.close_status);
+  EXPECT_TRUE(message.is_text);
+  EXPECT_EQ(message.data, data);
+}
+
+UTEST(WebsocketDeflate, RecvCompressedNotNegotiated) {
+  auto connection = MakeConnection({});
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  const auto frame = ws::impl::frames::DataFrame(
+      AsBytes("data"), /*is_text=*/true, ws::impl::frames::Compressed::kYes);
+  EXPECT_EQ(connection.client.SendAll(frame.data(), frame.size(), deadline),
+            frame.size());
+
+  ws::Message message;
+  connection.server->Recv(message);
+  EXPECT_EQ(message.close_status, ws::CloseStatus::kProtocolError);
+}
+
+USERVER_NAMESPACE_END
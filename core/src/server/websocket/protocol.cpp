@@ -61,7 +61,7 @@ namespace frames {
 
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final) {
+    Continuation is_continuation, Final is_final, Compressed is_compressed) {
   boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
   frame.resize(sizeof(WSHeader));
@@ -73,7 +73,11 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   hdr->bytes = 0;
   hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
   hdr->bits.opcode = is_text ? kText : kBinary;
-  if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+  if (is_continuation == Continuation::kYes) {
+    hdr->bits.opcode = kContinuation;
+  } else if (is_compressed == Compressed::kYes) {
+    hdr->bits.reserved = kReservedCompressed;
+  }
 
   if (data.size() <= 125) {
     hdr->bits.payloadLen = data.size();
@@ -89,6 +93,17 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   return frame;
 }
 
+std::string DataFrame(utils::span<const std::byte> data, bool is_text,
+                      Compressed is_compressed) {
+  const auto header = DataFrameHeader(data, is_text, Continuation::kNo,
+                                      Final::kYes, is_compressed);
+  std::string frame;
+  frame.reserve(header.size() + data.size());
+  frame.append(header.data(), header.size());
+  frame.append(reinterpret_cast<const char*>(data.data()), data.size());
+  return frame;
+}
+
 std::string CloseFrame(CloseStatusInt status_code) {
   std::string frame;
   frame.resize(sizeof(WSHeader) + sizeof(status_code));
@@ -159,6 +174,19 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
 
   const bool isDataFrame =
       (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+
+  // Only RSV1 of the first frame of a message is allowed, and only if
+  // permessage-deflate was negotiated
+  const bool isFirstDataFrame =
+      hdr.bits.opcode == kText || hdr.bits.opcode == kBinary;
+  if (hdr.bits.reserved != 0 &&
+      (!frame.deflate_enabled || !isFirstDataFrame ||
+       hdr.bits.reserved != kReservedCompressed)) {
+    return CloseStatus::kProtocolError;
+  }
+  if (isFirstDataFrame) {
+    frame.is_compressed = hdr.bits.reserved == kReservedCompressed;
+  }
   if (hdr.bits.payloadLen <= 125) {
     payload_len = hdr.bits.payloadLen;
   } else if (hdr.bits.payloadLen == 126) {
@@ -2,10 +2,14 @@
 
 #include <userver/server/websocket/server.hpp>
 
+#include <memory>
+#include <optional>
 #include <string>
 
 #include <boost/container/small_vector.hpp>
 
+#include <server/websocket/deflate.hpp>
+
 #include <userver/engine/io/common.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/span.hpp>
@@ -60,6 +64,9 @@ union WSHeader {
 
 static_assert(sizeof(WSHeader) == 2);
 
+// RSV1 bit of WSHeader::bits::reserved, marks compressed messages
+constexpr inline unsigned char kReservedCompressed = 0x4;
+
 constexpr inline unsigned int kMaxFrameHeaderSize =
     sizeof(WSHeader) + sizeof(uint64_t);
 
@@ -75,9 +82,20 @@ enum class Final {
   kNo,
 };
 
+enum class Compressed {
+  kYes,
+  kNo,
+};
+
+// RSV1 is set only for the first frame of a compressed message
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final);
+    Continuation is_continuation, Final is_final,
+    Compressed is_compressed = Compressed::kNo);
+
+// Header and payload of an unfragmented data frame
+std::string DataFrame(utils::span<const std::byte> data, bool is_text,
+                      Compressed is_compressed);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(
     WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
@@ -94,6 +112,8 @@ struct FrameParserState {
   bool pong_received = false;
   bool waiting_continuation = false;
   bool is_text = false;
+  bool is_compressed = false;
+  bool deflate_enabled = false;
   CloseStatusInt remote_close_status = 0;
 
   std::string* payload = nullptr;
@@ -102,6 +122,18 @@ struct FrameParserState {
 CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                         unsigned max_payload_size, std::size_t& payload_len);
 
+struct PreparedFrames final {
+  std::string frame;
+  // Empty if the compression was not requested
+  std::string compressed_frame;
+  std::size_t payload_size{0};
+};
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate_params);
+
 }  // namespace server::websocket::impl
 
 USERVER_NAMESPACE_END
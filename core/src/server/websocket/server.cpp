@@ -36,9 +36,45 @@ Config Parse(const yaml_config::YamlConfig& config,
   return {
       config["max-remote-payload"].As<unsigned>(65536),
       config["fragment-size"].As<unsigned>(65536),
+      config["deflate"].As<bool>(false),
+      config["deflate-level"].As<int>(6),
+      config["deflate-threshold"].As<unsigned>(128),
   };
 }
 
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text,
+                                 bool compress) {
+  const auto bytes = MakeBinarySpan(data);
+  auto frames = std::make_shared<impl::PreparedFrames>();
+  frames->payload_size = data.size();
+  frames->frame =
+      impl::frames::DataFrame(bytes, is_text, impl::frames::Compressed::kNo);
+  if (compress) {
+    impl::Deflater deflater{impl::kDefaultDeflateLevel,
+                            impl::kMaxDeflateWindowBits};
+    frames->compressed_frame = impl::frames::DataFrame(
+        MakeBinarySpan(deflater.Compress(bytes)), is_text,
+        impl::frames::Compressed::kYes);
+  }
+  frames_ = std::move(frames);
+}
+
+PreparedMessage::~PreparedMessage() = default;
+
+PreparedMessage::PreparedMessage(const PreparedMessage&) noexcept = default;
+
+PreparedMessage::PreparedMessage(PreparedMessage&&) noexcept = default;
+
+PreparedMessage& PreparedMessage::operator=(const PreparedMessage&) noexcept =
+    default;
+
+PreparedMessage& PreparedMessage::operator=(PreparedMessage&&) noexcept =
+    default;
+
+std::size_t PreparedMessage::GetPayloadSize() const noexcept {
+  return frames_->payload_size;
+}
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
  public:
  private:
@@ -64,11 +100,29 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
 
   Config config;
 
+  // Set if permessage-deflate was negotiated. The deflater is guarded by
+  // write_mutex_, the inflater is used only by the Recv() task.
+  std::optional<impl::Deflater> deflater_;
+  std::optional<impl::Inflater> inflater_;
+  // Prepared compressed frames use the maximum window
+  bool prepared_compression_allowed_{false};
+  std::string inflate_buffer_;
+
  public:
-  WebSocketConnectionImpl(std::unique_ptr<engine::io::RwBase> io_,
-                          const engine::io::Sockaddr& remote_addr,
-                          const Config& server_config)
-      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+  WebSocketConnectionImpl(
+      std::unique_ptr<engine::io::RwBase> io_,
+      const engine::io::Sockaddr& remote_addr, const Config& server_config,
+      const std::optional<impl::DeflateParams>& deflate_params)
+      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+    if (deflate_params) {
+      deflater_.emplace(config.deflate_level,
+                        deflate_params->server_max_window_bits);
+      inflater_.emplace();
+      prepared_compression_allowed_ = deflate_params->server_max_window_bits ==
+                                      impl::kMaxDeflateWindowBits;
+      frame_.deflate_enabled = true;
+    }
+  }
 
   ~WebSocketConnectionImpl() override {
     LOG_TRACE() << "Websocket connection closed";
@@ -93,13 +147,21 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
       SendExactly(*io, close_frame, {});
     } else if (!message.data.empty()) {
       utils::span<const std::byte> data_to_send{message.data};
+      auto compressed = impl::frames::Compressed::kNo;
+      std::string compressed_data;
+      if (deflater_ && message.data.size() >= config.deflate_threshold) {
+        compressed_data = deflater_->Compress(message.data);
+        data_to_send = MakeBinarySpan(compressed_data);
+        compressed = impl::frames::Compressed::kYes;
+      }
+
       auto continuation = impl::frames::Continuation::kNo;
       while (data_to_send.size() > config.fragment_size &&
              config.fragment_size > 0) {
         const auto data_frame_header = impl::frames::DataFrameHeader(
             data_to_send.first(config.fragment_size),
             message.opcode == impl::WSOpcodes::kText, continuation,
-            impl::frames::Final::kNo);
+            impl::frames::Final::kNo, compressed);
         SendExactly(*io, data_frame_header,
                     data_to_send.first(config.fragment_size));
         continuation = impl::frames::Continuation::kYes;
@@ -108,7 +170,7 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
       }
       const auto data_frame_header = impl::frames::DataFrameHeader(
           data_to_send, message.opcode == impl::WSOpcodes::kText, continuation,
-          impl::frames::Final::kYes);
+          impl::frames::Final::kYes, compressed);
       SendExactly(*io, data_frame_header, data_to_send);
     }
   }
@@ -126,6 +188,22 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     SendExtended(mext);
   }
 
+  void SendPrepared(const PreparedMessage& message) override {
+    const auto& frames = *message.frames_;
+    const bool use_compressed = deflater_ && prepared_compression_allowed_ &&
+                                !frames.compressed_frame.empty();
+    const auto& frame =
+        use_compressed ? frames.compressed_frame : frames.frame;
+
+    stats_.msg_sent++;
+    stats_.bytes_sent += frames.payload_size;
+
+    const std::unique_lock lock(write_mutex_);
+    LOG_TRACE() << "Write prepared message " << frames.payload_size
+                << " bytes";
+    SendExactly(*io, frame, {});
+  }
+
   void DoSendBinary(utils::span<const std::byte> message) override {
     MessageExtended mext{message, impl::WSOpcodes::kBinary, {}};
     SendExtended(mext);
@@ -176,6 +254,19 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
         }
         if (frame_.waiting_continuation) continue;
 
+        if (frame_.is_compressed) {
+          status_raw = inflater_->Decompress(msg.data, inflate_buffer_,
+                                             config.max_remote_payload);
+          if (status_raw != CloseStatus::kNone) {
+            MessageExtended close_msg{{}, impl::WSOpcodes::kClose, status_raw};
+            SendExtended(close_msg);
+            msg = CloseMessage(status_raw);
+            return;
+          }
+          // keep both buffers allocated for the next messages
+          msg.data.swap(inflate_buffer_);
+        }
+
         msg.is_text = frame_.is_text;
         stats_.msg_recv++;
         stats_.bytes_recv += msg.data.size();
@@ -218,10 +309,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 std::shared_ptr<WebSocketConnection> MakeWebSocket(
     std::unique_ptr<engine::io::RwBase>&& socket,
     engine::io::Sockaddr&& peer_name, const Config& config) {
+  return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config,
+                             {});
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate_params) {
   return std::make_shared<WebSocketConnectionImpl>(
-      std::move(socket), std::move(peer_name), config);
+      std::move(socket), std::move(peer_name), config, deflate_params);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -63,6 +63,17 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
 
   if (!HandleHandshake(request, response, context)) return "";
 
+  std::optional<websocket::impl::DeflateParams> deflate_params;
+  if (config_.deflate_enabled) {
+    deflate_params = websocket::impl::NegotiateDeflate(request.GetHeader(
+        USERVER_NAMESPACE::http::headers::kWebsocketExtensions));
+    if (deflate_params) {
+      response.SetHeader(
+          USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+          websocket::impl::MakeDeflateResponse(*deflate_params));
+    }
+  }
+
   response.SetStatus(server::http::HttpStatus::kSwitchingProtocols);
   response.SetHeader(USERVER_NAMESPACE::http::headers::kConnection, "Upgrade");
   response.SetHeader(USERVER_NAMESPACE::http::headers::kUpgrade, "websocket");
@@ -72,11 +83,12 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   request.SetUpgradeWebsocket(
       [context = std::make_shared<server::request::RequestContext>(
            std::move(context)),
+       deflate_params,
        this](std::unique_ptr<engine::io::RwBase> socket,
              engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket),
-                                           std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(
+            std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
           Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -112,6 +124,20 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    deflate:
+        type: boolean
+        description: accept the permessage-deflate extension offered by clients
+        defaultDescription: false
+    deflate-level:
+        type: integer
+        description: zlib compression level of the outgoing messages
+        defaultDescription: 6
+        minimum: 1
+        maximum: 9
+    deflate-threshold:
+        type: integer
+        description: outgoing messages smaller than this are not compressed
+        defaultDescription: 128
 )");
 }
 
@@ -0,0 +1,124 @@
+#include <userver/storages/batch_loader.hpp>
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using Loader = storages::BatchLoader<int, std::string>;
+
+}  // namespace
+
+UTEST_MT(BatchLoader, Sample, 4) {
+  /// [Sample]
+  storages::BatchLoader<int, std::string> loader(
+      {/*max_delay=*/10ms, /*max_batch_size=*/100},
+      [](const std::vector<int>& ids) {
+        // SELECT id, name FROM users WHERE id = ANY($1)
+        std::unordered_map<int, std::string> names;
+        for (const auto id : ids) {
+          if (id % 2 == 0) names.emplace(id, std::to_string(id));
+        }
+        return names;
+      });
+
+  // Concurrently from the request handlers
+  std::vector<engine::TaskWithResult<std::optional<std::string>>> tasks;
+  for (int id = 0; id < 10; ++id) {
+    tasks.push_back(utils::Async("load", [&loader, id] {
+      return loader.Load(id);  // one query for all the ids
+    }));
+  }
+  /// [Sample]
+
+  const auto results = engine::GetAll(tasks);
+  for (int id = 0; id < 10; ++id) {
+    if (id % 2 == 0) {
+      EXPECT_EQ(results[id], std::to_string(id));
+    } else {
+      EXPECT_EQ(results[id], std::nullopt);
+    }
+  }
+}
+
+UTEST(BatchLoader, MaxBatchSize) {
+  std::vector<std::vector<int>> batches;
+  Loader loader({/*max_delay=*/utest::kMaxTestWaitTime, /*max_batch_size=*/2},
+                [&batches](const std::vector<int>& ids) {
+                  batches.push_back(ids);
+                  return Loader::Values{};
+                });
+
+  // Would wait for kMaxTestWaitTime if the size was not respected
+  std::vector<engine::TaskWithResult<std::optional<std::string>>> tasks;
+  for (int id = 0; id < 4; ++id) {
+    tasks.push_back(
+        utils::Async("load", [&loader, id] { return loader.Load(id); }));
+  }
+  engine::GetAll(tasks);
+
+  ASSERT_EQ(batches.size(), 2);
+  EXPECT_EQ(batches[0], (std::vector<int>{0, 1}));
+  EXPECT_EQ(batches[1], (std::vector<int>{2, 3}));
+}
+
+UTEST(BatchLoader, DuplicateKeys) {
+  std::vector<int> loaded;
+  Loader loader({/*max_delay=*/10ms, /*max_batch_size=*/2},
+                [&loaded](const std::vector<int>& ids) {
+                  loaded.insert(loaded.end(), ids.begin(), ids.end());
+                  return Loader::Values{{1, "one"}};
+                });
+
+  auto first = utils::Async("load", [&loader] { return loader.Load(1); });
+  auto second = utils::Async("load", [&loader] { return loader.Load(1); });
+  EXPECT_EQ(first.Get(), "one");
+  EXPECT_EQ(second.Get(), "one");
+  EXPECT_EQ(loaded, std::vector<int>{1});
+}
+
+UTEST(BatchLoader, Exception) {
+  Loader loader({/*max_delay=*/1ms, /*max_batch_size=*/100},
+                [](const std::vector<int>&) -> Loader::Values {
+                  throw std::runtime_error("failed");
+                });
+
+  UEXPECT_THROW_MSG(loader.Load(1), std::runtime_error, "failed");
+  // The next batch is loaded anew
+  UEXPECT_THROW_MSG(loader.Load(1), std::runtime_error, "failed");
+}
+
+UTEST(BatchLoader, CancelledWaiter) {
+  engine::SingleConsumerEvent loading;
+  engine::SingleConsumerEvent release;
+  Loader loader({/*max_delay=*/utest::kMaxTestWaitTime, /*max_batch_size=*/2},
+                [&](const std::vector<int>&) {
+                  loading.Send();
+                  EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+                  return Loader::Values{{1, "one"}, {2, "two"}};
+                });
+
+  auto cancelled = utils::Async("load", [&loader] { return loader.Load(1); });
+  auto waiter = utils::Async("load", [&loader] { return loader.Load(2); });
+  ASSERT_TRUE(loading.WaitForEventFor(utest::kMaxTestWaitTime));
+
+  cancelled.SyncCancel();
+  release.Send();
+  // The batch was not affected by the cancellation of the first waiter
+  EXPECT_EQ(waiter.Get(), "two");
+}
+
+USERVER_NAMESPACE_END
@@ -37,6 +37,30 @@ struct OTelTracingHeadersInheritedData final {
 engine::TaskInheritedVariable<OTelTracingHeadersInheritedData>
     kOTelTracingHeadersInheritedData;
 
+// The 'sampled' flag is the least significant bit of the hex trace flags
+int FromHexDigit(char digit) noexcept {
+  return (digit >= '0' && digit <= '9') ? digit - '0'
+                                        : (digit | 0x20) - 'a' + 10;
+}
+
+char ToHexDigit(int digit) noexcept {
+  return static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+}
+
+bool IsOTelSampled(std::string_view trace_flags) noexcept {
+  if (trace_flags.empty()) return true;
+  return (FromHexDigit(trace_flags.back()) & 1) != 0;
+}
+
+// Sets the 'sampled' bit of the hex trace flags to the local decision
+std::string WithOTelSampledFlag(std::string_view trace_flags, bool sampled) {
+  std::string result{trace_flags.empty() ? kDefaultOtelTraceFlags
+                                         : trace_flags};
+  const int digit = FromHexDigit(result.back());
+  result.back() = ToHexDigit(sampled ? (digit | 1) : (digit & ~1));
+  return result;
+}
+
 bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request,
                                      tracing::SpanBuilder& span_builder) {
   namespace b3 = http::headers::b3;
@@ -53,6 +77,7 @@ bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request,
   span_builder.SetTraceId(trace_id);
   span_builder.SetParentSpanId(request.GetHeader(b3::kSpanId));
   span_builder.AddTagFrozen(std::string{kSampledTag}, sampled);
+  span_builder.SetSampled(sampled != "0" && sampled != "false");
   return true;
 }
 
@@ -64,7 +89,9 @@ void B3FillWithTracingContext(const tracing::Span& span, T& target) {
   target.SetHeader(b3::kParentSpanId, span.GetParentId());
 
   const auto& sampled = server::request::GetTaskInheritedHeader(b3::kSampled);
-  if (!sampled.empty()) {
+  if (!span.IsSampled()) {
+    target.SetHeader(b3::kSampled, "0");
+  } else if (!sampled.empty() && sampled != "0" && sampled != "false") {
     target.SetHeader(b3::kSampled, sampled);
   } else {
     target.SetHeader(b3::kSampled, "1");
@@ -96,6 +123,8 @@ bool OpenTelemetryTryFillSpanBuilderFromRequest(
   span_builder.SetParentSpanId(std::move(data.span_id));
   if (data.trace_flags.empty()) {
     data.trace_flags = std::string{kDefaultOtelTraceFlags};
+  } else {
+    span_builder.SetSampled(IsOTelSampled(data.trace_flags));
   }
 
   const auto& tracestate = request.GetHeader(opentelemetry::kTraceState);
@@ -115,7 +144,8 @@ void OpenTelemetryFillWithTracingContext(const tracing::Span& span, T& target) {
     traceflags = data->traceflags;
   }
   auto traceparent_result = opentelemetry::BuildTraceParentHeader(
-      span.GetTraceId(), span.GetSpanId(), traceflags);
+      span.GetTraceId(), span.GetSpanId(),
+      WithOTelSampledFlag(traceflags, span.IsSampled()));
 
   if (!traceparent_result.has_value()) {
     LOG_LIMITED_WARNING() << fmt::format(
@@ -195,6 +225,10 @@ Format FormatFromString(std::string_view format) {
   return *value;
 }
 
+bool TracingManagerBase::ShouldSampleNewTrace(std::string_view) const {
+  return true;
+}
+
 bool TryFillSpanBuilderFromRequest(Format format,
                                    const server::http::HttpRequest& request,
                                    SpanBuilder& span_builder) {
@@ -286,6 +320,11 @@ void GenericTracingManager::FillResponseWithTracingContext(
   }
 }
 
+bool GenericTracingManager::ShouldSampleNewTrace(
+    std::string_view handler_name) const {
+  return !sampler_ || sampler_->ShouldSample(handler_name);
+}
+
 }  // namespace tracing
 
 USERVER_NAMESPACE_END
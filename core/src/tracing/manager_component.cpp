@@ -2,6 +2,7 @@
 
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/tracing/sampler.hpp>
 #include <userver/tracing/span_builder.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -48,12 +49,22 @@ TracingManagerComponentBase::TracingManagerComponentBase(
     const components::ComponentContext& context)
     : components::LoggableComponentBase(config, context) {}
 
+std::shared_ptr<Sampler> MakeSampler(const yaml_config::YamlConfig& config) {
+  if (config.IsMissing()) return {};
+
+  return std::make_shared<EndpointSampler>(
+      config.As<SamplingRule>(),
+      config["endpoints"]
+          .As<utils::impl::TransparentMap<std::string, SamplingRule>>({}));
+}
+
 DefaultTracingManagerLocator::DefaultTracingManagerLocator(
     const components::ComponentConfig& config,
     const components::ComponentContext& context)
     : components::LoggableComponentBase(config, context),
       default_manager_(config["incoming-format"].As<FlagsFormat>(),
-                       config["new-requests-format"].As<FlagsFormat>()),
+                       config["new-requests-format"].As<FlagsFormat>(),
+                       MakeSampler(config["sampling"])),
       tracing_manager_(
           GetTracingManagerFromConfig(default_manager_, config, context)) {}
 
@@ -86,6 +97,42 @@ properties:
         type: array
         description: Send tracing data in those formats
         items: *format_items
+    sampling:
+        type: object
+        description: sampling of the new traces started by the handlers
+        additionalProperties: false
+        properties:
+            probability:
+                type: number
+                description: probability of sampling a new trace
+                defaultDescription: 1
+                minimum: 0
+                maximum: 1
+            max-traces-per-second:
+                type: integer
+                description: max count of the new traces sampled per second
+                defaultDescription: unlimited
+                minimum: 0
+            endpoints:
+                type: object
+                description: sampling rules for handlers by the handler names
+                properties: {}
+                additionalProperties:
+                    type: object
+                    description: sampling rule of the handler
+                    additionalProperties: false
+                    properties:
+                        probability:
+                            type: number
+                            description: probability of sampling a new trace
+                            defaultDescription: 1
+                            minimum: 0
+                            maximum: 1
+                        max-traces-per-second:
+                            type: integer
+                            description: max count of the new traces sampled per second
+                            defaultDescription: unlimited
+                            minimum: 0
 )");
 }
 
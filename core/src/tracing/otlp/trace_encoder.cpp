@@ -0,0 +1,198 @@
+#include <tracing/otlp/trace_encoder.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <variant>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <utils/impl/proto_writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+namespace {
+
+constexpr std::size_t kTraceIdSize = 16;
+constexpr std::size_t kSpanIdSize = 8;
+
+constexpr std::string_view kInstrumentationScope = "userver";
+constexpr std::string_view kServiceNameAttribute = "service.name";
+
+// The numbers of the fields in opentelemetry/proto/trace/v1/trace.proto
+// and in the common.proto, resource.proto it depends on
+namespace field {
+constexpr int kResourceSpans = 1;
+
+constexpr int kResource = 1;
+constexpr int kScopeSpans = 2;
+
+constexpr int kResourceAttributes = 1;
+
+constexpr int kScope = 1;
+constexpr int kSpans = 2;
+constexpr int kScopeName = 1;
+
+constexpr int kTraceId = 1;
+constexpr int kSpanId = 2;
+constexpr int kParentSpanId = 4;
+constexpr int kName = 5;
+constexpr int kKind = 6;
+constexpr int kStartTime = 7;
+constexpr int kEndTime = 8;
+constexpr int kAttributes = 9;
+constexpr int kStatus = 15;
+
+constexpr int kStatusMessage = 2;
+constexpr int kStatusCode = 3;
+
+constexpr int kKey = 1;
+constexpr int kValue = 2;
+
+constexpr int kStringValue = 1;
+constexpr int kIntValue = 3;
+constexpr int kDoubleValue = 4;
+}  // namespace field
+
+constexpr std::uint64_t kSpanKindInternal = 1;
+constexpr std::uint64_t kStatusCodeError = 2;
+
+using utils::impl::ProtoWriter;
+
+std::string HashId(std::string_view id, std::size_t size) {
+  std::string result;
+  result.reserve(size);
+  std::size_t seed = 0;
+  while (result.size() < size) {
+    boost::hash_combine(seed, std::hash<std::string_view>{}(id));
+    for (std::size_t i = 0; i < sizeof(seed) && result.size() < size; ++i) {
+      result.push_back(static_cast<char>((seed >> (i * 8)) & 0xff));
+    }
+  }
+  return result;
+}
+
+// OTLP requires the IDs of the exact size, the shorter hex IDs are padded with
+// zeros at the beginning as OpenTelemetry does for the 64-bit trace IDs
+std::string ToBinaryId(std::string_view id, std::size_t size) {
+  if (id.size() <= utils::encoding::LengthInHexForm(size) &&
+      id.size() % 2 == 0 && utils::encoding::IsHexData(id)) {
+    std::string result(size - id.size() / 2, '\0');
+    result += utils::encoding::FromHex(id);
+    return result;
+  }
+  return HashId(id, size);
+}
+
+std::uint64_t ToUnixNanoseconds(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+void WriteAnyValue(ProtoWriter& writer, const logging::LogExtra::Value& value) {
+  std::visit(utils::Overloaded{
+                 [&writer](const std::string& string) {
+                   writer.Bytes(field::kStringValue, string);
+                 },
+                 [&writer](auto number) {
+                   if constexpr (std::is_floating_point_v<decltype(number)>) {
+                     writer.Double(field::kDoubleValue, number);
+                   } else {
+                     // int64 values are encoded as the two's complement
+                     writer.Varint(field::kIntValue,
+                                   static_cast<std::uint64_t>(number));
+                   }
+                 },
+             },
+             value);
+}
+
+void WriteKeyValue(ProtoWriter& writer, int field, std::string_view key,
+                   const logging::LogExtra::Value& value) {
+  writer.Message(field, [&](ProtoWriter& key_value) {
+    key_value.Bytes(field::kKey, key);
+    key_value.Message(field::kValue, [&](ProtoWriter& any_value) {
+      WriteAnyValue(any_value, value);
+    });
+  });
+}
+
+bool IsError(const logging::LogExtra::Value& value) {
+  return std::visit(utils::Overloaded{
+                        [](const std::string& string) {
+                          return string == "true" || string == "1";
+                        },
+                        [](auto number) { return number != 0; },
+                    },
+                    value);
+}
+
+void WriteSpan(ProtoWriter& writer, const FinishedSpan& span) {
+  writer.Bytes(field::kTraceId, ToBinaryId(span.trace_id, kTraceIdSize));
+  writer.Bytes(field::kSpanId, ToBinaryId(span.span_id, kSpanIdSize));
+  if (!span.parent_id.empty()) {
+    writer.Bytes(field::kParentSpanId,
+                 ToBinaryId(span.parent_id, kSpanIdSize));
+  }
+  writer.Bytes(field::kName, span.name);
+  writer.Varint(field::kKind, kSpanKindInternal);
+
+  const auto start = ToUnixNanoseconds(span.start_time);
+  writer.Fixed64(field::kStartTime, start);
+  writer.Fixed64(field::kEndTime, start + span.duration.count());
+
+  bool is_error = false;
+  const std::string* error_message = nullptr;
+  for (const auto& [key, value] : span.attributes) {
+    if (key == kErrorFlag) {
+      is_error = IsError(value);
+      continue;
+    }
+    if (key == kErrorMessage) {
+      error_message = std::get_if<std::string>(&value);
+    }
+    WriteKeyValue(writer, field::kAttributes, key, value);
+  }
+
+  if (is_error) {
+    writer.Message(field::kStatus, [&](ProtoWriter& status) {
+      if (error_message) status.Bytes(field::kStatusMessage, *error_message);
+      status.Varint(field::kStatusCode, kStatusCodeError);
+    });
+  }
+}
+
+}  // namespace
+
+std::string EncodeExportTraceServiceRequest(
+    std::string_view service_name, utils::span<const FinishedSpan> spans) {
+  std::string result;
+  ProtoWriter writer{result};
+  writer.Message(field::kResourceSpans, [&](ProtoWriter& resource_spans) {
+    resource_spans.Message(field::kResource, [&](ProtoWriter& resource) {
+      WriteKeyValue(resource, field::kResourceAttributes,
+                    kServiceNameAttribute, std::string{service_name});
+    });
+    resource_spans.Message(field::kScopeSpans, [&](ProtoWriter& scope_spans) {
+      scope_spans.Message(field::kScope, [](ProtoWriter& scope) {
+        scope.Bytes(field::kScopeName, kInstrumentationScope);
+      });
+      for (const auto& span : spans) {
+        scope_spans.Message(field::kSpans, [&span](ProtoWriter& span_writer) {
+          WriteSpan(span_writer, span);
+        });
+      }
+    });
+  });
+  return result;
+}
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+/// Serializes the spans into the protobuf of
+/// opentelemetry.proto.collector.trace.v1.ExportTraceServiceRequest.
+///
+/// The hex IDs are converted to bytes, the IDs of other formats are hashed to
+/// get the IDs of the sizes required by OTLP. The `error` and `error_msg` tags
+/// are converted into the status of the span.
+std::string EncodeExportTraceServiceRequest(
+    std::string_view service_name, utils::span<const FinishedSpan> spans);
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <tracing/otlp/trace_encoder.hpp>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using testing::HasSubstr;
+using testing::Not;
+
+tracing::FinishedSpan MakeSpan() {
+  tracing::FinishedSpan span;
+  span.name = "handler";
+  span.trace_id = "0123456789abcdef0123456789abcdef";
+  span.span_id = "0011223344556677";
+  span.start_time =
+      std::chrono::system_clock::time_point{std::chrono::seconds{1}};
+  span.duration = std::chrono::milliseconds{5};
+  return span;
+}
+
+std::string Encode(const tracing::FinishedSpan& span) {
+  const std::vector<tracing::FinishedSpan> spans{span};
+  return tracing::otlp::EncodeExportTraceServiceRequest("test-service",
+                                                        spans);
+}
+
+}  // namespace
+
+TEST(OtlpTraceEncoder, Ids) {
+  auto span = MakeSpan();
+  span.parent_id = "8899aabbccddeeff";
+  const auto encoded = Encode(span);
+
+  // trace_id = 1, span_id = 2, parent_span_id = 4, all of them are bytes
+  EXPECT_THAT(encoded, HasSubstr("\x0a\x10\x01\x23\x45\x67\x89\xab\xcd\xef"
+                                 "\x01\x23\x45\x67\x89\xab\xcd\xef"));
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x12\x08\x00\x11\x22\x33\x44\x55\x66\x77", 10}));
+  EXPECT_THAT(encoded,
+              HasSubstr("\x22\x08\x88\x99\xaa\xbb\xcc\xdd\xee\xff"));
+  EXPECT_THAT(encoded, HasSubstr("\x2a\x07handler"));
+  EXPECT_THAT(encoded, HasSubstr("test-service"));
+}
+
+TEST(OtlpTraceEncoder, ShortAndNonHexIds) {
+  auto span = MakeSpan();
+  span.trace_id = "0123456789abcdef";
+  span.span_id = "not a hex id";
+  const auto encoded = Encode(span);
+
+  // 64-bit trace IDs are padded with zeros
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x0a\x10\x00\x00\x00\x00\x00\x00\x00\x00"
+                           "\x01\x23\x45\x67\x89\xab\xcd\xef",
+                           18}));
+  EXPECT_THAT(encoded, HasSubstr("\x12\x08"));
+  EXPECT_EQ(encoded, Encode(span));
+}
+
+TEST(OtlpTraceEncoder, Timestamps) {
+  const auto encoded = Encode(MakeSpan());
+
+  // start_time_unix_nano = 7 and end_time_unix_nano = 8 are fixed64
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x39\x00\xca\x9a\x3b\x00\x00\x00\x00", 9}));
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x41\x40\x15\xe7\x3b\x00\x00\x00\x00", 9}));
+}
+
+TEST(OtlpTraceEncoder, Attributes) {
+  auto span = MakeSpan();
+  span.attributes.emplace_back("int", 300);
+  span.attributes.emplace_back("str", std::string{"value"});
+  span.attributes.emplace_back("double", 0.5);
+  const auto encoded = Encode(span);
+
+  // attributes = 9: KeyValue{key = 1, value = AnyValue}
+  EXPECT_THAT(encoded, HasSubstr("\x4a\x0a\x0a\x03int\x12\x03\x18\xac\x02"));
+  EXPECT_THAT(encoded, HasSubstr("\x4a\x0e\x0a\x03str\x12\x07\x0a\x05value"));
+  EXPECT_THAT(encoded,
+              HasSubstr(std::string_view{"\x4a\x13\x0a\x06"
+                                         "double\x12\x09\x21"
+                                         "\x00\x00\x00\x00\x00\x00\xe0\x3f",
+                                         21}));
+  // No status without errors
+  EXPECT_THAT(encoded, Not(HasSubstr("\x7a")));
+}
+
+TEST(OtlpTraceEncoder, ErrorStatus) {
+  auto span = MakeSpan();
+  span.attributes.emplace_back(tracing::kErrorFlag, 1);
+  span.attributes.emplace_back(tracing::kErrorMessage, std::string{"boom"});
+  const auto encoded = Encode(span);
+
+  // status = 15: Status{message = 2, code = 3 (STATUS_CODE_ERROR)}
+  EXPECT_THAT(encoded, HasSubstr("\x7a\x08\x12\x04\x62oom\x18\x02"));
+  EXPECT_THAT(encoded, Not(HasSubstr("\x05\x65rror")));
+}
+
+USERVER_NAMESPACE_END
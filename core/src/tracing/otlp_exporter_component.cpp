@@ -0,0 +1,296 @@
+#include <userver/tracing/otlp_exporter_component.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/component.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tracer.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <tracing/otlp/trace_encoder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+TailSampler::~TailSampler() = default;
+
+namespace impl {
+
+namespace {
+
+constexpr std::size_t kDefaultMaxQueueSize = 65536;
+constexpr std::size_t kDefaultMaxBatchSize = 512;
+constexpr std::chrono::milliseconds kDefaultExportInterval{1000};
+constexpr std::chrono::milliseconds kDefaultTimeout{5000};
+
+}  // namespace
+
+struct OtlpExporterSettings final {
+  std::string endpoint;
+  std::string service_name;
+  std::size_t max_batch_size{kDefaultMaxBatchSize};
+  std::chrono::milliseconds export_interval{kDefaultExportInterval};
+  std::chrono::milliseconds timeout{kDefaultTimeout};
+  bool log_spans{false};
+};
+
+class OtlpExporter final : public SpanExporter {
+ public:
+  OtlpExporter(clients::http::Client& http_client,
+               OtlpExporterSettings&& settings, std::size_t max_queue_size)
+      : http_client_(http_client),
+        settings_(std::move(settings)),
+        queue_(Queue::Create(max_queue_size)),
+        producer_(queue_->GetMultiProducer()),
+        consumer_(queue_->GetConsumer()) {}
+
+  void Export(FinishedSpan&& span) noexcept override {
+    bool is_pushed = false;
+    try {
+      is_pushed = producer_.PushNoblock(std::move(span));
+    } catch (const std::exception&) {
+      // The span is dropped and counted below
+    }
+    if (!is_pushed) ++stats_.dropped;
+  }
+
+  bool IsSpanLoggingEnabled() const noexcept override {
+    return settings_.log_spans;
+  }
+
+  void SetTailSampler(std::shared_ptr<TailSampler> sampler) {
+    tail_sampler_.Assign(std::move(sampler));
+  }
+
+  void Run();
+
+  void WriteStatistics(utils::statistics::Writer& writer) const {
+    writer["exported"] = stats_.exported;
+    writer["dropped"] = stats_.dropped;
+    writer["sampled-out"] = stats_.sampled_out;
+    writer["failed"] = stats_.failed;
+  }
+
+ private:
+  using Queue = concurrent::NonFifoMpscQueue<FinishedSpan>;
+
+  struct Stats final {
+    utils::statistics::RateCounter exported;
+    utils::statistics::RateCounter dropped;
+    utils::statistics::RateCounter sampled_out;
+    utils::statistics::RateCounter failed;
+  };
+
+  std::vector<FinishedSpan> ApplyTailSampler(std::vector<FinishedSpan>&& batch);
+  void Send(std::vector<FinishedSpan>&& batch);
+
+  clients::http::Client& http_client_;
+  const OtlpExporterSettings settings_;
+  std::shared_ptr<Queue> queue_;
+  Queue::MultiProducer producer_;
+  Queue::Consumer consumer_;
+  rcu::Variable<std::shared_ptr<TailSampler>> tail_sampler_;
+  Stats stats_;
+};
+
+void OtlpExporter::Run() {
+  // The spans of the export requests inherit the flag, so they are not
+  // exported and do not feed themselves back into the queue
+  tracing::Span::CurrentSpan().SetSampled(false);
+
+  std::vector<FinishedSpan> batch;
+  batch.reserve(settings_.max_batch_size);
+  auto deadline = engine::Deadline::FromDuration(settings_.export_interval);
+
+  while (!engine::current_task::ShouldCancel()) {
+    FinishedSpan finished_span;
+    if (consumer_.Pop(finished_span, deadline)) {
+      batch.push_back(std::move(finished_span));
+      if (batch.size() < settings_.max_batch_size) continue;
+    } else if (!deadline.IsReached()) {
+      // Cancelled
+      break;
+    }
+
+    if (!batch.empty()) {
+      Send(std::move(batch));
+      batch.clear();
+      batch.reserve(settings_.max_batch_size);
+    }
+    deadline = engine::Deadline::FromDuration(settings_.export_interval);
+  }
+}
+
+std::vector<FinishedSpan> OtlpExporter::ApplyTailSampler(
+    std::vector<FinishedSpan>&& batch) {
+  const auto sampler = tail_sampler_.ReadCopy();
+  if (!sampler) return std::move(batch);
+
+  std::stable_sort(batch.begin(), batch.end(),
+                   [](const FinishedSpan& lhs, const FinishedSpan& rhs) {
+                     return lhs.trace_id < rhs.trace_id;
+                   });
+
+  std::vector<FinishedSpan> result;
+  result.reserve(batch.size());
+  std::size_t begin = 0;
+  while (begin != batch.size()) {
+    std::size_t end = begin + 1;
+    const auto& trace_id = batch[begin].trace_id;
+    while (end != batch.size() && batch[end].trace_id == trace_id) ++end;
+
+    bool should_export = true;
+    try {
+      should_export = sampler->ShouldExport(
+          {batch.data() + begin, batch.data() + end});
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Tail sampler failed, exporting the trace: " << e;
+    }
+
+    if (should_export) {
+      std::move(batch.begin() + begin, batch.begin() + end,
+                std::back_inserter(result));
+    } else {
+      stats_.sampled_out.Add(utils::statistics::Rate{end - begin});
+    }
+    begin = end;
+  }
+  return result;
+}
+
+void OtlpExporter::Send(std::vector<FinishedSpan>&& batch) {
+  batch = ApplyTailSampler(std::move(batch));
+  if (batch.empty()) return;
+
+  const utils::statistics::Rate count{batch.size()};
+  try {
+    auto body = otlp::EncodeExportTraceServiceRequest(settings_.service_name,
+                                                      batch);
+    auto response = http_client_.CreateRequest()
+                        .post(settings_.endpoint, std::move(body))
+                        .headers({{"Content-Type", "application/x-protobuf"}})
+                        .timeout(settings_.timeout)
+                        .perform();
+    response->raise_for_status();
+    stats_.exported.Add(count);
+  } catch (const std::exception& e) {
+    stats_.failed.Add(count);
+    LOG_LIMITED_WARNING() << "Failed to export " << count.value
+                          << " spans: " << e;
+  }
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+namespace components {
+
+OtlpSpanExporter::OtlpSpanExporter(const ComponentConfig& config,
+                                   const ComponentContext& context)
+    : LoggableComponentBase(config, context) {
+  tracing::impl::OtlpExporterSettings settings;
+  settings.endpoint = config["endpoint"].As<std::string>();
+  settings.service_name = config["service-name"].As<std::string>();
+  settings.max_batch_size =
+      config["max-batch-size"].As<std::size_t>(settings.max_batch_size);
+  settings.export_interval = config["export-interval"].As<
+      std::chrono::milliseconds>(settings.export_interval);
+  settings.timeout =
+      config["timeout"].As<std::chrono::milliseconds>(settings.timeout);
+  settings.log_spans = config["log-spans"].As<bool>(settings.log_spans);
+
+  auto& http_client =
+      context
+          .FindComponent<HttpClient>(
+              config["http-client"].As<std::string>(HttpClient::kName))
+          .GetHttpClient();
+  const auto max_queue_size = config["max-queue-size"].As<std::size_t>(
+      tracing::impl::kDefaultMaxQueueSize);
+
+  exporter_ = std::make_shared<tracing::impl::OtlpExporter>(
+      http_client, std::move(settings), max_queue_size);
+  task_ = utils::CriticalAsync("otlp-span-exporter",
+                               [this] { exporter_->Run(); });
+
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "tracing.otlp-exporter", [this](utils::statistics::Writer& writer) {
+        exporter_->WriteStatistics(writer);
+      });
+
+  tracing::Tracer::SetSpanExporter(exporter_);
+}
+
+OtlpSpanExporter::~OtlpSpanExporter() {
+  // The spans left in the queue are lost
+  tracing::Tracer::SetSpanExporter(nullptr);
+  statistics_holder_.Unregister();
+  task_.SyncCancel();
+}
+
+void OtlpSpanExporter::SetTailSampler(
+    std::shared_ptr<tracing::TailSampler> sampler) {
+  exporter_->SetTailSampler(std::move(sampler));
+}
+
+yaml_config::Schema OtlpSpanExporter::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: Component that sends the finished spans to an OpenTelemetry collector
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: URL of the OTLP/HTTP traces handler of the collector
+    service-name:
+        type: string
+        description: the service name to put into the `service.name` resource attribute
+    http-client:
+        type: string
+        description: name of the components::HttpClient to send the spans with
+        defaultDescription: http-client
+    max-queue-size:
+        type: integer
+        description: max count of the spans waiting for the export
+        defaultDescription: 65536
+        minimum: 1
+    max-batch-size:
+        type: integer
+        description: max count of the spans in a single request
+        defaultDescription: 512
+        minimum: 1
+    export-interval:
+        type: string
+        description: max time the spans wait in the queue
+        defaultDescription: 1s
+    timeout:
+        type: string
+        description: timeout of the export request
+        defaultDescription: 5s
+    log-spans:
+        type: boolean
+        description: whether the spans are also written to the default logger
+        defaultDescription: false
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
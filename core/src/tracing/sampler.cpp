@@ -0,0 +1,73 @@
+#include <userver/tracing/sampler.hpp>
+
+#include <chrono>
+
+#include <userver/utils/rand.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+std::optional<utils::TokenBucket> MakeBucket(const SamplingRule& rule) {
+  if (!rule.max_traces_per_second) return std::nullopt;
+
+  const auto rate = *rule.max_traces_per_second;
+  // An empty bucket without refills never samples
+  if (rate == 0) return std::make_optional<utils::TokenBucket>();
+
+  return std::make_optional<utils::TokenBucket>(
+      rate, utils::TokenBucket::RefillPolicy{
+                1, utils::TokenBucket::Duration{std::chrono::seconds{1}} /
+                       rate});
+}
+
+}  // namespace
+
+Sampler::~Sampler() = default;
+
+SamplingRule Parse(const yaml_config::YamlConfig& value,
+                   formats::parse::To<SamplingRule>) {
+  SamplingRule rule;
+  rule.probability = value["probability"].As<double>(rule.probability);
+  rule.max_traces_per_second =
+      value["max-traces-per-second"].As<std::optional<std::size_t>>();
+  if (rule.probability < 0 || rule.probability > 1) {
+    throw std::runtime_error("Sampling probability must be within [0, 1]");
+  }
+  return rule;
+}
+
+EndpointSampler::Limiter::Limiter(const SamplingRule& rule)
+    : probability(rule.probability), bucket(MakeBucket(rule)) {}
+
+bool EndpointSampler::Limiter::ShouldSample() noexcept {
+  if (probability < 1 && utils::RandRange(1.0) >= probability) return false;
+  return !bucket || bucket->Obtain();
+}
+
+EndpointSampler::EndpointSampler(
+    const SamplingRule& default_rule,
+    const utils::impl::TransparentMap<std::string, SamplingRule>&
+        endpoint_rules)
+    : default_limiter_(default_rule) {
+  for (const auto& [endpoint, rule] : endpoint_rules) {
+    endpoint_limiters_.emplace(std::piecewise_construct,
+                               std::forward_as_tuple(endpoint),
+                               std::forward_as_tuple(rule));
+  }
+}
+
+EndpointSampler::~EndpointSampler() = default;
+
+bool EndpointSampler::ShouldSample(std::string_view endpoint) noexcept {
+  auto* limiter = utils::impl::FindTransparentOrNullptr(endpoint_limiters_,
+                                                        endpoint);
+  return (limiter ? *limiter : default_limiter_).ShouldSample();
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <userver/tracing/sampler.hpp>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kAttempts = 1000;
+
+int CountSampled(tracing::Sampler& sampler, std::string_view endpoint) {
+  int sampled = 0;
+  for (int i = 0; i < kAttempts; ++i) {
+    if (sampler.ShouldSample(endpoint)) ++sampled;
+  }
+  return sampled;
+}
+
+tracing::SamplingRule MakeRule(double probability,
+                               std::optional<std::size_t> max_per_second) {
+  tracing::SamplingRule rule;
+  rule.probability = probability;
+  rule.max_traces_per_second = max_per_second;
+  return rule;
+}
+
+}  // namespace
+
+TEST(EndpointSampler, Probability) {
+  tracing::EndpointSampler sampler{MakeRule(0.5, std::nullopt),
+                                   {{"always", MakeRule(1, std::nullopt)},
+                                    {"never", MakeRule(0, std::nullopt)}}};
+
+  EXPECT_EQ(CountSampled(sampler, "always"), kAttempts);
+  EXPECT_EQ(CountSampled(sampler, "never"), 0);
+
+  const auto sampled = CountSampled(sampler, "other");
+  EXPECT_GT(sampled, kAttempts / 4);
+  EXPECT_LT(sampled, kAttempts * 3 / 4);
+}
+
+TEST(EndpointSampler, RateLimit) {
+  tracing::EndpointSampler sampler{MakeRule(1, 2),
+                                   {{"limited", MakeRule(1, 5)},
+                                    {"disabled", MakeRule(1, 0)}}};
+
+  // The buckets are refilled over the whole second, the test does not last
+  // long enough to get more tokens
+  EXPECT_EQ(CountSampled(sampler, "limited"), 5);
+  EXPECT_EQ(CountSampled(sampler, "disabled"), 0);
+
+  // The endpoints without rules share the default limit
+  EXPECT_EQ(CountSampled(sampler, "first") + CountSampled(sampler, "second"),
+            2);
+}
+
+TEST(EndpointSampler, ParseRule) {
+  const auto yaml = formats::yaml::FromString(R"(
+    probability: 0.25
+    max-traces-per-second: 10
+  )");
+  const auto rule =
+      yaml_config::YamlConfig{yaml, {}}.As<tracing::SamplingRule>();
+  EXPECT_EQ(rule.probability, 0.25);
+  EXPECT_EQ(rule.max_traces_per_second, 10);
+
+  const auto invalid = formats::yaml::FromString("probability: 2");
+  UEXPECT_THROW(
+      yaml_config::YamlConfig(invalid, {}).As<tracing::SamplingRule>(),
+      std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,18 @@
 #include <tracing/span_impl.hpp>
 
+#include <array>
+#include <new>
 #include <type_traits>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <boost/container/small_vector.hpp>
+
+#include <compiler/tls.hpp>
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <logging/rate_limit.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -65,6 +71,43 @@ std::string_view StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
+// Span::Impl is too large for the thread caches of malloc, and the spans are
+// created and destroyed at a high rate, so the storage is reused per thread.
+class ImplStorageCache final {
+ public:
+  ~ImplStorageCache() {
+    for (std::size_t i = 0; i < size_; ++i) ::operator delete(storages_[i]);
+    // The spans destroyed at the thread exit go to the heap
+    size_ = kDisabled;
+  }
+
+  void* TryPop() noexcept {
+    if (size_ == 0 || size_ == kDisabled) return nullptr;
+    return storages_[--size_];
+  }
+
+  bool TryPush(void* storage) noexcept {
+    if (size_ >= kMaxSize) return false;
+    storages_[size_++] = storage;
+    return true;
+  }
+
+ private:
+  static constexpr std::size_t kMaxSize = 16;
+  static constexpr std::size_t kDisabled = kMaxSize + 1;
+
+  std::array<void*, kMaxSize> storages_{};
+  std::size_t size_{0};
+};
+
+static_assert(alignof(Span::Impl) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+thread_local ImplStorageCache impl_storage_cache;
+
+USERVER_PREVENT_TLS_CACHING ImplStorageCache& GetImplStorageCache() noexcept {
+  return impl_storage_cache;
+}
+
 std::string GenerateSpanId() {
   std::uniform_int_distribution<std::uint64_t> dist;
   auto random_value = dist(utils::DefaultRandom());
@@ -75,6 +118,15 @@ std::string GenerateSpanId() {
 
 }  // namespace
 
+void* AllocateImplStorage() {
+  if (void* storage = GetImplStorageCache().TryPop()) return storage;
+  return ::operator new(sizeof(Span::Impl));
+}
+
+void DeallocateImplStorage(void* storage) noexcept {
+  if (!GetImplStorageCache().TryPush(storage)) ::operator delete(storage);
+}
+
 Span::Impl::Impl(std::string name, ReferenceType reference_type,
                  logging::Level log_level,
                  utils::impl::SourceLocation source_location)
@@ -99,11 +151,21 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    is_sampled_ = parent->is_sampled_;
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
+  bool should_log = ShouldLog();
+
+  if (!is_no_log_span_ && is_sampled_) {
+    if (auto exporter = Tracer::GetSpanExporter()) {
+      exporter->Export(MakeFinishedSpan());
+      should_log = should_log && exporter->IsSpanLoggingEnabled();
+    }
+  }
+
+  if (!should_log) {
     return;
   }
 
@@ -144,6 +206,29 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   LogOpenTracing();
 }
 
+FinishedSpan Span::Impl::MakeFinishedSpan() const {
+  FinishedSpan span;
+  span.name = name_;
+  span.trace_id = trace_id_;
+  span.span_id = span_id_;
+  span.parent_id = parent_id_;
+  span.reference_type = reference_type_;
+  span.start_time = start_system_time_;
+  span.duration = std::chrono::steady_clock::now() - start_steady_time_;
+
+  const auto append = [&span](const logging::LogExtra& extra) {
+    for (const auto& [key, value] : *extra.extra_) {
+      span.attributes.emplace_back(key, value.GetValue());
+    }
+  };
+  span.attributes.reserve(log_extra_inheritable_.extra_->size() +
+                          (log_extra_local_ ? log_extra_local_->extra_->size()
+                                            : 0));
+  append(log_extra_inheritable_);
+  if (log_extra_local_) append(*log_extra_local_);
+  return span;
+}
+
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   writer.ExtendLogExtra(log_extra_inheritable_);
   tracer_->LogSpanContextTo(*this, writer);
@@ -153,7 +238,12 @@ void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
   UASSERT(!is_linked());
-  task_local_spans->push_back(*this);
+  auto& spans = *task_local_spans;
+  if (spans.empty()) {
+    // The root span of the task names it in the task profiler
+    engine::current_task::GetCurrentTaskContext().ProfilerSetSpanName(name_);
+  }
+  spans.push_back(*this);
 }
 
 std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
@@ -189,12 +279,20 @@ bool Span::Impl::ShouldLog() const {
    */
   return logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
                                         log_level_) &&
-         local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
+         local_log_level_.value_or(logging::Level::kTrace) <= log_level_ &&
+         (is_sampled_ || logging::impl::GetNotSampledLogLevel() <= log_level_);
+}
+
+bool Span::Impl::IsNeverLogged() const noexcept {
+  return is_no_log_span_ ||
+         (!is_sampled_ &&
+          logging::impl::GetNotSampledLogLevel() == logging::Level::kNone);
 }
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
-  if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+  if (do_delete && impl) {
+    impl->~Impl();
+    DeallocateImplStorage(impl);
   }
 }
 
@@ -311,6 +409,8 @@ tracing::ScopeTime Span::CreateScopeTime(std::string name) {
 
 void Span::AddNonInheritableTag(std::string key,
                                 logging::LogExtra::Value value) {
+  // The tags of the span record are not built if it is never written
+  if (pimpl_->IsNeverLogged()) return;
   if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
@@ -330,6 +430,10 @@ std::optional<logging::Level> Span::GetLocalLogLevel() const {
   return pimpl_->local_log_level_;
 }
 
+void Span::SetSampled(bool sampled) noexcept { pimpl_->is_sampled_ = sampled; }
+
+bool Span::IsSampled() const noexcept { return pimpl_->is_sampled_; }
+
 void Span::AddTag(std::string key, logging::LogExtra::Value value) {
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value));
 }
@@ -340,6 +444,7 @@ void Span::AddTags(const logging::LogExtra& log_extra, utils::InternalTag) {
 
 void Span::AddNonInheritableTags(const logging::LogExtra& log_extra,
                                  utils::InternalTag) {
+  if (pimpl_->IsNeverLogged()) return;
   if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
   pimpl_->log_extra_local_->Extend(log_extra);
 }
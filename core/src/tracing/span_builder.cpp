@@ -49,6 +49,10 @@ void SpanBuilder::AddNonInheritableTag(std::string key,
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
 
+void SpanBuilder::SetSampled(bool sampled) noexcept {
+  pimpl_->is_sampled_ = sampled;
+}
+
 void SpanBuilder::SetParentLink(std::string parent_link) {
   AddTagFrozen(kParentLinkTag, std::move(parent_link));
 }
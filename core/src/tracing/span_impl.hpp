@@ -15,6 +15,7 @@
 #include <userver/logging/log_helper.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
@@ -79,9 +80,13 @@ class Span::Impl
 
   static std::string GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
+  bool IsNeverLogged() const noexcept;
+  FinishedSpan MakeFinishedSpan() const;
 
   const std::string name_;
   const bool is_no_log_span_;
+  // Placed into the padding to keep InPlaceSpan within its FastPimpl size
+  bool is_sampled_{true};
   logging::Level log_level_;
   std::optional<logging::Level> local_log_level_;
 
@@ -114,9 +119,20 @@ using SpanStack =
 
 const Span::Impl* GetParentSpanImpl();
 
+void* AllocateImplStorage();
+void DeallocateImplStorage(void* storage) noexcept;
+
+/// Span::Impl allocated with AllocateImpl should be destroyed with the
+/// Span::OptionalDeleter.
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  void* storage = AllocateImplStorage();
+  try {
+    return new (storage) Span::Impl(std::forward<Args>(args)...);
+  } catch (...) {
+    DeallocateImplStorage(storage);
+    throw;
+  }
 }
 
 class DetachLocalSpansScope final {
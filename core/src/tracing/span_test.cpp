@@ -1,11 +1,15 @@
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
+#include <logging/rate_limit.hpp>
 #include <tracing/no_log_spans.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -347,6 +351,119 @@ UTEST_F(Span, LocalLogLevel) {
   EXPECT_NE(std::string::npos, GetStreamString().find("info4"));
 }
 
+UTEST_F(Span, NotSampledLogLevel) {
+  logging::impl::SetNotSampledLogLevel(logging::Level::kWarning);
+  {
+    tracing::Span span("span_name");
+    LOG_INFO() << "info1";
+
+    span.SetSampled(false);
+    LOG_INFO() << "info2";
+    LOG_WARNING() << "warning2";
+
+    {
+      tracing::Span child("child_span");
+      EXPECT_FALSE(child.IsSampled());
+      LOG_INFO() << "info3";
+    }
+  }
+  logging::impl::SetNotSampledLogLevel(logging::Level::kTrace);
+  logging::LogFlush();
+
+  EXPECT_NE(std::string::npos, GetStreamString().find("info1"));
+  EXPECT_EQ(std::string::npos, GetStreamString().find("info2"));
+  EXPECT_NE(std::string::npos, GetStreamString().find("warning2"));
+  EXPECT_EQ(std::string::npos, GetStreamString().find("info3"));
+}
+
+namespace {
+
+class TestSpanExporter final : public tracing::SpanExporter {
+ public:
+  explicit TestSpanExporter(bool is_logging_enabled)
+      : is_logging_enabled_(is_logging_enabled) {}
+
+  void Export(tracing::FinishedSpan&& span) noexcept override {
+    spans.push_back(std::move(span));
+  }
+
+  bool IsSpanLoggingEnabled() const noexcept override {
+    return is_logging_enabled_;
+  }
+
+  std::vector<tracing::FinishedSpan> spans;
+
+ private:
+  const bool is_logging_enabled_;
+};
+
+}  // namespace
+
+UTEST_F(Span, Exporter) {
+  auto exporter = std::make_shared<TestSpanExporter>(false);
+  tracing::Tracer::SetSpanExporter(exporter);
+  std::string parent_span_id;
+  {
+    tracing::Span span("exported_span");
+    span.AddTag("local_tag", 42);
+    span.AddTagFrozen("frozen_tag", "value");
+    parent_span_id = span.GetSpanId();
+
+    tracing::Span child("exported_child");
+    child.SetSampled(false);
+  }
+  tracing::Tracer::SetSpanExporter(nullptr);
+  logging::LogFlush();
+
+  ASSERT_EQ(exporter->spans.size(), 1);
+  const auto& span = exporter->spans[0];
+  EXPECT_EQ(span.name, "exported_span");
+  EXPECT_EQ(span.span_id, parent_span_id);
+  EXPECT_FALSE(span.trace_id.empty());
+  EXPECT_GE(span.duration.count(), 0);
+
+  const auto has_attribute = [&span](std::string_view key,
+                                     const logging::LogExtra::Value& value) {
+    return std::find(span.attributes.begin(), span.attributes.end(),
+                     std::make_pair(std::string{key}, value)) !=
+           span.attributes.end();
+  };
+  EXPECT_TRUE(has_attribute("local_tag", 42));
+  EXPECT_TRUE(has_attribute("frozen_tag", std::string{"value"}));
+
+  EXPECT_EQ(std::string::npos, GetStreamString().find("exported_span"));
+}
+
+UTEST_F(Span, ExporterWithLogging) {
+  auto exporter = std::make_shared<TestSpanExporter>(true);
+  tracing::Tracer::SetSpanExporter(exporter);
+  { tracing::Span span("exported_and_logged"); }
+  tracing::Tracer::SetSpanExporter(nullptr);
+  logging::LogFlush();
+
+  ASSERT_EQ(exporter->spans.size(), 1);
+  EXPECT_NE(std::string::npos, GetStreamString().find("exported_and_logged"));
+}
+
+UTEST_F(Span, NotSampledSpanRecord) {
+  logging::impl::SetNotSampledLogLevel(logging::Level::kWarning);
+  {
+    tracing::Span span("not_sampled_span");
+    span.SetSampled(false);
+  }
+  {
+    tracing::Span span("not_sampled_warning_span");
+    span.SetSampled(false);
+    span.SetLogLevel(logging::Level::kWarning);
+  }
+  logging::impl::SetNotSampledLogLevel(logging::Level::kTrace);
+  logging::LogFlush();
+
+  EXPECT_EQ(std::string::npos,
+            GetStreamString().find("stopwatch_name=not_sampled_span"));
+  EXPECT_NE(std::string::npos, GetStreamString().find("not_sampled_warning"));
+}
+
 UTEST_F(Span, LowerLocalLogLevel) {
   tracing::Span span("parent_span");
   span.SetLocalLogLevel(logging::Level::kError);
@@ -4,6 +4,7 @@
 
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/utils/uuid4.hpp>
 
 #include <tracing/no_log_spans.hpp>
@@ -45,6 +46,16 @@ auto& GlobalTracer() {
   return tracer;
 }
 
+auto& GlobalSpanExporter() {
+  static rcu::Variable<std::shared_ptr<SpanExporter>> exporter{};
+  return exporter;
+}
+
+// Most of the services have neither the no-log spans nor the exporter, the
+// flags let the spans skip the RCU reads
+std::atomic<bool> has_no_log_spans{false};
+std::atomic<bool> has_span_exporter{false};
+
 template <class T>
 bool ValueMatchPrefix(const T& value, const T& prefix) {
   return prefix.size() <= value.size() &&
@@ -71,12 +82,17 @@ bool ValueMatchesOneOfPrefixes(const T& value,
 
 Tracer::~Tracer() = default;
 
+SpanExporter::~SpanExporter() = default;
+
 void Tracer::SetNoLogSpans(NoLogSpans&& spans) {
+  const bool is_empty = spans.prefixes.empty() && spans.names.empty();
   auto& global_spans = GlobalNoLogSpans();
   global_spans.Assign(std::move(spans));
+  has_no_log_spans.store(!is_empty, std::memory_order_relaxed);
 }
 
 bool Tracer::IsNoLogSpan(const std::string& name) {
+  if (!has_no_log_spans.load(std::memory_order_relaxed)) return false;
   const auto spans = GlobalNoLogSpans().Read();
 
   return ValueMatchesOneOfPrefixes(name, spans->prefixes) ||
@@ -91,6 +107,17 @@ std::shared_ptr<Tracer> Tracer::GetTracer() {
   return GlobalTracer().ReadCopy();
 }
 
+void Tracer::SetSpanExporter(std::shared_ptr<SpanExporter> exporter) {
+  const bool is_set = exporter != nullptr;
+  GlobalSpanExporter().Assign(std::move(exporter));
+  has_span_exporter.store(is_set, std::memory_order_relaxed);
+}
+
+std::shared_ptr<SpanExporter> Tracer::GetSpanExporter() {
+  if (!has_span_exporter.load(std::memory_order_relaxed)) return nullptr;
+  return GlobalSpanExporter().ReadCopy();
+}
+
 const std::string& Tracer::GetServiceName() const {
   UASSERT_MSG(!service_name_.empty(),
               "Requested a service name, which is misconfigured and empty. "
@@ -4,6 +4,8 @@
 #include <userver/logging/null_logger.hpp>
 #include <userver/tracing/tracer.hpp>
 
+#include <tracing/no_log_spans.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -33,6 +35,31 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_span_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const tracing::Span parent{"parent"};
+
+    for ([[maybe_unused]] auto _ : state)
+      benchmark::DoNotOptimize(tracing::Span{"name"});
+  });
+}
+BENCHMARK(tracing_child_span_ctr);
+
+void tracing_no_log_span_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    tracing::NoLogSpans no_log_spans;
+    no_log_spans.names.insert("name");
+    tracing::Tracer::SetNoLogSpans(std::move(no_log_spans));
+    const tracing::Span parent{"parent"};
+
+    for ([[maybe_unused]] auto _ : state)
+      benchmark::DoNotOptimize(tracing::Span{"name"});
+
+    tracing::Tracer::SetNoLogSpans({});
+  });
+}
+BENCHMARK(tracing_no_log_span_ctr);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
@@ -0,0 +1,106 @@
+#include <userver/utils/async_many.hpp>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+TaskBatchStateBase::TaskBatchStateBase(std::string&& name, std::size_t size)
+    : size_(size), span_(std::move(name)), remaining_(size) {
+  // The span measures the whole batch and must not become the parent of the
+  // caller's spans
+  span_.AddNonInheritableTag("tasks_count", size_);
+  span_.DetachFromCoroStack();
+
+  if (engine::current_task::IsTaskProcessorThread()) {
+    storage_.InheritFrom(engine::impl::task_local::GetCurrentStorage());
+  }
+  tasks_.reserve(size_);
+}
+
+TaskBatchStateBase::~TaskBatchStateBase() {
+  RequestCancel();
+
+  {
+    const engine::TaskCancellationBlocker blocker;
+    while (remaining_.load(std::memory_order_acquire) != 0) {
+      [[maybe_unused]] const bool ok = event_.WaitForEvent();
+    }
+  }
+
+  // The tasks may still be finishing after reporting into the counter
+  tasks_.clear();
+}
+
+bool TaskBatchStateBase::IsReady() const noexcept {
+  return remaining_.load(std::memory_order_acquire) == 0 ||
+         is_failed_.load(std::memory_order_acquire);
+}
+
+void TaskBatchStateBase::RequestCancel() {
+  for (auto& task : tasks_) {
+    if (!task.IsFinished()) task.RequestCancel();
+  }
+}
+
+engine::FutureStatus TaskBatchStateBase::WaitUntil(engine::Deadline deadline) {
+  while (!IsReady()) {
+    if (!event_.WaitForEventUntil(deadline)) {
+      if (IsReady()) break;
+      return engine::current_task::ShouldCancel()
+                 ? engine::FutureStatus::kCancelled
+                 : engine::FutureStatus::kTimeout;
+    }
+  }
+  return engine::FutureStatus::kReady;
+}
+
+void TaskBatchStateBase::Wait() {
+  if (WaitUntil({}) != engine::FutureStatus::kReady) {
+    throw engine::WaitInterruptedException(
+        engine::current_task::CancellationReason());
+  }
+}
+
+void TaskBatchStateBase::RethrowIfFailed() {
+  if (!is_failed_.load(std::memory_order_acquire)) return;
+
+  RequestCancel();
+  std::rethrow_exception(exception_);
+}
+
+void TaskBatchStateBase::OnTaskCompleted(std::exception_ptr exception) noexcept {
+  if (exception && !has_exception_.exchange(true)) {
+    exception_ = std::move(exception);
+    is_failed_.store(true, std::memory_order_release);
+    event_.Send();
+  }
+
+  // The owner may see the zero before the Send, but it does not destroy the
+  // state until the task finishes
+  if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) event_.Send();
+}
+
+void TaskBatchStateBase::OnTaskCancelled() noexcept {
+  OnTaskCompleted(std::make_exception_ptr(engine::TaskCancelledException(
+      engine::current_task::CancellationReason())));
+}
+
+void TaskBatchStateBase::BeforeInvoke() {
+  engine::impl::task_local::GetCurrentStorage().InheritFrom(storage_);
+}
+
+void TaskBatchStateBase::AddTask(engine::TaskWithResult<void>&& task) {
+  tasks_.push_back(std::move(task));
+}
+
+void TaskBatchStateBase::OnTasksNotStarted(std::size_t count) noexcept {
+  remaining_.fetch_sub(count, std::memory_order_acq_rel);
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
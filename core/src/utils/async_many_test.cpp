@@ -0,0 +1,115 @@
+#include <userver/utils/async_many.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::TaskInheritedVariable<std::string> kInheritedVariable;
+
+}  // namespace
+
+UTEST_MT(UtilsAsyncMany, Results, 4) {
+  /// [Sample utils::AsyncMany]
+  auto batch = utils::AsyncMany("squares", 100, [](std::size_t index) {
+    return index * index;
+  });
+  const std::vector<std::size_t> squares = batch.Get();
+  /// [Sample utils::AsyncMany]
+
+  ASSERT_EQ(squares.size(), 100);
+  for (std::size_t i = 0; i < squares.size(); ++i) {
+    EXPECT_EQ(squares[i], i * i);
+  }
+  EXPECT_FALSE(batch.IsValid());
+}
+
+UTEST(UtilsAsyncMany, Void) {
+  std::atomic<std::size_t> sum{0};
+  auto batch =
+      utils::AsyncMany("void", 10, [&sum](std::size_t index) { sum += index; });
+  EXPECT_EQ(batch.Size(), 10);
+  batch.Get();
+  EXPECT_EQ(sum.load(), 45);
+}
+
+UTEST(UtilsAsyncMany, Empty) {
+  auto batch = utils::AsyncMany("empty", 0, [](std::size_t) { return 1; });
+  EXPECT_TRUE(batch.IsReady());
+  EXPECT_TRUE(batch.Get().empty());
+}
+
+UTEST(UtilsAsyncMany, Wait) {
+  engine::SingleConsumerEvent event;
+  auto batch = utils::AsyncMany("wait", 3, [&event](std::size_t index) {
+    if (index == 0) ASSERT_TRUE(event.WaitForEventFor(utest::kMaxTestWaitTime));
+  });
+
+  EXPECT_EQ(batch.WaitUntil(engine::Deadline::FromDuration(
+                std::chrono::milliseconds{10})),
+            engine::FutureStatus::kTimeout);
+  EXPECT_FALSE(batch.IsReady());
+
+  event.Send();
+  batch.Wait();
+  EXPECT_TRUE(batch.IsReady());
+}
+
+UTEST_MT(UtilsAsyncMany, Exception, 2) {
+  auto batch = utils::AsyncMany("throw", 10, [](std::size_t index) {
+    if (index == 3) throw std::runtime_error("3");
+    engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    engine::current_task::CancellationPoint();
+  });
+
+  // Does not wait for the sleeping tasks
+  UEXPECT_THROW_MSG(batch.Get(), std::runtime_error, "3");
+}
+
+UTEST(UtilsAsyncMany, CancelBeforeStart) {
+  std::atomic<int> calls{0};
+  auto batch = utils::AsyncMany("cancel", 10, [&calls](std::size_t) {
+    ++calls;
+  });
+  batch.RequestCancel();
+
+  UEXPECT_THROW(batch.Get(), engine::TaskCancelledException);
+  EXPECT_EQ(calls.load(), 0);
+}
+
+UTEST(UtilsAsyncMany, DestroyCancels) {
+  std::atomic<int> started{0};
+  std::atomic<int> cancelled{0};
+  {
+    auto batch = utils::AsyncMany("destroy", 5, [&](std::size_t) {
+      ++started;
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+      if (engine::current_task::ShouldCancel()) ++cancelled;
+    });
+    while (started != 5) engine::Yield();
+  }
+  EXPECT_EQ(cancelled.load(), 5);
+}
+
+UTEST(UtilsAsyncMany, InheritedVariables) {
+  kInheritedVariable.Set("parent");
+  auto batch = utils::AsyncMany("inherit", 3, [](std::size_t index) {
+    auto value = kInheritedVariable.Get();
+    kInheritedVariable.Set(std::to_string(index));
+    return value;
+  });
+
+  for (const auto& value : batch.Get()) EXPECT_EQ(value, "parent");
+  EXPECT_EQ(kInheritedVariable.Get(), "parent");
+}
+
+USERVER_NAMESPACE_END
@@ -43,6 +43,18 @@ UTEST(UtilsAsync, WithDeadlineCancellationPoint) {
   UEXPECT_THROW(task.Get(), engine::TaskCancelledException);
 }
 
+UTEST(UtilsAsync, WithPriority) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  auto task = utils::Async(task_processor, "async",
+                           engine::Task::Priority::kHigh, [] { return 1; });
+  EXPECT_EQ(task.Get(), 1);
+
+  auto critical_task = utils::CriticalAsync(
+      task_processor, "critical", engine::Task::Priority::kLow,
+      [](int x) { return x; }, 2);
+  EXPECT_EQ(critical_task.Get(), 2);
+}
+
 UTEST(UtilsAsync, MemberFunctions) {
   struct NotCopyable {
     NotCopyable() = default;
@@ -1,8 +1,13 @@
 #include <userver/utils/cpu_relax.hpp>
 
+#include <algorithm>
+#include <utility>
+
 #include <fmt/format.h>
 
+#include <engine/task/task_context.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/local_variable.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -12,9 +17,68 @@ USERVER_NAMESPACE_BEGIN
 namespace utils {
 
 namespace {
+
 constexpr std::chrono::milliseconds kYieldInterval{3};
+
+// Bounds the burst of CPU usage after the task has been waiting for a while
+constexpr std::chrono::milliseconds kMaxCpuBudgetCredit{100};
+
+engine::TaskLocalVariable<CpuBudgetScope*> current_cpu_budget;
+
+std::chrono::nanoseconds GetCurrentTaskCpuTime() {
+  return engine::current_task::GetCurrentTaskContext().GetCpuTime();
+}
+
+void YieldOrThrottle() {
+  if (!engine::current_task::IsTaskProcessorThread()) return;
+
+  auto* const* budget = current_cpu_budget.GetOptional();
+  if (budget && *budget) {
+    (*budget)->Throttle();
+  } else {
+    engine::Yield();
+  }
+}
+
 }  // namespace
 
+CpuBudgetScope::CpuBudgetScope(double cpu_share)
+    : cpu_share_(cpu_share),
+      previous_(std::exchange(*current_cpu_budget, this)),
+      start_cpu_time_(GetCurrentTaskCpuTime()),
+      start_time_(std::chrono::steady_clock::now()) {
+  UINVARIANT(cpu_share_ > 0 && cpu_share_ <= 1,
+             "CPU share must be in (0, 1]");
+}
+
+CpuBudgetScope::~CpuBudgetScope() {
+  UASSERT(*current_cpu_budget == this);
+  *current_cpu_budget = previous_;
+}
+
+std::chrono::nanoseconds CpuBudgetScope::GetCpuTime() const {
+  return GetCurrentTaskCpuTime() - start_cpu_time_;
+}
+
+void CpuBudgetScope::Throttle() {
+  if (cpu_share_ >= 1) {
+    engine::Yield();
+    return;
+  }
+
+  // The wall time needed to stay within the budget
+  const auto required_time =
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          GetCpuTime() / cpu_share_);
+  const auto allowed_since = std::chrono::steady_clock::now() - required_time;
+  if (allowed_since < start_time_) {
+    engine::SleepFor(start_time_ - allowed_since);
+  } else {
+    start_time_ = std::max(start_time_, allowed_since - kMaxCpuBudgetCredit);
+    engine::Yield();
+  }
+}
+
 ScopeTimePause::ScopeTimePause(tracing::ScopeTime* scope) : scope_(scope) {}
 
 void ScopeTimePause::Pause() {
@@ -41,9 +105,7 @@ void CpuRelax::Relax() {
     pause_.Pause();
     LOG_TRACE() << fmt::format("CPU relax: yielding after {} iterations",
                                every_iterations_);
-    if (engine::current_task::IsTaskProcessorThread()) {
-      engine::Yield();
-    }
+    YieldOrThrottle();
     pause_.Unpause();
   }
 }
@@ -72,9 +134,7 @@ void StreamingCpuRelax::Relax(std::uint64_t bytes_processed) {
                   << " of CPU time";
 
       last_yield_time_ = now;
-      if (engine::current_task::IsTaskProcessorThread()) {
-        engine::Yield();
-      }
+      YieldOrThrottle();
       pause_.Unpause();
     }
   }
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+/// Writes the protobuf wire format without the generated code, for the few
+/// messages that are serialized by userver itself
+class ProtoWriter final {
+ public:
+  explicit ProtoWriter(std::string& out) : out_(out) {}
+
+  void Varint(int field, std::uint64_t value) {
+    Tag(field, WireType::kVarint);
+    RawVarint(value);
+  }
+
+  void Fixed64(int field, std::uint64_t value) {
+    Tag(field, WireType::kFixed64);
+    RawFixed64(value);
+  }
+
+  void Double(int field, double value) { Fixed64(field, ToBits(value)); }
+
+  void Bytes(int field, std::string_view value) {
+    Tag(field, WireType::kLengthDelimited);
+    RawVarint(value.size());
+    out_.append(value);
+  }
+
+  /// Appends the already serialized fields
+  void Raw(std::string_view fields) { out_.append(fields); }
+
+  /// Writes the nested message produced by `func(ProtoWriter&)`
+  template <typename Func>
+  void Message(int field, Func&& func) {
+    std::string nested;
+    ProtoWriter writer{nested};
+    std::forward<Func>(func)(writer);
+    Bytes(field, nested);
+  }
+
+  /// Writes the packed repeated varint field, the negative values take the
+  /// full 10 bytes as `int64`
+  template <typename Range>
+  void PackedVarint(int field, const Range& values) {
+    std::string packed;
+    ProtoWriter writer{packed};
+    for (const auto value : values) {
+      writer.RawVarint(static_cast<std::uint64_t>(value));
+    }
+    Bytes(field, packed);
+  }
+
+  /// Writes the packed repeated fixed64 or double field
+  template <typename Range>
+  void PackedFixed64(int field, const Range& values) {
+    std::string packed;
+    ProtoWriter writer{packed};
+    for (const auto value : values) {
+      if constexpr (std::is_floating_point_v<decltype(value)>) {
+        writer.RawFixed64(ToBits(value));
+      } else {
+        writer.RawFixed64(value);
+      }
+    }
+    Bytes(field, packed);
+  }
+
+ private:
+  enum class WireType : std::uint8_t {
+    kVarint = 0,
+    kFixed64 = 1,
+    kLengthDelimited = 2,
+  };
+
+  static std::uint64_t ToBits(double value) noexcept {
+    std::uint64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value));
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  void Tag(int field, WireType type) {
+    RawVarint((static_cast<std::uint64_t>(field) << 3) |
+              static_cast<std::uint8_t>(type));
+  }
+
+  void RawVarint(std::uint64_t value) {
+    while (value >= 0x80) {
+      out_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    out_.push_back(static_cast<char>(value));
+  }
+
+  void RawFixed64(std::uint64_t value) {
+    char bytes[sizeof(value)];
+    for (auto& byte : bytes) {
+      byte = static_cast<char>(value & 0xff);
+      value >>= 8;
+    }
+    out_.append(bytes, sizeof(bytes));
+  }
+
+  std::string& out_;
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
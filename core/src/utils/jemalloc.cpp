@@ -6,6 +6,8 @@
 #include <cerrno>
 #endif
 
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,6 +38,12 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+constexpr std::uint64_t kNoThreadAllocatedBytes = 0;
+
+// Points to the counter of jemalloc itself, so the reads are cheap
+thread_local USERVER_IMPL_CONSTINIT const std::uint64_t* thread_allocated =
+    nullptr;
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -55,6 +63,10 @@ std::error_code ProfDeactivate() { return MallCtl<bool>("prof.active", false); }
 
 std::error_code ProfDump() { return MallCtl("prof.dump"); }
 
+std::error_code ProfDump(const std::string& filename) {
+  return MallCtl<const char*>("prof.dump", filename.c_str());
+}
+
 std::error_code SetMaxBgThreads(size_t max_bg_threads) {
   return MallCtl<size_t>("max_background_threads", max_bg_threads);
 }
@@ -68,6 +80,17 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+USERVER_PREVENT_TLS_CACHING std::uint64_t GetThreadAllocatedBytes() noexcept {
+  if (!thread_allocated) {
+    std::uint64_t* counter = nullptr;
+    std::size_t size = sizeof(counter);
+    const int rc = mallctl("thread.allocatedp", &counter, &size, nullptr, 0);
+    thread_allocated =
+        (rc == 0 && counter) ? counter : &kNoThreadAllocatedBytes;
+  }
+  return *thread_allocated;
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <system_error>
 
@@ -15,6 +16,10 @@ std::error_code ProfDeactivate();
 
 std::error_code ProfDump();
 
+// Dumps the heap profile into the specified file instead of the one from the
+// `prof_prefix` option
+std::error_code ProfDump(const std::string& filename);
+
 std::error_code SetMaxBgThreads(size_t max_bg_threads);
 
 std::error_code EnableBgThreads();
@@ -22,6 +27,10 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+// The count of bytes allocated by the current thread since its start, always
+// returns 0 if jemalloc is disabled
+std::uint64_t GetThreadAllocatedBytes() noexcept;
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
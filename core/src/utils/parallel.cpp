@@ -0,0 +1,84 @@
+#include <userver/utils/parallel.hpp>
+
+#include <atomic>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::parallel::impl {
+
+namespace {
+
+// More chunks than tasks, so that the tasks that got cheaper chunks or
+// started earlier take the remaining work
+constexpr std::size_t kChunksPerTask = 4;
+
+engine::TaskProcessor& GetTaskProcessor(const Options& options) {
+  return options.task_processor ? *options.task_processor
+                                : engine::current_task::GetTaskProcessor();
+}
+
+std::size_t DivideRoundingUp(std::size_t lhs, std::size_t rhs) noexcept {
+  return (lhs + rhs - 1) / rhs;
+}
+
+}  // namespace
+
+Runner::Runner(std::string&& name, std::size_t size, const Options& options)
+    : span_(std::move(name)),
+      task_processor_(GetTaskProcessor(options)),
+      deadline_(options.deadline),
+      size_(size),
+      concurrency_(options.max_concurrency
+                       ? options.max_concurrency
+                       : task_processor_.GetActiveWorkerCount()),
+      chunk_size_(std::max(options.min_chunk_size, std::size_t{1})),
+      chunks_count_(0) {
+  if (concurrency_ == 0) concurrency_ = 1;
+  chunk_size_ = std::max(chunk_size_,
+                         DivideRoundingUp(size_, concurrency_ * kChunksPerTask));
+  chunks_count_ = DivideRoundingUp(size_, chunk_size_);
+
+  span_.AddNonInheritableTag("parallel_size", size_);
+  span_.AddNonInheritableTag("parallel_chunks", chunks_count_);
+}
+
+void Runner::RunJobs(std::size_t jobs_count, Job job) {
+  if (jobs_count == 0) return;
+
+  // A single job on the caller's task processor does not need a task
+  if (jobs_count == 1 && !deadline_.IsReachable() &&
+      &task_processor_ == &engine::current_task::GetTaskProcessor()) {
+    job(0);
+    return;
+  }
+
+  std::atomic<std::size_t> next_job{0};
+  const auto worker = [&next_job, jobs_count, job] {
+    while (true) {
+      engine::current_task::CancellationPoint();
+      const auto index = next_job.fetch_add(1, std::memory_order_relaxed);
+      if (index >= jobs_count) return;
+      job(index);
+    }
+  };
+
+  const auto tasks_count = std::min(concurrency_, jobs_count);
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(tasks_count);
+  for (std::size_t i = 0; i < tasks_count; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(task_processor_, deadline_, worker));
+  }
+
+  // On exception the destructors of the tasks cancel the rest of the jobs
+  engine::WaitAllChecked(tasks);
+}
+
+}  // namespace utils::parallel::impl
+
+USERVER_NAMESPACE_END
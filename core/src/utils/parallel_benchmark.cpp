@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/parallel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSize = 1 << 20;
+
+std::vector<std::uint64_t> MakeShuffled() {
+  std::vector<std::uint64_t> result(kSize);
+  std::iota(result.begin(), result.end(), 0);
+  std::shuffle(result.begin(), result.end(), std::mt19937{42});
+  return result;
+}
+
+}  // namespace
+
+void parallel_sort(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const auto input = MakeShuffled();
+    for ([[maybe_unused]] auto _ : state) {
+      state.PauseTiming();
+      auto values = input;
+      state.ResumeTiming();
+
+      utils::parallel::Sort("sort", values.begin(), values.end());
+      benchmark::DoNotOptimize(values.data());
+    }
+  });
+}
+BENCHMARK(parallel_sort)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+void parallel_reduce(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const auto input = MakeShuffled();
+    for ([[maybe_unused]] auto _ : state) {
+      auto sum = utils::parallel::Reduce("sum", input.begin(), input.end(),
+                                         std::uint64_t{0});
+      benchmark::DoNotOptimize(sum);
+    }
+  });
+}
+BENCHMARK(parallel_reduce)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+void parallel_for_small(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::vector<std::uint64_t> values(64);
+    for ([[maybe_unused]] auto _ : state) {
+      utils::parallel::For("small", values.size(),
+                           [&values](std::size_t i) { values[i] += i; });
+      benchmark::DoNotOptimize(values.data());
+    }
+  });
+}
+BENCHMARK(parallel_for_small)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,161 @@
+#include <userver/utils/parallel.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kThreads = 4;
+
+std::vector<int> MakeShuffled(std::size_t size) {
+  std::vector<int> result(size);
+  std::iota(result.begin(), result.end(), 0);
+  std::shuffle(result.begin(), result.end(), std::mt19937{42});
+  return result;
+}
+
+}  // namespace
+
+UTEST_MT(UtilsParallel, For, kThreads) {
+  /// [Sample utils::parallel::For]
+  std::vector<int> squares(10000);
+  utils::parallel::For("squares", squares.size(), [&squares](std::size_t i) {
+    squares[i] = static_cast<int>(i * i);
+  });
+  /// [Sample utils::parallel::For]
+
+  for (std::size_t i = 0; i < squares.size(); ++i) {
+    ASSERT_EQ(squares[i], static_cast<int>(i * i));
+  }
+}
+
+UTEST_MT(UtilsParallel, Empty, kThreads) {
+  std::vector<int> empty;
+  utils::parallel::For("empty", 0, [](std::size_t) { FAIL(); });
+  utils::parallel::ForEach("empty", empty.begin(), empty.end(),
+                           [](int) { FAIL(); });
+  utils::parallel::Sort("empty", empty.begin(), empty.end());
+  EXPECT_EQ(utils::parallel::Reduce("empty", empty.begin(), empty.end(), 42),
+            42);
+}
+
+UTEST_MT(UtilsParallel, ForEach, kThreads) {
+  std::vector<std::atomic<int>> visits(1000);
+  utils::parallel::ForEach("visits", visits.begin(), visits.end(),
+                           [](std::atomic<int>& visit) { ++visit; });
+  for (const auto& visit : visits) ASSERT_EQ(visit.load(), 1);
+}
+
+UTEST_MT(UtilsParallel, Transform, kThreads) {
+  const auto input = MakeShuffled(5000);
+  std::vector<std::string> output(input.size());
+  utils::parallel::Transform("transform", input.begin(), input.end(),
+                             output.begin(),
+                             [](int value) { return std::to_string(value); });
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    ASSERT_EQ(output[i], std::to_string(input[i]));
+  }
+}
+
+UTEST_MT(UtilsParallel, Reduce, kThreads) {
+  /// [Sample utils::parallel::Reduce]
+  const std::vector<std::int64_t> values(100000, 3);
+  const auto sum = utils::parallel::Reduce("sum", values.begin(), values.end(),
+                                           std::int64_t{0});
+  EXPECT_EQ(sum, 300000);
+  /// [Sample utils::parallel::Reduce]
+}
+
+UTEST_MT(UtilsParallel, ReduceKeepsOrder, kThreads) {
+  std::vector<std::string> letters;
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    letters.emplace_back(1, static_cast<char>('a' + i % 26));
+    expected += letters.back();
+  }
+
+  utils::parallel::Options options;
+  options.min_chunk_size = 10;
+
+  // Concatenation is associative but not commutative
+  const auto result =
+      utils::parallel::Reduce("concat", letters.begin(), letters.end(),
+                              std::string{}, std::plus<>{}, options);
+  EXPECT_EQ(result, expected);
+}
+
+UTEST_MT(UtilsParallel, Sort, kThreads) {
+  for (const std::size_t size : {1, 2, 3, 17, 1000, 12345}) {
+    auto values = MakeShuffled(size);
+    utils::parallel::Sort("sort", values.begin(), values.end(),
+                          std::greater<>{});
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>{}))
+        << size;
+    ASSERT_EQ(values.front(), static_cast<int>(size) - 1);
+  }
+}
+
+UTEST_MT(UtilsParallel, MaxConcurrency, kThreads) {
+  std::atomic<int> running{0};
+  std::atomic<int> max_running{0};
+
+  utils::parallel::Options options;
+  options.max_concurrency = 2;
+  utils::parallel::For(
+      "concurrency", 100,
+      [&](std::size_t) {
+        const auto current = ++running;
+        auto max = max_running.load();
+        while (max < current &&
+               !max_running.compare_exchange_weak(max, current)) {
+        }
+        engine::Yield();
+        --running;
+      },
+      options);
+
+  EXPECT_LE(max_running.load(), 2);
+}
+
+UTEST_MT(UtilsParallel, Exception, kThreads) {
+  std::atomic<int> calls{0};
+  UEXPECT_THROW_MSG(utils::parallel::For("throw", 100000,
+                                         [&calls](std::size_t i) {
+                                           ++calls;
+                                           if (i == 10) {
+                                             throw std::runtime_error("10");
+                                           }
+                                           engine::Yield();
+                                         }),
+                    std::runtime_error, "10");
+  // The rest of the chunks were cancelled
+  EXPECT_LT(calls.load(), 100000);
+}
+
+UTEST_MT(UtilsParallel, Deadline, kThreads) {
+  utils::parallel::Options options;
+  options.deadline =
+      engine::Deadline::FromDuration(std::chrono::milliseconds{10});
+
+  UEXPECT_THROW(utils::parallel::For(
+                    "deadline", 1000000,
+                    [](std::size_t) {
+                      engine::current_task::CancellationPoint();
+                      engine::Yield();
+                    },
+                    options),
+                engine::TaskCancelledException);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/periodic_task.hpp>
 
+#include <functional>
 #include <random>
 
 #include <fmt/format.h>
@@ -132,6 +133,7 @@ void PeriodicTask::Run() {
       skip_step = true;
     }
   }
+  auto phase = GetPhase();
 
   while (!engine::current_task::ShouldCancel()) {
     const auto before = std::chrono::steady_clock::now();
@@ -154,6 +156,7 @@ void PeriodicTask::Run() {
       start = std::chrono::steady_clock::now();
     }
 
+    start += std::exchange(phase, std::chrono::milliseconds::zero());
     while (changed_event_.WaitForEventUntil(start + MutatePeriod(period))) {
       if (should_force_step_.exchange(false)) {
         break;
@@ -171,17 +174,42 @@ bool PeriodicTask::DoStep() {
   auto settings_ptr = settings_.Read();
   const auto span_log_level = settings_ptr->span_level;
   const auto name_ptr = name_.Read();
+  const auto period = settings_ptr->period;
   tracing::Span span(*name_ptr, tracing::ReferenceType::kChild, span_log_level);
+  const auto before = std::chrono::steady_clock::now();
   try {
     callback_();
+    AccountRun(std::chrono::steady_clock::now() - before, period, true);
     return true;
   } catch (const std::exception& e) {
+    AccountRun(std::chrono::steady_clock::now() - before, period, false);
     LOG_ERROR() << "Exception in PeriodicTask with name=" << *name_ptr << ": "
                 << e;
     return false;
   }
 }
 
+void PeriodicTask::AccountRun(std::chrono::steady_clock::duration runtime,
+                              std::chrono::milliseconds period,
+                              bool no_exception) {
+  const auto runtime_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(runtime).count();
+  last_runtime_us_.store(runtime_us, std::memory_order_relaxed);
+  // Steps are serialized by step_mutex_, no need for a CAS loop
+  if (runtime_us > max_runtime_us_.load(std::memory_order_relaxed)) {
+    max_runtime_us_.store(runtime_us, std::memory_order_relaxed);
+  }
+  if (runtime > period) {
+    overruns_.fetch_add(1, std::memory_order_relaxed);
+    const auto name_ptr = name_.Read();
+    LOG_LIMITED_WARNING() << "PeriodicTask with name=" << *name_ptr
+                          << " took " << runtime_us
+                          << "us, which is longer than its period";
+  }
+  if (!no_exception) failures_.fetch_add(1, std::memory_order_relaxed);
+  runs_.fetch_add(1, std::memory_order_relaxed);
+}
+
 bool PeriodicTask::Step() {
   std::lock_guard<engine::Mutex> lock_step(step_mutex_);
 
@@ -218,6 +246,19 @@ std::chrono::milliseconds PeriodicTask::MutatePeriod(
   return std::chrono::milliseconds(ms);
 }
 
+std::chrono::milliseconds PeriodicTask::GetPhase() const {
+  auto settings_ptr = settings_.Read();
+  if (!(settings_ptr->flags & Flags::kSpread)) return {};
+
+  const auto distribution = settings_ptr->distribution.count();
+  if (distribution <= 0) return {};
+  const auto name_ptr = name_.Read();
+  // Deterministic, so that restarts and replicas keep the phases spread
+  const auto hash = std::hash<std::string>{}(*name_ptr);
+  return std::chrono::milliseconds(
+      static_cast<std::int64_t>(hash % static_cast<std::size_t>(distribution)));
+}
+
 void PeriodicTask::SuspendDebug() {
   // step_mutex_ waits, for a potentially long time, for Step() call completion
   std::lock_guard<engine::Mutex> lock_step(step_mutex_);
@@ -247,6 +288,18 @@ PeriodicTask::Settings PeriodicTask::GetCurrentSettings() const {
   return *settings_ptr;
 }
 
+PeriodicTask::Statistics PeriodicTask::GetStatistics() const {
+  Statistics result;
+  result.runs = runs_.load(std::memory_order_relaxed);
+  result.failures = failures_.load(std::memory_order_relaxed);
+  result.overruns = overruns_.load(std::memory_order_relaxed);
+  result.last_runtime = std::chrono::microseconds{
+      last_runtime_us_.load(std::memory_order_relaxed)};
+  result.max_runtime = std::chrono::microseconds{
+      max_runtime_us_.load(std::memory_order_relaxed)};
+  return result;
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
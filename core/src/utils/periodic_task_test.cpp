@@ -406,6 +406,61 @@ UTEST(PeriodicTask, SynchronizeDebugFailure) {
   task.Stop();
 }
 
+UTEST(PeriodicTask, Statistics) {
+  SimpleTaskData simple;
+  simple.throw_exception = true;
+
+  constexpr auto period = utest::kMaxTestWaitTime;
+  utils::PeriodicTask task("task", period, simple.GetTaskFunction());
+  EXPECT_EQ(task.GetStatistics().runs, 0U);
+
+  EXPECT_FALSE(task.SynchronizeDebug());
+  simple.throw_exception = false;
+  simple.sleep = 10ms;
+  EXPECT_TRUE(task.SynchronizeDebug());
+
+  const auto stats = task.GetStatistics();
+  EXPECT_EQ(stats.runs, 2U);
+  EXPECT_EQ(stats.failures, 1U);
+  EXPECT_EQ(stats.overruns, 0U);
+  EXPECT_GE(stats.last_runtime, simple.sleep);
+  EXPECT_GE(stats.max_runtime, stats.last_runtime);
+
+  task.Stop();
+}
+
+UTEST(PeriodicTask, StatisticsOverrun) {
+  SimpleTaskData simple;
+  simple.sleep = 20ms;
+
+  constexpr auto period = 10ms;
+  utils::PeriodicTask task("task", period, simple.GetTaskFunction());
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple]() { return simple.GetCount() > 0; }));
+  task.Stop();
+
+  const auto stats = task.GetStatistics();
+  EXPECT_GE(stats.runs, 1U);
+  EXPECT_GE(stats.overruns, 1U);
+  EXPECT_GE(stats.max_runtime, simple.sleep);
+}
+
+UTEST(PeriodicTask, Spread) {
+  constexpr auto period = 20ms;
+  const utils::PeriodicTask::Settings settings(
+      period, period, utils::PeriodicTask::Flags::kSpread);
+
+  SimpleTaskData simple;
+  const auto start = std::chrono::steady_clock::now();
+  utils::PeriodicTask task("task", settings, simple.GetTaskFunction());
+  EXPECT_TRUE(simple.WaitFor(period * 2 * kSlowRatio,
+                             [&simple]() { return simple.GetCount() > 0; }));
+  // The phase only delays the iterations
+  EXPECT_GE(std::chrono::steady_clock::now() - start, period);
+
+  task.Stop();
+}
+
 UTEST(PeriodicTask, SynchronizeDebugSpan) {
   const tracing::Span span(__func__);
   std::string task_link;
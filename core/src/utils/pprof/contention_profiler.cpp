@@ -0,0 +1,119 @@
+#include <utils/pprof/contention_profiler.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+namespace impl {
+std::atomic<bool> is_contention_profiler_enabled{false};
+}  // namespace impl
+
+namespace {
+
+constexpr std::size_t kMaxDepth = 64;
+constexpr std::size_t kMaxStacks = 16384;
+
+struct Contentions final {
+  std::int64_t count{0};
+  std::int64_t delay_ns{0};
+};
+
+std::atomic<bool> is_busy{false};
+
+// The contended locks are already slow, a plain mutex is fine here
+std::mutex contentions_mutex;
+std::map<Stack, Contentions> contentions;
+std::size_t dropped_contentions{0};
+
+}  // namespace
+
+void ContentionScope::Account() noexcept {
+  const auto delay = std::chrono::steady_clock::now() - start_;
+
+  // Skips the Account itself
+  const void* frames[kMaxDepth + 1]{};
+  boost::stacktrace::safe_dump_to(1, frames, sizeof(frames));
+  const auto* const end =
+      std::find(std::begin(frames), std::end(frames), nullptr);
+
+  try {
+    Stack stack;
+    stack.reserve(end - std::begin(frames));
+    for (const auto* frame = std::begin(frames); frame != end; ++frame) {
+      stack.push_back(reinterpret_cast<std::uintptr_t>(*frame));
+    }
+
+    const std::lock_guard lock{contentions_mutex};
+    // The profile might have been collected while the task waited
+    if (!impl::is_contention_profiler_enabled.load(std::memory_order_relaxed)) {
+      return;
+    }
+    auto it = contentions.find(stack);
+    if (it == contentions.end()) {
+      if (contentions.size() >= kMaxStacks) {
+        ++dropped_contentions;
+        return;
+      }
+      it = contentions.emplace(std::move(stack), Contentions{}).first;
+    }
+    ++it->second.count;
+    it->second.delay_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count();
+  } catch (const std::exception&) {
+    // The contention is not accounted
+  }
+}
+
+std::string CollectContentionProfile(std::chrono::milliseconds duration) {
+  if (is_busy.exchange(true)) {
+    throw ProfilerBusyError("Another contention profile is being collected");
+  }
+  const utils::FastScopeGuard busy_guard{[]() noexcept { is_busy = false; }};
+
+  const auto start = utils::datetime::Now();
+  impl::is_contention_profiler_enabled = true;
+  {
+    const utils::FastScopeGuard enabled_guard{
+        []() noexcept { impl::is_contention_profiler_enabled = false; }};
+    engine::InterruptibleSleepFor(duration);
+  }
+  const auto actual_duration = utils::datetime::Now() - start;
+
+  std::map<Stack, Contentions> collected;
+  std::size_t dropped = 0;
+  {
+    const std::lock_guard lock{contentions_mutex};
+    collected.swap(contentions);
+    std::swap(dropped, dropped_contentions);
+  }
+  if (dropped != 0) {
+    LOG_WARNING() << "Contention profiler dropped " << dropped
+                  << " contentions, too many different stacks";
+  }
+
+  ProfileBuilder builder{{{"contentions", "count"}, {"delay", "nanoseconds"}},
+                         {"contentions", "count"},
+                         1};
+  builder.SetTime(start, actual_duration);
+  for (const auto& [stack, stats] : collected) {
+    const std::int64_t values[] = {stats.count, stats.delay_ns};
+    builder.AddSample(stack, values);
+  }
+  return builder.Serialize();
+}
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include <utils/pprof/profile_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+namespace impl {
+extern std::atomic<bool> is_contention_profiler_enabled;
+}  // namespace impl
+
+/// @brief Measures the wait of a contended engine::Mutex lock, does nothing
+/// unless the contention profile is being collected.
+///
+/// Should be created only after the fast path of the lock has failed.
+class ContentionScope final {
+ public:
+  ContentionScope() noexcept {
+    if (impl::is_contention_profiler_enabled.load(std::memory_order_relaxed)) {
+      start_ = std::chrono::steady_clock::now();
+    }
+  }
+
+  ContentionScope(const ContentionScope&) = delete;
+  ContentionScope& operator=(const ContentionScope&) = delete;
+
+  ~ContentionScope() {
+    if (start_ != std::chrono::steady_clock::time_point{}) Account();
+  }
+
+ private:
+  void Account() noexcept;
+
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// @brief Records the stacks of the contended engine::Mutex locks, suspends
+/// the current task for the `duration` or until it is cancelled.
+///
+/// @returns serialized pprof profile with the `contentions` and `delay`
+/// sample types
+/// @throws ProfilerBusyError if another contention profile is being collected
+std::string CollectContentionProfile(std::chrono::milliseconds duration);
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
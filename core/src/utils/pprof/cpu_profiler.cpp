@@ -0,0 +1,173 @@
+#include <utils/pprof/cpu_profiler.hpp>
+
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/stacktrace/safe_dump_to.hpp>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <utils/check_syscall.hpp>
+#include <utils/pprof/profile_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+namespace {
+
+constexpr std::size_t kMaxDepth = 64;
+constexpr std::size_t kMaxSamples = 1 << 15;
+
+// The signal handler itself and the signal trampoline
+constexpr std::size_t kSkippedFrames = 2;
+
+struct SampleSlot final {
+  // One more for the terminating nullptr
+  const void* frames[kMaxDepth + 1];
+};
+
+std::atomic<bool> is_busy{false};
+
+// Only async-signal-safe operations on these from the signal handler
+std::atomic<SampleSlot*> sample_slots{nullptr};
+std::atomic<std::size_t> sample_slots_count{0};
+std::atomic<std::size_t> next_sample_slot{0};
+std::atomic<std::size_t> dropped_samples{0};
+std::atomic<std::size_t> running_handlers{0};
+
+void OnSigProf(int, siginfo_t*, void*) {
+  const auto saved_errno = errno;
+
+  // Pairs with the reset of sample_slots in StopSampling
+  running_handlers.fetch_add(1);
+  auto* const slots = sample_slots.load();
+  if (slots) {
+    const auto index = next_sample_slot.fetch_add(1, std::memory_order_relaxed);
+    if (index < sample_slots_count.load(std::memory_order_relaxed)) {
+      boost::stacktrace::safe_dump_to(kSkippedFrames, slots[index].frames,
+                                      sizeof(slots[index].frames));
+    } else {
+      dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  running_handlers.fetch_sub(1);
+
+  errno = saved_errno;
+}
+
+void InstallSignalHandler() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    struct sigaction action {};
+    action.sa_sigaction = &OnSigProf;
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    utils::CheckSyscall(sigaction(SIGPROF, &action, nullptr),
+                        "setting SIGPROF handler");
+  });
+}
+
+void StartTimer(std::chrono::microseconds interval) {
+  itimerval timer{};
+  timer.it_interval.tv_sec = interval.count() / 1'000'000;
+  timer.it_interval.tv_usec = interval.count() % 1'000'000;
+  timer.it_value = timer.it_interval;
+  utils::CheckSyscall(setitimer(ITIMER_PROF, &timer, nullptr),
+                      "setting ITIMER_PROF");
+}
+
+void StopSampling() noexcept {
+  const itimerval disabled_timer{};
+  setitimer(ITIMER_PROF, &disabled_timer, nullptr);
+  sample_slots.store(nullptr);
+  // The handlers that have already seen the slots are finishing the writes
+  while (running_handlers.load() != 0) {
+    std::this_thread::yield();
+  }
+}
+
+}  // namespace
+
+std::string CollectCpuProfile(std::chrono::milliseconds duration,
+                              int frequency) {
+  UINVARIANT(frequency > 0 && frequency <= 1'000'000,
+             "Invalid CPU profiling frequency");
+  if (is_busy.exchange(true)) {
+    throw ProfilerBusyError("Another CPU profile is being collected");
+  }
+  const utils::FastScopeGuard busy_guard{[]() noexcept { is_busy = false; }};
+
+  const auto seconds = std::max<std::int64_t>(
+      std::chrono::ceil<std::chrono::seconds>(duration).count(), 1);
+  const auto expected_samples =
+      static_cast<std::size_t>(seconds) * frequency *
+      std::max(std::thread::hardware_concurrency(), 1U);
+  const auto slots_count = std::min(expected_samples, kMaxSamples);
+  const auto slots = std::make_unique<SampleSlot[]>(slots_count);
+
+  // Loads the unwinder libraries, so the handler does not allocate
+  SampleSlot warm_up{};
+  boost::stacktrace::safe_dump_to(warm_up.frames, sizeof(warm_up.frames));
+  InstallSignalHandler();
+
+  const auto start = utils::datetime::Now();
+  next_sample_slot = 0;
+  dropped_samples = 0;
+  sample_slots_count = slots_count;
+  sample_slots = slots.get();
+  {
+    const utils::FastScopeGuard sampling_guard{
+        []() noexcept { StopSampling(); }};
+    StartTimer(std::chrono::microseconds{1'000'000 / frequency});
+    engine::InterruptibleSleepFor(duration);
+  }
+  const auto actual_duration = utils::datetime::Now() - start;
+
+  const auto samples_count = std::min(next_sample_slot.load(), slots_count);
+  if (const auto dropped = dropped_samples.load(); dropped != 0) {
+    LOG_WARNING() << "CPU profiler dropped " << dropped << " samples of "
+                  << dropped + samples_count;
+  }
+
+  std::map<Stack, std::int64_t> stack_counts;
+  for (std::size_t i = 0; i < samples_count; ++i) {
+    const auto& frames = slots[i].frames;
+    const auto* const end =
+        std::find(std::begin(frames), std::end(frames), nullptr);
+    Stack stack;
+    stack.reserve(end - std::begin(frames));
+    for (const auto* frame = std::begin(frames); frame != end; ++frame) {
+      stack.push_back(reinterpret_cast<std::uintptr_t>(*frame));
+    }
+    if (!stack.empty()) ++stack_counts[std::move(stack)];
+  }
+
+  const std::int64_t period = 1'000'000'000 / frequency;
+  ProfileBuilder builder{
+      {{"samples", "count"}, {"cpu", "nanoseconds"}}, {"cpu", "nanoseconds"},
+      period};
+  builder.SetTime(start, actual_duration);
+  for (const auto& [stack, count] : stack_counts) {
+    const std::int64_t values[] = {count, count * period};
+    builder.AddSample(stack, values);
+  }
+  return builder.Serialize();
+}
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include <utils/pprof/profile_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+/// @brief Samples the stacks of the threads that consume CPU with `SIGPROF`,
+/// suspends the current task for the `duration` or until it is cancelled.
+///
+/// The stacks are unwound from the interrupted frame, so a sample taken
+/// while a coroutine runs contains only the frames of the task itself, and a
+/// sample of the engine code contains the frames of the worker thread.
+///
+/// The `SIGPROF` handler stays installed after the first call, only one
+/// profile is collected at a time.
+///
+/// @returns serialized pprof profile with the `samples` and `cpu` sample types
+/// @throws ProfilerBusyError if another CPU profile is being collected
+std::string CollectCpuProfile(std::chrono::milliseconds duration,
+                              int frequency);
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,173 @@
+#include <utils/pprof/heap_profile.hpp>
+
+#include <charconv>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/utils/datetime.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+namespace {
+
+constexpr std::string_view kHeader = "heap_v2/";
+constexpr std::string_view kStackPrefix = "@";
+constexpr std::string_view kTotalPrefix = "t*:";
+constexpr std::string_view kMappedLibraries = "MAPPED_LIBRARIES:";
+
+[[noreturn]] void ThrowMalformed(std::string_view line) {
+  throw std::runtime_error(
+      fmt::format("Malformed jemalloc heap profile line '{}'", line));
+}
+
+std::string_view Trim(std::string_view value) {
+  const auto begin = value.find_first_not_of(" \t");
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(" \t\r");
+  return value.substr(begin, end - begin + 1);
+}
+
+// Also consumes the separator
+std::string_view NextToken(std::string_view& line, char separator) {
+  line = Trim(line);
+  const auto pos = line.find(separator);
+  const auto token = line.substr(0, pos);
+  line.remove_prefix(pos == std::string_view::npos ? line.size() : pos + 1);
+  return Trim(token);
+}
+
+std::uint64_t ParseNumber(std::string_view token, std::string_view line,
+                          int base = 10) {
+  if (base == 16 && token.substr(0, 2) == "0x") token.remove_prefix(2);
+  std::uint64_t result = 0;
+  const auto* const end = token.data() + token.size();
+  const auto [ptr, ec] = std::from_chars(token.data(), end, result, base);
+  if (token.empty() || ec != std::errc{} || ptr != end) ThrowMalformed(line);
+  return result;
+}
+
+Stack ParseStack(std::string_view line) {
+  const auto original_line = line;
+  line.remove_prefix(kStackPrefix.size());
+  Stack stack;
+  for (auto token = NextToken(line, ' '); !token.empty();
+       token = NextToken(line, ' ')) {
+    stack.push_back(ParseNumber(token, original_line, 16));
+  }
+  if (stack.empty()) ThrowMalformed(original_line);
+  return stack;
+}
+
+// `t*: <objects>: <bytes> [<accumulated objects>: <accumulated bytes>]`
+void ParseCounts(std::string_view line, std::uint64_t sample_period,
+                 HeapSample& sample) {
+  auto rest = line.substr(kTotalPrefix.size());
+  const auto objects = ParseNumber(NextToken(rest, ':'), line);
+  const auto bytes = ParseNumber(NextToken(rest, '['), line);
+  if (objects == 0) return;
+
+  // The allocations are sampled with the probability that grows with their
+  // size, see `lg_prof_sample` in the jemalloc docs
+  const auto average_size =
+      static_cast<double>(bytes) / static_cast<double>(objects);
+  const auto scale =
+      1 / (1 - std::exp(-average_size / static_cast<double>(sample_period)));
+  sample.objects = std::llround(static_cast<double>(objects) * scale);
+  sample.bytes = std::llround(static_cast<double>(bytes) * scale);
+}
+
+}  // namespace
+
+HeapProfile ParseJemallocHeapProfile(std::string_view dump) {
+  HeapProfile result;
+
+  bool is_header = true;
+  bool is_stack_counts = false;
+  while (!dump.empty()) {
+    const auto pos = dump.find('\n');
+    const auto line = Trim(dump.substr(0, pos));
+    dump.remove_prefix(pos == std::string_view::npos ? dump.size() : pos + 1);
+
+    if (is_header) {
+      if (line.substr(0, kHeader.size()) != kHeader) ThrowMalformed(line);
+      result.sample_period = ParseNumber(line.substr(kHeader.size()), line);
+      if (result.sample_period == 0) ThrowMalformed(line);
+      is_header = false;
+    } else if (line.substr(0, kStackPrefix.size()) == kStackPrefix) {
+      result.samples.push_back({ParseStack(line), 0, 0});
+      is_stack_counts = true;
+    } else if (line.substr(0, kTotalPrefix.size()) == kTotalPrefix) {
+      // The first one is the total of the whole profile
+      if (is_stack_counts) {
+        ParseCounts(line, result.sample_period, result.samples.back());
+        is_stack_counts = false;
+      }
+    } else if (line == kMappedLibraries) {
+      // /proc/self/maps are read by the ProfileBuilder itself
+      break;
+    }
+    // The per-thread counts are skipped
+  }
+  if (is_header) throw std::runtime_error("Empty jemalloc heap profile");
+  return result;
+}
+
+HeapProfile DumpJemallocHeapProfile() {
+  const auto file = fs::blocking::TempFile::Create();
+  const auto time = utils::datetime::Now();
+  const auto ec = utils::jemalloc::ProfDump(file.GetPath());
+  if (ec) throw std::system_error(ec, "jemalloc prof.dump");
+
+  auto result =
+      ParseJemallocHeapProfile(fs::blocking::ReadFileContents(file.GetPath()));
+  result.time = time;
+  return result;
+}
+
+HeapProfile GetDelta(const HeapProfile& current, const HeapProfile& base) {
+  std::map<Stack, HeapSample> delta;
+  for (const auto& sample : current.samples) {
+    auto& result = delta[sample.stack];
+    result.objects += sample.objects;
+    result.bytes += sample.bytes;
+  }
+  for (const auto& sample : base.samples) {
+    auto& result = delta[sample.stack];
+    result.objects -= sample.objects;
+    result.bytes -= sample.bytes;
+  }
+
+  HeapProfile result{current.sample_period, current.time, {}};
+  for (auto& [stack, sample] : delta) {
+    if (sample.objects == 0 && sample.bytes == 0) continue;
+    sample.stack = stack;
+    result.samples.push_back(std::move(sample));
+  }
+  return result;
+}
+
+std::string SerializeHeapProfile(const HeapProfile& profile,
+                                 std::chrono::nanoseconds duration) {
+  ProfileBuilder builder{{{"inuse_objects", "count"}, {"inuse_space", "bytes"}},
+                         {"space", "bytes"},
+                         static_cast<std::int64_t>(profile.sample_period)};
+  builder.SetTime(profile.time, duration);
+  for (const auto& sample : profile.samples) {
+    const std::int64_t values[] = {sample.objects, sample.bytes};
+    builder.AddSample(sample.stack, values);
+  }
+  return builder.Serialize();
+}
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
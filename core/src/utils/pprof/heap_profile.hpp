@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <utils/pprof/profile_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+struct HeapSample final {
+  Stack stack;
+  // The estimations of the live objects, scaled for the sampling
+  std::int64_t objects{0};
+  std::int64_t bytes{0};
+};
+
+struct HeapProfile final {
+  std::uint64_t sample_period{0};
+  std::chrono::system_clock::time_point time;
+  std::vector<HeapSample> samples;
+};
+
+/// Parses the `heap_v2` format of the jemalloc `prof.dump`
+/// @throws std::runtime_error on the malformed dump
+HeapProfile ParseJemallocHeapProfile(std::string_view dump);
+
+/// Dumps and parses the heap profile of the current process, blocks
+/// @throws std::system_error if the jemalloc profiling is disabled
+HeapProfile DumpJemallocHeapProfile();
+
+/// Returns the difference of the profiles, the stacks that are absent in one
+/// of the profiles are treated as having zero values there
+HeapProfile GetDelta(const HeapProfile& current, const HeapProfile& base);
+
+/// Returns the serialized pprof profile with the `inuse_objects` and
+/// `inuse_space` sample types
+std::string SerializeHeapProfile(
+    const HeapProfile& profile,
+    std::chrono::nanoseconds duration = std::chrono::nanoseconds{0});
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
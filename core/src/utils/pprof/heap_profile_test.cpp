@@ -0,0 +1,93 @@
+#include <utils/pprof/heap_profile.hpp>
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDump = R"(heap_v2/524288
+  t*: 3: 1572992 [0: 0]
+  t0: 1: 128 [0: 0]
+  t3: 2: 1572864 [0: 0]
+@ 0x7f1000 0x7f2000 0x7f3000
+  t*: 1: 128 [0: 0]
+  t0: 1: 128 [0: 0]
+@ 0x7f4000 0x7f3000
+  t*: 2: 1572864 [0: 0]
+  t3: 2: 1572864 [0: 0]
+@ 0x7f5000
+  t*: 0: 0 [0: 0]
+
+MAPPED_LIBRARIES:
+55d0c5e2a000-55d0c5e2f000 r-xp 00002000 fd:01 1234 /usr/bin/service
+)";
+
+std::int64_t Scaled(double count, double average_size) {
+  return std::llround(count / (1 - std::exp(-average_size / 524288)));
+}
+
+}  // namespace
+
+TEST(PprofHeapProfile, Parse) {
+  const auto profile = utils::pprof::ParseJemallocHeapProfile(kDump);
+  EXPECT_EQ(profile.sample_period, 524288);
+  ASSERT_EQ(profile.samples.size(), 3);
+
+  EXPECT_EQ(profile.samples[0].stack,
+            (utils::pprof::Stack{0x7f1000, 0x7f2000, 0x7f3000}));
+  EXPECT_EQ(profile.samples[0].objects, Scaled(1, 128));
+  EXPECT_EQ(profile.samples[0].bytes, Scaled(128, 128));
+  // The small allocations are rarely sampled
+  EXPECT_GT(profile.samples[0].objects, 4000);
+
+  EXPECT_EQ(profile.samples[1].stack,
+            (utils::pprof::Stack{0x7f4000, 0x7f3000}));
+  EXPECT_EQ(profile.samples[1].objects, Scaled(2, 786432));
+  EXPECT_EQ(profile.samples[1].bytes, Scaled(1572864, 786432));
+
+  EXPECT_EQ(profile.samples[2].stack, (utils::pprof::Stack{0x7f5000}));
+  EXPECT_EQ(profile.samples[2].objects, 0);
+  EXPECT_EQ(profile.samples[2].bytes, 0);
+}
+
+TEST(PprofHeapProfile, Malformed) {
+  EXPECT_THROW(utils::pprof::ParseJemallocHeapProfile(""), std::runtime_error);
+  EXPECT_THROW(utils::pprof::ParseJemallocHeapProfile("heap_v1/524288\n"),
+               std::runtime_error);
+  EXPECT_THROW(utils::pprof::ParseJemallocHeapProfile(
+                   "heap_v2/524288\n@ 0xzz\n  t*: 1: 2 [0: 0]\n"),
+               std::runtime_error);
+  EXPECT_THROW(utils::pprof::ParseJemallocHeapProfile(
+                   "heap_v2/524288\n@ 0x10\n  t*: 1 [0: 0]\n"),
+               std::runtime_error);
+}
+
+TEST(PprofHeapProfile, Delta) {
+  utils::pprof::HeapProfile base;
+  base.sample_period = 524288;
+  base.samples = {{{1, 2}, 10, 100}, {{3}, 5, 50}};
+
+  utils::pprof::HeapProfile current;
+  current.sample_period = 524288;
+  current.samples = {{{1, 2}, 15, 150}, {{4}, 1, 8}, {{3}, 5, 50}};
+
+  const auto delta = utils::pprof::GetDelta(current, base);
+  EXPECT_EQ(delta.sample_period, 524288);
+  ASSERT_EQ(delta.samples.size(), 2);
+  EXPECT_EQ(delta.samples[0].stack, (utils::pprof::Stack{1, 2}));
+  EXPECT_EQ(delta.samples[0].objects, 5);
+  EXPECT_EQ(delta.samples[0].bytes, 50);
+  EXPECT_EQ(delta.samples[1].stack, (utils::pprof::Stack{4}));
+  EXPECT_EQ(delta.samples[1].objects, 1);
+  EXPECT_EQ(delta.samples[1].bytes, 8);
+
+  const auto reverse = utils::pprof::GetDelta(base, current);
+  ASSERT_EQ(reverse.samples.size(), 2);
+  EXPECT_EQ(reverse.samples[0].objects, -5);
+  EXPECT_EQ(reverse.samples[1].bytes, -8);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,278 @@
+#include <utils/pprof/profile_builder.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <utility>
+
+#include <boost/stacktrace/frame.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <utils/impl/proto_writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+namespace {
+
+// Field numbers of perftools.profiles.Profile and its nested messages
+namespace profile_field {
+constexpr int kSampleType = 1;
+constexpr int kSample = 2;
+constexpr int kMapping = 3;
+constexpr int kLocation = 4;
+constexpr int kFunction = 5;
+constexpr int kStringTable = 6;
+constexpr int kTimeNanos = 9;
+constexpr int kDurationNanos = 10;
+constexpr int kPeriodType = 11;
+constexpr int kPeriod = 12;
+}  // namespace profile_field
+
+namespace value_type_field {
+constexpr int kType = 1;
+constexpr int kUnit = 2;
+}  // namespace value_type_field
+
+namespace sample_field {
+constexpr int kLocationId = 1;
+constexpr int kValue = 2;
+}  // namespace sample_field
+
+namespace mapping_field {
+constexpr int kId = 1;
+constexpr int kMemoryStart = 2;
+constexpr int kMemoryLimit = 3;
+constexpr int kFileOffset = 4;
+constexpr int kFilename = 5;
+}  // namespace mapping_field
+
+namespace location_field {
+constexpr int kId = 1;
+constexpr int kMappingId = 2;
+constexpr int kAddress = 3;
+constexpr int kLine = 4;
+}  // namespace location_field
+
+namespace line_field {
+constexpr int kFunctionId = 1;
+constexpr int kLine = 2;
+}  // namespace line_field
+
+namespace function_field {
+constexpr int kId = 1;
+constexpr int kName = 2;
+constexpr int kSystemName = 3;
+constexpr int kFilename = 4;
+}  // namespace function_field
+
+struct Mapping final {
+  std::uintptr_t start{0};
+  std::uintptr_t limit{0};
+  std::uint64_t offset{0};
+  std::string filename;
+};
+
+// The executable mappings of the current process, sorted by the address
+std::vector<Mapping> ReadExecutableMappings() {
+  std::vector<Mapping> result;
+  std::ifstream maps{"/proc/self/maps"};
+  std::string line;
+  while (std::getline(maps, line)) {
+    // 55d0c5e2a000-55d0c5e2f000 r-xp 00002000 fd:01 1234 /usr/bin/service
+    std::istringstream fields{line};
+    std::string range;
+    std::string permissions;
+    std::string offset;
+    std::string device;
+    std::string inode;
+    std::string filename;
+    fields >> range >> permissions >> offset >> device >> inode;
+    std::getline(fields >> std::ws, filename);
+    if (permissions.size() < 3 || permissions[2] != 'x') continue;
+
+    const auto dash = range.find('-');
+    if (dash == std::string::npos) continue;
+    try {
+      result.push_back({std::stoull(range.substr(0, dash), nullptr, 16),
+                        std::stoull(range.substr(dash + 1), nullptr, 16),
+                        std::stoull(offset, nullptr, 16), std::move(filename)});
+    } catch (const std::exception&) {
+      // Skip the malformed line
+    }
+  }
+  return result;
+}
+
+class StringTable final {
+ public:
+  StringTable() { GetIndex({}); }
+
+  std::int64_t GetIndex(const std::string& value) {
+    const auto [it, inserted] = indices_.emplace(value, strings_.size());
+    if (inserted) strings_.push_back(value);
+    return static_cast<std::int64_t>(it->second);
+  }
+
+  const std::vector<std::string>& GetStrings() const { return strings_; }
+
+ private:
+  std::unordered_map<std::string, std::size_t> indices_;
+  std::vector<std::string> strings_;
+};
+
+}  // namespace
+
+Frame SymbolizeAddress(std::uintptr_t address) {
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  const boost::stacktrace::frame frame{reinterpret_cast<const void*>(address)};
+  return {frame.name(), frame.source_file(),
+          static_cast<std::int64_t>(frame.source_line())};
+}
+
+ProfileBuilder::ProfileBuilder(std::vector<ValueType> sample_types,
+                               ValueType period_type, std::int64_t period,
+                               Symbolizer symbolizer)
+    : sample_types_(std::move(sample_types)),
+      period_type_(period_type),
+      period_(period),
+      symbolizer_(std::move(symbolizer)) {
+  UASSERT(!sample_types_.empty());
+  UASSERT(symbolizer_);
+}
+
+void ProfileBuilder::SetTime(std::chrono::system_clock::time_point start,
+                             std::chrono::nanoseconds duration) {
+  start_ = start;
+  duration_ = duration;
+}
+
+void ProfileBuilder::AddSample(utils::span<const std::uintptr_t> stack,
+                               utils::span<const std::int64_t> values) {
+  UASSERT(values.size() == sample_types_.size());
+  Sample sample;
+  sample.location_ids.reserve(stack.size());
+  for (const auto address : stack) {
+    sample.location_ids.push_back(GetLocationId(address));
+  }
+  sample.values.assign(values.begin(), values.end());
+  samples_.push_back(std::move(sample));
+}
+
+std::uint64_t ProfileBuilder::GetLocationId(std::uintptr_t address) {
+  const auto [it, inserted] =
+      location_ids_.emplace(address, addresses_.size() + 1);
+  if (inserted) addresses_.push_back(address);
+  return it->second;
+}
+
+std::string ProfileBuilder::Serialize() const {
+  using utils::impl::ProtoWriter;
+  StringTable strings;
+  std::string result;
+  ProtoWriter writer{result};
+
+  const auto write_value_type = [&strings](ProtoWriter& nested,
+                                           const ValueType& value) {
+    nested.Varint(value_type_field::kType,
+                  strings.GetIndex(std::string{value.type}));
+    nested.Varint(value_type_field::kUnit,
+                  strings.GetIndex(std::string{value.unit}));
+  };
+
+  for (const auto& sample_type : sample_types_) {
+    writer.Message(profile_field::kSampleType, [&](ProtoWriter& nested) {
+      write_value_type(nested, sample_type);
+    });
+  }
+
+  for (const auto& sample : samples_) {
+    writer.Message(profile_field::kSample, [&](ProtoWriter& nested) {
+      nested.PackedVarint(sample_field::kLocationId, sample.location_ids);
+      nested.PackedVarint(sample_field::kValue, sample.values);
+    });
+  }
+
+  const auto mappings = ReadExecutableMappings();
+  for (std::size_t i = 0; i < mappings.size(); ++i) {
+    const auto& mapping = mappings[i];
+    writer.Message(profile_field::kMapping, [&](ProtoWriter& nested) {
+      nested.Varint(mapping_field::kId, i + 1);
+      nested.Varint(mapping_field::kMemoryStart, mapping.start);
+      nested.Varint(mapping_field::kMemoryLimit, mapping.limit);
+      nested.Varint(mapping_field::kFileOffset, mapping.offset);
+      nested.Varint(mapping_field::kFilename,
+                    strings.GetIndex(mapping.filename));
+    });
+  }
+
+  std::map<std::pair<std::string, std::string>, std::uint64_t> function_ids;
+  for (std::size_t i = 0; i < addresses_.size(); ++i) {
+    const auto address = addresses_[i];
+    const auto mapping_it = std::upper_bound(
+        mappings.begin(), mappings.end(), address,
+        [](std::uintptr_t lhs, const Mapping& rhs) { return lhs < rhs.start; });
+    std::uint64_t mapping_id = 0;
+    if (mapping_it != mappings.begin() &&
+        address < std::prev(mapping_it)->limit) {
+      mapping_id = mapping_it - mappings.begin();
+    }
+
+    // The return address points past the call instruction
+    const auto frame = symbolizer_(address - 1);
+    std::uint64_t function_id = 0;
+    if (!frame.function.empty()) {
+      const auto [it, inserted] = function_ids.emplace(
+          std::make_pair(frame.function, frame.filename),
+          function_ids.size() + 1);
+      function_id = it->second;
+      if (inserted) {
+        writer.Message(profile_field::kFunction, [&](ProtoWriter& nested) {
+          const auto name = strings.GetIndex(frame.function);
+          nested.Varint(function_field::kId, function_id);
+          nested.Varint(function_field::kName, name);
+          nested.Varint(function_field::kSystemName, name);
+          nested.Varint(function_field::kFilename,
+                        strings.GetIndex(frame.filename));
+        });
+      }
+    }
+
+    writer.Message(profile_field::kLocation, [&](ProtoWriter& nested) {
+      nested.Varint(location_field::kId, i + 1);
+      if (mapping_id != 0) {
+        nested.Varint(location_field::kMappingId, mapping_id);
+      }
+      nested.Varint(location_field::kAddress, address);
+      if (function_id != 0) {
+        nested.Message(location_field::kLine, [&](ProtoWriter& line) {
+          line.Varint(line_field::kFunctionId, function_id);
+          line.Varint(line_field::kLine, frame.line);
+        });
+      }
+    });
+  }
+
+  writer.Varint(profile_field::kTimeNanos,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    start_.time_since_epoch())
+                    .count());
+  writer.Varint(profile_field::kDurationNanos, duration_.count());
+  writer.Message(profile_field::kPeriodType, [&](ProtoWriter& nested) {
+    write_value_type(nested, period_type_);
+  });
+  writer.Varint(profile_field::kPeriod, period_);
+
+  // The indices are known only after all the other fields
+  for (const auto& string : strings.GetStrings()) {
+    writer.Bytes(profile_field::kStringTable, string);
+  }
+  return result;
+}
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::pprof {
+
+/// The return addresses of a stack, the innermost frame first
+using Stack = std::vector<std::uintptr_t>;
+
+/// Thrown if another profile of the same kind is being collected
+class ProfilerBusyError final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+struct ValueType final {
+  std::string_view type;
+  std::string_view unit;
+};
+
+struct Frame final {
+  std::string function;
+  std::string filename;
+  std::int64_t line{0};
+};
+
+/// Resolves the address of a call instruction into a frame, returns an empty
+/// function name for an unknown address
+using Symbolizer = std::function<Frame(std::uintptr_t)>;
+
+/// Resolves the addresses with boost::stacktrace
+Frame SymbolizeAddress(std::uintptr_t address);
+
+/// @brief Builds a profile in the pprof format, the protobuf message
+/// `perftools.profiles.Profile` of
+/// https://github.com/google/pprof/blob/main/proto/profile.proto
+///
+/// The addresses are both symbolized and attributed to the executable mappings
+/// of the current process, so the profile is readable as is and could also be
+/// re-symbolized by pprof with the binaries with the debug info.
+class ProfileBuilder final {
+ public:
+  ProfileBuilder(std::vector<ValueType> sample_types, ValueType period_type,
+                 std::int64_t period, Symbolizer symbolizer = SymbolizeAddress);
+
+  void SetTime(std::chrono::system_clock::time_point start,
+               std::chrono::nanoseconds duration);
+
+  /// Adds the sample, `values` correspond to the `sample_types`
+  void AddSample(utils::span<const std::uintptr_t> stack,
+                 utils::span<const std::int64_t> values);
+
+  /// Returns the serialized uncompressed profile
+  std::string Serialize() const;
+
+ private:
+  struct Sample final {
+    std::vector<std::uint64_t> location_ids;
+    std::vector<std::int64_t> values;
+  };
+
+  std::uint64_t GetLocationId(std::uintptr_t address);
+
+  const std::vector<ValueType> sample_types_;
+  const ValueType period_type_;
+  const std::int64_t period_;
+  const Symbolizer symbolizer_;
+
+  std::chrono::system_clock::time_point start_;
+  std::chrono::nanoseconds duration_{0};
+  std::vector<Sample> samples_;
+  // Location ids are the indices of the addresses plus one
+  std::unordered_map<std::uintptr_t, std::uint64_t> location_ids_;
+  std::vector<std::uintptr_t> addresses_;
+};
+
+}  // namespace utils::pprof
+
+USERVER_NAMESPACE_END
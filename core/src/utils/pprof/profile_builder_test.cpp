@@ -0,0 +1,142 @@
+#include <utils/pprof/profile_builder.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Field final {
+  int number{0};
+  std::uint64_t varint{0};
+  std::string bytes;
+};
+
+std::uint64_t ReadVarint(std::string_view& data) {
+  std::uint64_t value = 0;
+  for (int shift = 0; !data.empty(); shift += 7) {
+    const auto byte = static_cast<std::uint8_t>(data.front());
+    data.remove_prefix(1);
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) break;
+  }
+  return value;
+}
+
+// Only the varint and the length-delimited fields are used by pprof
+std::vector<Field> Parse(std::string_view data) {
+  std::vector<Field> result;
+  while (!data.empty()) {
+    const auto tag = ReadVarint(data);
+    Field field;
+    field.number = static_cast<int>(tag >> 3);
+    if ((tag & 7) == 0) {
+      field.varint = ReadVarint(data);
+    } else {
+      EXPECT_EQ(tag & 7, 2);
+      const auto size = ReadVarint(data);
+      field.bytes = std::string{data.substr(0, size)};
+      data.remove_prefix(size);
+    }
+    result.push_back(std::move(field));
+  }
+  return result;
+}
+
+std::vector<std::uint64_t> ParsePacked(std::string_view data) {
+  std::vector<std::uint64_t> result;
+  while (!data.empty()) result.push_back(ReadVarint(data));
+  return result;
+}
+
+std::multimap<int, Field> ParseMessage(std::string_view data) {
+  std::multimap<int, Field> result;
+  for (auto& field : Parse(data)) result.emplace(field.number, field);
+  return result;
+}
+
+utils::pprof::Frame FakeSymbolizer(std::uintptr_t address) {
+  if (address == 0x1000 - 1) return {"Foo()", "foo.cpp", 10};
+  if (address == 0x2000 - 1) return {"Bar()", "bar.cpp", 20};
+  return {};
+}
+
+}  // namespace
+
+TEST(PprofProfileBuilder, Serialize) {
+  utils::pprof::ProfileBuilder builder{
+      {{"samples", "count"}, {"cpu", "nanoseconds"}},
+      {"cpu", "nanoseconds"},
+      10'000'000,
+      &FakeSymbolizer};
+  builder.SetTime(
+      std::chrono::system_clock::time_point{std::chrono::seconds{1}},
+      std::chrono::seconds{2});
+
+  const std::vector<std::uintptr_t> stack1{0x1000, 0x2000};
+  const std::vector<std::int64_t> values1{3, 30'000'000};
+  builder.AddSample(stack1, values1);
+
+  const std::vector<std::uintptr_t> stack2{0x3000, 0x2000};
+  const std::vector<std::int64_t> values2{-1, -10'000'000};
+  builder.AddSample(stack2, values2);
+
+  const auto profile = ParseMessage(builder.Serialize());
+  EXPECT_EQ(profile.count(1), 2);  // sample_type
+  EXPECT_EQ(profile.count(2), 2);  // sample
+  EXPECT_EQ(profile.count(4), 3);  // location
+  EXPECT_EQ(profile.count(5), 2);  // function
+  EXPECT_EQ(profile.find(9)->second.varint, 1'000'000'000);
+  EXPECT_EQ(profile.find(10)->second.varint, 2'000'000'000);
+  EXPECT_EQ(profile.find(12)->second.varint, 10'000'000);
+
+  std::vector<std::string> strings;
+  const auto string_range = profile.equal_range(6);
+  for (auto it = string_range.first; it != string_range.second; ++it) {
+    strings.push_back(it->second.bytes);
+  }
+  ASSERT_FALSE(strings.empty());
+  EXPECT_EQ(strings[0], "");
+  EXPECT_THAT(strings, testing::IsSupersetOf({"samples", "count", "cpu",
+                                              "nanoseconds", "Foo()", "foo.cpp",
+                                              "Bar()", "bar.cpp"}));
+
+  auto sample_it = profile.find(2);
+  auto sample = ParseMessage(sample_it->second.bytes);
+  EXPECT_EQ(ParsePacked(sample.find(1)->second.bytes),
+            (std::vector<std::uint64_t>{1, 2}));
+  EXPECT_EQ(ParsePacked(sample.find(2)->second.bytes),
+            (std::vector<std::uint64_t>{3, 30'000'000}));
+
+  sample = ParseMessage(std::next(sample_it)->second.bytes);
+  EXPECT_EQ(ParsePacked(sample.find(1)->second.bytes),
+            (std::vector<std::uint64_t>{3, 2}));
+  const auto values = ParsePacked(sample.find(2)->second.bytes);
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(static_cast<std::int64_t>(values[0]), -1);
+  EXPECT_EQ(static_cast<std::int64_t>(values[1]), -10'000'000);
+
+  // The unknown address has no line
+  const auto location_range = profile.equal_range(4);
+  std::vector<std::size_t> line_counts;
+  for (auto it = location_range.first; it != location_range.second; ++it) {
+    line_counts.push_back(ParseMessage(it->second.bytes).count(4));
+  }
+  EXPECT_EQ(line_counts, (std::vector<std::size_t>{1, 1, 0}));
+}
+
+TEST(PprofProfileBuilder, Empty) {
+  const utils::pprof::ProfileBuilder builder{
+      {{"contentions", "count"}}, {"contentions", "count"}, 1};
+  const auto profile = ParseMessage(builder.Serialize());
+  EXPECT_EQ(profile.count(1), 1);
+  EXPECT_EQ(profile.count(2), 0);
+  EXPECT_EQ(profile.count(4), 0);
+  EXPECT_EQ(profile.find(12)->second.varint, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <userver/utils/statistics/changed_metrics_filter.hpp>
+
+#include <cstring>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/utils/overloaded.hpp>
+#include <utils/statistics/impl/metric_key.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+std::uint64_t GetFingerprint(const MetricValue& value) noexcept {
+  return value.Visit(utils::Overloaded{
+      [](std::int64_t x) { return static_cast<std::uint64_t>(x); },
+      [](double x) {
+        std::uint64_t bits = 0;
+        static_assert(sizeof(bits) == sizeof(x));
+        std::memcpy(&bits, &x, sizeof(bits));
+        return bits;
+      },
+      [](Rate x) { return std::uint64_t{x.value}; },
+      [](HistogramView x) {
+        std::size_t seed = x.GetBucketCount();
+        for (std::size_t i = 0; i < x.GetBucketCount(); ++i) {
+          boost::hash_combine(seed, x.GetUpperBoundAt(i));
+          boost::hash_combine(seed, x.GetValueAt(i));
+        }
+        boost::hash_combine(seed, x.GetValueAtInf());
+        return std::uint64_t{seed};
+      },
+  });
+}
+
+}  // namespace
+
+class ChangedMetricsFilter::Builder final : public BaseFormatBuilder {
+ public:
+  Builder(ChangedMetricsFilter& filter, BaseFormatBuilder& out)
+      : filter_(filter), out_(out) {}
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override {
+    impl::AssignMetricKey(key_, path, labels);
+    const auto fingerprint = GetFingerprint(value);
+    auto [it, is_new] = filter_.previous_values_.try_emplace(key_);
+    auto& previous = it->second;
+    previous.visit = filter_.visit_;
+    if (!is_new && previous.fingerprint == fingerprint) return;
+
+    previous.fingerprint = fingerprint;
+    out_.HandleMetric(path, labels, value);
+    ++passed_count_;
+  }
+
+  std::size_t GetPassedCount() const noexcept { return passed_count_; }
+
+ private:
+  ChangedMetricsFilter& filter_;
+  BaseFormatBuilder& out_;
+  std::string key_;
+  std::size_t passed_count_{0};
+};
+
+ChangedMetricsFilter::ChangedMetricsFilter() = default;
+
+ChangedMetricsFilter::ChangedMetricsFilter(ChangedMetricsFilter&&) noexcept =
+    default;
+
+ChangedMetricsFilter& ChangedMetricsFilter::operator=(
+    ChangedMetricsFilter&&) noexcept = default;
+
+ChangedMetricsFilter::~ChangedMetricsFilter() = default;
+
+std::size_t ChangedMetricsFilter::VisitChangedMetrics(
+    const Storage& storage, BaseFormatBuilder& out, const Request& request) {
+  ++visit_;
+  Builder builder{*this, out};
+  storage.VisitMetrics(builder, request);
+
+  for (auto it = previous_values_.begin(); it != previous_values_.end();) {
+    if (it->second.visit != visit_) {
+      it = previous_values_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return builder.GetPassedCount();
+}
+
+void ChangedMetricsFilter::Reset() noexcept { previous_values_.clear(); }
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#include <userver/utils/statistics/changed_metrics_filter.hpp>
+
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class TestBuilder final : public utils::statistics::BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue& value) override {
+    std::string metric{path};
+    for (const auto& label : labels) {
+      metric += fmt::format(";{}={}", label.Name(), label.Value());
+    }
+    metrics_.push_back(fmt::format("{}:{}", metric, value));
+  }
+
+  std::vector<std::string> Release() { return std::exchange(metrics_, {}); }
+
+ private:
+  std::vector<std::string> metrics_;
+};
+
+using Metrics = std::vector<std::string>;
+
+}  // namespace
+
+UTEST(ChangedMetricsFilter, Basic) {
+  utils::statistics::Storage storage;
+  int a = 1;
+  int b = 2;
+  auto holder = storage.RegisterWriter("test", [&](auto& writer) {
+    writer["a"] = a;
+    writer["b"].ValueWithLabels(b, {"label", "x"});
+    writer["b"].ValueWithLabels(b, {"label", "y"});
+  });
+
+  utils::statistics::ChangedMetricsFilter filter;
+  TestBuilder builder;
+
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 3);
+  EXPECT_EQ(builder.Release(),
+            (Metrics{"test.a:1", "test.b;label=x:2", "test.b;label=y:2"}));
+
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 0);
+  EXPECT_EQ(builder.Release(), Metrics{});
+
+  b = 3;
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 2);
+  EXPECT_EQ(builder.Release(),
+            (Metrics{"test.b;label=x:3", "test.b;label=y:3"}));
+
+  filter.Reset();
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 3);
+  EXPECT_EQ(builder.Release().size(), 3);
+}
+
+UTEST(ChangedMetricsFilter, DisappearedMetric) {
+  utils::statistics::Storage storage;
+  bool has_metric = true;
+  auto holder = storage.RegisterWriter("test", [&](auto& writer) {
+    if (has_metric) writer["a"] = 1;
+  });
+
+  utils::statistics::ChangedMetricsFilter filter;
+  TestBuilder builder;
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 1);
+
+  has_metric = false;
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 0);
+
+  has_metric = true;
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 1);
+  EXPECT_EQ(builder.Release(), (Metrics{"test.a:1", "test.a:1"}));
+}
+
+UTEST(ChangedMetricsFilter, Histogram) {
+  utils::statistics::Storage storage;
+  utils::statistics::Histogram histogram{std::vector<double>{1, 10}};
+  auto holder = storage.RegisterWriter(
+      "test", [&](auto& writer) { writer = histogram; });
+
+  utils::statistics::ChangedMetricsFilter filter;
+  TestBuilder builder;
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 1);
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 0);
+
+  histogram.Account(5);
+  EXPECT_EQ(filter.VisitChangedMetrics(storage, builder), 1);
+  EXPECT_EQ(builder.Release(), (Metrics{"test:[1]=0,[10]=0,[inf]=0",
+                                        "test:[1]=0,[10]=1,[inf]=0"}));
+}
+
+USERVER_NAMESPACE_END
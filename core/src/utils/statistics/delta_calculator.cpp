@@ -0,0 +1,147 @@
+#include <utils/statistics/delta_calculator.hpp>
+
+#include <memory>
+
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <utils/statistics/impl/metric_key.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+void LoadCounters(HistogramView histogram,
+                  std::vector<std::uint64_t>& counters) {
+  counters.resize(histogram.GetBucketCount() + 1);
+  counters[0] = histogram.GetValueAtInf();
+  for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+    counters[i + 1] = histogram.GetValueAt(i);
+  }
+}
+
+bool IsReset(const std::vector<std::uint64_t>& previous,
+             const std::vector<std::uint64_t>& current) noexcept {
+  if (previous.size() != current.size()) return true;
+  for (std::size_t i = 0; i < current.size(); ++i) {
+    if (current[i] < previous[i]) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+class DeltaCalculator::Builder final : public BaseFormatBuilder {
+ public:
+  Builder(DeltaCalculator& calculator, BaseFormatBuilder& out)
+      : calculator_(calculator), out_(out) {}
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override {
+    value.Visit(utils::Overloaded{
+        [&](Rate rate) { HandleRate(path, labels, rate); },
+        [&](HistogramView histogram) {
+          HandleHistogram(path, labels, histogram);
+        },
+        [&](auto) { Pass(path, labels, value); },
+    });
+  }
+
+  std::size_t GetPassedCount() const noexcept { return passed_count_; }
+
+ private:
+  PreviousValue& FindPrevious(std::string_view path, LabelsSpan labels,
+                              bool& is_new) {
+    AssignMetricKey(key_, path, labels);
+    auto [it, inserted] = calculator_.previous_values_.try_emplace(key_);
+    it->second.visit = calculator_.visit_;
+    is_new = inserted;
+    return it->second;
+  }
+
+  void HandleRate(std::string_view path, LabelsSpan labels, Rate rate) {
+    bool is_new = false;
+    auto& previous = FindPrevious(path, labels, is_new);
+    if (is_new) previous.counters.assign(1, 0);
+
+    const auto previous_value = previous.counters[0];
+    previous.counters[0] = rate.value;
+    const Rate delta{rate.value >= previous_value
+                         ? rate.value - previous_value
+                         : rate.value};
+    if (!delta) return;
+    Pass(path, labels, MetricValue{MetricValue::RawType{delta}});
+  }
+
+  void HandleHistogram(std::string_view path, LabelsSpan labels,
+                       HistogramView histogram) {
+    bool is_new = false;
+    auto& previous = FindPrevious(path, labels, is_new);
+    LoadCounters(histogram, counters_);
+    if (IsReset(previous.counters, counters_)) {
+      previous.counters.assign(counters_.size(), 0);
+    }
+
+    std::uint64_t total_delta = 0;
+    for (std::size_t i = 0; i < counters_.size(); ++i) {
+      const auto delta = counters_[i] - previous.counters[i];
+      previous.counters[i] = counters_[i];
+      counters_[i] = delta;
+      total_delta += delta;
+    }
+    if (total_delta == 0) return;
+
+    // Same layout, the 0th bucket holds the size and the "infinity" counter
+    const auto buckets =
+        std::make_unique<histogram::Bucket[]>(counters_.size());
+    histogram::CopyBoundsAndValues(buckets.get(), histogram);
+    for (std::size_t i = 0; i < counters_.size(); ++i) {
+      buckets[i].counter.store(counters_[i], std::memory_order_relaxed);
+    }
+    Pass(path, labels,
+         MetricValue{MetricValue::RawType{histogram::MakeView(buckets.get())}});
+  }
+
+  void Pass(std::string_view path, LabelsSpan labels,
+            const MetricValue& value) {
+    out_.HandleMetric(path, labels, value);
+    ++passed_count_;
+  }
+
+  DeltaCalculator& calculator_;
+  BaseFormatBuilder& out_;
+  std::string key_;
+  std::vector<std::uint64_t> counters_;
+  std::size_t passed_count_{0};
+};
+
+DeltaCalculator::DeltaCalculator() = default;
+
+DeltaCalculator::DeltaCalculator(DeltaCalculator&&) noexcept = default;
+
+DeltaCalculator& DeltaCalculator::operator=(DeltaCalculator&&) noexcept =
+    default;
+
+DeltaCalculator::~DeltaCalculator() = default;
+
+std::size_t DeltaCalculator::VisitDeltas(const Storage& storage,
+                                         BaseFormatBuilder& out,
+                                         const Request& request) {
+  ++visit_;
+  Builder builder{*this, out};
+  storage.VisitMetrics(builder, request);
+
+  for (auto it = previous_values_.begin(); it != previous_values_.end();) {
+    if (it->second.visit != visit_) {
+      it = previous_values_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return builder.GetPassedCount();
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+/// Converts the cumulative metrics of the Storage into the deltas since the
+/// previous visit, for the exporters with the delta temporality.
+///
+/// The utils::statistics::Rate and utils::statistics::HistogramView values are
+/// replaced with their increments, the zero increments are skipped. A decrease
+/// of a counter is treated as a reset, and the whole new value is the delta.
+/// The gauges (integer and floating point values) are passed as is.
+///
+/// Not thread-safe, the visits must not run concurrently.
+class DeltaCalculator final {
+ public:
+  DeltaCalculator();
+  DeltaCalculator(DeltaCalculator&&) noexcept;
+  DeltaCalculator& operator=(DeltaCalculator&&) noexcept;
+  ~DeltaCalculator();
+
+  /// Visits the metrics of the `storage`, calls `out.HandleMetric` with the
+  /// deltas. Returns the number of the passed metrics.
+  std::size_t VisitDeltas(const Storage& storage, BaseFormatBuilder& out,
+                          const Request& request = {});
+
+ private:
+  struct PreviousValue final {
+    // The rate value, or the "infinity" bucket and the buckets of a histogram
+    std::vector<std::uint64_t> counters;
+    std::uint64_t visit{0};
+  };
+
+  class Builder;
+
+  std::unordered_map<std::string, PreviousValue> previous_values_;
+  std::uint64_t visit_{0};
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
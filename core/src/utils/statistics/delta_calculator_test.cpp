@@ -0,0 +1,98 @@
+#include <utils/statistics/delta_calculator.hpp>
+
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class TestBuilder final : public utils::statistics::BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue& value) override {
+    std::string metric{path};
+    for (const auto& label : labels) {
+      metric += fmt::format(";{}={}", label.Name(), label.Value());
+    }
+    metrics_.push_back(fmt::format("{}:{}", metric, value));
+  }
+
+  std::vector<std::string> Release() { return std::exchange(metrics_, {}); }
+
+ private:
+  std::vector<std::string> metrics_;
+};
+
+using Metrics = std::vector<std::string>;
+
+}  // namespace
+
+UTEST(DeltaCalculator, Rates) {
+  utils::statistics::Storage storage;
+  utils::statistics::RateCounter requests;
+  int connections = 5;
+  auto holder = storage.RegisterWriter("test", [&](auto& writer) {
+    writer["requests"].ValueWithLabels(requests, {"handler", "ping"});
+    writer["connections"] = connections;
+  });
+
+  utils::statistics::impl::DeltaCalculator calculator;
+  TestBuilder builder;
+
+  requests.Add(utils::statistics::Rate{10});
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 2);
+  EXPECT_EQ(builder.Release(),
+            (Metrics{"test.requests;handler=ping:10", "test.connections:5"}));
+
+  // Unchanged counters are skipped, gauges are passed as is
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 1);
+  EXPECT_EQ(builder.Release(), Metrics{"test.connections:5"});
+
+  requests.Add(utils::statistics::Rate{3});
+  connections = 4;
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 2);
+  EXPECT_EQ(builder.Release(), (Metrics{"test.requests;handler=ping:3",
+                                        "test.connections:4"}));
+
+  // A decrease means the counter was reset
+  requests.Store(utils::statistics::Rate{2});
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 2);
+  EXPECT_EQ(builder.Release(), (Metrics{"test.requests;handler=ping:2",
+                                        "test.connections:4"}));
+}
+
+UTEST(DeltaCalculator, Histogram) {
+  utils::statistics::Storage storage;
+  utils::statistics::Histogram histogram{std::vector<double>{1, 10}};
+  auto holder = storage.RegisterWriter(
+      "test", [&](auto& writer) { writer = histogram; });
+
+  utils::statistics::impl::DeltaCalculator calculator;
+  TestBuilder builder;
+
+  histogram.Account(5);
+  histogram.Account(100);
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 1);
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 0);
+
+  histogram.Account(0.5);
+  histogram.Account(5);
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 1);
+
+  ResetMetric(histogram);
+  histogram.Account(100);
+  EXPECT_EQ(calculator.VisitDeltas(storage, builder), 1);
+
+  EXPECT_EQ(builder.Release(), (Metrics{"test:[1]=0,[10]=1,[inf]=1",
+                                        "test:[1]=1,[10]=1,[inf]=0",
+                                        "test:[1]=0,[10]=0,[inf]=1"}));
+}
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,8 @@
 
 #include <userver/utils/algo.hpp>
 #include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+#include <userver/utils/statistics/percentile.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,4 +37,100 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+namespace {
+
+// 47 buckets up to 8191
+using LogLinearHistogram = utils::statistics::LogLinearHistogram<2, 13>;
+constexpr double kMaxValue = 8192;
+
+std::vector<double> MakeRandomValues() {
+  auto values = std::vector<double>(1024);
+  for (auto& value : values) {
+    value = utils::RandRange(0.0, kMaxValue);
+  }
+  return Launder(std::move(values));
+}
+
+std::vector<double> MakeLogLinearBounds() {
+  std::vector<double> bounds;
+  for (std::size_t i = 1; i <= LogLinearHistogram::kBucketCount; ++i) {
+    bounds.push_back(
+        utils::statistics::impl::log_linear_histogram::GetUpperBound(i, 2));
+  }
+  return bounds;
+}
+
+}  // namespace
+
+// Compares utils::statistics::Histogram with the same bounds,
+// LogLinearHistogram and Percentile, under contention from multiple threads
+// accounting into the same metric
+void HistogramAccountShared(benchmark::State& state) {
+  static utils::statistics::Histogram histogram{MakeLogLinearBounds()};
+  const auto values = MakeRandomValues();
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+BENCHMARK(HistogramAccountShared)->ThreadRange(1, 8);
+
+void LogLinearHistogramAccountShared(benchmark::State& state) {
+  static LogLinearHistogram histogram;
+  const auto values = MakeRandomValues();
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+BENCHMARK(LogLinearHistogramAccountShared)->ThreadRange(1, 8);
+
+void PercentileAccountShared(benchmark::State& state) {
+  static utils::statistics::Percentile<static_cast<std::size_t>(kMaxValue)>
+      percentile;
+  const auto values = MakeRandomValues();
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      percentile.Account(value);
+    }
+  }
+}
+BENCHMARK(PercentileAccountShared)->ThreadRange(1, 8);
+
+// Reading 1 minute of 5 second epochs, as utils::statistics::RecentPeriod does
+void LogLinearHistogramAggregate(benchmark::State& state) {
+  std::vector<LogLinearHistogram> epochs(12);
+  for (auto& epoch : epochs) {
+    for (const auto value : MakeRandomValues()) epoch.Account(value);
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    LogLinearHistogram result;
+    for (const auto& epoch : epochs) result.Add(epoch);
+    benchmark::DoNotOptimize(result.GetPercentile(99));
+  }
+}
+BENCHMARK(LogLinearHistogramAggregate);
+
+void PercentileAggregate(benchmark::State& state) {
+  using Percentile =
+      utils::statistics::Percentile<static_cast<std::size_t>(kMaxValue)>;
+  std::vector<Percentile> epochs(12);
+  for (auto& epoch : epochs) {
+    for (const auto value : MakeRandomValues()) epoch.Account(value);
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    Percentile result;
+    for (const auto& epoch : epochs) result.Add(epoch);
+    benchmark::DoNotOptimize(result.GetPercentile(99));
+  }
+}
+BENCHMARK(PercentileAggregate);
+
 USERVER_NAMESPACE_END
@@ -254,18 +254,28 @@ UTEST_F(StatisticsHistogramFormat, PrettyFormat) {
             "test:\tHIST_RATE\t[1.5]=1,[5]=1,[42]=5,[60]=0,[inf]=1\n");
 }
 
-// TODO support HistogramView in Prometheus metrics
-UTEST_F_DEATH(StatisticsHistogramFormatDeathTest, Prometheus) {
-  EXPECT_DEBUG_DEATH(
-      EXPECT_EQ(utils::statistics::ToPrometheusFormat(GetStorage()), ""),
-      "not supported");
+UTEST_F(StatisticsHistogramFormat, Prometheus) {
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(GetStorage()),
+            R"(# TYPE test histogram
+test_bucket{le="1.5"} 1
+test_bucket{le="5"} 2
+test_bucket{le="42"} 7
+test_bucket{le="60"} 7
+test_bucket{le="+Inf"} 8
+test_count{} 8
+)");
 }
 
-// TODO support HistogramView in PrometheusUntyped metrics
-UTEST_F_DEATH(StatisticsHistogramFormatDeathTest, PrometheusUntyped) {
-  EXPECT_DEBUG_DEATH(
-      EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(GetStorage()), ""),
-      "not supported");
+UTEST_F(StatisticsHistogramFormat, PrometheusUntyped) {
+  EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(GetStorage()),
+            R"(# TYPE test histogram
+test_bucket{le="1.5"} 1
+test_bucket{le="5"} 2
+test_bucket{le="42"} 7
+test_bucket{le="60"} 7
+test_bucket{le="+Inf"} 8
+test_count{} 8
+)");
 }
 
 // TODO support HistogramView in Graphite metrics
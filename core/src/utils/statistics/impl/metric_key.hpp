@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <userver/utils/statistics/labels.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+// Identifies a series across the visits of a Storage, reuses the buffer
+inline void AssignMetricKey(std::string& key, std::string_view path,
+                            LabelsSpan labels) {
+  key.assign(path);
+  for (const auto& label : labels) {
+    key.push_back('\0');
+    key.append(label.Name());
+    key.push_back('\0');
+    key.append(label.Value());
+  }
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
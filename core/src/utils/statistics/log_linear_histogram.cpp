@@ -0,0 +1,56 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <compiler/tls.hpp>
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl::log_linear_histogram {
+
+namespace {
+
+constexpr std::size_t kNoShard = -1;
+
+std::atomic<std::size_t> next_shard{0};
+
+thread_local USERVER_IMPL_CONSTINIT std::size_t current_shard = kNoShard;
+
+}  // namespace
+
+USERVER_PREVENT_TLS_CACHING std::size_t GetCurrentShard() noexcept {
+  if (current_shard == kNoShard) {
+    // The threads are spread evenly among the shards in the order of their
+    // first Account
+    current_shard =
+        next_shard.fetch_add(1, std::memory_order_relaxed) % kShardCount;
+  }
+  return current_shard;
+}
+
+void DumpMetric(Writer& writer, std::size_t precision_bits,
+                utils::span<const std::uint64_t> counters) {
+  UASSERT(!counters.empty());
+  std::vector<double> upper_bounds(counters.size() - 1);
+  for (std::size_t i = 0; i < upper_bounds.size(); ++i) {
+    upper_bounds[i] = GetUpperBound(i + 1, precision_bits);
+  }
+
+  // Same layout, the 0th bucket is the "infinity" one
+  const auto buckets = std::make_unique<histogram::Bucket[]>(counters.size());
+  histogram::CopyBounds(buckets.get(), upper_bounds);
+  for (std::size_t i = 0; i < counters.size(); ++i) {
+    buckets[i].counter.store(counters[i], std::memory_order_relaxed);
+  }
+  writer = histogram::MakeView(buckets.get());
+}
+
+}  // namespace utils::statistics::impl::log_linear_histogram
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,146 @@
+#include <userver/utils/statistics/log_linear_histogram.hpp>
+
+#include <chrono>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/mock_now.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Buckets: [1], [2], [3], [5], [7], [inf]
+using SmallHistogram = utils::statistics::LogLinearHistogram<1, 3>;
+
+static_assert(SmallHistogram::kBucketCount == 5);
+static_assert(utils::statistics::LogLinearHistogram<2, 13>::kBucketCount ==
+              47);
+static_assert(utils::statistics::kHasWriterSupport<SmallHistogram>);
+
+void AccountSome(SmallHistogram& histogram) {
+  histogram.Account(-1);
+  histogram.Account(0.5);
+  histogram.Account(2);
+  histogram.Account(2.1);
+  histogram.Account(4);
+  histogram.Account(7);
+  histogram.Account(8);
+  histogram.Account(100);
+}
+
+std::string ToString(const SmallHistogram& histogram) {
+  utils::statistics::Storage storage;
+  auto statistics_holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+  const utils::statistics::Snapshot snapshot{storage};
+  return fmt::to_string(snapshot.SingleMetric("test"));
+}
+
+}  // namespace
+
+TEST(StatisticsLogLinearHistogram, Bounds) {
+  namespace impl = utils::statistics::impl::log_linear_histogram;
+  constexpr std::size_t kPrecisionBits = 3;
+  constexpr std::size_t kMaxPowerOfTwo = 20;
+
+  for (std::uint64_t value = 1; value < (1 << kMaxPowerOfTwo); ++value) {
+    const auto index =
+        impl::GetCounterIndex(value, kPrecisionBits, kMaxPowerOfTwo);
+    ASSERT_GE(index, 1);
+    const auto upper_bound = impl::GetUpperBound(index, kPrecisionBits);
+    ASSERT_GE(upper_bound, value);
+    ASSERT_LE(upper_bound - value, value >> kPrecisionBits);
+    if (index > 1) {
+      ASSERT_LT(impl::GetUpperBound(index - 1, kPrecisionBits), value);
+    }
+  }
+  EXPECT_EQ(impl::GetCounterIndex(0, kPrecisionBits, kMaxPowerOfTwo), 1);
+  EXPECT_EQ(impl::GetCounterIndex(1 << kMaxPowerOfTwo, kPrecisionBits,
+                                  kMaxPowerOfTwo),
+            0);
+}
+
+UTEST(StatisticsLogLinearHistogram, Account) {
+  SmallHistogram histogram;
+  AccountSome(histogram);
+  EXPECT_EQ(histogram.Count(), 8);
+  EXPECT_EQ(ToString(histogram), "[1]=2,[2]=1,[3]=1,[5]=1,[7]=1,[inf]=2");
+}
+
+TEST(StatisticsLogLinearHistogram, Percentile) {
+  SmallHistogram histogram;
+  EXPECT_EQ(histogram.GetPercentile(50), 0);
+
+  histogram.Account(3);
+  histogram.Account(4);
+  histogram.Account(6);
+  EXPECT_EQ(histogram.GetPercentile(0), 3);
+  EXPECT_EQ(histogram.GetPercentile(50), 5);
+  EXPECT_EQ(histogram.GetPercentile(100), 7);
+
+  histogram.Account(9);
+  EXPECT_EQ(histogram.GetPercentile(50), 7);
+  EXPECT_EQ(histogram.GetPercentile(100), 8);
+}
+
+UTEST(StatisticsLogLinearHistogram, CopyAddReset) {
+  SmallHistogram histogram1;
+  AccountSome(histogram1);
+
+  SmallHistogram histogram2{histogram1};
+  histogram2.Account(3);
+  EXPECT_EQ(ToString(histogram2), "[1]=2,[2]=1,[3]=2,[5]=1,[7]=1,[inf]=2");
+
+  histogram1.Add(histogram2);
+  EXPECT_EQ(ToString(histogram1), "[1]=4,[2]=2,[3]=3,[5]=2,[7]=2,[inf]=4");
+
+  ResetMetric(histogram1);
+  EXPECT_EQ(histogram1.Count(), 0);
+  EXPECT_EQ(ToString(histogram1), "[1]=0,[2]=0,[3]=0,[5]=0,[7]=0,[inf]=0");
+}
+
+TEST(StatisticsLogLinearHistogram, RecentPeriod) {
+  using Histogram = utils::statistics::LogLinearHistogram<3, 20>;
+  utils::datetime::MockNowSet({});
+  utils::statistics::RecentPeriod<Histogram, Histogram> period{
+      std::chrono::seconds{1}, std::chrono::seconds{10}};
+
+  for (int i = 1; i <= 100; ++i) {
+    period.GetCurrentCounter().Account(i * 1000);
+    if (i % 10 == 0) utils::datetime::MockSleep(std::chrono::seconds{1});
+  }
+
+  const auto result = period.GetStatsForPeriod();
+  EXPECT_EQ(result.Count(), 100);
+  EXPECT_EQ(result.GetPercentile(50), 53247);
+  EXPECT_EQ(result.GetPercentile(100), 106495);
+  utils::datetime::MockNowUnset();
+}
+
+UTEST(StatisticsLogLinearHistogram, Prometheus) {
+  utils::statistics::Storage storage;
+  SmallHistogram histogram;
+  AccountSome(histogram);
+  auto statistics_holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) {
+        writer.ValueWithLabels(histogram, {"handler", "ping"});
+      });
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormat(storage),
+            R"(# TYPE test histogram
+test_bucket{handler="ping",le="1"} 2
+test_bucket{handler="ping",le="2"} 3
+test_bucket{handler="ping",le="3"} 4
+test_bucket{handler="ping",le="5"} 5
+test_bucket{handler="ping",le="7"} 6
+test_bucket{handler="ping",le="+Inf"} 8
+test_count{handler="ping"} 8
+)");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,308 @@
+#include <userver/utils/statistics/metrics_push_exporter.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/clients/dns/component.hpp>
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/component.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <compression/compressor.hpp>
+#include <utils/statistics/delta_calculator.hpp>
+#include <utils/statistics/otlp_metrics_builder.hpp>
+#include <utils/statistics/statsd_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDefaultPushInterval{15'000};
+constexpr std::chrono::milliseconds kDefaultTimeout{5000};
+constexpr std::chrono::milliseconds kStatsdResolveTimeout{1000};
+constexpr std::chrono::milliseconds kStatsdSendTimeout{1000};
+constexpr std::size_t kDefaultMaxPacketSize = 1432;
+constexpr int kGzipLevel = 6;
+
+enum class Format {
+  kOtlp,
+  kStatsd,
+};
+
+Format Parse(const yaml_config::YamlConfig& value, formats::parse::To<Format>) {
+  const auto format = value.As<std::string>();
+  if (format == "otlp") return Format::kOtlp;
+  if (format == "statsd") return Format::kStatsd;
+  throw std::runtime_error("Unknown metrics push format '" + format +
+                           "' at " + value.GetPath());
+}
+
+struct StatsdEndpoint final {
+  std::string host;
+  std::uint16_t port{0};
+};
+
+StatsdEndpoint ParseStatsdEndpoint(const std::string& endpoint) {
+  const auto colon = endpoint.rfind(':');
+  if (colon == std::string::npos || colon == 0) {
+    throw std::runtime_error("StatsD endpoint '" + endpoint +
+                             "' must be in 'host:port' format");
+  }
+  StatsdEndpoint result;
+  result.host = endpoint.substr(0, colon);
+  // [::1]:8125
+  if (result.host.size() > 2 && result.host.front() == '[' &&
+      result.host.back() == ']') {
+    result.host = result.host.substr(1, result.host.size() - 2);
+  }
+  result.port =
+      static_cast<std::uint16_t>(std::stoul(endpoint.substr(colon + 1)));
+  return result;
+}
+
+}  // namespace
+
+class MetricsPushExporter::Impl final {
+ public:
+  Impl(const ComponentConfig& config, const ComponentContext& context)
+      : storage_(context.FindComponent<components::StatisticsStorage>()
+                     .GetStorage()),
+        format_(config["format"].As<Format>()),
+        endpoint_(config["endpoint"].As<std::string>()),
+        prefix_(config["prefix"].As<std::string>("")),
+        last_push_time_(std::chrono::system_clock::now()) {
+    if (format_ == Format::kOtlp) {
+      service_name_ = config["service-name"].As<std::string>();
+      timeout_ = config["timeout"].As<std::chrono::milliseconds>(timeout_);
+      const auto compression = config["compression"].As<std::string>("none");
+      if (compression == "gzip") {
+        compression_ = compression::Algorithm::kGzip;
+      } else if (compression != "none") {
+        throw std::runtime_error("Unknown metrics push compression '" +
+                                 compression + "'");
+      }
+      http_client_ =
+          &context
+               .FindComponent<HttpClient>(
+                   config["http-client"].As<std::string>(HttpClient::kName))
+               .GetHttpClient();
+    } else {
+      statsd_endpoint_ = ParseStatsdEndpoint(endpoint_);
+      max_packet_size_ =
+          config["max-packet-size"].As<std::size_t>(max_packet_size_);
+      resolver_ =
+          &context
+               .FindComponent<clients::dns::Component>(
+                   config["dns-client"].As<std::string>(
+                       clients::dns::Component::kName))
+               .GetResolver();
+    }
+  }
+
+  // Called from the PeriodicTask only, never concurrently
+  void Push() {
+    const auto now = std::chrono::system_clock::now();
+    const auto request = utils::statistics::Request::MakeWithPrefix(prefix_);
+
+    try {
+      std::size_t count = 0;
+      if (format_ == Format::kOtlp) {
+        count = PushOtlp(request, now);
+      } else {
+        count = PushStatsd(request);
+      }
+      stats_.pushed_metrics.Add(utils::statistics::Rate{count});
+      stats_.pushes.Add(utils::statistics::Rate{1});
+    } catch (const std::exception& e) {
+      stats_.failed_pushes.Add(utils::statistics::Rate{1});
+      LOG_LIMITED_WARNING() << "Failed to push the metrics to '" << endpoint_
+                            << "': " << e;
+    }
+    last_push_time_ = now;
+  }
+
+  void WriteStatistics(utils::statistics::Writer& writer) const {
+    writer["pushes"] = stats_.pushes;
+    writer["failed-pushes"] = stats_.failed_pushes;
+    writer["pushed-metrics"] = stats_.pushed_metrics;
+  }
+
+ private:
+  struct Stats final {
+    utils::statistics::RateCounter pushes;
+    utils::statistics::RateCounter failed_pushes;
+    utils::statistics::RateCounter pushed_metrics;
+  };
+
+  std::size_t PushOtlp(const utils::statistics::Request& request,
+                       std::chrono::system_clock::time_point now) {
+    utils::statistics::impl::OtlpMetricsBuilder builder{
+        service_name_, last_push_time_, now};
+    const auto count =
+        delta_calculator_.VisitDeltas(storage_, builder, request);
+    if (count == 0) return 0;
+
+    auto body = builder.Release();
+    clients::http::Headers headers{{"Content-Type", "application/x-protobuf"}};
+    if (compression_) {
+      body = compression::Compress(*compression_, body, kGzipLevel);
+      headers.insert_or_assign(
+          std::string{"Content-Encoding"},
+          std::string{compression::ToContentEncoding(*compression_)});
+    }
+
+    auto response = http_client_->CreateRequest()
+                        .post(endpoint_, std::move(body))
+                        .headers(headers)
+                        .timeout(timeout_)
+                        .perform();
+    response->raise_for_status();
+    return count;
+  }
+
+  std::size_t PushStatsd(const utils::statistics::Request& request) {
+    utils::statistics::impl::StatsdBuilder builder{max_packet_size_};
+    const auto count =
+        delta_calculator_.VisitDeltas(storage_, builder, request);
+    const auto packets = builder.Release();
+    if (packets.empty()) return count;
+
+    // The resolver caches the addresses, so the changes of the DNS records are
+    // picked up by the following pushes
+    const auto addrs = resolver_->Resolve(
+        statsd_endpoint_.host,
+        engine::Deadline::FromDuration(kStatsdResolveTimeout));
+    if (addrs.empty()) {
+      throw std::runtime_error("No addresses for '" + statsd_endpoint_.host +
+                               "'");
+    }
+    auto addr = addrs.front();
+    addr.SetPort(statsd_endpoint_.port);
+
+    engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kDgram};
+    const auto deadline = engine::Deadline::FromDuration(kStatsdSendTimeout);
+    for (const auto& packet : packets) {
+      [[maybe_unused]] const auto sent =
+          socket.SendAllTo(addr, packet.data(), packet.size(), deadline);
+    }
+    return count;
+  }
+
+  const utils::statistics::Storage& storage_;
+  const Format format_;
+  const std::string endpoint_;
+  const std::string prefix_;
+
+  // OTLP
+  std::string service_name_;
+  std::chrono::milliseconds timeout_{kDefaultTimeout};
+  std::optional<compression::Algorithm> compression_;
+  clients::http::Client* http_client_{nullptr};
+
+  // StatsD
+  StatsdEndpoint statsd_endpoint_;
+  std::size_t max_packet_size_{kDefaultMaxPacketSize};
+  clients::dns::Resolver* resolver_{nullptr};
+
+  utils::statistics::impl::DeltaCalculator delta_calculator_;
+  std::chrono::system_clock::time_point last_push_time_;
+  Stats stats_;
+};
+
+MetricsPushExporter::MetricsPushExporter(const ComponentConfig& config,
+                                         const ComponentContext& context)
+    : LoggableComponentBase(config, context),
+      impl_(std::make_unique<Impl>(config, context)) {
+  const auto push_interval = config["push-interval"].As<
+      std::chrono::milliseconds>(kDefaultPushInterval);
+  periodic_task_.Start(
+      "metrics-push-exporter",
+      {push_interval, {utils::PeriodicTask::Flags::kStrong},
+       logging::Level::kDebug},
+      [this] { impl_->Push(); });
+
+  statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter("metrics-push-exporter",
+                          [this](utils::statistics::Writer& writer) {
+                            impl_->WriteStatistics(writer);
+                          });
+}
+
+MetricsPushExporter::~MetricsPushExporter() {
+  statistics_holder_.Unregister();
+  periodic_task_.Stop();
+}
+
+yaml_config::Schema MetricsPushExporter::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: Component that periodically pushes the metrics to a collector
+additionalProperties: false
+properties:
+    format:
+        type: string
+        description: format of the pushed metrics
+        enum:
+          - otlp
+          - statsd
+    endpoint:
+        type: string
+        description: URL of the OTLP/HTTP metrics handler or the 'host:port' of the StatsD server
+    service-name:
+        type: string
+        description: the service name to put into the `service.name` resource attribute of OTLP
+        defaultDescription: ''
+    push-interval:
+        type: string
+        description: interval between the pushes
+        defaultDescription: 15s
+    prefix:
+        type: string
+        description: only the metrics with the path starting with the prefix are pushed
+        defaultDescription: ''
+    http-client:
+        type: string
+        description: name of the components::HttpClient to send the OTLP requests with
+        defaultDescription: http-client
+    timeout:
+        type: string
+        description: timeout of the OTLP request
+        defaultDescription: 5s
+    compression:
+        type: string
+        description: compression of the OTLP request body
+        defaultDescription: none
+        enum:
+          - none
+          - gzip
+    dns-client:
+        type: string
+        description: name of the clients::dns::Component to resolve the StatsD host with
+        defaultDescription: dns-client
+    max-packet-size:
+        type: integer
+        description: max size of a StatsD datagram in bytes
+        defaultDescription: 1432
+        minimum: 1
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
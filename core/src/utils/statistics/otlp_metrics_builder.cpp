@@ -0,0 +1,203 @@
+#include <utils/statistics/otlp_metrics_builder.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <userver/utils/overloaded.hpp>
+#include <utils/impl/proto_writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+constexpr std::string_view kInstrumentationScope = "userver";
+constexpr std::string_view kServiceNameAttribute = "service.name";
+
+// The numbers of the fields in opentelemetry/proto/metrics/v1/metrics.proto
+// and in the common.proto, resource.proto it depends on
+namespace field {
+constexpr int kResourceMetrics = 1;
+
+constexpr int kResource = 1;
+constexpr int kScopeMetrics = 2;
+
+constexpr int kResourceAttributes = 1;
+
+constexpr int kScope = 1;
+constexpr int kMetrics = 2;
+constexpr int kScopeName = 1;
+
+constexpr int kName = 1;
+constexpr int kGauge = 5;
+constexpr int kSum = 7;
+constexpr int kHistogram = 9;
+
+constexpr int kDataPoints = 1;
+constexpr int kAggregationTemporality = 2;
+constexpr int kIsMonotonic = 3;
+
+constexpr int kStartTime = 2;
+constexpr int kTime = 3;
+
+constexpr int kAsDouble = 4;
+constexpr int kAsInt = 6;
+constexpr int kNumberAttributes = 7;
+
+constexpr int kCount = 4;
+constexpr int kBucketCounts = 6;
+constexpr int kExplicitBounds = 7;
+constexpr int kHistogramAttributes = 9;
+
+constexpr int kKey = 1;
+constexpr int kValue = 2;
+
+constexpr int kStringValue = 1;
+}  // namespace field
+
+constexpr std::uint64_t kAggregationTemporalityDelta = 1;
+
+using utils::impl::ProtoWriter;
+
+std::uint64_t ToUnixNanoseconds(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+void WriteAttribute(ProtoWriter& writer, int field, std::string_view key,
+                    std::string_view value) {
+  writer.Message(field, [&](ProtoWriter& key_value) {
+    key_value.Bytes(field::kKey, key);
+    key_value.Message(field::kValue, [&](ProtoWriter& any_value) {
+      any_value.Bytes(field::kStringValue, value);
+    });
+  });
+}
+
+void WriteAttributes(ProtoWriter& writer, int field, LabelsSpan labels) {
+  for (const auto& label : labels) {
+    WriteAttribute(writer, field, label.Name(), label.Value());
+  }
+}
+
+}  // namespace
+
+OtlpMetricsBuilder::OtlpMetricsBuilder(
+    std::string_view service_name,
+    std::chrono::system_clock::time_point start_time,
+    std::chrono::system_clock::time_point time)
+    : service_name_(service_name),
+      start_time_(ToUnixNanoseconds(start_time)),
+      time_(ToUnixNanoseconds(time)) {}
+
+void OtlpMetricsBuilder::HandleMetric(std::string_view path, LabelsSpan labels,
+                                      const MetricValue& value) {
+  const auto kind = value.Visit(utils::Overloaded{
+      [](Rate) { return Kind::kSum; },
+      [](HistogramView) { return Kind::kHistogram; },
+      [](auto) { return Kind::kGauge; },
+  });
+  if (kind != current_kind_ || path != current_path_) {
+    FlushMetric();
+    current_path_.assign(path);
+    current_kind_ = kind;
+  }
+
+  ProtoWriter writer{current_data_points_};
+  writer.Message(field::kDataPoints, [&](ProtoWriter& point) {
+    if (kind != Kind::kGauge) point.Fixed64(field::kStartTime, start_time_);
+    point.Fixed64(field::kTime, time_);
+    value.Visit(utils::Overloaded{
+        [&](std::int64_t x) {
+          point.Fixed64(field::kAsInt, static_cast<std::uint64_t>(x));
+          WriteAttributes(point, field::kNumberAttributes, labels);
+        },
+        [&](double x) {
+          point.Double(field::kAsDouble, x);
+          WriteAttributes(point, field::kNumberAttributes, labels);
+        },
+        [&](Rate x) {
+          point.Fixed64(field::kAsInt, x.value);
+          WriteAttributes(point, field::kNumberAttributes, labels);
+        },
+        [&](HistogramView x) {
+          const auto bucket_count = x.GetBucketCount();
+          std::vector<std::uint64_t> counts(bucket_count + 1);
+          std::vector<double> bounds(bucket_count);
+          std::uint64_t total = 0;
+          for (std::size_t i = 0; i < bucket_count; ++i) {
+            counts[i] = x.GetValueAt(i);
+            bounds[i] = x.GetUpperBoundAt(i);
+            total += counts[i];
+          }
+          counts[bucket_count] = x.GetValueAtInf();
+          total += counts[bucket_count];
+
+          point.Fixed64(field::kCount, total);
+          point.PackedFixed64(field::kBucketCounts, counts);
+          point.PackedFixed64(field::kExplicitBounds, bounds);
+          WriteAttributes(point, field::kHistogramAttributes, labels);
+        },
+    });
+  });
+}
+
+void OtlpMetricsBuilder::FlushMetric() {
+  if (current_kind_ == Kind::kNone) return;
+
+  ProtoWriter writer{metrics_};
+  writer.Message(field::kMetrics, [&](ProtoWriter& metric) {
+    metric.Bytes(field::kName, current_path_);
+    switch (current_kind_) {
+      case Kind::kGauge:
+        metric.Bytes(field::kGauge, current_data_points_);
+        break;
+      case Kind::kSum:
+        metric.Message(field::kSum, [&](ProtoWriter& sum) {
+          sum.Raw(current_data_points_);
+          sum.Varint(field::kAggregationTemporality,
+                     kAggregationTemporalityDelta);
+          sum.Varint(field::kIsMonotonic, 1);
+        });
+        break;
+      case Kind::kHistogram:
+        metric.Message(field::kHistogram, [&](ProtoWriter& histogram) {
+          histogram.Raw(current_data_points_);
+          histogram.Varint(field::kAggregationTemporality,
+                           kAggregationTemporalityDelta);
+        });
+        break;
+      case Kind::kNone:
+        break;
+    }
+  });
+  current_data_points_.clear();
+  current_kind_ = Kind::kNone;
+}
+
+std::string OtlpMetricsBuilder::Release() {
+  FlushMetric();
+
+  std::string result;
+  ProtoWriter writer{result};
+  writer.Message(field::kResourceMetrics, [&](ProtoWriter& resource_metrics) {
+    resource_metrics.Message(field::kResource, [&](ProtoWriter& resource) {
+      WriteAttribute(resource, field::kResourceAttributes,
+                     kServiceNameAttribute, service_name_);
+    });
+    resource_metrics.Message(
+        field::kScopeMetrics, [&](ProtoWriter& scope_metrics) {
+          scope_metrics.Message(field::kScope, [](ProtoWriter& scope) {
+            scope.Bytes(field::kScopeName, kInstrumentationScope);
+          });
+          scope_metrics.Raw(metrics_);
+        });
+  });
+  return result;
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
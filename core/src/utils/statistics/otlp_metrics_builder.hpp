@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+/// Serializes the metrics into the protobuf of
+/// opentelemetry.proto.collector.metrics.v1.ExportMetricsServiceRequest.
+///
+/// The utils::statistics::Rate values become the monotonic sums and the
+/// utils::statistics::HistogramView values become the histograms, both with
+/// the delta temporality over [start_time, time]. Pass the values through the
+/// DeltaCalculator to get the deltas. Other values become the gauges.
+///
+/// The consecutive metrics of the same path and kind share a Metric message.
+class OtlpMetricsBuilder final : public BaseFormatBuilder {
+ public:
+  OtlpMetricsBuilder(std::string_view service_name,
+                     std::chrono::system_clock::time_point start_time,
+                     std::chrono::system_clock::time_point time);
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override;
+
+  /// Returns the serialized request, the builder must not be used afterwards
+  std::string Release();
+
+ private:
+  enum class Kind {
+    kNone,
+    kGauge,
+    kSum,
+    kHistogram,
+  };
+
+  void FlushMetric();
+
+  const std::string service_name_;
+  const std::uint64_t start_time_;
+  const std::uint64_t time_;
+
+  std::string metrics_;
+  std::string current_path_;
+  Kind current_kind_{Kind::kNone};
+  std::string current_data_points_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
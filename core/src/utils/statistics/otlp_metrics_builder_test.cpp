@@ -0,0 +1,114 @@
+#include <utils/statistics/otlp_metrics_builder.hpp>
+
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using testing::HasSubstr;
+using utils::statistics::MetricValue;
+
+MetricValue MakeValue(MetricValue::RawType value) {
+  return MetricValue{value};
+}
+
+utils::statistics::impl::OtlpMetricsBuilder MakeBuilder() {
+  return utils::statistics::impl::OtlpMetricsBuilder{
+      "test-service",
+      std::chrono::system_clock::time_point{std::chrono::seconds{1}},
+      std::chrono::system_clock::time_point{std::chrono::seconds{2}}};
+}
+
+std::size_t CountSubstr(std::string_view string, std::string_view substr) {
+  std::size_t count = 0;
+  for (auto pos = string.find(substr); pos != std::string_view::npos;
+       pos = string.find(substr, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(OtlpMetricsBuilder, Sum) {
+  auto builder = MakeBuilder();
+  builder.HandleMetric("requests", {{"handler", "ping"}},
+                       MakeValue(utils::statistics::Rate{300}));
+  const auto encoded = builder.Release();
+
+  EXPECT_THAT(encoded, HasSubstr("test-service"));
+  EXPECT_THAT(encoded, HasSubstr("\x0a\x08requests"));
+  // start_time_unix_nano = 2 and time_unix_nano = 3 are fixed64
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x11\x00\xca\x9a\x3b\x00\x00\x00\x00", 9}));
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x19\x00\x94\x35\x77\x00\x00\x00\x00", 9}));
+  // as_int = 6 is sfixed64
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x31\x2c\x01\x00\x00\x00\x00\x00\x00", 9}));
+  // aggregation_temporality = DELTA, is_monotonic = true
+  EXPECT_THAT(encoded, HasSubstr("\x10\x01\x18\x01"));
+  EXPECT_THAT(encoded, HasSubstr("handler"));
+  EXPECT_THAT(encoded, HasSubstr("ping"));
+}
+
+TEST(OtlpMetricsBuilder, Gauge) {
+  auto builder = MakeBuilder();
+  builder.HandleMetric("temperature", {}, MakeValue(1.0));
+  const auto encoded = builder.Release();
+
+  // as_double = 4
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x21\x00\x00\x00\x00\x00\x00\xf0\x3f", 9}));
+  // Gauges have no start time
+  EXPECT_THAT(encoded, testing::Not(HasSubstr("\x11\x00\xca\x9a\x3b")));
+}
+
+TEST(OtlpMetricsBuilder, Histogram) {
+  utils::statistics::Histogram histogram{std::vector<double>{1, 10}};
+  histogram.Account(5);
+  histogram.Account(100);
+
+  auto builder = MakeBuilder();
+  builder.HandleMetric("timings", {}, MakeValue(histogram.GetView()));
+  const auto encoded = builder.Release();
+
+  // count = 4 is fixed64
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x21\x02\x00\x00\x00\x00\x00\x00\x00", 9}));
+  // bucket_counts = 6 include the "infinity" bucket
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x32\x18"
+                           "\x00\x00\x00\x00\x00\x00\x00\x00"
+                           "\x01\x00\x00\x00\x00\x00\x00\x00"
+                           "\x01\x00\x00\x00\x00\x00\x00\x00",
+                           26}));
+  // explicit_bounds = 7
+  EXPECT_THAT(encoded, HasSubstr(std::string_view{
+                           "\x3a\x10"
+                           "\x00\x00\x00\x00\x00\x00\xf0\x3f"
+                           "\x00\x00\x00\x00\x00\x00\x24\x40",
+                           18}));
+}
+
+TEST(OtlpMetricsBuilder, GroupsDataPoints) {
+  auto builder = MakeBuilder();
+  builder.HandleMetric("requests", {{"handler", "a"}},
+                       MakeValue(utils::statistics::Rate{1}));
+  builder.HandleMetric("requests", {{"handler", "b"}},
+                       MakeValue(utils::statistics::Rate{2}));
+  builder.HandleMetric("other", {}, MakeValue(utils::statistics::Rate{3}));
+  builder.HandleMetric("requests", {}, MakeValue(std::int64_t{4}));
+  const auto encoded = builder.Release();
+
+  EXPECT_EQ(CountSubstr(encoded, "\x0a\x08requests"), 2);
+  EXPECT_EQ(CountSubstr(encoded, "\x0a\x05other"), 1);
+}
+
+USERVER_NAMESPACE_END
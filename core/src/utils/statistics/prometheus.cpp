@@ -1,7 +1,9 @@
 #include <userver/utils/statistics/prometheus.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
+#include <optional>
 #include <unordered_map>
 
 #include <fmt/compile.h>
@@ -29,14 +31,12 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
+    const auto& prometheus_name = ConvertNameAndDumpType(path, value);
     if (value.IsHistogram()) {
-      // TODO support histogram metrics using 'le', or better yet,
-      //  using Prometheus native histograms.
-      UASSERT_MSG(false,
-                  "Histogram metrics are not supported for Prometheus yet");
+      DumpHistogram(prometheus_name, labels, value.AsHistogram());
       return;
     }
-    DumpMetricNameAndType(path, value);
+    buf_.append(prometheus_name);
     DumpLabels(labels);
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
   }
@@ -44,17 +44,17 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
   std::string Release() { return fmt::to_string(buf_); }
 
  private:
-  void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
+  // Returns the converted name, the type is written for the new names only
+  const std::string& ConvertNameAndDumpType(std::string_view name,
+                                            const MetricValue& value) {
     if (const auto* const converted =
             utils::impl::FindTransparentOrNullptr(metrics_, name)) {
-      buf_.append(*converted);
-      return;
+      return *converted;
     }
 
     auto prometheus_name = impl::ToPrometheusName(name);
     DumpMetricType(prometheus_name, value);
-    buf_.append(prometheus_name);
-    metrics_.emplace(name, std::move(prometheus_name));
+    return metrics_.emplace(name, std::move(prometheus_name)).first->second;
   }
 
   void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
@@ -73,16 +73,42 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
         [](std::int64_t) -> std::string_view { return "gauge"; },
         [](double) -> std::string_view { return "gauge"; },
         [](Rate) -> std::string_view { return "counter"; },
-        [](HistogramView) -> std::string_view {
-          UINVARIANT(false,
-                     "Histogram metrics are not supported for Prometheus yet");
-        },
+        [](HistogramView) -> std::string_view { return "histogram"; },
     });
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("# TYPE {} {}\n"),
                    prometheus_name, type);
   }
 
-  void DumpLabels(utils::statistics::LabelsSpan labels) {
+  // Writes a classic Prometheus histogram: the cumulative '_bucket' counters
+  // and the '_count'. There is no '_sum', as the sum of the values is not
+  // stored.
+  void DumpHistogram(std::string_view prometheus_name,
+                     utils::statistics::LabelsSpan labels,
+                     HistogramView histogram) {
+    std::uint64_t count = 0;
+    for (std::size_t i = 0; i < histogram.GetBucketCount(); ++i) {
+      count += histogram.GetValueAt(i);
+      DumpHistogramLine(prometheus_name, "_bucket", labels,
+                        fmt::to_string(histogram.GetUpperBoundAt(i)), count);
+    }
+    count += histogram.GetValueAtInf();
+    DumpHistogramLine(prometheus_name, "_bucket", labels, "+Inf", count);
+    DumpHistogramLine(prometheus_name, "_count", labels, std::nullopt, count);
+  }
+
+  void DumpHistogramLine(std::string_view prometheus_name,
+                         std::string_view suffix,
+                         utils::statistics::LabelsSpan labels,
+                         std::optional<std::string_view> le,
+                         std::uint64_t count) {
+    buf_.append(prometheus_name);
+    buf_.append(suffix);
+    DumpLabels(labels, le);
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), count);
+  }
+
+  void DumpLabels(utils::statistics::LabelsSpan labels,
+                  std::optional<std::string_view> le = std::nullopt) {
     buf_.push_back('{');
     bool sep = false;
     for (const auto& label : labels) {
@@ -97,6 +123,12 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       buf_.push_back('"');
       sep = true;
     }
+    if (le) {
+      if (sep) {
+        buf_.push_back(',');
+      }
+      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("le=\"{}\""), *le);
+    }
     buf_.push_back('}');
   }
 
@@ -0,0 +1,107 @@
+#include <utils/statistics/statsd_builder.hpp>
+
+#include <cstdint>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/overloaded.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+namespace {
+
+constexpr std::string_view kCounterType = "c";
+constexpr std::string_view kGaugeType = "g";
+constexpr std::string_view kInfUpperBound = "inf";
+
+// Replaces the characters that delimit the parts of the line
+void AppendEscaped(std::string& out, std::string_view value, bool is_name) {
+  for (const char c : value) {
+    const bool is_special = c == '|' || c == '#' || c == '@' || c == ',' ||
+                            c == '\n' || (is_name && c == ':');
+    out.push_back(is_special ? '_' : c);
+  }
+}
+
+}  // namespace
+
+StatsdBuilder::StatsdBuilder(std::size_t max_packet_size)
+    : max_packet_size_(max_packet_size) {
+  UINVARIANT(max_packet_size_ > 0, "max_packet_size must be positive");
+}
+
+void StatsdBuilder::HandleMetric(std::string_view path, LabelsSpan labels,
+                                 const MetricValue& value) {
+  value.Visit(utils::Overloaded{
+      [&](std::int64_t x) {
+        // A signed value would change the gauge instead of setting it
+        if (x < 0) WriteLine(path, {}, "0", kGaugeType, labels);
+        WriteLine(path, {}, fmt::to_string(x), kGaugeType, labels);
+      },
+      [&](double x) {
+        if (x < 0) WriteLine(path, {}, "0", kGaugeType, labels);
+        WriteLine(path, {}, fmt::to_string(x), kGaugeType, labels);
+      },
+      [&](Rate x) {
+        WriteLine(path, {}, fmt::to_string(x.value), kCounterType, labels);
+      },
+      [&](HistogramView x) {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < x.GetBucketCount(); ++i) {
+          const auto count = x.GetValueAt(i);
+          if (count == 0) continue;
+          total += count;
+          WriteLine(path, ".bucket", fmt::to_string(count), kCounterType,
+                    labels, fmt::to_string(x.GetUpperBoundAt(i)));
+        }
+        if (const auto count = x.GetValueAtInf(); count != 0) {
+          total += count;
+          WriteLine(path, ".bucket", fmt::to_string(count), kCounterType,
+                    labels, kInfUpperBound);
+        }
+        WriteLine(path, ".count", fmt::to_string(total), kCounterType, labels);
+      },
+  });
+}
+
+void StatsdBuilder::WriteLine(std::string_view path, std::string_view suffix,
+                              std::string_view value, std::string_view type,
+                              LabelsSpan labels, std::string_view upper_bound) {
+  line_.clear();
+  AppendEscaped(line_, path, true);
+  line_.append(suffix);
+  line_.push_back(':');
+  line_.append(value);
+  line_.push_back('|');
+  line_.append(type);
+
+  bool is_first_tag = true;
+  const auto append_tag = [&](std::string_view name, std::string_view value) {
+    line_.append(is_first_tag ? "|#" : ",");
+    is_first_tag = false;
+    AppendEscaped(line_, name, true);
+    line_.push_back(':');
+    AppendEscaped(line_, value, false);
+  };
+  for (const auto& label : labels) append_tag(label.Name(), label.Value());
+  if (!upper_bound.empty()) append_tag("upper_bound", upper_bound);
+
+  if (packets_.empty() ||
+      packets_.back().size() + 1 + line_.size() > max_packet_size_) {
+    packets_.emplace_back();
+  } else {
+    packets_.back().push_back('\n');
+  }
+  packets_.back().append(line_);
+}
+
+std::vector<std::string> StatsdBuilder::Release() {
+  return std::move(packets_);
+}
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
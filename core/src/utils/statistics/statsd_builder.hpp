@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+/// Serializes the metrics into the StatsD lines with the DogStatsD tags,
+/// packed into the datagrams of at most `max_packet_size` bytes.
+///
+/// The utils::statistics::Rate values become the counters, so pass the values
+/// through the DeltaCalculator first. Other values become the gauges. The
+/// non-zero buckets of a utils::statistics::HistogramView become the
+/// `<path>.bucket` counters tagged with the `upper_bound`, and the total
+/// count becomes the `<path>.count` counter.
+class StatsdBuilder final : public BaseFormatBuilder {
+ public:
+  explicit StatsdBuilder(std::size_t max_packet_size);
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override;
+
+  /// Returns the datagrams, the builder must not be used afterwards
+  std::vector<std::string> Release();
+
+ private:
+  void WriteLine(std::string_view path, std::string_view suffix,
+                 std::string_view value, std::string_view type,
+                 LabelsSpan labels, std::string_view upper_bound = {});
+
+  const std::size_t max_packet_size_;
+  std::vector<std::string> packets_;
+  std::string line_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#include <utils/statistics/statsd_builder.hpp>
+
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Packets = std::vector<std::string>;
+using utils::statistics::MetricValue;
+
+MetricValue MakeValue(MetricValue::RawType value) {
+  return MetricValue{value};
+}
+
+}  // namespace
+
+TEST(StatsdBuilder, Values) {
+  utils::statistics::impl::StatsdBuilder builder{1432};
+  builder.HandleMetric("requests", {{"handler", "ping"}, {"code", "200"}},
+                       MakeValue(utils::statistics::Rate{5}));
+  builder.HandleMetric("connections", {}, MakeValue(std::int64_t{3}));
+  builder.HandleMetric("temperature", {}, MakeValue(-1.5));
+
+  EXPECT_EQ(builder.Release(),
+            Packets{"requests:5|c|#handler:ping,code:200\n"
+                    "connections:3|g\n"
+                    "temperature:0|g\n"
+                    "temperature:-1.5|g"});
+}
+
+TEST(StatsdBuilder, Histogram) {
+  utils::statistics::Histogram histogram{std::vector<double>{1, 10}};
+  histogram.Account(5);
+  histogram.Account(7);
+  histogram.Account(100);
+
+  utils::statistics::impl::StatsdBuilder builder{1432};
+  builder.HandleMetric("timings", {{"handler", "ping"}},
+                       MakeValue(histogram.GetView()));
+
+  EXPECT_EQ(builder.Release(),
+            Packets{"timings.bucket:2|c|#handler:ping,upper_bound:10\n"
+                    "timings.bucket:1|c|#handler:ping,upper_bound:inf\n"
+                    "timings.count:3|c|#handler:ping"});
+}
+
+TEST(StatsdBuilder, Escaping) {
+  utils::statistics::impl::StatsdBuilder builder{1432};
+  builder.HandleMetric("a:b|c", {{"na#me", "va:l,ue"}},
+                       MakeValue(utils::statistics::Rate{1}));
+  EXPECT_EQ(builder.Release(), Packets{"a_b_c:1|c|#na_me:va:l_ue"});
+}
+
+TEST(StatsdBuilder, Packets) {
+  utils::statistics::impl::StatsdBuilder builder{21};
+  for (int i = 0; i < 5; ++i) {
+    builder.HandleMetric("metric", {}, MakeValue(std::int64_t{i}));
+  }
+  builder.HandleMetric("too.long.metric.name", {}, MakeValue(std::int64_t{0}));
+
+  EXPECT_EQ(builder.Release(),
+            (Packets{"metric:0|g\nmetric:1|g", "metric:2|g\nmetric:3|g",
+                     "metric:4|g", "too.long.metric.name:0|g"}));
+}
+
+USERVER_NAMESPACE_END
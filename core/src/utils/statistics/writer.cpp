@@ -28,6 +28,21 @@ bool LeftContainsRight(LabelsSpan left, const ContainerRight& right) {
   return true;
 }
 
+// The label names do not repeat, so a metric with a required label name and
+// another value could not match the request
+bool ConflictsWithRequired(LabelsSpan labels,
+                           const std::vector<Label>& require_labels) {
+  for (const auto& required : require_labels) {
+    for (const auto& label : labels) {
+      if (label.Name() == required.Name() &&
+          label.Value() != required.Value()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 bool CanSubPathSucceedExactMatch(std::string_view current_path,
                                  std::string_view required,
                                  std::size_t initial_path_size) {
@@ -254,6 +269,12 @@ void Writer::AppendLabelsSpan(LabelsSpan labels) {
   state_->add_labels.insert(state_->add_labels.end(), labels.begin(),
                             labels.end());
   current_labels_size_ = state_->add_labels.size();
+
+  if (ConflictsWithRequired(labels, state_->request.require_labels)) {
+    // Skips the whole subtree, including the writers of the Storage that
+    // were registered with such labels
+    ResetState();
+  }
 }
 
 }  // namespace utils::statistics
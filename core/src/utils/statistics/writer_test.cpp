@@ -419,6 +419,32 @@ UTEST(MetricsWriter, CustomTypesOptimization) {
   holder.Unregister();
 }
 
+UTEST(MetricsWriter, RequiredLabelsSkipWriters) {
+  Storage storage;
+  auto holder = storage.RegisterWriter(
+      "a",
+      [](Writer& writer) {
+        writer = MetricTypeThatMustBeSkipped{"at 'a' path with 'env' label"};
+      },
+      {{"env", "testing"}});
+  auto holder1 = storage.RegisterWriter("a", [](Writer& writer) {
+    writer.ValueWithLabels(MetricTypeThatMustBeSkipped{"at 'a' path"},
+                           {"env", "testing"});
+    writer.ValueWithLabels(42, {"env", "production"});
+    writer.ValueWithLabels(43, {"other", "label"});
+  });
+
+  const auto* const expected = "a{env=\"production\"} 42\n";
+  EXPECT_EQ(expected,
+            ToPrometheusFormatUntyped(
+                storage, Request::MakeWithPrefix({}, {},
+                                                 {{"env", "production"}})));
+
+  // Manual unregister to avoid fake writer call when destroying a `Entry`
+  holder1.Unregister();
+  holder.Unregister();
+}
+
 UTEST(MetricsWriter, ComplexPathsStored) {
   Storage storage;
   auto holder = storage.RegisterWriter("a", [](Writer& writer) {
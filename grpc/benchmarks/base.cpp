@@ -72,6 +72,22 @@ class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
 
 using GrpcClientTest = tests::Service<UnitTestService>;
 
+// Polls the single completion queue in a worker thread of the current task
+// processor, so the benchmarks of this mode need at least 2 worker threads
+server::ServerConfig MakeQueueInTaskProcessorConfig() {
+  server::ServerConfig config;
+  config.completion_queue_num = 1;
+  config.completion_queue_task_processor =
+      &engine::current_task::GetTaskProcessor();
+  return config;
+}
+
+server::ServerConfig MakeQueueInThreadConfig() {
+  server::ServerConfig config;
+  config.completion_queue_num = 1;
+  return config;
+}
+
 std::unique_ptr<grpc::ClientContext> PrepareClientContext() {
   auto context = std::make_unique<grpc::ClientContext>();
   context->AddMetadata("req_header", "value");
@@ -120,6 +136,27 @@ void UnaryRPC(benchmark::State& state) {
 
 BENCHMARK(UnaryRPC)->DenseRange(1, 4)->Unit(benchmark::kMicrosecond);
 
+template <server::ServerConfig (*MakeServerConfig)()>
+void UnaryRPCSingleQueue(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    GrpcClientTest client_factory(dynamic_config::MakeDefaultStorage({}),
+                                  MakeServerConfig());
+    auto client =
+        client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    for (auto _ : state) {
+      UnaryRPCPayload(client);
+    }
+  });
+}
+
+BENCHMARK_TEMPLATE(UnaryRPCSingleQueue, MakeQueueInThreadConfig)
+    ->DenseRange(2, 4)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(UnaryRPCSingleQueue, MakeQueueInTaskProcessorConfig)
+    ->DenseRange(2, 4)
+    ->Unit(benchmark::kMicrosecond);
+
 void UnaryRPCNewClient(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     GrpcClientTest client_factory;
@@ -166,6 +203,45 @@ void BatchOfUnaryRPC(benchmark::State& state) {
 
 BENCHMARK(BatchOfUnaryRPC)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
 
+template <server::ServerConfig (*MakeServerConfig)()>
+void BatchOfUnaryRPCSingleQueue(benchmark::State& state) {
+  engine::RunStandalone(
+      state.range(0),
+      engine::TaskProcessorPoolsConfig{10000, 100000, 256 * 1024ULL, 1, "ev",
+                                       false, false},
+      [&] {
+        static constexpr std::size_t kBatchSize = 16;
+        GrpcClientTest client_factory(dynamic_config::MakeDefaultStorage({}),
+                                      MakeServerConfig());
+        auto clients =
+            utils::GenerateFixedArray(kBatchSize, [&client_factory](auto) {
+              return client_factory
+                  .MakeClient<sample::ugrpc::UnitTestServiceClient>();
+            });
+
+        for (auto _ : state) {
+          auto tasks =
+              utils::GenerateFixedArray(kBatchSize, [&clients](auto i) {
+                return engine::AsyncNoSpan(UnaryRPCPayloadRepeated,
+                                           std::ref(clients[i]));
+              });
+          engine::GetAll(tasks);
+        }
+
+        state.counters["rps"] = benchmark::Counter(
+            static_cast<std::size_t>(state.iterations()) * kBatchSize *
+                kUnaryRPCPayloadRepeatedRepetitions,
+            benchmark::Counter::kIsRate);
+      });
+}
+
+BENCHMARK_TEMPLATE(BatchOfUnaryRPCSingleQueue, MakeQueueInThreadConfig)
+    ->DenseRange(2, 8)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BatchOfUnaryRPCSingleQueue, MakeQueueInTaskProcessorConfig)
+    ->DenseRange(2, 8)
+    ->Unit(benchmark::kMillisecond);
+
 void BatchOfUnaryRPCNewClient(benchmark::State& state) {
   engine::RunStandalone(
       state.range(0),
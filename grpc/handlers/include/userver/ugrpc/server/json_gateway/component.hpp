@@ -0,0 +1,102 @@
+#pragma once
+
+/// @file userver/ugrpc/server/json_gateway/component.hpp
+/// @brief @copybrief ugrpc::server::JsonGatewayHandler
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/generic/generic_stub.h>
+
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/ugrpc/client/queue_holder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief HTTP handler that exposes the unary methods of gRPC services as
+/// HTTP/JSON endpoints
+///
+/// The JSON body of the request is parsed right into the protobuf request
+/// of the method, the request is sent to `grpc-endpoint`, and the response is
+/// written as JSON right from the protobuf response, see
+/// ugrpc::JsonToMessage and ugrpc::WriteJson. There is no intermediate
+/// formats::json::Value.
+///
+/// The service and the method are taken from the `service` and `method` path
+/// arguments, e.g. `path: /grpc/{service}/{method}`, where `service` is the
+/// full name of the service, e.g. `sample.ugrpc.GreeterService`. Only the
+/// services linked into the binary are known. The streaming methods are
+/// rejected with 400.
+///
+/// The errors of gRPC are returned as `{"code": <grpc code>, "message": ...}`
+/// with the HTTP status corresponding to the gRPC status code. The deadline of
+/// the gRPC call is the least of `grpc-timeout` and the deadline of the HTTP
+/// request.
+///
+/// The completion queue of ugrpc::server::ServerComponent is used if there is
+/// one, so that the handler may expose the services of the same process.
+///
+/// ## Static options:
+/// The component name for static config is `"grpc-json-gateway"`.
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// grpc-endpoint | the gRPC server to send the requests to, 'host:port' | --
+/// grpc-timeout | timeout of the gRPC calls | 10s
+/// blocking-task-processor | the task processor for blocking channel creation | --
+/// Options inherited from @ref server::handlers::HttpHandlerBase
+///
+/// ## Static configuration example:
+///
+/// @code
+/// grpc-json-gateway:
+///     path: /grpc/{service}/{method}
+///     method: POST
+///     task_processor: main-task-processor
+///     grpc-endpoint: '[::1]:8091'
+///     blocking-task-processor: grpc-blocking-task-processor
+/// @endcode
+
+// clang-format on
+
+class JsonGatewayHandler final
+    : public USERVER_NAMESPACE::server::handlers::HttpHandlerBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of ugrpc::server::JsonGatewayHandler
+  static constexpr std::string_view kName = "grpc-json-gateway";
+
+  JsonGatewayHandler(const components::ComponentConfig& config,
+                     const components::ComponentContext& context);
+
+  ~JsonGatewayHandler() override;
+
+  std::string HandleRequestThrow(
+      const USERVER_NAMESPACE::server::http::HttpRequest& request,
+      USERVER_NAMESPACE::server::request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::chrono::milliseconds timeout_;
+  std::optional<client::QueueHolder> queue_holder_;
+  grpc::CompletionQueue* queue_{nullptr};
+  std::shared_ptr<grpc::Channel> channel_;
+  std::unique_ptr<grpc::GenericStub> stub_;
+};
+
+}  // namespace ugrpc::server
+
+template <>
+inline constexpr bool
+    components::kHasValidate<ugrpc::server::JsonGatewayHandler> = true;
+
+USERVER_NAMESPACE_END
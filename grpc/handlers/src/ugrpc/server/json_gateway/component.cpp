@@ -0,0 +1,231 @@
+#include <userver/ugrpc/server/json_gateway/component.hpp>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/security/credentials.h>
+
+#include <userver/components/component.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/server/request/task_inherited_data.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <userver/ugrpc/client/channels.hpp>
+#include <userver/ugrpc/client/impl/async_method_invocation.hpp>
+#include <userver/ugrpc/impl/deadline_timepoint.hpp>
+#include <userver/ugrpc/proto_json.hpp>
+#include <userver/ugrpc/server/server_component.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+namespace {
+
+using USERVER_NAMESPACE::server::http::HttpStatus;
+using Serialization = grpc::SerializationTraits<google::protobuf::Message>;
+
+constexpr std::chrono::milliseconds kDefaultTimeout{std::chrono::seconds{10}};
+
+HttpStatus ToHttpStatus(grpc::StatusCode code) {
+  switch (code) {
+    case grpc::StatusCode::OK:
+      return HttpStatus::kOk;
+    case grpc::StatusCode::CANCELLED:
+      return HttpStatus::kClientClosedRequest;
+    case grpc::StatusCode::INVALID_ARGUMENT:
+    case grpc::StatusCode::FAILED_PRECONDITION:
+    case grpc::StatusCode::OUT_OF_RANGE:
+      return HttpStatus::kBadRequest;
+    case grpc::StatusCode::DEADLINE_EXCEEDED:
+      return HttpStatus::kGatewayTimeout;
+    case grpc::StatusCode::NOT_FOUND:
+      return HttpStatus::kNotFound;
+    case grpc::StatusCode::ALREADY_EXISTS:
+    case grpc::StatusCode::ABORTED:
+      return HttpStatus::kConflict;
+    case grpc::StatusCode::PERMISSION_DENIED:
+      return HttpStatus::kForbidden;
+    case grpc::StatusCode::UNAUTHENTICATED:
+      return HttpStatus::kUnauthorized;
+    case grpc::StatusCode::RESOURCE_EXHAUSTED:
+      return HttpStatus::kTooManyRequests;
+    case grpc::StatusCode::UNIMPLEMENTED:
+      return HttpStatus::kNotImplemented;
+    case grpc::StatusCode::UNAVAILABLE:
+      return HttpStatus::kServiceUnavailable;
+    default:
+      return HttpStatus::kInternalServerError;
+  }
+}
+
+std::string MakeError(
+    const USERVER_NAMESPACE::server::http::HttpRequest& request,
+    grpc::StatusCode code, std::string_view message) {
+  request.SetResponseStatus(ToHttpStatus(code));
+
+  formats::json::StringBuilder sw;
+  {
+    const formats::json::StringBuilder::ObjectGuard guard{sw};
+    sw.Key("code");
+    sw.WriteInt64(static_cast<int>(code));
+    sw.Key("message");
+    sw.WriteString(message);
+  }
+  return sw.GetString();
+}
+
+const google::protobuf::MethodDescriptor* FindMethod(
+    const std::string& service_name, const std::string& method_name) {
+  const auto* service =
+      google::protobuf::DescriptorPool::generated_pool()->FindServiceByName(
+          service_name);
+  return service ? service->FindMethodByName(method_name) : nullptr;
+}
+
+std::unique_ptr<google::protobuf::Message> MakeMessage(
+    const google::protobuf::Descriptor& descriptor) {
+  return std::unique_ptr<google::protobuf::Message>{
+      google::protobuf::MessageFactory::generated_factory()
+          ->GetPrototype(&descriptor)
+          ->New()};
+}
+
+void AddTracingMetadata(grpc::ClientContext& context) {
+  // Same as the metadata of the ugrpc clients
+  const auto* span = tracing::Span::CurrentSpanUnchecked();
+  if (!span) return;
+  context.AddMetadata("x-yatraceid", span->GetTraceId());
+  context.AddMetadata("x-yaspanid", span->GetSpanId());
+  context.AddMetadata("x-yarequestid", span->GetLink());
+}
+
+}  // namespace
+
+JsonGatewayHandler::JsonGatewayHandler(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : HttpHandlerBase(config, context),
+      timeout_(config["grpc-timeout"].As<std::chrono::milliseconds>(
+          kDefaultTimeout)) {
+  if (auto* const server = context.FindComponentOptional<ServerComponent>()) {
+    queue_ = &server->GetServer().GetCompletionQueue();
+  } else {
+    queue_holder_.emplace();
+    queue_ = &queue_holder_->GetQueue();
+  }
+
+  auto& blocking_task_processor = context.GetTaskProcessor(
+      config["blocking-task-processor"].As<std::string>());
+  channel_ = client::MakeChannel(blocking_task_processor,
+                                 grpc::InsecureChannelCredentials(),
+                                 config["grpc-endpoint"].As<std::string>());
+  stub_ = std::make_unique<grpc::GenericStub>(channel_);
+}
+
+JsonGatewayHandler::~JsonGatewayHandler() = default;
+
+std::string JsonGatewayHandler::HandleRequestThrow(
+    const USERVER_NAMESPACE::server::http::HttpRequest& request,
+    USERVER_NAMESPACE::server::request::RequestContext&) const {
+  request.GetHttpResponse().SetContentType(
+      USERVER_NAMESPACE::http::content_type::kApplicationJson);
+
+  const auto& service_name = request.GetPathArg("service");
+  const auto& method_name = request.GetPathArg("method");
+  const auto* const method = FindMethod(service_name, method_name);
+  if (!method) {
+    return MakeError(
+        request, grpc::StatusCode::NOT_FOUND,
+        utils::StrCat("Unknown method ", service_name, "/", method_name));
+  }
+  if (method->client_streaming() || method->server_streaming()) {
+    return MakeError(request, grpc::StatusCode::INVALID_ARGUMENT,
+                     "Streaming methods are not supported");
+  }
+
+  const auto request_message = MakeMessage(*method->input_type());
+  try {
+    const auto& body = request.RequestBody();
+    ugrpc::JsonToMessage(body.empty() ? "{}" : body, *request_message);
+  } catch (const formats::json::Exception& ex) {
+    return MakeError(request, grpc::StatusCode::INVALID_ARGUMENT, ex.what());
+  }
+
+  grpc::ByteBuffer request_buffer;
+  bool own_buffer = false;
+  if (const auto status = Serialization::Serialize(
+          *request_message, &request_buffer, &own_buffer);
+      !status.ok()) {
+    return MakeError(request, status.error_code(), status.error_message());
+  }
+
+  grpc::ClientContext context;
+  context.set_deadline(std::min(
+      engine::Deadline::FromDuration(timeout_),
+      USERVER_NAMESPACE::server::request::GetTaskInheritedDeadline()));
+  AddTracingMetadata(context);
+
+  grpc::ByteBuffer response_buffer;
+  grpc::Status status;
+  const auto call = stub_->PrepareUnaryCall(
+      &context,
+      utils::StrCat("/", method->service()->full_name(), "/", method->name()),
+      request_buffer, queue_);
+  call->StartCall();
+
+  ugrpc::impl::AsyncMethodInvocation finish;
+  call->Finish(&response_buffer, &status, finish.GetTag());
+  switch (client::impl::Wait(finish, context)) {
+    case ugrpc::impl::AsyncMethodInvocation::WaitStatus::kOk:
+      break;
+    case ugrpc::impl::AsyncMethodInvocation::WaitStatus::kCancelled:
+      return MakeError(request, grpc::StatusCode::CANCELLED,
+                       "The request is cancelled");
+    case ugrpc::impl::AsyncMethodInvocation::WaitStatus::kError:
+      return MakeError(request, grpc::StatusCode::UNAVAILABLE,
+                       "The gRPC call is interrupted");
+  }
+  if (!status.ok()) {
+    return MakeError(request, status.error_code(), status.error_message());
+  }
+
+  const auto response_message = MakeMessage(*method->output_type());
+  if (const auto parse_status =
+          Serialization::Deserialize(&response_buffer, response_message.get());
+      !parse_status.ok()) {
+    return MakeError(request, parse_status.error_code(),
+                     parse_status.error_message());
+  }
+
+  formats::json::StringBuilder sw;
+  ugrpc::WriteJson(*response_message, sw);
+  return sw.GetString();
+}
+
+yaml_config::Schema JsonGatewayHandler::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: HTTP handler that exposes gRPC services as HTTP/JSON endpoints
+additionalProperties: false
+properties:
+    grpc-endpoint:
+        type: string
+        description: the gRPC server to send the requests to, 'host:port'
+    grpc-timeout:
+        type: string
+        description: timeout of the gRPC calls
+        defaultDescription: 10s
+    blocking-task-processor:
+        type: string
+        description: the task processor for blocking channel creation
+)");
+}
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
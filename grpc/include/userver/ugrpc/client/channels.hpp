@@ -47,7 +47,8 @@ std::shared_ptr<grpc::Channel> MakeChannel(
 
 /// @brief Wait until the channel state of `client` is `READY`. If the current
 /// state is already `READY`, returns `true` immediately. In case of multiple
-/// underlying channels, waits for all of them.
+/// underlying channels, waits for all of them, except for the extra channels
+/// not used yet.
 /// @returns `true` if the state changed before `deadline` expired
 /// @note The wait operation does not support task cancellations
 template <typename Client>
@@ -13,6 +13,7 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/statistics/entry.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
@@ -42,6 +43,16 @@ struct ClientFactoryConfig {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Maximum number of underlying channels for every client in this factory.
+  /// The extra channels are used once all the others have
+  /// `channel_streams_threshold` RPCs in flight. Values below `channel_count`
+  /// disable the extra channels.
+  std::size_t max_channel_count{0};
+
+  /// Number of RPCs in flight on a channel, past which an extra channel is
+  /// used, e.g. HTTP/2 MAX_CONCURRENT_STREAMS of the server
+  std::size_t channel_streams_threshold{100};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
@@ -59,6 +70,8 @@ class ClientFactory final {
                 testsuite::GrpcControl& testsuite_grpc,
                 dynamic_config::Source source);
 
+  ~ClientFactory();
+
   template <typename Client>
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
@@ -73,6 +86,7 @@ class ClientFactory final {
   ugrpc::impl::StatisticsStorage client_statistics_storage_;
   const dynamic_config::Source config_source_;
   testsuite::GrpcControl& testsuite_grpc_;
+  utils::statistics::Entry channels_statistics_holder_;
 };
 
 template <typename Client>
@@ -47,6 +47,8 @@ namespace ugrpc::client {
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// max-channel-count | Maximum number of grpc::Channel objects, the extra ones are used once all the others have `channel-streams-threshold` RPCs in flight | channel-count
+/// channel-streams-threshold | Number of RPCs in flight on a channel, past which an extra channel is used | 100
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -15,10 +15,12 @@
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/tracing/in_place_span.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/function_ref.hpp>
 
 #include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
+#include <userver/ugrpc/client/impl/hedging.hpp>
 #include <userver/ugrpc/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
 
@@ -99,6 +101,9 @@ class RpcData final {
 
   const Middlewares& GetMiddlewares() const noexcept;
 
+  /// @returns nullptr if the RPC is not hedged
+  const HedgingParams* GetHedgingParams() const noexcept;
+
   void ResetSpan() noexcept;
 
   ugrpc::impl::RpcStatisticsScope& GetStatsScope() noexcept;
@@ -147,6 +152,8 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  ChannelCache::Lease channel_lease_;
+  std::optional<HedgingParams> hedging_;
 
   std::variant<std::monostate, AsyncMethodInvocation,
                FinishAsyncMethodInvocation>
@@ -209,6 +216,19 @@ void Finish(GrpcStream& stream, RpcData& data, bool throw_on_error) {
                       std::move(finish.GetParsedGStatus()), throw_on_error);
 }
 
+/// Starts `Finish` of the attempt with the `tag`, the attempt 0 is the
+/// original one. Returns the context of the attempt.
+using HedgedFinishStarter = utils::function_ref<grpc::ClientContext&(
+    std::size_t attempt, grpc::Status& status, void* tag)>;
+
+/// Creates the context of a hedged attempt, see HedgingPolicy
+std::unique_ptr<grpc::ClientContext> MakeHedgedAttemptContext(RpcData& data);
+
+/// @brief Finishes the unary RPC according to its HedgingParams
+/// @returns the index of the attempt that has produced the result
+/// @throws the same as ProcessFinishResult
+std::size_t FinishHedged(RpcData& data, HedgedFinishStarter start_finish);
+
 void PrepareRead(RpcData& data);
 
 template <typename GrpcStream, typename Response>
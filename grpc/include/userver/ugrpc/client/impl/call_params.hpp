@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string_view>
 
 #include <grpcpp/client_context.h>
@@ -8,6 +9,7 @@
 #include <userver/dynamic_config/snapshot.hpp>
 
 #include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/impl/hedging.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/client/qos.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
@@ -24,10 +26,14 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  ChannelCache::Lease channel;
+  std::optional<HedgingParams> hedging;
 };
 
 CallParams DoCreateCallParams(const ClientData&, std::size_t method_id,
-                              std::unique_ptr<grpc::ClientContext>);
+                              std::unique_ptr<grpc::ClientContext>,
+                              const ugrpc::client::Qos& user_qos,
+                              const ugrpc::client::Qos& config_qos);
 
 template <typename ClientQosConfig>
 CallParams CreateCallParams(const ClientData& client_data,
@@ -41,15 +47,16 @@ CallParams CreateCallParams(const ClientData& client_data,
       full_name.substr(metadata.service_full_name.size() + 1);
 
   const auto& config = client_data.GetConfigSnapshot();
+  const auto& config_qos = config[client_qos][method_name];
 
   // User qos goes first
   ApplyQos(*client_context, qos, client_data.GetTestsuiteControl());
 
   // If user qos was empty update timeout from config
-  ApplyQos(*client_context, config[client_qos][method_name],
-           client_data.GetTestsuiteControl());
+  ApplyQos(*client_context, config_qos, client_data.GetTestsuiteControl());
 
-  return DoCreateCallParams(client_data, method_id, std::move(client_context));
+  return DoCreateCallParams(client_data, method_id, std::move(client_context),
+                            qos, config_qos);
 }
 
 }  // namespace ugrpc::client::impl
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -12,33 +13,63 @@
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+/// Settings of the channels created for each endpoint
+struct ChannelPoolSettings final {
+  /// Number of the channels used from the start
+  std::size_t channel_count{1};
+
+  /// Maximum number of the channels, the extra ones are used once all the
+  /// used channels have `streams_threshold` RPCs in flight
+  std::size_t max_channel_count{1};
+
+  /// Number of the RPCs in flight on a channel, past which an extra channel
+  /// is used
+  std::size_t streams_threshold{100};
+};
+
 class ChannelCache final {
  public:
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               ChannelPoolSettings settings);
 
   ~ChannelCache();
 
   class Token;
+  class Lease;
 
   // The grpc::Channel is kept in cache as long as some Token pointing to it is
   // alive.
   Token Get(const std::string& endpoint);
 
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ChannelCache& cache);
+
  private:
+  struct ChannelData final {
+    explicit ChannelData(std::shared_ptr<grpc::Channel>&& channel) noexcept
+        : channel(std::move(channel)) {}
+
+    const std::shared_ptr<grpc::Channel> channel;
+    std::atomic<std::size_t> in_flight{0};
+    std::atomic<std::uint64_t> started{0};
+  };
+
   struct CountedChannel final {
     CountedChannel(const std::string& endpoint,
                    const std::shared_ptr<grpc::ChannelCredentials>& credentials,
                    const grpc::ChannelArguments& channel_args,
-                   std::size_t count);
+                   const ChannelPoolSettings& settings);
 
-    utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    utils::FixedArray<ChannelData> channels;
+    std::atomic<std::size_t> used_count;
+    const std::size_t streams_threshold;
     std::uint64_t counter{0};
   };
 
@@ -46,8 +77,30 @@ class ChannelCache final {
 
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
-  const std::size_t channel_count_;
-  concurrent::Variable<Map> channels_;
+  const ChannelPoolSettings settings_;
+  mutable concurrent::Variable<Map> channels_;
+};
+
+/// Accounts an RPC in flight on a channel until destroyed or reset
+class ChannelCache::Lease final {
+ public:
+  Lease() noexcept = default;
+
+  Lease(Lease&&) noexcept;
+  Lease& operator=(Lease&&) noexcept;
+  ~Lease();
+
+  std::size_t GetChannelIndex() const noexcept;
+
+  void Reset() noexcept;
+
+ private:
+  friend class ChannelCache::Token;
+
+  Lease(ChannelData& channel, std::size_t index) noexcept;
+
+  ChannelData* channel_{nullptr};
+  std::size_t index_{0};
 };
 
 class ChannelCache::Token final {
@@ -62,11 +115,19 @@ class ChannelCache::Token final {
   Token& operator=(Token&&) noexcept;
   ~Token();
 
+  /// The number of all the channels, including the extra ones not used yet
   std::size_t GetChannelCount() const noexcept;
 
+  /// The number of the channels the RPCs have been made on
+  std::size_t GetUsedChannelCount() const noexcept;
+
   const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
       noexcept;
 
+  /// Picks the channel with the least RPCs in flight, starting to use an
+  /// extra channel if all the used ones are past the threshold
+  Lease AcquireChannel() const noexcept;
+
  private:
   ChannelCache* cache_{nullptr};
   const std::string* endpoint_{nullptr};
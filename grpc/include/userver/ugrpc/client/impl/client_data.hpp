@@ -10,11 +10,11 @@
 #include <userver/dynamic_config/source.hpp>
 #include <userver/testsuite/grpc_control.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
+#include <userver/ugrpc/client/impl/hedging.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/utils/fixed_array.hpp>
-#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -41,7 +41,9 @@ class ClientData final {
   template <typename Service>
   ClientData(ClientParams&& params, ugrpc::impl::StaticServiceMetadata metadata,
              std::in_place_type_t<Service>)
-      : params_(std::move(params)), metadata_(metadata) {
+      : params_(std::move(params)),
+        metadata_(metadata),
+        retry_throttles_(metadata_.method_full_names.size()) {
     const std::size_t channel_count = GetChannelToken().GetChannelCount();
     stubs_ = utils::GenerateFixedArray(channel_count, [&](std::size_t index) {
       return StubPtr(
@@ -56,10 +58,15 @@ class ClientData final {
   ClientData(const ClientData&) = delete;
   ClientData& operator=(const ClientData&) = delete;
 
+  /// Picks the least loaded channel for a new RPC
+  ChannelCache::Lease AcquireChannel() const {
+    return params_.channel_token.AcquireChannel();
+  }
+
   template <typename Service>
-  Stub<Service>& NextStub() const {
+  Stub<Service>& GetStub(const ChannelCache::Lease& channel) const {
     return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+        stubs_[channel.GetChannelIndex()].get());
   }
 
   grpc::CompletionQueue& GetQueue() const { return params_.queue; }
@@ -72,6 +79,10 @@ class ClientData final {
     return params_.statistics_storage.GetMethodStatistics(method_id);
   }
 
+  RetryThrottle& GetRetryThrottle(std::size_t method_id) const {
+    return retry_throttles_[method_id];
+  }
+
   ChannelCache::Token& GetChannelToken() { return params_.channel_token; }
 
   std::string_view GetClientName() const { return params_.client_name; }
@@ -98,6 +109,7 @@ class ClientData final {
   ClientParams params_;
   ugrpc::impl::StaticServiceMetadata metadata_;
   utils::FixedArray<StubPtr> stubs_;
+  mutable utils::FixedArray<RetryThrottle> retry_throttles_;
 };
 
 template <typename Client>
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+#include <userver/ugrpc/client/qos.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+/// @brief The token bucket of RetryThrottlingPolicy for a single method
+///
+/// The tokens are counted in thousandths, as gRPC does. The bucket starts
+/// full, so the missing tokens are stored, which also lets the policy change
+/// at runtime.
+class RetryThrottle final {
+ public:
+  /// @returns whether hedged attempts may be sent
+  bool IsAllowed(const RetryThrottlingPolicy& policy) const noexcept;
+
+  void OnSuccess(const RetryThrottlingPolicy& policy) noexcept;
+
+  void OnFailure(const RetryThrottlingPolicy& policy) noexcept;
+
+ private:
+  std::atomic<std::int64_t> missing_milli_tokens_{0};
+};
+
+struct HedgingParams final {
+  HedgingPolicy policy;
+  std::optional<RetryThrottlingPolicy> throttling;
+  RetryThrottle& throttle;
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
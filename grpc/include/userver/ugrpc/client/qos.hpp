@@ -1,11 +1,17 @@
 #pragma once
 
+/// @file userver/ugrpc/client/qos.hpp
+/// @brief @copybrief ugrpc::client::Qos
+
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <grpcpp/client_context.h>
+#include <grpcpp/support/status.h>
 
 #include <userver/formats/json_fwd.hpp>
 
@@ -17,10 +23,83 @@ class GrpcControl;
 
 namespace ugrpc::client {
 
+/// @brief Hedging of unary RPCs, the same as `hedgingPolicy` of gRPC
+///
+/// The first attempt is sent right away, each of the next ones is sent after
+/// `delay` unless some attempt has already produced the result. The first
+/// attempt that finishes with OK or with a code outside of `non_fatal_codes`
+/// produces the result of the RPC, the rest of the attempts are cancelled.
+/// An attempt that finishes with a non-fatal code immediately starts the next
+/// one.
+///
+/// Hedged attempts get the deadline, the compression algorithm and the tracing
+/// metadata of the RPC. Other metadata of the `grpc::ClientContext` is not
+/// copied, so hedging should only be enabled for idempotent methods that don't
+/// require custom metadata. Only `UnaryCall::Finish` sends hedged attempts.
+struct HedgingPolicy final {
+  /// The total number of attempts, including the original one, at most 5
+  std::size_t max_attempts{1};
+
+  /// The delay before sending the next hedged attempt
+  std::chrono::milliseconds delay{0};
+
+  /// The status codes that let the other attempts produce the result
+  std::vector<grpc::StatusCode> non_fatal_codes;
+};
+
+/// @brief Token bucket that disables hedging of a method when too many of
+/// its attempts fail, the same as `retryThrottling` of gRPC
+///
+/// The bucket starts with `max_tokens`. Each attempt that finishes with a
+/// non-fatal code takes a token, each successful attempt puts back
+/// `token_ratio` tokens. Hedged attempts are only sent while there are more
+/// than `max_tokens / 2` tokens.
+struct RetryThrottlingPolicy final {
+  double max_tokens{10};
+  double token_ratio{0.1};
+};
+
+/// @brief Quality of service settings of an RPC
+///
+/// The settings may be passed to the methods of the generated clients and
+/// may be set per method in the `GRPC_CLIENT_QOS_*` dynamic config. In the
+/// dynamic config:
+///
+/// @code{.json}
+/// {
+///   "__default__": {"timeout-ms": 1000},
+///   "SayHello": {
+///     "timeout-ms": 200,
+///     "hedging": {
+///       "max-attempts": 3,
+///       "delay-ms": 20,
+///       "non-fatal-codes": ["UNAVAILABLE"]
+///     },
+///     "retry-throttling": {"max-tokens": 10, "token-ratio": 0.1}
+///   }
+/// }
+/// @endcode
+///
+/// The fields set in the Qos passed to the client method take precedence over
+/// the ones from the dynamic config.
 struct Qos final {
   std::optional<std::chrono::milliseconds> timeout;
+  std::optional<HedgingPolicy> hedging;
+  std::optional<RetryThrottlingPolicy> retry_throttling;
 };
 
+HedgingPolicy Parse(const formats::json::Value& value,
+                    formats::parse::To<HedgingPolicy>);
+
+formats::json::Value Serialize(const HedgingPolicy& policy,
+                               formats::serialize::To<formats::json::Value>);
+
+RetryThrottlingPolicy Parse(const formats::json::Value& value,
+                            formats::parse::To<RetryThrottlingPolicy>);
+
+formats::json::Value Serialize(const RetryThrottlingPolicy& policy,
+                               formats::serialize::To<formats::json::Value>);
+
 Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>);
 
 formats::json::Value Serialize(const Qos& qos,
@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/client/rpc.hpp
 /// @brief Classes representing an outgoing RPC
 
+#include <functional>
 #include <memory>
 #include <string_view>
 #include <utility>
@@ -12,6 +13,7 @@
 
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
 #include <userver/utils/function_ref.hpp>
 
 #include <userver/ugrpc/client/exceptions.hpp>
@@ -143,6 +145,8 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ///
   /// The connection is not closed, it will be reused for new RPCs.
   ///
+  /// Sends hedged attempts if the HedgingPolicy is set for the method.
+  ///
   /// @returns the response on success
   /// @throws ugrpc::client::RpcError on an RPC error
   /// @throws ugrpc::client::RpcCancelledError on task cancellation
@@ -154,6 +158,8 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ///
   /// `Finish` and `FinishAsync` should not be called together for the same RPC.
   ///
+  /// No hedged attempts are sent, see HedgingPolicy.
+  ///
   /// @returns the future for the single response
   UnaryFuture FinishAsync(Response& response);
 
@@ -171,7 +177,11 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ~UnaryCall() = default;
 
  private:
+  Response FinishHedged();
+
   impl::RawResponseReader<Response> reader_;
+  std::function<impl::RawResponseReader<Response>(grpc::ClientContext&)>
+      start_hedged_attempt_;
 };
 
 /// @brief Controls a single request -> response stream RPC
@@ -465,16 +475,58 @@ UnaryCall<Response>::UnaryCall(
       },
       &req);
   GetData().SetWritesFinished();
+
+  if (GetData().GetHedgingParams()) {
+    start_hedged_attempt_ = [&stub, prepare_func, &queue = GetData().GetQueue(),
+                             req](grpc::ClientContext& context) {
+      auto reader = (stub.*prepare_func)(&context, req, &queue);
+      reader->StartCall();
+      return reader;
+    };
+  }
 }
 
 template <typename Response>
 Response UnaryCall<Response>::Finish() {
+  if (start_hedged_attempt_) return FinishHedged();
+
   Response response;
   UnaryFuture future = FinishAsync(response);
   future.Get();
   return response;
 }
 
+template <typename Response>
+Response UnaryCall<Response>::FinishHedged() {
+  UASSERT(reader_);
+  struct HedgedAttempt final {
+    // The reader is allocated in the arena of the call
+    std::unique_ptr<grpc::ClientContext> context;
+    impl::RawResponseReader<Response> reader;
+    Response response;
+  };
+
+  Response response;
+  utils::FixedArray<HedgedAttempt> hedges(
+      GetData().GetHedgingParams()->policy.max_attempts - 1);
+  const auto result = impl::FinishHedged(
+      GetData(),
+      [&](std::size_t attempt, grpc::Status& status,
+          void* tag) -> grpc::ClientContext& {
+        if (attempt == 0) {
+          reader_->Finish(&response, &status, tag);
+          return GetData().GetContext();
+        }
+        auto& hedge = hedges[attempt - 1];
+        hedge.context = impl::MakeHedgedAttemptContext(GetData());
+        hedge.reader = start_hedged_attempt_(*hedge.context);
+        hedge.reader->Finish(&hedge.response, &status, tag);
+        return *hedge.context;
+      });
+  if (result != 0) return std::move(hedges[result - 1].response);
+  return response;
+}
+
 template <typename Response>
 UnaryFuture UnaryCall<Response>::FinishAsync(Response& response) {
   UASSERT(reader_);
@@ -3,6 +3,8 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/engine/single_use_event.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -10,12 +12,20 @@ namespace ugrpc::impl {
 
 class QueueRunner final {
  public:
+  /// Polls the queue in a dedicated thread
   explicit QueueRunner(grpc::CompletionQueue& queue);
+
+  /// Polls the queue in a task of `task_processor`, occupying one of its
+  /// worker threads
+  QueueRunner(grpc::CompletionQueue& queue,
+              engine::TaskProcessor& task_processor);
+
   ~QueueRunner();
 
  private:
   grpc::CompletionQueue& queue_;
   engine::SingleUseEvent completion_;
+  engine::TaskWithResult<void> polling_task_;
 };
 
 }  // namespace ugrpc::impl
@@ -45,6 +45,12 @@ class MethodStatistics final {
 
   void AccountCancelled() noexcept;
 
+  void AccountHedgeSent() noexcept;
+
+  void AccountHedgeWon() noexcept;
+
+  void AccountHedgeCancelled() noexcept;
+
   friend void DumpMetric(utils::statistics::Writer& writer,
                          const MethodStatistics& stats);
 
@@ -66,6 +72,10 @@ class MethodStatistics final {
 
   RateCounter deadline_updated_{0};
   RateCounter deadline_cancelled_{0};
+
+  RateCounter hedges_sent_{0};
+  RateCounter hedges_won_{0};
+  RateCounter hedges_cancelled_{0};
 };
 
 class ServiceStatistics final {
@@ -28,6 +28,12 @@ class RpcStatisticsScope final {
 
   void OnNetworkError();
 
+  void OnHedgeSent();
+
+  void OnHedgeWon();
+
+  void OnHedgeCancelled();
+
   void Flush();
 
  private:
@@ -1,12 +1,16 @@
 #pragma once
 
 /// @file userver/ugrpc/proto_json.hpp
-/// @brief Utilities for conversion Protobuf -> Json
+/// @brief Utilities for conversion Protobuf <-> Json
+
+#include <string_view>
+#include <type_traits>
 
 #include <google/protobuf/util/json_util.h>
 
 #include <userver/formats/json.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,6 +27,22 @@ std::string ToString(const google::protobuf::Message& message);
 /// @throws formats::json::ConversionException
 std::string ToJsonString(const google::protobuf::Message& message);
 
+/// @brief Writes the Json representation of protobuf message right into the
+/// formats::json::StringBuilder, without building formats::json::Value.
+///
+/// The output is the same as of ToJsonString. The well-known types of
+/// google.protobuf are written by ToJsonString.
+void WriteJson(const google::protobuf::Message& message,
+               formats::json::StringBuilder& sw);
+
+/// @brief Parses the Json representation of protobuf message into `message`
+/// with the SAX parser, without building formats::json::Value.
+///
+/// The parsed fields are merged into the message, the unknown fields are an
+/// error. The well-known types of google.protobuf are parsed by protobuf.
+/// @throws formats::json::Exception
+void JsonToMessage(std::string_view json, google::protobuf::Message& message);
+
 }  // namespace ugrpc
 
 namespace formats::serialize {
@@ -30,6 +50,13 @@ namespace formats::serialize {
 json::Value Serialize(const google::protobuf::Message& message,
                       To<json::Value>);
 
+/// SAX serialization of protobuf messages, see ugrpc::WriteJson
+template <typename Message>
+std::enable_if_t<std::is_base_of_v<google::protobuf::Message, Message>>
+WriteToStream(const Message& message, json::StringBuilder& sw) {
+  ugrpc::WriteJson(message, sw);
+}
+
 }  // namespace formats::serialize
 
 USERVER_NAMESPACE_END
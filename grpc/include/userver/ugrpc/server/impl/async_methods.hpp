@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <utility>
 
@@ -8,6 +10,8 @@
 #include <grpcpp/impl/codegen/async_unary_call.h>
 #include <grpcpp/impl/codegen/status.h>
 
+#include <userver/utils/span.hpp>
+
 #include <userver/ugrpc/server/exceptions.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 
@@ -42,6 +46,20 @@ void ThrowOnError(impl::AsyncMethodInvocation::WaitStatus status,
 extern const grpc::Status kUnimplementedStatus;
 extern const grpc::Status kUnknownErrorStatus;
 
+/// Picks the writes of a stream that may stay in the buffer of gRPC
+class WriteCoalescing final {
+ public:
+  /// Buffers the writes until `flush_interval` passes since the last flush
+  void SetFlushInterval(std::chrono::milliseconds flush_interval);
+
+  /// @returns the options of the next write
+  grpc::WriteOptions NextWriteOptions();
+
+ private:
+  std::optional<std::chrono::milliseconds> flush_interval_;
+  std::chrono::steady_clock::time_point last_flush_;
+};
+
 template <typename GrpcStream, typename Response>
 void Finish(GrpcStream& stream, const Response& response,
             const grpc::Status& status, std::string_view call_name) {
@@ -104,6 +122,21 @@ void Write(GrpcStream& stream, const Response& response,
   ThrowOnError(Wait(write), call_name, "Write");
 }
 
+template <typename GrpcStream, typename Response>
+void WriteMany(GrpcStream& stream, utils::span<const Response> responses,
+               WriteCoalescing& coalescing, std::string_view call_name) {
+  if (responses.empty()) return;
+
+  // gRPC permits a single outstanding write, but the buffered ones complete
+  // without waiting for the transport
+  const auto last = responses.size() - 1;
+  for (std::size_t i = 0; i < last; ++i) {
+    Write(stream, responses[i], grpc::WriteOptions{}.set_buffer_hint(),
+          call_name);
+  }
+  Write(stream, responses[last], coalescing.NextWriteOptions(), call_name);
+}
+
 template <typename GrpcStream, typename Response>
 void WriteAndFinish(GrpcStream& stream, const Response& response,
                     grpc::WriteOptions options, const grpc::Status& status,
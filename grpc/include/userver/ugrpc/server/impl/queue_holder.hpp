@@ -4,6 +4,7 @@
 
 #include <grpcpp/server_builder.h>
 
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -17,7 +18,10 @@ namespace ugrpc::server::impl {
 /// instances are destroyed.
 class QueueHolder final {
  public:
-  explicit QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder);
+  /// @param task_processor if set, the queues are polled in its tasks instead
+  /// of the dedicated threads
+  QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder,
+              engine::TaskProcessor* task_processor = nullptr);
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
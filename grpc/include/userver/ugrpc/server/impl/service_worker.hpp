@@ -2,7 +2,9 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <grpcpp/completion_queue.h>
@@ -31,6 +33,7 @@ struct ServiceSettings final {
   Middlewares middlewares;
   logging::LoggerPtr access_tskv_logger;
   const dynamic_config::Source config_source;
+  std::unordered_map<std::string, std::size_t> arena_block_sizes;
 };
 
 /// @brief Listens to requests for a gRPC service, forwarding them to a
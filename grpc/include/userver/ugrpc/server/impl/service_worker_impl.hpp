@@ -1,13 +1,17 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <functional>
+#include <initializer_list>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -55,6 +59,16 @@ void ReportCustomError(
 void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
                grpc::ServerContext& context, std::string_view call_name);
 
+/// @throws std::runtime_error if `arena_block_sizes` mentions a method missing
+/// from the service or a streaming one
+void ValidateArenaBlockSizes(const ServiceSettings& settings,
+                             const ugrpc::impl::StaticServiceMetadata& metadata,
+                             std::initializer_list<bool> are_methods_unary);
+
+/// @returns 0 if the requests of the method are allocated on heap
+std::size_t GetArenaBlockSize(const ServiceSettings& settings,
+                              std::string_view method_name);
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
@@ -90,6 +104,8 @@ struct MethodData final {
       call_name.substr(service_data.metadata.service_full_name.size() + 1)};
   ugrpc::impl::MethodStatistics& statistics{
       service_data.statistics.GetMethodStatistics(method_id)};
+  std::size_t arena_block_size{
+      GetArenaBlockSize(service_data.settings, method_name)};
 };
 
 template <typename GrpcppService, typename CallTraits>
@@ -100,6 +116,17 @@ class CallData final {
         method_data_(method_data) {
     UASSERT(method_data.method_id <
             method_data.service_data.metadata.method_full_names.size());
+    if constexpr (CallTraits::kCallCategory == CallCategory::kUnary) {
+      if (method_data_.arena_block_size != 0) {
+        google::protobuf::ArenaOptions options;
+        options.start_block_size = method_data_.arena_block_size;
+        options.max_block_size =
+            std::max(options.start_block_size, options.max_block_size);
+        arena_.emplace(options);
+        initial_request_ =
+            google::protobuf::Arena::CreateMessage<InitialRequest>(&*arena_);
+      }
+    }
   }
 
   void operator()() && {
@@ -118,7 +145,7 @@ class CallData final {
         method_data_.queue_num);
 
     method_data_.service_data.async_service.template Prepare<CallTraits>(
-        method_data_.method_id, context_, initial_request_, raw_responder_,
+        method_data_.method_id, context_, *initial_request_, raw_responder_,
         queue, queue, prepare_.GetTag());
 
     // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -174,21 +201,22 @@ class CallData final {
 
     auto& access_tskv_logger =
         method_data_.service_data.settings.access_tskv_logger;
-    Call responder(CallParams{context_, call_name, statistics_scope,
-                              *access_tskv_logger, span_->Get()},
-                   raw_responder_);
+    Call responder(
+        CallParams{context_, call_name, statistics_scope, *access_tskv_logger,
+                   span_->Get(), arena_ ? &*arena_ : nullptr},
+        raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
         (service.*service_method)(responder);
       } else {
-        (service.*service_method)(responder, std::move(initial_request_));
+        (service.*service_method)(responder, std::move(*initial_request_));
       }
     };
 
     try {
       ::google::protobuf::Message* initial_request = nullptr;
       if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-        initial_request = &initial_request_;
+        initial_request = initial_request_;
       }
 
       auto& middlewares = method_data_.service_data.settings.middlewares;
@@ -215,7 +243,10 @@ class CallData final {
   MethodData<GrpcppService, CallTraits> method_data_;
 
   grpc::ServerContext context_{};
-  InitialRequest initial_request_{};
+  // Owns 'initial_request_' if the method uses an arena
+  std::optional<google::protobuf::Arena> arena_;
+  InitialRequest initial_request_storage_{};
+  InitialRequest* initial_request_{&initial_request_storage_};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -237,7 +268,11 @@ class ServiceWorkerImpl final : public ServiceWorker {
                   service_methods}),
              ...);
           }
-        }} {}
+        }} {
+    ValidateArenaBlockSizes(
+        service_data_.settings, service_data_.metadata,
+        {CallTraits<ServiceMethods>::kCallCategory == CallCategory::kUnary...});
+  }
 
   ~ServiceWorkerImpl() override {
     service_data_.wait_tokens.WaitForAllTokens();
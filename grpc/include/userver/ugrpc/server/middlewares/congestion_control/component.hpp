@@ -13,9 +13,40 @@ namespace ugrpc::server::middlewares::congestion_control {
 
 class Middleware;
 
+// clang-format off
+
 /// @ingroup userver_components userver_base_classes
 ///
-/// @brief Component for gRPC server logging
+/// @brief Component for gRPC server congestion control
+///
+/// Rejects the calls with RESOURCE_EXHAUSTED:
+/// * when the server-wide limit of congestion_control::Component is exceeded;
+/// * when the method already handles `max-concurrent-calls` calls;
+/// * when less than `min-deadline-left` is left until the deadline of the call,
+///   e.g. because the call has been waiting in the queues for too long. Such
+///   calls are most likely to fail anyway, and the client may have already
+///   given up.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// max-concurrent-calls | max number of the concurrent calls of each method, 0 means no limit | 0
+/// max-concurrent-calls-by-name | overrides of max-concurrent-calls by 'Service/Method' or by 'Service' names, the limit of a service is shared by all of its methods | {}
+/// min-deadline-left | the calls with less time left until their deadline are rejected | the calls are not rejected by deadline
+///
+/// ## Static configuration example:
+///
+/// @code
+/// grpc-server-congestion-control:
+///     max-concurrent-calls: 1000
+///     max-concurrent-calls-by-name:
+///         sample.ugrpc.GreeterService/SayHello: 100
+///         sample.ugrpc.OtherService: 50
+///     min-deadline-left: 10ms
+/// @endcode
+
+// clang-format on
+
 class Component final : public MiddlewareComponentBase {
  public:
   /// @ingroup userver_component_names
@@ -3,10 +3,13 @@
 /// @file userver/ugrpc/server/rpc.hpp
 /// @brief Classes representing an incoming RPC
 
+#include <chrono>
+
 #include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
 
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
@@ -64,6 +67,8 @@ class CallAnyBase {
 
   logging::LoggerRef AccessTskvLogger() { return params_.access_tskv_logger; }
 
+  google::protobuf::Arena* Arena() const { return params_.arena; }
+
   void LogFinish(grpc::Status status) const;
 
  private:
@@ -92,6 +97,16 @@ class UnaryCall final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void FinishWithError(const grpc::Status& status) override;
 
+  /// @brief The protobuf arena of this RPC, which also holds the request
+  ///
+  /// The messages created on the arena, e.g. a large response for `Finish`,
+  /// avoid the heap allocations of their fields and are all freed at once
+  /// after the RPC completes.
+  ///
+  /// @returns nullptr unless `arena-block-sizes` of the service is set for
+  /// the method
+  google::protobuf::Arena* GetArena() const { return Arena(); }
+
   /// For internal use only
   UnaryCall(impl::CallParams&& call_params,
             impl::RawResponseWriter<Response>& stream);
@@ -172,6 +187,27 @@ class OutputStream final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Write several messages, letting gRPC pack them into fewer
+  /// HTTP/2 frames
+  ///
+  /// All the messages but the last one are written with
+  /// `grpc::WriteOptions::set_buffer_hint`, the last one flushes them unless
+  /// the write buffering is enabled, see `SetWriteBuffering`.
+  ///
+  /// @param responses the next messages to write
+  /// @throws ugrpc::server::RpcError on an RPC error
+  void WriteMany(utils::span<const Response> responses);
+
+  /// @brief Let gRPC coalesce the messages of `Write` and `WriteMany`
+  ///
+  /// The messages stay in the buffer of gRPC until a write that takes place
+  /// `flush_interval` or more after the previous flush, or until `Finish`.
+  /// The last messages may be delayed until the next write, so this is meant
+  /// for streams that keep writing, e.g. for streams of many small events.
+  ///
+  /// @param flush_interval how long the messages may be buffered
+  void SetWriteBuffering(std::chrono::milliseconds flush_interval);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -212,6 +248,7 @@ class OutputStream final : public CallAnyBase {
 
   impl::RawWriter<Response>& stream_;
   State state_{State::kNew};
+  impl::WriteCoalescing write_coalescing_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -236,6 +273,27 @@ class BidirectionalStream : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Write several messages, letting gRPC pack them into fewer
+  /// HTTP/2 frames
+  ///
+  /// All the messages but the last one are written with
+  /// `grpc::WriteOptions::set_buffer_hint`, the last one flushes them unless
+  /// the write buffering is enabled, see `SetWriteBuffering`.
+  ///
+  /// @param responses the next messages to write
+  /// @throws ugrpc::server::RpcError on an RPC error
+  void WriteMany(utils::span<const Response> responses);
+
+  /// @brief Let gRPC coalesce the messages of `Write` and `WriteMany`
+  ///
+  /// The messages stay in the buffer of gRPC until a write that takes place
+  /// `flush_interval` or more after the previous flush, or until `Finish`.
+  /// The last messages may be delayed until the next write, so this is meant
+  /// for streams that keep writing, e.g. for streams of many small events.
+  ///
+  /// @param flush_interval how long the messages may be buffered
+  void SetWriteBuffering(std::chrono::milliseconds flush_interval);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -276,6 +334,7 @@ class BidirectionalStream : public CallAnyBase {
 
   impl::RawReaderWriter<Request, Response>& stream_;
   State state_{State::kOpen};
+  impl::WriteCoalescing write_coalescing_;
 };
 
 // ========================== Implementation follows ==========================
@@ -394,11 +453,24 @@ void OutputStream<Response>::Write(const Response& response) {
   // streams
   impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  impl::Write(stream_, response, write_coalescing_.NextWriteOptions(),
+              GetCallName());
+}
+
+template <typename Response>
+void OutputStream<Response>::WriteMany(utils::span<const Response> responses) {
+  UINVARIANT(state_ != State::kFinished,
+             "'WriteMany' called on a finished stream");
+
+  impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
+
+  impl::WriteMany(stream_, responses, write_coalescing_, GetCallName());
+}
 
-  impl::Write(stream_, response, write_options, GetCallName());
+template <typename Response>
+void OutputStream<Response>::SetWriteBuffering(
+    std::chrono::milliseconds flush_interval) {
+  write_coalescing_.SetFlushInterval(flush_interval);
 }
 
 template <typename Response>
@@ -475,10 +547,24 @@ template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(const Response& response) {
   UINVARIANT(state_ != State::kFinished, "'Write' called on a finished stream");
 
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes by default, optimize for ping-pong-style interaction
+  impl::Write(stream_, response, write_coalescing_.NextWriteOptions(),
+              GetCallName());
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::WriteMany(
+    utils::span<const Response> responses) {
+  UINVARIANT(state_ != State::kFinished,
+             "'WriteMany' called on a finished stream");
 
-  impl::Write(stream_, response, write_options, GetCallName());
+  impl::WriteMany(stream_, responses, write_coalescing_, GetCallName());
+}
+
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::SetWriteBuffering(
+    std::chrono::milliseconds flush_interval) {
+  write_coalescing_.SetFlushInterval(flush_interval);
 }
 
 template <typename Request, typename Response>
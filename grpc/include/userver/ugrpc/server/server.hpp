@@ -37,6 +37,13 @@ struct ServerConfig final {
   /// of worker threads for best RPS.
   int completion_queue_num{2};
 
+  /// If set, the completion queues are polled by the tasks of this task
+  /// processor instead of the dedicated threads, so that the completion events
+  /// are dispatched to the coroutines without a hop through an extra thread
+  /// when the services run on the same task processor. Each queue occupies one
+  /// worker thread of the task processor.
+  engine::TaskProcessor* completion_queue_task_processor{nullptr};
+
   /// Optional grpc-core channel args
   /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
   std::unordered_map<std::string, std::string> channel_args{};
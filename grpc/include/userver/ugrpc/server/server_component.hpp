@@ -29,6 +29,7 @@ struct ServiceDefaults;
 /// access-tskv-logger | logger name for access-tskv.log | -
 /// port | the port to use for all gRPC services, or 0 to pick any available | -
 /// completion-queue-count | count of completion queues to create | 2
+/// completion-queue-task-processor | task processor to poll the completion queues in, each queue occupies one of its worker threads | dedicated threads
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
@@ -3,6 +3,10 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/ugrpc/server/impl/service_worker.hpp>
@@ -19,6 +23,10 @@ struct ServiceConfig final {
 
   /// Server middlewares to use for the gRPC service.
   Middlewares middlewares;
+
+  /// Initial block sizes of the per-call protobuf arenas by the names of the
+  /// unary methods. The requests of the other methods are allocated on heap.
+  std::unordered_map<std::string, std::size_t> arena_block_sizes{};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -28,6 +28,7 @@ class ServerComponent;
 /// ---- | ----------- | -------------
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// middlewares | middleware component names to use for each RPC call, can be empty array ([]) | taken from grpc-server.service-defaults
+/// arena-block-sizes | initial block sizes of the per-call protobuf arenas by the names of the unary methods, see ugrpc::server::UnaryCall::GetArena | {}
 
 // clang-format on
 
@@ -1,5 +1,6 @@
 #include <userver/ugrpc/client/client_factory.hpp>
 
+#include <algorithm>
 #include <optional>
 #include <stdexcept>
 
@@ -7,6 +8,8 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/logging/level_serialization.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -80,6 +83,11 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
       value["native-log-level"].As<logging::Level>(config.native_log_level);
   config.channel_count =
       value["channel-count"].As<std::size_t>(config.channel_count);
+  config.max_channel_count =
+      value["max-channel-count"].As<std::size_t>(config.max_channel_count);
+  config.channel_streams_threshold =
+      value["channel-streams-threshold"].As<std::size_t>(
+          config.channel_streams_threshold);
 
   return config;
 }
@@ -97,14 +105,26 @@ ClientFactory::ClientFactory(ClientFactoryConfig&& config,
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? config.credentials
                          : grpc::InsecureChannelCredentials(),
-                     config.channel_args, config.channel_count),
+                     config.channel_args,
+                     impl::ChannelPoolSettings{
+                         config.channel_count,
+                         std::max(config.channel_count,
+                                  config.max_channel_count),
+                         config.channel_streams_threshold,
+                     }),
       client_statistics_storage_(statistics_storage, "client"),
       config_source_(source),
       testsuite_grpc_(testsuite_grpc) {
   ugrpc::impl::SetupNativeLogging();
   ugrpc::impl::UpdateNativeLogLevel(config.native_log_level);
+  channels_statistics_holder_ = statistics_storage.RegisterWriter(
+      "grpc.client.channels", [this](utils::statistics::Writer& writer) {
+        writer = channel_cache_;
+      });
 }
 
+ClientFactory::~ClientFactory() { channels_statistics_holder_.Unregister(); }
+
 impl::ChannelCache::Token ClientFactory::GetChannel(
     const std::string& endpoint) {
   // Spawn a blocking task creating a gRPC channel
@@ -95,6 +95,20 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    max-channel-count:
+        type: integer
+        description: |
+            Maximum number of channels for each endpoint. The extra channels
+            connect once all the others have channel-streams-threshold RPCs
+            in flight.
+        defaultDescription: channel-count
+    channel-streams-threshold:
+        type: integer
+        description: |
+            Number of RPCs in flight on a channel, past which an extra channel
+            is used. Should not exceed MAX_CONCURRENT_STREAMS of the server.
+        defaultDescription: 100
+        minimum: 1
     middlewares:
         type: array
         items:
@@ -24,6 +24,16 @@ namespace ugrpc::client::impl {
 
 namespace {
 
+void AddTracingMetadata(grpc::ClientContext& context,
+                        const tracing::Span& span) {
+  context.AddMetadata(ugrpc::impl::kXYaTraceId,
+                      ugrpc::impl::ToGrpcString(span.GetTraceId()));
+  context.AddMetadata(ugrpc::impl::kXYaSpanId,
+                      ugrpc::impl::ToGrpcString(span.GetSpanId()));
+  context.AddMetadata(ugrpc::impl::kXYaRequestId,
+                      ugrpc::impl::ToGrpcString(span.GetLink()));
+}
+
 void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
                grpc::ClientContext& context, std::string_view call_name) {
   UASSERT(!span_holder);
@@ -33,12 +43,7 @@ void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
 
   span.DetachFromCoroStack();
 
-  context.AddMetadata(ugrpc::impl::kXYaTraceId,
-                      ugrpc::impl::ToGrpcString(span.GetTraceId()));
-  context.AddMetadata(ugrpc::impl::kXYaSpanId,
-                      ugrpc::impl::ToGrpcString(span.GetSpanId()));
-  context.AddMetadata(ugrpc::impl::kXYaRequestId,
-                      ugrpc::impl::ToGrpcString(span.GetLink()));
+  AddTracingMetadata(context, span);
 }
 
 void SetStatusDetailsForSpan(RpcData& data, grpc::Status& status,
@@ -93,7 +98,9 @@ RpcData::RpcData(impl::CallParams&& params)
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      channel_lease_(std::move(params.channel)),
+      hedging_(std::move(params.hedging)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_);
@@ -134,6 +141,11 @@ const Middlewares& RpcData::GetMiddlewares() const noexcept {
   return mws_;
 }
 
+const HedgingParams* RpcData::GetHedgingParams() const noexcept {
+  UASSERT(context_);
+  return hedging_ ? &*hedging_ : nullptr;
+}
+
 std::string_view RpcData::GetCallName() const noexcept {
   UASSERT(context_);
   return call_name_;
@@ -165,6 +177,7 @@ void RpcData::SetFinished() noexcept {
   UASSERT(context_);
   UINVARIANT(!is_finished_, "Tried to finish already finished call");
   is_finished_ = true;
+  channel_lease_.Reset();
 }
 
 bool RpcData::IsFinished() const noexcept {
@@ -277,6 +290,15 @@ void ProcessFinishResult(RpcData& data,
   }
 }
 
+std::unique_ptr<grpc::ClientContext> MakeHedgedAttemptContext(RpcData& data) {
+  const auto& original = data.GetContext();
+  auto context = std::make_unique<grpc::ClientContext>();
+  context->set_deadline(original.deadline());
+  context->set_compression_algorithm(original.compression_algorithm());
+  AddTracingMetadata(*context, data.GetSpan());
+  return context;
+}
+
 void PrepareRead(RpcData& data) {
   UINVARIANT(!data.IsFinished(), "'Read' called on a finished call");
 }
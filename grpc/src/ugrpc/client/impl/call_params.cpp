@@ -4,16 +4,40 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+namespace {
+
+std::optional<HedgingParams> MakeHedgingParams(const ClientData& client_data,
+                                               std::size_t method_id,
+                                               const Qos& user_qos,
+                                               const Qos& config_qos) {
+  // User qos goes first
+  const auto& hedging =
+      user_qos.hedging ? user_qos.hedging : config_qos.hedging;
+  if (!hedging || hedging->max_attempts <= 1) return std::nullopt;
+
+  const auto& throttling = user_qos.retry_throttling
+                               ? user_qos.retry_throttling
+                               : config_qos.retry_throttling;
+  return HedgingParams{*hedging, throttling,
+                       client_data.GetRetryThrottle(method_id)};
+}
+
+}  // namespace
+
 CallParams DoCreateCallParams(const ClientData& client_data,
                               std::size_t method_id,
-                              std::unique_ptr<grpc::ClientContext> context) {
+                              std::unique_ptr<grpc::ClientContext> context,
+                              const Qos& user_qos, const Qos& config_qos) {
   return CallParams{client_data.GetClientName(),
                     client_data.GetQueue(),
                     client_data.GetConfigSnapshot(),
                     client_data.GetMetadata().method_full_names[method_id],
                     std::move(context),
                     client_data.GetStatistics(method_id),
-                    client_data.GetMiddlewares()};
+                    client_data.GetMiddlewares(),
+                    client_data.AcquireChannel(),
+                    MakeHedgingParams(client_data, method_id, user_qos,
+                                      config_qos)};
 }
 
 }  // namespace ugrpc::client::impl
@@ -1,12 +1,16 @@
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 
 #include <algorithm>
+#include <string>
 #include <utility>
 
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/to_string.hpp>
 
@@ -47,7 +51,7 @@ const std::shared_ptr<grpc::Channel>& ChannelCache::Token::GetChannel(
     std::size_t index) const noexcept {
   UASSERT(counted_channel_);
   UASSERT(index < counted_channel_->channels.size());
-  return counted_channel_->channels[index];
+  return counted_channel_->channels[index].channel;
 }
 
 std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
@@ -55,25 +59,110 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
   return counted_channel_->channels.size();
 }
 
+std::size_t ChannelCache::Token::GetUsedChannelCount() const noexcept {
+  UASSERT(counted_channel_);
+  return counted_channel_->used_count.load();
+}
+
+ChannelCache::Lease ChannelCache::Token::AcquireChannel() const noexcept {
+  UASSERT(counted_channel_);
+  auto& channels = counted_channel_->channels;
+  auto used_count = counted_channel_->used_count.load();
+
+  // Starts from a random channel, so that the ties are broken evenly
+  const auto start = utils::RandRange(used_count);
+  auto best = start;
+  auto best_in_flight = channels[best].in_flight.load();
+  for (std::size_t i = 1; i < used_count && best_in_flight != 0; ++i) {
+    const auto index = (start + i) % used_count;
+    const auto in_flight = channels[index].in_flight.load();
+    if (in_flight < best_in_flight) {
+      best = index;
+      best_in_flight = in_flight;
+    }
+  }
+
+  while (best_in_flight >= counted_channel_->streams_threshold &&
+         used_count < channels.size()) {
+    if (counted_channel_->used_count.compare_exchange_weak(used_count,
+                                                           used_count + 1)) {
+      best = used_count;
+      break;
+    }
+    // A concurrent RPC has started using an extra channel, which may do
+    const auto last = used_count - 1;
+    const auto in_flight = channels[last].in_flight.load();
+    if (in_flight < best_in_flight) {
+      best = last;
+      best_in_flight = in_flight;
+    }
+  }
+
+  return Lease{channels[best], best};
+}
+
+ChannelCache::Lease::Lease(ChannelData& channel, std::size_t index) noexcept
+    : channel_(&channel), index_(index) {
+  ++channel.in_flight;
+  ++channel.started;
+}
+
+ChannelCache::Lease::Lease(Lease&& other) noexcept
+    : channel_(std::exchange(other.channel_, nullptr)),
+      index_(other.index_) {}
+
+ChannelCache::Lease& ChannelCache::Lease::operator=(Lease&& other) noexcept {
+  std::swap(channel_, other.channel_);
+  std::swap(index_, other.index_);
+  return *this;
+}
+
+ChannelCache::Lease::~Lease() { Reset(); }
+
+std::size_t ChannelCache::Lease::GetChannelIndex() const noexcept {
+  UASSERT(channel_);
+  return index_;
+}
+
+void ChannelCache::Lease::Reset() noexcept {
+  if (channel_) {
+    --channel_->in_flight;
+    channel_ = nullptr;
+  }
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
-  const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
-  channels = utils::GenerateFixedArray(count, [&](std::size_t) {
-    return grpc::CreateCustomChannel(endpoint_string, credentials,
-                                     channel_args);
-  });
-  UASSERT(count > 0);
+    const grpc::ChannelArguments& channel_args,
+    const ChannelPoolSettings& settings)
+    : channels(utils::GenerateFixedArray(
+          settings.max_channel_count,
+          [&, endpoint_string = ugrpc::impl::ToGrpcString(endpoint)](
+              std::size_t) {
+            // The channels connect lazily, so the extra ones stay idle until
+            // used
+            return ChannelData{grpc::CreateCustomChannel(
+                endpoint_string, credentials, channel_args)};
+          })),
+      used_count(settings.channel_count),
+      streams_threshold(settings.streams_threshold) {
+  UASSERT(settings.channel_count > 0);
+  UASSERT(settings.channel_count <= settings.max_channel_count);
 }
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, ChannelPoolSettings settings)
     : credentials_(std::move(credentials)),
       channel_args_(channel_args),
-      channel_count_(channel_count) {
-  UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
+      settings_(settings) {
+  UINVARIANT(settings_.channel_count > 0,
+             "Channels count must be greater than zero");
+  UINVARIANT(settings_.channel_count <= settings_.max_channel_count,
+             "Max channels count must not be less than channels count");
+  UINVARIANT(settings_.streams_threshold > 0,
+             "Channel streams threshold must be greater than zero");
 }
 
 ChannelCache::~ChannelCache() = default;
@@ -81,10 +170,28 @@ ChannelCache::~ChannelCache() = default;
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   auto channels = channels_.Lock();
   const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_,
-                                             channel_args_, channel_count_);
+                                             channel_args_, settings_);
   return {*this, it->first, it->second};
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ChannelCache& cache) {
+  const auto channels = cache.channels_.Lock();
+  for (const auto& [endpoint, counted_channel] : *channels) {
+    writer["used-channels"].ValueWithLabels(counted_channel.used_count.load(),
+                                            {"grpc_endpoint", endpoint});
+    for (std::size_t i = 0; i < counted_channel.channels.size(); ++i) {
+      const auto& channel = counted_channel.channels[i];
+      const auto index = std::to_string(i);
+      writer["active"].ValueWithLabels(
+          channel.in_flight.load(),
+          {{"grpc_endpoint", endpoint}, {"grpc_channel", index}});
+      writer["rps"].ValueWithLabels(
+          utils::statistics::Rate{channel.started.load()},
+          {{"grpc_endpoint", endpoint}, {"grpc_channel", index}});
+    }
+  }
+}
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
@@ -6,7 +6,9 @@ namespace ugrpc::client::impl {
 
 const dynamic_config::Key<ClientQos> kNoClientQos{
     dynamic_config::ConstantConfig{},
-    ClientQos{{"__default__", {/*timeout=*/std::nullopt}}},
+    ClientQos{{"__default__",
+               {/*timeout=*/std::nullopt, /*hedging=*/std::nullopt,
+                /*retry_throttling=*/std::nullopt}}},
 };
 
 }  // namespace ugrpc::client::impl
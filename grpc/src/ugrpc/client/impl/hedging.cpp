@@ -0,0 +1,205 @@
+#include <userver/ugrpc/client/impl/hedging.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/impl/async_methods.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+namespace {
+
+constexpr std::int64_t kMilliTokensPerToken = 1000;
+
+std::int64_t ToMilliTokens(double tokens) noexcept {
+  return std::llround(tokens * kMilliTokensPerToken);
+}
+
+template <typename Func>
+void UpdateMissingTokens(std::atomic<std::int64_t>& missing, Func func) {
+  auto current = missing.load(std::memory_order_relaxed);
+  while (!missing.compare_exchange_weak(current, func(current),
+                                        std::memory_order_relaxed)) {
+  }
+}
+
+/// Finish of a hedged attempt, also wakes up the task waiting for any attempt
+class HedgedFinishInvocation final : public AsyncMethodInvocation {
+ public:
+  explicit HedgedFinishInvocation(
+      const std::shared_ptr<engine::SingleConsumerEvent>& any_finished)
+      : any_finished_(any_finished) {}
+
+  // Notify accesses the members, so the base destructor is too late to wait
+  ~HedgedFinishInvocation() override { WaitWhileBusy(); }
+
+  void Notify(bool ok) noexcept override {
+    // 'this' may be destroyed as soon as the base Notify returns
+    const auto any_finished = any_finished_;
+    AsyncMethodInvocation::Notify(ok);
+    any_finished->Send();
+  }
+
+ private:
+  std::shared_ptr<engine::SingleConsumerEvent> any_finished_;
+};
+
+struct HedgedAttempt final {
+  explicit HedgedAttempt(
+      const std::shared_ptr<engine::SingleConsumerEvent>& any_finished)
+      : finish(any_finished) {}
+
+  // The destructor of 'finish' waits for the attempt
+  ~HedgedAttempt() {
+    if (context && !is_finished) context->TryCancel();
+  }
+
+  HedgedFinishInvocation finish;
+  grpc::Status status;
+  grpc::ClientContext* context{nullptr};
+  bool is_finished{false};
+};
+
+bool IsNonFatal(const HedgingPolicy& policy, grpc::StatusCode code) {
+  return std::find(policy.non_fatal_codes.begin(),
+                   policy.non_fatal_codes.end(),
+                   code) != policy.non_fatal_codes.end();
+}
+
+}  // namespace
+
+bool RetryThrottle::IsAllowed(
+    const RetryThrottlingPolicy& policy) const noexcept {
+  return missing_milli_tokens_.load(std::memory_order_relaxed) <
+         ToMilliTokens(policy.max_tokens) / 2;
+}
+
+void RetryThrottle::OnSuccess(const RetryThrottlingPolicy& policy) noexcept {
+  const auto ratio = ToMilliTokens(policy.token_ratio);
+  UpdateMissingTokens(missing_milli_tokens_, [ratio](std::int64_t missing) {
+    return std::max<std::int64_t>(missing - ratio, 0);
+  });
+}
+
+void RetryThrottle::OnFailure(const RetryThrottlingPolicy& policy) noexcept {
+  const auto max_tokens = ToMilliTokens(policy.max_tokens);
+  UpdateMissingTokens(missing_milli_tokens_,
+                      [max_tokens](std::int64_t missing) {
+                        return std::min(missing + kMilliTokensPerToken,
+                                        max_tokens);
+                      });
+}
+
+std::size_t FinishHedged(RpcData& data, HedgedFinishStarter start_finish) {
+  const auto* const params = data.GetHedgingParams();
+  UASSERT(params);
+  const auto& policy = params->policy;
+  auto& stats = data.GetStatsScope();
+
+  PrepareFinish(data);
+
+  const auto any_finished = std::make_shared<engine::SingleConsumerEvent>();
+  utils::FixedArray<HedgedAttempt> attempts(policy.max_attempts, any_finished);
+  std::size_t started = 0;
+  std::size_t failed = 0;
+
+  const auto can_hedge = [&] {
+    return started < attempts.size() &&
+           (!params->throttling ||
+            params->throttle.IsAllowed(*params->throttling));
+  };
+  const auto start_attempt = [&] {
+    auto& attempt = attempts[started];
+    attempt.context =
+        &start_finish(started, attempt.status, attempt.finish.GetTag());
+    ++started;
+  };
+
+  start_attempt();
+  auto next_hedge = engine::Deadline::FromDuration(policy.delay);
+
+  std::optional<std::size_t> result;
+  std::optional<std::size_t> last_failed;
+  while (!result) {
+    const bool may_hedge = can_hedge();
+    if (may_hedge && next_hedge.IsReached()) {
+      start_attempt();
+      stats.OnHedgeSent();
+      next_hedge = engine::Deadline::FromDuration(policy.delay);
+      continue;
+    }
+
+    const bool is_woken_up = any_finished->WaitForEventUntil(
+        may_hedge ? next_hedge : engine::Deadline{});
+    if (engine::current_task::ShouldCancel()) {
+      stats.OnCancelled();
+      throw RpcCancelledError(data.GetCallName(), "Finish");
+    }
+    if (!is_woken_up) continue;
+
+    for (std::size_t i = 0; i < started && !result; ++i) {
+      auto& attempt = attempts[i];
+      if (attempt.is_finished || !attempt.finish.IsReady()) continue;
+
+      attempt.is_finished = true;
+      [[maybe_unused]] const auto wait_status = attempt.finish.Wait();
+      UASSERT_MSG(wait_status == AsyncMethodInvocation::WaitStatus::kOk,
+                  "ok=false in async Finish method invocation is prohibited "
+                  "by gRPC docs, see grpc::CompletionQueue::Next");
+
+      const auto code = attempt.status.error_code();
+      const bool is_non_fatal =
+          code != grpc::StatusCode::OK && IsNonFatal(policy, code);
+      if (params->throttling) {
+        if (code == grpc::StatusCode::OK) {
+          params->throttle.OnSuccess(*params->throttling);
+        } else if (is_non_fatal) {
+          params->throttle.OnFailure(*params->throttling);
+        }
+      }
+
+      if (is_non_fatal) {
+        ++failed;
+        last_failed = i;
+        // The next hedged attempt is sent right away
+        next_hedge = engine::Deadline::Passed();
+      } else {
+        result = i;
+      }
+    }
+
+    if (!result && failed == started && !can_hedge()) {
+      result = last_failed;
+    }
+  }
+
+  for (std::size_t i = 0; i < started; ++i) {
+    if (!attempts[i].is_finished) stats.OnHedgeCancelled();
+  }
+  if (*result != 0) stats.OnHedgeWon();
+
+  auto& status = attempts[*result].status;
+  if (status.error_code() == grpc::StatusCode::DEADLINE_EXCEEDED &&
+      data.IsDeadlinePropagated()) {
+    stats.OnCancelledByDeadlinePropagation();
+  }
+  auto parsed_gstatus = ParsedGStatus::ProcessStatus(status);
+  ProcessFinishResult(data, AsyncMethodInvocation::WaitStatus::kOk,
+                      std::move(status), std::move(parsed_gstatus), true);
+  return *result;
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
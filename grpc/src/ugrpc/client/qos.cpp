@@ -1,7 +1,10 @@
 #include <userver/ugrpc/client/qos.hpp>
 
+#include <algorithm>
+
 #include <grpcpp/client_context.h>
 
+#include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize_duration.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -9,10 +12,76 @@
 #include <userver/formats/serialize/common_containers.hpp>
 #include <userver/testsuite/grpc_control.hpp>
 
+#include <userver/ugrpc/status_codes.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
+namespace {
+
+// Same as the limit of gRPC, larger values are treated as this one
+constexpr std::size_t kMaxHedgingAttempts = 5;
+
+}  // namespace
+
+HedgingPolicy Parse(const formats::json::Value& value,
+                    formats::parse::To<HedgingPolicy>) {
+  HedgingPolicy result;
+  const auto max_attempts = value["max-attempts"].As<std::size_t>();
+  if (max_attempts < 1) {
+    throw formats::json::ParseException(
+        "'max-attempts' of the hedging policy must be positive");
+  }
+  result.max_attempts = std::min(max_attempts, kMaxHedgingAttempts);
+  result.delay = std::chrono::milliseconds{
+      value["delay-ms"].As<std::chrono::milliseconds::rep>(0)};
+
+  for (const auto& code : value["non-fatal-codes"].As<std::vector<std::string>>(
+           std::vector<std::string>{})) {
+    try {
+      result.non_fatal_codes.push_back(ugrpc::StatusCodeFromString(code));
+    } catch (const std::runtime_error& ex) {
+      throw formats::json::ParseException(ex.what());
+    }
+  }
+  return result;
+}
+
+formats::json::Value Serialize(const HedgingPolicy& policy,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder result{formats::common::Type::kObject};
+  result["max-attempts"] = policy.max_attempts;
+  result["delay-ms"] = policy.delay.count();
+  std::vector<std::string> non_fatal_codes;
+  for (const auto code : policy.non_fatal_codes) {
+    non_fatal_codes.emplace_back(ugrpc::ToString(code));
+  }
+  result["non-fatal-codes"] = non_fatal_codes;
+  return result.ExtractValue();
+}
+
+RetryThrottlingPolicy Parse(const formats::json::Value& value,
+                            formats::parse::To<RetryThrottlingPolicy>) {
+  RetryThrottlingPolicy result;
+  result.max_tokens = value["max-tokens"].As<double>();
+  result.token_ratio = value["token-ratio"].As<double>();
+  if (!(result.max_tokens > 0) || !(result.token_ratio > 0)) {
+    throw formats::json::ParseException(
+        "'max-tokens' and 'token-ratio' of the retry throttling must be "
+        "positive");
+  }
+  return result;
+}
+
+formats::json::Value Serialize(const RetryThrottlingPolicy& policy,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder result{formats::common::Type::kObject};
+  result["max-tokens"] = policy.max_tokens;
+  result["token-ratio"] = policy.token_ratio;
+  return result.ExtractValue();
+}
+
 Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
   Qos result;
   const auto ms =
@@ -20,6 +89,9 @@ Qos Parse(const formats::json::Value& value, formats::parse::To<Qos>) {
   if (ms) {
     result.timeout = std::chrono::milliseconds{*ms};
   }
+  result.hedging = value["hedging"].As<std::optional<HedgingPolicy>>();
+  result.retry_throttling =
+      value["retry-throttling"].As<std::optional<RetryThrottlingPolicy>>();
   return result;
 }
 
@@ -27,6 +99,8 @@ formats::json::Value Serialize(const Qos& qos,
                                formats::serialize::To<formats::json::Value>) {
   formats::json::ValueBuilder result{formats::common::Type::kObject};
   result["timeout-ms"] = qos.timeout;
+  if (qos.hedging) result["hedging"] = *qos.hedging;
+  if (qos.retry_throttling) result["retry-throttling"] = *qos.retry_throttling;
   return result.ExtractValue();
 }
 
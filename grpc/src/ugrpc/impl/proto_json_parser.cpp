@@ -0,0 +1,428 @@
+#include <ugrpc/impl/proto_json_parser.hpp>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <fmt/format.h>
+#include <google/protobuf/util/json_util.h>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+using formats::json::parser::InternalParseError;
+using Scalar = ProtoMessageParser::Scalar;
+
+constexpr auto kMessageType =
+    google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE;
+
+template <typename T, typename U>
+T CastInteger(U value) {
+  const auto result = static_cast<T>(value);
+  if (static_cast<U>(result) != value || (result < T{}) != (value < U{})) {
+    throw InternalParseError(fmt::format("Integer {} is out of range", value));
+  }
+  return result;
+}
+
+template <typename T>
+T ToInteger(const Scalar& value) {
+  if (const auto* number = std::get_if<std::int64_t>(&value)) {
+    return CastInteger<T>(*number);
+  }
+  if (const auto* number = std::get_if<std::uint64_t>(&value)) {
+    return CastInteger<T>(*number);
+  }
+  if (const auto* number = std::get_if<double>(&value)) {
+    if (std::trunc(*number) != *number) {
+      throw InternalParseError(fmt::format("{} is not an integer", *number));
+    }
+    // 2^64 and -2^63 are exactly representable as doubles
+    if (*number >= 0 && *number < 18446744073709551616.0) {
+      return CastInteger<T>(static_cast<std::uint64_t>(*number));
+    }
+    if (*number < 0 && *number >= -9223372036854775808.0) {
+      return CastInteger<T>(static_cast<std::int64_t>(*number));
+    }
+    throw InternalParseError(
+        fmt::format("Integer {} is out of range", *number));
+  }
+  if (const auto* string = std::get_if<std::string_view>(&value)) {
+    return utils::FromString<T>(*string);
+  }
+  throw InternalParseError("integer was expected, but bool found");
+}
+
+template <typename T>
+T ToFloating(const Scalar& value) {
+  if (const auto* string = std::get_if<std::string_view>(&value)) {
+    if (*string == "NaN") return std::numeric_limits<T>::quiet_NaN();
+    if (*string == "Infinity") return std::numeric_limits<T>::infinity();
+    if (*string == "-Infinity") return -std::numeric_limits<T>::infinity();
+    return utils::FromString<T>(*string);
+  }
+  double number = 0;
+  if (const auto* integer = std::get_if<std::int64_t>(&value)) {
+    number = static_cast<double>(*integer);
+  } else if (const auto* integer = std::get_if<std::uint64_t>(&value)) {
+    number = static_cast<double>(*integer);
+  } else if (const auto* floating = std::get_if<double>(&value)) {
+    number = *floating;
+  } else {
+    throw InternalParseError("number was expected, but bool found");
+  }
+
+  if (std::is_same_v<T, float> && std::isfinite(number) &&
+      std::abs(number) > std::numeric_limits<float>::max()) {
+    throw InternalParseError(fmt::format("Float {} is out of range", number));
+  }
+  return static_cast<T>(number);
+}
+
+bool ToBool(const Scalar& value) {
+  if (const auto* boolean = std::get_if<bool>(&value)) return *boolean;
+  // Map keys are always strings
+  if (const auto* string = std::get_if<std::string_view>(&value)) {
+    if (*string == "true") return true;
+    if (*string == "false") return false;
+  }
+  throw InternalParseError("bool was expected");
+}
+
+std::string ToString(const Scalar& value,
+                     const google::protobuf::FieldDescriptor& field) {
+  const auto* string = std::get_if<std::string_view>(&value);
+  if (!string) throw InternalParseError("string was expected");
+  if (field.type() != google::protobuf::FieldDescriptor::TYPE_BYTES) {
+    return std::string{*string};
+  }
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+  // Both the standard and the URL-safe alphabets are accepted
+  if (string->find_first_of("-_") != std::string_view::npos) {
+    return crypto::base64::Base64UrlDecode(*string);
+  }
+#endif
+  return crypto::base64::Base64Decode(*string);
+}
+
+int ToEnum(const Scalar& value,
+           const google::protobuf::FieldDescriptor& field) {
+  if (const auto* string = std::get_if<std::string_view>(&value)) {
+    const auto* enum_value =
+        field.enum_type()->FindValueByName(std::string{*string});
+    if (!enum_value) {
+      throw InternalParseError(fmt::format("Unknown value '{}' of enum {}",
+                                           *string,
+                                           field.enum_type()->full_name()));
+    }
+    return enum_value->number();
+  }
+  return ToInteger<std::int32_t>(value);
+}
+
+void SetField(google::protobuf::Message& message,
+              const google::protobuf::FieldDescriptor& field,
+              const Scalar& value) {
+  using google::protobuf::FieldDescriptor;
+  const auto& reflection = *message.GetReflection();
+  const bool add = field.is_repeated();
+
+  switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32: {
+      const auto number = ToInteger<std::int32_t>(value);
+      add ? reflection.AddInt32(&message, &field, number)
+          : reflection.SetInt32(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_INT64: {
+      const auto number = ToInteger<std::int64_t>(value);
+      add ? reflection.AddInt64(&message, &field, number)
+          : reflection.SetInt64(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_UINT32: {
+      const auto number = ToInteger<std::uint32_t>(value);
+      add ? reflection.AddUInt32(&message, &field, number)
+          : reflection.SetUInt32(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_UINT64: {
+      const auto number = ToInteger<std::uint64_t>(value);
+      add ? reflection.AddUInt64(&message, &field, number)
+          : reflection.SetUInt64(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_DOUBLE: {
+      const auto number = ToFloating<double>(value);
+      add ? reflection.AddDouble(&message, &field, number)
+          : reflection.SetDouble(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_FLOAT: {
+      const auto number = ToFloating<float>(value);
+      add ? reflection.AddFloat(&message, &field, number)
+          : reflection.SetFloat(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_BOOL: {
+      const auto boolean = ToBool(value);
+      add ? reflection.AddBool(&message, &field, boolean)
+          : reflection.SetBool(&message, &field, boolean);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      const auto number = ToEnum(value, field);
+      add ? reflection.AddEnumValue(&message, &field, number)
+          : reflection.SetEnumValue(&message, &field, number);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_STRING: {
+      auto string = ToString(value, field);
+      add ? reflection.AddString(&message, &field, std::move(string))
+          : reflection.SetString(&message, &field, std::move(string));
+      return;
+    }
+    case kMessageType:
+      throw InternalParseError("object was expected");
+  }
+
+  UINVARIANT(false, "Unexpected protobuf field type");
+}
+
+const google::protobuf::FieldDescriptor* FindField(
+    const google::protobuf::Descriptor& descriptor, const std::string& key) {
+  // The JSON name is the lowerCamelCase name unless set explicitly
+  if (const auto* field = descriptor.FindFieldByCamelcaseName(key);
+      field && field->json_name() == key) {
+    return field;
+  }
+  if (const auto* field = descriptor.FindFieldByName(key)) return field;
+  for (int i = 0; i < descriptor.field_count(); ++i) {
+    if (descriptor.field(i)->json_name() == key) return descriptor.field(i);
+  }
+  return nullptr;
+}
+
+bool IsWellKnownFile(const google::protobuf::FileDescriptor& file) {
+  return file.package() == "google.protobuf";
+}
+
+}  // namespace
+
+bool IsWellKnownType(const google::protobuf::Descriptor& descriptor) {
+  return IsWellKnownFile(*descriptor.file());
+}
+
+bool HasWellKnownJsonMapping(const google::protobuf::FieldDescriptor& field) {
+  const auto* value_field = field.is_map() ? field.message_type()->map_value()
+                                           : &field;
+  if (const auto* message_type = value_field->message_type()) {
+    return IsWellKnownType(*message_type);
+  }
+  if (const auto* enum_type = value_field->enum_type()) {
+    return IsWellKnownFile(*enum_type->file());
+  }
+  return false;
+}
+
+void ParseJsonWithProtobuf(std::string_view json,
+                           google::protobuf::Message& message) {
+  const auto status = google::protobuf::util::JsonStringToMessage(
+      {json.data(), json.size()}, &message);
+  if (!status.ok()) throw InternalParseError(status.ToString());
+}
+
+ProtoMessageParser::ProtoMessageParser() = default;
+
+ProtoMessageParser::~ProtoMessageParser() = default;
+
+void ProtoMessageParser::Reset(google::protobuf::Message& message) noexcept {
+  state_ = State::kStart;
+  message_ = &message;
+  field_ = nullptr;
+  map_entry_ = nullptr;
+}
+
+void ProtoMessageParser::Null() {
+  // null is the default value of any field
+  if (state_ != State::kFieldValue) Throw("null");
+  state_ = State::kObject;
+}
+
+void ProtoMessageParser::Bool(bool value) { SetScalar(value, "bool"); }
+
+void ProtoMessageParser::Int64(std::int64_t value) {
+  SetScalar(value, "integer");
+}
+
+void ProtoMessageParser::Uint64(std::uint64_t value) {
+  SetScalar(value, "integer");
+}
+
+void ProtoMessageParser::Double(double value) { SetScalar(value, "double"); }
+
+void ProtoMessageParser::String(std::string_view value) {
+  SetScalar(value, "string");
+}
+
+void ProtoMessageParser::StartObject() {
+  const auto& reflection = *message_->GetReflection();
+  switch (state_) {
+    case State::kStart:
+      state_ = State::kObject;
+      return;
+    case State::kFieldValue:
+      if (field_->is_map()) {
+        state_ = State::kMap;
+        return;
+      }
+      if (field_->cpp_type() != kMessageType || field_->is_repeated()) break;
+      state_ = State::kObject;
+      StartMessage(*reflection.MutableMessage(message_, field_));
+      return;
+    case State::kArray:
+      if (field_->cpp_type() != kMessageType) break;
+      StartMessage(*reflection.AddMessage(message_, field_));
+      return;
+    case State::kMapValue: {
+      const auto& value_field = *field_->message_type()->map_value();
+      if (value_field.cpp_type() != kMessageType) break;
+      state_ = State::kMap;
+      StartMessage(*map_entry_->GetReflection()->MutableMessage(map_entry_,
+                                                                &value_field));
+      return;
+    }
+    case State::kObject:
+    case State::kMap:
+      break;
+  }
+  Throw("object");
+}
+
+void ProtoMessageParser::Key(std::string_view key) {
+  key_ = key;
+  if (state_ == State::kMap) {
+    map_entry_ = message_->GetReflection()->AddMessage(message_, field_);
+    SetField(*map_entry_, *field_->message_type()->map_key(),
+             std::string_view{key_});
+    state_ = State::kMapValue;
+    return;
+  }
+  if (state_ != State::kObject) Throw("field '" + key_ + "'");
+
+  const auto& descriptor = *message_->GetDescriptor();
+  field_ = FindField(descriptor, key_);
+  if (!field_) {
+    throw InternalParseError(fmt::format("Unknown field '{}' of {}", key_,
+                                         descriptor.full_name()));
+  }
+
+  if (HasWellKnownJsonMapping(*field_)) {
+    value_parser_ = std::make_unique<formats::json::parser::JsonValueParser>();
+    value_parser_->Subscribe(*this);
+    parser_state_->PushParser(*value_parser_);
+    return;
+  }
+  state_ = State::kFieldValue;
+}
+
+void ProtoMessageParser::EndObject() {
+  switch (state_) {
+    case State::kObject:
+      parser_state_->PopMe(*this);
+      return;
+    case State::kMap:
+      state_ = State::kObject;
+      return;
+    default:
+      Throw("'}'");
+  }
+}
+
+void ProtoMessageParser::StartArray() {
+  if (state_ != State::kFieldValue || !field_->is_repeated() ||
+      field_->is_map()) {
+    Throw("array");
+  }
+  state_ = State::kArray;
+}
+
+void ProtoMessageParser::EndArray() {
+  if (state_ != State::kArray) Throw("']'");
+  state_ = State::kObject;
+}
+
+std::string ProtoMessageParser::GetPathItem() const { return key_; }
+
+std::string ProtoMessageParser::Expected() const {
+  switch (state_) {
+    case State::kStart:
+      return "object";
+    case State::kObject:
+    case State::kMap:
+      return "field or '}'";
+    case State::kFieldValue:
+      if (field_->is_map()) return "object";
+      if (field_->is_repeated()) return "array";
+      [[fallthrough]];
+    case State::kArray:
+    case State::kMapValue:
+      return "value";
+  }
+
+  UINVARIANT(false, "Unexpected parser state");
+}
+
+void ProtoMessageParser::OnSend(formats::json::Value&& value) {
+  // The field is parsed alone and then merged into the message
+  formats::json::StringBuilder sw;
+  {
+    const formats::json::StringBuilder::ObjectGuard guard{sw};
+    sw.Key(field_->json_name());
+    sw.WriteValue(value);
+  }
+  const std::unique_ptr<google::protobuf::Message> field_message{
+      message_->New()};
+  ParseJsonWithProtobuf(sw.GetStringView(), *field_message);
+  message_->MergeFrom(*field_message);
+}
+
+void ProtoMessageParser::SetScalar(const Scalar& value, std::string_view type) {
+  switch (state_) {
+    case State::kFieldValue:
+      if (field_->is_repeated()) break;
+      SetField(*message_, *field_, value);
+      state_ = State::kObject;
+      return;
+    case State::kArray:
+      SetField(*message_, *field_, value);
+      return;
+    case State::kMapValue:
+      SetField(*map_entry_, *field_->message_type()->map_value(), value);
+      state_ = State::kMap;
+      return;
+    default:
+      break;
+  }
+  Throw(std::string{type});
+}
+
+void ProtoMessageParser::StartMessage(google::protobuf::Message& message) {
+  if (!child_) child_ = std::make_unique<ProtoMessageParser>();
+  child_->Reset(message);
+  parser_state_->PushParser(*child_);
+  child_->StartObject();
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+#include <userver/formats/json/parser/base_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+/// @returns whether the message is one of the well-known types of
+/// google.protobuf, which have a special JSON mapping
+bool IsWellKnownType(const google::protobuf::Descriptor& descriptor);
+
+/// @returns whether the value of the field involves the well-known types
+bool HasWellKnownJsonMapping(const google::protobuf::FieldDescriptor& field);
+
+/// @brief Parses the JSON with google::protobuf::util::JsonStringToMessage
+/// @throws formats::json::parser::InternalParseError
+void ParseJsonWithProtobuf(std::string_view json,
+                           google::protobuf::Message& message);
+
+/// @brief SAX parser of the canonical JSON mapping of a protobuf message
+///
+/// The fields are set through the reflection right from the tokens of the
+/// input. The fields of the well-known types are collected into
+/// formats::json::Value and are parsed by protobuf.
+class ProtoMessageParser final
+    : public formats::json::parser::BaseParser,
+      public formats::json::parser::Subscriber<formats::json::Value> {
+ public:
+  ProtoMessageParser();
+  ~ProtoMessageParser() override;
+
+  /// The message is not cleared, the parsed fields are merged into it
+  void Reset(google::protobuf::Message& message) noexcept;
+
+  void Null() override;
+  void Bool(bool value) override;
+  void Int64(std::int64_t value) override;
+  void Uint64(std::uint64_t value) override;
+  void Double(double value) override;
+  void String(std::string_view value) override;
+  void StartObject() override;
+  void Key(std::string_view key) override;
+  void EndObject() override;
+  void StartArray() override;
+  void EndArray() override;
+
+  std::string GetPathItem() const override;
+
+  using Scalar =
+      std::variant<bool, std::int64_t, std::uint64_t, double, std::string_view>;
+
+ private:
+  enum class State {
+    kStart,
+    kObject,
+    kFieldValue,
+    kArray,
+    kMap,
+    kMapValue,
+  };
+
+  std::string Expected() const override;
+
+  void OnSend(formats::json::Value&& value) override;
+
+  void SetScalar(const Scalar& value, std::string_view type);
+  void StartMessage(google::protobuf::Message& message);
+
+  State state_{State::kStart};
+  google::protobuf::Message* message_{nullptr};
+  const google::protobuf::FieldDescriptor* field_{nullptr};
+  google::protobuf::Message* map_entry_{nullptr};
+  std::string key_;
+
+  std::unique_ptr<ProtoMessageParser> child_;
+  std::unique_ptr<formats::json::parser::JsonValueParser> value_parser_;
+};
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <thread>
 
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/thread_name.hpp>
 
@@ -29,12 +31,43 @@ void ProcessQueue(grpc::CompletionQueue& queue,
   completion.Send();
 }
 
+void ProcessQueueInTask(grpc::CompletionQueue& queue,
+                        engine::SingleUseEvent& completion) noexcept {
+  void* tag = nullptr;
+  bool ok = false;
+
+  while (true) {
+    // Drains the ready events without blocking, then lets the woken up
+    // coroutines run on this worker thread before blocking in the queue
+    const auto status =
+        queue.AsyncNext(&tag, &ok, gpr_inf_past(GPR_CLOCK_MONOTONIC));
+    if (status == grpc::CompletionQueue::SHUTDOWN) break;
+    if (status == grpc::CompletionQueue::TIMEOUT) {
+      engine::Yield();
+      if (!queue.Next(&tag, &ok)) break;
+    }
+
+    auto* call = static_cast<EventBase*>(tag);
+    UASSERT(call != nullptr);
+    call->Notify(ok);
+  }
+
+  completion.Send();
+}
+
 }  // namespace
 
 QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
   std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
 }
 
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue,
+                         engine::TaskProcessor& task_processor)
+    : queue_(queue),
+      polling_task_(engine::CriticalAsyncNoSpan(task_processor, [this] {
+        ProcessQueueInTask(queue_, completion_);
+      })) {}
+
 QueueRunner::~QueueRunner() {
   queue_.Shutdown();
   completion_.WaitNonCancellable();
@@ -63,6 +63,14 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept {
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountHedgeSent() noexcept { ++hedges_sent_; }
+
+void MethodStatistics::AccountHedgeWon() noexcept { ++hedges_won_; }
+
+void MethodStatistics::AccountHedgeCancelled() noexcept {
+  ++hedges_cancelled_;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const MethodStatistics& stats) {
   writer["timings"] = stats.timings_;
@@ -117,6 +125,10 @@ void DumpMetric(utils::statistics::Writer& writer,
       AsRateAndGauge{stats.deadline_updated_.Load()};
   writer["cancelled-by-deadline-propagation"] =
       AsRateAndGauge{deadline_cancelled_value};
+
+  writer["hedges-sent"] = stats.hedges_sent_.Load();
+  writer["hedges-won"] = stats.hedges_won_.Load();
+  writer["hedges-cancelled"] = stats.hedges_cancelled_.Load();
 }
 
 ServiceStatistics::~ServiceStatistics() = default;
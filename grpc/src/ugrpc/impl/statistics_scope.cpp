@@ -32,6 +32,14 @@ void RpcStatisticsScope::OnDeadlinePropagated() {
   statistics_.AccountDeadlinePropagated();
 }
 
+void RpcStatisticsScope::OnHedgeSent() { statistics_.AccountHedgeSent(); }
+
+void RpcStatisticsScope::OnHedgeWon() { statistics_.AccountHedgeWon(); }
+
+void RpcStatisticsScope::OnHedgeCancelled() {
+  statistics_.AccountHedgeCancelled();
+}
+
 void RpcStatisticsScope::OnCancelled() {
   // If the task is cancelled, then this is what typically happens:
   //
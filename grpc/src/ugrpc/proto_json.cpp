@@ -1,8 +1,17 @@
 #include <userver/ugrpc/proto_json.hpp>
 
+#include <cmath>
+#include <iterator>
+
+#include <fmt/format.h>
 #include <grpcpp/support/config.h>
 
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/parser/parser_state.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <ugrpc/impl/proto_json_parser.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,8 +24,164 @@ const google::protobuf::util::JsonPrintOptions kOptions = []() {
   options.always_print_primitive_fields = true;
   return options;
 }();
+
+using google::protobuf::FieldDescriptor;
+
+void WriteFloating(double value, formats::json::StringBuilder& sw) {
+  if (std::isnan(value)) {
+    sw.WriteString("NaN");
+  } else if (std::isinf(value)) {
+    sw.WriteString(value > 0 ? "Infinity" : "-Infinity");
+  } else {
+    // The shortest representation, so that floats are not printed as doubles
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "{}", value);
+    sw.WriteRawString({buffer.data(), buffer.size()});
+  }
+}
+
+void WriteFloating(float value, formats::json::StringBuilder& sw) {
+  if (!std::isfinite(value)) return WriteFloating(double{value}, sw);
+  fmt::memory_buffer buffer;
+  fmt::format_to(std::back_inserter(buffer), "{}", value);
+  sw.WriteRawString({buffer.data(), buffer.size()});
+}
+
+template <typename Integer>
+void WriteQuoted(Integer value, formats::json::StringBuilder& sw) {
+  // 64-bit integers do not fit into the doubles of JavaScript
+  const fmt::format_int formatted{value};
+  sw.WriteString({formatted.data(), formatted.size()});
 }
 
+void WriteEnum(int number, const FieldDescriptor& field,
+               formats::json::StringBuilder& sw) {
+  const auto& enum_type = *field.enum_type();
+  if (enum_type.full_name() == "google.protobuf.NullValue") {
+    sw.WriteNull();
+  } else if (const auto* value = enum_type.FindValueByNumber(number)) {
+    sw.WriteString(value->name());
+  } else {
+    sw.WriteInt64(number);
+  }
+}
+
+/// Writes a singular field or an element of a repeated field for index >= 0
+void WriteValue(const google::protobuf::Message& message,
+                const FieldDescriptor& field, int index,
+                formats::json::StringBuilder& sw) {
+  const auto& reflection = *message.GetReflection();
+  const bool repeated = index >= 0;
+
+  switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      sw.WriteInt64(repeated
+                        ? reflection.GetRepeatedInt32(message, &field, index)
+                        : reflection.GetInt32(message, &field));
+      return;
+    case FieldDescriptor::CPPTYPE_INT64:
+      WriteQuoted(repeated ? reflection.GetRepeatedInt64(message, &field, index)
+                           : reflection.GetInt64(message, &field),
+                  sw);
+      return;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      sw.WriteUInt64(repeated
+                         ? reflection.GetRepeatedUInt32(message, &field, index)
+                         : reflection.GetUInt32(message, &field));
+      return;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      WriteQuoted(repeated
+                      ? reflection.GetRepeatedUInt64(message, &field, index)
+                      : reflection.GetUInt64(message, &field),
+                  sw);
+      return;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      WriteFloating(repeated
+                        ? reflection.GetRepeatedDouble(message, &field, index)
+                        : reflection.GetDouble(message, &field),
+                    sw);
+      return;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      WriteFloating(repeated
+                        ? reflection.GetRepeatedFloat(message, &field, index)
+                        : reflection.GetFloat(message, &field),
+                    sw);
+      return;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      sw.WriteBool(repeated ? reflection.GetRepeatedBool(message, &field, index)
+                            : reflection.GetBool(message, &field));
+      return;
+    case FieldDescriptor::CPPTYPE_ENUM:
+      WriteEnum(repeated
+                    ? reflection.GetRepeatedEnumValue(message, &field, index)
+                    : reflection.GetEnumValue(message, &field),
+                field, sw);
+      return;
+    case FieldDescriptor::CPPTYPE_STRING: {
+      std::string scratch;
+      const auto& value =
+          repeated ? reflection.GetRepeatedStringReference(message, &field,
+                                                           index, &scratch)
+                   : reflection.GetStringReference(message, &field, &scratch);
+      if (field.type() == FieldDescriptor::TYPE_BYTES) {
+        sw.WriteString(crypto::base64::Base64Encode(value));
+      } else {
+        sw.WriteString(value);
+      }
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      WriteJson(repeated ? reflection.GetRepeatedMessage(message, &field, index)
+                         : reflection.GetMessage(message, &field),
+                sw);
+      return;
+  }
+
+  UINVARIANT(false, "Unexpected protobuf field type");
+}
+
+void WriteMapKey(const google::protobuf::Message& entry,
+                 formats::json::StringBuilder& sw) {
+  const auto& reflection = *entry.GetReflection();
+  const auto& field = *entry.GetDescriptor()->map_key();
+
+  switch (field.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_STRING: {
+      std::string scratch;
+      sw.Key(reflection.GetStringReference(entry, &field, &scratch));
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_BOOL:
+      sw.Key(reflection.GetBool(entry, &field) ? "true" : "false");
+      return;
+    case FieldDescriptor::CPPTYPE_INT32:
+      sw.Key(fmt::format_int{reflection.GetInt32(entry, &field)}.str());
+      return;
+    case FieldDescriptor::CPPTYPE_INT64:
+      sw.Key(fmt::format_int{reflection.GetInt64(entry, &field)}.str());
+      return;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      sw.Key(fmt::format_int{reflection.GetUInt32(entry, &field)}.str());
+      return;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      sw.Key(fmt::format_int{reflection.GetUInt64(entry, &field)}.str());
+      return;
+    default:
+      UINVARIANT(false, "Unexpected protobuf map key type");
+  }
+}
+
+bool ShouldWrite(const google::protobuf::Message& message,
+                 const FieldDescriptor& field) {
+  // Same as always_print_primitive_fields of kOptions
+  if (field.is_repeated()) return true;
+  if (message.GetReflection()->HasField(message, &field)) return true;
+  return !field.containing_oneof() &&
+         field.cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE;
+}
+
+}  // namespace
+
 formats::json::Value MessageToJson(const google::protobuf::Message& message) {
   return formats::json::FromString(ToJsonString(message));
 }
@@ -39,6 +204,54 @@ std::string ToJsonString(const google::protobuf::Message& message) {
   return result;
 }
 
+void WriteJson(const google::protobuf::Message& message,
+               formats::json::StringBuilder& sw) {
+  const auto& descriptor = *message.GetDescriptor();
+  if (impl::IsWellKnownType(descriptor)) {
+    sw.WriteRawString(ToJsonString(message));
+    return;
+  }
+
+  const auto& reflection = *message.GetReflection();
+  const formats::json::StringBuilder::ObjectGuard guard{sw};
+  for (int i = 0; i < descriptor.field_count(); ++i) {
+    const auto& field = *descriptor.field(i);
+    if (!ShouldWrite(message, field)) continue;
+
+    sw.Key(field.json_name());
+    if (field.is_map()) {
+      const formats::json::StringBuilder::ObjectGuard map_guard{sw};
+      const auto& value_field = *field.message_type()->map_value();
+      for (int j = 0; j < reflection.FieldSize(message, &field); ++j) {
+        const auto& entry = reflection.GetRepeatedMessage(message, &field, j);
+        WriteMapKey(entry, sw);
+        WriteValue(entry, value_field, -1, sw);
+      }
+    } else if (field.is_repeated()) {
+      const formats::json::StringBuilder::ArrayGuard array_guard{sw};
+      for (int j = 0; j < reflection.FieldSize(message, &field); ++j) {
+        WriteValue(message, field, j, sw);
+      }
+    } else {
+      WriteValue(message, field, -1, sw);
+    }
+  }
+}
+
+void JsonToMessage(std::string_view json, google::protobuf::Message& message) {
+  if (impl::IsWellKnownType(*message.GetDescriptor())) {
+    impl::ParseJsonWithProtobuf(json, message);
+    return;
+  }
+
+  impl::ProtoMessageParser parser;
+  parser.Reset(message);
+
+  formats::json::parser::ParserState state;
+  state.PushParser(parser);
+  state.ProcessInput(json);
+}
+
 }  // namespace ugrpc
 
 namespace formats::serialize {
@@ -25,6 +25,27 @@ void ThrowOnError(impl::AsyncMethodInvocation::WaitStatus status,
   }
 }
 
+void WriteCoalescing::SetFlushInterval(
+    std::chrono::milliseconds flush_interval) {
+  flush_interval_ = flush_interval;
+  last_flush_ = std::chrono::steady_clock::now();
+}
+
+grpc::WriteOptions WriteCoalescing::NextWriteOptions() {
+  grpc::WriteOptions options;
+  // Don't buffer writes by default, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  if (!flush_interval_) return options;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (now - last_flush_ < *flush_interval_) {
+    options.set_buffer_hint();
+  } else {
+    last_flush_ = now;
+  }
+  return options;
+}
+
 const grpc::Status kUnimplementedStatus{grpc::StatusCode::UNIMPLEMENTED,
                                         "This method is unimplemented"};
 
@@ -17,6 +17,7 @@ namespace {
 
 constexpr std::string_view kTaskProcessorKey = "task-processor";
 constexpr std::string_view kMiddlewaresKey = "middlewares";
+constexpr std::string_view kArenaBlockSizesKey = "arena-block-sizes";
 
 template <typename ParserFunc>
 auto ParseOptional(const yaml_config::YamlConfig& service_field,
@@ -88,6 +89,9 @@ server::ServiceConfig ParseServiceConfig(
           MergeField(value[kMiddlewaresKey], defaults.middleware_names, context,
                      ParseMiddlewares),
           context),
+      /*arena_block_sizes=*/
+      value[kArenaBlockSizesKey]
+          .As<std::unordered_map<std::string, std::size_t>>({}),
   };
 }
 
@@ -96,6 +100,11 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
   ServerConfig config;
   config.port = value["port"].As<std::optional<int>>();
   config.completion_queue_num = value["completion-queue-count"].As<int>(2);
+  const auto queue_task_processor = value["completion-queue-task-processor"];
+  if (!queue_task_processor.IsMissing()) {
+    config.completion_queue_task_processor =
+        &ParseTaskProcessor(queue_task_processor, context);
+  }
   config.channel_args =
       value["channel-args"].As<decltype(config.channel_args)>({});
   config.native_log_level =
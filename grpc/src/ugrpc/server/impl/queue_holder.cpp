@@ -14,20 +14,30 @@ namespace ugrpc::server::impl {
 
 namespace {
 
+ugrpc::impl::QueueRunner MakeQueueRunner(
+    grpc::CompletionQueue& queue, engine::TaskProcessor* task_processor) {
+  if (task_processor) return ugrpc::impl::QueueRunner(queue, *task_processor);
+  return ugrpc::impl::QueueRunner(queue);
+}
+
 struct QueueSubHolder final {
-  explicit QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue)
-      : queue(std::move(queue)) {}
+  QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue,
+                 engine::TaskProcessor* task_processor)
+      : queue(std::move(queue)),
+        queue_runner(MakeQueueRunner(*this->queue, task_processor)) {}
 
   std::unique_ptr<grpc::ServerCompletionQueue> queue;
-  ugrpc::impl::QueueRunner queue_runner{*queue};
+  ugrpc::impl::QueueRunner queue_runner;
 };
 
 }  // namespace
 
 struct QueueHolder::Impl final {
-  explicit Impl(std::size_t num, grpc::ServerBuilder& server_builder)
-      : queue(utils::GenerateFixedArray(num, [&server_builder](size_t) {
-          return QueueSubHolder(server_builder.AddCompletionQueue());
+  Impl(std::size_t num, grpc::ServerBuilder& server_builder,
+       engine::TaskProcessor* task_processor)
+      : queue(utils::GenerateFixedArray(num, [&](size_t) {
+          return QueueSubHolder(server_builder.AddCompletionQueue(),
+                                task_processor);
         })) {
     for (auto& subholder : queue)
       queues.queues.push_back(subholder.queue.get());
@@ -37,8 +47,9 @@ struct QueueHolder::Impl final {
   ugrpc::impl::CompletionQueues queues;
 };
 
-QueueHolder::QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder)
-    : impl_(num, server_builder) {}
+QueueHolder::QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder,
+                         engine::TaskProcessor* task_processor)
+    : impl_(num, server_builder, task_processor) {}
 
 QueueHolder::~QueueHolder() = default;
 
@@ -1,7 +1,10 @@
 #include <userver/ugrpc/server/impl/service_worker_impl.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <stdexcept>
 
+#include <fmt/format.h>
 #include <grpc/support/time.h>
 
 #include <userver/logging/log.hpp>
@@ -82,6 +85,38 @@ void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
                              ugrpc::impl::ToGrpcString(span.GetLink()));
 }
 
+void ValidateArenaBlockSizes(const ServiceSettings& settings,
+                             const ugrpc::impl::StaticServiceMetadata& metadata,
+                             std::initializer_list<bool> are_methods_unary) {
+  UASSERT(are_methods_unary.size() == metadata.method_full_names.size());
+  for (const auto& [method_name, block_size] : settings.arena_block_sizes) {
+    const auto full_name =
+        fmt::format("{}/{}", metadata.service_full_name, method_name);
+    const auto it = std::find(metadata.method_full_names.begin(),
+                              metadata.method_full_names.end(), full_name);
+    if (it == metadata.method_full_names.end()) {
+      throw std::runtime_error(fmt::format(
+          "'arena-block-sizes' of gRPC service '{}' mention a missing method "
+          "'{}'",
+          metadata.service_full_name, method_name));
+    }
+    if (!are_methods_unary
+             .begin()[it - metadata.method_full_names.begin()]) {
+      throw std::runtime_error(fmt::format(
+          "'arena-block-sizes' of gRPC service '{}' mention a streaming "
+          "method '{}', only the unary methods may use arenas",
+          metadata.service_full_name, method_name));
+    }
+  }
+}
+
+std::size_t GetArenaBlockSize(const ServiceSettings& settings,
+                              std::string_view method_name) {
+  if (settings.arena_block_sizes.empty()) return 0;
+  return utils::FindOrDefault(settings.arena_block_sizes,
+                              std::string{method_name});
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -17,9 +17,6 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
   const auto& dynamic_config = context.GetInitialDynamicConfig();
 
   if (dynamic_config[USERVER_NAMESPACE::baggage::kBaggageEnabled]) {
-    const auto& baggage_settings =
-        dynamic_config[USERVER_NAMESPACE::baggage::kBaggageSettings];
-
     const auto& server_context = call.GetContext();
 
     const auto* baggage_header = utils::FindOrNullptr(
@@ -30,7 +27,7 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
 
       auto baggage = USERVER_NAMESPACE::baggage::TryMakeBaggage(
           ugrpc::impl::ToString(*baggage_header),
-          baggage_settings.allowed_keys);
+          USERVER_NAMESPACE::baggage::GetAllowedKeys(dynamic_config));
       if (baggage) {
         USERVER_NAMESPACE::baggage::kInheritedBaggage.Set(std::move(*baggage));
       }
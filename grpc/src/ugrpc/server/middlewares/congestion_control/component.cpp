@@ -4,6 +4,7 @@
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/congestion_control/component.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,7 +14,13 @@ namespace ugrpc::server::middlewares::congestion_control {
 Component::Component(const components::ComponentConfig& config,
                      const components::ComponentContext& context)
     : MiddlewareComponentBase(config, context),
-      middleware_(std::make_shared<Middleware>()) {
+      middleware_(std::make_shared<Middleware>(Settings{
+          config["max-concurrent-calls"].As<std::size_t>(0),
+          config["max-concurrent-calls-by-name"]
+              .As<std::unordered_map<std::string, std::size_t>>({}),
+          config["min-deadline-left"]
+              .As<std::optional<std::chrono::milliseconds>>(),
+      })) {
   auto& server =
       context.FindComponent<USERVER_NAMESPACE::congestion_control::Component>()
           .GetServerLimiter();
@@ -29,7 +36,32 @@ yaml_config::Schema Component::GetStaticConfigSchema() {
 type: object
 description: gRPC service congestion control middleware component
 additionalProperties: false
-properties: {}
+properties:
+    max-concurrent-calls:
+        type: integer
+        description: |
+            max number of the concurrent calls of each method, the calls over
+            the limit are rejected with RESOURCE_EXHAUSTED, 0 means no limit
+        defaultDescription: 0
+        minimum: 0
+    max-concurrent-calls-by-name:
+        type: object
+        description: |
+            overrides of max-concurrent-calls by 'Service/Method' or by
+            'Service' names, the limit of a service is shared by all of its
+            methods
+        defaultDescription: '{}'
+        additionalProperties:
+            type: integer
+            description: max number of the concurrent calls, 0 means no limit
+            minimum: 0
+        properties: {}
+    min-deadline-left:
+        type: string
+        description: |
+            the calls with less time left until their deadline are rejected
+            with RESOURCE_EXHAUSTED without being handled
+        defaultDescription: the calls are not rejected by deadline
 )");
 }
 
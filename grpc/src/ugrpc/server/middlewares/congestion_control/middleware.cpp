@@ -1,5 +1,7 @@
 #include "middleware.hpp"
 
+#include <userver/utils/fast_scope_guard.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
@@ -21,8 +23,42 @@ bool CheckRatelimit(utils::TokenBucket& rate_limit,
   return false;
 }
 
+std::optional<std::chrono::system_clock::duration> GetDeadlineLeft(
+    std::chrono::system_clock::time_point deadline) {
+  // In some versions of gRPC, absence of deadline represented as negative
+  // time_point
+  if (deadline.time_since_epoch().count() < 0) {
+    return std::nullopt;
+  }
+
+  const auto duration = deadline - std::chrono::system_clock::now();
+  if (duration >= std::chrono::hours{365 * 24}) {
+    return std::nullopt;
+  }
+  return duration;
+}
+
+bool CheckDeadlineLeft(const std::optional<std::chrono::milliseconds>& min_left,
+                       grpc::ServerContext& context,
+                       std::string_view call_name) {
+  if (!min_left) return true;
+
+  const auto left = GetDeadlineLeft(context.deadline());
+  if (!left || *left >= *min_left) return true;
+
+  LOG_LIMITED_WARNING()
+      << "Request shed (congestion control), the time left until the "
+         "deadline is "
+      << std::chrono::duration_cast<std::chrono::milliseconds>(*left).count()
+      << "ms, the minimum is " << min_left->count()
+      << "ms, service/method=" << call_name;
+  return false;
+}
+
 }  // namespace
 
+Middleware::Middleware(Settings&& settings) : settings_(std::move(settings)) {}
+
 void Middleware::SetLimit(std::optional<size_t> new_limit) {
   if (new_limit) {
     const auto rps_val = *new_limit;
@@ -39,16 +75,68 @@ void Middleware::SetLimit(std::optional<size_t> new_limit) {
   }
 }
 
+std::optional<Middleware::ConcurrencyLimit> Middleware::FindConcurrencyLimit(
+    MiddlewareCallContext& context) const {
+  const auto& by_name = settings_.max_concurrent_calls_by_name;
+  if (!by_name.empty()) {
+    std::string call_name{context.GetCall().GetCallName()};
+    if (const auto it = by_name.find(call_name); it != by_name.end()) {
+      return ConcurrencyLimit{std::move(call_name), it->second};
+    }
+
+    std::string service_name{context.GetServiceName()};
+    if (const auto it = by_name.find(service_name); it != by_name.end()) {
+      return ConcurrencyLimit{std::move(service_name), it->second};
+    }
+  }
+
+  if (settings_.max_concurrent_calls == 0) return std::nullopt;
+  return ConcurrencyLimit{std::string{context.GetCall().GetCallName()},
+                          settings_.max_concurrent_calls};
+}
+
 void Middleware::Handle(MiddlewareCallContext& context) const {
   auto& call = context.GetCall();
 
-  if (!CheckRatelimit(rate_limit_, context.GetCall().GetCallName())) {
+  if (!CheckRatelimit(rate_limit_, call.GetCallName())) {
     call.FinishWithError(
         grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED,
                      "Congestion control: rate limit exceeded"});
     return;
   }
 
+  if (!CheckDeadlineLeft(settings_.min_deadline_left, call.GetContext(),
+                         call.GetCallName())) {
+    call.FinishWithError(grpc::Status{
+        grpc::StatusCode::RESOURCE_EXHAUSTED,
+        "Congestion control: not enough time left until the deadline"});
+    return;
+  }
+
+  auto limit = FindConcurrencyLimit(context);
+  if (!limit || limit->limit == 0) {
+    context.Next();
+    return;
+  }
+
+  auto counter = in_flight_.Get(limit->key);
+  if (!counter) counter = in_flight_.Emplace(limit->key, 0).value;
+
+  if (counter->fetch_add(1) >= limit->limit) {
+    counter->fetch_sub(1);
+    LOG_LIMITED_ERROR() << "Request throttled (congestion control), "
+                        << "max concurrent calls of '" << limit->key
+                        << "' is " << limit->limit
+                        << ", service/method=" << call.GetCallName();
+    call.FinishWithError(
+        grpc::Status{grpc::StatusCode::RESOURCE_EXHAUSTED,
+                     "Congestion control: concurrency limit exceeded"});
+    return;
+  }
+
+  const utils::FastScopeGuard release([&counter]() noexcept {
+    counter->fetch_sub(1);
+  });
   context.Next();
 }
 
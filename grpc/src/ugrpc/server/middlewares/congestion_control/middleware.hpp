@@ -1,5 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <userver/rcu/rcu_map.hpp>
 #include <userver/server/congestion_control/limiter.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 #include <userver/utils/token_bucket.hpp>
@@ -8,16 +16,44 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::server::middlewares::congestion_control {
 
+struct Settings final {
+  /// Max number of the concurrent calls of each method, 0 means no limit
+  std::size_t max_concurrent_calls{0};
+
+  /// Overrides of the limit by 'Service/Method' or by 'Service' names. The
+  /// limit of a service is shared by all of its methods.
+  std::unordered_map<std::string, std::size_t> max_concurrent_calls_by_name;
+
+  /// The calls with less time left until the deadline are rejected
+  std::optional<std::chrono::milliseconds> min_deadline_left;
+};
+
 class Middleware final
     : public MiddlewareBase,
       public USERVER_NAMESPACE::server::congestion_control::Limitee {
  public:
+  Middleware() = default;
+
+  explicit Middleware(Settings&& settings);
+
   void Handle(MiddlewareCallContext& context) const override;
 
   void SetLimit(std::optional<size_t> new_limit) override;
 
  private:
+  using InFlightCounter = std::atomic<std::size_t>;
+
+  struct ConcurrencyLimit final {
+    std::string key;
+    std::size_t limit{0};
+  };
+
+  std::optional<ConcurrencyLimit> FindConcurrencyLimit(
+      MiddlewareCallContext& context) const;
+
   mutable utils::TokenBucket rate_limit_{utils::TokenBucket::MakeUnbounded()};
+  const Settings settings_;
+  mutable rcu::RcuMap<std::string, InFlightCounter> in_flight_;
 };
 
 }  // namespace ugrpc::server::middlewares::congestion_control
@@ -133,7 +133,8 @@ Server::Impl::Impl(ServerConfig&& config,
   server_builder_.emplace();
   ApplyChannelArgs(*server_builder_, config);
   queue_.emplace(static_cast<std::size_t>(config.completion_queue_num),
-                 std::ref(*server_builder_));
+                 std::ref(*server_builder_),
+                 config.completion_queue_task_processor);
 
   if (config.port) AddListeningPort(*config.port);
 }
@@ -172,6 +173,7 @@ void Server::Impl::AddService(ServiceBase& service, ServiceConfig&& config) {
       std::move(config.middlewares),
       access_tskv_logger_,
       config_source_,
+      std::move(config.arena_block_sizes),
   }));
 }
 
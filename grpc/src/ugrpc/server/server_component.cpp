@@ -51,6 +51,12 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-task-processor:
+        type: string
+        description: |
+            the task processor to poll the completion queues in, instead of the
+            dedicated threads. Each queue occupies one of its worker threads.
+        defaultDescription: dedicated threads
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
@@ -42,6 +42,18 @@ properties:
         items:
             type: string
             description: middleware component name
+    arena-block-sizes:
+        type: object
+        description: |
+            initial block sizes of the per-call protobuf arenas by the names
+            of the unary methods, the requests of the other methods are
+            allocated on heap
+        defaultDescription: '{}'
+        additionalProperties:
+            type: integer
+            description: initial block size of the arena in bytes
+            minimum: 1
+        properties: {}
 )");
 }
 
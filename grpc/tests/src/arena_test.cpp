@@ -0,0 +1,99 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <unordered_map>
+
+#include <google/protobuf/arena.h>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    auto* arena = call.GetArena();
+    if (!arena) {
+      sample::ugrpc::GreetingResponse response;
+      response.set_name("Heap " + request.name());
+      call.Finish(response);
+      return;
+    }
+
+    EXPECT_EQ(request.GetArena(), arena);
+    auto* response =
+        google::protobuf::Arena::CreateMessage<sample::ugrpc::GreetingResponse>(
+            arena);
+    response->set_name("Arena " + request.name());
+    call.Finish(*response);
+  }
+};
+
+class GrpcArena : public ugrpc::tests::ServiceBase, public ::testing::Test {
+ protected:
+  explicit GrpcArena(
+      std::unordered_map<std::string, std::size_t> arena_block_sizes) {
+    GetServer().AddService(
+        service_, ugrpc::server::ServiceConfig{
+                      engine::current_task::GetTaskProcessor(),
+                      /*middlewares=*/{}, std::move(arena_block_sizes)});
+    StartServer();
+  }
+
+  ~GrpcArena() override { StopServer(); }
+
+  std::string SayHello() {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest out;
+    out.set_name("userver");
+    return client.SayHello(out).Finish().name();
+  }
+
+ private:
+  UnitTestService service_;
+};
+
+class GrpcArenaEnabled : public GrpcArena {
+ protected:
+  GrpcArenaEnabled() : GrpcArena({{"SayHello", 4096}}) {}
+};
+
+class GrpcArenaDisabled : public GrpcArena {
+ protected:
+  GrpcArenaDisabled() : GrpcArena({}) {}
+};
+
+}  // namespace
+
+UTEST_F(GrpcArenaEnabled, UnaryCall) { EXPECT_EQ(SayHello(), "Arena userver"); }
+
+UTEST_F(GrpcArenaDisabled, UnaryCall) { EXPECT_EQ(SayHello(), "Heap userver"); }
+
+UTEST(GrpcArenaConfig, StreamingMethodIsRejected) {
+  ugrpc::tests::ServiceBase service_base;
+  UnitTestService service;
+  UEXPECT_THROW(service_base.GetServer().AddService(
+                    service, ugrpc::server::ServiceConfig{
+                                 engine::current_task::GetTaskProcessor(),
+                                 /*middlewares=*/{},
+                                 {{"Chat", 4096}}}),
+                std::runtime_error);
+}
+
+UTEST(GrpcArenaConfig, MissingMethodIsRejected) {
+  ugrpc::tests::ServiceBase service_base;
+  UnitTestService service;
+  UEXPECT_THROW(service_base.GetServer().AddService(
+                    service, ugrpc::server::ServiceConfig{
+                                 engine::current_task::GetTaskProcessor(),
+                                 /*middlewares=*/{},
+                                 {{"Missing", 4096}}}),
+                std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/utils/statistics/testing.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMaxChannelCount = 3;
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    while (call.Read(request)) {
+    }
+    call.Finish();
+  }
+};
+
+class GrpcChannelPool : public ugrpc::tests::ServiceBase,
+                        public ::testing::Test {
+ protected:
+  GrpcChannelPool() {
+    RegisterService(service_);
+    ugrpc::client::ClientFactoryConfig config;
+    config.channel_count = 1;
+    config.max_channel_count = kMaxChannelCount;
+    config.channel_streams_threshold = 1;
+    StartServer(std::move(config));
+  }
+
+  ~GrpcChannelPool() override { StopServer(); }
+
+ private:
+  UnitTestService service_;
+};
+
+void FinishChat(sample::ugrpc::UnitTestServiceClient::ChatCall& call) {
+  EXPECT_TRUE(call.WritesDone());
+  sample::ugrpc::StreamGreetingResponse response;
+  EXPECT_FALSE(call.Read(response));
+}
+
+}  // namespace
+
+UTEST_F(GrpcChannelPool, ExtraChannels) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  const auto& token =
+      ugrpc::client::impl::GetClientData(client).GetChannelToken();
+  EXPECT_EQ(token.GetChannelCount(), kMaxChannelCount);
+  EXPECT_EQ(token.GetUsedChannelCount(), 1);
+
+  std::vector<sample::ugrpc::UnitTestServiceClient::ChatCall> calls;
+  calls.push_back(client.Chat());
+  EXPECT_EQ(token.GetUsedChannelCount(), 1);
+  calls.push_back(client.Chat());
+  EXPECT_EQ(token.GetUsedChannelCount(), 2);
+  calls.push_back(client.Chat());
+  calls.push_back(client.Chat());
+  EXPECT_EQ(token.GetUsedChannelCount(), kMaxChannelCount);
+
+  const utils::statistics::Snapshot stats{GetStatisticsStorage(),
+                                          "grpc.client.channels"};
+  std::size_t active = 0;
+  for (std::size_t i = 0; i < kMaxChannelCount; ++i) {
+    const auto channel_active =
+        stats
+            .SingleMetric("active", {{"grpc_channel", std::to_string(i)}})
+            .AsInt();
+    EXPECT_GE(channel_active, 1);
+    active += channel_active;
+  }
+  EXPECT_EQ(active, calls.size());
+
+  for (auto& call : calls) FinishChat(call);
+}
+
+UTEST_F(GrpcChannelPool, LeastLoadedChannel) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto& data = ugrpc::client::impl::GetClientData(client);
+
+  auto first = client.Chat();
+  auto second = client.Chat();
+  FinishChat(first);
+
+  // The channel of the finished stream is the only one without RPCs in flight
+  const auto lease = data.AcquireChannel();
+  EXPECT_EQ(data.GetChannelToken().GetUsedChannelCount(), 2);
+  EXPECT_EQ(lease.GetChannelIndex(), 0);
+
+  FinishChat(second);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,163 @@
+#include <userver/utest/utest.hpp>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+#include <ugrpc/server/middlewares/congestion_control/middleware.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using namespace std::chrono_literals;
+
+namespace {
+
+namespace congestion_control = ugrpc::server::middlewares::congestion_control;
+
+constexpr std::chrono::milliseconds kLongDelay = std::chrono::minutes{1};
+
+class UnitTestServiceBlocking final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    if (request.name() == "block") {
+      entered.Send();
+      [[maybe_unused]] const bool is_released =
+          released.WaitForEventFor(kLongDelay);
+    }
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  engine::SingleConsumerEvent entered;
+  engine::SingleConsumerEvent released;
+};
+
+sample::ugrpc::GreetingRequest MakeRequest(std::string name) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(std::move(name));
+  return request;
+}
+
+class GrpcCongestionControl : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  explicit GrpcCongestionControl(congestion_control::Settings&& settings) {
+    AddServerMiddleware(
+        std::make_shared<congestion_control::Middleware>(std::move(settings)));
+    RegisterService(service_);
+    StartServer();
+    client_.emplace(MakeClient<sample::ugrpc::UnitTestServiceClient>());
+  }
+
+  ~GrpcCongestionControl() override {
+    client_.reset();
+    StopServer();
+  }
+
+  sample::ugrpc::UnitTestServiceClient& GetClient() { return client_.value(); }
+
+  UnitTestServiceBlocking& GetService() { return service_; }
+
+ private:
+  UnitTestServiceBlocking service_;
+  std::optional<sample::ugrpc::UnitTestServiceClient> client_;
+};
+
+congestion_control::Settings MakeConcurrencySettings() {
+  congestion_control::Settings settings;
+  settings.max_concurrent_calls = 1;
+  return settings;
+}
+
+class GrpcConcurrencyLimit : public GrpcCongestionControl {
+ protected:
+  GrpcConcurrencyLimit() : GrpcCongestionControl(MakeConcurrencySettings()) {}
+};
+
+congestion_control::Settings MakeServiceLimitSettings() {
+  congestion_control::Settings settings;
+  settings.max_concurrent_calls_by_name = {
+      {"sample.ugrpc.UnitTestService", 0}};
+  settings.max_concurrent_calls = 1;
+  return settings;
+}
+
+class GrpcConcurrencyLimitOverride : public GrpcCongestionControl {
+ protected:
+  GrpcConcurrencyLimitOverride()
+      : GrpcCongestionControl(MakeServiceLimitSettings()) {}
+};
+
+congestion_control::Settings MakeDeadlineSettings() {
+  congestion_control::Settings settings;
+  settings.min_deadline_left = 30s;
+  return settings;
+}
+
+class GrpcDeadlineShedding : public GrpcCongestionControl {
+ protected:
+  GrpcDeadlineShedding() : GrpcCongestionControl(MakeDeadlineSettings()) {}
+};
+
+std::unique_ptr<grpc::ClientContext> MakeContext(
+    std::chrono::milliseconds timeout) {
+  auto context = std::make_unique<grpc::ClientContext>();
+  context->set_deadline(engine::Deadline::FromDuration(timeout));
+  return context;
+}
+
+}  // namespace
+
+UTEST_F(GrpcConcurrencyLimit, RejectsOverLimit) {
+  auto blocked = GetClient().SayHello(MakeRequest("block"));
+  ASSERT_TRUE(GetService().entered.WaitForEventFor(kLongDelay));
+
+  UEXPECT_THROW(GetClient().SayHello(MakeRequest("userver")).Finish(),
+                ugrpc::client::ResourceExhaustedError);
+
+  GetService().released.Send();
+  EXPECT_EQ(blocked.Finish().name(), "Hello block");
+
+  // The slot is released after the call is finished
+  EXPECT_EQ(GetClient().SayHello(MakeRequest("userver")).Finish().name(),
+            "Hello userver");
+}
+
+UTEST_F(GrpcConcurrencyLimitOverride, NoLimitForService) {
+  auto blocked = GetClient().SayHello(MakeRequest("block"));
+  ASSERT_TRUE(GetService().entered.WaitForEventFor(kLongDelay));
+
+  EXPECT_EQ(GetClient().SayHello(MakeRequest("userver")).Finish().name(),
+            "Hello userver");
+
+  GetService().released.Send();
+  EXPECT_EQ(blocked.Finish().name(), "Hello block");
+}
+
+UTEST_F(GrpcDeadlineShedding, RejectsShortDeadline) {
+  UEXPECT_THROW(
+      GetClient().SayHello(MakeRequest("userver"), MakeContext(1s)).Finish(),
+      ugrpc::client::ResourceExhaustedError);
+}
+
+UTEST_F(GrpcDeadlineShedding, AcceptsLongDeadline) {
+  EXPECT_EQ(GetClient()
+                .SayHello(MakeRequest("userver"), MakeContext(kLongDelay))
+                .Finish()
+                .name(),
+            "Hello userver");
+  EXPECT_EQ(GetClient().SayHello(MakeRequest("userver")).Finish().name(),
+            "Hello userver");
+}
+
+USERVER_NAMESPACE_END
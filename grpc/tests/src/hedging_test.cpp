@@ -0,0 +1,168 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include <userver/engine/sleep.hpp>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::chrono::milliseconds kLongDelay = std::chrono::minutes{1};
+
+// The first attempt of each RPC is slow or fails depending on the request
+class UnitTestServiceForHedging final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    const auto attempt = attempts_++;
+    const auto& mode = request.name();
+
+    if (mode == "slow" && attempt == 0) {
+      engine::InterruptibleSleepFor(500ms);
+    } else if (mode == "unavailable" && attempt == 0) {
+      call.FinishWithError({grpc::StatusCode::UNAVAILABLE, "retry"});
+      return;
+    } else if (mode == "always-unavailable") {
+      call.FinishWithError({grpc::StatusCode::UNAVAILABLE, "retry"});
+      return;
+    } else if (mode == "invalid" && attempt == 0) {
+      call.FinishWithError({grpc::StatusCode::INVALID_ARGUMENT, "invalid"});
+      return;
+    }
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name(std::to_string(attempt));
+    call.Finish(response);
+  }
+
+ private:
+  std::atomic<int> attempts_{0};
+};
+
+ugrpc::client::Qos MakeHedgingQos(std::chrono::milliseconds delay) {
+  ugrpc::client::Qos qos;
+  qos.hedging.emplace();
+  qos.hedging->max_attempts = 2;
+  qos.hedging->delay = delay;
+  qos.hedging->non_fatal_codes = {grpc::StatusCode::UNAVAILABLE};
+  return qos;
+}
+
+sample::ugrpc::GreetingRequest MakeRequest(std::string mode) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name(std::move(mode));
+  return request;
+}
+
+}  // namespace
+
+class GrpcHedging
+    : public ugrpc::tests::ServiceFixture<UnitTestServiceForHedging> {
+ protected:
+  sample::ugrpc::UnitTestServiceClient MakeTestClient() {
+    return MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  }
+
+  double GetHedgingMetric(const std::string& name) {
+    return GetStatistics(
+               "grpc.client.by-destination",
+               {{"grpc_destination", "sample.ugrpc.UnitTestService/SayHello"}})
+        .SingleMetric(name)
+        .AsRate();
+  }
+};
+
+UTEST_F(GrpcHedging, SlowAttempt) {
+  auto client = MakeTestClient();
+  const auto response =
+      client
+          .SayHello(MakeRequest("slow"),
+                    std::make_unique<grpc::ClientContext>(),
+                    MakeHedgingQos(10ms))
+          .Finish();
+  EXPECT_EQ(response.name(), "1");
+
+  EXPECT_EQ(GetHedgingMetric("hedges-sent"), 1);
+  EXPECT_EQ(GetHedgingMetric("hedges-won"), 1);
+  EXPECT_EQ(GetHedgingMetric("hedges-cancelled"), 1);
+}
+
+UTEST_F(GrpcHedging, NonFatalCode) {
+  auto client = MakeTestClient();
+  // The hedged attempt is sent right after the failure, not after the delay
+  const auto response =
+      client
+          .SayHello(MakeRequest("unavailable"),
+                    std::make_unique<grpc::ClientContext>(),
+                    MakeHedgingQos(kLongDelay))
+          .Finish();
+  EXPECT_EQ(response.name(), "1");
+
+  EXPECT_EQ(GetHedgingMetric("hedges-sent"), 1);
+  EXPECT_EQ(GetHedgingMetric("hedges-won"), 1);
+  EXPECT_EQ(GetHedgingMetric("hedges-cancelled"), 0);
+}
+
+UTEST_F(GrpcHedging, FatalCode) {
+  auto client = MakeTestClient();
+  UEXPECT_THROW(client
+                    .SayHello(MakeRequest("invalid"),
+                              std::make_unique<grpc::ClientContext>(),
+                              MakeHedgingQos(kLongDelay))
+                    .Finish(),
+                ugrpc::client::InvalidArgumentError);
+
+  EXPECT_EQ(GetHedgingMetric("hedges-sent"), 0);
+  EXPECT_EQ(GetHedgingMetric("hedges-won"), 0);
+}
+
+UTEST_F(GrpcHedging, RetryThrottling) {
+  auto client = MakeTestClient();
+  auto qos = MakeHedgingQos(kLongDelay);
+  qos.retry_throttling.emplace();
+  qos.retry_throttling->max_tokens = 4;
+  qos.retry_throttling->token_ratio = 0.1;
+
+  // 4 tokens: both attempts fail, 2 tokens are left
+  UEXPECT_THROW(client
+                    .SayHello(MakeRequest("always-unavailable"),
+                              std::make_unique<grpc::ClientContext>(), qos)
+                    .Finish(),
+                ugrpc::client::UnavailableError);
+  EXPECT_EQ(GetHedgingMetric("hedges-sent"), 1);
+
+  // 1 token is left after the first attempt, hedging is throttled
+  UEXPECT_THROW(client
+                    .SayHello(MakeRequest("always-unavailable"),
+                              std::make_unique<grpc::ClientContext>(), qos)
+                    .Finish(),
+                ugrpc::client::UnavailableError);
+  EXPECT_EQ(GetHedgingMetric("hedges-sent"), 1);
+}
+
+UTEST_F(GrpcHedging, FinishAsyncIsNotHedged) {
+  auto client = MakeTestClient();
+  sample::ugrpc::GreetingResponse response;
+  auto call = client.SayHello(MakeRequest("unavailable"),
+                              std::make_unique<grpc::ClientContext>(),
+                              MakeHedgingQos(10ms));
+  auto future = call.FinishAsync(response);
+  UEXPECT_THROW(future.Get(), ugrpc::client::UnavailableError);
+
+  EXPECT_EQ(GetHedgingMetric("hedges-sent"), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/ugrpc/proto_json.hpp>
+
+#include <tests/json.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+sample::ugrpc::JsonMessage MakeMessage() {
+  sample::ugrpc::JsonMessage message;
+  message.set_int32_value(-42);
+  message.set_int64_value(std::numeric_limits<std::int64_t>::min());
+  message.set_uint32_value(42);
+  message.set_uint64_value(std::numeric_limits<std::uint64_t>::max());
+  message.set_double_value(0.1);
+  message.set_float_value(0.1F);
+  message.set_bool_value(true);
+  message.set_string_value("\"quoted\"\n");
+  message.set_bytes_value(std::string{"\0\xff\x01", 3});
+  message.set_kind(sample::ugrpc::JsonMessage::KIND_SECOND);
+  message.mutable_nested()->set_value("nested");
+  message.add_int64_values(1);
+  message.add_int64_values(-1);
+  message.add_nested_values()->set_value("first");
+  message.add_nested_values();
+  (*message.mutable_nested_by_name())["key"].set_value("value");
+  (*message.mutable_names_by_id())[-7] = "seven";
+  message.set_choice_int(0);
+  message.mutable_duration()->set_seconds(3);
+  message.mutable_duration()->set_nanos(500'000'000);
+  message.mutable_wrapped_int64()->set_value(5);
+  message.set_custom_name("custom");
+  return message;
+}
+
+std::string WriteJson(const google::protobuf::Message& message) {
+  formats::json::StringBuilder sw;
+  WriteToStream(message, sw);
+  return sw.GetString();
+}
+
+sample::ugrpc::JsonMessage ParseJson(std::string_view json) {
+  sample::ugrpc::JsonMessage message;
+  ugrpc::JsonToMessage(json, message);
+  return message;
+}
+
+void ExpectEqual(const google::protobuf::Message& expected,
+                 const google::protobuf::Message& actual) {
+  EXPECT_TRUE(
+      google::protobuf::util::MessageDifferencer::Equals(expected, actual))
+      << "expected: " << expected.ShortDebugString()
+      << ", actual: " << actual.ShortDebugString();
+}
+
+}  // namespace
+
+TEST(GrpcProtoJson, WriteSameAsProtobuf) {
+  for (const auto& message : {MakeMessage(), sample::ugrpc::JsonMessage{}}) {
+    EXPECT_EQ(formats::json::FromString(WriteJson(message)),
+              formats::json::FromString(ugrpc::ToJsonString(message)));
+  }
+}
+
+TEST(GrpcProtoJson, WriteNonFinite) {
+  sample::ugrpc::JsonMessage message;
+  message.set_double_value(std::numeric_limits<double>::quiet_NaN());
+  message.set_float_value(-std::numeric_limits<float>::infinity());
+
+  const auto json = formats::json::FromString(WriteJson(message));
+  EXPECT_EQ(json["doubleValue"].As<std::string>(), "NaN");
+  EXPECT_EQ(json["floatValue"].As<std::string>(), "-Infinity");
+}
+
+TEST(GrpcProtoJson, WriteNested) {
+  formats::json::StringBuilder sw;
+  {
+    const formats::json::StringBuilder::ObjectGuard guard{sw};
+    sw.Key("message");
+    WriteToStream(MakeMessage(), sw);
+    sw.Key("other");
+    WriteToStream(1, sw);
+  }
+
+  const auto json = formats::json::FromString(sw.GetStringView());
+  EXPECT_EQ(json["message"], ugrpc::MessageToJson(MakeMessage()));
+  EXPECT_EQ(json["other"].As<int>(), 1);
+}
+
+TEST(GrpcProtoJson, RoundTrip) {
+  const auto message = MakeMessage();
+  ExpectEqual(message, ParseJson(WriteJson(message)));
+  ExpectEqual(message, ParseJson(ugrpc::ToJsonString(message)));
+  ExpectEqual(sample::ugrpc::JsonMessage{}, ParseJson("{}"));
+}
+
+TEST(GrpcProtoJson, ParseAlternativeForms) {
+  const auto message = ParseJson(R"({
+    "int32_value": "-42",
+    "int64Value": 7,
+    "uint32Value": 1e1,
+    "doubleValue": "Infinity",
+    "kind": 1,
+    "string_value": null,
+    "bytesValue": "/w==",
+    "names_by_id": {"1": "one"},
+    "nested": {"value": "nested"}
+  })");
+
+  EXPECT_EQ(message.int32_value(), -42);
+  EXPECT_EQ(message.int64_value(), 7);
+  EXPECT_EQ(message.uint32_value(), 10);
+  EXPECT_TRUE(std::isinf(message.double_value()));
+  EXPECT_EQ(message.kind(), sample::ugrpc::JsonMessage::KIND_FIRST);
+  EXPECT_EQ(message.string_value(), "");
+  EXPECT_EQ(message.bytes_value(), "\xff");
+  EXPECT_EQ(message.names_by_id().at(1), "one");
+  EXPECT_EQ(message.nested().value(), "nested");
+}
+
+TEST(GrpcProtoJson, ParseErrors) {
+  for (const auto* json : {
+           R"({"unknownField": 1})",
+           R"({"int32Value": 2147483648})",
+           R"({"int32Value": 1.5})",
+           R"({"int32Value": true})",
+           R"({"kind": "KIND_UNKNOWN"})",
+           R"({"int64Values": 1})",
+           R"({"nested": [1]})",
+           R"({"duration": "not a duration"})",
+           R"([])",
+           R"({"int32Value": 1})"
+           R"({})",
+       }) {
+    sample::ugrpc::JsonMessage message;
+    EXPECT_THROW(ugrpc::JsonToMessage(json, message),
+                 formats::json::Exception)
+        << json;
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kRequestsCount = 32;
+
+ugrpc::server::ServerConfig MakeServerConfig() {
+  ugrpc::server::ServerConfig config;
+  config.completion_queue_num = 1;
+  config.completion_queue_task_processor =
+      &engine::current_task::GetTaskProcessor();
+  return config;
+}
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+};
+
+class GrpcQueueInTaskProcessor
+    : public ugrpc::tests::Service<UnitTestService>,
+      public ::testing::Test {
+ public:
+  GrpcQueueInTaskProcessor()
+      : ugrpc::tests::Service<UnitTestService>(
+            dynamic_config::MakeDefaultStorage({}), MakeServerConfig()) {}
+};
+
+}  // namespace
+
+UTEST_F_MT(GrpcQueueInTaskProcessor, UnaryRPC, 2) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest out;
+  out.set_name("userver");
+  auto response = client.SayHello(out).Finish();
+  EXPECT_EQ(response.name(), "Hello userver");
+}
+
+UTEST_F_MT(GrpcQueueInTaskProcessor, ConcurrentUnaryRPCs, 3) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  tasks.reserve(kRequestsCount);
+  for (std::size_t i = 0; i < kRequestsCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&client, i] {
+      sample::ugrpc::GreetingRequest out;
+      out.set_name(std::to_string(i));
+      return client.SayHello(out).Finish().name();
+    }));
+  }
+
+  for (std::size_t i = 0; i < kRequestsCount; ++i) {
+    EXPECT_EQ(tasks[i].Get(), "Hello " + std::to_string(i));
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kNumber = 42;
+constexpr std::size_t kBatchSize = 10;
+
+class UnitTestServiceWriteMany final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    std::vector<sample::ugrpc::StreamGreetingResponse> batch;
+    for (int i = 0; i < request.number(); ++i) {
+      auto& response = batch.emplace_back();
+      response.set_name(request.name());
+      response.set_number(i);
+      if (batch.size() == kBatchSize) {
+        call.WriteMany(batch);
+        batch.clear();
+      }
+    }
+    call.WriteMany(batch);
+    call.Finish();
+  }
+
+  void Chat(ChatCall& call) override {
+    // The responses are flushed by Finish at the latest
+    call.SetWriteBuffering(1h);
+
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_number(request.number());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+}  // namespace
+
+using GrpcWriteMany = ugrpc::tests::ServiceFixture<UnitTestServiceWriteMany>;
+
+UTEST_F(GrpcWriteMany, OutputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_name("userver");
+  out.set_number(kNumber);
+  auto is = client.ReadMany(out);
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kNumber; ++i) {
+    ASSERT_TRUE(is.Read(in));
+    EXPECT_EQ(in.number(), i);
+    EXPECT_EQ(in.name(), "userver");
+  }
+  EXPECT_FALSE(is.Read(in));
+}
+
+UTEST_F(GrpcWriteMany, BufferedBidirectionalStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto bs = client.Chat();
+
+  sample::ugrpc::StreamGreetingRequest out;
+  for (int i = 0; i < kNumber; ++i) {
+    out.set_number(i);
+    ASSERT_TRUE(bs.Write(out));
+  }
+  ASSERT_TRUE(bs.WritesDone());
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kNumber; ++i) {
+    ASSERT_TRUE(bs.Read(in));
+    EXPECT_EQ(in.number(), i);
+  }
+  EXPECT_FALSE(bs.Read(in));
+}
+
+USERVER_NAMESPACE_END
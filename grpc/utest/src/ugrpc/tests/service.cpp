@@ -51,6 +51,7 @@ void ServiceBase::RegisterService(server::ServiceBase& service) {
   server_.AddService(service, server::ServiceConfig{
                                   engine::current_task::GetTaskProcessor(),
                                   server_middlewares_,
+                                  /*arena_block_sizes=*/{},
                               });
 }
 
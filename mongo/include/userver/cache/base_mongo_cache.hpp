@@ -4,6 +4,12 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -14,10 +20,13 @@
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -30,11 +39,29 @@ inline const std::string kFetchAndParseStage = "fetch_and_parse";
 inline constexpr std::chrono::milliseconds kCpuRelaxThreshold{10};
 inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 
+inline constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{10};
+inline constexpr std::size_t kMaxChangeEventsPerUpdate = 100'000;
+
 namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
-}
+std::size_t GetMongoCacheFullUpdateParallelism(const ComponentConfig&);
+
+bool GetMongoCacheUseChangeStream(const ComponentConfig&);
+
+std::string GetMongoCacheIdKey(const formats::bson::Value& id);
+
+bool IsMongoCacheUpsertEvent(std::string_view operation_type);
+
+std::vector<formats::bson::Value> SampleMongoCacheIdBoundaries(
+    storages::mongo::Collection collection, std::size_t parallelism,
+    bool is_secondary_preferred);
+
+std::vector<formats::bson::Document> MakeMongoCacheIdRangeFilters(
+    const std::vector<formats::bson::Value>& boundaries);
+
+}  // namespace impl
 
 // clang-format off
 
@@ -49,6 +76,35 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// full-update-parallelism | number of _id ranges read concurrently by full updates | 1
+/// use-change-stream | apply the events of a change stream by incremental updates instead of polling | false
+///
+/// ## Parallel full updates
+/// With `full-update-parallelism` greater than 1 the full update splits the
+/// collection into `_id` ranges and reads each range with a separate cursor in
+/// a separate task, the documents are parsed concurrently too. The boundaries
+/// of the ranges are taken from the `GetIdRangeBoundaries` function of traits,
+/// or are sampled with the `$sample` aggregation on each full update.
+/// The documents with the `_id` of other BSON types than the boundaries are
+/// read by the first range.
+///
+/// Parallel full updates are only supported with the default find operation,
+/// incremental updates always use a single cursor.
+///
+/// ## Change stream updates
+/// With `use-change-stream` each full update opens a change stream of the
+/// collection right before reading it, and the incremental updates apply the
+/// insert, update, replace and delete events of the stream to the cache
+/// instead of querying `kMongoUpdateFieldName`. Unlike polling, this also
+/// removes the deleted documents from the cache and needs no index. Use a
+/// short `update-interval` to lower the update lag, an incremental update
+/// without events costs a single awaiting request. The periodic full updates
+/// reconcile the cache with the collection.
+///
+/// The stream is resumed automatically after the recoverable errors. If the
+/// stream is lost, e.g. on collection drop or when the resume point leaves the
+/// oplog, the next incremental update reloads the whole cache. The change
+/// streams require a replica set or a sharded cluster.
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -105,6 +161,13 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultFindOperation = true;
 ///
+///   // Optional function that returns the ascending boundaries of the _id
+///   // ranges for parallel full updates, see `full-update-parallelism`
+///   static std::vector<formats::bson::Value> GetIdRangeBoundaries() {
+///     return {formats::bson::ValueBuilder{"m"}.ExtractValue()};
+///   }
+///   // (default implementation samples the boundaries from the collection)
+///
 ///   // Whether update part of the cache even if failed to parse some documents
 ///   static constexpr bool kAreInvalidDocumentsSkipped = false;
 ///
@@ -136,6 +199,39 @@ class MongoCache
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  using KeyType = typename MongoCacheTraits::DataType::key_type;
+  using KeysById = std::unordered_map<std::string, KeyType>;
+  // Pairs of the _id keys (empty without change streams) and the objects
+  using FetchedObjects = std::vector<
+      std::pair<std::string, typename MongoCacheTraits::ObjectType>>;
+
+  void UpdateInParallel(cache::UpdateStatisticsScope& stats_scope);
+
+  void UpdateFromChangeStream(cache::UpdateStatisticsScope& stats_scope);
+
+  void ApplyChangeEvent(const formats::bson::Document& event,
+                        typename MongoCacheTraits::DataType& cache,
+                        cache::UpdateStatisticsScope& stats_scope);
+
+  storages::mongo::ChangeStream OpenChangeStream() const;
+
+  FetchedObjects FetchRange(
+      const formats::bson::Document& id_range,
+      cache::UpdateStatisticsScope& stats_scope) const;
+
+  std::optional<typename MongoCacheTraits::ObjectType> ParseDocument(
+      const formats::bson::Document& doc,
+      cache::UpdateStatisticsScope& stats_scope) const;
+
+  void InsertObject(cache::UpdateType type,
+                    typename MongoCacheTraits::DataType& cache,
+                    typename MongoCacheTraits::ObjectType&& object) const;
+
+  void AdjustCpuRelax(std::size_t doc_count,
+                      tracing::ScopeTime::DurationMillis elapsed_time);
+
+  std::vector<formats::bson::Value> GetIdRangeBoundaries() const;
+
   typename MongoCacheTraits::ObjectType DeserializeObject(
       const formats::bson::Document& doc) const;
 
@@ -151,7 +247,12 @@ class MongoCache
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const std::size_t full_update_parallelism_;
+  const bool use_change_stream_;
   std::size_t cpu_relax_iterations_{0};
+  std::optional<storages::mongo::ChangeStream> change_stream_;
+  // The keys of the cached documents for the delete events
+  KeysById keys_by_id_;
 };
 
 template <class MongoCacheTraits>
@@ -169,7 +270,10 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      full_update_parallelism_(
+          impl::GetMongoCacheFullUpdateParallelism(config)),
+      use_change_stream_(impl::GetMongoCacheUseChangeStream(config)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
@@ -177,7 +281,8 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
           typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
-      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits> &&
+      !use_change_stream_) {
     throw std::logic_error(
         "Incremental update support is requested in config but no update field "
         "name is specified in traits of '" +
@@ -189,6 +294,22 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
         "config for '" +
         components::GetCurrentComponentName(config) + "' cache");
   }
+  if (full_update_parallelism_ > 1 &&
+      mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+    throw std::logic_error(
+        "Parallel full updates are requested in config but a custom find "
+        "operation is specified in traits of '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
+  if (use_change_stream_ &&
+      CachingComponentBase<
+          typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() !=
+          cache::AllowedUpdateTypes::kFullAndIncremental) {
+    throw std::logic_error(
+        "Change stream updates are requested in config but both full and "
+        "incremental updates are not allowed for '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
 
   this->StartPeriodicUpdates();
 }
@@ -206,6 +327,28 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  std::optional<sm::ChangeStream> change_stream;
+  if (use_change_stream_) {
+    if (type == cache::UpdateType::kIncremental && change_stream_) {
+      UpdateFromChangeStream(stats_scope);
+      return;
+    }
+    if (type == cache::UpdateType::kIncremental) {
+      LOG_WARNING() << "No change stream in cache " << MongoCacheTraits::kName
+                    << ", reloading the whole cache";
+      type = cache::UpdateType::kFull;
+    }
+    // The events racing with the full update are applied on top of it
+    change_stream_.reset();
+    change_stream = OpenChangeStream();
+  }
+
+  if (type == cache::UpdateType::kFull && full_update_parallelism_ > 1) {
+    UpdateInParallel(stats_scope);
+    change_stream_ = std::move(change_stream);
+    return;
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -224,6 +367,7 @@ void MongoCache<MongoCacheTraits>::Update(
 
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
   std::size_t doc_count = 0;
+  KeysById keys_by_id;
 
   for (const auto& doc : cursor) {
     ++doc_count;
@@ -232,29 +376,238 @@ void MongoCache<MongoCacheTraits>::Update(
 
     stats_scope.IncreaseDocumentsReadCount(1);
 
-    try {
-      auto object = DeserializeObject(doc);
-      auto key = (object.*MongoCacheTraits::kKeyField);
+    auto object = ParseDocument(doc, stats_scope);
+    if (!object) continue;
+    if (use_change_stream_) {
+      keys_by_id.emplace(impl::GetMongoCacheIdKey(doc["_id"]),
+                         (*object).*MongoCacheTraits::kKeyField);
+    }
+    InsertObject(type, *new_cache, std::move(*object));
+  }
+
+  AdjustCpuRelax(doc_count, scope.ElapsedTotal(kFetchAndParseStage));
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  keys_by_id_ = std::move(keys_by_id);
+  change_stream_ = std::move(change_stream);
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::UpdateInParallel(
+    cache::UpdateStatisticsScope& stats_scope) {
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("split_ranges");
+  const auto id_ranges =
+      impl::MakeMongoCacheIdRangeFilters(GetIdRangeBoundaries());
+
+  scope.Reset(kFetchAndParseStage);
+  std::vector<engine::TaskWithResult<FetchedObjects>> tasks;
+  tasks.reserve(id_ranges.size());
+  for (const auto& id_range : id_ranges) {
+    tasks.push_back(utils::Async(
+        "mongo-cache-fetch-range", [this, &id_range, &stats_scope] {
+          return FetchRange(id_range, stats_scope);
+        }));
+  }
 
-      if (type == cache::UpdateType::kIncremental ||
-          new_cache->count(key) == 0) {
-        (*new_cache)[key] = std::move(object);
-      } else {
-        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
-                            << MongoCacheTraits::kName << ", key=" << key;
+  auto new_cache = GetData(cache::UpdateType::kFull);
+  std::size_t doc_count = 0;
+  KeysById keys_by_id;
+  // The ranges are merged in order, so are the duplicate keys
+  for (auto& task : tasks) {
+    auto objects = task.Get();
+    doc_count += objects.size();
+    for (auto& [id, object] : objects) {
+      if (use_change_stream_) {
+        keys_by_id.emplace(std::move(id),
+                           object.*MongoCacheTraits::kKeyField);
       }
-    } catch (const std::exception& e) {
-      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
-                          << MongoCacheTraits::kName << ", _id="
-                          << doc["_id"].template ConvertTo<std::string>()
-                          << ", what(): " << e;
-      stats_scope.IncreaseDocumentsParseFailures(1);
-
-      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+      InsertObject(cache::UpdateType::kFull, *new_cache, std::move(object));
+    }
+  }
+  tasks.clear();
+
+  // Each task relaxes on its own, so the per task document count is used
+  AdjustCpuRelax(doc_count / id_ranges.size(),
+                 scope.ElapsedTotal(kFetchAndParseStage));
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  keys_by_id_ = std::move(keys_by_id);
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::UpdateFromChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("fetch_events");
+  std::vector<formats::bson::Document> events;
+  try {
+    while (events.size() < kMaxChangeEventsPerUpdate) {
+      auto event = change_stream_->Next();
+      if (!event) break;
+      events.push_back(std::move(*event));
     }
+  } catch (const std::exception&) {
+    // The driver has already tried to resume the stream
+    change_stream_.reset();
+    throw;
   }
 
-  const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
+  if (events.empty()) {
+    // Don't touch the cache at all
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return;
+  }
+
+  scope.Reset("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+
+  scope.Reset("apply_events");
+  try {
+    for (const auto& event : events) {
+      ApplyChangeEvent(event, *new_cache, stats_scope);
+    }
+  } catch (const std::exception&) {
+    // keys_by_id_ may be inconsistent with the cache now
+    change_stream_.reset();
+    throw;
+  }
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::ApplyChangeEvent(
+    const formats::bson::Document& event,
+    typename MongoCacheTraits::DataType& cache,
+    cache::UpdateStatisticsScope& stats_scope) {
+  const auto operation_type = event["operationType"].As<std::string>();
+  if (operation_type != "delete" &&
+      !impl::IsMongoCacheUpsertEvent(operation_type)) {
+    // drop, rename, dropDatabase and invalidate events end the stream
+    throw std::runtime_error(fmt::format(
+        "Change stream of cache {} is invalidated by '{}' event",
+        MongoCacheTraits::kName, operation_type));
+  }
+
+  stats_scope.IncreaseDocumentsReadCount(1);
+  auto id = impl::GetMongoCacheIdKey(event["documentKey"]["_id"]);
+
+  // The document of an update event is missing if it is already deleted
+  const auto full_document = event["fullDocument"];
+  if (impl::IsMongoCacheUpsertEvent(operation_type) &&
+      !full_document.IsMissing() && !full_document.IsNull()) {
+    auto object = ParseDocument(full_document, stats_scope);
+    if (!object) return;
+
+    auto key = (*object).*MongoCacheTraits::kKeyField;
+    const auto [it, is_new] = keys_by_id_.emplace(std::move(id), key);
+    if (!is_new && !(it->second == key)) {
+      // The key field of the document is changed
+      cache.erase(it->second);
+      it->second = key;
+    }
+    InsertObject(cache::UpdateType::kIncremental, cache, std::move(*object));
+    return;
+  }
+
+  const auto it = keys_by_id_.find(id);
+  if (it == keys_by_id_.end()) return;
+  cache.erase(it->second);
+  keys_by_id_.erase(it);
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream MongoCache<MongoCacheTraits>::OpenChangeStream()
+    const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op;
+  watch_op.SetOption(sm::options::FullDocumentLookup{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    watch_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  auto collection = *mongo_collection_;
+  return collection.Execute(watch_op);
+}
+
+template <class MongoCacheTraits>
+typename MongoCache<MongoCacheTraits>::FetchedObjects
+MongoCache<MongoCacheTraits>::FetchRange(
+    const formats::bson::Document& id_range,
+    cache::UpdateStatisticsScope& stats_scope) const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Find find_op(id_range);
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    find_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+
+  utils::CpuRelax relax{cpu_relax_iterations_, nullptr};
+  FetchedObjects objects;
+  for (const auto& doc : mongo_collection_->Execute(find_op)) {
+    relax.Relax();
+
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    auto object = ParseDocument(doc, stats_scope);
+    if (!object) continue;
+    objects.emplace_back(use_change_stream_
+                             ? impl::GetMongoCacheIdKey(doc["_id"])
+                             : std::string{},
+                         std::move(*object));
+  }
+  return objects;
+}
+
+template <class MongoCacheTraits>
+std::optional<typename MongoCacheTraits::ObjectType>
+MongoCache<MongoCacheTraits>::ParseDocument(
+    const formats::bson::Document& doc,
+    cache::UpdateStatisticsScope& stats_scope) const {
+  try {
+    return DeserializeObject(doc);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                        << MongoCacheTraits::kName << ", _id="
+                        << doc["_id"].template ConvertTo<std::string>()
+                        << ", what(): " << e;
+    stats_scope.IncreaseDocumentsParseFailures(1);
+
+    if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+  }
+  return std::nullopt;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::InsertObject(
+    cache::UpdateType type, typename MongoCacheTraits::DataType& cache,
+    typename MongoCacheTraits::ObjectType&& object) const {
+  auto key = (object.*MongoCacheTraits::kKeyField);
+
+  if (type == cache::UpdateType::kIncremental || cache.count(key) == 0) {
+    cache[key] = std::move(object);
+  } else {
+    LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                        << MongoCacheTraits::kName << ", key=" << key;
+  }
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::AdjustCpuRelax(
+    std::size_t doc_count, tracing::ScopeTime::DurationMillis elapsed_time) {
   if (elapsed_time > kCpuRelaxThreshold) {
     cpu_relax_iterations_ = static_cast<std::size_t>(
         static_cast<double>(doc_count) / (elapsed_time / kCpuRelaxInterval));
@@ -263,12 +616,18 @@ void MongoCache<MongoCacheTraits>::Update(
         "Will relax CPU every {} iterations",
         kName, elapsed_time.count(), doc_count, cpu_relax_iterations_);
   }
+}
 
-  scope.Reset();
-
-  const auto size = new_cache->size();
-  this->Set(std::move(new_cache));
-  stats_scope.Finish(size);
+template <class MongoCacheTraits>
+std::vector<formats::bson::Value>
+MongoCache<MongoCacheTraits>::GetIdRangeBoundaries() const {
+  if constexpr (mongo_cache::impl::kHasIdRangeBoundaries<MongoCacheTraits>) {
+    return MongoCacheTraits::GetIdRangeBoundaries();
+  } else {
+    return impl::SampleMongoCacheIdBoundaries(
+        *mongo_collection_, full_update_parallelism_,
+        MongoCacheTraits::kIsSecondaryPreferred);
+  }
 }
 
 template <class MongoCacheTraits>
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <type_traits>
+#include <vector>
 
 #include <userver/cache/update_type.hpp>
 #include <userver/utils/meta.hpp>
@@ -11,7 +12,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::bson {
 class Document;
-}
+class Value;
+}  // namespace formats::bson
 
 namespace storages::mongo::operations {
 class Find;
@@ -100,6 +102,20 @@ template <typename T>
 inline constexpr bool kHasInvalidDocumentsSkipped =
     meta::kIsDetected<HasInvalidDocumentsSkipped, T>;
 
+template <typename T>
+using HasIdRangeBoundaries = decltype(T::GetIdRangeBoundaries);
+template <typename T>
+inline constexpr bool kHasIdRangeBoundaries =
+    meta::kIsDetected<HasIdRangeBoundaries, T>;
+
+template <typename T>
+using HasCorrectIdRangeBoundaries =
+    meta::ExpectSame<std::vector<formats::bson::Value>,
+                     decltype(T::GetIdRangeBoundaries())>;
+template <typename T>
+inline constexpr bool kHasCorrectIdRangeBoundaries =
+    meta::kIsDetected<HasCorrectIdRangeBoundaries, T>;
+
 template <typename>
 struct ClassByMemberPointer {};
 template <typename T, typename C>
@@ -178,6 +194,13 @@ struct CheckTraits {
       "signature and return value type: "
       "static ObjectType DeserializeObject(const formats::bson::Document& "
       "doc)");
+
+  static_assert(!kHasIdRangeBoundaries<MongoCacheTraits> ||
+                    kHasCorrectIdRangeBoundaries<MongoCacheTraits>,
+                "Mongo cache traits must specify _id range boundaries with "
+                "correct signature and return value type: "
+                "static std::vector<formats::bson::Value> "
+                "GetIdRangeBoundaries()");
 };
 
 }  // namespace mongo_cache::impl
@@ -0,0 +1,50 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief MongoDB change stream, the events of the changes of a collection
+///
+/// Retrieved with storages::mongo::Collection::Watch. The driver transparently
+/// resumes the stream after the recoverable errors.
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Returns the next change event
+  ///
+  /// Waits for the new events for at most options::MaxAwaitTime if there are
+  /// no buffered events.
+  /// @returns std::nullopt if there are no new events yet
+  /// @throws MongoException on errors, including the invalidation of the
+  /// stream, e.g. on collection drop
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event with options::ResumeAfter, empty if there is none yet
+  formats::bson::Document GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
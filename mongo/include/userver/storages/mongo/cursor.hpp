@@ -15,6 +15,9 @@ namespace impl {
 class CursorImpl;
 }  // namespace impl
 
+template <typename T>
+class TypedCursor;
+
 /// Interface for MongoDB query cursors
 class Cursor {
  public:
@@ -62,6 +65,12 @@ class Cursor {
   Iterator end();
 
  private:
+  template <typename T>
+  friend class TypedCursor;
+
+  const bson_t& CurrentNative() const;
+  void Next();
+
   std::unique_ptr<impl::CursorImpl> impl_;
 };
 
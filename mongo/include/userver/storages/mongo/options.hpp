@@ -300,6 +300,37 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Makes the update events of a change stream contain the current
+/// version of the whole document
+/// @see
+/// https://www.mongodb.com/docs/manual/changeStreams/#lookup-full-document-for-update-operations
+class FullDocumentLookup {};
+
+/// Resumes a change stream right after the event with the resume token
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Specifies the longest time the server waits for new change stream
+/// events before returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,271 @@
+#pragma once
+
+/// @file userver/storages/mongo/typed_cursor.hpp
+/// @brief @copybrief storages::mongo::TypedCursor
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <bson/bson.h>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/exception.hpp>
+#include <userver/formats/bson/types.hpp>
+#include <userver/formats/bson/value.hpp>
+#include <userver/storages/mongo/cursor.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief A field of a BSON document being decoded by
+/// storages::mongo::DocumentDecoder
+///
+/// The field refers to the raw BSON data of the cursor and is only valid
+/// during the call of the field parser.
+class RawField final {
+ public:
+  /// @cond
+  // For internal use only
+  explicit RawField(const bson_iter_t& iter) noexcept : iter_(iter) {}
+  /// @endcond
+
+  RawField(const RawField&) = delete;
+  RawField& operator=(const RawField&) = delete;
+
+  std::string_view GetKey() const;
+
+  /// Returns true if the field is null or undefined
+  bool IsNull() const;
+
+  /// @brief Returns the value of the field
+  ///
+  /// The scalars are read right from the raw BSON with the same conversion
+  /// rules as of formats::bson::Value::As. Other types, e.g. nested documents,
+  /// are parsed from the result of AsValue. std::optional is empty for null.
+  template <typename T>
+  T As() const;
+
+  /// @brief Copies the field into a formats::bson::Value
+  /// @note Builds the DOM of the field, use for nested documents only
+  formats::bson::Value AsValue() const;
+
+ private:
+  bool AsBool() const;
+  std::int64_t AsInt64() const;
+  std::uint64_t AsUint64() const;
+  double AsDouble() const;
+  std::string_view AsStringView() const;
+  std::chrono::system_clock::time_point AsTimePoint() const;
+  formats::bson::Oid AsOid() const;
+
+  [[noreturn]] void ThrowOutOfRange() const;
+
+  const bson_iter_t& iter_;
+};
+
+namespace impl {
+
+/// Finds the decoded fields in the documents, remembering their positions
+class FieldLayout final {
+ public:
+  using FieldParser = utils::function_ref<void(std::size_t, const RawField&)>;
+
+  explicit FieldLayout(std::vector<std::string> names);
+
+  /// Calls the parser with the index of each decoded field of the document
+  void Parse(const bson_t& document, FieldParser parser);
+
+ private:
+  static constexpr std::size_t kSkippedField = -1;
+
+  struct Position final {
+    std::string key;
+    std::size_t field{kSkippedField};
+  };
+
+  std::size_t FindField(std::string_view key) const noexcept;
+
+  std::vector<std::string> names_;
+  std::vector<Position> positions_;
+};
+
+}  // namespace impl
+
+/// @brief Describes how to decode the raw BSON documents into `T`
+///
+/// Only the registered fields are read, the other fields are skipped. The
+/// fields missing from a document leave the respective members of a
+/// value-initialized `T` intact.
+///
+/// ## Example:
+///
+/// @code
+///   struct Item {
+///     std::string name;
+///     std::int64_t price{0};
+///   };
+///
+///   auto decoder = storages::mongo::DocumentDecoder<Item>{}
+///       .Field("name", &Item::name)
+///       .Field("price", &Item::price);
+///   for (const auto& item : storages::mongo::TypedCursor<Item>(
+///            collection.Find({}), std::move(decoder))) {
+///     ...
+///   }
+/// @endcode
+template <typename T>
+class DocumentDecoder final {
+ public:
+  using FieldParser = std::function<void(T&, const RawField&)>;
+
+  /// Registers a field decoded by the parser
+  DocumentDecoder& Field(std::string name, FieldParser parser) {
+    names_.push_back(std::move(name));
+    parsers_.push_back(std::move(parser));
+    return *this;
+  }
+
+  /// Registers a field decoded into the member with RawField::As
+  template <typename Member>
+  DocumentDecoder& Field(std::string name, Member T::*member) {
+    return Field(std::move(name), [member](T& value, const RawField& field) {
+      value.*member = field.As<Member>();
+    });
+  }
+
+ private:
+  template <typename U>
+  friend class TypedCursor;
+
+  std::vector<std::string> names_;
+  std::vector<FieldParser> parsers_;
+};
+
+/// @brief A view of storages::mongo::Cursor that decodes the documents
+/// right from the raw BSON into `T`, without building formats::bson::Document
+///
+/// The positions of the fields are found in the first document and are
+/// reused while the following documents have the same layout, as documents
+/// of a single query usually do.
+///
+/// @see storages::mongo::DocumentDecoder
+template <typename T>
+class TypedCursor final {
+ public:
+  TypedCursor(Cursor&& cursor, DocumentDecoder<T> decoder)
+      : cursor_(std::move(cursor)),
+        parsers_(std::move(decoder.parsers_)),
+        layout_(std::move(decoder.names_)) {}
+
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = ptrdiff_t;
+    using value_type = T;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    explicit Iterator(TypedCursor* cursor) : cursor_(cursor) {
+      if (cursor_ && !cursor_->cursor_.HasMore()) cursor_ = nullptr;
+      if (cursor_) value_ = cursor_->DecodeCurrent();
+    }
+
+    Iterator& operator++() {
+      cursor_->cursor_.Next();
+      if (cursor_->cursor_.HasMore()) {
+        value_ = cursor_->DecodeCurrent();
+      } else {
+        cursor_ = nullptr;
+        value_.reset();
+      }
+      return *this;
+    }
+
+    reference operator*() const { return *value_; }
+    pointer operator->() const { return &*value_; }
+
+    bool operator==(const Iterator& rhs) const {
+      return cursor_ == rhs.cursor_;
+    }
+    bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+
+   private:
+    TypedCursor* cursor_;
+    std::optional<T> value_;
+  };
+
+  bool HasMore() const { return cursor_.HasMore(); }
+  explicit operator bool() const { return HasMore(); }
+
+  Iterator begin() { return Iterator(this); }
+  // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+  Iterator end() { return Iterator(nullptr); }
+
+ private:
+  T DecodeCurrent() {
+    T value{};
+    layout_.Parse(cursor_.CurrentNative(),
+                  [&](std::size_t index, const RawField& field) {
+                    parsers_[index](value, field);
+                  });
+    return value;
+  }
+
+  Cursor cursor_;
+  std::vector<typename DocumentDecoder<T>::FieldParser> parsers_;
+  impl::FieldLayout layout_;
+};
+
+template <typename T>
+T RawField::As() const {
+  using TimePoint = std::chrono::system_clock::time_point;
+
+  if constexpr (meta::kIsOptional<T>) {
+    if (IsNull()) return std::nullopt;
+    return As<typename T::value_type>();
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return AsBool();
+  } else if constexpr (std::is_integral_v<T>) {
+    if constexpr (std::is_signed_v<T>) {
+      const auto value = AsInt64();
+      if (value < std::numeric_limits<T>::min() ||
+          value > std::numeric_limits<T>::max()) {
+        ThrowOutOfRange();
+      }
+      return static_cast<T>(value);
+    } else {
+      const auto value = AsUint64();
+      if (value > std::numeric_limits<T>::max()) ThrowOutOfRange();
+      return static_cast<T>(value);
+    }
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<T>(AsDouble());
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return std::string{AsStringView()};
+  } else if constexpr (std::is_same_v<T, TimePoint>) {
+    return AsTimePoint();
+  } else if constexpr (std::is_same_v<T, formats::bson::Oid>) {
+    return AsOid();
+  } else if constexpr (std::is_same_v<T, formats::bson::Value>) {
+    return AsValue();
+  } else {
+    return AsValue().template As<T>();
+  }
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
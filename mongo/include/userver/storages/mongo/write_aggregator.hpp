@@ -0,0 +1,117 @@
+#pragma once
+
+/// @file userver/storages/mongo/write_aggregator.hpp
+/// @brief @copybrief storages::mongo::WriteAggregator
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/bulk_ops.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/write_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// Settings of storages::mongo::WriteAggregator
+struct WriteAggregatorSettings final {
+  /// How long the first write of a batch waits for the other writes
+  std::chrono::milliseconds window{1};
+
+  /// The batch is sent right away when it reaches this number of writes
+  std::size_t max_batch_size{100};
+};
+
+/// @brief Merges the single writes of concurrent tasks to a collection
+/// into unordered bulk operations
+///
+/// The first write waits for up to WriteAggregatorSettings::window for the
+/// writes of the other tasks, then all of them are sent as a single unordered
+/// operations::Bulk in the task of the first write. Each task gets the result
+/// of its own write: the server error of the write is thrown as the respective
+/// exception, same as by storages::mongo::Collection.
+///
+/// The inserted and the upserted counters and the upserted ids of the results
+/// are exact. MongoDB only reports the totals of the matched, modified and
+/// deleted counters for the whole batch, so these counters are exact when all
+/// the writes of the kind in the batch have the same outcome. Otherwise the
+/// counters of such writes are reported as 1. Use storages::mongo::Collection
+/// directly if the exact counters matter.
+///
+/// As the writes are unordered, the writes of different tasks may be applied
+/// in any order. A single task observes its writes in order, because it waits
+/// for each one of them.
+///
+/// The sizes of the batches are reported in the `aggregated-writes` metrics
+/// of the collection.
+///
+/// ## Example:
+///
+/// @code
+///   storages::mongo::WriteAggregator aggregator(pool->GetCollection("events"));
+///   // in the concurrent handlers
+///   aggregator.InsertOne(formats::bson::MakeDoc("event", "click"));
+/// @endcode
+class WriteAggregator final {
+ public:
+  explicit WriteAggregator(Collection collection,
+                           WriteAggregatorSettings settings = {});
+  ~WriteAggregator();
+
+  WriteAggregator(const WriteAggregator&) = delete;
+  WriteAggregator& operator=(const WriteAggregator&) = delete;
+
+  /// Inserts a single document
+  WriteResult InsertOne(formats::bson::Document document);
+
+  /// @brief Replaces a single matching document
+  /// @see options::Upsert
+  template <typename... Options>
+  WriteResult ReplaceOne(formats::bson::Document selector,
+                         formats::bson::Document replacement,
+                         Options&&... options);
+
+  /// @brief Updates a single matching document
+  /// @see options::Upsert
+  template <typename... Options>
+  WriteResult UpdateOne(formats::bson::Document selector,
+                        formats::bson::Document update, Options&&... options);
+
+  /// Deletes a single matching document
+  WriteResult DeleteOne(formats::bson::Document selector);
+
+ private:
+  WriteResult Execute(bulk_ops::ReplaceOne&&);
+  // Single document updates only
+  WriteResult Execute(bulk_ops::Update&&);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+template <typename... Options>
+WriteResult WriteAggregator::ReplaceOne(formats::bson::Document selector,
+                                        formats::bson::Document replacement,
+                                        Options&&... options) {
+  bulk_ops::ReplaceOne replace_subop(std::move(selector),
+                                     std::move(replacement));
+  (replace_subop.SetOption(std::forward<Options>(options)), ...);
+  return Execute(std::move(replace_subop));
+}
+
+template <typename... Options>
+WriteResult WriteAggregator::UpdateOne(formats::bson::Document selector,
+                                       formats::bson::Document update,
+                                       Options&&... options) {
+  bulk_ops::Update update_subop(bulk_ops::Update::Mode::kSingle,
+                                std::move(selector), std::move(update));
+  (update_subop.SetOption(std::forward<Options>(options)), ...);
+  return Execute(std::move(update_subop));
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -1,17 +1,103 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
 #include <userver/components/component_config.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/serialize.hpp>
+#include <userver/storages/mongo/operations.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace components::impl {
 
+namespace {
+
+// The more samples, the more even the ranges are
+constexpr std::size_t kSamplesPerRange = 16;
+
+}  // namespace
+
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(
     const ComponentConfig& config) {
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+std::size_t GetMongoCacheFullUpdateParallelism(const ComponentConfig& config) {
+  return config["full-update-parallelism"].As<std::size_t>(1);
+}
+
+bool GetMongoCacheUseChangeStream(const ComponentConfig& config) {
+  return config["use-change-stream"].As<bool>(false);
+}
+
+std::string GetMongoCacheIdKey(const formats::bson::Value& id) {
+  return std::string{
+      formats::bson::ToCanonicalJsonString(formats::bson::MakeDoc("_id", id))
+          .GetView()};
+}
+
+bool IsMongoCacheUpsertEvent(std::string_view operation_type) {
+  return operation_type == "insert" || operation_type == "update" ||
+         operation_type == "replace";
+}
+
+std::vector<formats::bson::Value> SampleMongoCacheIdBoundaries(
+    storages::mongo::Collection collection, std::size_t parallelism,
+    bool is_secondary_preferred) {
+  namespace bson = formats::bson;
+  namespace sm = storages::mongo;
+  UASSERT(parallelism > 1);
+
+  const auto sample_size =
+      static_cast<std::int64_t>(parallelism * kSamplesPerRange);
+  sm::operations::Aggregate aggregate{bson::MakeArray(
+      bson::MakeDoc("$sample", bson::MakeDoc("size", sample_size)),
+      bson::MakeDoc("$project", bson::MakeDoc("_id", 1)),
+      bson::MakeDoc("$sort", bson::MakeDoc("_id", 1)))};
+  if (is_secondary_preferred) {
+    aggregate.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+
+  std::vector<bson::Value> samples;
+  for (const auto& doc : collection.Execute(aggregate)) {
+    samples.push_back(doc["_id"]);
+  }
+
+  std::vector<bson::Value> boundaries;
+  for (std::size_t i = 1; i < parallelism; ++i) {
+    const auto& sample = samples[i * samples.size() / parallelism];
+    if (boundaries.empty() || !(boundaries.back() == sample)) {
+      boundaries.push_back(sample);
+    }
+  }
+  return boundaries;
+}
+
+std::vector<formats::bson::Document> MakeMongoCacheIdRangeFilters(
+    const std::vector<formats::bson::Value>& boundaries) {
+  namespace bson = formats::bson;
+
+  std::vector<bson::Document> filters;
+  if (boundaries.empty()) {
+    filters.emplace_back();
+    return filters;
+  }
+
+  filters.reserve(boundaries.size() + 1);
+  // $not also matches the _id of other types, to which $gte/$lt never apply
+  filters.push_back(bson::MakeDoc(
+      "_id", bson::MakeDoc("$not", bson::MakeDoc("$gte", boundaries.front()))));
+  for (std::size_t i = 1; i < boundaries.size(); ++i) {
+    filters.push_back(bson::MakeDoc(
+        "_id",
+        bson::MakeDoc("$gte", boundaries[i - 1], "$lt", boundaries[i])));
+  }
+  filters.push_back(
+      bson::MakeDoc("_id", bson::MakeDoc("$gte", boundaries.back())));
+  return filters;
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +108,15 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    full-update-parallelism:
+        type: integer
+        description: number of _id ranges read concurrently by full updates
+        defaultDescription: 1
+        minimum: 1
+    use-change-stream:
+        type: boolean
+        description: apply the events of a change stream by incremental updates instead of polling
+        defaultDescription: false
 )";
 }
 
@@ -0,0 +1,34 @@
+#include <userver/cache/base_mongo_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+
+TEST(MongoCacheIdRanges, NoBoundaries) {
+  const auto filters = components::impl::MakeMongoCacheIdRangeFilters({});
+  ASSERT_EQ(filters.size(), 1);
+  EXPECT_EQ(filters[0], bson::MakeDoc());
+}
+
+TEST(MongoCacheIdRanges, Boundaries) {
+  const std::vector<bson::Value> boundaries{
+      bson::ValueBuilder{"b"}.ExtractValue(),
+      bson::ValueBuilder{"d"}.ExtractValue()};
+  const auto filters =
+      components::impl::MakeMongoCacheIdRangeFilters(boundaries);
+
+  ASSERT_EQ(filters.size(), 3);
+  EXPECT_EQ(filters[0],
+            bson::MakeDoc("_id", bson::MakeDoc("$not",
+                                               bson::MakeDoc("$gte", "b"))));
+  EXPECT_EQ(filters[1],
+            bson::MakeDoc("_id", bson::MakeDoc("$gte", "b", "$lt", "d")));
+  EXPECT_EQ(filters[2], bson::MakeDoc("_id", bson::MakeDoc("$gte", "d")));
+}
+
+USERVER_NAMESPACE_END
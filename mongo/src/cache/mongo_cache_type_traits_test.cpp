@@ -53,6 +53,14 @@ struct IncorrectSignatureOfFindOperation {
   static storages::mongo::operations::Find GetFindOperation(int x, int y);
 };
 
+struct CorrectIdRangeBoundaries {
+  static std::vector<formats::bson::Value> GetIdRangeBoundaries();
+};
+
+struct IncorrectReturnTypeOfIdRangeBoundaries {
+  static std::vector<int> GetIdRangeBoundaries();
+};
+
 TEST(CheckTraits, DeserializeObject) {
   EXPECT_TRUE(mongo_cache::impl::kHasCorrectDeserializeObject<
               CorrectDeserializeObject>);
@@ -71,6 +79,15 @@ TEST(CheckTraits, FindOperation) {
                IncorrectSignatureOfFindOperation>);
 }
 
+TEST(CheckTraits, IdRangeBoundaries) {
+  EXPECT_TRUE(mongo_cache::impl::kHasCorrectIdRangeBoundaries<
+              CorrectIdRangeBoundaries>);
+  EXPECT_FALSE(mongo_cache::impl::kHasCorrectIdRangeBoundaries<
+               IncorrectReturnTypeOfIdRangeBoundaries>);
+  EXPECT_FALSE(mongo_cache::impl::kHasIdRangeBoundaries<
+               CorrectMongoCacheTraits>);
+}
+
 TEST(CheckTraits, CorrectTraits) {
   mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{};
 }
@@ -0,0 +1,45 @@
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+
+CDriverChangeStreamImpl::CDriverChangeStreamImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client,
+    cdriver::ChangeStreamPtr stream)
+    : client_(std::move(client)), stream_(std::move(stream)) {
+  UASSERT(client_ && stream_);
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::Next() {
+  const bson_t* event = nullptr;
+  if (mongoc_change_stream_next(stream_.get(), &event)) {
+    return formats::bson::Document(
+        formats::bson::impl::MutableBson::CopyNative(event).Extract());
+  }
+  MongoError error;
+  if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(),
+                                          nullptr)) {
+    error.Throw("Error iterating over change stream");
+  }
+  return std::nullopt;
+}
+
+formats::bson::Document CDriverChangeStreamImpl::GetResumeToken() const {
+  const auto* token = mongoc_change_stream_get_resume_token(stream_.get());
+  if (!token) return {};
+  return formats::bson::Document(
+      formats::bson::impl::MutableBson::CopyNative(token).Extract());
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
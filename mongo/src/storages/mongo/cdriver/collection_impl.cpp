@@ -15,6 +15,7 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -538,6 +539,32 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
       std::move(context.stats)));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  if (operation.impl_->read_prefs.Get()) {
+    mongoc_collection_set_read_prefs(context.collection.get(),
+                                     operation.impl_->read_prefs.Get());
+  }
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+
+  MongoError error;
+  stats::OperationStopwatch stopwatch(std::move(context.stats));
+  // The initial aggregate is run right away
+  impl::cdriver::ChangeStreamPtr stream(mongoc_collection_watch(
+      context.collection.get(), pipeline_doc.GetBson().get(),
+      impl::GetNative(operation.impl_->options)));
+  if (mongoc_change_stream_error_document(stream.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  stopwatch.AccountSuccess();
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(stream)));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   auto context = MakeRequestContext("mongo_drop", operation);
 
@@ -553,6 +580,10 @@ void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   }
 }
 
+stats::CollectionStatistics& CDriverCollectionImpl::GetStatistics() {
+  return *statistics_;
+}
+
 cdriver::CDriverPoolImpl::BoundClientPtr CDriverCollectionImpl::GetClient(
     stats::OperationStatisticsItem& stats) const {
   try {
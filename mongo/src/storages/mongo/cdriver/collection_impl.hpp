@@ -40,8 +40,11 @@ class CDriverCollectionImpl : public CollectionImpl {
   WriteResult Execute(const operations::FindAndRemove&) override;
   WriteResult Execute(operations::Bulk&&) override;
   Cursor Execute(const operations::Aggregate&) override;
+  ChangeStream Execute(const operations::Watch&) override;
   void Execute(const operations::Drop&) override;
 
+  stats::CollectionStatistics& GetStatistics() override;
+
  private:
   cdriver::CDriverPoolImpl::BoundClientPtr GetClient(
       stats::OperationStatisticsItem& stats) const;
@@ -44,7 +44,9 @@ CDriverCursorImpl::CDriverCursorImpl(
   Next();
 }
 
-bool CDriverCursorImpl::IsValid() const { return cursor_ || current_; }
+bool CDriverCursorImpl::IsValid() const {
+  return cursor_ || current_native_;
+}
 
 bool CDriverCursorImpl::HasMore() const {
   return cursor_ && mongoc_cursor_more(cursor_.get());
@@ -52,13 +54,24 @@ bool CDriverCursorImpl::HasMore() const {
 
 const formats::bson::Document& CDriverCursorImpl::Current() const {
   if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  if (!current_) {
+    current_ = formats::bson::Document(
+        formats::bson::impl::MutableBson::CopyNative(current_native_)
+            .Extract());
+  }
   return *current_;
 }
 
+const bson_t& CDriverCursorImpl::CurrentNative() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return *current_native_;
+}
+
 void CDriverCursorImpl::Next() {
   if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
 
   current_ = std::nullopt;
+  current_native_ = nullptr;
   if (!HasMore()) {
     UASSERT(!cursor_ && !client_);
     return;
@@ -72,8 +85,7 @@ void CDriverCursorImpl::Next() {
   MongoError error;
   while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
     if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
-      current_ = formats::bson::Document(
-          formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+      current_native_ = current_bson;
       break;
     }
   }
@@ -85,6 +97,8 @@ void CDriverCursorImpl::Next() {
     cursor_next_sw.AccountError(error.GetKind());
   }
   if (!HasMore()) {
+    // The last document outlives the cursor
+    if (current_native_) current_native_ = Current().GetBson().get();
     cursor_.reset();
     client_.reset();
   }
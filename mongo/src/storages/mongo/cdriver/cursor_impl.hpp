@@ -25,10 +25,14 @@ class CDriverCursorImpl final : public CursorImpl {
   bool HasMore() const override;
 
   const formats::bson::Document& Current() const override;
+  const bson_t& CurrentNative() const override;
   void Next() override;
 
  private:
-  std::optional<formats::bson::Document> current_;
+  // Owned either by cursor_ or by current_
+  const bson_t* current_native_{nullptr};
+  // Built on demand, the typed cursors do not need it
+  mutable std::optional<formats::bson::Document> current_;
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
   cdriver::CursorPtr cursor_;
   const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
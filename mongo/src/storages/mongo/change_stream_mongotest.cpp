@@ -0,0 +1,84 @@
+#include <userver/utest/utest.hpp>
+
+#include <optional>
+#include <string>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+class ChangeStream : public MongoPoolFixture {};
+
+constexpr std::chrono::milliseconds kMaxAwaitTime{100};
+
+bson::Document NextEvent(mongo::ChangeStream& stream) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (!deadline.IsReached()) {
+    auto event = stream.Next();
+    if (event) return std::move(*event);
+  }
+  ADD_FAILURE() << "No change stream event";
+  return {};
+}
+
+}  // namespace
+
+UTEST_F(ChangeStream, Events) {
+  auto coll = GetDefaultPool().GetCollection("change_stream");
+  auto stream =
+      coll.Watch(bson::MakeArray(), mongo::options::FullDocumentLookup{},
+                 mongo::options::MaxAwaitTime{kMaxAwaitTime});
+
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 1));
+  coll.UpdateOne(bson::MakeDoc("_id", 1),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 2)));
+  coll.DeleteOne(bson::MakeDoc("_id", 1));
+
+  auto event = NextEvent(stream);
+  EXPECT_EQ("insert", event["operationType"].As<std::string>());
+  EXPECT_EQ(1, event["fullDocument"]["x"].As<int>());
+
+  event = NextEvent(stream);
+  EXPECT_EQ("update", event["operationType"].As<std::string>());
+  EXPECT_EQ(1, event["documentKey"]["_id"].As<int>());
+  // The document is already deleted
+  EXPECT_TRUE(event["fullDocument"].IsNull());
+
+  event = NextEvent(stream);
+  EXPECT_EQ("delete", event["operationType"].As<std::string>());
+  EXPECT_EQ(1, event["documentKey"]["_id"].As<int>());
+
+  EXPECT_FALSE(stream.Next());
+}
+
+UTEST_F(ChangeStream, Resume) {
+  auto coll = GetDefaultPool().GetCollection("change_stream_resume");
+  std::optional<mongo::ChangeStream> stream{coll.Watch(
+      bson::MakeArray(), mongo::options::MaxAwaitTime{kMaxAwaitTime})};
+
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+  coll.InsertOne(bson::MakeDoc("_id", 2));
+  EXPECT_EQ(1, NextEvent(*stream)["documentKey"]["_id"].As<int>());
+  const auto token = stream->GetResumeToken();
+  stream.reset();
+
+  auto resumed = coll.Watch(bson::MakeArray(),
+                            mongo::options::ResumeAfter{token},
+                            mongo::options::MaxAwaitTime{kMaxAwaitTime});
+  EXPECT_EQ(2, NextEvent(resumed)["documentKey"]["_id"].As<int>());
+}
+
+UTEST_F(ChangeStream, InvalidPipeline) {
+  UEXPECT_THROW(mongo::operations::Watch{bson::MakeDoc("a", 1)},
+                mongo::InvalidQueryArgumentException);
+}
+
+USERVER_NAMESPACE_END
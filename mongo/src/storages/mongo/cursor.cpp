@@ -15,6 +15,12 @@ Cursor& Cursor::operator=(Cursor&&) noexcept = default;
 
 bool Cursor::HasMore() const { return impl_->IsValid(); }
 
+const bson_t& Cursor::CurrentNative() const {
+  return impl_->CurrentNative();
+}
+
+void Cursor::Next() { impl_->Next(); }
+
 Cursor::Iterator Cursor::begin() { return Iterator(this); }
 
 // no, part of the iterator interface
@@ -58,6 +58,12 @@ void OperationStatisticsItem::Reset() {
   timings.Reset();
 }
 
+void WriteAggregationStatistics::AccountBatch(std::size_t size) noexcept {
+  ++batches;
+  writes += Rate{size};
+  batch_sizes.GetCurrentCounter().Account(size);
+}
+
 Rate OperationStatisticsItem::GetCounter(ErrorType error_type) const noexcept {
   return counters[static_cast<std::size_t>(error_type)].Load();
 }
@@ -139,6 +145,8 @@ std::string_view ToString(OpType type) {
       return "bulk";
     case Type::kAggregate:
       return "aggregate";
+    case Type::kWatch:
+      return "watch";
     case Type::kDrop:
       return "drop";
   }
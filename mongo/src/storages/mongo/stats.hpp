@@ -74,6 +74,7 @@ enum class OpType {
   kCountApprox,
   kFind,
   kAggregate,
+  kWatch,
 
   kWriteMin,
   kInsertOne = kWriteMin,
@@ -98,8 +99,25 @@ struct OperationKey final {
   OpType op_type{OpType::kInvalid};
 };
 
+using BatchSizePercentile =
+    utils::statistics::Percentile</*buckets =*/101, uint32_t,
+                                  /*extra_buckets=*/90,
+                                  /*extra_bucket_size=*/10>;
+using AggregatedBatchSizePercentile =
+    utils::statistics::RecentPeriod<BatchSizePercentile, BatchSizePercentile>;
+
+/// Statistics of storages::mongo::WriteAggregator
+struct WriteAggregationStatistics final {
+  void AccountBatch(std::size_t size) noexcept;
+
+  Counter batches{0};
+  Counter writes{0};
+  AggregatedBatchSizePercentile batch_sizes;
+};
+
 struct CollectionStatistics final {
   rcu::RcuMap<OperationKey, OperationStatisticsItem> items;
+  WriteAggregationStatistics aggregated_writes;
 };
 
 struct PoolConnectStatistics {
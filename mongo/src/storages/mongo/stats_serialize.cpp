@@ -13,6 +13,8 @@ namespace {
 constexpr std::initializer_list<double> kOperationsStatisticsPercentiles = {
     95, 98, 99, 100};
 
+constexpr std::initializer_list<double> kBatchSizePercentiles = {50, 95, 100};
+
 using Rate = utils::statistics::Rate;
 
 struct OperationStatisticsSum final {
@@ -131,6 +133,18 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   writer["by-collection"] = coll_overall;
 
+  const auto& aggregated_writes = coll_stats.stats.aggregated_writes;
+  if (aggregated_writes.batches.Load()) {
+    auto aggregated_writer = writer["aggregated-writes"];
+    aggregated_writer["batches"] = aggregated_writes.batches;
+    aggregated_writer["writes"] = aggregated_writes.writes;
+    if (auto batch_size_writer = aggregated_writer["batch-size-1min"]) {
+      DumpMetric(batch_size_writer,
+                 aggregated_writes.batch_sizes.GetStatsForPeriod(),
+                 kBatchSizePercentiles);
+    }
+  }
+
   coll_stats.overall_stats.Add(coll_overall);
 }
 
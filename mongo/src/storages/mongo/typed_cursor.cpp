@@ -0,0 +1,152 @@
+#include <userver/storages/mongo/typed_cursor.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace {
+
+constexpr std::int64_t kMaxIntDouble{std::int64_t{1}
+                                     << std::numeric_limits<double>::digits};
+
+}  // namespace
+
+std::string_view RawField::GetKey() const {
+  return {bson_iter_key(&iter_), bson_iter_key_len(&iter_)};
+}
+
+bool RawField::IsNull() const {
+  const auto type = bson_iter_type(&iter_);
+  return type == BSON_TYPE_NULL || type == BSON_TYPE_UNDEFINED;
+}
+
+bool RawField::AsBool() const {
+  if (BSON_ITER_HOLDS_BOOL(&iter_)) return bson_iter_bool(&iter_);
+  throw formats::bson::TypeMismatchException(bson_iter_type(&iter_),
+                                             BSON_TYPE_BOOL, GetKey());
+}
+
+std::int64_t RawField::AsInt64() const {
+  if (BSON_ITER_HOLDS_INT32(&iter_)) return bson_iter_int32(&iter_);
+  if (BSON_ITER_HOLDS_INT64(&iter_)) return bson_iter_int64(&iter_);
+  if (BSON_ITER_HOLDS_DOUBLE(&iter_)) {
+    const auto as_double = bson_iter_double(&iter_);
+    double int_part = 0.0;
+    const auto frac_part = std::modf(as_double, &int_part);
+    if (frac_part || std::abs(as_double) >= kMaxIntDouble) {
+      throw formats::bson::ConversionException("Conversion of ")
+          << GetKey() << '=' << as_double
+          << " to integer causes precision change";
+    }
+    return static_cast<std::int64_t>(as_double);
+  }
+  throw formats::bson::TypeMismatchException(bson_iter_type(&iter_),
+                                             BSON_TYPE_INT64, GetKey());
+}
+
+std::uint64_t RawField::AsUint64() const {
+  const auto value = AsInt64();
+  if (value <= -1) {
+    throw formats::bson::ConversionException(
+        "Cannot convert to unsigned value from negative ")
+        << GetKey() << '=' << value;
+  }
+  return static_cast<std::uint64_t>(value);
+}
+
+double RawField::AsDouble() const {
+  if (BSON_ITER_HOLDS_DOUBLE(&iter_)) return bson_iter_double(&iter_);
+  if (BSON_ITER_HOLDS_INT32(&iter_)) return bson_iter_int32(&iter_);
+  if (BSON_ITER_HOLDS_INT64(&iter_)) {
+    const auto as_int = bson_iter_int64(&iter_);
+    if (as_int == std::numeric_limits<std::int64_t>::min() ||
+        std::abs(as_int) > kMaxIntDouble) {
+      throw formats::bson::ConversionException("Conversion of ")
+          << GetKey() << '=' << as_int << " to double causes precision loss";
+    }
+    return static_cast<double>(as_int);
+  }
+  throw formats::bson::TypeMismatchException(bson_iter_type(&iter_),
+                                             BSON_TYPE_DOUBLE, GetKey());
+}
+
+std::string_view RawField::AsStringView() const {
+  if (BSON_ITER_HOLDS_UTF8(&iter_)) {
+    std::uint32_t length = 0;
+    const char* data = bson_iter_utf8(&iter_, &length);
+    return {data, length};
+  }
+  throw formats::bson::TypeMismatchException(bson_iter_type(&iter_),
+                                             BSON_TYPE_UTF8, GetKey());
+}
+
+std::chrono::system_clock::time_point RawField::AsTimePoint() const {
+  if (BSON_ITER_HOLDS_DATE_TIME(&iter_)) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::milliseconds(bson_iter_date_time(&iter_)));
+  }
+  throw formats::bson::TypeMismatchException(bson_iter_type(&iter_),
+                                             BSON_TYPE_DATE_TIME, GetKey());
+}
+
+formats::bson::Oid RawField::AsOid() const {
+  if (BSON_ITER_HOLDS_OID(&iter_)) return *bson_iter_oid(&iter_);
+  throw formats::bson::TypeMismatchException(bson_iter_type(&iter_),
+                                             BSON_TYPE_OID, GetKey());
+}
+
+formats::bson::Value RawField::AsValue() const {
+  formats::bson::impl::MutableBson holder;
+  const auto key = GetKey();
+  if (!bson_append_iter(holder.Get(), key.data(), key.size(), &iter_)) {
+    throw formats::bson::BsonException("Cannot copy the field ") << key;
+  }
+  return formats::bson::Document(holder.Extract())[std::string{key}];
+}
+
+void RawField::ThrowOutOfRange() const {
+  throw formats::bson::ConversionException("Value of ")
+      << GetKey() << " is out of range of the integer type";
+}
+
+namespace impl {
+
+FieldLayout::FieldLayout(std::vector<std::string> names)
+    : names_(std::move(names)) {}
+
+std::size_t FieldLayout::FindField(std::string_view key) const noexcept {
+  const auto it = std::find(names_.begin(), names_.end(), key);
+  return it == names_.end() ? kSkippedField : it - names_.begin();
+}
+
+void FieldLayout::Parse(const bson_t& document, FieldParser parser) {
+  bson_iter_t iter;
+  if (!bson_iter_init(&iter, &document)) {
+    throw formats::bson::ParseException("Malformed BSON document");
+  }
+
+  std::size_t position = 0;
+  for (; bson_iter_next(&iter); ++position) {
+    const std::string_view key{bson_iter_key(&iter), bson_iter_key_len(&iter)};
+    if (position == positions_.size()) {
+      positions_.push_back({std::string{key}, FindField(key)});
+    } else if (positions_[position].key != key) {
+      // The layout differs from the previous documents
+      positions_[position] = {std::string{key}, FindField(key)};
+    }
+
+    const auto field = positions_[position].field;
+    if (field != kSkippedField) parser(field, RawField{iter});
+  }
+}
+
+}  // namespace impl
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
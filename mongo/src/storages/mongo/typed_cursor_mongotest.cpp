@@ -0,0 +1,104 @@
+#include <userver/utest/utest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+#include <userver/storages/mongo/typed_cursor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+
+class TypedCursor : public MongoPoolFixture {};
+
+struct Item {
+  int id{0};
+  std::string name;
+  std::optional<double> price;
+  std::vector<int> tags;
+};
+
+mongo::DocumentDecoder<Item> MakeDecoder() {
+  mongo::DocumentDecoder<Item> decoder;
+  decoder.Field("_id", &Item::id)
+      .Field("name", &Item::name)
+      .Field("price", &Item::price)
+      .Field("tags", &Item::tags);
+  return decoder;
+}
+
+}  // namespace
+
+UTEST_F(TypedCursor, Decode) {
+  auto coll = GetDefaultPool().GetCollection("typed_cursor");
+  coll.InsertOne(bson::MakeDoc("_id", 1, "name", "a", "price", 1.5, "tags",
+                               bson::MakeArray(1, 2)));
+  // Different layout and an unknown field
+  coll.InsertOne(bson::MakeDoc("name", "b", "extra", true, "_id", 2, "price",
+                               nullptr));
+  coll.InsertOne(bson::MakeDoc("_id", 3, "name", "c", "price", 3));
+
+  std::vector<Item> items;
+  const mongo::options::Sort sort{{"_id", mongo::options::Sort::kAscending}};
+  for (const auto& item :
+       mongo::TypedCursor<Item>(coll.Find({}, sort), MakeDecoder())) {
+    items.push_back(item);
+  }
+
+  ASSERT_EQ(3, items.size());
+  EXPECT_EQ(1, items[0].id);
+  EXPECT_EQ("a", items[0].name);
+  EXPECT_EQ(1.5, items[0].price);
+  EXPECT_EQ((std::vector<int>{1, 2}), items[0].tags);
+
+  EXPECT_EQ(2, items[1].id);
+  EXPECT_EQ("b", items[1].name);
+  EXPECT_FALSE(items[1].price);
+  EXPECT_TRUE(items[1].tags.empty());
+
+  EXPECT_EQ(3, items[2].id);
+  EXPECT_EQ(3.0, items[2].price);
+}
+
+UTEST_F(TypedCursor, ManyBatches) {
+  auto coll = GetDefaultPool().GetCollection("typed_cursor_batches");
+  // More than the default size of the first batch
+  constexpr int kCount = 250;
+  std::vector<bson::Document> docs;
+  for (int i = 0; i < kCount; ++i) {
+    docs.push_back(bson::MakeDoc("_id", i, "name", std::to_string(i)));
+  }
+  coll.InsertMany(std::move(docs));
+
+  int count = 0;
+  for (const auto& item :
+       mongo::TypedCursor<Item>(coll.Find({}), MakeDecoder())) {
+    EXPECT_EQ(std::to_string(item.id), item.name);
+    ++count;
+  }
+  EXPECT_EQ(kCount, count);
+}
+
+UTEST_F(TypedCursor, TypeMismatch) {
+  auto coll = GetDefaultPool().GetCollection("typed_cursor_mismatch");
+  coll.InsertOne(bson::MakeDoc("_id", "not a number"));
+
+  mongo::TypedCursor<Item> cursor(coll.Find({}), MakeDecoder());
+  UEXPECT_THROW(cursor.begin(), bson::TypeMismatchException);
+}
+
+UTEST_F(TypedCursor, Empty) {
+  auto coll = GetDefaultPool().GetCollection("typed_cursor_empty");
+  mongo::TypedCursor<Item> cursor(coll.Find({}), MakeDecoder());
+  EXPECT_FALSE(cursor);
+  EXPECT_EQ(cursor.begin(), cursor.end());
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,206 @@
+#include <userver/storages/mongo/write_aggregator.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
+
+#include <storages/mongo/collection_impl.hpp>
+#include <storages/mongo/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace {
+
+using SubOperation = std::variant<bulk_ops::InsertOne, bulk_ops::ReplaceOne,
+                                  bulk_ops::Update, bulk_ops::Delete>;
+
+struct Write final {
+  SubOperation operation;
+  engine::Promise<WriteResult> promise;
+};
+
+struct BatchTotals final {
+  // Each single write affects at most one document, so a write is reported
+  // as affected if any write of the batch is
+  int matched;
+  int modified;
+  int deleted;
+};
+
+WriteResult MakeWriteResult(const SubOperation& operation,
+                            const BatchTotals& totals,
+                            const formats::bson::Value* upserted_id) {
+  if (upserted_id) {
+    return WriteResult{formats::bson::MakeDoc(
+        "nUpserted", 1, "upserted",
+        formats::bson::MakeArray(
+            formats::bson::MakeDoc("index", 0, "_id", *upserted_id)))};
+  }
+
+  if (std::holds_alternative<bulk_ops::InsertOne>(operation)) {
+    return WriteResult{formats::bson::MakeDoc("nInserted", 1)};
+  }
+  if (std::holds_alternative<bulk_ops::Delete>(operation)) {
+    return WriteResult{formats::bson::MakeDoc("nRemoved", totals.deleted)};
+  }
+  return WriteResult{formats::bson::MakeDoc("nMatched", totals.matched,
+                                            "nModified", totals.modified)};
+}
+
+}  // namespace
+
+class WriteAggregator::Impl final {
+ public:
+  Impl(Collection&& collection, WriteAggregatorSettings&& settings,
+       stats::WriteAggregationStatistics& statistics)
+      : collection_(std::move(collection)),
+        settings_(std::move(settings)),
+        statistics_(statistics) {
+    UINVARIANT(settings_.max_batch_size > 0,
+               "max_batch_size of WriteAggregator must be positive");
+  }
+
+  WriteResult Execute(SubOperation&& operation) {
+    engine::Future<WriteResult> future;
+    bool is_collecting = false;
+    {
+      const std::lock_guard lock(mutex_);
+      auto& write = pending_.emplace_back(Write{std::move(operation), {}});
+      future = write.promise.get_future();
+      if (!is_collecting_) {
+        is_collecting_ = is_collecting = true;
+      } else if (pending_.size() >= settings_.max_batch_size) {
+        batch_full_.NotifyOne();
+      }
+    }
+
+    // The first write of the batch waits for the others and sends them all
+    if (is_collecting) Flush();
+    return future.get();
+  }
+
+ private:
+  void Flush() {
+    std::vector<Write> writes;
+    {
+      std::unique_lock lock(mutex_);
+      // If the task is cancelled, the writes are sent right away
+      [[maybe_unused]] const bool is_full =
+          batch_full_.WaitFor(lock, settings_.window, [this] {
+            return pending_.size() >= settings_.max_batch_size;
+          });
+      writes.swap(pending_);
+      is_collecting_ = false;
+    }
+
+    // The writes of the other tasks must not fail because of this task
+    const engine::TaskCancellationBlocker block_cancel;
+    const utils::span<Write> all_writes{writes};
+    for (std::size_t offset = 0; offset < writes.size();
+         offset += settings_.max_batch_size) {
+      ExecuteBatch(all_writes.subspan(
+          offset, std::min(settings_.max_batch_size, writes.size() - offset)));
+    }
+  }
+
+  void ExecuteBatch(utils::span<Write> batch) {
+    statistics_.AccountBatch(batch.size());
+
+    auto bulk =
+        collection_.MakeUnorderedBulk(options::SuppressServerExceptions{});
+    for (const auto& write : batch) {
+      std::visit([&bulk](const auto& operation) { bulk.Append(operation); },
+                 write.operation);
+    }
+
+    WriteResult result;
+    try {
+      result = collection_.Execute(std::move(bulk));
+    } catch (const std::exception&) {
+      for (auto& write : batch) {
+        write.promise.set_exception(std::current_exception());
+      }
+      return;
+    }
+
+    const auto wc_errors = result.WriteConcernErrors();
+    const auto server_errors = result.ServerErrors();
+    const auto upserted_ids = result.UpsertedIds();
+    const BatchTotals totals{
+        result.MatchedCount() != 0,
+        result.ModifiedCount() != 0,
+        result.DeletedCount() != 0,
+    };
+
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+      auto& write = batch[i];
+      try {
+        if (const auto it = server_errors.find(i); it != server_errors.end()) {
+          it->second.Throw("Error running aggregated write");
+        }
+        if (!wc_errors.empty()) {
+          wc_errors.front().Throw("Error running aggregated write");
+        }
+
+        const auto upserted_it = upserted_ids.find(i);
+        write.promise.set_value(MakeWriteResult(
+            write.operation, totals,
+            upserted_it != upserted_ids.end() ? &upserted_it->second
+                                              : nullptr));
+      } catch (const std::exception&) {
+        write.promise.set_exception(std::current_exception());
+      }
+    }
+  }
+
+  Collection collection_;
+  const WriteAggregatorSettings settings_;
+  stats::WriteAggregationStatistics& statistics_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable batch_full_;
+  std::vector<Write> pending_;
+  bool is_collecting_{false};
+};
+
+WriteAggregator::WriteAggregator(Collection collection,
+                                 WriteAggregatorSettings settings)
+    : impl_(std::make_unique<Impl>(
+          Collection{collection}, std::move(settings),
+          collection.impl_->GetStatistics().aggregated_writes)) {}
+
+WriteAggregator::~WriteAggregator() = default;
+
+WriteResult WriteAggregator::InsertOne(formats::bson::Document document) {
+  return impl_->Execute(bulk_ops::InsertOne(std::move(document)));
+}
+
+WriteResult WriteAggregator::DeleteOne(formats::bson::Document selector) {
+  return impl_->Execute(
+      bulk_ops::Delete(bulk_ops::Delete::Mode::kSingle, std::move(selector)));
+}
+
+WriteResult WriteAggregator::Execute(bulk_ops::ReplaceOne&& replace) {
+  return impl_->Execute(std::move(replace));
+}
+
+WriteResult WriteAggregator::Execute(bulk_ops::Update&& update) {
+  return impl_->Execute(std::move(update));
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr int kWritesCount = 10;
+
+class WriteAggregator : public MongoPoolFixture {};
+
+mongo::WriteAggregatorSettings MakeSettings() {
+  mongo::WriteAggregatorSettings settings;
+  settings.window = 100ms;
+  settings.max_batch_size = kWritesCount;
+  return settings;
+}
+
+}  // namespace
+
+UTEST_F_MT(WriteAggregator, ConcurrentInserts, 2) {
+  auto coll = GetDefaultPool().GetCollection("aggregated_inserts");
+  mongo::WriteAggregator aggregator(coll, MakeSettings());
+
+  std::vector<engine::TaskWithResult<mongo::WriteResult>> tasks;
+  for (int i = 0; i < kWritesCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&aggregator, i] {
+      return aggregator.InsertOne(bson::MakeDoc("x", i));
+    }));
+  }
+  for (auto& task : tasks) {
+    EXPECT_EQ(1, task.Get().InsertedCount());
+  }
+
+  EXPECT_EQ(kWritesCount, coll.Count({}));
+}
+
+UTEST_F(WriteAggregator, ServerErrors) {
+  auto coll = GetDefaultPool().GetCollection("aggregated_errors");
+  mongo::WriteAggregator aggregator(coll, MakeSettings());
+
+  EXPECT_EQ(1, aggregator.InsertOne(bson::MakeDoc("_id", 1)).InsertedCount());
+
+  auto duplicate = engine::AsyncNoSpan(
+      [&] { return aggregator.InsertOne(bson::MakeDoc("_id", 1)); });
+  auto unique = engine::AsyncNoSpan(
+      [&] { return aggregator.InsertOne(bson::MakeDoc("_id", 2)); });
+
+  UEXPECT_THROW(duplicate.Get(), mongo::DuplicateKeyException);
+  EXPECT_EQ(1, unique.Get().InsertedCount());
+  EXPECT_EQ(2, coll.Count({}));
+}
+
+UTEST_F(WriteAggregator, UpdatesAndDeletes) {
+  auto coll = GetDefaultPool().GetCollection("aggregated_updates");
+  mongo::WriteAggregator aggregator(coll, MakeSettings());
+
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", 0));
+  coll.InsertOne(bson::MakeDoc("_id", 2, "x", 0));
+
+  auto update = engine::AsyncNoSpan([&] {
+    return aggregator.UpdateOne(bson::MakeDoc("_id", 1),
+                                bson::MakeDoc("$set", bson::MakeDoc("x", 1)));
+  });
+  auto upsert = engine::AsyncNoSpan([&] {
+    return aggregator.UpdateOne(bson::MakeDoc("_id", 3),
+                                bson::MakeDoc("$set", bson::MakeDoc("x", 3)),
+                                mongo::options::Upsert{});
+  });
+  auto del = engine::AsyncNoSpan(
+      [&] { return aggregator.DeleteOne(bson::MakeDoc("_id", 2)); });
+
+  const auto update_result = update.Get();
+  EXPECT_EQ(1, update_result.MatchedCount());
+  EXPECT_EQ(1, update_result.ModifiedCount());
+  EXPECT_EQ(0, update_result.UpsertedCount());
+
+  const auto upsert_result = upsert.Get();
+  EXPECT_EQ(1, upsert_result.UpsertedCount());
+  ASSERT_EQ(1, upsert_result.UpsertedIds().count(0));
+  EXPECT_EQ(3, upsert_result.UpsertedIds().at(0).As<int>());
+
+  EXPECT_EQ(1, del.Get().DeletedCount());
+
+  EXPECT_EQ(1, (*coll.FindOne(bson::MakeDoc("_id", 1)))["x"].As<int>());
+  EXPECT_FALSE(coll.FindOne(bson::MakeDoc("_id", 2)));
+  EXPECT_TRUE(coll.FindOne(bson::MakeDoc("_id", 3)));
+}
+
+USERVER_NAMESPACE_END
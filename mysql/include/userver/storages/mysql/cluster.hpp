@@ -115,6 +115,10 @@ class Cluster final {
   ///
   /// @note Requires MariaDB 10.2.6+ as a server
   ///
+  /// The params not fitting into max_allowed_packet of the server are
+  /// executed in several consecutive statements, which are atomic only within
+  /// a transaction, see storages::mysql::Transaction.
+  ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
   template <typename Container>
@@ -133,6 +137,10 @@ class Cluster final {
   ///
   /// @note Requires MariaDB 10.2.6+ as a server
   ///
+  /// The params not fitting into max_allowed_packet of the server are
+  /// executed in several consecutive statements, which are atomic only within
+  /// a transaction, see storages::mysql::Transaction.
+  ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
   /// @snippet storages/tests/unittests/cluster_mysqltest.cpp uMySQL usage sample - Cluster ExecuteBulk
@@ -155,6 +163,10 @@ class Cluster final {
   ///
   /// @note Requires MariaDB 10.2.6+ as a server
   ///
+  /// The params not fitting into max_allowed_packet of the server are
+  /// executed in several consecutive statements, which are atomic only within
+  /// a transaction, see storages::mysql::Transaction.
+  ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
   template <typename MapTo, typename Container>
@@ -177,6 +189,10 @@ class Cluster final {
   ///
   /// @note Requires MariaDB 10.2.6+ as a server
   ///
+  /// The params not fitting into max_allowed_packet of the server are
+  /// executed in several consecutive statements, which are atomic only within
+  /// a transaction, see storages::mysql::Transaction.
+  ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
   ///
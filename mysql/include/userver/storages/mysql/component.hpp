@@ -44,11 +44,19 @@ namespace storages::mysql {
 /// primary detection and always considers the first host in `hosts` list
 /// an only primary node in the cluster.
 ///
+/// The reads from ClusterHostType::kSecondary are balanced among the rest of
+/// the hosts by their latency and the count of the queries in flight. The
+/// replicas that are unavailable, have the replication stopped or lag
+/// behind the primary more than `max_replication_lag` (`Seconds_Behind_Master`
+/// of `SHOW SLAVE STATUS`) are excluded, and the primary is used if there
+/// are no healthy replicas left.
+///
 /// ## Static options (more to come)
 /// Name                     | Description                                 | Default value
 /// -------------------------|---------------------------------------------|---------------
 /// initial_pool_size        | initial connection pool size (per host)     | 5
 /// max_pool_size            | maximum connection pool size (per host)     | 10
+/// max_replication_lag      | replicas lagging behind the primary more than that are not used for reads | 60s
 ///
 // clang-format on
 class Component final : public components::LoggableComponentBase {
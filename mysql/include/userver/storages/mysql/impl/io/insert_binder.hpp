@@ -1,6 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <boost/pfr/core.hpp>
 
@@ -23,6 +29,54 @@ struct OwnedMappedRow<Row, true> final {
   Row value;
 };
 
+// The estimations are upper bounds of the sizes of the fields in a bulk packet:
+// the strings are sent as is after a length prefix, every other type is
+// sent in kMaxFixedFieldSize bytes at most.
+inline constexpr std::size_t kFieldOverhead = 10;
+inline constexpr std::size_t kMaxFixedFieldSize = 32;
+
+template <typename T>
+struct IsFixedSizeField : std::true_type {};
+template <>
+struct IsFixedSizeField<std::string> : std::false_type {};
+template <>
+struct IsFixedSizeField<std::string_view> : std::false_type {};
+template <>
+struct IsFixedSizeField<formats::json::Value> : std::false_type {};
+template <typename T>
+struct IsFixedSizeField<std::optional<T>> : IsFixedSizeField<T> {};
+
+template <typename Row, typename = std::make_index_sequence<
+                            boost::pfr::tuple_size_v<Row>>>
+struct IsFixedSizeRow;
+template <typename Row, std::size_t... I>
+struct IsFixedSizeRow<Row, std::index_sequence<I...>>
+    : std::conjunction<
+          IsFixedSizeField<boost::pfr::tuple_element_t<I, Row>>...> {};
+
+// Serializes the json, so it's costly
+std::size_t EstimateFieldSize(const formats::json::Value& field);
+
+template <typename T>
+std::size_t EstimateFieldSize(const T& field) {
+  if constexpr (std::is_same_v<T, std::string> ||
+                std::is_same_v<T, std::string_view>) {
+    return field.size() + kFieldOverhead;
+  } else if constexpr (meta::kIsOptional<T>) {
+    return field.has_value() ? EstimateFieldSize(*field) : kFieldOverhead;
+  } else {
+    return kMaxFixedFieldSize;
+  }
+}
+
+template <typename Row>
+std::size_t EstimateRowSize(const Row& row) {
+  std::size_t size = 0;
+  boost::pfr::for_each_field(
+      row, [&size](const auto& field) { size += EstimateFieldSize(field); });
+  return size;
+}
+
 class InsertBinderBase : public ParamsBinderBase {
  public:
   explicit InsertBinderBase(std::size_t size);
@@ -35,6 +89,9 @@ class InsertBinderBase : public ParamsBinderBase {
                        char (*param_cb)(void*, void*, std::size_t));
 
   void UpdateBinds(void* binds_array);
+
+  // Makes the binds point to the owned array again after an execution
+  void ResetBinds();
 };
 
 template <typename Container, typename MapTo = typename Container::value_type>
@@ -43,7 +100,9 @@ class InsertBinder final : public InsertBinderBase {
   explicit InsertBinder(const Container& container)
       : InsertBinderBase{kColumnsCount},
         container_{container},
-        current_row_it_{container_.begin()} {
+        current_row_it_{container_.begin()},
+        chunk_end_{container_.begin()},
+        chunk_size_{container_.size()} {
     static_assert(kColumnsCount != 0, "Rows to insert have zero columns");
     static_assert(meta::kIsSizable<Container>,
                   "Container should be sizeable for batch insertion");
@@ -55,7 +114,38 @@ class InsertBinder final : public InsertBinderBase {
     SetBindCallback(this, &BindsRowCallback);
   }
 
-  std::size_t GetRowsCount() const final { return container_.size(); }
+  std::size_t GetRowsCount() const final { return chunk_size_; }
+
+  bool SelectNextChunk(std::size_t max_size) final {
+    UASSERT(chunk_end_ != container_.end());
+
+    if (chunk_end_ != container_.begin()) {
+      // Following chunk, the binds of the previous execution are used up
+      ResetBinds();
+      current_row_it_ = chunk_end_;
+      max_row_number_seen_ = 0;
+      BindColumns();
+    }
+
+    chunk_size_ = 0;
+    if constexpr (IsFixedSizeRow<Row>::value) {
+      constexpr auto kRowSize = kColumnsCount * kMaxFixedFieldSize;
+      const auto rows_left = static_cast<std::size_t>(
+          std::distance(chunk_end_, container_.end()));
+      chunk_size_ = std::min(rows_left, std::max<std::size_t>(
+                                            max_size / kRowSize, 1));
+      std::advance(chunk_end_, chunk_size_);
+    } else {
+      std::size_t size = 0;
+      for (; chunk_end_ != container_.end(); ++chunk_end_, ++chunk_size_) {
+        const auto row_size = EstimateCurrentRowSize(*chunk_end_);
+        if (chunk_size_ != 0 && size + row_size > max_size) break;
+        size += row_size;
+      }
+    }
+
+    return chunk_end_ != container_.end();
+  }
 
  private:
   using Row = MapTo;
@@ -75,6 +165,15 @@ class InsertBinder final : public InsertBinderBase {
         });
   }
 
+  static std::size_t EstimateCurrentRowSize(
+      const typename Container::value_type& row) {
+    if constexpr (kIsMapped) {
+      return EstimateRowSize(storages::mysql::convert::DoConvert<Row>(row));
+    } else {
+      return EstimateRowSize(row);
+    }
+  }
+
   void UpdateCurrentRowPtr() {
     if constexpr (kIsMapped) {
       current_row_.value =
@@ -109,6 +208,8 @@ class InsertBinder final : public InsertBinderBase {
   const Container& container_;
 
   typename Container::const_iterator current_row_it_;
+  typename Container::const_iterator chunk_end_;
+  std::size_t chunk_size_;
 
   OwnedMappedRow<Row, kIsMapped> current_row_;
   const Row* current_row_ptr_;
@@ -17,6 +17,12 @@ class ParamsBinderBase {
 
   virtual std::size_t GetRowsCount() const = 0;
 
+  // Bulk binders split their rows into several executions, so that each one
+  // fits into max_allowed_packet of the server. This limits the rows of the
+  // next execution to `max_size` bytes and returns whether there are rows left
+  // for the executions after it.
+  virtual bool SelectNextChunk(std::size_t max_size);
+
  protected:
   ~ParamsBinderBase();
 
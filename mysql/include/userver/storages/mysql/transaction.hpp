@@ -65,6 +65,9 @@ class Transaction final {
   ///
   /// @note Requires MariaDB 10.2.6+ as a server
   ///
+  /// The params not fitting into max_allowed_packet of the server are
+  /// executed in several consecutive statements.
+  ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
   template <typename Container>
@@ -84,6 +87,9 @@ class Transaction final {
   ///
   /// @note Requires MariaDB 10.2.6+ as a server
   ///
+  /// The params not fitting into max_allowed_packet of the server are
+  /// executed in several consecutive statements.
+  ///
   /// UINVARIANTs on params count mismatch, doesn't validate types.
   /// UINVARIANTs on empty params container.
   template <typename MapTo, typename Container>
@@ -41,7 +41,8 @@ std::unique_ptr<infra::topology::TopologyBase> CreateTopology(
         settings::PoolSettings::Create(config, endpoint_info, settings.auth));
   }
 
-  return infra::topology::TopologyBase::Create(resolver, pools_settings);
+  return infra::topology::TopologyBase::Create(
+      resolver, pools_settings, settings::TopologySettings::Create(config));
 }
 
 }  // namespace
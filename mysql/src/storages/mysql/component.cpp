@@ -63,6 +63,10 @@ properties:
         type: integer
         description: maximum number of created connections
         defaultDescription: 10
+    max_replication_lag:
+        type: string
+        description: replicas lagging more than that are excluded from reads
+        defaultDescription: 60s
 )");
 }
 
@@ -50,6 +50,8 @@ void InputBindings::WrapBinds(void* binds_array) {
   binds_ptr_ = static_cast<MYSQL_BIND*>(binds_array);
 }
 
+void InputBindings::UnwrapBinds() { binds_ptr_ = owned_binds_.data(); }
+
 void InputBindings::Bind(std::size_t pos, C<uint8_t>& val) {
   BindValue(pos, GetNativeType(val), val, 0, true);
 }
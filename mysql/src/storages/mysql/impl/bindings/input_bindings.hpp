@@ -33,6 +33,7 @@ class InputBindings : public NativeBindsHelper {
   bool Empty() const;
   MYSQL_BIND* GetBindsArray();
   void WrapBinds(void* binds_array);
+  void UnwrapBinds();
 
   void Bind(std::size_t pos, C<std::uint8_t>& val);
   void Bind(std::size_t pos, C<std::int8_t>& val);
@@ -9,6 +9,7 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/scope_time.hpp>
+#include <userver/utils/from_string.hpp>
 
 #include <storages/mysql/impl/metadata/native_client_info.hpp>
 #include <storages/mysql/impl/metadata/server_info.hpp>
@@ -47,6 +48,9 @@ class MysqlThreadEnd final {
 // to honor any kind of deadline, so this is zero.
 constexpr std::chrono::milliseconds kDefaultCloseTimeout{0};
 
+// The default max_allowed_packet of MySQL 8
+constexpr std::size_t kDefaultMaxPacketSize = 64 * 1024 * 1024;
+
 #ifdef USERVER_MYSQL_ALLOW_BUGGY_LIBMARIADB
 constexpr bool kAbortOnBuggyLibmariadb = false;
 #else
@@ -114,6 +118,13 @@ Connection::Connection(clients::dns::Resolver& resolver,
   InitSocket(resolver, endpoint_info, auth_settings, connection_settings,
              deadline);
   server_info_ = metadata::ServerInfo::Get(mysql_);
+  try {
+    max_packet_size_ = QueryMaxPacketSize(deadline);
+  } catch (const std::exception&) {
+    // the destructor won't be called
+    Close(deadline);
+    throw;
+  }
 
   const auto server_info = metadata::ServerInfo::Get(mysql_);
   LOG_INFO() << "MySQL connection initialized."
@@ -128,13 +139,14 @@ Connection::~Connection() {
 }
 
 QueryResult Connection::ExecuteQuery(const std::string& query,
-                                     engine::Deadline deadline) {
+                                     engine::Deadline deadline,
+                                     bool with_fields_names) {
   auto guard = GetBrokenGuard();
 
   return guard.Execute([&] {
     PlainQuery mysql_query{*this, query};
     mysql_query.Execute(deadline);
-    return mysql_query.FetchResult(deadline);
+    return mysql_query.FetchResult(deadline, with_fields_names);
   });
 }
 
@@ -163,6 +175,55 @@ void Connection::Ping(engine::Deadline deadline) {
   });
 }
 
+std::vector<std::string> Connection::GetCachedStatements() const {
+  return statements_cache_.GetStatementsTexts();
+}
+
+void Connection::PrepareStatements(const std::vector<std::string>& statements,
+                                   engine::Deadline deadline) {
+  for (const auto& statement : statements) {
+    if (deadline.IsReached()) {
+      break;
+    }
+
+    try {
+      auto guard = GetBrokenGuard();
+      guard.Execute(
+          [&] { statements_cache_.PrepareStatement(statement, deadline); });
+    } catch (const std::exception& ex) {
+      if (IsBroken()) {
+        throw;
+      }
+      LOG_WARNING() << "Failed to prepare a statement ahead: " << ex.what();
+    }
+  }
+}
+
+std::optional<std::chrono::seconds> Connection::GetReplicationLag(
+    engine::Deadline deadline) {
+  auto result = ExecuteQuery("SHOW SLAVE STATUS", deadline,
+                             !replication_lag_field_.has_value());
+  if (result.RowsCount() == 0) {
+    // Not a replica
+    return std::chrono::seconds{0};
+  }
+
+  if (!replication_lag_field_.has_value()) {
+    replication_lag_field_ = result.FindField("Seconds_Behind_Master");
+    if (!replication_lag_field_.has_value()) {
+      return std::nullopt;
+    }
+  }
+
+  // NULL (which we get as an empty string) if the replication is stopped
+  const auto& lag = result.GetRow(0).GetField(*replication_lag_field_);
+  if (lag.empty()) {
+    return std::nullopt;
+  }
+
+  return std::chrono::seconds{utils::FromString<std::int64_t>(lag)};
+}
+
 void Connection::Commit(engine::Deadline deadline) {
   auto guard = GetBrokenGuard();
 
@@ -206,6 +267,8 @@ const metadata::ServerInfo& Connection::GetServerInfo() const {
   return server_info_;
 }
 
+std::size_t Connection::GetMaxPacketSize() const { return max_packet_size_; }
+
 BrokenGuard Connection::GetBrokenGuard() { return BrokenGuard{*this}; }
 
 void Connection::NotifyBroken() { broken_.store(true); }
@@ -310,6 +373,15 @@ bool Connection::DoInitSocket(
   return true;
 }
 
+std::size_t Connection::QueryMaxPacketSize(engine::Deadline deadline) {
+  auto result = ExecuteQuery("SELECT @@max_allowed_packet", deadline);
+  if (result.RowsCount() == 0 || result.GetRow(0).FieldsCount() == 0) {
+    return kDefaultMaxPacketSize;
+  }
+
+  return utils::FromString<std::size_t>(result.GetRow(0).GetField(0));
+}
+
 void Connection::Close(engine::Deadline deadline) noexcept {
   UASSERT(socket_.IsValid());
 
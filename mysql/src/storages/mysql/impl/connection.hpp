@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -41,7 +43,8 @@ class Connection final {
              engine::Deadline deadline);
   ~Connection();
 
-  QueryResult ExecuteQuery(const std::string& query, engine::Deadline deadline);
+  QueryResult ExecuteQuery(const std::string& query, engine::Deadline deadline,
+                           bool with_fields_names = false);
 
   StatementFetcher ExecuteStatement(const std::string& statement,
                                     io::ParamsBinderBase& params,
@@ -50,6 +53,18 @@ class Connection final {
 
   void Ping(engine::Deadline deadline);
 
+  // Texts of the statements prepared on this connection
+  std::vector<std::string> GetCachedStatements() const;
+  // Prepares the statements ahead of their first execution, the statements
+  // prepared already and the ones failing to prepare are skipped.
+  void PrepareStatements(const std::vector<std::string>& statements,
+                         engine::Deadline deadline);
+
+  // Seconds_Behind_Master of the server, zero if the server is not a replica,
+  // std::nullopt if the replication is stopped.
+  std::optional<std::chrono::seconds> GetReplicationLag(
+      engine::Deadline deadline);
+
   void Commit(engine::Deadline deadline);
   void Rollback(engine::Deadline deadline);
 
@@ -62,6 +77,9 @@ class Connection final {
 
   const metadata::ServerInfo& GetServerInfo() const;
 
+  // max_allowed_packet of the server
+  std::size_t GetMaxPacketSize() const;
+
   BrokenGuard GetBrokenGuard();
 
   // There are places (destructors, basically) where we want to run some
@@ -82,6 +100,7 @@ class Connection final {
                     const settings::ConnectionSettings& connection_settings,
                     engine::Deadline deadline);
   void Close(engine::Deadline deadline) noexcept;
+  std::size_t QueryMaxPacketSize(engine::Deadline deadline);
 
   Statement& PrepareStatement(const std::string& statement,
                               engine::Deadline deadline,
@@ -93,8 +112,13 @@ class Connection final {
   MYSQL mysql_{};
 
   metadata::ServerInfo server_info_{};
+  std::size_t max_packet_size_{0};
 
   StatementsCache statements_cache_;
+
+  // The columns of SHOW SLAVE STATUS don't change for the server, so the
+  // names are fetched once per connection
+  std::optional<std::size_t> replication_lag_field_;
 };
 
 }  // namespace impl
@@ -1,11 +1,17 @@
 #include <userver/storages/mysql/impl/io/insert_binder.hpp>
 
+#include <userver/formats/json/serialize.hpp>
+
 #include <storages/mysql/impl/bindings/input_bindings.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::impl::io {
 
+std::size_t EstimateFieldSize(const formats::json::Value& field) {
+  return ToString(field).size() + kFieldOverhead;
+}
+
 InsertBinderBase::InsertBinderBase(std::size_t size) : ParamsBinderBase{size} {}
 
 InsertBinderBase::~InsertBinderBase() = default;
@@ -23,6 +29,8 @@ void InsertBinderBase::UpdateBinds(void* binds_array) {
   GetBinds().WrapBinds(binds_array);
 }
 
+void InsertBinderBase::ResetBinds() { GetBinds().UnwrapBinds(); }
+
 }  // namespace storages::mysql::impl::io
 
 USERVER_NAMESPACE_END
@@ -13,6 +13,8 @@ ParamsBinderBase::ParamsBinderBase(ParamsBinderBase&& other) noexcept
 
 InputBindingsFwd& ParamsBinderBase::GetBinds() { return *binds_impl_; }
 
+bool ParamsBinderBase::SelectNextChunk(std::size_t) { return false; }
+
 ParamsBinderBase::~ParamsBinderBase() = default;
 
 }  // namespace storages::mysql::impl::io
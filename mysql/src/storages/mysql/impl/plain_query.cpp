@@ -1,6 +1,8 @@
 #include <storages/mysql/impl/plain_query.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <storages/mysql/impl/mariadb_include.hpp>
 
@@ -55,7 +57,8 @@ void PlainQuery::Execute(engine::Deadline deadline) {
   }
 }
 
-QueryResult PlainQuery::FetchResult(engine::Deadline deadline) {
+QueryResult PlainQuery::FetchResult(engine::Deadline deadline,
+                                    bool with_fields_names) {
   const std::unique_ptr<MYSQL_RES, NativeResultDeleter> native_result{
       NativeInterface{connection_->GetSocket(), deadline}.QueryStoreResult(
           &connection_->GetNativeHandler()),
@@ -66,6 +69,18 @@ QueryResult PlainQuery::FetchResult(engine::Deadline deadline) {
   }
 
   QueryResult result{};
+
+  if (with_fields_names) {
+    const auto fields_count = mysql_num_fields(native_result.get());
+    const auto* fields = mysql_fetch_fields(native_result.get());
+    std::vector<std::string> fields_names;
+    fields_names.reserve(fields_count);
+    for (std::size_t i = 0; i < fields_count; ++i) {
+      fields_names.emplace_back(fields[i].name, fields[i].name_length);
+    }
+    result.SetFieldsNames(std::move(fields_names));
+  }
+
   while (true) {
     MYSQL_ROW row =
         NativeInterface{connection_->GetSocket(), deadline}.QueryResultFetchRow(
@@ -21,7 +21,9 @@ class PlainQuery final {
   PlainQuery(PlainQuery&& other) noexcept;
 
   void Execute(engine::Deadline deadline);
-  QueryResult FetchResult(engine::Deadline deadline);
+  // The names of the fields are only fetched if `with_fields_names` is set
+  QueryResult FetchResult(engine::Deadline deadline,
+                          bool with_fields_names = false);
 
  private:
   Connection* connection_;
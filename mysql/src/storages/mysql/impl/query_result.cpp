@@ -1,5 +1,7 @@
 #include <storages/mysql/impl/query_result.hpp>
 
+#include <algorithm>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +18,20 @@ void QueryResult::AppendRow(QueryResultRow&& row) {
   rows_.push_back(std::move(row));
 }
 
+void QueryResult::SetFieldsNames(std::vector<std::string>&& fields_names) {
+  fields_names_ = std::move(fields_names);
+}
+
+std::optional<std::size_t> QueryResult::FindField(std::string_view name) const {
+  const auto it =
+      std::find(fields_names_.begin(), fields_names_.end(), name);
+  if (it == fields_names_.end()) {
+    return std::nullopt;
+  }
+
+  return it - fields_names_.begin();
+}
+
 std::size_t QueryResult::RowsCount() const { return rows_.size(); }
 
 const QueryResultRow& QueryResult::GetRow(std::size_t ind) const {
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <storages/mysql/impl/query_result_row.hpp>
@@ -17,6 +20,9 @@ class QueryResult final {
   QueryResult(QueryResult&& other) noexcept;
 
   void AppendRow(QueryResultRow&& row);
+  void SetFieldsNames(std::vector<std::string>&& fields_names);
+
+  std::optional<std::size_t> FindField(std::string_view name) const;
 
   std::size_t RowsCount() const;
 
@@ -31,6 +37,7 @@ class QueryResult final {
 
  private:
   std::vector<QueryResultRow> rows_;
+  std::vector<std::string> fields_names_;
 };
 
 }  // namespace storages::mysql::impl
@@ -1,5 +1,8 @@
 #include <storages/mysql/impl/statement.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <typeinfo>
 #include <utility>
 
 #include <fmt/format.h>
@@ -20,6 +23,12 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::impl {
 
+namespace {
+
+constexpr std::size_t kPacketSizeReserve = 4096;
+
+}  // namespace
+
 Statement::NativeStatementDeleter::NativeStatementDeleter(
     Connection* connection)
     : connection_{connection} {
@@ -58,8 +67,32 @@ StatementFetcher Statement::Execute(io::ParamsBinderBase& params,
                                     engine::Deadline deadline) {
   const USERVER_NAMESPACE::tracing::ScopeTime execute{
       impl::tracing::kExecuteScope};
+
+  // The packet also holds the statement id and the types of the params
+  const auto max_packet_size = connection_->GetMaxPacketSize();
+  const auto max_chunk_size =
+      max_packet_size - std::min(max_packet_size, kPacketSizeReserve);
+
+  std::uint64_t rows_affected = 0;
+  std::optional<std::uint64_t> first_insert_id;
+  while (params.SelectNextChunk(max_chunk_size)) {
+    UpdateParamsBindings(params);
+    DoExecute(deadline);
+
+    rows_affected += GetNativeRowsAffected();
+    if (!first_insert_id.has_value()) {
+      first_insert_id.emplace(mysql_stmt_insert_id(native_statement_.get()));
+    }
+    Reset(deadline);
+  }
+
   UpdateParamsBindings(params);
+  DoExecute(deadline);
+
+  return StatementFetcher{*this, rows_affected, first_insert_id};
+}
 
+void Statement::DoExecute(engine::Deadline deadline) {
   const int err =
       NativeInterface{connection_->GetSocket(), deadline}.StatementExecute(
           native_statement_.get());
@@ -69,8 +102,17 @@ StatementFetcher Statement::Execute(io::ParamsBinderBase& params,
         mysql_stmt_errno(native_statement_.get()),
         GetNativeError("Failed to execute a prepared statement")};
   }
+}
+
+std::uint64_t Statement::GetNativeRowsAffected() const {
+  const auto rows_affected = mysql_stmt_affected_rows(native_statement_.get());
+
+  // libmariadb return -1 as ulonglong
+  if (rows_affected == std::numeric_limits<std::uint64_t>::max()) {
+    return 0;
+  }
 
-  return StatementFetcher{*this};
+  return rows_affected;
 }
 
 void Statement::StoreResult(engine::Deadline deadline) {
@@ -284,8 +326,12 @@ std::string Statement::GetNativeError(std::string_view prefix) const {
                      mysql_stmt_error(native_statement_.get()));
 }
 
-StatementFetcher::StatementFetcher(Statement& statement)
-    : statement_{&statement} {
+StatementFetcher::StatementFetcher(
+    Statement& statement, std::uint64_t previous_rows_affected,
+    std::optional<std::uint64_t> first_insert_id)
+    : previous_rows_affected_{previous_rows_affected},
+      first_insert_id_{first_insert_id},
+      statement_{&statement} {
   UASSERT(statement_->native_statement_);
 }
 
@@ -305,6 +351,8 @@ StatementFetcher::~StatementFetcher() {
 
 StatementFetcher::StatementFetcher(StatementFetcher&& other) noexcept
     : parent_statement_deadline_{other.parent_statement_deadline_},
+      previous_rows_affected_{other.previous_rows_affected_},
+      first_insert_id_{other.first_insert_id_},
       binds_applied_{other.binds_applied_},
       statement_{std::exchange(other.statement_, nullptr)} {}
 
@@ -321,7 +369,10 @@ bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
     const auto rows_count = batch_size.value_or(statement_->RowsCount());
     extractor.Reserve(rows_count);
 
-    const auto validate_binds = !std::exchange(binds_validated_, true);
+    const std::type_index extractor_type{typeid(extractor)};
+    const auto validate_binds =
+        !std::exchange(binds_validated_, true) &&
+        statement_->validated_extractor_type_ != extractor_type;
     if (validate_binds) {
       // We validate binds even for empty results:
       // we don't want a query returning empty result to pass tests and then
@@ -330,6 +381,7 @@ bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
       auto& binds = extractor.BindNextRow();
       binds.ValidateAgainstStatement(*statement_->native_statement_);
       extractor.RollbackLastRow();
+      statement_->validated_extractor_type_.emplace(extractor_type);
     }
 
     for (size_t i = 0; i < rows_count; ++i) {
@@ -373,14 +425,16 @@ std::uint64_t StatementFetcher::RowsAffected() const {
   if (rows_affected == std::numeric_limits<std::uint64_t>::max()) {
     LOG_WARNING()
         << "RowsAffected called on a statement that doesn't affect any rows";
-    return 0;
+    return previous_rows_affected_;
   }
 
-  return rows_affected;
+  return previous_rows_affected_ + rows_affected;
 }
 
 std::uint64_t StatementFetcher::LastInsertId() const {
-  return mysql_stmt_insert_id(statement_->native_statement_.get());
+  // The id of the first inserted row, same as for a single bulk execution
+  return first_insert_id_.value_or(
+      mysql_stmt_insert_id(statement_->native_statement_.get()));
 }
 
 }  // namespace storages::mysql::impl
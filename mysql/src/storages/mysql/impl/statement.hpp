@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <typeindex>
 
 #include <storages/mysql/impl/mariadb_include.hpp>
 
@@ -41,9 +42,14 @@ class StatementFetcher final {
 
  private:
   friend class Statement;
-  explicit StatementFetcher(Statement& statement);
+  explicit StatementFetcher(
+      Statement& statement, std::uint64_t previous_rows_affected = 0,
+      std::optional<std::uint64_t> first_insert_id = std::nullopt);
 
   engine::Deadline parent_statement_deadline_;
+  // Of the previous chunks of a bulk execution
+  std::uint64_t previous_rows_affected_{0};
+  std::optional<std::uint64_t> first_insert_id_;
   bool binds_applied_{false};
   bool binds_validated_{false};
   Statement* statement_;
@@ -83,6 +89,8 @@ class Statement final {
   void Reset(engine::Deadline deadline);
 
   void UpdateParamsBindings(io::ParamsBinderBase& params);
+  void DoExecute(engine::Deadline deadline);
+  std::uint64_t GetNativeRowsAffected() const;
 
   class NativeStatementDeleter {
    public:
@@ -110,6 +118,10 @@ class Statement final {
   NativeStatementPtr native_statement_;
 
   std::optional<std::size_t> batch_size_;
+
+  // Validation of the result binds fetches and parses the result metadata,
+  // so it's done once per statement and extractor type, not per execution.
+  std::optional<std::type_index> validated_extractor_type_;
 };
 
 }  // namespace storages::mysql::impl
@@ -47,6 +47,16 @@ Statement& StatementsCache::PrepareStatement(const std::string& statement,
   return *added_statement;
 }
 
+std::vector<std::string> StatementsCache::GetStatementsTexts() const {
+  std::vector<std::string> texts;
+  texts.reserve(cache_.GetSize());
+  cache_.VisitAll([&texts](const std::string& text, const Statement&) {
+    texts.push_back(text);
+  });
+
+  return texts;
+}
+
 }  // namespace storages::mysql::impl
 
 USERVER_NAMESPACE_END
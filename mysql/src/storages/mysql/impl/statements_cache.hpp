@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <userver/cache/lru_map.hpp>
 #include <userver/utils/str_icase.hpp>
 
@@ -19,6 +22,8 @@ class StatementsCache final {
   Statement& PrepareStatement(const std::string& statement,
                               engine::Deadline deadline);
 
+  std::vector<std::string> GetStatementsTexts() const;
+
  private:
   Connection& connection_;
 
@@ -1,5 +1,6 @@
 #include <storages/mysql/infra/pool.hpp>
 
+#include <algorithm>
 #include <chrono>
 
 #include <userver/logging/log.hpp>
@@ -21,6 +22,14 @@ constexpr std::chrono::milliseconds kPoolSizeMonitorInterval{2000};
 
 constexpr std::chrono::milliseconds kPingerInterval{1000};
 constexpr std::chrono::milliseconds kPingTimeout{200};
+constexpr std::chrono::milliseconds kPrepareTimeout{500};
+
+constexpr std::chrono::milliseconds kReplicationLagTimeout{500};
+
+// Weight of the previous latency in the smoothed one, out of 8
+constexpr std::int64_t kLatencySmoothing{7};
+
+constexpr std::int64_t kReplicationStopped{-1};
 
 }  // namespace
 
@@ -52,6 +61,57 @@ void Pool::WriteStatistics(utils::statistics::Writer& writer) const {
                          {{"mysql_instance", settings_.endpoint_info.host}});
 }
 
+bool Pool::IsAvailable() const { return monitor_.IsAvailable(); }
+
+std::size_t Pool::GetInFlightCount() const {
+  // The counters are loaded separately, so released may be ahead of acquired
+  const auto acquired = stats_.acquired.Load();
+  const auto released = stats_.released.Load();
+
+  return acquired > released ? acquired - released : 0;
+}
+
+std::chrono::microseconds Pool::GetLatency() const {
+  return std::chrono::microseconds{latency_us_.load()};
+}
+
+std::optional<std::chrono::seconds> Pool::GetReplicationLag() const {
+  const auto lag = replication_lag_s_.load();
+  if (lag == kReplicationStopped) {
+    return std::nullopt;
+  }
+
+  return std::chrono::seconds{lag};
+}
+
+void Pool::UpdateReplicationLag() {
+  const auto deadline = engine::Deadline::FromDuration(kReplicationLagTimeout);
+
+  try {
+    auto connection = Acquire(deadline);
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto lag = connection->GetReplicationLag(deadline);
+    AccountLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
+
+    if (!lag.has_value()) {
+      LOG_LIMITED_WARNING() << "Replication is stopped on "
+                            << settings_.endpoint_info.host;
+    }
+    replication_lag_s_.store(lag.has_value() ? lag->count()
+                                             : kReplicationStopped);
+  } catch (const std::exception& ex) {
+    // The unavailability of the host is accounted by the monitor, and we
+    // don't want to exclude a replica if we aren't allowed to check it.
+    // The check is repeated every second for every replica, e.g. without the
+    // REPLICATION CLIENT privilege, so the warning is rate limited.
+    LOG_LIMITED_WARNING() << "Failed to get the replication lag of "
+                          << settings_.endpoint_info.host << ": "
+                          << ex.what();
+  }
+}
+
 Pool::Pool(clients::dns::Resolver& resolver,
            const settings::PoolSettings& pool_settings)
     : drivers::impl::ConnectionPoolBase<
@@ -82,12 +142,32 @@ Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
   }
 }
 
+void Pool::PrepareHotStatements(impl::Connection& connection,
+                                engine::Deadline deadline) {
+  const auto hot_statements = hot_statements_.Read();
+  if (!hot_statements->empty()) {
+    connection.PrepareStatements(*hot_statements, deadline);
+  }
+}
+
 void Pool::AccountConnectionAcquired() { ++stats_.acquired; }
 void Pool::AccountConnectionReleased() { ++stats_.released; }
 void Pool::AccountConnectionCreated() { ++stats_.created; }
 void Pool::AccountConnectionDestroyed() noexcept { ++stats_.closed; }
 void Pool::AccountOverload() { ++stats_.overload; }
 
+void Pool::AccountLatency(std::chrono::microseconds latency) noexcept {
+  const auto sample = latency.count();
+  const auto current = latency_us_.load(std::memory_order_relaxed);
+  const auto smoothed =
+      current == 0
+          ? sample
+          : (current * kLatencySmoothing + sample) / (kLatencySmoothing + 1);
+  // A lost update of the estimate doesn't matter
+  latency_us_.store(std::max<std::int64_t>(smoothed, 1),
+                    std::memory_order_relaxed);
+}
+
 void Pool::RunSizeMonitor() {
   if (AliveConnectionsCountApprox() < settings_.initial_pool_size) {
     try {
@@ -112,10 +192,29 @@ void Pool::RunPinger() {
       pinger_connection{connection_ptr.release(), pinger_connection_deleter};
 
   try {
+    const auto start = std::chrono::steady_clock::now();
     pinger_connection->Ping(engine::Deadline::FromDuration(kPingTimeout));
+    AccountLatency(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
     monitor_.AccountSuccess();
   } catch (const std::exception& ex) {
     LOG_WARNING() << "Failed to ping the server: " << ex.what();
+    return;
+  }
+
+  // The idle connections prepare the statements of the others here rather
+  // than on the acquire path
+  try {
+    PrepareHotStatements(*pinger_connection,
+                         engine::Deadline::FromDuration(kPrepareTimeout));
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to prepare the statements ahead: " << ex.what();
+    return;
+  }
+
+  auto cached_statements = pinger_connection->GetCachedStatements();
+  if (!cached_statements.empty()) {
+    hot_statements_.Assign(std::move(cached_statements));
   }
 }
 
@@ -144,7 +243,7 @@ void Pool::PoolMonitor::AccountFailure() noexcept {
   last_failure_.store(Clock::now());
 }
 
-bool Pool::PoolMonitor::IsAvailable() noexcept {
+bool Pool::PoolMonitor::IsAvailable() const noexcept {
   const auto now = Clock::now();
 
   const auto last_success = last_success_.load();
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/periodic_task.hpp>
 
@@ -37,6 +42,18 @@ class Pool final
 
   void WriteStatistics(utils::statistics::Writer& writer) const;
 
+  bool IsAvailable() const;
+
+  // Connections acquired and not yet released
+  std::size_t GetInFlightCount() const;
+
+  // Smoothed round trip time of the pings and the replication checks
+  std::chrono::microseconds GetLatency() const;
+
+  // Last known replication lag, std::nullopt if the replication is stopped
+  std::optional<std::chrono::seconds> GetReplicationLag() const;
+  void UpdateReplicationLag();
+
   Pool(clients::dns::Resolver& resolver,
        const settings::PoolSettings& pool_settings);
 
@@ -44,12 +61,15 @@ class Pool final
   friend class drivers::impl::ConnectionPoolBase<impl::Connection, Pool>;
 
   ConnectionUniquePtr DoCreateConnection(engine::Deadline deadline);
+  void PrepareHotStatements(impl::Connection& connection,
+                            engine::Deadline deadline);
 
   void AccountConnectionAcquired();
   void AccountConnectionReleased();
   void AccountConnectionCreated();
   void AccountConnectionDestroyed() noexcept;
   void AccountOverload();
+  void AccountLatency(std::chrono::microseconds latency) noexcept;
 
   void RunSizeMonitor();
   void RunPinger();
@@ -65,7 +85,7 @@ class Pool final
     void AccountSuccess() noexcept;
     void AccountFailure() noexcept;
 
-    bool IsAvailable() noexcept;
+    bool IsAvailable() const noexcept;
 
    private:
     using Clock = utils::datetime::WallCoarseClock;
@@ -85,6 +105,14 @@ class Pool final
 
   PoolConnectionStatistics stats_{};
 
+  // Statements prepared on the connections of the pool, the pinger prepares
+  // them on the idle connections
+  rcu::Variable<std::vector<std::string>> hot_statements_;
+
+  std::atomic<std::int64_t> latency_us_{0};
+  // Negative if the replication is stopped
+  std::atomic<std::int64_t> replication_lag_s_{0};
+
   PoolMonitor monitor_;
 };
 
@@ -1,6 +1,10 @@
 #include <storages/mysql/infra/topology/fixed_primary.hpp>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+#include <storages/mysql/infra/pool.hpp>
+#include <storages/mysql/settings/settings.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -8,27 +12,68 @@ namespace storages::mysql::infra::topology {
 
 namespace {
 
-std::size_t WrappingIncrement(std::atomic<size_t>& value, std::size_t mod) {
-  // we don't actually care about order being broken once in 2^64 iterations
-  return value.fetch_add(1) % mod;
+constexpr std::chrono::milliseconds kReplicationMonitorInterval{1000};
+
+// The less the better: the latency of the host scaled by its load
+std::uint64_t GetLoadScore(const Pool& pool) {
+  const auto latency = std::max<std::int64_t>(pool.GetLatency().count(), 1);
+
+  return (pool.GetInFlightCount() + 1) * static_cast<std::uint64_t>(latency);
 }
 
 }  // namespace
 
-FixedPrimary::FixedPrimary(clients::dns::Resolver& resolver,
-                           const std::vector<settings::PoolSettings>& settings)
+FixedPrimary::FixedPrimary(
+    clients::dns::Resolver& resolver,
+    const std::vector<settings::PoolSettings>& settings,
+    const settings::TopologySettings& topology_settings)
     : TopologyBase(resolver, settings),
       primary_{InitializePrimaryPoolReference()},
-      secondaries_{InitializeSecondariesVector()} {}
+      secondaries_{InitializeSecondariesVector()},
+      max_replication_lag_{topology_settings.max_replication_lag} {
+  replication_monitor_.Start(
+      "mysql_replication_monitor",
+      {kReplicationMonitorInterval, utils::PeriodicTask::Flags::kNow},
+      [this] { RunReplicationMonitor(); });
+}
 
-FixedPrimary::~FixedPrimary() = default;
+FixedPrimary::~FixedPrimary() { replication_monitor_.Stop(); }
 
 Pool& FixedPrimary::GetPrimary() const { return primary_; }
 
 Pool& FixedPrimary::GetSecondary() const {
-  const auto pool_index =
-      WrappingIncrement(secondary_index_, secondaries_.size());
-  return *secondaries_[pool_index];
+  if (secondaries_.size() == 1) {
+    auto& secondary = *secondaries_.front();
+    return IsHealthy(secondary) ? secondary : primary_;
+  }
+
+  const auto first_index = utils::RandRange(secondaries_.size());
+  auto second_index = utils::RandRange(secondaries_.size() - 1);
+  if (second_index >= first_index) {
+    ++second_index;
+  }
+
+  auto& first = *secondaries_[first_index];
+  auto& second = *secondaries_[second_index];
+  const bool is_first_healthy = IsHealthy(first);
+  const bool is_second_healthy = IsHealthy(second);
+
+  if (is_first_healthy && is_second_healthy) {
+    return GetLoadScore(first) <= GetLoadScore(second) ? first : second;
+  } else if (is_first_healthy) {
+    return first;
+  } else if (is_second_healthy) {
+    return second;
+  }
+
+  for (auto* secondary : secondaries_) {
+    if (IsHealthy(*secondary)) {
+      return *secondary;
+    }
+  }
+
+  // All the replicas are unavailable or lagging, the primary is the freshest
+  return primary_;
 }
 
 Pool& FixedPrimary::InitializePrimaryPoolReference() {
@@ -49,6 +94,21 @@ std::vector<Pool*> FixedPrimary::InitializeSecondariesVector() {
   return pools;
 }
 
+bool FixedPrimary::IsHealthy(const Pool& pool) const {
+  if (!pool.IsAvailable()) {
+    return false;
+  }
+
+  const auto lag = pool.GetReplicationLag();
+  return lag.has_value() && *lag <= max_replication_lag_;
+}
+
+void FixedPrimary::RunReplicationMonitor() {
+  for (auto* secondary : secondaries_) {
+    secondary->UpdateReplicationLag();
+  }
+}
+
 }  // namespace storages::mysql::infra::topology
 
 USERVER_NAMESPACE_END
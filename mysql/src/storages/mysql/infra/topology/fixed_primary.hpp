@@ -1,6 +1,8 @@
 #pragma once
 
-#include <atomic>
+#include <chrono>
+
+#include <userver/utils/periodic_task.hpp>
 
 #include <storages/mysql/infra/topology/topology_base.hpp>
 
@@ -8,10 +10,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::infra::topology {
 
+// The first host is the primary, the rest are its replicas.
+// Reads from the secondaries are balanced with the power of two choices by
+// the in-flight count and the latency, the replicas that are unavailable or
+// lag more than max_replication_lag are excluded. If there is no healthy
+// replica the primary is used.
 class FixedPrimary final : public TopologyBase {
  public:
   FixedPrimary(clients::dns::Resolver& resolver,
-               const std::vector<settings::PoolSettings>& settings);
+               const std::vector<settings::PoolSettings>& settings,
+               const settings::TopologySettings& topology_settings);
   ~FixedPrimary() final;
 
  private:
@@ -21,10 +29,16 @@ class FixedPrimary final : public TopologyBase {
   Pool& InitializePrimaryPoolReference();
   std::vector<Pool*> InitializeSecondariesVector();
 
+  bool IsHealthy(const Pool& pool) const;
+
+  void RunReplicationMonitor();
+
   Pool& primary_;
   std::vector<Pool*> secondaries_;
 
-  mutable std::atomic<std::size_t> secondary_index_{0};
+  const std::chrono::milliseconds max_replication_lag_;
+
+  utils::PeriodicTask replication_monitor_;
 };
 
 }  // namespace storages::mysql::infra::topology
@@ -34,15 +34,16 @@ TopologyBase::~TopologyBase() = default;
 
 std::unique_ptr<TopologyBase> TopologyBase::Create(
     clients::dns::Resolver& resolver,
-    const std::vector<settings::PoolSettings>& pools_settings) {
+    const std::vector<settings::PoolSettings>& pools_settings,
+    const settings::TopologySettings& topology_settings) {
   UASSERT(!pools_settings.empty());
 
   if (pools_settings.size() == 1) {
     return std::make_unique<infra::topology::Standalone>(resolver,
                                                          pools_settings);
   } else {
-    return std::make_unique<infra::topology::FixedPrimary>(resolver,
-                                                           pools_settings);
+    return std::make_unique<infra::topology::FixedPrimary>(
+        resolver, pools_settings, topology_settings);
   }
 }
 
@@ -14,7 +14,8 @@ namespace storages::mysql {
 
 namespace settings {
 struct PoolSettings;
-}
+struct TopologySettings;
+}  // namespace settings
 
 namespace infra {
 
@@ -28,7 +29,8 @@ class TopologyBase {
 
   static std::unique_ptr<TopologyBase> Create(
       clients::dns::Resolver& resolver,
-      const std::vector<settings::PoolSettings>& pools_settings);
+      const std::vector<settings::PoolSettings>& pools_settings,
+      const settings::TopologySettings& topology_settings);
 
   Pool& SelectPool(ClusterHostType host_type) const;
 
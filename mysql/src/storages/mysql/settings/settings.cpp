@@ -82,6 +82,16 @@ PoolSettings PoolSettings::Create(const components::ComponentConfig& config,
   return settings;
 }
 
+TopologySettings TopologySettings::Create(
+    const components::ComponentConfig& config) {
+  TopologySettings settings{};
+  settings.max_replication_lag =
+      config["max_replication_lag"].As<std::chrono::milliseconds>(
+          settings.max_replication_lag);
+
+  return settings;
+}
+
 MysqlSettings Parse(const formats::json::Value& value,
                     formats::parse::To<MysqlSettings>) {
   auto port = value["port"].As<std::uint32_t>();
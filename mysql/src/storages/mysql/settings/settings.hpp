@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 
@@ -56,6 +57,13 @@ struct PoolSettings final {
                              const AuthSettings& auth);
 };
 
+struct TopologySettings final {
+  // Replicas lagging behind the primary more than that are not used
+  std::chrono::milliseconds max_replication_lag{std::chrono::seconds{60}};
+
+  static TopologySettings Create(const components::ComponentConfig& config);
+};
+
 struct MysqlSettings final {
   std::vector<EndpointInfo> endpoints;
 
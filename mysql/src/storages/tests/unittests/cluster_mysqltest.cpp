@@ -128,6 +128,39 @@ UTEST(Cluster, UpdateMany) {
   }
 }
 
+UTEST(Cluster, InsertManyExceedingMaxPacket) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value LONGTEXT NOT NULL"};
+
+  const auto max_packet_size =
+      cluster.DefaultExecute("SELECT @@max_allowed_packet")
+          .AsSingleField<std::uint64_t>();
+
+  constexpr std::size_t kValueSize = 1024 * 1024;
+  const std::size_t rows_count = max_packet_size / kValueSize + 2;
+
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back(
+        {static_cast<int>(i), std::string(kValueSize, 'a')});
+  }
+
+  const auto result =
+      cluster
+          ->ExecuteBulk(ClusterHostType::kPrimary,
+                        table.FormatWithTableName(
+                            "INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+                        rows_to_insert)
+          .AsExecutionResult();
+  EXPECT_EQ(result.rows_affected, rows_count);
+
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {} ORDER BY Id")
+          .AsVector<Row>();
+  EXPECT_EQ(db_rows, rows_to_insert);
+}
+
 UTEST(ShowCase, Basic) {
   ClusterWrapper cluster{};
 
@@ -0,0 +1,70 @@
+#include <userver/utest/utest.hpp>
+#include "../utils_mysqltest.hpp"
+
+#include <algorithm>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+
+#include <storages/mysql/impl/connection.hpp>
+#include <storages/mysql/infra/pool.hpp>
+#include <storages/mysql/settings/settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::tests {
+
+namespace {
+
+constexpr std::size_t kPoolSize = 2;
+
+settings::PoolSettings CreatePoolSettings() {
+  settings::PoolSettings settings;
+  settings.initial_pool_size = kPoolSize;
+  settings.max_pool_size = kPoolSize;
+  settings.endpoint_info = {"localhost", GetMysqlPort()};
+  settings.auth_settings.database = "userver_mysql_test";
+  settings.auth_settings.user = "root";
+  settings.connection_settings.statements_cache_size = 10;
+  settings.connection_settings.use_secure_connection = false;
+  settings.connection_settings.use_compression = false;
+  settings.connection_settings.ip_mode = settings::IpMode::kAny;
+  return settings;
+}
+
+bool IsPrepared(const infra::ConnectionPtr& connection,
+                const std::string& statement) {
+  const auto statements = connection->GetCachedStatements();
+  return std::find(statements.begin(), statements.end(), statement) !=
+         statements.end();
+}
+
+}  // namespace
+
+UTEST(Pool, PreparesHotStatementsInBackground) {
+  clients::dns::Resolver resolver{engine::current_task::GetTaskProcessor(),
+                                  {}};
+  const auto pool = infra::Pool::Create(resolver, CreatePoolSettings());
+  const std::string statement = "SELECT 1";
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  {
+    auto first = pool->Acquire(deadline);
+    auto second = pool->Acquire(deadline);
+    first->PrepareStatements({statement}, deadline);
+    EXPECT_FALSE(IsPrepared(second, statement));
+  }
+
+  // The pinger prepares the statement on the other idle connection
+  while (true) {
+    auto first = pool->Acquire(deadline);
+    auto second = pool->Acquire(deadline);
+    if (IsPrepared(first, statement) && IsPrepared(second, statement)) break;
+    ASSERT_FALSE(deadline.IsReached());
+    engine::SleepFor(std::chrono::milliseconds{100});
+  }
+}
+
+}  // namespace storages::mysql::tests
+
+USERVER_NAMESPACE_END
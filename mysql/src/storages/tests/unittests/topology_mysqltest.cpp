@@ -0,0 +1,70 @@
+#include <userver/utest/utest.hpp>
+#include "../utils_mysqltest.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <userver/engine/task/task.hpp>
+
+#include <storages/mysql/infra/pool.hpp>
+#include <storages/mysql/infra/topology/topology_base.hpp>
+#include <storages/mysql/settings/settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mysql::tests {
+
+namespace {
+
+constexpr std::size_t kHostsCount = 3;
+
+std::vector<settings::PoolSettings> CreatePoolsSettings() {
+  settings::PoolSettings settings;
+  settings.initial_pool_size = 1;
+  settings.max_pool_size = 2;
+  settings.endpoint_info = {"localhost", GetMysqlPort()};
+  settings.auth_settings.database = "userver_mysql_test";
+  settings.auth_settings.user = "root";
+  settings.connection_settings.use_secure_connection = false;
+  settings.connection_settings.use_compression = false;
+  settings.connection_settings.ip_mode = settings::IpMode::kAny;
+
+  // The same server plays the primary and the replicas
+  return std::vector<settings::PoolSettings>(kHostsCount, settings);
+}
+
+}  // namespace
+
+UTEST(FixedPrimaryTopology, ReadsFromReplicas) {
+  clients::dns::Resolver resolver{engine::current_task::GetTaskProcessor(),
+                                  {}};
+  const auto topology = infra::topology::TopologyBase::Create(
+      resolver, CreatePoolsSettings(), settings::TopologySettings{});
+  auto& primary = topology->SelectPool(ClusterHostType::kPrimary);
+
+  // The test server is not a replica, so there is no lag
+  for (int i = 0; i < 100; ++i) {
+    auto& secondary = topology->SelectPool(ClusterHostType::kSecondary);
+    EXPECT_NE(&secondary, &primary);
+    EXPECT_EQ(secondary.GetReplicationLag(), std::chrono::seconds{0});
+  }
+}
+
+UTEST(FixedPrimaryTopology, LaggingReplicasAreExcluded) {
+  clients::dns::Resolver resolver{engine::current_task::GetTaskProcessor(),
+                                  {}};
+  settings::TopologySettings topology_settings;
+  // Even no lag at all is too much
+  topology_settings.max_replication_lag = std::chrono::milliseconds{-1};
+  const auto topology = infra::topology::TopologyBase::Create(
+      resolver, CreatePoolsSettings(), topology_settings);
+  auto& primary = topology->SelectPool(ClusterHostType::kPrimary);
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(&topology->SelectPool(ClusterHostType::kSecondary), &primary);
+  }
+}
+
+}  // namespace storages::mysql::tests
+
+USERVER_NAMESPACE_END
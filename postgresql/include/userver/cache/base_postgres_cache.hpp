@@ -5,11 +5,14 @@
 
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <map>
+#include <mutex>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -23,9 +26,11 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -62,7 +67,8 @@ namespace components {
 /// full-update-op-timeout | timeout for a full update | 1m
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
-/// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// chunk-size | number of rows to request from PostgreSQL via portals, the next chunk is requested while the current one is processed, 0 to fetch all rows in one request without portals | 1000
+/// full-update-partitions | number of partitions a full update is split into, the partitions are fetched and parsed concurrently over separate connections; requires `kPartitionKey` in the policy if greater than 1 | 1
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -94,6 +100,23 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// cache::IndexedContainer uses that notification to build secondary indexes
+/// over the cached values.
+///
+/// @section pg_cc_partitioned_full_update Partitioned full updates
+///
+/// A full update of a large cache may be split into `full-update-partitions`
+/// queries that are fetched and parsed concurrently, each one over
+/// a separate connection of the PostgreSQL cluster. The rows are assigned to
+/// partitions by the hash of the `kPartitionKey` SQL expression of the policy,
+/// so the expression should spread the rows evenly, e.g. the primary key:
+///
+/// @code
+/// static constexpr const char* kPartitionKey = "id";
+/// @endcode
+///
+/// Incremental updates are not partitioned.
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -158,6 +181,12 @@ using HasWhere = decltype(T::kWhere);
 template <typename T>
 inline constexpr bool kHasWhere = meta::kIsDetected<HasWhere, T>;
 
+// Component kPartitionKey in policy
+template <typename T>
+using HasPartitionKey = decltype(T::kPartitionKey);
+template <typename T>
+inline constexpr bool kHasPartitionKey = meta::kIsDetected<HasPartitionKey, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -365,6 +394,7 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+inline constexpr std::size_t kDefaultFullUpdatePartitions = 1;
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -416,9 +446,15 @@ class PostgreCache final
   void CacheResults(storages::postgres::ResultSet res, CachedData& data_cache,
                     cache::UpdateStatisticsScope& stats_scope,
                     tracing::ScopeTime& scope);
+  std::vector<ValueType> ParseResults(
+      storages::postgres::ResultSet res,
+      cache::UpdateStatisticsScope& stats_scope);
+  std::size_t FetchPartitioned(CachedData& data_cache,
+                               cache::UpdateStatisticsScope& stats_scope);
 
   static storages::postgres::Query GetAllQuery();
   static storages::postgres::Query GetDeltaQuery();
+  static storages::postgres::Query GetPartitionQuery(std::size_t partitions);
 
   std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
@@ -428,6 +464,7 @@ class PostgreCache final
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::size_t full_update_partitions_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
 };
@@ -447,7 +484,9 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      full_update_partitions_{config["full-update-partitions"].As<std::size_t>(
+          pg_cache::detail::kDefaultFullUpdatePartitions)} {
   UINVARIANT(
       !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
       "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -461,6 +500,17 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
         "name is specified in traits of '" +
         config.Name() + "' cache");
   }
+  if (full_update_partitions_ == 0) {
+    throw std::logic_error("'full-update-partitions' must be positive for '" +
+                           config.Name() + "' cache");
+  }
+  if (full_update_partitions_ > 1 &&
+      !pg_cache::detail::kHasPartitionKey<PostgreCachePolicy>) {
+    throw std::logic_error(
+        "Partitioned full updates are requested in config but no partition "
+        "key is specified in traits of '" +
+        config.Name() + "' cache");
+  }
   if (correction_.count() < 0) {
     throw std::logic_error(
         "Refusing to set forward (negative) update correction requested in "
@@ -524,6 +574,29 @@ storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetDeltaQuery() {
   }
 }
 
+template <typename PostgreCachePolicy>
+storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetPartitionQuery(
+    [[maybe_unused]] std::size_t partitions) {
+  if constexpr (pg_cache::detail::kHasPartitionKey<PostgreCachePolicy>) {
+    storages::postgres::Query query = PolicyCheckerType::GetQuery();
+    // '& 2147483647' keeps the remainder non-negative
+    const auto condition =
+        fmt::format("(hashtext(({})::text) & 2147483647) % {} = $1",
+                    PostgreCachePolicy::kPartitionKey, partitions);
+
+    if constexpr (pg_cache::detail::kHasWhere<PostgreCachePolicy>) {
+      return {fmt::format("{} where ({}) and {}", query.Statement(),
+                          PostgreCachePolicy::kWhere, condition),
+              query.GetName()};
+    } else {
+      return {fmt::format("{} where {}", query.Statement(), condition),
+              query.GetName()};
+    }
+  } else {
+    return GetAllQuery();
+  }
+}
+
 template <typename PostgreCachePolicy>
 std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(
     const ComponentConfig& config) {
@@ -573,43 +646,51 @@ void PostgreCache<PostgreCachePolicy>::Update(
   scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
   size_t changes = 0;
-  // Iterate clusters
-  for (auto& cluster : clusters_) {
-    if (chunk_size_ > 0) {
-      auto trx = cluster->Begin(
-          kClusterHostTypeFlags, pg::Transaction::RO,
-          pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
-      auto portal =
-          trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-      while (portal) {
-        scope.Reset(std::string{pg_cache::detail::kFetchStage});
-        auto res = portal.Fetch(chunk_size_);
+  if (type == cache::UpdateType::kFull && full_update_partitions_ > 1) {
+    changes = FetchPartitioned(data_cache, stats_scope);
+  } else {
+    // Iterate clusters
+    for (auto& cluster : clusters_) {
+      if (chunk_size_ > 0) {
+        auto trx = cluster->Begin(
+            kClusterHostTypeFlags, pg::Transaction::RO,
+            pg::CommandControl{timeout,
+                               pg_cache::detail::kStatementTimeoutOff});
+        auto portal =
+            trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
+        while (portal) {
+          scope.Reset(std::string{pg_cache::detail::kFetchStage});
+          auto res = portal.FetchWithPrefetch(chunk_size_);
+          stats_scope.IncreaseDocumentsReadCount(res.Size());
+
+          scope.Reset(std::string{pg_cache::detail::kParseStage});
+          CacheResults(res, data_cache, stats_scope, scope);
+          changes += res.Size();
+        }
+        trx.Commit();
+      } else {
+        bool has_parameter = query.Statement().find('$') != std::string::npos;
+        auto res = has_parameter
+                       ? cluster->Execute(
+                             kClusterHostTypeFlags,
+                             pg::CommandControl{
+                                 timeout,
+                                 pg_cache::detail::kStatementTimeoutOff},
+                             query, GetLastUpdated(last_update, *data_cache))
+                       : cluster->Execute(
+                             kClusterHostTypeFlags,
+                             pg::CommandControl{
+                                 timeout,
+                                 pg_cache::detail::kStatementTimeoutOff},
+                             query);
         stats_scope.IncreaseDocumentsReadCount(res.Size());
 
         scope.Reset(std::string{pg_cache::detail::kParseStage});
         CacheResults(res, data_cache, stats_scope, scope);
         changes += res.Size();
       }
-      trx.Commit();
-    } else {
-      bool has_parameter = query.Statement().find('$') != std::string::npos;
-      auto res = has_parameter
-                     ? cluster->Execute(
-                           kClusterHostTypeFlags,
-                           pg::CommandControl{
-                               timeout, pg_cache::detail::kStatementTimeoutOff},
-                           query, GetLastUpdated(last_update, *data_cache))
-                     : cluster->Execute(
-                           kClusterHostTypeFlags,
-                           pg::CommandControl{
-                               timeout, pg_cache::detail::kStatementTimeoutOff},
-                           query);
-      stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-      scope.Reset(std::string{pg_cache::detail::kParseStage});
-      CacheResults(res, data_cache, stats_scope, scope);
-      changes += res.Size();
     }
+
   }
 
   scope.Reset();
@@ -679,6 +760,79 @@ void PostgreCache<PostgreCachePolicy>::CacheResults(
   }
 }
 
+template <typename PostgreCachePolicy>
+std::vector<typename PostgreCache<PostgreCachePolicy>::ValueType>
+PostgreCache<PostgreCachePolicy>::ParseResults(
+    storages::postgres::ResultSet res,
+    cache::UpdateStatisticsScope& stats_scope) {
+  auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
+  std::vector<ValueType> result;
+  result.reserve(res.Size());
+  utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+  for (auto p = values.begin(); p != values.end(); ++p) {
+    relax.Relax();
+    try {
+      result.push_back(pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+    } catch (const std::exception& e) {
+      stats_scope.IncreaseDocumentsParseFailures(1);
+      LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                  << compiler::GetTypeName<ValueType>() << "': " << e.what();
+    }
+  }
+  return result;
+}
+
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchPartitioned(
+    CachedData& data_cache, cache::UpdateStatisticsScope& stats_scope) {
+  namespace pg = storages::postgres;
+  const auto query = GetPartitionQuery(full_update_partitions_);
+  const pg::CommandControl cc{full_update_timeout_,
+                              pg_cache::detail::kStatementTimeoutOff};
+
+  // Rows are parsed concurrently, only the insertion is serialized
+  engine::Mutex data_mutex;
+  std::atomic<std::size_t> changes{0};
+  const auto store = [&](pg::ResultSet res) {
+    stats_scope.IncreaseDocumentsReadCount(res.Size());
+    changes += res.Size();
+    auto values = ParseResults(std::move(res), stats_scope);
+
+    const std::lock_guard lock{data_mutex};
+    utils::CpuRelax relax{cpu_relax_iterations_parse_, nullptr};
+    for (auto& value : values) {
+      relax.Relax();
+      using pg_cache::detail::CacheInsertOrAssign;
+      CacheInsertOrAssign(*data_cache, std::move(value),
+                          PostgreCachePolicy::kKeyMember);
+    }
+  };
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(clusters_.size() * full_update_partitions_);
+  for (auto& cluster : clusters_) {
+    for (std::size_t i = 0; i < full_update_partitions_; ++i) {
+      tasks.push_back(utils::Async(
+          "pg_cache_partition",
+          [&, &cluster = cluster, partition = static_cast<int>(i)] {
+            if (chunk_size_ > 0) {
+              auto trx = cluster->Begin(kClusterHostTypeFlags,
+                                        pg::Transaction::RO, cc);
+              auto portal = trx.MakePortal(query, partition);
+              while (portal) store(portal.FetchWithPrefetch(chunk_size_));
+              trx.Commit();
+            } else {
+              store(cluster->Execute(kClusterHostTypeFlags, cc, query,
+                                     partition));
+            }
+          }));
+    }
+  }
+  for (auto& task : tasks) task.Get();
+
+  return changes;
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::CachedData
 PostgreCache<PostgreCachePolicy>::GetDataSnapshot(cache::UpdateType type,
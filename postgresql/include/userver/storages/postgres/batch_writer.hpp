@@ -0,0 +1,94 @@
+#pragma once
+
+/// @file userver/storages/postgres/batch_writer.hpp
+/// @brief @copybrief storages::postgres::BatchWriter
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/cluster_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Collects the executions of a statement by concurrent tasks into
+/// batches, each batch is executed in a single transaction on a single
+/// connection
+///
+/// The first task of a batch waits for up to Settings::max_delay for the
+/// other tasks to join the batch, or until the batch has
+/// Settings::max_batch_size statements, and executes the batch with
+/// storages::postgres::Transaction::ExecuteBatch. With the pipeline mode
+/// enabled the whole batch takes a single round trip. Each task gets the
+/// result of its own statement.
+///
+/// The batch succeeds or fails as a whole: if one of the statements fails,
+/// the transaction is rolled back and all the tasks of the batch get the
+/// error. A task cancelled while waiting for the batch stops waiting, but its
+/// statement is still executed, unless it is the first task of the batch:
+/// the whole batch fails then.
+///
+/// As with storages::postgres::ParameterStore, only built-in types can be
+/// used as parameters.
+///
+/// @snippet storages/postgres/tests/cluster_pgtest.cpp BatchWriter sample
+class BatchWriter final {
+ public:
+  struct Settings final {
+    /// The batch is executed as soon as it has this many statements
+    std::size_t max_batch_size{100};
+
+    /// The longest time the first statement waits for the batch to fill up
+    std::chrono::milliseconds max_delay{5};
+  };
+
+  BatchWriter(ClusterPtr cluster, Query query, Settings settings,
+              ClusterHostTypeFlags flags = ClusterHostType::kMaster,
+              TransactionOptions options = {},
+              OptionalCommandControl cmd_ctl = {});
+  ~BatchWriter();
+
+  BatchWriter(const BatchWriter&) = delete;
+  BatchWriter& operator=(const BatchWriter&) = delete;
+
+  /// @brief Executes the statement with the parameters as a part of a batch
+  /// @returns the result of this statement
+  template <typename... Args>
+  ResultSet Execute(const Args&... args) {
+    ParameterStore params;
+    (params.PushBack(args), ...);
+    return Execute(std::move(params));
+  }
+
+  /// @overload
+  ResultSet Execute(ParameterStore&& params);
+
+ private:
+  struct Batch;
+
+  void Flush(const std::shared_ptr<Batch>& batch);
+
+  const ClusterPtr cluster_;
+  const Query query_;
+  const Settings settings_;
+  const ClusterHostTypeFlags flags_;
+  const TransactionOptions options_;
+  const OptionalCommandControl cmd_ctl_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable batch_full_;
+  std::shared_ptr<Batch> current_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -135,6 +135,18 @@ class Cluster {
   Transaction Begin(ClusterHostTypeFlags, const TransactionOptions&,
                     OptionalCommandControl = {});
 
+  /// Start a transaction on a host that has replayed the write-ahead log up
+  /// to `min_lsn`, see Transaction::CommitAndGetLsn.
+  ///
+  /// Only the hosts of the requested role that are known to have reached the
+  /// LSN are used, otherwise the transaction falls back to master. The
+  /// replication positions are discovered once a second, so the reads right
+  /// after a commit are usually served by master.
+  /// If the transaction is RW, only master connection can be used.
+  /// @throws ClusterUnavailable if no hosts are available
+  Transaction Begin(ClusterHostTypeFlags, const TransactionOptions&,
+                    Lsn min_lsn, OptionalCommandControl = {});
+
   /// Start a named transaction in any available connection depending on
   /// transaction options.
   ///
@@ -126,10 +126,12 @@ namespace components {
 /// monitoring-dbalias      | name of the database for monitorings                      | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                      | 5000
 /// max_statement_metrics   | limit of exported metrics for named statements            | 0
+/// prepare-on-connect-size | number of the statements recently prepared in a pool to prepare on its new connections (0 - disabled) | 0
 /// min_pool_size           | number of connections created initially                   | 4
 /// max_pool_size           | maximum number of created connections                     | 15
 /// max_queue_size          | maximum number of clients waiting for a connection        | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// adaptive_pool_size      | grow the pool ahead of the demand and shrink it down to the recent peak demand, min_pool_size becomes a lower bound | false
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings | --
 
@@ -0,0 +1,146 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Binary COPY streams
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief A stream of rows for a `COPY ... FROM STDIN (FORMAT binary)`
+/// statement, created by storages::postgres::Transaction::CopyIn
+///
+/// The rows are formatted in the PostgreSQL binary COPY format with the same
+/// formatters as the query parameters and are buffered. A full buffer is sent
+/// to the server before the next row is written, so the memory usage does not
+/// depend on the number of rows and a slow server slows the writer down.
+///
+/// If the stream is destroyed without Finish(), the COPY is aborted and the
+/// transaction fails.
+///
+/// The stream must not outlive the transaction, no other statements may be
+/// executed in the transaction until the stream is finished.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn sample
+class CopyInStream final {
+ public:
+  /// @cond
+  CopyInStream(detail::Connection* conn, const UserTypes& types);
+  /// @endcond
+
+  CopyInStream(CopyInStream&&) noexcept;
+  CopyInStream& operator=(CopyInStream&&) = delete;
+  CopyInStream(const CopyInStream&) = delete;
+  CopyInStream& operator=(const CopyInStream&) = delete;
+
+  ~CopyInStream();
+
+  /// @brief Writes a row, the columns must match the column list of the
+  /// COPY statement
+  template <typename... Columns>
+  void Write(const Columns&... columns) {
+    static_assert(sizeof...(Columns) > 0, "A row must have columns");
+    io::WriteBuffer(*types_, buffer_,
+                    static_cast<Smallint>(sizeof...(Columns)));
+    (io::WriteRawBinary(*types_, buffer_, columns), ...);
+    ++rows_written_;
+    if (buffer_.size() >= kBufferSize) SendBuffer();
+  }
+
+  /// @brief Sends the rest of the rows and completes the COPY
+  /// @returns the number of rows copied by the server
+  std::size_t Finish();
+
+  /// @returns the number of rows written so far
+  std::size_t GetRowsWritten() const { return rows_written_; }
+
+ private:
+  static constexpr std::size_t kBufferSize = 64 * 1024;
+
+  void SendBuffer();
+
+  detail::Connection* conn_;
+  const UserTypes* types_;
+  std::string buffer_;
+  std::size_t rows_written_{0};
+};
+
+/// @brief A stream of rows of a `COPY ... TO STDOUT (FORMAT binary)`
+/// statement, created by storages::postgres::Transaction::CopyOut
+///
+/// The data is received from the server as the rows are read and is parsed
+/// with the same parsers as the result sets, so the memory usage does not
+/// depend on the number of rows. Only the types mapped to the system
+/// PostgreSQL types can be read, as the binary COPY format carries no type
+/// information.
+///
+/// If the stream is destroyed before all the rows are read, the COPY is
+/// cancelled and the transaction fails.
+///
+/// The stream must not outlive the transaction, no other statements may be
+/// executed in the transaction until all the rows are read.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut sample
+class CopyOutStream final {
+ public:
+  /// @cond
+  explicit CopyOutStream(detail::Connection* conn);
+  /// @endcond
+
+  CopyOutStream(CopyOutStream&&) noexcept;
+  CopyOutStream& operator=(CopyOutStream&&) = delete;
+  CopyOutStream(const CopyOutStream&) = delete;
+  CopyOutStream& operator=(const CopyOutStream&) = delete;
+
+  ~CopyOutStream();
+
+  /// @brief Reads the next row into the columns, the columns must match the
+  /// column list of the COPY statement
+  /// @returns `false` if there are no more rows
+  template <typename... Columns>
+  bool Read(Columns&... columns) {
+    static_assert(
+        ((io::IsTypeMappedToSystem<Columns>() ||
+          io::IsTypeMappedToSystemArray<Columns>()) &&
+         ...),
+        "Only built-in types can be read from a binary COPY stream");
+    auto row = ReadRow(sizeof...(Columns));
+    if (!row) return false;
+    (row->ReadRaw(columns, kNoCategories,
+                  io::traits::kTypeBufferCategory<Columns>),
+     ...);
+    return true;
+  }
+
+  /// @returns the number of rows read so far
+  std::size_t GetRowsRead() const { return rows_read_; }
+
+ private:
+  static inline const io::TypeBufferCategory kNoCategories{};
+
+  std::optional<io::FieldBuffer> ReadRow(std::size_t columns_count);
+  bool EnsureData(std::size_t size);
+
+  detail::Connection* conn_;
+  std::string buffer_;
+  std::size_t offset_{0};
+  std::size_t rows_read_{0};
+  bool header_read_{false};
+  bool done_{false};
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
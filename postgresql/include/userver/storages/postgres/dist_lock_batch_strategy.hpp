@@ -0,0 +1,48 @@
+#pragma once
+
+/// @file userver/storages/postgres/dist_lock_batch_strategy.hpp
+/// @brief @copybrief storages::postgres::DistLockBatchStrategy
+
+#include <userver/dist_lock/dist_lock_batch_strategy.hpp>
+#include <userver/dist_lock/dist_lock_settings.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/storages/postgres/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Postgres distributed locking strategy for
+/// dist_lock::DistLockManager
+///
+/// Uses the same table as storages::postgres::DistLockStrategy and acquires
+/// all the locks of a batch in a single query. The live members are stored in
+/// the same table under the `dist-lock-member:` key prefix.
+class DistLockBatchStrategy final
+    : public dist_lock::DistLockBatchStrategyBase {
+ public:
+  DistLockBatchStrategy(ClusterPtr cluster, const std::string& table,
+                        const dist_lock::DistLockSettings& settings);
+
+  dist_lock::BatchAcquireResult AcquireBatch(
+      const std::vector<dist_lock::LeaseRequest>& requests) override;
+
+  void Release(const std::string& lock_name,
+               const std::string& locker_id) override;
+
+  const std::string& GetMemberId() const override;
+
+  void UpdateCommandControl(CommandControl cc);
+
+ private:
+  ClusterPtr cluster_;
+  rcu::Variable<CommandControl> cc_;
+  const std::string acquire_query_;
+  const std::string release_query_;
+  const std::string owner_prefix_;
+  const std::string member_key_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
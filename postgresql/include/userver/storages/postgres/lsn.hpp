@@ -0,0 +1,26 @@
+#pragma once
+
+/// @file userver/storages/postgres/lsn.hpp
+/// @brief PostgreSQL write-ahead log position
+
+#include <cstdint>
+
+#include <userver/utils/strong_typedef.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @brief Log sequence number, a position in the write-ahead log
+///
+/// Returned by storages::postgres::Transaction::CommitAndGetLsn and accepted
+/// by storages::postgres::Cluster::Begin to read the committed data from the
+/// replicas.
+using Lsn = USERVER_NAMESPACE::utils::StrongTypedef<struct LsnTag, uint64_t>;
+
+/// An LSN that is not known, imposes no restrictions
+inline constexpr Lsn kUnknownLsn{0};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
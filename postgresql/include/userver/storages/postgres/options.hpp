@@ -184,10 +184,15 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Grow the pool ahead of the demand and shrink it down to the recent peak
+  /// demand, min_size becomes the lower bound of the pool size
+  bool adaptive_size{false};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           adaptive_size == rhs.adaptive_size;
   }
 };
 
@@ -246,12 +251,18 @@ struct ConnectionSettings {
   /// Execute discard all after establishing a new connection
   DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+  /// This many statements recently prepared by the connections of a pool are
+  /// prepared by a new connection of the pool right after establishing
+  /// (0 - disabled)
+  size_t prepare_on_connect_size = 0;
+
   /// Helps keep track of the changes in settings
   SettingsVersion version{0U};
 
   bool operator==(const ConnectionSettings& rhs) const {
     return !RequiresConnectionReset(rhs) &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           prepare_on_connect_size == rhs.prepare_on_connect_size;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/engine/deadline.hpp>
@@ -22,6 +26,9 @@ namespace storages::postgres {
 using PortalName =
     USERVER_NAMESPACE::utils::StrongTypedef<struct PortalNameTag, std::string>;
 
+template <typename T, typename ExtractionTag>
+class TypedPortalRange;
+
 class Portal {
  public:
   Portal(detail::Connection* conn, const Query& query,
@@ -41,6 +48,29 @@ class Portal {
 
   ResultSet Fetch(std::uint32_t n_rows);
 
+  /// @brief Fetch the next `n_rows` rows and request the following `n_rows`
+  /// rows right away, so that they are transferred while the caller processes
+  /// the current ones.
+  ///
+  /// Consecutive fetches must request the same number of rows. No other
+  /// statements may be executed in the transaction until the portal is done
+  /// or destroyed.
+  ResultSet FetchWithPrefetch(std::uint32_t n_rows);
+
+  /// @brief Returns a single-pass range over the rest of the rows of the
+  /// portal converted to `T`, the rows are fetched by `chunk_rows` with
+  /// prefetching, see FetchWithPrefetch.
+  ///
+  /// The portal must outlive the range.
+  ///
+  /// @snippet storages/postgres/tests/portal_pgtest.cpp Portal AsSetOf sample
+  template <typename T>
+  TypedPortalRange<T, FieldTag> AsSetOf(std::uint32_t chunk_rows);
+  template <typename T>
+  TypedPortalRange<T, RowTag> AsSetOf(std::uint32_t chunk_rows, RowTag);
+  template <typename T>
+  TypedPortalRange<T, FieldTag> AsSetOf(std::uint32_t chunk_rows, FieldTag);
+
   bool Done() const;
   std::size_t FetchedSoFar() const;
 
@@ -58,6 +88,102 @@ class Portal {
   USERVER_NAMESPACE::utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
 
+/// @brief A single-pass range of the rows of a storages::postgres::Portal
+/// converted to `T`, see storages::postgres::Portal::AsSetOf
+template <typename T, typename ExtractionTag>
+class TypedPortalRange final {
+ public:
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using reference = typename TypedResultSet<T, ExtractionTag>::reference;
+    using pointer = void;
+
+    Iterator() = default;
+
+    reference operator*() const { return range_->Current(); }
+
+    Iterator& operator++() {
+      if (!range_->Advance()) range_ = nullptr;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return range_ == other.range_;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+   private:
+    friend class TypedPortalRange;
+
+    explicit Iterator(TypedPortalRange* range) : range_{range} {}
+
+    TypedPortalRange* range_{nullptr};
+  };
+
+  TypedPortalRange(const TypedPortalRange&) = delete;
+  TypedPortalRange& operator=(const TypedPortalRange&) = delete;
+
+  /// Fetches the first chunk of rows on the first call
+  Iterator begin() {
+    if (!started_) {
+      started_ = true;
+      FetchChunk();
+    }
+    return Iterator{chunk_ ? this : nullptr};
+  }
+  Iterator end() { return {}; }
+
+ private:
+  friend class Portal;
+
+  TypedPortalRange(Portal& portal, std::uint32_t chunk_rows)
+      : portal_{&portal}, chunk_rows_{chunk_rows} {}
+
+  typename Iterator::reference Current() const { return (*chunk_)[index_]; }
+
+  bool Advance() {
+    if (++index_ == chunk_->Size()) FetchChunk();
+    return chunk_.has_value();
+  }
+
+  void FetchChunk() {
+    chunk_.reset();
+    index_ = 0;
+    while (!portal_->Done()) {
+      auto res = portal_->FetchWithPrefetch(chunk_rows_);
+      if (!res.IsEmpty()) {
+        chunk_.emplace(res.template AsSetOf<T>(ExtractionTag{}));
+        return;
+      }
+    }
+  }
+
+  Portal* portal_;
+  std::uint32_t chunk_rows_;
+  std::optional<TypedResultSet<T, ExtractionTag>> chunk_;
+  std::size_t index_{0};
+  bool started_{false};
+};
+
+template <typename T>
+TypedPortalRange<T, FieldTag> Portal::AsSetOf(std::uint32_t chunk_rows) {
+  return AsSetOf<T>(chunk_rows, kFieldTag);
+}
+
+template <typename T>
+TypedPortalRange<T, RowTag> Portal::AsSetOf(std::uint32_t chunk_rows, RowTag) {
+  return TypedPortalRange<T, RowTag>{*this, chunk_rows};
+}
+
+template <typename T>
+TypedPortalRange<T, FieldTag> Portal::AsSetOf(std::uint32_t chunk_rows,
+                                              FieldTag) {
+  return TypedPortalRange<T, FieldTag>{*this, chunk_rows};
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
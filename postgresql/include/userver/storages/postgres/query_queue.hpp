@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file userver/storages/postgres/query_queue.hpp
+/// @brief @copybrief storages::postgres::QueryQueue
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @ingroup userver_containers
+///
+/// @brief A list of independent statements to be executed by
+/// storages::postgres::Transaction::ExecuteBatch
+///
+/// When the pipeline mode is enabled for the connection, all the statements
+/// of the queue are sent to the server at once and their results are read
+/// back in a single round trip. Otherwise the statements are executed one by
+/// one.
+///
+/// The statements must not depend on the results of each other. As with
+/// storages::postgres::ParameterStore, only built-in types can be used as
+/// parameters.
+///
+/// @snippet storages/postgres/tests/query_queue_pgtest.cpp QueryQueue sample
+class QueryQueue final {
+ public:
+  /// @cond
+  struct Statement final {
+    Query query;
+    ParameterStore params;
+  };
+  /// @endcond
+
+  QueryQueue() = default;
+  QueryQueue(const QueryQueue&) = delete;
+  QueryQueue(QueryQueue&&) = default;
+  QueryQueue& operator=(const QueryQueue&) = delete;
+  QueryQueue& operator=(QueryQueue&&) = default;
+
+  /// @brief Adds a statement with the parameters to the end of the queue
+  template <typename... Args>
+  QueryQueue& Push(Query query, const Args&... args) {
+    ParameterStore params;
+    (params.PushBack(args), ...);
+    statements_.push_back({std::move(query), std::move(params)});
+    return *this;
+  }
+
+  /// @brief Adds a statement with the already stored parameters to the end of
+  /// the queue
+  QueryQueue& Push(Query query, ParameterStore&& params) {
+    statements_.push_back({std::move(query), std::move(params)});
+    return *this;
+  }
+
+  void Reserve(std::size_t size) { statements_.reserve(size); }
+
+  /// Returns whether the queue is empty
+  bool IsEmpty() const { return statements_.empty(); }
+
+  /// Returns the number of statements in the queue
+  std::size_t Size() const { return statements_.size(); }
+
+  /// @cond
+  const std::vector<Statement>& GetInternalData() const { return statements_; }
+  /// @endcond
+
+ private:
+  std::vector<Statement> statements_;
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
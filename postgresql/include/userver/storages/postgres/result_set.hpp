@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -685,12 +686,41 @@ class ResultSet {
   auto AsSingleRow(RowTag) const;
   template <typename T>
   auto AsSingleRow(FieldTag) const;
+
+  /// @brief Extract a single column into a vector.
+  ///
+  /// The columns of integral, floating point, `timestamp` and `timestamptz`
+  /// types read into the C++ types of the same size are decoded in a single
+  /// pass without the per-field buffer category checks, other columns are
+  /// read field by field.
+  ///
+  /// Reading to `std::string_view` does not copy the data, the values must not
+  /// outlive the result set.
+  template <typename T>
+  std::vector<T> AsColumn(size_type field_index) const;
   //@}
  private:
   friend class detail::ConnectionImpl;
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
 
+  // Fast paths of AsColumn, return false if the column has to be read field
+  // by field
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<Smallint>& column) const;
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<Integer>& column) const;
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<Bigint>& column) const;
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<float>& column) const;
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<double>& column) const;
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<TimePoint>& column) const;
+  bool ReadFixedSizeColumn(size_type field_index,
+                           std::vector<TimePointTz>& column) const;
+
   template <typename T, typename Tag>
   friend class TypedResultSet;
   friend class ConnectionImpl;
@@ -730,6 +760,13 @@ constexpr void AssertSaneTypeToDeserialize() {
       "obfuscates code. Change the type to just T");
 }
 
+template <typename T>
+inline constexpr bool kHasFixedSizeColumnReader =
+    std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+    std::is_same_v<T, Bigint> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double> || std::is_same_v<T, TimePoint> ||
+    std::is_same_v<T, TimePointTz>;
+
 //@{
 /** @name Sequental field extraction */
 template <typename IndexTuple, typename... T>
@@ -942,6 +979,29 @@ auto ResultSet::AsSetOf(FieldTag) const {
   return TypedResultSet<T, FieldTag>{*this};
 }
 
+template <typename T>
+std::vector<T> ResultSet::AsColumn(size_type field_index) const {
+  detail::AssertSaneTypeToDeserialize<T>();
+  using ValueType = std::decay_t<T>;
+  static_assert(io::traits::kIsMappedToPg<ValueType> ||
+                    io::traits::kIsCompositeType<ValueType>,
+                "This type is not mapped to a PostgreSQL type");
+  if (field_index >= FieldCount()) throw FieldIndexOutOfBounds{field_index};
+
+  std::vector<T> column;
+  if constexpr (detail::kHasFixedSizeColumnReader<T>) {
+    if (ReadFixedSizeColumn(field_index, column)) return column;
+  }
+  const auto size = Size();
+  column.reserve(size);
+  for (size_type i = 0; i < size; ++i) {
+    T value{};
+    FieldView{*pimpl_, i, field_index}.To(value);
+    column.push_back(std::move(value));
+  }
+  return column;
+}
+
 template <typename Container>
 Container ResultSet::AsContainer() const {
   detail::AssertSaneTypeToDeserialize<Container>();
@@ -5,15 +5,19 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
+#include <userver/storages/postgres/lsn.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
 #include <userver/storages/postgres/portal.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -209,6 +213,25 @@ class Transaction {
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Execute independent statements of the queue and return their results
+  /// in the same order.
+  ///
+  /// In the pipeline mode the statements are sent to the server at once,
+  /// saving a round trip per statement. If one of the statements fails, the
+  /// following statements are not executed and its error is thrown.
+  ///
+  /// Suspends coroutine for execution.
+  std::vector<ResultSet> ExecuteBatch(const QueryQueue& queue) {
+    return ExecuteBatch(OptionalCommandControl{}, queue);
+  }
+
+  /// Execute independent statements of the queue with per-statement
+  /// command control and return their results in the same order.
+  ///
+  /// Suspends coroutine for execution.
+  std::vector<ResultSet> ExecuteBatch(OptionalCommandControl statement_cmd_ctl,
+                                      const QueryQueue& queue);
+
   /// Execute statement that uses an array of arguments splitting that array in
   /// chunks and executing the statement with a chunk of arguments.
   ///
@@ -288,6 +311,40 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement and return the
+  /// stream to write the rows to.
+  ///
+  /// Suspends coroutine for execution.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn sample
+  CopyInStream CopyIn(const Query& query) {
+    return CopyIn(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement with
+  /// per-statement command control. The network timeout applies to each
+  /// portion of the data sent, the statement timeout applies to the whole
+  /// COPY.
+  CopyInStream CopyIn(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query);
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement and return the
+  /// stream to read the rows from.
+  ///
+  /// Suspends coroutine for execution.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut sample
+  CopyOutStream CopyOut(const Query& query) {
+    return CopyOut(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement with
+  /// per-statement command control. The network timeout applies to each
+  /// portion of the data received, the statement timeout applies to the
+  /// whole COPY.
+  CopyOutStream CopyOut(OptionalCommandControl statement_cmd_ctl,
+                        const Query& query);
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -299,6 +356,15 @@ class Transaction {
   /// After Commit or Rollback is called, the transaction is not usable any
   /// more.
   void Commit();
+  /// Commit the transaction and return the position in the write-ahead log
+  /// that includes it.
+  ///
+  /// Passing the LSN to storages::postgres::Cluster::Begin routes the reads
+  /// only to the hosts that have replayed the commit. For a transaction on a
+  /// replica returns the replayed position, which keeps the subsequent reads
+  /// from seeing older data. Costs an extra round trip after the commit.
+  /// After CommitAndGetLsn is called, the transaction is not usable any more.
+  Lsn CommitAndGetLsn();
   /// Rollback the transaction
   /// Suspends coroutine until command complete.
   /// After Commit or Rollback is called, the transaction is not usable any
@@ -72,6 +72,12 @@ struct PostgresExamplePolicy {
   // Required: no
   static constexpr const char* kWhere = "id > 10";
 
+  // SQL expression to split the full update into `full-update-partitions`
+  // concurrently fetched partitions by. Should spread the rows evenly.
+  //
+  // Required: **yes** if `full-update-partitions` is greater than 1.
+  static constexpr const char* kPartitionKey = "id";
+
   // Cache container type.
   //
   // It can be of any map type. The default is `unordered_map`, it is not
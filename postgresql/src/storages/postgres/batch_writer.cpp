@@ -0,0 +1,93 @@
+#include <userver/storages/postgres/batch_writer.hpp>
+
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/future.hpp>
+#include <userver/storages/postgres/cluster.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+struct BatchWriter::Batch final {
+  QueryQueue queue;
+  std::vector<engine::Promise<ResultSet>> promises;
+};
+
+BatchWriter::BatchWriter(ClusterPtr cluster, Query query, Settings settings,
+                         ClusterHostTypeFlags flags,
+                         TransactionOptions options,
+                         OptionalCommandControl cmd_ctl)
+    : cluster_(std::move(cluster)),
+      query_(std::move(query)),
+      settings_(settings),
+      flags_(flags),
+      options_(options),
+      cmd_ctl_(std::move(cmd_ctl)) {
+  UASSERT(cluster_);
+  UINVARIANT(settings_.max_batch_size > 0, "max_batch_size must be positive");
+}
+
+BatchWriter::~BatchWriter() = default;
+
+ResultSet BatchWriter::Execute(ParameterStore&& params) {
+  std::shared_ptr<Batch> batch;
+  engine::Future<ResultSet> future;
+  bool is_first = false;
+  {
+    std::lock_guard lock{mutex_};
+    if (!current_) {
+      current_ = std::make_shared<Batch>();
+      current_->queue.Reserve(settings_.max_batch_size);
+      current_->promises.reserve(settings_.max_batch_size);
+      is_first = true;
+    }
+    batch = current_;
+    batch->queue.Push(query_, std::move(params));
+    future = batch->promises.emplace_back().get_future();
+    if (batch->queue.Size() >= settings_.max_batch_size) {
+      // No more statements are added to a full batch
+      current_.reset();
+      batch_full_.NotifyAll();
+    }
+  }
+
+  if (is_first) Flush(batch);
+  return future.get();
+}
+
+void BatchWriter::Flush(const std::shared_ptr<Batch>& batch) {
+  {
+    std::unique_lock lock{mutex_};
+    // Wakes up early on cancellation, the batch is executed right away then
+    [[maybe_unused]] const auto is_full = batch_full_.WaitFor(
+        lock, settings_.max_delay, [&] { return current_ != batch; });
+    if (current_ == batch) current_.reset();
+  }
+
+  try {
+    auto trx = cluster_->Begin(flags_, options_, cmd_ctl_);
+    auto results = trx.ExecuteBatch(batch->queue);
+    trx.Commit();
+    UINVARIANT(results.size() == batch->promises.size(),
+               "Unexpected number of results of the batch");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      batch->promises[i].set_value(std::move(results[i]));
+    }
+  } catch (const std::exception&) {
+    const auto error = std::current_exception();
+    for (auto& promise : batch->promises) {
+      promise.set_exception(error);
+    }
+  }
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -35,7 +35,14 @@ Transaction Cluster::Begin(const TransactionOptions& options,
 Transaction Cluster::Begin(ClusterHostTypeFlags flags,
                            const TransactionOptions& options,
                            OptionalCommandControl cmd_ctl) {
-  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(cmd_ctl));
+  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(cmd_ctl),
+                       kUnknownLsn);
+}
+
+Transaction Cluster::Begin(ClusterHostTypeFlags flags,
+                           const TransactionOptions& options, Lsn min_lsn,
+                           OptionalCommandControl cmd_ctl) {
+  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(cmd_ctl), min_lsn);
 }
 
 Transaction Cluster::Begin(const std::string& name,
@@ -45,7 +52,8 @@ Transaction Cluster::Begin(const std::string& name,
 
 Transaction Cluster::Begin(const std::string& name, ClusterHostTypeFlags flags,
                            const TransactionOptions& options) {
-  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(GetQueryCmdCtl(name)));
+  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(GetQueryCmdCtl(name)),
+                       kUnknownLsn);
 }
 
 void Cluster::SetDefaultCommandControl(CommandControl cmd_ctl) {
@@ -265,6 +265,11 @@ properties:
         type: boolean
         description: execute discard all on new connections
         defaultDescription: true
+    prepare-on-connect-size:
+        type: integer
+        minimum: 0
+        description: number of the statements recently prepared in a pool to prepare on its new connections (0 - disabled)
+        defaultDescription: 0
     monitoring-dbalias:
         type: string
         description: name of the database for monitorings
@@ -314,6 +319,10 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    adaptive_pool_size:
+        type: boolean
+        description: grow the pool ahead of the demand and shrink it down to the recent peak demand, min_pool_size becomes a lower bound
+        defaultDescription: false
     connlimit_mode:
         type: string
         enum:
@@ -0,0 +1,174 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+constexpr std::string_view kSignature{"PGCOPY\n\377\r\n\0", 11};
+
+// Signature, flags and the length of the header extension
+constexpr std::size_t kHeaderSize = kSignature.size() + 2 * sizeof(Integer);
+
+constexpr Smallint kTrailer = -1;
+
+template <typename T>
+T ReadInteger(const std::string& buffer, std::size_t offset) {
+  T value{};
+  io::ReadBuffer(
+      io::FieldBuffer{
+          false, io::BufferCategory::kPlainBuffer, sizeof(T),
+          reinterpret_cast<const std::uint8_t*>(buffer.data() + offset)},
+      value);
+  return value;
+}
+
+}  // namespace
+
+CopyInStream::CopyInStream(detail::Connection* conn, const UserTypes& types)
+    : conn_(conn), types_(&types) {
+  UASSERT(conn_);
+  buffer_.reserve(kBufferSize);
+  buffer_.append(kSignature);
+  io::WriteBuffer(types, buffer_, Integer{0});  // flags
+  io::WriteBuffer(types, buffer_, Integer{0});  // header extension length
+}
+
+CopyInStream::CopyInStream(CopyInStream&& other) noexcept
+    : conn_(std::exchange(other.conn_, nullptr)),
+      types_(other.types_),
+      buffer_(std::move(other.buffer_)),
+      rows_written_(other.rows_written_) {}
+
+CopyInStream::~CopyInStream() {
+  if (!conn_) return;
+  try {
+    conn_->AbortCopyIn("COPY stream was destroyed before finishing");
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to abort an unfinished COPY: " << e;
+  }
+}
+
+std::size_t CopyInStream::Finish() {
+  if (!conn_) throw LogicError{"COPY stream is already finished"};
+  io::WriteBuffer(*types_, buffer_, kTrailer);
+  SendBuffer();
+  return std::exchange(conn_, nullptr)->EndCopyIn();
+}
+
+void CopyInStream::SendBuffer() {
+  UINVARIANT(conn_, "Writing to a finished COPY stream");
+  conn_->PutCopyData(buffer_);
+  buffer_.clear();
+}
+
+CopyOutStream::CopyOutStream(detail::Connection* conn) : conn_(conn) {
+  UASSERT(conn_);
+}
+
+CopyOutStream::CopyOutStream(CopyOutStream&& other) noexcept
+    : conn_(std::exchange(other.conn_, nullptr)),
+      buffer_(std::move(other.buffer_)),
+      offset_(other.offset_),
+      rows_read_(other.rows_read_),
+      header_read_(other.header_read_),
+      done_(other.done_) {}
+
+CopyOutStream::~CopyOutStream() {
+  if (!conn_ || done_) return;
+  try {
+    conn_->CancelCopyOut();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to cancel an unfinished COPY: " << e;
+  }
+}
+
+std::optional<io::FieldBuffer> CopyOutStream::ReadRow(
+    std::size_t columns_count) {
+  if (done_) return std::nullopt;
+  UINVARIANT(conn_, "Reading from a moved-out COPY stream");
+
+  if (!header_read_) {
+    if (!EnsureData(kHeaderSize)) {
+      throw InvalidBinaryBuffer{"COPY data has no header"};
+    }
+    if (std::string_view{buffer_}.substr(offset_, kSignature.size()) !=
+        kSignature) {
+      throw InvalidBinaryBuffer{
+          "Unexpected COPY data signature, the format must be binary"};
+    }
+    const auto extension_length = ReadInteger<Integer>(
+        buffer_, offset_ + kSignature.size() + sizeof(Integer));
+    if (extension_length < 0 ||
+        !EnsureData(kHeaderSize + extension_length)) {
+      throw InvalidBinaryBuffer{"COPY data header is truncated"};
+    }
+    offset_ += kHeaderSize + extension_length;
+    header_read_ = true;
+  }
+
+  if (!EnsureData(sizeof(Smallint))) {
+    throw InvalidBinaryBuffer{"COPY data has no trailer"};
+  }
+  const auto fields_count = ReadInteger<Smallint>(buffer_, offset_);
+  if (fields_count == kTrailer) {
+    // Read up to the end of the COPY to get its result
+    while (conn_->GetCopyData(buffer_)) {
+    }
+    done_ = true;
+    buffer_.clear();
+    offset_ = 0;
+    return std::nullopt;
+  }
+  if (fields_count < 0 ||
+      static_cast<std::size_t>(fields_count) != columns_count) {
+    throw FieldTupleMismatch(fields_count, columns_count);
+  }
+
+  // Offsets are relative to `offset_`, as it is changed by EnsureData
+  std::size_t row_size = sizeof(Smallint);
+  for (Smallint i = 0; i < fields_count; ++i) {
+    if (!EnsureData(row_size + sizeof(Integer))) {
+      throw InvalidBinaryBuffer{"COPY row is truncated"};
+    }
+    const auto field_length = ReadInteger<Integer>(buffer_, offset_ + row_size);
+    row_size += sizeof(Integer) + (field_length > 0 ? field_length : 0);
+  }
+  if (!EnsureData(row_size)) {
+    throw InvalidBinaryBuffer{"COPY row is truncated"};
+  }
+
+  const io::FieldBuffer row{
+      false, io::BufferCategory::kPlainBuffer, row_size - sizeof(Smallint),
+      reinterpret_cast<const std::uint8_t*>(buffer_.data() + offset_ +
+                                            sizeof(Smallint))};
+  offset_ += row_size;
+  ++rows_read_;
+  return row;
+}
+
+bool CopyOutStream::EnsureData(std::size_t size) {
+  while (buffer_.size() - offset_ < size) {
+    // Drop the rows that were read already to keep the buffer small
+    buffer_.erase(0, offset_);
+    offset_ = 0;
+    if (!conn_->GetCopyData(buffer_)) {
+      done_ = true;
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -1,14 +1,18 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
 
 #include <storages/postgres/detail/topology/hot_standby.hpp>
 #include <storages/postgres/detail/topology/standalone.hpp>
+#include <storages/postgres/internal_pg_types.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -31,15 +35,44 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kLeastLoaded:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
   UINVARIANT(false, "Unexpected cluster host type");
 }
 
-size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
-                      ClusterHostTypeFlags flags,
-                      std::atomic<uint32_t>& rr_host_idx) {
+// Expected time to serve a statement, the hosts without known latency are
+// preferred to get their latency measured
+double EstimateLoad(const ConnectionPool& pool) {
+  const auto in_flight = pool.GetStatistics().connection.used.Load();
+  const auto latency =
+      pool.GetStatementTimingsStorage().GetLatencyEwma().count();
+  return (in_flight + 1.0) * std::max<std::int64_t>(latency, 1);
+}
+
+// Power of two choices, avoids herding on the least loaded host during the
+// statistics update lag
+size_t SelectLeastLoaded(
+    const topology::TopologyBase::DsnIndices& indices,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools) {
+  if (indices.size() == 1) return 0;
+  const auto first = USERVER_NAMESPACE::utils::RandRange(indices.size());
+  auto second = USERVER_NAMESPACE::utils::RandRange(indices.size() - 1);
+  if (second >= first) ++second;
+
+  UASSERT(indices[first] < host_pools.size());
+  UASSERT(indices[second] < host_pools.size());
+  return EstimateLoad(*host_pools[indices[first]]) <=
+                 EstimateLoad(*host_pools[indices[second]])
+             ? first
+             : second;
+}
+
+size_t SelectDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    ClusterHostTypeFlags flags, std::atomic<uint32_t>& rr_host_idx,
+    const std::vector<std::shared_ptr<ConnectionPool>>& host_pools) {
   UASSERT(!indices.empty());
   if (indices.empty()) {
     throw ClusterError("Cannot select host from an empty list");
@@ -54,6 +87,8 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
       idx_pos =
           rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
     }
+  } else if (strategy_flags == ClusterHostType::kLeastLoaded) {
+    idx_pos = SelectLeastLoaded(indices, host_pools);
   } else if (strategy_flags != ClusterHostType::kNearest) {
     throw LogicError(
         fmt::format("Invalid strategy requested: {}, ensure only one is used",
@@ -62,6 +97,28 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
   return indices[idx_pos];
 }
 
+// Leaves the hosts that have replayed the WAL up to `min_lsn`, the master is
+// always kept as it is the source of the WAL
+topology::TopologyBase::DsnIndices FilterCaughtUp(
+    const topology::TopologyBase& topology,
+    const topology::TopologyBase::DsnIndices& indices, Lsn min_lsn) {
+  const auto dsn_indices_by_type = topology.GetDsnIndicesByType();
+  const auto master_it = dsn_indices_by_type->find(ClusterHostType::kMaster);
+  const auto wal_lsns = topology.GetWalLsns();
+
+  topology::TopologyBase::DsnIndices caught_up;
+  for (const auto idx : indices) {
+    const bool is_master =
+        master_it != dsn_indices_by_type->end() &&
+        std::find(master_it->second.begin(), master_it->second.end(), idx) !=
+            master_it->second.end();
+    if (is_master || (idx < wal_lsns->size() && (*wal_lsns)[idx] >= min_lsn)) {
+      caught_up.push_back(idx);
+    }
+  }
+  return caught_up;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
@@ -205,7 +262,7 @@ ClusterStatisticsPtr ClusterImpl::GetStatistics() const {
 }
 
 ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
-    ClusterHostTypeFlags flags) {
+    ClusterHostTypeFlags flags, Lsn min_lsn) {
   LOG_TRACE() << "Looking for pool: " << flags;
 
   size_t dsn_index = -1;
@@ -223,7 +280,19 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    if (min_lsn != kUnknownLsn) {
+      const auto caught_up_dsn_indices =
+          FilterCaughtUp(*topology_, *alive_dsn_indices, min_lsn);
+      if (caught_up_dsn_indices.empty()) {
+        throw ClusterUnavailable(
+            "None of available cluster hosts have replayed the requested LSN");
+      }
+      dsn_index = SelectDsnIndex(caught_up_dsn_indices, flags, rr_host_idx_,
+                               host_pools_);
+    } else {
+      dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_,
+                               host_pools_);
+    }
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -238,6 +307,18 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
       dsn_indices_it = dsn_indices_by_type->find(host_role);
     }
 
+    topology::TopologyBase::DsnIndices caught_up_dsn_indices;
+    if (min_lsn != kUnknownLsn && host_role != ClusterHostType::kMaster) {
+      caught_up_dsn_indices =
+          FilterCaughtUp(*topology_, dsn_indices_it->second, min_lsn);
+      if (caught_up_dsn_indices.empty()) {
+        LOG_DEBUG() << "No " << host_role << " has replayed LSN " << min_lsn
+                    << ", falling back to " << ClusterHostType::kMaster;
+        host_role = ClusterHostType::kMaster;
+        dsn_indices_it = dsn_indices_by_type->find(host_role);
+      }
+    }
+
     if (dsn_indices_it == dsn_indices_by_type->end() ||
         dsn_indices_it->second.empty()) {
       throw ClusterUnavailable(
@@ -245,7 +326,10 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(caught_up_dsn_indices.empty()
+                                   ? dsn_indices_it->second
+                                   : caught_up_dsn_indices,
+                               flags, rr_host_idx_, host_pools_);
   }
 
   UASSERT(dsn_index < host_pools_.size());
@@ -254,7 +338,7 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
 
 Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
                                const TransactionOptions& options,
-                               OptionalCommandControl cmd_ctl) {
+                               OptionalCommandControl cmd_ctl, Lsn min_lsn) {
   LOG_TRACE() << "Requested transaction on " << flags;
   const auto role_flags = flags & kClusterHostRolesMask;
   if (options.IsReadOnly()) {
@@ -267,7 +351,7 @@ Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
     }
     flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
   }
-  return FindPool(flags)->Begin(options, cmd_ctl);
+  return FindPool(flags, min_lsn)->Begin(options, cmd_ctl);
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
@@ -277,7 +361,7 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
         "Host role must be specified for execution of a single statement");
   }
   LOG_TRACE() << "Requested single statement on " << flags;
-  return FindPool(flags)->Start(cmd_ctl);
+  return FindPool(flags, kUnknownLsn)->Start(cmd_ctl);
 }
 
 void ClusterImpl::SetDefaultCommandControl(CommandControl cmd_ctl,
@@ -42,7 +42,7 @@ class ClusterImpl {
   ClusterStatisticsPtr GetStatistics() const;
 
   Transaction Begin(ClusterHostTypeFlags, const TransactionOptions&,
-                    OptionalCommandControl);
+                    OptionalCommandControl, Lsn min_lsn);
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
@@ -74,7 +74,7 @@ class ClusterImpl {
 
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
-  ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  ConnectionPoolPtr FindPool(ClusterHostTypeFlags, Lsn min_lsn);
 
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
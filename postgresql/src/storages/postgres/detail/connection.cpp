@@ -23,14 +23,16 @@ std::unique_ptr<Connection> Connection::Connect(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock) {
+    engine::SemaphoreLock&& size_lock, StatementCatalog* statement_catalog,
+    SharedUserTypes* shared_user_types) {
   std::unique_ptr<Connection> conn(new Connection());
 
   const auto deadline = engine::Deadline::FromDuration(std::max(
       kMinConnectTimeout, default_cmd_ctls.GetDefaultCmdCtl().execute));
   conn->pimpl_ = std::make_unique<ConnectionImpl>(
       bg_task_processor, bg_task_storage, id, settings, default_cmd_ctls,
-      testsuite_pg_ctl, ei_settings, std::move(size_lock));
+      testsuite_pg_ctl, ei_settings, std::move(size_lock), statement_catalog,
+      shared_user_types);
   if (resolver) {
     try {
       conn->pimpl_->AsyncConnect(ResolveDsnHostaddrs(dsn, *resolver, deadline),
@@ -123,6 +125,37 @@ ResultSet Connection::Execute(CommandControl statement_cmd_ctl,
                  OptionalCommandControl{statement_cmd_ctl});
 }
 
+std::vector<ResultSet> Connection::ExecuteBatch(
+    const QueryQueue& queue, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecuteBatch(queue, std::move(statement_cmd_ctl));
+}
+
+void Connection::StartCopyIn(const Query& query,
+                             OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->StartCopy(query, true, std::move(statement_cmd_ctl));
+}
+
+void Connection::PutCopyData(std::string_view data) {
+  pimpl_->PutCopyData(data);
+}
+
+std::size_t Connection::EndCopyIn() { return pimpl_->EndCopyIn(); }
+
+void Connection::AbortCopyIn(const std::string& reason) {
+  pimpl_->AbortCopyIn(reason);
+}
+
+void Connection::StartCopyOut(const Query& query,
+                              OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->StartCopy(query, false, std::move(statement_cmd_ctl));
+}
+
+bool Connection::GetCopyData(std::string& buffer) {
+  return pimpl_->GetCopyData(buffer);
+}
+
+void Connection::CancelCopyOut() { pimpl_->CancelCopyOut(); }
+
 Connection::StatementId Connection::PortalBind(
     const std::string& statement, const std::string& portal_name,
     const detail::QueryParameters& params,
@@ -139,6 +172,20 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+void Connection::PortalPrefetch(StatementId statement_id,
+                                const std::string& portal_name,
+                                std::uint32_t n_rows,
+                                OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->PortalPrefetch(statement_id, portal_name, n_rows,
+                         std::move(statement_cmd_ctl));
+}
+
+ResultSet Connection::PortalWaitPrefetched(
+    StatementId statement_id, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->PortalWaitPrefetched(statement_id,
+                                      std::move(statement_cmd_ctl));
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
@@ -3,6 +3,8 @@
 #include <atomic>
 #include <chrono>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -19,6 +21,7 @@
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -37,6 +40,8 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class SharedUserTypes;
+class StatementCatalog;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -129,6 +134,8 @@ class Connection {
   /// @param testsuite_pg_ctl operation parameters customizer for testsuite
   /// @param ei_settings error injection settings
   /// @param size_guard structure to track the size of owning connection pool
+  /// @param statement_catalog statements of the owning pool to prepare eagerly
+  /// @param shared_user_types user types recently loaded by the owning pool
   /// @throws ConnectionFailed, ConnectionTimeoutError
   // clang-format on
   static std::unique_ptr<Connection> Connect(
@@ -139,7 +146,9 @@ class Connection {
       const DefaultCommandControls& default_cmd_ctls,
       const testsuite::PostgresControl& testsuite_pg_ctl,
       const error_injection::Settings& ei_settings,
-      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{});
+      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{},
+      StatementCatalog* statement_catalog = nullptr,
+      SharedUserTypes* shared_user_types = nullptr);
 
   /// Close the connection
   /// TODO When called from another thread/coroutine will wait for current
@@ -226,12 +235,45 @@ class Connection {
   ResultSet Execute(CommandControl statement_cmd_ctl, const Query& query,
                     const ParameterStore& store);
 
+  /// Execute independent statements, in a single pipeline if the pipeline
+  /// mode is active
+  std::vector<ResultSet> ExecuteBatch(const QueryQueue& queue,
+                                      OptionalCommandControl statement_cmd_ctl);
+
+  /// Start a `COPY ... FROM STDIN` statement
+  void StartCopyIn(const Query& query,
+                   OptionalCommandControl statement_cmd_ctl);
+  /// Send the data of the COPY started by StartCopyIn
+  void PutCopyData(std::string_view data);
+  /// Complete the COPY started by StartCopyIn
+  /// @returns the number of copied rows
+  std::size_t EndCopyIn();
+  /// Fail the COPY started by StartCopyIn
+  void AbortCopyIn(const std::string& reason);
+
+  /// Start a `COPY ... TO STDOUT` statement
+  void StartCopyOut(const Query& query,
+                    OptionalCommandControl statement_cmd_ctl);
+  /// Append the next portion of the data of the COPY started by StartCopyOut
+  /// to the buffer
+  /// @returns false if the data has ended
+  bool GetCopyData(std::string& buffer);
+  /// Cancel the COPY started by StartCopyOut discarding the rest of the data
+  void CancelCopyOut();
+
   StatementId PortalBind(const std::string& statement,
                          const std::string& portal_name,
                          const detail::QueryParameters& params,
                          OptionalCommandControl);
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
+  /// Send the execution of the portal without waiting for the result, the
+  /// result must be collected by PortalWaitPrefetched before any other
+  /// statement is executed
+  void PortalPrefetch(StatementId, const std::string& portal_name,
+                      std::uint32_t n_rows, OptionalCommandControl);
+  /// Wait for the result of the preceding PortalPrefetch
+  ResultSet PortalWaitPrefetched(StatementId, OptionalCommandControl);
 
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
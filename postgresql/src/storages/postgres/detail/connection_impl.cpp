@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/connection_impl.hpp>
 
+#include <algorithm>
+
 #include <boost/functional/hash.hpp>
 
 #include <userver/error_injection/hook.hpp>
@@ -14,6 +16,8 @@
 #include <userver/utils/text_light.hpp>
 #include <userver/utils/uuid4.hpp>
 
+#include <storages/postgres/detail/shared_user_types.hpp>
+#include <storages/postgres/detail/statement_catalog.hpp>
 #include <storages/postgres/detail/tracing_tags.hpp>
 #include <storages/postgres/io/pg_type_parsers.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -179,11 +183,14 @@ ConnectionImpl::ConnectionImpl(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock)
+    engine::SemaphoreLock&& size_lock, StatementCatalog* statement_catalog,
+    SharedUserTypes* shared_user_types)
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
       conn_wrapper_{bg_task_processor, bg_task_storage, id,
                     std::move(size_lock)},
       prepared_{settings.max_prepared_cache_size},
+      statement_catalog_{statement_catalog},
+      shared_user_types_{shared_user_types},
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
@@ -227,11 +234,18 @@ void ConnectionImpl::AsyncConnect(const Dsn& dsn, engine::Deadline deadline) {
   RefreshReplicaState(deadline);
   SetConnectionStatementTimeout(GetDefaultCommandControl().statement, deadline);
   if (settings_.user_types != ConnectionSettings::kPredefinedTypesOnly) {
-    LoadUserTypes(deadline);
+    const auto shared_definitions =
+        shared_user_types_ ? shared_user_types_->GetRecent() : nullptr;
+    if (shared_definitions) {
+      db_types_ = shared_definitions->MakeUserTypes();
+    } else {
+      LoadUserTypes(deadline);
+    }
   }
   if (settings_.pipeline_mode == PipelineMode::kEnabled) {
     conn_wrapper_.EnterPipelineMode();
   }
+  PrepareCatalogStatements(deadline, span, scope);
 }
 
 void ConnectionImpl::Close() { conn_wrapper_.Close().Wait(); }
@@ -363,6 +377,196 @@ ResultSet ConnectionImpl::ExecuteCommand(
   return ExecuteCommand(query, params, deadline);
 }
 
+std::vector<ResultSet> ConnectionImpl::ExecuteBatch(
+    const QueryQueue& queue, OptionalCommandControl statement_cmd_ctl) {
+  const auto& statements = queue.GetInternalData();
+  const bool use_prepared = settings_.prepared_statements !=
+                            ConnectionSettings::kNoPreparedStatements;
+  // Preparing more statements than the cache holds would evict the ones
+  // prepared earlier for the same batch
+  if (!IsPipelineActive() ||
+      (use_prepared && statements.size() > settings_.max_prepared_cache_size)) {
+    std::vector<ResultSet> results;
+    results.reserve(statements.size());
+    for (const auto& [query, params] : statements) {
+      results.push_back(ExecuteCommand(
+          query, QueryParameters{params.GetInternalData()}, statement_cmd_ctl));
+    }
+    return results;
+  }
+
+  CheckBusy();
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+  span.AddTag("batch_size", statements.size());
+  auto scope = span.CreateScopeTime();
+  CountExecute count_execute(stats_);
+  stats_.execute_total += statements.size() - 1;
+
+  // All the statements are prepared before sending any of them, as waiting
+  // for the preparation would consume the results of the sent statements
+  std::vector<std::string> statement_names;
+  std::vector<ResultSet> descriptions;
+  if (use_prepared) {
+    statement_names.reserve(statements.size());
+    descriptions.reserve(statements.size());
+    for (const auto& [query, params] : statements) {
+      const QueryParameters query_params{params.GetInternalData()};
+      if (settings_.ignore_unused_query_params ==
+          ConnectionSettings::kCheckUnused) {
+        CheckQueryParameters(query.Statement(), query_params);
+      }
+      const auto& prepared_info = PrepareStatement(
+          query.Statement(), query_params, deadline, span, scope);
+      statement_names.push_back(prepared_info.statement_name);
+      descriptions.push_back(prepared_info.description);
+    }
+  }
+
+  scope.Reset(scopes::kExec);
+  for (std::size_t i = 0; i < statements.size(); ++i) {
+    const QueryParameters params{statements[i].params.GetInternalData()};
+    if (use_prepared) {
+      conn_wrapper_.SendPreparedQuery(statement_names[i], params, scope);
+    } else {
+      conn_wrapper_.SendQuery(statements[i].query.Statement(), params, scope);
+    }
+  }
+
+  try {
+    auto results = conn_wrapper_.GatherPipeline(deadline, scope);
+    // The results of the commands sent without waiting, e.g. of the statement
+    // timeout setup, precede the results of the batch
+    UINVARIANT(results.size() >= statements.size(),
+               "Fewer results than the statements in the pipeline");
+    const auto leading_count = results.size() - statements.size();
+    results.erase(results.begin(),
+                  results.begin() + static_cast<std::ptrdiff_t>(leading_count));
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      auto& res = results[i];
+      if (use_prepared && !descriptions[i].IsEmpty()) {
+        res.SetBufferCategoriesFrom(descriptions[i]);
+      } else if (!res.IsEmpty()) {
+        FillBufferCategories(res);
+      }
+      count_execute.AccountResult(res);
+    }
+    return results;
+  } catch (const ConnectionTimeoutError& e) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING() << "Batch of " << statements.size()
+                          << " statements network timeout error: " << e
+                          << ". Network timeout was "
+                          << network_timeout.count() << "ms";
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  } catch (const FeatureNotSupported& e) {
+    if (e.GetServerMessage().GetPrimary() == kBadCachedPlanErrorMessage) {
+      LOG_LIMITED_WARNING()
+          << "Scheduling prepared statements invalidation due to "
+             "cached plan change";
+      is_discard_prepared_pending_ = true;
+    }
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+}
+
+void ConnectionImpl::StartCopy(const Query& query, bool is_copy_in,
+                               OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  ++stats_.execute_total;
+  try {
+    copy_.emplace(CopyState{network_timeout});
+    if (IsPipelineActive()) {
+      // Collect the results of the commands sent without waiting
+      conn_wrapper_.WaitResult(deadline, scope);
+      conn_wrapper_.ExitPipelineMode();
+      copy_->exited_pipeline = true;
+    }
+    conn_wrapper_.StartCopy(query.Statement(), is_copy_in, deadline, scope);
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    span.AddTag(tracing::kErrorFlag, true);
+    FinishCopy();
+    throw;
+  }
+}
+
+void ConnectionImpl::PutCopyData(std::string_view data) {
+  UINVARIANT(copy_, "There is no COPY in progress");
+  conn_wrapper_.PutCopyData(data, MakeCopyDeadline());
+}
+
+std::size_t ConnectionImpl::EndCopyIn() {
+  UINVARIANT(copy_, "There is no COPY in progress");
+  ScopeGuard finish_guard{[this] { FinishCopy(); }};
+  try {
+    return conn_wrapper_.EndCopy(nullptr, MakeCopyDeadline()).RowsAffected();
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    throw;
+  }
+}
+
+void ConnectionImpl::AbortCopyIn(const std::string& reason) {
+  UINVARIANT(copy_, "There is no COPY in progress");
+  ScopeGuard finish_guard{[this] { FinishCopy(); }};
+  ++stats_.error_execute_total;
+  try {
+    conn_wrapper_.EndCopy(reason.c_str(), MakeCopyDeadline());
+  } catch (const QueryCancelled&) {
+    // The server fails the COPY with the reason
+  }
+}
+
+bool ConnectionImpl::GetCopyData(std::string& buffer) {
+  UINVARIANT(copy_, "There is no COPY in progress");
+  try {
+    if (conn_wrapper_.GetCopyData(buffer, MakeCopyDeadline())) return true;
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    FinishCopy();
+    throw;
+  }
+  FinishCopy();
+  return false;
+}
+
+void ConnectionImpl::CancelCopyOut() {
+  UINVARIANT(copy_, "There is no COPY in progress");
+  ScopeGuard finish_guard{[this] { FinishCopy(); }};
+  ++stats_.error_execute_total;
+  Cancel();
+  std::string discarded;
+  try {
+    while (conn_wrapper_.GetCopyData(discarded, MakeCopyDeadline())) {
+      discarded.clear();
+    }
+  } catch (const QueryCancelled&) {
+    // The COPY is cancelled as requested
+  }
+}
+
 void ConnectionImpl::Begin(const TransactionOptions& options,
                            SteadyClock::time_point trx_start_time,
                            OptionalCommandControl trx_cmd_ctl) {
@@ -433,14 +637,6 @@ void ConnectionImpl::Finish() { stats_.trx_end_time = SteadyClock::now(); }
 Connection::StatementId ConnectionImpl::PortalBind(
     const std::string& statement, const std::string& portal_name,
     const QueryParameters& params, OptionalCommandControl statement_cmd_ctl) {
-  if (settings_.prepared_statements ==
-      ConnectionSettings::kNoPreparedStatements) {
-    LOG_LIMITED_WARNING()
-        << "Portals without prepared statements are currently unsupported";
-    throw LogicError{
-        "Prepared statements shouldn't be turned off while using portals"};
-  }  // TODO Prepare unnamed query instead
-
   CheckBusy();
   TimeoutDuration network_timeout = !!statement_cmd_ctl
                                         ? statement_cmd_ctl->execute
@@ -456,7 +652,9 @@ Connection::StatementId ConnectionImpl::PortalBind(
   CountPortalBind count_bind(stats_);
 
   const auto& prepared_info =
-      PrepareStatement(statement, params, deadline, span, scope);
+      settings_.prepared_statements == ConnectionSettings::kNoPreparedStatements
+          ? PrepareUnnamedStatement(statement, params, deadline, span, scope)
+          : PrepareStatement(statement, params, deadline, span, scope);
 
   scope.Reset(scopes::kBind);
   conn_wrapper_.SendPortalBind(prepared_info.statement_name, portal_name,
@@ -501,6 +699,60 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+void ConnectionImpl::PortalPrefetch(Connection::StatementId statement_id,
+                                    const std::string& portal_name,
+                                    std::uint32_t n_rows,
+                                    OptionalCommandControl statement_cmd_ctl) {
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+
+  auto* prepared_info = prepared_.Get(statement_id);
+  UASSERT_MSG(prepared_info,
+              "Portal prefetch uses statement id that is absent in prepared "
+              "statements");
+
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+  span.AddTag(tracing::kDatabaseStatement, prepared_info->statement);
+  if (deadline.IsReached()) {
+    ++stats_.execute_timeout;
+    LOG_LIMITED_WARNING()
+        << "Deadline was reached before starting to prefetch portal `"
+        << portal_name << "`";
+    throw ConnectionTimeoutError{"Deadline reached before executing"};
+  }
+  auto scope = span.CreateScopeTime(scopes::kExec);
+  conn_wrapper_.SendPortalExecute(portal_name, n_rows, scope);
+  // The rows are transferred while the caller processes the previous ones
+  conn_wrapper_.Flush(deadline);
+}
+
+ResultSet ConnectionImpl::PortalWaitPrefetched(
+    Connection::StatementId statement_id,
+    OptionalCommandControl statement_cmd_ctl) {
+  TimeoutDuration network_timeout = !!statement_cmd_ctl
+                                        ? statement_cmd_ctl->execute
+                                        : CurrentExecuteTimeout();
+  auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+
+  auto* prepared_info = prepared_.Get(statement_id);
+  UASSERT_MSG(prepared_info,
+              "Portal prefetch uses statement id that is absent in prepared "
+              "statements");
+
+  tracing::Span span{scopes::kQuery};
+  conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+  span.AddTag(tracing::kDatabaseStatement, prepared_info->statement);
+  auto scope = span.CreateScopeTime(scopes::kExec);
+  CountExecute count_execute(stats_);
+  return WaitResult(prepared_info->statement, deadline, network_timeout,
+                    count_execute, span, scope, &prepared_info->description);
+}
+
 void ConnectionImpl::CancelAndCleanup(TimeoutDuration timeout) {
   auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
 
@@ -725,10 +977,121 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
     // Ensure we've got binary format established
     res.GetRowDescription().CheckBinaryFormat(db_types_);
     ++stats_.parse_total;
+    if (statement_catalog_ && settings_.prepare_on_connect_size > 0) {
+      statement_catalog_->Add(query_hash, statement, params);
+    }
     return *statement_info;
   }
 }
 
+const ConnectionImpl::PreparedStatementInfo&
+ConnectionImpl::PrepareUnnamedStatement(const std::string& statement,
+                                        const QueryParameters& params,
+                                        engine::Deadline deadline,
+                                        tracing::Span& span,
+                                        tracing::ScopeTime& scope) {
+  const Connection::StatementId query_id{QueryHash(statement, params)};
+  scope.Reset(scopes::kPrepare);
+  try {
+    conn_wrapper_.SendPrepare({}, statement, params, scope);
+    conn_wrapper_.WaitResult(deadline, scope);
+    conn_wrapper_.SendDescribePrepared({}, scope);
+    auto res = conn_wrapper_.WaitResult(deadline, scope);
+    if (!res.pimpl_) {
+      throw CommandError("WaitResult() returned nullptr");
+    }
+    FillBufferCategories(res);
+    res.GetRowDescription().CheckBinaryFormat(db_types_);
+    ++stats_.parse_total;
+    // The unnamed statement itself is replaced by the next one, only its
+    // description is kept for the portal
+    prepared_.Put(query_id, {query_id, statement, {}, std::move(res)});
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+  return *prepared_.Get(query_id);
+}
+
+void ConnectionImpl::PrepareCatalogStatements(engine::Deadline deadline,
+                                              tracing::Span& span,
+                                              tracing::ScopeTime& scope) {
+  if (!statement_catalog_ || settings_.prepare_on_connect_size == 0 ||
+      settings_.prepared_statements ==
+          ConnectionSettings::kNoPreparedStatements) {
+    return;
+  }
+  const auto statements = statement_catalog_->GetStatements(std::min(
+      settings_.prepare_on_connect_size, settings_.max_prepared_cache_size));
+  if (statements.empty()) return;
+  LOG_DEBUG() << "Preparing " << statements.size()
+              << " statements of the pool on connect";
+
+  if (!IsPipelineActive()) {
+    for (const auto& statement : statements) {
+      const auto params = statement.GetParams();
+      try {
+        PrepareStatement(statement.statement, params, deadline, span, scope);
+      } catch (const ConnectionError&) {
+        throw;
+      } catch (const Error& e) {
+        // E.g. a table of the statement was dropped, the connection is fine
+        LOG_LIMITED_WARNING() << "Failed to prepare statement `"
+                              << statement.statement << "` on connect: " << e;
+        statement_catalog_->Remove(QueryHash(statement.statement, params));
+      }
+    }
+    return;
+  }
+
+  // All the statements are prepared and described in a single round trip
+  std::vector<std::string> statement_names;
+  statement_names.reserve(statements.size());
+  scope.Reset(scopes::kPrepare);
+  for (const auto& statement : statements) {
+    const auto params = statement.GetParams();
+    const auto query_hash = QueryHash(statement.statement, params);
+    statement_names.push_back("q" + std::to_string(query_hash) + "_" + uuid_);
+    conn_wrapper_.SendPrepare(statement_names.back(), statement.statement,
+                              params, scope);
+    conn_wrapper_.SendDescribePrepared(statement_names.back(), scope);
+  }
+
+  try {
+    auto results = conn_wrapper_.GatherPipeline(deadline, scope);
+    UINVARIANT(results.size() >= 2 * statements.size(),
+               "Fewer results than the statements in the pipeline");
+    const auto leading_count = results.size() - 2 * statements.size();
+    for (std::size_t i = 0; i < statements.size(); ++i) {
+      auto& description = results[leading_count + 2 * i + 1];
+      if (!description.pimpl_) {
+        throw CommandError("GatherPipeline() returned nullptr");
+      }
+      FillBufferCategories(description);
+      description.GetRowDescription().CheckBinaryFormat(db_types_);
+      const Connection::StatementId query_id{
+          QueryHash(statements[i].statement, statements[i].GetParams())};
+      prepared_.Put(query_id, {query_id, statements[i].statement,
+                               statement_names[i], std::move(description)});
+      ++stats_.parse_total;
+    }
+  } catch (const ConnectionError&) {
+    throw;
+  } catch (const Error& e) {
+    // The statements after a failed one are skipped by the server and there
+    // is no telling which one failed. Forget all of them, the hot ones are
+    // added back to the catalog as soon as they are prepared by the queries.
+    LOG_LIMITED_WARNING() << "Failed to prepare " << statements.size()
+                          << " statements on connect: " << e;
+    prepared_.Clear();
+    is_discard_prepared_pending_ = true;
+    for (const auto& statement : statements) {
+      statement_catalog_->Remove(
+          QueryHash(statement.statement, statement.GetParams()));
+    }
+  }
+}
+
 void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
   // do not try to do anything in transaction as it may already be broken
   if (is_discard_prepared_pending_ && !IsInTransaction()) {
@@ -855,18 +1218,17 @@ void ConnectionImpl::SetParameter(std::string_view name, std::string_view value,
 void ConnectionImpl::LoadUserTypes(engine::Deadline deadline) {
   UASSERT(settings_.user_types != ConnectionSettings::kPredefinedTypesOnly);
   try {
-    auto types = ExecuteCommand(kGetUserTypesSQL, deadline)
-                     .AsSetOf<DBTypeDescription>(kRowTag);
-    auto attribs = ExecuteCommand(kGetCompositeAttribsSQL, deadline)
-                       .AsContainer<UserTypes::CompositeFieldDefs>(kRowTag);
+    SharedUserTypes::Definitions definitions;
+    definitions.types =
+        ExecuteCommand(kGetUserTypesSQL, deadline)
+            .AsContainer<std::vector<DBTypeDescription>>(kRowTag);
+    definitions.attribs =
+        ExecuteCommand(kGetCompositeAttribsSQL, deadline)
+            .AsContainer<UserTypes::CompositeFieldDefs>(kRowTag);
     // End of definitions marker, to simplify processing
-    attribs.push_back(CompositeFieldDef::EmptyDef());
-    UserTypes db_types;
-    for (auto desc : types) {
-      db_types.AddType(std::move(desc));
-    }
-    db_types.AddCompositeFields(std::move(attribs));
-    db_types_ = std::move(db_types);
+    definitions.attribs.push_back(CompositeFieldDef::EmptyDef());
+    db_types_ = definitions.MakeUserTypes();
+    if (shared_user_types_) shared_user_types_->Set(std::move(definitions));
   } catch (const Error& e) {
     LOG_LIMITED_ERROR() << "Error loading user datatypes: " << e;
     // TODO Decide about rethrowing
@@ -947,6 +1309,19 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
 
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
+engine::Deadline ConnectionImpl::MakeCopyDeadline() const {
+  UASSERT(copy_);
+  return testsuite_pg_ctl_.MakeExecuteDeadline(copy_->network_timeout);
+}
+
+void ConnectionImpl::FinishCopy() {
+  const auto copy = std::exchange(copy_, std::nullopt);
+  // A broken connection may still be in the middle of the COPY
+  if (copy && copy->exited_pipeline && !IsBroken()) {
+    conn_wrapper_.EnterPipelineMode();
+  }
+}
+
 }  // namespace storages::postgres::detail
 
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/cache/lru_map.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -36,7 +37,9 @@ class ConnectionImpl {
                  const DefaultCommandControls& default_cmd_ctls,
                  const testsuite::PostgresControl& testsuite_pg_ctl,
                  const error_injection::Settings& ei_settings,
-                 engine::SemaphoreLock&& size_lock);
+                 engine::SemaphoreLock&& size_lock,
+                 StatementCatalog* statement_catalog,
+                 SharedUserTypes* shared_user_types);
 
   void AsyncConnect(const Dsn& dsn, engine::Deadline deadline);
   void Close();
@@ -69,6 +72,17 @@ class ConnectionImpl {
                            const detail::QueryParameters& params,
                            OptionalCommandControl statement_cmd_ctl);
 
+  std::vector<ResultSet> ExecuteBatch(const QueryQueue& queue,
+                                      OptionalCommandControl statement_cmd_ctl);
+
+  void StartCopy(const Query& query, bool is_copy_in,
+                 OptionalCommandControl statement_cmd_ctl);
+  void PutCopyData(std::string_view data);
+  std::size_t EndCopyIn();
+  void AbortCopyIn(const std::string& reason);
+  bool GetCopyData(std::string& buffer);
+  void CancelCopyOut();
+
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
              OptionalCommandControl trx_cmd_ctl = {});
@@ -87,6 +101,13 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  void PortalPrefetch(Connection::StatementId statement_id,
+                      const std::string& portal_name, std::uint32_t n_rows,
+                      OptionalCommandControl statement_cmd_ctl);
+
+  ResultSet PortalWaitPrefetched(Connection::StatementId statement_id,
+                                 OptionalCommandControl statement_cmd_ctl);
+
   void CancelAndCleanup(TimeoutDuration timeout);
   bool Cleanup(TimeoutDuration timeout);
 
@@ -110,6 +131,12 @@ class ConnectionImpl {
     ResultSet description{nullptr};
   };
 
+  struct CopyState {
+    TimeoutDuration network_timeout;
+    // COPY is not allowed in the pipeline mode
+    bool exited_pipeline{false};
+  };
+
   using PreparedStatements =
       cache::LruMap<Connection::StatementId, PreparedStatementInfo>;
 
@@ -136,6 +163,13 @@ class ConnectionImpl {
       const std::string& statement, const detail::QueryParameters& params,
       engine::Deadline deadline, tracing::Span& span,
       tracing::ScopeTime& scope);
+  const PreparedStatementInfo& PrepareUnnamedStatement(
+      const std::string& statement, const detail::QueryParameters& params,
+      engine::Deadline deadline, tracing::Span& span,
+      tracing::ScopeTime& scope);
+  void PrepareCatalogStatements(engine::Deadline deadline,
+                                tracing::Span& span,
+                                tracing::ScopeTime& scope);
   void DiscardOldPreparedStatements(engine::Deadline deadline);
   void DiscardPreparedStatement(const PreparedStatementInfo& info,
                                 engine::Deadline deadline);
@@ -173,10 +207,15 @@ class ConnectionImpl {
 
   void Cancel();
 
+  engine::Deadline MakeCopyDeadline() const;
+  void FinishCopy();
+
   const std::string uuid_;
   Connection::Statistics stats_;
   PGConnectionWrapper conn_wrapper_;
   PreparedStatements prepared_;
+  StatementCatalog* statement_catalog_;
+  SharedUserTypes* shared_user_types_;
   UserTypes db_types_;
   bool is_in_recovery_ = true;
   bool is_read_only_ = true;
@@ -190,6 +229,7 @@ class ConnectionImpl {
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
   const error_injection::Settings ei_settings_;
+  std::optional<CopyState> copy_;
 };
 
 }  // namespace storages::postgres::detail
@@ -552,6 +552,44 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
   return MakeResult(std::move(handle));
 }
 
+std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
+    Deadline deadline, tracing::ScopeTime& scope) {
+  UASSERT(IsPipelineActive());
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  std::vector<ResultHandle> handles;
+  auto null_res_counter{0};
+  do {
+    while (auto* pg_res = ReadResult(deadline)) {
+      null_res_counter = 0;
+      auto handle = MakeResultHandle(pg_res);
+#if LIBPQ_HAS_PIPELINING
+      const auto status = PQresultStatus(pg_res);
+      if (status == PGRES_PIPELINE_SYNC) {
+        HandlePipelineSync();
+        continue;
+      }
+      // Queries after a failed one are skipped by the server
+      if (status == PGRES_PIPELINE_ABORTED) continue;
+#endif
+      handles.push_back(std::move(handle));
+    }
+    // Same issue as with WaitResult
+    if (++null_res_counter > 2) {
+      MarkAsBroken();
+      if (handles.empty()) throw RuntimeError{"Empty result"};
+      pipeline_sync_counter_ = 0;
+    }
+  } while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD);
+
+  std::vector<ResultSet> results;
+  results.reserve(handles.size());
+  for (auto& handle : handles) {
+    results.push_back(MakeResult(std::move(handle)));
+  }
+  return results;
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
@@ -574,6 +612,118 @@ void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   } while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD);
 }
 
+void PGConnectionWrapper::StartCopy(const std::string& statement,
+                                    bool is_copy_in, Deadline deadline,
+                                    tracing::ScopeTime& scope) {
+  SendQuery(statement, scope);
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(ReadResult(deadline));
+  const auto status =
+      handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+  if (status == (is_copy_in ? PGRES_COPY_IN : PGRES_COPY_OUT)) return;
+  if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT) {
+    // There is no way to leave the COPY without completing it
+    MarkAsBroken();
+    throw LogicError{"Unexpected direction of the COPY statement"};
+  }
+
+  // An error or a statement other than COPY
+  while (auto* pg_res = ReadResult(deadline)) {
+    handle = MakeResultHandle(pg_res);
+  }
+  MakeResult(std::move(handle));
+  throw LogicError{"Not a COPY statement: " + statement};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  try {
+    int res = 0;
+    while ((res = PQputCopyData(conn_, data.data(),
+                                static_cast<int>(data.size()))) == 0) {
+      // The output buffer is full
+      Flush(deadline);
+    }
+    if (res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(PQerrorMessage(conn_));
+    }
+    Flush(deadline);
+  } catch (const std::exception&) {
+    // The connection is left in the middle of the COPY
+    MarkAsBroken();
+    throw;
+  }
+  UpdateLastUse();
+}
+
+ResultSet PGConnectionWrapper::EndCopy(const char* error_message,
+                                       Deadline deadline) {
+  try {
+    int res = 0;
+    while ((res = PQputCopyEnd(conn_, error_message)) == 0) {
+      Flush(deadline);
+    }
+    if (res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(PQerrorMessage(conn_));
+    }
+    Flush(deadline);
+  } catch (const std::exception&) {
+    MarkAsBroken();
+    throw;
+  }
+  UpdateLastUse();
+  return ReadCopyResult(deadline);
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& buffer, Deadline deadline) {
+  try {
+    while (true) {
+      char* data = nullptr;
+      const auto size = PQgetCopyData(conn_, &data, /* async = */ 1);
+      if (size > 0) {
+        buffer.append(data, size);
+        PQfreemem(data);
+        UpdateLastUse();
+        return true;
+      }
+      if (size == -1) break;
+      if (size < -1) {
+        HandleSocketPostClose();
+        throw CommandError(PQerrorMessage(conn_));
+      }
+
+      // A complete row is not received yet
+      HandleSocketPostClose();
+      if (!WaitSocketReadable(deadline)) {
+        if (engine::current_task::ShouldCancel()) {
+          throw ConnectionInterrupted("Task cancelled while reading COPY data");
+        }
+        PGCW_LOG_LIMITED_WARNING()
+            << "Timeout while reading COPY data from PostgreSQL connection";
+        throw ConnectionTimeoutError("Timed out while reading COPY data");
+      }
+      CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    }
+  } catch (const std::exception&) {
+    // The connection is left in the middle of the COPY
+    MarkAsBroken();
+    throw;
+  }
+  ReadCopyResult(deadline);
+  return false;
+}
+
+ResultSet PGConnectionWrapper::ReadCopyResult(Deadline deadline) {
+  auto handle = MakeResultHandle(nullptr);
+  while (auto* pg_res = ReadResult(deadline)) {
+    handle = MakeResultHandle(pg_res);
+  }
+  return MakeResult(std::move(handle));
+}
+
 void PGConnectionWrapper::FillSpanTags(tracing::Span& span,
                                        const CommandControl& cc) const {
   // With inheritable tags, they would end up being duplicated in current Span
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -102,10 +104,36 @@ class PGConnectionWrapper {
   void SendPortalExecute(const std::string& portal_name, std::uint32_t n_rows,
                          tracing::ScopeTime&);
 
+  /// @brief Send the queued queries to the server without waiting for the
+  /// results, adds a sync point in pipeline mode
+  void Flush(Deadline deadline);
+
   /// @brief Wait for query result
   /// Will return result or throw an exception
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&);
 
+  /// @brief Flush the pipeline and wait for the results of all the queries
+  /// sent since the previous sync, in the order they were sent
+  /// Will throw the error of the first failed query
+  std::vector<ResultSet> GatherPipeline(Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Send a COPY statement and wait for the server to start the
+  /// data transfer in the expected direction
+  void StartCopy(const std::string& statement, bool is_copy_in,
+                 Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData, waits until the data is sent
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, waits for the COPY result
+  /// Will throw the error of the COPY, including the one caused by a non-null
+  /// `error_message`
+  ResultSet EndCopy(const char* error_message, Deadline deadline);
+
+  /// @brief Wrapper for PQgetCopyData, appends the received data to the buffer
+  /// Returns false and waits for the COPY result when the data has ended
+  bool GetCopyData(std::string& buffer, Deadline deadline);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline);
   /// Consume all input discarding all result sets
@@ -146,12 +174,12 @@ class PGConnectionWrapper {
   /// @return true if wait was successful, false if was awakened by the deadline
   [[nodiscard]] bool WaitSocketReadable(Deadline deadline);
 
-  void Flush(Deadline deadline);
-
   PGresult* ReadResult(Deadline deadline);
 
   ResultSet MakeResult(ResultHandle&& handle);
 
+  ResultSet ReadCopyResult(Deadline deadline);
+
   template <typename ExceptionType>
   void CheckError(const std::string& cmd, int pg_dispatch_result);
 
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/pool.hpp>
 
+#include <algorithm>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
@@ -41,6 +43,9 @@ constexpr auto kPendingConnectsMax{1};
 // Max idle connections that can be dropped in one run of maintenance task
 constexpr auto kIdleDropLimit = 1;
 
+// Part of the used connections kept idle in reserve by an adaptive pool
+constexpr std::size_t kAdaptiveHeadroomRatio = 4;
+
 // Practically unlimited number on concurrent establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
@@ -89,12 +94,14 @@ ConnectionPool::ConnectionPool(
                                 ? settings.connecting_limit
                                 : kUnlimitedConnecting},
       wait_count_{0},
+      adaptive_size_{settings.adaptive_size},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
       ei_settings_(std::move(ei_settings)),
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio),
                     {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      statement_catalog_{conn_settings.prepare_on_connect_size},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -210,6 +217,10 @@ ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
   CheckDeadlineIsExpired(config);
   ConnectionPtr connection{Pop(deadline), std::move(shared_this)};
   ++stats_.connection.used;
+  if (adaptive_size_.load(std::memory_order_relaxed)) {
+    AccountDemand();
+    GrowAheadOfDemand();
+  }
   CheckDeadlineIsExpired(config);
 
   connection->UpdateDefaultCommandControl();
@@ -351,6 +362,7 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
   *writer = settings;
   writer->max_size = max_connections;
   writer.Commit();
+  adaptive_size_ = settings.adaptive_size;
 }
 
 void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
@@ -363,6 +375,7 @@ void ConnectionPool::SetConnectionSettings(const ConnectionSettings& settings) {
       writer->version = old_version + 1;
     }
     writer.Commit();
+    statement_catalog_.SetMaxSize(settings.prepare_on_connect_size);
   }
 }
 
@@ -407,7 +420,7 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
     connection = Connection::Connect(
         dsn_, resolver_, bg_task_processor_, close_task_storage_, conn_id,
         *conn_settings, default_cmd_ctls_, testsuite_pg_ctl_, ei_settings_,
-        std::move(size_lock));
+        std::move(size_lock), &statement_catalog_, &shared_user_types_);
   } catch (const ConnectionTimeoutError&) {
     // No problem if it's connection error
     ++stats_.connection.error_timeout;
@@ -452,16 +465,61 @@ void ConnectionPool::TryCreateConnectionAsync() {
   }
 }
 
-void ConnectionPool::CheckMinPoolSizeUnderflow() {
-  auto settings = settings_.Read();
+void ConnectionPool::CheckMinPoolSizeUnderflow(std::size_t min_size,
+                                               bool fill) {
   auto count = size_semaphore_.UsedApprox();
-  if (count < settings->min_size) {
+  if (count < min_size) {
     LOG_DEBUG() << "Current pool size is less than min_size (" << count << " < "
-                << settings->min_size << "). Create new connection.";
-    TryCreateConnectionAsync();
+                << min_size << "). Create new connection.";
+    const auto new_count = fill ? min_size - count : 1;
+    for (std::size_t i = 0; i < new_count; ++i) {
+      TryCreateConnectionAsync();
+    }
+  }
+}
+
+void ConnectionPool::AccountDemand() {
+  const std::size_t demand = stats_.connection.used.Load() +
+                             wait_count_.load(std::memory_order_relaxed);
+  auto peak = peak_demand_.load(std::memory_order_relaxed);
+  while (peak < demand && !peak_demand_.compare_exchange_weak(
+                              peak, demand, std::memory_order_relaxed)) {
+  }
+}
+
+void ConnectionPool::GrowAheadOfDemand() {
+  const std::size_t used = stats_.connection.used.Load();
+  // Connections being established are accounted by the semaphore as well
+  if (size_semaphore_.UsedApprox() > used + used / kAdaptiveHeadroomRatio) {
+    return;
+  }
+  if (connect_task_storage_.ActiveTasksApprox() >= kPendingConnectsMax) {
+    return;
+  }
+  auto conn_settings = conn_settings_.Read();
+  if (recent_conn_errors_.GetStatsForPeriod(kRecentErrorPeriod, true) >=
+      conn_settings->recent_errors_threshold) {
+    return;
+  }
+  // Unlike TryCreateConnectionAsync, never wait for a slot of an exhausted
+  // pool, there is no one waiting for this connection yet
+  engine::SemaphoreLock size_lock{size_semaphore_, std::try_to_lock};
+  if (size_lock) {
+    LOG_DEBUG() << "Few idle connections left, " << used
+                << " are used. Create new connection.";
+    connect_task_storage_.Detach(Connect(std::move(size_lock)));
   }
 }
 
+std::size_t ConnectionPool::GetAdaptiveMinSize(const PoolSettings& settings) {
+  const std::size_t peak =
+      peak_demand_.exchange(stats_.connection.used.Load());
+  // max_size may be lowered below min_size by the connlimit watchdog
+  return std::min(
+      std::max(peak + peak / kAdaptiveHeadroomRatio, settings.min_size),
+      settings.max_size);
+}
+
 void ConnectionPool::Push(Connection* connection) {
   // However unlikely, this could happen when we return connection after
   // asynchronous cleanup routine.
@@ -522,6 +580,7 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
     ++stats_.queue_size_errors;
     throw PoolError("Wait queue size exceeded");
   }
+  if (settings->adaptive_size) AccountDemand();
   // No connections found - create a new one if pool is not exhausted
   LOG_DEBUG() << "No idle connections, waiting for one for "
               << deadline.TimeLeft();
@@ -640,8 +699,15 @@ void ConnectionPool::MaintainConnections() {
   LOG_DEBUG() << "Ping connection pool " << DsnCutPassword(dsn_);
   auto stale_connection = true;
   auto count = size_semaphore_.UsedApprox();
-  auto drop_left = kIdleDropLimit;
   auto settings = settings_.Read();
+  const auto min_size = settings->adaptive_size
+                            ? GetAdaptiveMinSize(*settings)
+                            : settings->min_size;
+  // An adaptive pool drops all the idle connections above the recent demand
+  std::size_t drop_left = kIdleDropLimit;
+  if (settings->adaptive_size && count > min_size) {
+    drop_left = count - min_size;
+  }
   while (count > 0 && stale_connection) {
     try {
       auto deleter = [this](Connection* c) { DeleteConnection(c); };
@@ -653,7 +719,7 @@ void ConnectionPool::MaintainConnections() {
         break;
       }
       stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-      if (count > settings->min_size && drop_left > 0) {
+      if (count > min_size && drop_left > 0) {
         --drop_left;
         --stats_.connection.used;
         LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_)
@@ -678,7 +744,7 @@ void ConnectionPool::MaintainConnections() {
   }
 
   // Check and maintain minimum count of connections
-  CheckMinPoolSizeUnderflow();
+  CheckMinPoolSizeUnderflow(min_size, settings->adaptive_size);
 }
 
 void ConnectionPool::StartMaintainTask() {
@@ -32,6 +32,8 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/shared_user_types.hpp>
+#include <storages/postgres/detail/statement_catalog.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -103,7 +105,11 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   bool DoConnect(engine::SemaphoreLock);
 
   void TryCreateConnectionAsync();
-  void CheckMinPoolSizeUnderflow();
+  void CheckMinPoolSizeUnderflow(std::size_t min_size, bool fill);
+
+  void AccountDemand();
+  void GrowAheadOfDemand();
+  std::size_t GetAdaptiveMinSize(const PoolSettings& settings);
 
   void Push(Connection* connection);
   Connection* Pop(engine::Deadline);
@@ -145,12 +151,17 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
+  // Peak of used plus waiting connections since the last maintenance run
+  std::atomic<size_t> peak_demand_{0};
+  std::atomic<bool> adaptive_size_;
   DefaultCommandControls default_cmd_ctls_;
   testsuite::PostgresControl testsuite_pg_ctl_;
   const error_injection::Settings ei_settings_;
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementTimingsStorage sts_;
+  StatementCatalog statement_catalog_;
+  SharedUserTypes shared_user_types_;
   dynamic_config::Source config_source_;
 
   // Congestion control stuff
@@ -283,6 +283,16 @@ io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row,
                              PQgetvalue(handle_.get(), row, col))};
 }
 
+bool ResultWrapper::IsBinaryFormat(std::size_t col) const {
+  return PQfformat(handle_.get(), col) == io::kPgBinaryDataFormat;
+}
+
+const std::uint8_t* ResultWrapper::GetFieldValue(std::size_t row,
+                                                 std::size_t col) const {
+  return reinterpret_cast<const std::uint8_t*>(
+      PQgetvalue(handle_.get(), row, col));
+}
+
 std::string ResultWrapper::GetErrorMessage() const {
   auto* msg = PQresultErrorMessage(handle_.get());
   return {msg ? msg : "no error message"};
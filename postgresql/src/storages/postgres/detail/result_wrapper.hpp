@@ -50,6 +50,9 @@ class ResultWrapper {
   bool IsFieldNull(std::size_t row, std::size_t col) const;
   std::size_t GetFieldLength(std::size_t row, std::size_t col) const;
   io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
+  // Raw access for column-at-a-time reads, the caller checks the format
+  bool IsBinaryFormat(std::size_t col) const;
+  const std::uint8_t* GetFieldValue(std::size_t row, std::size_t col) const;
   //@}
 
   //@{
@@ -0,0 +1,44 @@
+#include <storages/postgres/detail/shared_user_types.hpp>
+
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Connections established before a migration keep the old types until they
+// meet an unknown type, the new ones are not any worse off for this long
+constexpr std::chrono::minutes kMaxAge{1};
+
+}  // namespace
+
+UserTypes SharedUserTypes::Definitions::MakeUserTypes() const {
+  UserTypes db_types;
+  for (auto desc : types) {
+    db_types.AddType(std::move(desc));
+  }
+  db_types.AddCompositeFields(UserTypes::CompositeFieldDefs{attribs});
+  return db_types;
+}
+
+std::shared_ptr<const SharedUserTypes::Definitions>
+SharedUserTypes::GetRecent() const {
+  const auto snapshot = snapshot_.Read();
+  if (!snapshot->definitions ||
+      std::chrono::steady_clock::now() - snapshot->loaded_at > kMaxAge) {
+    return nullptr;
+  }
+  return snapshot->definitions;
+}
+
+void SharedUserTypes::Set(Definitions definitions) {
+  snapshot_.Assign(
+      {std::make_shared<const Definitions>(std::move(definitions)),
+       std::chrono::steady_clock::now()});
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// User types loaded by a connection of a pool, the new connections of the
+/// pool reuse them for a while instead of loading them again
+class SharedUserTypes final {
+ public:
+  struct Definitions final {
+    std::vector<DBTypeDescription> types;
+    UserTypes::CompositeFieldDefs attribs;
+
+    UserTypes MakeUserTypes() const;
+  };
+
+  /// Returns the definitions if they were loaded recently enough, nullptr
+  /// otherwise
+  std::shared_ptr<const Definitions> GetRecent() const;
+
+  void Set(Definitions definitions);
+
+ private:
+  struct Snapshot final {
+    std::shared_ptr<const Definitions> definitions;
+    std::chrono::steady_clock::time_point loaded_at;
+  };
+
+  rcu::Variable<Snapshot> snapshot_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,54 @@
+#include <storages/postgres/detail/statement_catalog.hpp>
+
+#include <algorithm>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+// LruMap cannot be empty, a disabled catalog just ignores the statements
+StatementCatalog::StatementCatalog(std::size_t max_size)
+    : data_{Data{Storage{std::max(max_size, std::size_t{1})}, max_size}} {}
+
+void StatementCatalog::SetMaxSize(std::size_t max_size) {
+  auto data = data_.UniqueLock();
+  if (data->max_size == max_size) return;
+  data->max_size = max_size;
+  if (max_size == 0) {
+    data->statements.Clear();
+  } else {
+    data->statements.SetMaxSize(max_size);
+  }
+}
+
+void StatementCatalog::Add(std::size_t query_id, const std::string& statement,
+                           const QueryParameters& params) {
+  auto data = data_.UniqueLock();
+  if (data->max_size == 0) return;
+  if (data->statements.Get(query_id)) return;
+  const auto* types = params.ParamTypesBuffer();
+  data->statements.Put(
+      query_id, {statement, {types, types + (types ? params.Size() : 0)}});
+}
+
+void StatementCatalog::Remove(std::size_t query_id) {
+  auto data = data_.UniqueLock();
+  data->statements.Erase(query_id);
+}
+
+std::vector<StatementCatalog::Statement> StatementCatalog::GetStatements(
+    std::size_t limit) const {
+  std::vector<Statement> result;
+  auto data = data_.UniqueLock();
+  if (data->max_size == 0) return result;
+  result.reserve(std::min(limit, data->statements.GetSize()));
+  data->statements.VisitAll(
+      [&result, limit](const std::size_t&, const Statement& statement) {
+        if (result.size() < limit) result.push_back(statement);
+      });
+  return result;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
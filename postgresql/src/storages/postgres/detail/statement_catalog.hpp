@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Statements recently prepared by the connections of a pool, a new
+/// connection prepares them eagerly instead of on the first use
+class StatementCatalog final {
+ public:
+  struct Statement final {
+    std::string statement;
+    std::vector<Oid> param_types;
+
+    /// Parameters with the types only, enough to prepare the statement
+    QueryParameters GetParams() const { return QueryParameters{*this}; }
+
+    /// @cond
+    // The parameters holder interface for QueryParameters
+    std::size_t Size() const { return param_types.size(); }
+    const Oid* ParamTypesBuffer() const { return param_types.data(); }
+    const char* const* ParamBuffers() const { return nullptr; }
+    const int* ParamLengthsBuffer() const { return nullptr; }
+    const int* ParamFormatsBuffer() const { return nullptr; }
+    /// @endcond
+  };
+
+  /// @param max_size number of the statements to keep, 0 disables the catalog
+  explicit StatementCatalog(std::size_t max_size);
+
+  void SetMaxSize(std::size_t max_size);
+
+  void Add(std::size_t query_id, const std::string& statement,
+           const QueryParameters& params);
+  void Remove(std::size_t query_id);
+
+  /// Returns up to `limit` of the recently prepared statements
+  std::vector<Statement> GetStatements(std::size_t limit) const;
+
+ private:
+  using Storage = cache::LruMap<std::size_t, Statement>;
+
+  struct Data final {
+    Storage statements;
+    std::size_t max_size;
+  };
+
+  mutable concurrent::Variable<Data, engine::Mutex> data_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
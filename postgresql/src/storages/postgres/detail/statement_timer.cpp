@@ -14,11 +14,16 @@ StatementTimer::StatementTimer(const Query& query, const ConnectionPtr& conn)
       start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {}
 
 void StatementTimer::Account() {
-  if (sts_ == nullptr || !query_.GetName().has_value()) return;
+  if (sts_ == nullptr) return;
+
+  const auto duration = Now() - start_;
+  sts_->AccountLatency(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration));
+
+  if (!query_.GetName().has_value()) return;
 
   const auto duration_ms =
-      std::chrono::duration_cast<std::chrono::milliseconds>(Now() - start_)
-          .count();
+      std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
 
   sts_->Account(query_.GetName()->GetUnderlying(), duration_ms);
 }
@@ -1,5 +1,7 @@
 #include "statement_timings_storage.hpp"
 
+#include <algorithm>
+
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/async.hpp>
 
@@ -9,7 +11,10 @@ namespace storages::postgres::detail {
 
 namespace {
 constexpr size_t kDefaultEventsQueueSize = 1000;
-}
+
+// A new sample weighs 1/8, so a slowdown shows up after a few statements
+constexpr std::int64_t kLatencyEwmaWeightDivisor = 8;
+}  // namespace
 
 StatementTimingsStorage::StatementTimingsStorage(
     const StatementMetricsSettings& settings)
@@ -37,6 +42,23 @@ void StatementTimingsStorage::Account(const std::string& statement_name,
       std::make_unique<StatementEvent>(statement_name, duration_ms));
 }
 
+void StatementTimingsStorage::AccountLatency(
+    std::chrono::microseconds latency) const {
+  const auto sample = std::max<std::int64_t>(latency.count(), 1);
+  auto current = latency_ewma_us_.load(std::memory_order_relaxed);
+  std::int64_t updated = 0;
+  do {
+    updated = current ? current + (sample - current) / kLatencyEwmaWeightDivisor
+                      : sample;
+  } while (!latency_ewma_us_.compare_exchange_weak(current, updated,
+                                                   std::memory_order_relaxed));
+}
+
+std::chrono::microseconds StatementTimingsStorage::GetLatencyEwma() const {
+  return std::chrono::microseconds{
+      latency_ewma_us_.load(std::memory_order_relaxed)};
+}
+
 std::unordered_map<std::string, StatementTimingsStorage::Percentile>
 StatementTimingsStorage::GetTimingsPercentiles() const {
   if (!IsEnabled()) return {};
@@ -11,6 +11,9 @@
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <unordered_map>
 
 USERVER_NAMESPACE_BEGIN
@@ -29,6 +32,13 @@ class StatementTimingsStorage final {
 
   std::unordered_map<std::string, Percentile> GetTimingsPercentiles() const;
 
+  /// Accounts the latency of any statement, named or not
+  void AccountLatency(std::chrono::microseconds latency) const;
+
+  /// Exponentially weighted moving average of the latency of the statements,
+  /// zero if there were none
+  std::chrono::microseconds GetLatencyEwma() const;
+
   void SetSettings(const StatementMetricsSettings& settings);
 
   // For testing purposes, don't use directly
@@ -71,6 +81,7 @@ class StatementTimingsStorage final {
 
   rcu::Variable<StatementMetricsSettings> settings_;
   std::atomic_bool enabled_;
+  mutable std::atomic<std::int64_t> latency_ewma_us_{0};
 
   StorageData data_;
 };
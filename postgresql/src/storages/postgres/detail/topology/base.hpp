@@ -12,6 +12,7 @@
 #include <userver/error_injection/settings.hpp>
 #include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
+#include <userver/storages/postgres/lsn.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/statistics.hpp>
 #include <userver/testsuite/postgres_control.hpp>
@@ -47,6 +48,10 @@ class TopologyBase {
   /// Currently accessible hosts
   virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+  /// Last known WAL positions by DSN index: the replayed position for slaves,
+  /// the current one for the master, kUnknownLsn if not known
+  virtual rcu::ReadablePtr<std::vector<Lsn>> GetWalLsns() const = 0;
+
   // Returns statistics for each DSN in DsnList
   virtual const std::vector<decltype(InstanceStatistics::topology)>&
   GetDsnStatistics() const = 0;
@@ -162,6 +162,10 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<std::vector<Lsn>> HotStandby::GetWalLsns() const {
+  return wal_lsns_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -256,9 +260,11 @@ void HotStandby::RunDiscovery() {
   }
 
   DsnIndices alive_dsn_indices;
+  std::vector<Lsn> wal_lsns(GetDsnList().size(), kUnknownLsn);
   for (DsnIndex i = 0; i < GetDsnList().size(); ++i) {
     if (host_states_[i].role != ClusterHostType::kNone) {
       alive_dsn_indices.push_back(i);
+      wal_lsns[i] = host_states_[i].wal_lsn;
     }
   }
 
@@ -280,6 +286,7 @@ void HotStandby::RunDiscovery() {
   }
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+  wal_lsns_.Assign(std::move(wal_lsns));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
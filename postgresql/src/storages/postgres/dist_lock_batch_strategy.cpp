@@ -0,0 +1,145 @@
+#include <userver/storages/postgres/dist_lock_batch_strategy.hpp>
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/hostinfo/blocking/get_hostname.hpp>
+#include <userver/storages/postgres/cluster.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+constexpr std::string_view kMemberKeyPrefix = "dist-lock-member:";
+
+// keys - $1
+// owners - $2
+// timeouts in seconds - $3
+// member key - $4
+// member id - $5
+// member timeout in seconds - $6
+//
+// Returns (true, key) for each acquired lock and (false, member id) for each
+// live member.
+std::string MakeAcquireQuery(const std::string& table) {
+  static constexpr auto kAcquireQueryFmt = R"(
+    WITH member AS (
+      INSERT INTO {0} AS t (key, owner, expiration_time) VALUES
+      ($4, $5, current_timestamp + make_interval(secs => $6))
+      ON CONFLICT (key) DO UPDATE
+      SET owner = excluded.owner, expiration_time = excluded.expiration_time
+      RETURNING t.owner
+    ), acquired AS (
+      INSERT INTO {0} AS t (key, owner, expiration_time)
+      SELECT r.key, r.owner, current_timestamp + make_interval(secs => r.ttl)
+      FROM UNNEST($1::text[], $2::text[], $3::double precision[])
+        AS r(key, owner, ttl)
+      ON CONFLICT (key) DO UPDATE
+      SET owner = excluded.owner, expiration_time = excluded.expiration_time
+      WHERE (t.owner = excluded.owner) OR
+      (t.expiration_time <= current_timestamp) RETURNING t.key
+    )
+    SELECT TRUE, key FROM acquired
+    UNION ALL
+    SELECT FALSE, owner FROM member
+    UNION ALL
+    SELECT FALSE, owner FROM {0}
+    WHERE key LIKE '{1}%' AND key <> $4
+    AND expiration_time > current_timestamp;
+)";
+  return fmt::format(FMT_COMPILE(kAcquireQueryFmt), table, kMemberKeyPrefix);
+}
+
+// key - $1
+// owner - $2
+std::string MakeReleaseQuery(const std::string& table) {
+  static constexpr auto kReleaseQueryFmt = R"(
+    DELETE FROM {}
+    WHERE key = $1
+    AND owner = $2
+    RETURNING 1;
+)";
+  return fmt::format(FMT_COMPILE(kReleaseQueryFmt), table);
+}
+
+std::string MakeOwnerId(const std::string& prefix, const std::string& locker) {
+  return fmt::format(FMT_COMPILE("{}:{}"), prefix, locker);
+}
+
+}  // namespace
+
+DistLockBatchStrategy::DistLockBatchStrategy(
+    ClusterPtr cluster, const std::string& table,
+    const dist_lock::DistLockSettings& settings)
+    : cluster_(std::move(cluster)),
+      cc_(settings.forced_stop_margin, settings.forced_stop_margin),
+      acquire_query_(MakeAcquireQuery(table)),
+      release_query_(MakeReleaseQuery(table)),
+      owner_prefix_(hostinfo::blocking::GetRealHostName()),
+      member_key_(fmt::format(FMT_COMPILE("{}{}"), kMemberKeyPrefix,
+                              owner_prefix_)) {}
+
+void DistLockBatchStrategy::UpdateCommandControl(CommandControl cc) {
+  auto cc_ptr = cc_.StartWrite();
+  *cc_ptr = cc;
+  cc_ptr.Commit();
+}
+
+dist_lock::BatchAcquireResult DistLockBatchStrategy::AcquireBatch(
+    const std::vector<dist_lock::LeaseRequest>& requests) {
+  std::vector<std::string> keys;
+  std::vector<std::string> owners;
+  std::vector<double> timeouts_seconds;
+  std::unordered_map<std::string_view, std::size_t> indices;
+  keys.reserve(requests.size());
+  owners.reserve(requests.size());
+  timeouts_seconds.reserve(requests.size());
+  std::chrono::milliseconds member_ttl{0};
+  for (const auto& request : requests) {
+    indices.emplace(request.lock_name, keys.size());
+    keys.push_back(request.lock_name);
+    owners.push_back(MakeOwnerId(owner_prefix_, request.locker_id));
+    timeouts_seconds.push_back(request.lock_ttl.count() / 1000.0);
+    member_ttl = std::max(member_ttl, request.lock_ttl);
+  }
+
+  auto cc_ptr = cc_.Read();
+  auto result = cluster_->Execute(
+      ClusterHostType::kMaster, *cc_ptr, acquire_query_, keys, owners,
+      timeouts_seconds, member_key_, owner_prefix_,
+      member_ttl.count() / 1000.0);
+
+  dist_lock::BatchAcquireResult batch_result;
+  batch_result.acquired.resize(requests.size(), false);
+  for (const auto& row : result) {
+    auto [is_lock, value] = row.As<bool, std::string>();
+    if (!is_lock) {
+      batch_result.members.push_back(std::move(value));
+      continue;
+    }
+    const auto it = indices.find(value);
+    if (it != indices.end()) batch_result.acquired[it->second] = true;
+  }
+  return batch_result;
+}
+
+void DistLockBatchStrategy::Release(const std::string& lock_name,
+                                    const std::string& locker_id) {
+  auto cc_ptr = cc_.Read();
+  cluster_->Execute(ClusterHostType::kMaster, *cc_ptr, release_query_,
+                    lock_name, MakeOwnerId(owner_prefix_, locker_id));
+}
+
+const std::string& DistLockBatchStrategy::GetMemberId() const {
+  return owner_prefix_;
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
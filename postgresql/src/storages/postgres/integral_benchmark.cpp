@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <vector>
 
 #include <storages/postgres/detail/connection.hpp>
 
@@ -53,6 +54,26 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
   });
 }
 
+BENCHMARK_F(PgConnection, Int64ColumnAsContainer)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(
+        "select generate_series(1, 10000)::bigint");
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.AsContainer<std::vector<std::int64_t>>());
+    }
+  });
+}
+
+BENCHMARK_F(PgConnection, Int64ColumnAsColumn)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(
+        "select generate_series(1, 10000)::bigint");
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.AsColumn<std::int64_t>(0));
+    }
+  });
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,6 @@
 #pragma once
 
-#include <cstdint>
-
-#include <userver/utils/strong_typedef.hpp>
+#include <userver/storages/postgres/lsn.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,9 +10,6 @@ class LogHelper;
 
 namespace storages::postgres {
 
-using Lsn = USERVER_NAMESPACE::utils::StrongTypedef<struct LsnTag, uint64_t>;
-constexpr Lsn kUnknownLsn{0};
-
 logging::LogHelper& operator<<(logging::LogHelper& lh, Lsn lsn);
 
 }  // namespace storages::postgres
@@ -1,8 +1,12 @@
 #include <userver/storages/postgres/portal.hpp>
 
+#include <utility>
+
 #include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,6 +19,8 @@ struct Portal::Impl {
   PortalName name_;
   std::size_t fetched_so_far_{0};
   bool done_{false};
+  // Number of rows requested by a prefetch that is in flight
+  std::uint32_t prefetched_rows_{0};
 
   Impl(detail::Connection* conn, const PortalName& name, const Query& query,
        const detail::QueryParameters& params, OptionalCommandControl cmd_ctl)
@@ -27,7 +33,26 @@ struct Portal::Impl {
     }
   }
 
-  Impl(Impl&& rhs) noexcept = default;
+  Impl(Impl&& rhs) noexcept
+      : conn_{rhs.conn_},
+        cmd_ctl_{std::move(rhs.cmd_ctl_)},
+        statement_id_{rhs.statement_id_},
+        name_{std::move(rhs.name_)},
+        fetched_so_far_{rhs.fetched_so_far_},
+        done_{rhs.done_},
+        prefetched_rows_{std::exchange(rhs.prefetched_rows_, 0)} {}
+
+  ~Impl() {
+    if (!prefetched_rows_) return;
+    // Collect the result, otherwise the connection stays busy
+    try {
+      conn_->PortalWaitPrefetched(statement_id_, cmd_ctl_);
+    } catch (const std::exception& e) {
+      LOG_LIMITED_WARNING()
+          << "Failed to wait for the prefetched rows of a portal: " << e;
+    }
+  }
+
   Impl& operator=(Impl&& rhs) noexcept {
     Impl{std::move(rhs)}.Swap(*this);
     return *this;
@@ -41,6 +66,7 @@ struct Portal::Impl {
     swap(name_, rhs.name_);
     swap(fetched_so_far_, rhs.fetched_so_far_);
     swap(done_, rhs.done_);
+    swap(prefetched_rows_, rhs.prefetched_rows_);
   }
 
   void Bind(const std::string& statement,
@@ -52,8 +78,10 @@ struct Portal::Impl {
   ResultSet Fetch(std::uint32_t n_rows) {
     if (!done_) {
       UASSERT(conn_);
-      auto res = conn_->PortalExecute(statement_id_, name_.GetUnderlying(),
-                                      n_rows, cmd_ctl_);
+      auto res = prefetched_rows_ ? WaitPrefetched(n_rows)
+                                  : conn_->PortalExecute(statement_id_,
+                                                         name_.GetUnderlying(),
+                                                         n_rows, cmd_ctl_);
       auto fetched = res.Size();
       // TODO: check command completion in result TAXICOMMON-4505
       if (!n_rows || fetched != n_rows) {
@@ -66,6 +94,25 @@ struct Portal::Impl {
       throw RuntimeError{"Portal is done, no more data to fetch"};
     }
   }
+
+  ResultSet FetchWithPrefetch(std::uint32_t n_rows) {
+    UINVARIANT(n_rows, "Portal prefetch requires a limited number of rows");
+    auto res = Fetch(n_rows);
+    if (!done_) {
+      conn_->PortalPrefetch(statement_id_, name_.GetUnderlying(), n_rows,
+                            cmd_ctl_);
+      prefetched_rows_ = n_rows;
+    }
+    return res;
+  }
+
+  ResultSet WaitPrefetched(std::uint32_t n_rows) {
+    UINVARIANT(n_rows == prefetched_rows_,
+               "Portal fetch must request the same number of rows as the "
+               "prefetch");
+    prefetched_rows_ = 0;
+    return conn_->PortalWaitPrefetched(statement_id_, cmd_ctl_);
+  }
 };
 
 Portal::Portal(detail::Connection* conn, const Query& query,
@@ -85,6 +132,10 @@ Portal& Portal::operator=(Portal&&) noexcept = default;
 
 ResultSet Portal::Fetch(std::uint32_t n_rows) { return pimpl_->Fetch(n_rows); }
 
+ResultSet Portal::FetchWithPrefetch(std::uint32_t n_rows) {
+  return pimpl_->FetchWithPrefetch(n_rows);
+}
+
 bool Portal::Done() const { return pimpl_->done_; }
 std::size_t Portal::FetchedSoFar() const { return pimpl_->fetched_so_far_; }
 
@@ -76,6 +76,10 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
           ? ConnectionSettings::kDiscardAll
           : ConnectionSettings::kDiscardNone;
 
+  settings.prepare_on_connect_size =
+      config["prepare-on-connect-size"].template As<size_t>(
+          settings.prepare_on_connect_size);
+
   return settings;
 }
 
@@ -108,6 +112,8 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.adaptive_size =
+      config["adaptive_pool_size"].template As<bool>(result.adaptive_size);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
@@ -1,7 +1,12 @@
 #include <userver/storages/postgres/result_set.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string_view>
 
+#include <boost/endian/conversion.hpp>
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/result_wrapper.hpp>
@@ -33,6 +38,56 @@ constexpr std::string_view kUnknownTypeErrorMessageTemplate =
     "the type and probably altering a table was run while service up, the only "
     "way to fix this is to restart the service.";
 
+template <typename T>
+T ReadBigEndian(const std::uint8_t* data) {
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return boost::endian::big_to_native(value);
+}
+
+template <typename Float, typename Int>
+Float ReadFloatingPoint(const std::uint8_t* data) {
+  static_assert(sizeof(Float) == sizeof(Int));
+  const auto bits = ReadBigEndian<Int>(data);
+  Float value;
+  std::memcpy(&value, &bits, sizeof(Float));
+  return value;
+}
+
+TimePoint ReadTimestamp(const std::uint8_t* data) {
+  static const TimePoint pg_epoch = PostgresEpochTimePoint();
+  const auto usec = ReadBigEndian<Bigint>(data);
+  if (usec == std::numeric_limits<Bigint>::max()) {
+    return kTimestampPositiveInfinity;
+  } else if (usec == std::numeric_limits<Bigint>::min()) {
+    return kTimestampNegativeInfinity;
+  }
+  return pg_epoch + std::chrono::microseconds{usec};
+}
+
+// Gives up on nulls and unexpected sizes to let the field by field read
+// report them
+template <std::size_t Size, typename T, typename Parse>
+bool ReadFixedSizeColumnImpl(const detail::ResultWrapper& res,
+                             std::size_t field_index, io::PredefinedOids oid,
+                             std::vector<T>& column, Parse parse) {
+  if (res.GetFieldTypeOid(field_index) != static_cast<Oid>(oid) ||
+      !res.IsBinaryFormat(field_index)) {
+    return false;
+  }
+  const auto size = res.RowCount();
+  column.reserve(size);
+  for (std::size_t row = 0; row < size; ++row) {
+    if (res.IsFieldNull(row, field_index) ||
+        res.GetFieldLength(row, field_index) != Size) {
+      column.clear();
+      return false;
+    }
+    column.push_back(parse(res.GetFieldValue(row, field_index)));
+  }
+  return true;
+}
+
 }  // namespace
 
 //----------------------------------------------------------------------------
@@ -244,6 +299,57 @@ ResultSet::reference ResultSet::operator[](size_type index) const& {
   return {pimpl_, index};
 }
 
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<Smallint>& column) const {
+  return ReadFixedSizeColumnImpl<2>(*pimpl_, field_index,
+                                    io::PredefinedOids::kInt2, column,
+                                    &ReadBigEndian<Smallint>);
+}
+
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<Integer>& column) const {
+  return ReadFixedSizeColumnImpl<4>(*pimpl_, field_index,
+                                    io::PredefinedOids::kInt4, column,
+                                    &ReadBigEndian<Integer>);
+}
+
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<Bigint>& column) const {
+  return ReadFixedSizeColumnImpl<8>(*pimpl_, field_index,
+                                    io::PredefinedOids::kInt8, column,
+                                    &ReadBigEndian<Bigint>);
+}
+
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<float>& column) const {
+  return ReadFixedSizeColumnImpl<4>(*pimpl_, field_index,
+                                    io::PredefinedOids::kFloat4, column,
+                                    &ReadFloatingPoint<float, std::uint32_t>);
+}
+
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<double>& column) const {
+  return ReadFixedSizeColumnImpl<8>(*pimpl_, field_index,
+                                    io::PredefinedOids::kFloat8, column,
+                                    &ReadFloatingPoint<double, std::uint64_t>);
+}
+
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<TimePoint>& column) const {
+  return ReadFixedSizeColumnImpl<8>(*pimpl_, field_index,
+                                    io::PredefinedOids::kTimestamp, column,
+                                    &ReadTimestamp);
+}
+
+bool ResultSet::ReadFixedSizeColumn(size_type field_index,
+                                    std::vector<TimePointTz>& column) const {
+  return ReadFixedSizeColumnImpl<8>(
+      *pimpl_, field_index, io::PredefinedOids::kTimestamptz, column,
+      [](const std::uint8_t* data) {
+        return TimePointTz{ReadTimestamp(data)};
+      });
+}
+
 void ResultSet::FillBufferCategories(const UserTypes& types) {
   pimpl_->FillBufferCategories(types);
 }
@@ -7,6 +7,8 @@
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/postgres_config.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/storages/postgres/batch_writer.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
@@ -80,6 +82,66 @@ UTEST_F(PostgreCluster, PartiallyUnavailable) {
 
   CheckRwTransaction(cluster.Begin(pg::Transaction::RW));
   CheckRoTransaction(cluster.Begin(pg::Transaction::RO));
+  CheckRoTransaction(
+      cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster,
+                     pg::ClusterHostType::kLeastLoaded},
+                    pg::Transaction::RO));
+}
+
+UTEST_F(PostgreCluster, ReadYourWrites) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto dsns = GetDsnListFromEnv();
+  dsns.push_back(GetUnavailableDsn());
+
+  auto cluster = CreateCluster(dsns, GetTaskProcessor(), 1, testsuite_tasks);
+
+  auto trx = cluster.Begin(pg::Transaction::RW);
+  UEXPECT_NO_THROW(trx.Execute("SELECT 1"));
+  pg::Lsn lsn = pg::kUnknownLsn;
+  UEXPECT_NO_THROW(lsn = trx.CommitAndGetLsn());
+  EXPECT_NE(lsn, pg::kUnknownLsn);
+  UEXPECT_THROW(trx.CommitAndGetLsn(), pg::NotInTransaction);
+
+  // There are no slaves that have replayed the LSN, the master is used
+  auto ro_trx =
+      cluster.Begin(pg::ClusterHostType::kSlave, pg::Transaction::RO, lsn);
+  pg::Lsn ro_lsn = pg::kUnknownLsn;
+  UEXPECT_NO_THROW(ro_lsn = ro_trx.CommitAndGetLsn());
+  EXPECT_GE(ro_lsn, lsn);
+
+  CheckRoTransaction(
+      cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster},
+                    pg::Transaction::RO, lsn));
+}
+
+UTEST_F(PostgreCluster, BatchWriter) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+  const pg::ClusterPtr cluster_ptr{&cluster, [](pg::Cluster*) {}};
+
+  /// [BatchWriter sample]
+  pg::BatchWriter writer{cluster_ptr,
+                         "SELECT $1::integer",
+                         {/*max_batch_size=*/4, std::chrono::milliseconds{50}}};
+  std::vector<engine::TaskWithResult<int>> tasks;
+  for (int i = 0; i < 10; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(
+        [&writer, i] { return writer.Execute(i).AsSingleRow<int>(); }));
+  }
+  /// [BatchWriter sample]
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(tasks[i].Get(), i);
+  }
+
+  pg::BatchWriter failing_writer{
+      cluster_ptr, "SELECT 1 / $1::integer", {2, utest::kMaxTestWaitTime}};
+  auto failing = engine::AsyncNoSpan([&] { return failing_writer.Execute(0); });
+  auto succeeding =
+      engine::AsyncNoSpan([&] { return failing_writer.Execute(1); });
+  // The batch is rolled back as a whole
+  UEXPECT_THROW(failing.Get(), pg::DataException);
+  UEXPECT_THROW(succeeding.Get(), pg::DataException);
 }
 
 UTEST_F(PostgreCluster, ClusterSlaveRW) {
@@ -188,6 +250,9 @@ UTEST_F(PostgreCluster, ClusterSlaveRO) {
   CheckRoTransaction(cluster.Begin(
       {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest},
       pg::Transaction::RO));
+  CheckRoTransaction(cluster.Begin(
+      {pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RO));
 
   UEXPECT_THROW(cluster.Begin({pg::ClusterHostType::kSlave,
                                pg::ClusterHostType::kRoundRobin,
@@ -230,6 +295,10 @@ UTEST_F(PostgreCluster, ClusterAnyRO) {
       cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster,
                      pg::ClusterHostType::kNearest},
                     pg::Transaction::RO));
+  CheckRoTransaction(
+      cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster,
+                     pg::ClusterHostType::kLeastLoaded},
+                    pg::Transaction::RO));
 
   UEXPECT_THROW(
       cluster.Begin(
@@ -417,6 +417,29 @@ UTEST_F(PostgreCustomConnection, NoPreparedStatements) {
       kConnectionId, kNoPreparedStatements, GetTestCmdCtls(), {}, {}));
 }
 
+UTEST_F(PostgreCustomConnection, NoPreparedStatementsPortal) {
+  std::unique_ptr<pg::detail::Connection> conn;
+  UASSERT_NO_THROW(conn = pg::detail::Connection::Connect(
+                       GetDsnFromEnv(), nullptr, GetTaskProcessor(),
+                       GetTaskStorage(), kConnectionId, kNoPreparedStatements,
+                       GetTestCmdCtls(), {}, {}));
+  ASSERT_TRUE(conn);
+
+  UEXPECT_NO_THROW(conn->Begin({}, pg::detail::SteadyClock::now()));
+  pg::detail::Connection::StatementId stmt_id;
+  UEXPECT_NO_THROW(stmt_id = conn->PortalBind(
+                       "select generate_series(1, 10)", "", {}, {}));
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = conn->PortalExecute(stmt_id, "", 4, {}));
+  EXPECT_EQ(res.Size(), 4);
+  // The portal outlives the unnamed statement it was bound from
+  UEXPECT_NO_THROW(conn->Execute("select 1"));
+  UEXPECT_NO_THROW(res = conn->PortalExecute(stmt_id, "", 10, {}));
+  ASSERT_EQ(res.Size(), 6);
+  EXPECT_EQ(res.Front().As<int>(), 5);
+  UEXPECT_NO_THROW(conn->Commit());
+}
+
 UTEST_F(PostgreCustomConnection, NoUserTypes) {
   std::unique_ptr<pg::detail::Connection> conn;
   UASSERT_NO_THROW(conn = pg::detail::Connection::Connect(
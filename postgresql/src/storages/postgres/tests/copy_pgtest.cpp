@@ -0,0 +1,113 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr int kRowsCount = 100000;
+
+void CreateTable(pg::Transaction& trx) {
+  trx.Execute(
+      "CREATE TEMPORARY TABLE copy_test (id integer, name text) "
+      "ON COMMIT DROP");
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInOut) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+  CreateTable(trx);
+
+  /// [CopyIn sample]
+  auto copy_in =
+      trx.CopyIn("COPY copy_test (id, name) FROM STDIN (FORMAT binary)");
+  for (int i = 0; i < kRowsCount; ++i) {
+    const auto name = i % 10 ? std::optional{std::to_string(i)} : std::nullopt;
+    copy_in.Write(i, name);
+  }
+  const auto copied = copy_in.Finish();
+  /// [CopyIn sample]
+  EXPECT_EQ(copied, kRowsCount);
+
+  auto res = trx.Execute("SELECT count(*), count(name) FROM copy_test");
+  EXPECT_EQ(res.Front()[0].As<pg::Bigint>(), kRowsCount);
+  EXPECT_EQ(res.Front()[1].As<pg::Bigint>(), kRowsCount - kRowsCount / 10);
+
+  /// [CopyOut sample]
+  auto copy_out = trx.CopyOut(
+      "COPY (SELECT id, name FROM copy_test ORDER BY id) TO STDOUT "
+      "(FORMAT binary)");
+  int id = 0;
+  std::optional<std::string> name;
+  std::vector<std::pair<int, std::optional<std::string>>> rows;
+  while (copy_out.Read(id, name)) {
+    rows.emplace_back(id, name);
+  }
+  /// [CopyOut sample]
+  EXPECT_EQ(copy_out.GetRowsRead(), kRowsCount);
+  ASSERT_EQ(rows.size(), kRowsCount);
+  for (int i = 0; i < kRowsCount; ++i) {
+    EXPECT_EQ(rows[i].first, i);
+    EXPECT_EQ(rows[i].second.has_value(), i % 10 != 0);
+  }
+
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, CopyInAbort) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+  CreateTable(trx);
+
+  {
+    auto copy_in =
+        trx.CopyIn("COPY copy_test (id, name) FROM STDIN (FORMAT binary)");
+    copy_in.Write(1, std::string{"one"});
+  }
+  UEXPECT_THROW(trx.Execute("SELECT 1"), pg::Error);
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyOutCancel) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+
+  {
+    auto copy_out = trx.CopyOut(
+        "COPY (SELECT generate_series(1, 1000000)) TO STDOUT (FORMAT binary)");
+    int value = 0;
+    ASSERT_TRUE(copy_out.Read(value));
+    EXPECT_EQ(value, 1);
+  }
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+  CreateTable(trx);
+
+  trx.Execute("INSERT INTO copy_test VALUES (1, 'one')");
+
+  UEXPECT_THROW(trx.CopyIn("SELECT 1"), pg::LogicError);
+  {
+    auto copy_out = trx.CopyOut("COPY copy_test TO STDOUT (FORMAT binary)");
+    int id = 0;
+    UEXPECT_THROW(copy_out.Read(id), pg::FieldTupleMismatch);
+  }
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+USERVER_NAMESPACE_END
@@ -328,6 +328,34 @@ UTEST_P(PostgrePool, SetConnectionSettings) {
   CheckConnection(std::move(conn));
 }
 
+UTEST_P(PostgrePool, PrepareOnConnect) {
+  for (auto conn_settings : {kCachePreparedStatements, kPipelineEnabled}) {
+    conn_settings.prepare_on_connect_size = 10;
+    auto pool = pg::detail::ConnectionPool::Create(
+        GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(),
+        {1, 1, 10}, conn_settings, {}, GetTestCmdCtls(), {}, {}, {},
+        dynamic_config::GetDefaultSource());
+    {
+      auto conn = pool->Acquire(MakeDeadline());
+      UEXPECT_NO_THROW(conn->Execute("select $1::integer", 1));
+    }
+    const auto parse_total = pool->GetStatistics().transaction.parse_total;
+
+    // force pool to recreate connection by assigning new settings
+    ++conn_settings.max_prepared_cache_size;
+    pool->SetConnectionSettings(conn_settings);
+
+    pg::detail::ConnectionPtr conn(nullptr);
+    UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+    EXPECT_EQ(conn->GetSettings().max_prepared_cache_size,
+              conn_settings.max_prepared_cache_size);
+    // The statement was prepared by the new connection on connect
+    UEXPECT_NO_THROW(conn->Execute("select $1::integer", 2));
+    conn = pg::detail::ConnectionPtr{nullptr};
+    EXPECT_EQ(pool->GetStatistics().transaction.parse_total, parse_total);
+  }
+}
+
 UTEST_P(PostgrePool, DefaultCmdCtl) {
   using Source = pg::detail::DefaultCommandControlSource;
   const pg::CommandControl custom_cmd_ctl{std::chrono::seconds{2},
@@ -383,6 +411,33 @@ UTEST_P(PostgrePool, CheckUserTypes) {
       pg::UserTypeError);
 }
 
+UTEST_P(PostgrePool, AdaptiveSizeGrowsAhead) {
+  pg::PoolSettings settings{1, 10, 10};
+  settings.adaptive_size = true;
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), settings,
+      kCachePreparedStatements, {}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+
+  constexpr std::size_t kUsed = 4;
+  std::vector<pg::detail::ConnectionPtr> connections;
+  for (std::size_t i = 0; i < kUsed; ++i) {
+    UASSERT_NO_THROW(connections.push_back(pool->Acquire(MakeDeadline())));
+  }
+
+  // An idle connection is established before anyone waits for it
+  const auto deadline = MakeDeadline();
+  while (pool->GetStatistics().connection.active <= kUsed &&
+         !deadline.IsReached()) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_GT(pool->GetStatistics().connection.active, kUsed);
+  EXPECT_EQ(pool->GetStatistics().connection.used, kUsed);
+  EXPECT_EQ(pool->GetStatistics().pool_exhaust_errors, 0);
+
+  for (auto& conn : connections) CheckConnection(std::move(conn));
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     PoolTests, PostgrePool,
     ::testing::Values(pg::InitMode::kAsync, pg::InitMode::kSync),
@@ -289,6 +289,64 @@ UTEST_P(PostgreConnection, PortalParallel) {
   EXPECT_EQ(second.FetchedSoFar(), kIterations);
 }
 
+UTEST_P(PostgreConnection, PortalFetchWithPrefetch) {
+  constexpr int kRowsCount = 1000;
+  constexpr std::uint32_t kChunkSize = 100;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  auto portal = trx.MakePortal("SELECT generate_series(1, $1)", kRowsCount);
+  int expected = 1;
+  while (portal) {
+    auto result = portal.FetchWithPrefetch(kChunkSize);
+    for (const auto& row : result) {
+      EXPECT_EQ(row[0].As<int>(), expected++);
+    }
+  }
+  EXPECT_EQ(expected, kRowsCount + 1);
+  EXPECT_EQ(portal.FetchedSoFar(), kRowsCount);
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, PortalAsSetOf) {
+  constexpr int kRowsCount = 1000;
+
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  /// [Portal AsSetOf sample]
+  auto portal = trx.MakePortal("SELECT generate_series(1, $1)", kRowsCount);
+  int sum = 0;
+  for (const int value : portal.AsSetOf<int>(/*chunk_rows*/ 128)) {
+    sum += value;
+  }
+  /// [Portal AsSetOf sample]
+  EXPECT_EQ(sum, kRowsCount * (kRowsCount + 1) / 2);
+  EXPECT_TRUE(portal.Done());
+
+  auto empty = trx.MakePortal("SELECT 1 WHERE false");
+  for ([[maybe_unused]] const int value : empty.AsSetOf<int>(10)) {
+    ADD_FAILURE() << "Unexpected row";
+  }
+
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, PortalPrefetchDestroyed) {
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  {
+    auto portal = trx.MakePortal("SELECT generate_series(1, 100)");
+    auto result = portal.FetchWithPrefetch(10);
+    EXPECT_EQ(result.Size(), 10);
+  }
+  // The prefetched rows are discarded and the connection is usable
+  EXPECT_EQ(trx.Execute("SELECT 1").AsSingleRow<int>(), 1);
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
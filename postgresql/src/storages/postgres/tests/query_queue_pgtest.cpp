@@ -0,0 +1,64 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <string>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+UTEST_P(PostgreConnection, QueryQueue) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+
+  /// [QueryQueue sample]
+  pg::QueryQueue queue;
+  queue.Push("SELECT $1::integer", 1);
+  queue.Push("SELECT $1::text", std::string{"two"});
+  queue.Push("SELECT 3");
+
+  const auto results = trx.ExecuteBatch(queue);
+  /// [QueryQueue sample]
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0].AsSingleRow<int>(), 1);
+  EXPECT_EQ(results[1].AsSingleRow<std::string>(), "two");
+  EXPECT_EQ(results[2].AsSingleRow<int>(), 3);
+
+  // The statements are prepared by now, and are executed again from the cache
+  const auto results_again = trx.ExecuteBatch(queue);
+  ASSERT_EQ(results_again.size(), 3);
+  EXPECT_EQ(results_again[1].AsSingleRow<std::string>(), "two");
+
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, QueryQueueEmpty) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+
+  EXPECT_TRUE(trx.ExecuteBatch(pg::QueryQueue{}).empty());
+  UEXPECT_NO_THROW(trx.Commit());
+}
+
+UTEST_P(PostgreConnection, QueryQueueError) {
+  CheckConnection(GetConn());
+  pg::Transaction trx(std::move(GetConn()), pg::TransactionOptions{});
+
+  pg::QueryQueue queue;
+  queue.Push("SELECT 1");
+  queue.Push("SELECT 1 / $1::integer", 0);
+  queue.Push("SELECT 3");
+
+  UEXPECT_THROW(trx.ExecuteBatch(queue), pg::DataException);
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <optional>
+#include <string_view>
+
+#include <userver/storages/postgres/io/chrono.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -117,4 +121,56 @@ UTEST_P(PostgreConnection, ResultTraverseBackward) {
   EXPECT_EQ(5, num);
 }
 
+UTEST_P(PostgreConnection, ResultAsColumn) {
+  CheckConnection(GetConn());
+
+  const auto res = GetConn()->Execute(
+      "select i::smallint, i, i::bigint, i::real, i::float8, "
+      "'2000-01-01'::timestamp + i * interval '1 second', "
+      "'2000-01-01 00:00+00'::timestamptz + i * interval '1 second', i::text "
+      "from generate_series(1, 100) i");
+  ASSERT_EQ(res.Size(), 100);
+
+  const auto smallints = res.AsColumn<pg::Smallint>(0);
+  const auto integers = res.AsColumn<pg::Integer>(1);
+  const auto bigints = res.AsColumn<pg::Bigint>(2);
+  const auto floats = res.AsColumn<float>(3);
+  const auto doubles = res.AsColumn<double>(4);
+  const auto timestamps = res.AsColumn<pg::TimePoint>(5);
+  const auto timestamps_tz = res.AsColumn<pg::TimePointTz>(6);
+  const auto texts = res.AsColumn<std::string_view>(7);
+  // Falls back to the field by field read for a wider C++ type
+  const auto widened = res.AsColumn<pg::Bigint>(0);
+
+  for (int i = 1; i <= 100; ++i) {
+    const auto index = i - 1;
+    EXPECT_EQ(smallints[index], i);
+    EXPECT_EQ(integers[index], i);
+    EXPECT_EQ(bigints[index], i);
+    EXPECT_EQ(floats[index], i);
+    EXPECT_EQ(doubles[index], i);
+    EXPECT_EQ(timestamps[index],
+              pg::PostgresEpochTimePoint() + std::chrono::seconds{i});
+    EXPECT_EQ(timestamps_tz[index].GetUnderlying(), timestamps[index]);
+    EXPECT_EQ(texts[index], std::to_string(i));
+    EXPECT_EQ(widened[index], i);
+  }
+
+  UEXPECT_THROW(res.AsColumn<int>(8), pg::FieldIndexOutOfBounds);
+}
+
+UTEST_P(PostgreConnection, ResultAsColumnNulls) {
+  CheckConnection(GetConn());
+
+  const auto res =
+      GetConn()->Execute("select * from (values (1), (null), (3)) as data");
+
+  UEXPECT_THROW(res.AsColumn<int>(0), pg::FieldValueIsNull);
+  const auto column = res.AsColumn<std::optional<int>>(0);
+  ASSERT_EQ(column.size(), 3);
+  EXPECT_EQ(column[0], 1);
+  EXPECT_EQ(column[1], std::nullopt);
+  EXPECT_EQ(column[2], 3);
+}
+
 USERVER_NAMESPACE_END
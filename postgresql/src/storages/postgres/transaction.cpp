@@ -3,6 +3,7 @@
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/statement_timer.hpp>
+#include <storages/postgres/io/pg_type_parsers.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 
 #include <userver/logging/log.hpp>
@@ -12,6 +13,21 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+namespace {
+
+// The inserted position of the master includes the commit record even when
+// the WAL is not flushed yet
+const std::string kCurrentLsnStatement =
+    "SELECT CASE WHEN pg_is_in_recovery() THEN pg_last_wal_replay_lsn() "
+    "ELSE pg_current_wal_insert_lsn() END";
+// Versions for 9.4-9.x servers
+const std::string kCurrentLsnStatementPre10 =
+    "SELECT CASE WHEN pg_is_in_recovery() THEN "
+    "pg_last_xlog_replay_location() ELSE pg_current_xlog_insert_location() "
+    "END";
+
+}  // namespace
+
 Transaction::Transaction(detail::ConnectionPtr&& conn,
                          const TransactionOptions& options,
                          OptionalCommandControl trx_cmd_ctl,
@@ -46,6 +62,21 @@ ResultSet Transaction::Execute(OptionalCommandControl statement_cmd_ctl,
                    statement_cmd_ctl);
 }
 
+std::vector<ResultSet> Transaction::ExecuteBatch(
+    OptionalCommandControl statement_cmd_ctl, const QueryQueue& queue) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Execute batch called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  if (queue.IsEmpty()) return {};
+
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+  return conn_->ExecuteBatch(queue, std::move(statement_cmd_ctl));
+}
+
 Portal Transaction::MakePortal(OptionalCommandControl statement_cmd_ctl,
                                const Query& query,
                                const ParameterStore& store) {
@@ -95,6 +126,28 @@ Portal Transaction::MakePortal(const PortalName& portal_name,
                 std::move(statement_cmd_ctl)};
 }
 
+CopyInStream Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl,
+                                 const Query& query) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Copy in called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  conn_->StartCopyIn(query, std::move(statement_cmd_ctl));
+  return CopyInStream{conn_.get(), conn_->GetUserTypes()};
+}
+
+CopyOutStream Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl,
+                                   const Query& query) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Copy out called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  conn_->StartCopyOut(query, std::move(statement_cmd_ctl));
+  return CopyOutStream{conn_.get()};
+}
+
 void Transaction::SetParameter(const std::string& param_name,
                                const std::string& value) {
   if (!conn_) {
@@ -119,6 +172,22 @@ void Transaction::Commit() {
   }
 }
 
+Lsn Transaction::CommitAndGetLsn() {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Commit after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  conn_->Commit();
+  // The transaction is committed, so the connection is released even if
+  // the LSN is not received
+  auto conn = std::move(conn_);
+  const auto res = conn->Execute(conn->GetServerVersion() >= 100000
+                                     ? kCurrentLsnStatement
+                                     : kCurrentLsnStatementPre10);
+  return res.AsSingleRow<Lsn>();
+}
+
 void Transaction::Rollback() {
   auto conn = std::move(conn_);
   if (conn) {
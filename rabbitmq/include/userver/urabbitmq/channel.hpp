@@ -4,6 +4,8 @@
 /// @brief Publisher interface for the broker.
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -77,6 +79,30 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @brief Publishes the messages in order and waits for the broker to
+  /// confirm all of them.
+  ///
+  /// Unlike PublishReliable for each message, doesn't wait for a confirm
+  /// before publishing the next message: up to `max_in_flight_requests`
+  /// messages are awaiting the confirms at once, and the broker confirms them
+  /// in batches. Throws on the first message that is not confirmed, the
+  /// messages published before it might be delivered.
+  ///
+  /// @snippet rabbitmq/src/tests/publish_consume_rmqtest.cpp Sample PublishReliableBatch usage
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type, engine::Deadline deadline);
+
+  /// @overload
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            engine::Deadline deadline) {
+    PublishReliableBatch(exchange, routing_key, messages,
+                         MessageType::kTransient, deadline);
+  }
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
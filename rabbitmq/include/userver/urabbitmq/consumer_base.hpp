@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <userver/urabbitmq/consumer_settings.hpp>
 
@@ -16,6 +17,10 @@ namespace urabbitmq {
 class Client;
 class ConsumerBaseImpl;
 
+namespace statistics {
+class ConsumerStatistics;
+}
+
 /// @ingroup userver_base_classes
 ///
 /// @brief Base class for your consumers.
@@ -56,6 +61,12 @@ class ConsumerBase {
   /// otherwise it's UB.
   void Stop();
 
+  /// @brief Writes the statistics of the consumer: the amount of processed
+  /// and failed messages, the current prefetch_count and the processing lag
+  /// percentiles (the time from the delivery of a message to the end of its
+  /// processing, in milliseconds).
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
  protected:
   /// @brief Override this method in derived class and implement
   /// message handling logic.
@@ -74,6 +85,8 @@ class ConsumerBase {
   std::shared_ptr<Client> client_;
   const ConsumerSettings settings_;
 
+  std::unique_ptr<statistics::ConsumerStatistics> stats_;
+
   std::unique_ptr<ConsumerBaseImpl> impl_;
   utils::PeriodicTask monitor_{};
 };
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -38,6 +39,12 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// max_prefetch_count | upper limit for the prefetch_count autotuning, 0 (default) disables the autotuning
+/// ack_batch_size   | amount of processed messages to ack at once (`multiple=true`), 1 by default
+/// ack_batch_interval | max time a processed message waits for the batched ack, 100ms by default
+///
+/// The statistics of the consumer are written as `rabbitmq_consumer.<component name>`,
+/// see urabbitmq::ConsumerBase::WriteStatistics.
 ///
 // clang-format on
 class ConsumerComponentBase : public components::LoggableComponentBase {
@@ -70,6 +77,8 @@ class ConsumerComponentBase : public components::LoggableComponentBase {
   // This is actually just a subclass of `ConsumerBase`
   class Impl;
   std::unique_ptr<Impl> impl_;
+
+  utils::statistics::Entry statistics_holder_;
 };
 
 }  // namespace urabbitmq
@@ -3,7 +3,9 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -24,6 +26,22 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// Upper limit for the prefetch_count autotuning. If greater than
+  /// `prefetch_count`, the prefetch is adjusted within
+  /// [`prefetch_count`, `max_prefetch_count`]: raised while all the prefetched
+  /// messages are being processed and the processing latency doesn't grow,
+  /// lowered when the processing latency grows.
+  std::uint16_t max_prefetch_count{0};
+
+  /// If greater than 1, the processed messages are acked in batches
+  /// (`multiple=true`) once this many messages are ready to be acked or
+  /// `ack_batch_interval` passes, whichever comes first. Only the messages
+  /// delivered before any message still being processed can be acked.
+  std::uint16_t ack_batch_size{1};
+
+  /// Max time a processed message waits for the batched ack
+  std::chrono::milliseconds ack_batch_interval{100};
 };
 
 }  // namespace urabbitmq
@@ -1,6 +1,9 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/uuid4.hpp>
@@ -150,6 +153,95 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, PublishReliableBatchWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  const size_t messages_count = 1000;
+  std::vector<std::string> messages;
+  messages.reserve(messages_count);
+  for (size_t i = 0; i < messages_count; ++i) {
+    messages.push_back(std::to_string(i));
+  }
+
+  /// [Sample PublishReliableBatch usage]
+  auto channel = client->GetReliableChannel(client.GetDeadline());
+  channel.PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               messages, urabbitmq::MessageType::kTransient,
+                               client.GetDeadline());
+  /// [Sample PublishReliableBatch usage]
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  ASSERT_EQ(consumed.size(), messages_count);
+  std::sort(consumed.begin(), consumed.end());
+  std::sort(messages.begin(), messages.end());
+  EXPECT_EQ(consumed, messages);
+}
+
+UTEST(Consumer, BatchedAcksWork) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+  settings.max_prefetch_count = 50;
+  settings.ack_batch_size = 7;
+
+  // Not a multiple of ack_batch_size, the tail is acked by the interval flush
+  const size_t messages_count = 1000;
+  for (size_t i = 0; i < messages_count; ++i) {
+    auto channel = client->GetReliableChannel(client.GetDeadline());
+    channel.PublishReliable(
+        client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+        urabbitmq::MessageType::kTransient, client.GetDeadline());
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+  EXPECT_EQ(consumer.Wait().size(), messages_count);
+  engine::InterruptibleSleepFor(settings.ack_batch_interval * 2);
+  consumer.Stop();
+
+  // Everything is acked, nothing is redelivered
+  Consumer other_consumer{client.Get(), settings};
+  other_consumer.Start();
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+  EXPECT_TRUE(other_consumer.Get().empty());
+}
+
+UTEST(Consumer, MixedSizeMessagesWork) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  // The large messages span many frames and exceed the largest socket read,
+  // the small ones share the reads with the tails of the large ones
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < 20; ++i) {
+    const size_t size = i % 2 ? (size_t{3} << 20) + i : i + 1;
+    messages.emplace_back(size, static_cast<char>('a' + i));
+  }
+  for (const auto& message : messages) {
+    client->PublishReliable(client.GetExchange(), client.GetRoutingKey(),
+                            message, urabbitmq::MessageType::kTransient,
+                            client.GetDeadline());
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages.size());
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  ASSERT_EQ(consumed.size(), messages.size());
+  std::sort(consumed.begin(), consumed.end());
+  std::sort(messages.begin(), messages.end());
+  EXPECT_TRUE(consumed == messages);
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
@@ -1,6 +1,12 @@
 #include <userver/urabbitmq/channel.hpp>
 
+#include <algorithm>
+#include <deque>
+
+#include <userver/tracing/span.hpp>
+
 #include <urabbitmq/connection_helper.hpp>
+#include <urabbitmq/connection.hpp>
 #include <urabbitmq/connection_ptr.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -44,6 +50,42 @@ void ReliableChannel::PublishReliable(const Exchange& exchange,
       .Wait(deadline);
 }
 
+void ReliableChannel::PublishReliableBatch(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::vector<std::string>& messages, MessageType type,
+    engine::Deadline deadline) {
+  const tracing::Span span{"reliable_publish_batch"};
+
+  auto& reliable = (*impl_)->GetReliableChannel();
+  const auto max_in_flight = std::max<std::size_t>(
+      (*impl_)->GetMaxInFlightRequests(), 1);
+
+  std::deque<impl::ResponseAwaiter> in_flight;
+  try {
+    for (const auto& message : messages) {
+      if (in_flight.size() == max_in_flight) {
+        in_flight.front().Wait(deadline);
+        in_flight.pop_front();
+      }
+      in_flight.push_back(
+          reliable.Publish(exchange, routing_key, message, type, deadline));
+    }
+
+    for (auto& awaiter : in_flight) {
+      awaiter.Wait(deadline);
+    }
+  } catch (const std::exception&) {
+    // The confirms of the rest of the messages don't matter anymore
+    for (auto& awaiter : in_flight) {
+      try {
+        awaiter.Wait(engine::Deadline::Passed());
+      } catch (const std::exception&) {
+      }
+    }
+    throw;
+  }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
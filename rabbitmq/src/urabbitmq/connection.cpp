@@ -25,6 +25,10 @@ impl::AmqpReliableChannel& Connection::GetReliableChannel() {
 
 bool Connection::IsBroken() const { return handler_.IsBroken(); }
 
+std::size_t Connection::GetMaxInFlightRequests() const {
+  return connection_.GetMaxInFlightRequests();
+}
+
 void Connection::EnsureUsable() const {
   if (IsBroken()) {
     throw std::runtime_error{"Connection is broken"};
@@ -35,6 +35,8 @@ class Connection final {
 
   bool IsBroken() const;
 
+  std::size_t GetMaxInFlightRequests() const;
+
   void EnsureUsable() const;
 
  private:
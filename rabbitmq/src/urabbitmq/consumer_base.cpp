@@ -6,6 +6,7 @@
 
 #include <urabbitmq/client_impl.hpp>
 #include <urabbitmq/consumer_base_impl.hpp>
+#include <urabbitmq/statistics/consumer_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,11 +20,11 @@ constexpr std::chrono::seconds kMonitorInterval{1};
 template <typename OnMessage>
 std::unique_ptr<ConsumerBaseImpl> CreateAndStartConsumerImpl(
     ClientImpl& client_impl, const ConsumerSettings& settings,
-    OnMessage&& on_message) {
+    statistics::ConsumerStatistics& stats, OnMessage&& on_message) {
   auto impl = std::make_unique<ConsumerBaseImpl>(
       client_impl.GetConnection(
           engine::Deadline::FromDuration(kConnectionAcquisitionTimeout)),
-      settings);
+      settings, stats);
   impl->Start(std::forward<OnMessage>(on_message));
 
   return impl;
@@ -33,7 +34,10 @@ std::unique_ptr<ConsumerBaseImpl> CreateAndStartConsumerImpl(
 
 ConsumerBase::ConsumerBase(std::shared_ptr<Client> client,
                            const ConsumerSettings& settings)
-    : client_{std::move(client)}, settings_{settings}, impl_{nullptr} {
+    : client_{std::move(client)},
+      settings_{settings},
+      stats_{std::make_unique<statistics::ConsumerStatistics>()},
+      impl_{nullptr} {
   UASSERT(client_);
 }
 
@@ -50,7 +54,7 @@ void ConsumerBase::Start() {
 
   try {
     impl_ = CreateAndStartConsumerImpl(
-        *client_->impl_, settings_,
+        *client_->impl_, settings_, *stats_,
         [this](std::string message) { Process(std::move(message)); });
   } catch (const std::exception& ex) {
     LOG_WARNING() << "Failed to start a consumer: '" << ex.what()
@@ -71,7 +75,7 @@ void ConsumerBase::Start() {
             // that is, but still
             impl_.reset();
             impl_ = CreateAndStartConsumerImpl(
-                *client_->impl_, settings_,
+                *client_->impl_, settings_, *stats_,
                 [this](std::string message) { Process(std::move(message)); });
             LOG_INFO() << "Restarted successfully";
           } catch (const std::exception& ex) {
@@ -87,6 +91,10 @@ void ConsumerBase::Stop() {
   impl_.reset();
 }
 
+void ConsumerBase::WriteStatistics(utils::statistics::Writer& writer) const {
+  writer = *stats_;
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <string>
 
 #include <fmt/format.h>
@@ -12,6 +14,7 @@
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/impl/amqp_channel.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
+#include <urabbitmq/statistics/consumer_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,13 +24,25 @@ namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
 
+constexpr std::chrono::milliseconds kPrefetchTuneInterval{1000};
+constexpr std::chrono::milliseconds kSetQosTimeout{1000};
+// The baseline processing lag follows the growing lag this slowly
+constexpr std::int64_t kBaselineLagDecay{16};
+
 }  // namespace
 
 ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
-                                   const ConsumerSettings& settings)
+                                   const ConsumerSettings& settings,
+                                   statistics::ConsumerStatistics& stats)
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      min_prefetch_count_{settings.prefetch_count},
+      max_prefetch_count_{
+          std::max(settings.prefetch_count, settings.max_prefetch_count)},
+      ack_batch_size_{std::max<std::size_t>(settings.ack_batch_size, 1)},
+      ack_batch_interval_{settings.ack_batch_interval},
+      stats_{stats},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
   // We take ownership of the connection, because if it remains pooled
@@ -40,6 +55,7 @@ ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
 void ConsumerBaseImpl::Start(DispatchCallback cb) {
   const auto start_deadline = engine::Deadline::FromDuration(kStartTimeout);
   channel_.SetQos(prefetch_count_, start_deadline);
+  stats_.SetPrefetchCount(prefetch_count_);
 
   dispatch_callback_ = std::move(cb);
 
@@ -65,6 +81,16 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
       },
       start_deadline);
 
+  if (ack_batch_size_ > 1) {
+    ack_flusher_.Start(fmt::format("{}_consumer_ack_flusher", queue_name_),
+                       {ack_batch_interval_}, [this] { FlushAcks(); });
+  }
+  if (max_prefetch_count_ > min_prefetch_count_) {
+    prefetch_tuner_.Start(
+        fmt::format("{}_consumer_prefetch_tuner", queue_name_),
+        {kPrefetchTuneInterval}, [this] { TunePrefetch(); });
+  }
+
   LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
 }
 
@@ -79,6 +105,13 @@ void ConsumerBaseImpl::Stop() {
   // Cancel all the active dispatched tasks
   bts_.CancelAndWait();
 
+  prefetch_tuner_.Stop();
+  ack_flusher_.Stop();
+  if (ack_batch_size_ > 1) {
+    // The messages not acked are requeued by RabbitMQ anyway
+    FlushAcks();
+  }
+
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
   // didn't receive onSuccess callback yet.
@@ -98,10 +131,17 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
   std::string trace_id = message.headers().get("u-trace-id");
   std::string message_data{message.body(), message.bodySize()};
 
+  const auto in_flight = ++in_flight_;
+  auto peak_in_flight = peak_in_flight_.load();
+  while (peak_in_flight < in_flight &&
+         !peak_in_flight_.compare_exchange_weak(peak_in_flight, in_flight)) {
+  }
+
   bts_.Detach(engine::AsyncNoSpan(
       dispatcher_, [this, message = std::move(message_data),
                     span_name = std::move(span_name),
-                    trace_id = std::move(trace_id), delivery_tag]() mutable {
+                    trace_id = std::move(trace_id), delivery_tag,
+                    delivered_at = std::chrono::steady_clock::now()]() mutable {
         auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id, {});
 
         bool success = false;
@@ -113,8 +153,22 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
                       << "; would requeue";
         }
 
+        const auto lag = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - delivered_at);
+        stats_.AccountMessageProcessed(
+            std::chrono::duration_cast<std::chrono::milliseconds>(lag),
+            success);
+        ++window_processed_;
+        window_lag_us_ += lag.count();
+        --in_flight_;
+
         try {
-          if (success) {
+          if (ack_batch_size_ > 1) {
+            OnProcessed(delivery_tag, success);
+            if (success) {
+              channel_.AccountMessageConsumed();
+            }
+          } else if (success) {
             channel_.Ack(delivery_tag, {});
             channel_.AccountMessageConsumed();
           } else {
@@ -128,6 +182,99 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::OnProcessed(uint64_t delivery_tag, bool success) {
+  // RabbitMQ numbers the deliveries on a channel consecutively starting from
+  // 1, and the channel is used by this consumer only. So a multiple ack of a
+  // tag is safe once all the messages delivered before it are processed,
+  // and the rejected ones are rejected before they are covered by the ack.
+  const std::lock_guard lock{ack_mutex_};
+  UASSERT(delivery_tag >= next_delivery_tag_);
+
+  processed_.emplace(delivery_tag, success);
+  if (!success) {
+    channel_.Reject(delivery_tag, true, {});
+  }
+
+  while (!processed_.empty() &&
+         processed_.begin()->first == next_delivery_tag_) {
+    if (processed_.begin()->second) {
+      last_ackable_tag_ = next_delivery_tag_;
+      ++pending_acks_;
+    }
+    processed_.erase(processed_.begin());
+    ++next_delivery_tag_;
+  }
+
+  if (pending_acks_ >= ack_batch_size_) {
+    DoFlushAcks();
+  }
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  try {
+    const std::lock_guard lock{ack_mutex_};
+    DoFlushAcks();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to ack the messages, they will be requeued by "
+                     "RabbitMQ at some point: "
+                  << ex.what();
+  }
+}
+
+void ConsumerBaseImpl::DoFlushAcks() {
+  if (pending_acks_ == 0) {
+    return;
+  }
+
+  pending_acks_ = 0;
+  channel_.AckMultiple(last_ackable_tag_, {});
+}
+
+void ConsumerBaseImpl::TunePrefetch() {
+  const auto processed = window_processed_.exchange(0);
+  const auto lag_sum = window_lag_us_.exchange(0);
+  const auto peak_in_flight = peak_in_flight_.exchange(in_flight_.load());
+  if (processed == 0) {
+    return;
+  }
+
+  const std::chrono::microseconds lag{lag_sum / processed};
+  if (baseline_lag_.count() == 0 || lag < baseline_lag_) {
+    baseline_lag_ = lag;
+  } else {
+    baseline_lag_ += (lag - baseline_lag_) / kBaselineLagDecay;
+  }
+
+  auto prefetch_count = prefetch_count_;
+  if (lag > baseline_lag_ * 2) {
+    // The processing slows down with more messages in flight, back off
+    prefetch_count = std::max<uint16_t>(min_prefetch_count_,
+                                        prefetch_count_ * 3 / 4);
+  } else if (peak_in_flight >= prefetch_count_) {
+    // All the prefetched messages are being processed and the latency holds,
+    // so we are likely bound by the round trips to the broker
+    prefetch_count = static_cast<uint16_t>(
+        std::min<std::size_t>(max_prefetch_count_, prefetch_count_ * 2));
+  }
+
+  if (prefetch_count == prefetch_count_) {
+    return;
+  }
+
+  try {
+    channel_.SetQos(prefetch_count,
+                    engine::Deadline::FromDuration(kSetQosTimeout));
+    LOG_INFO() << "Changed prefetch_count of the consumer for '" << queue_name_
+               << "' queue from " << prefetch_count_ << " to "
+               << prefetch_count;
+    prefetch_count_ = prefetch_count;
+    stats_.SetPrefetchCount(prefetch_count_);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to change prefetch_count of the consumer: "
+                  << ex.what();
+  }
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <map>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
 
@@ -19,10 +23,14 @@ namespace impl {
 class AmqpChannel;
 }
 
+namespace statistics {
+class ConsumerStatistics;
+}
+
 class ConsumerBaseImpl final {
  public:
-  ConsumerBaseImpl(ConnectionPtr&& connection,
-                   const ConsumerSettings& settings);
+  ConsumerBaseImpl(ConnectionPtr&& connection, const ConsumerSettings& settings,
+                   statistics::ConsumerStatistics& stats);
   ~ConsumerBaseImpl();
 
   using DispatchCallback = std::function<void(std::string message)>;
@@ -33,11 +41,21 @@ class ConsumerBaseImpl final {
 
  private:
   void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  void OnProcessed(uint64_t delivery_tag, bool success);
+  void FlushAcks();
+  void DoFlushAcks();
+  void TunePrefetch();
   void Stop();
 
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
   uint16_t prefetch_count_;
+  const uint16_t min_prefetch_count_;
+  const uint16_t max_prefetch_count_;
+  const std::size_t ack_batch_size_;
+  const std::chrono::milliseconds ack_batch_interval_;
+
+  statistics::ConsumerStatistics& stats_;
 
   ConnectionPtr connection_ptr_;
   impl::AmqpChannel& channel_;
@@ -52,6 +70,25 @@ class ConsumerBaseImpl final {
   // (consumer_base polls this and destructs+constructs us if we broke)
   std::atomic<bool> broken_{false};
 
+  // Batched acks state, see OnProcessed
+  engine::Mutex ack_mutex_;
+  // Processed messages delivered after the first not processed one, with
+  // the processing result
+  std::map<uint64_t, bool> processed_;
+  uint64_t next_delivery_tag_{1};
+  uint64_t last_ackable_tag_{0};
+  std::size_t pending_acks_{0};
+
+  // Prefetch autotuning state, gathered between the TunePrefetch calls
+  std::atomic<std::size_t> in_flight_{0};
+  std::atomic<std::size_t> peak_in_flight_{0};
+  std::atomic<std::uint64_t> window_processed_{0};
+  std::atomic<std::uint64_t> window_lag_us_{0};
+  std::chrono::microseconds baseline_lag_{0};
+
+  utils::PeriodicTask ack_flusher_;
+  utils::PeriodicTask prefetch_tuner_;
+
   // This should be the last member
   concurrent::BackgroundTaskStorageCore bts_;
 };
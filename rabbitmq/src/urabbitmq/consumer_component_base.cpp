@@ -2,6 +2,7 @@
 
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/urabbitmq/component.hpp>
@@ -17,6 +18,14 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config,
   settings.queue = Queue{config["queue"].As<std::string>()};
   settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
 
+  settings.max_prefetch_count =
+      config["max_prefetch_count"].As<uint16_t>(settings.max_prefetch_count);
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<uint16_t>(settings.ack_batch_size);
+  settings.ack_batch_interval =
+      config["ack_batch_interval"].As<std::chrono::milliseconds>(
+          settings.ack_batch_interval);
+
   UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
 
   return settings;
@@ -53,9 +62,19 @@ ConsumerComponentBase::ConsumerComponentBase(
               .FindComponent<components::RabbitMQ>(
                   config["rabbit_name"].As<std::string>())
               .GetClient(),
-          config.As<ConsumerSettings>())} {}
+          config.As<ConsumerSettings>())} {
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>();
+  statistics_holder_ = statistics_storage.GetStorage().RegisterWriter(
+      "rabbitmq_consumer." + config.Name(),
+      [this](utils::statistics::Writer& writer) {
+        impl_->WriteStatistics(writer);
+      });
+}
 
-ConsumerComponentBase::~ConsumerComponentBase() = default;
+ConsumerComponentBase::~ConsumerComponentBase() {
+  statistics_holder_.Unregister();
+}
 
 void ConsumerComponentBase::OnAllComponentsLoaded() { impl_->Start(this); }
 
@@ -76,6 +95,18 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    max_prefetch_count:
+        type: integer
+        description: upper limit for the prefetch_count autotuning
+        defaultDescription: 0 (no autotuning)
+    ack_batch_size:
+        type: integer
+        description: amount of processed messages to ack at once
+        defaultDescription: 1
+    ack_batch_interval:
+        type: string
+        description: max time a processed message waits for the batched ack
+        defaultDescription: 100ms
 )");
 }
 
@@ -94,6 +94,10 @@ ResponseAwaiter AmqpConnection::GetAwaiter(engine::Deadline deadline) {
   return ResponseAwaiter{std::move(lock)};
 }
 
+std::size_t AmqpConnection::GetMaxInFlightRequests() const {
+  return waiters_sema_.GetCapacity();
+}
+
 ConnectionLock AmqpConnection::Lock(engine::Deadline deadline) {
   return {mutex_, deadline};
 }
@@ -1,6 +1,8 @@
 #include "socket_reader.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <utility>
 
 #include <userver/engine/io/common.hpp>
 #include <userver/logging/log.hpp>
@@ -32,36 +34,46 @@ void SocketReader::Start(AmqpConnection* connection) {
 
 void SocketReader::Stop() { reader_task_.SyncCancel(); }
 
-SocketReader::Buffer::Buffer() { data_.resize(kTmpBufferSize); }
+SocketReader::Buffer::Buffer() { data_.resize(kMinReadSize); }
 
 bool SocketReader::Buffer::Read(engine::io::RwBase& socket,
                                 AmqpConnection* conn,
                                 AmqpConnectionHandler& parent) {
   try {
     bool is_readable = true;
-    if (last_bytes_read_ != kTmpBufferSize) {
+    if (!last_read_filled_) {
       is_readable = socket.WaitReadable({});
     }
 
-    last_bytes_read_ =
-        is_readable ? socket.ReadSome(&tmp_buffer_[0], kTmpBufferSize, {}) : 0;
-    if (last_bytes_read_ == 0) {
+    const auto read_size = read_size_;
+    Reserve(read_size);
+    const auto bytes_read =
+        is_readable ? socket.ReadSome(data_.data() + end_, read_size, {}) : 0;
+    if (bytes_read == 0) {
       throw std::runtime_error{"Connection is closed by remote"};
     }
+    end_ += bytes_read;
+    last_read_filled_ = bytes_read == read_size;
+    AdjustReadSize(bytes_read);
 
-    data_.resize(size_ + last_bytes_read_);
-    std::memcpy(data_.data() + size_, &tmp_buffer_[0], last_bytes_read_);
-    size_ += last_bytes_read_;
-
-    const auto parsed = [this, conn] {
+    const auto [parsed, expected] = [this, conn] {
       auto lock = AmqpConnectionLocker{*conn}.Lock({});
-      return conn->GetNative().parse(data_.data(), size_);
+      auto& native = conn->GetNative();
+      const auto parsed_bytes =
+          native.parse(data_.data() + begin_, end_ - begin_);
+      return std::make_pair(parsed_bytes, native.expected());
     }();
     if (parsed != 0) {
-      std::memmove(data_.data(), data_.data() + parsed, size_ - parsed);
-      size_ -= parsed;
+      begin_ += parsed;
       parent.AccountRead(parsed);
     }
+    if (begin_ == end_) {
+      begin_ = end_ = 0;
+    } else if (expected > end_ - begin_) {
+      // Read the rest of a large frame in place instead of growing the buffer
+      // chunk by chunk
+      Reserve(expected - (end_ - begin_));
+    }
 
     return true;
   } catch (const std::exception& ex) {
@@ -80,6 +92,31 @@ bool SocketReader::Buffer::Read(engine::io::RwBase& socket,
   }
 }
 
+void SocketReader::Buffer::Reserve(size_t size) {
+  if (data_.size() - end_ >= size) {
+    return;
+  }
+
+  const auto unparsed = end_ - begin_;
+  if (begin_ != 0) {
+    std::memmove(data_.data(), data_.data() + begin_, unparsed);
+    begin_ = 0;
+    end_ = unparsed;
+  }
+  if (data_.size() < unparsed + size) {
+    data_.resize(std::max(unparsed + size, data_.size() * 2));
+  }
+}
+
+void SocketReader::Buffer::AdjustReadSize(size_t bytes_read) {
+  if (bytes_read == read_size_) {
+    // There is more data in the socket, read it in fewer syscalls
+    read_size_ = std::min(read_size_ * 2, kMaxReadSize);
+  } else if (bytes_read < read_size_ / 4) {
+    read_size_ = std::max(read_size_ / 2, kMinReadSize);
+  }
+}
+
 }  // namespace urabbitmq::impl::io
 
 USERVER_NAMESPACE_END
@@ -37,13 +37,21 @@ class SocketReader final {
               AmqpConnectionHandler& parent);
 
    private:
-    static constexpr size_t kTmpBufferSize = 1 << 15;
-    char tmp_buffer_[kTmpBufferSize]{};
+    // Makes room for at least `size` bytes after the unparsed data
+    void Reserve(size_t size);
+    void AdjustReadSize(size_t bytes_read);
 
+    static constexpr size_t kMinReadSize = 1 << 15;
+    static constexpr size_t kMaxReadSize = 1 << 20;
+
+    // The socket is read right into the buffer, the unparsed data is
+    // data_[begin_, end_)
     std::vector<char> data_{};
-    size_t size_{0};
+    size_t begin_{0};
+    size_t end_{0};
 
-    size_t last_bytes_read_{0};
+    size_t read_size_{kMinReadSize};
+    bool last_read_filled_{false};
   };
 
   AmqpConnectionHandler& parent_;
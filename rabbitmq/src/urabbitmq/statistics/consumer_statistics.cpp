@@ -0,0 +1,31 @@
+#include "consumer_statistics.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+void ConsumerStatistics::AccountMessageProcessed(std::chrono::milliseconds lag,
+                                                 bool success) {
+  if (success) {
+    ++processed_;
+  } else {
+    ++failed_;
+  }
+  processing_lag_.GetCurrentCounter().Account(lag.count());
+}
+
+void ConsumerStatistics::SetPrefetchCount(std::uint16_t prefetch_count) {
+  prefetch_count_.store(prefetch_count);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConsumerStatistics& stats) {
+  writer["messages_processed"] = stats.processed_.Load();
+  writer["messages_failed"] = stats.failed_.Load();
+  writer["prefetch_count"] = stats.prefetch_count_.load();
+  writer["processing_lag"] = stats.processing_lag_;
+}
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+class ConsumerStatistics final {
+ public:
+  // Lag is the time from the delivery of a message to the end of its
+  // processing
+  void AccountMessageProcessed(std::chrono::milliseconds lag, bool success);
+
+  void SetPrefetchCount(std::uint16_t prefetch_count);
+
+  using Percentile =
+      utils::statistics::Percentile<2048, std::uint64_t, 16, 256>;
+  using RecentPeriod =
+      utils::statistics::RecentPeriod<Percentile, Percentile>;
+
+ private:
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ConsumerStatistics& stats);
+
+  utils::statistics::RelaxedCounter<std::uint64_t> processed_{0};
+  utils::statistics::RelaxedCounter<std::uint64_t> failed_{0};
+  std::atomic<std::uint16_t> prefetch_count_{0};
+  RecentPeriod processing_lag_{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConsumerStatistics& stats);
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <hiredis/hiredis.h>
+
+#include <storages/redis/impl/reply_reader.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// An MGET-like reply of state.range(0) bulk strings of state.range(1) bytes
+std::string MakeArrayReply(benchmark::State& state) {
+  const auto value = std::string(state.range(1), 'x');
+  std::string data = "*" + std::to_string(state.range(0)) + "\r\n";
+  for (auto i = 0; i < state.range(0); ++i) {
+    data += "$" + std::to_string(value.size()) + "\r\n" + value + "\r\n";
+  }
+  return data;
+}
+
+}  // namespace
+
+void RedisReplyFromRedisReply(benchmark::State& state) {
+  const auto data = MakeArrayReply(state);
+  auto* reader = redisReaderCreate();
+  for ([[maybe_unused]] auto _ : state) {
+    redisReaderFeed(reader, data.data(), data.size());
+    void* reply = nullptr;
+    redisReaderGetReply(reader, &reply);
+    redis::ReplyData reply_data{static_cast<const redisReply*>(reply)};
+    freeReplyObject(reply);
+    benchmark::DoNotOptimize(reply_data);
+  }
+  redisReaderFree(reader);
+}
+BENCHMARK(RedisReplyFromRedisReply)
+    ->Args({100, 16})
+    ->Args({100, 256})
+    ->Args({1000, 16})
+    ->Args({1000, 256});
+
+void RedisReplyDataReader(benchmark::State& state) {
+  const auto data = MakeArrayReply(state);
+  auto* reader = redisReaderCreate();
+  redis::impl::SetReplyDataReader(*reader);
+  for ([[maybe_unused]] auto _ : state) {
+    redisReaderFeed(reader, data.data(), data.size());
+    void* reply = nullptr;
+    redisReaderGetReply(reader, &reply);
+    auto reply_data =
+        redis::impl::TakeReplyData(static_cast<redisReply*>(reply));
+    reader->fn->freeObject(reply);
+    benchmark::DoNotOptimize(reply_data);
+  }
+  redisReaderFree(reader);
+}
+BENCHMARK(RedisReplyDataReader)
+    ->Args({100, 16})
+    ->Args({100, 256})
+    ->Args({1000, 16})
+    ->Args({1000, 256});
+
+USERVER_NAMESPACE_END
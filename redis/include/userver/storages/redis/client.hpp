@@ -36,6 +36,11 @@ inline constexpr RetryNilFromMaster kRetryNilFromMaster{};
 ///
 /// Usually retrieved from components::Redis component.
 ///
+/// The DEL, EXISTS, MGET, MSET and UNLINK commands for the keys of several
+/// shards (or hash slots in the cluster mode) are split into concurrent
+/// per-shard requests, and their replies are merged in the order of the keys.
+/// Such an MSET is not atomic.
+///
 /// ## Example usage:
 ///
 /// @snippet storages/redis/client_redistest.cpp  Sample Redis Client usage
@@ -96,6 +101,18 @@ class Client {
       std::string script, size_t shard,
       const CommandControl& command_control) = 0;
 
+  /// @brief Registers the script to be loaded by all the connections to the
+  /// servers, including the ones to the replicas and the future ones
+  ///
+  /// The connections load the script before sending the other commands, so
+  /// EvalSha() with the returned hash does not get NOSCRIPT after reconnects
+  /// and failovers unless the script cache of the server is flushed. The
+  /// timings of EvalSha() of the registered scripts are reported in the
+  /// `script_timings` metrics with the `redis_script` label.
+  ///
+  /// @returns SHA1 of the script for EvalSha()
+  virtual std::string RegisterScript(std::string script) = 0;
+
   template <typename ScriptInfo, typename ReplyType = std::decay_t<ScriptInfo>>
   RequestEval<std::decay_t<ScriptInfo>, ReplyType> Eval(
       const ScriptInfo& script_info, std::vector<std::string> keys,
@@ -360,6 +377,34 @@ class Client {
   virtual RequestType Type(std::string key,
                            const CommandControl& command_control) = 0;
 
+  virtual RequestXack Xack(std::string key, std::string group,
+                           std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  /// Adds an entry with an id generated by the server
+  virtual RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) = 0;
+
+  virtual RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) = 0;
+
+  virtual RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const XgroupCreateOptions& options,
+      const CommandControl& command_control) = 0;
+
+  /// Reads the entries of a single stream. There is no BLOCK option, as a
+  /// blocking command would stall all the requests sharing the connection
+  virtual RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer, std::string id,
+      const XreadgroupOptions& options,
+      const CommandControl& command_control) = 0;
+
   virtual RequestZadd Zadd(std::string key, double score, std::string member,
                            const CommandControl& command_control) = 0;
 
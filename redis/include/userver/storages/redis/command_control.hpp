@@ -83,6 +83,11 @@ struct CommandControl {
 
     /// Send requests to 'best_dc_count' Redis instances with the min ping
     kNearestServerPing,
+
+    /// Send read-only requests to the less loaded of two random instances.
+    /// The load is the moving average of the request latency of an instance
+    /// multiplied by the number of its running requests.
+    kPowerOfTwoChoices,
   };
 
   /// Timeout for a single attempt to execute command
@@ -103,6 +108,11 @@ struct CommandControl {
   /// Server latency limit
   std::chrono::milliseconds max_ping_latency = std::chrono::milliseconds(0);
 
+  /// Read-only requests are not sent to the instances with that many requests
+  /// waiting for the replies, 0 for no limit. A stalled replica stops getting
+  /// the reads once the limit is reached.
+  std::size_t max_running_commands = 0;
+
   /// Force execution on master node
   bool force_request_to_master = false;
 
@@ -127,6 +137,12 @@ struct CommandControl {
   /// If set, command retries are directed to the master instance
   bool force_retries_to_master_on_nil_reply = false;
 
+  /// If set, GET and HGET are served from the in-process cache of the values
+  /// tracked by the server. Requires `client_side_cache_size` in the static
+  /// config of the components::Redis group, ignored otherwise. The values
+  /// may lag behind the writes by the delivery time of invalidation messages.
+  bool client_side_cache = false;
+
   CommandControl() = default;
   CommandControl(std::chrono::milliseconds timeout_single,
                  std::chrono::milliseconds timeout_all, std::size_t max_retries,
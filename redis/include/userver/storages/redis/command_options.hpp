@@ -22,6 +22,9 @@ using RangeOptions = USERVER_NAMESPACE::redis::RangeOptions;
 using GeoaddArg = USERVER_NAMESPACE::redis::GeoaddArg;
 using GeoradiusOptions = USERVER_NAMESPACE::redis::GeoradiusOptions;
 using GeosearchOptions = USERVER_NAMESPACE::redis::GeosearchOptions;
+using XautoclaimOptions = USERVER_NAMESPACE::redis::XautoclaimOptions;
+using XgroupCreateOptions = USERVER_NAMESPACE::redis::XgroupCreateOptions;
+using XreadgroupOptions = USERVER_NAMESPACE::redis::XreadgroupOptions;
 using ZaddOptions = USERVER_NAMESPACE::redis::ZaddOptions;
 
 class ScanOptionsBase {
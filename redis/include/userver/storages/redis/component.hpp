@@ -62,6 +62,8 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].client_side_cache_size | max number of keys in the cache of GET and HGET replies for requests with redis::CommandControl::client_side_cache; the connections enable `CLIENT TRACKING ON REDIRECT` to an extra connection per server, requires Redis 6+ and is not supported with TLS; 0 disables the cache | 0
+/// groups.[].connections_per_instance | number of connections to each master and replica in the Sentinel mode, the commands are balanced among them by the number of the running commands, see also `max_in_flight_commands` of @ref REDIS_COMMANDS_BUFFERING_SETTINGS | 1
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -117,11 +117,30 @@ struct CommandsBufferingSettings {
   bool buffering_enabled{false};
   size_t commands_buffering_threshold{0};
   std::chrono::microseconds watch_command_timer_interval{0};
+  /// Commands are buffered only while the replies to the sent commands are
+  /// pending, for at most a fraction of the ping latency
+  bool adaptive{false};
+  /// Zero means no limit on the size of the buffered commands
+  size_t commands_buffering_bytes_threshold{0};
+  /// Max number of the commands waiting to be sent over a connection, zero
+  /// means no limit. Applies with the buffering disabled too. The commands
+  /// over the limit go to the other connections or wait in the queue of the
+  /// shard group until `timeout_all`
+  size_t max_queued_commands{0};
+  /// Max number of the commands sent over a connection and waiting for the
+  /// replies, zero means no limit. The rest wait in the queue of the
+  /// connection without the `timeout_single` running
+  size_t max_in_flight_commands{0};
 
   constexpr bool operator==(const CommandsBufferingSettings& o) const {
     return buffering_enabled == o.buffering_enabled &&
            commands_buffering_threshold == o.commands_buffering_threshold &&
-           watch_command_timer_interval == o.watch_command_timer_interval;
+           watch_command_timer_interval == o.watch_command_timer_interval &&
+           adaptive == o.adaptive &&
+           commands_buffering_bytes_threshold ==
+               o.commands_buffering_bytes_threshold &&
+           max_queued_commands == o.max_queued_commands &&
+           max_in_flight_commands == o.max_in_flight_commands;
   }
 };
 
@@ -92,6 +92,23 @@ struct RangeScoreOptions {
   RangeOptions range_options;
 };
 
+struct XgroupCreateOptions {
+  /// Create the stream if it does not exist
+  bool mkstream = false;
+};
+
+struct XreadgroupOptions {
+  /// Maximum number of entries to read, 0 for no limit
+  size_t count = 0;
+  /// Do not add the entries to the pending entries list
+  bool noack = false;
+};
+
+struct XautoclaimOptions {
+  /// Maximum number of entries to claim, 0 for the server default of 100
+  size_t count = 0;
+};
+
 void PutArg(CmdArgs::CmdArgsArray& args_, GeoaddArg arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, std::vector<GeoaddArg> arg);
@@ -112,6 +129,12 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeOptions& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XgroupCreateOptions& arg);
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg);
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XautoclaimOptions& arg);
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,229 @@
+#pragma once
+
+/// @file userver/storages/redis/lru_cache_component_base.hpp
+/// @brief @copybrief storages::redis::LruCacheComponent
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <userver/cache/lru_cache_component_base.hpp>
+#include <userver/cache/lru_cache_statistics.hpp>
+#include <userver/components/component_fwd.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace impl {
+
+struct RedisCacheEntry final {
+  formats::json::Value value;
+  /// Time of the value computation, for the probabilistic early expiration
+  std::chrono::milliseconds delta{0};
+  std::chrono::system_clock::time_point expiry;
+};
+
+struct RedisCacheSettings final {
+  explicit RedisCacheSettings(const components::ComponentConfig& config);
+
+  std::string key_prefix;
+  std::chrono::milliseconds lifetime;
+  double xfetch_beta;
+  CommandControl command_control;
+};
+
+ClientPtr FindRedisClient(const components::ComponentConfig& config,
+                          const components::ComponentContext& context);
+
+utils::statistics::Entry RegisterRedisTierStatistics(
+    const components::ComponentContext& context, const std::string& name,
+    const cache::impl::ExpirableLruCacheStatistics& statistics);
+
+std::string SerializeRedisCacheEntry(const RedisCacheEntry& entry);
+
+/// @returns std::nullopt if the data is not a valid entry
+std::optional<RedisCacheEntry> ParseRedisCacheEntry(std::string_view data);
+
+/// The XFetch algorithm: recomputes the value before its expiry with the
+/// probability growing as the expiry approaches, and the sooner the longer the
+/// value takes to compute, so that the concurrent recomputations are unlikely
+bool ShouldRecomputeEarly(const RedisCacheEntry& entry, double beta);
+
+const std::string& GetRedisLruCacheComponentSchema();
+
+}  // namespace impl
+
+// clang-format off
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Base class for the LRU-cache components with the second tier of
+/// cache in Redis
+///
+/// The values missing from the in-process cache::LruCacheComponent are looked
+/// up in Redis, and on a miss there are computed by
+/// LruCacheComponent::DoGetFromSource and stored in Redis with the
+/// `redis-lifetime` TTL. The computations of the same key in the process are
+/// serialized by cache::ExpirableLruCache, and the computations among the
+/// processes are avoided by the probabilistic early expiration
+/// (XFetch) of the values in Redis.
+///
+/// The values are serialized with formats::json, so `Value` has to support
+/// `Serialize(const Value&, formats::serialize::To<formats::json::Value>)` and
+/// `Parse(const formats::json::Value&, formats::parse::To<Value>)`. The errors
+/// of Redis are logged and the value is computed from the source.
+///
+/// Both tiers report `hits`, `misses` and `hit_ratio` in the `cache` metrics
+/// with the `cache_name` label. The metrics of the Redis tier are marked with
+/// `cache_tier=redis` and count the early expirations as both `misses` and
+/// `stale`.
+///
+/// ## Static options:
+/// Options of cache::LruCacheComponent and:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// redis-component | name of the components::Redis | redis
+/// redis-db | name of the Redis database | --
+/// redis-key-prefix | prefix of the Redis keys | the component name and ':'
+/// redis-lifetime | TTL of the values in Redis | --
+/// redis-timeout | timeout of a single Redis request | 100ms
+/// xfetch-beta | XFetch coefficient, greater values recompute earlier, 0 disables the early expiration | 1.0
+// clang-format on
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class LruCacheComponent
+    : public cache::LruCacheComponent<Key, Value, Hash, Equal> {
+ public:
+  LruCacheComponent(const components::ComponentConfig& config,
+                    const components::ComponentContext& context);
+
+  ~LruCacheComponent() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Computes the value missing from both tiers
+  virtual Value DoGetFromSource(const Key& key) = 0;
+
+  /// Returns the Redis key without the prefix, the key itself for string keys
+  /// and its decimal representation for arithmetic keys
+  virtual std::string DoGetRedisKey(const Key& key);
+
+ private:
+  Value DoGetByKey(const Key& key) final;
+
+  std::optional<Value> GetFromRedis(const std::string& redis_key);
+
+  const impl::RedisCacheSettings settings_;
+  const ClientPtr client_;
+  cache::impl::ExpirableLruCacheStatistics redis_statistics_;
+  utils::statistics::Entry redis_statistics_holder_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : cache::LruCacheComponent<Key, Value, Hash, Equal>(config, context),
+      settings_(config),
+      client_(impl::FindRedisClient(config, context)) {
+  redis_statistics_holder_ = impl::RegisterRedisTierStatistics(
+      context, components::GetCurrentComponentName(config), redis_statistics_);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+LruCacheComponent<Key, Value, Hash, Equal>::~LruCacheComponent() {
+  redis_statistics_holder_.Unregister();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+yaml_config::Schema
+LruCacheComponent<Key, Value, Hash, Equal>::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<
+      cache::LruCacheComponent<Key, Value, Hash, Equal>>(
+      impl::GetRedisLruCacheComponentSchema());
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::string LruCacheComponent<Key, Value, Hash, Equal>::DoGetRedisKey(
+    const Key& key) {
+  if constexpr (std::is_convertible_v<const Key&, std::string>) {
+    return key;
+  } else if constexpr (std::is_arithmetic_v<Key>) {
+    return std::to_string(key);
+  } else {
+    throw std::logic_error(
+        "DoGetRedisKey must be overridden for the keys that are neither "
+        "strings nor numbers");
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value LruCacheComponent<Key, Value, Hash, Equal>::DoGetByKey(const Key& key) {
+  const auto redis_key = settings_.key_prefix + DoGetRedisKey(key);
+  if (auto value = GetFromRedis(redis_key)) return std::move(*value);
+
+  const auto start = std::chrono::steady_clock::now();
+  auto value = DoGetFromSource(key);
+
+  impl::RedisCacheEntry entry;
+  entry.value = formats::json::ValueBuilder(value).ExtractValue();
+  entry.delta = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  entry.expiry = std::chrono::system_clock::now() + settings_.lifetime;
+  try {
+    // Not waited for, the value is already known
+    client_
+        ->Set(redis_key, impl::SerializeRedisCacheEntry(entry),
+              settings_.lifetime, settings_.command_control)
+        .IgnoreResult();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to store '" << redis_key
+                          << "' in redis: " << e;
+  }
+  return value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::optional<Value> LruCacheComponent<Key, Value, Hash, Equal>::GetFromRedis(
+    const std::string& redis_key) {
+  try {
+    const auto data =
+        client_->Get(redis_key, settings_.command_control).Get();
+    auto entry = data ? impl::ParseRedisCacheEntry(*data) : std::nullopt;
+    if (!entry) {
+      cache::impl::CacheMiss(redis_statistics_);
+      return std::nullopt;
+    }
+    if (impl::ShouldRecomputeEarly(*entry, settings_.xfetch_beta)) {
+      cache::impl::CacheStale(redis_statistics_);
+      cache::impl::CacheMiss(redis_statistics_);
+      return std::nullopt;
+    }
+    auto value = entry->value.template As<Value>();
+    cache::impl::CacheHit(redis_statistics_);
+    return value;
+  } catch (const std::exception& e) {
+    cache::impl::CacheMiss(redis_statistics_);
+    LOG_LIMITED_WARNING() << "Failed to get '" << redis_key
+                          << "' from redis: " << e;
+    return std::nullopt;
+  }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
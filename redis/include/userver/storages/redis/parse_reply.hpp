@@ -71,6 +71,10 @@ std::vector<GeoPoint> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<GeoPoint>>);
 
+std::vector<StreamEntry> ParseReplyDataArray(
+    ReplyData&& array_data, const std::string& request_description,
+    To<std::vector<StreamEntry>>);
+
 std::string Parse(ReplyData&& reply_data,
                   const std::string& request_description, To<std::string>);
 
@@ -122,6 +126,18 @@ std::unordered_map<std::string, std::string> Parse(
 ReplyData Parse(ReplyData&& reply_data, const std::string& request_description,
                 To<ReplyData>);
 
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>);
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>);
+
+std::vector<StreamEntry> Parse(ReplyData&& reply_data,
+                               const std::string& request_description,
+                               To<XreadgroupReply, std::vector<StreamEntry>>);
+
 template <typename Result, typename ReplyType = Result>
 std::enable_if_t<impl::HasParseFunctionFromRedisReply<Result, ReplyType>::value,
                  ReplyType>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -109,6 +110,36 @@ enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
 
+struct StreamEntry final {
+  std::string id;
+  /// Empty for the entries deleted from the stream while being pending
+  std::vector<std::pair<std::string, std::string>> fields;
+
+  StreamEntry() = default;
+  StreamEntry(std::string id,
+              std::vector<std::pair<std::string, std::string>> fields)
+      : id(std::move(id)), fields(std::move(fields)) {}
+
+  bool operator==(const StreamEntry& rhs) const {
+    return std::tie(id, fields) == std::tie(rhs.id, rhs.fields);
+  }
+
+  bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+struct XautoclaimReply final {
+  /// The start id for the next call, "0-0" when the whole pending entries
+  /// list was scanned
+  std::string next_start_id;
+  std::vector<StreamEntry> entries;
+};
+
+enum class XgroupCreateReply { kCreated, kAlreadyExists };
+
+/// Parse tag of the XREADGROUP reply for a single stream, which is nil when
+/// there are no entries to read
+struct XreadgroupReply final {};
+
 using TtlReply = USERVER_NAMESPACE::redis::TtlReply;
 
 }  // namespace storages::redis
@@ -0,0 +1,116 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumer
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// Settings of StreamConsumer
+struct StreamConsumerSettings {
+  std::string stream;
+  std::string group;
+  std::string consumer;
+
+  /// Maximum number of the entries read at once and passed to the callback
+  std::size_t batch_size{100};
+
+  /// Maximum number of the batches processed concurrently. The stream is not
+  /// read while all of them are busy
+  std::size_t max_concurrent_batches{1};
+
+  /// Pause between the reads while the stream has no new entries
+  std::chrono::milliseconds poll_interval{100};
+
+  /// Number of the processed entries to acknowledge with a single XACK. The
+  /// rest are acknowledged before the next read of the stream
+  std::size_t ack_batch_size{100};
+
+  /// Interval of XAUTOCLAIM of the entries left pending by the failed
+  /// callbacks or by the dead consumers, zero disables it
+  std::chrono::milliseconds claim_interval{std::chrono::seconds{30}};
+
+  /// Minimum idle time of a pending entry to be claimed
+  std::chrono::milliseconds claim_min_idle_time{std::chrono::minutes{1}};
+
+  /// Create the group at the end of the stream if it does not exist
+  bool create_group{true};
+
+  USERVER_NAMESPACE::redis::CommandControl command_control;
+};
+
+/// @ingroup userver_clients
+///
+/// @brief Consumer of a Redis stream as a member of a consumer group
+///
+/// Reads the new entries of the stream with XREADGROUP and passes them in
+/// batches to the callback on the given task processor. An entry is
+/// acknowledged once the callback returns. If the callback throws, the entries
+/// stay pending and are claimed for a retry by XAUTOCLAIM after
+/// `claim_min_idle_time`, so the delivery is at-least-once.
+///
+/// XREADGROUP is called without BLOCK, as a blocking command would stall the
+/// other requests sharing the connection, and the stream is polled with
+/// `poll_interval` while there are no new entries. XACKs are not waited for
+/// and are pipelined with the other commands, a lost XACK results in a
+/// redelivery of the entries.
+///
+/// Processing of the batches is cancelled on destruction.
+class StreamConsumer final {
+ public:
+  using Callback = std::function<void(std::vector<StreamEntry> entries)>;
+
+  StreamConsumer(ClientPtr client, StreamConsumerSettings settings,
+                 engine::TaskProcessor& task_processor, Callback callback);
+
+  ~StreamConsumer();
+
+  StreamConsumer(const StreamConsumer&) = delete;
+  StreamConsumer& operator=(const StreamConsumer&) = delete;
+
+  /// Stops reading the stream, cancels the processing of the batches and
+  /// acknowledges the processed entries
+  void Stop() noexcept;
+
+ private:
+  void Run();
+  void CreateGroup();
+  void ClaimPending();
+  void Dispatch(std::vector<StreamEntry> entries);
+  void ProcessBatch(std::vector<StreamEntry> entries);
+  void Acknowledge(std::vector<std::string> ids);
+  void FlushAcks();
+  void SendAcks(std::vector<std::string> ids);
+
+  const ClientPtr client_;
+  const StreamConsumerSettings settings_;
+  const Callback callback_;
+
+  std::string claim_start_id_{"0-0"};
+
+  std::mutex acks_mutex_;
+  std::vector<std::string> pending_acks_;
+
+  engine::Semaphore batches_semaphore_;
+  concurrent::BackgroundTaskStorage batch_tasks_;
+  engine::TaskWithResult<void> consumer_task_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -50,6 +51,8 @@ class [[nodiscard]] SubscriptionToken final {
   using OnPmessageCb =
       std::function<void(const std::string& pattern, const std::string& channel,
                          const std::string& message)>;
+  using OnMessagesCb = std::function<void(const std::string& channel,
+                                          std::vector<std::string> messages)>;
 
   SubscriptionToken();
   SubscriptionToken(SubscriptionToken&&) noexcept;
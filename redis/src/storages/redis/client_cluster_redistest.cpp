@@ -108,20 +108,25 @@ UTEST_F(RedisClusterClientTest, MgetCrossSlot) {
   auto shard = client->ShardByKey(MakeKey(idx[0]));
   while (client->ShardByKey(MakeKey(idx[1])) != shard) ++idx[1];
 
-  for (unsigned long i : idx) {
-    auto req = client->Set(MakeKey(i), std::to_string(add + i), kDefaultCc);
-    UASSERT_NO_THROW(req.Get());
-  }
+  const std::vector<std::string> keys{MakeKey(idx[0]), MakeKey(idx[1])};
+  UASSERT_NO_THROW(
+      client
+          ->Mset({{keys[0], std::to_string(add + idx[0])},
+                  {keys[1], std::to_string(add + idx[1])}},
+                 kDefaultCc)
+          .Get());
 
   {
-    auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-    UASSERT_THROW(req.Get(), redis::ParseReplyException);
+    // The keys are in distinct slots, the replies are merged in key order
+    auto req = client->Mget({keys[1], keys[0]}, kDefaultCc);
+    auto reply = req.Get();
+    ASSERT_EQ(reply.size(), 2);
+    EXPECT_EQ(reply[0], std::to_string(add + idx[1]));
+    EXPECT_EQ(reply[1], std::to_string(add + idx[0]));
   }
 
-  for (unsigned long i : idx) {
-    auto req = client->Del(MakeKey(i), kDefaultCc);
-    EXPECT_EQ(req.Get(), 1);
-  }
+  EXPECT_EQ(client->Exists(keys, kDefaultCc).Get(), 2);
+  EXPECT_EQ(client->Del(keys, kDefaultCc).Get(), 2);
 }
 
 UTEST_F(RedisClusterClientTest, Transaction) {
@@ -1,7 +1,10 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "request_impl.hpp"
@@ -32,8 +35,43 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
         ')');
 }
 
+struct GetKey {
+  const std::string& operator()(const std::string& key) const { return key; }
+
+  const std::string& operator()(
+      const std::pair<std::string, std::string>& key_value) const {
+    return key_value.first;
+  }
+};
+
 }  // namespace
 
+template <typename Request, typename T>
+Request ClientImpl::MakeScatterGatherRequest(
+    const char* command, std::vector<T>&& args, std::vector<KeysGroup>&& groups,
+    bool master, size_t max_chunk_size, const CommandControl& command_control) {
+  const auto cc = GetCommandControl(command_control);
+  std::vector<USERVER_NAMESPACE::redis::Request> requests;
+  std::vector<std::vector<size_t>> key_indices;
+  for (auto& group : groups) {
+    const auto& indices = group.key_indices;
+    const auto chunk_size = max_chunk_size ? max_chunk_size : indices.size();
+    for (size_t begin = 0; begin < indices.size(); begin += chunk_size) {
+      const auto end = std::min(begin + chunk_size, indices.size());
+      std::vector<T> chunk_args;
+      chunk_args.reserve(end - begin);
+      for (auto i = begin; i < end; ++i) {
+        chunk_args.push_back(std::move(args[indices[i]]));
+      }
+      requests.push_back(MakeRequest(CmdArgs{command, std::move(chunk_args)},
+                                     group.shard, master, cc));
+      key_indices.emplace_back(indices.begin() + begin, indices.begin() + end);
+    }
+  }
+  return CreateScatterGatherRequest<Request>(
+      std::move(requests), std::move(key_indices), args.size());
+}
+
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
     std::optional<size_t> force_shard_idx)
@@ -112,6 +150,11 @@ RequestDel ClientImpl::Del(std::vector<std::string> keys,
                            const CommandControl& command_control) {
   if (keys.empty())
     return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
+  if (auto groups = GroupKeys(keys, GetKey{}, command_control);
+      !groups.empty()) {
+    return MakeScatterGatherRequest<RequestDel>(
+        "del", std::move(keys), std::move(groups), true, 0, command_control);
+  }
   auto shard = ShardByKey(keys.at(0), command_control);
   return CreateRequest<RequestDel>(
       MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true,
@@ -131,6 +174,11 @@ RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestUnlink>(
         std::make_shared<Reply>("unlink", 0));
+  if (auto groups = GroupKeys(keys, GetKey{}, command_control);
+      !groups.empty()) {
+    return MakeScatterGatherRequest<RequestUnlink>(
+        "unlink", std::move(keys), std::move(groups), true, 0, command_control);
+  }
   auto shard = ShardByKey(keys.at(0), command_control);
   return CreateRequest<RequestUnlink>(
       MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true,
@@ -168,6 +216,10 @@ RequestScriptLoad ClientImpl::ScriptLoad(
                   GetCommandControl(command_control)));
 }
 
+std::string ClientImpl::RegisterScript(std::string script) {
+  return redis_client_->RegisterScript(std::move(script));
+}
+
 RequestExists ClientImpl::Exists(std::string key,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -181,6 +233,12 @@ RequestExists ClientImpl::Exists(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestExists>(
         std::make_shared<Reply>("exists", 0));
+  if (auto groups = GroupKeys(keys, GetKey{}, command_control);
+      !groups.empty()) {
+    return MakeScatterGatherRequest<RequestExists>(
+        "exists", std::move(keys), std::move(groups), false, 0,
+        command_control);
+  }
   auto shard = ShardByKey(keys.at(0), command_control);
   return CreateRequest<RequestExists>(
       MakeRequest(CmdArgs{"exists", std::move(keys)}, shard, false,
@@ -272,9 +330,18 @@ RequestGeosearch ClientImpl::Geosearch(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  const auto cc = GetCommandControl(command_control);
+  const auto& cache = redis_client_->GetClientSideCache();
+  if (cc.client_side_cache && cache->IsEnabled()) {
+    if (auto reply = cache->Get(key, std::nullopt))
+      return CreateDummyRequest<RequestGet>(std::move(reply));
+    const auto generation = cache->GetGeneration(key);
+    return CreateCachingRequest<RequestGet>(
+        MakeRequest(CmdArgs{"get", key}, shard, false, cc), cache,
+        std::move(key), std::nullopt, generation);
+  }
   return CreateRequest<RequestGet>(
-      MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
-                  GetCommandControl(command_control)));
+      MakeRequest(CmdArgs{"get", std::move(key)}, shard, false, cc));
 }
 
 RequestGetset ClientImpl::Getset(std::string key, std::string value,
@@ -314,9 +381,18 @@ RequestHexists ClientImpl::Hexists(std::string key, std::string field,
 RequestHget ClientImpl::Hget(std::string key, std::string field,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
-  return CreateRequest<RequestHget>(
-      MakeRequest(CmdArgs{"hget", std::move(key), std::move(field)}, shard,
-                  false, GetCommandControl(command_control)));
+  const auto cc = GetCommandControl(command_control);
+  const auto& cache = redis_client_->GetClientSideCache();
+  if (cc.client_side_cache && cache->IsEnabled()) {
+    if (auto reply = cache->Get(key, field))
+      return CreateDummyRequest<RequestHget>(std::move(reply));
+    const auto generation = cache->GetGeneration(key);
+    return CreateCachingRequest<RequestHget>(
+        MakeRequest(CmdArgs{"hget", key, field}, shard, false, cc), cache,
+        std::move(key), std::move(field), generation);
+  }
+  return CreateRequest<RequestHget>(MakeRequest(
+      CmdArgs{"hget", std::move(key), std::move(field)}, shard, false, cc));
 }
 
 RequestHgetall ClientImpl::Hgetall(std::string key,
@@ -513,6 +589,12 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestMget>(
         std::make_shared<Reply>("mget", ReplyData::Array{}));
+  if (auto groups = GroupKeys(keys, GetKey{}, command_control);
+      !groups.empty()) {
+    return MakeScatterGatherRequest<RequestMget>(
+        "mget", std::move(keys), std::move(groups), false,
+        command_control.chunk_size, command_control);
+  }
   const auto shard = ShardByKey(keys.at(0), command_control);
   const auto max_chunk_size =
       command_control.chunk_size ? command_control.chunk_size : keys.size();
@@ -535,6 +617,12 @@ RequestMset ClientImpl::Mset(
     return CreateDummyRequest<RequestMset>(
         std::make_shared<USERVER_NAMESPACE::redis::Reply>(
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")));
+  if (auto groups = GroupKeys(key_values, GetKey{}, command_control);
+      !groups.empty()) {
+    return MakeScatterGatherRequest<RequestMset>(
+        "mset", std::move(key_values), std::move(groups), true, 0,
+        command_control);
+  }
   auto shard = ShardByKey(key_values.at(0).first, command_control);
   return CreateRequest<RequestMset>(
       MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
@@ -842,6 +930,61 @@ RequestType ClientImpl::Type(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestXack ClientImpl::Xack(std::string key, std::string group,
+                             std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  if (ids.empty())
+    return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXack>(MakeRequest(
+      CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)}, shard,
+      true, GetCommandControl(command_control)));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key,
+    std::vector<std::pair<std::string, std::string>> field_values,
+    const CommandControl& command_control) {
+  UASSERT(!field_values.empty());
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXadd>(MakeRequest(
+      CmdArgs{"xadd", std::move(key), "*", std::move(field_values)}, shard,
+      true, GetCommandControl(command_control)));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key, std::string group, std::string consumer,
+    std::chrono::milliseconds min_idle_time, std::string start,
+    const XautoclaimOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXautoclaim>(
+      MakeRequest(CmdArgs{"xautoclaim", std::move(key), std::move(group),
+                          std::move(consumer), min_idle_time.count(),
+                          std::move(start), options},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key, std::string group, std::string id,
+    const XgroupCreateOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXgroupCreate>(
+      MakeRequest(CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group),
+                          std::move(id), options},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key, std::string group, std::string consumer, std::string id,
+    const XreadgroupOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXreadgroup>(
+      MakeRequest(CmdArgs{"xreadgroup", "GROUP", std::move(group),
+                          std::move(consumer), options, "STREAMS",
+                          std::move(key), std::move(id)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -1126,6 +1269,10 @@ size_t ClientImpl::ShardByKey(const std::string& key,
   return ShardByKey(key);
 }
 
+bool ClientImpl::IsInClusterMode() const {
+  return redis_client_->IsInClusterMode();
+}
+
 void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
   DoCheckShard(shard, force_shard_idx_);
   DoCheckShard(shard, cc.force_shard_idx);
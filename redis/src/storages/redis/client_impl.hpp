@@ -4,10 +4,12 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/command_options.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 
 #include <userver/storages/redis/client.hpp>
@@ -87,6 +89,8 @@ class ClientImpl final : public Client,
   RequestScriptLoad ScriptLoad(std::string script, size_t shard,
                                const CommandControl& command_control) override;
 
+  std::string RegisterScript(std::string script) override;
+
   RequestExists Exists(std::string key,
                        const CommandControl& command_control) override;
 
@@ -336,6 +340,31 @@ class ClientImpl final : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const XgroupCreateOptions& options,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer, std::string id,
+      const XreadgroupOptions& options,
+      const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -444,6 +473,45 @@ class ClientImpl final : public Client,
       CmdArgs&& args, size_t shard, bool master,
       const CommandControl& command_control, size_t replies_to_skip = 0);
 
+  // Indices of the keys of a multi-key command that are sent together
+  struct KeysGroup {
+    size_t shard;
+    std::vector<size_t> key_indices;
+  };
+
+  // Groups the keys by shard, or by hash slot in the cluster mode. Returns
+  // nothing if all the keys may be sent in one command.
+  template <typename T, typename GetKey>
+  std::vector<KeysGroup> GroupKeys(const std::vector<T>& args, GetKey get_key,
+                                   const CommandControl& cc) const {
+    if (force_shard_idx_ || cc.force_shard_idx || args.size() < 2) return {};
+    const bool cluster_mode = IsInClusterMode();
+    if (!cluster_mode && ShardsCount() == 1) return {};
+
+    std::vector<KeysGroup> groups;
+    std::unordered_map<size_t, size_t> group_by_slot_or_shard;
+    for (size_t i = 0; i < args.size(); ++i) {
+      const std::string& key = get_key(args[i]);
+      const auto slot_or_shard = cluster_mode
+                                     ? USERVER_NAMESPACE::redis::HashSlot(key)
+                                     : ShardByKey(key);
+      const auto [it, inserted] =
+          group_by_slot_or_shard.emplace(slot_or_shard, groups.size());
+      if (inserted) {
+        groups.push_back({cluster_mode ? ShardByKey(key) : slot_or_shard, {}});
+      }
+      groups[it->second].key_indices.push_back(i);
+    }
+    if (groups.size() == 1) return {};
+    return groups;
+  }
+
+  template <typename Request, typename T>
+  Request MakeScatterGatherRequest(const char* command, std::vector<T>&& args,
+                                   std::vector<KeysGroup>&& groups,
+                                   bool master, size_t max_chunk_size,
+                                   const CommandControl& command_control);
+
   template <typename T, typename Func>
   auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args,
                          Func&& func) {
@@ -470,6 +538,8 @@ class ClientImpl final : public Client,
 
   size_t ShardByKey(const std::string& key, const CommandControl& cc) const;
 
+  bool IsInClusterMode() const;
+
   void CheckShard(size_t shard, const CommandControl& cc) const;
 
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
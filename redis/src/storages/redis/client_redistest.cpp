@@ -162,6 +162,50 @@ UTEST_F(RedisClientTest, Geosearch) {
       client->Geosearch("Sicily", "Palermo", width, height, options, {}).Get();
 }
 
+UTEST_F(RedisClientTest, Streams) {
+  Version since{6, 2, 0};
+  if (!CheckVersion(since))
+    GTEST_SKIP() << SkipMsgByVersion("Xautoclaim", since);
+
+  auto client = GetClient();
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {true}, {}).Get(),
+            storages::redis::XgroupCreateReply::kCreated);
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {true}, {}).Get(),
+            storages::redis::XgroupCreateReply::kAlreadyExists);
+
+  EXPECT_TRUE(client->Xreadgroup("stream", "group", "consumer", ">", {}, {})
+                  .Get()
+                  .empty());
+
+  const auto id1 = client->Xadd("stream", {{"field", "value1"}}, {}).Get();
+  const auto id2 = client->Xadd("stream", {{"field", "value2"}}, {}).Get();
+
+  auto entries =
+      client->Xreadgroup("stream", "group", "consumer", ">", {1, false}, {})
+          .Get();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0],
+            (storages::redis::StreamEntry{id1, {{"field", "value1"}}}));
+
+  entries =
+      client->Xreadgroup("stream", "group", "consumer", ">", {}, {}).Get();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].id, id2);
+
+  EXPECT_EQ(client->Xack("stream", "group", {id1}, {}).Get(), 1);
+  EXPECT_EQ(client->Xack("stream", "group", {id1}, {}).Get(), 0);
+
+  // The unacknowledged entry is claimed by another consumer
+  auto claim = client
+                   ->Xautoclaim("stream", "group", "other",
+                                std::chrono::milliseconds{0}, "0-0", {}, {})
+                   .Get();
+  EXPECT_EQ(claim.next_start_id, "0-0");
+  ASSERT_EQ(claim.entries.size(), 1);
+  EXPECT_EQ(claim.entries[0],
+            (storages::redis::StreamEntry{id2, {{"field", "value2"}}}));
+}
+
 UTEST_F(RedisClientTest, Append) {
   auto client = GetClient();
   EXPECT_EQ(client->Exists("key", {}).Get(), 0);
@@ -212,6 +256,23 @@ UTEST_F(RedisClientTest, EvalSha) {
   EXPECT_EQ(result_array[0], "key1");
 }
 
+UTEST_F(RedisClientTest, EvalShaRegistered) {
+  auto client = GetClient();
+  const std::string script = "return { KEYS[1], ARGV[1] }";
+
+  // The script is loaded by the already established connections before the
+  // next commands
+  const auto sha = client->RegisterScript(script);
+  auto result =
+      client->EvalSha<std::vector<std::string>>(sha, {"key1"}, {"arg1"}, {})
+          .Get();
+  ASSERT_TRUE(result.HasValue());
+  EXPECT_EQ(result.Extract(), (std::vector<std::string>{"key1", "arg1"}));
+
+  EXPECT_EQ(client->RegisterScript(script), sha);
+  EXPECT_EQ(client->ScriptLoad(script, 0, {}).Get(), sha);
+}
+
 UTEST_F(RedisClientTest, Exists) {
   auto client = GetClient();
   client->Set("key1", "Hello", {}).Get();
@@ -0,0 +1,122 @@
+#include <memory>
+#include <regex>
+#include <string>
+
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/impl/thread_pools.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <storages/redis/client_impl.hpp>
+#include <storages/redis/impl/client_side_cache.hpp>
+#include <storages/redis/impl/sentinel.hpp>
+#include <storages/redis/util_redistest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kClientSideCacheSize = 100;
+
+class RedisClientSideCacheTest : public ::testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    thread_pools_ = std::make_shared<redis::ThreadPools>(
+        redis::kDefaultSentinelThreadPoolSize,
+        redis::kDefaultRedisThreadPoolSize);
+    sentinel_ = redis::Sentinel::CreateSentinel(
+        thread_pools_, GetTestsuiteRedisSettings(), "none",
+        dynamic_config::GetDefaultSource(), "pub", redis::KeyShardFactory{""},
+        {}, {}, kClientSideCacheSize);
+    sentinel_->WaitConnectedDebug();
+
+    auto info_reply =
+        sentinel_->MakeRequest({"info", "server"}, "none", false).Get();
+    ASSERT_TRUE(info_reply->IsOk());
+    ASSERT_TRUE(info_reply->data.IsString());
+    std::smatch matches;
+    const auto& info = info_reply->data.GetString();
+    ASSERT_TRUE(std::regex_search(info, matches,
+                                  std::regex(R"(redis_version:(\d+)\.)")));
+    major_version_ = std::stoi(matches[1]);
+  }
+
+  static void TearDownTestSuite() {
+    sentinel_.reset();
+    thread_pools_.reset();
+  }
+
+  void SetUp() override {
+    // CLIENT TRACKING is available since 6.0.0
+    if (major_version_ < 6) GTEST_SKIP() << "Redis 6+ is required";
+    sentinel_->MakeRequest({"flushdb"}, "none", true).Get();
+    client_ = std::make_shared<storages::redis::ClientImpl>(sentinel_);
+  }
+
+  storages::redis::ClientPtr GetClient() { return client_; }
+
+  static redis::ClientSideCache& GetCache() {
+    return *sentinel_->GetClientSideCache();
+  }
+
+  static bool WaitForCacheSize(std::size_t size) {
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (GetCache().GetSize() != size) {
+      if (deadline.IsReached()) return false;
+      engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    return true;
+  }
+
+ private:
+  static inline std::shared_ptr<redis::ThreadPools> thread_pools_;
+  static inline std::shared_ptr<redis::Sentinel> sentinel_;
+  static inline int major_version_{0};
+  storages::redis::ClientPtr client_;
+};
+
+redis::CommandControl MakeCachingCommandControl() {
+  redis::CommandControl cc;
+  cc.client_side_cache = true;
+  return cc;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientSideCacheTest, Get) {
+  auto client = GetClient();
+  const auto cc = MakeCachingCommandControl();
+
+  client->Set("key", "value", {}).Get();
+  EXPECT_EQ(client->Get("key", cc).Get(), "value");
+  EXPECT_EQ(GetCache().GetSize(), 1);
+  EXPECT_EQ(client->Get("key", cc).Get(), "value");
+
+  // The server sends the invalidation message for the key read before
+  client->Set("key", "new_value", {}).Get();
+  ASSERT_TRUE(WaitForCacheSize(0));
+  EXPECT_EQ(client->Get("key", cc).Get(), "new_value");
+  EXPECT_EQ(GetCache().GetSize(), 1);
+}
+
+UTEST_F(RedisClientSideCacheTest, ZrangeWithScores) {
+  auto client = GetClient();
+  const auto cc = MakeCachingCommandControl();
+
+  client->Zadd("zset", {{1.0, "one"}, {2.0, "two"}}, {}).Get();
+  // The connections of the cache-enabled group keep the RESP2 replies
+  const auto members = client->ZrangeWithScores("zset", 0, -1, cc).Get();
+  ASSERT_EQ(members.size(), 2);
+  EXPECT_EQ(members[0].member, "one");
+  EXPECT_EQ(members[0].score, 1.0);
+  EXPECT_EQ(members[1].member, "two");
+  EXPECT_EQ(members[1].score, 2.0);
+
+  client->Set("key", "value", {}).Get();
+  EXPECT_EQ(client->Get("key", cc).Get(), "value");
+  EXPECT_EQ(client->ZrangeWithScores("zset", 0, 0, cc).Get().size(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -91,6 +91,8 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
   if (b.best_dc_count > 0) res.best_dc_count = b.best_dc_count;
   if (b.max_ping_latency > std::chrono::milliseconds(0))
     res.max_ping_latency = b.max_ping_latency;
+  if (b.max_running_commands > 0)
+    res.max_running_commands = b.max_running_commands;
   if (b.force_request_to_master)
     res.force_request_to_master = b.force_request_to_master;
   if (b.allow_reads_from_master)
@@ -100,6 +102,7 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
     res.force_retries_to_master_on_nil_reply =
         b.force_retries_to_master_on_nil_reply;
   if (b.force_shard_idx) res.force_shard_idx = b.force_shard_idx;
+  if (b.client_side_cache) res.client_side_cache = b.client_side_cache;
   return res;
 }
 
@@ -122,6 +125,9 @@ std::string CommandControl::ToString() const {
     ss << " force_server_id: " << force_server_id.GetId() << ',';
   if (force_request_to_master) ss << " force_request_to_master: true,";
   if (force_shard_idx) ss << " force_shard_idx: " << *force_shard_idx << ',';
+  if (client_side_cache) ss << " client_side_cache: true,";
+  if (max_running_commands)
+    ss << " max_running_commands: " << max_running_commands << ',';
   ss << " max ping: " << max_ping_latency.count();
   return ss.str();
 }
@@ -139,7 +145,8 @@ CommandControl::Strategy StrategyFromString(std::string_view strategy) {
         .Case("every_dc", Strategy::kEveryDc)
         .Case("default", Strategy::kDefault)
         .Case("local_dc_conductor", Strategy::kLocalDcConductor)
-        .Case("nearest_server_ping", Strategy::kNearestServerPing);
+        .Case("nearest_server_ping", Strategy::kNearestServerPing)
+        .Case("power_of_two_choices", Strategy::kPowerOfTwoChoices);
   };
 
   auto result = kToStrategy.TryFind(strategy);
@@ -69,6 +69,8 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  std::size_t client_side_cache_size{0};
+  std::size_t connections_per_instance{1};
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -79,6 +81,10 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.client_side_cache_size =
+      value["client_side_cache_size"].As<std::size_t>(0);
+  config.connections_per_instance =
+      value["connections_per_instance"].As<std::size_t>(1);
   return config;
 }
 
@@ -210,7 +216,8 @@ void Redis::Connect(const ComponentConfig& config,
     auto sentinel = redis::Sentinel::CreateSentinel(
         thread_pools_, settings, redis_group.config_name, config_source,
         redis_group.db, redis::KeyShardFactory{redis_group.sharding_strategy},
-        cc, testsuite_redis_control);
+        cc, testsuite_redis_control, redis_group.client_side_cache_size,
+        redis_group.connections_per_instance);
     if (sentinel) {
       sentinels_.emplace(redis_group.db, sentinel);
       const auto& client =
@@ -370,6 +377,16 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                client_side_cache_size:
+                    type: integer
+                    description: max number of keys in the cache of GET and HGET replies, 0 disables the cache
+                    defaultDescription: 0
+                    minimum: 0
+                connections_per_instance:
+                    type: integer
+                    description: number of connections to each master and replica, the commands are balanced among them
+                    defaultDescription: 1
+                    minimum: 1
     metrics_level:
         type: string
         description: set metrics detail level
@@ -0,0 +1,103 @@
+#include "client_side_cache.hpp"
+
+#include <functional>
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+// LruMap requires a non-zero size, the cache is disabled until SetMaxSize()
+ClientSideCache::ClientSideCache() : values_(1) {}
+
+void ClientSideCache::SetMaxSize(std::size_t max_size) {
+  std::lock_guard lock(mutex_);
+  enabled_ = max_size > 0;
+  if (enabled_) {
+    values_.SetMaxSize(max_size);
+  } else {
+    InvalidateAllLocked();
+  }
+}
+
+bool ClientSideCache::IsEnabled() const {
+  std::lock_guard lock(mutex_);
+  return enabled_;
+}
+
+void ClientSideCache::AddTrackedServer(ServerId server_id) {
+  std::lock_guard lock(mutex_);
+  tracked_servers_.insert(server_id);
+}
+
+void ClientSideCache::RemoveTrackedServer(ServerId server_id) {
+  std::lock_guard lock(mutex_);
+  if (tracked_servers_.erase(server_id)) InvalidateAllLocked();
+}
+
+std::uint64_t ClientSideCache::GetGeneration(const std::string& key) const {
+  std::lock_guard lock(mutex_);
+  return GenerationLocked(key);
+}
+
+ReplyPtr ClientSideCache::Get(const std::string& key,
+                              const std::optional<std::string>& field) const {
+  std::lock_guard lock(mutex_);
+  if (!enabled_) return {};
+  const auto* values = values_.Get(key);
+  if (!values) return {};
+  const auto it = values->find(field);
+  if (it == values->end()) return {};
+  // The parsers move the data out of the reply
+  return std::make_shared<Reply>(*it->second);
+}
+
+void ClientSideCache::Store(const std::string& key,
+                            const std::optional<std::string>& field,
+                            const ReplyPtr& reply, std::uint64_t generation) {
+  if (!reply || !reply->IsOk() ||
+      !(reply->data.IsString() || reply->data.IsNil())) {
+    return;
+  }
+
+  std::lock_guard lock(mutex_);
+  if (!enabled_ || generation != GenerationLocked(key) ||
+      !tracked_servers_.count(reply->server_id)) {
+    return;
+  }
+  auto* values = values_.Emplace(key);
+  (*values)[field] = std::make_shared<Reply>(*reply);
+}
+
+void ClientSideCache::Invalidate(const std::vector<std::string>& keys) {
+  std::lock_guard lock(mutex_);
+  for (const auto& key : keys) {
+    ++GenerationLocked(key);
+    values_.Erase(key);
+  }
+}
+
+void ClientSideCache::InvalidateAll() {
+  std::lock_guard lock(mutex_);
+  InvalidateAllLocked();
+}
+
+std::size_t ClientSideCache::GetSize() const {
+  std::lock_guard lock(mutex_);
+  return values_.GetSize();
+}
+
+std::uint64_t& ClientSideCache::GenerationLocked(
+    const std::string& key) const {
+  return generations_[std::hash<std::string>{}(key) % kGenerationsCount];
+}
+
+void ClientSideCache::InvalidateAllLocked() {
+  for (auto& generation : generations_) ++generation;
+  values_.Clear();
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
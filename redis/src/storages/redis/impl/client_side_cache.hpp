@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// In-process cache of the GET and HGET replies. The values are kept up to
+/// date by the server: the connections of the tracked servers enable
+/// `CLIENT TRACKING ON REDIRECT` to a connection subscribed to the
+/// invalidation channel, which passes the invalidation messages to the cache.
+///
+/// Only the replies of the tracked servers are stored. A server stops being
+/// tracked on disconnect and the whole cache is dropped, as the invalidation
+/// messages for the keys read through that connection may be lost.
+class ClientSideCache final {
+ public:
+  ClientSideCache();
+
+  /// Zero disables the cache and drops the values
+  void SetMaxSize(std::size_t max_size);
+  bool IsEnabled() const;
+
+  void AddTrackedServer(ServerId server_id);
+  void RemoveTrackedServer(ServerId server_id);
+
+  /// Returns the generation to pass to Store() for the reply of a request
+  /// for the key sent after the call
+  std::uint64_t GetGeneration(const std::string& key) const;
+
+  /// @returns a copy of the stored reply or nullptr. `field` is std::nullopt
+  /// for GET
+  ReplyPtr Get(const std::string& key,
+               const std::optional<std::string>& field) const;
+
+  /// Stores the reply unless the key may have been invalidated since the
+  /// generation was taken, so that a reply racing with the invalidation is not
+  /// cached
+  void Store(const std::string& key, const std::optional<std::string>& field,
+             const ReplyPtr& reply, std::uint64_t generation);
+
+  void Invalidate(const std::vector<std::string>& keys);
+  void InvalidateAll();
+
+  std::size_t GetSize() const;
+
+ private:
+  using Values = std::unordered_map<std::optional<std::string>, ReplyPtr>;
+
+  // The keys share the generations by their hash, so that an invalidation
+  // blocks the stores of a small part of the keys only
+  static constexpr std::size_t kGenerationsCount = 1024;
+
+  std::uint64_t& GenerationLocked(const std::string& key) const;
+  void InvalidateAllLocked();
+
+  mutable std::mutex mutex_;
+  mutable cache::LruMap<std::string, Values> values_;
+  std::unordered_set<ServerId, ServerIdHasher> tracked_servers_;
+  mutable std::array<std::uint64_t, kGenerationsCount> generations_{};
+  bool enabled_{false};
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#include <storages/redis/impl/client_side_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+redis::ReplyPtr MakeReply(std::string value, redis::ServerId server_id) {
+  auto reply = std::make_shared<redis::Reply>("get", std::move(value));
+  reply->server_id = server_id;
+  return reply;
+}
+
+}  // namespace
+
+TEST(ClientSideCache, StoreAndInvalidate) {
+  const auto server_id = redis::ServerId::Generate();
+  redis::ClientSideCache cache;
+  cache.SetMaxSize(10);
+  cache.AddTrackedServer(server_id);
+
+  cache.Store("key", std::nullopt, MakeReply("value", server_id),
+              cache.GetGeneration("key"));
+  cache.Store("hash", "field", MakeReply("hvalue", server_id),
+              cache.GetGeneration("hash"));
+
+  auto reply = cache.Get("key", std::nullopt);
+  ASSERT_TRUE(reply);
+  EXPECT_EQ(reply->data.GetString(), "value");
+  // The caller gets a copy that may be moved out
+  reply->data.GetString().clear();
+  EXPECT_EQ(cache.Get("key", std::nullopt)->data.GetString(), "value");
+
+  EXPECT_FALSE(cache.Get("hash", std::nullopt));
+  EXPECT_FALSE(cache.Get("hash", "other"));
+  ASSERT_TRUE(cache.Get("hash", "field"));
+
+  cache.Invalidate({"key"});
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+  EXPECT_TRUE(cache.Get("hash", "field"));
+
+  cache.InvalidateAll();
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+TEST(ClientSideCache, RacingInvalidation) {
+  const auto server_id = redis::ServerId::Generate();
+  redis::ClientSideCache cache;
+  cache.SetMaxSize(10);
+  cache.AddTrackedServer(server_id);
+
+  auto generation = cache.GetGeneration("key");
+  cache.Invalidate({"key"});
+  cache.Store("key", std::nullopt, MakeReply("value", server_id), generation);
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+
+  generation = cache.GetGeneration("key");
+  cache.InvalidateAll();
+  cache.Store("key", std::nullopt, MakeReply("value", server_id), generation);
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+
+  // The invalidation of the other keys does not block the store
+  generation = cache.GetGeneration("key");
+  cache.Invalidate({"other"});
+  cache.Store("key", std::nullopt, MakeReply("value", server_id), generation);
+  EXPECT_TRUE(cache.Get("key", std::nullopt));
+}
+
+TEST(ClientSideCache, TrackedServersOnly) {
+  const auto server_id = redis::ServerId::Generate();
+  redis::ClientSideCache cache;
+  cache.SetMaxSize(10);
+
+  cache.Store("key", std::nullopt, MakeReply("value", server_id),
+              cache.GetGeneration("key"));
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+
+  cache.AddTrackedServer(server_id);
+  cache.Store("key", std::nullopt, MakeReply("value", server_id),
+              cache.GetGeneration("key"));
+  EXPECT_TRUE(cache.Get("key", std::nullopt));
+
+  cache.RemoveTrackedServer(server_id);
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+  cache.Store("key", std::nullopt, MakeReply("value", server_id),
+              cache.GetGeneration("key"));
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+}
+
+TEST(ClientSideCache, Disabled) {
+  const auto server_id = redis::ServerId::Generate();
+  redis::ClientSideCache cache;
+  EXPECT_FALSE(cache.IsEnabled());
+  cache.AddTrackedServer(server_id);
+
+  cache.Store("key", std::nullopt, MakeReply("value", server_id),
+              cache.GetGeneration("key"));
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+
+  cache.SetMaxSize(1);
+  EXPECT_TRUE(cache.IsEnabled());
+  cache.Store("key", std::nullopt, MakeReply("value", server_id),
+              cache.GetGeneration("key"));
+  cache.Store("key2", std::nullopt, MakeReply("value2", server_id),
+              cache.GetGeneration("key2"));
+  EXPECT_FALSE(cache.Get("key", std::nullopt));
+  EXPECT_TRUE(cache.Get("key2", std::nullopt));
+}
+
+USERVER_NAMESPACE_END
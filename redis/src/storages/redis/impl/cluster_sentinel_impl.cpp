@@ -3,7 +3,6 @@
 #include <atomic>
 
 #include <fmt/format.h>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/rcu/rcu.hpp>
@@ -32,15 +31,6 @@ bool CheckQuorum(size_t requests_sent, size_t responses_parsed) {
   return responses_parsed >= quorum;
 }
 
-size_t HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
   static const auto kUnknownShard = std::string("");
   size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -133,11 +123,13 @@ class ClusterTopologyHolder
       const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool,
       std::string shard_group_name, Password password,
       const std::vector<std::string>& /*shards*/,
-      const std::vector<ConnectionInfo>& conns)
+      const std::vector<ConnectionInfo>& conns,
+      std::shared_ptr<ScriptRegistry> script_registry)
       : ev_thread_(sentinel_thread_control),
         redis_thread_pool_(redis_thread_pool),
         shard_group_name_(std::move(shard_group_name)),
         password_(std::move(password)),
+        script_registry_(std::move(script_registry)),
         shards_names_(MakeShardNames()),
         conns_(conns),
         update_topology_timer_(
@@ -309,6 +301,7 @@ class ClusterTopologyHolder
 
   std::string shard_group_name_;
   Password password_;
+  std::shared_ptr<ScriptRegistry> script_registry_;
   std::shared_ptr<const std::vector<std::string>> shards_names_;
   std::vector<ConnectionInfo> conns_;
   std::shared_ptr<Shard> sentinels_;
@@ -542,7 +535,7 @@ ClusterTopologyHolder::CreateRedisInstance(const std::string& host_port) {
   return std::make_shared<RedisConnectionHolder>(
       ev_thread_, redis_thread_pool_, host, port, password_,
       buffering_settings_ptr->value_or(CommandsBufferingSettings{}),
-      *replication_monitoring_settings_ptr);
+      *replication_monitoring_settings_ptr, script_registry_);
 }
 
 void ClusterTopologyHolder::UpdateClusterTopology() {
@@ -636,7 +629,7 @@ ClusterSentinelImpl::ClusterSentinelImpl(
               kSentinelGetHostsCheckInterval)),
       topology_holder_(std::make_shared<ClusterTopologyHolder>(
           ev_thread_, redis_thread_pool, shard_group_name, password, shards,
-          conns)),
+          conns, sentinel.GetScriptRegistry())),
       shard_group_name_(std::move(shard_group_name)),
       conns_(conns),
       ready_callback_(std::move(ready_callback)),
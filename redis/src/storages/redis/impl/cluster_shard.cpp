@@ -7,6 +7,8 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/load_balancing.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
@@ -17,6 +19,7 @@ bool IsNearestServerPing(const CommandControl& control) {
   switch (control.strategy) {
     case CommandControl::Strategy::kEveryDc:
     case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kPowerOfTwoChoices:
       return false;
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing:
@@ -85,6 +88,17 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
   const auto servers_count = available_servers.size();
   const auto is_nearest_ping_server = IsNearestServerPing(command_control);
 
+  if (command_control.strategy ==
+          CommandControl::Strategy::kPowerOfTwoChoices &&
+      command->instance_idx == SentinelImpl::kDefaultPrevInstanceIdx) {
+    size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
+    if (const auto instance =
+            GetLessLoadedInstance(available_servers, command_control, &idx)) {
+      command->instance_idx = idx;
+      if (instance->AsyncCommand(command)) return true;
+    }
+  }
+
   const auto masters_count = 1;
   const auto max_attempts = replicas_.size() + masters_count + 1;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
@@ -93,9 +107,9 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
                       command->instance_idx, current, servers_count);
 
     size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
-    const auto instance = GetInstance(available_servers, start_idx, attempt,
-                                      is_nearest_ping_server,
-                                      command_control.best_dc_count, &idx);
+    const auto instance =
+        GetInstance(available_servers, start_idx, attempt,
+                    is_nearest_ping_server, command_control, &idx);
     if (!instance) {
       continue;
     }
@@ -119,6 +133,8 @@ ShardStatistics ClusterShard::GetStatistics(
     }
     auto inst_stats =
         redis::InstanceStatistics(settings, instance->GetStatistics());
+    inst_stats.queued_commands = instance->GetQueuedCommands();
+    inst_stats.running_commands = instance->GetRunningCommands();
     stats.shard_total.Add(inst_stats);
     auto master_host_port = instance->GetServerHost() + ":" +
                             std::to_string(instance->GetServerPort());
@@ -211,9 +227,10 @@ std::vector<ClusterShard::RedisConnectionPtr> ClusterShard::GetAvailableServers(
 
 ClusterShard::RedisPtr ClusterShard::GetInstance(
     const std::vector<RedisConnectionPtr>& instances, size_t start_idx,
-    size_t attempt, bool is_nearest_ping_server, size_t best_dc_count,
-    size_t* pinstance_idx) {
+    size_t attempt, bool is_nearest_ping_server,
+    const CommandControl& command_control, size_t* pinstance_idx) {
   RedisPtr ret;
+  const auto best_dc_count = command_control.best_dc_count;
   const auto end = (is_nearest_ping_server && attempt == 0 && best_dc_count)
                        ? std::min(instances.size(), best_dc_count)
                        : instances.size();
@@ -225,9 +242,8 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
     }
     const auto& cur_inst = cur->Get();
 
-    if (cur_inst && !cur_inst->IsDestroying() &&
-        (cur_inst->GetState() == Redis::State::kConnected) &&
-        !cur_inst->IsSyncing() &&
+    if (cur_inst &&
+        IsInstanceAvailable(*cur_inst, command_control.max_running_commands) &&
         (!ret || ret->IsDestroying() ||
          cur_inst->GetRunningCommands() < ret->GetRunningCommands())) {
       if (pinstance_idx) *pinstance_idx = idx;
@@ -237,6 +253,37 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
   return ret;
 }
 
+ClusterShard::RedisPtr ClusterShard::GetLessLoadedInstance(
+    const std::vector<RedisConnectionPtr>& instances,
+    const CommandControl& command_control, size_t* pinstance_idx) {
+  std::vector<std::pair<size_t, RedisPtr>> candidates;
+  candidates.reserve(instances.size());
+  for (size_t i = 0; i < instances.size(); ++i) {
+    if (!instances[i]) continue;
+    auto instance = instances[i]->Get();
+    if (instance &&
+        IsInstanceAvailable(*instance, command_control.max_running_commands)) {
+      candidates.emplace_back(i, std::move(instance));
+    }
+  }
+
+  /// Master is the last one in the list, it gets the reads only if allowed
+  /// or if no replica is available
+  const bool has_master =
+      !candidates.empty() && candidates.back().first + 1 == instances.size();
+  if (has_master && candidates.size() > 1 &&
+      !command_control.allow_reads_from_master) {
+    candidates.pop_back();
+  }
+  if (candidates.empty()) return {};
+
+  auto& chosen = candidates[ChooseLessLoadedOfTwo(
+      candidates.size(),
+      [&candidates](size_t i) { return GetLoad(*candidates[i].second); })];
+  *pinstance_idx = chosen.first;
+  return std::move(chosen.second);
+}
+
 bool ClusterShard::IsMasterReady() const {
   return master_ && master_->GetState() == Redis::State::kConnected;
 }
@@ -62,8 +62,13 @@ class ClusterShard {
       const CommandControl& command_control) const;
   static RedisPtr GetInstance(const std::vector<RedisConnectionPtr>& instances,
                               size_t start_idx, size_t attempt,
-                              bool is_nearest_ping_server, size_t best_dc_count,
+                              bool is_nearest_ping_server,
+                              const CommandControl& command_control,
                               size_t* pinstance_idx);
+  /// Chooses a replica for CommandControl::Strategy::kPowerOfTwoChoices
+  static RedisPtr GetLessLoadedInstance(
+      const std::vector<RedisConnectionPtr>& instances,
+      const CommandControl& command_control, size_t* pinstance_idx);
   std::vector<RedisConnectionPtr> MakeReadonlyWithMasters() const;
   bool IsMasterReady() const;
   bool IsReplicaReady() const;
@@ -146,6 +146,25 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg) {
   PutArg(args_, arg.range_options);
 }
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XgroupCreateOptions& arg) {
+  if (arg.mkstream) args_.emplace_back("MKSTREAM");
+}
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg) {
+  if (arg.count) {
+    args_.emplace_back("COUNT");
+    args_.emplace_back(std::to_string(arg.count));
+  }
+  if (arg.noack) args_.emplace_back("NOACK");
+}
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XautoclaimOptions& arg) {
+  if (arg.count) {
+    args_.emplace_back("COUNT");
+    args_.emplace_back(std::to_string(arg.count));
+  }
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#include <storages/redis/impl/load_balancing.hpp>
+
+#include <storages/redis/impl/redis.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+bool IsInstanceAvailable(const Redis& instance,
+                         std::size_t max_running_commands) {
+  return !instance.IsDestroying() &&
+         instance.GetState() == Redis::State::kConnected &&
+         !instance.IsSyncing() && !instance.IsOverloaded() &&
+         (!max_running_commands ||
+          instance.GetRunningCommands() < max_running_commands);
+}
+
+double GetLoad(const Redis& instance) {
+  return static_cast<double>(instance.GetRequestLatency().count()) *
+         static_cast<double>(instance.GetRunningCommands() +
+                             instance.GetQueuedCommands() + 1);
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+class Redis;
+
+/// @returns whether the commands may be sent to the instance: it is connected,
+/// not syncing with the master, its queue is not full and it has less than
+/// `max_running_commands` commands waiting for the replies, 0 for no limit
+bool IsInstanceAvailable(const Redis& instance,
+                         std::size_t max_running_commands = 0);
+
+/// Load estimate of an instance for the kPowerOfTwoChoices strategy: the time
+/// to serve its running and queued commands and a new one at the recent
+/// latency
+double GetLoad(const Redis& instance);
+
+/// @returns the index of the less loaded of two distinct random candidates
+/// from [0, count)
+template <typename GetCandidateLoad>
+std::size_t ChooseLessLoadedOfTwo(std::size_t count,
+                                  GetCandidateLoad get_candidate_load) {
+  UASSERT(count > 0);
+  if (count == 1) return 0;
+
+  const auto first = utils::RandRange(count);
+  auto second = utils::RandRange(count - 1);
+  if (second >= first) ++second;
+  return get_candidate_load(second) < get_candidate_load(first) ? second
+                                                                : first;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
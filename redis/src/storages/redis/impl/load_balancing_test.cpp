@@ -0,0 +1,33 @@
+#include <storages/redis/impl/load_balancing.hpp>
+
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(LoadBalancing, SingleCandidate) {
+  EXPECT_EQ(redis::ChooseLessLoadedOfTwo(1, [](size_t) { return 1.0; }), 0);
+}
+
+TEST(LoadBalancing, LessLoadedOfTwo) {
+  const std::vector<double> loads{3.0, 1.0};
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(redis::ChooseLessLoadedOfTwo(
+                  loads.size(), [&loads](size_t idx) { return loads[idx]; }),
+              1);
+  }
+}
+
+TEST(LoadBalancing, MostLoadedIsNeverChosen) {
+  const std::vector<double> loads{1.0, 2.0, 3.0, 10.0};
+  std::set<size_t> chosen;
+  for (int i = 0; i < 1000; ++i) {
+    chosen.insert(redis::ChooseLessLoadedOfTwo(
+        loads.size(), [&loads](size_t idx) { return loads[idx]; }));
+  }
+  EXPECT_EQ(chosen, (std::set<size_t>{0, 1, 2}));
+}
+
+USERVER_NAMESPACE_END
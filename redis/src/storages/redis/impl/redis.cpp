@@ -21,10 +21,13 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/swappingsmart.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_reader.hpp>
+#include <storages/redis/impl/script_registry.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -35,7 +38,11 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+const auto kRequestLatencyExp = 0.9;
 const size_t kMissedPingStreakThresholdDefault = 3;
+// Part of the ping latency the commands may wait for in the adaptive
+// buffering mode, so that the buffering adds little to the request latency
+const auto kAdaptiveBufferingLatencyFraction = 0.25;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
 // instead of sending PING commands which are not supported by hiredis in
@@ -67,6 +74,14 @@ ReplyStatus NativeToReplyStatus(int status) {
   return *reply_status;
 }
 
+size_t GetCommandBytes(const Command& command) {
+  size_t bytes = 0;
+  for (const auto& args : command.args.args) {
+    for (const auto& arg : args) bytes += arg.size();
+  }
+  return bytes;
+}
+
 inline bool AreStringsEqualIgnoreCase(const std::string& l,
                                       const std::string& r) {
   return l.size() == r.size() && !strcasecmp(l.c_str(), r.c_str());
@@ -151,11 +166,20 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   const Statistics& GetStatistics() const { return statistics_; }
   ServerId GetServerId() const { return server_id_; }
   size_t GetRunningCommands() const;
+  size_t GetQueuedCommands() const { return commands_size_; }
+  bool IsOverloaded() const {
+    const auto max_queued_commands = max_queued_commands_.load();
+    return max_queued_commands && commands_size_ >= max_queued_commands;
+  }
   bool IsDestroying() const { return destroying_; }
   bool IsSyncing() const { return is_syncing_; }
   std::chrono::milliseconds GetPingLatency() const {
     return std::chrono::milliseconds(ping_latency_ms_);
   }
+  std::chrono::microseconds GetRequestLatency() const {
+    return std::chrono::microseconds(
+        static_cast<std::int64_t>(request_latency_us_));
+  }
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
@@ -184,6 +208,12 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
                            void* privdata) noexcept;
   static void OnConnect(const redisAsyncContext* c, int status) noexcept;
   static void OnDisconnect(const redisAsyncContext* c, int status) noexcept;
+  static void OnTrackingConnect(const redisAsyncContext* c,
+                                int status) noexcept;
+  static void OnTrackingDisconnect(const redisAsyncContext* c,
+                                   int status) noexcept;
+  static void OnTrackingReply(redisAsyncContext* c, void* r,
+                              void* privdata) noexcept;
   static void OnTimerPing(struct ev_loop* loop, ev_timer* w,
                           int revents) noexcept;
   static void OnTimerInfo(struct ev_loop* loop, ev_timer* w,
@@ -195,6 +225,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void OnConnectImpl(int status);
   void OnDisconnectImpl(int status);
+  void OnTrackingReplyImpl(const redisReply* redis_reply);
   bool InitSecureConnection();
   void InvokeCommand(const CommandPtr& command, ReplyPtr&& reply);
   void InvokeCommandError(const CommandPtr& command, const std::string& name,
@@ -206,6 +237,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status,
                         const char* errstr);
   void AccountPingLatency(std::chrono::milliseconds latency);
+  void AccountRequestLatency(const Command& command);
   void AccountRtt();
   void OnTimerPingImpl();
   void OnTimerInfoImpl();
@@ -220,6 +252,12 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void Authenticate();
   void SendReadOnly();
+  void EnableTracking();
+  bool ConnectTracking();
+  void EnableTrackingRedirect(int64_t client_id);
+  void StopTracking();
+  void FreeTracking();
+  void LoadScripts();
   void FreeCommands();
 
   static void LogSocketErrorReply(const CommandPtr& command,
@@ -236,6 +274,12 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   static bool WatchCommandTimerEnabled(
       const CommandsBufferingSettings& commands_buffering_settings);
+  bool BufferingLimitReached(
+      const CommandsBufferingSettings& commands_buffering_settings) const;
+  std::chrono::microseconds GetBufferingInterval(
+      const CommandsBufferingSettings& commands_buffering_settings) const;
+  void OnNoRepliesPending();
+  void ResumeQueuedCommands();
 
   bool Connect(const std::string& host, int port, const Password& password);
 
@@ -250,6 +294,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic<bool> destroying_{false};
 
   redisAsyncContext* context_ = nullptr;
+  // Receives the invalidation messages of the keys read through context_
+  redisAsyncContext* tracking_context_ = nullptr;
 #ifdef USERVER_FEATURE_REDIS_TLS
   SSLContextPtr ssl_context_;
 #endif
@@ -259,6 +305,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::string server_;
   Password password_{std::string()};
   std::atomic<size_t> commands_size_ = 0;
+  std::atomic<size_t> commands_bytes_ = 0;
   size_t sent_count_ = 0;
   size_t cmd_counter_ = 0;
   std::unordered_map<size_t, std::unique_ptr<SingleCommand>> reply_privdata_;
@@ -274,14 +321,25 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   ev_timer watch_command_timer_{};
   ev_async watch_command_{};
   utils::SwappingSmart<CommandsBufferingSettings> commands_buffering_settings_;
+  std::atomic<size_t> max_queued_commands_{0};
+  std::atomic<size_t> max_in_flight_commands_{0};
   std::atomic_bool enable_replication_monitoring_ = false;
   std::atomic_bool forbid_requests_to_syncing_replicas_ = false;
   const bool send_readonly_;
   const ConnectionSecurity connection_security_;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
+  const std::shared_ptr<ScriptRegistry> script_registry_;
+  std::size_t loaded_scripts_count_{0};
+  const bool direct_reply_parsing_;
+  bool is_tracking_ = false;
+  // The connection waits for the tracking connection to become kConnected
+  bool tracking_pending_ = false;
+  int64_t tracking_client_id_ = 0;
   std::chrono::milliseconds ping_interval_{2000};
   std::chrono::milliseconds ping_timeout_{4000};
   std::chrono::milliseconds info_replication_interval_{2000};
   std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+  std::atomic<double> request_latency_us_{0};
   logging::LogExtra log_extra_;
   bool watch_command_timer_started_ = false;
   Statistics statistics_;
@@ -352,10 +410,18 @@ ServerId Redis::GetServerId() const { return impl_->GetServerId(); }
 
 size_t Redis::GetRunningCommands() const { return impl_->GetRunningCommands(); }
 
+size_t Redis::GetQueuedCommands() const { return impl_->GetQueuedCommands(); }
+
+bool Redis::IsOverloaded() const { return impl_->IsOverloaded(); }
+
 std::chrono::milliseconds Redis::GetPingLatency() const {
   return impl_->GetPingLatency();
 }
 
+std::chrono::microseconds Redis::GetRequestLatency() const {
+  return impl_->GetRequestLatency();
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -383,6 +449,9 @@ Redis::RedisImpl::RedisImpl(
       thread_pool_(thread_pool),
       send_readonly_(redis_settings.send_readonly),
       connection_security_(redis_settings.connection_security),
+      client_side_cache_(redis_settings.client_side_cache),
+      script_registry_(redis_settings.script_registry),
+      direct_reply_parsing_(redis_settings.direct_reply_parsing),
       server_id_(ServerId::Generate()) {
   SetCommandsBufferingSettings(CommandsBufferingSettings{});
   LOG_DEBUG() << "RedisImpl() server_id=" << GetServerId().GetId();
@@ -470,6 +539,8 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
     return false;
   }
 
+  if (direct_reply_parsing_) impl::SetReplyDataReader(*context_->c.reader);
+
   ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
     bool err = false;
     auto CheckError = [&err, &host](int status, const std::string& name) {
@@ -501,6 +572,7 @@ void Redis::RedisImpl::Disconnect() {
 
 void Redis::RedisImpl::DoDisconnect() {
   Detach();
+  FreeTracking();
 
   if (state_ == State::kInit || state_ == State::kConnected)
     redisAsyncDisconnect(context_);
@@ -523,8 +595,21 @@ void Redis::RedisImpl::DoDisconnect() {
 void Redis::RedisImpl::InvokeCommand(const CommandPtr& command,
                                      ReplyPtr&& reply) {
   UASSERT(reply);
-  if (command->control.account_in_statistics)
+  if (command->control.account_in_statistics) {
     statistics_.AccountReplyReceived(reply, command);
+    if (script_registry_ && command->GetName() == "evalsha" &&
+        command->args.args.size() == 1 && command->args.args[0].size() > 1) {
+      script_registry_->AccountReply(
+          command->args.args[0][1],
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() -
+              command->GetStartHandlingTime()));
+    }
+  }
+  if (!subscriber_ &&
+      (reply->IsOk() || reply->status == ReplyStatus::kTimeoutError)) {
+    AccountRequestLatency(*command);
+  }
   reply->server = server_;
   if (reply->status == ReplyStatus::kTimeoutError) {
     auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -586,6 +671,58 @@ bool Redis::RedisImpl::WatchCommandTimerEnabled(
              std::chrono::microseconds::zero();
 }
 
+bool Redis::RedisImpl::BufferingLimitReached(
+    const CommandsBufferingSettings& commands_buffering_settings) const {
+  if (commands_buffering_settings.commands_buffering_threshold &&
+      commands_size_.load() >=
+          commands_buffering_settings.commands_buffering_threshold) {
+    return true;
+  }
+  if (!commands_buffering_settings.adaptive) return false;
+
+  // As in Nagle's algorithm there is nothing to wait for on an idle connection
+  if (!sent_count_) return true;
+  return commands_buffering_settings.commands_buffering_bytes_threshold &&
+         commands_bytes_.load() >=
+             commands_buffering_settings.commands_buffering_bytes_threshold;
+}
+
+std::chrono::microseconds Redis::RedisImpl::GetBufferingInterval(
+    const CommandsBufferingSettings& commands_buffering_settings) const {
+  const auto interval =
+      commands_buffering_settings.watch_command_timer_interval;
+  if (!commands_buffering_settings.adaptive) return interval;
+
+  const std::chrono::duration<double, std::milli> latency_part{
+      ping_latency_ms_.load() * kAdaptiveBufferingLatencyFraction};
+  return std::min(
+      interval,
+      std::chrono::duration_cast<std::chrono::microseconds>(latency_part));
+}
+
+void Redis::RedisImpl::OnNoRepliesPending() {
+  if (!watch_command_timer_started_ ||
+      !commands_buffering_settings_.Get()->adaptive) {
+    return;
+  }
+  // The buffered commands were waiting for the replies, send them on the next
+  // loop iteration rather than from within the reply callback
+  ev_thread_control_.Stop(watch_command_timer_);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_set(&watch_command_timer_, 0.0, 0.0);
+  ev_thread_control_.Start(watch_command_timer_);
+}
+
+void Redis::RedisImpl::ResumeQueuedCommands() {
+  const auto max_in_flight_commands = max_in_flight_commands_.load();
+  if (!max_in_flight_commands || sent_count_ + 1 != max_in_flight_commands ||
+      !commands_size_) {
+    return;
+  }
+  // The queue was stopped at the limit, continue on the next loop iteration
+  ev_thread_control_.Send(watch_command_);
+}
+
 bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
   LOG_DEBUG() << "AsyncCommand for server_id=" << GetServerId().GetId()
               << " server=" << GetServerId().GetDescription()
@@ -593,7 +730,12 @@ bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     if (destroying_) return false;
+    if (IsOverloaded()) {
+      ++statistics_.queue_overflows;
+      return false;
+    }
     ++commands_size_;
+    commands_bytes_ += GetCommandBytes(*command);
     commands_.push_back(command);
   }
   ev_thread_control_.Send(watch_command_);
@@ -636,7 +778,10 @@ void Redis::RedisImpl::OnCommandTimeoutImpl(ev_timer* w) {
   auto reply_iterator = reply_privdata_.find(cmd_idx);
   if (reply_iterator != reply_privdata_.end()) {
     SingleCommand& command = *reply_iterator->second;
-    if (!subscriber_) --sent_count_;
+    if (!subscriber_) {
+      --sent_count_;
+      ResumeQueuedCommands();
+    }
     UASSERT(reply_privdata_rev_.count(&command.timer));
     UASSERT(w == &command.timer);
     reply_privdata_rev_.erase(&command.timer);
@@ -645,6 +790,16 @@ void Redis::RedisImpl::OnCommandTimeoutImpl(ev_timer* w) {
   }
 }
 
+void Redis::RedisImpl::AccountRequestLatency(const Command& command) {
+  const std::chrono::duration<double, std::micro> latency =
+      std::chrono::steady_clock::now() - command.GetStartHandlingTime();
+  const auto prev_latency_us = request_latency_us_.load();
+  request_latency_us_ =
+      prev_latency_us ? prev_latency_us * kRequestLatencyExp +
+                            latency.count() * (1 - kRequestLatencyExp)
+                      : latency.count();
+}
+
 void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
   statistics_.AccountPing(latency);
   ping_latency_ms_ = (ping_latency_ms_.load() * kPingLatencyExp +
@@ -831,6 +986,10 @@ void Redis::RedisImpl::SetState(State state) {
   state_ = state;
   statistics_.AccountStateChanged(state);
 
+  if (state != State::kConnected && std::exchange(is_tracking_, false)) {
+    client_side_cache_->RemoveTrackedServer(server_id_);
+  }
+
   auto self = shared_from_this();  // prevents deleting this in Disconnect()
   if (state == State::kConnected) {
     ev_thread_control_.RunInEvLoopBlocking([this] {
@@ -850,6 +1009,7 @@ void Redis::RedisImpl::FreeCommands() {
     auto command = commands_.front();
     commands_.pop_front();
     --commands_size_;
+    commands_bytes_ -= GetCommandBytes(*command);
     for (const auto& args : command->args.args) {
       InvokeCommandError(
           command, args[0], ReplyStatus::kEndOfFileError,
@@ -883,15 +1043,12 @@ void Redis::RedisImpl::OnNewCommand(struct ev_loop*, ev_async* w,
 void Redis::RedisImpl::OnNewCommandImpl() {
   auto commands_buffering_settings = commands_buffering_settings_.Get();
   if (WatchCommandTimerEnabled(*commands_buffering_settings) &&
-      (!commands_buffering_settings->commands_buffering_threshold ||
-       commands_size_.load() <
-           commands_buffering_settings->commands_buffering_threshold)) {
+      !BufferingLimitReached(*commands_buffering_settings)) {
     if (!std::exchange(watch_command_timer_started_, true)) {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
       ev_timer_set(
           &watch_command_timer_,
-          ToEvDuration(
-              commands_buffering_settings->watch_command_timer_interval),
+          ToEvDuration(GetBufferingInterval(*commands_buffering_settings)),
           0.0);
       ev_thread_control_.Start(watch_command_timer_);
     }
@@ -918,12 +1075,33 @@ void Redis::RedisImpl::CommandLoopImpl() {
     }
   }
   std::deque<CommandPtr> commands;
+  const auto max_in_flight_commands =
+      subscriber_ ? 0 : max_in_flight_commands_.load();
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
-    commands_size_ -= commands_.size();
-    std::swap(commands_, commands);
+    if (!max_in_flight_commands) {
+      commands_size_ -= commands_.size();
+      commands_bytes_ = 0;
+      std::swap(commands_, commands);
+    } else {
+      // The rest stay in the queue until the replies are received, see
+      // ResumeQueuedCommands()
+      auto in_flight_commands = sent_count_;
+      while (!commands_.empty() &&
+             in_flight_commands < max_in_flight_commands) {
+        auto command = std::move(commands_.front());
+        commands_.pop_front();
+        --commands_size_;
+        commands_bytes_ -= GetCommandBytes(*command);
+        in_flight_commands += command->args.args.size();
+        commands.push_back(std::move(command));
+      }
+    }
   }
   LOG_TRACE() << "commands size=" << commands.size();
+  // The scripts registered after the connect are loaded before the commands
+  // that may call them, the connection keeps the order of the commands
+  if (!commands.empty() && !subscriber_) LoadScripts();
   for (auto& command : commands) {
     ProcessCommand(command);
   }
@@ -1028,7 +1206,7 @@ void Redis::RedisImpl::Authenticate() {
     if (send_readonly_)
       SendReadOnly();
     else
-      SetState(State::kConnected);
+      EnableTracking();
   } else {
     ProcessCommand(PrepareCommand(
         CmdArgs{"AUTH", password_.GetUnderlying()},
@@ -1037,7 +1215,7 @@ void Redis::RedisImpl::Authenticate() {
             if (send_readonly_)
               SendReadOnly();
             else
-              SetState(State::kConnected);
+              EnableTracking();
           } else {
             if (*reply) {
               if (reply->IsUnknownCommandError()) {
@@ -1069,7 +1247,7 @@ void Redis::RedisImpl::SendReadOnly() {
   ProcessCommand(PrepareCommand(CmdArgs{"READONLY"}, [this](const CommandPtr&,
                                                             ReplyPtr reply) {
     if (*reply && reply->data.IsStatus()) {
-      SetState(State::kConnected);
+      EnableTracking();
     } else {
       if (*reply) {
         LOG_LIMITED_ERROR()
@@ -1086,6 +1264,203 @@ void Redis::RedisImpl::SendReadOnly() {
   }));
 }
 
+void Redis::RedisImpl::EnableTracking() {
+  if (client_side_cache_ && ConnectTracking()) {
+    tracking_pending_ = true;
+    return;
+  }
+  LoadScripts();
+  SetState(State::kConnected);
+}
+
+// The connection stays on RESP2, as the reply parsers expect it. The server
+// redirects the invalidation messages to a connection of their own that is
+// subscribed to the invalidation channel.
+bool Redis::RedisImpl::ConnectTracking() {
+  UASSERT(tracking_context_ == nullptr);
+  if (connection_security_ == ConnectionSecurity::kTLS) {
+    LOG_WARNING() << log_extra_
+                  << "Client-side caching is not supported for TLS "
+                     "connections, the cache is disabled for the server";
+    return false;
+  }
+
+  auto* context = redisAsyncConnect(host_.c_str(), port_);
+  UASSERT(context != nullptr);
+  if (context->err) {
+    LOG_WARNING() << log_extra_
+                  << "error after redisAsyncConnect of the tracking "
+                     "connection: "
+                  << context->errstr;
+    redisAsyncFree(context);
+    return false;
+  }
+  context->data = this;
+  if (redisLibevAttach(ev_thread_control_.GetEvLoop(), context) != REDIS_OK ||
+      redisAsyncSetConnectCallback(context, OnTrackingConnect) != REDIS_OK ||
+      redisAsyncSetDisconnectCallback(context, OnTrackingDisconnect) !=
+          REDIS_OK) {
+    LOG_WARNING() << log_extra_ << "failed to set up the tracking connection";
+    redisAsyncFree(context);
+    return false;
+  }
+  tracking_context_ = context;
+
+  // The commands are sent once connected. A failed AUTH fails CLIENT ID
+  const auto& password = password_.GetUnderlying();
+  if (!password.empty()) {
+    redisAsyncCommand(context, nullptr, nullptr, "AUTH %b", password.data(),
+                      password.size());
+  }
+  redisAsyncCommand(context, OnTrackingReply, nullptr, "CLIENT ID");
+  return true;
+}
+
+void Redis::RedisImpl::EnableTrackingRedirect(int64_t client_id) {
+  ProcessCommand(PrepareCommand(
+      CmdArgs{"CLIENT", "TRACKING", "ON", "REDIRECT",
+              std::to_string(client_id)},
+      [this](const CommandPtr&, ReplyPtr reply) {
+        if (!tracking_pending_) return;
+        if (*reply && reply->data.IsStatus()) {
+          is_tracking_ = true;
+          client_side_cache_->AddTrackedServer(server_id_);
+          tracking_pending_ = false;
+          LoadScripts();
+          SetState(State::kConnected);
+        } else {
+          LOG_WARNING() << log_extra_
+                        << "CLIENT TRACKING failed, client-side caching is "
+                           "disabled for the server: "
+                        << reply->data.ToDebugString();
+          StopTracking();
+        }
+      }));
+}
+
+void Redis::RedisImpl::StopTracking() {
+  if (auto* context = std::exchange(tracking_context_, nullptr)) {
+    redisAsyncFree(context);
+  }
+  // The keys read before are not invalidated anymore
+  if (std::exchange(is_tracking_, false)) {
+    client_side_cache_->RemoveTrackedServer(server_id_);
+  }
+  if (std::exchange(tracking_pending_, false)) {
+    LoadScripts();
+    SetState(State::kConnected);
+  }
+}
+
+void Redis::RedisImpl::FreeTracking() {
+  tracking_pending_ = false;
+  if (auto* context = std::exchange(tracking_context_, nullptr)) {
+    redisAsyncFree(context);
+  }
+}
+
+void Redis::RedisImpl::LoadScripts() {
+  if (!script_registry_ ||
+      script_registry_->GetSize() == loaded_scripts_count_) {
+    return;
+  }
+  auto scripts = script_registry_->GetScripts(loaded_scripts_count_);
+  loaded_scripts_count_ += scripts.size();
+  // The replies are not waited for, EVALSHA sent later is executed after them
+  for (auto& script : scripts) {
+    ProcessCommand(PrepareCommand(
+        CmdArgs{"SCRIPT", "LOAD", std::move(script)},
+        [this](const CommandPtr&, ReplyPtr reply) {
+          if (!*reply || !reply->data.IsString()) {
+            LOG_LIMITED_ERROR() << log_extra_ << "SCRIPT LOAD failed: "
+                                << reply->data.ToDebugString();
+          }
+        }));
+  }
+}
+
+void Redis::RedisImpl::OnTrackingConnect(const redisAsyncContext* c,
+                                         int status) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  if (status == REDIS_OK || c != impl->tracking_context_) return;
+  LOG_WARNING() << impl->log_extra_
+                << "Tracking connection failed, client-side caching is "
+                   "disabled for the server: "
+                << c->errstr;
+  // hiredis frees the context
+  impl->tracking_context_ = nullptr;
+  impl->StopTracking();
+}
+
+void Redis::RedisImpl::OnTrackingDisconnect(const redisAsyncContext* c,
+                                            int status) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  if (c != impl->tracking_context_) return;
+  LOG_WARNING() << impl->log_extra_
+                << "Tracking connection is closed, client-side caching is "
+                   "disabled for the server: "
+                << (status == REDIS_OK ? "" : c->errstr);
+  // hiredis frees the context
+  impl->tracking_context_ = nullptr;
+  impl->StopTracking();
+}
+
+void Redis::RedisImpl::OnTrackingReply(redisAsyncContext* c, void* r,
+                                       void*) noexcept {
+  auto* impl = static_cast<Redis::RedisImpl*>(c->data);
+  UASSERT(impl != nullptr);
+  // The replies are dropped after the context is freed, and the empty replies
+  // on disconnect are followed by OnTrackingDisconnect()
+  if (c != impl->tracking_context_ || !r) return;
+  try {
+    impl->OnTrackingReplyImpl(static_cast<const redisReply*>(r));
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "OnTrackingReplyImpl() failed: " << ex;
+  }
+}
+
+void Redis::RedisImpl::OnTrackingReplyImpl(const redisReply* redis_reply) {
+  const ReplyData data{redis_reply};
+  if (data.IsInt()) {
+    // CLIENT ID
+    redisAsyncCommand(tracking_context_, OnTrackingReply, nullptr,
+                      "SUBSCRIBE __redis__:invalidate");
+    tracking_client_id_ = data.GetInt();
+    return;
+  }
+
+  if (!data.IsArray() || data.GetArray().size() != 3 ||
+      !data.GetArray()[0].IsString()) {
+    LOG_WARNING() << log_extra_
+                  << "Unexpected reply of the tracking connection, "
+                     "client-side caching is disabled for the server: "
+                  << data.ToDebugString();
+    StopTracking();
+    return;
+  }
+  const auto& message = data.GetArray();
+  const auto& kind = message[0].GetString();
+  if (kind == "subscribe") {
+    if (tracking_pending_) EnableTrackingRedirect(tracking_client_id_);
+    return;
+  }
+  if (kind != "message") return;
+
+  // A nil key list is sent on FLUSHALL / FLUSHDB
+  if (!message[2].IsArray()) {
+    client_side_cache_->InvalidateAll();
+    return;
+  }
+  std::vector<std::string> keys;
+  keys.reserve(message[2].GetArray().size());
+  for (const auto& key : message[2].GetArray()) {
+    if (key.IsString()) keys.push_back(key.GetString());
+  }
+  client_side_cache_->Invalidate(keys);
+}
+
 void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
                                     void* privdata) noexcept {
   auto* impl = static_cast<Redis::RedisImpl*>(c->data);
@@ -1115,9 +1490,13 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   ev_thread_control_.Stop(data->second->timer);
   pcommand = data->second.get();
 
-  auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply,
-                                       NativeToReplyStatus(status),
-                                       errstr ? errstr : "");
+  auto reply =
+      direct_reply_parsing_ && redis_reply
+          ? std::make_shared<Reply>(pcommand->cmd,
+                                    impl::TakeReplyData(redis_reply))
+          : std::make_shared<Reply>(pcommand->cmd, redis_reply,
+                                    NativeToReplyStatus(status),
+                                    errstr ? errstr : "");
 
   // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
   // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -1129,7 +1508,10 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   // TODO: add check in RedisImpl.
   if (!subscriber_ || !redis_reply || IsUnsubscribeReply(reply)) {
     command_ptr = std::move(data->second);
-    if (!subscriber_) --sent_count_;
+    if (!subscriber_) {
+      if (!--sent_count_) OnNoRepliesPending();
+      ResumeQueuedCommands();
+    }
 
     if (subscriber_) {
       LOG_DEBUG() << "server_id=" << GetServerId().GetId()
@@ -1177,6 +1559,12 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
     }
 
     const bool is_special = IsSubscribesCommand(args);
+    if (is_special && direct_reply_parsing_) {
+      LOG_ERROR() << log_extra_ << "impossible for commands connection: "
+                  << args[0];
+      InvokeCommandError(command, args[0], ReplyStatus::kOtherError);
+      continue;
+    }
     if (is_special) subscriber_ = true;
     if (subscriber_ && !is_special) {
       LOG_ERROR() << log_extra_ << "impossible for subscriber: " << args[0];
@@ -1244,6 +1632,8 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
 
 void Redis::RedisImpl::SetCommandsBufferingSettings(
     CommandsBufferingSettings commands_buffering_settings) {
+  max_queued_commands_ = commands_buffering_settings.max_queued_commands;
+  max_in_flight_commands_ = commands_buffering_settings.max_in_flight_commands;
   commands_buffering_settings_.Set(
       std::make_shared<CommandsBufferingSettings>(commands_buffering_settings));
 }
@@ -39,7 +39,14 @@ class Redis {
 
   bool AsyncCommand(const CommandPtr& command);
   size_t GetRunningCommands() const;
+  /// Commands waiting to be sent
+  size_t GetQueuedCommands() const;
+  /// The queue of the commands waiting to be sent is full
+  bool IsOverloaded() const;
   std::chrono::milliseconds GetPingLatency() const;
+  /// Moving average of the time to the replies of the commands, including
+  /// the timed out ones
+  std::chrono::microseconds GetRequestLatency() const;
   bool IsDestroying() const;
   std::string GetServerHost() const;
   uint16_t GetServerPort() const;
@@ -9,7 +9,8 @@ RedisConnectionHolder::RedisConnectionHolder(
     const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool,
     const std::string& host, uint16_t port, Password password,
     CommandsBufferingSettings buffering_settings,
-    ReplicationMonitoringSettings replication_monitoring_settings)
+    ReplicationMonitoringSettings replication_monitoring_settings,
+    std::shared_ptr<ScriptRegistry> script_registry)
     : commands_buffering_settings_(std::move(buffering_settings)),
       replication_monitoring_settings_(
           std::move(replication_monitoring_settings)),
@@ -18,6 +19,7 @@ RedisConnectionHolder::RedisConnectionHolder(
       host_(host),
       port_(port),
       password_(std::move(password)),
+      script_registry_(std::move(script_registry)),
       connection_check_timer_(
           ev_thread_, [this] { EnsureConnected(); },
           kCheckRedisConnectedInterval) {
@@ -51,6 +53,7 @@ void RedisConnectionHolder::CreateConnection() {
   /// Here we allow read from replicas possibly stale data.
   /// This does not affect connections to masters
   settings.send_readonly = true;
+  settings.script_registry = script_registry_;
   auto instance = std::make_shared<Redis>(redis_thread_pool_, settings);
   instance->signal_state_change.connect(
       [weak_ptr{weak_from_this()}](Redis::State state) {
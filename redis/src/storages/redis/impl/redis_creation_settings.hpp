@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -8,9 +9,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+class ClientSideCache;
+class ScriptRegistry;
+
 struct RedisCreationSettings {
   ConnectionSecurity connection_security = ConnectionSecurity::kNone;
   bool send_readonly{false};
+  /// Build the replies right from the read buffer, see SetReplyDataReader()
+  bool direct_reply_parsing{false};
+  /// If set, the connection tracks the keys it reads with an extra
+  /// connection that receives the invalidation messages
+  std::shared_ptr<ClientSideCache> client_side_cache;
+  /// If set, the connection loads the scripts before the other commands
+  std::shared_ptr<ScriptRegistry> script_registry;
 };
 
 }  // namespace redis
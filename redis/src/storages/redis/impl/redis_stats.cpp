@@ -90,6 +90,11 @@ const std::string_view kCommandTypes[] = {
     "type",
     "unlink",
     "unsubscribe",
+    "xack",
+    "xadd",
+    "xautoclaim",
+    "xgroup",
+    "xreadgroup",
     "zadd",
     "zcard",
     "zcount",
@@ -167,6 +172,9 @@ InstanceStatistics SentinelStatistics::GetShardGroupTotalStatistics() const {
 void DumpMetric(utils::statistics::Writer& writer,
                 const InstanceStatistics& stats, bool real_instance) {
   writer["reconnects"] = stats.reconnects;
+  writer["queue_overflows"] = stats.queue_overflows;
+  writer["queued_commands"] = stats.queued_commands;
+  writer["running_commands"] = stats.running_commands;
 
   if (stats.settings.IsRequestSizesEnabled()) {
     writer["request_sizes"] = stats.request_size_percentile;
@@ -239,6 +247,12 @@ void DumpMetric(utils::statistics::Writer& writer,
   DumpMetric(writer, stats.shard_group_total, false);
   writer["errors"].ValueWithLabels(stats.internal.redis_not_ready.load(),
                                    {"redis_error", "redis_not_ready"});
+  if (settings.IsCommandTimingsEnabled()) {
+    for (const auto& [sha, percentile] : stats.script_timings) {
+      writer["script_timings"].ValueWithLabels(percentile,
+                                               {"redis_script", sha});
+    }
+  }
   if (settings.GetMetricsLevel() >= MetricsSettings::Level::kShard) {
     for (const auto& [shard_name, shard_stats] : stats.masters) {
       writer.ValueWithLabels(shard_stats, {{"redis_instance_type", "masters"},
@@ -42,6 +42,8 @@ class Statistics {
 
   std::atomic<RedisState> state{RedisState::kInit};
   std::atomic_llong reconnects{0};
+  /// Commands rejected as the queue of the connection was full
+  std::atomic_llong queue_overflows{0};
   std::atomic<std::chrono::milliseconds> session_start_time{};
   RecentPeriod request_size_percentile;
   RecentPeriod reply_size_percentile;
@@ -59,6 +61,8 @@ struct InstanceStatistics {
       : settings(settings),
         state(other.state.load(std::memory_order_relaxed)),
         reconnects(other.reconnects.load(std::memory_order_relaxed)),
+        queue_overflows(
+            other.queue_overflows.load(std::memory_order_relaxed)),
         session_start_time(
             other.session_start_time.load(std::memory_order_relaxed)),
         request_size_percentile(
@@ -83,6 +87,9 @@ struct InstanceStatistics {
 
   void Add(const InstanceStatistics& other) {
     reconnects += other.reconnects;
+    queue_overflows += other.queue_overflows;
+    queued_commands += other.queued_commands;
+    running_commands += other.running_commands;
     request_size_percentile.Add(other.request_size_percentile);
     reply_size_percentile.Add(other.reply_size_percentile);
     timings_percentile.Add(other.timings_percentile);
@@ -97,6 +104,10 @@ struct InstanceStatistics {
   const MetricsSettings& settings;
   RedisState state;
   long long reconnects;
+  long long queue_overflows;
+  /// Filled from the connection rather than from Statistics
+  std::size_t queued_commands{0};
+  std::size_t running_commands{0};
   std::chrono::milliseconds session_start_time;
   Statistics::Percentile request_size_percentile;
   Statistics::Percentile reply_size_percentile;
@@ -140,6 +151,8 @@ struct SentinelStatistics {
   std::map<std::string, ShardStatistics> slaves;
   InstanceStatistics shard_group_total;
   SentinelStatisticsInternal internal;
+  /// Timings of EVALSHA of the registered scripts by the script hash
+  std::unordered_map<std::string, Statistics::Percentile> script_timings;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
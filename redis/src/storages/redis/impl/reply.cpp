@@ -75,6 +75,13 @@ ReplyData ReplyData::CreateNil() {
   return data;
 }
 
+ReplyData ReplyData::CreateInteger(int64_t value) {
+  ReplyData data;
+  data.type_ = Type::kInteger;
+  data.integer_ = value;
+  return data;
+}
+
 std::string ReplyData::GetTypeString() const { return TypeToString(GetType()); }
 
 std::string ReplyData::ToDebugString() const {
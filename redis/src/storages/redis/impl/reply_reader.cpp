@@ -0,0 +1,132 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <string>
+#include <utility>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis::impl {
+
+namespace {
+
+// The root object is a redisReply, as hiredis inspects the type of the
+// replies and copies the message of a spontaneous error reply
+struct RootReply final : redisReply {
+  RootReply(int reply_type, ReplyData&& reply_data)
+      : redisReply{}, data(std::move(reply_data)) {
+    type = reply_type;
+    if (data.IsError() || data.IsStatus()) {
+      str = data.IsError() ? data.GetError().data() : data.GetStatus().data();
+      len = data.IsError() ? data.GetError().size() : data.GetStatus().size();
+    }
+  }
+
+  ReplyData data;
+};
+
+ReplyData& GetData(const redisReadTask* task) {
+  if (!task->parent) {
+    return static_cast<RootReply*>(static_cast<redisReply*>(task->obj))->data;
+  }
+  return *static_cast<ReplyData*>(task->obj);
+}
+
+// The reader functions are called by hiredis, so the exceptions are caught
+// here and reported to hiredis as an out of memory error
+template <typename MakeData>
+void* AddObject(const redisReadTask* task, MakeData make_data) noexcept {
+  try {
+    if (!task->parent) {
+      return static_cast<redisReply*>(new RootReply(task->type, make_data()));
+    }
+
+    // The elements are read in order, and the array is reserved for all of
+    // them, so the pointers to the nested arrays stay valid
+    auto& array = GetData(task->parent).GetArray();
+    UASSERT(static_cast<std::size_t>(task->idx) == array.size());
+    array.push_back(make_data());
+    return &array.back();
+  } catch (const std::exception&) {
+    return nullptr;
+  }
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) {
+  return AddObject(task, [task, str, len] {
+    std::string value(str, len);
+    switch (task->type) {
+      case REDIS_REPLY_ERROR:
+        return ReplyData::CreateError(std::move(value));
+      case REDIS_REPLY_STATUS:
+        return ReplyData::CreateStatus(std::move(value));
+      default:
+        return ReplyData(std::move(value));
+    }
+  });
+}
+
+void* CreateArray(const redisReadTask* task, size_t elements) {
+  return AddObject(task, [elements] {
+    ReplyData::Array array;
+    array.reserve(elements);
+    return ReplyData(std::move(array));
+  });
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) {
+  return AddObject(task, [value] { return ReplyData::CreateInteger(value); });
+}
+
+void* CreateNil(const redisReadTask* task) {
+  return AddObject(task, [] { return ReplyData::CreateNil(); });
+}
+
+#ifdef REDIS_REPLY_PUSH
+void* CreateDouble(const redisReadTask* task, double, char* str, size_t len) {
+  return AddObject(task,
+                   [str, len] { return ReplyData(std::string(str, len)); });
+}
+
+void* CreateBool(const redisReadTask* task, int value) {
+  return AddObject(task, [value] { return ReplyData::CreateInteger(value); });
+}
+#endif
+
+void FreeObject(void* reply) {
+  // hiredis frees only the root objects
+  delete static_cast<RootReply*>(static_cast<redisReply*>(reply));
+}
+
+redisReplyObjectFunctions MakeObjectFunctions() {
+  redisReplyObjectFunctions functions{};
+  functions.createString = &CreateString;
+  functions.createArray = &CreateArray;
+  functions.createInteger = &CreateInteger;
+  functions.createNil = &CreateNil;
+#ifdef REDIS_REPLY_PUSH
+  functions.createDouble = &CreateDouble;
+  functions.createBool = &CreateBool;
+#endif
+  functions.freeObject = &FreeObject;
+  return functions;
+}
+
+}  // namespace
+
+void SetReplyDataReader(redisReader& reader) {
+  static redisReplyObjectFunctions functions = MakeObjectFunctions();
+  reader.fn = &functions;
+}
+
+ReplyData TakeReplyData(redisReply* reply) {
+  UASSERT(reply);
+  return std::move(static_cast<RootReply*>(reply)->data);
+}
+
+}  // namespace redis::impl
+
+USERVER_NAMESPACE_END
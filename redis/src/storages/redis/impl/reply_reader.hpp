@@ -0,0 +1,25 @@
+#pragma once
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+struct redisReader;
+struct redisReply;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis::impl {
+
+/// Makes the hiredis reader build ReplyData right from the read buffer,
+/// without the intermediate redisReply tree and its deep copy.
+///
+/// The replies of the reader are then only usable with
+/// TakeReplyData(). Must not be used for subscriber connections, as hiredis
+/// inspects the elements of the subscription replies.
+void SetReplyDataReader(redisReader& reader);
+
+/// Moves the data out of a reply built by the reader of SetReplyDataReader()
+ReplyData TakeReplyData(redisReply* reply);
+
+}  // namespace redis::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <string>
+
+#include <hiredis/hiredis.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+redis::ReplyData Read(const std::string& data) {
+  auto* reader = redisReaderCreate();
+  redis::impl::SetReplyDataReader(*reader);
+  EXPECT_EQ(redisReaderFeed(reader, data.data(), data.size()), REDIS_OK);
+
+  void* reply = nullptr;
+  EXPECT_EQ(redisReaderGetReply(reader, &reply), REDIS_OK);
+  EXPECT_NE(reply, nullptr);
+  auto result = redis::impl::TakeReplyData(static_cast<redisReply*>(reply));
+  reader->fn->freeObject(reply);
+  redisReaderFree(reader);
+  return result;
+}
+
+}  // namespace
+
+TEST(ReplyReader, Scalars) {
+  EXPECT_EQ(Read("$5\r\nhello\r\n").GetString(), "hello");
+  EXPECT_EQ(Read("+OK\r\n").GetStatus(), "OK");
+  EXPECT_EQ(Read("-ERR failed\r\n").GetError(), "ERR failed");
+  EXPECT_EQ(Read(":-9000000000\r\n").GetInt(), -9000000000);
+  EXPECT_TRUE(Read("$-1\r\n").IsNil());
+  EXPECT_TRUE(Read("*-1\r\n").IsNil());
+}
+
+TEST(ReplyReader, NestedArrays) {
+  const auto data =
+      Read("*3\r\n$3\r\nkey\r\n*2\r\n:1\r\n*1\r\n$-1\r\n*0\r\n");
+  ASSERT_TRUE(data.IsArray());
+  const auto& array = data.GetArray();
+  ASSERT_EQ(array.size(), 3);
+  EXPECT_EQ(array[0].GetString(), "key");
+
+  ASSERT_TRUE(array[1].IsArray());
+  const auto& nested = array[1].GetArray();
+  ASSERT_EQ(nested.size(), 2);
+  EXPECT_EQ(nested[0].GetInt(), 1);
+  ASSERT_TRUE(nested[1].IsArray());
+  ASSERT_EQ(nested[1].GetArray().size(), 1);
+  EXPECT_TRUE(nested[1].GetArray()[0].IsNil());
+
+  ASSERT_TRUE(array[2].IsArray());
+  EXPECT_TRUE(array[2].GetArray().empty());
+}
+
+TEST(ReplyReader, PartialFeed) {
+  const std::string data = "*2\r\n$5\r\nfirst\r\n$6\r\nsecond\r\n";
+  auto* reader = redisReaderCreate();
+  redis::impl::SetReplyDataReader(*reader);
+
+  void* reply = nullptr;
+  for (const char c : data) {
+    EXPECT_EQ(reply, nullptr);
+    EXPECT_EQ(redisReaderFeed(reader, &c, 1), REDIS_OK);
+    EXPECT_EQ(redisReaderGetReply(reader, &reply), REDIS_OK);
+  }
+  ASSERT_NE(reply, nullptr);
+  const auto result =
+      redis::impl::TakeReplyData(static_cast<redisReply*>(reply));
+  reader->fn->freeObject(reply);
+  redisReaderFree(reader);
+
+  ASSERT_EQ(result.GetArray().size(), 2);
+  EXPECT_EQ(result.GetArray()[1].GetString(), "second");
+}
+
+TEST(ReplyReader, FreeUnfinished) {
+  // The partially read reply is freed with the reader
+  auto* reader = redisReaderCreate();
+  redis::impl::SetReplyDataReader(*reader);
+  const std::string data = "*3\r\n$5\r\nfirst\r\n*2\r\n:1\r\n";
+  EXPECT_EQ(redisReaderFeed(reader, data.data(), data.size()), REDIS_OK);
+  void* reply = nullptr;
+  EXPECT_EQ(redisReaderGetReply(reader, &reply), REDIS_OK);
+  EXPECT_EQ(reply, nullptr);
+  redisReaderFree(reader);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#include <storages/redis/impl/script_registry.hpp>
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+std::string ScriptRegistry::Add(std::string script) {
+  auto sha = crypto::hash::Sha1(script);
+  const std::lock_guard lock(mutex_);
+  const auto [it, inserted] = timings_.try_emplace(sha);
+  if (inserted) {
+    it->second = std::make_unique<Statistics::RecentPeriod>();
+    scripts_.push_back(std::move(script));
+    size_ = scripts_.size();
+  }
+  return sha;
+}
+
+std::size_t ScriptRegistry::GetSize() const noexcept { return size_.load(); }
+
+std::vector<std::string> ScriptRegistry::GetScripts(std::size_t from) const {
+  const std::lock_guard lock(mutex_);
+  if (from >= scripts_.size()) return {};
+  return {scripts_.begin() + from, scripts_.end()};
+}
+
+void ScriptRegistry::AccountReply(const std::string& sha,
+                                  std::chrono::milliseconds timing) {
+  const std::lock_guard lock(mutex_);
+  const auto it = timings_.find(sha);
+  if (it == timings_.end()) return;
+  it->second->GetCurrentCounter().Account(timing.count());
+}
+
+std::unordered_map<std::string, Statistics::Percentile>
+ScriptRegistry::GetTimings() const {
+  std::unordered_map<std::string, Statistics::Percentile> result;
+  const std::lock_guard lock(mutex_);
+  for (const auto& [sha, timings] : timings_) {
+    auto stats = timings->GetStatsForPeriod();
+    if (!stats.Count()) continue;
+    result.emplace(sha, std::move(stats));
+  }
+  return result;
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
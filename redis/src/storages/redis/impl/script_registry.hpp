@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <storages/redis/impl/redis_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// Lua scripts that every connection loads with SCRIPT LOAD before sending
+/// the other commands, so that EVALSHA of them does not get NOSCRIPT after
+/// reconnects and failovers.
+///
+/// A connection loads the scripts registered before its connect during the
+/// connect, and the ones registered later right before its next commands.
+/// The scripts are never unregistered.
+class ScriptRegistry final {
+ public:
+  /// @returns SHA1 of the script for EVALSHA
+  std::string Add(std::string script);
+
+  std::size_t GetSize() const noexcept;
+
+  /// @returns the scripts in the order of registration starting from `from`
+  std::vector<std::string> GetScripts(std::size_t from) const;
+
+  /// Accounts the timing of an EVALSHA reply, ignores the unknown hashes
+  void AccountReply(const std::string& sha, std::chrono::milliseconds timing);
+
+  /// @returns the timings of the scripts that were called during the period,
+  /// by the script hash
+  std::unordered_map<std::string, Statistics::Percentile> GetTimings() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::string> scripts_;
+  std::unordered_map<std::string, std::unique_ptr<Statistics::RecentPeriod>>
+      timings_;
+  std::atomic<std::size_t> size_{0};
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,24 @@
+#include <storages/redis/impl/script_registry.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(ScriptRegistry, Add) {
+  redis::ScriptRegistry registry;
+  EXPECT_EQ(registry.GetSize(), 0);
+  EXPECT_TRUE(registry.GetScripts(0).empty());
+
+  EXPECT_EQ(registry.Add("return 1"),
+            "e0e1f9fabfc9d4800c877a703b823ac0578ff8db");
+  const auto sha = registry.Add("return 2");
+  EXPECT_EQ(registry.Add("return 2"), sha);
+  EXPECT_EQ(registry.GetSize(), 2);
+
+  EXPECT_EQ(registry.GetScripts(0),
+            (std::vector<std::string>{"return 1", "return 2"}));
+  EXPECT_EQ(registry.GetScripts(1), std::vector<std::string>{"return 2"});
+  EXPECT_TRUE(registry.GetScripts(2).empty());
+}
+
+USERVER_NAMESPACE_END
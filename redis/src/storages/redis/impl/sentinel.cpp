@@ -1,5 +1,6 @@
 #include <storages/redis/impl/sentinel.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <stdexcept>
 
@@ -16,9 +17,11 @@
 #include <userver/utils/impl/userver_experiments.hpp>
 
 #include <storages/redis/dynamic_config.hpp>
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/cluster_sentinel_impl.hpp>
 #include <storages/redis/impl/command.hpp>
 #include <storages/redis/impl/redis.hpp>
+#include <storages/redis/impl/script_registry.hpp>
 #include <storages/redis/impl/sentinel_impl.hpp>
 #include <storages/redis/impl/sentinel_impl_switcher.hpp>
 #include <storages/redis/impl/subscribe_sentinel.hpp>
@@ -46,10 +49,15 @@ Sentinel::Sentinel(
     ConnectionSecurity connection_security, ReadyChangeCallback ready_callback,
     dynamic_config::Source dynamic_config_source,
     std::unique_ptr<KeyShard>&& key_shard, CommandControl command_control,
-    const testsuite::RedisControl& testsuite_redis_control, ConnectionMode mode)
+    const testsuite::RedisControl& testsuite_redis_control, ConnectionMode mode,
+    std::size_t connections_per_instance)
     : thread_pools_(thread_pools),
       secdist_default_command_control_(command_control),
-      testsuite_redis_control_(testsuite_redis_control) {
+      testsuite_redis_control_(testsuite_redis_control),
+      client_side_cache_(std::make_shared<ClientSideCache>()),
+      script_registry_(std::make_shared<ScriptRegistry>()),
+      connections_per_instance_(std::max<std::size_t>(connections_per_instance,
+                                                      1)) {
   config_default_command_control_.Set(
       std::make_shared<CommandControl>(secdist_default_command_control_));
 
@@ -110,7 +118,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     dynamic_config::Source dynamic_config_source,
     const std::string& client_name, KeyShardFactory key_shard_factory,
     const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::size_t client_side_cache_size, std::size_t connections_per_instance) {
   auto ready_callback = [](size_t shard, const std::string& shard_name,
                            bool ready) {
     LOG_INFO() << "redis: ready_callback:"
@@ -120,7 +129,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
   return CreateSentinel(thread_pools, settings, std::move(shard_group_name),
                         dynamic_config_source, client_name,
                         std::move(ready_callback), std::move(key_shard_factory),
-                        command_control, testsuite_redis_control);
+                        command_control, testsuite_redis_control,
+                        client_side_cache_size, connections_per_instance);
 }
 
 std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
@@ -130,7 +140,8 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
     const std::string& client_name,
     Sentinel::ReadyChangeCallback ready_callback,
     KeyShardFactory key_shard_factory, const CommandControl& command_control,
-    const testsuite::RedisControl& testsuite_redis_control) {
+    const testsuite::RedisControl& testsuite_redis_control,
+    std::size_t client_side_cache_size, std::size_t connections_per_instance) {
   const auto& password = settings.password;
 
   const std::vector<std::string>& shards = settings.shards;
@@ -165,13 +176,23 @@ std::shared_ptr<Sentinel> Sentinel::CreateSentinel(
         thread_pools, shards, conns, std::move(shard_group_name), client_name,
         password, settings.secure_connection, std::move(ready_callback),
         dynamic_config_source, std::move(key_shard), command_control,
-        testsuite_redis_control);
+        testsuite_redis_control, ConnectionMode::kCommands,
+        connections_per_instance);
+    client->SetClientSideCacheSize(client_side_cache_size);
     client->Start();
   }
 
   return client;
 }
 
+void Sentinel::SetClientSideCacheSize(std::size_t max_size) {
+  client_side_cache_->SetMaxSize(max_size);
+}
+
+std::string Sentinel::RegisterScript(std::string script) {
+  return script_registry_->Add(std::move(script));
+}
+
 void Sentinel::Restart() {
   sentinel_thread_control_->RunInEvLoopBlocking([&]() {
     impl_->Stop();
@@ -269,6 +290,8 @@ size_t Sentinel::ShardByKey(const std::string& key) const {
 
 size_t Sentinel::ShardsCount() const { return impl_->ShardsCount(); }
 
+bool Sentinel::IsInClusterMode() const { return impl_->IsInClusterMode(); }
+
 void Sentinel::CheckShardIdx(size_t shard_idx) const {
   CheckShardIdx(shard_idx, ShardsCount());
 }
@@ -288,7 +311,9 @@ const std::string& Sentinel::GetAnyKeyForShard(size_t shard_idx) const {
 
 SentinelStatistics Sentinel::GetStatistics(
     const MetricsSettings& settings) const {
-  return impl_->GetStatistics(settings);
+  auto stats = impl_->GetStatistics(settings);
+  stats.script_timings = script_registry_->GetTimings();
+  return stats;
 }
 
 void Sentinel::SetCommandsBufferingSettings(
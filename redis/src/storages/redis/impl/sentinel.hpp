@@ -42,6 +42,8 @@ const auto kCheckRedisConnectedInterval = std::chrono::seconds(3);
 class SentinelImplBase;
 class SentinelImpl;
 class Shard;
+class ClientSideCache;
+class ScriptRegistry;
 
 class Sentinel {
  public:
@@ -58,7 +60,8 @@ class Sentinel {
            std::unique_ptr<KeyShard>&& key_shard = nullptr,
            CommandControl command_control = {},
            const testsuite::RedisControl& testsuite_redis_control = {},
-           ConnectionMode mode = ConnectionMode::kCommands);
+           ConnectionMode mode = ConnectionMode::kCommands,
+           std::size_t connections_per_instance = 1);
   virtual ~Sentinel();
 
   void Start();
@@ -85,7 +88,9 @@ class Sentinel {
       dynamic_config::Source dynamic_config_source,
       const std::string& client_name, KeyShardFactory key_shard_factory,
       const CommandControl& command_control = {},
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      std::size_t client_side_cache_size = 0,
+      std::size_t connections_per_instance = 1);
   static std::shared_ptr<redis::Sentinel> CreateSentinel(
       const std::shared_ptr<ThreadPools>& thread_pools,
       const secdist::RedisSettings& settings, std::string shard_group_name,
@@ -93,7 +98,9 @@ class Sentinel {
       const std::string& client_name, ReadyChangeCallback ready_callback,
       KeyShardFactory key_shard_factory,
       const CommandControl& command_control = {},
-      const testsuite::RedisControl& testsuite_redis_control = {});
+      const testsuite::RedisControl& testsuite_redis_control = {},
+      std::size_t client_side_cache_size = 0,
+      std::size_t connections_per_instance = 1);
 
   void Restart();
 
@@ -112,6 +119,7 @@ class Sentinel {
 
   size_t ShardByKey(const std::string& key) const;
   size_t ShardsCount() const;
+  bool IsInClusterMode() const;
   void CheckShardIdx(size_t shard_idx) const;
   static void CheckShardIdx(size_t shard_idx, size_t shard_count);
 
@@ -169,14 +177,41 @@ class Sentinel {
   CommandControl GetCommandControl(const CommandControl& cc) const;
   PublishSettings GetPublishSettings() const;
 
+  // Must be called before Start(), the connections track the keys for the
+  // cache only if it was enabled when they were created
+  void SetClientSideCacheSize(std::size_t max_size);
+  const std::shared_ptr<ClientSideCache>& GetClientSideCache() const {
+    return client_side_cache_;
+  }
+
+  /// @returns SHA1 of the script that is loaded by all the connections, see
+  /// ScriptRegistry
+  std::string RegisterScript(std::string script);
+  const std::shared_ptr<ScriptRegistry>& GetScriptRegistry() const {
+    return script_registry_;
+  }
+
+  /// Number of the connections to each master and replica of the shards,
+  /// the commands are balanced among them
+  std::size_t GetConnectionsPerInstance() const {
+    return connections_per_instance_;
+  }
+
   virtual void SetConfigDefaultCommandControl(
       const std::shared_ptr<CommandControl>& cc);
 
-  using UserMessageCallback = std::function<void(const std::string& channel,
-                                                 const std::string& message)>;
-  using UserPmessageCallback =
-      std::function<void(const std::string& pattern, const std::string& channel,
-                         const std::string& message)>;
+  /// Result of passing a message to a subscriber
+  enum class Outcome {
+    kOk,
+    /// The subscriber queue overflowed and a message was discarded
+    kOverflowDiscarded,
+  };
+
+  using UserMessageCallback = std::function<Outcome(
+      const std::string& channel, const std::string& message)>;
+  using UserPmessageCallback = std::function<Outcome(
+      const std::string& pattern, const std::string& channel,
+      const std::string& message)>;
 
   using MessageCallback =
       std::function<void(ServerId server_id, const std::string& channel,
@@ -218,6 +253,9 @@ class Sentinel {
   utils::SwappingSmart<CommandControl> config_default_command_control_;
   std::atomic_int publish_shard_{0};
   testsuite::RedisControl testsuite_redis_control_;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
+  const std::shared_ptr<ScriptRegistry> script_registry_;
+  const std::size_t connections_per_instance_;
 };
 
 }  // namespace redis
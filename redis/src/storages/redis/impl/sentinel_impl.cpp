@@ -5,7 +5,6 @@
 #include <thread>
 
 #include <boost/algorithm/string.hpp>
-#include <boost/crc.hpp>
 
 #include <fmt/format.h>
 
@@ -190,6 +189,12 @@ void SentinelImpl::InitShards(
                                            ready_callback](bool ready) {
       if (ready_callback) ready_callback(i, shard, ready);
     };
+    shard_options.client_side_cache = sentinel_obj_.GetClientSideCache();
+    shard_options.script_registry = sentinel_obj_.GetScriptRegistry();
+    shard_options.connections_per_instance =
+        sentinel_obj_.GetConnectionsPerInstance();
+    shard_options.direct_reply_parsing =
+        connection_mode_ == ConnectionMode::kCommands;
     auto object = std::make_shared<Shard>(std::move(shard_options));
     object->SignalInstanceStateChange().connect(
         [this](ServerId, Redis::State state) {
@@ -922,15 +927,6 @@ size_t SentinelImpl::ParseMovedShard(const std::string& err_string) {
   return shard_info_.GetShard(host, port);
 }
 
-size_t SentinelImpl::HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 SentinelImpl::SlotInfo::SlotInfo() {
   for (size_t i = 0; i < kClusterHashSlots; ++i) {
     slot_to_shard_[i] = kUnknownShard;
@@ -1,5 +1,6 @@
 #include "mock_server_test.hpp"
 
+#include <atomic>
 #include <thread>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -152,6 +153,91 @@ TEST(Redis, PingFail) {
   PeriodicWait([&] { return !IsConnected(*redis); });
 }
 
+TEST(Redis, MaxInFlightAndQueuedCommands) {
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto get_handler =
+      server.RegisterTimeoutHandler("GET", std::chrono::milliseconds{100});
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  redis::RedisCreationSettings redis_settings;
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              redis_settings);
+  redis::CommandsBufferingSettings buffering_settings;
+  buffering_settings.max_in_flight_commands = 1;
+  buffering_settings.max_queued_commands = 2;
+  redis->SetCommandsBufferingSettings(buffering_settings);
+  redis->Connect({kLocalhost}, server.GetPort(), redis::Password(""));
+  PeriodicWait([&] { return IsConnected(*redis); });
+
+  std::atomic<int> replies{0};
+  const auto make_command = [&replies] {
+    return redis::PrepareCommand(
+        {"GET", "123"},
+        [&replies](const redis::CommandPtr&, redis::ReplyPtr reply) {
+          EXPECT_TRUE(reply->IsOk());
+          ++replies;
+        });
+  };
+  for (int i = 0; i < 3; ++i) EXPECT_TRUE(redis->AsyncCommand(make_command()));
+
+  // A single command is sent, the rest wait in the queue
+  PeriodicWait([&] {
+    return redis->GetRunningCommands() == 1 && redis->GetQueuedCommands() == 2;
+  });
+  EXPECT_TRUE(redis->IsOverloaded());
+  EXPECT_FALSE(redis->AsyncCommand(make_command()));
+  EXPECT_EQ(redis->GetStatistics().queue_overflows.load(), 1);
+
+  PeriodicWait([&] { return replies == 3; });
+  EXPECT_EQ(get_handler->GetReplyCount(), 3);
+  EXPECT_EQ(redis->GetQueuedCommands(), 0);
+  EXPECT_FALSE(redis->IsOverloaded());
+}
+
+TEST(Redis, AdaptiveCommandsBuffering) {
+  MockRedisServer server;
+  auto ping_handler = server.RegisterPingHandler();
+  auto get_handler =
+      server.RegisterTimeoutHandler("GET", std::chrono::milliseconds{100});
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  redis::RedisCreationSettings redis_settings;
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              redis_settings);
+  // The plain buffering would hold the commands for the whole interval, far
+  // longer than PeriodicWait waits
+  redis::CommandsBufferingSettings buffering_settings;
+  buffering_settings.buffering_enabled = true;
+  buffering_settings.watch_command_timer_interval = std::chrono::seconds{10};
+  buffering_settings.adaptive = true;
+  redis->SetCommandsBufferingSettings(buffering_settings);
+  redis->Connect({kLocalhost}, server.GetPort(), redis::Password(""));
+  PeriodicWait([&] { return IsConnected(*redis); });
+
+  std::atomic<int> replies{0};
+  const auto make_command = [&replies] {
+    return redis::PrepareCommand(
+        {"GET", "123"},
+        [&replies](const redis::CommandPtr&, redis::ReplyPtr reply) {
+          EXPECT_TRUE(reply->IsOk());
+          ++replies;
+        });
+  };
+
+  // Nothing is pending, the command is sent right away
+  EXPECT_TRUE(redis->AsyncCommand(make_command()));
+  PeriodicWait([&] { return replies == 1; });
+
+  // The commands wait for the pending reply and are sent together after it
+  EXPECT_TRUE(redis->AsyncCommand(make_command()));
+  PeriodicWait([&] { return redis->GetRunningCommands() == 1; });
+  EXPECT_TRUE(redis->AsyncCommand(make_command()));
+  EXPECT_TRUE(redis->AsyncCommand(make_command()));
+  PeriodicWait([&] { return replies == 4; });
+  EXPECT_EQ(get_handler->GetReplyCount(), 4);
+}
+
 class RedisDisconnectingReplies : public ::testing::TestWithParam<const char*> {
 };
 
@@ -1,13 +1,16 @@
 #include <storages/redis/impl/shard.hpp>
 
+#include <algorithm>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <userver/logging/log.hpp>
-#include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
 #include <storages/redis/impl/command.hpp>
+#include <storages/redis/impl/load_balancing.hpp>
 #include <userver/storages/redis/impl/base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -67,7 +70,11 @@ Shard::Shard(Options options)
     : shard_name_(std::move(options.shard_name)),
       shard_group_name_(std::move(options.shard_group_name)),
       ready_change_callback_(std::move(options.ready_change_callback)),
-      cluster_mode_(options.cluster_mode) {
+      client_side_cache_(std::move(options.client_side_cache)),
+      script_registry_(std::move(options.script_registry)),
+      direct_reply_parsing_(options.direct_reply_parsing),
+      cluster_mode_(options.cluster_mode),
+      connections_per_instance_(options.connections_per_instance) {
   for (const auto& conn : options.connection_infos) {
     connection_infos_.emplace_back(conn);
   }
@@ -118,7 +125,8 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 
   switch (command_control.strategy) {
     case CommandControl::Strategy::kEveryDc:
-    case CommandControl::Strategy::kDefault: {
+    case CommandControl::Strategy::kDefault:
+    case CommandControl::Strategy::kPowerOfTwoChoices: {
       std::vector<unsigned char> result(instances_.size(), 0);
       for (size_t i = 0; i < instances_.size(); i++) {
         result[i] =
@@ -174,7 +182,7 @@ std::vector<unsigned char> Shard::GetNearestServersPing(
 std::shared_ptr<Redis> Shard::GetInstance(
     const std::vector<unsigned char>& available_servers,
     bool may_fallback_to_any, size_t skip_idx, bool read_only,
-    size_t* pinstance_idx) {
+    size_t max_running_commands, size_t* pinstance_idx) {
   std::shared_ptr<Redis> instance;
 
   auto end = instances_.size();
@@ -188,9 +196,7 @@ std::shared_ptr<Redis> Shard::GetInstance(
       continue;
 
     const auto& cur_inst = instances_[instance_idx].instance;
-    if (cur_inst && !cur_inst->IsDestroying() &&
-        (cur_inst->GetState() == Redis::State::kConnected) &&
-        !cur_inst->IsSyncing() &&
+    if (cur_inst && IsInstanceAvailable(*cur_inst, max_running_commands) &&
         (!instance || instance->IsDestroying() ||
          cur_inst->GetRunningCommands() < instance->GetRunningCommands())) {
       if (pinstance_idx) *pinstance_idx = instance_idx;
@@ -202,6 +208,28 @@ std::shared_ptr<Redis> Shard::GetInstance(
   return instance;
 }
 
+std::shared_ptr<Redis> Shard::GetLessLoadedInstance(
+    const std::vector<unsigned char>& available_servers, size_t skip_idx,
+    size_t max_running_commands, size_t* pinstance_idx) const {
+  std::vector<size_t> candidates;
+  candidates.reserve(instances_.size());
+  for (size_t i = 0; i < instances_.size(); ++i) {
+    const auto& instance = instances_[i].instance;
+    if (i != skip_idx && available_servers[i] && instance &&
+        IsInstanceAvailable(*instance, max_running_commands)) {
+      candidates.push_back(i);
+    }
+  }
+  if (candidates.empty()) return {};
+
+  const auto idx = candidates[ChooseLessLoadedOfTwo(
+      candidates.size(), [this, &candidates](size_t i) {
+        return GetLoad(*instances_[candidates[i]].instance);
+      })];
+  *pinstance_idx = idx;
+  return instances_[idx].instance;
+}
+
 std::vector<ServerId> Shard::GetAllInstancesServerId() const {
   std::vector<ServerId> ids;
   std::shared_lock lock(mutex_);  // protects instances_
@@ -227,6 +255,20 @@ bool Shard::AsyncCommand(CommandPtr command) {
       !command->read_only || command->control.allow_reads_from_master,
       command->read_only);
 
+  const auto max_running_commands =
+      command->read_only ? command->control.max_running_commands : 0;
+
+  if (command->read_only && command->control.force_server_id.IsAny() &&
+      command->control.strategy ==
+          CommandControl::Strategy::kPowerOfTwoChoices) {
+    instance = GetLessLoadedInstance(available_servers, command->instance_idx,
+                                     max_running_commands, &idx);
+    if (instance) {
+      command->instance_idx = idx;
+      if (instance->AsyncCommand(command)) return true;
+    }
+  }
+
   auto max_attempts = instances_.size() + 1;
   for (size_t attempt = 0; attempt < max_attempts; attempt++) {
     size_t skip_idx = (attempt == 0) ? command->instance_idx : -1;
@@ -240,7 +282,7 @@ bool Shard::AsyncCommand(CommandPtr command) {
         attempt != 0 && command->control.force_server_id.IsAny();
 
     instance = GetInstance(available_servers, may_fallback_to_any, skip_idx,
-                           command->read_only, &idx);
+                           command->read_only, max_running_commands, &idx);
     command->instance_idx = idx;
 
     if (instance) {
@@ -288,8 +330,11 @@ bool Shard::ProcessCreation(
   // https://github.com/boostorg/signals2/issues/59
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDelete)
   for (const auto& id : need_to_create) {
-    const auto redis_settings = RedisCreationSettings{
-        id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly()};
+    auto redis_settings = RedisCreationSettings{
+        id.GetConnectionSecurity(), cluster_mode_ && id.IsReadOnly(),
+        direct_reply_parsing_, {}, script_registry_};
+    if (client_side_cache_ && client_side_cache_->IsEnabled())
+      redis_settings.client_side_cache = client_side_cache_;
     ConnectionStatus entry{
         id, std::make_shared<Redis>(
                 redis_thread_pool,
@@ -396,8 +441,13 @@ ShardStatistics Shard::GetStatistics(bool master,
     if (!instance.instance || instance.info.IsReadOnly() == master) continue;
     auto inst_stats =
         redis::InstanceStatistics(settings, instance.instance->GetStatistics());
+    inst_stats.queued_commands = instance.instance->GetQueuedCommands();
+    inst_stats.running_commands = instance.instance->GetRunningCommands();
     stats.shard_total.Add(inst_stats);
-    stats.instances.emplace(instance.info.Fulltext(), std::move(inst_stats));
+    // The connections to the same instance are reported together
+    const auto [it, inserted] =
+        stats.instances.emplace(instance.info.Fulltext(), inst_stats);
+    if (!inserted) it->second.Add(inst_stats);
     if (instance.instance->GetState() == Redis::State::kConnected) {
       stats.is_ready = true;
     }
@@ -462,13 +512,19 @@ void Shard::SetReplicationMonitoringSettings(
 std::vector<ConnectionInfoInt> Shard::GetConnectionInfosToCreate() const {
   std::shared_lock lock(mutex_);
 
-  auto need_to_create = connection_infos_;
-
-  for (const auto& instance : instances_)
-    utils::Erase(need_to_create, instance.info);
-  for (const auto& instance : clean_wait_)
-    utils::Erase(need_to_create, instance.info);
-
+  std::vector<ConnectionInfoInt> need_to_create;
+  for (const auto& info : connection_infos_) {
+    const auto is_same = [&info](const ConnectionStatus& instance) {
+      return instance.info == info;
+    };
+    const auto count =
+        std::count_if(instances_.begin(), instances_.end(), is_same) +
+        std::count_if(clean_wait_.begin(), clean_wait_.end(), is_same);
+    for (auto i = static_cast<std::size_t>(count);
+         i < connections_per_instance_; ++i) {
+      need_to_create.push_back(info);
+    }
+  }
   return need_to_create;
 }
 
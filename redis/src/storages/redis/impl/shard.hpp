@@ -65,6 +65,10 @@ class Shard {
     bool cluster_mode{false};
     std::function<void(bool ready)> ready_change_callback;
     std::vector<ConnectionInfo> connection_infos;
+    std::shared_ptr<ClientSideCache> client_side_cache;
+    std::shared_ptr<ScriptRegistry> script_registry;
+    bool direct_reply_parsing{false};
+    std::size_t connections_per_instance{1};
   };
 
   explicit Shard(Options options);
@@ -79,7 +83,7 @@ class Shard {
   std::shared_ptr<Redis> GetInstance(
       const std::vector<unsigned char>& available_servers,
       bool may_fallback_to_any, size_t skip_idx, bool read_only,
-      size_t* pinstance_idx);
+      size_t max_running_commands, size_t* pinstance_idx);
   void Clean();
   bool ProcessCreation(
       const std::shared_ptr<engine::ev::ThreadPool>& redis_thread_pool);
@@ -107,6 +111,10 @@ class Shard {
   std::vector<unsigned char> GetNearestServersPing(
       const CommandControl& command_control, bool with_masters,
       bool with_slaves) const;
+  // Chooses an instance for CommandControl::Strategy::kPowerOfTwoChoices
+  std::shared_ptr<Redis> GetLessLoadedInstance(
+      const std::vector<unsigned char>& available_servers, size_t skip_idx,
+      size_t max_running_commands, size_t* pinstance_idx) const;
 
   std::vector<ConnectionInfoInt> GetConnectionInfosToCreate() const;
   bool UpdateCleanWaitQueue(std::vector<ConnectionStatus>&& add_clean_wait);
@@ -125,6 +133,9 @@ class Shard {
   bool destroying_ = false;
 
   const std::function<void(bool ready)> ready_change_callback_;
+  const std::shared_ptr<ClientSideCache> client_side_cache_;
+  const std::shared_ptr<ScriptRegistry> script_registry_;
+  const bool direct_reply_parsing_;
 
   boost::signals2::signal<void(ServerId, Redis::State)>
       signal_instance_state_change_;
@@ -135,6 +146,7 @@ class Shard {
 
   bool prev_connected_ = false;
   const bool cluster_mode_ = false;
+  const std::size_t connections_per_instance_;
 };
 
 }  // namespace redis
@@ -8,6 +8,7 @@ void DumpMetric(utils::statistics::Writer& writer,
                 const PubsubChannelStatistics& stats) {
   writer["messages"]["count"] = stats.messages_count;
   writer["messages"]["alien-count"] = stats.messages_alien_count;
+  writer["messages"]["discarded-count"] = stats.messages_discarded_count;
   writer["messages"]["size"] = stats.messages_size;
 
   if (stats.server_id) {
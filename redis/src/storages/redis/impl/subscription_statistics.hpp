@@ -18,6 +18,7 @@ struct PubsubChannelStatistics {
   size_t messages_count{0};
   size_t messages_size{0};
   size_t messages_alien_count{0};
+  size_t messages_discarded_count{0};
 
   std::optional<ServerId> server_id;
 
@@ -28,11 +29,14 @@ struct PubsubChannelStatistics {
 
   void AccountAlienMessage() { messages_alien_count++; }
 
+  void AccountDiscardedMessage() { messages_discarded_count++; }
+
   PubsubChannelStatistics& operator+=(const PubsubChannelStatistics& other) {
     subscription_timestamp = std::chrono::steady_clock::time_point();
     messages_count += other.messages_count;
     messages_size += other.messages_size;
     messages_alien_count += other.messages_alien_count;
+    messages_discarded_count += other.messages_discarded_count;
     return *this;
   }
 };
@@ -405,15 +405,19 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
   try {
     std::lock_guard<std::mutex> lock(mutex_);
     auto& m = callback_map_.at(channel);
+    auto& info = m.GetInfo(shard_idx);
     for (const auto& it : m.callbacks) {
       try {
-        it.second(channel, message);
+        const auto outcome = it.second(channel, message);
+        if (outcome == Sentinel::Outcome::kOverflowDiscarded) {
+          info.statistics.AccountDiscardedMessage();
+        }
       } catch (const std::exception& e) {
         LOG_ERROR() << "Unhandled exception in subscriber: " << e.what();
       }
     }
 
-    m.GetInfo(shard_idx).AccountMessage(server_id, message.size());
+    info.AccountMessage(server_id, message.size());
   } catch (const std::out_of_range& e) {
     LOG_ERROR() << "Got MESSAGE while not subscribed on it, channel="
                 << channel;
@@ -430,15 +434,19 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
   try {
     std::lock_guard<std::mutex> lock(mutex_);
     auto& m = pattern_callback_map_.at(pattern);
+    auto& info = m.GetInfo(shard_idx);
     for (const auto& it : m.callbacks) {
       try {
-        it.second(pattern, channel, message);
+        const auto outcome = it.second(pattern, channel, message);
+        if (outcome == Sentinel::Outcome::kOverflowDiscarded) {
+          info.statistics.AccountDiscardedMessage();
+        }
       } catch (const std::exception& e) {
         LOG_ERROR() << "Unhandled exception in subscriber: " << e.what();
       }
     }
 
-    m.GetInfo(shard_idx).AccountMessage(server_id, message.size());
+    info.AccountMessage(server_id, message.size());
   } catch (const std::out_of_range& e) {
     LOG_ERROR() << "Got PMESSAGE while not subscribed on it, channel="
                 << channel;
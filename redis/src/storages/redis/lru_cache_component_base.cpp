@@ -0,0 +1,140 @@
+#include <userver/storages/redis/lru_cache_component_base.hpp>
+
+#include <cmath>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/storages/redis/component.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::impl {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDefaultTimeout{100};
+constexpr double kDefaultXfetchBeta = 1.0;
+
+const std::string kValue = "value";
+const std::string kDelta = "delta_ms";
+const std::string kExpiry = "expiry_ms";
+
+}  // namespace
+
+RedisCacheSettings::RedisCacheSettings(
+    const components::ComponentConfig& config)
+    : key_prefix(config["redis-key-prefix"].As<std::string>(
+          components::GetCurrentComponentName(config) + ':')),
+      lifetime(config["redis-lifetime"].As<std::chrono::milliseconds>()),
+      xfetch_beta(config["xfetch-beta"].As<double>(kDefaultXfetchBeta)),
+      command_control(
+          config["redis-timeout"].As<std::chrono::milliseconds>(
+              kDefaultTimeout),
+          config["redis-timeout"].As<std::chrono::milliseconds>(
+              kDefaultTimeout),
+          1) {
+  if (lifetime <= std::chrono::milliseconds::zero()) {
+    throw std::runtime_error("'redis-lifetime' must be positive");
+  }
+  if (xfetch_beta < 0) {
+    throw std::runtime_error("'xfetch-beta' must not be negative");
+  }
+}
+
+ClientPtr FindRedisClient(const components::ComponentConfig& config,
+                          const components::ComponentContext& context) {
+  return context
+      .FindComponent<components::Redis>(
+          config["redis-component"].As<std::string>(components::Redis::kName))
+      .GetClient(config["redis-db"].As<std::string>());
+}
+
+utils::statistics::Entry RegisterRedisTierStatistics(
+    const components::ComponentContext& context, const std::string& name,
+    const cache::impl::ExpirableLruCacheStatistics& statistics) {
+  return context.FindComponent<components::StatisticsStorage>()
+      .GetStorage()
+      .RegisterWriter(
+          "cache",
+          [&statistics](utils::statistics::Writer& writer) {
+            writer = statistics;
+          },
+          {{"cache_name", name}, {"cache_tier", "redis"}});
+}
+
+std::string SerializeRedisCacheEntry(const RedisCacheEntry& entry) {
+  formats::json::ValueBuilder builder;
+  builder[kValue] = entry.value;
+  builder[kDelta] = entry.delta.count();
+  builder[kExpiry] = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         entry.expiry.time_since_epoch())
+                         .count();
+  return formats::json::ToString(builder.ExtractValue());
+}
+
+std::optional<RedisCacheEntry> ParseRedisCacheEntry(std::string_view data) {
+  try {
+    const auto json = formats::json::FromString(data);
+    RedisCacheEntry entry;
+    entry.value = json[kValue];
+    entry.delta = std::chrono::milliseconds{json[kDelta].As<std::int64_t>()};
+    entry.expiry = std::chrono::system_clock::time_point{
+        std::chrono::milliseconds{json[kExpiry].As<std::int64_t>()}};
+    if (entry.value.IsMissing()) return std::nullopt;
+    return entry;
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to parse the cached value: " << e;
+    return std::nullopt;
+  }
+}
+
+bool ShouldRecomputeEarly(const RedisCacheEntry& entry, double beta) {
+  const auto now = std::chrono::system_clock::now();
+  if (beta <= 0) return now >= entry.expiry;
+  // -log(U) for U uniform in (0, 1] is exponentially distributed
+  const auto gap = -std::log(1.0 - utils::RandRange(1.0)) * beta *
+                   static_cast<double>(entry.delta.count());
+  return now + std::chrono::milliseconds{static_cast<std::int64_t>(gap)} >=
+         entry.expiry;
+}
+
+const std::string& GetRedisLruCacheComponentSchema() {
+  static const std::string kSchema = R"(
+type: object
+description: LRU cache component with the second tier in redis
+additionalProperties: false
+properties:
+    redis-component:
+        type: string
+        description: name of the redis component
+        defaultDescription: redis
+    redis-db:
+        type: string
+        description: name of the redis database
+    redis-key-prefix:
+        type: string
+        description: prefix of the redis keys
+        defaultDescription: the component name and ':'
+    redis-lifetime:
+        type: string
+        description: TTL of the values in redis
+    redis-timeout:
+        type: string
+        description: timeout of a single redis request
+        defaultDescription: 100ms
+    xfetch-beta:
+        type: number
+        description: |
+            XFetch coefficient, greater values recompute earlier, 0 disables
+            the early expiration
+        defaultDescription: 1.0
+        minimum: 0
+)";
+  return kSchema;
+}
+
+}  // namespace storages::redis::impl
+
+USERVER_NAMESPACE_END
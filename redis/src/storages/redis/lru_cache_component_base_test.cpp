@@ -0,0 +1,63 @@
+#include <userver/storages/redis/lru_cache_component_base.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+storages::redis::impl::RedisCacheEntry MakeEntry(
+    std::chrono::milliseconds delta, std::chrono::milliseconds expires_in) {
+  storages::redis::impl::RedisCacheEntry entry;
+  entry.value = formats::json::FromString(R"({"field": [1, 2]})");
+  entry.delta = delta;
+  entry.expiry = std::chrono::system_clock::now() + expires_in;
+  return entry;
+}
+
+}  // namespace
+
+TEST(RedisLruCacheComponent, SerializeEntry) {
+  const auto entry =
+      MakeEntry(std::chrono::milliseconds{42}, std::chrono::minutes{1});
+  const auto parsed = storages::redis::impl::ParseRedisCacheEntry(
+      storages::redis::impl::SerializeRedisCacheEntry(entry));
+  ASSERT_TRUE(parsed);
+  EXPECT_EQ(parsed->value, entry.value);
+  EXPECT_EQ(parsed->delta, entry.delta);
+  EXPECT_EQ(std::chrono::duration_cast<std::chrono::milliseconds>(
+                parsed->expiry - entry.expiry),
+            std::chrono::milliseconds{0});
+
+  EXPECT_FALSE(storages::redis::impl::ParseRedisCacheEntry("not json"));
+  EXPECT_FALSE(storages::redis::impl::ParseRedisCacheEntry(R"({"other": 1})"));
+}
+
+TEST(RedisLruCacheComponent, RecomputeEarly) {
+  using storages::redis::impl::ShouldRecomputeEarly;
+
+  const auto expired =
+      MakeEntry(std::chrono::milliseconds{1}, -std::chrono::seconds{1});
+  EXPECT_TRUE(ShouldRecomputeEarly(expired, 1.0));
+
+  // Far from the expiry compared to the computation time
+  const auto fresh =
+      MakeEntry(std::chrono::milliseconds{1}, std::chrono::hours{1});
+  EXPECT_FALSE(ShouldRecomputeEarly(fresh, 1.0));
+
+  // Close to the expiry compared to the computation time
+  const auto expiring =
+      MakeEntry(std::chrono::hours{1}, std::chrono::milliseconds{1});
+  int recomputed = 0;
+  for (int i = 0; i < 100; ++i) {
+    recomputed += ShouldRecomputeEarly(expiring, 1.0);
+  }
+  EXPECT_GT(recomputed, 90);
+
+  // Disabled
+  EXPECT_FALSE(ShouldRecomputeEarly(expiring, 0.0));
+}
+
+USERVER_NAMESPACE_END
@@ -227,6 +227,38 @@ std::vector<GeoPoint> ParseReplyDataArray(
   return result;
 }
 
+std::vector<StreamEntry> ParseReplyDataArray(
+    ReplyData&& array_data, const std::string& request_description,
+    To<std::vector<StreamEntry>>) {
+  auto& array = array_data.GetArray();
+  std::vector<StreamEntry> result;
+  result.reserve(array.size());
+
+  for (auto& elem : array) {
+    elem.ExpectArray(request_description);
+    auto& id_fields = elem.GetArray();
+    if (id_fields.size() != 2) {
+      throw USERVER_NAMESPACE::redis::ParseReplyException(
+          "Unexpected reply to '" + request_description +
+          "'. Expected stream entry of 2 elements, got " +
+          elem.ToDebugString());
+    }
+    id_fields[0].ExpectString(request_description);
+
+    StreamEntry entry;
+    entry.id = std::move(id_fields[0].GetString());
+    // XAUTOCLAIM of Redis 6.2 returns nil fields for the deleted entries
+    if (!id_fields[1].IsNil()) {
+      id_fields[1].ExpectArray(request_description);
+      entry.fields = ParseReplyDataArray(
+          std::move(id_fields[1]), request_description,
+          To<std::vector<std::pair<std::string, std::string>>>{});
+    }
+    result.push_back(std::move(entry));
+  }
+  return result;
+}
+
 std::string Parse(ReplyData&& reply_data,
                   const std::string& request_description, To<std::string>) {
   reply_data.ExpectString(request_description);
@@ -383,6 +415,64 @@ ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) {
   return std::move(reply_data);
 }
 
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>) {
+  reply_data.ExpectArray(request_description);
+  auto& array = reply_data.GetArray();
+  // Redis 7 adds the ids of the deleted entries as the third element
+  if (array.size() < 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected at least 2 elements, got " + reply_data.ToDebugString());
+  }
+
+  XautoclaimReply result;
+  result.next_start_id =
+      Parse(std::move(array[0]), request_description, To<std::string>{});
+  result.entries = Parse(std::move(array[1]), request_description,
+                         To<std::vector<StreamEntry>>{});
+  return result;
+}
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>) {
+  if (reply_data.IsError() &&
+      reply_data.GetError().rfind("BUSYGROUP", 0) == 0) {
+    return XgroupCreateReply::kAlreadyExists;
+  }
+  reply_data.ExpectStatusEqualTo(kOk, request_description);
+  return XgroupCreateReply::kCreated;
+}
+
+std::vector<StreamEntry> Parse(ReplyData&& reply_data,
+                               const std::string& request_description,
+                               To<XreadgroupReply, std::vector<StreamEntry>>) {
+  if (reply_data.IsNil()) return {};
+  reply_data.ExpectArray(request_description);
+  auto& streams = reply_data.GetArray();
+  if (streams.empty()) return {};
+  if (streams.size() != 1) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected entries of a single stream, got " +
+        reply_data.ToDebugString());
+  }
+
+  // [[stream, [entries...]]]
+  streams[0].ExpectArray(request_description);
+  auto& stream_entries = streams[0].GetArray();
+  if (stream_entries.size() != 2) {
+    throw USERVER_NAMESPACE::redis::ParseReplyException(
+        "Unexpected reply to '" + request_description +
+        "'. Expected stream name and entries, got " +
+        streams[0].ToDebugString());
+  }
+  return Parse(std::move(stream_entries[1]), request_description,
+               To<std::vector<StreamEntry>>{});
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -86,6 +86,46 @@ UTEST_P_MT(RedisPubsubTestBasic, SimplePsubscribe, 2) {
   token.Unsubscribe();
 }
 
+UTEST_P_MT(RedisPubsubTestBasic, SimpleSubscribeBatched, 2) {
+  const std::string test_data = "something_else";
+  const std::string test_channel = "interior";
+
+  engine::SingleConsumerEvent success;
+
+  auto callback = [&](const std::string& channel,
+                      std::vector<std::string> messages) {
+    EXPECT_FALSE(messages.empty());
+    EXPECT_LE(messages.size(), 2);
+    if (channel == test_channel &&
+        std::all_of(messages.begin(), messages.end(),
+                    [&](const auto& data) { return data == test_data; })) {
+      success.Send();
+    }
+  };
+
+  auto sender = utils::CriticalAsync("sender", [&]() {
+    while (!engine::current_task::ShouldCancel()) {
+      for (int i = 0; i < 5; ++i) {
+        GetClient()->Publish(test_channel, test_data, {});
+      }
+      engine::InterruptibleSleepFor(std::chrono::seconds{1});
+    }
+  });
+
+  storages::redis::BatchedSubscriptionSettings settings;
+  settings.max_batch_size = 2;
+  redis::CommandControl cc{GetParam()};
+  auto token = GetSubscribeClient()->SubscribeBatched(
+      test_channel, std::move(callback), settings, cc);
+
+  std::chrono::seconds deadwait{15};
+  EXPECT_TRUE(success.WaitForEventFor(deadwait))
+      << "Couldn't receive message for " << deadwait.count() << " seconds";
+
+  sender.RequestCancel();
+  token.Unsubscribe();
+}
+
 namespace {
 
 std::vector<redis::CommandControl> BuildTestData() {
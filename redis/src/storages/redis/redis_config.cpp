@@ -54,6 +54,8 @@ USERVER_NAMESPACE::redis::CommandControl Parse(
         throw ParseConfigException(
             "Invalid max_ping_latency in redis CommandControl");
       }
+    } else if (name == "max_running_commands") {
+      response.max_running_commands = it->As<size_t>();
     } else if (name == "allow_reads_from_master") {
       response.allow_reads_from_master = it->As<bool>();
     } else {
@@ -93,6 +95,12 @@ USERVER_NAMESPACE::redis::CommandsBufferingSettings Parse(
       elem["commands_buffering_threshold"].As<size_t>(0);
   result.watch_command_timer_interval = std::chrono::microseconds(
       elem["watch_command_timer_interval_us"].As<size_t>());
+  result.adaptive = elem["adaptive"].As<bool>(result.adaptive);
+  result.commands_buffering_bytes_threshold =
+      elem["commands_buffering_bytes_threshold"].As<size_t>(0);
+  result.max_queued_commands = elem["max_queued_commands"].As<size_t>(0);
+  result.max_in_flight_commands =
+      elem["max_in_flight_commands"].As<size_t>(0);
   return result;
 }
 
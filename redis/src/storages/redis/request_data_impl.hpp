@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -11,6 +17,8 @@
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
+#include <storages/redis/impl/client_side_cache.hpp>
+
 #include "client_impl.hpp"
 #include "scan_reply.hpp"
 
@@ -73,6 +81,40 @@ class RequestDataImpl final : public RequestDataImplBase,
   ReplyPtr GetRaw() override { return GetReply(); }
 };
 
+template <typename Result, typename ReplyType>
+class CachingRequestDataImpl final : public RequestDataImplBase,
+                                     public RequestDataBase<ReplyType> {
+ public:
+  CachingRequestDataImpl(
+      USERVER_NAMESPACE::redis::Request&& request,
+      std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache,
+      std::string key, std::optional<std::string> field,
+      std::uint64_t generation)
+      : RequestDataImplBase(std::move(request)),
+        cache_(std::move(cache)),
+        key_(std::move(key)),
+        field_(std::move(field)),
+        generation_(generation) {}
+
+  void Wait() override { impl::Wait(GetRequest()); }
+
+  ReplyType Get(const std::string& request_description) override {
+    return ParseReply<Result, ReplyType>(GetRaw(), request_description);
+  }
+
+  ReplyPtr GetRaw() override {
+    auto reply = GetReply();
+    cache_->Store(key_, field_, reply, generation_);
+    return reply;
+  }
+
+ private:
+  const std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache_;
+  const std::string key_;
+  const std::optional<std::string> field_;
+  const std::uint64_t generation_;
+};
+
 template <typename Result, typename ReplyType>
 class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
@@ -105,6 +147,124 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   std::vector<RequestDataPtr> requests_;
 };
 
+/// Requests of a multi-key command split by the shards (or the hash slots in
+/// the cluster mode) of its keys. The replies are merged back in the order of
+/// the keys of the command.
+template <typename Result, typename ReplyType>
+class ScatterGatherRequestDataImpl final : public RequestDataBase<ReplyType> {
+  using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
+
+ public:
+  ScatterGatherRequestDataImpl(std::vector<RequestDataPtr>&& requests,
+                               std::vector<std::vector<size_t>>&& key_indices,
+                               size_t keys_count)
+      : requests_(std::move(requests)),
+        key_indices_(std::move(key_indices)),
+        keys_count_(keys_count) {
+    UASSERT(requests_.size() == key_indices_.size());
+  }
+
+  void Wait() override {
+    for (auto& request : requests_) {
+      request->Wait();
+    }
+  }
+
+  ReplyType Get(const std::string& request_description) override {
+    if constexpr (std::is_void_v<ReplyType>) {
+      GetAll(request_description,
+             [&](size_t i) { requests_[i]->Get(request_description); });
+    } else if constexpr (std::is_arithmetic_v<ReplyType>) {
+      ReplyType result{};
+      GetAll(request_description, [&](size_t i) {
+        result += requests_[i]->Get(request_description);
+      });
+      return result;
+    } else {
+      ReplyType result(keys_count_);
+      GetAll(request_description, [&](size_t i) {
+        auto data = requests_[i]->Get(request_description);
+        const auto& indices = key_indices_[i];
+        UINVARIANT(data.size() == indices.size(),
+                   "Unexpected reply size for a part of a multi-key command");
+        for (size_t j = 0; j < indices.size(); ++j) {
+          result[indices[j]] = std::move(data[j]);
+        }
+      });
+      return result;
+    }
+  }
+
+  // Merges the raw replies the same way as Get() does. A failed part is
+  // returned as is, so that the caller reports it.
+  ReplyPtr GetRaw() override {
+    std::vector<ReplyPtr> replies;
+    replies.reserve(requests_.size());
+    for (auto& request : requests_) {
+      replies.push_back(request->GetRaw());
+    }
+    for (auto& reply : replies) {
+      if (!reply->IsOk() || reply->data.IsError()) return std::move(reply);
+    }
+    UINVARIANT(!replies.empty(), "Multi-key command without parts");
+
+    const auto& cmd = replies.front()->cmd;
+    if (replies.front()->data.IsArray()) {
+      USERVER_NAMESPACE::redis::ReplyData::Array result(
+          keys_count_, USERVER_NAMESPACE::redis::ReplyData::CreateNil());
+      for (size_t i = 0; i < replies.size(); ++i) {
+        auto& data = replies[i]->data;
+        const auto& indices = key_indices_[i];
+        UINVARIANT(data.IsArray() && data.GetArray().size() == indices.size(),
+                   "Unexpected reply size for a part of a multi-key command");
+        for (size_t j = 0; j < indices.size(); ++j) {
+          result[indices[j]] = std::move(data.GetArray()[j]);
+        }
+      }
+      return std::make_shared<USERVER_NAMESPACE::redis::Reply>(
+          cmd, std::move(result));
+    }
+    if (replies.front()->data.IsInt()) {
+      int64_t result = 0;
+      for (const auto& reply : replies) {
+        UINVARIANT(reply->data.IsInt(),
+                   "Unexpected reply type for a part of a multi-key command");
+        result += reply->data.GetInt();
+      }
+      return std::make_shared<USERVER_NAMESPACE::redis::Reply>(
+          cmd, USERVER_NAMESPACE::redis::ReplyData::CreateInteger(result));
+    }
+    // Status replies, e.g. 'OK' of MSET: every part has succeeded
+    return replies.front();
+  }
+
+ private:
+  // Every part is waited for before the first failure is rethrown, so that
+  // the failed parts are reported together
+  template <typename GetPart>
+  void GetAll(const std::string& request_description, GetPart get_part) {
+    std::exception_ptr first_error;
+    size_t failed = 0;
+    for (size_t i = 0; i < requests_.size(); ++i) {
+      try {
+        get_part(i);
+      } catch (const std::exception&) {
+        if (!failed++) first_error = std::current_exception();
+      }
+    }
+    if (failed) {
+      LOG_WARNING() << failed << " of " << requests_.size()
+                    << " parts of request '" << request_description
+                    << "' failed";
+      std::rethrow_exception(first_error);
+    }
+  }
+
+  std::vector<RequestDataPtr> requests_;
+  std::vector<std::vector<size_t>> key_indices_;
+  const size_t keys_count_;
+};
+
 template <typename Result, typename ReplyType>
 class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
  public:
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include <userver/storages/redis/request.hpp>
 
@@ -19,6 +22,18 @@ Request<Result, ReplyType> CreateRequest(
       std::make_unique<RequestDataImpl<Result, ReplyType>>(std::move(request)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache,
+    std::string key, std::optional<std::string> field,
+    std::uint64_t generation, Request<Result, ReplyType>* /* for ADL */) {
+  return Request<Result, ReplyType>(
+      std::make_unique<CachingRequestDataImpl<Result, ReplyType>>(
+          std::move(request), std::move(cache), std::move(key),
+          std::move(field), generation));
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
@@ -34,6 +49,22 @@ Request<Result, ReplyType> CreateAggregateRequest(
           std::move(req_data)));
 }
 
+template <typename Result, typename ReplyType = Result>
+Request<Result, ReplyType> CreateScatterGatherRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& key_indices, size_t keys_count,
+    Request<Result, ReplyType>* /* for ADL */) {
+  std::vector<std::unique_ptr<RequestDataBase<ReplyType>>> req_data;
+  req_data.reserve(requests.size());
+  for (auto& request : requests) {
+    req_data.push_back(std::make_unique<RequestDataImpl<Result, ReplyType>>(
+        std::move(request)));
+  }
+  return Request<Result, ReplyType>(
+      std::make_unique<ScatterGatherRequestDataImpl<Result, ReplyType>>(
+          std::move(req_data), std::move(key_indices), keys_count));
+}
+
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateDummyRequest(
     ReplyPtr&& reply, Request<Result, ReplyType>* /* for ADL */) {
@@ -50,6 +81,18 @@ Request CreateRequest(USERVER_NAMESPACE::redis::Request&& request) {
   return impl::CreateRequest(std::move(request), tmp);
 }
 
+template <typename Request>
+Request CreateCachingRequest(
+    USERVER_NAMESPACE::redis::Request&& request,
+    std::shared_ptr<USERVER_NAMESPACE::redis::ClientSideCache> cache,
+    std::string key, std::optional<std::string> field,
+    std::uint64_t generation) {
+  Request* tmp = nullptr;
+  return impl::CreateCachingRequest(std::move(request), std::move(cache),
+                                    std::move(key), std::move(field),
+                                    generation, tmp);
+}
+
 template <typename Request>
 Request CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests) {
@@ -57,6 +100,15 @@ Request CreateAggregateRequest(
   return impl::CreateAggregateRequest(std::move(requests), tmp);
 }
 
+template <typename Request>
+Request CreateScatterGatherRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& key_indices, size_t keys_count) {
+  Request* tmp = nullptr;
+  return impl::CreateScatterGatherRequest(
+      std::move(requests), std::move(key_indices), keys_count, tmp);
+}
+
 template <typename Request>
 Request CreateDummyRequest(ReplyPtr reply) {
   Request* tmp = nullptr;
@@ -1,8 +1,25 @@
 #include <userver/storages/redis/mock_request.hpp>
 #include <userver/storages/redis/request.hpp>
 
+#include <storages/redis/request_data_impl.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+using USERVER_NAMESPACE::redis::Reply;
+using USERVER_NAMESPACE::redis::ReplyData;
+
+template <typename ReplyType>
+std::unique_ptr<storages::redis::RequestDataBase<ReplyType>> MakePart(
+    ReplyData&& data) {
+  return std::make_unique<
+      storages::redis::DummyRequestDataImpl<ReplyType, ReplyType>>(
+      std::make_shared<Reply>("cmd", std::move(data)));
+}
+
+}  // namespace
+
 TEST(ScanRequest, PostfixIncrementCorrect) {
   auto scan_request =
       storages::redis::CreateMockRequestScan<storages::redis::ScanTag::kScan>(
@@ -15,4 +32,46 @@ TEST(ScanRequest, PostfixIncrementCorrect) {
   EXPECT_EQ(it, scan_request.end());
 }
 
+TEST(ScatterGatherRequest, GetRawArray) {
+  using ReplyType = std::vector<std::optional<std::string>>;
+  std::vector<std::unique_ptr<storages::redis::RequestDataBase<ReplyType>>>
+      parts;
+  parts.push_back(MakePart<ReplyType>(
+      ReplyData::Array{ReplyData{"a"}, ReplyData::CreateNil()}));
+  parts.push_back(MakePart<ReplyType>(ReplyData::Array{ReplyData{"b"}}));
+
+  storages::redis::ScatterGatherRequestDataImpl<ReplyType, ReplyType> request{
+      std::move(parts), {{0, 2}, {1}}, 3};
+  const auto reply = request.GetRaw();
+  ASSERT_TRUE(reply->data.IsArray());
+  ASSERT_EQ(reply->data.GetArray().size(), 3);
+  EXPECT_EQ(reply->data[0].GetString(), "a");
+  EXPECT_EQ(reply->data[1].GetString(), "b");
+  EXPECT_TRUE(reply->data[2].IsNil());
+}
+
+TEST(ScatterGatherRequest, GetRawInteger) {
+  std::vector<std::unique_ptr<storages::redis::RequestDataBase<size_t>>> parts;
+  parts.push_back(MakePart<size_t>(ReplyData::CreateInteger(2)));
+  parts.push_back(MakePart<size_t>(ReplyData::CreateInteger(3)));
+
+  storages::redis::ScatterGatherRequestDataImpl<size_t, size_t> request{
+      std::move(parts), {{0, 1}, {2, 3, 4}}, 5};
+  const auto reply = request.GetRaw();
+  ASSERT_TRUE(reply->data.IsInt());
+  EXPECT_EQ(reply->data.GetInt(), 5);
+}
+
+TEST(ScatterGatherRequest, GetRawError) {
+  std::vector<std::unique_ptr<storages::redis::RequestDataBase<size_t>>> parts;
+  parts.push_back(MakePart<size_t>(ReplyData::CreateInteger(2)));
+  parts.push_back(MakePart<size_t>(ReplyData::CreateError("ERR failed")));
+
+  storages::redis::ScatterGatherRequestDataImpl<size_t, size_t> request{
+      std::move(parts), {{0}, {1}}, 2};
+  const auto reply = request.GetRaw();
+  ASSERT_TRUE(reply->data.IsError());
+  EXPECT_EQ(reply->data.GetError(), "ERR failed");
+}
+
 USERVER_NAMESPACE_END
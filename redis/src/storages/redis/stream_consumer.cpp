@@ -0,0 +1,207 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <shared_mutex>
+#include <utility>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+namespace {
+
+constexpr std::string_view kProcessRedisStreamEntries =
+    "process redis stream entries";
+
+// XREADGROUP id of the entries never delivered to the other consumers
+const std::string kNewEntriesId = ">";
+
+// XGROUP CREATE id of the last entry of the stream
+const std::string kLastEntryId = "$";
+
+}  // namespace
+
+StreamConsumer::StreamConsumer(ClientPtr client,
+                               StreamConsumerSettings settings,
+                               engine::TaskProcessor& task_processor,
+                               Callback callback)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      callback_(std::move(callback)),
+      batches_semaphore_(std::max<std::size_t>(settings_.max_concurrent_batches,
+                                               1)),
+      batch_tasks_(task_processor),
+      consumer_task_(
+          utils::CriticalAsync("redis-stream-consumer-" + settings_.stream,
+                               [this] { Run(); })) {
+  UASSERT(client_);
+  UASSERT(callback_);
+}
+
+StreamConsumer::~StreamConsumer() { Stop(); }
+
+void StreamConsumer::Stop() noexcept {
+  if (consumer_task_.IsValid()) consumer_task_.SyncCancel();
+  batch_tasks_.CancelAndWait();
+  try {
+    FlushAcks();
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to acknowledge the entries of redis stream '"
+                  << settings_.stream << "': " << e;
+  }
+}
+
+void StreamConsumer::Run() {
+  if (settings_.create_group) CreateGroup();
+
+  auto next_claim = std::chrono::steady_clock::now();
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      const auto now = std::chrono::steady_clock::now();
+      if (settings_.claim_interval.count() && now >= next_claim) {
+        ClaimPending();
+        next_claim = now + settings_.claim_interval;
+      }
+
+      FlushAcks();
+      auto entries =
+          client_
+              ->Xreadgroup(settings_.stream, settings_.group,
+                           settings_.consumer, kNewEntriesId,
+                           {settings_.batch_size, false},
+                           settings_.command_control)
+              .Get();
+      if (entries.empty()) {
+        engine::InterruptibleSleepFor(settings_.poll_interval);
+        continue;
+      }
+      Dispatch(std::move(entries));
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_WARNING() << "Failed to read redis stream '" << settings_.stream
+                    << "' as consumer '" << settings_.consumer
+                    << "' of group '" << settings_.group << "': " << e;
+      engine::InterruptibleSleepFor(settings_.poll_interval);
+    }
+  }
+}
+
+void StreamConsumer::CreateGroup() {
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      client_
+          ->XgroupCreate(settings_.stream, settings_.group, kLastEntryId,
+                         {/*mkstream=*/true}, settings_.command_control)
+          .Get();
+      return;
+    } catch (const std::exception& e) {
+      LOG_WARNING() << "Failed to create group '" << settings_.group
+                    << "' of redis stream '" << settings_.stream << "': " << e;
+      engine::InterruptibleSleepFor(settings_.poll_interval);
+    }
+  }
+}
+
+void StreamConsumer::ClaimPending() {
+  auto reply = client_
+                   ->Xautoclaim(settings_.stream, settings_.group,
+                                settings_.consumer,
+                                settings_.claim_min_idle_time, claim_start_id_,
+                                {settings_.batch_size},
+                                settings_.command_control)
+                   .Get();
+  // The scan of the pending entries list continues on the next claim
+  claim_start_id_ = std::move(reply.next_start_id);
+  if (!reply.entries.empty()) {
+    LOG_INFO() << "Claimed " << reply.entries.size()
+               << " pending entries of redis stream '" << settings_.stream
+               << "'";
+    Dispatch(std::move(reply.entries));
+  }
+}
+
+void StreamConsumer::Dispatch(std::vector<StreamEntry> entries) {
+  // The entries deleted from the stream are only acknowledged
+  const auto deleted_begin = std::stable_partition(
+      entries.begin(), entries.end(),
+      [](const auto& entry) { return !entry.fields.empty(); });
+  if (deleted_begin != entries.end()) {
+    std::vector<std::string> ids;
+    for (auto it = deleted_begin; it != entries.end(); ++it) {
+      ids.push_back(std::move(it->id));
+    }
+    entries.erase(deleted_begin, entries.end());
+    Acknowledge(std::move(ids));
+  }
+  if (entries.empty()) return;
+
+  // Stops reading the stream while all the batches are busy
+  std::shared_lock lock(batches_semaphore_);
+  batch_tasks_.AsyncDetach(
+      "redis-stream-batch-" + settings_.stream,
+      [this, lock = std::move(lock), entries = std::move(entries)]() mutable {
+        ProcessBatch(std::move(entries));
+      });
+}
+
+void StreamConsumer::ProcessBatch(std::vector<StreamEntry> entries) {
+  std::vector<std::string> ids;
+  ids.reserve(entries.size());
+  for (const auto& entry : entries) ids.push_back(entry.id);
+
+  tracing::Span span(std::string{kProcessRedisStreamEntries});
+  span.AddTag("count", entries.size());
+  try {
+    callback_(std::move(entries));
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to process " << ids.size()
+                  << " entries of redis stream '" << settings_.stream
+                  << "', they will be claimed after "
+                  << settings_.claim_min_idle_time.count() << "ms: " << e;
+    return;
+  }
+  Acknowledge(std::move(ids));
+}
+
+void StreamConsumer::Acknowledge(std::vector<std::string> ids) {
+  std::unique_lock lock(acks_mutex_);
+  if (pending_acks_.empty()) {
+    pending_acks_ = std::move(ids);
+  } else {
+    pending_acks_.insert(pending_acks_.end(),
+                         std::make_move_iterator(ids.begin()),
+                         std::make_move_iterator(ids.end()));
+  }
+  if (pending_acks_.size() < settings_.ack_batch_size) return;
+
+  auto acks = std::exchange(pending_acks_, {});
+  lock.unlock();
+  SendAcks(std::move(acks));
+}
+
+void StreamConsumer::FlushAcks() {
+  std::unique_lock lock(acks_mutex_);
+  auto acks = std::exchange(pending_acks_, {});
+  lock.unlock();
+  if (!acks.empty()) SendAcks(std::move(acks));
+}
+
+void StreamConsumer::SendAcks(std::vector<std::string> ids) {
+  // Not waited for, so that the XACKs are pipelined with the other commands
+  client_
+      ->Xack(settings_.stream, settings_.group, std::move(ids),
+             settings_.command_control)
+      .IgnoreResult();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,97 @@
+#include <storages/redis/client_redistest.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/storages/redis/stream_consumer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+storages::redis::StreamConsumerSettings MakeSettings() {
+  storages::redis::StreamConsumerSettings settings;
+  settings.stream = "stream";
+  settings.group = "group";
+  settings.consumer = "consumer";
+  settings.batch_size = 10;
+  settings.poll_interval = std::chrono::milliseconds{10};
+  settings.ack_batch_size = 1;
+  return settings;
+}
+
+}  // namespace
+
+UTEST_F(RedisClientTest, StreamConsumer) {
+  Version since{6, 2, 0};
+  if (!CheckVersion(since))
+    GTEST_SKIP() << SkipMsgByVersion("Xautoclaim", since);
+
+  auto client = GetClient();
+  client->XgroupCreate("stream", "group", "$", {true}, {}).Get();
+
+  constexpr std::size_t kEntries = 25;
+  std::atomic<std::size_t> received{0};
+  engine::SingleConsumerEvent done;
+
+  auto settings = MakeSettings();
+  settings.max_concurrent_batches = 2;
+  storages::redis::StreamConsumer consumer(
+      client, settings, engine::current_task::GetTaskProcessor(),
+      [&](std::vector<storages::redis::StreamEntry> entries) {
+        EXPECT_LE(entries.size(), 10);
+        if ((received += entries.size()) == kEntries) done.Send();
+      });
+
+  for (std::size_t i = 0; i < kEntries; ++i) {
+    client->Xadd("stream", {{"index", std::to_string(i)}}, {}).Get();
+  }
+
+  ASSERT_TRUE(done.WaitForEventFor(utest::kMaxTestWaitTime));
+  consumer.Stop();
+  EXPECT_EQ(received.load(), kEntries);
+
+  // Everything is acknowledged
+  const auto pending = GetSentinel()
+                           ->MakeRequest({"xpending", "stream", "group"},
+                                         "stream", true)
+                           .Get();
+  ASSERT_TRUE(pending->data.IsArray());
+  EXPECT_EQ(pending->data.GetArray().at(0).GetInt(), 0);
+}
+
+UTEST_F(RedisClientTest, StreamConsumerRetry) {
+  Version since{6, 2, 0};
+  if (!CheckVersion(since))
+    GTEST_SKIP() << SkipMsgByVersion("Xautoclaim", since);
+
+  auto client = GetClient();
+  client->XgroupCreate("stream", "group", "$", {true}, {}).Get();
+  const auto id = client->Xadd("stream", {{"field", "value"}}, {}).Get();
+
+  std::atomic<int> calls{0};
+  engine::SingleConsumerEvent done;
+
+  auto settings = MakeSettings();
+  settings.claim_interval = std::chrono::milliseconds{10};
+  settings.claim_min_idle_time = std::chrono::milliseconds{0};
+  storages::redis::StreamConsumer consumer(
+      client, settings, engine::current_task::GetTaskProcessor(),
+      [&](std::vector<storages::redis::StreamEntry> entries) {
+        ASSERT_EQ(entries.size(), 1);
+        EXPECT_EQ(entries[0].id, id);
+        if (++calls == 1) throw std::runtime_error("processing failed");
+        done.Send();
+      });
+
+  // The failed entry is claimed and processed again
+  ASSERT_TRUE(done.WaitForEventFor(utest::kMaxTestWaitTime));
+  consumer.Stop();
+  EXPECT_EQ(calls.load(), 2);
+}
+
+USERVER_NAMESPACE_END
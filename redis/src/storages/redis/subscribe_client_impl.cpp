@@ -9,6 +9,19 @@ namespace storages::redis {
 
 SubscribeClient::~SubscribeClient() = default;
 
+SubscriptionToken SubscribeClient::SubscribeBatched(
+    std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+    const BatchedSubscriptionSettings& /*settings*/,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
+  return Subscribe(
+      std::move(channel),
+      [on_messages_cb = std::move(on_messages_cb)](const std::string& channel,
+                                                   const std::string& message) {
+        on_messages_cb(channel, {message});
+      },
+      command_control);
+}
+
 SubscribeClientImpl::SubscribeClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::SubscribeSentinel>
         subscribe_sentinel)
@@ -30,6 +43,15 @@ SubscriptionToken SubscribeClientImpl::Psubscribe(
       command_control)};
 }
 
+SubscriptionToken SubscribeClientImpl::SubscribeBatched(
+    std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+    const BatchedSubscriptionSettings& settings,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control) {
+  return {std::make_unique<BatchedSubscriptionTokenImpl>(
+      *redis_client_, std::move(channel), std::move(on_messages_cb), settings,
+      command_control)};
+}
+
 void SubscribeClientImpl::WaitConnectedOnce(
     USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
   redis_client_->WaitConnectedOnce(wait_connected);
@@ -43,6 +43,11 @@ class SubscribeClientImpl final : public SubscribeClient {
       std::string pattern, SubscriptionToken::OnPmessageCb on_pmessage_cb,
       const USERVER_NAMESPACE::redis::CommandControl& command_control) override;
 
+  SubscriptionToken SubscribeBatched(
+      std::string channel, SubscriptionToken::OnMessagesCb on_messages_cb,
+      const BatchedSubscriptionSettings& settings,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control) override;
+
   size_t ShardsCount() const override;
 
   void WaitConnectedOnce(
@@ -6,6 +6,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+namespace {
+using Outcome = USERVER_NAMESPACE::redis::Sentinel::Outcome;
+}  // namespace
+
 template <typename Item>
 SubscriptionQueue<Item>::SubscriptionQueue(
     USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
@@ -57,7 +61,9 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
               << channel
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
+          return Outcome::kOverflowDiscarded;
         }
+        return Outcome::kOk;
       },
       command_control);
 }
@@ -82,7 +88,9 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
               << channel << "' from pattern '" << pattern
               << "' into subscription queue due to overflow (max length="
               << queue_->GetSoftMaxSize() << ')';
+          return Outcome::kOverflowDiscarded;
         }
+        return Outcome::kOk;
       },
       command_control);
 }
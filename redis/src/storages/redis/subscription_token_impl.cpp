@@ -1,8 +1,10 @@
 #include "subscription_token_impl.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/async.hpp>
 
@@ -14,6 +16,9 @@ namespace {
 constexpr std::string_view kProcessRedisSubscriptionMessage =
     "process redis subscription message";
 
+constexpr std::string_view kProcessRedisSubscriptionMessages =
+    "process redis subscription messages";
+
 }  // namespace
 
 SubscriptionTokenImpl::SubscriptionTokenImpl(
@@ -76,6 +81,93 @@ void PsubscriptionTokenImpl::ProcessMessages() {
   }
 }
 
+BatchedSubscriptionTokenImpl::BatchedSubscriptionTokenImpl(
+    USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+    std::string channel, OnMessagesCb on_messages_cb,
+    const BatchedSubscriptionSettings& settings,
+    const USERVER_NAMESPACE::redis::CommandControl& command_control)
+    : channel_(std::move(channel)),
+      on_messages_cb_(std::move(on_messages_cb)),
+      settings_(settings),
+      max_queue_length_(settings.max_queue_length),
+      token_(std::make_unique<USERVER_NAMESPACE::redis::SubscriptionToken>(
+          subscribe_sentinel.Subscribe(
+              channel_,
+              [this](const std::string&, const std::string& message) {
+                return PushMessage(message);
+              },
+              command_control))),
+      subscriber_task_(
+          utils::CriticalAsync("redis-channel-batched-subscriber-" + channel_,
+                               [this] { ProcessMessages(); })) {}
+
+BatchedSubscriptionTokenImpl::~BatchedSubscriptionTokenImpl() {
+  Unsubscribe();
+}
+
+void BatchedSubscriptionTokenImpl::SetMaxQueueLength(size_t length) {
+  std::lock_guard lock(mutex_);
+  max_queue_length_ = length;
+}
+
+void BatchedSubscriptionTokenImpl::Unsubscribe() {
+  token_->Unsubscribe();
+  subscriber_task_.SyncCancel();
+}
+
+BatchedSubscriptionTokenImpl::Outcome BatchedSubscriptionTokenImpl::PushMessage(
+    const std::string& message) {
+  bool pushed = true;
+  bool overflow = false;
+  {
+    std::lock_guard lock(mutex_);
+    overflow = messages_.size() >= max_queue_length_;
+    if (overflow) {
+      pushed = settings_.overflow_policy ==
+                   BatchedSubscriptionSettings::OverflowPolicy::kDropOldest &&
+               !messages_.empty();
+      if (pushed) messages_.pop_front();
+    }
+    if (pushed) messages_.push_back(message);
+  }
+
+  if (pushed) event_.Send();
+  if (!overflow) return Outcome::kOk;
+
+  // Use SubscriptionToken::SetMaxQueueLength() if limit is too low
+  LOG_LIMITED_WARNING() << "discarded " << (pushed ? "the oldest" : "new")
+                        << " message from channel '" << channel_
+                        << "' due to subscription queue overflow";
+  return Outcome::kOverflowDiscarded;
+}
+
+std::vector<std::string> BatchedSubscriptionTokenImpl::PopMessages() {
+  std::vector<std::string> result;
+  std::lock_guard lock(mutex_);
+  const auto size = settings_.max_batch_size
+                        ? std::min(settings_.max_batch_size, messages_.size())
+                        : messages_.size();
+  result.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    result.push_back(std::move(messages_.front()));
+    messages_.pop_front();
+  }
+  // The rest of the messages are taken without waiting for a new one
+  if (!messages_.empty()) event_.Send();
+  return result;
+}
+
+void BatchedSubscriptionTokenImpl::ProcessMessages() {
+  while (event_.WaitForEvent()) {
+    auto messages = PopMessages();
+    if (messages.empty()) continue;
+
+    tracing::Span span(std::string{kProcessRedisSubscriptionMessages});
+    span.AddTag("count", messages.size());
+    if (on_messages_cb_) on_messages_cb_(channel_, std::move(messages));
+  }
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
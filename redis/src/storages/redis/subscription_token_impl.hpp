@@ -1,8 +1,15 @@
 #pragma once
 
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
 #include <userver/storages/redis/subscription_token.hpp>
 
 #include "subscription_queue.hpp"
@@ -59,6 +66,43 @@ class PsubscriptionTokenImpl final : public impl::SubscriptionTokenImplBase {
   engine::TaskWithResult<void> subscriber_task_;
 };
 
+class BatchedSubscriptionTokenImpl final
+    : public impl::SubscriptionTokenImplBase {
+ public:
+  using OnMessagesCb = SubscriptionToken::OnMessagesCb;
+
+  BatchedSubscriptionTokenImpl(
+      USERVER_NAMESPACE::redis::SubscribeSentinel& subscribe_sentinel,
+      std::string channel, OnMessagesCb on_messages_cb,
+      const BatchedSubscriptionSettings& settings,
+      const USERVER_NAMESPACE::redis::CommandControl& command_control);
+
+  ~BatchedSubscriptionTokenImpl() override;
+
+  void SetMaxQueueLength(size_t length) override;
+
+  void Unsubscribe() override;
+
+ private:
+  using Outcome = USERVER_NAMESPACE::redis::Sentinel::Outcome;
+
+  Outcome PushMessage(const std::string& message);
+  std::vector<std::string> PopMessages();
+  void ProcessMessages();
+
+  std::string channel_;
+  OnMessagesCb on_messages_cb_;
+  const BatchedSubscriptionSettings settings_;
+
+  std::mutex mutex_;
+  std::deque<std::string> messages_;
+  size_t max_queue_length_;
+  engine::SingleConsumerEvent event_;
+
+  std::unique_ptr<USERVER_NAMESPACE::redis::SubscriptionToken> token_;
+  engine::TaskWithResult<void> subscriber_task_;
+};
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -88,6 +88,9 @@ class MockClientBase : public Client,
   RequestScriptLoad ScriptLoad(std::string script, size_t shard,
                                const CommandControl& command_control) override;
 
+  /// @returns SHA1 of the script without loading it
+  std::string RegisterScript(std::string script) override;
+
   RequestExists Exists(std::string key,
                        const CommandControl& command_control) override;
 
@@ -328,6 +331,31 @@ class MockClientBase : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(
+      std::string key,
+      std::vector<std::pair<std::string, std::string>> field_values,
+      const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const XgroupCreateOptions& options,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer, std::string id,
+      const XreadgroupOptions& options,
+      const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
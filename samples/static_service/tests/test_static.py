@@ -27,3 +27,76 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_not_modified(service_client):
+    headers = {'Accept-Encoding': 'identity'}
+    response = await service_client.get('/index.html', headers=headers)
+    assert response.status == 200
+    etag = response.headers['ETag']
+    assert etag.startswith('"') and etag.endswith('"')
+
+    for if_none_match in (etag, f'W/{etag}', f'"other", {etag}', '*'):
+        response = await service_client.get(
+            '/index.html',
+            headers={**headers, 'If-None-Match': if_none_match},
+        )
+        assert response.status == 304
+        assert response.headers['ETag'] == etag
+        assert response.content == b''
+
+    response = await service_client.get(
+        '/index.html', headers={**headers, 'If-None-Match': '"other"'},
+    )
+    assert response.status == 200
+
+
+async def test_precompressed(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'lorem.txt'
+
+    response = await service_client.get(
+        '/lorem.txt', headers={'Accept-Encoding': 'gzip'},
+    )
+    assert response.status == 200
+    assert response.headers['Content-Encoding'] == 'gzip'
+    assert response.headers['Vary'] == 'Accept-Encoding'
+    # the client decompresses the body
+    assert response.content.decode() == file.open().read()
+    gzip_etag = response.headers['ETag']
+    assert gzip_etag.endswith('-gzip"')
+
+    response = await service_client.get(
+        '/lorem.txt', headers={'Accept-Encoding': 'identity'},
+    )
+    assert response.status == 200
+    assert 'Content-Encoding' not in response.headers
+    assert response.headers['Vary'] == 'Accept-Encoding'
+    assert response.content.decode() == file.open().read()
+    assert response.headers['ETag'] != gzip_etag
+
+    # the ETag of the gzip variant does not match the uncompressed one
+    response = await service_client.get(
+        '/lorem.txt',
+        headers={'Accept-Encoding': 'identity', 'If-None-Match': gzip_etag},
+    )
+    assert response.status == 200
+
+    response = await service_client.get(
+        '/lorem.txt',
+        headers={'Accept-Encoding': 'gzip', 'If-None-Match': gzip_etag},
+    )
+    assert response.status == 304
+
+
+async def test_range_is_not_compressed(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'lorem.txt'
+    data = file.open().read().encode()
+
+    response = await service_client.get(
+        '/lorem.txt',
+        headers={'Accept-Encoding': 'gzip', 'Range': 'bytes=6-16'},
+    )
+    assert response.status == 206
+    assert 'Content-Encoding' not in response.headers
+    assert response.headers['Content-Range'] == f'bytes 6-16/{len(data)}'
+    assert response.content == data[6:17]
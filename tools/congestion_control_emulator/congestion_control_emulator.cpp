@@ -3,6 +3,7 @@
 #include <boost/program_options.hpp>
 
 #include <userver/congestion_control/controller.hpp>
+#include <userver/congestion_control/controllers/codel.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -13,12 +14,23 @@ using namespace congestion_control;
 
 struct Config {
   Policy policy;
+  std::string controller = "rps";
+  v2::CoDelController::StaticConfig codel;
   std::string log_level = "none";
 };
 
+class NullSensor final : public v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class NullLimiter final : public Limiter {
+  void SetLimit(const Limit&) override {}
+};
+
 Config ParseArgs(int argc, char* argv[]) {
   Config config;
   std::string policy_json;
+  std::size_t codel_target_ms = config.codel.target.count();
 
   namespace po = boost::program_options;
 
@@ -32,6 +44,16 @@ Config ParseArgs(int argc, char* argv[]) {
     ("policy,p",
      po::value(&policy_json)->default_value(std::string{}),
      "policy in JSON")
+    ("controller,c",
+     po::value(&config.controller)->default_value(config.controller),
+     "controller to emulate: 'rps' reads '<load> <overloads>' lines, "
+     "'codel' reads '<load> <sojourn_ms>' lines")
+    ("codel-target-ms",
+     po::value(&codel_target_ms)->default_value(codel_target_ms),
+     "target queue sojourn time of the codel controller")
+    ("codel-interval",
+     po::value(&config.codel.interval)->default_value(config.codel.interval),
+     "interval of the codel controller, in input lines")
   ;
   // clang-format on
 
@@ -48,9 +70,39 @@ Config ParseArgs(int argc, char* argv[]) {
     config.policy = formats::json::FromString(policy_json).As<Policy>();
   }
 
+  if (config.controller != "rps" && config.controller != "codel") {
+    throw std::runtime_error("Unknown controller: " + config.controller);
+  }
+  config.codel.target = std::chrono::milliseconds{codel_target_ms};
+
   return config;
 }
 
+void PrintLimit(const Limit& limit) {
+  if (limit.load_limit) {
+    std::cout << *limit.load_limit << std::endl;
+  } else {
+    std::cout << "(none)" << std::endl;
+  }
+}
+
+void EmulateCoDel(const Config& config) {
+  NullSensor sensor;
+  NullLimiter limiter;
+  v2::Stats stats;
+  v2::CoDelController ctrl("cc", sensor, limiter, stats, config.codel);
+
+  for (;;) {
+    v2::Sensor::Data data;
+    std::cin >> data.current_load >> data.timings_avg_ms;
+    if (std::cin.eof()) break;
+    if (!std::cin.good()) throw std::runtime_error("Invalid input");
+    data.total = data.current_load;
+
+    PrintLimit(ctrl.Update(data));
+  }
+}
+
 int main(int argc, char* argv[]) {
   Config config = ParseArgs(argc, argv);
 
@@ -58,6 +110,11 @@ int main(int argc, char* argv[]) {
       logging::MakeStderrLogger("default", logging::Format::kTskv,
                                 logging::LevelFromString(config.log_level))};
 
+  if (config.controller == "codel") {
+    EmulateCoDel(config);
+    return 0;
+  }
+
   dynamic_config::StorageMock dynamic_config{
       {congestion_control::impl::kRpsCcConfig, {config.policy, true}}};
   Controller ctrl("cc", dynamic_config.GetSource());
@@ -70,11 +127,6 @@ int main(int argc, char* argv[]) {
     if (!std::cin.good()) throw std::runtime_error("Invalid input");
 
     ctrl.Feed(data);
-    auto limit = ctrl.GetLimit();
-    if (limit.load_limit) {
-      std::cout << *limit.load_limit << std::endl;
-    } else {
-      std::cout << "(none)" << std::endl;
-    }
+    PrintLimit(ctrl.GetLimit());
   }
 }
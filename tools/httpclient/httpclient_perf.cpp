@@ -3,9 +3,13 @@
 #include <list>
 #include <thread>
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
 #include <boost/program_options.hpp>
 
 #include <userver/clients/http/client.hpp>
+#include <userver/clients/http/lite_client.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/log.hpp>
@@ -30,6 +34,12 @@ struct Config {
   http::HttpVersion http_version = http::HttpVersion::k11;
   std::string url_file;
   bool defer_events = false;
+  bool lite = false;
+};
+
+struct LiteTarget {
+  engine::io::Sockaddr endpoint;
+  http::LiteRequest request;
 };
 
 struct WorkerContext {
@@ -38,8 +48,10 @@ struct WorkerContext {
   uint64_t response_len;
 
   http::Client& http_client;
+  http::LiteClient& lite_client;
   const Config& config;
   const std::vector<std::string>& urls;
+  const std::vector<LiteTarget>& lite_targets;
 };
 
 Config ParseConfig(int argc, char* argv[]) {
@@ -77,7 +89,9 @@ Config ParseConfig(int argc, char* argv[]) {
       "maximum HTTP connection number to a single host")(
       "defer-events",
       po::value(&config.defer_events)->default_value(config.defer_events),
-      "whether to defer curl events to a periodic timer");
+      "whether to defer curl events to a periodic timer")(
+      "lite",
+      "use clients::http::LiteClient, URLs must be http://<ip>:<port>/<path>");
 
   po::variables_map vm;
   po::store(po::parse_command_line(argc, argv, desc), vm);
@@ -89,6 +103,7 @@ Config ParseConfig(int argc, char* argv[]) {
   }
 
   if (vm.count("multiplexing")) config.multiplexing = true;
+  if (vm.count("lite")) config.lite = true;
   if (vm.count("http-version")) {
     auto value = vm["http-version"].as<std::string>();
     if (value == "1.0")
@@ -133,6 +148,49 @@ std::vector<std::string> ReadUrls(const Config& config) {
   return urls;
 }
 
+// Only the numeric addresses are supported, LiteClient does not resolve names
+LiteTarget ParseLiteTarget(const std::string& url) {
+  constexpr std::string_view kScheme = "http://";
+  if (url.rfind(kScheme, 0) != 0) {
+    throw std::runtime_error("Only http:// URLs are supported: " + url);
+  }
+
+  const auto authority_end = url.find('/', kScheme.size());
+  const auto authority = url.substr(
+      kScheme.size(), authority_end == std::string::npos
+                          ? std::string::npos
+                          : authority_end - kScheme.size());
+  const auto port_pos = authority.rfind(':');
+  if (port_pos == std::string::npos) {
+    throw std::runtime_error("Port is required: " + url);
+  }
+  auto host = authority.substr(0, port_pos);
+  const auto port =
+      static_cast<std::uint16_t>(std::stoi(authority.substr(port_pos + 1)));
+
+  LiteTarget target;
+  if (host.size() > 2 && host.front() == '[' && host.back() == ']') {
+    host = host.substr(1, host.size() - 2);
+    auto* sa = target.endpoint.As<sockaddr_in6>();
+    sa->sin6_family = AF_INET6;
+    sa->sin6_port = htons(port);
+    if (::inet_pton(AF_INET6, host.c_str(), &sa->sin6_addr) != 1) {
+      throw std::runtime_error("Invalid IPv6 address: " + url);
+    }
+  } else {
+    auto* sa = target.endpoint.As<sockaddr_in>();
+    sa->sin_family = AF_INET;
+    sa->sin_port = htons(port);
+    if (::inet_pton(AF_INET, host.c_str(), &sa->sin_addr) != 1) {
+      throw std::runtime_error("Invalid IPv4 address: " + url);
+    }
+  }
+  target.request.target =
+      authority_end == std::string::npos ? "/" : url.substr(authority_end);
+  target.request.headers.emplace(std::string{"Host"}, authority);
+  return target;
+}
+
 http::Request CreateRequest(http::Client& http_client, const Config& config,
                             const std::string& url) {
   return http_client.CreateRequest()
@@ -152,6 +210,21 @@ void Worker(WorkerContext& context) {
 
     const std::string& url = context.urls[idx % context.urls.size()];
 
+    if (context.config.lite) {
+      const auto& target =
+          context.lite_targets[idx % context.lite_targets.size()];
+      try {
+        const auto response = context.lite_client.Perform(
+            target.endpoint, target.request,
+            engine::Deadline::FromDuration(
+                std::chrono::milliseconds{context.config.timeout_ms}));
+        context.response_len += response.body.size();
+      } catch (const std::exception& e) {
+        LOG_ERROR() << "Exception: " << e;
+      }
+      continue;
+    }
+
     try {
       auto ts1 = std::chrono::system_clock::now();
       auto request = CreateRequest(context.http_client, context.config, url);
@@ -195,8 +268,14 @@ void DoWork(const Config& config, const std::vector<std::string>& urls) {
   if (config.max_host_connections > 0)
     http_client.SetMaxHostConnections(config.max_host_connections);
 
-  WorkerContext worker_context{{0},    2000, 0, std::ref(http_client),
-                               config, urls};
+  http::LiteClient lite_client;
+  std::vector<LiteTarget> lite_targets;
+  if (config.lite) {
+    for (const auto& url : urls) lite_targets.push_back(ParseLiteTarget(url));
+  }
+
+  WorkerContext worker_context{
+      {0}, 2000, 0, http_client, lite_client, config, urls, lite_targets};
 
   std::vector<engine::TaskWithResult<void>> tasks;
   tasks.resize(config.coroutines);
@@ -242,7 +321,8 @@ int main(int argc, char* argv[]) {
                 << " timeout=" << config.timeout_ms << "ms";
   LOG_WARNING() << "multiplexing ="
                 << (config.multiplexing ? "enabled" : "disabled")
-                << " max_host_connections=" << config.max_host_connections;
+                << " max_host_connections=" << config.max_host_connections
+                << " client=" << (config.lite ? "lite" : "curl");
 
   const std::vector<std::string> urls = ReadUrls(config);
 
@@ -0,0 +1,164 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+#include <boost/program_options.hpp>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/logging/impl/binary_format.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+namespace binary = logging::impl::binary;
+
+struct Config {
+  std::string format = "tskv";
+  std::vector<std::string> inputs;
+};
+
+Config ParseConfig(int argc, char** argv) {
+  namespace po = boost::program_options;
+
+  Config config;
+  po::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "format,f", po::value(&config.format)->default_value(config.format),
+      "output format (tskv, json)")(
+      "input", po::value(&config.inputs),
+      "binary log files to render (stdin by default)");
+
+  po::positional_options_description positional;
+  positional.add("input", -1);
+
+  po::variables_map vm;
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                  .options(desc)
+                  .positional(positional)
+                  .run(),
+              vm);
+    po::notify(vm);
+  } catch (const std::exception& ex) {
+    std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+    exit(1);
+  }
+
+  if (vm.count("help")) {
+    std::cout << "Renders the logs of 'format: binary' loggers\n\n"
+              << desc << '\n';
+    exit(0);
+  }
+
+  if (config.format != "tskv" && config.format != "json") {
+    std::cerr << "Unknown output format '" << config.format << "'\n";
+    exit(1);
+  }
+
+  return config;
+}
+
+// Same as the 'timestamp' of the TSKV logs
+std::string FormatTimestamp(std::chrono::system_clock::time_point timestamp) {
+  const auto microseconds =
+      std::chrono::time_point_cast<std::chrono::microseconds>(timestamp)
+          .time_since_epoch()
+          .count() %
+      1'000'000;
+  return fmt::format(
+      "{:%FT%T}.{:06}",
+      fmt::localtime(std::chrono::system_clock::to_time_t(timestamp)),
+      microseconds);
+}
+
+void RenderTskv(const binary::Record& record, std::string& out) {
+  out += "tskv\ttimestamp=";
+  out += FormatTimestamp(record.timestamp);
+  out += "\tlevel=";
+  out += logging::ToUpperCaseString(record.level);
+  for (const auto& [key, value] : record.tags) {
+    out += utils::encoding::kTskvPairsSeparator;
+    utils::encoding::EncodeTskv(
+        out, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+    out += utils::encoding::kTskvKeyValueSeparator;
+    utils::encoding::EncodeTskv(out, value,
+                                utils::encoding::EncodeTskvMode::kValue);
+  }
+  out += '\n';
+}
+
+void RenderJson(const binary::Record& record, std::string& out) {
+  formats::json::StringBuilder sw;
+  {
+    const formats::json::StringBuilder::ObjectGuard guard{sw};
+    sw.Key("timestamp");
+    sw.WriteString(FormatTimestamp(record.timestamp));
+    sw.Key("level");
+    sw.WriteString(logging::ToUpperCaseString(record.level));
+    for (const auto& [key, value] : record.tags) {
+      sw.Key(key);
+      sw.WriteString(value);
+    }
+  }
+  out += sw.GetStringView();
+  out += '\n';
+}
+
+void Render(std::istream& input, const Config& config) {
+  constexpr std::size_t kChunkSize = 1 << 20;
+  const auto render = config.format == "json" ? &RenderJson : &RenderTskv;
+
+  std::string buffer;
+  std::string out;
+  binary::Record record;
+  std::size_t parsed_size = 0;
+  while (input) {
+    buffer.erase(0, parsed_size);
+    const auto old_size = buffer.size();
+    buffer.resize(old_size + kChunkSize);
+    input.read(buffer.data() + old_size, kChunkSize);
+    buffer.resize(old_size + input.gcount());
+
+    std::string_view data = buffer;
+    while (true) {
+      const auto record_size = binary::GetRecordSize(data);
+      if (!record_size || *record_size > data.size()) break;
+      binary::ParseRecord(data, record);
+      render(record, out);
+    }
+    parsed_size = buffer.size() - data.size();
+
+    std::cout << out;
+    out.clear();
+  }
+
+  if (parsed_size != buffer.size()) {
+    throw std::runtime_error("The last record is truncated");
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto config = ParseConfig(argc, argv);
+  try {
+    if (config.inputs.empty()) {
+      Render(std::cin, config);
+    }
+    for (const auto& path : config.inputs) {
+      std::ifstream input{path, std::ios::binary};
+      if (!input) throw std::runtime_error("Cannot open '" + path + "'");
+      Render(input, config);
+    }
+  } catch (const std::exception& ex) {
+    std::cerr << ex.what() << '\n';
+    return 1;
+  }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file userver/cache/flat_string_map.hpp
+/// @brief @copybrief cache::FlatStringMap
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Read-only hash map of strings over a contiguous buffer
+///
+/// The buffer contains only offsets and no pointers, so it may be mapped from
+/// a file or a shared memory segment at any address and looked up in place
+/// without deserialization, see cache::SharedMemorySnapshotReader. The layout
+/// depends on the byte order, so the buffer must be used on the host that
+/// built it.
+///
+/// @snippet src/cache/flat_string_map_test.cpp  Sample FlatStringMap
+class FlatStringMap final {
+ public:
+  /// @brief Builds the buffer of the map, the last of the duplicate keys wins
+  static std::string Build(
+      const std::vector<std::pair<std::string, std::string>>& items);
+
+  /// @brief Views the buffer built by Build(), the buffer must outlive the map
+  /// @throws std::runtime_error if the buffer is not a valid map
+  explicit FlatStringMap(std::string_view buffer);
+
+  /// @brief Returns the value of the `key` that points into the buffer
+  std::optional<std::string_view> Find(std::string_view key) const;
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+ private:
+  std::string_view buffer_;
+  std::size_t size_{0};
+  std::size_t buckets_count_{0};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -85,6 +85,7 @@ template <typename T, typename U, typename Hash = std::hash<T>,
 class LruBase final {
  public:
   using NodeType = std::unique_ptr<LruNode<T, U>>;
+  using Node = LruNode<T, U>;
 
   explicit LruBase(size_t max_size, const Hash& hash, const Equal& equal);
   ~LruBase() { Clear(); }
@@ -120,6 +121,11 @@ class LruBase final {
 
   U* Get(const T& key);
 
+  /// Returns the node of the key without updating its usage
+  Node* FindNode(const T& key);
+
+  void MarkRecentlyUsed(Node& node) noexcept;
+
   const T* GetLeastUsedKey() const;
 
   U* GetLeastUsedValue();
@@ -144,7 +150,6 @@ class LruBase final {
   std::size_t GetCapacity() const;
 
  private:
-  using Node = LruNode<T, U>;
   using List =
       boost::intrusive::list<Node, boost::intrusive::constant_time_size<false>>;
 
@@ -175,7 +180,6 @@ class LruBase final {
   using BucketType = typename Map::bucket_type;
 
   U& Add(const T& key, U value);
-  void MarkRecentlyUsed(Node& node) noexcept;
   std::unique_ptr<Node> ExtractNode(typename List::iterator it) noexcept;
 
   std::vector<BucketType> buckets_;
@@ -236,6 +240,14 @@ U* LruBase<T, U, Hash, Eq>::Get(const T& key) {
   return &it->GetValue();
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+typename LruBase<T, U, Hash, Eq>::Node* LruBase<T, U, Hash, Eq>::FindNode(
+    const T& key) {
+  auto it = map_.find(key, map_.hash_function(), map_.key_eq());
+  if (it == map_.end()) return nullptr;
+  return &*it;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 const T* LruBase<T, U, Hash, Eq>::GetLeastUsedKey() const {
   if (list_.empty()) return nullptr;
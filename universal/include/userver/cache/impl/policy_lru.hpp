@@ -0,0 +1,87 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <variant>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/policy.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// LRU storage with the CachePolicy selected at runtime
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class PolicyLruBase final {
+ public:
+  using Node = LruNode<T, U>;
+
+  PolicyLruBase(CachePolicy policy, std::size_t max_size, const Hash& hash,
+                const Equal& equal)
+      : impl_(MakeImpl(policy, max_size, hash, equal)) {}
+
+  PolicyLruBase(PolicyLruBase&& other) = default;
+
+  bool Put(const T& key, U value) {
+    return Visit([&](auto& impl) { return impl.Put(key, std::move(value)); });
+  }
+
+  void Erase(const T& key) {
+    Visit([&](auto& impl) { impl.Erase(key); });
+  }
+
+  U* Get(const T& key) {
+    return Visit([&](auto& impl) { return impl.Get(key); });
+  }
+
+  Node* FindNode(const T& key) {
+    return Visit([&](auto& impl) { return impl.FindNode(key); });
+  }
+
+  void MarkRecentlyUsed(Node& node) {
+    Visit([&](auto& impl) { impl.MarkRecentlyUsed(node); });
+  }
+
+  void SetMaxSize(std::size_t new_max_size) {
+    Visit([&](auto& impl) { impl.SetMaxSize(new_max_size); });
+  }
+
+  void Clear() noexcept {
+    Visit([](auto& impl) { impl.Clear(); });
+  }
+
+  template <typename Function>
+  void VisitAll(Function&& func) const {
+    std::visit([&](const auto& impl) { impl.VisitAll(func); }, impl_);
+  }
+
+  std::size_t GetSize() const {
+    return std::visit([](const auto& impl) { return impl.GetSize(); }, impl_);
+  }
+
+ private:
+  using Impl =
+      std::variant<LruBase<T, U, Hash, Equal>, TinyLfuBase<T, U, Hash, Equal>>;
+
+  static Impl MakeImpl(CachePolicy policy, std::size_t max_size,
+                       const Hash& hash, const Equal& equal) {
+    if (policy == CachePolicy::kTinyLFU) {
+      return Impl{std::in_place_index<1>, max_size, hash, equal};
+    }
+    return Impl{std::in_place_index<0>, max_size, hash, equal};
+  }
+
+  template <typename Function>
+  decltype(auto) Visit(Function&& func) {
+    return std::visit(std::forward<Function>(func), impl_);
+  }
+
+  Impl impl_;
+};
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#pragma once
+
+/// @file userver/cache/policy.hpp
+/// @brief @copybrief cache::CachePolicy
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal
+///
+/// @brief Eviction and admission policy of the bounded caches
+enum class CachePolicy {
+  /// Evicts the least recently used key on each insertion into a full cache
+  kLRU,
+
+  /// W-TinyLFU: the new keys are put into a small LRU window. The keys evicted
+  /// from the window are admitted to the main LRU only if they are used more
+  /// frequently than the main LRU victim, according to a count-min sketch.
+  /// Protects the hot keys from being evicted by scans of one-hit wonders.
+  kTinyLFU,
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
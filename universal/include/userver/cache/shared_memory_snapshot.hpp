@@ -0,0 +1,104 @@
+#pragma once
+
+/// @file userver/cache/shared_memory_snapshot.hpp
+/// @brief @copybrief cache::SharedMemorySnapshotReader
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal
+///
+/// @brief Read-only mapping of a generation of a shared memory snapshot
+///
+/// The memory is shared by all the processes that map the same generation and
+/// stays valid while the object is alive, even if newer generations are
+/// published and the segment is removed.
+class SharedMemorySnapshot final {
+ public:
+  SharedMemorySnapshot(std::uint64_t generation, const void* data,
+                       std::size_t size) noexcept;
+
+  SharedMemorySnapshot(SharedMemorySnapshot&&) = delete;
+  SharedMemorySnapshot& operator=(SharedMemorySnapshot&&) = delete;
+
+  /// Unmaps the segment
+  ~SharedMemorySnapshot();
+
+  std::uint64_t GetGeneration() const noexcept { return generation_; }
+
+  std::string_view GetData() const noexcept {
+    return {static_cast<const char*>(data_), size_};
+  }
+
+ private:
+  const std::uint64_t generation_;
+  const void* const data_;
+  const std::size_t size_;
+};
+
+/// @ingroup userver_universal
+///
+/// @brief Publishes the generations of a snapshot for
+/// cache::SharedMemorySnapshotReader in other processes on the same host
+///
+/// Each generation is written to its own file `<path>.<generation>`, then
+/// `<path>.current` is atomically switched to it and the previous generation
+/// file is removed. Use a path on tmpfs, e.g. `/dev/shm/<name>`, so that the
+/// files stay in memory.
+///
+/// Blocking, not thread-safe, there must be a single writer per path.
+class SharedMemorySnapshotWriter final {
+ public:
+  explicit SharedMemorySnapshotWriter(std::string path);
+
+  /// @brief Publishes a new generation, data is usually built by
+  /// cache::FlatStringMap::Build() or another offset-based layout
+  /// @returns the generation
+  /// @throws std::runtime_error on write failure
+  std::uint64_t Publish(std::string_view data);
+
+ private:
+  const std::string path_;
+  std::uint64_t generation_;
+};
+
+/// @ingroup userver_universal
+///
+/// @brief Maps the latest generation published by
+/// cache::SharedMemorySnapshotWriter in another process
+///
+/// The processes that read the same generation share its memory, so a big
+/// reference cache is kept once per host and not once per process. The
+/// generations are switched RCU-style: the old mapping is alive while
+/// somebody holds it. Usually the reader is called from the Update() of a
+/// cache component, that stores the snapshot with Set().
+///
+/// Blocking, not thread-safe.
+///
+/// @snippet src/cache/shared_memory_snapshot_test.cpp  Sample SharedMemorySnapshot
+class SharedMemorySnapshotReader final {
+ public:
+  explicit SharedMemorySnapshotReader(std::string path);
+
+  /// @brief Maps the latest generation if it differs from the one returned
+  /// last time
+  /// @returns the snapshot, nullptr if the generation is the same or nothing
+  /// is published yet
+  /// @throws std::runtime_error on read failure
+  std::shared_ptr<const SharedMemorySnapshot> ReadIfChanged();
+
+ private:
+  const std::string path_;
+  std::uint64_t generation_{0};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -18,7 +18,8 @@ enum class Pad { kWith, kWithout };
 /// @throws CryptoException internal library exception
 std::string Base64Encode(std::string_view data, Pad pad = Pad::kWith);
 
-/// @brief Decodes data from Base64
+/// @brief Decodes data from Base64, chars out of the alphabet (padding,
+/// whitespace) are skipped
 /// @throws CryptoException internal library exception
 std::string Base64Decode(std::string_view data);
 
@@ -29,7 +30,8 @@ std::string Base64Decode(std::string_view data);
 /// @throws CryptoException internal library exception
 std::string Base64UrlEncode(std::string_view data, Pad pad = Pad::kWith);
 
-/// @brief Decodes data from Base64 (using URL alphabet)
+/// @brief Decodes data from Base64 (using URL alphabet), chars out of the
+/// alphabet are skipped
 /// @throws CryptoException internal library exception
 std::string Base64UrlDecode(std::string_view data);
 
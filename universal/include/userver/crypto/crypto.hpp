@@ -10,6 +10,7 @@
 #include <userver/crypto/hash.hpp>
 #include <userver/crypto/private_key.hpp>
 #include <userver/crypto/public_key.hpp>
+#include <userver/crypto/public_key_cache.hpp>
 #include <userver/crypto/signers.hpp>
 #include <userver/crypto/verifiers.hpp>
 
@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/crypto/public_key_cache.hpp
+/// @brief @copybrief crypto::PublicKeyCache
+
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/crypto/public_key.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Thread-safe cache of the parsed public keys by their key ids, e.g.
+/// by the `kid` of JWT.
+///
+/// Parsing a PEM takes tens of microseconds, while a lookup in the cache is
+/// a hash and a comparison of the PEM with the one the key was parsed from.
+/// A changed PEM for the same key id (key rotation) is parsed again.
+///
+/// @snippet src/crypto/public_key_test.cpp  Sample PublicKeyCache
+class PublicKeyCache final {
+ public:
+  /// @brief Returns the key for `key_id` if it was parsed from the same
+  /// `pem`, otherwise parses `pem` with PublicKey::LoadFromString and caches
+  /// the result.
+  /// @throw crypto::KeyParseError if failed to load the key.
+  PublicKey GetOrLoad(std::string_view key_id, std::string_view pem);
+
+  /// @brief Returns the cached key for `key_id`, if any
+  std::optional<PublicKey> Get(std::string_view key_id) const;
+
+  /// @brief Removes the key for `key_id` from the cache
+  void Erase(std::string_view key_id);
+
+  std::size_t GetSize() const;
+
+ private:
+  struct Entry {
+    std::string pem;
+    PublicKey key;
+  };
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::string, Entry, utils::StrCaseHash> keys_;
+};
+
+}  // namespace crypto
+
+USERVER_NAMESPACE_END
@@ -81,6 +81,8 @@ class DsaSigner final : public Signer {
 
  private:
   PrivateKey pkey_;
+  // initialized once for pkey_, copied for every message
+  std::shared_ptr<EVP_MD_CTX> sign_ctx_;
 };
 
 /// @name Outputs RSASSA signature using SHA-2 and PKCS1 padding.
@@ -8,17 +8,25 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/crypto/basic_types.hpp>
 #include <userver/crypto/certificate.hpp>
 #include <userver/crypto/exception.hpp>
 #include <userver/crypto/public_key.hpp>
 #include <userver/utils/flags.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace crypto {
 
+/// Message and its signature for Verifier::VerifyBatch
+struct SignedMessage {
+  std::string_view data;
+  std::string_view raw_signature;
+};
+
 /// Base verifier class
 class Verifier : public NamedAlgo {
  public:
@@ -28,6 +36,12 @@ class Verifier : public NamedAlgo {
   /// Verifies a signature against the message
   virtual void Verify(std::initializer_list<std::string_view> data,
                       std::string_view raw_signature) const = 0;
+
+  /// Verifies the signatures of many messages, e.g. of a batch of tokens
+  /// signed with the same key. Returns for each message whether its signature
+  /// is valid, does not throw on invalid signatures.
+  virtual std::vector<bool> VerifyBatch(
+      utils::span<const SignedMessage> messages) const;
 };
 
 /// "none" algorithm verifier
@@ -78,6 +92,11 @@ class DsaVerifier final : public Verifier {
   void Verify(std::initializer_list<std::string_view> data,
               std::string_view raw_signature) const override;
 
+  /// Verifies the signatures of many messages without throwing on the
+  /// invalid ones
+  std::vector<bool> VerifyBatch(
+      utils::span<const SignedMessage> messages) const override;
+
   /// Verifies a signature against the message digest.
   ///
   /// Not available for RSASSA-PSS.
@@ -87,6 +106,8 @@ class DsaVerifier final : public Verifier {
 
  private:
   PublicKey pkey_;
+  // initialized once for pkey_, copied for every message
+  std::shared_ptr<EVP_MD_CTX> verify_ctx_;
 };
 
 /// @name Verifies RSASSA signature using SHA-2 and PKCS1 padding.
@@ -0,0 +1,145 @@
+#pragma once
+
+/// @file userver/decimal64/bulk.hpp
+/// @brief Arithmetic on whole arrays of decimal64::Decimal
+/// @ingroup userver_universal
+
+#include <cstdint>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Arithmetic on whole arrays of decimal64::Decimal, e.g. on the
+/// columns of a price feed
+///
+/// The results are the same as of the element-wise operators of `Decimal`.
+/// The loops do not branch on overflow, the sign bits of the wrapped around
+/// results are checked instead, so that the compiler is able to vectorize
+/// them; if any of the results overflows, decimal64::OutOfBoundsError
+/// is thrown after the whole array is processed, and the contents of `out` are
+/// unspecified.
+///
+/// `out` may be the same array as one of the inputs. The decimal type has to
+/// be specified explicitly:
+///
+/// @code
+/// using Money = decimal64::Decimal<4>;
+/// std::vector<Money> prices = ...;
+/// std::vector<Money> fees = ...;
+/// decimal64::bulk::Add<Money>(prices, fees, prices);
+/// @endcode
+namespace decimal64::bulk {
+
+/// @brief out[i] = lhs[i] + rhs[i]
+/// @throw decimal64::OutOfBoundsError on overflow
+template <typename Decimal>
+void Add(utils::span<const Decimal> lhs, utils::span<const Decimal> rhs,
+         utils::span<Decimal> out) {
+  static_assert(kIsDecimal<Decimal>);
+  UINVARIANT(lhs.size() == rhs.size() && lhs.size() == out.size(),
+             "decimal64::bulk::Add: arrays of different sizes");
+
+  uint64_t overflow = 0;
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    const auto lhs_value = static_cast<uint64_t>(lhs[i].AsUnbiased());
+    const auto rhs_value = static_cast<uint64_t>(rhs[i].AsUnbiased());
+    const auto result = lhs_value + rhs_value;
+    overflow |= (lhs_value ^ result) & (rhs_value ^ result);
+    out[i] = Decimal::FromUnbiased(static_cast<int64_t>(result));
+  }
+  if (overflow >> 63) throw OutOfBoundsError();
+}
+
+/// @brief out[i] = lhs[i] - rhs[i]
+/// @throw decimal64::OutOfBoundsError on overflow
+template <typename Decimal>
+void Subtract(utils::span<const Decimal> lhs, utils::span<const Decimal> rhs,
+              utils::span<Decimal> out) {
+  static_assert(kIsDecimal<Decimal>);
+  UINVARIANT(lhs.size() == rhs.size() && lhs.size() == out.size(),
+             "decimal64::bulk::Subtract: arrays of different sizes");
+
+  uint64_t overflow = 0;
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    const auto lhs_value = static_cast<uint64_t>(lhs[i].AsUnbiased());
+    const auto rhs_value = static_cast<uint64_t>(rhs[i].AsUnbiased());
+    const auto result = lhs_value - rhs_value;
+    overflow |= (lhs_value ^ rhs_value) & (lhs_value ^ result);
+    out[i] = Decimal::FromUnbiased(static_cast<int64_t>(result));
+  }
+  if (overflow >> 63) throw OutOfBoundsError();
+}
+
+/// @brief out[i] = lhs[i] * rhs[i], rounded according to `RoundPolicy`
+/// @throw decimal64::OutOfBoundsError on overflow
+template <typename Decimal>
+void Multiply(utils::span<const Decimal> lhs, utils::span<const Decimal> rhs,
+              utils::span<Decimal> out) {
+  static_assert(kIsDecimal<Decimal>);
+  UINVARIANT(lhs.size() == rhs.size() && lhs.size() == out.size(),
+             "decimal64::bulk::Multiply: arrays of different sizes");
+
+  // rounding is a division, which is not vectorized anyway
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    out[i] = lhs[i] * rhs[i];
+  }
+}
+
+/// @brief out[i] = values[i] * factor
+/// @throw decimal64::OutOfBoundsError on overflow
+template <typename Decimal>
+void Multiply(utils::span<const Decimal> values, int64_t factor,
+              utils::span<Decimal> out) {
+  static_assert(kIsDecimal<Decimal>);
+  UINVARIANT(values.size() == out.size(),
+             "decimal64::bulk::Multiply: arrays of different sizes");
+
+  bool overflow = false;
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    int64_t result{};
+    overflow |= __builtin_mul_overflow(values[i].AsUnbiased(), factor, &result);
+    out[i] = Decimal::FromUnbiased(result);
+  }
+  if (overflow) throw OutOfBoundsError();
+}
+
+/// @brief out[i] = values[i].RoundToMultipleOf(base)
+/// @throw decimal64::OutOfBoundsError if `base` is negative or on overflow
+/// @throw decimal64::DivisionByZeroError if `base` is zero
+template <typename Decimal>
+void RoundToMultipleOf(utils::span<const Decimal> values, Decimal base,
+                       utils::span<Decimal> out) {
+  static_assert(kIsDecimal<Decimal>);
+  UINVARIANT(values.size() == out.size(),
+             "decimal64::bulk::RoundToMultipleOf: arrays of different sizes");
+  if (base.Sign() < 0) throw OutOfBoundsError();
+
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    out[i] = values[i].RoundToMultipleOf(base);
+  }
+}
+
+/// @brief Returns the sum of `values`
+/// @throw decimal64::OutOfBoundsError on overflow
+template <typename Decimal>
+Decimal Sum(utils::span<const Decimal> values) {
+  static_assert(kIsDecimal<Decimal>);
+
+  uint64_t overflow = 0;
+  uint64_t sum = 0;
+  for (const auto value : values) {
+    const auto addend = static_cast<uint64_t>(value.AsUnbiased());
+    const auto result = sum + addend;
+    overflow |= (sum ^ result) & (addend ^ result);
+    sum = result;
+  }
+  if (overflow >> 63) throw OutOfBoundsError();
+  return Decimal::FromUnbiased(static_cast<int64_t>(sum));
+}
+
+}  // namespace decimal64::bulk
+
+USERVER_NAMESPACE_END
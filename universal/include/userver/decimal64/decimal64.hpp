@@ -126,6 +126,14 @@ template <typename RoundPolicy>
 constexpr int64_t MulDiv(int64_t value1, int64_t value2, int64_t divisor) {
   if (divisor == 0) throw DivisionByZeroError();
 
+  // The common case of small values: the 64-bit division by a constant is
+  // much cheaper than the 128-bit one. The bounds leave room for rounding.
+  int64_t prod64{};
+  if (!__builtin_mul_overflow(value1, value2, &prod64) &&
+      prod64 > kMinInt64 / 2 && prod64 < kMaxInt64 / 2) {
+    return Div<RoundPolicy>(prod64, divisor);
+  }
+
 #if __x86_64__ || __ppc64__ || __aarch64__
   using LongInt = __int128_t;
   static_assert(sizeof(void*) == 8);
@@ -1238,6 +1246,113 @@ template <int Prec, typename RoundPolicy, typename CharSequence>
           0};
 }
 
+constexpr uint64_t LoadChar(const char* input, int index) {
+  return static_cast<uint64_t>(static_cast<unsigned char>(input[index]))
+         << (8 * index);
+}
+
+// Compilers turn the expression into a single load
+constexpr uint64_t LoadEightChars(const char* input) {
+  return LoadChar(input, 0) | LoadChar(input, 1) | LoadChar(input, 2) |
+         LoadChar(input, 3) | LoadChar(input, 4) | LoadChar(input, 5) |
+         LoadChar(input, 6) | LoadChar(input, 7);
+}
+
+// Returns up to 8 chars of `input` starting at `position` as a word, the first
+// char in the lowest byte, the missing chars are zero bytes.
+constexpr uint64_t LoadChars(std::string_view input, std::size_t position) {
+  const auto rest = input.size() - position;
+  if (rest >= 8) return LoadEightChars(input.data() + position);
+  if (rest == 0) return 0;
+  if (input.size() >= 8) {
+    // the last 8 chars of `input`, without the ones before `position`
+    return LoadEightChars(input.data() + input.size() - 8) >> (8 * (8 - rest));
+  }
+
+  uint64_t word = 0;
+  for (std::size_t i = 0; i < rest; ++i) {
+    word |= LoadChar(input.data() + position, static_cast<int>(i));
+  }
+  return word;
+}
+
+struct DigitRun {
+  uint64_t value{0};
+  std::size_t length{0};
+};
+
+// Parses the decimal digits of `input` starting at `position`, 8 chars at a
+// time (SWAR), without a branch per digit. `value` is meaningful only for
+// `length <= kMaxDecimalDigits`.
+constexpr DigitRun ParseDigitRun(std::string_view input, std::size_t position) {
+  constexpr uint64_t kZeros = 0x3030303030303030;
+  constexpr uint64_t kHighNibbles = 0xF0F0F0F0F0F0F0F0;
+
+  DigitRun result;
+  while (true) {
+    const auto word = LoadChars(input, position + result.length);
+
+    // non-zero bytes for non-digits; a carry out of a byte may only mark
+    // the bytes after a non-digit, so the first non-digit is found correctly
+    const auto non_digits = ((word & kHighNibbles) ^ kZeros) |
+                            (((word + 0x0606060606060606) & kHighNibbles) ^
+                             kZeros);
+    const std::size_t digits =
+        non_digits == 0 ? 8 : __builtin_ctzll(non_digits) / 8;
+    if (digits == 0) break;
+
+    // right-align the digits, padding with '0's
+    auto chunk = word << (8 * (8 - digits));
+    if (digits != 8) chunk |= kZeros >> (8 * digits);
+    chunk -= kZeros;
+    chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FF;
+    chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFF;
+    chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFF;
+
+    result.value = result.value * kPowSeries10[digits] + chunk;
+    result.length += digits;
+    if (digits != 8 || result.length > kMaxDecimalDigits) break;
+  }
+  return result;
+}
+
+/// Parses the most common strings, e.g. "-123.45" with at most `Prec`
+/// fractional digits, without the generic ParseUnpacked. Returns
+/// `std::nullopt` if the input is not such a string, then Parse must be
+/// used to get either the value or the exact error.
+template <int Prec, typename RoundPolicy>
+constexpr std::optional<Decimal<Prec, RoundPolicy>> TryParseCanonical(
+    std::string_view input) {
+  bool is_negative = false;
+  if (!input.empty() && (input[0] == '-' || input[0] == '+')) {
+    is_negative = input[0] == '-';
+    input.remove_prefix(1);
+  }
+
+  const auto before = ParseDigitRun(input, 0);
+  if (before.length == 0 || before.length > kMaxDecimalDigits ||
+      before.value >= static_cast<uint64_t>(kMaxInt64 / kPow10<Prec>)) {
+    return std::nullopt;
+  }
+
+  DigitRun after;
+  if (before.length != input.size()) {
+    if (input[before.length] != '.') return std::nullopt;
+    after = ParseDigitRun(input, before.length + 1);
+    if (after.length == 0 ||
+        before.length + 1 + after.length != input.size() ||
+        after.length > static_cast<std::size_t>(Prec)) {
+      return std::nullopt;
+    }
+  }
+
+  const auto result = static_cast<int64_t>(
+      before.value * kPow10<Prec> +
+      after.value * Pow10(Prec - static_cast<int>(after.length)));
+  return Decimal<Prec, RoundPolicy>::FromUnbiased(is_negative ? -result
+                                                              : result);
+}
+
 std::string GetErrorMessage(std::string_view source, std::string_view path,
                             size_t position, ParseErrorCode reason);
 
@@ -1252,6 +1367,11 @@ std::string ToString(int64_t before, int64_t after, int precision,
 
 template <int Prec, typename RoundPolicy>
 constexpr Decimal<Prec, RoundPolicy>::Decimal(std::string_view value) {
+  if (const auto fast = impl::TryParseCanonical<Prec, RoundPolicy>(value)) {
+    *this = *fast;
+    return;
+  }
+
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(value), impl::ParseOptions::kNone);
 
@@ -1265,6 +1385,10 @@ constexpr Decimal<Prec, RoundPolicy>::Decimal(std::string_view value) {
 template <int Prec, typename RoundPolicy>
 constexpr Decimal<Prec, RoundPolicy>
 Decimal<Prec, RoundPolicy>::FromStringPermissive(std::string_view input) {
+  if (const auto fast = impl::TryParseCanonical<Prec, RoundPolicy>(input)) {
+    return *fast;
+  }
+
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(input),
       {impl::ParseOptions::kAllowSpaces, impl::ParseOptions::kAllowBoundaryDot,
@@ -1396,6 +1520,9 @@ std::enable_if_t<formats::common::kIsFormatValue<Value>,
                  Decimal<Prec, RoundPolicy>>
 Parse(const Value& value, formats::parse::To<Decimal<Prec, RoundPolicy>>) {
   const std::string input = value.template As<std::string>();
+  if (const auto fast = impl::TryParseCanonical<Prec, RoundPolicy>(input)) {
+    return *fast;
+  }
 
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(std::string_view{input}),
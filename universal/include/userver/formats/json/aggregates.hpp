@@ -0,0 +1,137 @@
+#pragma once
+
+/// @file userver/formats/json/aggregates.hpp
+/// @brief JSON SAX serialization and parsing of aggregates without a DOM
+/// @ingroup userver_universal userver_formats_serialize_sax
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/utils/meta.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+struct NoAggregateFields final {};
+
+}  // namespace impl
+
+/// @brief The JSON names of the fields of an aggregate
+///
+/// Specialize it for an aggregate to get formats::json::WriteToStream and
+/// formats::json::parser::AggregateParser for it. The names are mapped to the
+/// indices of the fields, all the fields must be named:
+///
+/// @code
+/// struct Item {
+///   std::string id;
+///   int count;
+///   std::optional<double> price;
+/// };
+///
+/// template <>
+/// inline constexpr auto formats::json::kAggregateFields<Item> =
+///     utils::TrivialBiMap([](auto selector) {
+///       return selector().Case("id", 0).Case("count", 1).Case("price", 2);
+///     });
+/// @endcode
+///
+/// std::optional fields may be missing or null in JSON and are not written if
+/// empty, all the other fields are required.
+template <typename T>
+inline constexpr auto kAggregateFields = impl::NoAggregateFields{};
+
+namespace impl {
+
+template <typename T>
+inline constexpr bool kIsJsonAggregate =
+    !std::is_same_v<std::decay_t<decltype(kAggregateFields<T>)>,
+                    NoAggregateFields>;
+
+template <typename T>
+using FieldIndex = typename std::decay_t<decltype(kAggregateFields<T>)>::Second;
+
+template <typename T, std::size_t... Indices>
+constexpr bool AreAllFieldsNamed(std::index_sequence<Indices...>) {
+  return kAggregateFields<T>.size() == sizeof...(Indices) &&
+         (kAggregateFields<T>
+              .TryFindBySecond(static_cast<FieldIndex<T>>(Indices))
+              .has_value() &&
+          ...);
+}
+
+template <typename T>
+constexpr bool CheckAggregateFields() {
+  static_assert(std::is_aggregate_v<T>,
+                "formats::json::kAggregateFields is specialized for a type "
+                "that is not an aggregate");
+  static_assert(AreAllFieldsNamed<T>(
+                    std::make_index_sequence<boost::pfr::tuple_size_v<T>>{}),
+                "formats::json::kAggregateFields must name each field of the "
+                "aggregate by its index, starting from 0");
+  return true;
+}
+
+template <typename T, std::size_t Index>
+constexpr std::string_view GetFieldName() noexcept {
+  constexpr auto kName =
+      kAggregateFields<T>.TryFindBySecond(static_cast<FieldIndex<T>>(Index));
+  return *kName;
+}
+
+template <typename T, std::size_t... Indices>
+constexpr std::array<std::string_view, sizeof...(Indices)> MakeFieldNames(
+    std::index_sequence<Indices...>) noexcept {
+  return {GetFieldName<T, Indices>()...};
+}
+
+// The names of the fields by their indices
+template <typename T>
+inline constexpr auto kFieldNames = MakeFieldNames<T>(
+    std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+
+template <typename T, std::size_t Index>
+void WriteField(const T& value, StringBuilder& sw) {
+  const auto& field = boost::pfr::get<Index>(value);
+  if constexpr (meta::kIsOptional<std::decay_t<decltype(field)>>) {
+    if (!field) return;
+  }
+
+  sw.Key(GetFieldName<T, Index>());
+  WriteToStream(field, sw);
+}
+
+template <typename T, std::size_t... Indices>
+void WriteAggregate(const T& value, StringBuilder& sw,
+                    std::index_sequence<Indices...>) {
+  const StringBuilder::ObjectGuard guard{sw};
+  (WriteField<T, Indices>(value, sw), ...);
+}
+
+}  // namespace impl
+
+/// @brief SAX serialization of the aggregates with
+/// formats::json::kAggregateFields, the field names are compile-time
+/// constants
+template <typename T>
+std::enable_if_t<impl::kIsJsonAggregate<T>> WriteToStream(const T& value,
+                                                          StringBuilder& sw) {
+  static_assert(impl::CheckAggregateFields<T>());
+  impl::WriteAggregate(value, sw,
+                       std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
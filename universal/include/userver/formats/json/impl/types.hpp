@@ -50,6 +50,10 @@ class VersionedValuePtr final {
   explicit operator bool() const;
   bool IsUnique() const;
 
+  /// The strings of the value point into the buffer owned by the root,
+  /// see formats::json::FromStringInPlace
+  bool IsInsitu() const;
+
   const impl::Value* Get() const;
   impl::Value* Get();
 
@@ -0,0 +1,360 @@
+#pragma once
+
+/// @file userver/formats/json/parser/aggregate_parser.hpp
+/// @brief @copybrief formats::json::parser::AggregateParser
+
+#include <bitset>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+#include <fmt/format.h>
+
+#include <userver/formats/json/aggregates.hpp>
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/map_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/skip_parser.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+template <typename T>
+class AggregateParser;
+
+namespace impl {
+
+template <typename T, typename = void>
+struct ParserForType final {
+  static_assert(!sizeof(T),
+                "There is no SAX parser for the type, specialize "
+                "formats::json::kAggregateFields for it if it is an aggregate");
+};
+
+}  // namespace impl
+
+/// The SAX parser of T used by formats::json::parser::AggregateParser
+template <typename T>
+using ParserFor = typename impl::ParserForType<T>::type;
+
+/// Proxy parser for std::optional, null is parsed as std::nullopt
+template <typename T>
+class OptionalParser final : public TypedParser<std::optional<T>>,
+                             public Subscriber<T> {
+ public:
+  OptionalParser() { parser_.Subscribe(*this); }
+
+  OptionalParser(const OptionalParser&) = delete;
+  OptionalParser& operator=(const OptionalParser&) = delete;
+
+ protected:
+  void Null() override { this->SetResult(std::nullopt); }
+  void Bool(bool value) override { PushParser().Bool(value); }
+  void Int64(int64_t value) override { PushParser().Int64(value); }
+  void Uint64(uint64_t value) override { PushParser().Uint64(value); }
+  void Double(double value) override { PushParser().Double(value); }
+  void String(std::string_view value) override { PushParser().String(value); }
+  void StartObject() override { PushParser().StartObject(); }
+  void StartArray() override { PushParser().StartArray(); }
+
+  std::string GetPathItem() const override { return {}; }
+
+  std::string Expected() const override { return "null or a value"; }
+
+ private:
+  BaseParser& PushParser() {
+    parser_.Reset();
+    this->parser_state_->PushParser(parser_.GetParser());
+    return parser_.GetParser();
+  }
+
+  void OnSend(T&& value) override {
+    this->SetResult(std::optional<T>{std::move(value)});
+  }
+
+  ParserFor<T> parser_;
+};
+
+/// Proxy parser for std::vector that owns the parser of the items
+template <typename Item>
+class VectorParser final {
+ public:
+  using ResultType = std::vector<Item>;
+
+  VectorParser() : parser_(item_parser_) {}
+
+  VectorParser(const VectorParser&) = delete;
+  VectorParser& operator=(const VectorParser&) = delete;
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    parser_.Subscribe(subscriber);
+  }
+
+  TypedParser<ResultType>& GetParser() { return parser_.GetParser(); }
+
+ private:
+  ParserFor<Item> item_parser_;
+  ArrayParser<Item, ParserFor<Item>> parser_;
+};
+
+/// Proxy parser for maps with string keys that owns the parser of the values
+template <typename Map>
+class OwningMapParser final {
+ public:
+  using ResultType = Map;
+
+  OwningMapParser() : parser_(value_parser_) {}
+
+  OwningMapParser(const OwningMapParser&) = delete;
+  OwningMapParser& operator=(const OwningMapParser&) = delete;
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(Subscriber<ResultType>& subscriber) {
+    parser_.Subscribe(subscriber);
+  }
+
+  TypedParser<ResultType>& GetParser() { return parser_.GetParser(); }
+
+ private:
+  using ValueParser = ParserFor<typename Map::mapped_type>;
+
+  ValueParser value_parser_;
+  MapParser<Map, ValueParser> parser_;
+};
+
+// clang-format off
+
+/// @brief SAX parser of the aggregates with formats::json::kAggregateFields
+///
+/// No DOM is built: the fields are parsed right into the resulting aggregate
+/// by the parsers of their types, the field names are looked up with
+/// utils::TrivialBiMap, the unknown fields are skipped.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/parser/aggregate_parser_test.cpp  Sample AggregateParser usage
+
+// clang-format on
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  AggregateParser() : sinks_(MakeSinks(result_, Indices{})) {
+    static_assert(formats::json::impl::CheckAggregateFields<T>());
+    SubscribeFields(Indices{});
+  }
+
+  AggregateParser(const AggregateParser&) = delete;
+  AggregateParser& operator=(const AggregateParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    result_ = T{};
+    seen_.reset();
+    field_ = kNoField;
+  }
+
+ protected:
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("{");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kInside) this->Throw("object");
+
+    const auto index = formats::json::kAggregateFields<T>.TryFindByFirst(key);
+    if (!index) {
+      field_ = kUnknownField;
+      unknown_key_ = key;
+      skip_parser_.Reset();
+      this->parser_state_->PushParser(skip_parser_);
+      return;
+    }
+
+    field_ = static_cast<std::size_t>(*index);
+    seen_.set(field_);
+    PushFieldParser(field_, Indices{});
+  }
+
+  void EndObject() override {
+    if (state_ != State::kInside) this->Throw("}");
+
+    field_ = kNoField;
+    CheckRequiredFields(Indices{});
+    this->SetResult(std::move(result_));
+  }
+
+  std::string Expected() const override {
+    return state_ == State::kInside ? "string" : "object";
+  }
+
+  std::string GetPathItem() const override {
+    if (field_ == kNoField) return {};
+    if (field_ == kUnknownField) return unknown_key_;
+    return std::string{formats::json::impl::kFieldNames<T>[field_]};
+  }
+
+ private:
+  static constexpr std::size_t kSize = boost::pfr::tuple_size_v<T>;
+  static constexpr std::size_t kNoField = kSize;
+  static constexpr std::size_t kUnknownField = kSize + 1;
+
+  using Indices = std::make_index_sequence<kSize>;
+
+  template <std::size_t Index>
+  using Field = boost::pfr::tuple_element_t<Index, T>;
+
+  template <std::size_t... Indices>
+  static auto MakeParsers(std::index_sequence<Indices...>)
+      -> std::tuple<ParserFor<Field<Indices>>...>;
+
+  template <std::size_t... Indices>
+  static auto MakeSinks(T& result, std::index_sequence<Indices...>) {
+    return std::tuple<SubscriberSink<Field<Indices>>...>{
+        SubscriberSink<Field<Indices>>{boost::pfr::get<Indices>(result)}...};
+  }
+
+  template <std::size_t... Indices>
+  void SubscribeFields(std::index_sequence<Indices...>) {
+    (std::get<Indices>(parsers_).Subscribe(std::get<Indices>(sinks_)), ...);
+  }
+
+  template <std::size_t Index>
+  void PushFieldParser() {
+    auto& parser = std::get<Index>(parsers_);
+    parser.Reset();
+    this->parser_state_->PushParser(parser.GetParser());
+  }
+
+  template <std::size_t... Indices>
+  void PushFieldParser(std::size_t index, std::index_sequence<Indices...>) {
+    ((index == Indices && (PushFieldParser<Indices>(), true)) || ...);
+  }
+
+  template <std::size_t... Indices>
+  void CheckRequiredFields(std::index_sequence<Indices...>) const {
+    (CheckRequiredField<Indices>(), ...);
+  }
+
+  template <std::size_t Index>
+  void CheckRequiredField() const {
+    if constexpr (!meta::kIsOptional<Field<Index>>) {
+      if (!seen_.test(Index)) {
+        throw InternalParseError(fmt::format(
+            "field '{}' is missing",
+            formats::json::impl::GetFieldName<T, Index>()));
+      }
+    }
+  }
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  T result_{};
+  decltype(MakeParsers(Indices{})) parsers_;
+  decltype(MakeSinks(std::declval<T&>(), Indices{})) sinks_;
+  SkipParser skip_parser_;
+
+  State state_{State::kStart};
+  std::bitset<kSize> seen_;
+  std::size_t field_{kNoField};
+  std::string unknown_key_;
+};
+
+namespace impl {
+
+template <>
+struct ParserForType<bool> final {
+  using type = BoolParser;
+};
+
+template <>
+struct ParserForType<std::int32_t> final {
+  using type = Int32Parser;
+};
+
+template <>
+struct ParserForType<std::int64_t> final {
+  using type = Int64Parser;
+};
+
+template <>
+struct ParserForType<double> final {
+  using type = DoubleParser;
+};
+
+template <>
+struct ParserForType<float> final {
+  using type = FloatParser;
+};
+
+template <>
+struct ParserForType<std::string> final {
+  using type = StringParser;
+};
+
+template <>
+struct ParserForType<formats::json::Value> final {
+  using type = JsonValueParser;
+};
+
+template <typename T>
+struct ParserForType<std::optional<T>> final {
+  using type = OptionalParser<T>;
+};
+
+template <typename T>
+struct ParserForType<std::vector<T>> final {
+  using type = VectorParser<T>;
+};
+
+template <typename T>
+struct ParserForType<std::map<std::string, T>> final {
+  using type = OwningMapParser<std::map<std::string, T>>;
+};
+
+template <typename T>
+struct ParserForType<std::unordered_map<std::string, T>> final {
+  using type = OwningMapParser<std::unordered_map<std::string, T>>;
+};
+
+template <typename T>
+struct ParserForType<
+    T, std::enable_if_t<formats::json::impl::kIsJsonAggregate<T>>>
+    final {
+  using type = AggregateParser<T>;
+};
+
+}  // namespace impl
+
+/// @brief Parses the JSON right into T with formats::json::parser::ParserFor,
+/// without building a DOM
+///
+/// @snippet formats/json/parser/aggregate_parser_test.cpp  Sample ParseToType usage
+template <typename T>
+T ParseToType(std::string_view input) {
+  return ParseToType<T, ParserFor<T>>(input);
+}
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
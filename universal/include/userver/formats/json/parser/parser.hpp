@@ -1,11 +1,17 @@
 #pragma once
 
+/// @file userver/formats/json/parser/parser.hpp
+/// @brief SAX parsers that parse JSON right into C++ types, see
+/// @ref formats_streaming_parsing
+
+#include <userver/formats/json/parser/aggregate_parser.hpp>
 #include <userver/formats/json/parser/array_parser.hpp>
 #include <userver/formats/json/parser/bool_parser.hpp>
 #include <userver/formats/json/parser/int_parser.hpp>
 #include <userver/formats/json/parser/map_parser.hpp>
 #include <userver/formats/json/parser/number_parser.hpp>
 #include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/skip_parser.hpp>
 #include <userver/formats/json/parser/string_parser.hpp>
 
 USERVER_NAMESPACE_BEGIN
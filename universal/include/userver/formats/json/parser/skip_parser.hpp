@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/formats/json/parser/typed_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+/// Parser for any JSON value that throws the value away, e.g. for the unknown
+/// fields of an object
+class SkipParser final : public TypedParser<std::nullptr_t> {
+ public:
+  void Reset() override { depth_ = 0; }
+
+ protected:
+  void Null() override;
+  void Bool(bool) override;
+  void Int64(int64_t) override;
+  void Uint64(uint64_t) override;
+  void Double(double) override;
+  void String(std::string_view) override;
+  void StartObject() override;
+  void Key(std::string_view) override;
+  void EndObject() override;
+  void StartArray() override;
+  void EndArray() override;
+
+  std::string GetPathItem() const override { return {}; }
+
+  std::string Expected() const override;
+
+ private:
+  void OnScalar();
+  void OnEnd();
+
+  std::size_t depth_{0};
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -154,6 +154,7 @@ class TypedParser : public BaseParser {
   Subscriber<T>* subscriber_{nullptr};
 };
 
+/// Parses the JSON right into T with the typed or proxy `Parser`
 template <typename T, typename Parser>
 T ParseToType(std::string_view input) {
   T result{};
@@ -163,7 +164,7 @@ T ParseToType(std::string_view input) {
   parser.Subscribe(sink);
 
   ParserState state;
-  state.PushParser(parser);
+  state.PushParser(parser.GetParser());
   state.ProcessInput(input);
 
   return result;
@@ -4,6 +4,7 @@
 /// @brief Parsers and serializers to/from string and stream
 
 #include <iosfwd>
+#include <string>
 #include <string_view>
 
 #include <fmt/format.h>
@@ -25,6 +26,16 @@ namespace formats::json {
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// @brief Parse JSON from string, taking ownership of it
+///
+/// The document is parsed in place: the strings of the resulting Value point
+/// right into the buffer of `doc` instead of being allocated one by one,
+/// which makes the parsing of large documents noticeably faster. The Value is
+/// fully usable, its strings are copied only when it is turned into a
+/// formats::json::ValueBuilder. Prefer it for large read-only documents,
+/// e.g. request bodies.
+formats::json::Value FromStringInPlace(std::string&& doc);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
@@ -39,6 +39,13 @@ class StringBuilder final : public serialize::SaxStream {
   using Value = formats::json::Value;
 
   StringBuilder();
+
+  /// @brief Reserve the output buffer for `size_hint` bytes right away
+  ///
+  /// Saves the reallocations of the buffer when the approximate size of the
+  /// result is known, e.g. from the previous results for the same type.
+  explicit StringBuilder(std::size_t size_hint);
+
   ~StringBuilder();
 
   /// Construct this guard on new object start and its destructor will end the
@@ -23,6 +23,15 @@ namespace logging {
 class LogHelper;
 }  // namespace logging
 
+namespace formats::json {
+class Value;
+}  // namespace formats::json
+
+namespace formats::msgpack {
+formats::json::Value FromString(std::string_view);
+std::string ToString(const formats::json::Value&);
+}  // namespace formats::msgpack
+
 namespace formats::json {
 namespace impl {
 class InlineObjectBuilder;
@@ -305,6 +314,7 @@ class Value final {
   friend class impl::StringBuffer;
 
   friend formats::json::Value FromString(std::string_view);
+  friend formats::json::Value FromStringInPlace(std::string&&);
   friend formats::json::Value FromStream(std::istream&);
   friend void Serialize(const formats::json::Value&, std::ostream&);
   friend std::string ToString(const formats::json::Value&);
@@ -315,6 +325,8 @@ class Value final {
   friend logging::LogHelper& operator<<(logging::LogHelper&, const Value&);
   friend bool Validate(const formats::json::Value&,
                        const formats::json::Schema&);
+  friend formats::json::Value msgpack::FromString(std::string_view);
+  friend std::string msgpack::ToString(const formats::json::Value&);
 };
 
 template <typename T>
@@ -0,0 +1,19 @@
+#pragma once
+
+/// @file userver/formats/msgpack.hpp
+/// @brief Include-all header for MessagePack support
+/// @ingroup userver_universal
+
+#include <userver/formats/msgpack/exception.hpp>
+#include <userver/formats/msgpack/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief MessagePack support
+///
+/// MessagePack documents are represented by formats::json::Value, so all the
+/// `Parse` and `Serialize` customizations for formats::json::Value and
+/// formats::json::ValueBuilder work for MessagePack as is.
+namespace formats::msgpack {}
+
+USERVER_NAMESPACE_END
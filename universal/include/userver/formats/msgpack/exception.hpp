@@ -0,0 +1,31 @@
+#pragma once
+
+/// @file userver/formats/msgpack/exception.hpp
+/// @brief Exception classes for MessagePack module
+/// @ingroup userver_universal
+
+#include <stdexcept>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+class Exception : public std::exception {
+ public:
+  explicit Exception(std::string msg) : msg_(std::move(msg)) {}
+
+  const char* what() const noexcept final { return msg_.c_str(); }
+
+ private:
+  std::string msg_;
+};
+
+class ParseException : public Exception {
+ public:
+  using Exception::Exception;
+};
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,34 @@
+#pragma once
+
+/// @file userver/formats/msgpack/serialize.hpp
+/// @brief Parsers and serializers of MessagePack to/from formats::json::Value
+/// @ingroup userver_universal
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+/// @brief Parse MessagePack from binary string
+///
+/// Maps and arrays become JSON objects and arrays, both str and bin become
+/// JSON strings. The keys of the maps must be strings and must be unique,
+/// extension types and not finite floats are not supported.
+///
+/// @throws formats::msgpack::ParseException if the document is not a valid
+/// MessagePack or is not representable as JSON
+formats::json::Value FromString(std::string_view doc);
+
+/// @brief Serialize JSON to MessagePack binary string
+///
+/// The integers are written in the shortest representation, floating point
+/// numbers are always written as float 64.
+std::string ToString(const formats::json::Value& doc);
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
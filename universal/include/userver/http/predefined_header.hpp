@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 
@@ -47,7 +49,69 @@ struct UnsafeConstexprHasher final {
     return hash;
   }
 
+  // Same as operator(), but loads the data by whole words instead of bytes,
+  // which the compiler does not do for the constexpr version.
+  std::size_t HashAtRuntime(std::string_view str) const noexcept {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    constexpr std::uint64_t mul = (0xc6a4a793UL << 32UL) + 0x5bd1e995UL;
+
+    const auto size = str.size();
+    std::uint64_t hash = seed_ ^ (size * mul);
+    const char* data = str.data();
+    std::size_t n = size;
+    while (n >= 8) {
+      const std::uint64_t word =
+          LoadWord<std::uint64_t>(data) | kDeliberatelyBrokenLowercaseMask;
+      hash ^= ShiftMix(word * mul) * mul;
+      hash *= mul;
+
+      data += 8;
+      n -= 8;
+    }
+    if (n) {
+      std::uint64_t tail = 0;
+      if (size >= 8) {
+        // the last 8 bytes shifted to the tail
+        tail = LoadWord<std::uint64_t>(str.data() + size - 8) >> (8 * (8 - n));
+      } else if (n >= 4) {
+        // two overlapping 4 bytes loads
+        tail = LoadWord<std::uint32_t>(data) |
+               (static_cast<std::uint64_t>(
+                    LoadWord<std::uint32_t>(data + n - 4))
+                << (8 * (n - 4)));
+      } else {
+        tail = LoadByte(data, 0) | LoadByte(data, n / 2) |
+               LoadByte(data, n - 1);
+      }
+      hash ^= tail | (kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n)));
+      hash *= mul;
+    }
+
+    hash = ShiftMix(hash) * mul;
+    hash = ShiftMix(hash);
+    return hash;
+#else
+    return (*this)(str);
+#endif
+  }
+
  private:
+  // See LoadN
+  static constexpr std::uint64_t kDeliberatelyBrokenLowercaseMask =
+      0x2020202020202020UL;
+
+  template <typename Word>
+  static Word LoadWord(const char* data) noexcept {
+    Word result{};
+    std::memcpy(&result, data, sizeof(result));
+    return result;
+  }
+
+  static std::uint64_t LoadByte(const char* data, std::size_t i) noexcept {
+    return static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i]))
+           << (8 * i);
+  }
+
   static constexpr inline std::uint64_t ShiftMix(std::uint64_t v) noexcept {
     return v ^ (v >> 47);
   }
@@ -64,9 +128,6 @@ struct UnsafeConstexprHasher final {
     // However, for expected input (lower/upper-case ASCII letters + dashes)
     // this just works, and against malicious
     // input we defend by falling back to case-insensitive SipHash.
-    constexpr std::uint64_t kDeliberatelyBrokenLowercaseMask =
-        0x2020202020202020UL;
-
     std::uint64_t result = kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n));
     for (std::size_t i = 0; i < n; ++i) {
       const std::uint8_t c = data[i];
@@ -127,7 +188,14 @@ inline constexpr utils::TrivialBiMap kKnownHeadersLowercaseMap =
           .Case("x-b3-sampled", 36)
           .Case("x-b3-parentspanid", 37)
           .Case("traceparent", 38)
-          .Case("tracestate", 39);
+          .Case("tracestate", 39)
+          .Case("vary", 40)
+          .Case("cache-control", 41)
+          .Case("content-range", 42)
+          .Case("accept-ranges", 43)
+          .Case("etag", 44)
+          .Case("last-modified", 45)
+          .Case("location", 46);
     };
 
 // We use different values for "no index" at compile and run time to simplify
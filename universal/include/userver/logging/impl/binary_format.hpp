@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Records of logging::Format::kBinary
+///
+/// @code
+/// record := kRecordMarker length:u32le body   // length is the size of body
+/// body   := timestamp:varint level:u8 tag*    // microseconds since epoch
+/// tag    := key_id:varint [key_size:varint key] value_size:varint value
+/// @endcode
+///
+/// The `key` is only written for kInlineKeyId, otherwise `key_id` refers to
+/// one of the interned keys. The values are written as is, without escaping.
+/// The varints are unsigned LEB128.
+///
+/// `tools/log_render` renders the records into TSKV or JSON.
+namespace logging::impl::binary {
+
+inline constexpr char kRecordMarker = '\x1e';
+inline constexpr std::size_t kRecordHeaderSize = 1 + 4;
+inline constexpr std::uint64_t kInlineKeyId = 0;
+
+/// @returns the id of an interned key, kInlineKeyId for any other key
+std::uint64_t FindInternedKey(std::string_view key) noexcept;
+
+/// @returns the interned key by its id
+/// @throws std::runtime_error on unknown ids
+std::string_view GetInternedKey(std::uint64_t key_id);
+
+struct Record final {
+  std::chrono::system_clock::time_point timestamp;
+  Level level{Level::kNone};
+  std::vector<std::pair<std::string_view, std::string_view>> tags;
+};
+
+/// @returns the size of the first record in `data` including the header, or
+/// std::nullopt if the header is not complete yet
+/// @throws std::runtime_error if `data` does not start with a record
+std::optional<std::size_t> GetRecordSize(std::string_view data);
+
+/// Parses the first record of `data` into `record`, which then points into
+/// `data`, and removes the record from `data`
+/// @throws std::runtime_error if the record is malformed or incomplete
+void ParseRecord(std::string_view& data, Record& record);
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
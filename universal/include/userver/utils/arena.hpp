@@ -0,0 +1,169 @@
+#pragma once
+
+/// @file userver/utils/arena.hpp
+/// @brief @copybrief utils::Arena
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Thread-safe pool of the blocks for utils::Arena
+///
+/// An arena that is destroyed on another thread gives its blocks back to the
+/// pool instead of freeing them one by one, and the next arena takes them
+/// without calling the heap allocator. Up to `max_free_blocks` blocks are
+/// kept, the rest are freed.
+class ArenaBlockPool final {
+ public:
+  ArenaBlockPool(std::size_t block_size, std::size_t max_free_blocks);
+
+  ArenaBlockPool(ArenaBlockPool&&) = delete;
+  ArenaBlockPool& operator=(ArenaBlockPool&&) = delete;
+
+  ~ArenaBlockPool();
+
+  std::size_t GetBlockSize() const noexcept { return block_size_; }
+
+  /// @brief Returns a free block or a new one of GetBlockSize() bytes
+  std::unique_ptr<char[]> Acquire();
+
+  /// @brief Takes the blocks of GetBlockSize() bytes back
+  void Release(std::vector<std::unique_ptr<char[]>>&& blocks) noexcept;
+
+  /// @brief Number of the blocks that are kept for reuse
+  std::size_t GetFreeBlocksCount() const;
+
+ private:
+  const std::size_t block_size_;
+  const std::size_t max_free_blocks_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<char[]>> free_blocks_;
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Monotonic memory resource for the objects that live no longer than
+/// some unit of work, e.g. the strings of a request.
+///
+/// The memory is taken from blocks of `block_size` bytes and is freed all at
+/// once by the destructor, so an allocation is a pointer increment. Only the
+/// last allocation may be given back, that makes the growth of a single
+/// string in place cheap.
+///
+/// Not thread-safe.
+///
+/// @snippet src/utils/arena_test.cpp  Sample Arena
+class Arena final {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = 4096;
+
+  explicit Arena(std::size_t block_size = kDefaultBlockSize);
+
+  /// @brief Takes the blocks from the `pool` and gives them back on
+  /// destruction, the pool must outlive the arena
+  explicit Arena(ArenaBlockPool& pool);
+
+  Arena(Arena&&) = delete;
+  Arena& operator=(Arena&&) = delete;
+
+  ~Arena();
+
+  /// @brief Returns `size` bytes aligned by `alignment`, which must be a power
+  /// of 2 not greater than alignof(std::max_align_t)
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /// @brief Gives the memory back if it is the last allocation, does nothing
+  /// otherwise
+  void Deallocate(void* ptr, std::size_t size) noexcept;
+
+  /// @brief Bytes of the blocks taken from the heap
+  std::size_t GetAllocatedBytes() const noexcept { return allocated_bytes_; }
+
+ private:
+  char* AllocateBlock(std::size_t size);
+
+  const std::size_t block_size_;
+  ArenaBlockPool* const pool_{nullptr};
+  // blocks of block_size_, the bigger ones are in big_blocks_
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  std::vector<std::unique_ptr<char[]>> big_blocks_;
+  char* current_{nullptr};
+  char* end_{nullptr};
+  std::size_t allocated_bytes_{0};
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Allocator that takes the memory from utils::Arena, for use with the
+/// standard containers and utils::SmallString.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+      : arena_(&other.GetArena()) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    arena_->Deallocate(ptr, n * sizeof(T));
+  }
+
+  Arena& GetArena() const noexcept { return *arena_; }
+
+ private:
+  Arena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs,
+                const ArenaAllocator<U>& rhs) noexcept {
+  return &lhs.GetArena() == &rhs.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs,
+                const ArenaAllocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief std::pmr::memory_resource that takes the memory from utils::Arena,
+/// for use with the std::pmr containers
+///
+/// @snippet src/utils/arena_test.cpp  Sample ArenaMemoryResource
+class ArenaMemoryResource final : public std::pmr::memory_resource {
+ public:
+  explicit ArenaMemoryResource(Arena& arena) noexcept : arena_(&arena) {}
+
+  Arena& GetArena() const noexcept { return *arena_; }
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+  Arena* arena_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
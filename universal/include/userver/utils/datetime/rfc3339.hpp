@@ -0,0 +1,40 @@
+#pragma once
+
+/// @file userver/utils/datetime/rfc3339.hpp
+/// @brief Fast converters between time points and RFC3339 strings in UTC.
+/// @ingroup userver_universal
+
+#include <chrono>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+/// @brief Returns the same string as
+/// `Timestring(tp, "UTC", kRfc3339Format)`, e.g.
+/// "2023-05-17T10:20:30.123456+00:00", without cctz
+///
+/// The date and time part is cached per thread for the last formatted second,
+/// so formatting the current time over and over again is especially cheap.
+///
+/// Example:
+/// @snippet utils/datetime/rfc3339_test.cpp  ToRfc3339String example
+std::string ToRfc3339String(std::chrono::system_clock::time_point tp);
+
+/// @brief Returns the same time point as
+/// `Stringtime(std::string{timestring}, "UTC", kRfc3339Format)`
+///
+/// Strings like "2023-05-17T10:20:30.123+03:00" or "2023-05-17T10:20:30Z" are
+/// parsed without cctz, the rest are passed to it.
+/// @throws utils::datetime::DateParseError
+///
+/// Example:
+/// @snippet utils/datetime/rfc3339_test.cpp  FromRfc3339String example
+std::chrono::system_clock::time_point FromRfc3339String(
+    std::string_view timestring);
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
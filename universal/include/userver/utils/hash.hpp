@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file userver/utils/hash.hpp
+/// @brief Fast non-cryptographic hash functions
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Fast non-cryptographic hash functions
+///
+/// None of them protects from hash flooding, use utils::StrCaseHash or
+/// utils::StrIcaseHash for the keys that come from the outside world.
+namespace utils::hash {
+
+/// @brief CRC-32 (ISO-HDLC, the one of zlib and boost::crc_32_type)
+///
+/// Pass the result of a previous call as `crc` to continue the calculation.
+/// The result is stable and may be stored or sent over the network.
+std::uint32_t Crc32(std::string_view data, std::uint32_t crc = 0) noexcept;
+
+/// @brief CRC-32C (Castagnoli), uses the CRC instructions of SSE4.2 or ARMv8
+/// if the code is compiled for them
+///
+/// Pass the result of a previous call as `crc` to continue the calculation.
+/// The result is stable and may be stored or sent over the network.
+std::uint32_t Crc32c(std::string_view data, std::uint32_t crc = 0) noexcept;
+
+/// @brief wyhash-style 64-bit hash, the fastest one for short keys
+///
+/// The result may differ between platforms and userver versions, do not
+/// store it.
+std::uint64_t WyHash(std::string_view data, std::uint64_t seed = 0) noexcept;
+
+/// @ingroup userver_universal
+///
+/// @brief Transparent hasher of strings based on utils::hash::WyHash, a
+/// drop-in replacement for std::hash<std::string> in the containers that
+/// take a hasher, e.g. cache::NWayLRU and concurrent::MutexSet
+struct StringHash final {
+  using is_transparent = void;
+
+  std::size_t operator()(std::string_view str) const noexcept {
+    return WyHash(str);
+  }
+};
+
+}  // namespace utils::hash
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,490 @@
+#pragma once
+
+/// @file userver/utils/persistent_map.hpp
+/// @brief @copybrief utils::PersistentMap
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Immutable hash map with structural sharing (hash array mapped trie)
+///
+/// Copying the map is O(1): the copies share all the data. A modification
+/// copies only the O(log32(size)) nodes on the path to the modified key, the
+/// rest of the data stays shared with the other copies. The shared data is
+/// never modified, so different copies may be safely used from different
+/// threads, like different std::unordered_map instances.
+///
+/// The map suits large components::CachingComponentBase caches with
+/// incremental updates: the update copies the current map and applies the
+/// changes to the copy, so the cost of the update depends on the size of the
+/// changes rather than on the size of the cache.
+///
+/// Lookups are several times slower than in std::unordered_map because of
+/// the tree traversal, see persistent_map_benchmark.cpp. Prefer FindPtr() and
+/// contains() to find(), as the iterators allocate.
+///
+/// Iteration order is unspecified. The iterators are invalidated by any
+/// modification of the map.
+///
+/// ## Example usage:
+///
+/// @snippet utils/persistent_map_test.cpp  Sample persistent map
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class PersistentMap final {
+  struct Leaf;
+  struct Node;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+
+  class const_iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = PersistentMap::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    const_iterator() = default;
+
+    reference operator*() const {
+      UASSERT(current_);
+      return current_->value;
+    }
+    pointer operator->() const { return &**this; }
+
+    const_iterator& operator++() {
+      Advance();
+      return *this;
+    }
+    const_iterator operator++(int) {
+      auto copy = *this;
+      Advance();
+      return copy;
+    }
+
+    bool operator==(const const_iterator& other) const noexcept {
+      return current_ == other.current_;
+    }
+    bool operator!=(const const_iterator& other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class PersistentMap;
+
+    struct Frame {
+      const Node* node;
+      std::size_t next_leaf;
+      std::size_t next_child;
+    };
+
+    void Advance();
+
+    std::vector<Frame> stack_;
+    const Leaf* current_{nullptr};
+  };
+  using iterator = const_iterator;
+
+  explicit PersistentMap(const Hash& hash = Hash(),
+                         const Equal& equal = Equal())
+      : hash_(hash), equal_(equal) {}
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const_iterator begin() const;
+  const_iterator end() const { return {}; }
+
+  const_iterator find(const Key& key) const;
+  size_type count(const Key& key) const { return FindLeaf(key) ? 1 : 0; }
+  bool contains(const Key& key) const { return FindLeaf(key) != nullptr; }
+
+  /// @returns pointer to the value of the key or nullptr
+  const Value* FindPtr(const Key& key) const;
+
+  /// @returns the value of the key
+  /// @throws std::out_of_range if there is no such key
+  const Value& at(const Key& key) const;
+
+  /// Inserts the value if there is no such key yet
+  /// @returns true if the value was inserted
+  bool insert(value_type value);
+
+  /// Inserts the value or replaces the value of the existing key
+  /// @returns true if the value was inserted
+  template <typename V>
+  bool insert_or_assign(const Key& key, V&& value);
+
+  /// @returns the count of the erased values
+  size_type erase(const Key& key);
+
+  void clear() noexcept {
+    root_.reset();
+    size_ = 0;
+  }
+
+ private:
+  using LeafPtr = std::shared_ptr<const Leaf>;
+  using NodePtr = std::shared_ptr<const Node>;
+
+  static constexpr std::size_t kBitsPerLevel = 5;
+  static constexpr std::size_t kHashBits = sizeof(std::size_t) * 8;
+  static constexpr std::size_t kLevelMask = (1 << kBitsPerLevel) - 1;
+
+  struct Leaf {
+    template <typename... Args>
+    explicit Leaf(std::size_t hash, Args&&... args)
+        : hash(hash), value(std::forward<Args>(args)...) {}
+
+    std::size_t hash;
+    value_type value;
+  };
+
+  // A node below the last level of hash bits is a collision node, it stores
+  // the leaves with equal hashes in no particular order and has no children
+  struct Node {
+    std::uint32_t leaf_map{0};
+    std::uint32_t child_map{0};
+    std::vector<LeafPtr> leaves;
+    std::vector<NodePtr> children;
+  };
+
+  static std::uint32_t GetBit(std::size_t hash, std::size_t shift) noexcept {
+    return std::uint32_t{1} << ((hash >> shift) & kLevelMask);
+  }
+  static std::size_t GetIndex(std::uint32_t map, std::uint32_t bit) noexcept {
+    return __builtin_popcount(map & (bit - 1));
+  }
+
+  const Leaf* FindLeaf(const Key& key) const;
+  bool Assign(LeafPtr leaf, bool replace);
+
+  NodePtr DoAssign(const NodePtr& node, LeafPtr&& leaf, std::size_t shift,
+                   bool replace, bool& inserted) const;
+  NodePtr DoErase(const NodePtr& node, std::size_t hash, const Key& key,
+                  std::size_t shift, bool& erased) const;
+  static NodePtr MergeLeaves(LeafPtr&& first, LeafPtr&& second,
+                             std::size_t shift);
+
+  NodePtr root_;
+  size_type size_{0};
+  Hash hash_;
+  Equal equal_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentMap<Key, Value, Hash, Equal>::const_iterator::Advance() {
+  while (!stack_.empty()) {
+    auto& frame = stack_.back();
+    if (frame.next_leaf < frame.node->leaves.size()) {
+      current_ = frame.node->leaves[frame.next_leaf++].get();
+      return;
+    }
+    if (frame.next_child < frame.node->children.size()) {
+      const Node* child = frame.node->children[frame.next_child++].get();
+      stack_.push_back({child, 0, 0});
+      continue;
+    }
+    stack_.pop_back();
+  }
+  current_ = nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::const_iterator
+PersistentMap<Key, Value, Hash, Equal>::begin() const {
+  const_iterator it;
+  if (root_) {
+    it.stack_.push_back({root_.get(), 0, 0});
+    it.Advance();
+  }
+  return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::const_iterator
+PersistentMap<Key, Value, Hash, Equal>::find(const Key& key) const {
+  // Builds the iterator stack as if the key was reached by the iteration
+  const auto hash = hash_(key);
+  const_iterator it;
+  const Node* node = root_.get();
+  for (std::size_t shift = 0; node; shift += kBitsPerLevel) {
+    if (shift >= kHashBits) {
+      for (std::size_t i = 0; i < node->leaves.size(); ++i) {
+        if (equal_(node->leaves[i]->value.first, key)) {
+          it.stack_.push_back({node, i + 1, 0});
+          it.current_ = node->leaves[i].get();
+          return it;
+        }
+      }
+      return {};
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (node->leaf_map & bit) {
+      const auto index = GetIndex(node->leaf_map, bit);
+      const auto& leaf = node->leaves[index];
+      if (!equal_(leaf->value.first, key)) return {};
+      it.stack_.push_back({node, index + 1, 0});
+      it.current_ = leaf.get();
+      return it;
+    }
+    if (!(node->child_map & bit)) return {};
+
+    const auto index = GetIndex(node->child_map, bit);
+    it.stack_.push_back({node, node->leaves.size(), index + 1});
+    node = node->children[index].get();
+  }
+  return {};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* PersistentMap<Key, Value, Hash, Equal>::FindPtr(
+    const Key& key) const {
+  const auto* leaf = FindLeaf(key);
+  return leaf ? &leaf->value.second : nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& PersistentMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+  const auto* value = FindPtr(key);
+  if (!value) throw std::out_of_range("utils::PersistentMap::at");
+  return *value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentMap<Key, Value, Hash, Equal>::insert(value_type value) {
+  const auto hash = hash_(value.first);
+  return Assign(std::make_shared<const Leaf>(hash, std::move(value)),
+                /*replace=*/false);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename V>
+bool PersistentMap<Key, Value, Hash, Equal>::insert_or_assign(const Key& key,
+                                                              V&& value) {
+  return Assign(
+      std::make_shared<const Leaf>(hash_(key), key, std::forward<V>(value)),
+      /*replace=*/true);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::size_type
+PersistentMap<Key, Value, Hash, Equal>::erase(const Key& key) {
+  if (!root_) return 0;
+
+  bool erased = false;
+  auto new_root = DoErase(root_, hash_(key), key, 0, erased);
+  if (!erased) return 0;
+
+  root_ = std::move(new_root);
+  --size_;
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const typename PersistentMap<Key, Value, Hash, Equal>::Leaf*
+PersistentMap<Key, Value, Hash, Equal>::FindLeaf(const Key& key) const {
+  const auto hash = hash_(key);
+  const Node* node = root_.get();
+  for (std::size_t shift = 0; node; shift += kBitsPerLevel) {
+    if (shift >= kHashBits) {
+      for (const auto& leaf : node->leaves) {
+        if (equal_(leaf->value.first, key)) return leaf.get();
+      }
+      return nullptr;
+    }
+
+    const auto bit = GetBit(hash, shift);
+    if (node->leaf_map & bit) {
+      const auto& leaf = node->leaves[GetIndex(node->leaf_map, bit)];
+      return equal_(leaf->value.first, key) ? leaf.get() : nullptr;
+    }
+    if (!(node->child_map & bit)) return nullptr;
+    node = node->children[GetIndex(node->child_map, bit)].get();
+  }
+  return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentMap<Key, Value, Hash, Equal>::Assign(LeafPtr leaf,
+                                                    bool replace) {
+  if (!root_) root_ = std::make_shared<const Node>();
+
+  bool inserted = false;
+  auto new_root = DoAssign(root_, std::move(leaf), 0, replace, inserted);
+  if (new_root) root_ = std::move(new_root);
+  if (inserted) ++size_;
+  return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::NodePtr
+PersistentMap<Key, Value, Hash, Equal>::DoAssign(const NodePtr& node,
+                                                 LeafPtr&& leaf,
+                                                 std::size_t shift,
+                                                 bool replace,
+                                                 bool& inserted) const {
+  // Returns nullptr if nothing has changed
+  if (shift >= kHashBits) {
+    for (std::size_t i = 0; i < node->leaves.size(); ++i) {
+      if (equal_(node->leaves[i]->value.first, leaf->value.first)) {
+        if (!replace) return nullptr;
+        auto copy = std::make_shared<Node>(*node);
+        copy->leaves[i] = std::move(leaf);
+        return copy;
+      }
+    }
+    auto copy = std::make_shared<Node>(*node);
+    copy->leaves.push_back(std::move(leaf));
+    inserted = true;
+    return copy;
+  }
+
+  const auto bit = GetBit(leaf->hash, shift);
+  if (node->leaf_map & bit) {
+    const auto index = GetIndex(node->leaf_map, bit);
+    const auto& existing = node->leaves[index];
+    if (equal_(existing->value.first, leaf->value.first)) {
+      if (!replace) return nullptr;
+      auto copy = std::make_shared<Node>(*node);
+      copy->leaves[index] = std::move(leaf);
+      return copy;
+    }
+
+    // Both leaves go one level down
+    auto copy = std::make_shared<Node>(*node);
+    auto child =
+        MergeLeaves(LeafPtr{existing}, std::move(leaf), shift + kBitsPerLevel);
+    copy->leaves.erase(copy->leaves.begin() + index);
+    copy->leaf_map &= ~bit;
+    copy->child_map |= bit;
+    copy->children.insert(
+        copy->children.begin() + GetIndex(copy->child_map, bit),
+        std::move(child));
+    inserted = true;
+    return copy;
+  }
+
+  if (node->child_map & bit) {
+    const auto index = GetIndex(node->child_map, bit);
+    auto child = DoAssign(node->children[index], std::move(leaf),
+                          shift + kBitsPerLevel, replace, inserted);
+    if (!child) return nullptr;
+    auto copy = std::make_shared<Node>(*node);
+    copy->children[index] = std::move(child);
+    return copy;
+  }
+
+  auto copy = std::make_shared<Node>(*node);
+  copy->leaf_map |= bit;
+  copy->leaves.insert(copy->leaves.begin() + GetIndex(copy->leaf_map, bit),
+                      std::move(leaf));
+  inserted = true;
+  return copy;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::NodePtr
+PersistentMap<Key, Value, Hash, Equal>::DoErase(const NodePtr& node,
+                                                std::size_t hash,
+                                                const Key& key,
+                                                std::size_t shift,
+                                                bool& erased) const {
+  if (shift >= kHashBits) {
+    for (std::size_t i = 0; i < node->leaves.size(); ++i) {
+      if (equal_(node->leaves[i]->value.first, key)) {
+        auto copy = std::make_shared<Node>(*node);
+        copy->leaves.erase(copy->leaves.begin() + i);
+        erased = true;
+        return copy;
+      }
+    }
+    return node;
+  }
+
+  const auto bit = GetBit(hash, shift);
+  if (node->leaf_map & bit) {
+    const auto index = GetIndex(node->leaf_map, bit);
+    if (!equal_(node->leaves[index]->value.first, key)) return node;
+
+    auto copy = std::make_shared<Node>(*node);
+    copy->leaves.erase(copy->leaves.begin() + index);
+    copy->leaf_map &= ~bit;
+    erased = true;
+    return copy;
+  }
+  if (!(node->child_map & bit)) return node;
+
+  const auto index = GetIndex(node->child_map, bit);
+  auto child =
+      DoErase(node->children[index], hash, key, shift + kBitsPerLevel, erased);
+  if (!erased) return node;
+
+  auto copy = std::make_shared<Node>(*node);
+  if (child->children.empty() && child->leaves.size() == 1) {
+    // The single remaining leaf is pulled up to keep the trie compact
+    copy->children.erase(copy->children.begin() + index);
+    copy->child_map &= ~bit;
+    copy->leaf_map |= bit;
+    copy->leaves.insert(copy->leaves.begin() + GetIndex(copy->leaf_map, bit),
+                        child->leaves.front());
+  } else {
+    UASSERT(!child->leaves.empty() || !child->children.empty());
+    copy->children[index] = std::move(child);
+  }
+  return copy;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename PersistentMap<Key, Value, Hash, Equal>::NodePtr
+PersistentMap<Key, Value, Hash, Equal>::MergeLeaves(LeafPtr&& first,
+                                                    LeafPtr&& second,
+                                                    std::size_t shift) {
+  auto node = std::make_shared<Node>();
+  if (shift >= kHashBits) {
+    node->leaves.push_back(std::move(first));
+    node->leaves.push_back(std::move(second));
+    return node;
+  }
+
+  const auto first_bit = GetBit(first->hash, shift);
+  const auto second_bit = GetBit(second->hash, shift);
+  if (first_bit == second_bit) {
+    node->child_map = first_bit;
+    node->children.push_back(MergeLeaves(std::move(first), std::move(second),
+                                         shift + kBitsPerLevel));
+    return node;
+  }
+
+  node->leaf_map = first_bit | second_bit;
+  if (first_bit > second_bit) std::swap(first, second);
+  node->leaves.push_back(std::move(first));
+  node->leaves.push_back(std::move(second));
+  return node;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
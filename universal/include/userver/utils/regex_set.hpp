@@ -0,0 +1,64 @@
+#pragma once
+
+/// @file userver/utils/regex_set.hpp
+/// @brief @copybrief utils::RegexSet
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief A set of regular expressions that is compiled once and is searched
+/// for all of the patterns at once.
+///
+/// For each pattern a literal that every match must contain is extracted,
+/// and the patterns whose literals are not in the text are skipped without
+/// running the regex engine. The patterns are also merged into a single
+/// alternation, so a text that matches none of them (the usual case for
+/// rewrite or scrubbing rules) is scanned by the regex engine once, not once
+/// per pattern.
+///
+/// Patterns use the same syntax as utils::regex. Patterns with
+/// backreferences can not be merged, with them in the set every search checks
+/// the patterns one by one.
+///
+/// @snippet src/utils/regex_set_test.cpp  Sample RegexSet
+class RegexSet final {
+ public:
+  /// @throws std::exception if some of the patterns is not a valid regex
+  explicit RegexSet(const std::vector<std::string>& patterns);
+
+  RegexSet(RegexSet&&) noexcept;
+  RegexSet& operator=(RegexSet&&) noexcept;
+  ~RegexSet();
+
+  /// @brief Number of patterns in the set
+  std::size_t Size() const noexcept;
+
+  /// @brief Returns true if any of the patterns matches anywhere in `str`
+  bool SearchAny(std::string_view str) const;
+
+  /// @brief Returns the index of the pattern that matches at the leftmost
+  /// position of `str`, the smallest index if there are several of them
+  std::optional<std::size_t> SearchFirst(std::string_view str) const;
+
+  /// @brief Returns the sorted indices of all the patterns that match
+  /// anywhere in `str`
+  std::vector<std::size_t> SearchAll(std::string_view str) const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
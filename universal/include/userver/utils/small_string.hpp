@@ -5,40 +5,70 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 #include <boost/container/small_vector.hpp>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/small_string_fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+namespace impl {
+
+// boost::container default-initializes the chars on resize only with the
+// allocators that have no construct(), so std::allocator is replaced with the
+// boost one
+template <typename Allocator>
+using SmallStringAllocator =
+    std::conditional_t<std::is_same_v<Allocator, std::allocator<char>>, void,
+                       Allocator>;
+
+}  // namespace impl
+
 /// @ingroup userver_universal userver_containers
 ///
 /// @brief An alternative to std::string with a custom SSO (small string
 /// optimization) container size. Unlike std::string, SmallString is not
 /// null-terminated thus it has no c_str(), data() returns a not null-terminated
 /// buffer.
-template <std::size_t N>
+///
+/// Strings longer than N are stored in the memory from `Allocator`, for
+/// example utils::ArenaAllocator takes it from a utils::Arena that lives as
+/// long as the request being processed.
+template <std::size_t N, typename Allocator>
 class SmallString final {
-  using Container = boost::container::small_vector<char, N>;
+  using Container =
+      boost::container::small_vector<char, N,
+                                     impl::SmallStringAllocator<Allocator>>;
 
  public:
+  using allocator_type = Allocator;
+
   /// @brief Create empty string.
   SmallString() = default;
 
+  /// @brief Create empty string that grows into `allocator` memory.
+  explicit SmallString(const Allocator& allocator);
+
   /// @brief Create a string from another one.
-  SmallString(const SmallString<N>&) = default;
+  SmallString(const SmallString&) = default;
 
   /// @brief Create a string from another one.
-  explicit SmallString(SmallString<N>&&) noexcept = default;
+  explicit SmallString(SmallString&&) noexcept = default;
 
   /// @brief Create a string from std::string_view.
   explicit SmallString(std::string_view sv);
 
+  /// @brief Create a string from std::string_view that grows into `allocator`
+  /// memory.
+  SmallString(std::string_view sv, const Allocator& allocator);
+
   /// @brief Assign the value of other string_view to this string.
   SmallString& operator=(std::string_view sv);
 
@@ -129,185 +159,233 @@ class SmallString final {
   /// @brief Remove the last character from the string.
   void pop_back();
 
+  /// @brief Get the allocator the string grows with.
+  Allocator get_allocator() const noexcept;
+
  private:
-  boost::container::small_vector<char, N> data_;
+  static typename Container::allocator_type MakeContainerAllocator(
+      const Allocator& allocator) noexcept;
+
+  Container data_;
 };
 
-template <std::size_t N>
-SmallString<N>::SmallString(std::string_view sv)
+template <std::size_t N, typename Allocator>
+SmallString<N, Allocator>::SmallString(const Allocator& allocator)
+    : data_(MakeContainerAllocator(allocator)) {}
+
+template <std::size_t N, typename Allocator>
+SmallString<N, Allocator>::SmallString(std::string_view sv)
     : data_(sv.begin(), sv.end()) {}
 
-template <std::size_t N>
-SmallString<N>::operator std::string_view() const {
+template <std::size_t N, typename Allocator>
+SmallString<N, Allocator>::SmallString(std::string_view sv,
+                                       const Allocator& allocator)
+    : data_(MakeContainerAllocator(allocator)) {
+  data_.assign(sv.begin(), sv.end());
+}
+
+template <std::size_t N, typename Allocator>
+SmallString<N, Allocator>::operator std::string_view() const {
   return std::string_view{data_.data(), data_.size()};
 }
 
-template <std::size_t N>
-SmallString<N>& SmallString<N>::operator=(std::string_view sv) {
-  data_ = {sv.begin(), sv.end()};
+template <std::size_t N, typename Allocator>
+SmallString<N, Allocator>& SmallString<N, Allocator>::operator=(
+    std::string_view sv) {
+  // Keeps the allocator of the string
+  data_.assign(sv.begin(), sv.end());
   return *this;
 }
 
-template <std::size_t N>
-bool operator==(const SmallString<N>& str, std::string_view sv) {
+template <std::size_t N, typename Allocator>
+bool operator==(const SmallString<N, Allocator>& str, std::string_view sv) {
   return std::string_view{str} == sv;
 }
 
-template <std::size_t N>
-bool operator==(std::string_view sv, const SmallString<N>& str) {
+template <std::size_t N, typename Allocator>
+bool operator==(std::string_view sv, const SmallString<N, Allocator>& str) {
   return std::string_view{str} == sv;
 }
 
-template <std::size_t N>
-bool operator==(const SmallString<N>& str1, const SmallString<N>& str2) {
+template <std::size_t N, typename Allocator>
+bool operator==(const SmallString<N, Allocator>& str1,
+                const SmallString<N, Allocator>& str2) {
   return std::string_view{str1} == std::string_view{str2};
 }
 
-template <std::size_t N>
-bool operator!=(const SmallString<N>& str1, const SmallString<N>& str2) {
+template <std::size_t N, typename Allocator>
+bool operator!=(const SmallString<N, Allocator>& str1,
+                const SmallString<N, Allocator>& str2) {
   return !(str1 == str2);
 }
 
-template <std::size_t N>
-const char& SmallString<N>::operator[](std::size_t pos) const {
+template <std::size_t N, typename Allocator>
+const char& SmallString<N, Allocator>::operator[](std::size_t pos) const {
   return data_[pos];
 }
 
-template <std::size_t N>
-char& SmallString<N>::operator[](std::size_t pos) {
+template <std::size_t N, typename Allocator>
+char& SmallString<N, Allocator>::operator[](std::size_t pos) {
   return data_[pos];
 }
 
-template <std::size_t N>
-const char& SmallString<N>::at(std::size_t pos) const {
+template <std::size_t N, typename Allocator>
+const char& SmallString<N, Allocator>::at(std::size_t pos) const {
   if (size() <= pos) throw std::out_of_range("at");
   return data_[pos];
 }
 
-template <std::size_t N>
-char& SmallString<N>::at(std::size_t pos) {
+template <std::size_t N, typename Allocator>
+char& SmallString<N, Allocator>::at(std::size_t pos) {
   if (size() <= pos) throw std::out_of_range("at");
   return data_[pos];
 }
 
-template <std::size_t N>
-typename SmallString<N>::iterator SmallString<N>::begin() noexcept {
+template <std::size_t N, typename Allocator>
+typename SmallString<N, Allocator>::iterator
+SmallString<N, Allocator>::begin() noexcept {
   return {data_.begin()};
 }
 
-template <std::size_t N>
-typename SmallString<N>::const_iterator SmallString<N>::begin() const noexcept {
+template <std::size_t N, typename Allocator>
+typename SmallString<N, Allocator>::const_iterator
+SmallString<N, Allocator>::begin() const noexcept {
   return {data_.begin()};
 }
 
-template <std::size_t N>
-typename SmallString<N>::iterator SmallString<N>::end() noexcept {
+template <std::size_t N, typename Allocator>
+typename SmallString<N, Allocator>::iterator
+SmallString<N, Allocator>::end() noexcept {
   return {data_.end()};
 }
 
-template <std::size_t N>
-typename SmallString<N>::const_iterator SmallString<N>::end() const noexcept {
+template <std::size_t N, typename Allocator>
+typename SmallString<N, Allocator>::const_iterator
+SmallString<N, Allocator>::end() const noexcept {
   return {data_.end()};
 }
 
-template <std::size_t N>
-std::size_t SmallString<N>::size() const noexcept {
+template <std::size_t N, typename Allocator>
+std::size_t SmallString<N, Allocator>::size() const noexcept {
   return data_.size();
 }
 
-template <std::size_t N>
-const char* SmallString<N>::data() const noexcept {
+template <std::size_t N, typename Allocator>
+const char* SmallString<N, Allocator>::data() const noexcept {
   return data_.data();
 }
 
-template <std::size_t N>
-char* SmallString<N>::data() noexcept {
+template <std::size_t N, typename Allocator>
+char* SmallString<N, Allocator>::data() noexcept {
   return data_.data();
 }
 
-template <std::size_t N>
-bool SmallString<N>::empty() const noexcept {
+template <std::size_t N, typename Allocator>
+bool SmallString<N, Allocator>::empty() const noexcept {
   return data_.empty();
 }
 
-template <std::size_t N>
-char& SmallString<N>::front() {
+template <std::size_t N, typename Allocator>
+char& SmallString<N, Allocator>::front() {
   return data_.front();
 }
 
-template <std::size_t N>
-const char& SmallString<N>::front() const {
+template <std::size_t N, typename Allocator>
+const char& SmallString<N, Allocator>::front() const {
   return data_.front();
 }
 
-template <std::size_t N>
-char& SmallString<N>::back() {
+template <std::size_t N, typename Allocator>
+char& SmallString<N, Allocator>::back() {
   return data_.back();
 }
 
-template <std::size_t N>
-const char& SmallString<N>::back() const {
+template <std::size_t N, typename Allocator>
+const char& SmallString<N, Allocator>::back() const {
   return data_.back();
 }
 
-template <std::size_t N>
-void SmallString<N>::push_back(char c) {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::push_back(char c) {
   data_.push_back(c);
 }
 
-template <std::size_t N>
-void SmallString<N>::append(std::string_view str) {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::append(std::string_view str) {
   std::size_t old_size = data_.size();
   data_.insert(data_.begin() + old_size, str.begin(), str.end());
 }
 
-template <std::size_t N>
-void SmallString<N>::pop_back() {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::pop_back() {
   data_.pop_back();
 }
 
-template <std::size_t N>
-void SmallString<N>::resize(std::size_t n, char c) {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::resize(std::size_t n, char c) {
   data_.resize(n, c);
 }
 
-template <std::size_t N>
+template <std::size_t N, typename Allocator>
 template <class Operation>
-void SmallString<N>::resize_and_overwrite(std::size_t size, Operation op) {
+void SmallString<N, Allocator>::resize_and_overwrite(std::size_t size,
+                                                     Operation op) {
   data_.resize(size, boost::container::default_init);
   data_.resize(std::move(op)(data_.data(), size),
                boost::container::default_init);
   UASSERT(data_.size() <= size);
 }
 
-template <std::size_t N>
-void SmallString<N>::shrink_to_fit() {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::shrink_to_fit() {
   data_.shrink_to_fit();
 }
 
-template <std::size_t N>
-std::size_t SmallString<N>::capacity() const noexcept {
+template <std::size_t N, typename Allocator>
+std::size_t SmallString<N, Allocator>::capacity() const noexcept {
   return data_.capacity();
 }
 
-template <std::size_t N>
-void SmallString<N>::reserve(std::size_t n) {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::reserve(std::size_t n) {
   return data_.reserve(n);
 }
 
-template <std::size_t N>
-void SmallString<N>::clear() noexcept {
+template <std::size_t N, typename Allocator>
+void SmallString<N, Allocator>::clear() noexcept {
   data_.clear();
 }
 
+template <std::size_t N, typename Allocator>
+Allocator SmallString<N, Allocator>::get_allocator() const noexcept {
+  if constexpr (std::is_same_v<Allocator, std::allocator<char>>) {
+    return Allocator{};
+  } else {
+    // small_vector wraps the allocator to tell the inline storage apart
+    return static_cast<const Allocator&>(data_.get_allocator());
+  }
+}
+
+template <std::size_t N, typename Allocator>
+typename SmallString<N, Allocator>::Container::allocator_type
+SmallString<N, Allocator>::MakeContainerAllocator(
+    [[maybe_unused]] const Allocator& allocator) noexcept {
+  if constexpr (std::is_same_v<Allocator, std::allocator<char>>) {
+    return {};
+  } else {
+    return typename Container::allocator_type{allocator};
+  }
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
 
-template <std::size_t N>
-struct std::hash<USERVER_NAMESPACE::utils::SmallString<N>> {
+template <std::size_t N, typename Allocator>
+struct std::hash<USERVER_NAMESPACE::utils::SmallString<N, Allocator>> {
   std::size_t operator()(
-      const USERVER_NAMESPACE::utils::SmallString<N>& s) const noexcept {
+      const USERVER_NAMESPACE::utils::SmallString<N, Allocator>& s)
+      const noexcept {
     return std::hash<std::string_view>{}(std::string_view{s});
   }
 };
@@ -1,12 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 // Forward declaration
-template <std::size_t N>
+template <std::size_t N, typename Allocator = std::allocator<char>>
 class SmallString;
 }  // namespace utils
 
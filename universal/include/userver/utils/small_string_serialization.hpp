@@ -12,8 +12,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
-template <typename Value, std::size_t N>
-Value Serialize(const SmallString<N>& value, formats::serialize::To<Value>) {
+template <typename Value, std::size_t N, typename Allocator>
+Value Serialize(const SmallString<N, Allocator>& value,
+                formats::serialize::To<Value>) {
   return typename Value::Builder{std::string_view{value}}.ExtractValue();
 }
 
@@ -26,12 +27,13 @@ SmallString<N> Parse(const Value& value, formats::parse::To<SmallString<N>>) {
 
 USERVER_NAMESPACE_END
 
-template <std::size_t N>
-struct fmt::formatter<USERVER_NAMESPACE::utils::SmallString<N>>
+template <std::size_t N, typename Allocator>
+struct fmt::formatter<USERVER_NAMESPACE::utils::SmallString<N, Allocator>>
     : public fmt::formatter<std::string_view> {
   template <typename FormatContext>
-  auto format(const USERVER_NAMESPACE::utils::SmallString<N>& value,
-              FormatContext& ctx) const -> decltype(ctx.out()) {
+  auto format(
+      const USERVER_NAMESPACE::utils::SmallString<N, Allocator>& value,
+      FormatContext& ctx) const -> decltype(ctx.out()) {
     return formatter<std::string_view>::format(std::string_view{value}, ctx);
   }
 };
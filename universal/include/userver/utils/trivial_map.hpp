@@ -3,7 +3,10 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -20,6 +23,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+template <const auto& Map>
+class TrivialPerfectHashIndex;
+
 namespace impl {
 
 constexpr bool HasUppercaseAscii(std::string_view value) noexcept {
@@ -458,6 +464,214 @@ class CaseSecondDescriber final {
   std::string description_{};
 };
 
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+ public:
+  using Value = std::conditional_t<std::is_void_v<Second>, bool, Second>;
+
+  template <typename FirstArg, typename SecondArg>
+  constexpr CaseCollector& Case(FirstArg first, SecondArg second) noexcept {
+    values_[size_] = second;
+    return Case(first);
+  }
+
+  template <typename FirstArg>
+  constexpr CaseCollector& Case(FirstArg first) noexcept {
+    keys_[size_] = first;
+    ++size_;
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetKeys() const noexcept {
+    return keys_;
+  }
+
+  constexpr const std::array<Value, Size>& GetValues() const noexcept {
+    return values_;
+  }
+
+ private:
+  std::array<First, Size> keys_{};
+  std::array<Value, Size> values_{};
+  std::size_t size_{0};
+};
+
+constexpr std::uint64_t PerfectHashByte(const char* data) noexcept {
+  return static_cast<unsigned char>(*data);
+}
+
+// Little endian loads, that compilers merge into a single instruction
+constexpr std::uint64_t PerfectHashLoad4(const char* data) noexcept {
+  return PerfectHashByte(data) | (PerfectHashByte(data + 1) << 8) |
+         (PerfectHashByte(data + 2) << 16) | (PerfectHashByte(data + 3) << 24);
+}
+
+constexpr std::uint64_t PerfectHashLoad8(const char* data) noexcept {
+  return PerfectHashLoad4(data) | (PerfectHashLoad4(data + 4) << 32);
+}
+
+// Reads all the bytes with a few constant size loads, some bytes may be read
+// twice
+constexpr std::uint64_t PerfectHashLoadTail(const char* data,
+                                            std::size_t size) noexcept {
+  if (size >= 4) {
+    return PerfectHashLoad4(data) | (PerfectHashLoad4(data + size - 4) << 32);
+  }
+  if (size > 0) {
+    return PerfectHashByte(data) | (PerfectHashByte(data + size / 2) << 8) |
+           (PerfectHashByte(data + size - 1) << 16);
+  }
+  return 0;
+}
+
+// Spreads the input bits over all the bits of the result
+constexpr std::uint64_t PerfectHashMix(std::uint64_t value) noexcept {
+  value ^= value >> 32;
+  value *= 0xd6e8feb86659fd93ULL;
+  value ^= value >> 32;
+  return value;
+}
+
+constexpr std::uint64_t PerfectHashString(std::string_view value) noexcept {
+  constexpr std::uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+  const auto* data = value.data();
+  const auto size = value.size();
+
+  std::uint64_t hash = size * kMultiplier;
+  if (size < 8) {
+    return PerfectHashMix((hash ^ PerfectHashLoadTail(data, size)) *
+                          kMultiplier);
+  }
+
+  const auto* const last = data + size - 8;
+  for (; data < last; data += 8) {
+    hash = PerfectHashMix((hash ^ PerfectHashLoad8(data)) * kMultiplier);
+  }
+  return PerfectHashMix((hash ^ PerfectHashLoad8(last)) * kMultiplier);
+}
+
+constexpr std::size_t PerfectHashLog2(std::size_t value) noexcept {
+  std::size_t result = 0;
+  while ((std::size_t{1} << result) < value) ++result;
+  return result;
+}
+
+// "Hash and displace" perfect hashing: each key goes to a bucket by its
+// hash, and each bucket gets a seed that puts all of its keys into free
+// slots of the table.
+template <std::size_t Size>
+struct PerfectHashTable final {
+  static constexpr std::size_t kBucketsLog2 = PerfectHashLog2(Size / 2 + 1);
+  // Load factor of at most 0.8 keeps the compile time search short
+  static constexpr std::size_t kSlotsLog2 =
+      PerfectHashLog2(Size + Size / 4 + 1);
+  static constexpr std::size_t kBuckets = std::size_t{1} << kBucketsLog2;
+  static constexpr std::size_t kSlots = std::size_t{1} << kSlotsLog2;
+  static constexpr auto kNoCase = static_cast<std::uint32_t>(Size);
+  static constexpr std::uint32_t kMaxSeed = 1 << 16;
+
+  static_assert(Size < std::numeric_limits<std::uint32_t>::max());
+
+  static constexpr std::size_t GetBucket(std::uint64_t hash) noexcept {
+    return hash & (kBuckets - 1);
+  }
+
+  static constexpr std::size_t GetSlot(std::uint64_t hash,
+                                       std::uint32_t seed) noexcept {
+    if constexpr (kSlotsLog2 == 0) {
+      return 0;
+    } else {
+      // Multiplicative hashing, the high bits are the best mixed ones
+      constexpr std::uint64_t kMultiplier = 0xff51afd7ed558ccdULL;
+      return ((hash ^ (seed * kMultiplier)) * kMultiplier) >>
+             (64 - kSlotsLog2);
+    }
+  }
+
+  constexpr std::size_t FindSlot(std::string_view key) const noexcept {
+    const auto hash = PerfectHashString(key);
+    return GetSlot(hash, seeds[GetBucket(hash)]);
+  }
+
+  std::array<std::uint32_t, kBuckets> seeds{};
+  std::array<std::uint32_t, kSlots> cases{};
+  bool is_built{false};
+};
+
+template <std::size_t Size>
+constexpr PerfectHashTable<Size> MakePerfectHashTable(
+    const std::array<std::string_view, Size>& keys) {
+  using Table = PerfectHashTable<Size>;
+  Table table{};
+  for (auto& case_index : table.cases) case_index = Table::kNoCase;
+
+  std::array<std::uint64_t, Size> hashes{};
+  std::array<bool, Size> is_duplicate{};
+  std::array<std::size_t, Table::kBuckets + 1> bucket_begins{};
+  for (std::size_t i = 0; i < Size; ++i) {
+    hashes[i] = PerfectHashString(keys[i]);
+
+    // Only the first Case of the duplicate keys is found, as in TrivialBiMap
+    for (std::size_t j = 0; j < i && !is_duplicate[i]; ++j) {
+      is_duplicate[i] = hashes[j] == hashes[i] && keys[j] == keys[i];
+    }
+    if (!is_duplicate[i]) ++bucket_begins[Table::GetBucket(hashes[i]) + 1];
+  }
+
+  std::size_t max_bucket_size = 0;
+  for (std::size_t bucket = 0; bucket < Table::kBuckets; ++bucket) {
+    if (bucket_begins[bucket + 1] > max_bucket_size) {
+      max_bucket_size = bucket_begins[bucket + 1];
+    }
+    bucket_begins[bucket + 1] += bucket_begins[bucket];
+  }
+
+  // Case indices sorted by bucket
+  std::array<std::uint32_t, Size> bucket_cases{};
+  auto bucket_ends = bucket_begins;
+  for (std::size_t i = 0; i < Size; ++i) {
+    if (is_duplicate[i]) continue;
+    bucket_cases[bucket_ends[Table::GetBucket(hashes[i])]++] =
+        static_cast<std::uint32_t>(i);
+  }
+
+  // Larger buckets are harder to place, so they go first
+  for (std::size_t size = max_bucket_size; size > 0; --size) {
+    for (std::size_t bucket = 0; bucket < Table::kBuckets; ++bucket) {
+      const auto begin = bucket_begins[bucket];
+      const auto end = bucket_begins[bucket + 1];
+      if (end - begin != size) continue;
+
+      bool is_placed = false;
+      for (std::uint32_t seed = 0; seed < Table::kMaxSeed && !is_placed;
+           ++seed) {
+        auto placed = begin;
+        for (; placed < end; ++placed) {
+          const auto case_index = bucket_cases[placed];
+          const auto slot = Table::GetSlot(hashes[case_index], seed);
+          if (table.cases[slot] != Table::kNoCase) break;
+          table.cases[slot] = case_index;
+        }
+
+        is_placed = (placed == end);
+        if (is_placed) {
+          table.seeds[bucket] = seed;
+        } else {
+          for (auto i = begin; i < placed; ++i) {
+            const auto slot = Table::GetSlot(hashes[bucket_cases[i]], seed);
+            table.cases[slot] = Table::kNoCase;
+          }
+        }
+      }
+
+      if (!is_placed) return table;
+    }
+  }
+
+  table.is_built = true;
+  return table;
+}
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -483,6 +697,9 @@ class CaseSecondDescriber final {
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// For a single value Case statements see @ref utils::TrivialSet.
+///
+/// For maps with a lot of string keys of the same length see
+/// @ref utils::TrivialPerfectHashIndex.
 template <typename BuilderFunc>
 class TrivialBiMap final {
   using TypesPair =
@@ -621,6 +838,9 @@ class TrivialBiMap final {
   }
 
  private:
+  template <const auto& Map>
+  friend class TrivialPerfectHashIndex;
+
   const BuilderFunc func_;
 };
 
@@ -679,6 +899,9 @@ class TrivialSet final {
   }
 
  private:
+  template <const auto& Map>
+  friend class TrivialPerfectHashIndex;
+
   const BuilderFunc func_;
 };
 
@@ -754,6 +977,69 @@ constexpr auto MakeTrivialBiMap() {
   });
 }
 
+/// @ingroup userver_universal userver_containers
+///
+/// @brief O(1) search by the string keys of a `constexpr` utils::TrivialBiMap
+/// or utils::TrivialSet.
+///
+/// The perfect hash table for the keys is built at compile time, so there is
+/// no runtime initialization. A search computes the hash of the input once
+/// and compares it with at most one key, regardless of the map size.
+///
+/// utils::TrivialBiMap compares the input with all the keys of the same
+/// length, so prefer the index for maps with a lot of keys of the same
+/// length, e.g. the HTTP headers or the long enum lists.
+///
+/// @snippet universal/src/utils/trivial_map_test.cpp  sample perfect hash
+template <const auto& Map>
+class TrivialPerfectHashIndex final {
+  using MapType = std::decay_t<decltype(Map)>;
+
+ public:
+  using First = typename MapType::First;
+  using Second = typename MapType::Second;
+
+  static_assert(std::is_same_v<First, std::string_view>,
+                "First type in Case must be a string");
+
+  /// Returns the Second of the `value` key, if the map has it
+  constexpr std::optional<Second> TryFindByFirst(
+      std::string_view value) const noexcept {
+    static_assert(!std::is_void_v<Second>,
+                  "Use Contains() for the utils::TrivialSet");
+    const auto case_index = FindCase(value);
+    if (case_index == Table::kNoCase) return std::nullopt;
+    return kCases.GetValues()[case_index];
+  }
+
+  /// Returns true if the map or set has the `value` key
+  constexpr bool Contains(std::string_view value) const noexcept {
+    return FindCase(value) != Table::kNoCase;
+  }
+
+  constexpr std::size_t size() const noexcept { return Map.size(); }
+
+ private:
+  static constexpr auto kSize = Map.size();
+  using Table = impl::PerfectHashTable<kSize>;
+
+  static constexpr auto kCases = Map.func_([]() {
+    return impl::CaseCollector<First, Second, kSize>{};
+  });
+  static constexpr Table kTable = impl::MakePerfectHashTable(kCases.GetKeys());
+  static_assert(kTable.is_built,
+                "Failed to build the perfect hash table for the keys");
+
+  static constexpr std::uint32_t FindCase(std::string_view value) noexcept {
+    const auto case_index = kTable.cases[kTable.FindSlot(value)];
+    if (case_index == Table::kNoCase ||
+        kCases.GetKeys()[case_index] != value) {
+      return Table::kNoCase;
+    }
+    return case_index;
+  }
+};
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
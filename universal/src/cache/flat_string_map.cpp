@@ -0,0 +1,147 @@
+#include <userver/cache/flat_string_map.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <userver/utils/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+// Layout:
+// Header, Entry[size], std::uint32_t buckets[buckets_count], strings
+//
+// A bucket holds the index of its entry plus 1, 0 for an empty one. The
+// collisions are resolved with linear probing, at least half of the buckets
+// are empty.
+
+constexpr std::uint64_t kMagic = 0x3150414d4c465355;  // "USFLMAP1"
+
+struct Header {
+  std::uint64_t magic;
+  std::uint64_t size;
+  std::uint64_t buckets_count;
+};
+
+struct Entry {
+  std::uint64_t offset;
+  std::uint32_t key_size;
+  std::uint32_t value_size;
+};
+
+constexpr std::size_t kBucketSize = sizeof(std::uint32_t);
+
+std::uint64_t HashKey(std::string_view key) {
+  return utils::hash::WyHash(key, 0);
+}
+
+std::size_t GetBucketsOffset(std::size_t size) {
+  return sizeof(Header) + size * sizeof(Entry);
+}
+
+template <typename T>
+T Load(std::string_view buffer, std::size_t offset) {
+  T result;
+  std::memcpy(&result, buffer.data() + offset, sizeof(T));
+  return result;
+}
+
+template <typename T>
+void Store(std::string& buffer, std::size_t offset, const T& value) {
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+}  // namespace
+
+std::string FlatStringMap::Build(
+    const std::vector<std::pair<std::string, std::string>>& items) {
+  std::unordered_map<std::string_view, std::string_view> unique;
+  unique.reserve(items.size());
+  for (const auto& [key, value] : items) unique[key] = value;
+
+  const auto size = unique.size();
+  std::size_t buckets_count = 1;
+  while (buckets_count < size * 2) buckets_count *= 2;
+
+  const auto strings_offset =
+      GetBucketsOffset(size) + buckets_count * kBucketSize;
+  std::size_t strings_size = 0;
+  for (const auto& [key, value] : unique) {
+    strings_size += key.size() + value.size();
+  }
+
+  std::string buffer(strings_offset + strings_size, '\0');
+  Store(buffer, 0, Header{kMagic, size, buckets_count});
+
+  std::uint32_t index = 0;
+  auto offset = strings_offset;
+  for (const auto& [key, value] : unique) {
+    Store(buffer, sizeof(Header) + index * sizeof(Entry),
+          Entry{offset, static_cast<std::uint32_t>(key.size()),
+                static_cast<std::uint32_t>(value.size())});
+    std::memcpy(buffer.data() + offset, key.data(), key.size());
+    std::memcpy(buffer.data() + offset + key.size(), value.data(),
+                value.size());
+    offset += key.size() + value.size();
+
+    auto bucket = HashKey(key) & (buckets_count - 1);
+    while (Load<std::uint32_t>(buffer,
+                               GetBucketsOffset(size) + bucket * kBucketSize)) {
+      bucket = (bucket + 1) & (buckets_count - 1);
+    }
+    ++index;
+    Store(buffer, GetBucketsOffset(size) + bucket * kBucketSize, index);
+  }
+  return buffer;
+}
+
+FlatStringMap::FlatStringMap(std::string_view buffer) : buffer_(buffer) {
+  if (buffer_.size() < sizeof(Header)) {
+    throw std::runtime_error("FlatStringMap buffer is too small");
+  }
+  const auto header = Load<Header>(buffer_, 0);
+  if (header.magic != kMagic) {
+    throw std::runtime_error("FlatStringMap buffer has invalid magic");
+  }
+  if (header.buckets_count == 0 ||
+      (header.buckets_count & (header.buckets_count - 1)) ||
+      header.buckets_count < header.size ||
+      header.size > buffer_.size() / sizeof(Entry) ||
+      header.buckets_count > buffer_.size() / kBucketSize ||
+      GetBucketsOffset(header.size) + header.buckets_count * kBucketSize >
+          buffer_.size()) {
+    throw std::runtime_error("FlatStringMap buffer has invalid header");
+  }
+  size_ = header.size;
+  buckets_count_ = header.buckets_count;
+}
+
+std::optional<std::string_view> FlatStringMap::Find(
+    std::string_view key) const {
+  const auto buckets_offset = GetBucketsOffset(size_);
+  auto bucket = HashKey(key) & (buckets_count_ - 1);
+  for (std::size_t probes = 0; probes < buckets_count_; ++probes) {
+    const auto index =
+        Load<std::uint32_t>(buffer_, buckets_offset + bucket * kBucketSize);
+    if (index == 0 || index > size_) return std::nullopt;
+
+    const auto entry =
+        Load<Entry>(buffer_, sizeof(Header) + (index - 1) * sizeof(Entry));
+    if (entry.key_size == key.size() && entry.offset <= buffer_.size() &&
+        buffer_.size() - entry.offset >=
+            std::uint64_t{entry.key_size} + entry.value_size &&
+        buffer_.substr(entry.offset, entry.key_size) == key) {
+      return buffer_.substr(entry.offset + entry.key_size, entry.value_size);
+    }
+    bucket = (bucket + 1) & (buckets_count_ - 1);
+  }
+  return std::nullopt;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <userver/cache/flat_string_map.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(FlatStringMap, Sample) {
+  /// [Sample FlatStringMap]
+  const auto buffer = cache::FlatStringMap::Build({
+      {"moscow", "msk"},
+      {"saint-petersburg", "spb"},
+  });
+
+  // The buffer may be written to a file and mapped by another process
+  const cache::FlatStringMap map{buffer};
+  EXPECT_EQ(map.Find("moscow"), "msk");
+  EXPECT_EQ(map.Find("kazan"), std::nullopt);
+  /// [Sample FlatStringMap]
+
+  EXPECT_EQ(map.GetSize(), 2);
+}
+
+TEST(FlatStringMap, Empty) {
+  const auto buffer = cache::FlatStringMap::Build({});
+  const cache::FlatStringMap map{buffer};
+  EXPECT_EQ(map.GetSize(), 0);
+  EXPECT_EQ(map.Find(""), std::nullopt);
+}
+
+TEST(FlatStringMap, Many) {
+  std::vector<std::pair<std::string, std::string>> items;
+  for (int i = 0; i < 10000; ++i) {
+    items.emplace_back("key" + std::to_string(i), std::string(i % 7, 'v'));
+  }
+  items.emplace_back("", "empty key");
+  items.emplace_back("key1", "overridden");
+
+  const auto buffer = cache::FlatStringMap::Build(items);
+  const cache::FlatStringMap map{buffer};
+  EXPECT_EQ(map.GetSize(), 10001);
+  for (int i = 2; i < 10000; ++i) {
+    EXPECT_EQ(map.Find("key" + std::to_string(i)), std::string(i % 7, 'v'));
+  }
+  EXPECT_EQ(map.Find("key1"), "overridden");
+  EXPECT_EQ(map.Find(""), "empty key");
+  EXPECT_EQ(map.Find("key10000"), std::nullopt);
+}
+
+TEST(FlatStringMap, Invalid) {
+  EXPECT_THROW(cache::FlatStringMap{""}, std::runtime_error);
+  EXPECT_THROW(cache::FlatStringMap{std::string(64, 'x')}, std::runtime_error);
+
+  auto buffer = cache::FlatStringMap::Build({{"a", "b"}});
+  buffer.resize(buffer.size() / 2);
+  EXPECT_THROW(cache::FlatStringMap{buffer}, std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
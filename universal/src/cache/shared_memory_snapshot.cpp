@@ -0,0 +1,130 @@
+#include <userver/cache/shared_memory_snapshot.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <optional>
+#include <stdexcept>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utils/from_string.hpp>
+
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+constexpr auto kPerms = boost::filesystem::perms::owner_read |
+                        boost::filesystem::perms::owner_write |
+                        boost::filesystem::perms::group_read |
+                        boost::filesystem::perms::others_read;
+
+std::string GetCurrentPath(const std::string& path) {
+  return path + ".current";
+}
+
+std::string GetSegmentPath(const std::string& path, std::uint64_t generation) {
+  return path + '.' + std::to_string(generation);
+}
+
+std::optional<std::uint64_t> ReadCurrentGeneration(const std::string& path) {
+  const auto current_path = GetCurrentPath(path);
+  if (!fs::blocking::FileExists(current_path)) return std::nullopt;
+  return utils::FromString<std::uint64_t>(
+      fs::blocking::ReadFileContents(current_path));
+}
+
+// Returns nullptr if the segment is removed already
+std::shared_ptr<const SharedMemorySnapshot> MapSegment(
+    const std::string& path, std::uint64_t generation) {
+  const auto segment_path = GetSegmentPath(path, generation);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  const int fd = ::open(segment_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1 && errno == ENOENT) return nullptr;
+  utils::CheckSyscall(fd, "opening {}", segment_path);
+
+  struct stat st {};
+  if (::fstat(fd, &st) == -1) {
+    const auto err_value = errno;
+    ::close(fd);
+    errno = err_value;
+    utils::CheckSyscall(-1, "getting the size of {}", segment_path);
+  }
+
+  const auto size = static_cast<std::size_t>(st.st_size);
+  void* data = nullptr;
+  if (size != 0) {
+    data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  const auto err_value = errno;
+  // the mapping keeps the segment alive
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    errno = err_value;
+    utils::CheckSyscall(-1, "mapping {}", segment_path);
+  }
+  return std::make_shared<const SharedMemorySnapshot>(generation, data, size);
+}
+
+}  // namespace
+
+SharedMemorySnapshot::SharedMemorySnapshot(std::uint64_t generation,
+                                           const void* data,
+                                           std::size_t size) noexcept
+    : generation_(generation), data_(data), size_(size) {}
+
+SharedMemorySnapshot::~SharedMemorySnapshot() {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  if (size_ != 0) ::munmap(const_cast<void*>(data_), size_);
+}
+
+SharedMemorySnapshotWriter::SharedMemorySnapshotWriter(std::string path)
+    : path_(std::move(path)),
+      generation_(ReadCurrentGeneration(path_).value_or(0)) {}
+
+std::uint64_t SharedMemorySnapshotWriter::Publish(std::string_view data) {
+  const auto generation = generation_ + 1;
+  fs::blocking::RewriteFileContentsAtomically(
+      GetSegmentPath(path_, generation), data, kPerms);
+  fs::blocking::RewriteFileContentsAtomically(
+      GetCurrentPath(path_), std::to_string(generation), kPerms);
+
+  // The readers that mapped the previous generation keep its memory
+  if (generation_ != 0) {
+    fs::blocking::RemoveSingleFile(GetSegmentPath(path_, generation_));
+  }
+  generation_ = generation;
+  return generation_;
+}
+
+SharedMemorySnapshotReader::SharedMemorySnapshotReader(std::string path)
+    : path_(std::move(path)) {}
+
+std::shared_ptr<const SharedMemorySnapshot>
+SharedMemorySnapshotReader::ReadIfChanged() {
+  // The segment may be removed by a newer generation between the reads
+  for (int attempt = 0; attempt < 3; ++attempt) {
+    const auto generation = ReadCurrentGeneration(path_);
+    if (!generation || *generation == generation_) return nullptr;
+
+    if (auto snapshot = MapSegment(path_, *generation)) {
+      generation_ = *generation;
+      return snapshot;
+    }
+  }
+  throw std::runtime_error("Failed to map a generation of " + path_ +
+                           ", it is changed too often");
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <userver/cache/shared_memory_snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/flat_string_map.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(SharedMemorySnapshot, Sample) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/cities";
+
+  /// [Sample SharedMemorySnapshot]
+  // In the process that builds the cache
+  cache::SharedMemorySnapshotWriter writer{path};
+  writer.Publish(cache::FlatStringMap::Build({{"moscow", "msk"}}));
+
+  // In the other processes on the same host
+  cache::SharedMemorySnapshotReader reader{path};
+  const auto snapshot = reader.ReadIfChanged();
+  ASSERT_TRUE(snapshot);
+  const cache::FlatStringMap map{snapshot->GetData()};
+  EXPECT_EQ(map.Find("moscow"), "msk");
+  /// [Sample SharedMemorySnapshot]
+}
+
+TEST(SharedMemorySnapshot, Generations) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/snapshot";
+
+  cache::SharedMemorySnapshotReader reader{path};
+  EXPECT_EQ(reader.ReadIfChanged(), nullptr);
+
+  cache::SharedMemorySnapshotWriter writer{path};
+  EXPECT_EQ(writer.Publish("first"), 1);
+
+  const auto first = reader.ReadIfChanged();
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first->GetGeneration(), 1);
+  EXPECT_EQ(first->GetData(), "first");
+  EXPECT_EQ(reader.ReadIfChanged(), nullptr);
+
+  EXPECT_EQ(writer.Publish("second"), 2);
+  EXPECT_FALSE(fs::blocking::FileExists(path + ".1"));
+
+  const auto second = reader.ReadIfChanged();
+  ASSERT_TRUE(second);
+  EXPECT_EQ(second->GetData(), "second");
+  // The old generation is still mapped
+  EXPECT_EQ(first->GetData(), "first");
+
+  // A restarted writer continues the generations
+  cache::SharedMemorySnapshotWriter restarted_writer{path};
+  EXPECT_EQ(restarted_writer.Publish(""), 3);
+  const auto empty = reader.ReadIfChanged();
+  ASSERT_TRUE(empty);
+  EXPECT_EQ(empty->GetData(), "");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr unsigned kKeysCount = 100'000;
+constexpr std::size_t kTraceSize = 1'000'000;
+constexpr double kZipfExponent = 0.9;
+
+// Each 10th request of the trace starts a scan of 100 keys that are never
+// requested again
+constexpr std::size_t kScanPeriod = 10;
+constexpr unsigned kScanSize = 100;
+
+std::vector<unsigned> MakeZipfTrace(bool with_scans) {
+  std::vector<double> cdf(kKeysCount);
+  double sum = 0;
+  for (unsigned i = 0; i < kKeysCount; ++i) {
+    sum += 1.0 / std::pow(i + 1, kZipfExponent);
+    cdf[i] = sum;
+  }
+
+  std::mt19937 engine{42};
+  std::uniform_real_distribution<double> distribution{0, sum};
+  unsigned scan_key = kKeysCount;
+
+  std::vector<unsigned> trace;
+  trace.reserve(kTraceSize);
+  while (trace.size() < kTraceSize) {
+    const auto it =
+        std::lower_bound(cdf.begin(), cdf.end(), distribution(engine));
+    trace.push_back(it - cdf.begin());
+
+    if (with_scans && trace.size() % (kScanPeriod * kScanSize) == 0) {
+      for (unsigned i = 0; i < kScanSize; ++i) trace.push_back(scan_key++);
+    }
+  }
+  return trace;
+}
+
+const std::vector<unsigned>& GetTrace(bool with_scans) {
+  static const auto kTrace = MakeZipfTrace(false);
+  static const auto kTraceWithScans = MakeZipfTrace(true);
+  return with_scans ? kTraceWithScans : kTrace;
+}
+
+template <cache::CachePolicy Policy>
+double GetHitRatio(std::size_t cache_size, const std::vector<unsigned>& trace) {
+  cache::LruMap<unsigned, unsigned, std::hash<unsigned>,
+                std::equal_to<unsigned>, Policy>
+      lru(cache_size);
+  std::size_t hits = 0;
+  for (const auto key : trace) {
+    if (lru.Get(key)) {
+      ++hits;
+    } else {
+      lru.Put(key, key);
+    }
+  }
+  return static_cast<double>(hits) / trace.size();
+}
+
+void LruHitRatio(benchmark::State& state, cache::CachePolicy policy,
+                 bool with_scans) {
+  const auto& trace = GetTrace(with_scans);
+  double hit_ratio = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    hit_ratio =
+        policy == cache::CachePolicy::kTinyLFU
+            ? GetHitRatio<cache::CachePolicy::kTinyLFU>(state.range(0), trace)
+            : GetHitRatio<cache::CachePolicy::kLRU>(state.range(0), trace);
+    benchmark::DoNotOptimize(hit_ratio);
+  }
+  state.counters["hit_ratio"] = hit_ratio;
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(LruHitRatio, lru_zipf, cache::CachePolicy::kLRU, false)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LruHitRatio, tinylfu_zipf, cache::CachePolicy::kTinyLFU,
+                  false)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LruHitRatio, lru_zipf_with_scans, cache::CachePolicy::kLRU,
+                  true)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LruHitRatio, tinylfu_zipf_with_scans,
+                  cache::CachePolicy::kTinyLFU, true)
+    ->RangeMultiplier(10)
+    ->Range(100, 10'000)
+    ->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,86 @@
+#include <userver/cache/impl/tinylfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using TinyLfu = cache::impl::TinyLfuBase<int, int>;
+
+TEST(TinyLfu, SetGet) {
+  TinyLfu cache(10);
+  EXPECT_EQ(nullptr, cache.Get(1));
+  EXPECT_TRUE(cache.Put(1, 2));
+  EXPECT_EQ(2, *cache.Get(1));
+  EXPECT_FALSE(cache.Put(1, 3));
+  EXPECT_EQ(3, *cache.Get(1));
+  EXPECT_EQ(1, cache.GetSize());
+
+  cache.Erase(1);
+  EXPECT_EQ(nullptr, cache.Get(1));
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfu, Capacity) {
+  TinyLfu cache(100);
+  EXPECT_EQ(100, cache.GetCapacity());
+  for (int i = 0; i < 1000; ++i) cache.Put(i, i);
+  EXPECT_EQ(100, cache.GetSize());
+
+  // The newest key is always in the window
+  EXPECT_EQ(999, *cache.Get(999));
+
+  cache.SetMaxSize(10);
+  EXPECT_EQ(10, cache.GetCapacity());
+  EXPECT_LE(cache.GetSize(), 10);
+
+  cache.Clear();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+TEST(TinyLfu, ScanResistance) {
+  constexpr int kHotKeys = 50;
+  TinyLfu cache(100);
+
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < kHotKeys; ++i) {
+      if (!cache.Get(i)) cache.Put(i, i);
+    }
+  }
+
+  // One-hit wonders do not evict the hot keys
+  for (int i = 1000; i < 2000; ++i) cache.Put(i, i);
+
+  int hits = 0;
+  for (int i = 0; i < kHotKeys; ++i) {
+    if (cache.Get(i)) ++hits;
+  }
+  EXPECT_EQ(hits, kHotKeys);
+}
+
+TEST(TinyLfu, FindNode) {
+  TinyLfu cache(10);
+  cache.Put(1, 1);
+  auto* node = cache.FindNode(1);
+  ASSERT_NE(node, nullptr);
+  EXPECT_EQ(node->GetValue(), 1);
+  cache.MarkRecentlyUsed(*node);
+  EXPECT_EQ(cache.FindNode(2), nullptr);
+}
+
+TEST(TinyLfu, LruMap) {
+  cache::LruMap<std::string, int, std::hash<std::string>,
+                std::equal_to<std::string>, cache::CachePolicy::kTinyLFU>
+      cache(10);
+  cache.Put("a", 1);
+  EXPECT_EQ(1, cache.GetOr("a", -1));
+  EXPECT_EQ(-1, cache.GetOr("b", -1));
+  EXPECT_EQ(2, *cache.Emplace("b", 2));
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(10, cache.GetCapacity());
+}
+
+USERVER_NAMESPACE_END
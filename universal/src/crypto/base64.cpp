@@ -1,11 +1,11 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
+#include <string>
 
-#include <userver/crypto/exception.hpp>
-
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#ifdef __SSSE3__
+#include <tmmintrin.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,54 +14,229 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-  std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+constexpr char kPadding = '=';
+constexpr std::uint8_t kInvalid = 0xff;
+
+struct Alphabet final {
+  // 62 and 63 are the only chars that differ between the alphabets
+  char char62;
+  char char63;
+
+  std::array<char, 64> encode{};
+  std::array<std::uint8_t, 256> decode{};
+};
+
+constexpr Alphabet MakeAlphabet(char char62, char char63) {
+  Alphabet result{char62, char63};
+  for (auto& value : result.decode) value = kInvalid;
+
+  std::size_t index = 0;
+  const auto add = [&result, &index](char c) {
+    result.encode[index] = c;
+    result.decode[static_cast<std::uint8_t>(c)] = index;
+    ++index;
+  };
+  for (char c = 'A'; c <= 'Z'; ++c) add(c);
+  for (char c = 'a'; c <= 'z'; ++c) add(c);
+  for (char c = '0'; c <= '9'; ++c) add(c);
+  add(char62);
+  add(char63);
+  return result;
+}
+
+constexpr auto kStandard = MakeAlphabet('+', '/');
+constexpr auto kUrl = MakeAlphabet('-', '_');
+
+#ifdef __SSSE3__
+// Takes 12 bytes from the first 16 of `src`, writes 16 chars to `dst`.
+// See http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+void EncodeBlock(const char* src, char* dst, const Alphabet& alphabet) {
+  auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+  // split the 3-byte groups into 4 6-bit indices, one per byte
+  input = _mm_shuffle_epi8(
+      input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const auto hi = _mm_mulhi_epu16(
+      _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)),
+      _mm_set1_epi32(0x04000040));
+  const auto lo = _mm_mullo_epi16(
+      _mm_and_si128(input, _mm_set1_epi32(0x003f03f0)),
+      _mm_set1_epi32(0x01000010));
+  const auto indices = _mm_or_si128(hi, lo);
+
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+  auto range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  range = _mm_or_si128(
+      range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices),
+                           _mm_set1_epi8(13)));
+
+  const auto kDigitShift = static_cast<char>('0' - 52);
+  const auto shift = _mm_setr_epi8(
+      'a' - 26, kDigitShift, kDigitShift, kDigitShift, kDigitShift,
+      kDigitShift, kDigitShift, kDigitShift, kDigitShift, kDigitShift,
+      kDigitShift, static_cast<char>(alphabet.char62 - 62),
+      static_cast<char>(alphabet.char63 - 63), 'A', 0, 0);
+  const auto chars = _mm_add_epi8(_mm_shuffle_epi8(shift, range), indices);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), chars);
+}
+
+__m128i InRange(__m128i input, char first, char last) {
+  return _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(first - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), input));
+}
+
+__m128i Select(__m128i mask, char value) {
+  return _mm_and_si128(mask, _mm_set1_epi8(value));
+}
+
+// Takes 16 chars from `src`, writes 12 bytes to `dst` and 4 bytes of garbage
+// after them. Returns false and writes nothing if any of the chars is not
+// from the alphabet.
+// See http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+bool DecodeBlock(const char* src, char* dst, const Alphabet& alphabet) {
+  const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+  // chars >= 0x80 are negative and fail all of the checks
+  const auto upper = InRange(input, 'A', 'Z');
+  const auto lower = InRange(input, 'a', 'z');
+  const auto digit = InRange(input, '0', '9');
+  const auto is62 = _mm_cmpeq_epi8(input, _mm_set1_epi8(alphabet.char62));
+  const auto is63 = _mm_cmpeq_epi8(input, _mm_set1_epi8(alphabet.char63));
+
+  const auto valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                  _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+  if (_mm_movemask_epi8(valid) != 0xffff) return false;
+
+  const auto shift = _mm_or_si128(
+      _mm_or_si128(Select(upper, -'A'), Select(lower, 26 - 'a')),
+      _mm_or_si128(Select(digit, 52 - '0'),
+                   _mm_or_si128(Select(is62, 62 - alphabet.char62),
+                                Select(is63, 63 - alphabet.char63))));
+  const auto values = _mm_add_epi8(input, shift);
+
+  // 4 6-bit values -> 24 bits of a 32-bit lane -> 3 bytes
+  const auto pairs =
+      _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const auto quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+  const auto bytes = _mm_shuffle_epi8(
+      quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1,
+                           -1));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), bytes);
+  return true;
+}
+#endif
+
+std::string Encode(std::string_view data, Pad pad, const Alphabet& alphabet) {
+  const std::size_t full_groups = data.size() / 3;
+  const std::size_t tail = data.size() % 3;
+  std::size_t encoded_size = full_groups * 4;
+  if (tail) encoded_size += (pad == Pad::kWith ? 4 : tail + 1);
+
+  std::string result(encoded_size, '\0');
+  const auto* src = reinterpret_cast<const std::uint8_t*>(data.data());
+  const auto* const src_end = src + full_groups * 3;
+  char* dst = result.data();
+
+#ifdef __SSSE3__
+  // EncodeBlock reads 16 bytes to consume 12
+  const auto* const data_end = src + data.size();
+  while (data_end - src >= 16) {
+    EncodeBlock(reinterpret_cast<const char*>(src), dst, alphabet);
+    src += 12;
+    dst += 16;
   }
-  return response;
+#endif
+
+  for (; src != src_end; src += 3) {
+    const std::uint32_t group = (src[0] << 16) | (src[1] << 8) | src[2];
+    *dst++ = alphabet.encode[(group >> 18) & 0x3f];
+    *dst++ = alphabet.encode[(group >> 12) & 0x3f];
+    *dst++ = alphabet.encode[(group >> 6) & 0x3f];
+    *dst++ = alphabet.encode[group & 0x3f];
+  }
+
+  if (tail) {
+    std::uint32_t group = src[0] << 16;
+    if (tail == 2) group |= src[1] << 8;
+    *dst++ = alphabet.encode[(group >> 18) & 0x3f];
+    *dst++ = alphabet.encode[(group >> 12) & 0x3f];
+    if (tail == 2) *dst++ = alphabet.encode[(group >> 6) & 0x3f];
+    if (pad == Pad::kWith) {
+      *dst++ = kPadding;
+      if (tail == 1) *dst++ = kPadding;
+    }
+  }
+
+  return result;
 }
 
-template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
-  std::string response;
-  try {
-    Base64Decoder decoder(new CryptoPP::StringSink(response));
-    decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+// Chars that are not from the alphabet (padding, whitespace, garbage) are
+// skipped, and the trailing bits that do not form a whole byte are dropped.
+std::string Decode(std::string_view data, const Alphabet& alphabet) {
+  // +4 for the garbage written by DecodeBlock
+  std::string result(data.size() / 4 * 3 + 3 + 4, '\0');
+  const char* src = data.data();
+  const char* const src_end = src + data.size();
+  char* dst = result.data();
+
+#ifdef __SSSE3__
+  while (src_end - src >= 16 && DecodeBlock(src, dst, alphabet)) {
+    src += 16;
+    dst += 12;
+  }
+#endif
+
+  // fast path for the valid groups of 4 chars
+  while (src_end - src >= 4) {
+    const auto a = alphabet.decode[static_cast<std::uint8_t>(src[0])];
+    const auto b = alphabet.decode[static_cast<std::uint8_t>(src[1])];
+    const auto c = alphabet.decode[static_cast<std::uint8_t>(src[2])];
+    const auto d = alphabet.decode[static_cast<std::uint8_t>(src[3])];
+    // kInvalid is the only value with the high bit set
+    if ((a | b | c | d) & 0x80) break;
+
+    const std::uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+    *dst++ = static_cast<char>(group >> 16);
+    *dst++ = static_cast<char>(group >> 8);
+    *dst++ = static_cast<char>(group);
+    src += 4;
   }
-  return response;
+
+  // only the low bits_count bits are meaningful
+  std::uint32_t bits = 0;
+  std::size_t bits_count = 0;
+  for (; src != src_end; ++src) {
+    const auto value = alphabet.decode[static_cast<std::uint8_t>(*src)];
+    if (value == kInvalid) continue;
+
+    bits = (bits << 6) | value;
+    bits_count += 6;
+    if (bits_count >= 8) {
+      bits_count -= 8;
+      *dst++ = static_cast<char>(bits >> bits_count);
+    }
+  }
+
+  result.resize(dst - result.data());
+  return result;
 }
 
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  return Encode(data, pad, kStandard);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  return Decode(data, kStandard);
 }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  return Encode(data, pad, kUrl);
 }
 
-std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
-}
+std::string Base64UrlDecode(std::string_view data) { return Decode(data, kUrl); }
 #endif
 
 }  // namespace crypto::base64
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <userver/crypto/base64.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,6 +19,28 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64Long) {
+  std::string data;
+  for (int i = 0; i < 256; ++i) data.push_back(static_cast<char>(i));
+
+  for (std::size_t size = 0; size <= data.size(); ++size) {
+    const auto part = std::string_view{data}.substr(0, size);
+    const auto encoded = crypto::base64::Base64Encode(part);
+    EXPECT_EQ(encoded.size(), (size + 2) / 3 * 4);
+    EXPECT_EQ(part, crypto::base64::Base64Decode(encoded));
+    EXPECT_EQ(part, crypto::base64::Base64Decode(crypto::base64::Base64Encode(
+                        part, crypto::base64::Pad::kWithout)));
+  }
+
+  // chars out of the alphabet are skipped wherever they are
+  const auto encoded = crypto::base64::Base64Encode(data);
+  for (std::size_t position = 0; position < 64; position += 3) {
+    auto broken = encoded;
+    broken.insert(position, "\r\n ");
+    EXPECT_EQ(data, crypto::base64::Base64Decode(broken));
+  }
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
@@ -24,6 +48,12 @@ TEST(Crypto, Base64Url) {
                        "S\xff", crypto::base64::Pad::kWithout));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+
+  std::string data;
+  for (int i = 0; i < 256; ++i) data.push_back(static_cast<char>(i));
+  const auto encoded = crypto::base64::Base64UrlEncode(data);
+  EXPECT_EQ(std::string::npos, encoded.find_first_of("+/"));
+  EXPECT_EQ(data, crypto::base64::Base64UrlDecode(encoded));
 }
 #endif
 
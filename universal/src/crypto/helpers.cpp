@@ -94,6 +94,28 @@ EvpMdCtx::~EvpMdCtx() {
 EvpMdCtx::EvpMdCtx(EvpMdCtx&& other) noexcept
     : ctx_(std::exchange(other.ctx_, nullptr)) {}
 
+std::shared_ptr<EVP_MD_CTX> MakeSharedEvpMdCtx() {
+  auto owner = std::make_shared<EvpMdCtx>();
+  auto* native = owner->Get();
+  return {std::move(owner), native};
+}
+
+ThreadLocalEvpMdCtx::ThreadLocalEvpMdCtx(const EVP_MD_CTX& prototype) {
+  thread_local EvpMdCtx thread_ctx;
+  ctx_ = thread_ctx.Get();
+  if (1 != EVP_MD_CTX_copy_ex(ctx_, &prototype)) {
+    throw CryptoException(FormatSslError("Failed to copy EVP_MD_CTX"));
+  }
+}
+
+ThreadLocalEvpMdCtx::~ThreadLocalEvpMdCtx() {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+  EVP_MD_CTX_reset(ctx_);
+#else
+  EVP_MD_CTX_cleanup(ctx_);
+#endif
+}
+
 decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits) {
   switch (bits) {
     case DigestSize::k160:
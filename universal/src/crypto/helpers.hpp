@@ -30,6 +30,29 @@ class EvpMdCtx {
   EVP_MD_CTX* ctx_;
 };
 
+/// EVP_MD_CTX that is initialized by EVP_Digest{Sign,Verify}Init once and is
+/// copied for every message, which is much cheaper than the initialization.
+/// Concurrent copying from it is safe.
+std::shared_ptr<EVP_MD_CTX> MakeSharedEvpMdCtx();
+
+/// Per-thread EVP_MD_CTX for a single sign or verify operation, must not be
+/// held across context switches. Is reset on destruction, so that it does not
+/// retain the key.
+class ThreadLocalEvpMdCtx final {
+ public:
+  /// Copies the initialized `prototype` into the per-thread context
+  explicit ThreadLocalEvpMdCtx(const EVP_MD_CTX& prototype);
+  ~ThreadLocalEvpMdCtx();
+
+  ThreadLocalEvpMdCtx(const ThreadLocalEvpMdCtx&) = delete;
+  ThreadLocalEvpMdCtx& operator=(const ThreadLocalEvpMdCtx&) = delete;
+
+  EVP_MD_CTX* Get() noexcept { return ctx_; }
+
+ private:
+  EVP_MD_CTX* ctx_;
+};
+
 constexpr size_t GetDigestLength(DigestSize digest_size) {
   size_t bits = 0;
   switch (digest_size) {
@@ -0,0 +1,45 @@
+#include <userver/crypto/public_key_cache.hpp>
+
+#include <mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace crypto {
+
+PublicKey PublicKeyCache::GetOrLoad(std::string_view key_id,
+                                    std::string_view pem) {
+  std::string id{key_id};
+  {
+    const std::shared_lock lock{mutex_};
+    const auto it = keys_.find(id);
+    if (it != keys_.end() && it->second.pem == pem) return it->second.key;
+  }
+
+  // parsing without the lock, a concurrent parse of the same key is harmless
+  auto key = PublicKey::LoadFromString(pem);
+
+  const std::unique_lock lock{mutex_};
+  keys_.insert_or_assign(std::move(id), Entry{std::string{pem}, key});
+  return key;
+}
+
+std::optional<PublicKey> PublicKeyCache::Get(std::string_view key_id) const {
+  const std::shared_lock lock{mutex_};
+  const auto it = keys_.find(std::string{key_id});
+  if (it == keys_.end()) return std::nullopt;
+  return it->second.key;
+}
+
+void PublicKeyCache::Erase(std::string_view key_id) {
+  const std::unique_lock lock{mutex_};
+  keys_.erase(std::string{key_id});
+}
+
+std::size_t PublicKeyCache::GetSize() const {
+  const std::shared_lock lock{mutex_};
+  return keys_.size();
+}
+
+}  // namespace crypto
+
+USERVER_NAMESPACE_END
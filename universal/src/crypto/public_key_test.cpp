@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <userver/crypto/public_key.hpp>
+#include <userver/crypto/public_key_cache.hpp>
 #include <userver/crypto/signers.hpp>
 #include <userver/crypto/verifiers.hpp>
 
@@ -136,6 +137,46 @@ constexpr crypto::PublicKey::CoordinateView kY{
 
 }  // namespace
 
+constexpr std::string_view kEcdsa256v1PubKey = R"(
+-----BEGIN PUBLIC KEY-----
+MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAEWcvDFh6ghcjNODTCvvXIU7oUjiyF
+lfIQBOEzbTtSL/ep3D4QLQ5mnWCYfw933KIzeVOQRuenSnecuPex6KvSgw==
+-----END PUBLIC KEY-----
+)";
+
+TEST(Crypto, PublicKeyCache) {
+  crypto::SignerEs256 signer(ecdsa256v1_priv_key);
+  const auto sign = signer.Sign({"Hello, World"});
+
+  /// [Sample PublicKeyCache]
+  crypto::PublicKeyCache cache;
+
+  const auto key = cache.GetOrLoad("kid-1", kEcdsa256v1PubKey);
+  EXPECT_NO_THROW(crypto::VerifierEs256{key}.Verify({"Hello, World"}, sign));
+
+  // same PEM, the key is not parsed again
+  EXPECT_EQ(cache.GetOrLoad("kid-1", kEcdsa256v1PubKey).GetNative(),
+            key.GetNative());
+  /// [Sample PublicKeyCache]
+
+  ASSERT_TRUE(cache.Get("kid-1"));
+  EXPECT_EQ(cache.Get("kid-1")->GetNative(), key.GetNative());
+  EXPECT_FALSE(cache.Get("kid-2"));
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  EXPECT_THROW(cache.GetOrLoad("kid-2", "not a key"), crypto::KeyParseError);
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  // rotated key for the same id is parsed again
+  std::string rotated{kEcdsa256v1PubKey};
+  rotated.insert(0, "\n");
+  EXPECT_NE(cache.GetOrLoad("kid-1", rotated).GetNative(), key.GetNative());
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  cache.Erase("kid-1");
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
 TEST(Crypto, EcdsaVerifierFromComponents) {
   crypto::SignerEs256 signer(ecdsa256v1_priv_key);
   const auto sign = signer.Sign({"Hello, World"});
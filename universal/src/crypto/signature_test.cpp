@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/crypto/base64.hpp>
 #include <userver/crypto/hash.hpp>
@@ -202,6 +205,16 @@ void TestDsaSignature(DsaSigner signer, DsaVerifier verifier,
 
   EXPECT_THROW(bad_verifier.Verify({message}, sig), crypto::VerificationError);
 
+  const std::string bad_message = "bad " + std::string{message};
+  const crypto::SignedMessage batch[] = {
+      {message, sig}, {message, {}},  {message, bad_sig},
+      {bad_message, bad_sig}, {message, sig},
+  };
+  EXPECT_EQ(verifier.VerifyBatch(batch),
+            (std::vector<bool>{true, false, false, true, true}));
+  EXPECT_EQ(bad_verifier.VerifyBatch(batch),
+            (std::vector<bool>(std::size(batch), false)));
+
   if (!(flags & TestFlags::kSkipDigestOps)) {
     const auto md_sig = signer.SignDigest(utils::encoding::FromHex(digest));
     EXPECT_THROW(signer.SignDigest(digest), crypto::SignError);
@@ -237,6 +250,10 @@ TEST(Crypto, SignatureNone) {
   EXPECT_NO_THROW(crypto::VerifierNone{}.Verify({"test"}, {}));
   EXPECT_THROW(crypto::VerifierNone{}.Verify({"test"}, "test"),
                crypto::VerificationError);
+
+  const crypto::SignedMessage batch[] = {{"test", {}}, {"test", "test"}};
+  EXPECT_EQ(crypto::VerifierNone{}.VerifyBatch(batch),
+            (std::vector<bool>{true, false}));
 }
 
 TEST(Crypto, SignatureHs1) {
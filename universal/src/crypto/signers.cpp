@@ -170,14 +170,10 @@ DsaSigner<type, bits>::DsaSigner(const std::string& key,
       throw SignError("Non-RSA key supplied for " + Name() + " signer");
     }
   }
-}
 
-template <DsaType type, DigestSize bits>
-std::string DsaSigner<type, bits>::Sign(
-    std::initializer_list<std::string_view> data) const {
-  EvpMdCtx ctx;
+  sign_ctx_ = MakeSharedEvpMdCtx();
   EVP_PKEY_CTX* pkey_ctx = nullptr;  // non-owning
-  if (1 != EVP_DigestSignInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
+  if (1 != EVP_DigestSignInit(sign_ctx_.get(), &pkey_ctx, GetShaMdByEnum(bits),
                               nullptr, pkey_.GetNative())) {
     throw SignError(FormatSslError("Failed to sign: EVP_DigestSignInit"));
   }
@@ -185,6 +181,12 @@ std::string DsaSigner<type, bits>::Sign(
   if constexpr (type == DsaType::kRsaPss) {
     SetupJwaRsaPssPadding(pkey_ctx, bits);
   }
+}
+
+template <DsaType type, DigestSize bits>
+std::string DsaSigner<type, bits>::Sign(
+    std::initializer_list<std::string_view> data) const {
+  ThreadLocalEvpMdCtx ctx{*sign_ctx_};
 
   for (const auto& part : data) {
     if (1 != EVP_DigestSignUpdate(ctx.Get(), part.data(), part.size())) {
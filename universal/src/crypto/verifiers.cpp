@@ -7,6 +7,7 @@
 #include <openssl/cms.h>
 
 #include <openssl/crypto.h>
+#include <openssl/err.h>
 #include <openssl/evp.h>
 #include <openssl/x509.h>
 
@@ -90,11 +91,49 @@ ReadCmsContent(BIO& from, CmsVerifier::InForm in_form) {
   return cms;
 }
 
+// Returns the result of EVP_DigestVerifyFinal
+template <typename Parts>
+int DigestVerify(const EVP_MD_CTX& prototype, const Parts& parts,
+                 std::string_view raw_signature, bool is_ec) {
+  ThreadLocalEvpMdCtx ctx{prototype};
+
+  for (const std::string_view part : parts) {
+    if (1 != EVP_DigestVerifyUpdate(ctx.Get(), part.data(), part.size())) {
+      throw VerificationError(
+          FormatSslError("Failed to verify: EVP_DigestVerifyUpdate"));
+    }
+  }
+
+  if (is_ec) {
+    auto der_signature = ConvertEcSignature(raw_signature);
+    return EVP_DigestVerifyFinal(ctx.Get(), der_signature.data(),
+                                 der_signature.size());
+  }
+  return EVP_DigestVerifyFinal(
+      ctx.Get(), reinterpret_cast<const unsigned char*>(raw_signature.data()),
+      raw_signature.size());
+}
+
 }  // namespace
 
 Verifier::Verifier(const std::string& name) : NamedAlgo(name) {}
 Verifier::~Verifier() = default;
 
+std::vector<bool> Verifier::VerifyBatch(
+    utils::span<const SignedMessage> messages) const {
+  std::vector<bool> result;
+  result.reserve(messages.size());
+  for (const auto& message : messages) {
+    try {
+      Verify({message.data}, message.raw_signature);
+      result.push_back(true);
+    } catch (const VerificationError&) {
+      result.push_back(false);
+    }
+  }
+  return result;
+}
+
 ///
 /// None
 ///
@@ -170,6 +209,19 @@ DsaVerifier<type, bits>::DsaVerifier(PublicKey pubkey)
                               " verifier");
     }
   }
+
+  verify_ctx_ = MakeSharedEvpMdCtx();
+  EVP_PKEY_CTX* pkey_ctx = nullptr;
+  if (1 != EVP_DigestVerifyInit(verify_ctx_.get(), &pkey_ctx,
+                                GetShaMdByEnum(bits), nullptr,
+                                pkey_.GetNative())) {
+    throw VerificationError(
+        FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
+  }
+
+  if constexpr (type == DsaType::kRsaPss) {
+    SetupJwaRsaPssPadding(pkey_ctx, bits);
+  }
 }
 
 template <DsaType type, DigestSize bits>
@@ -180,40 +232,32 @@ template <DsaType type, DigestSize bits>
 void DsaVerifier<type, bits>::Verify(
     std::initializer_list<std::string_view> data,
     std::string_view raw_signature) const {
-  EvpMdCtx ctx;
-  EVP_PKEY_CTX* pkey_ctx = nullptr;
-  if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
-                                nullptr, pkey_.GetNative())) {
+  if (1 != DigestVerify(*verify_ctx_, data, raw_signature,
+                        type == DsaType::kEc)) {
     throw VerificationError(
-        FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
-  }
-
-  if constexpr (type == DsaType::kRsaPss) {
-    SetupJwaRsaPssPadding(pkey_ctx, bits);
+        FormatSslError("Failed to verify: EVP_DigestVerifyFinal"));
   }
+}
 
-  for (const auto& part : data) {
-    if (1 != EVP_DigestVerifyUpdate(ctx.Get(), part.data(), part.size())) {
-      throw VerificationError(
-          FormatSslError("Failed to verify: EVP_DigestVerifyUpdate"));
+template <DsaType type, DigestSize bits>
+std::vector<bool> DsaVerifier<type, bits>::VerifyBatch(
+    utils::span<const SignedMessage> messages) const {
+  std::vector<bool> result;
+  result.reserve(messages.size());
+  for (const auto& message : messages) {
+    bool is_valid = false;
+    try {
+      const std::string_view parts[] = {message.data};
+      is_valid = (1 == DigestVerify(*verify_ctx_, parts, message.raw_signature,
+                                    type == DsaType::kEc));
+    } catch (const VerificationError&) {
+      // malformed EC signature
     }
+    // do not leave the errors of the invalid signatures for the next calls
+    if (!is_valid) ERR_clear_error();
+    result.push_back(is_valid);
   }
-
-  int verification_result = -1;
-  if constexpr (type == DsaType::kEc) {
-    auto der_signature = ConvertEcSignature(raw_signature);
-    verification_result = EVP_DigestVerifyFinal(ctx.Get(), der_signature.data(),
-                                                der_signature.size());
-  } else {
-    verification_result = EVP_DigestVerifyFinal(
-        ctx.Get(), reinterpret_cast<const unsigned char*>(raw_signature.data()),
-        raw_signature.size());
-  }
-
-  if (1 != verification_result) {
-    throw VerificationError(
-        FormatSslError("Failed to verify: EVP_DigestVerifyFinal"));
-  }
+  return result;
 }
 
 template <DsaType type, DigestSize bits>
@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/decimal64/bulk.hpp>
+#include <userver/decimal64/decimal64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Money = decimal64::Decimal<4>;
+using Rate = decimal64::Decimal<8>;
+
+constexpr std::size_t kCount = 4096;
+
+// "12345.6789" for prices, "1234567890.12345678" for rates
+std::vector<std::string> GenerateStrings(bool is_long) {
+  std::vector<std::string> result;
+  result.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    if (is_long) {
+      result.push_back(std::to_string(1000000000 + i * 7919) + '.' +
+                       std::to_string(10000000 + i * 13 % 90000000));
+    } else {
+      result.push_back(std::to_string(i * 7919 % 100000) + '.' +
+                       std::to_string(1000 + i % 9000));
+    }
+  }
+  return result;
+}
+
+std::vector<Money> GenerateDecimals(int64_t seed) {
+  std::vector<Money> result;
+  result.reserve(kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    result.push_back(
+        Money::FromUnbiased(static_cast<int64_t>(i * 7919 % 100000) + seed));
+  }
+  return result;
+}
+
+template <typename Decimal>
+void FromString(benchmark::State& state, bool is_long) {
+  const auto strings = GenerateStrings(is_long);
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& str : strings) {
+      benchmark::DoNotOptimize(Decimal{str});
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+template <typename Decimal>
+void FromStringGeneric(benchmark::State& state, bool is_long) {
+  const auto strings = GenerateStrings(is_long);
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& str : strings) {
+      benchmark::DoNotOptimize(
+          decimal64::impl::Parse<Decimal::kDecimalPoints,
+                                 typename Decimal::RoundPolicy>(
+              decimal64::impl::StringCharSequence(std::string_view{str}),
+              decimal64::impl::ParseOptions::kNone));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+}  // namespace
+
+void decimal64_from_string(benchmark::State& state) {
+  FromString<Money>(state, false);
+}
+BENCHMARK(decimal64_from_string);
+
+void decimal64_from_string_generic(benchmark::State& state) {
+  FromStringGeneric<Money>(state, false);
+}
+BENCHMARK(decimal64_from_string_generic);
+
+void decimal64_from_string_long(benchmark::State& state) {
+  FromString<Rate>(state, true);
+}
+BENCHMARK(decimal64_from_string_long);
+
+void decimal64_from_string_long_generic(benchmark::State& state) {
+  FromStringGeneric<Rate>(state, true);
+}
+BENCHMARK(decimal64_from_string_long_generic);
+
+void decimal64_add_loop(benchmark::State& state) {
+  const auto lhs = GenerateDecimals(1);
+  const auto rhs = GenerateDecimals(2);
+  std::vector<Money> out(kCount);
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < kCount; ++i) out[i] = lhs[i] + rhs[i];
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(decimal64_add_loop);
+
+void decimal64_add_bulk(benchmark::State& state) {
+  const auto lhs = GenerateDecimals(1);
+  const auto rhs = GenerateDecimals(2);
+  std::vector<Money> out(kCount);
+  for ([[maybe_unused]] auto _ : state) {
+    decimal64::bulk::Add<Money>(lhs, rhs, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(decimal64_add_bulk);
+
+void decimal64_multiply_bulk(benchmark::State& state) {
+  const auto lhs = GenerateDecimals(1);
+  const auto rhs = GenerateDecimals(2);
+  std::vector<Money> out(kCount);
+  for ([[maybe_unused]] auto _ : state) {
+    decimal64::bulk::Multiply<Money>(lhs, rhs, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(decimal64_multiply_bulk);
+
+void decimal64_round_bulk(benchmark::State& state) {
+  const auto values = GenerateDecimals(1);
+  std::vector<Money> out(kCount);
+  for ([[maybe_unused]] auto _ : state) {
+    decimal64::bulk::RoundToMultipleOf<Money>(values, Money{"0.01"}, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(decimal64_round_bulk);
+
+void decimal64_sum_bulk(benchmark::State& state) {
+  const auto values = GenerateDecimals(1);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::bulk::Sum<Money>(values));
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+BENCHMARK(decimal64_sum_bulk);
+
+USERVER_NAMESPACE_END
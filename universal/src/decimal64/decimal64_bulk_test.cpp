@@ -0,0 +1,98 @@
+#include <userver/decimal64/bulk.hpp>
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Dec4 = decimal64::Decimal<4>;
+using Money = decimal64::Decimal<2, decimal64::HalfEvenRoundPolicy>;
+
+std::vector<Dec4> MakeValues(std::size_t count, int64_t seed) {
+  std::vector<Dec4> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto value = static_cast<int64_t>(i) * 7919 + seed;
+    result.push_back(Dec4::FromUnbiased(i % 2 ? value : -value));
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(Decimal64Bulk, AddSubtract) {
+  const auto lhs = MakeValues(100, 12345);
+  const auto rhs = MakeValues(100, 67890);
+  std::vector<Dec4> out(lhs.size());
+
+  decimal64::bulk::Add<Dec4>(lhs, rhs, out);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(out[i], lhs[i] + rhs[i]);
+  }
+
+  decimal64::bulk::Subtract<Dec4>(lhs, rhs, out);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(out[i], lhs[i] - rhs[i]);
+  }
+
+  // in place
+  auto values = lhs;
+  decimal64::bulk::Add<Dec4>(values, rhs, values);
+  EXPECT_EQ(values[42], lhs[42] + rhs[42]);
+}
+
+TEST(Decimal64Bulk, Multiply) {
+  const std::vector<Money> prices{Money{"10.25"}, Money{"-0.05"},
+                                  Money{"123456.78"}, Money{"0.15"}};
+  const std::vector<Money> rates{Money{"0.10"}, Money{"0.50"}, Money{"1.5"},
+                                 Money{"0.5"}};
+  std::vector<Money> out(prices.size());
+
+  decimal64::bulk::Multiply<Money>(prices, rates, out);
+  EXPECT_EQ(out, (std::vector<Money>{Money{"1.02"}, Money{"-0.02"},
+                                     Money{"185185.17"}, Money{"0.08"}}));
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(out[i], prices[i] * rates[i]);
+  }
+
+  decimal64::bulk::Multiply<Money>(prices, 3, out);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(out[i], prices[i] * 3);
+  }
+}
+
+TEST(Decimal64Bulk, RoundAndSum) {
+  const std::vector<Dec4> values{Dec4{"1.2345"}, Dec4{"-1.2355"},
+                                 Dec4{"0.0049"}};
+  std::vector<Dec4> out(values.size());
+
+  decimal64::bulk::RoundToMultipleOf<Dec4>(values, Dec4{"0.01"}, out);
+  EXPECT_EQ(out,
+            (std::vector<Dec4>{Dec4{"1.23"}, Dec4{"-1.24"}, Dec4{"0"}}));
+
+  EXPECT_EQ(decimal64::bulk::Sum<Dec4>(values), Dec4{"0.0039"});
+  EXPECT_EQ(decimal64::bulk::Sum<Dec4>({}), Dec4{0});
+}
+
+TEST(Decimal64Bulk, Errors) {
+  const auto max = Dec4::FromUnbiased(std::numeric_limits<int64_t>::max());
+  const std::vector<Dec4> lhs{Dec4{1}, max, Dec4{2}};
+  const std::vector<Dec4> rhs{Dec4{1}, Dec4{1}, Dec4{2}};
+  std::vector<Dec4> out(lhs.size());
+
+  EXPECT_THROW(decimal64::bulk::Add<Dec4>(lhs, rhs, out),
+               decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::bulk::Multiply<Dec4>(lhs, rhs, out),
+               decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::bulk::Multiply<Dec4>(lhs, 2, out),
+               decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::bulk::Sum<Dec4>(lhs), decimal64::OutOfBoundsError);
+  EXPECT_THROW(decimal64::bulk::RoundToMultipleOf<Dec4>(lhs, Dec4{-1}, out),
+               decimal64::OutOfBoundsError);
+}
+
+USERVER_NAMESPACE_END
@@ -80,6 +80,48 @@ TEST(Decimal64, ConstructFromString) {
 }
 
 // NOLINTNEXTLINE(readability-function-size)
+TEST(Decimal64, CanonicalFastPath) {
+  using Policy = decimal64::DefRoundPolicy;
+  const auto parse = &decimal64::impl::TryParseCanonical<4, Policy>;
+
+  EXPECT_EQ(parse("12345678.1234"), Dec4{"12345678.1234"});
+  EXPECT_EQ(parse("-0.5"), Dec4{"-0.5"});
+  EXPECT_EQ(parse("+7"), Dec4{7});
+  EXPECT_EQ((decimal64::impl::TryParseCanonical<18, Policy>(
+                "0.123456789012345678")),
+            decimal64::Decimal<18>{"0.123456789012345678"});
+  EXPECT_EQ((decimal64::impl::TryParseCanonical<0, Policy>(
+                "123456789012345678")),
+            decimal64::Decimal<0>{123456789012345678});
+
+  // anything unusual goes to the generic parser
+  EXPECT_FALSE(parse(""));
+  EXPECT_FALSE(parse("-"));
+  EXPECT_FALSE(parse("1."));
+  EXPECT_FALSE(parse(".1"));
+  EXPECT_FALSE(parse(" 1"));
+  EXPECT_FALSE(parse("1.23456"));
+  EXPECT_FALSE(parse("1234567/"));
+  EXPECT_FALSE(parse("12345678:"));
+  EXPECT_FALSE(parse("1.2.3"));
+  EXPECT_FALSE(parse("999999999999999"));
+  EXPECT_FALSE(parse("0000000000000000000001"));
+
+  // the fast path agrees with the generic parser
+  for (const std::string_view input :
+       {"0", "-0", "1", "-1.5", "99999999.9999", "00000000001.0001",
+        "922337203685477.5807", "922337203685476.9999"}) {
+    const auto generic = decimal64::impl::Parse<4, Policy>(
+        decimal64::impl::StringCharSequence(input),
+        decimal64::impl::ParseOptions::kNone);
+    if (generic.error) {
+      EXPECT_FALSE(parse(input)) << input;
+    } else {
+      EXPECT_EQ(parse(input), generic.decimal) << input;
+    }
+  }
+}
+
 TEST(Decimal64, FromStringPermissive) {
   EXPECT_EQ(Dec4::FromStringPermissive("1234.5678"), Dec4{"1234.5678"});
   EXPECT_EQ(Dec4::FromStringPermissive(".0"), Dec4{0});
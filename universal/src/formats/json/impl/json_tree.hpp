@@ -74,6 +74,8 @@ using TreeStack =
 std::string MakePath(const Value* root, const Value* node, int node_depth);
 /// Transform nodes onto stack into string
 std::string ExtractPath(const TreeStack& stack);
+/// Throw ParseException if any object of `root` has duplicate keys
+void CheckKeyUniqueness(const Value* root);
 }  // namespace formats::json::impl
 
 USERVER_NAMESPACE_END
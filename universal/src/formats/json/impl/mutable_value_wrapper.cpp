@@ -10,6 +10,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <formats/json/impl/exttypes.hpp>
+#include <formats/json/impl/pool_allocator.hpp>
 #include <userver/formats/common/path.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -24,6 +25,13 @@ struct MutableValueWrapper::JsonPath {
   JsonPath(T&& element_, std::shared_ptr<JsonPath> parent_)
       : element(std::forward<T>(element_)), parent(std::move(parent_)) {}
 
+  template <typename T>
+  static std::shared_ptr<JsonPath> Make(
+      T&& element, const std::shared_ptr<JsonPath>& parent) {
+    return std::allocate_shared<JsonPath>(PoolAllocator<JsonPath>{},
+                                          std::forward<T>(element), parent);
+  }
+
   static Value& FetchMember(Value& root, const std::shared_ptr<JsonPath>& path);
   static std::string ToString(const std::shared_ptr<JsonPath>&);
 };
@@ -71,13 +79,13 @@ MutableValueWrapper::~MutableValueWrapper() = default;
 MutableValueWrapper MutableValueWrapper::WrapMember(std::string&& element,
                                                     const Value& member) const {
   EnsureCurrent();
-  return {std::make_shared<JsonPath>(std::move(element), impl_->path),
-          impl_->value.root_, member, impl_->value.depth_ + 1};
+  return {JsonPath::Make(std::move(element), impl_->path), impl_->value.root_,
+          member, impl_->value.depth_ + 1};
 }
 
 MutableValueWrapper MutableValueWrapper::WrapElement(size_t index) const {
   EnsureCurrent();
-  return {std::make_shared<JsonPath>(index, impl_->path), impl_->value.root_,
+  return {JsonPath::Make(index, impl_->path), impl_->value.root_,
           (*impl_->value.value_ptr_)[static_cast<::rapidjson::SizeType>(index)],
           impl_->value.depth_ + 1};
 }
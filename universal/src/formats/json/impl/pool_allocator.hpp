@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+// Thread-local cache of the freed memory blocks of the same size.
+//
+// A ValueBuilder makes a lot of short-lived VersionedValuePtr::Data and
+// paths, every one of them is a separate allocation of a shared_ptr control
+// block. Reusing the blocks saves a trip into the memory allocator.
+//
+// NOTE: a block may be freed by a different thread than the one it was taken
+// from, it simply moves into the cache of that thread.
+template <std::size_t Size>
+class BlockPool final {
+ public:
+  static void* Allocate() {
+    auto& pool = pool_;
+    if (pool.size == 0) return ::operator new(Size);
+    return pool.blocks[--pool.size];
+  }
+
+  static void Deallocate(void* block) noexcept {
+    auto& pool = pool_;
+    if (pool.size == kMaxSize) {
+      ::operator delete(block);
+      return;
+    }
+    pool.blocks[pool.size++] = block;
+  }
+
+ private:
+  // Enough for building the usual response without touching the allocator
+  // while keeping the cache of an idle thread small
+  static constexpr std::size_t kMaxSize = 256;
+
+  struct Storage final {
+    ~Storage() {
+      while (size) ::operator delete(blocks[--size]);
+    }
+
+    void* blocks[kMaxSize];
+    std::size_t size{0};
+  };
+
+  /*constinit*/ inline static thread_local Storage pool_{};
+};
+
+// Stateless allocator for std::allocate_shared, takes the blocks of a single
+// object from BlockPool
+template <typename T>
+class PoolAllocator final {
+ public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    if (n != 1) return static_cast<T*>(::operator new(n * sizeof(T)));
+    return static_cast<T*>(BlockPool<sizeof(T)>::Allocate());
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept {
+    if (n != 1) {
+      ::operator delete(p);
+      return;
+    }
+    BlockPool<sizeof(T)>::Deallocate(p);
+  }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -26,6 +26,10 @@ VersionedValuePtr::operator bool() const { return !!data_; }
 
 bool VersionedValuePtr::IsUnique() const { return data_.use_count() == 1; }
 
+bool VersionedValuePtr::IsInsitu() const {
+  return data_ && !data_->insitu_buffer.empty();
+}
+
 const Value* VersionedValuePtr::Get() const {
   return data_ ? &data_->native : nullptr;
 }
@@ -1,15 +1,21 @@
 #pragma once
 
 #include <atomic>
+#include <string>
+#include <utility>
 
 #include <rapidjson/document.h>
 
 #include <userver/formats/json/impl/types.hpp>
 
+#include <formats/json/impl/pool_allocator.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace formats::json::impl {
 
+struct InsituTag final {};
+
 struct VersionedValuePtr::Data {
   template <typename... Args>
   explicit Data(Args&&... args) : native(std::forward<Args>(args)...) {}
@@ -18,8 +24,18 @@ struct VersionedValuePtr::Data {
   // https://github.com/Tencent/rapidjson/issues/387
   explicit Data(Document&&);
 
+  // The document is parsed by `parser` right in `buffer`, which is kept alive
+  // as the parsed strings point into it
+  template <typename Parser>
+  Data(InsituTag, std::string&& buffer, Parser parser)
+      : insitu_buffer(std::move(buffer)),
+        native(parser(insitu_buffer.data())) {}
+
   ~Data();
 
+  // buffer of the in-situ parsed document, empty otherwise
+  std::string insitu_buffer;
+
   // native rapidjson value
   Value native;
 
@@ -30,7 +46,8 @@ struct VersionedValuePtr::Data {
 
 template <typename... Args>
 VersionedValuePtr VersionedValuePtr::Create(Args&&... args) {
-  return VersionedValuePtr{std::make_shared<Data>(std::forward<Args>(args)...)};
+  return VersionedValuePtr{std::allocate_shared<Data>(
+      PoolAllocator<Data>{}, std::forward<Args>(args)...)};
 }
 
 }  // namespace formats::json::impl
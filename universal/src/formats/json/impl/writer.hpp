@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+// rapidjson::Writer with faster string escaping and double formatting.
+//
+// Strings are scanned 8 bytes at a time and the runs of bytes that need no
+// escaping are copied as a whole. The output is the same as of
+// rapidjson::Writer with the default flags.
+//
+// Doubles are formatted with the shortest round-trip representation of fmt,
+// integral values keep the trailing ".0".
+class Writer final : public rapidjson::Writer<rapidjson::StringBuffer> {
+ public:
+  using Base = rapidjson::Writer<rapidjson::StringBuffer>;
+
+  using Base::Base;
+
+  bool String(const Ch* str, rapidjson::SizeType length, bool = false) {
+    Prefix(rapidjson::kStringType);
+    WriteEscaped({str, length});
+    return EndValue(true);
+  }
+
+  bool Key(const Ch* str, rapidjson::SizeType length, bool copy = false) {
+    return String(str, length, copy);
+  }
+
+  bool Double(double value) {
+    Prefix(rapidjson::kNumberType);
+    WriteDouble(value);
+    return EndValue(true);
+  }
+
+ private:
+  static constexpr std::uint64_t kOnes = 0x0101010101010101;
+  static constexpr std::uint64_t kHighBits = 0x8080808080808080;
+
+  // Whether any byte of `chunk` is a control character, a quote or a backslash
+  static bool NeedsEscaping(std::uint64_t chunk) noexcept {
+    const auto is_zero = [](std::uint64_t x) {
+      return (x - kOnes) & ~x & kHighBits;
+    };
+    const auto is_control = (chunk - kOnes * 0x20) & ~chunk & kHighBits;
+    return is_control | is_zero(chunk ^ (kOnes * '"')) |
+           is_zero(chunk ^ (kOnes * '\\'));
+  }
+
+  void WriteEscaped(std::string_view str) {
+    static constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+    // the worst case is "\u00XX" for every byte
+    auto* out = os_->Push(2 + str.size() * 6);
+    auto* const begin = out;
+    *out++ = '"';
+
+    const char* p = str.data();
+    const char* const end = p + str.size();
+    while (p != end) {
+      while (end - p >= 8) {
+        std::uint64_t chunk = 0;
+        std::memcpy(&chunk, p, sizeof(chunk));
+        if (NeedsEscaping(chunk)) break;
+        std::memcpy(out, p, sizeof(chunk));
+        out += sizeof(chunk);
+        p += sizeof(chunk);
+      }
+      if (p == end) break;
+
+      const auto c = static_cast<unsigned char>(*p++);
+      if (c >= 0x20 && c != '"' && c != '\\') {
+        *out++ = static_cast<char>(c);
+        continue;
+      }
+
+      *out++ = '\\';
+      switch (c) {
+        case '"':
+        case '\\':
+          *out++ = static_cast<char>(c);
+          break;
+        case '\b':
+          *out++ = 'b';
+          break;
+        case '\f':
+          *out++ = 'f';
+          break;
+        case '\n':
+          *out++ = 'n';
+          break;
+        case '\r':
+          *out++ = 'r';
+          break;
+        case '\t':
+          *out++ = 't';
+          break;
+        default:
+          *out++ = 'u';
+          *out++ = '0';
+          *out++ = '0';
+          *out++ = kHexDigits[c >> 4];
+          *out++ = kHexDigits[c & 0xf];
+      }
+    }
+
+    *out++ = '"';
+    os_->Pop(2 + str.size() * 6 - static_cast<std::size_t>(out - begin));
+  }
+
+  void WriteDouble(double value) {
+    // enough for the shortest representation of any double
+    constexpr std::size_t kMaxSize = 32;
+    char buffer[kMaxSize];
+    auto* it = fmt::format_to(buffer, FMT_COMPILE("{}"), value);
+    std::string_view result{buffer, static_cast<std::size_t>(it - buffer)};
+
+    auto* out = os_->Push(result.size() + 2);
+    auto* const begin = out;
+    const auto exponent_pos = result.find('e');
+    if (exponent_pos == std::string_view::npos) {
+      std::memcpy(out, result.data(), result.size());
+      out += result.size();
+      if (result.find('.') == std::string_view::npos) {
+        *out++ = '.';
+        *out++ = '0';
+      }
+    } else {
+      // "1e+20" -> "1e20", "1e-07" -> "1e-7", as rapidjson does
+      std::memcpy(out, result.data(), exponent_pos + 1);
+      out += exponent_pos + 1;
+      auto exponent = result.substr(exponent_pos + 1);
+      if (exponent.front() == '-') *out++ = '-';
+      if (exponent.front() == '-' || exponent.front() == '+') {
+        exponent.remove_prefix(1);
+      }
+      while (exponent.size() > 1 && exponent.front() == '0') {
+        exponent.remove_prefix(1);
+      }
+      std::memcpy(out, exponent.data(), exponent.size());
+      out += exponent.size();
+    }
+    os_->Pop(result.size() + 2 - static_cast<std::size_t>(out - begin));
+  }
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -8,7 +8,7 @@
 
 #include <userver/formats/json/exception.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 #include <formats/common/validations.hpp>
 #include <formats/json/impl/types_impl.hpp>
@@ -31,8 +31,7 @@ impl::Value WrapStringView(std::string_view key) {
 }
 
 std::string FormatTimePoint(std::chrono::system_clock::time_point value) {
-  return utils::datetime::Timestring(value, "UTC",
-                                     utils::datetime::kRfc3339Format);
+  return utils::datetime::ToRfc3339String(value);
 }
 
 }  // namespace
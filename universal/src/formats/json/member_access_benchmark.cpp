@@ -1,6 +1,7 @@
 #include <unordered_map>
 
 #include <benchmark/benchmark.h>
+#include <fmt/format.h>
 
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
@@ -50,8 +51,55 @@ constexpr char bench_json_data[] = R"({
   }
 })";
 
+// A request body of the kind a handler reads a few fields from
+std::string BuildRequestBody(std::size_t items) {
+  std::string body = R"({"request_id": "4f0c9a6e3b1d4e2f8a7c5b3d1e9f0a2b", )"
+                     R"("user": {"id": 42, "locale": "en"}, "items": [)";
+  for (std::size_t i = 0; i < items; ++i) {
+    if (i != 0) body += ", ";
+    body += fmt::format(
+        R"({{"id": "item-{0}", "title": "Item number {0} of the order", )"
+        R"("description": "A rather long description of the item {0}, )"
+        R"(as they usually are", "price": {0}.99, "tags": ["a", "b"]}})",
+        i);
+  }
+  body += "]}";
+  return body;
+}
+
+bool ReadRequestFields(const formats::json::Value& json) {
+  return !json["request_id"].As<std::string>().empty() &&
+         json["user"]["id"].As<int>() == 42 && json["items"].GetSize() != 0;
+}
+
 }  // anonymous namespace
 
+void json_parse_and_read_few_fields(benchmark::State& state) {
+  const auto body = BuildRequestBody(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = ReadRequestFields(formats::json::FromString(body));
+    benchmark::DoNotOptimize(res);
+    if (!res) throw std::runtime_error("unexpected");
+  }
+}
+BENCHMARK(json_parse_and_read_few_fields)->RangeMultiplier(8)->Range(1, 1024);
+
+void json_parse_in_place_and_read_few_fields(benchmark::State& state) {
+  const auto body = BuildRequestBody(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto copy = body;
+    const auto res =
+        ReadRequestFields(formats::json::FromStringInPlace(std::move(copy)));
+    benchmark::DoNotOptimize(res);
+    if (!res) throw std::runtime_error("unexpected");
+  }
+}
+BENCHMARK(json_parse_in_place_and_read_few_fields)
+    ->RangeMultiplier(8)
+    ->Range(1, 1024);
+
 void json_path_short(benchmark::State& state) {
   auto json = formats::json::FromString(bench_json_data);
 
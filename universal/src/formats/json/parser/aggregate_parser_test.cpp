@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/formats/json/aggregates.hpp>
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fjp = formats::json::parser;
+
+namespace {
+
+/// [Sample AggregateParser usage]
+struct Item {
+  std::string id;
+  int count{0};
+  std::optional<double> price;
+  std::vector<std::string> tags;
+};
+
+struct Order {
+  std::int64_t order_id{0};
+  std::vector<Item> items;
+  std::optional<Item> gift;
+  std::unordered_map<std::string, int> counters;
+};
+
+}  // namespace
+
+template <>
+inline constexpr auto formats::json::kAggregateFields<Item> =
+    utils::TrivialBiMap([](auto selector) {
+      return selector()
+          .Case("id", 0)
+          .Case("count", 1)
+          .Case("price", 2)
+          .Case("tags", 3);
+    });
+
+template <>
+inline constexpr auto formats::json::kAggregateFields<Order> =
+    utils::TrivialBiMap([](auto selector) {
+      return selector()
+          .Case("order_id", 0)
+          .Case("items", 1)
+          .Case("gift", 2)
+          .Case("counters", 3);
+    });
+
+TEST(JsonAggregateParser, Parse) {
+  const auto order = fjp::ParseToType<Order, fjp::AggregateParser<Order>>(R"({
+    "order_id": 42,
+    "items": [
+      {"id": "a", "count": 1, "price": 9.5, "tags": ["x", "y"]},
+      {"id": "b", "count": 2, "price": null, "tags": [], "extra": {"k": [1]}}
+    ],
+    "unknown": [{"id": "c"}, null],
+    "counters": {"views": 3}
+  })");
+  /// [Sample AggregateParser usage]
+
+  EXPECT_EQ(order.order_id, 42);
+  ASSERT_EQ(order.items.size(), 2);
+  EXPECT_EQ(order.items[0].id, "a");
+  EXPECT_EQ(order.items[0].count, 1);
+  EXPECT_EQ(order.items[0].price, 9.5);
+  EXPECT_EQ(order.items[0].tags, (std::vector<std::string>{"x", "y"}));
+  EXPECT_EQ(order.items[1].id, "b");
+  EXPECT_EQ(order.items[1].count, 2);
+  EXPECT_EQ(order.items[1].price, std::nullopt);
+  EXPECT_TRUE(order.items[1].tags.empty());
+  EXPECT_FALSE(order.gift);
+  EXPECT_EQ(order.counters,
+            (std::unordered_map<std::string, int>{{"views", 3}}));
+}
+
+TEST(JsonAggregateParser, ParseToType) {
+  /// [Sample ParseToType usage]
+  const std::string_view request_body =
+      R"([{"order_id": 1, "items": [], "counters": {}}, {"order_id": 2,)"
+      R"( "items": [], "counters": {}, "gift": {"id": "a", "count": 1,)"
+      R"( "tags": []}}])";
+
+  const auto orders = fjp::ParseToType<std::vector<Order>>(request_body);
+  /// [Sample ParseToType usage]
+
+  ASSERT_EQ(orders.size(), 2);
+  EXPECT_EQ(orders[0].order_id, 1);
+  EXPECT_FALSE(orders[0].gift);
+  ASSERT_TRUE(orders[1].gift);
+  EXPECT_EQ(orders[1].gift->id, "a");
+
+  EXPECT_EQ((fjp::ParseToType<std::optional<int>>("null")), std::nullopt);
+  using Map = std::map<std::string, std::vector<int>>;
+  EXPECT_EQ(fjp::ParseToType<Map>(R"({"a": [1, 2], "b": []})"),
+            (Map{{"a", {1, 2}}, {"b", {}}}));
+}
+
+TEST(JsonAggregateParser, Errors) {
+  using Parser = fjp::AggregateParser<Item>;
+
+  EXPECT_THROW((fjp::ParseToType<Item, Parser>(R"({"id": "a"})")),
+               fjp::ParseError);
+  EXPECT_THROW(
+      (fjp::ParseToType<Item, Parser>(R"({"id": "a", "count": "1"})")),
+      fjp::ParseError);
+  EXPECT_THROW((fjp::ParseToType<Item, Parser>("[]")), fjp::ParseError);
+
+  try {
+    fjp::ParseToType<Order, fjp::AggregateParser<Order>>(
+        R"({"order_id": 1, "items": [{"id": "a", "count": 1, "tags": []}, )"
+        R"({"id": "b", "tags": []}]})");
+    FAIL() << "The missing field is not detected";
+  } catch (const fjp::ParseError& e) {
+    EXPECT_NE(std::string_view{e.what()}.find("field 'count' is missing"),
+              std::string_view::npos)
+        << e.what();
+    EXPECT_NE(std::string_view{e.what()}.find("path 'items.[1]'"),
+              std::string_view::npos)
+        << e.what();
+  }
+}
+
+TEST(JsonAggregateParser, WriteToStream) {
+  Order order;
+  order.order_id = 7;
+  order.items.push_back({"a", 1, 2.5, {"x"}});
+  order.items.push_back({"b", 2, std::nullopt, {}});
+  order.gift = Item{"c", 3, std::nullopt, {}};
+
+  formats::json::StringBuilder sb;
+  WriteToStream(order, sb);
+
+  EXPECT_EQ(formats::json::FromString(sb.GetString()),
+            formats::json::FromString(R"({
+              "order_id": 7,
+              "items": [
+                {"id": "a", "count": 1, "price": 2.5, "tags": ["x"]},
+                {"id": "b", "count": 2, "tags": []}
+              ],
+              "gift": {"id": "c", "count": 3, "tags": []},
+              "counters": {}
+            })"));
+
+  const auto parsed = fjp::ParseToType<Order, fjp::AggregateParser<Order>>(
+      sb.GetStringView());
+  ASSERT_EQ(parsed.items.size(), 2);
+  EXPECT_EQ(parsed.items[0].price, 2.5);
+  ASSERT_TRUE(parsed.gift);
+  EXPECT_EQ(parsed.gift->id, "c");
+}
+
+USERVER_NAMESPACE_END
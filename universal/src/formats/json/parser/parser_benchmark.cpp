@@ -2,7 +2,9 @@
 
 #include <fmt/format.h>
 
+#include <userver/formats/json/aggregates.hpp>
 #include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/parser/aggregate_parser.hpp>
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
@@ -90,6 +92,17 @@ void JsonParseValueDom(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueDom)->RangeMultiplier(2)->Range(1, 16);
 
+void JsonParseValueDomInPlace(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    // The copy is accounted, as it is made by FromString anyway
+    auto copy = input;
+    const auto res = formats::json::FromStringInPlace(std::move(copy));
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseValueDomInPlace)->RangeMultiplier(2)->Range(1, 16);
+
 void JsonParseValueSax(benchmark::State& state) {
   const auto input = BuildObject(state.range(0));
   for ([[maybe_unused]] auto _ : state) {
@@ -216,6 +229,86 @@ BENCHMARK(JsonParseValueDomLotsOfMissingKeys)
     ->RangeMultiplier(2)
     ->Range(1 << 7, 1 << 14);
 
+struct OrderItem final {
+  std::string id;
+  int count{0};
+  std::optional<double> price;
+  std::vector<std::string> tags;
+};
+
+struct Order final {
+  std::string order_id;
+  std::vector<OrderItem> items;
+};
+
+OrderItem Parse(const formats::json::Value& value,
+                formats::parse::To<OrderItem>) {
+  return {
+      value["id"].As<std::string>(),
+      value["count"].As<int>(),
+      value["price"].As<std::optional<double>>(),
+      value["tags"].As<std::vector<std::string>>(),
+  };
+}
+
+Order Parse(const formats::json::Value& value, formats::parse::To<Order>) {
+  return {value["order_id"].As<std::string>(),
+          value["items"].As<std::vector<OrderItem>>()};
+}
+
+std::string BuildOrder(std::size_t items) {
+  std::string result = R"({"order_id": "3f2a9c", "items": [)";
+  for (std::size_t i = 0; i < items; ++i) {
+    if (i != 0) result += ", ";
+    result += fmt::format(
+        R"({{"id": "item-{0}", "count": {0}, "price": {0}.5, )"
+        R"("tags": ["new", "sale"], "comment": "not in the struct"}})",
+        i);
+  }
+  result += "]}";
+  return result;
+}
+
 }  // namespace
 
+template <>
+inline constexpr auto formats::json::kAggregateFields<OrderItem> =
+    utils::TrivialBiMap([](auto selector) {
+      return selector()
+          .Case("id", 0)
+          .Case("count", 1)
+          .Case("price", 2)
+          .Case("tags", 3);
+    });
+
+template <>
+inline constexpr auto formats::json::kAggregateFields<Order> =
+    utils::TrivialBiMap([](auto selector) {
+      return selector().Case("order_id", 0).Case("items", 1);
+    });
+
+void JsonParseAggregateDom(benchmark::State& state) {
+  const auto input = BuildOrder(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = formats::json::FromString(input).As<Order>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseAggregateDom)
+    ->RangeMultiplier(8)
+    ->Range(1, 4096)
+    ->Arg(10'000);  // ~1MB
+
+void JsonParseAggregateSax(benchmark::State& state) {
+  const auto input = BuildOrder(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = formats::json::parser::ParseToType<Order>(input);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseAggregateSax)
+    ->RangeMultiplier(8)
+    ->Range(1, 4096)
+    ->Arg(10'000);  // ~1MB
+
 USERVER_NAMESPACE_END
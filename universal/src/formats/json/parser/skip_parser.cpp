@@ -0,0 +1,42 @@
+#include <userver/formats/json/parser/skip_parser.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+void SkipParser::Null() { OnScalar(); }
+
+void SkipParser::Bool(bool) { OnScalar(); }
+
+void SkipParser::Int64(int64_t) { OnScalar(); }
+
+void SkipParser::Uint64(uint64_t) { OnScalar(); }
+
+void SkipParser::Double(double) { OnScalar(); }
+
+void SkipParser::String(std::string_view) { OnScalar(); }
+
+void SkipParser::StartObject() { ++depth_; }
+
+void SkipParser::Key(std::string_view) {}
+
+void SkipParser::EndObject() { OnEnd(); }
+
+void SkipParser::StartArray() { ++depth_; }
+
+void SkipParser::EndArray() { OnEnd(); }
+
+std::string SkipParser::Expected() const { return "any value"; }
+
+void SkipParser::OnScalar() {
+  if (depth_ == 0) SetResult(nullptr);
+}
+
+void SkipParser::OnEnd() {
+  UASSERT(depth_ != 0);
+  if (--depth_ == 0) SetResult(nullptr);
+}
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
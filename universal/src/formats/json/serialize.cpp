@@ -31,57 +31,8 @@ namespace {
 
 ::rapidjson::CrtAllocator g_allocator;
 
-std::string_view AsStringView(const impl::Value& jval) {
-  return {jval.GetString(), jval.GetStringLength()};
-}
-
-void CheckKeyUniqueness(const impl::Value* root) {
-  using KeysStack = boost::container::small_vector<std::string_view,
-                                                   impl::kInitialStackDepth>;
-
-  impl::TreeStack stack;
-  const impl::Value* value = root;
-
-  stack.emplace_back();  // fake "top" frame to avoid extra checks for an empty
-                         // stack inside walker loop
-  KeysStack keys;
-  for (;;) {
-    stack.back().Advance();
-    if (value->IsObject()) {
-      const std::size_t count = value->MemberCount();
-      const auto begin = value->MemberBegin();
-      if (count > keys.size()) {
-        keys.resize(count);
-      }
-      for (std::size_t i = 0; i < count; ++i) {
-        keys[i] = AsStringView(begin[i].name);
-      }
-      std::sort(keys.begin(), keys.begin() + count);
-      const auto* cons_eq_element =
-          std::adjacent_find(keys.data(), keys.data() + count);
-      if (cons_eq_element != keys.data() + count) {
-        throw ParseException("Duplicate key: " + std::string(*cons_eq_element) +
-                             " at " + impl::ExtractPath(stack));
-      }
-    }
-
-    if ((value->IsObject() && value->MemberCount() > 0) ||
-        (value->IsArray() && value->Size() > 0)) {
-      // descend
-      stack.emplace_back(value);
-    } else {
-      while (!stack.back().HasMoreElements()) {
-        stack.pop_back();
-        if (stack.empty()) return;
-      }
-    }
-
-    value = stack.back().CurrentValue();
-  }
-}
-
 impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
-  CheckKeyUniqueness(&json);
+  impl::CheckKeyUniqueness(&json);
 
   return impl::VersionedValuePtr::Create(std::move(json));
 }
@@ -114,6 +65,30 @@ Value FromString(std::string_view doc) {
   return Value{EnsureValid(std::move(json))};
 }
 
+Value FromStringInPlace(std::string&& doc) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
+  }
+
+  return Value{impl::VersionedValuePtr::Create(
+      impl::InsituTag{}, std::move(doc), [](char* buffer) {
+        impl::Document json{&g_allocator};
+        rapidjson::ParseResult ok =
+            json.ParseInsitu<rapidjson::kParseDefaultFlags |
+                             rapidjson::kParseIterativeFlag |
+                             rapidjson::kParseFullPrecisionFlag>(buffer);
+        if (!ok) {
+          // The buffer is already modified, so the line and column are unknown
+          throw ParseException(fmt::format(
+              "JSON parse error at offset {}: {}", ok.Offset(),
+              rapidjson::GetParseError_En(ok.Code())));
+        }
+
+        impl::CheckKeyUniqueness(&json);
+        return impl::Value{static_cast<impl::Value&&>(json)};
+      })};
+}
+
 Value FromStream(std::istream& is) {
   if (!is) {
     throw BadStreamException(is);
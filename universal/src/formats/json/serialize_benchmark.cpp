@@ -6,6 +6,7 @@
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -1169,6 +1170,34 @@ void DeepWidthJson(benchmark::State& state) {
   }
 }
 
+// response of `size` objects each of which has 6 fields, built node by node
+formats::json::Value BuildResponse(std::size_t size) {
+  formats::json::ValueBuilder builder;
+  auto items = builder["items"];
+  for (std::size_t i = 0; i < size; ++i) {
+    formats::json::ValueBuilder item;
+    item["id"] = i;
+    item["name"] = "some item name";
+    item["price"] = 12.5;
+    item["available"] = true;
+    auto tags = item["tags"];
+    tags.PushBack("first");
+    tags.PushBack("second");
+    item["description"] = std::string("a longer description of the item");
+    items.PushBack(std::move(item));
+  }
+  builder["total"] = size;
+  return builder.ExtractValue();
+}
+
+void BuildAndSerializeJson(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = BuildResponse(state.range(0));
+    auto str = formats::json::ToString(json);
+    benchmark::DoNotOptimize(str);
+  }
+}
+
 BENCHMARK(SmallJson);
 
 BENCHMARK(MiddleJson);
@@ -1179,6 +1208,8 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+BENCHMARK(BuildAndSerializeJson)->RangeMultiplier(10)->Range(10, 1000);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -83,6 +83,38 @@ TEST(FormatsJson, ParseFromBadFile) {
   }
 }
 
+TEST(FormatsJson, FromStringInPlace) {
+  constexpr std::string_view kDoc =
+      R"({"short":"s","long":"a string that surely does not fit SSO",)"
+      R"("escaped":"a\"b\\c\u0444","arr":[1,2.5,true,null]})";
+
+  formats::json::ValueBuilder builder;
+  {
+    auto json = formats::json::FromStringInPlace(std::string{kDoc});
+    EXPECT_EQ(json, formats::json::FromString(kDoc));
+    EXPECT_EQ(json["escaped"].As<std::string>(), "a\"b\\c\u0444");
+    builder = formats::json::ValueBuilder{std::move(json)};
+  }
+
+  // The strings outlive the parsed document
+  builder["short"] = "other";
+  EXPECT_EQ(builder.ExtractValue()["long"].As<std::string>(),
+            "a string that surely does not fit SSO");
+
+  const auto clone =
+      formats::json::FromStringInPlace(std::string{kDoc})["long"].Clone();
+  EXPECT_EQ(clone.As<std::string>(), "a string that surely does not fit SSO");
+}
+
+TEST(FormatsJson, FromStringInPlaceErrors) {
+  using ParseException = formats::json::Value::ParseException;
+
+  EXPECT_THROW(formats::json::FromStringInPlace(std::string{}), ParseException);
+  EXPECT_THROW(formats::json::FromStringInPlace(R"({"a":})"), ParseException);
+  EXPECT_THROW(formats::json::FromStringInPlace(R"({"a":1,"a":2})"),
+               ParseException);
+}
+
 class FmtFormatterParameterized : public testing::TestWithParam<std::string> {};
 
 TEST_P(FmtFormatterParameterized, FormatsJsonFmt) {
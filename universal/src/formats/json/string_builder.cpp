@@ -5,13 +5,13 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
 
 #include <formats/common/validations.hpp>
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/writer.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -20,13 +20,17 @@ namespace formats::json {
 
 struct StringBuilder::Impl {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+  impl::Writer writer{buffer};
 
   Impl() = default;
+
+  explicit Impl(std::size_t size_hint) : buffer(nullptr, size_hint) {}
 };
 
 StringBuilder::StringBuilder() = default;
 
+StringBuilder::StringBuilder(std::size_t size_hint) : impl_(size_hint) {}
+
 StringBuilder::~StringBuilder() = default;
 
 std::string_view StringBuilder::GetStringView() const {
@@ -105,9 +109,7 @@ void WriteToStream(const std::string& value, StringBuilder& sw) {
 
 void WriteToStream(std::chrono::system_clock::time_point tp,
                    StringBuilder& sw) {
-  WriteToStream(
-      utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format),
-      sw);
+  WriteToStream(utils::datetime::ToRfc3339String(tp), sw);
 }
 
 StringBuilder::ObjectGuard::ObjectGuard(StringBuilder& sw) : sw_(sw) {
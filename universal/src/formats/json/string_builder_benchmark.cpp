@@ -1,3 +1,5 @@
+#include <string_view>
+
 #include <benchmark/benchmark.h>
 
 #include <userver/formats/json/string_builder.hpp>
@@ -74,4 +76,28 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+constexpr std::string_view kText =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua.\n\"Ut enim\" ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip.";
+
+void JsonStringBuilderText(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    StringBuilder sw;
+    {
+      const StringBuilder::ArrayGuard guard(sw);
+      for (int i = 0; i < state.range(0); ++i) {
+        const StringBuilder::ObjectGuard object_guard(sw);
+        sw.Key("text");
+        sw.WriteString(kText);
+        sw.Key("score");
+        sw.WriteDouble(i * 0.37);
+      }
+    }
+    auto str = sw.GetString();
+    benchmark::DoNotOptimize(str);
+  }
+}
+BENCHMARK(JsonStringBuilderText)->RangeMultiplier(8)->Range(1, 4096);
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,10 @@
 
 #include <array>
 #include <cstring>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
 
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/serialize_duration.hpp>
@@ -200,6 +204,59 @@ TEST(JsonStringBuilder, StringView) {
   EXPECT_EQ(sw.GetString(), "\"some string\"");
 }
 
+TEST(JsonStringBuilder, EscapedString) {
+  std::string all_bytes;
+  for (int i = 0; i < 256; ++i) all_bytes += static_cast<char>(i);
+
+  for (const auto str : std::initializer_list<std::string_view>{
+           "",
+           "\"",
+           "a\\b",
+           "line\nbreak\ttab\r\b\f",
+           "\x01\x1f\x7f",
+           "a string long enough not to fit in a few words of eight bytes",
+           "a long string with \"quotes\" and \\backslashes\\ in between",
+           "юникод — не экранируется",
+           all_bytes,
+       }) {
+    StringBuilder sw;
+    sw.WriteString(str);
+    // the same escaping as of formats::json::ToString
+    EXPECT_EQ(sw.GetString(), ToString(ValueBuilder{str}.ExtractValue()));
+    EXPECT_EQ(FromString(sw.GetString()).As<std::string>(), str);
+  }
+}
+
+TEST(JsonStringBuilder, DoubleFormatting) {
+  for (const auto& [value, expected] :
+       std::initializer_list<std::pair<double, std::string_view>>{
+           {0.0, "0.0"},
+           {-0.0, "-0.0"},
+           {0.1, "0.1"},
+           {-12.5, "-12.5"},
+           {1e15, "1000000000000000.0"},
+           {1e-7, "1e-7"},
+           {1.5e300, "1.5e300"},
+           {5e-324, "5e-324"},
+           {1.7976931348623157e308, "1.7976931348623157e308"},
+       }) {
+    StringBuilder sw;
+    sw.WriteDouble(value);
+    EXPECT_EQ(sw.GetString(), expected);
+    EXPECT_EQ(FromString(sw.GetString()).As<double>(), value);
+  }
+}
+
+TEST(JsonStringBuilder, SizeHint) {
+  StringBuilder sw{1024};
+  {
+    const StringBuilder::ObjectGuard guard{sw};
+    sw.Key("key");
+    sw.WriteString(std::string(2000, 'a'));
+  }
+  EXPECT_EQ(sw.GetString(), R"({"key":")" + std::string(2000, 'a') + R"("})");
+}
+
 TEST(JsonStringBuilder, Second) {
   StringBuilder sw;
   WriteToStream(std::chrono::seconds{42}, sw);
@@ -383,7 +383,8 @@ std::string Value::GetPath() const {
 }
 
 Value Value::Clone() const {
-  return Value{impl::VersionedValuePtr::Create(GetNative(), g_allocator)};
+  return Value{
+      impl::VersionedValuePtr::Create(GetNative(), g_allocator, true)};
 }
 
 void Value::EnsureNotMissing() const {
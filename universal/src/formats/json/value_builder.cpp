@@ -8,7 +8,7 @@
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/datetime.hpp>
+#include <userver/utils/datetime/rfc3339.hpp>
 
 #include <formats/common/validations.hpp>
 #include <formats/json/impl/types_impl.hpp>
@@ -108,17 +108,18 @@ ValueBuilder& ValueBuilder::operator=(ValueBuilder&& other) {
 ValueBuilder::ValueBuilder(const formats::json::Value& other) {
   // As we have new native object created,
   // we fill it with the copy from other's native object.
-  value_->GetNative().CopyFrom(other.GetNative(), g_allocator);
+  value_->GetNative().CopyFrom(other.GetNative(), g_allocator, true);
 }
 
 ValueBuilder::ValueBuilder(formats::json::Value&& other) {
   // As we have new native object created,
   // we fill it with the other's native object.
-  if (other.IsUniqueReference())
+  // The strings of an in-situ parsed value die with its buffer
+  if (other.IsUniqueReference() && !other.root_.IsInsitu())
     value_->GetNative() = std::move(other.GetNative());
   else
     // rapidjson uses move semantics in assignment
-    value_->GetNative().CopyFrom(other.GetNative(), g_allocator);
+    value_->GetNative().CopyFrom(other.GetNative(), g_allocator, true);
 }
 
 ValueBuilder::ValueBuilder(EmplaceEnabler,
@@ -284,8 +285,7 @@ impl::Value& ValueBuilder::AddMember(std::string_view key,
 
 Value Serialize(std::chrono::system_clock::time_point tp,
                 formats::serialize::To<Value>) {
-  json::ValueBuilder builder =
-      utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format);
+  json::ValueBuilder builder = utils::datetime::ToRfc3339String(tp);
   return builder.ExtractValue();
 }
 
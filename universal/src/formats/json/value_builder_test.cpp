@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
@@ -160,6 +163,26 @@ TEST(JsonValueBuilder, StringViewEmplaceNocheck) {
   EXPECT_EQ(1025, value[std::string(1024, 'a') + 'b'].As<int>());
 }
 
+TEST(JsonValueBuilder, ValuesBuiltInOtherThread) {
+  // The memory blocks of the values are cached per thread, the values must
+  // survive the thread they were built in
+  std::vector<formats::json::ValueBuilder> builders;
+  std::thread([&builders] {
+    for (int i = 0; i < 1000; ++i) {
+      auto& builder = builders.emplace_back();
+      builder["number"] = i;
+      builder["list"].PushBack(std::to_string(i));
+    }
+  }).join();
+
+  for (int i = 0; i < 1000; ++i) {
+    auto value = builders[i].ExtractValue();
+    EXPECT_EQ(value["number"].As<int>(), i);
+    EXPECT_EQ(value["list"][0].As<std::string>(), std::to_string(i));
+  }
+  builders.clear();
+}
+
 }  // namespace my_namespace
 
 /// [Sample Customization formats::json::ValueBuilder usage]
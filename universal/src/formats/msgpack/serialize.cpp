@@ -0,0 +1,506 @@
+#include <userver/formats/msgpack/serialize.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+
+#include <fmt/format.h>
+#include <rapidjson/document.h>
+#include <boost/container/small_vector.hpp>
+
+#include <formats/json/impl/json_tree.hpp>
+#include <formats/json/impl/types_impl.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/msgpack/exception.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace {
+
+namespace format {
+
+constexpr std::uint8_t kPositiveFixintMax = 0x7f;
+constexpr std::uint8_t kFixmap = 0x80;
+constexpr std::uint8_t kFixarray = 0x90;
+constexpr std::uint8_t kFixstr = 0xa0;
+constexpr std::uint8_t kNil = 0xc0;
+constexpr std::uint8_t kFalse = 0xc2;
+constexpr std::uint8_t kTrue = 0xc3;
+constexpr std::uint8_t kBin8 = 0xc4;
+constexpr std::uint8_t kBin16 = 0xc5;
+constexpr std::uint8_t kBin32 = 0xc6;
+constexpr std::uint8_t kFloat32 = 0xca;
+constexpr std::uint8_t kFloat64 = 0xcb;
+constexpr std::uint8_t kUint8 = 0xcc;
+constexpr std::uint8_t kUint16 = 0xcd;
+constexpr std::uint8_t kUint32 = 0xce;
+constexpr std::uint8_t kUint64 = 0xcf;
+constexpr std::uint8_t kInt8 = 0xd0;
+constexpr std::uint8_t kInt16 = 0xd1;
+constexpr std::uint8_t kInt32 = 0xd2;
+constexpr std::uint8_t kInt64 = 0xd3;
+constexpr std::uint8_t kStr8 = 0xd9;
+constexpr std::uint8_t kStr16 = 0xda;
+constexpr std::uint8_t kStr32 = 0xdb;
+constexpr std::uint8_t kArray16 = 0xdc;
+constexpr std::uint8_t kArray32 = 0xdd;
+constexpr std::uint8_t kMap16 = 0xde;
+constexpr std::uint8_t kMap32 = 0xdf;
+constexpr std::uint8_t kNegativeFixintMin = 0xe0;
+
+constexpr std::size_t kFixmapMaxSize = 15;
+constexpr std::size_t kFixarrayMaxSize = 15;
+constexpr std::size_t kFixstrMaxSize = 31;
+
+}  // namespace format
+
+constexpr std::size_t kInitialStackDepth = 32;
+
+::rapidjson::CrtAllocator g_allocator;
+
+// Serialization
+
+class Writer final {
+ public:
+  std::string Extract() && { return std::move(buffer_); }
+
+  void WriteNull() { WriteByte(format::kNil); }
+
+  void WriteBool(bool value) {
+    WriteByte(value ? format::kTrue : format::kFalse);
+  }
+
+  void WriteUint64(std::uint64_t value) {
+    if (value <= format::kPositiveFixintMax) {
+      WriteByte(static_cast<std::uint8_t>(value));
+    } else if (value <= std::numeric_limits<std::uint8_t>::max()) {
+      WriteWithHeader(format::kUint8, static_cast<std::uint8_t>(value));
+    } else if (value <= std::numeric_limits<std::uint16_t>::max()) {
+      WriteWithHeader(format::kUint16, static_cast<std::uint16_t>(value));
+    } else if (value <= std::numeric_limits<std::uint32_t>::max()) {
+      WriteWithHeader(format::kUint32, static_cast<std::uint32_t>(value));
+    } else {
+      WriteWithHeader(format::kUint64, value);
+    }
+  }
+
+  void WriteInt64(std::int64_t value) {
+    if (value >= 0) {
+      WriteUint64(static_cast<std::uint64_t>(value));
+    } else if (value >= -32) {
+      WriteByte(static_cast<std::uint8_t>(value));
+    } else if (value >= std::numeric_limits<std::int8_t>::min()) {
+      WriteWithHeader(format::kInt8, static_cast<std::uint8_t>(value));
+    } else if (value >= std::numeric_limits<std::int16_t>::min()) {
+      WriteWithHeader(format::kInt16, static_cast<std::uint16_t>(value));
+    } else if (value >= std::numeric_limits<std::int32_t>::min()) {
+      WriteWithHeader(format::kInt32, static_cast<std::uint32_t>(value));
+    } else {
+      WriteWithHeader(format::kInt64, static_cast<std::uint64_t>(value));
+    }
+  }
+
+  void WriteDouble(double value) {
+    std::uint64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value));
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteWithHeader(format::kFloat64, bits);
+  }
+
+  void WriteString(std::string_view value) {
+    const auto size = value.size();
+    if (size <= format::kFixstrMaxSize) {
+      WriteByte(format::kFixstr | static_cast<std::uint8_t>(size));
+    } else if (size <= std::numeric_limits<std::uint8_t>::max()) {
+      WriteWithHeader(format::kStr8, static_cast<std::uint8_t>(size));
+    } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+      WriteWithHeader(format::kStr16, static_cast<std::uint16_t>(size));
+    } else {
+      WriteWithHeader(format::kStr32, CheckedSize(size));
+    }
+    buffer_.append(value);
+  }
+
+  void WriteArrayHeader(std::size_t size) {
+    if (size <= format::kFixarrayMaxSize) {
+      WriteByte(format::kFixarray | static_cast<std::uint8_t>(size));
+    } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+      WriteWithHeader(format::kArray16, static_cast<std::uint16_t>(size));
+    } else {
+      WriteWithHeader(format::kArray32, CheckedSize(size));
+    }
+  }
+
+  void WriteMapHeader(std::size_t size) {
+    if (size <= format::kFixmapMaxSize) {
+      WriteByte(format::kFixmap | static_cast<std::uint8_t>(size));
+    } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+      WriteWithHeader(format::kMap16, static_cast<std::uint16_t>(size));
+    } else {
+      WriteWithHeader(format::kMap32, CheckedSize(size));
+    }
+  }
+
+ private:
+  static std::uint32_t CheckedSize(std::size_t size) {
+    if (size > std::numeric_limits<std::uint32_t>::max()) {
+      throw Exception(fmt::format(
+          "Size {} is too large for MessagePack, max allowed is {}", size,
+          std::numeric_limits<std::uint32_t>::max()));
+    }
+    return static_cast<std::uint32_t>(size);
+  }
+
+  void WriteByte(std::uint8_t byte) {
+    buffer_.push_back(static_cast<char>(byte));
+  }
+
+  // writes the header byte followed by the big-endian `value`
+  template <typename UnsignedInt>
+  void WriteWithHeader(std::uint8_t header, UnsignedInt value) {
+    char bytes[1 + sizeof(UnsignedInt)];
+    bytes[0] = static_cast<char>(header);
+    for (std::size_t i = sizeof(UnsignedInt); i > 0; --i) {
+      bytes[i] = static_cast<char>(value & 0xff);
+      if constexpr (sizeof(UnsignedInt) > 1) value >>= 8;
+    }
+    buffer_.append(bytes, sizeof(bytes));
+  }
+
+  std::string buffer_;
+};
+
+void WriteScalar(const json::impl::Value& value, Writer& writer) {
+  if (value.IsNull()) {
+    writer.WriteNull();
+  } else if (value.IsBool()) {
+    writer.WriteBool(value.GetBool());
+  } else if (value.IsUint64()) {
+    writer.WriteUint64(value.GetUint64());
+  } else if (value.IsInt64()) {
+    writer.WriteInt64(value.GetInt64());
+  } else if (value.IsDouble()) {
+    writer.WriteDouble(value.GetDouble());
+  } else {
+    UASSERT(value.IsString());
+    writer.WriteString({value.GetString(), value.GetStringLength()});
+  }
+}
+
+// Parsing
+
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  bool IsEnd() const noexcept { return position_ == data_.size(); }
+
+  std::size_t Position() const noexcept { return position_; }
+
+  std::size_t Remaining() const noexcept { return data_.size() - position_; }
+
+  std::uint8_t ReadByte() {
+    EnsureAvailable(1);
+    return static_cast<std::uint8_t>(data_[position_++]);
+  }
+
+  // reads the big-endian integer
+  template <typename UnsignedInt>
+  UnsignedInt ReadUnsigned() {
+    EnsureAvailable(sizeof(UnsignedInt));
+    UnsignedInt value = 0;
+    for (std::size_t i = 0; i < sizeof(UnsignedInt); ++i) {
+      if constexpr (sizeof(UnsignedInt) > 1) value <<= 8;
+      value |= static_cast<std::uint8_t>(data_[position_++]);
+    }
+    return value;
+  }
+
+  std::string_view ReadBytes(std::size_t size) {
+    EnsureAvailable(size);
+    const auto result = data_.substr(position_, size);
+    position_ += size;
+    return result;
+  }
+
+  [[noreturn]] void Fail(std::string_view message) const {
+    throw ParseException(fmt::format("MessagePack parse error at offset {}: {}",
+                                     position_, message));
+  }
+
+ private:
+  void EnsureAvailable(std::size_t size) const {
+    if (Remaining() < size) Fail("unexpected end of document");
+  }
+
+  std::string_view data_;
+  std::size_t position_{0};
+};
+
+struct Container final {
+  bool is_map;
+  std::uint32_t size;
+  std::uint32_t remaining;
+  bool is_key_expected;
+};
+
+class DocumentGenerator final {
+ public:
+  explicit DocumentGenerator(Reader& reader) : reader_(reader) {}
+
+  bool operator()(json::impl::Document& handler) {
+    do {
+      if (!stack_.empty() && stack_.back().is_map &&
+          stack_.back().is_key_expected) {
+        ReadKey(handler);
+        stack_.back().is_key_expected = false;
+      } else {
+        ReadValue(handler);
+      }
+
+      // close the finished containers
+      while (!stack_.empty() && stack_.back().remaining == 0) {
+        const auto& finished = stack_.back();
+        if (finished.is_map) {
+          handler.EndObject(finished.size);
+        } else {
+          handler.EndArray(finished.size);
+        }
+        stack_.pop_back();
+      }
+    } while (!stack_.empty());
+
+    return true;
+  }
+
+ private:
+  void ReadKey(json::impl::Document& handler) {
+    const auto header = reader_.ReadByte();
+    const auto key = ReadString(header);
+    if (!key) reader_.Fail("map keys must be strings");
+    handler.Key(key->data(), static_cast<rapidjson::SizeType>(key->size()),
+                /*copy=*/true);
+  }
+
+  void ReadValue(json::impl::Document& handler) {
+    if (!stack_.empty()) {
+      auto& parent = stack_.back();
+      UASSERT(parent.remaining > 0);
+      --parent.remaining;
+      parent.is_key_expected = parent.is_map;
+    }
+
+    const auto header = reader_.ReadByte();
+    if (header <= format::kPositiveFixintMax) {
+      handler.Uint(header);
+    } else if (header >= format::kNegativeFixintMin) {
+      handler.Int(static_cast<std::int8_t>(header));
+    } else if ((header & 0xf0) == format::kFixmap) {
+      EnterContainer(handler, true, header & 0x0f);
+    } else if ((header & 0xf0) == format::kFixarray) {
+      EnterContainer(handler, false, header & 0x0f);
+    } else if (const auto str = ReadString(header)) {
+      handler.String(str->data(),
+                     static_cast<rapidjson::SizeType>(str->size()),
+                     /*copy=*/true);
+    } else {
+      ReadOther(handler, header);
+    }
+  }
+
+  void ReadOther(json::impl::Document& handler, std::uint8_t header) {
+    switch (header) {
+      case format::kNil:
+        handler.Null();
+        break;
+      case format::kFalse:
+        handler.Bool(false);
+        break;
+      case format::kTrue:
+        handler.Bool(true);
+        break;
+      case format::kUint8:
+        handler.Uint(reader_.ReadUnsigned<std::uint8_t>());
+        break;
+      case format::kUint16:
+        handler.Uint(reader_.ReadUnsigned<std::uint16_t>());
+        break;
+      case format::kUint32:
+        handler.Uint(reader_.ReadUnsigned<std::uint32_t>());
+        break;
+      case format::kUint64:
+        handler.Uint64(reader_.ReadUnsigned<std::uint64_t>());
+        break;
+      case format::kInt8:
+        handler.Int(static_cast<std::int8_t>(
+            reader_.ReadUnsigned<std::uint8_t>()));
+        break;
+      case format::kInt16:
+        handler.Int(static_cast<std::int16_t>(
+            reader_.ReadUnsigned<std::uint16_t>()));
+        break;
+      case format::kInt32:
+        handler.Int(static_cast<std::int32_t>(
+            reader_.ReadUnsigned<std::uint32_t>()));
+        break;
+      case format::kInt64:
+        handler.Int64(static_cast<std::int64_t>(
+            reader_.ReadUnsigned<std::uint64_t>()));
+        break;
+      case format::kFloat32: {
+        const auto bits = reader_.ReadUnsigned<std::uint32_t>();
+        float value = 0;
+        static_assert(sizeof(bits) == sizeof(value));
+        std::memcpy(&value, &bits, sizeof(value));
+        handler.Double(CheckedDouble(value));
+        break;
+      }
+      case format::kFloat64: {
+        const auto bits = reader_.ReadUnsigned<std::uint64_t>();
+        double value = 0;
+        static_assert(sizeof(bits) == sizeof(value));
+        std::memcpy(&value, &bits, sizeof(value));
+        handler.Double(CheckedDouble(value));
+        break;
+      }
+      case format::kArray16:
+        EnterContainer(handler, false, reader_.ReadUnsigned<std::uint16_t>());
+        break;
+      case format::kArray32:
+        EnterContainer(handler, false, reader_.ReadUnsigned<std::uint32_t>());
+        break;
+      case format::kMap16:
+        EnterContainer(handler, true, reader_.ReadUnsigned<std::uint16_t>());
+        break;
+      case format::kMap32:
+        EnterContainer(handler, true, reader_.ReadUnsigned<std::uint32_t>());
+        break;
+      default:
+        reader_.Fail(fmt::format("unsupported type 0x{:02x}", header));
+    }
+  }
+
+  // returns nullopt if `header` is not of a str or bin family
+  std::optional<std::string_view> ReadString(std::uint8_t header) {
+    if ((header & 0xe0) == format::kFixstr) {
+      return reader_.ReadBytes(header & 0x1f);
+    }
+    switch (header) {
+      case format::kStr8:
+      case format::kBin8:
+        return reader_.ReadBytes(reader_.ReadUnsigned<std::uint8_t>());
+      case format::kStr16:
+      case format::kBin16:
+        return reader_.ReadBytes(reader_.ReadUnsigned<std::uint16_t>());
+      case format::kStr32:
+      case format::kBin32:
+        return reader_.ReadBytes(reader_.ReadUnsigned<std::uint32_t>());
+      default:
+        return std::nullopt;
+    }
+  }
+
+  void EnterContainer(json::impl::Document& handler, bool is_map,
+                      std::uint32_t size) {
+    // each item takes at least a byte, do not trust the size in vain
+    const std::size_t min_bytes = is_map ? std::size_t{size} * 2 : size;
+    if (min_bytes > reader_.Remaining()) {
+      reader_.Fail(fmt::format("{} of {} items does not fit into the document",
+                               is_map ? "map" : "array", size));
+    }
+
+    if (is_map) {
+      handler.StartObject();
+    } else {
+      handler.StartArray();
+    }
+    stack_.push_back({is_map, size, size, is_map});
+  }
+
+  double CheckedDouble(double value) const {
+    if (!std::isfinite(value)) {
+      reader_.Fail("not finite floating point numbers are not supported");
+    }
+    return value;
+  }
+
+  Reader& reader_;
+  boost::container::small_vector<Container, kInitialStackDepth> stack_;
+};
+
+}  // namespace
+
+formats::json::Value FromString(std::string_view doc) {
+  if (doc.empty()) {
+    throw ParseException("MessagePack document is empty");
+  }
+
+  Reader reader{doc};
+  DocumentGenerator generator{reader};
+  json::impl::Document document{&g_allocator};
+  document.Populate(generator);
+  if (!reader.IsEnd()) {
+    reader.Fail("extra data after the end of document");
+  }
+
+  try {
+    json::impl::CheckKeyUniqueness(&document);
+  } catch (const json::ParseException& e) {
+    throw ParseException(e.what());
+  }
+
+  return json::Value{
+      json::impl::VersionedValuePtr::Create(std::move(document))};
+}
+
+std::string ToString(const formats::json::Value& doc) {
+  struct Frame final {
+    const json::impl::Value* container;
+    std::size_t index;
+  };
+
+  Writer writer;
+  boost::container::small_vector<Frame, kInitialStackDepth> stack;
+  const json::impl::Value* value = &doc.GetNative();
+
+  for (;;) {
+    if (value->IsObject()) {
+      writer.WriteMapHeader(value->MemberCount());
+      stack.push_back({value, 0});
+    } else if (value->IsArray()) {
+      writer.WriteArrayHeader(value->Size());
+      stack.push_back({value, 0});
+    } else {
+      WriteScalar(*value, writer);
+    }
+
+    // find the next value, leaving the finished containers
+    value = nullptr;
+    while (!stack.empty() && !value) {
+      auto& frame = stack.back();
+      if (frame.container->IsObject()) {
+        if (frame.index < frame.container->MemberCount()) {
+          const auto& member = frame.container->MemberBegin()[frame.index++];
+          writer.WriteString(
+              {member.name.GetString(), member.name.GetStringLength()});
+          value = &member.value;
+        }
+      } else if (frame.index < frame.container->Size()) {
+        value = &frame.container->Begin()[frame.index++];
+      }
+      if (!value) stack.pop_back();
+    }
+    if (!value) break;
+  }
+
+  return std::move(writer).Extract();
+}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/msgpack.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string Bytes(std::initializer_list<std::uint8_t> bytes) {
+  return {bytes.begin(), bytes.end()};
+}
+
+}  // namespace
+
+TEST(MsgpackSerialize, SpecExample) {
+  const auto json = formats::json::FromString(R"({"compact":true,"schema":0})");
+  const auto expected = Bytes({0x82, 0xa7, 'c', 'o', 'm', 'p', 'a', 'c', 't',
+                               0xc3, 0xa6, 's', 'c', 'h', 'e', 'm', 'a', 0x00});
+
+  EXPECT_EQ(formats::msgpack::ToString(json), expected);
+  EXPECT_EQ(formats::msgpack::FromString(expected), json);
+}
+
+TEST(MsgpackSerialize, ShortestIntegers) {
+  using formats::json::ValueBuilder;
+  const auto to_msgpack = [](auto value) {
+    return formats::msgpack::ToString(ValueBuilder{value}.ExtractValue());
+  };
+
+  EXPECT_EQ(to_msgpack(0), Bytes({0x00}));
+  EXPECT_EQ(to_msgpack(127), Bytes({0x7f}));
+  EXPECT_EQ(to_msgpack(128), Bytes({0xcc, 0x80}));
+  EXPECT_EQ(to_msgpack(256), Bytes({0xcd, 0x01, 0x00}));
+  EXPECT_EQ(to_msgpack(std::uint64_t{1} << 32),
+            Bytes({0xcf, 0, 0, 0, 1, 0, 0, 0, 0}));
+  EXPECT_EQ(to_msgpack(-1), Bytes({0xff}));
+  EXPECT_EQ(to_msgpack(-32), Bytes({0xe0}));
+  EXPECT_EQ(to_msgpack(-33), Bytes({0xd0, 0xdf}));
+  EXPECT_EQ(to_msgpack(-129), Bytes({0xd1, 0xff, 0x7f}));
+  EXPECT_EQ(to_msgpack(1.5), Bytes({0xcb, 0x3f, 0xf8, 0, 0, 0, 0, 0, 0}));
+}
+
+TEST(MsgpackSerialize, Roundtrip) {
+  formats::json::ValueBuilder builder;
+  builder["null"] = formats::json::ValueBuilder{};
+  builder["string"] = "text";
+  builder["long_string"] = std::string(70'000, 'a');
+  builder["min"] = std::numeric_limits<std::int64_t>::min();
+  builder["max"] = std::numeric_limits<std::uint64_t>::max();
+  builder["double"] = -0.25;
+  builder["empty_object"] = formats::json::MakeObject();
+  builder["empty_array"] = formats::json::MakeArray();
+  for (int i = 0; i < 100; ++i) {
+    builder["array"].PushBack(formats::json::MakeObject("i", i, "odd", i % 2));
+  }
+  const auto json = builder.ExtractValue();
+
+  const auto msgpack = formats::msgpack::ToString(json);
+  EXPECT_LT(msgpack.size(), formats::json::ToString(json).size());
+  EXPECT_EQ(formats::msgpack::FromString(msgpack), json);
+}
+
+TEST(MsgpackSerialize, DeeplyNested) {
+  constexpr std::size_t kDepth = 1'000;
+  const auto msgpack = std::string(kDepth, '\x91') + '\xc0';
+
+  const auto json = formats::msgpack::FromString(msgpack);
+  EXPECT_EQ(formats::msgpack::ToString(json), msgpack);
+}
+
+TEST(MsgpackSerialize, OtherEncodings) {
+  // float 32, uint 16, int 64, bin 8 and map 16 are read as usual JSON values
+  const auto msgpack =
+      Bytes({0xde, 0x00, 0x04,                                  //
+             0xa1, 'f', 0xca, 0x3f, 0xc0, 0x00, 0x00,           //
+             0xa1, 'u', 0xcd, 0xff, 0xff,                       //
+             0xa1, 'i', 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+             0xa1, 'b', 0xc4, 0x02, 'a', 'b'});
+
+  const auto json = formats::msgpack::FromString(msgpack);
+  EXPECT_EQ(json, formats::json::FromString(
+                      R"({"f":1.5,"u":65535,"i":-2,"b":"ab"})"));
+}
+
+TEST(MsgpackSerialize, Errors) {
+  using formats::msgpack::FromString;
+  using formats::msgpack::ParseException;
+
+  EXPECT_THROW(FromString(""), ParseException);
+  EXPECT_THROW(FromString(Bytes({0x92, 0x01})), ParseException);
+  EXPECT_THROW(FromString(Bytes({0x01, 0x02})), ParseException);
+  EXPECT_THROW(FromString(Bytes({0xa3, 'a'})), ParseException);
+  EXPECT_THROW(FromString(Bytes({0xdd, 0xff, 0xff, 0xff, 0xff})),
+               ParseException);
+  // non-string key
+  EXPECT_THROW(FromString(Bytes({0x81, 0x01, 0x02})), ParseException);
+  // duplicate key
+  EXPECT_THROW(FromString(Bytes({0x82, 0xa1, 'a', 0x01, 0xa1, 'a', 0x02})),
+               ParseException);
+  // extension type
+  EXPECT_THROW(FromString(Bytes({0xd4, 0x01, 0x00})), ParseException);
+  // never used
+  EXPECT_THROW(FromString(Bytes({0xc1})), ParseException);
+  // NaN
+  EXPECT_THROW(FromString(Bytes({0xca, 0x7f, 0xc0, 0x00, 0x00})),
+               ParseException);
+}
+
+TEST(MsgpackSerialize, CustomTypes) {
+  /// [Sample formats::msgpack usage]
+  const std::map<std::string, std::vector<int>> data{{"a", {1, 2}}, {"b", {}}};
+
+  // Serialize/Parse customizations of formats::json work for MessagePack
+  const auto msgpack = formats::msgpack::ToString(
+      formats::json::ValueBuilder{data}.ExtractValue());
+  const auto parsed = formats::msgpack::FromString(msgpack)
+                          .As<std::map<std::string, std::vector<int>>>();
+  /// [Sample formats::msgpack usage]
+
+  EXPECT_EQ(parsed, data);
+}
+
+USERVER_NAMESPACE_END
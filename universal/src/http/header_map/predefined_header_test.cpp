@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <fmt/format.h>
 
 #include <userver/http/common_headers.hpp>
@@ -29,6 +31,22 @@ TEST(HeaderMapHasher, SameAtCompileTimeAndRuntime) {
   EXPECT_EQ(compile_time_hash, runtime_hash);
 }
 
+TEST(HeaderMapHasher, WordLoadsSameAsByteLoads) {
+  std::string data;
+  for (std::size_t i = 0; i < 64; ++i) {
+    data.push_back(static_cast<char>((i % 2 ? 'A' : '-') + i * 37 % 256));
+  }
+
+  const impl::UnsafeConstexprHasher hasher{};
+  for (std::size_t offset = 0; offset < 8; ++offset) {
+    for (std::size_t size = 0; offset + size <= data.size(); ++size) {
+      const std::string_view str{data.data() + offset, size};
+      EXPECT_EQ(hasher.HashAtRuntime(str), hasher(str))
+          << "offset=" << offset << " size=" << size;
+    }
+  }
+}
+
 TEST(PredefinedHeader, IsFormattable) {
   constexpr auto header = kXRequestApplication;
 
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <userver/http/header_map.hpp>
@@ -108,6 +109,32 @@ void HeaderMapWorstCaseCollisionsBenchmark(benchmark::State& state) {
 }
 BENCHMARK(HeaderMapWorstCaseCollisionsBenchmark);
 
+const std::vector<std::string_view> kTypicalHeaders{
+    "Host",          "User-Agent",     "Accept",        "Accept-Encoding",
+    "Content-Type",  "Content-Length", "Connection",    "X-Request-Id",
+    "X-YaRequestId", "X-YaSpanId",     "X-YaTraceId",   "Authorization",
+    "Cookie",        "X-Forwarded-For"};
+
+void HeaderMapHashByteLoads(benchmark::State& state) {
+  const http::headers::impl::UnsafeConstexprHasher hasher{};
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto header : kTypicalHeaders) {
+      benchmark::DoNotOptimize(hasher(header));
+    }
+  }
+}
+BENCHMARK(HeaderMapHashByteLoads);
+
+void HeaderMapHashWordLoads(benchmark::State& state) {
+  const http::headers::impl::UnsafeConstexprHasher hasher{};
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto header : kTypicalHeaders) {
+      benchmark::DoNotOptimize(hasher.HashAtRuntime(header));
+    }
+  }
+}
+BENCHMARK(HeaderMapHashWordLoads);
+
 void HeaderMapEraseBenchmark(benchmark::State& state) {
   const auto headers = [] {
     constexpr std::size_t kHeadersCount = 1000;
@@ -5,6 +5,8 @@
 
 #include <userver/utils/encoding/hex.hpp>
 
+#include <http/parser/lazy_args.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace http::parser {
@@ -57,32 +59,11 @@ std::string UrlDecode(std::string_view url) {
 }
 
 void ParseAndConsumeArgs(std::string_view args, ArgsConsumer handler) {
-  const char* end = args.data() + args.size();
-  const char* key_begin = args.data();
-  const char* key_end = args.data();
-  bool parse_key = true;
-  for (const char* ptr = args.data(); ptr <= end; ++ptr) {
-    if (ptr == end || *ptr == '&') {
-      if (!parse_key) {
-        const char* value_begin = key_end + 1;
-        const char* value_end = ptr;
-        if (key_begin < key_end && value_begin <= value_end) {
-          std::string_view key(key_begin, key_end - key_begin);
-          std::string_view value(value_begin, value_end - value_begin);
-          handler(USERVER_NAMESPACE::http::parser::UrlDecode(key),
-                  USERVER_NAMESPACE::http::parser::UrlDecode(value));
-        }
-      }
-      parse_key = true;
-      key_begin = ptr + 1;
-      continue;
-    }
-    if (*ptr == '=' && parse_key) {
-      parse_key = false;
-      key_end = ptr;
-      continue;
-    }
-  }
+  impl::ForEachRawArg(args, [&handler](std::string_view key,
+                                       std::string_view value) {
+    handler(USERVER_NAMESPACE::http::parser::UrlDecode(key),
+            USERVER_NAMESPACE::http::parser::UrlDecode(value));
+  });
 }
 
 }  // namespace http::parser
@@ -0,0 +1,118 @@
+#include <http/parser/lazy_args.hpp>
+
+#include <algorithm>
+
+#include <userver/http/parser/http_request_parse_args.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace http::parser {
+
+namespace {
+
+bool IsXDigit(char c) noexcept {
+  const auto lower = static_cast<char>(c | 0x20);
+  return (c >= '0' && c <= '9') || (lower >= 'a' && lower <= 'f');
+}
+
+// Performs the same checks as UrlDecode() without decoding
+void ValidateUrlEncoding(std::string_view value) {
+  for (auto pos = value.find('%'); pos != std::string_view::npos;
+       pos = value.find('%', pos + 3)) {
+    if (pos + 2 < value.size() && IsXDigit(value[pos + 1]) &&
+        IsXDigit(value[pos + 2])) {
+      continue;
+    }
+    // throws a descriptive exception
+    [[maybe_unused]] const auto decoded = UrlDecode(value);
+    UINVARIANT(false, "UrlDecode() accepted an invalid percent-encoding");
+  }
+}
+
+}  // namespace
+
+void LazyArgs::Parse(std::string_view args) {
+  if (args.empty()) return;
+
+  std::string raw = raw_;
+  if (!raw.empty()) raw += '&';
+  const auto offset = raw.size();
+  raw.append(args);
+
+  std::vector<RawArg> raw_args;
+  raw_args.reserve(std::count(args.begin(), args.end(), '&') + 1);
+  impl::ForEachRawArg(
+      std::string_view{raw}.substr(offset),
+      [&](std::string_view key, std::string_view value) {
+        ValidateUrlEncoding(value);
+        raw_args.push_back(RawArg{
+            UrlDecode(key),
+            static_cast<std::size_t>(value.data() - raw.data()),
+            value.size(),
+            {},
+        });
+      });
+
+  raw_ = std::move(raw);
+  for (const auto& raw_arg : raw_args_) raw_arg.values.clear();
+  raw_args_.insert(raw_args_.end(), std::make_move_iterator(raw_args.begin()),
+                   std::make_move_iterator(raw_args.end()));
+  decoded_once_ = utils::FixedArray<std::once_flag>(raw_args_.size());
+  index_.clear();
+  index_once_.emplace();
+}
+
+const std::vector<std::string>* LazyArgs::Find(std::string_view name) const {
+  const auto& index = GetIndex();
+  const auto index_it = std::lower_bound(
+      index.begin(), index.end(), name,
+      [this](std::size_t i, std::string_view key) {
+        return raw_args_[i].key < key;
+      });
+  if (index_it == index.end() || raw_args_[*index_it].key != name) {
+    return nullptr;
+  }
+  const auto it = raw_args_.begin() + *index_it;
+
+  std::call_once(decoded_once_[it - raw_args_.begin()], [this, it] {
+    for (auto next = it; next != raw_args_.end(); ++next) {
+      if (next->key != it->key) continue;
+      it->values.push_back(UrlDecode(std::string_view{raw_}.substr(
+          next->value_offset, next->value_size)));
+    }
+  });
+  return &it->values;
+}
+
+std::size_t LazyArgs::Size() const { return GetIndex().size(); }
+
+std::vector<std::string> LazyArgs::GetNames() const {
+  const auto& index = GetIndex();
+  std::vector<std::string> result;
+  result.reserve(index.size());
+  for (const auto i : index) result.push_back(raw_args_[i].key);
+  return result;
+}
+
+const std::vector<std::size_t>& LazyArgs::GetIndex() const {
+  std::call_once(*index_once_, [this] {
+    index_.resize(raw_args_.size());
+    for (std::size_t i = 0; i < index_.size(); ++i) index_[i] = i;
+    // Stable, so that the first argument of each name is kept
+    std::stable_sort(index_.begin(), index_.end(),
+                     [this](std::size_t lhs, std::size_t rhs) {
+                       return raw_args_[lhs].key < raw_args_[rhs].key;
+                     });
+    index_.erase(std::unique(index_.begin(), index_.end(),
+                             [this](std::size_t lhs, std::size_t rhs) {
+                               return raw_args_[lhs].key == raw_args_[rhs].key;
+                             }),
+                 index_.end());
+  });
+  return index_;
+}
+
+}  // namespace http::parser
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace http::parser {
+
+namespace impl {
+
+// Calls `consumer(key, value)` for every `key=value` of `args` without
+// url-decoding them. Pairs without '=' and pairs with an empty key are skipped.
+template <typename Consumer>
+void ForEachRawArg(std::string_view args, Consumer&& consumer) {
+  while (!args.empty()) {
+    const auto pair_end = std::min(args.find('&'), args.size());
+    const auto pair = args.substr(0, pair_end);
+    args.remove_prefix(std::min(pair_end + 1, args.size()));
+
+    const auto key_end = pair.find('=');
+    if (key_end == std::string_view::npos || key_end == 0) continue;
+    consumer(pair.substr(0, key_end), pair.substr(key_end + 1));
+  }
+}
+
+}  // namespace impl
+
+// Flat map of URL arguments. The keys are decoded by Parse(), the values are
+// url-decoded on the first access to their key. Keeps a copy of the raw
+// arguments, so the parsed string may be destroyed after Parse().
+//
+// The sorted index of the distinct names is built on the first access, the
+// lookups are binary searches in it. Const member functions are thread-safe.
+class LazyArgs final {
+ public:
+  // Adds the arguments of `args`, invalidates the references to the values.
+  // Throws std::runtime_error on a malformed percent-encoding, the same way
+  // UrlDecode() does.
+  void Parse(std::string_view args);
+
+  // Values of the `name` argument, nullptr if there is no such argument
+  const std::vector<std::string>* Find(std::string_view name) const;
+
+  // Count of the distinct argument names
+  std::size_t Size() const;
+
+  bool Empty() const noexcept { return raw_args_.empty(); }
+
+  // Distinct argument names, sorted
+  std::vector<std::string> GetNames() const;
+
+  // Parsed arguments as they came, '&'-separated
+  const std::string& GetRaw() const noexcept { return raw_; }
+
+ private:
+  struct RawArg {
+    std::string key;
+    std::size_t value_offset;
+    std::size_t value_size;
+    // All the values of the key, filled on the first Find() in the first
+    // argument with this key
+    mutable std::vector<std::string> values;
+  };
+
+  // Indices of the first raw_args_ of each name, sorted by the name
+  const std::vector<std::size_t>& GetIndex() const;
+
+  std::string raw_;
+  // In the order of appearance
+  std::vector<RawArg> raw_args_;
+  mutable utils::FixedArray<std::once_flag> decoded_once_;
+  mutable std::vector<std::size_t> index_;
+  mutable std::optional<std::once_flag> index_once_{std::in_place};
+};
+
+}  // namespace http::parser
+
+USERVER_NAMESPACE_END
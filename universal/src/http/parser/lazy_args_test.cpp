@@ -0,0 +1,78 @@
+#include <http/parser/lazy_args.hpp>
+
+#include <stdexcept>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using http::parser::LazyArgs;
+
+TEST(LazyArgs, Empty) {
+  LazyArgs args;
+  args.Parse("");
+  EXPECT_TRUE(args.Empty());
+  EXPECT_EQ(args.Size(), 0);
+  EXPECT_EQ(args.Find("a"), nullptr);
+}
+
+TEST(LazyArgs, Basic) {
+  LazyArgs args;
+  args.Parse("b=2&a=1&c=&=skipped&novalue&a=3");
+
+  EXPECT_EQ(args.Size(), 3);
+  EXPECT_THAT(args.GetNames(), testing::ElementsAre("a", "b", "c"));
+
+  ASSERT_NE(args.Find("a"), nullptr);
+  EXPECT_THAT(*args.Find("a"), testing::ElementsAre("1", "3"));
+  ASSERT_NE(args.Find("b"), nullptr);
+  EXPECT_THAT(*args.Find("b"), testing::ElementsAre("2"));
+  ASSERT_NE(args.Find("c"), nullptr);
+  EXPECT_THAT(*args.Find("c"), testing::ElementsAre(""));
+
+  EXPECT_EQ(args.Find("novalue"), nullptr);
+  EXPECT_EQ(args.Find(""), nullptr);
+  EXPECT_EQ(args.Find("A"), nullptr);
+}
+
+TEST(LazyArgs, Decoding) {
+  LazyArgs args;
+  args.Parse("k%20ey=v%20al+ue&x=a%3Db&k+ey=2");
+
+  EXPECT_THAT(args.GetNames(), testing::ElementsAre("k ey", "x"));
+  EXPECT_THAT(*args.Find("k ey"), testing::ElementsAre("v al ue", "2"));
+  EXPECT_THAT(*args.Find("x"), testing::ElementsAre("a=b"));
+}
+
+TEST(LazyArgs, Invalid) {
+  for (const auto* query : {"a=%", "a=%2", "a=%zz", "a=1&b=%%41", "%x=1"}) {
+    LazyArgs args;
+    EXPECT_THROW(args.Parse(query), std::runtime_error) << query;
+  }
+}
+
+TEST(LazyArgs, MultipleSources) {
+  LazyArgs args;
+  args.Parse("a=1&b=2");
+  // the names and the values are indexed again after the next Parse()
+  EXPECT_EQ(args.Size(), 2);
+  EXPECT_THAT(*args.Find("a"), testing::ElementsAre("1"));
+  EXPECT_EQ(args.Find("c"), nullptr);
+  {
+    std::string body = "a=3&c=4";
+    args.Parse(body);
+  }
+
+  EXPECT_THAT(args.GetNames(), testing::ElementsAre("a", "b", "c"));
+  EXPECT_THAT(*args.Find("a"), testing::ElementsAre("1", "3"));
+  EXPECT_THAT(*args.Find("c"), testing::ElementsAre("4"));
+  EXPECT_EQ(args.GetRaw(), "a=1&b=2&a=3&c=4");
+
+  // a failed Parse() leaves the arguments intact
+  EXPECT_THROW(args.Parse("d=%"), std::runtime_error);
+  EXPECT_EQ(args.Size(), 3);
+  EXPECT_EQ(args.Find("d"), nullptr);
+}
+
+USERVER_NAMESPACE_END
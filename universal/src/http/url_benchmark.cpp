@@ -1,5 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+
+#include <http/parser/lazy_args.hpp>
+#include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/http/url.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -40,4 +44,47 @@ void make_query(benchmark::State& state) {
 }
 BENCHMARK(make_query)->RangeMultiplier(2)->Range(1, 256);
 
+namespace {
+
+std::string MakeArgsQuery(std::size_t args_count) {
+  std::string query;
+  for (std::size_t i = 0; i < args_count; ++i) {
+    if (!query.empty()) query += '&';
+    query += "argument_" + std::to_string(i) + "=value%20number%20" +
+             std::to_string(i);
+  }
+  return query;
+}
+
+constexpr std::string_view kLookedUpArgs[] = {"argument_3", "argument_17"};
+
+}  // namespace
+
+// Handlers usually look at a couple of arguments out of the whole query
+void parse_args_eager(benchmark::State& state) {
+  const auto query = MakeArgsQuery(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    std::unordered_map<std::string, std::vector<std::string>,
+                       utils::StrCaseHash>
+        args;
+    http::parser::ParseArgs(query, args);
+    for (const auto name : kLookedUpArgs) {
+      benchmark::DoNotOptimize(args.find(std::string{name}));
+    }
+  }
+}
+BENCHMARK(parse_args_eager)->Arg(2)->Arg(30);
+
+void parse_args_lazy(benchmark::State& state) {
+  const auto query = MakeArgsQuery(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    http::parser::LazyArgs args;
+    args.Parse(query);
+    for (const auto name : kLookedUpArgs) {
+      benchmark::DoNotOptimize(args.Find(name));
+    }
+  }
+}
+BENCHMARK(parse_args_lazy)->Arg(2)->Arg(30);
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #include "dynamic_debug.hpp"
 
 #include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
@@ -29,19 +31,9 @@ LogEntryContentSet& GetAllLocations() noexcept {
       fmt::format("dynamic-debug-log: no logging in '{}'", location));
 }
 
-}  // namespace
-
-bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-  const auto cmp = std::strcmp(x.path, y.path);
-  return cmp < 0 || (cmp == 0 && x.line < y.line);
-}
-
-bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
-  return x.line == y.line && std::strcmp(x.path, y.path) == 0;
-}
-
-void AddDynamicDebugLog(const std::string& location_relative, int line,
-                        EntryState state) {
+template <typename Func>
+void ForEachLogLocation(const std::string& location_relative, int line,
+                        Func func) {
   utils::impl::AssertStaticRegistrationFinished();
 
   auto& all_locations = GetAllLocations();
@@ -58,18 +50,52 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
       ThrowUnknownDynamicLogLocation(location_relative, line);
     }
 
-    it_lower->state = state;
+    func(*it_lower);
     return;
   } else {
     for (; it_lower != all_locations.end(); ++it_lower) {
       if (std::strncmp(it_lower->path, location_relative.c_str(),
                        location_relative.size()) != 0)
         break;
-      it_lower->state = state;
+      func(*it_lower);
     }
   }
 }
 
+struct RateLimitsStorage {
+  std::mutex mutex;
+  std::unordered_map<LogEntryContent*, utils::TokenBucket> buckets;
+};
+
+RateLimitsStorage& GetRateLimitsStorage() noexcept {
+  static RateLimitsStorage storage;
+  return storage;
+}
+
+utils::TokenBucket::RefillPolicy MakeRefillPolicy(DynamicLogRateLimit limit) {
+  using Duration = utils::TokenBucket::Duration;
+  const Duration interval = limit.interval;
+  if (limit.max_logs == 0) return {0, interval};
+  return {1, interval / static_cast<Duration::rep>(limit.max_logs)};
+}
+
+}  // namespace
+
+bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+  const auto cmp = std::strcmp(x.path, y.path);
+  return cmp < 0 || (cmp == 0 && x.line < y.line);
+}
+
+bool operator==(const LogEntryContent& x, const LogEntryContent& y) noexcept {
+  return x.line == y.line && std::strcmp(x.path, y.path) == 0;
+}
+
+void AddDynamicDebugLog(const std::string& location_relative, int line,
+                        EntryState state) {
+  ForEachLogLocation(location_relative, line,
+                     [state](LogEntryContent& entry) { entry.state = state; });
+}
+
 void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
   utils::impl::AssertStaticRegistrationFinished();
   auto& all_locations = GetAllLocations();
@@ -84,6 +110,33 @@ void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
   }
 }
 
+void SetDynamicLogRateLimit(const std::string& location_relative, int line,
+                            DynamicLogRateLimit limit) {
+  auto& storage = GetRateLimitsStorage();
+  const std::lock_guard lock{storage.mutex};
+
+  ForEachLogLocation(
+      location_relative, line, [&storage, limit](LogEntryContent& entry) {
+        const auto policy = MakeRefillPolicy(limit);
+        auto [it, inserted] =
+            storage.buckets.try_emplace(&entry, limit.max_logs, policy);
+        if (!inserted) {
+          it->second.SetMaxSize(limit.max_logs);
+          it->second.SetRefillPolicy(policy);
+        }
+        entry.rate_limit = &it->second;
+      });
+}
+
+void RemoveDynamicLogRateLimits() {
+  auto& storage = GetRateLimitsStorage();
+  const std::lock_guard lock{storage.mutex};
+
+  for (auto& [entry, bucket] : storage.buckets) {
+    entry->rate_limit = nullptr;
+  }
+}
+
 const LogEntryContentSet& GetDynamicDebugLocations() {
   utils::impl::AssertStaticRegistrationFinished();
   return GetAllLocations();
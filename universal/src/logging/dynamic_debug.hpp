@@ -1,12 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
 #include <boost/intrusive/set_hook.hpp>
 
 #include <userver/logging/log.hpp>
+#include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -33,6 +36,14 @@ struct LogEntryContent {
   const int line;
   const char* const path;
   LogEntryContentHook hook;
+  std::atomic<utils::TokenBucket*> rate_limit{nullptr};
+};
+
+/// At most `max_logs` logs per `interval` from a location, the tokens are
+/// refilled evenly over the interval
+struct DynamicLogRateLimit {
+  std::size_t max_logs{0};
+  std::chrono::milliseconds interval{0};
 };
 
 bool operator<(const LogEntryContent& x, const LogEntryContent& y) noexcept;
@@ -53,6 +64,13 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
 
 void RemoveDynamicDebugLog(const std::string& location_relative, int line);
 
+/// The token buckets are never freed, so the logging threads may use them
+/// without synchronization while the limits are being changed.
+void SetDynamicLogRateLimit(const std::string& location_relative, int line,
+                            DynamicLogRateLimit limit);
+
+void RemoveDynamicLogRateLimits();
+
 const LogEntryContentSet& GetDynamicDebugLocations();
 
 void RegisterLogLocation(LogEntryContent& location);
@@ -0,0 +1,110 @@
+#include <userver/logging/impl/binary_format.hpp>
+
+#include <array>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+namespace {
+
+// The ids are written into the logs, so the keys may only be appended.
+constexpr std::array<std::string_view, 24> kInternedKeys{
+    "module",           "task_id",          "thread_id",
+    "text",             "trace_id",         "span_id",
+    "parent_id",        "link",             "parent_link",
+    "stopwatch_name",   "total_time",       "stopwatch_units",
+    "start_timestamp",  "_type",            "meta_type",
+    "meta_code",        "method",           "http.url",
+    "error",            "error_msg",        "attempts",
+    "max_attempts",     "timeout_ms",       "stacktrace",
+};
+
+[[noreturn]] void ThrowMalformed(std::string_view reason) {
+  throw std::runtime_error(
+      fmt::format("Malformed binary log record: {}", reason));
+}
+
+std::uint64_t ReadVarint(std::string_view& data) {
+  std::uint64_t result = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (data.empty()) ThrowMalformed("truncated varint");
+    const auto byte = static_cast<unsigned char>(data.front());
+    data.remove_prefix(1);
+    result |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return result;
+  }
+  ThrowMalformed("too long varint");
+}
+
+std::string_view ReadString(std::string_view& data) {
+  const auto size = ReadVarint(data);
+  if (size > data.size()) ThrowMalformed("truncated string");
+  const auto result = data.substr(0, size);
+  data.remove_prefix(size);
+  return result;
+}
+
+}  // namespace
+
+std::uint64_t FindInternedKey(std::string_view key) noexcept {
+  for (std::size_t i = 0; i < kInternedKeys.size(); ++i) {
+    if (kInternedKeys[i] == key) return i + 1;
+  }
+  return kInlineKeyId;
+}
+
+std::string_view GetInternedKey(std::uint64_t key_id) {
+  if (key_id == kInlineKeyId || key_id > kInternedKeys.size()) {
+    ThrowMalformed(fmt::format("unknown key id {}", key_id));
+  }
+  return kInternedKeys[key_id - 1];
+}
+
+std::optional<std::size_t> GetRecordSize(std::string_view data) {
+  if (data.empty()) return std::nullopt;
+  if (data.front() != kRecordMarker) ThrowMalformed("no record marker");
+  if (data.size() < kRecordHeaderSize) return std::nullopt;
+
+  std::uint32_t length = 0;
+  for (std::size_t i = kRecordHeaderSize - 1; i > 0; --i) {
+    length = (length << 8) | static_cast<unsigned char>(data[i]);
+  }
+  return kRecordHeaderSize + length;
+}
+
+void ParseRecord(std::string_view& data, Record& record) {
+  const auto record_size = GetRecordSize(data);
+  if (!record_size || *record_size > data.size()) {
+    ThrowMalformed("truncated record");
+  }
+  auto body = data.substr(kRecordHeaderSize, *record_size - kRecordHeaderSize);
+
+  record.timestamp = std::chrono::system_clock::time_point{
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::microseconds{ReadVarint(body)})};
+  if (body.empty()) ThrowMalformed("no level");
+  const auto level = static_cast<unsigned char>(body.front());
+  if (level > static_cast<unsigned char>(Level::kNone)) {
+    ThrowMalformed(fmt::format("unknown level {}", level));
+  }
+  record.level = static_cast<Level>(level);
+  body.remove_prefix(1);
+
+  record.tags.clear();
+  while (!body.empty()) {
+    const auto key_id = ReadVarint(body);
+    const auto key =
+        key_id == kInlineKeyId ? ReadString(body) : GetInternedKey(key_id);
+    record.tags.emplace_back(key, ReadString(body));
+  }
+
+  data.remove_prefix(*record_size);
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
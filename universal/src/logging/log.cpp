@@ -151,7 +151,13 @@ bool StaticLogEntry::ShouldNotLog(logging::LoggerRef logger,
   const bool force_disabled =
       level < Level::kWarning && state == EntryState::kForceDisabled;
   const bool force_enabled = state == EntryState::kForceEnabled;
-  return (!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled;
+  if ((!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled) {
+    return true;
+  }
+
+  // The tokens are spent only by the logs that would be written otherwise
+  auto* const rate_limit = content.rate_limit.load(std::memory_order_acquire);
+  return rate_limit && !rate_limit->Obtain();
 }
 
 bool StaticLogEntry::ShouldNotLog(const logging::LoggerPtr& logger,
@@ -1,10 +1,14 @@
 #include "log_helper_impl.hpp"
 
+#include <cstring>
+#include <limits>
+
 #include <fmt/chrono.h>
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <userver/compiler/impl/constexpr.hpp>
+#include <userver/logging/impl/binary_format.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/tskv.hpp>
@@ -19,6 +23,7 @@ char GetSeparatorFromLogger(LoggerRef logger) {
   switch (logger.GetFormat()) {
     case Format::kTskv:
     case Format::kRaw:
+    case Format::kBinary:
       return '=';
     case Format::kLtsv:
       return ':';
@@ -55,6 +60,30 @@ std::string_view GetCurrentTimeString(TimePoint now) noexcept {
   return {cached_time_string, kTemplate.size()};
 }
 
+// Unsigned LEB128
+std::size_t GetVarintSize(std::uint64_t value) noexcept {
+  std::size_t size = 1;
+  for (; value >= 0x80; value >>= 7) ++size;
+  return size;
+}
+
+void WriteVarint(char* destination, std::uint64_t value) noexcept {
+  for (; value >= 0x80; value >>= 7) {
+    *(destination++) = static_cast<char>((value & 0x7f) | 0x80);
+  }
+  *destination = static_cast<char>(value);
+}
+
+void AppendVarint(LogBuffer& buffer, std::uint64_t value) {
+  const auto old_size = buffer.size();
+  buffer.resize(old_size + GetVarintSize(value));
+  WriteVarint(buffer.data() + old_size, value);
+}
+
+// Most of the values fit into the reserved 2 bytes of a non-minimal varint.
+constexpr std::size_t kReservedValueSize = 2;
+constexpr std::size_t kMaxReservedValueSize = (1 << 14) - 1;
+
 }  // namespace
 
 auto LogHelper::Impl::BufferStd::overflow(int_type c) -> int_type {
@@ -72,7 +101,8 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(*logger_)),
+      is_binary_(logger_->GetFormat() == Format::kBinary) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
                 "8KB memory in allocator.");
@@ -111,14 +141,39 @@ void LogHelper::Impl::PutMessageBegin() {
       msg_.append(std::string_view{"tskv"});
       return;
     }
+    case Format::kBinary: {
+      const auto now = TimePoint::clock::now();
+      msg_.push_back(impl::binary::kRecordMarker);
+      // The length is written in PutMessageEnd
+      msg_.resize(impl::binary::kRecordHeaderSize);
+      AppendVarint(msg_, std::chrono::duration_cast<std::chrono::microseconds>(
+                             now.time_since_epoch())
+                             .count());
+      msg_.push_back(static_cast<char>(level_));
+      return;
+    }
   }
   UASSERT_MSG(false, "Invalid value of Format enum");
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void LogHelper::Impl::PutMessageEnd() {
+  if (!is_binary_) {
+    msg_.push_back('\n');
+    return;
+  }
+
+  const auto length = msg_.size() - impl::binary::kRecordHeaderSize;
+  UINVARIANT(length <= std::numeric_limits<std::uint32_t>::max(),
+             "Too long binary log record");
+  for (std::size_t i = 1; i < impl::binary::kRecordHeaderSize; ++i) {
+    msg_[i] = static_cast<char>((length >> (8 * (i - 1))) & 0xff);
+  }
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
-  if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+  if (is_binary_) {
+    PutBinaryKey(key);
+  } else if (!utils::encoding::ShouldKeyBeEscaped(key)) {
     PutRawKey(key);
   } else {
     UASSERT(!std::exchange(is_within_value_, true));
@@ -131,6 +186,11 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 }
 
 void LogHelper::Impl::PutRawKey(std::string_view key) {
+  if (is_binary_) {
+    PutBinaryKey(key);
+    return;
+  }
+
   UASSERT(!std::exchange(is_within_value_, true));
   CheckRepeatedKeys(key);
   const auto old_size = msg_.size();
@@ -145,12 +205,20 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    msg_.append(value);
+    return;
+  }
   utils::encoding::EncodeTskv(msg_, value,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    msg_.push_back(text_part);
+    return;
+  }
   utils::encoding::EncodeTskv(fmt::appender(msg_), text_part,
                               utils::encoding::EncodeTskvMode::kValue);
 }
@@ -160,8 +228,9 @@ LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
   return msg_;
 }
 
-void LogHelper::Impl::MarkValueEnd() noexcept {
+void LogHelper::Impl::MarkValueEnd() {
   UASSERT(std::exchange(is_within_value_, false));
+  if (is_binary_) PutBinaryValueSize();
 }
 
 void LogHelper::Impl::StartText() {
@@ -191,6 +260,38 @@ void LogHelper::Impl::MarkAsBroken() noexcept { logger_ = nullptr; }
 
 bool LogHelper::Impl::IsBroken() const noexcept { return !logger_; }
 
+void LogHelper::Impl::PutBinaryKey(std::string_view key) {
+  UASSERT(!std::exchange(is_within_value_, true));
+  CheckRepeatedKeys(key);
+
+  const auto key_id = impl::binary::FindInternedKey(key);
+  AppendVarint(msg_, key_id);
+  if (key_id == impl::binary::kInlineKeyId) {
+    AppendVarint(msg_, key.size());
+    msg_.append(key);
+  }
+
+  msg_.resize(msg_.size() + kReservedValueSize);
+  value_begin_ = msg_.size();
+}
+
+void LogHelper::Impl::PutBinaryValueSize() {
+  const auto size = msg_.size() - value_begin_;
+  auto* const reserved = msg_.data() + value_begin_ - kReservedValueSize;
+  if (size <= kMaxReservedValueSize) {
+    reserved[0] = static_cast<char>((size & 0x7f) | 0x80);
+    reserved[1] = static_cast<char>(size >> 7);
+    return;
+  }
+
+  // Rare long values are moved to make room for the longer varint
+  const auto extra_size = GetVarintSize(size) - kReservedValueSize;
+  msg_.resize(msg_.size() + extra_size);
+  auto* const value = msg_.data() + value_begin_;
+  std::memmove(value + extra_size, value, size);
+  WriteVarint(value - kReservedValueSize, size);
+}
+
 void LogHelper::Impl::CheckRepeatedKeys(
     [[maybe_unused]] std::string_view raw_key) {
   UASSERT_MSG(debug_tag_keys_->insert(std::string{raw_key}).second,
@@ -38,7 +38,7 @@ class LogHelper::Impl final {
   LogBuffer& GetBufferForRawValuePart() noexcept;
 
   bool IsWithinValue() const noexcept { return is_within_value_; }
-  void MarkValueEnd() noexcept;
+  void MarkValueEnd();
 
   LogExtra& GetLogExtra() { return extra_; }
 
@@ -78,13 +78,19 @@ class LogHelper::Impl final {
 
   void CheckRepeatedKeys(std::string_view raw_key);
 
+  void PutBinaryKey(std::string_view key);
+  void PutBinaryValueSize();
+
   impl::LoggerBase* logger_;
   const Level level_;
   const char key_value_separator_;
+  const bool is_binary_;
   LogBuffer msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
   std::size_t initial_length_{0};
+  // Start of the current value for Format::kBinary
+  std::size_t value_begin_{0};
   bool is_within_value_{false};
   std::optional<std::unordered_set<std::string>> debug_tag_keys_;
 };
@@ -21,6 +21,11 @@ std::atomic<bool>& AtomicLogLimited() noexcept {
   return enabled;
 }
 
+std::atomic<Level>& AtomicNotSampledLogLevel() noexcept {
+  static std::atomic<Level> level{Level::kTrace};
+  return level;
+}
+
 }  // namespace
 
 void SetLogLimitedEnable(bool enable) noexcept { AtomicLogLimited() = enable; }
@@ -35,6 +40,14 @@ std::chrono::steady_clock::duration GetLogLimitedInterval() noexcept {
   return AtomicLogLimitedDuration().load();
 }
 
+void SetNotSampledLogLevel(Level level) noexcept {
+  AtomicNotSampledLogLevel() = level;
+}
+
+Level GetNotSampledLogLevel() noexcept {
+  return AtomicNotSampledLogLevel().load(std::memory_order_relaxed);
+}
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <chrono>
 
+#include <userver/logging/level.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -14,6 +16,11 @@ void SetLogLimitedInterval(std::chrono::steady_clock::duration d) noexcept;
 
 std::chrono::steady_clock::duration GetLogLimitedInterval() noexcept;
 
+/// The logs below the level are skipped in the spans that are not sampled,
+/// see tracing::Span::IsSampled
+void SetNotSampledLogLevel(Level level) noexcept;
+Level GetNotSampledLogLevel() noexcept;
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
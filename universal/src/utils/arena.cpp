@@ -0,0 +1,142 @@
+#include <userver/utils/arena.hpp>
+
+#include <cstdint>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+char* AlignUp(char* ptr, std::size_t alignment) noexcept {
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+  const auto aligned = (address + alignment - 1) & ~(alignment - 1);
+  return ptr + (aligned - address);
+}
+
+}  // namespace
+
+ArenaBlockPool::ArenaBlockPool(std::size_t block_size,
+                               std::size_t max_free_blocks)
+    : block_size_(block_size), max_free_blocks_(max_free_blocks) {
+  UASSERT(block_size_ > 0);
+  // Release() never reallocates
+  free_blocks_.reserve(max_free_blocks_);
+}
+
+ArenaBlockPool::~ArenaBlockPool() = default;
+
+std::unique_ptr<char[]> ArenaBlockPool::Acquire() {
+  {
+    std::lock_guard lock(mutex_);
+    if (!free_blocks_.empty()) {
+      auto block = std::move(free_blocks_.back());
+      free_blocks_.pop_back();
+      return block;
+    }
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  return std::unique_ptr<char[]>(new char[block_size_]);
+}
+
+void ArenaBlockPool::Release(
+    std::vector<std::unique_ptr<char[]>>&& blocks) noexcept {
+  {
+    std::lock_guard lock(mutex_);
+    for (auto& block : blocks) {
+      if (free_blocks_.size() >= max_free_blocks_) break;
+      free_blocks_.push_back(std::move(block));
+    }
+  }
+  // the rest of the blocks are freed outside of the lock
+  blocks.clear();
+}
+
+std::size_t ArenaBlockPool::GetFreeBlocksCount() const {
+  std::lock_guard lock(mutex_);
+  return free_blocks_.size();
+}
+
+Arena::Arena(std::size_t block_size) : block_size_(block_size) {
+  UASSERT(block_size_ > 0);
+}
+
+Arena::Arena(ArenaBlockPool& pool)
+    : block_size_(pool.GetBlockSize()), pool_(&pool) {}
+
+Arena::~Arena() {
+  if (pool_) pool_->Release(std::move(blocks_));
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+  UASSERT_MSG(alignment && !(alignment & (alignment - 1)),
+              "alignment must be a power of 2");
+  UASSERT(alignment <= alignof(std::max_align_t));
+
+  if (current_) {
+    auto* ptr = AlignUp(current_, alignment);
+    if (ptr <= end_ && static_cast<std::size_t>(end_ - ptr) >= size) {
+      current_ = ptr + size;
+      return ptr;
+    }
+  }
+
+  // Big allocations get a block of their own, the current one is kept for
+  // the small ones
+  if (size > block_size_ / 4) return AllocateBlock(size);
+
+  current_ = AllocateBlock(block_size_);
+  end_ = current_ + block_size_;
+  auto* ptr = current_;
+  current_ += size;
+  return ptr;
+}
+
+void Arena::Deallocate(void* ptr, std::size_t size) noexcept {
+  if (current_ && static_cast<char*>(ptr) + size == current_) {
+    current_ = static_cast<char*>(ptr);
+  }
+}
+
+char* Arena::AllocateBlock(std::size_t size) {
+  // operator new[] returns memory aligned for any fundamental type
+  auto& blocks = (size == block_size_ ? blocks_ : big_blocks_);
+  blocks.reserve(blocks.size() + 1);
+  if (pool_ && size == block_size_) {
+    blocks.push_back(pool_->Acquire());
+  } else {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    blocks.emplace_back(new char[size]);
+  }
+  allocated_bytes_ += size;
+  return blocks.back().get();
+}
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes,
+                                       std::size_t alignment) {
+  if (alignment <= alignof(std::max_align_t)) {
+    return arena_->Allocate(bytes, alignment);
+  }
+  // over-aligned types are rare, the padding is wasted
+  auto* ptr = static_cast<char*>(
+      arena_->Allocate(bytes + alignment, alignof(std::max_align_t)));
+  return AlignUp(ptr, alignment);
+}
+
+void ArenaMemoryResource::do_deallocate(void* ptr, std::size_t bytes,
+                                        std::size_t alignment) {
+  if (alignment <= alignof(std::max_align_t)) {
+    arena_->Deallocate(ptr, bytes);
+  }
+}
+
+bool ArenaMemoryResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <userver/utils/arena.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Arena, Sample) {
+  /// [Sample Arena]
+  utils::Arena arena;
+  using ArenaString =
+      std::basic_string<char, std::char_traits<char>,
+                        utils::ArenaAllocator<char>>;
+
+  std::vector<ArenaString, utils::ArenaAllocator<ArenaString>> values{
+      utils::ArenaAllocator<ArenaString>{arena}};
+  for (int i = 0; i < 10; ++i) {
+    values.emplace_back(100, 'a', utils::ArenaAllocator<char>{arena});
+  }
+  // All the memory is freed at once by the arena destructor
+  /// [Sample Arena]
+
+  EXPECT_EQ(std::string_view{values.back()}, std::string(100, 'a'));
+  EXPECT_EQ(arena.GetAllocatedBytes(), utils::Arena::kDefaultBlockSize);
+}
+
+TEST(Arena, Alignment) {
+  utils::Arena arena{64};
+  EXPECT_NE(arena.Allocate(1, 1), nullptr);
+  for (const std::size_t alignment :
+       {std::size_t{2}, std::size_t{4}, std::size_t{8},
+        alignof(std::max_align_t)}) {
+    const auto address =
+        reinterpret_cast<std::uintptr_t>(arena.Allocate(1, alignment));
+    EXPECT_EQ(address % alignment, 0);
+  }
+}
+
+TEST(Arena, DeallocateLast) {
+  utils::Arena arena{64};
+  auto* first = arena.Allocate(8, 1);
+  auto* second = arena.Allocate(8, 1);
+
+  // Only the last allocation is given back
+  arena.Deallocate(first, 8);
+  EXPECT_NE(arena.Allocate(8, 1), first);
+
+  auto* third = arena.Allocate(8, 1);
+  arena.Deallocate(third, 8);
+  EXPECT_EQ(arena.Allocate(8, 1), third);
+  EXPECT_NE(second, third);
+}
+
+TEST(Arena, BigAllocations) {
+  utils::Arena arena{64};
+  auto* small = arena.Allocate(8, 1);
+  EXPECT_EQ(arena.GetAllocatedBytes(), 64);
+
+  EXPECT_NE(arena.Allocate(1000, 1), nullptr);
+  EXPECT_EQ(arena.GetAllocatedBytes(), 64 + 1000);
+
+  // The current block is still used for the small allocations
+  EXPECT_EQ(arena.Allocate(8, 1), static_cast<char*>(small) + 8);
+}
+
+TEST(Arena, BlockPool) {
+  utils::ArenaBlockPool pool{64, 2};
+  {
+    utils::Arena arena{pool};
+    for (int i = 0; i < 12; ++i) arena.Allocate(16, 1);
+    arena.Allocate(1000, 1);
+    EXPECT_EQ(arena.GetAllocatedBytes(), 64 * 3 + 1000);
+  }
+  // Only the blocks of the pool size are kept, up to the limit
+  EXPECT_EQ(pool.GetFreeBlocksCount(), 2);
+
+  utils::Arena arena{pool};
+  EXPECT_NE(arena.Allocate(8, 1), nullptr);
+  EXPECT_EQ(pool.GetFreeBlocksCount(), 1);
+}
+
+TEST(Arena, BlockPoolOtherThread) {
+  utils::ArenaBlockPool pool{64, 16};
+  auto arena = std::make_unique<utils::Arena>(pool);
+  for (int i = 0; i < 8; ++i) arena->Allocate(16, 1);
+
+  // The blocks are given back to the pool and not to the heap of the thread
+  std::thread([&arena] { arena.reset(); }).join();
+  EXPECT_EQ(pool.GetFreeBlocksCount(), 2);
+}
+
+TEST(Arena, MemoryResource) {
+  /// [Sample ArenaMemoryResource]
+  utils::Arena arena;
+  utils::ArenaMemoryResource resource{arena};
+
+  std::pmr::vector<std::pmr::string> values{&resource};
+  for (int i = 0; i < 10; ++i) values.emplace_back(100, 'a');
+  /// [Sample ArenaMemoryResource]
+
+  EXPECT_EQ(std::string_view{values.back()}, std::string(100, 'a'));
+  EXPECT_EQ(values.back().get_allocator().resource(), &resource);
+  EXPECT_GT(arena.GetAllocatedBytes(), 0);
+
+  struct alignas(64) OverAligned {
+    char data[64];
+  };
+  std::pmr::polymorphic_allocator<OverAligned> allocator{&resource};
+  auto* ptr = allocator.allocate(1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0);
+  allocator.deallocate(ptr, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -10,8 +10,11 @@
 #include <boost/lexical_cast.hpp>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/mock_now.hpp>
 
+#include <utils/datetime/rfc3339_impl.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::datetime {
@@ -44,6 +47,17 @@ const cctz::time_zone& GetLocalTimezone() {
   return kLocalTz;
 }
 
+bool IsUtc(const std::string& timezone) { return timezone == "UTC"; }
+
+std::optional<std::chrono::system_clock::time_point> FastUtcStringtime(
+    const std::string& timestring, const std::string& format) {
+  const auto fixed_format = impl::GetFixedFormat(format);
+  if (!fixed_format) return {};
+  const auto parsed = impl::ParseUtc(timestring, *fixed_format);
+  if (!parsed) return {};
+  return impl::ToTimePoint(*parsed);
+}
+
 std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
     const std::string& timestring, const cctz::time_zone& timezone,
     const std::string& format) {
@@ -104,6 +118,12 @@ bool IsTimeBetween(int hour, int min, int hour_from, int min_from, int hour_to,
 
 std::string Timestring(std::chrono::system_clock::time_point tp,
                        const std::string& timezone, const std::string& format) {
+  if (IsUtc(timezone)) {
+    if (const auto fixed_format = impl::GetFixedFormat(format)) {
+      auto result = impl::FormatUtc(tp, *fixed_format);
+      if (result) return std::move(*result);
+    }
+  }
   return cctz::format(format, tp, GetTimezone(timezone));
 }
 
@@ -127,6 +147,9 @@ std::string LocalTimezoneTimestring(time_t timestamp,
 std::chrono::system_clock::time_point Stringtime(const std::string& timestring,
                                                  const std::string& timezone,
                                                  const std::string& format) {
+  if (IsUtc(timezone)) {
+    if (const auto tp = FastUtcStringtime(timestring, format)) return *tp;
+  }
   const auto optional_tp =
       OptionalStringtime(timestring, GetTimezone(timezone), format);
   if (!optional_tp) {
@@ -147,6 +170,12 @@ std::chrono::system_clock::time_point LocalTimezoneStringtime(
 
 std::chrono::system_clock::time_point GuessStringtime(
     const std::string& timestamp, const std::string& timezone) {
+  if (IsUtc(timezone)) {
+    // same as the first format of DoGuessStringtime, that accepts "Z" too
+    if (const auto tp = FastUtcStringtime(timestamp, kRfc3339Format)) {
+      return *tp;
+    }
+  }
   return DoGuessStringtime(timestamp, GetTimezone(timezone));
 }
 
@@ -220,6 +249,12 @@ std::chrono::steady_clock::time_point SteadyNow() noexcept {
   return MockSteadyNow();
 }
 
+std::chrono::steady_clock::time_point SteadyCoarseNow() noexcept {
+  if (IsMockNow()) return MockSteadyNow();
+  return std::chrono::steady_clock::time_point{
+      SteadyCoarseClock::now().time_since_epoch()};
+}
+
 std::chrono::system_clock::time_point Now() noexcept { return MockNow(); }
 
 std::chrono::system_clock::time_point Epoch() noexcept {
@@ -230,6 +265,11 @@ std::chrono::system_clock::time_point Epoch() noexcept {
 std::string TimestampToString(const time_t timestamp) {
   static constexpr size_t kStringLen = 24;  // "YYYY-MM-DDTHH:MM:SS+0000"
 
+  if (const auto tp = impl::ToTimePoint({timestamp, 0})) {
+    auto result = impl::FormatUtc(*tp, impl::FixedFormat::kDefault);
+    if (result) return std::move(*result);
+  }
+
   std::tm ptm{};
   gmtime_r(&timestamp, &ptm);
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
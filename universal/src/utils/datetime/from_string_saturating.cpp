@@ -4,6 +4,8 @@
 
 #include <userver/utils/datetime.hpp>
 
+#include <utils/datetime/rfc3339_impl.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::datetime {
@@ -33,6 +35,21 @@ std::chrono::system_clock::time_point FromStringSaturating(
 
   constexpr cctz::time_point<Days> kTaxiInfinity{DaysBetweenYears(1970, 10000)};
 
+  if (const auto fixed_format = impl::GetFixedFormat(format)) {
+    if (const auto parsed = impl::ParseUtc(timestring, *fixed_format)) {
+      const std::chrono::seconds seconds{parsed->seconds};
+      if (seconds >= kTaxiInfinity.time_since_epoch() ||
+          seconds > std::chrono::duration_cast<std::chrono::seconds>(
+                        SystemClock::duration::max())) {
+        return SystemClock::time_point::max();
+      }
+      return SystemClock::time_point{
+          std::chrono::duration_cast<SystemClock::duration>(seconds) +
+          std::chrono::duration_cast<SystemClock::duration>(
+              std::chrono::nanoseconds{parsed->nanoseconds})};
+    }
+  }
+
   // reimplement cctz::parse() because we cannot distinguish overflow otherwise
   cctz::time_point<cctz::seconds> tp_seconds;
   cctz::detail::femtoseconds femtoseconds;
@@ -0,0 +1,340 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <cstring>
+
+#include <userver/compiler/impl/constexpr.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <utils/datetime/rfc3339_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime {
+
+namespace impl {
+
+namespace {
+
+using SystemClock = std::chrono::system_clock;
+
+constexpr std::int64_t kSecondsPerDay = 24 * 60 * 60;
+
+constexpr std::int64_t FloorDiv(std::int64_t value, std::int64_t divisor) {
+  return value / divisor - (value % divisor < 0 ? 1 : 0);
+}
+
+// https://howardhinnant.github.io/date_algorithms.html#days_from_civil
+constexpr std::int64_t DaysFromCivil(std::int64_t year, unsigned month,
+                                     unsigned day) noexcept {
+  year -= month <= 2 ? 1 : 0;
+  const auto era = FloorDiv(year, 400);
+  const auto year_of_era = year - era * 400;
+  const auto day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 +
+                           day - 1;
+  const auto day_of_era = year_of_era * 365 + year_of_era / 4 -
+                          year_of_era / 100 + day_of_year;
+  return era * 146097 + day_of_era - 719468;
+}
+
+struct CivilDate {
+  std::int64_t year;
+  unsigned month;
+  unsigned day;
+};
+
+// https://howardhinnant.github.io/date_algorithms.html#civil_from_days
+constexpr CivilDate CivilFromDays(std::int64_t days) noexcept {
+  days += 719468;
+  const auto era = FloorDiv(days, 146097);
+  const auto day_of_era = days - era * 146097;
+  const auto year_of_era = (day_of_era - day_of_era / 1460 +
+                            day_of_era / 36524 - day_of_era / 146096) /
+                           365;
+  const auto day_of_year =
+      day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto month_index = (5 * day_of_year + 2) / 153;
+  const auto day = static_cast<unsigned>(day_of_year -
+                                         (153 * month_index + 2) / 5 + 1);
+  const auto month = static_cast<unsigned>(
+      month_index < 10 ? month_index + 3 : month_index - 9);
+  return {year_of_era + era * 400 + (month <= 2 ? 1 : 0), month, day};
+}
+
+// 0000-01-01T00:00:00 and 10000-01-01T00:00:00, the range of 4-digit years
+constexpr std::int64_t kMinSeconds = DaysFromCivil(0, 1, 1) * kSecondsPerDay;
+constexpr std::int64_t kMaxSeconds =
+    DaysFromCivil(10000, 1, 1) * kSecondsPerDay;
+static_assert(kMinSeconds == -62167219200);
+static_assert(CivilFromDays(DaysFromCivil(2000, 2, 29)).day == 29);
+
+constexpr unsigned DaysInMonth(unsigned year, unsigned month) noexcept {
+  if (month == 2) {
+    const bool is_leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    return is_leap ? 29 : 28;
+  }
+  return month == 4 || month == 6 || month == 9 || month == 11 ? 30 : 31;
+}
+
+constexpr std::string_view kDateTimeTemplate = "0000-00-00T00:00:00";
+
+void WriteTwoDigits(char* out, unsigned value) noexcept {
+  out[0] = static_cast<char>('0' + value / 10);
+  out[1] = static_cast<char>('0' + value % 10);
+}
+
+// Returns the decimal digits of `value` < 10^8 as bytes with values 0..9,
+// the first digit in the lowest byte, converting all of them at once (SWAR)
+constexpr std::uint64_t GetEightDigits(std::uint32_t value) noexcept {
+  // 4-digit halves in the 32-bit lanes
+  const std::uint64_t halves =
+      (value / 10000) | (static_cast<std::uint64_t>(value % 10000) << 32);
+  // 2-digit quarters in the 16-bit lanes, x * 10486 >> 20 == x / 100
+  const std::uint64_t high_quarters =
+      ((halves * 10486) >> 20) & 0x0000007F0000007F;
+  const std::uint64_t quarters =
+      high_quarters | ((halves - 100 * high_quarters) << 16);
+  // digits in the bytes, x * 103 >> 10 == x / 10
+  const std::uint64_t tens = ((quarters * 103) >> 10) & 0x000F000F000F000F;
+  return tens | ((quarters - 10 * tens) << 8);
+}
+
+static_assert(GetEightDigits(12345678) == 0x0807060504030201);
+static_assert(GetEightDigits(90) == 0x0009000000000000);
+
+char* WriteDigits(char* out, std::uint64_t digits, int count) noexcept {
+  for (int i = 0; i < count; ++i) {
+    out[i] = static_cast<char>('0' + ((digits >> (8 * i)) & 0xFF));
+  }
+  return out + count;
+}
+
+// ".123456789" without the trailing zeros, nothing for 0, like %E*S
+char* WriteTrimmedFraction(char* out, std::uint32_t nanoseconds) noexcept {
+  if (nanoseconds == 0) return out;
+  *out++ = '.';
+  *out++ = static_cast<char>('0' + nanoseconds / 100'000'000);
+  const auto digits = GetEightDigits(nanoseconds % 100'000'000);
+  if (digits == 0) return out;
+  return WriteDigits(out, digits, 8 - __builtin_clzll(digits) / 8);
+}
+
+// ".123456", like %E6S
+char* WriteMicroseconds(char* out, std::uint32_t nanoseconds) noexcept {
+  *out++ = '.';
+  return WriteDigits(out, GetEightDigits(nanoseconds / 1000) >> 16, 6);
+}
+
+// Returns "YYYY-MM-DDTHH:MM:SS" of `seconds`, without the terminating zero
+const char* GetDateTime(std::int64_t seconds) noexcept {
+  // kMaxSeconds is never formatted, so the initial cache is always invalid
+  thread_local USERVER_IMPL_CONSTINIT std::int64_t cached_seconds =
+      kMaxSeconds;
+  thread_local USERVER_IMPL_CONSTINIT char
+      cached_date_time[kDateTimeTemplate.size()]{};
+
+  if (seconds != cached_seconds) {
+    const auto days = FloorDiv(seconds, kSecondsPerDay);
+    const auto time = static_cast<unsigned>(seconds - days * kSecondsPerDay);
+    const auto date = CivilFromDays(days);
+
+    char* out = cached_date_time;
+    WriteTwoDigits(out, static_cast<unsigned>(date.year / 100));
+    WriteTwoDigits(out + 2, static_cast<unsigned>(date.year % 100));
+    out[4] = '-';
+    WriteTwoDigits(out + 5, date.month);
+    out[7] = '-';
+    WriteTwoDigits(out + 8, date.day);
+    out[10] = 'T';
+    WriteTwoDigits(out + 11, time / 3600);
+    out[13] = ':';
+    WriteTwoDigits(out + 14, time / 60 % 60);
+    out[16] = ':';
+    WriteTwoDigits(out + 17, time % 60);
+    cached_seconds = seconds;
+  }
+  return cached_date_time;
+}
+
+constexpr bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+bool ParseDigits(std::string_view str, std::size_t position, std::size_t count,
+                 unsigned& value) noexcept {
+  value = 0;
+  for (std::size_t i = position; i < position + count; ++i) {
+    if (!IsDigit(str[i])) return false;
+    value = value * 10 + (str[i] - '0');
+  }
+  return true;
+}
+
+// Parses "+hh:mm" (%Ez only), "+hhmm" and "Z" of %z and %Ez
+std::optional<std::int64_t> ParseOffset(std::string_view zone,
+                                        FixedFormat format) noexcept {
+  if (zone == "Z") return 0;
+
+  switch (format) {
+    case FixedFormat::kIso:
+    case FixedFormat::kTaximeter:
+      return std::nullopt;
+    case FixedFormat::kRfc3339:
+    case FixedFormat::kDefault:
+      break;
+  }
+  if (zone == "z") return 0;
+  if (zone.empty() || (zone[0] != '+' && zone[0] != '-')) return std::nullopt;
+
+  unsigned hours = 0;
+  unsigned minutes = 0;
+  if (zone.size() == 5) {
+    if (!ParseDigits(zone, 1, 2, hours) || !ParseDigits(zone, 3, 2, minutes)) {
+      return std::nullopt;
+    }
+  } else if (zone.size() == 6 && format == FixedFormat::kRfc3339 &&
+             zone[3] == ':') {
+    if (!ParseDigits(zone, 1, 2, hours) || !ParseDigits(zone, 4, 2, minutes)) {
+      return std::nullopt;
+    }
+  } else {
+    return std::nullopt;
+  }
+  if (hours > 23 || minutes > 59) return std::nullopt;
+
+  const std::int64_t offset = hours * 3600 + minutes * 60;
+  return zone[0] == '-' ? -offset : offset;
+}
+
+}  // namespace
+
+std::optional<FixedFormat> GetFixedFormat(std::string_view format) noexcept {
+  if (format == kRfc3339Format) return FixedFormat::kRfc3339;
+  if (format == kDefaultFormat) return FixedFormat::kDefault;
+  if (format == kIsoFormat) return FixedFormat::kIso;
+  if (format == kTaximeterFormat) return FixedFormat::kTaximeter;
+  return std::nullopt;
+}
+
+std::optional<std::string> FormatUtc(SystemClock::time_point tp,
+                                     FixedFormat format) {
+  const auto seconds_tp = std::chrono::floor<std::chrono::seconds>(tp);
+  const std::int64_t seconds = seconds_tp.time_since_epoch().count();
+  if (seconds < kMinSeconds || seconds >= kMaxSeconds) return std::nullopt;
+  const auto nanoseconds = static_cast<std::uint32_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(tp - seconds_tp)
+          .count());
+
+  // "YYYY-MM-DDTHH:MM:SS" ".123456789" "+00:00"
+  char buffer[kDateTimeTemplate.size() + 10 + 6];
+  std::memcpy(buffer, GetDateTime(seconds), kDateTimeTemplate.size());
+  char* out = buffer + kDateTimeTemplate.size();
+
+  switch (format) {
+    case FixedFormat::kRfc3339:
+      out = WriteTrimmedFraction(out, nanoseconds);
+      std::memcpy(out, "+00:00", 6);
+      out += 6;
+      break;
+    case FixedFormat::kDefault:
+      out = WriteTrimmedFraction(out, nanoseconds);
+      std::memcpy(out, "+0000", 5);
+      out += 5;
+      break;
+    case FixedFormat::kIso:
+      *out++ = 'Z';
+      break;
+    case FixedFormat::kTaximeter:
+      out = WriteMicroseconds(out, nanoseconds);
+      *out++ = 'Z';
+      break;
+  }
+  return std::string(buffer, out - buffer);
+}
+
+std::optional<ParsedTime> ParseUtc(std::string_view timestring,
+                                   FixedFormat format) noexcept {
+  constexpr auto kDateTimeSize = kDateTimeTemplate.size();
+  if (timestring.size() <= kDateTimeSize) return std::nullopt;
+
+  unsigned year = 0;
+  unsigned month = 0;
+  unsigned day = 0;
+  unsigned hours = 0;
+  unsigned minutes = 0;
+  unsigned seconds = 0;
+  if (!ParseDigits(timestring, 0, 4, year) || timestring[4] != '-' ||
+      !ParseDigits(timestring, 5, 2, month) || timestring[7] != '-' ||
+      !ParseDigits(timestring, 8, 2, day) || timestring[10] != 'T' ||
+      !ParseDigits(timestring, 11, 2, hours) || timestring[13] != ':' ||
+      !ParseDigits(timestring, 14, 2, minutes) || timestring[16] != ':' ||
+      !ParseDigits(timestring, 17, 2, seconds)) {
+    return std::nullopt;
+  }
+  // leap seconds are left to cctz
+  if (month < 1 || month > 12 || day < 1 || day > DaysInMonth(year, month) ||
+      hours > 23 || minutes > 59 || seconds > 59) {
+    return std::nullopt;
+  }
+
+  std::size_t position = kDateTimeSize;
+  std::int64_t nanoseconds = 0;
+  if (timestring[position] == '.' && format != FixedFormat::kIso) {
+    ++position;
+    const auto begin = position;
+    while (position < timestring.size() && position - begin < 9 &&
+           IsDigit(timestring[position])) {
+      nanoseconds = nanoseconds * 10 + (timestring[position] - '0');
+      ++position;
+    }
+    const auto digits = position - begin;
+    if (digits == 0 ||
+        (position < timestring.size() && IsDigit(timestring[position]))) {
+      return std::nullopt;
+    }
+    for (auto i = digits; i < 9; ++i) nanoseconds *= 10;
+  }
+
+  const auto offset = ParseOffset(timestring.substr(position), format);
+  if (!offset) return std::nullopt;
+
+  return ParsedTime{DaysFromCivil(year, month, day) * kSecondsPerDay +
+                        hours * 3600 + minutes * 60 + seconds - *offset,
+                    nanoseconds};
+}
+
+std::optional<SystemClock::time_point> ToTimePoint(ParsedTime parsed) noexcept {
+  using Duration = SystemClock::duration;
+  constexpr auto kMax =
+      std::chrono::duration_cast<std::chrono::seconds>(Duration::max()).count();
+  constexpr auto kMin =
+      std::chrono::duration_cast<std::chrono::seconds>(Duration::min()).count();
+  if (parsed.seconds >= kMax || parsed.seconds <= kMin) {
+    return std::nullopt;
+  }
+
+  return SystemClock::time_point{
+      std::chrono::duration_cast<Duration>(
+          std::chrono::seconds{parsed.seconds}) +
+      std::chrono::duration_cast<Duration>(
+          std::chrono::nanoseconds{parsed.nanoseconds})};
+}
+
+}  // namespace impl
+
+std::string ToRfc3339String(std::chrono::system_clock::time_point tp) {
+  auto result = impl::FormatUtc(tp, impl::FixedFormat::kRfc3339);
+  if (result) return std::move(*result);
+  return Timestring(tp, kDefaultTimezone, kRfc3339Format);
+}
+
+std::chrono::system_clock::time_point FromRfc3339String(
+    std::string_view timestring) {
+  const auto parsed =
+      impl::ParseUtc(timestring, impl::FixedFormat::kRfc3339);
+  if (parsed) {
+    if (const auto tp = impl::ToTimePoint(*parsed)) return *tp;
+  }
+  return Stringtime(std::string{timestring}, kDefaultTimezone, kRfc3339Format);
+}
+
+}  // namespace utils::datetime
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <cctz/time_zone.h>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+// 1000 time points, `step` apart
+std::vector<TimePoint> MakeTimePoints(std::chrono::nanoseconds step) {
+  std::vector<TimePoint> result;
+  TimePoint tp{std::chrono::seconds{1700000000}};
+  for (int i = 0; i < 1000; ++i) {
+    result.push_back(tp);
+    tp += step;
+  }
+  return result;
+}
+
+}  // namespace
+
+void rfc3339_format_cctz(benchmark::State& state) {
+  const auto time_points = MakeTimePoints(std::chrono::nanoseconds{1234567});
+  const auto tz = cctz::utc_time_zone();
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto tp : time_points) {
+      benchmark::DoNotOptimize(
+          cctz::format(utils::datetime::kRfc3339Format, tp, tz));
+    }
+  }
+}
+BENCHMARK(rfc3339_format_cctz);
+
+// state.range(0) is the step between the time points in microseconds, the
+// cached date and time are reused if it is small
+void rfc3339_format_fast(benchmark::State& state) {
+  const auto time_points =
+      MakeTimePoints(std::chrono::microseconds{state.range(0)});
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto tp : time_points) {
+      benchmark::DoNotOptimize(utils::datetime::ToRfc3339String(tp));
+    }
+  }
+}
+BENCHMARK(rfc3339_format_fast)->Arg(1)->Arg(1000000);
+
+void rfc3339_timestring(benchmark::State& state) {
+  const auto time_points = MakeTimePoints(std::chrono::nanoseconds{1234567});
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto tp : time_points) {
+      benchmark::DoNotOptimize(utils::datetime::Timestring(
+          tp, "UTC", utils::datetime::kRfc3339Format));
+    }
+  }
+}
+BENCHMARK(rfc3339_timestring);
+
+void rfc3339_parse_cctz(benchmark::State& state) {
+  const std::string str = "2023-11-14T22:13:20.123456+03:00";
+  const auto tz = cctz::utc_time_zone();
+  for ([[maybe_unused]] auto _ : state) {
+    TimePoint tp;
+    benchmark::DoNotOptimize(
+        cctz::parse(utils::datetime::kRfc3339Format, str, tz, &tp));
+    benchmark::DoNotOptimize(tp);
+  }
+}
+BENCHMARK(rfc3339_parse_cctz);
+
+void rfc3339_parse_fast(benchmark::State& state) {
+  const std::string str = "2023-11-14T22:13:20.123456+03:00";
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::FromRfc3339String(str));
+  }
+}
+BENCHMARK(rfc3339_parse_fast);
+
+USERVER_NAMESPACE_END
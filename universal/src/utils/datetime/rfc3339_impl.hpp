@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime::impl {
+
+/// The formats from utils/datetime.hpp that are formatted and parsed in UTC
+/// without cctz
+enum class FixedFormat {
+  kRfc3339,    ///< kRfc3339Format, "%Y-%m-%dT%H:%M:%E*S%Ez"
+  kDefault,    ///< kDefaultFormat, "%Y-%m-%dT%H:%M:%E*S%z"
+  kIso,        ///< kIsoFormat, "%Y-%m-%dT%H:%M:%SZ"
+  kTaximeter,  ///< kTaximeterFormat, "%Y-%m-%dT%H:%M:%E6SZ"
+};
+
+/// Returns the FixedFormat of the cctz `format` string, if there is one
+std::optional<FixedFormat> GetFixedFormat(std::string_view format) noexcept;
+
+/// Returns the same string as cctz::format(format, tp, UTC), or std::nullopt
+/// if the year does not have exactly 4 digits. The date and time are cached
+/// per thread for the last formatted second.
+std::optional<std::string> FormatUtc(std::chrono::system_clock::time_point tp,
+                                     FixedFormat format);
+
+struct ParsedTime {
+  /// Seconds since the epoch, UTC
+  std::int64_t seconds{0};
+  /// Fraction of the second, [0, 1'000'000'000)
+  std::int64_t nanoseconds{0};
+};
+
+/// Parses the canonical strings of `format`, e.g. "2023-05-17T10:20:30.5Z".
+/// Returns std::nullopt if `timestring` has some other form, the result of
+/// cctz::parse is unknown in that case: a valid but unusual string, e.g. with
+/// a leap second or surrounding whitespace, or an invalid one.
+std::optional<ParsedTime> ParseUtc(std::string_view timestring,
+                                   FixedFormat format) noexcept;
+
+/// Returns the time point of `parsed`, or std::nullopt if it is not
+/// representable by std::chrono::system_clock::time_point
+std::optional<std::chrono::system_clock::time_point> ToTimePoint(
+    ParsedTime parsed) noexcept;
+
+}  // namespace utils::datetime::impl
+
+USERVER_NAMESPACE_END
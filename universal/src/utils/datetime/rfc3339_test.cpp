@@ -0,0 +1,131 @@
+#include <userver/utils/datetime/rfc3339.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cctz/time_zone.h>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+std::string CctzFormat(const std::string& format, TimePoint tp) {
+  return cctz::format(format, tp, cctz::utc_time_zone());
+}
+
+}  // namespace
+
+TEST(Rfc3339, ToRfc3339String) {
+  /// [ToRfc3339String example]
+  const TimePoint tp{std::chrono::seconds{1400294400} +
+                     std::chrono::milliseconds{250}};
+  EXPECT_EQ(utils::datetime::ToRfc3339String(tp),
+            "2014-05-17T02:40:00.25+00:00");
+  /// [ToRfc3339String example]
+
+  EXPECT_EQ(utils::datetime::ToRfc3339String(TimePoint{}),
+            "1970-01-01T00:00:00+00:00");
+  EXPECT_EQ(utils::datetime::ToRfc3339String(TimePoint{} -
+                                             std::chrono::microseconds{1}),
+            "1969-12-31T23:59:59.999999+00:00");
+}
+
+TEST(Rfc3339, SameAsCctz) {
+  const std::string formats[] = {
+      utils::datetime::kRfc3339Format, utils::datetime::kDefaultFormat,
+      utils::datetime::kIsoFormat, utils::datetime::kTaximeterFormat};
+  const TimePoint time_points[] = {
+      TimePoint{},
+      TimePoint::min(),
+      TimePoint{std::chrono::seconds{951782400}},  // 2000-02-29
+      TimePoint{std::chrono::seconds{1700000000} +
+                std::chrono::microseconds{123456}},
+      TimePoint{std::chrono::seconds{-1700000000} +
+                std::chrono::microseconds{900000}},
+      TimePoint{std::chrono::seconds{4102444799}},  // 2099-12-31T23:59:59
+  };
+
+  for (const auto& format : formats) {
+    for (const auto tp : time_points) {
+      // the same second twice to check the per-thread cache
+      for (const auto offset :
+           {std::chrono::microseconds{0}, std::chrono::microseconds{7}}) {
+        EXPECT_EQ(utils::datetime::Timestring(tp + offset, "UTC", format),
+                  CctzFormat(format, tp + offset))
+            << format;
+      }
+    }
+    EXPECT_EQ(utils::datetime::Timestring(TimePoint::max(), "UTC", format),
+              CctzFormat(format, TimePoint::max()));
+  }
+
+  const std::time_t c_time = 1400294400;
+  EXPECT_EQ(utils::datetime::TimestampToString(c_time),
+            "2014-05-17T02:40:00+0000");
+}
+
+TEST(Rfc3339, FromRfc3339String) {
+  /// [FromRfc3339String example]
+  const TimePoint expected{std::chrono::seconds{1400294400} +
+                           std::chrono::milliseconds{250}};
+  EXPECT_EQ(
+      utils::datetime::FromRfc3339String("2014-05-17T02:40:00.25+00:00"),
+      expected);
+  EXPECT_EQ(utils::datetime::FromRfc3339String("2014-05-17T02:40:00.250Z"),
+            expected);
+  EXPECT_EQ(
+      utils::datetime::FromRfc3339String("2014-05-17T05:10:00.25+02:30"),
+      expected);
+  /// [FromRfc3339String example]
+
+  // not in the canonical form, parsed by cctz
+  EXPECT_EQ(utils::datetime::FromRfc3339String(" 2014-05-17T02:40:00.25Z"),
+            expected);
+  EXPECT_EQ(utils::datetime::FromRfc3339String("2014-05-17T02:40:00.25+02"),
+            expected - std::chrono::hours{2});
+  // leap seconds lose the fraction in cctz
+  EXPECT_EQ(utils::datetime::FromRfc3339String("2014-05-17T02:39:60.25Z"),
+            TimePoint{std::chrono::seconds{1400294400}});
+
+  for (const auto* invalid :
+       {"", "2014-05-17", "2014-05-17T02:40:00", "2014-02-30T02:40:00Z",
+        "2014-05-17T24:40:00Z", "2014-05-17T02:40:00.Z",
+        "2014-05-17T02:40:00+24:00", "2014-05-17T02:40:00+2:30"}) {
+    EXPECT_THROW(utils::datetime::FromRfc3339String(invalid),
+                 utils::datetime::DateParseError)
+        << invalid;
+  }
+}
+
+TEST(Rfc3339, StringtimeSameAsCctz) {
+  const std::string formats[] = {
+      utils::datetime::kRfc3339Format, utils::datetime::kDefaultFormat,
+      utils::datetime::kIsoFormat, utils::datetime::kTaximeterFormat};
+  const std::string timestrings[] = {
+      "2014-05-17T02:40:00Z",         "2014-05-17T02:40:00z",
+      "2014-05-17T02:40:00+03:00",    "2014-05-17T02:40:00-0330",
+      "2014-05-17T02:40:00.5Z",       "2014-05-17T02:40:00.123456Z",
+      "2014-05-17T02:40:00.1234567Z", "2000-02-29T23:59:59.999999999+0000",
+      "2001-02-29T00:00:00Z",         "2014-05-17T02:40:00.",
+  };
+
+  for (const auto& format : formats) {
+    for (const auto& timestring : timestrings) {
+      TimePoint expected;
+      if (cctz::parse(format, timestring, cctz::utc_time_zone(), &expected)) {
+        EXPECT_EQ(utils::datetime::Stringtime(timestring, "UTC", format),
+                  expected)
+            << format << ' ' << timestring;
+      } else {
+        EXPECT_THROW(utils::datetime::Stringtime(timestring, "UTC", format),
+                     utils::datetime::DateParseError)
+            << format << ' ' << timestring;
+      }
+    }
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -109,6 +109,37 @@ bool IsXDigit(unsigned char x_digit) noexcept {
 const auto kLow4BitsMask = _mm_set1_epi8(0xf);
 const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
                                        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+__m128i InRange(__m128i input, char first, char last) {
+  return _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(first - 1)),
+                       _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), input));
+}
+
+/// Converts 16 hex chars into 8 bytes. Returns false and writes nothing if
+/// some of the chars are not hex digits
+bool FromHexBlock(const char* src, char* dst) noexcept {
+  const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+  // setting 0x20 bit maps 'A'-'F' to 'a'-'f' and keeps digits as is, no other
+  // char gets into 'a'-'f' that way
+  const auto lowercase = _mm_or_si128(input, _mm_set1_epi8(0x20));
+  const auto is_digit = InRange(input, '0', '9');
+  const auto is_letter = InRange(lowercase, 'a', 'f');
+  if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) {
+    return false;
+  }
+
+  const auto values = _mm_or_si128(
+      _mm_and_si128(is_digit, _mm_sub_epi8(input, _mm_set1_epi8('0'))),
+      _mm_and_si128(is_letter,
+                    _mm_sub_epi8(lowercase, _mm_set1_epi8('a' - 10))));
+
+  // each pair of values becomes hi * 16 + lo in a 16-bit lane
+  const auto bytes = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+                   _mm_packus_epi16(bytes, bytes));
+  return true;
+}
 #endif
 
 }  // namespace detail
@@ -186,27 +217,32 @@ bool IsHexData(std::string_view encoded) noexcept {
 }
 
 size_t FromHex(std::string_view encoded, std::string& out) noexcept {
-  // we need to read in pairs
+  const auto initial_size = out.size();
+  out.resize(initial_size + FromHexUpperBound(encoded.size()));
+
   const char* first = encoded.data();
   const char* pair_ptr = first;
   const char* last = first + encoded.size();
-  for (; pair_ptr != last; pair_ptr += 2) {
-    if (!detail::IsXDigit(pair_ptr[0])) {
-      break;
-    }
+  auto* dst = out.data() + initial_size;
 
-    if (pair_ptr + 1 == last) {
-      // no second element
-      break;
-    }
-    if (!detail::IsXDigit(pair_ptr[1])) {
+#ifdef __SSSE3__
+  while (last - pair_ptr >= 16 && detail::FromHexBlock(pair_ptr, dst)) {
+    pair_ptr += 16;
+    dst += 8;
+  }
+#endif
+
+  // we need to read in pairs
+  for (; last - pair_ptr >= 2; pair_ptr += 2) {
+    if (!detail::IsXDigit(pair_ptr[0]) || !detail::IsXDigit(pair_ptr[1])) {
       break;
     }
 
-    out.push_back((detail::GetXDigitValue(pair_ptr[0]) << 4) |
-                  (detail::GetXDigitValue(pair_ptr[1])));
+    *(dst++) = (detail::GetXDigitValue(pair_ptr[0]) << 4) |
+               (detail::GetXDigitValue(pair_ptr[1]));
   }
 
+  out.resize(dst - out.data());
   return static_cast<size_t>(std::distance(first, pair_ptr));
 }
 
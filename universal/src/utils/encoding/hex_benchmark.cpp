@@ -42,4 +42,18 @@ void to_hex_benchmark_no_alloc(benchmark::State& state) {
 }
 BENCHMARK(to_hex_benchmark_no_alloc)->RangeMultiplier(2)->Range(8, 512);
 
+void from_hex_benchmark(benchmark::State& state) {
+  const auto encoded = utils::encoding::ToHex(GenerateSource(state.range(0)));
+
+  std::string out;
+  out.reserve(state.range(0));
+  benchmark::DoNotOptimize(out);
+
+  for ([[maybe_unused]] auto _ : state) {
+    out.clear();
+    utils::encoding::FromHex(encoded, out);
+  }
+}
+BENCHMARK(from_hex_benchmark)->RangeMultiplier(2)->Range(8, 512);
+
 USERVER_NAMESPACE_END
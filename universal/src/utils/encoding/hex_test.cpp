@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cctype>
 #include <forward_list>
 #include <string>
 
@@ -104,6 +105,36 @@ TEST(Hex, FromHex) {
   }
 }
 
+TEST(Hex, FromHexLong) {
+  std::string data;
+  for (int i = 0; i < 256; ++i) data.push_back(static_cast<char>(i));
+  const auto encoded = ToHex(data);
+
+  std::string result;
+  EXPECT_EQ(encoded.size(), FromHex(encoded, result));
+  EXPECT_EQ(data, result);
+
+  std::string uppercase = encoded;
+  for (auto& c : uppercase) c = std::toupper(c);
+  result.clear();
+  EXPECT_EQ(uppercase.size(), FromHex(uppercase, result));
+  EXPECT_EQ(data, result);
+
+  // output is appended to
+  result = "prefix";
+  EXPECT_EQ(encoded.size(), FromHex(encoded, result));
+  EXPECT_EQ("prefix" + data, result);
+
+  // stops at any position of a wrong symbol
+  for (std::size_t position = 0; position < 40; ++position) {
+    std::string broken = encoded;
+    broken[position] = 'g';
+    result.clear();
+    EXPECT_EQ(position / 2 * 2, FromHex(broken, result));
+    EXPECT_EQ(data.substr(0, position / 2), result);
+  }
+}
+
 TEST(Hex, GetHexPart) {
   // Test simple case - everything is correct
   {
@@ -0,0 +1,204 @@
+#include <userver/utils/hash.hpp>
+
+#include <array>
+#include <cstring>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::hash {
+
+namespace {
+
+template <typename T>
+T Load(const unsigned char* data) noexcept {
+  T result;
+  std::memcpy(&result, data, sizeof(result));
+  return result;
+}
+
+// Slicing-by-8 tables of a reflected CRC-32 polynomial
+using CrcTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+constexpr CrcTables MakeCrcTables(std::uint32_t polynomial) {
+  CrcTables tables{};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+    }
+    tables[0][i] = crc;
+  }
+  for (std::size_t slice = 1; slice < tables.size(); ++slice) {
+    for (std::size_t i = 0; i < 256; ++i) {
+      const auto previous = tables[slice - 1][i];
+      tables[slice][i] = (previous >> 8) ^ tables[0][previous & 0xff];
+    }
+  }
+  return tables;
+}
+
+constexpr auto kCrc32Tables = MakeCrcTables(0xedb88320);
+#if !defined(__SSE4_2__) && !defined(__ARM_FEATURE_CRC32)
+constexpr auto kCrc32cTables = MakeCrcTables(0x82f63b78);
+#endif
+
+std::uint32_t CrcSlicing(const CrcTables& tables, std::string_view data,
+                         std::uint32_t crc) noexcept {
+  const auto* p = reinterpret_cast<const unsigned char*>(data.data());
+  std::size_t size = data.size();
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  for (; size >= 8; size -= 8, p += 8) {
+    const auto low = Load<std::uint32_t>(p) ^ crc;
+    const auto high = Load<std::uint32_t>(p + 4);
+    crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^
+          tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+          tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^
+          tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+  }
+#endif
+
+  for (; size; --size, ++p) {
+    crc = (crc >> 8) ^ tables[0][(crc ^ *p) & 0xff];
+  }
+  return crc;
+}
+
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+std::uint32_t Crc32cHardware(std::string_view data,
+                             std::uint32_t crc) noexcept {
+  const auto* p = reinterpret_cast<const unsigned char*>(data.data());
+  std::size_t size = data.size();
+
+#if defined(__SSE4_2__)
+#if defined(__x86_64__)
+  std::uint64_t crc64 = crc;
+  for (; size >= 8; size -= 8, p += 8) {
+    crc64 = _mm_crc32_u64(crc64, Load<std::uint64_t>(p));
+  }
+  crc = static_cast<std::uint32_t>(crc64);
+#endif
+  for (; size; --size, ++p) crc = _mm_crc32_u8(crc, *p);
+#else
+  for (; size >= 8; size -= 8, p += 8) {
+    crc = __crc32cd(crc, Load<std::uint64_t>(p));
+  }
+  for (; size; --size, ++p) crc = __crc32cb(crc, *p);
+#endif
+
+  return crc;
+}
+#endif
+
+constexpr std::uint64_t kWySecret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL,
+    0x4d5a2da51de1aa47ULL};
+
+// 64x64 -> 128 multiplication, returns low and high halves
+void WyMultiply(std::uint64_t& a, std::uint64_t& b) noexcept {
+#ifdef __SIZEOF_INT128__
+  const auto result = static_cast<unsigned __int128>(a) * b;
+  a = static_cast<std::uint64_t>(result);
+  b = static_cast<std::uint64_t>(result >> 64);
+#else
+  const std::uint64_t ha = a >> 32;
+  const std::uint64_t hb = b >> 32;
+  const std::uint64_t la = static_cast<std::uint32_t>(a);
+  const std::uint64_t lb = static_cast<std::uint32_t>(b);
+  const std::uint64_t rh = ha * hb;
+  const std::uint64_t rm0 = ha * lb;
+  const std::uint64_t rm1 = hb * la;
+  const std::uint64_t rl = la * lb;
+  const std::uint64_t t = rl + (rm0 << 32);
+  std::uint64_t carry = t < rl;
+  const std::uint64_t lo = t + (rm1 << 32);
+  carry += lo < t;
+  a = lo;
+  b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+std::uint64_t WyMix(std::uint64_t a, std::uint64_t b) noexcept {
+  WyMultiply(a, b);
+  return a ^ b;
+}
+
+std::uint64_t WyRead3(const unsigned char* p, std::size_t size) noexcept {
+  return (static_cast<std::uint64_t>(p[0]) << 16) |
+         (static_cast<std::uint64_t>(p[size >> 1]) << 8) | p[size - 1];
+}
+
+}  // namespace
+
+std::uint32_t Crc32(std::string_view data, std::uint32_t crc) noexcept {
+  return ~CrcSlicing(kCrc32Tables, data, ~crc);
+}
+
+std::uint32_t Crc32c(std::string_view data, std::uint32_t crc) noexcept {
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+  return ~Crc32cHardware(data, ~crc);
+#else
+  return ~CrcSlicing(kCrc32cTables, data, ~crc);
+#endif
+}
+
+std::uint64_t WyHash(std::string_view data, std::uint64_t seed) noexcept {
+  const auto* p = reinterpret_cast<const unsigned char*>(data.data());
+  const std::size_t size = data.size();
+
+  seed ^= WyMix(seed ^ kWySecret[0], kWySecret[1]);
+  std::uint64_t a = 0;
+  std::uint64_t b = 0;
+  if (size <= 16) {
+    if (size >= 4) {
+      const std::size_t shift = (size >> 3) << 2;
+      a = (static_cast<std::uint64_t>(Load<std::uint32_t>(p)) << 32) |
+          Load<std::uint32_t>(p + shift);
+      b = (static_cast<std::uint64_t>(Load<std::uint32_t>(p + size - 4))
+           << 32) |
+          Load<std::uint32_t>(p + size - 4 - shift);
+    } else if (size > 0) {
+      a = WyRead3(p, size);
+    }
+  } else {
+    std::size_t left = size;
+    if (left > 48) {
+      std::uint64_t seed1 = seed;
+      std::uint64_t seed2 = seed;
+      do {
+        seed = WyMix(Load<std::uint64_t>(p) ^ kWySecret[1],
+                     Load<std::uint64_t>(p + 8) ^ seed);
+        seed1 = WyMix(Load<std::uint64_t>(p + 16) ^ kWySecret[2],
+                      Load<std::uint64_t>(p + 24) ^ seed1);
+        seed2 = WyMix(Load<std::uint64_t>(p + 32) ^ kWySecret[3],
+                      Load<std::uint64_t>(p + 40) ^ seed2);
+        p += 48;
+        left -= 48;
+      } while (left > 48);
+      seed ^= seed1 ^ seed2;
+    }
+    while (left > 16) {
+      seed = WyMix(Load<std::uint64_t>(p) ^ kWySecret[1],
+                   Load<std::uint64_t>(p + 8) ^ seed);
+      p += 16;
+      left -= 16;
+    }
+    a = Load<std::uint64_t>(p + left - 16);
+    b = Load<std::uint64_t>(p + left - 8);
+  }
+
+  a ^= kWySecret[1];
+  b ^= seed;
+  WyMultiply(a, b);
+  return WyMix(a ^ kWySecret[0] ^ size, b ^ kWySecret[1]);
+}
+
+}  // namespace utils::hash
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <userver/utils/hash.hpp>
+
+#include <functional>
+#include <string>
+
+#include <boost/crc.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeData(std::size_t size) {
+  std::string data;
+  for (std::size_t i = 0; i < size; ++i) {
+    data.push_back(static_cast<char>('a' + i % 26));
+  }
+  return data;
+}
+
+}  // namespace
+
+void HashStd(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(std::hash<std::string_view>{}(data));
+  }
+}
+BENCHMARK(HashStd)->RangeMultiplier(4)->Range(4, 4096);
+
+void HashBoostCrc32(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data.data(), data.size());
+    benchmark::DoNotOptimize(crc.checksum());
+  }
+}
+BENCHMARK(HashBoostCrc32)->RangeMultiplier(4)->Range(4, 4096);
+
+void HashCrc32(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::hash::Crc32(data));
+  }
+}
+BENCHMARK(HashCrc32)->RangeMultiplier(4)->Range(4, 4096);
+
+void HashCrc32c(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::hash::Crc32c(data));
+  }
+}
+BENCHMARK(HashCrc32c)->RangeMultiplier(4)->Range(4, 4096);
+
+void HashWyHash(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::hash::WyHash(data));
+  }
+}
+BENCHMARK(HashWyHash)->RangeMultiplier(4)->Range(4, 4096);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <userver/utils/hash.hpp>
+
+#include <string>
+#include <unordered_set>
+
+#include <boost/crc.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeData(std::size_t size) {
+  std::string data;
+  for (std::size_t i = 0; i < size; ++i) {
+    data.push_back(static_cast<char>(i * 131 + 7));
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(Hash, Crc32) {
+  EXPECT_EQ(utils::hash::Crc32(""), 0);
+  EXPECT_EQ(utils::hash::Crc32("123456789"), 0xcbf43926);
+
+  const auto data = MakeData(1000);
+  for (std::size_t size = 0; size < data.size(); size += 7) {
+    const std::string_view part{data.data(), size};
+    boost::crc_32_type crc;
+    crc.process_bytes(part.data(), part.size());
+    EXPECT_EQ(utils::hash::Crc32(part), crc.checksum()) << size;
+  }
+}
+
+TEST(Hash, Crc32c) {
+  EXPECT_EQ(utils::hash::Crc32c(""), 0);
+  EXPECT_EQ(utils::hash::Crc32c("123456789"), 0xe3069283);
+
+  const auto data = MakeData(1000);
+  for (std::size_t size = 0; size < data.size(); size += 7) {
+    const std::string_view part{data.data(), size};
+    boost::crc_optimal<32, 0x1edc6f41, 0xffffffff, 0xffffffff, true, true> crc;
+    crc.process_bytes(part.data(), part.size());
+    EXPECT_EQ(utils::hash::Crc32c(part), crc.checksum()) << size;
+  }
+}
+
+TEST(Hash, CrcContinuation) {
+  const auto data = MakeData(100);
+  const std::string_view view{data};
+  for (std::size_t split = 0; split <= data.size(); ++split) {
+    EXPECT_EQ(utils::hash::Crc32(view.substr(split),
+                                 utils::hash::Crc32(view.substr(0, split))),
+              utils::hash::Crc32(view));
+    EXPECT_EQ(utils::hash::Crc32c(view.substr(split),
+                                  utils::hash::Crc32c(view.substr(0, split))),
+              utils::hash::Crc32c(view));
+  }
+}
+
+TEST(Hash, WyHash) {
+  const auto data = MakeData(200);
+  std::unordered_set<std::uint64_t> hashes;
+  for (std::size_t size = 0; size <= data.size(); ++size) {
+    const std::string_view part{data.data(), size};
+    EXPECT_EQ(utils::hash::WyHash(part), utils::hash::WyHash(std::string{part}));
+    hashes.insert(utils::hash::WyHash(part));
+  }
+  EXPECT_EQ(hashes.size(), data.size() + 1);
+
+  EXPECT_NE(utils::hash::WyHash(data, 1), utils::hash::WyHash(data, 2));
+  EXPECT_NE(utils::hash::WyHash("a"), utils::hash::WyHash("b"));
+}
+
+TEST(Hash, StringHash) {
+  std::unordered_set<std::string, utils::hash::StringHash> set{"a", "bb"};
+  EXPECT_EQ(set.count("a"), 1);
+  EXPECT_EQ(set.count("c"), 0);
+  EXPECT_EQ(utils::hash::StringHash{}("key"),
+            utils::hash::StringHash{}(std::string{"key"}));
+}
+
+USERVER_NAMESPACE_END
@@ -73,6 +73,30 @@ TEST(MockSteadyNow, MockedValidSeq) {
   UEXPECT_NO_THROW(utils::datetime::MockSteadyNow());
 }
 
+TEST(SteadyCoarseNow, Mocked) {
+  using utils::datetime::Stringtime;
+
+  MockNowSet(Stringtime("2000-01-01T00:00:00+0000"));
+  const auto start = utils::datetime::SteadyCoarseNow();
+  EXPECT_EQ(start, utils::datetime::MockSteadyNow());
+
+  utils::datetime::MockSleep(5s);
+  EXPECT_EQ(utils::datetime::SteadyCoarseNow() - start, 5s);
+  utils::datetime::MockNowUnset();
+}
+
+TEST(SteadyCoarseNow, NotMocked) {
+  utils::datetime::MockNowUnset();
+  const auto before = utils::datetime::SteadyCoarseNow();
+  const auto precise = std::chrono::steady_clock::now();
+  const auto after = utils::datetime::SteadyCoarseNow();
+
+  EXPECT_LE(before, after);
+  // Both clocks count from the same point, the coarse one lags behind
+  EXPECT_LE(after - precise, 1s);
+  EXPECT_LE(precise - before, 1s);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <unordered_map>
+
+#include <userver/utils/persistent_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kUpdatedKeys = 1000;
+
+template <typename Map>
+Map MakeMap(std::size_t size) {
+  Map map;
+  for (std::size_t i = 0; i < size; ++i) map.insert_or_assign(i, i);
+  return map;
+}
+
+// Resembles an incremental update of a cache: a copy of the current data
+// with a few keys changed
+template <typename Map>
+void IncrementalUpdate(benchmark::State& state) {
+  const auto map = MakeMap<Map>(state.range(0));
+  std::size_t key = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    auto copy = map;
+    for (std::size_t i = 0; i < kUpdatedKeys; ++i) {
+      copy.insert_or_assign(key++ % map.size(), i);
+    }
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+template <typename Map>
+void Count(benchmark::State& state) {
+  const auto map = MakeMap<Map>(state.range(0));
+  std::size_t key = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(map.count(key++ % map.size()));
+  }
+}
+
+using PersistentMap = utils::PersistentMap<std::size_t, std::size_t>;
+using UnorderedMap = std::unordered_map<std::size_t, std::size_t>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(IncrementalUpdate, UnorderedMap)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000);
+BENCHMARK_TEMPLATE(IncrementalUpdate, PersistentMap)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000);
+BENCHMARK_TEMPLATE(Count, UnorderedMap)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000);
+BENCHMARK_TEMPLATE(Count, PersistentMap)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000);
+
+USERVER_NAMESPACE_END
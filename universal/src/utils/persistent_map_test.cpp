@@ -0,0 +1,146 @@
+#include <userver/utils/persistent_map.hpp>
+
+#include <string>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Makes a lot of collisions, including the full hash collisions
+struct BadHash {
+  std::size_t operator()(int key) const noexcept {
+    return key % 3 == 0 ? 42 : static_cast<std::size_t>(key % 100) << 58;
+  }
+};
+
+template <typename Map>
+std::unordered_map<int, int> ToUnorderedMap(const Map& map) {
+  std::unordered_map<int, int> result;
+  for (const auto& [key, value] : map) {
+    EXPECT_TRUE(result.emplace(key, value).second) << key;
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(PersistentMap, Sample) {
+  /// [Sample persistent map]
+  utils::PersistentMap<std::string, int> map;
+  map.insert_or_assign("a", 1);
+  map.insert_or_assign("b", 2);
+
+  auto copy = map;  // O(1), the data is shared
+  copy.insert_or_assign("a", 10);
+  copy.erase("b");
+
+  EXPECT_EQ(map.at("a"), 1);
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_EQ(copy.at("a"), 10);
+  EXPECT_FALSE(copy.contains("b"));
+  /// [Sample persistent map]
+}
+
+TEST(PersistentMap, Basic) {
+  utils::PersistentMap<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.erase(1), 0);
+
+  EXPECT_TRUE(map.insert({1, 1}));
+  EXPECT_FALSE(map.insert({1, 2}));
+  EXPECT_EQ(map.at(1), 1);
+  EXPECT_FALSE(map.insert_or_assign(1, 3));
+  EXPECT_EQ(*map.FindPtr(1), 3);
+  EXPECT_EQ(map.size(), 1);
+
+  const auto it = map.find(1);
+  ASSERT_NE(it, map.end());
+  EXPECT_EQ(it->second, 3);
+  EXPECT_EQ(std::next(it), map.end());
+
+  EXPECT_THROW(map.at(2), std::out_of_range);
+  EXPECT_EQ(map.FindPtr(2), nullptr);
+  EXPECT_EQ(map.count(2), 0);
+
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentMap, Random) {
+  constexpr int kKeys = 5000;
+  utils::PersistentMap<int, int> map;
+  std::unordered_map<int, int> expected;
+
+  for (int i = 0; i < kKeys * 4; ++i) {
+    const int key = (i * 7919) % kKeys;
+    if (i % 3 == 2) {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      EXPECT_EQ(map.insert_or_assign(key, i),
+                expected.insert_or_assign(key, i).second);
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  EXPECT_EQ(ToUnorderedMap(map), expected);
+  for (int key = 0; key < kKeys; ++key) {
+    const auto it = expected.find(key);
+    if (it == expected.end()) {
+      EXPECT_EQ(map.find(key), map.end());
+    } else {
+      ASSERT_NE(map.find(key), map.end());
+      EXPECT_EQ(map.find(key)->second, it->second);
+    }
+  }
+}
+
+TEST(PersistentMap, Collisions) {
+  utils::PersistentMap<int, int, BadHash> map;
+  std::unordered_map<int, int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert_or_assign(i, i);
+    expected.emplace(i, i);
+  }
+  EXPECT_EQ(ToUnorderedMap(map), expected);
+
+  for (int i = 0; i < 1000; i += 2) {
+    EXPECT_EQ(map.erase(i), 1);
+    expected.erase(i);
+  }
+  EXPECT_EQ(map.size(), expected.size());
+  EXPECT_EQ(ToUnorderedMap(map), expected);
+
+  // Iteration continues after the found key
+  std::size_t count = 0;
+  for (auto it = map.find(999); it != map.end(); ++it) ++count;
+  EXPECT_GE(count, 1);
+  EXPECT_LE(count, map.size());
+}
+
+TEST(PersistentMap, Sharing) {
+  utils::PersistentMap<int, std::string> map;
+  for (int i = 0; i < 1000; ++i) map.insert_or_assign(i, std::to_string(i));
+
+  auto copy = map;
+  for (int i = 0; i < 1000; i += 10) copy.insert_or_assign(i, "changed");
+  for (int i = 1; i < 1000; i += 10) copy.erase(i);
+  copy.insert_or_assign(1000, "new");
+
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_EQ(copy.size(), 1000 - 100 + 1);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.at(i), std::to_string(i));
+  }
+  EXPECT_EQ(copy.at(0), "changed");
+  EXPECT_EQ(copy.at(2), "2");
+  EXPECT_FALSE(copy.contains(1));
+  EXPECT_FALSE(map.contains(1000));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,237 @@
+#include <userver/utils/regex_set.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+#include <boost/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+bool HasBackreferences(std::string_view pattern) {
+  for (std::size_t i = 0; i + 1 < pattern.size(); ++i) {
+    if (pattern[i] != '\\') continue;
+    const auto next = pattern[i + 1];
+    if (std::isdigit(static_cast<unsigned char>(next)) || next == 'g' ||
+        next == 'k') {
+      return true;
+    }
+    ++i;
+  }
+  return false;
+}
+
+// Returns the longest literal that is present in every text matched by the
+// pattern, or an empty string if it is not obvious. Only the top level of the
+// pattern is considered, anything in the groups and classes is skipped.
+std::string GetRequiredLiteral(std::string_view pattern) {
+  if (pattern.find('|') != std::string_view::npos) return {};
+  if (pattern.find("(?") != std::string_view::npos) return {};
+
+  std::string best;
+  std::string run;
+  const auto flush = [&best, &run] {
+    if (run.size() > best.size()) best = run;
+    run.clear();
+  };
+  const auto drop_optional = [&run, &flush] {
+    if (!run.empty()) run.pop_back();
+    flush();
+  };
+
+  std::size_t depth = 0;
+  for (std::size_t i = 0; i < pattern.size(); ++i) {
+    const auto c = pattern[i];
+    switch (c) {
+      case '\\':
+        if (i + 1 == pattern.size()) return {};
+        ++i;
+        if (std::isalnum(static_cast<unsigned char>(pattern[i]))) {
+          flush();
+        } else if (depth == 0) {
+          run.push_back(pattern[i]);
+        }
+        break;
+      case '[': {
+        flush();
+        // ']' right after '[' or '[^' is a literal
+        std::size_t end = i + 1;
+        if (end < pattern.size() && pattern[end] == '^') ++end;
+        if (end < pattern.size() && pattern[end] == ']') ++end;
+        while (end < pattern.size() && pattern[end] != ']') {
+          if (pattern[end] == '\\') ++end;
+          ++end;
+        }
+        if (end >= pattern.size()) return {};
+        i = end;
+        break;
+      }
+      case '(':
+        flush();
+        ++depth;
+        break;
+      case ')':
+        flush();
+        if (depth == 0) return {};
+        --depth;
+        break;
+      case '*':
+      case '?':
+        drop_optional();
+        break;
+      case '{': {
+        drop_optional();
+        const auto end = pattern.find('}', i);
+        if (end == std::string_view::npos) return {};
+        i = end;
+        break;
+      }
+      case '+':
+      case '.':
+      case '^':
+      case '$':
+        flush();
+        break;
+      default:
+        if (depth == 0) {
+          run.push_back(c);
+        } else {
+          flush();
+        }
+    }
+  }
+  flush();
+  return best;
+}
+
+}  // namespace
+
+struct RegexSet::Impl {
+  struct Pattern {
+    boost::regex regex;
+    std::string required_literal;
+    // index of the pattern's group in `merged`
+    std::size_t merged_group{0};
+  };
+
+  std::vector<Pattern> patterns;
+  std::optional<boost::regex> merged;
+
+  static bool MayMatch(const Pattern& pattern, std::string_view str) {
+    return pattern.required_literal.empty() ||
+           str.find(pattern.required_literal) != std::string_view::npos;
+  }
+
+  // Indices of the patterns whose required literals are in `str`
+  std::vector<std::size_t> GetCandidates(std::string_view str) const {
+    std::vector<std::size_t> result;
+    for (std::size_t i = 0; i < patterns.size(); ++i) {
+      if (MayMatch(patterns[i], str)) result.push_back(i);
+    }
+    return result;
+  }
+};
+
+RegexSet::RegexSet(const std::vector<std::string>& patterns)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->patterns.reserve(patterns.size());
+
+  bool can_merge = !patterns.empty();
+  std::string merged;
+  std::size_t group = 1;
+  for (const auto& pattern : patterns) {
+    auto& compiled = impl_->patterns.emplace_back();
+    compiled.regex = boost::regex(pattern);
+    compiled.required_literal = GetRequiredLiteral(pattern);
+    compiled.merged_group = group;
+    group += compiled.regex.mark_count() + 1;
+
+    can_merge = can_merge && !HasBackreferences(pattern);
+    if (!merged.empty()) merged += '|';
+    merged += '(';
+    merged += pattern;
+    merged += ')';
+  }
+
+  if (can_merge) {
+    try {
+      impl_->merged.emplace(merged);
+    } catch (const std::exception&) {
+      // e.g. duplicate group names, searching the patterns one by one
+    }
+  }
+}
+
+RegexSet::RegexSet(RegexSet&&) noexcept = default;
+
+RegexSet& RegexSet::operator=(RegexSet&&) noexcept = default;
+
+RegexSet::~RegexSet() = default;
+
+std::size_t RegexSet::Size() const noexcept { return impl_->patterns.size(); }
+
+bool RegexSet::SearchAny(std::string_view str) const {
+  const auto candidates = impl_->GetCandidates(str);
+  if (candidates.empty()) return false;
+  if (impl_->merged && candidates.size() > 1) {
+    return boost::regex_search(str.begin(), str.end(), *impl_->merged);
+  }
+  return std::any_of(candidates.begin(), candidates.end(),
+                     [&](std::size_t i) {
+                       return boost::regex_search(str.begin(), str.end(),
+                                                  impl_->patterns[i].regex);
+                     });
+}
+
+std::optional<std::size_t> RegexSet::SearchFirst(std::string_view str) const {
+  boost::match_results<std::string_view::const_iterator> match;
+  if (impl_->merged) {
+    if (impl_->GetCandidates(str).empty()) return std::nullopt;
+    if (!boost::regex_search(str.begin(), str.end(), match, *impl_->merged)) {
+      return std::nullopt;
+    }
+    for (std::size_t i = 0; i < impl_->patterns.size(); ++i) {
+      if (match[impl_->patterns[i].merged_group].matched) return i;
+    }
+    return std::nullopt;
+  }
+
+  std::optional<std::size_t> result;
+  auto position = str.size() + 1;
+  for (std::size_t i = 0; i < impl_->patterns.size(); ++i) {
+    const auto& pattern = impl_->patterns[i];
+    if (!Impl::MayMatch(pattern, str)) continue;
+    if (!boost::regex_search(str.begin(), str.end(), match, pattern.regex)) {
+      continue;
+    }
+    if (static_cast<std::size_t>(match.position()) < position) {
+      position = match.position();
+      result = i;
+    }
+  }
+  return result;
+}
+
+std::vector<std::size_t> RegexSet::SearchAll(std::string_view str) const {
+  auto candidates = impl_->GetCandidates(str);
+  if (impl_->merged && candidates.size() > 1 &&
+      !boost::regex_search(str.begin(), str.end(), *impl_->merged)) {
+    return {};
+  }
+
+  candidates.erase(
+      std::remove_if(candidates.begin(), candidates.end(),
+                     [&](std::size_t i) {
+                       return !boost::regex_search(str.begin(), str.end(),
+                                                   impl_->patterns[i].regex);
+                     }),
+      candidates.end());
+  return candidates;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
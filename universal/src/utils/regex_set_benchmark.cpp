@@ -0,0 +1,53 @@
+#include <userver/utils/regex_set.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::vector<std::string> MakePatterns(std::size_t count) {
+  std::vector<std::string> patterns;
+  patterns.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    patterns.push_back("/api/v" + std::to_string(i) + "/items/\\d+");
+  }
+  return patterns;
+}
+
+constexpr std::string_view kUrl =
+    "/service/handler/orders/123456?lang=en&version=3&flag=true";
+
+}  // namespace
+
+void RegexSeparate(benchmark::State& state) {
+  std::vector<utils::regex> regexes;
+  for (const auto& pattern : MakePatterns(state.range(0))) {
+    regexes.emplace_back(pattern);
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    std::size_t matched = 0;
+    for (const auto& regex : regexes) {
+      matched += utils::regex_search(kUrl, regex);
+    }
+    benchmark::DoNotOptimize(matched);
+  }
+}
+BENCHMARK(RegexSeparate)->Arg(10)->Arg(300);
+
+void RegexSetSearchAll(benchmark::State& state) {
+  const utils::RegexSet set{MakePatterns(state.range(0))};
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(set.SearchAll(kUrl));
+  }
+}
+BENCHMARK(RegexSetSearchAll)->Arg(10)->Arg(300);
+
+USERVER_NAMESPACE_END
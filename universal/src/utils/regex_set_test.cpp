@@ -0,0 +1,84 @@
+#include <userver/utils/regex_set.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Indices = std::vector<std::size_t>;
+
+const std::vector<std::string> kPatterns{
+    "ab?c",        "a(bc)?d",      "x{0,3}y",   "colou?r",   R"(\.com\b)",
+    "[abc]+def",   "(?i)hello",    "foo|bar",   "^start",    "end$",
+    R"(\d{3}-\d+)", "(a)(b)\\2?c", "(?<n>qq)z", R"(a\+b)",   "[]x]y",
+};
+
+const std::vector<std::string> kTexts{
+    "",          "ac",          "abc",         "ad",         "abcd",
+    "y",         "xxxy",        "color",       "colour",     "colouur",
+    "site.com",  "site.comx",   "bbdef",       "HeLLo",      "foo",
+    "xbar",      "start here",  "not start",   "the end",    "end not",
+    "123-45",    "12-45",       "abbc",        "abc",        "qqz",
+    "a+b",       "ab",          "]y",          "xy",         "colour.com",
+};
+
+}  // namespace
+
+TEST(RegexSet, Sample) {
+  /// [Sample RegexSet]
+  const utils::RegexSet set{{"/v1/users/\\d+", "token=[^&]+", "^/ping$"}};
+
+  EXPECT_FALSE(set.SearchAny("/v2/orders/42"));
+  EXPECT_TRUE(set.SearchAny("/v1/users/42?token=secret"));
+  EXPECT_EQ(set.SearchFirst("/v1/users/42?token=secret"), 0);
+  EXPECT_EQ(set.SearchAll("/v1/users/42?token=secret"), (Indices{0, 1}));
+  /// [Sample RegexSet]
+}
+
+TEST(RegexSet, SameAsSeparateRegexes) {
+  const utils::RegexSet set{kPatterns};
+  ASSERT_EQ(set.Size(), kPatterns.size());
+
+  for (const auto& text : kTexts) {
+    Indices expected;
+    for (std::size_t i = 0; i < kPatterns.size(); ++i) {
+      if (utils::regex_search(text, utils::regex{kPatterns[i]})) {
+        expected.push_back(i);
+      }
+    }
+
+    EXPECT_EQ(set.SearchAll(text), expected) << text;
+    EXPECT_EQ(set.SearchAny(text), !expected.empty()) << text;
+    EXPECT_EQ(set.SearchFirst(text).has_value(), !expected.empty()) << text;
+  }
+}
+
+TEST(RegexSet, SearchFirst) {
+  const utils::RegexSet set{{"b+", "a", "ab"}};
+  EXPECT_EQ(set.SearchFirst("xbab"), 0);
+  EXPECT_EQ(set.SearchFirst("xab"), 1);
+  EXPECT_EQ(set.SearchFirst("xyz"), std::nullopt);
+
+  // backreferences are not merged, the result is the same
+  const utils::RegexSet unmerged{{"(b)\\1", "a", "ab"}};
+  EXPECT_EQ(unmerged.SearchFirst("xbbab"), 0);
+  EXPECT_EQ(unmerged.SearchFirst("xab"), 1);
+  EXPECT_EQ(unmerged.SearchAll("bbab"), (Indices{0, 1, 2}));
+}
+
+TEST(RegexSet, Empty) {
+  const utils::RegexSet set{{}};
+  EXPECT_EQ(set.Size(), 0);
+  EXPECT_FALSE(set.SearchAny("text"));
+  EXPECT_EQ(set.SearchFirst("text"), std::nullopt);
+  EXPECT_TRUE(set.SearchAll("text").empty());
+}
+
+TEST(RegexSet, InvalidPattern) {
+  EXPECT_ANY_THROW(utils::RegexSet({"ok", "(unbalanced"}));
+}
+
+USERVER_NAMESPACE_END
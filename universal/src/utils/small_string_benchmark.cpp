@@ -1,6 +1,11 @@
 #include <userver/utils/small_string.hpp>
 
 #include <array>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/arena.hpp>
 
 #include <utils/gbench_auxilary.hpp>
 
@@ -10,8 +15,48 @@ USERVER_NAMESPACE_BEGIN
 
 namespace {
 constexpr size_t kArraySize = 1000;
+
+// Headers of a typical request from a browser through a balancer
+constexpr std::pair<std::string_view, std::string_view> kRequestHeaders[] = {
+    {"Host", "api.example.com"},
+    {"User-Agent",
+     "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+     "Chrome/118.0.0.0 Safari/537.36"},
+    {"Accept", "application/json, text/plain, */*"},
+    {"Accept-Encoding", "gzip, deflate, br"},
+    {"Accept-Language", "en-US,en;q=0.9"},
+    {"Connection", "keep-alive"},
+    {"Content-Type", "application/json"},
+    {"Content-Length", "348"},
+    {"X-Request-Id", "7f4b3c2a9e1d4f6b8a0c5e7d9b1f3a5c"},
+    {"X-YaTraceId", "0123456789abcdef0123456789abcdef"},
+    {"X-YaSpanId", "0123456789abcdef"},
+    {"X-Forwarded-For", "2001:db8::1, 10.0.0.1"},
+    {"Authorization",
+     "Bearer eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9.eyJzdWIiOiIxMjM0NTY3ODkwIiwi"
+     "bmFtZSI6IkpvaG4gRG9lIiwiaWF0IjoxNTE2MjM5MDIyfQ"},
+    {"Cookie",
+     "session_id=3a7f0c9e2b8d4f1a6c5e0b9d8f7a6c5e; theme=dark; lang=en; "
+     "_ga=GA1.2.1234567890.1234567890; _gid=GA1.2.0987654321.0987654321; "
+     "consent=analytics%2Cads; ab_test=variant_b"},
+};
+
+template <typename HeaderString, typename Allocator>
+auto ParseHeaders(const Allocator& allocator) {
+  using Header = std::pair<HeaderString, HeaderString>;
+  using HeaderAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Header>;
+  std::vector<Header, HeaderAllocator> headers{HeaderAllocator{allocator}};
+  headers.reserve(std::size(kRequestHeaders));
+  for (const auto& [name, value] : kRequestHeaders) {
+    headers.emplace_back(HeaderString{Launder(name), allocator},
+                         HeaderString{Launder(value), allocator});
+  }
+  return headers;
 }
 
+}  // namespace
+
 std::string GenerateString(size_t size) {
   std::string_view chars{"0123456789"};
   std::string result;
@@ -157,4 +202,33 @@ static void SmallStringAppend(benchmark::State& state) {
 }
 BENCHMARK(SmallStringAppend)->Range(2, 2 << 10)->Unit(benchmark::kMicrosecond);
 
+static void SmallString_Headers_Std(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto headers = ParseHeaders<std::string>(std::allocator<char>{});
+    benchmark::DoNotOptimize(headers);
+  }
+}
+BENCHMARK(SmallString_Headers_Std);
+
+static void SmallString_Headers_Small(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto headers =
+        ParseHeaders<utils::SmallString<32>>(std::allocator<char>{});
+    benchmark::DoNotOptimize(headers);
+  }
+}
+BENCHMARK(SmallString_Headers_Small);
+
+static void SmallString_Headers_Arena(benchmark::State& state) {
+  using ArenaString = utils::SmallString<32, utils::ArenaAllocator<char>>;
+  for ([[maybe_unused]] auto _ : state) {
+    // A per-request arena frees all the headers at once
+    utils::Arena arena;
+    auto headers =
+        ParseHeaders<ArenaString>(utils::ArenaAllocator<char>{arena});
+    benchmark::DoNotOptimize(headers);
+  }
+}
+BENCHMARK(SmallString_Headers_Arena);
+
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/arena.hpp>
 #include <userver/utils/small_string.hpp>
 #include <userver/utils/small_string_serialization.hpp>
 
@@ -194,4 +195,27 @@ TEST(SmallString, Indexing) {
   EXPECT_EQ(std::string_view(s.data(), 4), str);
 }
 
+TEST(SmallString, ArenaAllocator) {
+  using ArenaString = utils::SmallString<4, utils::ArenaAllocator<char>>;
+  utils::Arena arena;
+  const utils::ArenaAllocator<char> allocator{arena};
+
+  ArenaString str{"ab", allocator};
+  EXPECT_EQ(arena.GetAllocatedBytes(), 0);
+
+  // small_vector may round the inline storage up
+  str.append("cdefghijklmnopqrstuvwxyz");
+  EXPECT_EQ(str, "abcdefghijklmnopqrstuvwxyz");
+  EXPECT_EQ(arena.GetAllocatedBytes(), utils::Arena::kDefaultBlockSize);
+
+  str = "1234567890123456789012345678901234567890";
+  EXPECT_EQ(str, "1234567890123456789012345678901234567890");
+  EXPECT_EQ(str.get_allocator(), allocator);
+
+  ArenaString copy{str};
+  EXPECT_EQ(copy, str);
+  EXPECT_EQ(copy.get_allocator(), allocator);
+  EXPECT_EQ(arena.GetAllocatedBytes(), utils::Arena::kDefaultBlockSize);
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/utils/trivial_map.hpp>
 
+#include <array>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
@@ -109,6 +110,9 @@ constexpr int kHugeTrivialBiMapValues[] = {
 constexpr auto kHugeTrivialBiMapAlt =
     utils::MakeTrivialBiMap<kHugeTrivialBiMapKeys, kHugeTrivialBiMapValues>();
 
+constexpr utils::TrivialPerfectHashIndex<kHugeTrivialBiMap>
+    kHugeTrivialPerfectHash;
+
 const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_hello", 1}, {"aaaaaaaaaaaaaaaa_world", 2},
     {"aaaaaaaaaaaaaaaa_a", 3},     {"aaaaaaaaaaaaaaaa_b", 4},
@@ -131,6 +135,50 @@ const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_x9", 42},
 };
 
+// Keys of the same length are the worst case for the utils::TrivialBiMap
+constexpr std::size_t kSameLengthKeysCount = 128;
+
+constexpr auto kSameLengthKeysStorage = [] {
+  std::array<std::array<char, 7>, kSameLengthKeysCount> result{};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = {'k', 'e', 'y', '_', static_cast<char>('0' + i / 100),
+                 static_cast<char>('0' + i / 10 % 10),
+                 static_cast<char>('0' + i % 10)};
+  }
+  return result;
+}();
+
+constexpr auto kSameLengthKeys = [] {
+  std::array<std::string_view, kSameLengthKeysCount> result{};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = std::string_view{kSameLengthKeysStorage[i].data(),
+                                 kSameLengthKeysStorage[i].size()};
+  }
+  return result;
+}();
+
+constexpr auto kSameLengthValues = [] {
+  std::array<int, kSameLengthKeysCount> result{};
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = static_cast<int>(i);
+  }
+  return result;
+}();
+
+constexpr auto kSameLengthTrivialBiMap =
+    utils::MakeTrivialBiMap<kSameLengthKeys, kSameLengthValues>();
+
+constexpr utils::TrivialPerfectHashIndex<kSameLengthTrivialBiMap>
+    kSameLengthTrivialPerfectHash;
+
+const auto kSameLengthUnorderedMapping = [] {
+  std::unordered_map<std::string_view, int> result;
+  for (std::size_t i = 0; i < kSameLengthKeysCount; ++i) {
+    result.emplace(kSameLengthKeys[i], kSameLengthValues[i]);
+  }
+  return result;
+}();
+
 enum class Enum1 {
   C1,
   C2,
@@ -429,6 +477,35 @@ void MappingHugeUnordered(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnordered);
 
+void MappingHugeTrivialPerfectHash(benchmark::State& state) {
+  auto hello = MyLaunder("aaaaaaaaaaaaaaaa_hello");
+  auto world = MyLaunder("aaaaaaaaaaaaaaaa_world");
+  auto a = MyLaunder("aaaaaaaaaaaaaaaa_a");
+  auto b = MyLaunder("aaaaaaaaaaaaaaaa_b");
+  auto c = MyLaunder("aaaaaaaaaaaaaaaa_c");
+
+  auto d = MyLaunder("aaaaaaaaaaaaaaaa_d");
+  auto e = MyLaunder("aaaaaaaaaaaaaaaa_e");
+  auto f9 = MyLaunder("aaaaaaaaaaaaaaaa_f9");
+  auto z = MyLaunder("aaaaaaaaaaaaaaaa_z");
+  auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(hello));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(world));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(a));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(b));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(c));
+
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(d));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(e));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(f9));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(z));
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(z9));
+  }
+}
+BENCHMARK(MappingHugeTrivialPerfectHash);
+
 void MappingHugeTrivialBiMapLast(benchmark::State& state) {
   auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
 
@@ -447,6 +524,48 @@ void MappingHugeUnorderedLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnorderedLast);
 
+void MappingHugeTrivialPerfectHashLast(benchmark::State& state) {
+  auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kHugeTrivialPerfectHash.TryFindByFirst(z9));
+  }
+}
+BENCHMARK(MappingHugeTrivialPerfectHashLast);
+
+template <typename Find>
+void MappingSameLength(benchmark::State& state, Find find) {
+  std::array<std::string_view, 4> keys{};
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = MyLaunder(kSameLengthKeys[kSameLengthKeysCount / 4 * i + 7]);
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) benchmark::DoNotOptimize(find(key));
+  }
+}
+
+void MappingSameLengthTrivialBiMap(benchmark::State& state) {
+  MappingSameLength(state, [](std::string_view key) {
+    return kSameLengthTrivialBiMap.TryFind(key);
+  });
+}
+BENCHMARK(MappingSameLengthTrivialBiMap);
+
+void MappingSameLengthTrivialPerfectHash(benchmark::State& state) {
+  MappingSameLength(state, [](std::string_view key) {
+    return kSameLengthTrivialPerfectHash.TryFindByFirst(key);
+  });
+}
+BENCHMARK(MappingSameLengthTrivialPerfectHash);
+
+void MappingSameLengthUnordered(benchmark::State& state) {
+  MappingSameLength(state, [](std::string_view key) {
+    return kSameLengthUnorderedMapping.find(key);
+  });
+}
+BENCHMARK(MappingSameLengthUnordered);
+
 void MappingEnumsTrivialBiMap(benchmark::State& state) {
   const auto enum2 = Launder(Enum2::C7);
 
@@ -165,6 +165,70 @@ TEST(TrivialBiMap, MakeTrivialBiMap) {
   EXPECT_EQ(kMap.TryFind(42), std::nullopt);
 }
 
+/// [sample perfect hash]
+constexpr utils::TrivialBiMap kHeaderToId = [](auto selector) {
+  return selector()
+      .Case("x-request-id", 1)
+      .Case("x-backend-id", 2)
+      .Case("x-span-id-ok", 3)
+      .Case("x-trace-ids1", 4)
+      .Case("x-request-id", 5);  // duplicate, never found
+};
+
+constexpr utils::TrivialPerfectHashIndex<kHeaderToId> kHeaderToIdIndex;
+
+TEST(TrivialPerfectHashIndex, Basic) {
+  static_assert(kHeaderToIdIndex.TryFindByFirst("x-backend-id") == 2);
+
+  EXPECT_EQ(kHeaderToIdIndex.TryFindByFirst("x-request-id"), 1);
+  EXPECT_EQ(kHeaderToIdIndex.TryFindByFirst("x-trace-ids1"), 4);
+  EXPECT_EQ(kHeaderToIdIndex.TryFindByFirst("x-trace-ids2"), std::nullopt);
+  EXPECT_EQ(kHeaderToIdIndex.TryFindByFirst(""), std::nullopt);
+}
+/// [sample perfect hash]
+
+constexpr utils::TrivialSet kLetters = [](auto selector) {
+  return selector().Case("a").Case("b").Case("c");
+};
+
+TEST(TrivialPerfectHashIndex, Set) {
+  static constexpr utils::TrivialPerfectHashIndex<kLetters> kIndex;
+
+  EXPECT_TRUE(kIndex.Contains("a"));
+  EXPECT_TRUE(kIndex.Contains("c"));
+  EXPECT_FALSE(kIndex.Contains("d"));
+  EXPECT_FALSE(kIndex.Contains("ab"));
+  EXPECT_EQ(kIndex.size(), kLetters.size());
+}
+
+constexpr std::string_view kManyKeys[] = {
+    "key_00", "key_01", "key_02", "key_03", "key_04", "key_05", "key_06",
+    "key_07", "key_08", "key_09", "key_10", "key_11", "key_12", "key_13",
+    "key_14", "key_15", "key_16", "key_17", "key_18", "key_19", "key_20",
+    "key_21", "key_22", "key_23", "key_24", "key_25", "key_26", "key_27",
+    "key_28", "key_29", "key_30", "key_31", "key_32", "key_33", "key_34",
+    "key_35", "key_36", "key_37", "key_38", "key_39", "key_40", "key_41",
+};
+
+constexpr int kManyValues[] = {
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+};
+
+constexpr auto kManyMap = utils::MakeTrivialBiMap<kManyKeys, kManyValues>();
+
+TEST(TrivialPerfectHashIndex, ManyKeys) {
+  static constexpr utils::TrivialPerfectHashIndex<kManyMap> kIndex;
+
+  for (std::size_t i = 0; i < std::size(kManyKeys); ++i) {
+    EXPECT_EQ(kIndex.TryFindByFirst(kManyKeys[i]), kManyValues[i]);
+    EXPECT_EQ(kIndex.TryFindByFirst(std::string{kManyKeys[i]} + "0"),
+              std::nullopt);
+  }
+  EXPECT_EQ(kIndex.TryFindByFirst("key_42"), std::nullopt);
+}
+
 TEST(TrivialBiMap, FindICaseBySecond) {
   static constexpr utils::TrivialBiMap kNumToGerman = [](auto selector) {
     return selector().Case(0, "null").Case(1, "eins").Case(2, "zwei").Case(